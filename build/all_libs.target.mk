@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := all_libs
+### Rules for final target.
+$(obj).target/all_libs.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/all_libs.stamp: $(obj).target/groups/groups_all_libs.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/all_libs.stamp
+# Add target alias
+.PHONY: all_libs
+all_libs: $(obj).target/all_libs.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: all_libs
+
@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := all_tests_run
+### Rules for final target.
+$(obj).target/all_tests_run.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/all_tests_run.stamp: $(obj).target/groups/groups_all_tests_run.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/all_tests_run.stamp
+# Add target alias
+.PHONY: all_tests_run
+all_tests_run: $(obj).target/all_tests_run.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: all_tests_run
+
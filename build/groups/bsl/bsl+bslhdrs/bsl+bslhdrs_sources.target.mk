@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bsl+bslhdrs_sources
+### Rules for final target.
+$(obj).target/groups/bsl/bsl+bslhdrs/bsl+bslhdrs_sources.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bsl+bslhdrs/bsl+bslhdrs_sources.stamp:  FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bsl+bslhdrs/bsl+bslhdrs_sources.stamp
+# Add target alias
+.PHONY: bsl+bslhdrs_sources
+bsl+bslhdrs_sources: $(obj).target/groups/bsl/bsl+bslhdrs/bsl+bslhdrs_sources.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bsl+bslhdrs_sources
+
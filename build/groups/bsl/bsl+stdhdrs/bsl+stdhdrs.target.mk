@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bsl+stdhdrs
+### Rules for final target.
+$(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs.stamp: $(obj).target/groups/bsl/bsl_grpdeps.stamp $(obj).target/groups/bsl/bsl+bslhdrs/bsl+bslhdrs.stamp $(obj).target/groups/bsl/bslscm/libbslscm.a $(obj).target/groups/bsl/bslstl/libbslstl.a $(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs_sources.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs.stamp
+# Add target alias
+.PHONY: bsl+stdhdrs
+bsl+stdhdrs: $(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bsl+stdhdrs
+
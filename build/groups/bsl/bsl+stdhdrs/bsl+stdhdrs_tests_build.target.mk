@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bsl+stdhdrs_tests_build
+### Rules for final target.
+$(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs_tests_build.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs_tests_build.stamp:  FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs_tests_build.stamp
+# Add target alias
+.PHONY: bsl+stdhdrs_tests_build
+bsl+stdhdrs_tests_build: $(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs_tests_build.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bsl+stdhdrs_tests_build
+
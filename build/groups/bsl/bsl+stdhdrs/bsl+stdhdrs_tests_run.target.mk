@@ -0,0 +1,31 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bsl+stdhdrs_tests_run
+### Generated for rule _root_repo_groups_bsl_bsl_stdhdrs_bsl_stdhdrs_gyp_bsl_stdhdrs_tests_run_target_run_unit_tests:
+rule__root_repo_groups_bsl_bsl_stdhdrs_bsl_stdhdrs_gyp_bsl_stdhdrs_tests_run_target_run_unit_tests_outputs :=
+
+### Finished generating for rule: _root_repo_groups_bsl_bsl_stdhdrs_bsl_stdhdrs_gyp_bsl_stdhdrs_tests_run_target_run_unit_tests
+
+### Finished generating for all rules
+
+### Rules for final target.
+# Build our special outputs first.
+$(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs_tests_run.stamp: | $(rule__root_repo_groups_bsl_bsl_stdhdrs_bsl_stdhdrs_gyp_bsl_stdhdrs_tests_run_target_run_unit_tests_outputs)
+
+# Preserve order dependency of special output on deps.
+$(rule__root_repo_groups_bsl_bsl_stdhdrs_bsl_stdhdrs_gyp_bsl_stdhdrs_tests_run_target_run_unit_tests_outputs): | $(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs_tests_build.stamp
+
+$(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs_tests_run.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs_tests_run.stamp: $(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs_tests_build.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs_tests_run.stamp
+# Add target alias
+.PHONY: bsl+stdhdrs_tests_run
+bsl+stdhdrs_tests_run: $(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs_tests_run.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bsl+stdhdrs_tests_run
+
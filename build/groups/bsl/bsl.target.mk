@@ -0,0 +1,1985 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bsl
+### Generated for copy rule.
+/root/repo/build/include/bsl_algorithm.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_algorithm.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_algorithm.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_algorithm.h
+/root/repo/build/include/bsl_bitset.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_bitset.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_bitset.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_bitset.h
+/root/repo/build/include/bsl_c_assert.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_assert.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_assert.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_assert.h
+/root/repo/build/include/bsl_c_ctype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_ctype.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_ctype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_ctype.h
+/root/repo/build/include/bsl_c_errno.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_errno.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_errno.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_errno.h
+/root/repo/build/include/bsl_c_float.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_float.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_float.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_float.h
+/root/repo/build/include/bsl_c_iso646.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_iso646.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_iso646.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_iso646.h
+/root/repo/build/include/bsl_c_limits.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_limits.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_limits.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_limits.h
+/root/repo/build/include/bsl_c_locale.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_locale.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_locale.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_locale.h
+/root/repo/build/include/bsl_c_math.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_math.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_math.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_math.h
+/root/repo/build/include/bsl_c_setjmp.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_setjmp.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_setjmp.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_setjmp.h
+/root/repo/build/include/bsl_c_signal.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_signal.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_signal.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_signal.h
+/root/repo/build/include/bsl_c_stdarg.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_stdarg.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_stdarg.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_stdarg.h
+/root/repo/build/include/bsl_c_stddef.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_stddef.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_stddef.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_stddef.h
+/root/repo/build/include/bsl_c_stdio.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_stdio.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_stdio.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_stdio.h
+/root/repo/build/include/bsl_c_stdlib.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_stdlib.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_stdlib.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_stdlib.h
+/root/repo/build/include/bsl_c_string.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_string.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_string.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_string.h
+/root/repo/build/include/bsl_c_sys_time.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_sys_time.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_sys_time.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_sys_time.h
+/root/repo/build/include/bsl_c_time.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_time.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_time.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_time.h
+/root/repo/build/include/bsl_c_wchar.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_wchar.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_wchar.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_wchar.h
+/root/repo/build/include/bsl_c_wctype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_c_wctype.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_c_wctype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_c_wctype.h
+/root/repo/build/include/bsl_cassert.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_cassert.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_cassert.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_cassert.h
+/root/repo/build/include/bsl_cctype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_cctype.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_cctype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_cctype.h
+/root/repo/build/include/bsl_cerrno.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_cerrno.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_cerrno.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_cerrno.h
+/root/repo/build/include/bsl_cfloat.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_cfloat.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_cfloat.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_cfloat.h
+/root/repo/build/include/bsl_ciso646.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_ciso646.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_ciso646.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_ciso646.h
+/root/repo/build/include/bsl_climits.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_climits.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_climits.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_climits.h
+/root/repo/build/include/bsl_clocale.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_clocale.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_clocale.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_clocale.h
+/root/repo/build/include/bsl_cmath.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_cmath.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_cmath.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_cmath.h
+/root/repo/build/include/bsl_complex.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_complex.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_complex.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_complex.h
+/root/repo/build/include/bsl_csetjmp.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_csetjmp.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_csetjmp.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_csetjmp.h
+/root/repo/build/include/bsl_csignal.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_csignal.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_csignal.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_csignal.h
+/root/repo/build/include/bsl_cstdarg.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_cstdarg.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_cstdarg.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_cstdarg.h
+/root/repo/build/include/bsl_cstddef.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_cstddef.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_cstddef.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_cstddef.h
+/root/repo/build/include/bsl_cstdio.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_cstdio.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_cstdio.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_cstdio.h
+/root/repo/build/include/bsl_cstdlib.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_cstdlib.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_cstdlib.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_cstdlib.h
+/root/repo/build/include/bsl_cstring.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_cstring.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_cstring.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_cstring.h
+/root/repo/build/include/bsl_ctime.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_ctime.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_ctime.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_ctime.h
+/root/repo/build/include/bsl_cwchar.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_cwchar.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_cwchar.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_cwchar.h
+/root/repo/build/include/bsl_cwctype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_cwctype.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_cwctype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_cwctype.h
+/root/repo/build/include/bsl_deque.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_deque.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_deque.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_deque.h
+/root/repo/build/include/bsl_exception.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_exception.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_exception.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_exception.h
+/root/repo/build/include/bsl_fstream.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_fstream.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_fstream.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_fstream.h
+/root/repo/build/include/bsl_functional.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_functional.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_functional.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_functional.h
+/root/repo/build/include/bsl_iomanip.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_iomanip.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_iomanip.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_iomanip.h
+/root/repo/build/include/bsl_ios.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_ios.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_ios.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_ios.h
+/root/repo/build/include/bsl_iosfwd.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_iosfwd.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_iosfwd.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_iosfwd.h
+/root/repo/build/include/bsl_iostream.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_iostream.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_iostream.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_iostream.h
+/root/repo/build/include/bsl_istream.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_istream.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_istream.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_istream.h
+/root/repo/build/include/bsl_iterator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_iterator.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_iterator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_iterator.h
+/root/repo/build/include/bsl_limits.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_limits.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_limits.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_limits.h
+/root/repo/build/include/bsl_list.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_list.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_list.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_list.h
+/root/repo/build/include/bsl_locale.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_locale.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_locale.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_locale.h
+/root/repo/build/include/bsl_map.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_map.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_map.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_map.h
+/root/repo/build/include/bsl_memory.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_memory.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_memory.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_memory.h
+/root/repo/build/include/bsl_new.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_new.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_new.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_new.h
+/root/repo/build/include/bsl_numeric.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_numeric.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_numeric.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_numeric.h
+/root/repo/build/include/bsl_ostream.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_ostream.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_ostream.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_ostream.h
+/root/repo/build/include/bsl_queue.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_queue.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_queue.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_queue.h
+/root/repo/build/include/bsl_set.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_set.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_set.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_set.h
+/root/repo/build/include/bsl_sstream.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_sstream.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_sstream.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_sstream.h
+/root/repo/build/include/bsl_stack.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_stack.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_stack.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_stack.h
+/root/repo/build/include/bsl_stdexcept.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_stdexcept.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_stdexcept.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_stdexcept.h
+/root/repo/build/include/bsl_streambuf.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_streambuf.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_streambuf.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_streambuf.h
+/root/repo/build/include/bsl_string.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_string.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_string.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_string.h
+/root/repo/build/include/bsl_strstream.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_strstream.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_strstream.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_strstream.h
+/root/repo/build/include/bsl_typeinfo.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_typeinfo.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_typeinfo.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_typeinfo.h
+/root/repo/build/include/bsl_unordered_map.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_unordered_map.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_unordered_map.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_unordered_map.h
+/root/repo/build/include/bsl_unordered_set.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_unordered_set.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_unordered_set.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_unordered_set.h
+/root/repo/build/include/bsl_utility.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_utility.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_utility.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_utility.h
+/root/repo/build/include/bsl_valarray.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_valarray.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_valarray.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_valarray.h
+/root/repo/build/include/bsl_vector.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsl_vector.h: $(srcdir)/groups/bsl/bsl+bslhdrs/bsl_vector.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsl_vector.h
+/root/repo/build/include/bslalg_arraydestructionprimitives.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_arraydestructionprimitives.h: $(srcdir)/groups/bsl/bslalg/bslalg_arraydestructionprimitives.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_arraydestructionprimitives.h
+/root/repo/build/include/bslalg_arrayprimitives.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_arrayprimitives.h: $(srcdir)/groups/bsl/bslalg/bslalg_arrayprimitives.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_arrayprimitives.h
+/root/repo/build/include/bslalg_autoarraydestructor.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_autoarraydestructor.h: $(srcdir)/groups/bsl/bslalg/bslalg_autoarraydestructor.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_autoarraydestructor.h
+/root/repo/build/include/bslalg_autoarraymovedestructor.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_autoarraymovedestructor.h: $(srcdir)/groups/bsl/bslalg/bslalg_autoarraymovedestructor.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_autoarraymovedestructor.h
+/root/repo/build/include/bslalg_autoscalardestructor.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_autoscalardestructor.h: $(srcdir)/groups/bsl/bslalg/bslalg_autoscalardestructor.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_autoscalardestructor.h
+/root/repo/build/include/bslalg_bidirectionallink.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_bidirectionallink.h: $(srcdir)/groups/bsl/bslalg/bslalg_bidirectionallink.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_bidirectionallink.h
+/root/repo/build/include/bslalg_bidirectionallinklistutil.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_bidirectionallinklistutil.h: $(srcdir)/groups/bsl/bslalg/bslalg_bidirectionallinklistutil.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_bidirectionallinklistutil.h
+/root/repo/build/include/bslalg_bidirectionalnode.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_bidirectionalnode.h: $(srcdir)/groups/bsl/bslalg/bslalg_bidirectionalnode.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_bidirectionalnode.h
+/root/repo/build/include/bslalg_constructorproxy.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_constructorproxy.h: $(srcdir)/groups/bsl/bslalg/bslalg_constructorproxy.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_constructorproxy.h
+/root/repo/build/include/bslalg_containerbase.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_containerbase.h: $(srcdir)/groups/bsl/bslalg/bslalg_containerbase.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_containerbase.h
+/root/repo/build/include/bslalg_dequeimputil.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_dequeimputil.h: $(srcdir)/groups/bsl/bslalg/bslalg_dequeimputil.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_dequeimputil.h
+/root/repo/build/include/bslalg_dequeiterator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_dequeiterator.h: $(srcdir)/groups/bsl/bslalg/bslalg_dequeiterator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_dequeiterator.h
+/root/repo/build/include/bslalg_dequeprimitives.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_dequeprimitives.h: $(srcdir)/groups/bsl/bslalg/bslalg_dequeprimitives.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_dequeprimitives.h
+/root/repo/build/include/bslalg_functoradapter.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_functoradapter.h: $(srcdir)/groups/bsl/bslalg/bslalg_functoradapter.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_functoradapter.h
+/root/repo/build/include/bslalg_hashtableanchor.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_hashtableanchor.h: $(srcdir)/groups/bsl/bslalg/bslalg_hashtableanchor.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_hashtableanchor.h
+/root/repo/build/include/bslalg_hashtablebucket.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_hashtablebucket.h: $(srcdir)/groups/bsl/bslalg/bslalg_hashtablebucket.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_hashtablebucket.h
+/root/repo/build/include/bslalg_hashtableimputil.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_hashtableimputil.h: $(srcdir)/groups/bsl/bslalg/bslalg_hashtableimputil.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_hashtableimputil.h
+/root/repo/build/include/bslalg_hashutil.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_hashutil.h: $(srcdir)/groups/bsl/bslalg/bslalg_hashutil.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_hashutil.h
+/root/repo/build/include/bslalg_hastrait.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_hastrait.h: $(srcdir)/groups/bsl/bslalg/bslalg_hastrait.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_hastrait.h
+/root/repo/build/include/bslalg_rangecompare.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_rangecompare.h: $(srcdir)/groups/bsl/bslalg/bslalg_rangecompare.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_rangecompare.h
+/root/repo/build/include/bslalg_rbtreeanchor.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_rbtreeanchor.h: $(srcdir)/groups/bsl/bslalg/bslalg_rbtreeanchor.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_rbtreeanchor.h
+/root/repo/build/include/bslalg_rbtreenode.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_rbtreenode.h: $(srcdir)/groups/bsl/bslalg/bslalg_rbtreenode.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_rbtreenode.h
+/root/repo/build/include/bslalg_rbtreeutil.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_rbtreeutil.h: $(srcdir)/groups/bsl/bslalg/bslalg_rbtreeutil.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_rbtreeutil.h
+/root/repo/build/include/bslalg_scalardestructionprimitives.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_scalardestructionprimitives.h: $(srcdir)/groups/bsl/bslalg/bslalg_scalardestructionprimitives.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_scalardestructionprimitives.h
+/root/repo/build/include/bslalg_scalarprimitives.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_scalarprimitives.h: $(srcdir)/groups/bsl/bslalg/bslalg_scalarprimitives.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_scalarprimitives.h
+/root/repo/build/include/bslalg_selecttrait.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_selecttrait.h: $(srcdir)/groups/bsl/bslalg/bslalg_selecttrait.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_selecttrait.h
+/root/repo/build/include/bslalg_swaputil.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_swaputil.h: $(srcdir)/groups/bsl/bslalg/bslalg_swaputil.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_swaputil.h
+/root/repo/build/include/bslalg_typetraitbitwisecopyable.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_typetraitbitwisecopyable.h: $(srcdir)/groups/bsl/bslalg/bslalg_typetraitbitwisecopyable.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_typetraitbitwisecopyable.h
+/root/repo/build/include/bslalg_typetraitbitwiseequalitycomparable.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_typetraitbitwiseequalitycomparable.h: $(srcdir)/groups/bsl/bslalg/bslalg_typetraitbitwiseequalitycomparable.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_typetraitbitwiseequalitycomparable.h
+/root/repo/build/include/bslalg_typetraitbitwisemoveable.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_typetraitbitwisemoveable.h: $(srcdir)/groups/bsl/bslalg/bslalg_typetraitbitwisemoveable.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_typetraitbitwisemoveable.h
+/root/repo/build/include/bslalg_typetraithaspointersemantics.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_typetraithaspointersemantics.h: $(srcdir)/groups/bsl/bslalg/bslalg_typetraithaspointersemantics.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_typetraithaspointersemantics.h
+/root/repo/build/include/bslalg_typetraithasstliterators.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_typetraithasstliterators.h: $(srcdir)/groups/bsl/bslalg/bslalg_typetraithasstliterators.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_typetraithasstliterators.h
+/root/repo/build/include/bslalg_typetraithastrivialdefaultconstructor.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_typetraithastrivialdefaultconstructor.h: $(srcdir)/groups/bsl/bslalg/bslalg_typetraithastrivialdefaultconstructor.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_typetraithastrivialdefaultconstructor.h
+/root/repo/build/include/bslalg_typetraitnil.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_typetraitnil.h: $(srcdir)/groups/bsl/bslalg/bslalg_typetraitnil.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_typetraitnil.h
+/root/repo/build/include/bslalg_typetraitpair.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_typetraitpair.h: $(srcdir)/groups/bsl/bslalg/bslalg_typetraitpair.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_typetraitpair.h
+/root/repo/build/include/bslalg_typetraits.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_typetraits.h: $(srcdir)/groups/bsl/bslalg/bslalg_typetraits.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_typetraits.h
+/root/repo/build/include/bslalg_typetraitusesbslmaallocator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslalg_typetraitusesbslmaallocator.h: $(srcdir)/groups/bsl/bslalg/bslalg_typetraitusesbslmaallocator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslalg_typetraitusesbslmaallocator.h
+/root/repo/build/include/bsldoc_glossary.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsldoc_glossary.h: $(srcdir)/groups/bsl/bsldoc/bsldoc_glossary.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsldoc_glossary.h
+/root/repo/build/include/bslim_printer.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslim_printer.h: $(srcdir)/groups/bsl/bslim/bslim_printer.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslim_printer.h
+/root/repo/build/include/bslma_allocator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_allocator.h: $(srcdir)/groups/bsl/bslma/bslma_allocator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_allocator.h
+/root/repo/build/include/bslma_autodeallocator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_autodeallocator.h: $(srcdir)/groups/bsl/bslma/bslma_autodeallocator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_autodeallocator.h
+/root/repo/build/include/bslma_autodestructor.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_autodestructor.h: $(srcdir)/groups/bsl/bslma/bslma_autodestructor.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_autodestructor.h
+/root/repo/build/include/bslma_autorawdeleter.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_autorawdeleter.h: $(srcdir)/groups/bsl/bslma/bslma_autorawdeleter.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_autorawdeleter.h
+/root/repo/build/include/bslma_deallocatorguard.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_deallocatorguard.h: $(srcdir)/groups/bsl/bslma/bslma_deallocatorguard.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_deallocatorguard.h
+/root/repo/build/include/bslma_deallocatorproctor.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_deallocatorproctor.h: $(srcdir)/groups/bsl/bslma/bslma_deallocatorproctor.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_deallocatorproctor.h
+/root/repo/build/include/bslma_default.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_default.h: $(srcdir)/groups/bsl/bslma/bslma_default.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_default.h
+/root/repo/build/include/bslma_defaultallocatorguard.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_defaultallocatorguard.h: $(srcdir)/groups/bsl/bslma/bslma_defaultallocatorguard.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_defaultallocatorguard.h
+/root/repo/build/include/bslma_deleterhelper.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_deleterhelper.h: $(srcdir)/groups/bsl/bslma/bslma_deleterhelper.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_deleterhelper.h
+/root/repo/build/include/bslma_destructorguard.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_destructorguard.h: $(srcdir)/groups/bsl/bslma/bslma_destructorguard.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_destructorguard.h
+/root/repo/build/include/bslma_destructorproctor.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_destructorproctor.h: $(srcdir)/groups/bsl/bslma/bslma_destructorproctor.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_destructorproctor.h
+/root/repo/build/include/bslma_exceptionguard.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_exceptionguard.h: $(srcdir)/groups/bsl/bslma/bslma_exceptionguard.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_exceptionguard.h
+/root/repo/build/include/bslma_mallocfreeallocator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_mallocfreeallocator.h: $(srcdir)/groups/bsl/bslma/bslma_mallocfreeallocator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_mallocfreeallocator.h
+/root/repo/build/include/bslma_newdeleteallocator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_newdeleteallocator.h: $(srcdir)/groups/bsl/bslma/bslma_newdeleteallocator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_newdeleteallocator.h
+/root/repo/build/include/bslma_rawdeleterguard.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_rawdeleterguard.h: $(srcdir)/groups/bsl/bslma/bslma_rawdeleterguard.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_rawdeleterguard.h
+/root/repo/build/include/bslma_rawdeleterproctor.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_rawdeleterproctor.h: $(srcdir)/groups/bsl/bslma/bslma_rawdeleterproctor.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_rawdeleterproctor.h
+/root/repo/build/include/bslma_testallocator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_testallocator.h: $(srcdir)/groups/bsl/bslma/bslma_testallocator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_testallocator.h
+/root/repo/build/include/bslma_testallocatorexception.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_testallocatorexception.h: $(srcdir)/groups/bsl/bslma/bslma_testallocatorexception.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_testallocatorexception.h
+/root/repo/build/include/bslma_testallocatormonitor.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_testallocatormonitor.h: $(srcdir)/groups/bsl/bslma/bslma_testallocatormonitor.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_testallocatormonitor.h
+/root/repo/build/include/bslma_usesbslmaallocator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslma_usesbslmaallocator.h: $(srcdir)/groups/bsl/bslma/bslma_usesbslmaallocator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslma_usesbslmaallocator.h
+/root/repo/build/include/bslmf_addconst.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_addconst.h: $(srcdir)/groups/bsl/bslmf/bslmf_addconst.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_addconst.h
+/root/repo/build/include/bslmf_addcv.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_addcv.h: $(srcdir)/groups/bsl/bslmf/bslmf_addcv.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_addcv.h
+/root/repo/build/include/bslmf_addlvaluereference.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_addlvaluereference.h: $(srcdir)/groups/bsl/bslmf/bslmf_addlvaluereference.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_addlvaluereference.h
+/root/repo/build/include/bslmf_addpointer.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_addpointer.h: $(srcdir)/groups/bsl/bslmf/bslmf_addpointer.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_addpointer.h
+/root/repo/build/include/bslmf_addreference.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_addreference.h: $(srcdir)/groups/bsl/bslmf/bslmf_addreference.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_addreference.h
+/root/repo/build/include/bslmf_addrvaluereference.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_addrvaluereference.h: $(srcdir)/groups/bsl/bslmf/bslmf_addrvaluereference.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_addrvaluereference.h
+/root/repo/build/include/bslmf_addvolatile.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_addvolatile.h: $(srcdir)/groups/bsl/bslmf/bslmf_addvolatile.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_addvolatile.h
+/root/repo/build/include/bslmf_arraytopointer.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_arraytopointer.h: $(srcdir)/groups/bsl/bslmf/bslmf_arraytopointer.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_arraytopointer.h
+/root/repo/build/include/bslmf_assert.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_assert.h: $(srcdir)/groups/bsl/bslmf/bslmf_assert.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_assert.h
+/root/repo/build/include/bslmf_conditional.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_conditional.h: $(srcdir)/groups/bsl/bslmf/bslmf_conditional.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_conditional.h
+/root/repo/build/include/bslmf_detectnestedtrait.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_detectnestedtrait.h: $(srcdir)/groups/bsl/bslmf/bslmf_detectnestedtrait.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_detectnestedtrait.h
+/root/repo/build/include/bslmf_enableif.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_enableif.h: $(srcdir)/groups/bsl/bslmf/bslmf_enableif.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_enableif.h
+/root/repo/build/include/bslmf_forwardingtype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_forwardingtype.h: $(srcdir)/groups/bsl/bslmf/bslmf_forwardingtype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_forwardingtype.h
+/root/repo/build/include/bslmf_functionpointertraits.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_functionpointertraits.h: $(srcdir)/groups/bsl/bslmf/bslmf_functionpointertraits.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_functionpointertraits.h
+/root/repo/build/include/bslmf_haspointersemantics.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_haspointersemantics.h: $(srcdir)/groups/bsl/bslmf/bslmf_haspointersemantics.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_haspointersemantics.h
+/root/repo/build/include/bslmf_if.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_if.h: $(srcdir)/groups/bsl/bslmf/bslmf_if.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_if.h
+/root/repo/build/include/bslmf_integralconstant.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_integralconstant.h: $(srcdir)/groups/bsl/bslmf/bslmf_integralconstant.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_integralconstant.h
+/root/repo/build/include/bslmf_isarithmetic.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isarithmetic.h: $(srcdir)/groups/bsl/bslmf/bslmf_isarithmetic.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isarithmetic.h
+/root/repo/build/include/bslmf_isarray.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isarray.h: $(srcdir)/groups/bsl/bslmf/bslmf_isarray.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isarray.h
+/root/repo/build/include/bslmf_isbitwiseequalitycomparable.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isbitwiseequalitycomparable.h: $(srcdir)/groups/bsl/bslmf/bslmf_isbitwiseequalitycomparable.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isbitwiseequalitycomparable.h
+/root/repo/build/include/bslmf_isbitwisemoveable.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isbitwisemoveable.h: $(srcdir)/groups/bsl/bslmf/bslmf_isbitwisemoveable.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isbitwisemoveable.h
+/root/repo/build/include/bslmf_isclass.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isclass.h: $(srcdir)/groups/bsl/bslmf/bslmf_isclass.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isclass.h
+/root/repo/build/include/bslmf_isconst.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isconst.h: $(srcdir)/groups/bsl/bslmf/bslmf_isconst.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isconst.h
+/root/repo/build/include/bslmf_isconvertible.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isconvertible.h: $(srcdir)/groups/bsl/bslmf/bslmf_isconvertible.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isconvertible.h
+/root/repo/build/include/bslmf_isconvertibletoany.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isconvertibletoany.h: $(srcdir)/groups/bsl/bslmf/bslmf_isconvertibletoany.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isconvertibletoany.h
+/root/repo/build/include/bslmf_isenum.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isenum.h: $(srcdir)/groups/bsl/bslmf/bslmf_isenum.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isenum.h
+/root/repo/build/include/bslmf_isfloatingpoint.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isfloatingpoint.h: $(srcdir)/groups/bsl/bslmf/bslmf_isfloatingpoint.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isfloatingpoint.h
+/root/repo/build/include/bslmf_isfunction.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isfunction.h: $(srcdir)/groups/bsl/bslmf/bslmf_isfunction.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isfunction.h
+/root/repo/build/include/bslmf_isfundamental.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isfundamental.h: $(srcdir)/groups/bsl/bslmf/bslmf_isfundamental.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isfundamental.h
+/root/repo/build/include/bslmf_isintegral.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isintegral.h: $(srcdir)/groups/bsl/bslmf/bslmf_isintegral.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isintegral.h
+/root/repo/build/include/bslmf_islvaluereference.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_islvaluereference.h: $(srcdir)/groups/bsl/bslmf/bslmf_islvaluereference.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_islvaluereference.h
+/root/repo/build/include/bslmf_ismemberfunctionpointer.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_ismemberfunctionpointer.h: $(srcdir)/groups/bsl/bslmf/bslmf_ismemberfunctionpointer.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_ismemberfunctionpointer.h
+/root/repo/build/include/bslmf_ismemberobjectpointer.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_ismemberobjectpointer.h: $(srcdir)/groups/bsl/bslmf/bslmf_ismemberobjectpointer.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_ismemberobjectpointer.h
+/root/repo/build/include/bslmf_ismemberpointer.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_ismemberpointer.h: $(srcdir)/groups/bsl/bslmf/bslmf_ismemberpointer.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_ismemberpointer.h
+/root/repo/build/include/bslmf_ispair.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_ispair.h: $(srcdir)/groups/bsl/bslmf/bslmf_ispair.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_ispair.h
+/root/repo/build/include/bslmf_ispointer.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_ispointer.h: $(srcdir)/groups/bsl/bslmf/bslmf_ispointer.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_ispointer.h
+/root/repo/build/include/bslmf_ispointertomember.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_ispointertomember.h: $(srcdir)/groups/bsl/bslmf/bslmf_ispointertomember.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_ispointertomember.h
+/root/repo/build/include/bslmf_ispolymorphic.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_ispolymorphic.h: $(srcdir)/groups/bsl/bslmf/bslmf_ispolymorphic.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_ispolymorphic.h
+/root/repo/build/include/bslmf_isreference.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isreference.h: $(srcdir)/groups/bsl/bslmf/bslmf_isreference.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isreference.h
+/root/repo/build/include/bslmf_isrvaluereference.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isrvaluereference.h: $(srcdir)/groups/bsl/bslmf/bslmf_isrvaluereference.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isrvaluereference.h
+/root/repo/build/include/bslmf_issame.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_issame.h: $(srcdir)/groups/bsl/bslmf/bslmf_issame.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_issame.h
+/root/repo/build/include/bslmf_istriviallycopyable.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_istriviallycopyable.h: $(srcdir)/groups/bsl/bslmf/bslmf_istriviallycopyable.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_istriviallycopyable.h
+/root/repo/build/include/bslmf_istriviallydefaultconstructible.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_istriviallydefaultconstructible.h: $(srcdir)/groups/bsl/bslmf/bslmf_istriviallydefaultconstructible.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_istriviallydefaultconstructible.h
+/root/repo/build/include/bslmf_isvoid.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isvoid.h: $(srcdir)/groups/bsl/bslmf/bslmf_isvoid.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isvoid.h
+/root/repo/build/include/bslmf_isvolatile.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_isvolatile.h: $(srcdir)/groups/bsl/bslmf/bslmf_isvolatile.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_isvolatile.h
+/root/repo/build/include/bslmf_matchanytype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_matchanytype.h: $(srcdir)/groups/bsl/bslmf/bslmf_matchanytype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_matchanytype.h
+/root/repo/build/include/bslmf_matcharithmetictype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_matcharithmetictype.h: $(srcdir)/groups/bsl/bslmf/bslmf_matcharithmetictype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_matcharithmetictype.h
+/root/repo/build/include/bslmf_memberfunctionpointertraits.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_memberfunctionpointertraits.h: $(srcdir)/groups/bsl/bslmf/bslmf_memberfunctionpointertraits.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_memberfunctionpointertraits.h
+/root/repo/build/include/bslmf_metaint.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_metaint.h: $(srcdir)/groups/bsl/bslmf/bslmf_metaint.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_metaint.h
+/root/repo/build/include/bslmf_nestedtraitdeclaration.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_nestedtraitdeclaration.h: $(srcdir)/groups/bsl/bslmf/bslmf_nestedtraitdeclaration.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_nestedtraitdeclaration.h
+/root/repo/build/include/bslmf_nil.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_nil.h: $(srcdir)/groups/bsl/bslmf/bslmf_nil.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_nil.h
+/root/repo/build/include/bslmf_removeconst.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_removeconst.h: $(srcdir)/groups/bsl/bslmf/bslmf_removeconst.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_removeconst.h
+/root/repo/build/include/bslmf_removecv.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_removecv.h: $(srcdir)/groups/bsl/bslmf/bslmf_removecv.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_removecv.h
+/root/repo/build/include/bslmf_removecvq.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_removecvq.h: $(srcdir)/groups/bsl/bslmf/bslmf_removecvq.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_removecvq.h
+/root/repo/build/include/bslmf_removepointer.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_removepointer.h: $(srcdir)/groups/bsl/bslmf/bslmf_removepointer.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_removepointer.h
+/root/repo/build/include/bslmf_removereference.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_removereference.h: $(srcdir)/groups/bsl/bslmf/bslmf_removereference.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_removereference.h
+/root/repo/build/include/bslmf_removevolatile.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_removevolatile.h: $(srcdir)/groups/bsl/bslmf/bslmf_removevolatile.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_removevolatile.h
+/root/repo/build/include/bslmf_selecttrait.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_selecttrait.h: $(srcdir)/groups/bsl/bslmf/bslmf_selecttrait.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_selecttrait.h
+/root/repo/build/include/bslmf_switch.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_switch.h: $(srcdir)/groups/bsl/bslmf/bslmf_switch.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_switch.h
+/root/repo/build/include/bslmf_tag.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_tag.h: $(srcdir)/groups/bsl/bslmf/bslmf_tag.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_tag.h
+/root/repo/build/include/bslmf_typelist.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslmf_typelist.h: $(srcdir)/groups/bsl/bslmf/bslmf_typelist.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslmf_typelist.h
+/root/repo/build/include/bsls_alignedbuffer.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_alignedbuffer.h: $(srcdir)/groups/bsl/bsls/bsls_alignedbuffer.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_alignedbuffer.h
+/root/repo/build/include/bsls_alignment.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_alignment.h: $(srcdir)/groups/bsl/bsls/bsls_alignment.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_alignment.h
+/root/repo/build/include/bsls_alignmentfromtype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_alignmentfromtype.h: $(srcdir)/groups/bsl/bsls/bsls_alignmentfromtype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_alignmentfromtype.h
+/root/repo/build/include/bsls_alignmentimp.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_alignmentimp.h: $(srcdir)/groups/bsl/bsls/bsls_alignmentimp.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_alignmentimp.h
+/root/repo/build/include/bsls_alignmenttotype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_alignmenttotype.h: $(srcdir)/groups/bsl/bsls/bsls_alignmenttotype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_alignmenttotype.h
+/root/repo/build/include/bsls_alignmentutil.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_alignmentutil.h: $(srcdir)/groups/bsl/bsls/bsls_alignmentutil.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_alignmentutil.h
+/root/repo/build/include/bsls_annotation.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_annotation.h: $(srcdir)/groups/bsl/bsls/bsls_annotation.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_annotation.h
+/root/repo/build/include/bsls_assert.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_assert.h: $(srcdir)/groups/bsl/bsls/bsls_assert.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_assert.h
+/root/repo/build/include/bsls_asserttest.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_asserttest.h: $(srcdir)/groups/bsl/bsls/bsls_asserttest.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_asserttest.h
+/root/repo/build/include/bsls_asserttestexception.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_asserttestexception.h: $(srcdir)/groups/bsl/bsls/bsls_asserttestexception.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_asserttestexception.h
+/root/repo/build/include/bsls_atomic.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_atomic.h: $(srcdir)/groups/bsl/bsls/bsls_atomic.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_atomic.h
+/root/repo/build/include/bsls_atomicoperations.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_atomicoperations.h: $(srcdir)/groups/bsl/bsls/bsls_atomicoperations.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_atomicoperations.h
+/root/repo/build/include/bsls_atomicoperations_default.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_atomicoperations_default.h: $(srcdir)/groups/bsl/bsls/bsls_atomicoperations_default.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_atomicoperations_default.h
+/root/repo/build/include/bsls_atomicoperations_ia64_hp_acc.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_atomicoperations_ia64_hp_acc.h: $(srcdir)/groups/bsl/bsls/bsls_atomicoperations_ia64_hp_acc.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_atomicoperations_ia64_hp_acc.h
+/root/repo/build/include/bsls_atomicoperations_powerpc32_aix_xlc.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_atomicoperations_powerpc32_aix_xlc.h: $(srcdir)/groups/bsl/bsls/bsls_atomicoperations_powerpc32_aix_xlc.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_atomicoperations_powerpc32_aix_xlc.h
+/root/repo/build/include/bsls_atomicoperations_powerpc64_aix_xlc.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_atomicoperations_powerpc64_aix_xlc.h: $(srcdir)/groups/bsl/bsls/bsls_atomicoperations_powerpc64_aix_xlc.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_atomicoperations_powerpc64_aix_xlc.h
+/root/repo/build/include/bsls_atomicoperations_powerpc_aix_gcc.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_atomicoperations_powerpc_aix_gcc.h: $(srcdir)/groups/bsl/bsls/bsls_atomicoperations_powerpc_aix_gcc.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_atomicoperations_powerpc_aix_gcc.h
+/root/repo/build/include/bsls_atomicoperations_powerpc_aix_xlc_default.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_atomicoperations_powerpc_aix_xlc_default.h: $(srcdir)/groups/bsl/bsls/bsls_atomicoperations_powerpc_aix_xlc_default.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_atomicoperations_powerpc_aix_xlc_default.h
+/root/repo/build/include/bsls_atomicoperations_sparc32_sun_cc.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_atomicoperations_sparc32_sun_cc.h: $(srcdir)/groups/bsl/bsls/bsls_atomicoperations_sparc32_sun_cc.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_atomicoperations_sparc32_sun_cc.h
+/root/repo/build/include/bsls_atomicoperations_sparc64_sun_cc.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_atomicoperations_sparc64_sun_cc.h: $(srcdir)/groups/bsl/bsls/bsls_atomicoperations_sparc64_sun_cc.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_atomicoperations_sparc64_sun_cc.h
+/root/repo/build/include/bsls_atomicoperations_sparc_sun_cc_default.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_atomicoperations_sparc_sun_cc_default.h: $(srcdir)/groups/bsl/bsls/bsls_atomicoperations_sparc_sun_cc_default.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_atomicoperations_sparc_sun_cc_default.h
+/root/repo/build/include/bsls_atomicoperations_x64_all_gcc.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_atomicoperations_x64_all_gcc.h: $(srcdir)/groups/bsl/bsls/bsls_atomicoperations_x64_all_gcc.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_atomicoperations_x64_all_gcc.h
+/root/repo/build/include/bsls_atomicoperations_x64_win_msvc.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_atomicoperations_x64_win_msvc.h: $(srcdir)/groups/bsl/bsls/bsls_atomicoperations_x64_win_msvc.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_atomicoperations_x64_win_msvc.h
+/root/repo/build/include/bsls_atomicoperations_x86_all_gcc.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_atomicoperations_x86_all_gcc.h: $(srcdir)/groups/bsl/bsls/bsls_atomicoperations_x86_all_gcc.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_atomicoperations_x86_all_gcc.h
+/root/repo/build/include/bsls_atomicoperations_x86_win_msvc.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_atomicoperations_x86_win_msvc.h: $(srcdir)/groups/bsl/bsls/bsls_atomicoperations_x86_win_msvc.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_atomicoperations_x86_win_msvc.h
+/root/repo/build/include/bsls_blockgrowth.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_blockgrowth.h: $(srcdir)/groups/bsl/bsls/bsls_blockgrowth.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_blockgrowth.h
+/root/repo/build/include/bsls_bsltestutil.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_bsltestutil.h: $(srcdir)/groups/bsl/bsls/bsls_bsltestutil.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_bsltestutil.h
+/root/repo/build/include/bsls_buildtarget.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_buildtarget.h: $(srcdir)/groups/bsl/bsls/bsls_buildtarget.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_buildtarget.h
+/root/repo/build/include/bsls_byteorder.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_byteorder.h: $(srcdir)/groups/bsl/bsls/bsls_byteorder.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_byteorder.h
+/root/repo/build/include/bsls_compilerfeatures.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_compilerfeatures.h: $(srcdir)/groups/bsl/bsls/bsls_compilerfeatures.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_compilerfeatures.h
+/root/repo/build/include/bsls_exceptionutil.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_exceptionutil.h: $(srcdir)/groups/bsl/bsls/bsls_exceptionutil.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_exceptionutil.h
+/root/repo/build/include/bsls_ident.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_ident.h: $(srcdir)/groups/bsl/bsls/bsls_ident.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_ident.h
+/root/repo/build/include/bsls_macroincrement.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_macroincrement.h: $(srcdir)/groups/bsl/bsls/bsls_macroincrement.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_macroincrement.h
+/root/repo/build/include/bsls_nativestd.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_nativestd.h: $(srcdir)/groups/bsl/bsls/bsls_nativestd.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_nativestd.h
+/root/repo/build/include/bsls_nullptr.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_nullptr.h: $(srcdir)/groups/bsl/bsls/bsls_nullptr.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_nullptr.h
+/root/repo/build/include/bsls_objectbuffer.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_objectbuffer.h: $(srcdir)/groups/bsl/bsls/bsls_objectbuffer.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_objectbuffer.h
+/root/repo/build/include/bsls_performancehint.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_performancehint.h: $(srcdir)/groups/bsl/bsls/bsls_performancehint.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_performancehint.h
+/root/repo/build/include/bsls_platform.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_platform.h: $(srcdir)/groups/bsl/bsls/bsls_platform.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_platform.h
+/root/repo/build/include/bsls_protocoltest.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_protocoltest.h: $(srcdir)/groups/bsl/bsls/bsls_protocoltest.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_protocoltest.h
+/root/repo/build/include/bsls_stopwatch.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_stopwatch.h: $(srcdir)/groups/bsl/bsls/bsls_stopwatch.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_stopwatch.h
+/root/repo/build/include/bsls_timeutil.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_timeutil.h: $(srcdir)/groups/bsl/bsls/bsls_timeutil.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_timeutil.h
+/root/repo/build/include/bsls_types.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_types.h: $(srcdir)/groups/bsl/bsls/bsls_types.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_types.h
+/root/repo/build/include/bsls_unspecifiedbool.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_unspecifiedbool.h: $(srcdir)/groups/bsl/bsls/bsls_unspecifiedbool.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_unspecifiedbool.h
+/root/repo/build/include/bsls_util.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsls_util.h: $(srcdir)/groups/bsl/bsls/bsls_util.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsls_util.h
+/root/repo/build/include/bslscm_version.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslscm_version.h: $(srcdir)/groups/bsl/bslscm/bslscm_version.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslscm_version.h
+/root/repo/build/include/bslscm_versiontag.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslscm_versiontag.h: $(srcdir)/groups/bsl/bslscm/bslscm_versiontag.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslscm_versiontag.h
+/root/repo/build/include/bslstl_allocator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_allocator.h: $(srcdir)/groups/bsl/bslstl/bslstl_allocator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_allocator.h
+/root/repo/build/include/bslstl_allocatortraits.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_allocatortraits.h: $(srcdir)/groups/bsl/bslstl/bslstl_allocatortraits.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_allocatortraits.h
+/root/repo/build/include/bslstl_bidirectionaliterator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_bidirectionaliterator.h: $(srcdir)/groups/bsl/bslstl/bslstl_bidirectionaliterator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_bidirectionaliterator.h
+/root/repo/build/include/bslstl_bidirectionalnodepool.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_bidirectionalnodepool.h: $(srcdir)/groups/bsl/bslstl/bslstl_bidirectionalnodepool.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_bidirectionalnodepool.h
+/root/repo/build/include/bslstl_bitset.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_bitset.h: $(srcdir)/groups/bsl/bslstl/bslstl_bitset.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_bitset.h
+/root/repo/build/include/bslstl_deque.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_deque.h: $(srcdir)/groups/bsl/bslstl/bslstl_deque.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_deque.h
+/root/repo/build/include/bslstl_equalto.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_equalto.h: $(srcdir)/groups/bsl/bslstl/bslstl_equalto.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_equalto.h
+/root/repo/build/include/bslstl_forwarditerator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_forwarditerator.h: $(srcdir)/groups/bsl/bslstl/bslstl_forwarditerator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_forwarditerator.h
+/root/repo/build/include/bslstl_hash.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_hash.h: $(srcdir)/groups/bsl/bslstl/bslstl_hash.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_hash.h
+/root/repo/build/include/bslstl_hashtable.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_hashtable.h: $(srcdir)/groups/bsl/bslstl/bslstl_hashtable.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_hashtable.h
+/root/repo/build/include/bslstl_hashtablebucketiterator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_hashtablebucketiterator.h: $(srcdir)/groups/bsl/bslstl/bslstl_hashtablebucketiterator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_hashtablebucketiterator.h
+/root/repo/build/include/bslstl_hashtableiterator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_hashtableiterator.h: $(srcdir)/groups/bsl/bslstl/bslstl_hashtableiterator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_hashtableiterator.h
+/root/repo/build/include/bslstl_iosfwd.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_iosfwd.h: $(srcdir)/groups/bsl/bslstl/bslstl_iosfwd.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_iosfwd.h
+/root/repo/build/include/bslstl_istringstream.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_istringstream.h: $(srcdir)/groups/bsl/bslstl/bslstl_istringstream.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_istringstream.h
+/root/repo/build/include/bslstl_iterator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_iterator.h: $(srcdir)/groups/bsl/bslstl/bslstl_iterator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_iterator.h
+/root/repo/build/include/bslstl_iteratorutil.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_iteratorutil.h: $(srcdir)/groups/bsl/bslstl/bslstl_iteratorutil.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_iteratorutil.h
+/root/repo/build/include/bslstl_list.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_list.h: $(srcdir)/groups/bsl/bslstl/bslstl_list.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_list.h
+/root/repo/build/include/bslstl_map.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_map.h: $(srcdir)/groups/bsl/bslstl/bslstl_map.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_map.h
+/root/repo/build/include/bslstl_mapcomparator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_mapcomparator.h: $(srcdir)/groups/bsl/bslstl/bslstl_mapcomparator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_mapcomparator.h
+/root/repo/build/include/bslstl_multimap.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_multimap.h: $(srcdir)/groups/bsl/bslstl/bslstl_multimap.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_multimap.h
+/root/repo/build/include/bslstl_multiset.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_multiset.h: $(srcdir)/groups/bsl/bslstl/bslstl_multiset.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_multiset.h
+/root/repo/build/include/bslstl_ostringstream.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_ostringstream.h: $(srcdir)/groups/bsl/bslstl/bslstl_ostringstream.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_ostringstream.h
+/root/repo/build/include/bslstl_pair.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_pair.h: $(srcdir)/groups/bsl/bslstl/bslstl_pair.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_pair.h
+/root/repo/build/include/bslstl_priorityqueue.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_priorityqueue.h: $(srcdir)/groups/bsl/bslstl/bslstl_priorityqueue.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_priorityqueue.h
+/root/repo/build/include/bslstl_queue.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_queue.h: $(srcdir)/groups/bsl/bslstl/bslstl_queue.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_queue.h
+/root/repo/build/include/bslstl_randomaccessiterator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_randomaccessiterator.h: $(srcdir)/groups/bsl/bslstl/bslstl_randomaccessiterator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_randomaccessiterator.h
+/root/repo/build/include/bslstl_set.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_set.h: $(srcdir)/groups/bsl/bslstl/bslstl_set.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_set.h
+/root/repo/build/include/bslstl_setcomparator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_setcomparator.h: $(srcdir)/groups/bsl/bslstl/bslstl_setcomparator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_setcomparator.h
+/root/repo/build/include/bslstl_simplepool.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_simplepool.h: $(srcdir)/groups/bsl/bslstl/bslstl_simplepool.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_simplepool.h
+/root/repo/build/include/bslstl_sstream.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_sstream.h: $(srcdir)/groups/bsl/bslstl/bslstl_sstream.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_sstream.h
+/root/repo/build/include/bslstl_stack.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_stack.h: $(srcdir)/groups/bsl/bslstl/bslstl_stack.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_stack.h
+/root/repo/build/include/bslstl_stdexceptutil.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_stdexceptutil.h: $(srcdir)/groups/bsl/bslstl/bslstl_stdexceptutil.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_stdexceptutil.h
+/root/repo/build/include/bslstl_string.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_string.h: $(srcdir)/groups/bsl/bslstl/bslstl_string.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_string.h
+/root/repo/build/include/bslstl_stringbuf.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_stringbuf.h: $(srcdir)/groups/bsl/bslstl/bslstl_stringbuf.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_stringbuf.h
+/root/repo/build/include/bslstl_stringref.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_stringref.h: $(srcdir)/groups/bsl/bslstl/bslstl_stringref.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_stringref.h
+/root/repo/build/include/bslstl_stringrefdata.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_stringrefdata.h: $(srcdir)/groups/bsl/bslstl/bslstl_stringrefdata.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_stringrefdata.h
+/root/repo/build/include/bslstl_stringstream.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_stringstream.h: $(srcdir)/groups/bsl/bslstl/bslstl_stringstream.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_stringstream.h
+/root/repo/build/include/bslstl_treeiterator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_treeiterator.h: $(srcdir)/groups/bsl/bslstl/bslstl_treeiterator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_treeiterator.h
+/root/repo/build/include/bslstl_treenode.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_treenode.h: $(srcdir)/groups/bsl/bslstl/bslstl_treenode.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_treenode.h
+/root/repo/build/include/bslstl_treenodepool.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_treenodepool.h: $(srcdir)/groups/bsl/bslstl/bslstl_treenodepool.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_treenodepool.h
+/root/repo/build/include/bslstl_unorderedmap.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_unorderedmap.h: $(srcdir)/groups/bsl/bslstl/bslstl_unorderedmap.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_unorderedmap.h
+/root/repo/build/include/bslstl_unorderedmapkeyconfiguration.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_unorderedmapkeyconfiguration.h: $(srcdir)/groups/bsl/bslstl/bslstl_unorderedmapkeyconfiguration.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_unorderedmapkeyconfiguration.h
+/root/repo/build/include/bslstl_unorderedmultimap.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_unorderedmultimap.h: $(srcdir)/groups/bsl/bslstl/bslstl_unorderedmultimap.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_unorderedmultimap.h
+/root/repo/build/include/bslstl_unorderedmultiset.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_unorderedmultiset.h: $(srcdir)/groups/bsl/bslstl/bslstl_unorderedmultiset.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_unorderedmultiset.h
+/root/repo/build/include/bslstl_unorderedset.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_unorderedset.h: $(srcdir)/groups/bsl/bslstl/bslstl_unorderedset.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_unorderedset.h
+/root/repo/build/include/bslstl_unorderedsetkeyconfiguration.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_unorderedsetkeyconfiguration.h: $(srcdir)/groups/bsl/bslstl/bslstl_unorderedsetkeyconfiguration.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_unorderedsetkeyconfiguration.h
+/root/repo/build/include/bslstl_vector.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bslstl_vector.h: $(srcdir)/groups/bsl/bslstl/bslstl_vector.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bslstl_vector.h
+/root/repo/build/include/bsltf_allocbitwisemoveabletesttype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_allocbitwisemoveabletesttype.h: $(srcdir)/groups/bsl/bsltf/bsltf_allocbitwisemoveabletesttype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_allocbitwisemoveabletesttype.h
+/root/repo/build/include/bsltf_alloctesttype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_alloctesttype.h: $(srcdir)/groups/bsl/bsltf/bsltf_alloctesttype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_alloctesttype.h
+/root/repo/build/include/bsltf_bitwisemoveabletesttype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_bitwisemoveabletesttype.h: $(srcdir)/groups/bsl/bsltf/bsltf_bitwisemoveabletesttype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_bitwisemoveabletesttype.h
+/root/repo/build/include/bsltf_convertiblevaluewrapper.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_convertiblevaluewrapper.h: $(srcdir)/groups/bsl/bsltf/bsltf_convertiblevaluewrapper.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_convertiblevaluewrapper.h
+/root/repo/build/include/bsltf_degeneratefunctor.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_degeneratefunctor.h: $(srcdir)/groups/bsl/bsltf/bsltf_degeneratefunctor.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_degeneratefunctor.h
+/root/repo/build/include/bsltf_enumeratedtesttype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_enumeratedtesttype.h: $(srcdir)/groups/bsl/bsltf/bsltf_enumeratedtesttype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_enumeratedtesttype.h
+/root/repo/build/include/bsltf_evilbooleantype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_evilbooleantype.h: $(srcdir)/groups/bsl/bsltf/bsltf_evilbooleantype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_evilbooleantype.h
+/root/repo/build/include/bsltf_nonassignabletesttype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_nonassignabletesttype.h: $(srcdir)/groups/bsl/bsltf/bsltf_nonassignabletesttype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_nonassignabletesttype.h
+/root/repo/build/include/bsltf_noncopyconstructibletesttype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_noncopyconstructibletesttype.h: $(srcdir)/groups/bsl/bsltf/bsltf_noncopyconstructibletesttype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_noncopyconstructibletesttype.h
+/root/repo/build/include/bsltf_nondefaultconstructibletesttype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_nondefaultconstructibletesttype.h: $(srcdir)/groups/bsl/bsltf/bsltf_nondefaultconstructibletesttype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_nondefaultconstructibletesttype.h
+/root/repo/build/include/bsltf_nonequalcomparabletesttype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_nonequalcomparabletesttype.h: $(srcdir)/groups/bsl/bsltf/bsltf_nonequalcomparabletesttype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_nonequalcomparabletesttype.h
+/root/repo/build/include/bsltf_nontypicaloverloadstesttype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_nontypicaloverloadstesttype.h: $(srcdir)/groups/bsl/bsltf/bsltf_nontypicaloverloadstesttype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_nontypicaloverloadstesttype.h
+/root/repo/build/include/bsltf_simpletesttype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_simpletesttype.h: $(srcdir)/groups/bsl/bsltf/bsltf_simpletesttype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_simpletesttype.h
+/root/repo/build/include/bsltf_stdstatefulallocator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_stdstatefulallocator.h: $(srcdir)/groups/bsl/bsltf/bsltf_stdstatefulallocator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_stdstatefulallocator.h
+/root/repo/build/include/bsltf_stdtestallocator.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_stdtestallocator.h: $(srcdir)/groups/bsl/bsltf/bsltf_stdtestallocator.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_stdtestallocator.h
+/root/repo/build/include/bsltf_templatetestfacility.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_templatetestfacility.h: $(srcdir)/groups/bsl/bsltf/bsltf_templatetestfacility.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_templatetestfacility.h
+/root/repo/build/include/bsltf_testvaluesarray.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_testvaluesarray.h: $(srcdir)/groups/bsl/bsltf/bsltf_testvaluesarray.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_testvaluesarray.h
+/root/repo/build/include/bsltf_uniontesttype.h: TOOLSET := $(TOOLSET)
+/root/repo/build/include/bsltf_uniontesttype.h: $(srcdir)/groups/bsl/bsltf/bsltf_uniontesttype.h FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += /root/repo/build/include/bsltf_uniontesttype.h
+_root_repo_groups_bsl_bsl_gyp_bsl_target_copies = /root/repo/build/include/bsl_algorithm.h /root/repo/build/include/bsl_bitset.h /root/repo/build/include/bsl_c_assert.h /root/repo/build/include/bsl_c_ctype.h /root/repo/build/include/bsl_c_errno.h /root/repo/build/include/bsl_c_float.h /root/repo/build/include/bsl_c_iso646.h /root/repo/build/include/bsl_c_limits.h /root/repo/build/include/bsl_c_locale.h /root/repo/build/include/bsl_c_math.h /root/repo/build/include/bsl_c_setjmp.h /root/repo/build/include/bsl_c_signal.h /root/repo/build/include/bsl_c_stdarg.h /root/repo/build/include/bsl_c_stddef.h /root/repo/build/include/bsl_c_stdio.h /root/repo/build/include/bsl_c_stdlib.h /root/repo/build/include/bsl_c_string.h /root/repo/build/include/bsl_c_sys_time.h /root/repo/build/include/bsl_c_time.h /root/repo/build/include/bsl_c_wchar.h /root/repo/build/include/bsl_c_wctype.h /root/repo/build/include/bsl_cassert.h /root/repo/build/include/bsl_cctype.h /root/repo/build/include/bsl_cerrno.h /root/repo/build/include/bsl_cfloat.h /root/repo/build/include/bsl_ciso646.h /root/repo/build/include/bsl_climits.h /root/repo/build/include/bsl_clocale.h /root/repo/build/include/bsl_cmath.h /root/repo/build/include/bsl_complex.h /root/repo/build/include/bsl_csetjmp.h /root/repo/build/include/bsl_csignal.h /root/repo/build/include/bsl_cstdarg.h /root/repo/build/include/bsl_cstddef.h /root/repo/build/include/bsl_cstdio.h /root/repo/build/include/bsl_cstdlib.h /root/repo/build/include/bsl_cstring.h /root/repo/build/include/bsl_ctime.h /root/repo/build/include/bsl_cwchar.h /root/repo/build/include/bsl_cwctype.h /root/repo/build/include/bsl_deque.h /root/repo/build/include/bsl_exception.h /root/repo/build/include/bsl_fstream.h /root/repo/build/include/bsl_functional.h /root/repo/build/include/bsl_iomanip.h /root/repo/build/include/bsl_ios.h /root/repo/build/include/bsl_iosfwd.h /root/repo/build/include/bsl_iostream.h /root/repo/build/include/bsl_istream.h /root/repo/build/include/bsl_iterator.h /root/repo/build/include/bsl_limits.h /root/repo/build/include/bsl_list.h /root/repo/build/include/bsl_locale.h /root/repo/build/include/bsl_map.h /root/repo/build/include/bsl_memory.h /root/repo/build/include/bsl_new.h /root/repo/build/include/bsl_numeric.h /root/repo/build/include/bsl_ostream.h /root/repo/build/include/bsl_queue.h /root/repo/build/include/bsl_set.h /root/repo/build/include/bsl_sstream.h /root/repo/build/include/bsl_stack.h /root/repo/build/include/bsl_stdexcept.h /root/repo/build/include/bsl_streambuf.h /root/repo/build/include/bsl_string.h /root/repo/build/include/bsl_strstream.h /root/repo/build/include/bsl_typeinfo.h /root/repo/build/include/bsl_unordered_map.h /root/repo/build/include/bsl_unordered_set.h /root/repo/build/include/bsl_utility.h /root/repo/build/include/bsl_valarray.h /root/repo/build/include/bsl_vector.h /root/repo/build/include/bslalg_arraydestructionprimitives.h /root/repo/build/include/bslalg_arrayprimitives.h /root/repo/build/include/bslalg_autoarraydestructor.h /root/repo/build/include/bslalg_autoarraymovedestructor.h /root/repo/build/include/bslalg_autoscalardestructor.h /root/repo/build/include/bslalg_bidirectionallink.h /root/repo/build/include/bslalg_bidirectionallinklistutil.h /root/repo/build/include/bslalg_bidirectionalnode.h /root/repo/build/include/bslalg_constructorproxy.h /root/repo/build/include/bslalg_containerbase.h /root/repo/build/include/bslalg_dequeimputil.h /root/repo/build/include/bslalg_dequeiterator.h /root/repo/build/include/bslalg_dequeprimitives.h /root/repo/build/include/bslalg_functoradapter.h /root/repo/build/include/bslalg_hashtableanchor.h /root/repo/build/include/bslalg_hashtablebucket.h /root/repo/build/include/bslalg_hashtableimputil.h /root/repo/build/include/bslalg_hashutil.h /root/repo/build/include/bslalg_hastrait.h /root/repo/build/include/bslalg_rangecompare.h /root/repo/build/include/bslalg_rbtreeanchor.h /root/repo/build/include/bslalg_rbtreenode.h /root/repo/build/include/bslalg_rbtreeutil.h /root/repo/build/include/bslalg_scalardestructionprimitives.h /root/repo/build/include/bslalg_scalarprimitives.h /root/repo/build/include/bslalg_selecttrait.h /root/repo/build/include/bslalg_swaputil.h /root/repo/build/include/bslalg_typetraitbitwisecopyable.h /root/repo/build/include/bslalg_typetraitbitwiseequalitycomparable.h /root/repo/build/include/bslalg_typetraitbitwisemoveable.h /root/repo/build/include/bslalg_typetraithaspointersemantics.h /root/repo/build/include/bslalg_typetraithasstliterators.h /root/repo/build/include/bslalg_typetraithastrivialdefaultconstructor.h /root/repo/build/include/bslalg_typetraitnil.h /root/repo/build/include/bslalg_typetraitpair.h /root/repo/build/include/bslalg_typetraits.h /root/repo/build/include/bslalg_typetraitusesbslmaallocator.h /root/repo/build/include/bsldoc_glossary.h /root/repo/build/include/bslim_printer.h /root/repo/build/include/bslma_allocator.h /root/repo/build/include/bslma_autodeallocator.h /root/repo/build/include/bslma_autodestructor.h /root/repo/build/include/bslma_autorawdeleter.h /root/repo/build/include/bslma_deallocatorguard.h /root/repo/build/include/bslma_deallocatorproctor.h /root/repo/build/include/bslma_default.h /root/repo/build/include/bslma_defaultallocatorguard.h /root/repo/build/include/bslma_deleterhelper.h /root/repo/build/include/bslma_destructorguard.h /root/repo/build/include/bslma_destructorproctor.h /root/repo/build/include/bslma_exceptionguard.h /root/repo/build/include/bslma_mallocfreeallocator.h /root/repo/build/include/bslma_newdeleteallocator.h /root/repo/build/include/bslma_rawdeleterguard.h /root/repo/build/include/bslma_rawdeleterproctor.h /root/repo/build/include/bslma_testallocator.h /root/repo/build/include/bslma_testallocatorexception.h /root/repo/build/include/bslma_testallocatormonitor.h /root/repo/build/include/bslma_usesbslmaallocator.h /root/repo/build/include/bslmf_addconst.h /root/repo/build/include/bslmf_addcv.h /root/repo/build/include/bslmf_addlvaluereference.h /root/repo/build/include/bslmf_addpointer.h /root/repo/build/include/bslmf_addreference.h /root/repo/build/include/bslmf_addrvaluereference.h /root/repo/build/include/bslmf_addvolatile.h /root/repo/build/include/bslmf_arraytopointer.h /root/repo/build/include/bslmf_assert.h /root/repo/build/include/bslmf_conditional.h /root/repo/build/include/bslmf_detectnestedtrait.h /root/repo/build/include/bslmf_enableif.h /root/repo/build/include/bslmf_forwardingtype.h /root/repo/build/include/bslmf_functionpointertraits.h /root/repo/build/include/bslmf_haspointersemantics.h /root/repo/build/include/bslmf_if.h /root/repo/build/include/bslmf_integralconstant.h /root/repo/build/include/bslmf_isarithmetic.h /root/repo/build/include/bslmf_isarray.h /root/repo/build/include/bslmf_isbitwiseequalitycomparable.h /root/repo/build/include/bslmf_isbitwisemoveable.h /root/repo/build/include/bslmf_isclass.h /root/repo/build/include/bslmf_isconst.h /root/repo/build/include/bslmf_isconvertible.h /root/repo/build/include/bslmf_isconvertibletoany.h /root/repo/build/include/bslmf_isenum.h /root/repo/build/include/bslmf_isfloatingpoint.h /root/repo/build/include/bslmf_isfunction.h /root/repo/build/include/bslmf_isfundamental.h /root/repo/build/include/bslmf_isintegral.h /root/repo/build/include/bslmf_islvaluereference.h /root/repo/build/include/bslmf_ismemberfunctionpointer.h /root/repo/build/include/bslmf_ismemberobjectpointer.h /root/repo/build/include/bslmf_ismemberpointer.h /root/repo/build/include/bslmf_ispair.h /root/repo/build/include/bslmf_ispointer.h /root/repo/build/include/bslmf_ispointertomember.h /root/repo/build/include/bslmf_ispolymorphic.h /root/repo/build/include/bslmf_isreference.h /root/repo/build/include/bslmf_isrvaluereference.h /root/repo/build/include/bslmf_issame.h /root/repo/build/include/bslmf_istriviallycopyable.h /root/repo/build/include/bslmf_istriviallydefaultconstructible.h /root/repo/build/include/bslmf_isvoid.h /root/repo/build/include/bslmf_isvolatile.h /root/repo/build/include/bslmf_matchanytype.h /root/repo/build/include/bslmf_matcharithmetictype.h /root/repo/build/include/bslmf_memberfunctionpointertraits.h /root/repo/build/include/bslmf_metaint.h /root/repo/build/include/bslmf_nestedtraitdeclaration.h /root/repo/build/include/bslmf_nil.h /root/repo/build/include/bslmf_removeconst.h /root/repo/build/include/bslmf_removecv.h /root/repo/build/include/bslmf_removecvq.h /root/repo/build/include/bslmf_removepointer.h /root/repo/build/include/bslmf_removereference.h /root/repo/build/include/bslmf_removevolatile.h /root/repo/build/include/bslmf_selecttrait.h /root/repo/build/include/bslmf_switch.h /root/repo/build/include/bslmf_tag.h /root/repo/build/include/bslmf_typelist.h /root/repo/build/include/bsls_alignedbuffer.h /root/repo/build/include/bsls_alignment.h /root/repo/build/include/bsls_alignmentfromtype.h /root/repo/build/include/bsls_alignmentimp.h /root/repo/build/include/bsls_alignmenttotype.h /root/repo/build/include/bsls_alignmentutil.h /root/repo/build/include/bsls_annotation.h /root/repo/build/include/bsls_assert.h /root/repo/build/include/bsls_asserttest.h /root/repo/build/include/bsls_asserttestexception.h /root/repo/build/include/bsls_atomic.h /root/repo/build/include/bsls_atomicoperations.h /root/repo/build/include/bsls_atomicoperations_default.h /root/repo/build/include/bsls_atomicoperations_ia64_hp_acc.h /root/repo/build/include/bsls_atomicoperations_powerpc32_aix_xlc.h /root/repo/build/include/bsls_atomicoperations_powerpc64_aix_xlc.h /root/repo/build/include/bsls_atomicoperations_powerpc_aix_gcc.h /root/repo/build/include/bsls_atomicoperations_powerpc_aix_xlc_default.h /root/repo/build/include/bsls_atomicoperations_sparc32_sun_cc.h /root/repo/build/include/bsls_atomicoperations_sparc64_sun_cc.h /root/repo/build/include/bsls_atomicoperations_sparc_sun_cc_default.h /root/repo/build/include/bsls_atomicoperations_x64_all_gcc.h /root/repo/build/include/bsls_atomicoperations_x64_win_msvc.h /root/repo/build/include/bsls_atomicoperations_x86_all_gcc.h /root/repo/build/include/bsls_atomicoperations_x86_win_msvc.h /root/repo/build/include/bsls_blockgrowth.h /root/repo/build/include/bsls_bsltestutil.h /root/repo/build/include/bsls_buildtarget.h /root/repo/build/include/bsls_byteorder.h /root/repo/build/include/bsls_compilerfeatures.h /root/repo/build/include/bsls_exceptionutil.h /root/repo/build/include/bsls_ident.h /root/repo/build/include/bsls_macroincrement.h /root/repo/build/include/bsls_nativestd.h /root/repo/build/include/bsls_nullptr.h /root/repo/build/include/bsls_objectbuffer.h /root/repo/build/include/bsls_performancehint.h /root/repo/build/include/bsls_platform.h /root/repo/build/include/bsls_protocoltest.h /root/repo/build/include/bsls_stopwatch.h /root/repo/build/include/bsls_timeutil.h /root/repo/build/include/bsls_types.h /root/repo/build/include/bsls_unspecifiedbool.h /root/repo/build/include/bsls_util.h /root/repo/build/include/bslscm_version.h /root/repo/build/include/bslscm_versiontag.h /root/repo/build/include/bslstl_allocator.h /root/repo/build/include/bslstl_allocatortraits.h /root/repo/build/include/bslstl_bidirectionaliterator.h /root/repo/build/include/bslstl_bidirectionalnodepool.h /root/repo/build/include/bslstl_bitset.h /root/repo/build/include/bslstl_deque.h /root/repo/build/include/bslstl_equalto.h /root/repo/build/include/bslstl_forwarditerator.h /root/repo/build/include/bslstl_hash.h /root/repo/build/include/bslstl_hashtable.h /root/repo/build/include/bslstl_hashtablebucketiterator.h /root/repo/build/include/bslstl_hashtableiterator.h /root/repo/build/include/bslstl_iosfwd.h /root/repo/build/include/bslstl_istringstream.h /root/repo/build/include/bslstl_iterator.h /root/repo/build/include/bslstl_iteratorutil.h /root/repo/build/include/bslstl_list.h /root/repo/build/include/bslstl_map.h /root/repo/build/include/bslstl_mapcomparator.h /root/repo/build/include/bslstl_multimap.h /root/repo/build/include/bslstl_multiset.h /root/repo/build/include/bslstl_ostringstream.h /root/repo/build/include/bslstl_pair.h /root/repo/build/include/bslstl_priorityqueue.h /root/repo/build/include/bslstl_queue.h /root/repo/build/include/bslstl_randomaccessiterator.h /root/repo/build/include/bslstl_set.h /root/repo/build/include/bslstl_setcomparator.h /root/repo/build/include/bslstl_simplepool.h /root/repo/build/include/bslstl_sstream.h /root/repo/build/include/bslstl_stack.h /root/repo/build/include/bslstl_stdexceptutil.h /root/repo/build/include/bslstl_string.h /root/repo/build/include/bslstl_stringbuf.h /root/repo/build/include/bslstl_stringref.h /root/repo/build/include/bslstl_stringrefdata.h /root/repo/build/include/bslstl_stringstream.h /root/repo/build/include/bslstl_treeiterator.h /root/repo/build/include/bslstl_treenode.h /root/repo/build/include/bslstl_treenodepool.h /root/repo/build/include/bslstl_unorderedmap.h /root/repo/build/include/bslstl_unorderedmapkeyconfiguration.h /root/repo/build/include/bslstl_unorderedmultimap.h /root/repo/build/include/bslstl_unorderedmultiset.h /root/repo/build/include/bslstl_unorderedset.h /root/repo/build/include/bslstl_unorderedsetkeyconfiguration.h /root/repo/build/include/bslstl_vector.h /root/repo/build/include/bsltf_allocbitwisemoveabletesttype.h /root/repo/build/include/bsltf_alloctesttype.h /root/repo/build/include/bsltf_bitwisemoveabletesttype.h /root/repo/build/include/bsltf_convertiblevaluewrapper.h /root/repo/build/include/bsltf_degeneratefunctor.h /root/repo/build/include/bsltf_enumeratedtesttype.h /root/repo/build/include/bsltf_evilbooleantype.h /root/repo/build/include/bsltf_nonassignabletesttype.h /root/repo/build/include/bsltf_noncopyconstructibletesttype.h /root/repo/build/include/bsltf_nondefaultconstructibletesttype.h /root/repo/build/include/bsltf_nonequalcomparabletesttype.h /root/repo/build/include/bsltf_nontypicaloverloadstesttype.h /root/repo/build/include/bsltf_simpletesttype.h /root/repo/build/include/bsltf_stdstatefulallocator.h /root/repo/build/include/bsltf_stdtestallocator.h /root/repo/build/include/bsltf_templatetestfacility.h /root/repo/build/include/bsltf_testvaluesarray.h /root/repo/build/include/bsltf_uniontesttype.h
+
+DEFS_Debug := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Debug := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Debug := \
+	-I$(srcdir)/groups/bsl/bsl+bslhdrs \
+	-I$(srcdir)/groups/bsl/bsl+stdhdrs \
+	-I$(srcdir)/groups/bsl/bslalg \
+	-I$(srcdir)/groups/bsl/bsldoc \
+	-I$(srcdir)/groups/bsl/bslim \
+	-I$(srcdir)/groups/bsl/bslma \
+	-I$(srcdir)/groups/bsl/bslmf \
+	-I$(srcdir)/groups/bsl/bsls \
+	-I$(srcdir)/groups/bsl/bslscm \
+	-I$(srcdir)/groups/bsl/bslstl \
+	-I$(srcdir)/groups/bsl/bsltf
+
+DEFS_Profile := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Profile := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option \
+	--coverage
+
+# Flags passed to only C files.
+CFLAGS_C_Profile := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Profile := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Profile := \
+	-I$(srcdir)/groups/bsl/bsl+bslhdrs \
+	-I$(srcdir)/groups/bsl/bsl+stdhdrs \
+	-I$(srcdir)/groups/bsl/bslalg \
+	-I$(srcdir)/groups/bsl/bsldoc \
+	-I$(srcdir)/groups/bsl/bslim \
+	-I$(srcdir)/groups/bsl/bslma \
+	-I$(srcdir)/groups/bsl/bslmf \
+	-I$(srcdir)/groups/bsl/bsls \
+	-I$(srcdir)/groups/bsl/bslscm \
+	-I$(srcdir)/groups/bsl/bslstl \
+	-I$(srcdir)/groups/bsl/bsltf
+
+DEFS_Release := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_OPT' \
+	'-DNDEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-O2 \
+	-fno-strict-aliasing \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fexceptions
+
+INCS_Release := \
+	-I$(srcdir)/groups/bsl/bsl+bslhdrs \
+	-I$(srcdir)/groups/bsl/bsl+stdhdrs \
+	-I$(srcdir)/groups/bsl/bslalg \
+	-I$(srcdir)/groups/bsl/bsldoc \
+	-I$(srcdir)/groups/bsl/bslim \
+	-I$(srcdir)/groups/bsl/bslma \
+	-I$(srcdir)/groups/bsl/bslmf \
+	-I$(srcdir)/groups/bsl/bsls \
+	-I$(srcdir)/groups/bsl/bslscm \
+	-I$(srcdir)/groups/bsl/bslstl \
+	-I$(srcdir)/groups/bsl/bsltf
+
+OBJS := \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_arraydestructionprimitives.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_arrayprimitives.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_autoarraydestructor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_autoarraymovedestructor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_autoscalardestructor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_bidirectionallink.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_bidirectionallinklistutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_bidirectionalnode.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_constructorproxy.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_containerbase.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_dequeimputil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_dequeiterator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_dequeprimitives.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_functoradapter.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_hashtableanchor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_hashtablebucket.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_hashtableimputil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_hashutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_hastrait.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_rangecompare.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_rbtreeanchor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_rbtreenode.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_rbtreeutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_scalardestructionprimitives.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_scalarprimitives.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_selecttrait.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_swaputil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraitbitwisecopyable.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraitbitwiseequalitycomparable.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraitbitwisemoveable.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraithaspointersemantics.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraithasstliterators.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraithastrivialdefaultconstructor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraitnil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraitpair.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraits.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraitusesbslmaallocator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsldoc/bsldoc_glossary.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslim/bslim_printer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_allocator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_autodeallocator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_autodestructor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_autorawdeleter.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_deallocatorguard.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_deallocatorproctor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_default.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_defaultallocatorguard.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_deleterhelper.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_destructorguard.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_destructorproctor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_exceptionguard.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_mallocfreeallocator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_newdeleteallocator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_rawdeleterguard.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_rawdeleterproctor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_testallocator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_testallocatorexception.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_testallocatormonitor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslma/bslma_usesbslmaallocator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_addconst.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_addcv.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_addlvaluereference.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_addpointer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_addreference.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_addrvaluereference.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_addvolatile.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_arraytopointer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_assert.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_conditional.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_detectnestedtrait.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_enableif.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_forwardingtype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_functionpointertraits.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_haspointersemantics.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_if.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_integralconstant.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isarithmetic.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isarray.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isbitwiseequalitycomparable.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isbitwisemoveable.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isclass.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isconst.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isconvertible.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isconvertibletoany.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isenum.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isfloatingpoint.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isfunction.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isfundamental.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isintegral.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_islvaluereference.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_ismemberfunctionpointer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_ismemberobjectpointer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_ismemberpointer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_ispair.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_ispointer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_ispointertomember.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_ispolymorphic.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isreference.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isrvaluereference.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_issame.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_istriviallycopyable.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_istriviallydefaultconstructible.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isvoid.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isvolatile.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_matchanytype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_matcharithmetictype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_memberfunctionpointertraits.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_metaint.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_nestedtraitdeclaration.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_nil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_removeconst.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_removecv.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_removecvq.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_removepointer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_removereference.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_removevolatile.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_selecttrait.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_switch.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_tag.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_typelist.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_alignedbuffer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_alignment.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_alignmentfromtype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_alignmentimp.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_alignmenttotype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_alignmentutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_annotation.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_assert.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_asserttest.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_asserttestexception.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomic.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_default.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_ia64_hp_acc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_powerpc32_aix_xlc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_powerpc64_aix_xlc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_powerpc_aix_gcc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_powerpc_aix_xlc_default.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_sparc32_sun_cc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_sparc64_sun_cc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_sparc_sun_cc_default.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_x64_all_gcc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_x64_win_msvc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_x86_all_gcc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_x86_win_msvc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_blockgrowth.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_bsltestutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_buildtarget.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_byteorder.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_compilerfeatures.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_exceptionutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_ident.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_macroincrement.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_nativestd.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_nullptr.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_objectbuffer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_performancehint.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_platform.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_protocoltest.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_stopwatch.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_timeutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_types.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_unspecifiedbool.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_util.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslscm/bslscm_version.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslscm/bslscm_versiontag.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_allocator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_allocatortraits.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_bidirectionaliterator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_bidirectionalnodepool.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_bitset.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_deque.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_equalto.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_forwarditerator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_hash.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_hashtable.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_hashtablebucketiterator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_hashtableiterator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_iosfwd.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_istringstream.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_iterator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_iteratorutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_list.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_map.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_mapcomparator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_multimap.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_multiset.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_ostringstream.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_pair.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_priorityqueue.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_queue.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_randomaccessiterator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_set.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_setcomparator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_simplepool.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_sstream.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_stack.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_stdexceptutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_string.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_stringbuf.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_stringref.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_stringrefdata.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_stringstream.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_treeiterator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_treenode.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_treenodepool.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_unorderedmap.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_unorderedmapkeyconfiguration.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_unorderedmultimap.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_unorderedmultiset.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_unorderedset.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_unorderedsetkeyconfiguration.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_vector.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_allocbitwisemoveabletesttype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_alloctesttype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_bitwisemoveabletesttype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_convertiblevaluewrapper.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_degeneratefunctor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_enumeratedtesttype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_evilbooleantype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_nonassignabletesttype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_noncopyconstructibletesttype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_nondefaultconstructibletesttype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_nonequalcomparabletesttype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_nontypicaloverloadstesttype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_simpletesttype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_stdstatefulallocator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_stdtestallocator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_templatetestfacility.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_testvaluesarray.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsltf/bsltf_uniontesttype.o
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/groups/bsl/bsl_grpdeps.stamp $(obj).target/groups/bsl/bsl+bslhdrs/bsl+bslhdrs_sources.stamp $(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs_sources.stamp $(obj).target/groups/bsl/bslalg/bslalg_sources.stamp $(obj).target/groups/bsl/bsldoc/bsldoc_sources.stamp $(obj).target/groups/bsl/bslim/bslim_sources.stamp $(obj).target/groups/bsl/bslma/bslma_sources.stamp $(obj).target/groups/bsl/bslmf/bslmf_sources.stamp $(obj).target/groups/bsl/bsls/bsls_sources.stamp $(obj).target/groups/bsl/bslscm/bslscm_sources.stamp $(obj).target/groups/bsl/bslstl/bslstl_sources.stamp $(obj).target/groups/bsl/bsltf/bsltf_sources.stamp
+
+# Make sure our actions/rules run before any of us.
+$(OBJS): | $(_root_repo_groups_bsl_bsl_gyp_bsl_target_copies)
+
+# CFLAGS et al overrides must be target-local.
+# See "Target-specific Variable Values" in the GNU Make manual.
+$(OBJS): TOOLSET := $(TOOLSET)
+$(OBJS): GYP_CFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_C_$(BUILDTYPE))
+$(OBJS): GYP_CXXFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_CC_$(BUILDTYPE))
+
+# Suffix rules, putting all outputs into $(obj).
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(srcdir)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# Try building from generated source, too.
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj).$(TOOLSET)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# End of this set of suffix rules
+### Rules for final target.
+# Build our special outputs first.
+/root/repo/build/$(BUILDTYPE)/lib/libbsl.a: | $(_root_repo_groups_bsl_bsl_gyp_bsl_target_copies)
+
+# Preserve order dependency of special output on deps.
+$(_root_repo_groups_bsl_bsl_gyp_bsl_target_copies): | $(obj).target/groups/bsl/bsl_grpdeps.stamp $(obj).target/groups/bsl/bsl+bslhdrs/bsl+bslhdrs_sources.stamp $(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs_sources.stamp $(obj).target/groups/bsl/bslalg/bslalg_sources.stamp $(obj).target/groups/bsl/bsldoc/bsldoc_sources.stamp $(obj).target/groups/bsl/bslim/bslim_sources.stamp $(obj).target/groups/bsl/bslma/bslma_sources.stamp $(obj).target/groups/bsl/bslmf/bslmf_sources.stamp $(obj).target/groups/bsl/bsls/bsls_sources.stamp $(obj).target/groups/bsl/bslscm/bslscm_sources.stamp $(obj).target/groups/bsl/bslstl/bslstl_sources.stamp $(obj).target/groups/bsl/bsltf/bsltf_sources.stamp
+
+LDFLAGS_Debug := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack
+
+LDFLAGS_Profile := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack \
+	--coverage
+
+LDFLAGS_Release := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack
+
+LIBS :=
+
+/root/repo/build/$(BUILDTYPE)/lib/libbsl.a: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
+/root/repo/build/$(BUILDTYPE)/lib/libbsl.a: LIBS := $(LIBS)
+/root/repo/build/$(BUILDTYPE)/lib/libbsl.a: TOOLSET := $(TOOLSET)
+/root/repo/build/$(BUILDTYPE)/lib/libbsl.a: $(OBJS) FORCE_DO_CMD
+	$(call do_cmd,alink)
+
+all_deps += /root/repo/build/$(BUILDTYPE)/lib/libbsl.a
+# Add target alias
+.PHONY: bsl
+bsl: /root/repo/build/$(BUILDTYPE)/lib/libbsl.a
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bsl
+
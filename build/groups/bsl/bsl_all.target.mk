@@ -0,0 +1,14 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bsl_all
+### Rules for final target.
+$(obj).target/groups/bsl/bsl_all.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bsl_all.stamp: /root/repo/build/$(BUILDTYPE)/lib/libbsl.a $(obj).target/groups/bsl/bsl_tests_build.stamp $(obj).target/groups/bsl/bsl_tests_run.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bsl_all.stamp
+# Add target alias
+.PHONY: bsl_all
+bsl_all: $(obj).target/groups/bsl/bsl_all.stamp
+
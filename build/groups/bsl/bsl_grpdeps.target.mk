@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bsl_grpdeps
+### Rules for final target.
+$(obj).target/groups/bsl/bsl_grpdeps.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bsl_grpdeps.stamp:  FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bsl_grpdeps.stamp
+# Add target alias
+.PHONY: bsl_grpdeps
+bsl_grpdeps: $(obj).target/groups/bsl/bsl_grpdeps.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bsl_grpdeps
+
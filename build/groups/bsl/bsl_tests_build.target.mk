@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bsl_tests_build
+### Rules for final target.
+$(obj).target/groups/bsl/bsl_tests_build.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bsl_tests_build.stamp: $(obj).target/groups/bsl/bsl+bslhdrs/bsl+bslhdrs_tests_build.stamp $(obj).target/groups/bsl/bsl+stdhdrs/bsl+stdhdrs_tests_build.stamp $(obj).target/groups/bsl/bslalg/bslalg_tests_build.stamp $(obj).target/groups/bsl/bsldoc/bsldoc_tests_build.stamp $(obj).target/groups/bsl/bslim/bslim_tests_build.stamp $(obj).target/groups/bsl/bslma/bslma_tests_build.stamp $(obj).target/groups/bsl/bslmf/bslmf_tests_build.stamp $(obj).target/groups/bsl/bsls/bsls_tests_build.stamp $(obj).target/groups/bsl/bslscm/bslscm_tests_build.stamp $(obj).target/groups/bsl/bslstl/bslstl_tests_build.stamp $(obj).target/groups/bsl/bsltf/bsltf_tests_build.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bsl_tests_build.stamp
+# Add target alias
+.PHONY: bsl_tests_build
+bsl_tests_build: $(obj).target/groups/bsl/bsl_tests_build.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bsl_tests_build
+
@@ -0,0 +1,246 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslalg
+DEFS_Debug := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Debug := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Debug := \
+	-I$(srcdir)/groups/bsl/bslma \
+	-I$(srcdir)/groups/bsl/bslmf \
+	-I$(srcdir)/groups/bsl/bsls \
+	-I$(srcdir)/groups/bsl/bslscm \
+	-I$(srcdir)/groups/bsl/bslalg
+
+DEFS_Profile := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Profile := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option \
+	--coverage
+
+# Flags passed to only C files.
+CFLAGS_C_Profile := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Profile := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Profile := \
+	-I$(srcdir)/groups/bsl/bslma \
+	-I$(srcdir)/groups/bsl/bslmf \
+	-I$(srcdir)/groups/bsl/bsls \
+	-I$(srcdir)/groups/bsl/bslscm \
+	-I$(srcdir)/groups/bsl/bslalg
+
+DEFS_Release := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_OPT' \
+	'-DNDEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-O2 \
+	-fno-strict-aliasing \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fexceptions
+
+INCS_Release := \
+	-I$(srcdir)/groups/bsl/bslma \
+	-I$(srcdir)/groups/bsl/bslmf \
+	-I$(srcdir)/groups/bsl/bsls \
+	-I$(srcdir)/groups/bsl/bslscm \
+	-I$(srcdir)/groups/bsl/bslalg
+
+OBJS := \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_arraydestructionprimitives.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_arrayprimitives.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_autoarraydestructor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_autoarraymovedestructor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_autoscalardestructor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_bidirectionallink.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_bidirectionallinklistutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_bidirectionalnode.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_constructorproxy.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_containerbase.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_dequeimputil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_dequeiterator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_dequeprimitives.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_functoradapter.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_hashtableanchor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_hashtablebucket.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_hashtableimputil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_hashutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_hastrait.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_rangecompare.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_rbtreeanchor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_rbtreenode.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_rbtreeutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_scalardestructionprimitives.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_scalarprimitives.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_selecttrait.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_swaputil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraitbitwisecopyable.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraitbitwiseequalitycomparable.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraitbitwisemoveable.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraithaspointersemantics.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraithasstliterators.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraithastrivialdefaultconstructor.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraitnil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraitpair.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraits.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_typetraitusesbslmaallocator.o
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/groups/bsl/bsl_grpdeps.stamp $(obj).target/groups/bsl/bslalg/bslalg_sources.stamp
+
+# CFLAGS et al overrides must be target-local.
+# See "Target-specific Variable Values" in the GNU Make manual.
+$(OBJS): TOOLSET := $(TOOLSET)
+$(OBJS): GYP_CFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_C_$(BUILDTYPE))
+$(OBJS): GYP_CXXFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_CC_$(BUILDTYPE))
+
+# Suffix rules, putting all outputs into $(obj).
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(srcdir)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# Try building from generated source, too.
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj).$(TOOLSET)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# End of this set of suffix rules
+### Rules for final target.
+LDFLAGS_Debug := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack
+
+LDFLAGS_Profile := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack \
+	--coverage
+
+LDFLAGS_Release := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack
+
+LIBS :=
+
+$(obj).target/groups/bsl/bslalg/libbslalg.a: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
+$(obj).target/groups/bsl/bslalg/libbslalg.a: LIBS := $(LIBS)
+$(obj).target/groups/bsl/bslalg/libbslalg.a: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslalg/libbslalg.a: $(OBJS) FORCE_DO_CMD
+	$(call do_cmd,alink)
+
+all_deps += $(obj).target/groups/bsl/bslalg/libbslalg.a
+# Add target alias
+.PHONY: bslalg
+bslalg: $(obj).target/groups/bsl/bslalg/libbslalg.a
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslalg
+
@@ -0,0 +1,212 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslalg_arrayprimitives.t
+DEFS_Debug := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Debug := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Debug := \
+	-I$(srcdir)/groups/bsl/bslalg \
+	-I$(srcdir)/groups/bsl/bslma \
+	-I$(srcdir)/groups/bsl/bslmf \
+	-I$(srcdir)/groups/bsl/bsls \
+	-I$(srcdir)/groups/bsl/bslscm
+
+DEFS_Profile := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Profile := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option \
+	--coverage
+
+# Flags passed to only C files.
+CFLAGS_C_Profile := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Profile := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Profile := \
+	-I$(srcdir)/groups/bsl/bslalg \
+	-I$(srcdir)/groups/bsl/bslma \
+	-I$(srcdir)/groups/bsl/bslmf \
+	-I$(srcdir)/groups/bsl/bsls \
+	-I$(srcdir)/groups/bsl/bslscm
+
+DEFS_Release := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_OPT' \
+	'-DNDEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-O2 \
+	-fno-strict-aliasing \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fexceptions
+
+INCS_Release := \
+	-I$(srcdir)/groups/bsl/bslalg \
+	-I$(srcdir)/groups/bsl/bslma \
+	-I$(srcdir)/groups/bsl/bslmf \
+	-I$(srcdir)/groups/bsl/bsls \
+	-I$(srcdir)/groups/bsl/bslscm
+
+OBJS := \
+	$(obj).target/$(TARGET)/groups/bsl/bslalg/bslalg_arrayprimitives.t.o
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/groups/bsl/bslalg/libbslalg.a $(obj).target/groups/bsl/bslma/libbslma.a $(obj).target/groups/bsl/bslmf/libbslmf.a $(obj).target/groups/bsl/bslscm/libbslscm.a $(obj).target/groups/bsl/bsls/libbsls.a $(obj).target/groups/bsl/bslscm/bslscm_sources.stamp $(obj).target/groups/bsl/bslma/bslma_sources.stamp $(obj).target/groups/bsl/bsl_grpdeps.stamp $(obj).target/groups/bsl/bsls/bsls_sources.stamp $(obj).target/groups/bsl/bslmf/bslmf_sources.stamp $(obj).target/groups/bsl/bslalg/bslalg_sources.stamp
+
+# CFLAGS et al overrides must be target-local.
+# See "Target-specific Variable Values" in the GNU Make manual.
+$(OBJS): TOOLSET := $(TOOLSET)
+$(OBJS): GYP_CFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_C_$(BUILDTYPE))
+$(OBJS): GYP_CXXFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_CC_$(BUILDTYPE))
+
+# Suffix rules, putting all outputs into $(obj).
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(srcdir)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# Try building from generated source, too.
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj).$(TOOLSET)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# End of this set of suffix rules
+### Rules for final target.
+LDFLAGS_Debug := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack
+
+LDFLAGS_Profile := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack \
+	--coverage
+
+LDFLAGS_Release := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack
+
+LIBS := \
+	-lrt
+
+$(builddir)/bslalg_arrayprimitives.t: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
+$(builddir)/bslalg_arrayprimitives.t: LIBS := $(LIBS)
+$(builddir)/bslalg_arrayprimitives.t: LD_INPUTS := $(OBJS) $(obj).target/groups/bsl/bslalg/libbslalg.a $(obj).target/groups/bsl/bslma/libbslma.a $(obj).target/groups/bsl/bslmf/libbslmf.a $(obj).target/groups/bsl/bslscm/libbslscm.a $(obj).target/groups/bsl/bsls/libbsls.a
+$(builddir)/bslalg_arrayprimitives.t: TOOLSET := $(TOOLSET)
+$(builddir)/bslalg_arrayprimitives.t: $(OBJS) $(obj).target/groups/bsl/bslalg/libbslalg.a $(obj).target/groups/bsl/bslma/libbslma.a $(obj).target/groups/bsl/bslmf/libbslmf.a $(obj).target/groups/bsl/bslscm/libbslscm.a $(obj).target/groups/bsl/bsls/libbsls.a FORCE_DO_CMD
+	$(call do_cmd,link)
+
+all_deps += $(builddir)/bslalg_arrayprimitives.t
+# Add target alias
+.PHONY: bslalg_arrayprimitives.t
+bslalg_arrayprimitives.t: $(builddir)/bslalg_arrayprimitives.t
+
+# Add executable to "all" target.
+.PHONY: all
+all: $(builddir)/bslalg_arrayprimitives.t
+
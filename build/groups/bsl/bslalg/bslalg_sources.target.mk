@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslalg_sources
+### Rules for final target.
+$(obj).target/groups/bsl/bslalg/bslalg_sources.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslalg/bslalg_sources.stamp:  FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bslalg/bslalg_sources.stamp
+# Add target alias
+.PHONY: bslalg_sources
+bslalg_sources: $(obj).target/groups/bsl/bslalg/bslalg_sources.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslalg_sources
+
@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslalg_tests_build
+### Rules for final target.
+$(obj).target/groups/bsl/bslalg/bslalg_tests_build.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslalg/bslalg_tests_build.stamp: $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bslalg/bslalg_tests_build.stamp
+# Add target alias
+.PHONY: bslalg_tests_build
+bslalg_tests_build: $(obj).target/groups/bsl/bslalg/bslalg_tests_build.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslalg_tests_build
+
@@ -0,0 +1,578 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslalg_tests_run
+### Generated for rule _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests:
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_arraydestructionprimitives.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_arraydestructionprimitives.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_arraydestructionprimitives.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_arraydestructionprimitives.t.ran: $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_0)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_arraydestructionprimitives.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_0 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_arraydestructionprimitives.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_0 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_0 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_arrayprimitives.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_arrayprimitives.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_arrayprimitives.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_arrayprimitives.t.ran: $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_1)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_arrayprimitives.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_1 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_arrayprimitives.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_1 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_1 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoarraydestructor.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoarraydestructor.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoarraydestructor.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoarraydestructor.t.ran: $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_2)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoarraydestructor.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_2 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_autoarraydestructor.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_2 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_2 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoarraymovedestructor.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoarraymovedestructor.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoarraymovedestructor.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoarraymovedestructor.t.ran: $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_3)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoarraymovedestructor.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_3 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_autoarraymovedestructor.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_3 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_3 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoscalardestructor.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoscalardestructor.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoscalardestructor.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoscalardestructor.t.ran: $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_4)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoscalardestructor.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_4 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_autoscalardestructor.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_4 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_4 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionallink.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionallink.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionallink.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionallink.t.ran: $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_5)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionallink.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_5 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_bidirectionallink.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_5 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_5 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionallinklistutil.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionallinklistutil.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionallinklistutil.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionallinklistutil.t.ran: $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_6)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionallinklistutil.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_6 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_bidirectionallinklistutil.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_6 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_6 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionalnode.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionalnode.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionalnode.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionalnode.t.ran: $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_7)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionalnode.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_7 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_bidirectionalnode.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_7 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_7 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_constructorproxy.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_constructorproxy.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_constructorproxy.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_constructorproxy.t.ran: $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_8)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_constructorproxy.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_8 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_constructorproxy.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_8 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_8 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_containerbase.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_containerbase.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_containerbase.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_containerbase.t.ran: $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_9)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_containerbase.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_9 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_containerbase.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_9 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_9 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeimputil.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeimputil.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeimputil.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeimputil.t.ran: $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_10)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeimputil.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_10 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_dequeimputil.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_10 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_10 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeiterator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeiterator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeiterator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeiterator.t.ran: $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_11)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeiterator.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_11 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_dequeiterator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_11 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_11 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeprimitives.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeprimitives.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeprimitives.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeprimitives.t.ran: $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_12)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeprimitives.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_12 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_dequeprimitives.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_12 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_12 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_functoradapter.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_functoradapter.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_functoradapter.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_functoradapter.t.ran: $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_13)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_functoradapter.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_13 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_functoradapter.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_13 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_13 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtableanchor.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtableanchor.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtableanchor.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtableanchor.t.ran: $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_14)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtableanchor.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_14 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_hashtableanchor.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_14 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_14 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtablebucket.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtablebucket.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtablebucket.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtablebucket.t.ran: $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_15)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtablebucket.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_15 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_hashtablebucket.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_15 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_15 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtableimputil.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtableimputil.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtableimputil.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtableimputil.t.ran: $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_16)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtableimputil.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_16 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_hashtableimputil.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_16 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_16 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashutil.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashutil.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashutil.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashutil.t.ran: $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_17)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashutil.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_17 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_hashutil.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_17 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_17 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hastrait.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hastrait.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hastrait.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hastrait.t.ran: $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_18)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hastrait.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_18 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_hastrait.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_18 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_18 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rangecompare.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rangecompare.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rangecompare.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rangecompare.t.ran: $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_19)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rangecompare.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_19 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_rangecompare.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_19 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_19 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreeanchor.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreeanchor.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreeanchor.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreeanchor.t.ran: $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_20)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreeanchor.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_20 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_rbtreeanchor.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_20 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_20 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreenode.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreenode.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreenode.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreenode.t.ran: $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_21)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreenode.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_21 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_rbtreenode.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_21 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_21 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreeutil.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreeutil.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreeutil.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreeutil.t.ran: $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_22)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreeutil.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_22 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_rbtreeutil.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_22 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_22 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_scalardestructionprimitives.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_scalardestructionprimitives.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_scalardestructionprimitives.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_scalardestructionprimitives.t.ran: $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_23)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_scalardestructionprimitives.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_23 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_scalardestructionprimitives.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_23 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_23 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_scalarprimitives.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_scalarprimitives.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_scalarprimitives.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_scalarprimitives.t.ran: $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_24)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_scalarprimitives.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_24 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_scalarprimitives.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_24 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_24 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_selecttrait.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_selecttrait.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_selecttrait.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_selecttrait.t.ran: $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_25)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_selecttrait.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_25 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_selecttrait.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_25 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_25 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_swaputil.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_swaputil.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_swaputil.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_swaputil.t.ran: $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_26)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_swaputil.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_26 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_swaputil.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_26 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_26 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwisecopyable.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwisecopyable.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwisecopyable.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwisecopyable.t.ran: $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_27)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwisecopyable.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_27 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_typetraitbitwisecopyable.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_27 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_27 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwiseequalitycomparable.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwiseequalitycomparable.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwiseequalitycomparable.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwiseequalitycomparable.t.ran: $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_28)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwiseequalitycomparable.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_28 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_typetraitbitwiseequalitycomparable.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_28 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_28 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwisemoveable.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwisemoveable.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwisemoveable.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwisemoveable.t.ran: $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_29)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwisemoveable.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_29 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_typetraitbitwisemoveable.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_29 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_29 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithaspointersemantics.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithaspointersemantics.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithaspointersemantics.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithaspointersemantics.t.ran: $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_30)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithaspointersemantics.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_30 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_typetraithaspointersemantics.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_30 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_30 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithasstliterators.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithasstliterators.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithasstliterators.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithasstliterators.t.ran: $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_31)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithasstliterators.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_31 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_typetraithasstliterators.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_31 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_31 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithastrivialdefaultconstructor.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithastrivialdefaultconstructor.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithastrivialdefaultconstructor.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithastrivialdefaultconstructor.t.ran: $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_32)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithastrivialdefaultconstructor.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_32 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_typetraithastrivialdefaultconstructor.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_32 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_32 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitnil.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitnil.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitnil.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitnil.t.ran: $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_33)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitnil.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_33 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_typetraitnil.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_33 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_33 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitpair.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitpair.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitpair.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitpair.t.ran: $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_34)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitpair.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_34 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_typetraitpair.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_34 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_34 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraits.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraits.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraits.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraits.t.ran: $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_35)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraits.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_35 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_typetraits.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_35 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_35 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitusesbslmaallocator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitusesbslmaallocator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitusesbslmaallocator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitusesbslmaallocator.t.ran: $(builddir)/bslalg_typetraitusesbslmaallocator.t $(builddir)/bslalg_arraydestructionprimitives.t $(builddir)/bslalg_arrayprimitives.t $(builddir)/bslalg_autoarraydestructor.t $(builddir)/bslalg_autoarraymovedestructor.t $(builddir)/bslalg_autoscalardestructor.t $(builddir)/bslalg_bidirectionallink.t $(builddir)/bslalg_bidirectionallinklistutil.t $(builddir)/bslalg_bidirectionalnode.t $(builddir)/bslalg_constructorproxy.t $(builddir)/bslalg_containerbase.t $(builddir)/bslalg_dequeimputil.t $(builddir)/bslalg_dequeiterator.t $(builddir)/bslalg_dequeprimitives.t $(builddir)/bslalg_functoradapter.t $(builddir)/bslalg_hashtableanchor.t $(builddir)/bslalg_hashtablebucket.t $(builddir)/bslalg_hashtableimputil.t $(builddir)/bslalg_hashutil.t $(builddir)/bslalg_hastrait.t $(builddir)/bslalg_rangecompare.t $(builddir)/bslalg_rbtreeanchor.t $(builddir)/bslalg_rbtreenode.t $(builddir)/bslalg_rbtreeutil.t $(builddir)/bslalg_scalardestructionprimitives.t $(builddir)/bslalg_scalarprimitives.t $(builddir)/bslalg_selecttrait.t $(builddir)/bslalg_swaputil.t $(builddir)/bslalg_typetraitbitwisecopyable.t $(builddir)/bslalg_typetraitbitwiseequalitycomparable.t $(builddir)/bslalg_typetraitbitwisemoveable.t $(builddir)/bslalg_typetraithaspointersemantics.t $(builddir)/bslalg_typetraithasstliterators.t $(builddir)/bslalg_typetraithastrivialdefaultconstructor.t $(builddir)/bslalg_typetraitnil.t $(builddir)/bslalg_typetraitpair.t $(builddir)/bslalg_typetraits.t $(builddir)/bslalg_typetraitusesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_36)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitusesbslmaallocator.t.ran
+cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_36 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslalg; mkdir -p $(obj).$(TOOLSET)/bslalg_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslalg_tests_run/geni/bslalg_typetraitusesbslmaallocator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_36 = RULE _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_36 $@
+
+rule__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_outputs := \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_arraydestructionprimitives.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_arrayprimitives.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoarraydestructor.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoarraymovedestructor.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_autoscalardestructor.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionallink.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionallinklistutil.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_bidirectionalnode.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_constructorproxy.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_containerbase.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeimputil.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeiterator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_dequeprimitives.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_functoradapter.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtableanchor.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtablebucket.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashtableimputil.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hashutil.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_hastrait.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rangecompare.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreeanchor.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreenode.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_rbtreeutil.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_scalardestructionprimitives.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_scalarprimitives.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_selecttrait.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_swaputil.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwisecopyable.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwiseequalitycomparable.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitbitwisemoveable.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithaspointersemantics.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithasstliterators.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraithastrivialdefaultconstructor.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitnil.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitpair.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraits.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslalg_typetraitusesbslmaallocator.t.ran
+
+### Finished generating for rule: _root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests
+
+### Finished generating for all rules
+
+DEFS_Debug := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Debug := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Debug :=
+
+DEFS_Profile := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Profile := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option \
+	--coverage
+
+# Flags passed to only C files.
+CFLAGS_C_Profile := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Profile := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Profile :=
+
+DEFS_Release := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_OPT' \
+	'-DNDEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-O2 \
+	-fno-strict-aliasing \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fexceptions
+
+INCS_Release :=
+
+OBJS :=
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/groups/bsl/bslalg/bslalg_tests_build.stamp
+
+# Make sure our actions/rules run before any of us.
+$(OBJS): | $(rule__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_outputs)
+
+
+### Rules for final target.
+# Build our special outputs first.
+$(obj).target/groups/bsl/bslalg/bslalg_tests_run.stamp: | $(rule__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_outputs)
+
+# Preserve order dependency of special output on deps.
+$(rule__root_repo_groups_bsl_bslalg_bslalg_gyp_bslalg_tests_run_target_run_unit_tests_outputs): | $(obj).target/groups/bsl/bslalg/bslalg_tests_build.stamp
+
+$(obj).target/groups/bsl/bslalg/bslalg_tests_run.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslalg/bslalg_tests_run.stamp: $(obj).target/groups/bsl/bslalg/bslalg_tests_build.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bslalg/bslalg_tests_run.stamp
+# Add target alias
+.PHONY: bslalg_tests_run
+bslalg_tests_run: $(obj).target/groups/bsl/bslalg/bslalg_tests_run.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslalg_tests_run
+
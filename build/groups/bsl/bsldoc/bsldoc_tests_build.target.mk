@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bsldoc_tests_build
+### Rules for final target.
+$(obj).target/groups/bsl/bsldoc/bsldoc_tests_build.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bsldoc/bsldoc_tests_build.stamp: $(builddir)/bsldoc_glossary.t FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bsldoc/bsldoc_tests_build.stamp
+# Add target alias
+.PHONY: bsldoc_tests_build
+bsldoc_tests_build: $(obj).target/groups/bsl/bsldoc/bsldoc_tests_build.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bsldoc_tests_build
+
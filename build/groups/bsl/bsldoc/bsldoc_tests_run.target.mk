@@ -0,0 +1,182 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bsldoc_tests_run
+### Generated for rule _root_repo_groups_bsl_bsldoc_bsldoc_gyp_bsldoc_tests_run_target_run_unit_tests:
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsldoc_glossary.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsldoc_glossary.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsldoc_glossary.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsldoc_glossary.t.ran: $(builddir)/bsldoc_glossary.t $(builddir)/bsldoc_glossary.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsldoc_bsldoc_gyp_bsldoc_tests_run_target_run_unit_tests_0)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsldoc_glossary.t.ran
+cmd__root_repo_groups_bsl_bsldoc_bsldoc_gyp_bsldoc_tests_run_target_run_unit_tests_0 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsldoc; mkdir -p $(obj).$(TOOLSET)/bsldoc_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsldoc_tests_run/geni/bsldoc_glossary.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsldoc_bsldoc_gyp_bsldoc_tests_run_target_run_unit_tests_0 = RULE _root_repo_groups_bsl_bsldoc_bsldoc_gyp_bsldoc_tests_run_target_run_unit_tests_0 $@
+
+rule__root_repo_groups_bsl_bsldoc_bsldoc_gyp_bsldoc_tests_run_target_run_unit_tests_outputs := \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsldoc_glossary.t.ran
+
+### Finished generating for rule: _root_repo_groups_bsl_bsldoc_bsldoc_gyp_bsldoc_tests_run_target_run_unit_tests
+
+### Finished generating for all rules
+
+DEFS_Debug := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Debug := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Debug :=
+
+DEFS_Profile := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Profile := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option \
+	--coverage
+
+# Flags passed to only C files.
+CFLAGS_C_Profile := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Profile := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Profile :=
+
+DEFS_Release := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_OPT' \
+	'-DNDEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-O2 \
+	-fno-strict-aliasing \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fexceptions
+
+INCS_Release :=
+
+OBJS :=
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/groups/bsl/bsldoc/bsldoc_tests_build.stamp
+
+# Make sure our actions/rules run before any of us.
+$(OBJS): | $(rule__root_repo_groups_bsl_bsldoc_bsldoc_gyp_bsldoc_tests_run_target_run_unit_tests_outputs)
+
+
+### Rules for final target.
+# Build our special outputs first.
+$(obj).target/groups/bsl/bsldoc/bsldoc_tests_run.stamp: | $(rule__root_repo_groups_bsl_bsldoc_bsldoc_gyp_bsldoc_tests_run_target_run_unit_tests_outputs)
+
+# Preserve order dependency of special output on deps.
+$(rule__root_repo_groups_bsl_bsldoc_bsldoc_gyp_bsldoc_tests_run_target_run_unit_tests_outputs): | $(obj).target/groups/bsl/bsldoc/bsldoc_tests_build.stamp
+
+$(obj).target/groups/bsl/bsldoc/bsldoc_tests_run.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bsldoc/bsldoc_tests_run.stamp: $(obj).target/groups/bsl/bsldoc/bsldoc_tests_build.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bsldoc/bsldoc_tests_run.stamp
+# Add target alias
+.PHONY: bsldoc_tests_run
+bsldoc_tests_run: $(obj).target/groups/bsl/bsldoc/bsldoc_tests_run.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bsldoc_tests_run
+
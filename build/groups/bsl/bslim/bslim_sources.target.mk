@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslim_sources
+### Rules for final target.
+$(obj).target/groups/bsl/bslim/bslim_sources.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslim/bslim_sources.stamp:  FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bslim/bslim_sources.stamp
+# Add target alias
+.PHONY: bslim_sources
+bslim_sources: $(obj).target/groups/bsl/bslim/bslim_sources.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslim_sources
+
@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslim_tests_build
+### Rules for final target.
+$(obj).target/groups/bsl/bslim/bslim_tests_build.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslim/bslim_tests_build.stamp: $(builddir)/bslim_printer.t FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bslim/bslim_tests_build.stamp
+# Add target alias
+.PHONY: bslim_tests_build
+bslim_tests_build: $(obj).target/groups/bsl/bslim/bslim_tests_build.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslim_tests_build
+
@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslma_sources
+### Rules for final target.
+$(obj).target/groups/bsl/bslma/bslma_sources.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslma/bslma_sources.stamp:  FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bslma/bslma_sources.stamp
+# Add target alias
+.PHONY: bslma_sources
+bslma_sources: $(obj).target/groups/bsl/bslma/bslma_sources.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslma_sources
+
@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslma_tests_build
+### Rules for final target.
+$(obj).target/groups/bsl/bslma/bslma_tests_build.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslma/bslma_tests_build.stamp: $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bslma/bslma_tests_build.stamp
+# Add target alias
+.PHONY: bslma_tests_build
+bslma_tests_build: $(obj).target/groups/bsl/bslma/bslma_tests_build.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslma_tests_build
+
@@ -0,0 +1,391 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslma_tests_run
+### Generated for rule _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests:
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_allocator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_allocator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_allocator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_allocator.t.ran: $(builddir)/bslma_allocator.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_0)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_allocator.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_0 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_allocator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_0 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_0 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autodeallocator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autodeallocator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autodeallocator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autodeallocator.t.ran: $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_1)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autodeallocator.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_1 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_autodeallocator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_1 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_1 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autodestructor.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autodestructor.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autodestructor.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autodestructor.t.ran: $(builddir)/bslma_autodestructor.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_2)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autodestructor.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_2 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_autodestructor.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_2 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_2 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autorawdeleter.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autorawdeleter.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autorawdeleter.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autorawdeleter.t.ran: $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_3)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autorawdeleter.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_3 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_autorawdeleter.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_3 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_3 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deallocatorguard.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deallocatorguard.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deallocatorguard.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deallocatorguard.t.ran: $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_4)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deallocatorguard.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_4 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_deallocatorguard.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_4 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_4 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deallocatorproctor.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deallocatorproctor.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deallocatorproctor.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deallocatorproctor.t.ran: $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_5)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deallocatorproctor.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_5 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_deallocatorproctor.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_5 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_5 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_default.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_default.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_default.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_default.t.ran: $(builddir)/bslma_default.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_6)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_default.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_6 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_default.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_6 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_6 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_defaultallocatorguard.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_defaultallocatorguard.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_defaultallocatorguard.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_defaultallocatorguard.t.ran: $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_7)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_defaultallocatorguard.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_7 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_defaultallocatorguard.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_7 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_7 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deleterhelper.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deleterhelper.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deleterhelper.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deleterhelper.t.ran: $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_8)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deleterhelper.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_8 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_deleterhelper.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_8 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_8 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_destructorguard.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_destructorguard.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_destructorguard.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_destructorguard.t.ran: $(builddir)/bslma_destructorguard.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_9)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_destructorguard.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_9 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_destructorguard.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_9 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_9 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_destructorproctor.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_destructorproctor.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_destructorproctor.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_destructorproctor.t.ran: $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_10)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_destructorproctor.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_10 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_destructorproctor.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_10 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_10 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_exceptionguard.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_exceptionguard.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_exceptionguard.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_exceptionguard.t.ran: $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_11)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_exceptionguard.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_11 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_exceptionguard.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_11 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_11 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_mallocfreeallocator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_mallocfreeallocator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_mallocfreeallocator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_mallocfreeallocator.t.ran: $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_12)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_mallocfreeallocator.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_12 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_mallocfreeallocator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_12 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_12 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_newdeleteallocator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_newdeleteallocator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_newdeleteallocator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_newdeleteallocator.t.ran: $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_13)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_newdeleteallocator.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_13 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_newdeleteallocator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_13 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_13 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_rawdeleterguard.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_rawdeleterguard.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_rawdeleterguard.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_rawdeleterguard.t.ran: $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_14)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_rawdeleterguard.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_14 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_rawdeleterguard.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_14 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_14 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_rawdeleterproctor.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_rawdeleterproctor.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_rawdeleterproctor.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_rawdeleterproctor.t.ran: $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_15)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_rawdeleterproctor.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_15 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_rawdeleterproctor.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_15 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_15 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocator.t.ran: $(builddir)/bslma_testallocator.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_16)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocator.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_16 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_testallocator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_16 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_16 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocatorexception.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocatorexception.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocatorexception.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocatorexception.t.ran: $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_17)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocatorexception.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_17 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_testallocatorexception.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_17 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_17 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocatormonitor.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocatormonitor.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocatormonitor.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocatormonitor.t.ran: $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_18)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocatormonitor.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_18 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_testallocatormonitor.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_18 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_18 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_usesbslmaallocator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_usesbslmaallocator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_usesbslmaallocator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_usesbslmaallocator.t.ran: $(builddir)/bslma_usesbslmaallocator.t $(builddir)/bslma_allocator.t $(builddir)/bslma_autodeallocator.t $(builddir)/bslma_autodestructor.t $(builddir)/bslma_autorawdeleter.t $(builddir)/bslma_deallocatorguard.t $(builddir)/bslma_deallocatorproctor.t $(builddir)/bslma_default.t $(builddir)/bslma_defaultallocatorguard.t $(builddir)/bslma_deleterhelper.t $(builddir)/bslma_destructorguard.t $(builddir)/bslma_destructorproctor.t $(builddir)/bslma_exceptionguard.t $(builddir)/bslma_mallocfreeallocator.t $(builddir)/bslma_newdeleteallocator.t $(builddir)/bslma_rawdeleterguard.t $(builddir)/bslma_rawdeleterproctor.t $(builddir)/bslma_testallocator.t $(builddir)/bslma_testallocatorexception.t $(builddir)/bslma_testallocatormonitor.t $(builddir)/bslma_usesbslmaallocator.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_19)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslma_usesbslmaallocator.t.ran
+cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_19 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslma; mkdir -p $(obj).$(TOOLSET)/bslma_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslma_tests_run/geni/bslma_usesbslmaallocator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_19 = RULE _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_19 $@
+
+rule__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_outputs := \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_allocator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autodeallocator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autodestructor.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_autorawdeleter.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deallocatorguard.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deallocatorproctor.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_default.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_defaultallocatorguard.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_deleterhelper.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_destructorguard.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_destructorproctor.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_exceptionguard.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_mallocfreeallocator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_newdeleteallocator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_rawdeleterguard.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_rawdeleterproctor.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocatorexception.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_testallocatormonitor.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslma_usesbslmaallocator.t.ran
+
+### Finished generating for rule: _root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests
+
+### Finished generating for all rules
+
+DEFS_Debug := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Debug := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Debug :=
+
+DEFS_Profile := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Profile := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option \
+	--coverage
+
+# Flags passed to only C files.
+CFLAGS_C_Profile := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Profile := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Profile :=
+
+DEFS_Release := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_OPT' \
+	'-DNDEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-O2 \
+	-fno-strict-aliasing \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fexceptions
+
+INCS_Release :=
+
+OBJS :=
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/groups/bsl/bslma/bslma_tests_build.stamp
+
+# Make sure our actions/rules run before any of us.
+$(OBJS): | $(rule__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_outputs)
+
+
+### Rules for final target.
+# Build our special outputs first.
+$(obj).target/groups/bsl/bslma/bslma_tests_run.stamp: | $(rule__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_outputs)
+
+# Preserve order dependency of special output on deps.
+$(rule__root_repo_groups_bsl_bslma_bslma_gyp_bslma_tests_run_target_run_unit_tests_outputs): | $(obj).target/groups/bsl/bslma/bslma_tests_build.stamp
+
+$(obj).target/groups/bsl/bslma/bslma_tests_run.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslma/bslma_tests_run.stamp: $(obj).target/groups/bsl/bslma/bslma_tests_build.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bslma/bslma_tests_run.stamp
+# Add target alias
+.PHONY: bslma_tests_run
+bslma_tests_run: $(obj).target/groups/bsl/bslma/bslma_tests_run.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslma_tests_run
+
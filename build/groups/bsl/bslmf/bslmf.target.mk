@@ -0,0 +1,264 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslmf
+DEFS_Debug := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Debug := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Debug := \
+	-I$(srcdir)/groups/bsl/bsls \
+	-I$(srcdir)/groups/bsl/bslscm \
+	-I$(srcdir)/groups/bsl/bslmf
+
+DEFS_Profile := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Profile := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option \
+	--coverage
+
+# Flags passed to only C files.
+CFLAGS_C_Profile := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Profile := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Profile := \
+	-I$(srcdir)/groups/bsl/bsls \
+	-I$(srcdir)/groups/bsl/bslscm \
+	-I$(srcdir)/groups/bsl/bslmf
+
+DEFS_Release := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_OPT' \
+	'-DNDEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-O2 \
+	-fno-strict-aliasing \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fexceptions
+
+INCS_Release := \
+	-I$(srcdir)/groups/bsl/bsls \
+	-I$(srcdir)/groups/bsl/bslscm \
+	-I$(srcdir)/groups/bsl/bslmf
+
+OBJS := \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_addconst.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_addcv.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_addlvaluereference.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_addpointer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_addreference.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_addrvaluereference.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_addvolatile.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_arraytopointer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_assert.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_conditional.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_detectnestedtrait.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_enableif.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_forwardingtype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_functionpointertraits.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_haspointersemantics.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_if.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_integralconstant.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isarithmetic.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isarray.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isbitwiseequalitycomparable.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isbitwisemoveable.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isclass.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isconst.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isconvertible.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isconvertibletoany.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isenum.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isfloatingpoint.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isfunction.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isfundamental.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isintegral.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_islvaluereference.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_ismemberfunctionpointer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_ismemberobjectpointer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_ismemberpointer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_ispair.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_ispointer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_ispointertomember.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_ispolymorphic.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isreference.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isrvaluereference.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_issame.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_istriviallycopyable.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_istriviallydefaultconstructible.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isvoid.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_isvolatile.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_matchanytype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_matcharithmetictype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_memberfunctionpointertraits.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_metaint.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_nestedtraitdeclaration.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_nil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_removeconst.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_removecv.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_removecvq.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_removepointer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_removereference.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_removevolatile.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_selecttrait.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_switch.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_tag.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslmf/bslmf_typelist.o
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/groups/bsl/bsl_grpdeps.stamp $(obj).target/groups/bsl/bslmf/bslmf_sources.stamp
+
+# CFLAGS et al overrides must be target-local.
+# See "Target-specific Variable Values" in the GNU Make manual.
+$(OBJS): TOOLSET := $(TOOLSET)
+$(OBJS): GYP_CFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_C_$(BUILDTYPE))
+$(OBJS): GYP_CXXFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_CC_$(BUILDTYPE))
+
+# Suffix rules, putting all outputs into $(obj).
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(srcdir)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# Try building from generated source, too.
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj).$(TOOLSET)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# End of this set of suffix rules
+### Rules for final target.
+LDFLAGS_Debug := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack
+
+LDFLAGS_Profile := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack \
+	--coverage
+
+LDFLAGS_Release := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack
+
+LIBS :=
+
+$(obj).target/groups/bsl/bslmf/libbslmf.a: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
+$(obj).target/groups/bsl/bslmf/libbslmf.a: LIBS := $(LIBS)
+$(obj).target/groups/bsl/bslmf/libbslmf.a: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslmf/libbslmf.a: $(OBJS) FORCE_DO_CMD
+	$(call do_cmd,alink)
+
+all_deps += $(obj).target/groups/bsl/bslmf/libbslmf.a
+# Add target alias
+.PHONY: bslmf
+bslmf: $(obj).target/groups/bsl/bslmf/libbslmf.a
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslmf
+
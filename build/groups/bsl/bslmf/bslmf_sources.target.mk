@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslmf_sources
+### Rules for final target.
+$(obj).target/groups/bsl/bslmf/bslmf_sources.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslmf/bslmf_sources.stamp:  FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bslmf/bslmf_sources.stamp
+# Add target alias
+.PHONY: bslmf_sources
+bslmf_sources: $(obj).target/groups/bsl/bslmf/bslmf_sources.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslmf_sources
+
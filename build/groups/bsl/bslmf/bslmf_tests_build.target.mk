@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslmf_tests_build
+### Rules for final target.
+$(obj).target/groups/bsl/bslmf/bslmf_tests_build.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslmf/bslmf_tests_build.stamp: $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bslmf/bslmf_tests_build.stamp
+# Add target alias
+.PHONY: bslmf_tests_build
+bslmf_tests_build: $(obj).target/groups/bsl/bslmf/bslmf_tests_build.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslmf_tests_build
+
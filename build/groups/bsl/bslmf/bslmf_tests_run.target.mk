@@ -0,0 +1,842 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslmf_tests_run
+### Generated for rule _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests:
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addconst.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addconst.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addconst.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addconst.t.ran: $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_0)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addconst.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_0 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_addconst.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_0 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_0 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addcv.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addcv.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addcv.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addcv.t.ran: $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_1)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addcv.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_1 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_addcv.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_1 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_1 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addlvaluereference.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addlvaluereference.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addlvaluereference.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addlvaluereference.t.ran: $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_2)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addlvaluereference.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_2 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_addlvaluereference.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_2 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_2 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addpointer.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addpointer.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addpointer.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addpointer.t.ran: $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_3)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addpointer.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_3 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_addpointer.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_3 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_3 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addreference.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addreference.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addreference.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addreference.t.ran: $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_4)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addreference.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_4 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_addreference.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_4 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_4 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addrvaluereference.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addrvaluereference.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addrvaluereference.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addrvaluereference.t.ran: $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_5)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addrvaluereference.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_5 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_addrvaluereference.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_5 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_5 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addvolatile.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addvolatile.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addvolatile.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addvolatile.t.ran: $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_6)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addvolatile.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_6 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_addvolatile.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_6 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_6 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_arraytopointer.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_arraytopointer.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_arraytopointer.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_arraytopointer.t.ran: $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_7)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_arraytopointer.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_7 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_arraytopointer.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_7 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_7 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_assert.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_assert.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_assert.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_assert.t.ran: $(builddir)/bslmf_assert.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_8)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_assert.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_8 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_assert.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_8 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_8 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_conditional.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_conditional.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_conditional.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_conditional.t.ran: $(builddir)/bslmf_conditional.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_9)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_conditional.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_9 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_conditional.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_9 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_9 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_detectnestedtrait.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_detectnestedtrait.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_detectnestedtrait.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_detectnestedtrait.t.ran: $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_10)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_detectnestedtrait.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_10 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_detectnestedtrait.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_10 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_10 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_enableif.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_enableif.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_enableif.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_enableif.t.ran: $(builddir)/bslmf_enableif.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_11)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_enableif.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_11 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_enableif.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_11 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_11 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_forwardingtype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_forwardingtype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_forwardingtype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_forwardingtype.t.ran: $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_12)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_forwardingtype.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_12 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_forwardingtype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_12 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_12 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_functionpointertraits.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_functionpointertraits.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_functionpointertraits.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_functionpointertraits.t.ran: $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_13)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_functionpointertraits.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_13 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_functionpointertraits.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_13 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_13 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_haspointersemantics.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_haspointersemantics.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_haspointersemantics.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_haspointersemantics.t.ran: $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_14)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_haspointersemantics.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_14 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_haspointersemantics.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_14 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_14 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_if.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_if.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_if.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_if.t.ran: $(builddir)/bslmf_if.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_15)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_if.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_15 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_if.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_15 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_15 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_integralconstant.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_integralconstant.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_integralconstant.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_integralconstant.t.ran: $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_16)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_integralconstant.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_16 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_integralconstant.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_16 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_16 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isarithmetic.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isarithmetic.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isarithmetic.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isarithmetic.t.ran: $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_17)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isarithmetic.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_17 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isarithmetic.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_17 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_17 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isarray.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isarray.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isarray.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isarray.t.ran: $(builddir)/bslmf_isarray.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_18)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isarray.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_18 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isarray.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_18 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_18 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isbitwiseequalitycomparable.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isbitwiseequalitycomparable.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isbitwiseequalitycomparable.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isbitwiseequalitycomparable.t.ran: $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_19)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isbitwiseequalitycomparable.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_19 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isbitwiseequalitycomparable.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_19 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_19 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isbitwisemoveable.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isbitwisemoveable.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isbitwisemoveable.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isbitwisemoveable.t.ran: $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_20)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isbitwisemoveable.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_20 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isbitwisemoveable.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_20 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_20 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isclass.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isclass.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isclass.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isclass.t.ran: $(builddir)/bslmf_isclass.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_21)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isclass.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_21 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isclass.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_21 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_21 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconst.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconst.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconst.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconst.t.ran: $(builddir)/bslmf_isconst.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_22)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconst.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_22 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isconst.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_22 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_22 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconvertible.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconvertible.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconvertible.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconvertible.t.ran: $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_23)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconvertible.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_23 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isconvertible.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_23 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_23 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconvertibletoany.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconvertibletoany.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconvertibletoany.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconvertibletoany.t.ran: $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_24)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconvertibletoany.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_24 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isconvertibletoany.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_24 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_24 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isenum.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isenum.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isenum.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isenum.t.ran: $(builddir)/bslmf_isenum.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_25)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isenum.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_25 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isenum.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_25 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_25 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfloatingpoint.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfloatingpoint.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfloatingpoint.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfloatingpoint.t.ran: $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_26)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfloatingpoint.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_26 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isfloatingpoint.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_26 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_26 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfunction.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfunction.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfunction.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfunction.t.ran: $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_27)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfunction.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_27 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isfunction.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_27 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_27 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfundamental.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfundamental.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfundamental.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfundamental.t.ran: $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_28)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfundamental.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_28 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isfundamental.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_28 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_28 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isintegral.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isintegral.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isintegral.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isintegral.t.ran: $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_29)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isintegral.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_29 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isintegral.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_29 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_29 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_islvaluereference.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_islvaluereference.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_islvaluereference.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_islvaluereference.t.ran: $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_30)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_islvaluereference.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_30 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_islvaluereference.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_30 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_30 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberfunctionpointer.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberfunctionpointer.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberfunctionpointer.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberfunctionpointer.t.ran: $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_31)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberfunctionpointer.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_31 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_ismemberfunctionpointer.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_31 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_31 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberobjectpointer.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberobjectpointer.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberobjectpointer.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberobjectpointer.t.ran: $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_32)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberobjectpointer.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_32 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_ismemberobjectpointer.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_32 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_32 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberpointer.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberpointer.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberpointer.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberpointer.t.ran: $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_33)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberpointer.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_33 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_ismemberpointer.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_33 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_33 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispair.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispair.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispair.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispair.t.ran: $(builddir)/bslmf_ispair.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_34)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispair.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_34 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_ispair.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_34 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_34 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispointer.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispointer.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispointer.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispointer.t.ran: $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_35)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispointer.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_35 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_ispointer.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_35 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_35 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispointertomember.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispointertomember.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispointertomember.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispointertomember.t.ran: $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_36)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispointertomember.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_36 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_ispointertomember.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_36 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_36 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispolymorphic.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispolymorphic.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispolymorphic.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispolymorphic.t.ran: $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_37)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispolymorphic.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_37 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_ispolymorphic.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_37 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_37 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isreference.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isreference.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isreference.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isreference.t.ran: $(builddir)/bslmf_isreference.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_38)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isreference.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_38 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isreference.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_38 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_38 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isrvaluereference.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isrvaluereference.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isrvaluereference.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isrvaluereference.t.ran: $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_39)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isrvaluereference.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_39 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isrvaluereference.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_39 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_39 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_issame.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_issame.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_issame.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_issame.t.ran: $(builddir)/bslmf_issame.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_40)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_issame.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_40 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_issame.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_40 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_40 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_istriviallycopyable.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_istriviallycopyable.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_istriviallycopyable.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_istriviallycopyable.t.ran: $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_41)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_istriviallycopyable.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_41 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_istriviallycopyable.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_41 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_41 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_istriviallydefaultconstructible.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_istriviallydefaultconstructible.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_istriviallydefaultconstructible.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_istriviallydefaultconstructible.t.ran: $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_42)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_istriviallydefaultconstructible.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_42 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_istriviallydefaultconstructible.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_42 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_42 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isvoid.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isvoid.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isvoid.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isvoid.t.ran: $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_43)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isvoid.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_43 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isvoid.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_43 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_43 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isvolatile.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isvolatile.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isvolatile.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isvolatile.t.ran: $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_44)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isvolatile.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_44 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_isvolatile.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_44 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_44 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_matchanytype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_matchanytype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_matchanytype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_matchanytype.t.ran: $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_45)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_matchanytype.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_45 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_matchanytype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_45 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_45 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_matcharithmetictype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_matcharithmetictype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_matcharithmetictype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_matcharithmetictype.t.ran: $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_46)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_matcharithmetictype.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_46 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_matcharithmetictype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_46 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_46 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_memberfunctionpointertraits.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_memberfunctionpointertraits.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_memberfunctionpointertraits.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_memberfunctionpointertraits.t.ran: $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_47)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_memberfunctionpointertraits.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_47 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_memberfunctionpointertraits.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_47 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_47 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_metaint.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_metaint.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_metaint.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_metaint.t.ran: $(builddir)/bslmf_metaint.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_48)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_metaint.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_48 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_metaint.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_48 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_48 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_nestedtraitdeclaration.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_nestedtraitdeclaration.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_nestedtraitdeclaration.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_nestedtraitdeclaration.t.ran: $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_49)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_nestedtraitdeclaration.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_49 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_nestedtraitdeclaration.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_49 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_49 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_nil.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_nil.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_nil.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_nil.t.ran: $(builddir)/bslmf_nil.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_50)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_nil.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_50 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_nil.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_50 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_50 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removeconst.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removeconst.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removeconst.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removeconst.t.ran: $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_51)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removeconst.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_51 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_removeconst.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_51 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_51 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removecv.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removecv.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removecv.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removecv.t.ran: $(builddir)/bslmf_removecv.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_52)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removecv.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_52 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_removecv.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_52 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_52 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removecvq.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removecvq.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removecvq.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removecvq.t.ran: $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_53)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removecvq.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_53 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_removecvq.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_53 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_53 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removepointer.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removepointer.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removepointer.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removepointer.t.ran: $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_54)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removepointer.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_54 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_removepointer.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_54 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_54 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removereference.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removereference.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removereference.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removereference.t.ran: $(builddir)/bslmf_removereference.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_55)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removereference.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_55 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_removereference.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_55 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_55 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removevolatile.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removevolatile.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removevolatile.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removevolatile.t.ran: $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_56)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removevolatile.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_56 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_removevolatile.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_56 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_56 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_selecttrait.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_selecttrait.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_selecttrait.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_selecttrait.t.ran: $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_57)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_selecttrait.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_57 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_selecttrait.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_57 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_57 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_switch.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_switch.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_switch.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_switch.t.ran: $(builddir)/bslmf_switch.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_58)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_switch.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_58 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_switch.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_58 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_58 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_tag.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_tag.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_tag.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_tag.t.ran: $(builddir)/bslmf_tag.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_59)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_tag.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_59 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_tag.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_59 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_59 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_typelist.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_typelist.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_typelist.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_typelist.t.ran: $(builddir)/bslmf_typelist.t $(builddir)/bslmf_addconst.t $(builddir)/bslmf_addcv.t $(builddir)/bslmf_addlvaluereference.t $(builddir)/bslmf_addpointer.t $(builddir)/bslmf_addreference.t $(builddir)/bslmf_addrvaluereference.t $(builddir)/bslmf_addvolatile.t $(builddir)/bslmf_arraytopointer.t $(builddir)/bslmf_assert.t $(builddir)/bslmf_conditional.t $(builddir)/bslmf_detectnestedtrait.t $(builddir)/bslmf_enableif.t $(builddir)/bslmf_forwardingtype.t $(builddir)/bslmf_functionpointertraits.t $(builddir)/bslmf_haspointersemantics.t $(builddir)/bslmf_if.t $(builddir)/bslmf_integralconstant.t $(builddir)/bslmf_isarithmetic.t $(builddir)/bslmf_isarray.t $(builddir)/bslmf_isbitwiseequalitycomparable.t $(builddir)/bslmf_isbitwisemoveable.t $(builddir)/bslmf_isclass.t $(builddir)/bslmf_isconst.t $(builddir)/bslmf_isconvertible.t $(builddir)/bslmf_isconvertibletoany.t $(builddir)/bslmf_isenum.t $(builddir)/bslmf_isfloatingpoint.t $(builddir)/bslmf_isfunction.t $(builddir)/bslmf_isfundamental.t $(builddir)/bslmf_isintegral.t $(builddir)/bslmf_islvaluereference.t $(builddir)/bslmf_ismemberfunctionpointer.t $(builddir)/bslmf_ismemberobjectpointer.t $(builddir)/bslmf_ismemberpointer.t $(builddir)/bslmf_ispair.t $(builddir)/bslmf_ispointer.t $(builddir)/bslmf_ispointertomember.t $(builddir)/bslmf_ispolymorphic.t $(builddir)/bslmf_isreference.t $(builddir)/bslmf_isrvaluereference.t $(builddir)/bslmf_issame.t $(builddir)/bslmf_istriviallycopyable.t $(builddir)/bslmf_istriviallydefaultconstructible.t $(builddir)/bslmf_isvoid.t $(builddir)/bslmf_isvolatile.t $(builddir)/bslmf_matchanytype.t $(builddir)/bslmf_matcharithmetictype.t $(builddir)/bslmf_memberfunctionpointertraits.t $(builddir)/bslmf_metaint.t $(builddir)/bslmf_nestedtraitdeclaration.t $(builddir)/bslmf_nil.t $(builddir)/bslmf_removeconst.t $(builddir)/bslmf_removecv.t $(builddir)/bslmf_removecvq.t $(builddir)/bslmf_removepointer.t $(builddir)/bslmf_removereference.t $(builddir)/bslmf_removevolatile.t $(builddir)/bslmf_selecttrait.t $(builddir)/bslmf_switch.t $(builddir)/bslmf_tag.t $(builddir)/bslmf_typelist.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_60)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_typelist.t.ran
+cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_60 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslmf; mkdir -p $(obj).$(TOOLSET)/bslmf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslmf_tests_run/geni/bslmf_typelist.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_60 = RULE _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_60 $@
+
+rule__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_outputs := \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addconst.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addcv.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addlvaluereference.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addpointer.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addreference.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addrvaluereference.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_addvolatile.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_arraytopointer.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_assert.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_conditional.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_detectnestedtrait.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_enableif.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_forwardingtype.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_functionpointertraits.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_haspointersemantics.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_if.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_integralconstant.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isarithmetic.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isarray.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isbitwiseequalitycomparable.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isbitwisemoveable.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isclass.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconst.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconvertible.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isconvertibletoany.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isenum.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfloatingpoint.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfunction.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isfundamental.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isintegral.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_islvaluereference.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberfunctionpointer.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberobjectpointer.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ismemberpointer.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispair.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispointer.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispointertomember.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_ispolymorphic.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isreference.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isrvaluereference.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_issame.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_istriviallycopyable.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_istriviallydefaultconstructible.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isvoid.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_isvolatile.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_matchanytype.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_matcharithmetictype.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_memberfunctionpointertraits.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_metaint.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_nestedtraitdeclaration.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_nil.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removeconst.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removecv.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removecvq.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removepointer.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removereference.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_removevolatile.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_selecttrait.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_switch.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_tag.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslmf_typelist.t.ran
+
+### Finished generating for rule: _root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests
+
+### Finished generating for all rules
+
+DEFS_Debug := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Debug := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Debug :=
+
+DEFS_Profile := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Profile := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option \
+	--coverage
+
+# Flags passed to only C files.
+CFLAGS_C_Profile := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Profile := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Profile :=
+
+DEFS_Release := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_OPT' \
+	'-DNDEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-O2 \
+	-fno-strict-aliasing \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fexceptions
+
+INCS_Release :=
+
+OBJS :=
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/groups/bsl/bslmf/bslmf_tests_build.stamp
+
+# Make sure our actions/rules run before any of us.
+$(OBJS): | $(rule__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_outputs)
+
+
+### Rules for final target.
+# Build our special outputs first.
+$(obj).target/groups/bsl/bslmf/bslmf_tests_run.stamp: | $(rule__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_outputs)
+
+# Preserve order dependency of special output on deps.
+$(rule__root_repo_groups_bsl_bslmf_bslmf_gyp_bslmf_tests_run_target_run_unit_tests_outputs): | $(obj).target/groups/bsl/bslmf/bslmf_tests_build.stamp
+
+$(obj).target/groups/bsl/bslmf/bslmf_tests_run.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslmf/bslmf_tests_run.stamp: $(obj).target/groups/bsl/bslmf/bslmf_tests_build.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bslmf/bslmf_tests_run.stamp
+# Add target alias
+.PHONY: bslmf_tests_run
+bslmf_tests_run: $(obj).target/groups/bsl/bslmf/bslmf_tests_run.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslmf_tests_run
+
@@ -0,0 +1,241 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bsls
+DEFS_Debug := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Debug := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Debug := \
+	-I$(srcdir)/groups/bsl/bsls
+
+DEFS_Profile := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Profile := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option \
+	--coverage
+
+# Flags passed to only C files.
+CFLAGS_C_Profile := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Profile := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Profile := \
+	-I$(srcdir)/groups/bsl/bsls
+
+DEFS_Release := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_OPT' \
+	'-DNDEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-O2 \
+	-fno-strict-aliasing \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fexceptions
+
+INCS_Release := \
+	-I$(srcdir)/groups/bsl/bsls
+
+OBJS := \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_alignedbuffer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_alignment.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_alignmentfromtype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_alignmentimp.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_alignmenttotype.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_alignmentutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_annotation.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_assert.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_asserttest.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_asserttestexception.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomic.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_default.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_ia64_hp_acc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_powerpc32_aix_xlc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_powerpc64_aix_xlc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_powerpc_aix_gcc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_powerpc_aix_xlc_default.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_sparc32_sun_cc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_sparc64_sun_cc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_sparc_sun_cc_default.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_x64_all_gcc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_x64_win_msvc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_x86_all_gcc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_atomicoperations_x86_win_msvc.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_blockgrowth.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_bsltestutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_buildtarget.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_byteorder.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_compilerfeatures.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_exceptionutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_ident.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_macroincrement.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_nativestd.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_nullptr.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_objectbuffer.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_performancehint.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_platform.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_protocoltest.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_stopwatch.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_timeutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_types.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_unspecifiedbool.o \
+	$(obj).target/$(TARGET)/groups/bsl/bsls/bsls_util.o
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/groups/bsl/bsl_grpdeps.stamp $(obj).target/groups/bsl/bsls/bsls_sources.stamp
+
+# CFLAGS et al overrides must be target-local.
+# See "Target-specific Variable Values" in the GNU Make manual.
+$(OBJS): TOOLSET := $(TOOLSET)
+$(OBJS): GYP_CFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_C_$(BUILDTYPE))
+$(OBJS): GYP_CXXFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_CC_$(BUILDTYPE))
+
+# Suffix rules, putting all outputs into $(obj).
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(srcdir)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# Try building from generated source, too.
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj).$(TOOLSET)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# End of this set of suffix rules
+### Rules for final target.
+LDFLAGS_Debug := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack
+
+LDFLAGS_Profile := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack \
+	--coverage
+
+LDFLAGS_Release := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack
+
+LIBS :=
+
+$(obj).target/groups/bsl/bsls/libbsls.a: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
+$(obj).target/groups/bsl/bsls/libbsls.a: LIBS := $(LIBS)
+$(obj).target/groups/bsl/bsls/libbsls.a: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bsls/libbsls.a: $(OBJS) FORCE_DO_CMD
+	$(call do_cmd,alink)
+
+all_deps += $(obj).target/groups/bsl/bsls/libbsls.a
+# Add target alias
+.PHONY: bsls
+bsls: $(obj).target/groups/bsl/bsls/libbsls.a
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bsls
+
@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bsls_tests_build
+### Rules for final target.
+$(obj).target/groups/bsl/bsls/bsls_tests_build.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bsls/bsls_tests_build.stamp: $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bsls/bsls_tests_build.stamp
+# Add target alias
+.PHONY: bsls_tests_build
+bsls_tests_build: $(obj).target/groups/bsl/bsls/bsls_tests_build.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bsls_tests_build
+
@@ -0,0 +1,655 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bsls_tests_run
+### Generated for rule _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests:
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignedbuffer.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignedbuffer.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignedbuffer.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignedbuffer.t.ran: $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_0)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignedbuffer.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_0 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_alignedbuffer.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_0 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_0 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignment.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignment.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignment.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignment.t.ran: $(builddir)/bsls_alignment.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_1)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignment.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_1 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_alignment.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_1 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_1 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentfromtype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentfromtype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentfromtype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentfromtype.t.ran: $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_2)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentfromtype.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_2 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_alignmentfromtype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_2 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_2 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentimp.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentimp.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentimp.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentimp.t.ran: $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_3)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentimp.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_3 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_alignmentimp.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_3 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_3 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmenttotype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmenttotype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmenttotype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmenttotype.t.ran: $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_4)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmenttotype.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_4 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_alignmenttotype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_4 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_4 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentutil.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentutil.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentutil.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentutil.t.ran: $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_5)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentutil.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_5 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_alignmentutil.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_5 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_5 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_annotation.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_annotation.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_annotation.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_annotation.t.ran: $(builddir)/bsls_annotation.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_6)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_annotation.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_6 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_annotation.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_6 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_6 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_assert.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_assert.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_assert.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_assert.t.ran: $(builddir)/bsls_assert.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_7)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_assert.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_7 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_assert.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_7 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_7 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_asserttest.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_asserttest.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_asserttest.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_asserttest.t.ran: $(builddir)/bsls_asserttest.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_8)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_asserttest.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_8 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_asserttest.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_8 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_8 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_asserttestexception.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_asserttestexception.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_asserttestexception.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_asserttestexception.t.ran: $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_9)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_asserttestexception.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_9 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_asserttestexception.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_9 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_9 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomic.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomic.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomic.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomic.t.ran: $(builddir)/bsls_atomic.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_10)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomic.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_10 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_atomic.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_10 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_10 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations.t.ran: $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_11)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_11 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_atomicoperations.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_11 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_11 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_default.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_default.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_default.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_default.t.ran: $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_12)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_default.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_12 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_atomicoperations_default.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_12 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_12 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_ia64_hp_acc.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_ia64_hp_acc.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_ia64_hp_acc.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_ia64_hp_acc.t.ran: $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_13)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_ia64_hp_acc.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_13 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_atomicoperations_ia64_hp_acc.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_13 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_13 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc32_aix_xlc.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc32_aix_xlc.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc32_aix_xlc.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc32_aix_xlc.t.ran: $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_14)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc32_aix_xlc.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_14 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_atomicoperations_powerpc32_aix_xlc.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_14 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_14 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc64_aix_xlc.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc64_aix_xlc.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc64_aix_xlc.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc64_aix_xlc.t.ran: $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_15)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc64_aix_xlc.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_15 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_atomicoperations_powerpc64_aix_xlc.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_15 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_15 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc_aix_gcc.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc_aix_gcc.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc_aix_gcc.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc_aix_gcc.t.ran: $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_16)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc_aix_gcc.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_16 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_atomicoperations_powerpc_aix_gcc.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_16 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_16 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc_aix_xlc_default.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc_aix_xlc_default.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc_aix_xlc_default.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc_aix_xlc_default.t.ran: $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_17)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc_aix_xlc_default.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_17 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_atomicoperations_powerpc_aix_xlc_default.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_17 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_17 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc32_sun_cc.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc32_sun_cc.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc32_sun_cc.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc32_sun_cc.t.ran: $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_18)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc32_sun_cc.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_18 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_atomicoperations_sparc32_sun_cc.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_18 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_18 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc64_sun_cc.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc64_sun_cc.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc64_sun_cc.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc64_sun_cc.t.ran: $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_19)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc64_sun_cc.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_19 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_atomicoperations_sparc64_sun_cc.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_19 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_19 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc_sun_cc_default.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc_sun_cc_default.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc_sun_cc_default.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc_sun_cc_default.t.ran: $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_20)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc_sun_cc_default.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_20 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_atomicoperations_sparc_sun_cc_default.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_20 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_20 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x64_all_gcc.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x64_all_gcc.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x64_all_gcc.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x64_all_gcc.t.ran: $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_21)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x64_all_gcc.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_21 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_atomicoperations_x64_all_gcc.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_21 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_21 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x64_win_msvc.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x64_win_msvc.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x64_win_msvc.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x64_win_msvc.t.ran: $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_22)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x64_win_msvc.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_22 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_atomicoperations_x64_win_msvc.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_22 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_22 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x86_all_gcc.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x86_all_gcc.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x86_all_gcc.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x86_all_gcc.t.ran: $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_23)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x86_all_gcc.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_23 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_atomicoperations_x86_all_gcc.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_23 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_23 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x86_win_msvc.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x86_win_msvc.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x86_win_msvc.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x86_win_msvc.t.ran: $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_24)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x86_win_msvc.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_24 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_atomicoperations_x86_win_msvc.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_24 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_24 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_blockgrowth.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_blockgrowth.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_blockgrowth.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_blockgrowth.t.ran: $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_25)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_blockgrowth.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_25 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_blockgrowth.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_25 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_25 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_bsltestutil.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_bsltestutil.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_bsltestutil.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_bsltestutil.t.ran: $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_26)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_bsltestutil.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_26 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_bsltestutil.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_26 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_26 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_buildtarget.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_buildtarget.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_buildtarget.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_buildtarget.t.ran: $(builddir)/bsls_buildtarget.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_27)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_buildtarget.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_27 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_buildtarget.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_27 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_27 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_byteorder.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_byteorder.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_byteorder.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_byteorder.t.ran: $(builddir)/bsls_byteorder.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_28)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_byteorder.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_28 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_byteorder.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_28 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_28 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_compilerfeatures.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_compilerfeatures.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_compilerfeatures.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_compilerfeatures.t.ran: $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_29)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_compilerfeatures.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_29 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_compilerfeatures.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_29 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_29 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_exceptionutil.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_exceptionutil.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_exceptionutil.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_exceptionutil.t.ran: $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_30)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_exceptionutil.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_30 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_exceptionutil.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_30 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_30 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_ident.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_ident.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_ident.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_ident.t.ran: $(builddir)/bsls_ident.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_31)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_ident.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_31 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_ident.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_31 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_31 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_macroincrement.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_macroincrement.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_macroincrement.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_macroincrement.t.ran: $(builddir)/bsls_macroincrement.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_32)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_macroincrement.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_32 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_macroincrement.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_32 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_32 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_nativestd.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_nativestd.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_nativestd.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_nativestd.t.ran: $(builddir)/bsls_nativestd.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_33)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_nativestd.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_33 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_nativestd.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_33 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_33 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_nullptr.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_nullptr.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_nullptr.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_nullptr.t.ran: $(builddir)/bsls_nullptr.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_34)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_nullptr.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_34 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_nullptr.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_34 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_34 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_objectbuffer.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_objectbuffer.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_objectbuffer.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_objectbuffer.t.ran: $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_35)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_objectbuffer.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_35 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_objectbuffer.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_35 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_35 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_performancehint.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_performancehint.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_performancehint.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_performancehint.t.ran: $(builddir)/bsls_performancehint.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_36)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_performancehint.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_36 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_performancehint.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_36 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_36 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_platform.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_platform.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_platform.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_platform.t.ran: $(builddir)/bsls_platform.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_37)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_platform.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_37 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_platform.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_37 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_37 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_protocoltest.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_protocoltest.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_protocoltest.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_protocoltest.t.ran: $(builddir)/bsls_protocoltest.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_38)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_protocoltest.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_38 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_protocoltest.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_38 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_38 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_stopwatch.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_stopwatch.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_stopwatch.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_stopwatch.t.ran: $(builddir)/bsls_stopwatch.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_39)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_stopwatch.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_39 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_stopwatch.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_39 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_39 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_timeutil.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_timeutil.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_timeutil.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_timeutil.t.ran: $(builddir)/bsls_timeutil.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_40)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_timeutil.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_40 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_timeutil.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_40 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_40 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_types.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_types.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_types.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_types.t.ran: $(builddir)/bsls_types.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_41)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_types.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_41 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_types.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_41 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_41 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_unspecifiedbool.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_unspecifiedbool.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_unspecifiedbool.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_unspecifiedbool.t.ran: $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_42)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_unspecifiedbool.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_42 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_unspecifiedbool.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_42 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_42 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_util.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_util.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_util.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_util.t.ran: $(builddir)/bsls_util.t $(builddir)/bsls_alignedbuffer.t $(builddir)/bsls_alignment.t $(builddir)/bsls_alignmentfromtype.t $(builddir)/bsls_alignmentimp.t $(builddir)/bsls_alignmenttotype.t $(builddir)/bsls_alignmentutil.t $(builddir)/bsls_annotation.t $(builddir)/bsls_assert.t $(builddir)/bsls_asserttest.t $(builddir)/bsls_asserttestexception.t $(builddir)/bsls_atomic.t $(builddir)/bsls_atomicoperations.t $(builddir)/bsls_atomicoperations_default.t $(builddir)/bsls_atomicoperations_ia64_hp_acc.t $(builddir)/bsls_atomicoperations_powerpc32_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc64_aix_xlc.t $(builddir)/bsls_atomicoperations_powerpc_aix_gcc.t $(builddir)/bsls_atomicoperations_powerpc_aix_xlc_default.t $(builddir)/bsls_atomicoperations_sparc32_sun_cc.t $(builddir)/bsls_atomicoperations_sparc64_sun_cc.t $(builddir)/bsls_atomicoperations_sparc_sun_cc_default.t $(builddir)/bsls_atomicoperations_x64_all_gcc.t $(builddir)/bsls_atomicoperations_x64_win_msvc.t $(builddir)/bsls_atomicoperations_x86_all_gcc.t $(builddir)/bsls_atomicoperations_x86_win_msvc.t $(builddir)/bsls_blockgrowth.t $(builddir)/bsls_bsltestutil.t $(builddir)/bsls_buildtarget.t $(builddir)/bsls_byteorder.t $(builddir)/bsls_compilerfeatures.t $(builddir)/bsls_exceptionutil.t $(builddir)/bsls_ident.t $(builddir)/bsls_macroincrement.t $(builddir)/bsls_nativestd.t $(builddir)/bsls_nullptr.t $(builddir)/bsls_objectbuffer.t $(builddir)/bsls_performancehint.t $(builddir)/bsls_platform.t $(builddir)/bsls_protocoltest.t $(builddir)/bsls_stopwatch.t $(builddir)/bsls_timeutil.t $(builddir)/bsls_types.t $(builddir)/bsls_unspecifiedbool.t $(builddir)/bsls_util.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_43)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsls_util.t.ran
+cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_43 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsls; mkdir -p $(obj).$(TOOLSET)/bsls_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsls_tests_run/geni/bsls_util.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_43 = RULE _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_43 $@
+
+rule__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_outputs := \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignedbuffer.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignment.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentfromtype.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentimp.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmenttotype.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_alignmentutil.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_annotation.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_assert.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_asserttest.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_asserttestexception.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomic.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_default.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_ia64_hp_acc.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc32_aix_xlc.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc64_aix_xlc.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc_aix_gcc.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_powerpc_aix_xlc_default.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc32_sun_cc.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc64_sun_cc.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_sparc_sun_cc_default.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x64_all_gcc.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x64_win_msvc.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x86_all_gcc.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_atomicoperations_x86_win_msvc.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_blockgrowth.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_bsltestutil.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_buildtarget.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_byteorder.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_compilerfeatures.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_exceptionutil.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_ident.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_macroincrement.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_nativestd.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_nullptr.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_objectbuffer.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_performancehint.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_platform.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_protocoltest.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_stopwatch.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_timeutil.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_types.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_unspecifiedbool.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsls_util.t.ran
+
+### Finished generating for rule: _root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests
+
+### Finished generating for all rules
+
+DEFS_Debug := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Debug := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Debug :=
+
+DEFS_Profile := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Profile := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option \
+	--coverage
+
+# Flags passed to only C files.
+CFLAGS_C_Profile := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Profile := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Profile :=
+
+DEFS_Release := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_OPT' \
+	'-DNDEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-O2 \
+	-fno-strict-aliasing \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fexceptions
+
+INCS_Release :=
+
+OBJS :=
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/groups/bsl/bsls/bsls_tests_build.stamp
+
+# Make sure our actions/rules run before any of us.
+$(OBJS): | $(rule__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_outputs)
+
+
+### Rules for final target.
+# Build our special outputs first.
+$(obj).target/groups/bsl/bsls/bsls_tests_run.stamp: | $(rule__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_outputs)
+
+# Preserve order dependency of special output on deps.
+$(rule__root_repo_groups_bsl_bsls_bsls_gyp_bsls_tests_run_target_run_unit_tests_outputs): | $(obj).target/groups/bsl/bsls/bsls_tests_build.stamp
+
+$(obj).target/groups/bsl/bsls/bsls_tests_run.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bsls/bsls_tests_run.stamp: $(obj).target/groups/bsl/bsls/bsls_tests_build.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bsls/bsls_tests_run.stamp
+# Add target alias
+.PHONY: bsls_tests_run
+bsls_tests_run: $(obj).target/groups/bsl/bsls/bsls_tests_run.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bsls_tests_run
+
@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslscm_tests_build
+### Rules for final target.
+$(obj).target/groups/bsl/bslscm/bslscm_tests_build.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslscm/bslscm_tests_build.stamp: $(builddir)/bslscm_version.t $(builddir)/bslscm_versiontag.t FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bslscm/bslscm_tests_build.stamp
+# Add target alias
+.PHONY: bslscm_tests_build
+bslscm_tests_build: $(obj).target/groups/bsl/bslscm/bslscm_tests_build.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslscm_tests_build
+
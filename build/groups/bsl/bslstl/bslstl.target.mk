@@ -0,0 +1,262 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslstl
+DEFS_Debug := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Debug := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Debug := \
+	-I$(srcdir)/groups/bsl/bslalg \
+	-I$(srcdir)/groups/bsl/bslma \
+	-I$(srcdir)/groups/bsl/bslmf \
+	-I$(srcdir)/groups/bsl/bsls \
+	-I$(srcdir)/groups/bsl/bslscm \
+	-I$(srcdir)/groups/bsl/bsltf \
+	-I$(srcdir)/groups/bsl/bslstl
+
+DEFS_Profile := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Profile := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option \
+	--coverage
+
+# Flags passed to only C files.
+CFLAGS_C_Profile := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Profile := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Profile := \
+	-I$(srcdir)/groups/bsl/bslalg \
+	-I$(srcdir)/groups/bsl/bslma \
+	-I$(srcdir)/groups/bsl/bslmf \
+	-I$(srcdir)/groups/bsl/bsls \
+	-I$(srcdir)/groups/bsl/bslscm \
+	-I$(srcdir)/groups/bsl/bsltf \
+	-I$(srcdir)/groups/bsl/bslstl
+
+DEFS_Release := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_OPT' \
+	'-DNDEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-O2 \
+	-fno-strict-aliasing \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fexceptions
+
+INCS_Release := \
+	-I$(srcdir)/groups/bsl/bslalg \
+	-I$(srcdir)/groups/bsl/bslma \
+	-I$(srcdir)/groups/bsl/bslmf \
+	-I$(srcdir)/groups/bsl/bsls \
+	-I$(srcdir)/groups/bsl/bslscm \
+	-I$(srcdir)/groups/bsl/bsltf \
+	-I$(srcdir)/groups/bsl/bslstl
+
+OBJS := \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_allocator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_allocatortraits.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_bidirectionaliterator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_bidirectionalnodepool.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_bitset.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_deque.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_equalto.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_forwarditerator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_hash.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_hashtable.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_hashtablebucketiterator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_hashtableiterator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_iosfwd.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_istringstream.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_iterator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_iteratorutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_list.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_map.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_mapcomparator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_multimap.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_multiset.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_ostringstream.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_pair.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_priorityqueue.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_queue.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_randomaccessiterator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_set.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_setcomparator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_simplepool.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_sstream.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_stack.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_stdexceptutil.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_string.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_stringbuf.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_stringref.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_stringrefdata.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_stringstream.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_treeiterator.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_treenode.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_treenodepool.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_unorderedmap.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_unorderedmapkeyconfiguration.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_unorderedmultimap.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_unorderedmultiset.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_unorderedset.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_unorderedsetkeyconfiguration.o \
+	$(obj).target/$(TARGET)/groups/bsl/bslstl/bslstl_vector.o
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/groups/bsl/bsl_grpdeps.stamp $(obj).target/groups/bsl/bslstl/bslstl_sources.stamp
+
+# CFLAGS et al overrides must be target-local.
+# See "Target-specific Variable Values" in the GNU Make manual.
+$(OBJS): TOOLSET := $(TOOLSET)
+$(OBJS): GYP_CFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_C_$(BUILDTYPE))
+$(OBJS): GYP_CXXFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_CC_$(BUILDTYPE))
+
+# Suffix rules, putting all outputs into $(obj).
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(srcdir)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# Try building from generated source, too.
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj).$(TOOLSET)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj)/%.cpp FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# End of this set of suffix rules
+### Rules for final target.
+LDFLAGS_Debug := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack
+
+LDFLAGS_Profile := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack \
+	--coverage
+
+LDFLAGS_Release := \
+	-m64 \
+	-pthread \
+	-Wl,-z,noexecstack
+
+LIBS :=
+
+$(obj).target/groups/bsl/bslstl/libbslstl.a: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
+$(obj).target/groups/bsl/bslstl/libbslstl.a: LIBS := $(LIBS)
+$(obj).target/groups/bsl/bslstl/libbslstl.a: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslstl/libbslstl.a: $(OBJS) FORCE_DO_CMD
+	$(call do_cmd,alink)
+
+all_deps += $(obj).target/groups/bsl/bslstl/libbslstl.a
+# Add target alias
+.PHONY: bslstl
+bslstl: $(obj).target/groups/bsl/bslstl/libbslstl.a
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslstl
+
@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslstl_sources
+### Rules for final target.
+$(obj).target/groups/bsl/bslstl/bslstl_sources.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslstl/bslstl_sources.stamp:  FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bslstl/bslstl_sources.stamp
+# Add target alias
+.PHONY: bslstl_sources
+bslstl_sources: $(obj).target/groups/bsl/bslstl/bslstl_sources.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslstl_sources
+
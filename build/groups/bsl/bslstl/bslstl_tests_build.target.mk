@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslstl_tests_build
+### Rules for final target.
+$(obj).target/groups/bsl/bslstl/bslstl_tests_build.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslstl/bslstl_tests_build.stamp: $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bslstl/bslstl_tests_build.stamp
+# Add target alias
+.PHONY: bslstl_tests_build
+bslstl_tests_build: $(obj).target/groups/bsl/bslstl/bslstl_tests_build.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslstl_tests_build
+
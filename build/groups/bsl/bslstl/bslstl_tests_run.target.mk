@@ -0,0 +1,688 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bslstl_tests_run
+### Generated for rule _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests:
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_allocator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_allocator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_allocator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_allocator.t.ran: $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_0)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_allocator.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_0 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_allocator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_0 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_0 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_allocatortraits.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_allocatortraits.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_allocatortraits.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_allocatortraits.t.ran: $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_1)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_allocatortraits.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_1 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_allocatortraits.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_1 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_1 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bidirectionaliterator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bidirectionaliterator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bidirectionaliterator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bidirectionaliterator.t.ran: $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_2)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bidirectionaliterator.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_2 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_bidirectionaliterator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_2 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_2 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bidirectionalnodepool.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bidirectionalnodepool.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bidirectionalnodepool.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bidirectionalnodepool.t.ran: $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_3)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bidirectionalnodepool.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_3 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_bidirectionalnodepool.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_3 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_3 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bitset.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bitset.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bitset.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bitset.t.ran: $(builddir)/bslstl_bitset.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_4)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bitset.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_4 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_bitset.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_4 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_4 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_deque.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_deque.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_deque.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_deque.t.ran: $(builddir)/bslstl_deque.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_5)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_deque.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_5 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_deque.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_5 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_5 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_equalto.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_equalto.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_equalto.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_equalto.t.ran: $(builddir)/bslstl_equalto.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_6)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_equalto.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_6 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_equalto.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_6 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_6 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_forwarditerator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_forwarditerator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_forwarditerator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_forwarditerator.t.ran: $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_7)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_forwarditerator.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_7 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_forwarditerator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_7 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_7 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hash.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hash.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hash.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hash.t.ran: $(builddir)/bslstl_hash.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_8)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hash.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_8 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_hash.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_8 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_8 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtable.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtable.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtable.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtable.t.ran: $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_9)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtable.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_9 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_hashtable.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_9 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_9 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtablebucketiterator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtablebucketiterator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtablebucketiterator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtablebucketiterator.t.ran: $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_10)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtablebucketiterator.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_10 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_hashtablebucketiterator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_10 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_10 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtableiterator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtableiterator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtableiterator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtableiterator.t.ran: $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_11)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtableiterator.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_11 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_hashtableiterator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_11 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_11 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iosfwd.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iosfwd.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iosfwd.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iosfwd.t.ran: $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_12)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iosfwd.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_12 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_iosfwd.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_12 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_12 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_istringstream.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_istringstream.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_istringstream.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_istringstream.t.ran: $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_13)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_istringstream.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_13 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_istringstream.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_13 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_13 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iterator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iterator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iterator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iterator.t.ran: $(builddir)/bslstl_iterator.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_14)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iterator.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_14 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_iterator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_14 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_14 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iteratorutil.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iteratorutil.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iteratorutil.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iteratorutil.t.ran: $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_15)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iteratorutil.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_15 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_iteratorutil.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_15 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_15 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_list.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_list.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_list.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_list.t.ran: $(builddir)/bslstl_list.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_16)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_list.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_16 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_list.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_16 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_16 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_map.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_map.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_map.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_map.t.ran: $(builddir)/bslstl_map.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_17)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_map.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_17 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_map.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_17 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_17 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_mapcomparator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_mapcomparator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_mapcomparator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_mapcomparator.t.ran: $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_18)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_mapcomparator.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_18 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_mapcomparator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_18 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_18 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_multimap.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_multimap.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_multimap.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_multimap.t.ran: $(builddir)/bslstl_multimap.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_19)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_multimap.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_19 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_multimap.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_19 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_19 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_multiset.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_multiset.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_multiset.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_multiset.t.ran: $(builddir)/bslstl_multiset.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_20)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_multiset.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_20 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_multiset.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_20 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_20 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_ostringstream.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_ostringstream.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_ostringstream.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_ostringstream.t.ran: $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_21)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_ostringstream.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_21 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_ostringstream.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_21 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_21 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_pair.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_pair.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_pair.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_pair.t.ran: $(builddir)/bslstl_pair.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_22)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_pair.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_22 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_pair.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_22 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_22 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_priorityqueue.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_priorityqueue.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_priorityqueue.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_priorityqueue.t.ran: $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_23)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_priorityqueue.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_23 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_priorityqueue.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_23 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_23 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_queue.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_queue.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_queue.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_queue.t.ran: $(builddir)/bslstl_queue.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_24)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_queue.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_24 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_queue.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_24 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_24 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_randomaccessiterator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_randomaccessiterator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_randomaccessiterator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_randomaccessiterator.t.ran: $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_25)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_randomaccessiterator.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_25 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_randomaccessiterator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_25 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_25 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_set.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_set.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_set.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_set.t.ran: $(builddir)/bslstl_set.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_26)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_set.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_26 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_set.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_26 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_26 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_setcomparator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_setcomparator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_setcomparator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_setcomparator.t.ran: $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_27)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_setcomparator.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_27 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_setcomparator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_27 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_27 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_simplepool.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_simplepool.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_simplepool.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_simplepool.t.ran: $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_28)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_simplepool.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_28 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_simplepool.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_28 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_28 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_sstream.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_sstream.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_sstream.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_sstream.t.ran: $(builddir)/bslstl_sstream.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_29)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_sstream.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_29 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_sstream.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_29 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_29 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stack.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stack.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stack.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stack.t.ran: $(builddir)/bslstl_stack.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_30)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stack.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_30 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_stack.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_30 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_30 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stdexceptutil.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stdexceptutil.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stdexceptutil.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stdexceptutil.t.ran: $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_31)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stdexceptutil.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_31 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_stdexceptutil.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_31 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_31 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_string.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_string.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_string.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_string.t.ran: $(builddir)/bslstl_string.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_32)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_string.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_32 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_string.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_32 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_32 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringbuf.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringbuf.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringbuf.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringbuf.t.ran: $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_33)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringbuf.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_33 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_stringbuf.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_33 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_33 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringref.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringref.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringref.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringref.t.ran: $(builddir)/bslstl_stringref.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_34)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringref.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_34 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_stringref.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_34 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_34 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringrefdata.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringrefdata.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringrefdata.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringrefdata.t.ran: $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_35)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringrefdata.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_35 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_stringrefdata.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_35 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_35 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringstream.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringstream.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringstream.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringstream.t.ran: $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_36)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringstream.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_36 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_stringstream.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_36 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_36 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treeiterator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treeiterator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treeiterator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treeiterator.t.ran: $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_37)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treeiterator.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_37 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_treeiterator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_37 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_37 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treenode.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treenode.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treenode.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treenode.t.ran: $(builddir)/bslstl_treenode.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_38)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treenode.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_38 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_treenode.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_38 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_38 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treenodepool.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treenodepool.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treenodepool.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treenodepool.t.ran: $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_39)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treenodepool.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_39 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_treenodepool.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_39 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_39 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmap.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmap.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmap.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmap.t.ran: $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_40)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmap.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_40 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_unorderedmap.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_40 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_40 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmapkeyconfiguration.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmapkeyconfiguration.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmapkeyconfiguration.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmapkeyconfiguration.t.ran: $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_41)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmapkeyconfiguration.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_41 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_unorderedmapkeyconfiguration.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_41 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_41 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmultimap.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmultimap.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmultimap.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmultimap.t.ran: $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_42)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmultimap.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_42 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_unorderedmultimap.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_42 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_42 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmultiset.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmultiset.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmultiset.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmultiset.t.ran: $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_43)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmultiset.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_43 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_unorderedmultiset.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_43 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_43 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedset.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedset.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedset.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedset.t.ran: $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_44)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedset.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_44 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_unorderedset.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_44 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_44 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedsetkeyconfiguration.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedsetkeyconfiguration.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedsetkeyconfiguration.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedsetkeyconfiguration.t.ran: $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_45)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedsetkeyconfiguration.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_45 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_unorderedsetkeyconfiguration.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_45 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_45 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_vector.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_vector.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_vector.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_vector.t.ran: $(builddir)/bslstl_vector.t $(builddir)/bslstl_allocator.t $(builddir)/bslstl_allocatortraits.t $(builddir)/bslstl_bidirectionaliterator.t $(builddir)/bslstl_bidirectionalnodepool.t $(builddir)/bslstl_bitset.t $(builddir)/bslstl_deque.t $(builddir)/bslstl_equalto.t $(builddir)/bslstl_forwarditerator.t $(builddir)/bslstl_hash.t $(builddir)/bslstl_hashtable.t $(builddir)/bslstl_hashtablebucketiterator.t $(builddir)/bslstl_hashtableiterator.t $(builddir)/bslstl_iosfwd.t $(builddir)/bslstl_istringstream.t $(builddir)/bslstl_iterator.t $(builddir)/bslstl_iteratorutil.t $(builddir)/bslstl_list.t $(builddir)/bslstl_map.t $(builddir)/bslstl_mapcomparator.t $(builddir)/bslstl_multimap.t $(builddir)/bslstl_multiset.t $(builddir)/bslstl_ostringstream.t $(builddir)/bslstl_pair.t $(builddir)/bslstl_priorityqueue.t $(builddir)/bslstl_queue.t $(builddir)/bslstl_randomaccessiterator.t $(builddir)/bslstl_set.t $(builddir)/bslstl_setcomparator.t $(builddir)/bslstl_simplepool.t $(builddir)/bslstl_sstream.t $(builddir)/bslstl_stack.t $(builddir)/bslstl_stdexceptutil.t $(builddir)/bslstl_string.t $(builddir)/bslstl_stringbuf.t $(builddir)/bslstl_stringref.t $(builddir)/bslstl_stringrefdata.t $(builddir)/bslstl_stringstream.t $(builddir)/bslstl_treeiterator.t $(builddir)/bslstl_treenode.t $(builddir)/bslstl_treenodepool.t $(builddir)/bslstl_unorderedmap.t $(builddir)/bslstl_unorderedmapkeyconfiguration.t $(builddir)/bslstl_unorderedmultimap.t $(builddir)/bslstl_unorderedmultiset.t $(builddir)/bslstl_unorderedset.t $(builddir)/bslstl_unorderedsetkeyconfiguration.t $(builddir)/bslstl_vector.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_46)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_vector.t.ran
+cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_46 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bslstl; mkdir -p $(obj).$(TOOLSET)/bslstl_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bslstl_tests_run/geni/bslstl_vector.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_46 = RULE _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_46 $@
+
+rule__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_outputs := \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_allocator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_allocatortraits.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bidirectionaliterator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bidirectionalnodepool.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_bitset.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_deque.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_equalto.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_forwarditerator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hash.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtable.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtablebucketiterator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_hashtableiterator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iosfwd.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_istringstream.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iterator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_iteratorutil.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_list.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_map.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_mapcomparator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_multimap.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_multiset.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_ostringstream.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_pair.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_priorityqueue.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_queue.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_randomaccessiterator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_set.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_setcomparator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_simplepool.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_sstream.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stack.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stdexceptutil.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_string.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringbuf.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringref.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringrefdata.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_stringstream.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treeiterator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treenode.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_treenodepool.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmap.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmapkeyconfiguration.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmultimap.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedmultiset.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedset.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_unorderedsetkeyconfiguration.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bslstl_vector.t.ran
+
+### Finished generating for rule: _root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests
+
+### Finished generating for all rules
+
+DEFS_Debug := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Debug := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Debug :=
+
+DEFS_Profile := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Profile := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option \
+	--coverage
+
+# Flags passed to only C files.
+CFLAGS_C_Profile := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Profile := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Profile :=
+
+DEFS_Release := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_OPT' \
+	'-DNDEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-O2 \
+	-fno-strict-aliasing \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fexceptions
+
+INCS_Release :=
+
+OBJS :=
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/groups/bsl/bslstl/bslstl_tests_build.stamp
+
+# Make sure our actions/rules run before any of us.
+$(OBJS): | $(rule__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_outputs)
+
+
+### Rules for final target.
+# Build our special outputs first.
+$(obj).target/groups/bsl/bslstl/bslstl_tests_run.stamp: | $(rule__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_outputs)
+
+# Preserve order dependency of special output on deps.
+$(rule__root_repo_groups_bsl_bslstl_bslstl_gyp_bslstl_tests_run_target_run_unit_tests_outputs): | $(obj).target/groups/bsl/bslstl/bslstl_tests_build.stamp
+
+$(obj).target/groups/bsl/bslstl/bslstl_tests_run.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bslstl/bslstl_tests_run.stamp: $(obj).target/groups/bsl/bslstl/bslstl_tests_build.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bslstl/bslstl_tests_run.stamp
+# Add target alias
+.PHONY: bslstl_tests_run
+bslstl_tests_run: $(obj).target/groups/bsl/bslstl/bslstl_tests_run.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bslstl_tests_run
+
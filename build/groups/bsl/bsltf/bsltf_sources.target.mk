@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bsltf_sources
+### Rules for final target.
+$(obj).target/groups/bsl/bsltf/bsltf_sources.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bsltf/bsltf_sources.stamp:  FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bsltf/bsltf_sources.stamp
+# Add target alias
+.PHONY: bsltf_sources
+bsltf_sources: $(obj).target/groups/bsl/bsltf/bsltf_sources.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bsltf_sources
+
@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bsltf_tests_build
+### Rules for final target.
+$(obj).target/groups/bsl/bsltf/bsltf_tests_build.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bsltf/bsltf_tests_build.stamp: $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bsltf/bsltf_tests_build.stamp
+# Add target alias
+.PHONY: bsltf_tests_build
+bsltf_tests_build: $(obj).target/groups/bsl/bsltf/bsltf_tests_build.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bsltf_tests_build
+
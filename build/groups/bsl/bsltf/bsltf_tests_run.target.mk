@@ -0,0 +1,369 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := bsltf_tests_run
+### Generated for rule _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests:
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_allocbitwisemoveabletesttype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_allocbitwisemoveabletesttype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_allocbitwisemoveabletesttype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_allocbitwisemoveabletesttype.t.ran: $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_0)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_allocbitwisemoveabletesttype.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_0 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_allocbitwisemoveabletesttype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_0 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_0 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_alloctesttype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_alloctesttype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_alloctesttype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_alloctesttype.t.ran: $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_1)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_alloctesttype.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_1 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_alloctesttype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_1 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_1 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_bitwisemoveabletesttype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_bitwisemoveabletesttype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_bitwisemoveabletesttype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_bitwisemoveabletesttype.t.ran: $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_2)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_bitwisemoveabletesttype.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_2 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_bitwisemoveabletesttype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_2 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_2 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_convertiblevaluewrapper.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_convertiblevaluewrapper.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_convertiblevaluewrapper.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_convertiblevaluewrapper.t.ran: $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_3)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_convertiblevaluewrapper.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_3 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_convertiblevaluewrapper.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_3 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_3 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_degeneratefunctor.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_degeneratefunctor.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_degeneratefunctor.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_degeneratefunctor.t.ran: $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_4)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_degeneratefunctor.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_4 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_degeneratefunctor.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_4 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_4 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_enumeratedtesttype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_enumeratedtesttype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_enumeratedtesttype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_enumeratedtesttype.t.ran: $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_5)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_enumeratedtesttype.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_5 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_enumeratedtesttype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_5 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_5 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_evilbooleantype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_evilbooleantype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_evilbooleantype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_evilbooleantype.t.ran: $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_6)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_evilbooleantype.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_6 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_evilbooleantype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_6 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_6 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nonassignabletesttype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nonassignabletesttype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nonassignabletesttype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nonassignabletesttype.t.ran: $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_7)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nonassignabletesttype.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_7 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_nonassignabletesttype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_7 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_7 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_noncopyconstructibletesttype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_noncopyconstructibletesttype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_noncopyconstructibletesttype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_noncopyconstructibletesttype.t.ran: $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_8)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_noncopyconstructibletesttype.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_8 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_noncopyconstructibletesttype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_8 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_8 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nondefaultconstructibletesttype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nondefaultconstructibletesttype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nondefaultconstructibletesttype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nondefaultconstructibletesttype.t.ran: $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_9)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nondefaultconstructibletesttype.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_9 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_nondefaultconstructibletesttype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_9 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_9 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nonequalcomparabletesttype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nonequalcomparabletesttype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nonequalcomparabletesttype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nonequalcomparabletesttype.t.ran: $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_10)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nonequalcomparabletesttype.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_10 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_nonequalcomparabletesttype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_10 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_10 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nontypicaloverloadstesttype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nontypicaloverloadstesttype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nontypicaloverloadstesttype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nontypicaloverloadstesttype.t.ran: $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_11)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nontypicaloverloadstesttype.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_11 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_nontypicaloverloadstesttype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_11 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_11 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_simpletesttype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_simpletesttype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_simpletesttype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_simpletesttype.t.ran: $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_12)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_simpletesttype.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_12 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_simpletesttype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_12 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_12 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_stdstatefulallocator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_stdstatefulallocator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_stdstatefulallocator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_stdstatefulallocator.t.ran: $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_13)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_stdstatefulallocator.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_13 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_stdstatefulallocator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_13 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_13 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_stdtestallocator.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_stdtestallocator.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_stdtestallocator.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_stdtestallocator.t.ran: $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_14)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_stdtestallocator.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_14 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_stdtestallocator.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_14 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_14 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_templatetestfacility.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_templatetestfacility.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_templatetestfacility.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_templatetestfacility.t.ran: $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_15)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_templatetestfacility.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_15 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_templatetestfacility.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_15 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_15 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_testvaluesarray.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_testvaluesarray.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_testvaluesarray.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_testvaluesarray.t.ran: $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_16)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_testvaluesarray.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_16 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_testvaluesarray.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_16 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_16 $@
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_uniontesttype.t.ran: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_uniontesttype.t.ran: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_uniontesttype.t.ran: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_uniontesttype.t.ran: $(builddir)/bsltf_uniontesttype.t $(builddir)/bsltf_allocbitwisemoveabletesttype.t $(builddir)/bsltf_alloctesttype.t $(builddir)/bsltf_bitwisemoveabletesttype.t $(builddir)/bsltf_convertiblevaluewrapper.t $(builddir)/bsltf_degeneratefunctor.t $(builddir)/bsltf_enumeratedtesttype.t $(builddir)/bsltf_evilbooleantype.t $(builddir)/bsltf_nonassignabletesttype.t $(builddir)/bsltf_noncopyconstructibletesttype.t $(builddir)/bsltf_nondefaultconstructibletesttype.t $(builddir)/bsltf_nonequalcomparabletesttype.t $(builddir)/bsltf_nontypicaloverloadstesttype.t $(builddir)/bsltf_simpletesttype.t $(builddir)/bsltf_stdstatefulallocator.t $(builddir)/bsltf_stdtestallocator.t $(builddir)/bsltf_templatetestfacility.t $(builddir)/bsltf_testvaluesarray.t $(builddir)/bsltf_uniontesttype.t FORCE_DO_CMD
+	$(call do_cmd,_root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_17)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_uniontesttype.t.ran
+cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_17 = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/groups/bsl/bsltf; mkdir -p $(obj).$(TOOLSET)/bsltf_tests_run/geni; /root/.pyenv/versions/2.7.18/bin/python ../../../tools/run_unit_tests.py "$(abspath $<)" "$(obj).$(TOOLSET)/bsltf_tests_run/geni/bsltf_uniontesttype.t.ran" "--abi=64" "--lib=static_library"
+quiet_cmd__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_17 = RULE _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_17 $@
+
+rule__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_outputs := \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_allocbitwisemoveabletesttype.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_alloctesttype.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_bitwisemoveabletesttype.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_convertiblevaluewrapper.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_degeneratefunctor.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_enumeratedtesttype.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_evilbooleantype.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nonassignabletesttype.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_noncopyconstructibletesttype.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nondefaultconstructibletesttype.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nonequalcomparabletesttype.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_nontypicaloverloadstesttype.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_simpletesttype.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_stdstatefulallocator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_stdtestallocator.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_templatetestfacility.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_testvaluesarray.t.ran \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/bsltf_uniontesttype.t.ran
+
+### Finished generating for rule: _root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests
+
+### Finished generating for all rules
+
+DEFS_Debug := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Debug := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Debug :=
+
+DEFS_Profile := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_DBG'
+
+# Flags passed to all source files.
+CFLAGS_Profile := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option \
+	--coverage
+
+# Flags passed to only C files.
+CFLAGS_C_Profile := \
+	-g -fno-inline
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Profile := \
+	-fexceptions \
+	-g -fno-inline
+
+INCS_Profile :=
+
+DEFS_Release := \
+	'-D_REENTRANT' \
+	'-D_THREAD_SAFE' \
+	'-DBDE_BUILD_TARGET_EXC' \
+	'-DBDE_BUILD_TARGET_MT' \
+	'-DBDE_BUILD_TARGET_OPT' \
+	'-DNDEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-m64 \
+	-pipe \
+	-pthread \
+	-O2 \
+	-fno-strict-aliasing \
+	-Wall \
+	-Wextra \
+	-Wcast-align \
+	-Wcast-qual \
+	-Wformat-security \
+	-Wformat-y2k \
+	-Winit-self \
+	-Wno-long-long \
+	-Wno-unknown-pragmas \
+	-Wpacked \
+	-Wpointer-arith \
+	-Wwrite-strings \
+	-Wno-unused-value \
+	-Wno-char-subscripts \
+	-Wsign-compare \
+	-Wparentheses \
+	-Wvolatile-register-var \
+	-fdiagnostics-show-option
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fexceptions
+
+INCS_Release :=
+
+OBJS :=
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/groups/bsl/bsltf/bsltf_tests_build.stamp
+
+# Make sure our actions/rules run before any of us.
+$(OBJS): | $(rule__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_outputs)
+
+
+### Rules for final target.
+# Build our special outputs first.
+$(obj).target/groups/bsl/bsltf/bsltf_tests_run.stamp: | $(rule__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_outputs)
+
+# Preserve order dependency of special output on deps.
+$(rule__root_repo_groups_bsl_bsltf_bsltf_gyp_bsltf_tests_run_target_run_unit_tests_outputs): | $(obj).target/groups/bsl/bsltf/bsltf_tests_build.stamp
+
+$(obj).target/groups/bsl/bsltf/bsltf_tests_run.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/bsl/bsltf/bsltf_tests_run.stamp: $(obj).target/groups/bsl/bsltf/bsltf_tests_build.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/bsl/bsltf/bsltf_tests_run.stamp
+# Add target alias
+.PHONY: bsltf_tests_run
+bsltf_tests_run: $(obj).target/groups/bsl/bsltf/bsltf_tests_run.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: bsltf_tests_run
+
@@ -0,0 +1,14 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := groups_all
+### Rules for final target.
+$(obj).target/groups/groups_all.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/groups_all.stamp: $(obj).target/groups/groups_all_libs.stamp $(obj).target/groups/groups_all_tests_build.stamp $(obj).target/groups/groups_all_tests_run.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/groups_all.stamp
+# Add target alias
+.PHONY: groups_all
+groups_all: $(obj).target/groups/groups_all.stamp
+
@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := groups_all_libs
+### Rules for final target.
+$(obj).target/groups/groups_all_libs.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/groups_all_libs.stamp: /root/repo/build/$(BUILDTYPE)/lib/libbsl.a FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/groups_all_libs.stamp
+# Add target alias
+.PHONY: groups_all_libs
+groups_all_libs: $(obj).target/groups/groups_all_libs.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: groups_all_libs
+
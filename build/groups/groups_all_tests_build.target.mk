@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := groups_all_tests_build
+### Rules for final target.
+$(obj).target/groups/groups_all_tests_build.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/groups/groups_all_tests_build.stamp: $(obj).target/groups/bsl/bsl_tests_build.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/groups/groups_all_tests_build.stamp
+# Add target alias
+.PHONY: groups_all_tests_build
+groups_all_tests_build: $(obj).target/groups/groups_all_tests_build.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: groups_all_tests_build
+
@@ -0,0 +1,76 @@
+// bsl_cstring.h                                                      -*-C++-*-
+#ifndef INCLUDED_BSL_CSTRING
+#define INCLUDED_BSL_CSTRING
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide functionality of the corresponding C++ Standard header.
+//
+//@SEE_ALSO: package bsl+stdhdrs
+//
+//@DESCRIPTION: Provide types, in the 'bsl' namespace, equivalent to those
+// defined in the corresponding C++ standard header.  Include the native
+// compiler-provided standard header, and also directly include Bloomberg's
+// implementation of the C++ standard type (if one exists).  Finally, place the
+// included symbols from the 'std' namespace (if any) into the 'bsl' namespace.
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#include <cstring>
+
+namespace bsl
+{
+    // Import selected symbols into bsl namespace
+    using native_std::size_t;
+    using native_std::memmove;
+    using native_std::memcpy;
+    using native_std::memchr;
+    using native_std::strchr;
+    using native_std::strpbrk;
+    using native_std::strrchr;
+    using native_std::strstr;
+    using native_std::memcmp;
+    using native_std::memset;
+    using native_std::strcat;
+    using native_std::strcmp;
+    using native_std::strcoll;
+    using native_std::strcpy;
+    using native_std::strcspn;
+    using native_std::strerror;
+    using native_std::strlen;
+    using native_std::strncat;
+    using native_std::strncmp;
+    using native_std::strncpy;
+    using native_std::strspn;
+    using native_std::strtok;
+    using native_std::strxfrm;
+}
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
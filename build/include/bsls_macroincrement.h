@@ -0,0 +1,20094 @@
+// bsls_macroincrement.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLS_MACROINCREMENT
+#define INCLUDED_BSLS_MACROINCREMENT
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a macro to increment preprocessor numbers.
+//
+//@CLASSES:
+//
+//@MACROS:
+//  BSLS_MACROINCREMENT(NUMBER): expand to evaluated 'NUMBER + 1'
+//
+//@DESCRIPTION: This component provides a macro, 'BSLS_MACROINCREMENT(NUMBER)',
+// that produces the preprocessor number equal to the number succeeding the
+// supplied argument.  This is necessary as the preprocessor performs
+// arithmetic only inside the context of a '#if' directive.  Common use cases
+// for this macro would be '#line' directives or any attempt to provide a
+// computed value when token-pasting to produce an identifier.
+//
+///Macro Summary
+///-------------
+// This section provides a brief description of the macro defined in this
+// component.
+//..
+//  BSLS_MACROINCREMENT(MACRO_VALUE)
+//      Return the preprocessor number that is the successor to 'MACRO_VALUE'.
+//      The behavior is undefined unless 'MACRO_VALUE' is an integer literal,
+//      or a macro that ultimately expands to an integer literal.
+//..
+//
+///Usage
+///-----
+// Here we illustrate the typical use case, which demonstrates using the
+// 'BSLS_MACROINCREMENT' macro to change the effective name of a file without
+// changing the effective line count.
+//
+// First, we print out current file name and line number:
+//..
+//  cout << "__LINE__, __FILE__: " << __LINE__ << ", " __FILE__ << "\n";
+//..
+// Now, we provide a new effective file name to compiler by supplying the new
+// file name to '#line' directive:
+//..
+//#line BSLS_MACROINCREMENT(__LINE__) "some_other_filename.cpp"
+//..
+// Notice that the first argument following '#line' directive is the designated
+// line number of the next line, so we increment current '__LINE__' by calling
+// 'BSLS_MACROINCREMENT' to keep consistent line numbers.
+//
+// Finally, print out current file name and line number again.  Observe that
+// the file name is changed to the one we set in previous '#line' directive
+// while the line number still works as expected:
+//..
+//  cout << "__LINE__, __FILE__: " << __LINE__ << ", " __FILE__ << "\n";
+//..
+
+#define BSLS_MACROINCREMENT(MACRO_VALUE) \
+    BSLS_MACROINCREMENT_IMPL(MACRO_VALUE)
+
+// The 'BSLS_MACROINCREMENT_IMPL' macro is an implementation detail that forces
+// the token-pasting to occur in a separate round of macro expansion, so that
+// the computed macro will, in turn, expand to the desired literal.
+
+#define BSLS_MACROINCREMENT_IMPL(MACRO_VALUE) \
+    BSLS_MACROINCREMENTED_VALUE##MACRO_VALUE
+
+#define BSLS_MACROINCREMENTED_VALUE0 1
+#define BSLS_MACROINCREMENTED_VALUE1 2
+#define BSLS_MACROINCREMENTED_VALUE2 3
+#define BSLS_MACROINCREMENTED_VALUE3 4
+#define BSLS_MACROINCREMENTED_VALUE4 5
+#define BSLS_MACROINCREMENTED_VALUE5 6
+#define BSLS_MACROINCREMENTED_VALUE6 7
+#define BSLS_MACROINCREMENTED_VALUE7 8
+#define BSLS_MACROINCREMENTED_VALUE8 9
+#define BSLS_MACROINCREMENTED_VALUE9 10
+#define BSLS_MACROINCREMENTED_VALUE10 11
+#define BSLS_MACROINCREMENTED_VALUE11 12
+#define BSLS_MACROINCREMENTED_VALUE12 13
+#define BSLS_MACROINCREMENTED_VALUE13 14
+#define BSLS_MACROINCREMENTED_VALUE14 15
+#define BSLS_MACROINCREMENTED_VALUE15 16
+#define BSLS_MACROINCREMENTED_VALUE16 17
+#define BSLS_MACROINCREMENTED_VALUE17 18
+#define BSLS_MACROINCREMENTED_VALUE18 19
+#define BSLS_MACROINCREMENTED_VALUE19 20
+#define BSLS_MACROINCREMENTED_VALUE20 21
+#define BSLS_MACROINCREMENTED_VALUE21 22
+#define BSLS_MACROINCREMENTED_VALUE22 23
+#define BSLS_MACROINCREMENTED_VALUE23 24
+#define BSLS_MACROINCREMENTED_VALUE24 25
+#define BSLS_MACROINCREMENTED_VALUE25 26
+#define BSLS_MACROINCREMENTED_VALUE26 27
+#define BSLS_MACROINCREMENTED_VALUE27 28
+#define BSLS_MACROINCREMENTED_VALUE28 29
+#define BSLS_MACROINCREMENTED_VALUE29 30
+#define BSLS_MACROINCREMENTED_VALUE30 31
+#define BSLS_MACROINCREMENTED_VALUE31 32
+#define BSLS_MACROINCREMENTED_VALUE32 33
+#define BSLS_MACROINCREMENTED_VALUE33 34
+#define BSLS_MACROINCREMENTED_VALUE34 35
+#define BSLS_MACROINCREMENTED_VALUE35 36
+#define BSLS_MACROINCREMENTED_VALUE36 37
+#define BSLS_MACROINCREMENTED_VALUE37 38
+#define BSLS_MACROINCREMENTED_VALUE38 39
+#define BSLS_MACROINCREMENTED_VALUE39 40
+#define BSLS_MACROINCREMENTED_VALUE40 41
+#define BSLS_MACROINCREMENTED_VALUE41 42
+#define BSLS_MACROINCREMENTED_VALUE42 43
+#define BSLS_MACROINCREMENTED_VALUE43 44
+#define BSLS_MACROINCREMENTED_VALUE44 45
+#define BSLS_MACROINCREMENTED_VALUE45 46
+#define BSLS_MACROINCREMENTED_VALUE46 47
+#define BSLS_MACROINCREMENTED_VALUE47 48
+#define BSLS_MACROINCREMENTED_VALUE48 49
+#define BSLS_MACROINCREMENTED_VALUE49 50
+#define BSLS_MACROINCREMENTED_VALUE50 51
+#define BSLS_MACROINCREMENTED_VALUE51 52
+#define BSLS_MACROINCREMENTED_VALUE52 53
+#define BSLS_MACROINCREMENTED_VALUE53 54
+#define BSLS_MACROINCREMENTED_VALUE54 55
+#define BSLS_MACROINCREMENTED_VALUE55 56
+#define BSLS_MACROINCREMENTED_VALUE56 57
+#define BSLS_MACROINCREMENTED_VALUE57 58
+#define BSLS_MACROINCREMENTED_VALUE58 59
+#define BSLS_MACROINCREMENTED_VALUE59 60
+#define BSLS_MACROINCREMENTED_VALUE60 61
+#define BSLS_MACROINCREMENTED_VALUE61 62
+#define BSLS_MACROINCREMENTED_VALUE62 63
+#define BSLS_MACROINCREMENTED_VALUE63 64
+#define BSLS_MACROINCREMENTED_VALUE64 65
+#define BSLS_MACROINCREMENTED_VALUE65 66
+#define BSLS_MACROINCREMENTED_VALUE66 67
+#define BSLS_MACROINCREMENTED_VALUE67 68
+#define BSLS_MACROINCREMENTED_VALUE68 69
+#define BSLS_MACROINCREMENTED_VALUE69 70
+#define BSLS_MACROINCREMENTED_VALUE70 71
+#define BSLS_MACROINCREMENTED_VALUE71 72
+#define BSLS_MACROINCREMENTED_VALUE72 73
+#define BSLS_MACROINCREMENTED_VALUE73 74
+#define BSLS_MACROINCREMENTED_VALUE74 75
+#define BSLS_MACROINCREMENTED_VALUE75 76
+#define BSLS_MACROINCREMENTED_VALUE76 77
+#define BSLS_MACROINCREMENTED_VALUE77 78
+#define BSLS_MACROINCREMENTED_VALUE78 79
+#define BSLS_MACROINCREMENTED_VALUE79 80
+#define BSLS_MACROINCREMENTED_VALUE80 81
+#define BSLS_MACROINCREMENTED_VALUE81 82
+#define BSLS_MACROINCREMENTED_VALUE82 83
+#define BSLS_MACROINCREMENTED_VALUE83 84
+#define BSLS_MACROINCREMENTED_VALUE84 85
+#define BSLS_MACROINCREMENTED_VALUE85 86
+#define BSLS_MACROINCREMENTED_VALUE86 87
+#define BSLS_MACROINCREMENTED_VALUE87 88
+#define BSLS_MACROINCREMENTED_VALUE88 89
+#define BSLS_MACROINCREMENTED_VALUE89 90
+#define BSLS_MACROINCREMENTED_VALUE90 91
+#define BSLS_MACROINCREMENTED_VALUE91 92
+#define BSLS_MACROINCREMENTED_VALUE92 93
+#define BSLS_MACROINCREMENTED_VALUE93 94
+#define BSLS_MACROINCREMENTED_VALUE94 95
+#define BSLS_MACROINCREMENTED_VALUE95 96
+#define BSLS_MACROINCREMENTED_VALUE96 97
+#define BSLS_MACROINCREMENTED_VALUE97 98
+#define BSLS_MACROINCREMENTED_VALUE98 99
+#define BSLS_MACROINCREMENTED_VALUE99 100
+#define BSLS_MACROINCREMENTED_VALUE100 101
+#define BSLS_MACROINCREMENTED_VALUE101 102
+#define BSLS_MACROINCREMENTED_VALUE102 103
+#define BSLS_MACROINCREMENTED_VALUE103 104
+#define BSLS_MACROINCREMENTED_VALUE104 105
+#define BSLS_MACROINCREMENTED_VALUE105 106
+#define BSLS_MACROINCREMENTED_VALUE106 107
+#define BSLS_MACROINCREMENTED_VALUE107 108
+#define BSLS_MACROINCREMENTED_VALUE108 109
+#define BSLS_MACROINCREMENTED_VALUE109 110
+#define BSLS_MACROINCREMENTED_VALUE110 111
+#define BSLS_MACROINCREMENTED_VALUE111 112
+#define BSLS_MACROINCREMENTED_VALUE112 113
+#define BSLS_MACROINCREMENTED_VALUE113 114
+#define BSLS_MACROINCREMENTED_VALUE114 115
+#define BSLS_MACROINCREMENTED_VALUE115 116
+#define BSLS_MACROINCREMENTED_VALUE116 117
+#define BSLS_MACROINCREMENTED_VALUE117 118
+#define BSLS_MACROINCREMENTED_VALUE118 119
+#define BSLS_MACROINCREMENTED_VALUE119 120
+#define BSLS_MACROINCREMENTED_VALUE120 121
+#define BSLS_MACROINCREMENTED_VALUE121 122
+#define BSLS_MACROINCREMENTED_VALUE122 123
+#define BSLS_MACROINCREMENTED_VALUE123 124
+#define BSLS_MACROINCREMENTED_VALUE124 125
+#define BSLS_MACROINCREMENTED_VALUE125 126
+#define BSLS_MACROINCREMENTED_VALUE126 127
+#define BSLS_MACROINCREMENTED_VALUE127 128
+#define BSLS_MACROINCREMENTED_VALUE128 129
+#define BSLS_MACROINCREMENTED_VALUE129 130
+#define BSLS_MACROINCREMENTED_VALUE130 131
+#define BSLS_MACROINCREMENTED_VALUE131 132
+#define BSLS_MACROINCREMENTED_VALUE132 133
+#define BSLS_MACROINCREMENTED_VALUE133 134
+#define BSLS_MACROINCREMENTED_VALUE134 135
+#define BSLS_MACROINCREMENTED_VALUE135 136
+#define BSLS_MACROINCREMENTED_VALUE136 137
+#define BSLS_MACROINCREMENTED_VALUE137 138
+#define BSLS_MACROINCREMENTED_VALUE138 139
+#define BSLS_MACROINCREMENTED_VALUE139 140
+#define BSLS_MACROINCREMENTED_VALUE140 141
+#define BSLS_MACROINCREMENTED_VALUE141 142
+#define BSLS_MACROINCREMENTED_VALUE142 143
+#define BSLS_MACROINCREMENTED_VALUE143 144
+#define BSLS_MACROINCREMENTED_VALUE144 145
+#define BSLS_MACROINCREMENTED_VALUE145 146
+#define BSLS_MACROINCREMENTED_VALUE146 147
+#define BSLS_MACROINCREMENTED_VALUE147 148
+#define BSLS_MACROINCREMENTED_VALUE148 149
+#define BSLS_MACROINCREMENTED_VALUE149 150
+#define BSLS_MACROINCREMENTED_VALUE150 151
+#define BSLS_MACROINCREMENTED_VALUE151 152
+#define BSLS_MACROINCREMENTED_VALUE152 153
+#define BSLS_MACROINCREMENTED_VALUE153 154
+#define BSLS_MACROINCREMENTED_VALUE154 155
+#define BSLS_MACROINCREMENTED_VALUE155 156
+#define BSLS_MACROINCREMENTED_VALUE156 157
+#define BSLS_MACROINCREMENTED_VALUE157 158
+#define BSLS_MACROINCREMENTED_VALUE158 159
+#define BSLS_MACROINCREMENTED_VALUE159 160
+#define BSLS_MACROINCREMENTED_VALUE160 161
+#define BSLS_MACROINCREMENTED_VALUE161 162
+#define BSLS_MACROINCREMENTED_VALUE162 163
+#define BSLS_MACROINCREMENTED_VALUE163 164
+#define BSLS_MACROINCREMENTED_VALUE164 165
+#define BSLS_MACROINCREMENTED_VALUE165 166
+#define BSLS_MACROINCREMENTED_VALUE166 167
+#define BSLS_MACROINCREMENTED_VALUE167 168
+#define BSLS_MACROINCREMENTED_VALUE168 169
+#define BSLS_MACROINCREMENTED_VALUE169 170
+#define BSLS_MACROINCREMENTED_VALUE170 171
+#define BSLS_MACROINCREMENTED_VALUE171 172
+#define BSLS_MACROINCREMENTED_VALUE172 173
+#define BSLS_MACROINCREMENTED_VALUE173 174
+#define BSLS_MACROINCREMENTED_VALUE174 175
+#define BSLS_MACROINCREMENTED_VALUE175 176
+#define BSLS_MACROINCREMENTED_VALUE176 177
+#define BSLS_MACROINCREMENTED_VALUE177 178
+#define BSLS_MACROINCREMENTED_VALUE178 179
+#define BSLS_MACROINCREMENTED_VALUE179 180
+#define BSLS_MACROINCREMENTED_VALUE180 181
+#define BSLS_MACROINCREMENTED_VALUE181 182
+#define BSLS_MACROINCREMENTED_VALUE182 183
+#define BSLS_MACROINCREMENTED_VALUE183 184
+#define BSLS_MACROINCREMENTED_VALUE184 185
+#define BSLS_MACROINCREMENTED_VALUE185 186
+#define BSLS_MACROINCREMENTED_VALUE186 187
+#define BSLS_MACROINCREMENTED_VALUE187 188
+#define BSLS_MACROINCREMENTED_VALUE188 189
+#define BSLS_MACROINCREMENTED_VALUE189 190
+#define BSLS_MACROINCREMENTED_VALUE190 191
+#define BSLS_MACROINCREMENTED_VALUE191 192
+#define BSLS_MACROINCREMENTED_VALUE192 193
+#define BSLS_MACROINCREMENTED_VALUE193 194
+#define BSLS_MACROINCREMENTED_VALUE194 195
+#define BSLS_MACROINCREMENTED_VALUE195 196
+#define BSLS_MACROINCREMENTED_VALUE196 197
+#define BSLS_MACROINCREMENTED_VALUE197 198
+#define BSLS_MACROINCREMENTED_VALUE198 199
+#define BSLS_MACROINCREMENTED_VALUE199 200
+#define BSLS_MACROINCREMENTED_VALUE200 201
+#define BSLS_MACROINCREMENTED_VALUE201 202
+#define BSLS_MACROINCREMENTED_VALUE202 203
+#define BSLS_MACROINCREMENTED_VALUE203 204
+#define BSLS_MACROINCREMENTED_VALUE204 205
+#define BSLS_MACROINCREMENTED_VALUE205 206
+#define BSLS_MACROINCREMENTED_VALUE206 207
+#define BSLS_MACROINCREMENTED_VALUE207 208
+#define BSLS_MACROINCREMENTED_VALUE208 209
+#define BSLS_MACROINCREMENTED_VALUE209 210
+#define BSLS_MACROINCREMENTED_VALUE210 211
+#define BSLS_MACROINCREMENTED_VALUE211 212
+#define BSLS_MACROINCREMENTED_VALUE212 213
+#define BSLS_MACROINCREMENTED_VALUE213 214
+#define BSLS_MACROINCREMENTED_VALUE214 215
+#define BSLS_MACROINCREMENTED_VALUE215 216
+#define BSLS_MACROINCREMENTED_VALUE216 217
+#define BSLS_MACROINCREMENTED_VALUE217 218
+#define BSLS_MACROINCREMENTED_VALUE218 219
+#define BSLS_MACROINCREMENTED_VALUE219 220
+#define BSLS_MACROINCREMENTED_VALUE220 221
+#define BSLS_MACROINCREMENTED_VALUE221 222
+#define BSLS_MACROINCREMENTED_VALUE222 223
+#define BSLS_MACROINCREMENTED_VALUE223 224
+#define BSLS_MACROINCREMENTED_VALUE224 225
+#define BSLS_MACROINCREMENTED_VALUE225 226
+#define BSLS_MACROINCREMENTED_VALUE226 227
+#define BSLS_MACROINCREMENTED_VALUE227 228
+#define BSLS_MACROINCREMENTED_VALUE228 229
+#define BSLS_MACROINCREMENTED_VALUE229 230
+#define BSLS_MACROINCREMENTED_VALUE230 231
+#define BSLS_MACROINCREMENTED_VALUE231 232
+#define BSLS_MACROINCREMENTED_VALUE232 233
+#define BSLS_MACROINCREMENTED_VALUE233 234
+#define BSLS_MACROINCREMENTED_VALUE234 235
+#define BSLS_MACROINCREMENTED_VALUE235 236
+#define BSLS_MACROINCREMENTED_VALUE236 237
+#define BSLS_MACROINCREMENTED_VALUE237 238
+#define BSLS_MACROINCREMENTED_VALUE238 239
+#define BSLS_MACROINCREMENTED_VALUE239 240
+#define BSLS_MACROINCREMENTED_VALUE240 241
+#define BSLS_MACROINCREMENTED_VALUE241 242
+#define BSLS_MACROINCREMENTED_VALUE242 243
+#define BSLS_MACROINCREMENTED_VALUE243 244
+#define BSLS_MACROINCREMENTED_VALUE244 245
+#define BSLS_MACROINCREMENTED_VALUE245 246
+#define BSLS_MACROINCREMENTED_VALUE246 247
+#define BSLS_MACROINCREMENTED_VALUE247 248
+#define BSLS_MACROINCREMENTED_VALUE248 249
+#define BSLS_MACROINCREMENTED_VALUE249 250
+#define BSLS_MACROINCREMENTED_VALUE250 251
+#define BSLS_MACROINCREMENTED_VALUE251 252
+#define BSLS_MACROINCREMENTED_VALUE252 253
+#define BSLS_MACROINCREMENTED_VALUE253 254
+#define BSLS_MACROINCREMENTED_VALUE254 255
+#define BSLS_MACROINCREMENTED_VALUE255 256
+#define BSLS_MACROINCREMENTED_VALUE256 257
+#define BSLS_MACROINCREMENTED_VALUE257 258
+#define BSLS_MACROINCREMENTED_VALUE258 259
+#define BSLS_MACROINCREMENTED_VALUE259 260
+#define BSLS_MACROINCREMENTED_VALUE260 261
+#define BSLS_MACROINCREMENTED_VALUE261 262
+#define BSLS_MACROINCREMENTED_VALUE262 263
+#define BSLS_MACROINCREMENTED_VALUE263 264
+#define BSLS_MACROINCREMENTED_VALUE264 265
+#define BSLS_MACROINCREMENTED_VALUE265 266
+#define BSLS_MACROINCREMENTED_VALUE266 267
+#define BSLS_MACROINCREMENTED_VALUE267 268
+#define BSLS_MACROINCREMENTED_VALUE268 269
+#define BSLS_MACROINCREMENTED_VALUE269 270
+#define BSLS_MACROINCREMENTED_VALUE270 271
+#define BSLS_MACROINCREMENTED_VALUE271 272
+#define BSLS_MACROINCREMENTED_VALUE272 273
+#define BSLS_MACROINCREMENTED_VALUE273 274
+#define BSLS_MACROINCREMENTED_VALUE274 275
+#define BSLS_MACROINCREMENTED_VALUE275 276
+#define BSLS_MACROINCREMENTED_VALUE276 277
+#define BSLS_MACROINCREMENTED_VALUE277 278
+#define BSLS_MACROINCREMENTED_VALUE278 279
+#define BSLS_MACROINCREMENTED_VALUE279 280
+#define BSLS_MACROINCREMENTED_VALUE280 281
+#define BSLS_MACROINCREMENTED_VALUE281 282
+#define BSLS_MACROINCREMENTED_VALUE282 283
+#define BSLS_MACROINCREMENTED_VALUE283 284
+#define BSLS_MACROINCREMENTED_VALUE284 285
+#define BSLS_MACROINCREMENTED_VALUE285 286
+#define BSLS_MACROINCREMENTED_VALUE286 287
+#define BSLS_MACROINCREMENTED_VALUE287 288
+#define BSLS_MACROINCREMENTED_VALUE288 289
+#define BSLS_MACROINCREMENTED_VALUE289 290
+#define BSLS_MACROINCREMENTED_VALUE290 291
+#define BSLS_MACROINCREMENTED_VALUE291 292
+#define BSLS_MACROINCREMENTED_VALUE292 293
+#define BSLS_MACROINCREMENTED_VALUE293 294
+#define BSLS_MACROINCREMENTED_VALUE294 295
+#define BSLS_MACROINCREMENTED_VALUE295 296
+#define BSLS_MACROINCREMENTED_VALUE296 297
+#define BSLS_MACROINCREMENTED_VALUE297 298
+#define BSLS_MACROINCREMENTED_VALUE298 299
+#define BSLS_MACROINCREMENTED_VALUE299 300
+#define BSLS_MACROINCREMENTED_VALUE300 301
+#define BSLS_MACROINCREMENTED_VALUE301 302
+#define BSLS_MACROINCREMENTED_VALUE302 303
+#define BSLS_MACROINCREMENTED_VALUE303 304
+#define BSLS_MACROINCREMENTED_VALUE304 305
+#define BSLS_MACROINCREMENTED_VALUE305 306
+#define BSLS_MACROINCREMENTED_VALUE306 307
+#define BSLS_MACROINCREMENTED_VALUE307 308
+#define BSLS_MACROINCREMENTED_VALUE308 309
+#define BSLS_MACROINCREMENTED_VALUE309 310
+#define BSLS_MACROINCREMENTED_VALUE310 311
+#define BSLS_MACROINCREMENTED_VALUE311 312
+#define BSLS_MACROINCREMENTED_VALUE312 313
+#define BSLS_MACROINCREMENTED_VALUE313 314
+#define BSLS_MACROINCREMENTED_VALUE314 315
+#define BSLS_MACROINCREMENTED_VALUE315 316
+#define BSLS_MACROINCREMENTED_VALUE316 317
+#define BSLS_MACROINCREMENTED_VALUE317 318
+#define BSLS_MACROINCREMENTED_VALUE318 319
+#define BSLS_MACROINCREMENTED_VALUE319 320
+#define BSLS_MACROINCREMENTED_VALUE320 321
+#define BSLS_MACROINCREMENTED_VALUE321 322
+#define BSLS_MACROINCREMENTED_VALUE322 323
+#define BSLS_MACROINCREMENTED_VALUE323 324
+#define BSLS_MACROINCREMENTED_VALUE324 325
+#define BSLS_MACROINCREMENTED_VALUE325 326
+#define BSLS_MACROINCREMENTED_VALUE326 327
+#define BSLS_MACROINCREMENTED_VALUE327 328
+#define BSLS_MACROINCREMENTED_VALUE328 329
+#define BSLS_MACROINCREMENTED_VALUE329 330
+#define BSLS_MACROINCREMENTED_VALUE330 331
+#define BSLS_MACROINCREMENTED_VALUE331 332
+#define BSLS_MACROINCREMENTED_VALUE332 333
+#define BSLS_MACROINCREMENTED_VALUE333 334
+#define BSLS_MACROINCREMENTED_VALUE334 335
+#define BSLS_MACROINCREMENTED_VALUE335 336
+#define BSLS_MACROINCREMENTED_VALUE336 337
+#define BSLS_MACROINCREMENTED_VALUE337 338
+#define BSLS_MACROINCREMENTED_VALUE338 339
+#define BSLS_MACROINCREMENTED_VALUE339 340
+#define BSLS_MACROINCREMENTED_VALUE340 341
+#define BSLS_MACROINCREMENTED_VALUE341 342
+#define BSLS_MACROINCREMENTED_VALUE342 343
+#define BSLS_MACROINCREMENTED_VALUE343 344
+#define BSLS_MACROINCREMENTED_VALUE344 345
+#define BSLS_MACROINCREMENTED_VALUE345 346
+#define BSLS_MACROINCREMENTED_VALUE346 347
+#define BSLS_MACROINCREMENTED_VALUE347 348
+#define BSLS_MACROINCREMENTED_VALUE348 349
+#define BSLS_MACROINCREMENTED_VALUE349 350
+#define BSLS_MACROINCREMENTED_VALUE350 351
+#define BSLS_MACROINCREMENTED_VALUE351 352
+#define BSLS_MACROINCREMENTED_VALUE352 353
+#define BSLS_MACROINCREMENTED_VALUE353 354
+#define BSLS_MACROINCREMENTED_VALUE354 355
+#define BSLS_MACROINCREMENTED_VALUE355 356
+#define BSLS_MACROINCREMENTED_VALUE356 357
+#define BSLS_MACROINCREMENTED_VALUE357 358
+#define BSLS_MACROINCREMENTED_VALUE358 359
+#define BSLS_MACROINCREMENTED_VALUE359 360
+#define BSLS_MACROINCREMENTED_VALUE360 361
+#define BSLS_MACROINCREMENTED_VALUE361 362
+#define BSLS_MACROINCREMENTED_VALUE362 363
+#define BSLS_MACROINCREMENTED_VALUE363 364
+#define BSLS_MACROINCREMENTED_VALUE364 365
+#define BSLS_MACROINCREMENTED_VALUE365 366
+#define BSLS_MACROINCREMENTED_VALUE366 367
+#define BSLS_MACROINCREMENTED_VALUE367 368
+#define BSLS_MACROINCREMENTED_VALUE368 369
+#define BSLS_MACROINCREMENTED_VALUE369 370
+#define BSLS_MACROINCREMENTED_VALUE370 371
+#define BSLS_MACROINCREMENTED_VALUE371 372
+#define BSLS_MACROINCREMENTED_VALUE372 373
+#define BSLS_MACROINCREMENTED_VALUE373 374
+#define BSLS_MACROINCREMENTED_VALUE374 375
+#define BSLS_MACROINCREMENTED_VALUE375 376
+#define BSLS_MACROINCREMENTED_VALUE376 377
+#define BSLS_MACROINCREMENTED_VALUE377 378
+#define BSLS_MACROINCREMENTED_VALUE378 379
+#define BSLS_MACROINCREMENTED_VALUE379 380
+#define BSLS_MACROINCREMENTED_VALUE380 381
+#define BSLS_MACROINCREMENTED_VALUE381 382
+#define BSLS_MACROINCREMENTED_VALUE382 383
+#define BSLS_MACROINCREMENTED_VALUE383 384
+#define BSLS_MACROINCREMENTED_VALUE384 385
+#define BSLS_MACROINCREMENTED_VALUE385 386
+#define BSLS_MACROINCREMENTED_VALUE386 387
+#define BSLS_MACROINCREMENTED_VALUE387 388
+#define BSLS_MACROINCREMENTED_VALUE388 389
+#define BSLS_MACROINCREMENTED_VALUE389 390
+#define BSLS_MACROINCREMENTED_VALUE390 391
+#define BSLS_MACROINCREMENTED_VALUE391 392
+#define BSLS_MACROINCREMENTED_VALUE392 393
+#define BSLS_MACROINCREMENTED_VALUE393 394
+#define BSLS_MACROINCREMENTED_VALUE394 395
+#define BSLS_MACROINCREMENTED_VALUE395 396
+#define BSLS_MACROINCREMENTED_VALUE396 397
+#define BSLS_MACROINCREMENTED_VALUE397 398
+#define BSLS_MACROINCREMENTED_VALUE398 399
+#define BSLS_MACROINCREMENTED_VALUE399 400
+#define BSLS_MACROINCREMENTED_VALUE400 401
+#define BSLS_MACROINCREMENTED_VALUE401 402
+#define BSLS_MACROINCREMENTED_VALUE402 403
+#define BSLS_MACROINCREMENTED_VALUE403 404
+#define BSLS_MACROINCREMENTED_VALUE404 405
+#define BSLS_MACROINCREMENTED_VALUE405 406
+#define BSLS_MACROINCREMENTED_VALUE406 407
+#define BSLS_MACROINCREMENTED_VALUE407 408
+#define BSLS_MACROINCREMENTED_VALUE408 409
+#define BSLS_MACROINCREMENTED_VALUE409 410
+#define BSLS_MACROINCREMENTED_VALUE410 411
+#define BSLS_MACROINCREMENTED_VALUE411 412
+#define BSLS_MACROINCREMENTED_VALUE412 413
+#define BSLS_MACROINCREMENTED_VALUE413 414
+#define BSLS_MACROINCREMENTED_VALUE414 415
+#define BSLS_MACROINCREMENTED_VALUE415 416
+#define BSLS_MACROINCREMENTED_VALUE416 417
+#define BSLS_MACROINCREMENTED_VALUE417 418
+#define BSLS_MACROINCREMENTED_VALUE418 419
+#define BSLS_MACROINCREMENTED_VALUE419 420
+#define BSLS_MACROINCREMENTED_VALUE420 421
+#define BSLS_MACROINCREMENTED_VALUE421 422
+#define BSLS_MACROINCREMENTED_VALUE422 423
+#define BSLS_MACROINCREMENTED_VALUE423 424
+#define BSLS_MACROINCREMENTED_VALUE424 425
+#define BSLS_MACROINCREMENTED_VALUE425 426
+#define BSLS_MACROINCREMENTED_VALUE426 427
+#define BSLS_MACROINCREMENTED_VALUE427 428
+#define BSLS_MACROINCREMENTED_VALUE428 429
+#define BSLS_MACROINCREMENTED_VALUE429 430
+#define BSLS_MACROINCREMENTED_VALUE430 431
+#define BSLS_MACROINCREMENTED_VALUE431 432
+#define BSLS_MACROINCREMENTED_VALUE432 433
+#define BSLS_MACROINCREMENTED_VALUE433 434
+#define BSLS_MACROINCREMENTED_VALUE434 435
+#define BSLS_MACROINCREMENTED_VALUE435 436
+#define BSLS_MACROINCREMENTED_VALUE436 437
+#define BSLS_MACROINCREMENTED_VALUE437 438
+#define BSLS_MACROINCREMENTED_VALUE438 439
+#define BSLS_MACROINCREMENTED_VALUE439 440
+#define BSLS_MACROINCREMENTED_VALUE440 441
+#define BSLS_MACROINCREMENTED_VALUE441 442
+#define BSLS_MACROINCREMENTED_VALUE442 443
+#define BSLS_MACROINCREMENTED_VALUE443 444
+#define BSLS_MACROINCREMENTED_VALUE444 445
+#define BSLS_MACROINCREMENTED_VALUE445 446
+#define BSLS_MACROINCREMENTED_VALUE446 447
+#define BSLS_MACROINCREMENTED_VALUE447 448
+#define BSLS_MACROINCREMENTED_VALUE448 449
+#define BSLS_MACROINCREMENTED_VALUE449 450
+#define BSLS_MACROINCREMENTED_VALUE450 451
+#define BSLS_MACROINCREMENTED_VALUE451 452
+#define BSLS_MACROINCREMENTED_VALUE452 453
+#define BSLS_MACROINCREMENTED_VALUE453 454
+#define BSLS_MACROINCREMENTED_VALUE454 455
+#define BSLS_MACROINCREMENTED_VALUE455 456
+#define BSLS_MACROINCREMENTED_VALUE456 457
+#define BSLS_MACROINCREMENTED_VALUE457 458
+#define BSLS_MACROINCREMENTED_VALUE458 459
+#define BSLS_MACROINCREMENTED_VALUE459 460
+#define BSLS_MACROINCREMENTED_VALUE460 461
+#define BSLS_MACROINCREMENTED_VALUE461 462
+#define BSLS_MACROINCREMENTED_VALUE462 463
+#define BSLS_MACROINCREMENTED_VALUE463 464
+#define BSLS_MACROINCREMENTED_VALUE464 465
+#define BSLS_MACROINCREMENTED_VALUE465 466
+#define BSLS_MACROINCREMENTED_VALUE466 467
+#define BSLS_MACROINCREMENTED_VALUE467 468
+#define BSLS_MACROINCREMENTED_VALUE468 469
+#define BSLS_MACROINCREMENTED_VALUE469 470
+#define BSLS_MACROINCREMENTED_VALUE470 471
+#define BSLS_MACROINCREMENTED_VALUE471 472
+#define BSLS_MACROINCREMENTED_VALUE472 473
+#define BSLS_MACROINCREMENTED_VALUE473 474
+#define BSLS_MACROINCREMENTED_VALUE474 475
+#define BSLS_MACROINCREMENTED_VALUE475 476
+#define BSLS_MACROINCREMENTED_VALUE476 477
+#define BSLS_MACROINCREMENTED_VALUE477 478
+#define BSLS_MACROINCREMENTED_VALUE478 479
+#define BSLS_MACROINCREMENTED_VALUE479 480
+#define BSLS_MACROINCREMENTED_VALUE480 481
+#define BSLS_MACROINCREMENTED_VALUE481 482
+#define BSLS_MACROINCREMENTED_VALUE482 483
+#define BSLS_MACROINCREMENTED_VALUE483 484
+#define BSLS_MACROINCREMENTED_VALUE484 485
+#define BSLS_MACROINCREMENTED_VALUE485 486
+#define BSLS_MACROINCREMENTED_VALUE486 487
+#define BSLS_MACROINCREMENTED_VALUE487 488
+#define BSLS_MACROINCREMENTED_VALUE488 489
+#define BSLS_MACROINCREMENTED_VALUE489 490
+#define BSLS_MACROINCREMENTED_VALUE490 491
+#define BSLS_MACROINCREMENTED_VALUE491 492
+#define BSLS_MACROINCREMENTED_VALUE492 493
+#define BSLS_MACROINCREMENTED_VALUE493 494
+#define BSLS_MACROINCREMENTED_VALUE494 495
+#define BSLS_MACROINCREMENTED_VALUE495 496
+#define BSLS_MACROINCREMENTED_VALUE496 497
+#define BSLS_MACROINCREMENTED_VALUE497 498
+#define BSLS_MACROINCREMENTED_VALUE498 499
+#define BSLS_MACROINCREMENTED_VALUE499 500
+#define BSLS_MACROINCREMENTED_VALUE500 501
+#define BSLS_MACROINCREMENTED_VALUE501 502
+#define BSLS_MACROINCREMENTED_VALUE502 503
+#define BSLS_MACROINCREMENTED_VALUE503 504
+#define BSLS_MACROINCREMENTED_VALUE504 505
+#define BSLS_MACROINCREMENTED_VALUE505 506
+#define BSLS_MACROINCREMENTED_VALUE506 507
+#define BSLS_MACROINCREMENTED_VALUE507 508
+#define BSLS_MACROINCREMENTED_VALUE508 509
+#define BSLS_MACROINCREMENTED_VALUE509 510
+#define BSLS_MACROINCREMENTED_VALUE510 511
+#define BSLS_MACROINCREMENTED_VALUE511 512
+#define BSLS_MACROINCREMENTED_VALUE512 513
+#define BSLS_MACROINCREMENTED_VALUE513 514
+#define BSLS_MACROINCREMENTED_VALUE514 515
+#define BSLS_MACROINCREMENTED_VALUE515 516
+#define BSLS_MACROINCREMENTED_VALUE516 517
+#define BSLS_MACROINCREMENTED_VALUE517 518
+#define BSLS_MACROINCREMENTED_VALUE518 519
+#define BSLS_MACROINCREMENTED_VALUE519 520
+#define BSLS_MACROINCREMENTED_VALUE520 521
+#define BSLS_MACROINCREMENTED_VALUE521 522
+#define BSLS_MACROINCREMENTED_VALUE522 523
+#define BSLS_MACROINCREMENTED_VALUE523 524
+#define BSLS_MACROINCREMENTED_VALUE524 525
+#define BSLS_MACROINCREMENTED_VALUE525 526
+#define BSLS_MACROINCREMENTED_VALUE526 527
+#define BSLS_MACROINCREMENTED_VALUE527 528
+#define BSLS_MACROINCREMENTED_VALUE528 529
+#define BSLS_MACROINCREMENTED_VALUE529 530
+#define BSLS_MACROINCREMENTED_VALUE530 531
+#define BSLS_MACROINCREMENTED_VALUE531 532
+#define BSLS_MACROINCREMENTED_VALUE532 533
+#define BSLS_MACROINCREMENTED_VALUE533 534
+#define BSLS_MACROINCREMENTED_VALUE534 535
+#define BSLS_MACROINCREMENTED_VALUE535 536
+#define BSLS_MACROINCREMENTED_VALUE536 537
+#define BSLS_MACROINCREMENTED_VALUE537 538
+#define BSLS_MACROINCREMENTED_VALUE538 539
+#define BSLS_MACROINCREMENTED_VALUE539 540
+#define BSLS_MACROINCREMENTED_VALUE540 541
+#define BSLS_MACROINCREMENTED_VALUE541 542
+#define BSLS_MACROINCREMENTED_VALUE542 543
+#define BSLS_MACROINCREMENTED_VALUE543 544
+#define BSLS_MACROINCREMENTED_VALUE544 545
+#define BSLS_MACROINCREMENTED_VALUE545 546
+#define BSLS_MACROINCREMENTED_VALUE546 547
+#define BSLS_MACROINCREMENTED_VALUE547 548
+#define BSLS_MACROINCREMENTED_VALUE548 549
+#define BSLS_MACROINCREMENTED_VALUE549 550
+#define BSLS_MACROINCREMENTED_VALUE550 551
+#define BSLS_MACROINCREMENTED_VALUE551 552
+#define BSLS_MACROINCREMENTED_VALUE552 553
+#define BSLS_MACROINCREMENTED_VALUE553 554
+#define BSLS_MACROINCREMENTED_VALUE554 555
+#define BSLS_MACROINCREMENTED_VALUE555 556
+#define BSLS_MACROINCREMENTED_VALUE556 557
+#define BSLS_MACROINCREMENTED_VALUE557 558
+#define BSLS_MACROINCREMENTED_VALUE558 559
+#define BSLS_MACROINCREMENTED_VALUE559 560
+#define BSLS_MACROINCREMENTED_VALUE560 561
+#define BSLS_MACROINCREMENTED_VALUE561 562
+#define BSLS_MACROINCREMENTED_VALUE562 563
+#define BSLS_MACROINCREMENTED_VALUE563 564
+#define BSLS_MACROINCREMENTED_VALUE564 565
+#define BSLS_MACROINCREMENTED_VALUE565 566
+#define BSLS_MACROINCREMENTED_VALUE566 567
+#define BSLS_MACROINCREMENTED_VALUE567 568
+#define BSLS_MACROINCREMENTED_VALUE568 569
+#define BSLS_MACROINCREMENTED_VALUE569 570
+#define BSLS_MACROINCREMENTED_VALUE570 571
+#define BSLS_MACROINCREMENTED_VALUE571 572
+#define BSLS_MACROINCREMENTED_VALUE572 573
+#define BSLS_MACROINCREMENTED_VALUE573 574
+#define BSLS_MACROINCREMENTED_VALUE574 575
+#define BSLS_MACROINCREMENTED_VALUE575 576
+#define BSLS_MACROINCREMENTED_VALUE576 577
+#define BSLS_MACROINCREMENTED_VALUE577 578
+#define BSLS_MACROINCREMENTED_VALUE578 579
+#define BSLS_MACROINCREMENTED_VALUE579 580
+#define BSLS_MACROINCREMENTED_VALUE580 581
+#define BSLS_MACROINCREMENTED_VALUE581 582
+#define BSLS_MACROINCREMENTED_VALUE582 583
+#define BSLS_MACROINCREMENTED_VALUE583 584
+#define BSLS_MACROINCREMENTED_VALUE584 585
+#define BSLS_MACROINCREMENTED_VALUE585 586
+#define BSLS_MACROINCREMENTED_VALUE586 587
+#define BSLS_MACROINCREMENTED_VALUE587 588
+#define BSLS_MACROINCREMENTED_VALUE588 589
+#define BSLS_MACROINCREMENTED_VALUE589 590
+#define BSLS_MACROINCREMENTED_VALUE590 591
+#define BSLS_MACROINCREMENTED_VALUE591 592
+#define BSLS_MACROINCREMENTED_VALUE592 593
+#define BSLS_MACROINCREMENTED_VALUE593 594
+#define BSLS_MACROINCREMENTED_VALUE594 595
+#define BSLS_MACROINCREMENTED_VALUE595 596
+#define BSLS_MACROINCREMENTED_VALUE596 597
+#define BSLS_MACROINCREMENTED_VALUE597 598
+#define BSLS_MACROINCREMENTED_VALUE598 599
+#define BSLS_MACROINCREMENTED_VALUE599 600
+#define BSLS_MACROINCREMENTED_VALUE600 601
+#define BSLS_MACROINCREMENTED_VALUE601 602
+#define BSLS_MACROINCREMENTED_VALUE602 603
+#define BSLS_MACROINCREMENTED_VALUE603 604
+#define BSLS_MACROINCREMENTED_VALUE604 605
+#define BSLS_MACROINCREMENTED_VALUE605 606
+#define BSLS_MACROINCREMENTED_VALUE606 607
+#define BSLS_MACROINCREMENTED_VALUE607 608
+#define BSLS_MACROINCREMENTED_VALUE608 609
+#define BSLS_MACROINCREMENTED_VALUE609 610
+#define BSLS_MACROINCREMENTED_VALUE610 611
+#define BSLS_MACROINCREMENTED_VALUE611 612
+#define BSLS_MACROINCREMENTED_VALUE612 613
+#define BSLS_MACROINCREMENTED_VALUE613 614
+#define BSLS_MACROINCREMENTED_VALUE614 615
+#define BSLS_MACROINCREMENTED_VALUE615 616
+#define BSLS_MACROINCREMENTED_VALUE616 617
+#define BSLS_MACROINCREMENTED_VALUE617 618
+#define BSLS_MACROINCREMENTED_VALUE618 619
+#define BSLS_MACROINCREMENTED_VALUE619 620
+#define BSLS_MACROINCREMENTED_VALUE620 621
+#define BSLS_MACROINCREMENTED_VALUE621 622
+#define BSLS_MACROINCREMENTED_VALUE622 623
+#define BSLS_MACROINCREMENTED_VALUE623 624
+#define BSLS_MACROINCREMENTED_VALUE624 625
+#define BSLS_MACROINCREMENTED_VALUE625 626
+#define BSLS_MACROINCREMENTED_VALUE626 627
+#define BSLS_MACROINCREMENTED_VALUE627 628
+#define BSLS_MACROINCREMENTED_VALUE628 629
+#define BSLS_MACROINCREMENTED_VALUE629 630
+#define BSLS_MACROINCREMENTED_VALUE630 631
+#define BSLS_MACROINCREMENTED_VALUE631 632
+#define BSLS_MACROINCREMENTED_VALUE632 633
+#define BSLS_MACROINCREMENTED_VALUE633 634
+#define BSLS_MACROINCREMENTED_VALUE634 635
+#define BSLS_MACROINCREMENTED_VALUE635 636
+#define BSLS_MACROINCREMENTED_VALUE636 637
+#define BSLS_MACROINCREMENTED_VALUE637 638
+#define BSLS_MACROINCREMENTED_VALUE638 639
+#define BSLS_MACROINCREMENTED_VALUE639 640
+#define BSLS_MACROINCREMENTED_VALUE640 641
+#define BSLS_MACROINCREMENTED_VALUE641 642
+#define BSLS_MACROINCREMENTED_VALUE642 643
+#define BSLS_MACROINCREMENTED_VALUE643 644
+#define BSLS_MACROINCREMENTED_VALUE644 645
+#define BSLS_MACROINCREMENTED_VALUE645 646
+#define BSLS_MACROINCREMENTED_VALUE646 647
+#define BSLS_MACROINCREMENTED_VALUE647 648
+#define BSLS_MACROINCREMENTED_VALUE648 649
+#define BSLS_MACROINCREMENTED_VALUE649 650
+#define BSLS_MACROINCREMENTED_VALUE650 651
+#define BSLS_MACROINCREMENTED_VALUE651 652
+#define BSLS_MACROINCREMENTED_VALUE652 653
+#define BSLS_MACROINCREMENTED_VALUE653 654
+#define BSLS_MACROINCREMENTED_VALUE654 655
+#define BSLS_MACROINCREMENTED_VALUE655 656
+#define BSLS_MACROINCREMENTED_VALUE656 657
+#define BSLS_MACROINCREMENTED_VALUE657 658
+#define BSLS_MACROINCREMENTED_VALUE658 659
+#define BSLS_MACROINCREMENTED_VALUE659 660
+#define BSLS_MACROINCREMENTED_VALUE660 661
+#define BSLS_MACROINCREMENTED_VALUE661 662
+#define BSLS_MACROINCREMENTED_VALUE662 663
+#define BSLS_MACROINCREMENTED_VALUE663 664
+#define BSLS_MACROINCREMENTED_VALUE664 665
+#define BSLS_MACROINCREMENTED_VALUE665 666
+#define BSLS_MACROINCREMENTED_VALUE666 667
+#define BSLS_MACROINCREMENTED_VALUE667 668
+#define BSLS_MACROINCREMENTED_VALUE668 669
+#define BSLS_MACROINCREMENTED_VALUE669 670
+#define BSLS_MACROINCREMENTED_VALUE670 671
+#define BSLS_MACROINCREMENTED_VALUE671 672
+#define BSLS_MACROINCREMENTED_VALUE672 673
+#define BSLS_MACROINCREMENTED_VALUE673 674
+#define BSLS_MACROINCREMENTED_VALUE674 675
+#define BSLS_MACROINCREMENTED_VALUE675 676
+#define BSLS_MACROINCREMENTED_VALUE676 677
+#define BSLS_MACROINCREMENTED_VALUE677 678
+#define BSLS_MACROINCREMENTED_VALUE678 679
+#define BSLS_MACROINCREMENTED_VALUE679 680
+#define BSLS_MACROINCREMENTED_VALUE680 681
+#define BSLS_MACROINCREMENTED_VALUE681 682
+#define BSLS_MACROINCREMENTED_VALUE682 683
+#define BSLS_MACROINCREMENTED_VALUE683 684
+#define BSLS_MACROINCREMENTED_VALUE684 685
+#define BSLS_MACROINCREMENTED_VALUE685 686
+#define BSLS_MACROINCREMENTED_VALUE686 687
+#define BSLS_MACROINCREMENTED_VALUE687 688
+#define BSLS_MACROINCREMENTED_VALUE688 689
+#define BSLS_MACROINCREMENTED_VALUE689 690
+#define BSLS_MACROINCREMENTED_VALUE690 691
+#define BSLS_MACROINCREMENTED_VALUE691 692
+#define BSLS_MACROINCREMENTED_VALUE692 693
+#define BSLS_MACROINCREMENTED_VALUE693 694
+#define BSLS_MACROINCREMENTED_VALUE694 695
+#define BSLS_MACROINCREMENTED_VALUE695 696
+#define BSLS_MACROINCREMENTED_VALUE696 697
+#define BSLS_MACROINCREMENTED_VALUE697 698
+#define BSLS_MACROINCREMENTED_VALUE698 699
+#define BSLS_MACROINCREMENTED_VALUE699 700
+#define BSLS_MACROINCREMENTED_VALUE700 701
+#define BSLS_MACROINCREMENTED_VALUE701 702
+#define BSLS_MACROINCREMENTED_VALUE702 703
+#define BSLS_MACROINCREMENTED_VALUE703 704
+#define BSLS_MACROINCREMENTED_VALUE704 705
+#define BSLS_MACROINCREMENTED_VALUE705 706
+#define BSLS_MACROINCREMENTED_VALUE706 707
+#define BSLS_MACROINCREMENTED_VALUE707 708
+#define BSLS_MACROINCREMENTED_VALUE708 709
+#define BSLS_MACROINCREMENTED_VALUE709 710
+#define BSLS_MACROINCREMENTED_VALUE710 711
+#define BSLS_MACROINCREMENTED_VALUE711 712
+#define BSLS_MACROINCREMENTED_VALUE712 713
+#define BSLS_MACROINCREMENTED_VALUE713 714
+#define BSLS_MACROINCREMENTED_VALUE714 715
+#define BSLS_MACROINCREMENTED_VALUE715 716
+#define BSLS_MACROINCREMENTED_VALUE716 717
+#define BSLS_MACROINCREMENTED_VALUE717 718
+#define BSLS_MACROINCREMENTED_VALUE718 719
+#define BSLS_MACROINCREMENTED_VALUE719 720
+#define BSLS_MACROINCREMENTED_VALUE720 721
+#define BSLS_MACROINCREMENTED_VALUE721 722
+#define BSLS_MACROINCREMENTED_VALUE722 723
+#define BSLS_MACROINCREMENTED_VALUE723 724
+#define BSLS_MACROINCREMENTED_VALUE724 725
+#define BSLS_MACROINCREMENTED_VALUE725 726
+#define BSLS_MACROINCREMENTED_VALUE726 727
+#define BSLS_MACROINCREMENTED_VALUE727 728
+#define BSLS_MACROINCREMENTED_VALUE728 729
+#define BSLS_MACROINCREMENTED_VALUE729 730
+#define BSLS_MACROINCREMENTED_VALUE730 731
+#define BSLS_MACROINCREMENTED_VALUE731 732
+#define BSLS_MACROINCREMENTED_VALUE732 733
+#define BSLS_MACROINCREMENTED_VALUE733 734
+#define BSLS_MACROINCREMENTED_VALUE734 735
+#define BSLS_MACROINCREMENTED_VALUE735 736
+#define BSLS_MACROINCREMENTED_VALUE736 737
+#define BSLS_MACROINCREMENTED_VALUE737 738
+#define BSLS_MACROINCREMENTED_VALUE738 739
+#define BSLS_MACROINCREMENTED_VALUE739 740
+#define BSLS_MACROINCREMENTED_VALUE740 741
+#define BSLS_MACROINCREMENTED_VALUE741 742
+#define BSLS_MACROINCREMENTED_VALUE742 743
+#define BSLS_MACROINCREMENTED_VALUE743 744
+#define BSLS_MACROINCREMENTED_VALUE744 745
+#define BSLS_MACROINCREMENTED_VALUE745 746
+#define BSLS_MACROINCREMENTED_VALUE746 747
+#define BSLS_MACROINCREMENTED_VALUE747 748
+#define BSLS_MACROINCREMENTED_VALUE748 749
+#define BSLS_MACROINCREMENTED_VALUE749 750
+#define BSLS_MACROINCREMENTED_VALUE750 751
+#define BSLS_MACROINCREMENTED_VALUE751 752
+#define BSLS_MACROINCREMENTED_VALUE752 753
+#define BSLS_MACROINCREMENTED_VALUE753 754
+#define BSLS_MACROINCREMENTED_VALUE754 755
+#define BSLS_MACROINCREMENTED_VALUE755 756
+#define BSLS_MACROINCREMENTED_VALUE756 757
+#define BSLS_MACROINCREMENTED_VALUE757 758
+#define BSLS_MACROINCREMENTED_VALUE758 759
+#define BSLS_MACROINCREMENTED_VALUE759 760
+#define BSLS_MACROINCREMENTED_VALUE760 761
+#define BSLS_MACROINCREMENTED_VALUE761 762
+#define BSLS_MACROINCREMENTED_VALUE762 763
+#define BSLS_MACROINCREMENTED_VALUE763 764
+#define BSLS_MACROINCREMENTED_VALUE764 765
+#define BSLS_MACROINCREMENTED_VALUE765 766
+#define BSLS_MACROINCREMENTED_VALUE766 767
+#define BSLS_MACROINCREMENTED_VALUE767 768
+#define BSLS_MACROINCREMENTED_VALUE768 769
+#define BSLS_MACROINCREMENTED_VALUE769 770
+#define BSLS_MACROINCREMENTED_VALUE770 771
+#define BSLS_MACROINCREMENTED_VALUE771 772
+#define BSLS_MACROINCREMENTED_VALUE772 773
+#define BSLS_MACROINCREMENTED_VALUE773 774
+#define BSLS_MACROINCREMENTED_VALUE774 775
+#define BSLS_MACROINCREMENTED_VALUE775 776
+#define BSLS_MACROINCREMENTED_VALUE776 777
+#define BSLS_MACROINCREMENTED_VALUE777 778
+#define BSLS_MACROINCREMENTED_VALUE778 779
+#define BSLS_MACROINCREMENTED_VALUE779 780
+#define BSLS_MACROINCREMENTED_VALUE780 781
+#define BSLS_MACROINCREMENTED_VALUE781 782
+#define BSLS_MACROINCREMENTED_VALUE782 783
+#define BSLS_MACROINCREMENTED_VALUE783 784
+#define BSLS_MACROINCREMENTED_VALUE784 785
+#define BSLS_MACROINCREMENTED_VALUE785 786
+#define BSLS_MACROINCREMENTED_VALUE786 787
+#define BSLS_MACROINCREMENTED_VALUE787 788
+#define BSLS_MACROINCREMENTED_VALUE788 789
+#define BSLS_MACROINCREMENTED_VALUE789 790
+#define BSLS_MACROINCREMENTED_VALUE790 791
+#define BSLS_MACROINCREMENTED_VALUE791 792
+#define BSLS_MACROINCREMENTED_VALUE792 793
+#define BSLS_MACROINCREMENTED_VALUE793 794
+#define BSLS_MACROINCREMENTED_VALUE794 795
+#define BSLS_MACROINCREMENTED_VALUE795 796
+#define BSLS_MACROINCREMENTED_VALUE796 797
+#define BSLS_MACROINCREMENTED_VALUE797 798
+#define BSLS_MACROINCREMENTED_VALUE798 799
+#define BSLS_MACROINCREMENTED_VALUE799 800
+#define BSLS_MACROINCREMENTED_VALUE800 801
+#define BSLS_MACROINCREMENTED_VALUE801 802
+#define BSLS_MACROINCREMENTED_VALUE802 803
+#define BSLS_MACROINCREMENTED_VALUE803 804
+#define BSLS_MACROINCREMENTED_VALUE804 805
+#define BSLS_MACROINCREMENTED_VALUE805 806
+#define BSLS_MACROINCREMENTED_VALUE806 807
+#define BSLS_MACROINCREMENTED_VALUE807 808
+#define BSLS_MACROINCREMENTED_VALUE808 809
+#define BSLS_MACROINCREMENTED_VALUE809 810
+#define BSLS_MACROINCREMENTED_VALUE810 811
+#define BSLS_MACROINCREMENTED_VALUE811 812
+#define BSLS_MACROINCREMENTED_VALUE812 813
+#define BSLS_MACROINCREMENTED_VALUE813 814
+#define BSLS_MACROINCREMENTED_VALUE814 815
+#define BSLS_MACROINCREMENTED_VALUE815 816
+#define BSLS_MACROINCREMENTED_VALUE816 817
+#define BSLS_MACROINCREMENTED_VALUE817 818
+#define BSLS_MACROINCREMENTED_VALUE818 819
+#define BSLS_MACROINCREMENTED_VALUE819 820
+#define BSLS_MACROINCREMENTED_VALUE820 821
+#define BSLS_MACROINCREMENTED_VALUE821 822
+#define BSLS_MACROINCREMENTED_VALUE822 823
+#define BSLS_MACROINCREMENTED_VALUE823 824
+#define BSLS_MACROINCREMENTED_VALUE824 825
+#define BSLS_MACROINCREMENTED_VALUE825 826
+#define BSLS_MACROINCREMENTED_VALUE826 827
+#define BSLS_MACROINCREMENTED_VALUE827 828
+#define BSLS_MACROINCREMENTED_VALUE828 829
+#define BSLS_MACROINCREMENTED_VALUE829 830
+#define BSLS_MACROINCREMENTED_VALUE830 831
+#define BSLS_MACROINCREMENTED_VALUE831 832
+#define BSLS_MACROINCREMENTED_VALUE832 833
+#define BSLS_MACROINCREMENTED_VALUE833 834
+#define BSLS_MACROINCREMENTED_VALUE834 835
+#define BSLS_MACROINCREMENTED_VALUE835 836
+#define BSLS_MACROINCREMENTED_VALUE836 837
+#define BSLS_MACROINCREMENTED_VALUE837 838
+#define BSLS_MACROINCREMENTED_VALUE838 839
+#define BSLS_MACROINCREMENTED_VALUE839 840
+#define BSLS_MACROINCREMENTED_VALUE840 841
+#define BSLS_MACROINCREMENTED_VALUE841 842
+#define BSLS_MACROINCREMENTED_VALUE842 843
+#define BSLS_MACROINCREMENTED_VALUE843 844
+#define BSLS_MACROINCREMENTED_VALUE844 845
+#define BSLS_MACROINCREMENTED_VALUE845 846
+#define BSLS_MACROINCREMENTED_VALUE846 847
+#define BSLS_MACROINCREMENTED_VALUE847 848
+#define BSLS_MACROINCREMENTED_VALUE848 849
+#define BSLS_MACROINCREMENTED_VALUE849 850
+#define BSLS_MACROINCREMENTED_VALUE850 851
+#define BSLS_MACROINCREMENTED_VALUE851 852
+#define BSLS_MACROINCREMENTED_VALUE852 853
+#define BSLS_MACROINCREMENTED_VALUE853 854
+#define BSLS_MACROINCREMENTED_VALUE854 855
+#define BSLS_MACROINCREMENTED_VALUE855 856
+#define BSLS_MACROINCREMENTED_VALUE856 857
+#define BSLS_MACROINCREMENTED_VALUE857 858
+#define BSLS_MACROINCREMENTED_VALUE858 859
+#define BSLS_MACROINCREMENTED_VALUE859 860
+#define BSLS_MACROINCREMENTED_VALUE860 861
+#define BSLS_MACROINCREMENTED_VALUE861 862
+#define BSLS_MACROINCREMENTED_VALUE862 863
+#define BSLS_MACROINCREMENTED_VALUE863 864
+#define BSLS_MACROINCREMENTED_VALUE864 865
+#define BSLS_MACROINCREMENTED_VALUE865 866
+#define BSLS_MACROINCREMENTED_VALUE866 867
+#define BSLS_MACROINCREMENTED_VALUE867 868
+#define BSLS_MACROINCREMENTED_VALUE868 869
+#define BSLS_MACROINCREMENTED_VALUE869 870
+#define BSLS_MACROINCREMENTED_VALUE870 871
+#define BSLS_MACROINCREMENTED_VALUE871 872
+#define BSLS_MACROINCREMENTED_VALUE872 873
+#define BSLS_MACROINCREMENTED_VALUE873 874
+#define BSLS_MACROINCREMENTED_VALUE874 875
+#define BSLS_MACROINCREMENTED_VALUE875 876
+#define BSLS_MACROINCREMENTED_VALUE876 877
+#define BSLS_MACROINCREMENTED_VALUE877 878
+#define BSLS_MACROINCREMENTED_VALUE878 879
+#define BSLS_MACROINCREMENTED_VALUE879 880
+#define BSLS_MACROINCREMENTED_VALUE880 881
+#define BSLS_MACROINCREMENTED_VALUE881 882
+#define BSLS_MACROINCREMENTED_VALUE882 883
+#define BSLS_MACROINCREMENTED_VALUE883 884
+#define BSLS_MACROINCREMENTED_VALUE884 885
+#define BSLS_MACROINCREMENTED_VALUE885 886
+#define BSLS_MACROINCREMENTED_VALUE886 887
+#define BSLS_MACROINCREMENTED_VALUE887 888
+#define BSLS_MACROINCREMENTED_VALUE888 889
+#define BSLS_MACROINCREMENTED_VALUE889 890
+#define BSLS_MACROINCREMENTED_VALUE890 891
+#define BSLS_MACROINCREMENTED_VALUE891 892
+#define BSLS_MACROINCREMENTED_VALUE892 893
+#define BSLS_MACROINCREMENTED_VALUE893 894
+#define BSLS_MACROINCREMENTED_VALUE894 895
+#define BSLS_MACROINCREMENTED_VALUE895 896
+#define BSLS_MACROINCREMENTED_VALUE896 897
+#define BSLS_MACROINCREMENTED_VALUE897 898
+#define BSLS_MACROINCREMENTED_VALUE898 899
+#define BSLS_MACROINCREMENTED_VALUE899 900
+#define BSLS_MACROINCREMENTED_VALUE900 901
+#define BSLS_MACROINCREMENTED_VALUE901 902
+#define BSLS_MACROINCREMENTED_VALUE902 903
+#define BSLS_MACROINCREMENTED_VALUE903 904
+#define BSLS_MACROINCREMENTED_VALUE904 905
+#define BSLS_MACROINCREMENTED_VALUE905 906
+#define BSLS_MACROINCREMENTED_VALUE906 907
+#define BSLS_MACROINCREMENTED_VALUE907 908
+#define BSLS_MACROINCREMENTED_VALUE908 909
+#define BSLS_MACROINCREMENTED_VALUE909 910
+#define BSLS_MACROINCREMENTED_VALUE910 911
+#define BSLS_MACROINCREMENTED_VALUE911 912
+#define BSLS_MACROINCREMENTED_VALUE912 913
+#define BSLS_MACROINCREMENTED_VALUE913 914
+#define BSLS_MACROINCREMENTED_VALUE914 915
+#define BSLS_MACROINCREMENTED_VALUE915 916
+#define BSLS_MACROINCREMENTED_VALUE916 917
+#define BSLS_MACROINCREMENTED_VALUE917 918
+#define BSLS_MACROINCREMENTED_VALUE918 919
+#define BSLS_MACROINCREMENTED_VALUE919 920
+#define BSLS_MACROINCREMENTED_VALUE920 921
+#define BSLS_MACROINCREMENTED_VALUE921 922
+#define BSLS_MACROINCREMENTED_VALUE922 923
+#define BSLS_MACROINCREMENTED_VALUE923 924
+#define BSLS_MACROINCREMENTED_VALUE924 925
+#define BSLS_MACROINCREMENTED_VALUE925 926
+#define BSLS_MACROINCREMENTED_VALUE926 927
+#define BSLS_MACROINCREMENTED_VALUE927 928
+#define BSLS_MACROINCREMENTED_VALUE928 929
+#define BSLS_MACROINCREMENTED_VALUE929 930
+#define BSLS_MACROINCREMENTED_VALUE930 931
+#define BSLS_MACROINCREMENTED_VALUE931 932
+#define BSLS_MACROINCREMENTED_VALUE932 933
+#define BSLS_MACROINCREMENTED_VALUE933 934
+#define BSLS_MACROINCREMENTED_VALUE934 935
+#define BSLS_MACROINCREMENTED_VALUE935 936
+#define BSLS_MACROINCREMENTED_VALUE936 937
+#define BSLS_MACROINCREMENTED_VALUE937 938
+#define BSLS_MACROINCREMENTED_VALUE938 939
+#define BSLS_MACROINCREMENTED_VALUE939 940
+#define BSLS_MACROINCREMENTED_VALUE940 941
+#define BSLS_MACROINCREMENTED_VALUE941 942
+#define BSLS_MACROINCREMENTED_VALUE942 943
+#define BSLS_MACROINCREMENTED_VALUE943 944
+#define BSLS_MACROINCREMENTED_VALUE944 945
+#define BSLS_MACROINCREMENTED_VALUE945 946
+#define BSLS_MACROINCREMENTED_VALUE946 947
+#define BSLS_MACROINCREMENTED_VALUE947 948
+#define BSLS_MACROINCREMENTED_VALUE948 949
+#define BSLS_MACROINCREMENTED_VALUE949 950
+#define BSLS_MACROINCREMENTED_VALUE950 951
+#define BSLS_MACROINCREMENTED_VALUE951 952
+#define BSLS_MACROINCREMENTED_VALUE952 953
+#define BSLS_MACROINCREMENTED_VALUE953 954
+#define BSLS_MACROINCREMENTED_VALUE954 955
+#define BSLS_MACROINCREMENTED_VALUE955 956
+#define BSLS_MACROINCREMENTED_VALUE956 957
+#define BSLS_MACROINCREMENTED_VALUE957 958
+#define BSLS_MACROINCREMENTED_VALUE958 959
+#define BSLS_MACROINCREMENTED_VALUE959 960
+#define BSLS_MACROINCREMENTED_VALUE960 961
+#define BSLS_MACROINCREMENTED_VALUE961 962
+#define BSLS_MACROINCREMENTED_VALUE962 963
+#define BSLS_MACROINCREMENTED_VALUE963 964
+#define BSLS_MACROINCREMENTED_VALUE964 965
+#define BSLS_MACROINCREMENTED_VALUE965 966
+#define BSLS_MACROINCREMENTED_VALUE966 967
+#define BSLS_MACROINCREMENTED_VALUE967 968
+#define BSLS_MACROINCREMENTED_VALUE968 969
+#define BSLS_MACROINCREMENTED_VALUE969 970
+#define BSLS_MACROINCREMENTED_VALUE970 971
+#define BSLS_MACROINCREMENTED_VALUE971 972
+#define BSLS_MACROINCREMENTED_VALUE972 973
+#define BSLS_MACROINCREMENTED_VALUE973 974
+#define BSLS_MACROINCREMENTED_VALUE974 975
+#define BSLS_MACROINCREMENTED_VALUE975 976
+#define BSLS_MACROINCREMENTED_VALUE976 977
+#define BSLS_MACROINCREMENTED_VALUE977 978
+#define BSLS_MACROINCREMENTED_VALUE978 979
+#define BSLS_MACROINCREMENTED_VALUE979 980
+#define BSLS_MACROINCREMENTED_VALUE980 981
+#define BSLS_MACROINCREMENTED_VALUE981 982
+#define BSLS_MACROINCREMENTED_VALUE982 983
+#define BSLS_MACROINCREMENTED_VALUE983 984
+#define BSLS_MACROINCREMENTED_VALUE984 985
+#define BSLS_MACROINCREMENTED_VALUE985 986
+#define BSLS_MACROINCREMENTED_VALUE986 987
+#define BSLS_MACROINCREMENTED_VALUE987 988
+#define BSLS_MACROINCREMENTED_VALUE988 989
+#define BSLS_MACROINCREMENTED_VALUE989 990
+#define BSLS_MACROINCREMENTED_VALUE990 991
+#define BSLS_MACROINCREMENTED_VALUE991 992
+#define BSLS_MACROINCREMENTED_VALUE992 993
+#define BSLS_MACROINCREMENTED_VALUE993 994
+#define BSLS_MACROINCREMENTED_VALUE994 995
+#define BSLS_MACROINCREMENTED_VALUE995 996
+#define BSLS_MACROINCREMENTED_VALUE996 997
+#define BSLS_MACROINCREMENTED_VALUE997 998
+#define BSLS_MACROINCREMENTED_VALUE998 999
+#define BSLS_MACROINCREMENTED_VALUE999 1000
+#define BSLS_MACROINCREMENTED_VALUE1000 1001
+#define BSLS_MACROINCREMENTED_VALUE1001 1002
+#define BSLS_MACROINCREMENTED_VALUE1002 1003
+#define BSLS_MACROINCREMENTED_VALUE1003 1004
+#define BSLS_MACROINCREMENTED_VALUE1004 1005
+#define BSLS_MACROINCREMENTED_VALUE1005 1006
+#define BSLS_MACROINCREMENTED_VALUE1006 1007
+#define BSLS_MACROINCREMENTED_VALUE1007 1008
+#define BSLS_MACROINCREMENTED_VALUE1008 1009
+#define BSLS_MACROINCREMENTED_VALUE1009 1010
+#define BSLS_MACROINCREMENTED_VALUE1010 1011
+#define BSLS_MACROINCREMENTED_VALUE1011 1012
+#define BSLS_MACROINCREMENTED_VALUE1012 1013
+#define BSLS_MACROINCREMENTED_VALUE1013 1014
+#define BSLS_MACROINCREMENTED_VALUE1014 1015
+#define BSLS_MACROINCREMENTED_VALUE1015 1016
+#define BSLS_MACROINCREMENTED_VALUE1016 1017
+#define BSLS_MACROINCREMENTED_VALUE1017 1018
+#define BSLS_MACROINCREMENTED_VALUE1018 1019
+#define BSLS_MACROINCREMENTED_VALUE1019 1020
+#define BSLS_MACROINCREMENTED_VALUE1020 1021
+#define BSLS_MACROINCREMENTED_VALUE1021 1022
+#define BSLS_MACROINCREMENTED_VALUE1022 1023
+#define BSLS_MACROINCREMENTED_VALUE1023 1024
+#define BSLS_MACROINCREMENTED_VALUE1024 1025
+#define BSLS_MACROINCREMENTED_VALUE1025 1026
+#define BSLS_MACROINCREMENTED_VALUE1026 1027
+#define BSLS_MACROINCREMENTED_VALUE1027 1028
+#define BSLS_MACROINCREMENTED_VALUE1028 1029
+#define BSLS_MACROINCREMENTED_VALUE1029 1030
+#define BSLS_MACROINCREMENTED_VALUE1030 1031
+#define BSLS_MACROINCREMENTED_VALUE1031 1032
+#define BSLS_MACROINCREMENTED_VALUE1032 1033
+#define BSLS_MACROINCREMENTED_VALUE1033 1034
+#define BSLS_MACROINCREMENTED_VALUE1034 1035
+#define BSLS_MACROINCREMENTED_VALUE1035 1036
+#define BSLS_MACROINCREMENTED_VALUE1036 1037
+#define BSLS_MACROINCREMENTED_VALUE1037 1038
+#define BSLS_MACROINCREMENTED_VALUE1038 1039
+#define BSLS_MACROINCREMENTED_VALUE1039 1040
+#define BSLS_MACROINCREMENTED_VALUE1040 1041
+#define BSLS_MACROINCREMENTED_VALUE1041 1042
+#define BSLS_MACROINCREMENTED_VALUE1042 1043
+#define BSLS_MACROINCREMENTED_VALUE1043 1044
+#define BSLS_MACROINCREMENTED_VALUE1044 1045
+#define BSLS_MACROINCREMENTED_VALUE1045 1046
+#define BSLS_MACROINCREMENTED_VALUE1046 1047
+#define BSLS_MACROINCREMENTED_VALUE1047 1048
+#define BSLS_MACROINCREMENTED_VALUE1048 1049
+#define BSLS_MACROINCREMENTED_VALUE1049 1050
+#define BSLS_MACROINCREMENTED_VALUE1050 1051
+#define BSLS_MACROINCREMENTED_VALUE1051 1052
+#define BSLS_MACROINCREMENTED_VALUE1052 1053
+#define BSLS_MACROINCREMENTED_VALUE1053 1054
+#define BSLS_MACROINCREMENTED_VALUE1054 1055
+#define BSLS_MACROINCREMENTED_VALUE1055 1056
+#define BSLS_MACROINCREMENTED_VALUE1056 1057
+#define BSLS_MACROINCREMENTED_VALUE1057 1058
+#define BSLS_MACROINCREMENTED_VALUE1058 1059
+#define BSLS_MACROINCREMENTED_VALUE1059 1060
+#define BSLS_MACROINCREMENTED_VALUE1060 1061
+#define BSLS_MACROINCREMENTED_VALUE1061 1062
+#define BSLS_MACROINCREMENTED_VALUE1062 1063
+#define BSLS_MACROINCREMENTED_VALUE1063 1064
+#define BSLS_MACROINCREMENTED_VALUE1064 1065
+#define BSLS_MACROINCREMENTED_VALUE1065 1066
+#define BSLS_MACROINCREMENTED_VALUE1066 1067
+#define BSLS_MACROINCREMENTED_VALUE1067 1068
+#define BSLS_MACROINCREMENTED_VALUE1068 1069
+#define BSLS_MACROINCREMENTED_VALUE1069 1070
+#define BSLS_MACROINCREMENTED_VALUE1070 1071
+#define BSLS_MACROINCREMENTED_VALUE1071 1072
+#define BSLS_MACROINCREMENTED_VALUE1072 1073
+#define BSLS_MACROINCREMENTED_VALUE1073 1074
+#define BSLS_MACROINCREMENTED_VALUE1074 1075
+#define BSLS_MACROINCREMENTED_VALUE1075 1076
+#define BSLS_MACROINCREMENTED_VALUE1076 1077
+#define BSLS_MACROINCREMENTED_VALUE1077 1078
+#define BSLS_MACROINCREMENTED_VALUE1078 1079
+#define BSLS_MACROINCREMENTED_VALUE1079 1080
+#define BSLS_MACROINCREMENTED_VALUE1080 1081
+#define BSLS_MACROINCREMENTED_VALUE1081 1082
+#define BSLS_MACROINCREMENTED_VALUE1082 1083
+#define BSLS_MACROINCREMENTED_VALUE1083 1084
+#define BSLS_MACROINCREMENTED_VALUE1084 1085
+#define BSLS_MACROINCREMENTED_VALUE1085 1086
+#define BSLS_MACROINCREMENTED_VALUE1086 1087
+#define BSLS_MACROINCREMENTED_VALUE1087 1088
+#define BSLS_MACROINCREMENTED_VALUE1088 1089
+#define BSLS_MACROINCREMENTED_VALUE1089 1090
+#define BSLS_MACROINCREMENTED_VALUE1090 1091
+#define BSLS_MACROINCREMENTED_VALUE1091 1092
+#define BSLS_MACROINCREMENTED_VALUE1092 1093
+#define BSLS_MACROINCREMENTED_VALUE1093 1094
+#define BSLS_MACROINCREMENTED_VALUE1094 1095
+#define BSLS_MACROINCREMENTED_VALUE1095 1096
+#define BSLS_MACROINCREMENTED_VALUE1096 1097
+#define BSLS_MACROINCREMENTED_VALUE1097 1098
+#define BSLS_MACROINCREMENTED_VALUE1098 1099
+#define BSLS_MACROINCREMENTED_VALUE1099 1100
+#define BSLS_MACROINCREMENTED_VALUE1100 1101
+#define BSLS_MACROINCREMENTED_VALUE1101 1102
+#define BSLS_MACROINCREMENTED_VALUE1102 1103
+#define BSLS_MACROINCREMENTED_VALUE1103 1104
+#define BSLS_MACROINCREMENTED_VALUE1104 1105
+#define BSLS_MACROINCREMENTED_VALUE1105 1106
+#define BSLS_MACROINCREMENTED_VALUE1106 1107
+#define BSLS_MACROINCREMENTED_VALUE1107 1108
+#define BSLS_MACROINCREMENTED_VALUE1108 1109
+#define BSLS_MACROINCREMENTED_VALUE1109 1110
+#define BSLS_MACROINCREMENTED_VALUE1110 1111
+#define BSLS_MACROINCREMENTED_VALUE1111 1112
+#define BSLS_MACROINCREMENTED_VALUE1112 1113
+#define BSLS_MACROINCREMENTED_VALUE1113 1114
+#define BSLS_MACROINCREMENTED_VALUE1114 1115
+#define BSLS_MACROINCREMENTED_VALUE1115 1116
+#define BSLS_MACROINCREMENTED_VALUE1116 1117
+#define BSLS_MACROINCREMENTED_VALUE1117 1118
+#define BSLS_MACROINCREMENTED_VALUE1118 1119
+#define BSLS_MACROINCREMENTED_VALUE1119 1120
+#define BSLS_MACROINCREMENTED_VALUE1120 1121
+#define BSLS_MACROINCREMENTED_VALUE1121 1122
+#define BSLS_MACROINCREMENTED_VALUE1122 1123
+#define BSLS_MACROINCREMENTED_VALUE1123 1124
+#define BSLS_MACROINCREMENTED_VALUE1124 1125
+#define BSLS_MACROINCREMENTED_VALUE1125 1126
+#define BSLS_MACROINCREMENTED_VALUE1126 1127
+#define BSLS_MACROINCREMENTED_VALUE1127 1128
+#define BSLS_MACROINCREMENTED_VALUE1128 1129
+#define BSLS_MACROINCREMENTED_VALUE1129 1130
+#define BSLS_MACROINCREMENTED_VALUE1130 1131
+#define BSLS_MACROINCREMENTED_VALUE1131 1132
+#define BSLS_MACROINCREMENTED_VALUE1132 1133
+#define BSLS_MACROINCREMENTED_VALUE1133 1134
+#define BSLS_MACROINCREMENTED_VALUE1134 1135
+#define BSLS_MACROINCREMENTED_VALUE1135 1136
+#define BSLS_MACROINCREMENTED_VALUE1136 1137
+#define BSLS_MACROINCREMENTED_VALUE1137 1138
+#define BSLS_MACROINCREMENTED_VALUE1138 1139
+#define BSLS_MACROINCREMENTED_VALUE1139 1140
+#define BSLS_MACROINCREMENTED_VALUE1140 1141
+#define BSLS_MACROINCREMENTED_VALUE1141 1142
+#define BSLS_MACROINCREMENTED_VALUE1142 1143
+#define BSLS_MACROINCREMENTED_VALUE1143 1144
+#define BSLS_MACROINCREMENTED_VALUE1144 1145
+#define BSLS_MACROINCREMENTED_VALUE1145 1146
+#define BSLS_MACROINCREMENTED_VALUE1146 1147
+#define BSLS_MACROINCREMENTED_VALUE1147 1148
+#define BSLS_MACROINCREMENTED_VALUE1148 1149
+#define BSLS_MACROINCREMENTED_VALUE1149 1150
+#define BSLS_MACROINCREMENTED_VALUE1150 1151
+#define BSLS_MACROINCREMENTED_VALUE1151 1152
+#define BSLS_MACROINCREMENTED_VALUE1152 1153
+#define BSLS_MACROINCREMENTED_VALUE1153 1154
+#define BSLS_MACROINCREMENTED_VALUE1154 1155
+#define BSLS_MACROINCREMENTED_VALUE1155 1156
+#define BSLS_MACROINCREMENTED_VALUE1156 1157
+#define BSLS_MACROINCREMENTED_VALUE1157 1158
+#define BSLS_MACROINCREMENTED_VALUE1158 1159
+#define BSLS_MACROINCREMENTED_VALUE1159 1160
+#define BSLS_MACROINCREMENTED_VALUE1160 1161
+#define BSLS_MACROINCREMENTED_VALUE1161 1162
+#define BSLS_MACROINCREMENTED_VALUE1162 1163
+#define BSLS_MACROINCREMENTED_VALUE1163 1164
+#define BSLS_MACROINCREMENTED_VALUE1164 1165
+#define BSLS_MACROINCREMENTED_VALUE1165 1166
+#define BSLS_MACROINCREMENTED_VALUE1166 1167
+#define BSLS_MACROINCREMENTED_VALUE1167 1168
+#define BSLS_MACROINCREMENTED_VALUE1168 1169
+#define BSLS_MACROINCREMENTED_VALUE1169 1170
+#define BSLS_MACROINCREMENTED_VALUE1170 1171
+#define BSLS_MACROINCREMENTED_VALUE1171 1172
+#define BSLS_MACROINCREMENTED_VALUE1172 1173
+#define BSLS_MACROINCREMENTED_VALUE1173 1174
+#define BSLS_MACROINCREMENTED_VALUE1174 1175
+#define BSLS_MACROINCREMENTED_VALUE1175 1176
+#define BSLS_MACROINCREMENTED_VALUE1176 1177
+#define BSLS_MACROINCREMENTED_VALUE1177 1178
+#define BSLS_MACROINCREMENTED_VALUE1178 1179
+#define BSLS_MACROINCREMENTED_VALUE1179 1180
+#define BSLS_MACROINCREMENTED_VALUE1180 1181
+#define BSLS_MACROINCREMENTED_VALUE1181 1182
+#define BSLS_MACROINCREMENTED_VALUE1182 1183
+#define BSLS_MACROINCREMENTED_VALUE1183 1184
+#define BSLS_MACROINCREMENTED_VALUE1184 1185
+#define BSLS_MACROINCREMENTED_VALUE1185 1186
+#define BSLS_MACROINCREMENTED_VALUE1186 1187
+#define BSLS_MACROINCREMENTED_VALUE1187 1188
+#define BSLS_MACROINCREMENTED_VALUE1188 1189
+#define BSLS_MACROINCREMENTED_VALUE1189 1190
+#define BSLS_MACROINCREMENTED_VALUE1190 1191
+#define BSLS_MACROINCREMENTED_VALUE1191 1192
+#define BSLS_MACROINCREMENTED_VALUE1192 1193
+#define BSLS_MACROINCREMENTED_VALUE1193 1194
+#define BSLS_MACROINCREMENTED_VALUE1194 1195
+#define BSLS_MACROINCREMENTED_VALUE1195 1196
+#define BSLS_MACROINCREMENTED_VALUE1196 1197
+#define BSLS_MACROINCREMENTED_VALUE1197 1198
+#define BSLS_MACROINCREMENTED_VALUE1198 1199
+#define BSLS_MACROINCREMENTED_VALUE1199 1200
+#define BSLS_MACROINCREMENTED_VALUE1200 1201
+#define BSLS_MACROINCREMENTED_VALUE1201 1202
+#define BSLS_MACROINCREMENTED_VALUE1202 1203
+#define BSLS_MACROINCREMENTED_VALUE1203 1204
+#define BSLS_MACROINCREMENTED_VALUE1204 1205
+#define BSLS_MACROINCREMENTED_VALUE1205 1206
+#define BSLS_MACROINCREMENTED_VALUE1206 1207
+#define BSLS_MACROINCREMENTED_VALUE1207 1208
+#define BSLS_MACROINCREMENTED_VALUE1208 1209
+#define BSLS_MACROINCREMENTED_VALUE1209 1210
+#define BSLS_MACROINCREMENTED_VALUE1210 1211
+#define BSLS_MACROINCREMENTED_VALUE1211 1212
+#define BSLS_MACROINCREMENTED_VALUE1212 1213
+#define BSLS_MACROINCREMENTED_VALUE1213 1214
+#define BSLS_MACROINCREMENTED_VALUE1214 1215
+#define BSLS_MACROINCREMENTED_VALUE1215 1216
+#define BSLS_MACROINCREMENTED_VALUE1216 1217
+#define BSLS_MACROINCREMENTED_VALUE1217 1218
+#define BSLS_MACROINCREMENTED_VALUE1218 1219
+#define BSLS_MACROINCREMENTED_VALUE1219 1220
+#define BSLS_MACROINCREMENTED_VALUE1220 1221
+#define BSLS_MACROINCREMENTED_VALUE1221 1222
+#define BSLS_MACROINCREMENTED_VALUE1222 1223
+#define BSLS_MACROINCREMENTED_VALUE1223 1224
+#define BSLS_MACROINCREMENTED_VALUE1224 1225
+#define BSLS_MACROINCREMENTED_VALUE1225 1226
+#define BSLS_MACROINCREMENTED_VALUE1226 1227
+#define BSLS_MACROINCREMENTED_VALUE1227 1228
+#define BSLS_MACROINCREMENTED_VALUE1228 1229
+#define BSLS_MACROINCREMENTED_VALUE1229 1230
+#define BSLS_MACROINCREMENTED_VALUE1230 1231
+#define BSLS_MACROINCREMENTED_VALUE1231 1232
+#define BSLS_MACROINCREMENTED_VALUE1232 1233
+#define BSLS_MACROINCREMENTED_VALUE1233 1234
+#define BSLS_MACROINCREMENTED_VALUE1234 1235
+#define BSLS_MACROINCREMENTED_VALUE1235 1236
+#define BSLS_MACROINCREMENTED_VALUE1236 1237
+#define BSLS_MACROINCREMENTED_VALUE1237 1238
+#define BSLS_MACROINCREMENTED_VALUE1238 1239
+#define BSLS_MACROINCREMENTED_VALUE1239 1240
+#define BSLS_MACROINCREMENTED_VALUE1240 1241
+#define BSLS_MACROINCREMENTED_VALUE1241 1242
+#define BSLS_MACROINCREMENTED_VALUE1242 1243
+#define BSLS_MACROINCREMENTED_VALUE1243 1244
+#define BSLS_MACROINCREMENTED_VALUE1244 1245
+#define BSLS_MACROINCREMENTED_VALUE1245 1246
+#define BSLS_MACROINCREMENTED_VALUE1246 1247
+#define BSLS_MACROINCREMENTED_VALUE1247 1248
+#define BSLS_MACROINCREMENTED_VALUE1248 1249
+#define BSLS_MACROINCREMENTED_VALUE1249 1250
+#define BSLS_MACROINCREMENTED_VALUE1250 1251
+#define BSLS_MACROINCREMENTED_VALUE1251 1252
+#define BSLS_MACROINCREMENTED_VALUE1252 1253
+#define BSLS_MACROINCREMENTED_VALUE1253 1254
+#define BSLS_MACROINCREMENTED_VALUE1254 1255
+#define BSLS_MACROINCREMENTED_VALUE1255 1256
+#define BSLS_MACROINCREMENTED_VALUE1256 1257
+#define BSLS_MACROINCREMENTED_VALUE1257 1258
+#define BSLS_MACROINCREMENTED_VALUE1258 1259
+#define BSLS_MACROINCREMENTED_VALUE1259 1260
+#define BSLS_MACROINCREMENTED_VALUE1260 1261
+#define BSLS_MACROINCREMENTED_VALUE1261 1262
+#define BSLS_MACROINCREMENTED_VALUE1262 1263
+#define BSLS_MACROINCREMENTED_VALUE1263 1264
+#define BSLS_MACROINCREMENTED_VALUE1264 1265
+#define BSLS_MACROINCREMENTED_VALUE1265 1266
+#define BSLS_MACROINCREMENTED_VALUE1266 1267
+#define BSLS_MACROINCREMENTED_VALUE1267 1268
+#define BSLS_MACROINCREMENTED_VALUE1268 1269
+#define BSLS_MACROINCREMENTED_VALUE1269 1270
+#define BSLS_MACROINCREMENTED_VALUE1270 1271
+#define BSLS_MACROINCREMENTED_VALUE1271 1272
+#define BSLS_MACROINCREMENTED_VALUE1272 1273
+#define BSLS_MACROINCREMENTED_VALUE1273 1274
+#define BSLS_MACROINCREMENTED_VALUE1274 1275
+#define BSLS_MACROINCREMENTED_VALUE1275 1276
+#define BSLS_MACROINCREMENTED_VALUE1276 1277
+#define BSLS_MACROINCREMENTED_VALUE1277 1278
+#define BSLS_MACROINCREMENTED_VALUE1278 1279
+#define BSLS_MACROINCREMENTED_VALUE1279 1280
+#define BSLS_MACROINCREMENTED_VALUE1280 1281
+#define BSLS_MACROINCREMENTED_VALUE1281 1282
+#define BSLS_MACROINCREMENTED_VALUE1282 1283
+#define BSLS_MACROINCREMENTED_VALUE1283 1284
+#define BSLS_MACROINCREMENTED_VALUE1284 1285
+#define BSLS_MACROINCREMENTED_VALUE1285 1286
+#define BSLS_MACROINCREMENTED_VALUE1286 1287
+#define BSLS_MACROINCREMENTED_VALUE1287 1288
+#define BSLS_MACROINCREMENTED_VALUE1288 1289
+#define BSLS_MACROINCREMENTED_VALUE1289 1290
+#define BSLS_MACROINCREMENTED_VALUE1290 1291
+#define BSLS_MACROINCREMENTED_VALUE1291 1292
+#define BSLS_MACROINCREMENTED_VALUE1292 1293
+#define BSLS_MACROINCREMENTED_VALUE1293 1294
+#define BSLS_MACROINCREMENTED_VALUE1294 1295
+#define BSLS_MACROINCREMENTED_VALUE1295 1296
+#define BSLS_MACROINCREMENTED_VALUE1296 1297
+#define BSLS_MACROINCREMENTED_VALUE1297 1298
+#define BSLS_MACROINCREMENTED_VALUE1298 1299
+#define BSLS_MACROINCREMENTED_VALUE1299 1300
+#define BSLS_MACROINCREMENTED_VALUE1300 1301
+#define BSLS_MACROINCREMENTED_VALUE1301 1302
+#define BSLS_MACROINCREMENTED_VALUE1302 1303
+#define BSLS_MACROINCREMENTED_VALUE1303 1304
+#define BSLS_MACROINCREMENTED_VALUE1304 1305
+#define BSLS_MACROINCREMENTED_VALUE1305 1306
+#define BSLS_MACROINCREMENTED_VALUE1306 1307
+#define BSLS_MACROINCREMENTED_VALUE1307 1308
+#define BSLS_MACROINCREMENTED_VALUE1308 1309
+#define BSLS_MACROINCREMENTED_VALUE1309 1310
+#define BSLS_MACROINCREMENTED_VALUE1310 1311
+#define BSLS_MACROINCREMENTED_VALUE1311 1312
+#define BSLS_MACROINCREMENTED_VALUE1312 1313
+#define BSLS_MACROINCREMENTED_VALUE1313 1314
+#define BSLS_MACROINCREMENTED_VALUE1314 1315
+#define BSLS_MACROINCREMENTED_VALUE1315 1316
+#define BSLS_MACROINCREMENTED_VALUE1316 1317
+#define BSLS_MACROINCREMENTED_VALUE1317 1318
+#define BSLS_MACROINCREMENTED_VALUE1318 1319
+#define BSLS_MACROINCREMENTED_VALUE1319 1320
+#define BSLS_MACROINCREMENTED_VALUE1320 1321
+#define BSLS_MACROINCREMENTED_VALUE1321 1322
+#define BSLS_MACROINCREMENTED_VALUE1322 1323
+#define BSLS_MACROINCREMENTED_VALUE1323 1324
+#define BSLS_MACROINCREMENTED_VALUE1324 1325
+#define BSLS_MACROINCREMENTED_VALUE1325 1326
+#define BSLS_MACROINCREMENTED_VALUE1326 1327
+#define BSLS_MACROINCREMENTED_VALUE1327 1328
+#define BSLS_MACROINCREMENTED_VALUE1328 1329
+#define BSLS_MACROINCREMENTED_VALUE1329 1330
+#define BSLS_MACROINCREMENTED_VALUE1330 1331
+#define BSLS_MACROINCREMENTED_VALUE1331 1332
+#define BSLS_MACROINCREMENTED_VALUE1332 1333
+#define BSLS_MACROINCREMENTED_VALUE1333 1334
+#define BSLS_MACROINCREMENTED_VALUE1334 1335
+#define BSLS_MACROINCREMENTED_VALUE1335 1336
+#define BSLS_MACROINCREMENTED_VALUE1336 1337
+#define BSLS_MACROINCREMENTED_VALUE1337 1338
+#define BSLS_MACROINCREMENTED_VALUE1338 1339
+#define BSLS_MACROINCREMENTED_VALUE1339 1340
+#define BSLS_MACROINCREMENTED_VALUE1340 1341
+#define BSLS_MACROINCREMENTED_VALUE1341 1342
+#define BSLS_MACROINCREMENTED_VALUE1342 1343
+#define BSLS_MACROINCREMENTED_VALUE1343 1344
+#define BSLS_MACROINCREMENTED_VALUE1344 1345
+#define BSLS_MACROINCREMENTED_VALUE1345 1346
+#define BSLS_MACROINCREMENTED_VALUE1346 1347
+#define BSLS_MACROINCREMENTED_VALUE1347 1348
+#define BSLS_MACROINCREMENTED_VALUE1348 1349
+#define BSLS_MACROINCREMENTED_VALUE1349 1350
+#define BSLS_MACROINCREMENTED_VALUE1350 1351
+#define BSLS_MACROINCREMENTED_VALUE1351 1352
+#define BSLS_MACROINCREMENTED_VALUE1352 1353
+#define BSLS_MACROINCREMENTED_VALUE1353 1354
+#define BSLS_MACROINCREMENTED_VALUE1354 1355
+#define BSLS_MACROINCREMENTED_VALUE1355 1356
+#define BSLS_MACROINCREMENTED_VALUE1356 1357
+#define BSLS_MACROINCREMENTED_VALUE1357 1358
+#define BSLS_MACROINCREMENTED_VALUE1358 1359
+#define BSLS_MACROINCREMENTED_VALUE1359 1360
+#define BSLS_MACROINCREMENTED_VALUE1360 1361
+#define BSLS_MACROINCREMENTED_VALUE1361 1362
+#define BSLS_MACROINCREMENTED_VALUE1362 1363
+#define BSLS_MACROINCREMENTED_VALUE1363 1364
+#define BSLS_MACROINCREMENTED_VALUE1364 1365
+#define BSLS_MACROINCREMENTED_VALUE1365 1366
+#define BSLS_MACROINCREMENTED_VALUE1366 1367
+#define BSLS_MACROINCREMENTED_VALUE1367 1368
+#define BSLS_MACROINCREMENTED_VALUE1368 1369
+#define BSLS_MACROINCREMENTED_VALUE1369 1370
+#define BSLS_MACROINCREMENTED_VALUE1370 1371
+#define BSLS_MACROINCREMENTED_VALUE1371 1372
+#define BSLS_MACROINCREMENTED_VALUE1372 1373
+#define BSLS_MACROINCREMENTED_VALUE1373 1374
+#define BSLS_MACROINCREMENTED_VALUE1374 1375
+#define BSLS_MACROINCREMENTED_VALUE1375 1376
+#define BSLS_MACROINCREMENTED_VALUE1376 1377
+#define BSLS_MACROINCREMENTED_VALUE1377 1378
+#define BSLS_MACROINCREMENTED_VALUE1378 1379
+#define BSLS_MACROINCREMENTED_VALUE1379 1380
+#define BSLS_MACROINCREMENTED_VALUE1380 1381
+#define BSLS_MACROINCREMENTED_VALUE1381 1382
+#define BSLS_MACROINCREMENTED_VALUE1382 1383
+#define BSLS_MACROINCREMENTED_VALUE1383 1384
+#define BSLS_MACROINCREMENTED_VALUE1384 1385
+#define BSLS_MACROINCREMENTED_VALUE1385 1386
+#define BSLS_MACROINCREMENTED_VALUE1386 1387
+#define BSLS_MACROINCREMENTED_VALUE1387 1388
+#define BSLS_MACROINCREMENTED_VALUE1388 1389
+#define BSLS_MACROINCREMENTED_VALUE1389 1390
+#define BSLS_MACROINCREMENTED_VALUE1390 1391
+#define BSLS_MACROINCREMENTED_VALUE1391 1392
+#define BSLS_MACROINCREMENTED_VALUE1392 1393
+#define BSLS_MACROINCREMENTED_VALUE1393 1394
+#define BSLS_MACROINCREMENTED_VALUE1394 1395
+#define BSLS_MACROINCREMENTED_VALUE1395 1396
+#define BSLS_MACROINCREMENTED_VALUE1396 1397
+#define BSLS_MACROINCREMENTED_VALUE1397 1398
+#define BSLS_MACROINCREMENTED_VALUE1398 1399
+#define BSLS_MACROINCREMENTED_VALUE1399 1400
+#define BSLS_MACROINCREMENTED_VALUE1400 1401
+#define BSLS_MACROINCREMENTED_VALUE1401 1402
+#define BSLS_MACROINCREMENTED_VALUE1402 1403
+#define BSLS_MACROINCREMENTED_VALUE1403 1404
+#define BSLS_MACROINCREMENTED_VALUE1404 1405
+#define BSLS_MACROINCREMENTED_VALUE1405 1406
+#define BSLS_MACROINCREMENTED_VALUE1406 1407
+#define BSLS_MACROINCREMENTED_VALUE1407 1408
+#define BSLS_MACROINCREMENTED_VALUE1408 1409
+#define BSLS_MACROINCREMENTED_VALUE1409 1410
+#define BSLS_MACROINCREMENTED_VALUE1410 1411
+#define BSLS_MACROINCREMENTED_VALUE1411 1412
+#define BSLS_MACROINCREMENTED_VALUE1412 1413
+#define BSLS_MACROINCREMENTED_VALUE1413 1414
+#define BSLS_MACROINCREMENTED_VALUE1414 1415
+#define BSLS_MACROINCREMENTED_VALUE1415 1416
+#define BSLS_MACROINCREMENTED_VALUE1416 1417
+#define BSLS_MACROINCREMENTED_VALUE1417 1418
+#define BSLS_MACROINCREMENTED_VALUE1418 1419
+#define BSLS_MACROINCREMENTED_VALUE1419 1420
+#define BSLS_MACROINCREMENTED_VALUE1420 1421
+#define BSLS_MACROINCREMENTED_VALUE1421 1422
+#define BSLS_MACROINCREMENTED_VALUE1422 1423
+#define BSLS_MACROINCREMENTED_VALUE1423 1424
+#define BSLS_MACROINCREMENTED_VALUE1424 1425
+#define BSLS_MACROINCREMENTED_VALUE1425 1426
+#define BSLS_MACROINCREMENTED_VALUE1426 1427
+#define BSLS_MACROINCREMENTED_VALUE1427 1428
+#define BSLS_MACROINCREMENTED_VALUE1428 1429
+#define BSLS_MACROINCREMENTED_VALUE1429 1430
+#define BSLS_MACROINCREMENTED_VALUE1430 1431
+#define BSLS_MACROINCREMENTED_VALUE1431 1432
+#define BSLS_MACROINCREMENTED_VALUE1432 1433
+#define BSLS_MACROINCREMENTED_VALUE1433 1434
+#define BSLS_MACROINCREMENTED_VALUE1434 1435
+#define BSLS_MACROINCREMENTED_VALUE1435 1436
+#define BSLS_MACROINCREMENTED_VALUE1436 1437
+#define BSLS_MACROINCREMENTED_VALUE1437 1438
+#define BSLS_MACROINCREMENTED_VALUE1438 1439
+#define BSLS_MACROINCREMENTED_VALUE1439 1440
+#define BSLS_MACROINCREMENTED_VALUE1440 1441
+#define BSLS_MACROINCREMENTED_VALUE1441 1442
+#define BSLS_MACROINCREMENTED_VALUE1442 1443
+#define BSLS_MACROINCREMENTED_VALUE1443 1444
+#define BSLS_MACROINCREMENTED_VALUE1444 1445
+#define BSLS_MACROINCREMENTED_VALUE1445 1446
+#define BSLS_MACROINCREMENTED_VALUE1446 1447
+#define BSLS_MACROINCREMENTED_VALUE1447 1448
+#define BSLS_MACROINCREMENTED_VALUE1448 1449
+#define BSLS_MACROINCREMENTED_VALUE1449 1450
+#define BSLS_MACROINCREMENTED_VALUE1450 1451
+#define BSLS_MACROINCREMENTED_VALUE1451 1452
+#define BSLS_MACROINCREMENTED_VALUE1452 1453
+#define BSLS_MACROINCREMENTED_VALUE1453 1454
+#define BSLS_MACROINCREMENTED_VALUE1454 1455
+#define BSLS_MACROINCREMENTED_VALUE1455 1456
+#define BSLS_MACROINCREMENTED_VALUE1456 1457
+#define BSLS_MACROINCREMENTED_VALUE1457 1458
+#define BSLS_MACROINCREMENTED_VALUE1458 1459
+#define BSLS_MACROINCREMENTED_VALUE1459 1460
+#define BSLS_MACROINCREMENTED_VALUE1460 1461
+#define BSLS_MACROINCREMENTED_VALUE1461 1462
+#define BSLS_MACROINCREMENTED_VALUE1462 1463
+#define BSLS_MACROINCREMENTED_VALUE1463 1464
+#define BSLS_MACROINCREMENTED_VALUE1464 1465
+#define BSLS_MACROINCREMENTED_VALUE1465 1466
+#define BSLS_MACROINCREMENTED_VALUE1466 1467
+#define BSLS_MACROINCREMENTED_VALUE1467 1468
+#define BSLS_MACROINCREMENTED_VALUE1468 1469
+#define BSLS_MACROINCREMENTED_VALUE1469 1470
+#define BSLS_MACROINCREMENTED_VALUE1470 1471
+#define BSLS_MACROINCREMENTED_VALUE1471 1472
+#define BSLS_MACROINCREMENTED_VALUE1472 1473
+#define BSLS_MACROINCREMENTED_VALUE1473 1474
+#define BSLS_MACROINCREMENTED_VALUE1474 1475
+#define BSLS_MACROINCREMENTED_VALUE1475 1476
+#define BSLS_MACROINCREMENTED_VALUE1476 1477
+#define BSLS_MACROINCREMENTED_VALUE1477 1478
+#define BSLS_MACROINCREMENTED_VALUE1478 1479
+#define BSLS_MACROINCREMENTED_VALUE1479 1480
+#define BSLS_MACROINCREMENTED_VALUE1480 1481
+#define BSLS_MACROINCREMENTED_VALUE1481 1482
+#define BSLS_MACROINCREMENTED_VALUE1482 1483
+#define BSLS_MACROINCREMENTED_VALUE1483 1484
+#define BSLS_MACROINCREMENTED_VALUE1484 1485
+#define BSLS_MACROINCREMENTED_VALUE1485 1486
+#define BSLS_MACROINCREMENTED_VALUE1486 1487
+#define BSLS_MACROINCREMENTED_VALUE1487 1488
+#define BSLS_MACROINCREMENTED_VALUE1488 1489
+#define BSLS_MACROINCREMENTED_VALUE1489 1490
+#define BSLS_MACROINCREMENTED_VALUE1490 1491
+#define BSLS_MACROINCREMENTED_VALUE1491 1492
+#define BSLS_MACROINCREMENTED_VALUE1492 1493
+#define BSLS_MACROINCREMENTED_VALUE1493 1494
+#define BSLS_MACROINCREMENTED_VALUE1494 1495
+#define BSLS_MACROINCREMENTED_VALUE1495 1496
+#define BSLS_MACROINCREMENTED_VALUE1496 1497
+#define BSLS_MACROINCREMENTED_VALUE1497 1498
+#define BSLS_MACROINCREMENTED_VALUE1498 1499
+#define BSLS_MACROINCREMENTED_VALUE1499 1500
+#define BSLS_MACROINCREMENTED_VALUE1500 1501
+#define BSLS_MACROINCREMENTED_VALUE1501 1502
+#define BSLS_MACROINCREMENTED_VALUE1502 1503
+#define BSLS_MACROINCREMENTED_VALUE1503 1504
+#define BSLS_MACROINCREMENTED_VALUE1504 1505
+#define BSLS_MACROINCREMENTED_VALUE1505 1506
+#define BSLS_MACROINCREMENTED_VALUE1506 1507
+#define BSLS_MACROINCREMENTED_VALUE1507 1508
+#define BSLS_MACROINCREMENTED_VALUE1508 1509
+#define BSLS_MACROINCREMENTED_VALUE1509 1510
+#define BSLS_MACROINCREMENTED_VALUE1510 1511
+#define BSLS_MACROINCREMENTED_VALUE1511 1512
+#define BSLS_MACROINCREMENTED_VALUE1512 1513
+#define BSLS_MACROINCREMENTED_VALUE1513 1514
+#define BSLS_MACROINCREMENTED_VALUE1514 1515
+#define BSLS_MACROINCREMENTED_VALUE1515 1516
+#define BSLS_MACROINCREMENTED_VALUE1516 1517
+#define BSLS_MACROINCREMENTED_VALUE1517 1518
+#define BSLS_MACROINCREMENTED_VALUE1518 1519
+#define BSLS_MACROINCREMENTED_VALUE1519 1520
+#define BSLS_MACROINCREMENTED_VALUE1520 1521
+#define BSLS_MACROINCREMENTED_VALUE1521 1522
+#define BSLS_MACROINCREMENTED_VALUE1522 1523
+#define BSLS_MACROINCREMENTED_VALUE1523 1524
+#define BSLS_MACROINCREMENTED_VALUE1524 1525
+#define BSLS_MACROINCREMENTED_VALUE1525 1526
+#define BSLS_MACROINCREMENTED_VALUE1526 1527
+#define BSLS_MACROINCREMENTED_VALUE1527 1528
+#define BSLS_MACROINCREMENTED_VALUE1528 1529
+#define BSLS_MACROINCREMENTED_VALUE1529 1530
+#define BSLS_MACROINCREMENTED_VALUE1530 1531
+#define BSLS_MACROINCREMENTED_VALUE1531 1532
+#define BSLS_MACROINCREMENTED_VALUE1532 1533
+#define BSLS_MACROINCREMENTED_VALUE1533 1534
+#define BSLS_MACROINCREMENTED_VALUE1534 1535
+#define BSLS_MACROINCREMENTED_VALUE1535 1536
+#define BSLS_MACROINCREMENTED_VALUE1536 1537
+#define BSLS_MACROINCREMENTED_VALUE1537 1538
+#define BSLS_MACROINCREMENTED_VALUE1538 1539
+#define BSLS_MACROINCREMENTED_VALUE1539 1540
+#define BSLS_MACROINCREMENTED_VALUE1540 1541
+#define BSLS_MACROINCREMENTED_VALUE1541 1542
+#define BSLS_MACROINCREMENTED_VALUE1542 1543
+#define BSLS_MACROINCREMENTED_VALUE1543 1544
+#define BSLS_MACROINCREMENTED_VALUE1544 1545
+#define BSLS_MACROINCREMENTED_VALUE1545 1546
+#define BSLS_MACROINCREMENTED_VALUE1546 1547
+#define BSLS_MACROINCREMENTED_VALUE1547 1548
+#define BSLS_MACROINCREMENTED_VALUE1548 1549
+#define BSLS_MACROINCREMENTED_VALUE1549 1550
+#define BSLS_MACROINCREMENTED_VALUE1550 1551
+#define BSLS_MACROINCREMENTED_VALUE1551 1552
+#define BSLS_MACROINCREMENTED_VALUE1552 1553
+#define BSLS_MACROINCREMENTED_VALUE1553 1554
+#define BSLS_MACROINCREMENTED_VALUE1554 1555
+#define BSLS_MACROINCREMENTED_VALUE1555 1556
+#define BSLS_MACROINCREMENTED_VALUE1556 1557
+#define BSLS_MACROINCREMENTED_VALUE1557 1558
+#define BSLS_MACROINCREMENTED_VALUE1558 1559
+#define BSLS_MACROINCREMENTED_VALUE1559 1560
+#define BSLS_MACROINCREMENTED_VALUE1560 1561
+#define BSLS_MACROINCREMENTED_VALUE1561 1562
+#define BSLS_MACROINCREMENTED_VALUE1562 1563
+#define BSLS_MACROINCREMENTED_VALUE1563 1564
+#define BSLS_MACROINCREMENTED_VALUE1564 1565
+#define BSLS_MACROINCREMENTED_VALUE1565 1566
+#define BSLS_MACROINCREMENTED_VALUE1566 1567
+#define BSLS_MACROINCREMENTED_VALUE1567 1568
+#define BSLS_MACROINCREMENTED_VALUE1568 1569
+#define BSLS_MACROINCREMENTED_VALUE1569 1570
+#define BSLS_MACROINCREMENTED_VALUE1570 1571
+#define BSLS_MACROINCREMENTED_VALUE1571 1572
+#define BSLS_MACROINCREMENTED_VALUE1572 1573
+#define BSLS_MACROINCREMENTED_VALUE1573 1574
+#define BSLS_MACROINCREMENTED_VALUE1574 1575
+#define BSLS_MACROINCREMENTED_VALUE1575 1576
+#define BSLS_MACROINCREMENTED_VALUE1576 1577
+#define BSLS_MACROINCREMENTED_VALUE1577 1578
+#define BSLS_MACROINCREMENTED_VALUE1578 1579
+#define BSLS_MACROINCREMENTED_VALUE1579 1580
+#define BSLS_MACROINCREMENTED_VALUE1580 1581
+#define BSLS_MACROINCREMENTED_VALUE1581 1582
+#define BSLS_MACROINCREMENTED_VALUE1582 1583
+#define BSLS_MACROINCREMENTED_VALUE1583 1584
+#define BSLS_MACROINCREMENTED_VALUE1584 1585
+#define BSLS_MACROINCREMENTED_VALUE1585 1586
+#define BSLS_MACROINCREMENTED_VALUE1586 1587
+#define BSLS_MACROINCREMENTED_VALUE1587 1588
+#define BSLS_MACROINCREMENTED_VALUE1588 1589
+#define BSLS_MACROINCREMENTED_VALUE1589 1590
+#define BSLS_MACROINCREMENTED_VALUE1590 1591
+#define BSLS_MACROINCREMENTED_VALUE1591 1592
+#define BSLS_MACROINCREMENTED_VALUE1592 1593
+#define BSLS_MACROINCREMENTED_VALUE1593 1594
+#define BSLS_MACROINCREMENTED_VALUE1594 1595
+#define BSLS_MACROINCREMENTED_VALUE1595 1596
+#define BSLS_MACROINCREMENTED_VALUE1596 1597
+#define BSLS_MACROINCREMENTED_VALUE1597 1598
+#define BSLS_MACROINCREMENTED_VALUE1598 1599
+#define BSLS_MACROINCREMENTED_VALUE1599 1600
+#define BSLS_MACROINCREMENTED_VALUE1600 1601
+#define BSLS_MACROINCREMENTED_VALUE1601 1602
+#define BSLS_MACROINCREMENTED_VALUE1602 1603
+#define BSLS_MACROINCREMENTED_VALUE1603 1604
+#define BSLS_MACROINCREMENTED_VALUE1604 1605
+#define BSLS_MACROINCREMENTED_VALUE1605 1606
+#define BSLS_MACROINCREMENTED_VALUE1606 1607
+#define BSLS_MACROINCREMENTED_VALUE1607 1608
+#define BSLS_MACROINCREMENTED_VALUE1608 1609
+#define BSLS_MACROINCREMENTED_VALUE1609 1610
+#define BSLS_MACROINCREMENTED_VALUE1610 1611
+#define BSLS_MACROINCREMENTED_VALUE1611 1612
+#define BSLS_MACROINCREMENTED_VALUE1612 1613
+#define BSLS_MACROINCREMENTED_VALUE1613 1614
+#define BSLS_MACROINCREMENTED_VALUE1614 1615
+#define BSLS_MACROINCREMENTED_VALUE1615 1616
+#define BSLS_MACROINCREMENTED_VALUE1616 1617
+#define BSLS_MACROINCREMENTED_VALUE1617 1618
+#define BSLS_MACROINCREMENTED_VALUE1618 1619
+#define BSLS_MACROINCREMENTED_VALUE1619 1620
+#define BSLS_MACROINCREMENTED_VALUE1620 1621
+#define BSLS_MACROINCREMENTED_VALUE1621 1622
+#define BSLS_MACROINCREMENTED_VALUE1622 1623
+#define BSLS_MACROINCREMENTED_VALUE1623 1624
+#define BSLS_MACROINCREMENTED_VALUE1624 1625
+#define BSLS_MACROINCREMENTED_VALUE1625 1626
+#define BSLS_MACROINCREMENTED_VALUE1626 1627
+#define BSLS_MACROINCREMENTED_VALUE1627 1628
+#define BSLS_MACROINCREMENTED_VALUE1628 1629
+#define BSLS_MACROINCREMENTED_VALUE1629 1630
+#define BSLS_MACROINCREMENTED_VALUE1630 1631
+#define BSLS_MACROINCREMENTED_VALUE1631 1632
+#define BSLS_MACROINCREMENTED_VALUE1632 1633
+#define BSLS_MACROINCREMENTED_VALUE1633 1634
+#define BSLS_MACROINCREMENTED_VALUE1634 1635
+#define BSLS_MACROINCREMENTED_VALUE1635 1636
+#define BSLS_MACROINCREMENTED_VALUE1636 1637
+#define BSLS_MACROINCREMENTED_VALUE1637 1638
+#define BSLS_MACROINCREMENTED_VALUE1638 1639
+#define BSLS_MACROINCREMENTED_VALUE1639 1640
+#define BSLS_MACROINCREMENTED_VALUE1640 1641
+#define BSLS_MACROINCREMENTED_VALUE1641 1642
+#define BSLS_MACROINCREMENTED_VALUE1642 1643
+#define BSLS_MACROINCREMENTED_VALUE1643 1644
+#define BSLS_MACROINCREMENTED_VALUE1644 1645
+#define BSLS_MACROINCREMENTED_VALUE1645 1646
+#define BSLS_MACROINCREMENTED_VALUE1646 1647
+#define BSLS_MACROINCREMENTED_VALUE1647 1648
+#define BSLS_MACROINCREMENTED_VALUE1648 1649
+#define BSLS_MACROINCREMENTED_VALUE1649 1650
+#define BSLS_MACROINCREMENTED_VALUE1650 1651
+#define BSLS_MACROINCREMENTED_VALUE1651 1652
+#define BSLS_MACROINCREMENTED_VALUE1652 1653
+#define BSLS_MACROINCREMENTED_VALUE1653 1654
+#define BSLS_MACROINCREMENTED_VALUE1654 1655
+#define BSLS_MACROINCREMENTED_VALUE1655 1656
+#define BSLS_MACROINCREMENTED_VALUE1656 1657
+#define BSLS_MACROINCREMENTED_VALUE1657 1658
+#define BSLS_MACROINCREMENTED_VALUE1658 1659
+#define BSLS_MACROINCREMENTED_VALUE1659 1660
+#define BSLS_MACROINCREMENTED_VALUE1660 1661
+#define BSLS_MACROINCREMENTED_VALUE1661 1662
+#define BSLS_MACROINCREMENTED_VALUE1662 1663
+#define BSLS_MACROINCREMENTED_VALUE1663 1664
+#define BSLS_MACROINCREMENTED_VALUE1664 1665
+#define BSLS_MACROINCREMENTED_VALUE1665 1666
+#define BSLS_MACROINCREMENTED_VALUE1666 1667
+#define BSLS_MACROINCREMENTED_VALUE1667 1668
+#define BSLS_MACROINCREMENTED_VALUE1668 1669
+#define BSLS_MACROINCREMENTED_VALUE1669 1670
+#define BSLS_MACROINCREMENTED_VALUE1670 1671
+#define BSLS_MACROINCREMENTED_VALUE1671 1672
+#define BSLS_MACROINCREMENTED_VALUE1672 1673
+#define BSLS_MACROINCREMENTED_VALUE1673 1674
+#define BSLS_MACROINCREMENTED_VALUE1674 1675
+#define BSLS_MACROINCREMENTED_VALUE1675 1676
+#define BSLS_MACROINCREMENTED_VALUE1676 1677
+#define BSLS_MACROINCREMENTED_VALUE1677 1678
+#define BSLS_MACROINCREMENTED_VALUE1678 1679
+#define BSLS_MACROINCREMENTED_VALUE1679 1680
+#define BSLS_MACROINCREMENTED_VALUE1680 1681
+#define BSLS_MACROINCREMENTED_VALUE1681 1682
+#define BSLS_MACROINCREMENTED_VALUE1682 1683
+#define BSLS_MACROINCREMENTED_VALUE1683 1684
+#define BSLS_MACROINCREMENTED_VALUE1684 1685
+#define BSLS_MACROINCREMENTED_VALUE1685 1686
+#define BSLS_MACROINCREMENTED_VALUE1686 1687
+#define BSLS_MACROINCREMENTED_VALUE1687 1688
+#define BSLS_MACROINCREMENTED_VALUE1688 1689
+#define BSLS_MACROINCREMENTED_VALUE1689 1690
+#define BSLS_MACROINCREMENTED_VALUE1690 1691
+#define BSLS_MACROINCREMENTED_VALUE1691 1692
+#define BSLS_MACROINCREMENTED_VALUE1692 1693
+#define BSLS_MACROINCREMENTED_VALUE1693 1694
+#define BSLS_MACROINCREMENTED_VALUE1694 1695
+#define BSLS_MACROINCREMENTED_VALUE1695 1696
+#define BSLS_MACROINCREMENTED_VALUE1696 1697
+#define BSLS_MACROINCREMENTED_VALUE1697 1698
+#define BSLS_MACROINCREMENTED_VALUE1698 1699
+#define BSLS_MACROINCREMENTED_VALUE1699 1700
+#define BSLS_MACROINCREMENTED_VALUE1700 1701
+#define BSLS_MACROINCREMENTED_VALUE1701 1702
+#define BSLS_MACROINCREMENTED_VALUE1702 1703
+#define BSLS_MACROINCREMENTED_VALUE1703 1704
+#define BSLS_MACROINCREMENTED_VALUE1704 1705
+#define BSLS_MACROINCREMENTED_VALUE1705 1706
+#define BSLS_MACROINCREMENTED_VALUE1706 1707
+#define BSLS_MACROINCREMENTED_VALUE1707 1708
+#define BSLS_MACROINCREMENTED_VALUE1708 1709
+#define BSLS_MACROINCREMENTED_VALUE1709 1710
+#define BSLS_MACROINCREMENTED_VALUE1710 1711
+#define BSLS_MACROINCREMENTED_VALUE1711 1712
+#define BSLS_MACROINCREMENTED_VALUE1712 1713
+#define BSLS_MACROINCREMENTED_VALUE1713 1714
+#define BSLS_MACROINCREMENTED_VALUE1714 1715
+#define BSLS_MACROINCREMENTED_VALUE1715 1716
+#define BSLS_MACROINCREMENTED_VALUE1716 1717
+#define BSLS_MACROINCREMENTED_VALUE1717 1718
+#define BSLS_MACROINCREMENTED_VALUE1718 1719
+#define BSLS_MACROINCREMENTED_VALUE1719 1720
+#define BSLS_MACROINCREMENTED_VALUE1720 1721
+#define BSLS_MACROINCREMENTED_VALUE1721 1722
+#define BSLS_MACROINCREMENTED_VALUE1722 1723
+#define BSLS_MACROINCREMENTED_VALUE1723 1724
+#define BSLS_MACROINCREMENTED_VALUE1724 1725
+#define BSLS_MACROINCREMENTED_VALUE1725 1726
+#define BSLS_MACROINCREMENTED_VALUE1726 1727
+#define BSLS_MACROINCREMENTED_VALUE1727 1728
+#define BSLS_MACROINCREMENTED_VALUE1728 1729
+#define BSLS_MACROINCREMENTED_VALUE1729 1730
+#define BSLS_MACROINCREMENTED_VALUE1730 1731
+#define BSLS_MACROINCREMENTED_VALUE1731 1732
+#define BSLS_MACROINCREMENTED_VALUE1732 1733
+#define BSLS_MACROINCREMENTED_VALUE1733 1734
+#define BSLS_MACROINCREMENTED_VALUE1734 1735
+#define BSLS_MACROINCREMENTED_VALUE1735 1736
+#define BSLS_MACROINCREMENTED_VALUE1736 1737
+#define BSLS_MACROINCREMENTED_VALUE1737 1738
+#define BSLS_MACROINCREMENTED_VALUE1738 1739
+#define BSLS_MACROINCREMENTED_VALUE1739 1740
+#define BSLS_MACROINCREMENTED_VALUE1740 1741
+#define BSLS_MACROINCREMENTED_VALUE1741 1742
+#define BSLS_MACROINCREMENTED_VALUE1742 1743
+#define BSLS_MACROINCREMENTED_VALUE1743 1744
+#define BSLS_MACROINCREMENTED_VALUE1744 1745
+#define BSLS_MACROINCREMENTED_VALUE1745 1746
+#define BSLS_MACROINCREMENTED_VALUE1746 1747
+#define BSLS_MACROINCREMENTED_VALUE1747 1748
+#define BSLS_MACROINCREMENTED_VALUE1748 1749
+#define BSLS_MACROINCREMENTED_VALUE1749 1750
+#define BSLS_MACROINCREMENTED_VALUE1750 1751
+#define BSLS_MACROINCREMENTED_VALUE1751 1752
+#define BSLS_MACROINCREMENTED_VALUE1752 1753
+#define BSLS_MACROINCREMENTED_VALUE1753 1754
+#define BSLS_MACROINCREMENTED_VALUE1754 1755
+#define BSLS_MACROINCREMENTED_VALUE1755 1756
+#define BSLS_MACROINCREMENTED_VALUE1756 1757
+#define BSLS_MACROINCREMENTED_VALUE1757 1758
+#define BSLS_MACROINCREMENTED_VALUE1758 1759
+#define BSLS_MACROINCREMENTED_VALUE1759 1760
+#define BSLS_MACROINCREMENTED_VALUE1760 1761
+#define BSLS_MACROINCREMENTED_VALUE1761 1762
+#define BSLS_MACROINCREMENTED_VALUE1762 1763
+#define BSLS_MACROINCREMENTED_VALUE1763 1764
+#define BSLS_MACROINCREMENTED_VALUE1764 1765
+#define BSLS_MACROINCREMENTED_VALUE1765 1766
+#define BSLS_MACROINCREMENTED_VALUE1766 1767
+#define BSLS_MACROINCREMENTED_VALUE1767 1768
+#define BSLS_MACROINCREMENTED_VALUE1768 1769
+#define BSLS_MACROINCREMENTED_VALUE1769 1770
+#define BSLS_MACROINCREMENTED_VALUE1770 1771
+#define BSLS_MACROINCREMENTED_VALUE1771 1772
+#define BSLS_MACROINCREMENTED_VALUE1772 1773
+#define BSLS_MACROINCREMENTED_VALUE1773 1774
+#define BSLS_MACROINCREMENTED_VALUE1774 1775
+#define BSLS_MACROINCREMENTED_VALUE1775 1776
+#define BSLS_MACROINCREMENTED_VALUE1776 1777
+#define BSLS_MACROINCREMENTED_VALUE1777 1778
+#define BSLS_MACROINCREMENTED_VALUE1778 1779
+#define BSLS_MACROINCREMENTED_VALUE1779 1780
+#define BSLS_MACROINCREMENTED_VALUE1780 1781
+#define BSLS_MACROINCREMENTED_VALUE1781 1782
+#define BSLS_MACROINCREMENTED_VALUE1782 1783
+#define BSLS_MACROINCREMENTED_VALUE1783 1784
+#define BSLS_MACROINCREMENTED_VALUE1784 1785
+#define BSLS_MACROINCREMENTED_VALUE1785 1786
+#define BSLS_MACROINCREMENTED_VALUE1786 1787
+#define BSLS_MACROINCREMENTED_VALUE1787 1788
+#define BSLS_MACROINCREMENTED_VALUE1788 1789
+#define BSLS_MACROINCREMENTED_VALUE1789 1790
+#define BSLS_MACROINCREMENTED_VALUE1790 1791
+#define BSLS_MACROINCREMENTED_VALUE1791 1792
+#define BSLS_MACROINCREMENTED_VALUE1792 1793
+#define BSLS_MACROINCREMENTED_VALUE1793 1794
+#define BSLS_MACROINCREMENTED_VALUE1794 1795
+#define BSLS_MACROINCREMENTED_VALUE1795 1796
+#define BSLS_MACROINCREMENTED_VALUE1796 1797
+#define BSLS_MACROINCREMENTED_VALUE1797 1798
+#define BSLS_MACROINCREMENTED_VALUE1798 1799
+#define BSLS_MACROINCREMENTED_VALUE1799 1800
+#define BSLS_MACROINCREMENTED_VALUE1800 1801
+#define BSLS_MACROINCREMENTED_VALUE1801 1802
+#define BSLS_MACROINCREMENTED_VALUE1802 1803
+#define BSLS_MACROINCREMENTED_VALUE1803 1804
+#define BSLS_MACROINCREMENTED_VALUE1804 1805
+#define BSLS_MACROINCREMENTED_VALUE1805 1806
+#define BSLS_MACROINCREMENTED_VALUE1806 1807
+#define BSLS_MACROINCREMENTED_VALUE1807 1808
+#define BSLS_MACROINCREMENTED_VALUE1808 1809
+#define BSLS_MACROINCREMENTED_VALUE1809 1810
+#define BSLS_MACROINCREMENTED_VALUE1810 1811
+#define BSLS_MACROINCREMENTED_VALUE1811 1812
+#define BSLS_MACROINCREMENTED_VALUE1812 1813
+#define BSLS_MACROINCREMENTED_VALUE1813 1814
+#define BSLS_MACROINCREMENTED_VALUE1814 1815
+#define BSLS_MACROINCREMENTED_VALUE1815 1816
+#define BSLS_MACROINCREMENTED_VALUE1816 1817
+#define BSLS_MACROINCREMENTED_VALUE1817 1818
+#define BSLS_MACROINCREMENTED_VALUE1818 1819
+#define BSLS_MACROINCREMENTED_VALUE1819 1820
+#define BSLS_MACROINCREMENTED_VALUE1820 1821
+#define BSLS_MACROINCREMENTED_VALUE1821 1822
+#define BSLS_MACROINCREMENTED_VALUE1822 1823
+#define BSLS_MACROINCREMENTED_VALUE1823 1824
+#define BSLS_MACROINCREMENTED_VALUE1824 1825
+#define BSLS_MACROINCREMENTED_VALUE1825 1826
+#define BSLS_MACROINCREMENTED_VALUE1826 1827
+#define BSLS_MACROINCREMENTED_VALUE1827 1828
+#define BSLS_MACROINCREMENTED_VALUE1828 1829
+#define BSLS_MACROINCREMENTED_VALUE1829 1830
+#define BSLS_MACROINCREMENTED_VALUE1830 1831
+#define BSLS_MACROINCREMENTED_VALUE1831 1832
+#define BSLS_MACROINCREMENTED_VALUE1832 1833
+#define BSLS_MACROINCREMENTED_VALUE1833 1834
+#define BSLS_MACROINCREMENTED_VALUE1834 1835
+#define BSLS_MACROINCREMENTED_VALUE1835 1836
+#define BSLS_MACROINCREMENTED_VALUE1836 1837
+#define BSLS_MACROINCREMENTED_VALUE1837 1838
+#define BSLS_MACROINCREMENTED_VALUE1838 1839
+#define BSLS_MACROINCREMENTED_VALUE1839 1840
+#define BSLS_MACROINCREMENTED_VALUE1840 1841
+#define BSLS_MACROINCREMENTED_VALUE1841 1842
+#define BSLS_MACROINCREMENTED_VALUE1842 1843
+#define BSLS_MACROINCREMENTED_VALUE1843 1844
+#define BSLS_MACROINCREMENTED_VALUE1844 1845
+#define BSLS_MACROINCREMENTED_VALUE1845 1846
+#define BSLS_MACROINCREMENTED_VALUE1846 1847
+#define BSLS_MACROINCREMENTED_VALUE1847 1848
+#define BSLS_MACROINCREMENTED_VALUE1848 1849
+#define BSLS_MACROINCREMENTED_VALUE1849 1850
+#define BSLS_MACROINCREMENTED_VALUE1850 1851
+#define BSLS_MACROINCREMENTED_VALUE1851 1852
+#define BSLS_MACROINCREMENTED_VALUE1852 1853
+#define BSLS_MACROINCREMENTED_VALUE1853 1854
+#define BSLS_MACROINCREMENTED_VALUE1854 1855
+#define BSLS_MACROINCREMENTED_VALUE1855 1856
+#define BSLS_MACROINCREMENTED_VALUE1856 1857
+#define BSLS_MACROINCREMENTED_VALUE1857 1858
+#define BSLS_MACROINCREMENTED_VALUE1858 1859
+#define BSLS_MACROINCREMENTED_VALUE1859 1860
+#define BSLS_MACROINCREMENTED_VALUE1860 1861
+#define BSLS_MACROINCREMENTED_VALUE1861 1862
+#define BSLS_MACROINCREMENTED_VALUE1862 1863
+#define BSLS_MACROINCREMENTED_VALUE1863 1864
+#define BSLS_MACROINCREMENTED_VALUE1864 1865
+#define BSLS_MACROINCREMENTED_VALUE1865 1866
+#define BSLS_MACROINCREMENTED_VALUE1866 1867
+#define BSLS_MACROINCREMENTED_VALUE1867 1868
+#define BSLS_MACROINCREMENTED_VALUE1868 1869
+#define BSLS_MACROINCREMENTED_VALUE1869 1870
+#define BSLS_MACROINCREMENTED_VALUE1870 1871
+#define BSLS_MACROINCREMENTED_VALUE1871 1872
+#define BSLS_MACROINCREMENTED_VALUE1872 1873
+#define BSLS_MACROINCREMENTED_VALUE1873 1874
+#define BSLS_MACROINCREMENTED_VALUE1874 1875
+#define BSLS_MACROINCREMENTED_VALUE1875 1876
+#define BSLS_MACROINCREMENTED_VALUE1876 1877
+#define BSLS_MACROINCREMENTED_VALUE1877 1878
+#define BSLS_MACROINCREMENTED_VALUE1878 1879
+#define BSLS_MACROINCREMENTED_VALUE1879 1880
+#define BSLS_MACROINCREMENTED_VALUE1880 1881
+#define BSLS_MACROINCREMENTED_VALUE1881 1882
+#define BSLS_MACROINCREMENTED_VALUE1882 1883
+#define BSLS_MACROINCREMENTED_VALUE1883 1884
+#define BSLS_MACROINCREMENTED_VALUE1884 1885
+#define BSLS_MACROINCREMENTED_VALUE1885 1886
+#define BSLS_MACROINCREMENTED_VALUE1886 1887
+#define BSLS_MACROINCREMENTED_VALUE1887 1888
+#define BSLS_MACROINCREMENTED_VALUE1888 1889
+#define BSLS_MACROINCREMENTED_VALUE1889 1890
+#define BSLS_MACROINCREMENTED_VALUE1890 1891
+#define BSLS_MACROINCREMENTED_VALUE1891 1892
+#define BSLS_MACROINCREMENTED_VALUE1892 1893
+#define BSLS_MACROINCREMENTED_VALUE1893 1894
+#define BSLS_MACROINCREMENTED_VALUE1894 1895
+#define BSLS_MACROINCREMENTED_VALUE1895 1896
+#define BSLS_MACROINCREMENTED_VALUE1896 1897
+#define BSLS_MACROINCREMENTED_VALUE1897 1898
+#define BSLS_MACROINCREMENTED_VALUE1898 1899
+#define BSLS_MACROINCREMENTED_VALUE1899 1900
+#define BSLS_MACROINCREMENTED_VALUE1900 1901
+#define BSLS_MACROINCREMENTED_VALUE1901 1902
+#define BSLS_MACROINCREMENTED_VALUE1902 1903
+#define BSLS_MACROINCREMENTED_VALUE1903 1904
+#define BSLS_MACROINCREMENTED_VALUE1904 1905
+#define BSLS_MACROINCREMENTED_VALUE1905 1906
+#define BSLS_MACROINCREMENTED_VALUE1906 1907
+#define BSLS_MACROINCREMENTED_VALUE1907 1908
+#define BSLS_MACROINCREMENTED_VALUE1908 1909
+#define BSLS_MACROINCREMENTED_VALUE1909 1910
+#define BSLS_MACROINCREMENTED_VALUE1910 1911
+#define BSLS_MACROINCREMENTED_VALUE1911 1912
+#define BSLS_MACROINCREMENTED_VALUE1912 1913
+#define BSLS_MACROINCREMENTED_VALUE1913 1914
+#define BSLS_MACROINCREMENTED_VALUE1914 1915
+#define BSLS_MACROINCREMENTED_VALUE1915 1916
+#define BSLS_MACROINCREMENTED_VALUE1916 1917
+#define BSLS_MACROINCREMENTED_VALUE1917 1918
+#define BSLS_MACROINCREMENTED_VALUE1918 1919
+#define BSLS_MACROINCREMENTED_VALUE1919 1920
+#define BSLS_MACROINCREMENTED_VALUE1920 1921
+#define BSLS_MACROINCREMENTED_VALUE1921 1922
+#define BSLS_MACROINCREMENTED_VALUE1922 1923
+#define BSLS_MACROINCREMENTED_VALUE1923 1924
+#define BSLS_MACROINCREMENTED_VALUE1924 1925
+#define BSLS_MACROINCREMENTED_VALUE1925 1926
+#define BSLS_MACROINCREMENTED_VALUE1926 1927
+#define BSLS_MACROINCREMENTED_VALUE1927 1928
+#define BSLS_MACROINCREMENTED_VALUE1928 1929
+#define BSLS_MACROINCREMENTED_VALUE1929 1930
+#define BSLS_MACROINCREMENTED_VALUE1930 1931
+#define BSLS_MACROINCREMENTED_VALUE1931 1932
+#define BSLS_MACROINCREMENTED_VALUE1932 1933
+#define BSLS_MACROINCREMENTED_VALUE1933 1934
+#define BSLS_MACROINCREMENTED_VALUE1934 1935
+#define BSLS_MACROINCREMENTED_VALUE1935 1936
+#define BSLS_MACROINCREMENTED_VALUE1936 1937
+#define BSLS_MACROINCREMENTED_VALUE1937 1938
+#define BSLS_MACROINCREMENTED_VALUE1938 1939
+#define BSLS_MACROINCREMENTED_VALUE1939 1940
+#define BSLS_MACROINCREMENTED_VALUE1940 1941
+#define BSLS_MACROINCREMENTED_VALUE1941 1942
+#define BSLS_MACROINCREMENTED_VALUE1942 1943
+#define BSLS_MACROINCREMENTED_VALUE1943 1944
+#define BSLS_MACROINCREMENTED_VALUE1944 1945
+#define BSLS_MACROINCREMENTED_VALUE1945 1946
+#define BSLS_MACROINCREMENTED_VALUE1946 1947
+#define BSLS_MACROINCREMENTED_VALUE1947 1948
+#define BSLS_MACROINCREMENTED_VALUE1948 1949
+#define BSLS_MACROINCREMENTED_VALUE1949 1950
+#define BSLS_MACROINCREMENTED_VALUE1950 1951
+#define BSLS_MACROINCREMENTED_VALUE1951 1952
+#define BSLS_MACROINCREMENTED_VALUE1952 1953
+#define BSLS_MACROINCREMENTED_VALUE1953 1954
+#define BSLS_MACROINCREMENTED_VALUE1954 1955
+#define BSLS_MACROINCREMENTED_VALUE1955 1956
+#define BSLS_MACROINCREMENTED_VALUE1956 1957
+#define BSLS_MACROINCREMENTED_VALUE1957 1958
+#define BSLS_MACROINCREMENTED_VALUE1958 1959
+#define BSLS_MACROINCREMENTED_VALUE1959 1960
+#define BSLS_MACROINCREMENTED_VALUE1960 1961
+#define BSLS_MACROINCREMENTED_VALUE1961 1962
+#define BSLS_MACROINCREMENTED_VALUE1962 1963
+#define BSLS_MACROINCREMENTED_VALUE1963 1964
+#define BSLS_MACROINCREMENTED_VALUE1964 1965
+#define BSLS_MACROINCREMENTED_VALUE1965 1966
+#define BSLS_MACROINCREMENTED_VALUE1966 1967
+#define BSLS_MACROINCREMENTED_VALUE1967 1968
+#define BSLS_MACROINCREMENTED_VALUE1968 1969
+#define BSLS_MACROINCREMENTED_VALUE1969 1970
+#define BSLS_MACROINCREMENTED_VALUE1970 1971
+#define BSLS_MACROINCREMENTED_VALUE1971 1972
+#define BSLS_MACROINCREMENTED_VALUE1972 1973
+#define BSLS_MACROINCREMENTED_VALUE1973 1974
+#define BSLS_MACROINCREMENTED_VALUE1974 1975
+#define BSLS_MACROINCREMENTED_VALUE1975 1976
+#define BSLS_MACROINCREMENTED_VALUE1976 1977
+#define BSLS_MACROINCREMENTED_VALUE1977 1978
+#define BSLS_MACROINCREMENTED_VALUE1978 1979
+#define BSLS_MACROINCREMENTED_VALUE1979 1980
+#define BSLS_MACROINCREMENTED_VALUE1980 1981
+#define BSLS_MACROINCREMENTED_VALUE1981 1982
+#define BSLS_MACROINCREMENTED_VALUE1982 1983
+#define BSLS_MACROINCREMENTED_VALUE1983 1984
+#define BSLS_MACROINCREMENTED_VALUE1984 1985
+#define BSLS_MACROINCREMENTED_VALUE1985 1986
+#define BSLS_MACROINCREMENTED_VALUE1986 1987
+#define BSLS_MACROINCREMENTED_VALUE1987 1988
+#define BSLS_MACROINCREMENTED_VALUE1988 1989
+#define BSLS_MACROINCREMENTED_VALUE1989 1990
+#define BSLS_MACROINCREMENTED_VALUE1990 1991
+#define BSLS_MACROINCREMENTED_VALUE1991 1992
+#define BSLS_MACROINCREMENTED_VALUE1992 1993
+#define BSLS_MACROINCREMENTED_VALUE1993 1994
+#define BSLS_MACROINCREMENTED_VALUE1994 1995
+#define BSLS_MACROINCREMENTED_VALUE1995 1996
+#define BSLS_MACROINCREMENTED_VALUE1996 1997
+#define BSLS_MACROINCREMENTED_VALUE1997 1998
+#define BSLS_MACROINCREMENTED_VALUE1998 1999
+#define BSLS_MACROINCREMENTED_VALUE1999 2000
+#define BSLS_MACROINCREMENTED_VALUE2000 2001
+#define BSLS_MACROINCREMENTED_VALUE2001 2002
+#define BSLS_MACROINCREMENTED_VALUE2002 2003
+#define BSLS_MACROINCREMENTED_VALUE2003 2004
+#define BSLS_MACROINCREMENTED_VALUE2004 2005
+#define BSLS_MACROINCREMENTED_VALUE2005 2006
+#define BSLS_MACROINCREMENTED_VALUE2006 2007
+#define BSLS_MACROINCREMENTED_VALUE2007 2008
+#define BSLS_MACROINCREMENTED_VALUE2008 2009
+#define BSLS_MACROINCREMENTED_VALUE2009 2010
+#define BSLS_MACROINCREMENTED_VALUE2010 2011
+#define BSLS_MACROINCREMENTED_VALUE2011 2012
+#define BSLS_MACROINCREMENTED_VALUE2012 2013
+#define BSLS_MACROINCREMENTED_VALUE2013 2014
+#define BSLS_MACROINCREMENTED_VALUE2014 2015
+#define BSLS_MACROINCREMENTED_VALUE2015 2016
+#define BSLS_MACROINCREMENTED_VALUE2016 2017
+#define BSLS_MACROINCREMENTED_VALUE2017 2018
+#define BSLS_MACROINCREMENTED_VALUE2018 2019
+#define BSLS_MACROINCREMENTED_VALUE2019 2020
+#define BSLS_MACROINCREMENTED_VALUE2020 2021
+#define BSLS_MACROINCREMENTED_VALUE2021 2022
+#define BSLS_MACROINCREMENTED_VALUE2022 2023
+#define BSLS_MACROINCREMENTED_VALUE2023 2024
+#define BSLS_MACROINCREMENTED_VALUE2024 2025
+#define BSLS_MACROINCREMENTED_VALUE2025 2026
+#define BSLS_MACROINCREMENTED_VALUE2026 2027
+#define BSLS_MACROINCREMENTED_VALUE2027 2028
+#define BSLS_MACROINCREMENTED_VALUE2028 2029
+#define BSLS_MACROINCREMENTED_VALUE2029 2030
+#define BSLS_MACROINCREMENTED_VALUE2030 2031
+#define BSLS_MACROINCREMENTED_VALUE2031 2032
+#define BSLS_MACROINCREMENTED_VALUE2032 2033
+#define BSLS_MACROINCREMENTED_VALUE2033 2034
+#define BSLS_MACROINCREMENTED_VALUE2034 2035
+#define BSLS_MACROINCREMENTED_VALUE2035 2036
+#define BSLS_MACROINCREMENTED_VALUE2036 2037
+#define BSLS_MACROINCREMENTED_VALUE2037 2038
+#define BSLS_MACROINCREMENTED_VALUE2038 2039
+#define BSLS_MACROINCREMENTED_VALUE2039 2040
+#define BSLS_MACROINCREMENTED_VALUE2040 2041
+#define BSLS_MACROINCREMENTED_VALUE2041 2042
+#define BSLS_MACROINCREMENTED_VALUE2042 2043
+#define BSLS_MACROINCREMENTED_VALUE2043 2044
+#define BSLS_MACROINCREMENTED_VALUE2044 2045
+#define BSLS_MACROINCREMENTED_VALUE2045 2046
+#define BSLS_MACROINCREMENTED_VALUE2046 2047
+#define BSLS_MACROINCREMENTED_VALUE2047 2048
+#define BSLS_MACROINCREMENTED_VALUE2048 2049
+#define BSLS_MACROINCREMENTED_VALUE2049 2050
+#define BSLS_MACROINCREMENTED_VALUE2050 2051
+#define BSLS_MACROINCREMENTED_VALUE2051 2052
+#define BSLS_MACROINCREMENTED_VALUE2052 2053
+#define BSLS_MACROINCREMENTED_VALUE2053 2054
+#define BSLS_MACROINCREMENTED_VALUE2054 2055
+#define BSLS_MACROINCREMENTED_VALUE2055 2056
+#define BSLS_MACROINCREMENTED_VALUE2056 2057
+#define BSLS_MACROINCREMENTED_VALUE2057 2058
+#define BSLS_MACROINCREMENTED_VALUE2058 2059
+#define BSLS_MACROINCREMENTED_VALUE2059 2060
+#define BSLS_MACROINCREMENTED_VALUE2060 2061
+#define BSLS_MACROINCREMENTED_VALUE2061 2062
+#define BSLS_MACROINCREMENTED_VALUE2062 2063
+#define BSLS_MACROINCREMENTED_VALUE2063 2064
+#define BSLS_MACROINCREMENTED_VALUE2064 2065
+#define BSLS_MACROINCREMENTED_VALUE2065 2066
+#define BSLS_MACROINCREMENTED_VALUE2066 2067
+#define BSLS_MACROINCREMENTED_VALUE2067 2068
+#define BSLS_MACROINCREMENTED_VALUE2068 2069
+#define BSLS_MACROINCREMENTED_VALUE2069 2070
+#define BSLS_MACROINCREMENTED_VALUE2070 2071
+#define BSLS_MACROINCREMENTED_VALUE2071 2072
+#define BSLS_MACROINCREMENTED_VALUE2072 2073
+#define BSLS_MACROINCREMENTED_VALUE2073 2074
+#define BSLS_MACROINCREMENTED_VALUE2074 2075
+#define BSLS_MACROINCREMENTED_VALUE2075 2076
+#define BSLS_MACROINCREMENTED_VALUE2076 2077
+#define BSLS_MACROINCREMENTED_VALUE2077 2078
+#define BSLS_MACROINCREMENTED_VALUE2078 2079
+#define BSLS_MACROINCREMENTED_VALUE2079 2080
+#define BSLS_MACROINCREMENTED_VALUE2080 2081
+#define BSLS_MACROINCREMENTED_VALUE2081 2082
+#define BSLS_MACROINCREMENTED_VALUE2082 2083
+#define BSLS_MACROINCREMENTED_VALUE2083 2084
+#define BSLS_MACROINCREMENTED_VALUE2084 2085
+#define BSLS_MACROINCREMENTED_VALUE2085 2086
+#define BSLS_MACROINCREMENTED_VALUE2086 2087
+#define BSLS_MACROINCREMENTED_VALUE2087 2088
+#define BSLS_MACROINCREMENTED_VALUE2088 2089
+#define BSLS_MACROINCREMENTED_VALUE2089 2090
+#define BSLS_MACROINCREMENTED_VALUE2090 2091
+#define BSLS_MACROINCREMENTED_VALUE2091 2092
+#define BSLS_MACROINCREMENTED_VALUE2092 2093
+#define BSLS_MACROINCREMENTED_VALUE2093 2094
+#define BSLS_MACROINCREMENTED_VALUE2094 2095
+#define BSLS_MACROINCREMENTED_VALUE2095 2096
+#define BSLS_MACROINCREMENTED_VALUE2096 2097
+#define BSLS_MACROINCREMENTED_VALUE2097 2098
+#define BSLS_MACROINCREMENTED_VALUE2098 2099
+#define BSLS_MACROINCREMENTED_VALUE2099 2100
+#define BSLS_MACROINCREMENTED_VALUE2100 2101
+#define BSLS_MACROINCREMENTED_VALUE2101 2102
+#define BSLS_MACROINCREMENTED_VALUE2102 2103
+#define BSLS_MACROINCREMENTED_VALUE2103 2104
+#define BSLS_MACROINCREMENTED_VALUE2104 2105
+#define BSLS_MACROINCREMENTED_VALUE2105 2106
+#define BSLS_MACROINCREMENTED_VALUE2106 2107
+#define BSLS_MACROINCREMENTED_VALUE2107 2108
+#define BSLS_MACROINCREMENTED_VALUE2108 2109
+#define BSLS_MACROINCREMENTED_VALUE2109 2110
+#define BSLS_MACROINCREMENTED_VALUE2110 2111
+#define BSLS_MACROINCREMENTED_VALUE2111 2112
+#define BSLS_MACROINCREMENTED_VALUE2112 2113
+#define BSLS_MACROINCREMENTED_VALUE2113 2114
+#define BSLS_MACROINCREMENTED_VALUE2114 2115
+#define BSLS_MACROINCREMENTED_VALUE2115 2116
+#define BSLS_MACROINCREMENTED_VALUE2116 2117
+#define BSLS_MACROINCREMENTED_VALUE2117 2118
+#define BSLS_MACROINCREMENTED_VALUE2118 2119
+#define BSLS_MACROINCREMENTED_VALUE2119 2120
+#define BSLS_MACROINCREMENTED_VALUE2120 2121
+#define BSLS_MACROINCREMENTED_VALUE2121 2122
+#define BSLS_MACROINCREMENTED_VALUE2122 2123
+#define BSLS_MACROINCREMENTED_VALUE2123 2124
+#define BSLS_MACROINCREMENTED_VALUE2124 2125
+#define BSLS_MACROINCREMENTED_VALUE2125 2126
+#define BSLS_MACROINCREMENTED_VALUE2126 2127
+#define BSLS_MACROINCREMENTED_VALUE2127 2128
+#define BSLS_MACROINCREMENTED_VALUE2128 2129
+#define BSLS_MACROINCREMENTED_VALUE2129 2130
+#define BSLS_MACROINCREMENTED_VALUE2130 2131
+#define BSLS_MACROINCREMENTED_VALUE2131 2132
+#define BSLS_MACROINCREMENTED_VALUE2132 2133
+#define BSLS_MACROINCREMENTED_VALUE2133 2134
+#define BSLS_MACROINCREMENTED_VALUE2134 2135
+#define BSLS_MACROINCREMENTED_VALUE2135 2136
+#define BSLS_MACROINCREMENTED_VALUE2136 2137
+#define BSLS_MACROINCREMENTED_VALUE2137 2138
+#define BSLS_MACROINCREMENTED_VALUE2138 2139
+#define BSLS_MACROINCREMENTED_VALUE2139 2140
+#define BSLS_MACROINCREMENTED_VALUE2140 2141
+#define BSLS_MACROINCREMENTED_VALUE2141 2142
+#define BSLS_MACROINCREMENTED_VALUE2142 2143
+#define BSLS_MACROINCREMENTED_VALUE2143 2144
+#define BSLS_MACROINCREMENTED_VALUE2144 2145
+#define BSLS_MACROINCREMENTED_VALUE2145 2146
+#define BSLS_MACROINCREMENTED_VALUE2146 2147
+#define BSLS_MACROINCREMENTED_VALUE2147 2148
+#define BSLS_MACROINCREMENTED_VALUE2148 2149
+#define BSLS_MACROINCREMENTED_VALUE2149 2150
+#define BSLS_MACROINCREMENTED_VALUE2150 2151
+#define BSLS_MACROINCREMENTED_VALUE2151 2152
+#define BSLS_MACROINCREMENTED_VALUE2152 2153
+#define BSLS_MACROINCREMENTED_VALUE2153 2154
+#define BSLS_MACROINCREMENTED_VALUE2154 2155
+#define BSLS_MACROINCREMENTED_VALUE2155 2156
+#define BSLS_MACROINCREMENTED_VALUE2156 2157
+#define BSLS_MACROINCREMENTED_VALUE2157 2158
+#define BSLS_MACROINCREMENTED_VALUE2158 2159
+#define BSLS_MACROINCREMENTED_VALUE2159 2160
+#define BSLS_MACROINCREMENTED_VALUE2160 2161
+#define BSLS_MACROINCREMENTED_VALUE2161 2162
+#define BSLS_MACROINCREMENTED_VALUE2162 2163
+#define BSLS_MACROINCREMENTED_VALUE2163 2164
+#define BSLS_MACROINCREMENTED_VALUE2164 2165
+#define BSLS_MACROINCREMENTED_VALUE2165 2166
+#define BSLS_MACROINCREMENTED_VALUE2166 2167
+#define BSLS_MACROINCREMENTED_VALUE2167 2168
+#define BSLS_MACROINCREMENTED_VALUE2168 2169
+#define BSLS_MACROINCREMENTED_VALUE2169 2170
+#define BSLS_MACROINCREMENTED_VALUE2170 2171
+#define BSLS_MACROINCREMENTED_VALUE2171 2172
+#define BSLS_MACROINCREMENTED_VALUE2172 2173
+#define BSLS_MACROINCREMENTED_VALUE2173 2174
+#define BSLS_MACROINCREMENTED_VALUE2174 2175
+#define BSLS_MACROINCREMENTED_VALUE2175 2176
+#define BSLS_MACROINCREMENTED_VALUE2176 2177
+#define BSLS_MACROINCREMENTED_VALUE2177 2178
+#define BSLS_MACROINCREMENTED_VALUE2178 2179
+#define BSLS_MACROINCREMENTED_VALUE2179 2180
+#define BSLS_MACROINCREMENTED_VALUE2180 2181
+#define BSLS_MACROINCREMENTED_VALUE2181 2182
+#define BSLS_MACROINCREMENTED_VALUE2182 2183
+#define BSLS_MACROINCREMENTED_VALUE2183 2184
+#define BSLS_MACROINCREMENTED_VALUE2184 2185
+#define BSLS_MACROINCREMENTED_VALUE2185 2186
+#define BSLS_MACROINCREMENTED_VALUE2186 2187
+#define BSLS_MACROINCREMENTED_VALUE2187 2188
+#define BSLS_MACROINCREMENTED_VALUE2188 2189
+#define BSLS_MACROINCREMENTED_VALUE2189 2190
+#define BSLS_MACROINCREMENTED_VALUE2190 2191
+#define BSLS_MACROINCREMENTED_VALUE2191 2192
+#define BSLS_MACROINCREMENTED_VALUE2192 2193
+#define BSLS_MACROINCREMENTED_VALUE2193 2194
+#define BSLS_MACROINCREMENTED_VALUE2194 2195
+#define BSLS_MACROINCREMENTED_VALUE2195 2196
+#define BSLS_MACROINCREMENTED_VALUE2196 2197
+#define BSLS_MACROINCREMENTED_VALUE2197 2198
+#define BSLS_MACROINCREMENTED_VALUE2198 2199
+#define BSLS_MACROINCREMENTED_VALUE2199 2200
+#define BSLS_MACROINCREMENTED_VALUE2200 2201
+#define BSLS_MACROINCREMENTED_VALUE2201 2202
+#define BSLS_MACROINCREMENTED_VALUE2202 2203
+#define BSLS_MACROINCREMENTED_VALUE2203 2204
+#define BSLS_MACROINCREMENTED_VALUE2204 2205
+#define BSLS_MACROINCREMENTED_VALUE2205 2206
+#define BSLS_MACROINCREMENTED_VALUE2206 2207
+#define BSLS_MACROINCREMENTED_VALUE2207 2208
+#define BSLS_MACROINCREMENTED_VALUE2208 2209
+#define BSLS_MACROINCREMENTED_VALUE2209 2210
+#define BSLS_MACROINCREMENTED_VALUE2210 2211
+#define BSLS_MACROINCREMENTED_VALUE2211 2212
+#define BSLS_MACROINCREMENTED_VALUE2212 2213
+#define BSLS_MACROINCREMENTED_VALUE2213 2214
+#define BSLS_MACROINCREMENTED_VALUE2214 2215
+#define BSLS_MACROINCREMENTED_VALUE2215 2216
+#define BSLS_MACROINCREMENTED_VALUE2216 2217
+#define BSLS_MACROINCREMENTED_VALUE2217 2218
+#define BSLS_MACROINCREMENTED_VALUE2218 2219
+#define BSLS_MACROINCREMENTED_VALUE2219 2220
+#define BSLS_MACROINCREMENTED_VALUE2220 2221
+#define BSLS_MACROINCREMENTED_VALUE2221 2222
+#define BSLS_MACROINCREMENTED_VALUE2222 2223
+#define BSLS_MACROINCREMENTED_VALUE2223 2224
+#define BSLS_MACROINCREMENTED_VALUE2224 2225
+#define BSLS_MACROINCREMENTED_VALUE2225 2226
+#define BSLS_MACROINCREMENTED_VALUE2226 2227
+#define BSLS_MACROINCREMENTED_VALUE2227 2228
+#define BSLS_MACROINCREMENTED_VALUE2228 2229
+#define BSLS_MACROINCREMENTED_VALUE2229 2230
+#define BSLS_MACROINCREMENTED_VALUE2230 2231
+#define BSLS_MACROINCREMENTED_VALUE2231 2232
+#define BSLS_MACROINCREMENTED_VALUE2232 2233
+#define BSLS_MACROINCREMENTED_VALUE2233 2234
+#define BSLS_MACROINCREMENTED_VALUE2234 2235
+#define BSLS_MACROINCREMENTED_VALUE2235 2236
+#define BSLS_MACROINCREMENTED_VALUE2236 2237
+#define BSLS_MACROINCREMENTED_VALUE2237 2238
+#define BSLS_MACROINCREMENTED_VALUE2238 2239
+#define BSLS_MACROINCREMENTED_VALUE2239 2240
+#define BSLS_MACROINCREMENTED_VALUE2240 2241
+#define BSLS_MACROINCREMENTED_VALUE2241 2242
+#define BSLS_MACROINCREMENTED_VALUE2242 2243
+#define BSLS_MACROINCREMENTED_VALUE2243 2244
+#define BSLS_MACROINCREMENTED_VALUE2244 2245
+#define BSLS_MACROINCREMENTED_VALUE2245 2246
+#define BSLS_MACROINCREMENTED_VALUE2246 2247
+#define BSLS_MACROINCREMENTED_VALUE2247 2248
+#define BSLS_MACROINCREMENTED_VALUE2248 2249
+#define BSLS_MACROINCREMENTED_VALUE2249 2250
+#define BSLS_MACROINCREMENTED_VALUE2250 2251
+#define BSLS_MACROINCREMENTED_VALUE2251 2252
+#define BSLS_MACROINCREMENTED_VALUE2252 2253
+#define BSLS_MACROINCREMENTED_VALUE2253 2254
+#define BSLS_MACROINCREMENTED_VALUE2254 2255
+#define BSLS_MACROINCREMENTED_VALUE2255 2256
+#define BSLS_MACROINCREMENTED_VALUE2256 2257
+#define BSLS_MACROINCREMENTED_VALUE2257 2258
+#define BSLS_MACROINCREMENTED_VALUE2258 2259
+#define BSLS_MACROINCREMENTED_VALUE2259 2260
+#define BSLS_MACROINCREMENTED_VALUE2260 2261
+#define BSLS_MACROINCREMENTED_VALUE2261 2262
+#define BSLS_MACROINCREMENTED_VALUE2262 2263
+#define BSLS_MACROINCREMENTED_VALUE2263 2264
+#define BSLS_MACROINCREMENTED_VALUE2264 2265
+#define BSLS_MACROINCREMENTED_VALUE2265 2266
+#define BSLS_MACROINCREMENTED_VALUE2266 2267
+#define BSLS_MACROINCREMENTED_VALUE2267 2268
+#define BSLS_MACROINCREMENTED_VALUE2268 2269
+#define BSLS_MACROINCREMENTED_VALUE2269 2270
+#define BSLS_MACROINCREMENTED_VALUE2270 2271
+#define BSLS_MACROINCREMENTED_VALUE2271 2272
+#define BSLS_MACROINCREMENTED_VALUE2272 2273
+#define BSLS_MACROINCREMENTED_VALUE2273 2274
+#define BSLS_MACROINCREMENTED_VALUE2274 2275
+#define BSLS_MACROINCREMENTED_VALUE2275 2276
+#define BSLS_MACROINCREMENTED_VALUE2276 2277
+#define BSLS_MACROINCREMENTED_VALUE2277 2278
+#define BSLS_MACROINCREMENTED_VALUE2278 2279
+#define BSLS_MACROINCREMENTED_VALUE2279 2280
+#define BSLS_MACROINCREMENTED_VALUE2280 2281
+#define BSLS_MACROINCREMENTED_VALUE2281 2282
+#define BSLS_MACROINCREMENTED_VALUE2282 2283
+#define BSLS_MACROINCREMENTED_VALUE2283 2284
+#define BSLS_MACROINCREMENTED_VALUE2284 2285
+#define BSLS_MACROINCREMENTED_VALUE2285 2286
+#define BSLS_MACROINCREMENTED_VALUE2286 2287
+#define BSLS_MACROINCREMENTED_VALUE2287 2288
+#define BSLS_MACROINCREMENTED_VALUE2288 2289
+#define BSLS_MACROINCREMENTED_VALUE2289 2290
+#define BSLS_MACROINCREMENTED_VALUE2290 2291
+#define BSLS_MACROINCREMENTED_VALUE2291 2292
+#define BSLS_MACROINCREMENTED_VALUE2292 2293
+#define BSLS_MACROINCREMENTED_VALUE2293 2294
+#define BSLS_MACROINCREMENTED_VALUE2294 2295
+#define BSLS_MACROINCREMENTED_VALUE2295 2296
+#define BSLS_MACROINCREMENTED_VALUE2296 2297
+#define BSLS_MACROINCREMENTED_VALUE2297 2298
+#define BSLS_MACROINCREMENTED_VALUE2298 2299
+#define BSLS_MACROINCREMENTED_VALUE2299 2300
+#define BSLS_MACROINCREMENTED_VALUE2300 2301
+#define BSLS_MACROINCREMENTED_VALUE2301 2302
+#define BSLS_MACROINCREMENTED_VALUE2302 2303
+#define BSLS_MACROINCREMENTED_VALUE2303 2304
+#define BSLS_MACROINCREMENTED_VALUE2304 2305
+#define BSLS_MACROINCREMENTED_VALUE2305 2306
+#define BSLS_MACROINCREMENTED_VALUE2306 2307
+#define BSLS_MACROINCREMENTED_VALUE2307 2308
+#define BSLS_MACROINCREMENTED_VALUE2308 2309
+#define BSLS_MACROINCREMENTED_VALUE2309 2310
+#define BSLS_MACROINCREMENTED_VALUE2310 2311
+#define BSLS_MACROINCREMENTED_VALUE2311 2312
+#define BSLS_MACROINCREMENTED_VALUE2312 2313
+#define BSLS_MACROINCREMENTED_VALUE2313 2314
+#define BSLS_MACROINCREMENTED_VALUE2314 2315
+#define BSLS_MACROINCREMENTED_VALUE2315 2316
+#define BSLS_MACROINCREMENTED_VALUE2316 2317
+#define BSLS_MACROINCREMENTED_VALUE2317 2318
+#define BSLS_MACROINCREMENTED_VALUE2318 2319
+#define BSLS_MACROINCREMENTED_VALUE2319 2320
+#define BSLS_MACROINCREMENTED_VALUE2320 2321
+#define BSLS_MACROINCREMENTED_VALUE2321 2322
+#define BSLS_MACROINCREMENTED_VALUE2322 2323
+#define BSLS_MACROINCREMENTED_VALUE2323 2324
+#define BSLS_MACROINCREMENTED_VALUE2324 2325
+#define BSLS_MACROINCREMENTED_VALUE2325 2326
+#define BSLS_MACROINCREMENTED_VALUE2326 2327
+#define BSLS_MACROINCREMENTED_VALUE2327 2328
+#define BSLS_MACROINCREMENTED_VALUE2328 2329
+#define BSLS_MACROINCREMENTED_VALUE2329 2330
+#define BSLS_MACROINCREMENTED_VALUE2330 2331
+#define BSLS_MACROINCREMENTED_VALUE2331 2332
+#define BSLS_MACROINCREMENTED_VALUE2332 2333
+#define BSLS_MACROINCREMENTED_VALUE2333 2334
+#define BSLS_MACROINCREMENTED_VALUE2334 2335
+#define BSLS_MACROINCREMENTED_VALUE2335 2336
+#define BSLS_MACROINCREMENTED_VALUE2336 2337
+#define BSLS_MACROINCREMENTED_VALUE2337 2338
+#define BSLS_MACROINCREMENTED_VALUE2338 2339
+#define BSLS_MACROINCREMENTED_VALUE2339 2340
+#define BSLS_MACROINCREMENTED_VALUE2340 2341
+#define BSLS_MACROINCREMENTED_VALUE2341 2342
+#define BSLS_MACROINCREMENTED_VALUE2342 2343
+#define BSLS_MACROINCREMENTED_VALUE2343 2344
+#define BSLS_MACROINCREMENTED_VALUE2344 2345
+#define BSLS_MACROINCREMENTED_VALUE2345 2346
+#define BSLS_MACROINCREMENTED_VALUE2346 2347
+#define BSLS_MACROINCREMENTED_VALUE2347 2348
+#define BSLS_MACROINCREMENTED_VALUE2348 2349
+#define BSLS_MACROINCREMENTED_VALUE2349 2350
+#define BSLS_MACROINCREMENTED_VALUE2350 2351
+#define BSLS_MACROINCREMENTED_VALUE2351 2352
+#define BSLS_MACROINCREMENTED_VALUE2352 2353
+#define BSLS_MACROINCREMENTED_VALUE2353 2354
+#define BSLS_MACROINCREMENTED_VALUE2354 2355
+#define BSLS_MACROINCREMENTED_VALUE2355 2356
+#define BSLS_MACROINCREMENTED_VALUE2356 2357
+#define BSLS_MACROINCREMENTED_VALUE2357 2358
+#define BSLS_MACROINCREMENTED_VALUE2358 2359
+#define BSLS_MACROINCREMENTED_VALUE2359 2360
+#define BSLS_MACROINCREMENTED_VALUE2360 2361
+#define BSLS_MACROINCREMENTED_VALUE2361 2362
+#define BSLS_MACROINCREMENTED_VALUE2362 2363
+#define BSLS_MACROINCREMENTED_VALUE2363 2364
+#define BSLS_MACROINCREMENTED_VALUE2364 2365
+#define BSLS_MACROINCREMENTED_VALUE2365 2366
+#define BSLS_MACROINCREMENTED_VALUE2366 2367
+#define BSLS_MACROINCREMENTED_VALUE2367 2368
+#define BSLS_MACROINCREMENTED_VALUE2368 2369
+#define BSLS_MACROINCREMENTED_VALUE2369 2370
+#define BSLS_MACROINCREMENTED_VALUE2370 2371
+#define BSLS_MACROINCREMENTED_VALUE2371 2372
+#define BSLS_MACROINCREMENTED_VALUE2372 2373
+#define BSLS_MACROINCREMENTED_VALUE2373 2374
+#define BSLS_MACROINCREMENTED_VALUE2374 2375
+#define BSLS_MACROINCREMENTED_VALUE2375 2376
+#define BSLS_MACROINCREMENTED_VALUE2376 2377
+#define BSLS_MACROINCREMENTED_VALUE2377 2378
+#define BSLS_MACROINCREMENTED_VALUE2378 2379
+#define BSLS_MACROINCREMENTED_VALUE2379 2380
+#define BSLS_MACROINCREMENTED_VALUE2380 2381
+#define BSLS_MACROINCREMENTED_VALUE2381 2382
+#define BSLS_MACROINCREMENTED_VALUE2382 2383
+#define BSLS_MACROINCREMENTED_VALUE2383 2384
+#define BSLS_MACROINCREMENTED_VALUE2384 2385
+#define BSLS_MACROINCREMENTED_VALUE2385 2386
+#define BSLS_MACROINCREMENTED_VALUE2386 2387
+#define BSLS_MACROINCREMENTED_VALUE2387 2388
+#define BSLS_MACROINCREMENTED_VALUE2388 2389
+#define BSLS_MACROINCREMENTED_VALUE2389 2390
+#define BSLS_MACROINCREMENTED_VALUE2390 2391
+#define BSLS_MACROINCREMENTED_VALUE2391 2392
+#define BSLS_MACROINCREMENTED_VALUE2392 2393
+#define BSLS_MACROINCREMENTED_VALUE2393 2394
+#define BSLS_MACROINCREMENTED_VALUE2394 2395
+#define BSLS_MACROINCREMENTED_VALUE2395 2396
+#define BSLS_MACROINCREMENTED_VALUE2396 2397
+#define BSLS_MACROINCREMENTED_VALUE2397 2398
+#define BSLS_MACROINCREMENTED_VALUE2398 2399
+#define BSLS_MACROINCREMENTED_VALUE2399 2400
+#define BSLS_MACROINCREMENTED_VALUE2400 2401
+#define BSLS_MACROINCREMENTED_VALUE2401 2402
+#define BSLS_MACROINCREMENTED_VALUE2402 2403
+#define BSLS_MACROINCREMENTED_VALUE2403 2404
+#define BSLS_MACROINCREMENTED_VALUE2404 2405
+#define BSLS_MACROINCREMENTED_VALUE2405 2406
+#define BSLS_MACROINCREMENTED_VALUE2406 2407
+#define BSLS_MACROINCREMENTED_VALUE2407 2408
+#define BSLS_MACROINCREMENTED_VALUE2408 2409
+#define BSLS_MACROINCREMENTED_VALUE2409 2410
+#define BSLS_MACROINCREMENTED_VALUE2410 2411
+#define BSLS_MACROINCREMENTED_VALUE2411 2412
+#define BSLS_MACROINCREMENTED_VALUE2412 2413
+#define BSLS_MACROINCREMENTED_VALUE2413 2414
+#define BSLS_MACROINCREMENTED_VALUE2414 2415
+#define BSLS_MACROINCREMENTED_VALUE2415 2416
+#define BSLS_MACROINCREMENTED_VALUE2416 2417
+#define BSLS_MACROINCREMENTED_VALUE2417 2418
+#define BSLS_MACROINCREMENTED_VALUE2418 2419
+#define BSLS_MACROINCREMENTED_VALUE2419 2420
+#define BSLS_MACROINCREMENTED_VALUE2420 2421
+#define BSLS_MACROINCREMENTED_VALUE2421 2422
+#define BSLS_MACROINCREMENTED_VALUE2422 2423
+#define BSLS_MACROINCREMENTED_VALUE2423 2424
+#define BSLS_MACROINCREMENTED_VALUE2424 2425
+#define BSLS_MACROINCREMENTED_VALUE2425 2426
+#define BSLS_MACROINCREMENTED_VALUE2426 2427
+#define BSLS_MACROINCREMENTED_VALUE2427 2428
+#define BSLS_MACROINCREMENTED_VALUE2428 2429
+#define BSLS_MACROINCREMENTED_VALUE2429 2430
+#define BSLS_MACROINCREMENTED_VALUE2430 2431
+#define BSLS_MACROINCREMENTED_VALUE2431 2432
+#define BSLS_MACROINCREMENTED_VALUE2432 2433
+#define BSLS_MACROINCREMENTED_VALUE2433 2434
+#define BSLS_MACROINCREMENTED_VALUE2434 2435
+#define BSLS_MACROINCREMENTED_VALUE2435 2436
+#define BSLS_MACROINCREMENTED_VALUE2436 2437
+#define BSLS_MACROINCREMENTED_VALUE2437 2438
+#define BSLS_MACROINCREMENTED_VALUE2438 2439
+#define BSLS_MACROINCREMENTED_VALUE2439 2440
+#define BSLS_MACROINCREMENTED_VALUE2440 2441
+#define BSLS_MACROINCREMENTED_VALUE2441 2442
+#define BSLS_MACROINCREMENTED_VALUE2442 2443
+#define BSLS_MACROINCREMENTED_VALUE2443 2444
+#define BSLS_MACROINCREMENTED_VALUE2444 2445
+#define BSLS_MACROINCREMENTED_VALUE2445 2446
+#define BSLS_MACROINCREMENTED_VALUE2446 2447
+#define BSLS_MACROINCREMENTED_VALUE2447 2448
+#define BSLS_MACROINCREMENTED_VALUE2448 2449
+#define BSLS_MACROINCREMENTED_VALUE2449 2450
+#define BSLS_MACROINCREMENTED_VALUE2450 2451
+#define BSLS_MACROINCREMENTED_VALUE2451 2452
+#define BSLS_MACROINCREMENTED_VALUE2452 2453
+#define BSLS_MACROINCREMENTED_VALUE2453 2454
+#define BSLS_MACROINCREMENTED_VALUE2454 2455
+#define BSLS_MACROINCREMENTED_VALUE2455 2456
+#define BSLS_MACROINCREMENTED_VALUE2456 2457
+#define BSLS_MACROINCREMENTED_VALUE2457 2458
+#define BSLS_MACROINCREMENTED_VALUE2458 2459
+#define BSLS_MACROINCREMENTED_VALUE2459 2460
+#define BSLS_MACROINCREMENTED_VALUE2460 2461
+#define BSLS_MACROINCREMENTED_VALUE2461 2462
+#define BSLS_MACROINCREMENTED_VALUE2462 2463
+#define BSLS_MACROINCREMENTED_VALUE2463 2464
+#define BSLS_MACROINCREMENTED_VALUE2464 2465
+#define BSLS_MACROINCREMENTED_VALUE2465 2466
+#define BSLS_MACROINCREMENTED_VALUE2466 2467
+#define BSLS_MACROINCREMENTED_VALUE2467 2468
+#define BSLS_MACROINCREMENTED_VALUE2468 2469
+#define BSLS_MACROINCREMENTED_VALUE2469 2470
+#define BSLS_MACROINCREMENTED_VALUE2470 2471
+#define BSLS_MACROINCREMENTED_VALUE2471 2472
+#define BSLS_MACROINCREMENTED_VALUE2472 2473
+#define BSLS_MACROINCREMENTED_VALUE2473 2474
+#define BSLS_MACROINCREMENTED_VALUE2474 2475
+#define BSLS_MACROINCREMENTED_VALUE2475 2476
+#define BSLS_MACROINCREMENTED_VALUE2476 2477
+#define BSLS_MACROINCREMENTED_VALUE2477 2478
+#define BSLS_MACROINCREMENTED_VALUE2478 2479
+#define BSLS_MACROINCREMENTED_VALUE2479 2480
+#define BSLS_MACROINCREMENTED_VALUE2480 2481
+#define BSLS_MACROINCREMENTED_VALUE2481 2482
+#define BSLS_MACROINCREMENTED_VALUE2482 2483
+#define BSLS_MACROINCREMENTED_VALUE2483 2484
+#define BSLS_MACROINCREMENTED_VALUE2484 2485
+#define BSLS_MACROINCREMENTED_VALUE2485 2486
+#define BSLS_MACROINCREMENTED_VALUE2486 2487
+#define BSLS_MACROINCREMENTED_VALUE2487 2488
+#define BSLS_MACROINCREMENTED_VALUE2488 2489
+#define BSLS_MACROINCREMENTED_VALUE2489 2490
+#define BSLS_MACROINCREMENTED_VALUE2490 2491
+#define BSLS_MACROINCREMENTED_VALUE2491 2492
+#define BSLS_MACROINCREMENTED_VALUE2492 2493
+#define BSLS_MACROINCREMENTED_VALUE2493 2494
+#define BSLS_MACROINCREMENTED_VALUE2494 2495
+#define BSLS_MACROINCREMENTED_VALUE2495 2496
+#define BSLS_MACROINCREMENTED_VALUE2496 2497
+#define BSLS_MACROINCREMENTED_VALUE2497 2498
+#define BSLS_MACROINCREMENTED_VALUE2498 2499
+#define BSLS_MACROINCREMENTED_VALUE2499 2500
+#define BSLS_MACROINCREMENTED_VALUE2500 2501
+#define BSLS_MACROINCREMENTED_VALUE2501 2502
+#define BSLS_MACROINCREMENTED_VALUE2502 2503
+#define BSLS_MACROINCREMENTED_VALUE2503 2504
+#define BSLS_MACROINCREMENTED_VALUE2504 2505
+#define BSLS_MACROINCREMENTED_VALUE2505 2506
+#define BSLS_MACROINCREMENTED_VALUE2506 2507
+#define BSLS_MACROINCREMENTED_VALUE2507 2508
+#define BSLS_MACROINCREMENTED_VALUE2508 2509
+#define BSLS_MACROINCREMENTED_VALUE2509 2510
+#define BSLS_MACROINCREMENTED_VALUE2510 2511
+#define BSLS_MACROINCREMENTED_VALUE2511 2512
+#define BSLS_MACROINCREMENTED_VALUE2512 2513
+#define BSLS_MACROINCREMENTED_VALUE2513 2514
+#define BSLS_MACROINCREMENTED_VALUE2514 2515
+#define BSLS_MACROINCREMENTED_VALUE2515 2516
+#define BSLS_MACROINCREMENTED_VALUE2516 2517
+#define BSLS_MACROINCREMENTED_VALUE2517 2518
+#define BSLS_MACROINCREMENTED_VALUE2518 2519
+#define BSLS_MACROINCREMENTED_VALUE2519 2520
+#define BSLS_MACROINCREMENTED_VALUE2520 2521
+#define BSLS_MACROINCREMENTED_VALUE2521 2522
+#define BSLS_MACROINCREMENTED_VALUE2522 2523
+#define BSLS_MACROINCREMENTED_VALUE2523 2524
+#define BSLS_MACROINCREMENTED_VALUE2524 2525
+#define BSLS_MACROINCREMENTED_VALUE2525 2526
+#define BSLS_MACROINCREMENTED_VALUE2526 2527
+#define BSLS_MACROINCREMENTED_VALUE2527 2528
+#define BSLS_MACROINCREMENTED_VALUE2528 2529
+#define BSLS_MACROINCREMENTED_VALUE2529 2530
+#define BSLS_MACROINCREMENTED_VALUE2530 2531
+#define BSLS_MACROINCREMENTED_VALUE2531 2532
+#define BSLS_MACROINCREMENTED_VALUE2532 2533
+#define BSLS_MACROINCREMENTED_VALUE2533 2534
+#define BSLS_MACROINCREMENTED_VALUE2534 2535
+#define BSLS_MACROINCREMENTED_VALUE2535 2536
+#define BSLS_MACROINCREMENTED_VALUE2536 2537
+#define BSLS_MACROINCREMENTED_VALUE2537 2538
+#define BSLS_MACROINCREMENTED_VALUE2538 2539
+#define BSLS_MACROINCREMENTED_VALUE2539 2540
+#define BSLS_MACROINCREMENTED_VALUE2540 2541
+#define BSLS_MACROINCREMENTED_VALUE2541 2542
+#define BSLS_MACROINCREMENTED_VALUE2542 2543
+#define BSLS_MACROINCREMENTED_VALUE2543 2544
+#define BSLS_MACROINCREMENTED_VALUE2544 2545
+#define BSLS_MACROINCREMENTED_VALUE2545 2546
+#define BSLS_MACROINCREMENTED_VALUE2546 2547
+#define BSLS_MACROINCREMENTED_VALUE2547 2548
+#define BSLS_MACROINCREMENTED_VALUE2548 2549
+#define BSLS_MACROINCREMENTED_VALUE2549 2550
+#define BSLS_MACROINCREMENTED_VALUE2550 2551
+#define BSLS_MACROINCREMENTED_VALUE2551 2552
+#define BSLS_MACROINCREMENTED_VALUE2552 2553
+#define BSLS_MACROINCREMENTED_VALUE2553 2554
+#define BSLS_MACROINCREMENTED_VALUE2554 2555
+#define BSLS_MACROINCREMENTED_VALUE2555 2556
+#define BSLS_MACROINCREMENTED_VALUE2556 2557
+#define BSLS_MACROINCREMENTED_VALUE2557 2558
+#define BSLS_MACROINCREMENTED_VALUE2558 2559
+#define BSLS_MACROINCREMENTED_VALUE2559 2560
+#define BSLS_MACROINCREMENTED_VALUE2560 2561
+#define BSLS_MACROINCREMENTED_VALUE2561 2562
+#define BSLS_MACROINCREMENTED_VALUE2562 2563
+#define BSLS_MACROINCREMENTED_VALUE2563 2564
+#define BSLS_MACROINCREMENTED_VALUE2564 2565
+#define BSLS_MACROINCREMENTED_VALUE2565 2566
+#define BSLS_MACROINCREMENTED_VALUE2566 2567
+#define BSLS_MACROINCREMENTED_VALUE2567 2568
+#define BSLS_MACROINCREMENTED_VALUE2568 2569
+#define BSLS_MACROINCREMENTED_VALUE2569 2570
+#define BSLS_MACROINCREMENTED_VALUE2570 2571
+#define BSLS_MACROINCREMENTED_VALUE2571 2572
+#define BSLS_MACROINCREMENTED_VALUE2572 2573
+#define BSLS_MACROINCREMENTED_VALUE2573 2574
+#define BSLS_MACROINCREMENTED_VALUE2574 2575
+#define BSLS_MACROINCREMENTED_VALUE2575 2576
+#define BSLS_MACROINCREMENTED_VALUE2576 2577
+#define BSLS_MACROINCREMENTED_VALUE2577 2578
+#define BSLS_MACROINCREMENTED_VALUE2578 2579
+#define BSLS_MACROINCREMENTED_VALUE2579 2580
+#define BSLS_MACROINCREMENTED_VALUE2580 2581
+#define BSLS_MACROINCREMENTED_VALUE2581 2582
+#define BSLS_MACROINCREMENTED_VALUE2582 2583
+#define BSLS_MACROINCREMENTED_VALUE2583 2584
+#define BSLS_MACROINCREMENTED_VALUE2584 2585
+#define BSLS_MACROINCREMENTED_VALUE2585 2586
+#define BSLS_MACROINCREMENTED_VALUE2586 2587
+#define BSLS_MACROINCREMENTED_VALUE2587 2588
+#define BSLS_MACROINCREMENTED_VALUE2588 2589
+#define BSLS_MACROINCREMENTED_VALUE2589 2590
+#define BSLS_MACROINCREMENTED_VALUE2590 2591
+#define BSLS_MACROINCREMENTED_VALUE2591 2592
+#define BSLS_MACROINCREMENTED_VALUE2592 2593
+#define BSLS_MACROINCREMENTED_VALUE2593 2594
+#define BSLS_MACROINCREMENTED_VALUE2594 2595
+#define BSLS_MACROINCREMENTED_VALUE2595 2596
+#define BSLS_MACROINCREMENTED_VALUE2596 2597
+#define BSLS_MACROINCREMENTED_VALUE2597 2598
+#define BSLS_MACROINCREMENTED_VALUE2598 2599
+#define BSLS_MACROINCREMENTED_VALUE2599 2600
+#define BSLS_MACROINCREMENTED_VALUE2600 2601
+#define BSLS_MACROINCREMENTED_VALUE2601 2602
+#define BSLS_MACROINCREMENTED_VALUE2602 2603
+#define BSLS_MACROINCREMENTED_VALUE2603 2604
+#define BSLS_MACROINCREMENTED_VALUE2604 2605
+#define BSLS_MACROINCREMENTED_VALUE2605 2606
+#define BSLS_MACROINCREMENTED_VALUE2606 2607
+#define BSLS_MACROINCREMENTED_VALUE2607 2608
+#define BSLS_MACROINCREMENTED_VALUE2608 2609
+#define BSLS_MACROINCREMENTED_VALUE2609 2610
+#define BSLS_MACROINCREMENTED_VALUE2610 2611
+#define BSLS_MACROINCREMENTED_VALUE2611 2612
+#define BSLS_MACROINCREMENTED_VALUE2612 2613
+#define BSLS_MACROINCREMENTED_VALUE2613 2614
+#define BSLS_MACROINCREMENTED_VALUE2614 2615
+#define BSLS_MACROINCREMENTED_VALUE2615 2616
+#define BSLS_MACROINCREMENTED_VALUE2616 2617
+#define BSLS_MACROINCREMENTED_VALUE2617 2618
+#define BSLS_MACROINCREMENTED_VALUE2618 2619
+#define BSLS_MACROINCREMENTED_VALUE2619 2620
+#define BSLS_MACROINCREMENTED_VALUE2620 2621
+#define BSLS_MACROINCREMENTED_VALUE2621 2622
+#define BSLS_MACROINCREMENTED_VALUE2622 2623
+#define BSLS_MACROINCREMENTED_VALUE2623 2624
+#define BSLS_MACROINCREMENTED_VALUE2624 2625
+#define BSLS_MACROINCREMENTED_VALUE2625 2626
+#define BSLS_MACROINCREMENTED_VALUE2626 2627
+#define BSLS_MACROINCREMENTED_VALUE2627 2628
+#define BSLS_MACROINCREMENTED_VALUE2628 2629
+#define BSLS_MACROINCREMENTED_VALUE2629 2630
+#define BSLS_MACROINCREMENTED_VALUE2630 2631
+#define BSLS_MACROINCREMENTED_VALUE2631 2632
+#define BSLS_MACROINCREMENTED_VALUE2632 2633
+#define BSLS_MACROINCREMENTED_VALUE2633 2634
+#define BSLS_MACROINCREMENTED_VALUE2634 2635
+#define BSLS_MACROINCREMENTED_VALUE2635 2636
+#define BSLS_MACROINCREMENTED_VALUE2636 2637
+#define BSLS_MACROINCREMENTED_VALUE2637 2638
+#define BSLS_MACROINCREMENTED_VALUE2638 2639
+#define BSLS_MACROINCREMENTED_VALUE2639 2640
+#define BSLS_MACROINCREMENTED_VALUE2640 2641
+#define BSLS_MACROINCREMENTED_VALUE2641 2642
+#define BSLS_MACROINCREMENTED_VALUE2642 2643
+#define BSLS_MACROINCREMENTED_VALUE2643 2644
+#define BSLS_MACROINCREMENTED_VALUE2644 2645
+#define BSLS_MACROINCREMENTED_VALUE2645 2646
+#define BSLS_MACROINCREMENTED_VALUE2646 2647
+#define BSLS_MACROINCREMENTED_VALUE2647 2648
+#define BSLS_MACROINCREMENTED_VALUE2648 2649
+#define BSLS_MACROINCREMENTED_VALUE2649 2650
+#define BSLS_MACROINCREMENTED_VALUE2650 2651
+#define BSLS_MACROINCREMENTED_VALUE2651 2652
+#define BSLS_MACROINCREMENTED_VALUE2652 2653
+#define BSLS_MACROINCREMENTED_VALUE2653 2654
+#define BSLS_MACROINCREMENTED_VALUE2654 2655
+#define BSLS_MACROINCREMENTED_VALUE2655 2656
+#define BSLS_MACROINCREMENTED_VALUE2656 2657
+#define BSLS_MACROINCREMENTED_VALUE2657 2658
+#define BSLS_MACROINCREMENTED_VALUE2658 2659
+#define BSLS_MACROINCREMENTED_VALUE2659 2660
+#define BSLS_MACROINCREMENTED_VALUE2660 2661
+#define BSLS_MACROINCREMENTED_VALUE2661 2662
+#define BSLS_MACROINCREMENTED_VALUE2662 2663
+#define BSLS_MACROINCREMENTED_VALUE2663 2664
+#define BSLS_MACROINCREMENTED_VALUE2664 2665
+#define BSLS_MACROINCREMENTED_VALUE2665 2666
+#define BSLS_MACROINCREMENTED_VALUE2666 2667
+#define BSLS_MACROINCREMENTED_VALUE2667 2668
+#define BSLS_MACROINCREMENTED_VALUE2668 2669
+#define BSLS_MACROINCREMENTED_VALUE2669 2670
+#define BSLS_MACROINCREMENTED_VALUE2670 2671
+#define BSLS_MACROINCREMENTED_VALUE2671 2672
+#define BSLS_MACROINCREMENTED_VALUE2672 2673
+#define BSLS_MACROINCREMENTED_VALUE2673 2674
+#define BSLS_MACROINCREMENTED_VALUE2674 2675
+#define BSLS_MACROINCREMENTED_VALUE2675 2676
+#define BSLS_MACROINCREMENTED_VALUE2676 2677
+#define BSLS_MACROINCREMENTED_VALUE2677 2678
+#define BSLS_MACROINCREMENTED_VALUE2678 2679
+#define BSLS_MACROINCREMENTED_VALUE2679 2680
+#define BSLS_MACROINCREMENTED_VALUE2680 2681
+#define BSLS_MACROINCREMENTED_VALUE2681 2682
+#define BSLS_MACROINCREMENTED_VALUE2682 2683
+#define BSLS_MACROINCREMENTED_VALUE2683 2684
+#define BSLS_MACROINCREMENTED_VALUE2684 2685
+#define BSLS_MACROINCREMENTED_VALUE2685 2686
+#define BSLS_MACROINCREMENTED_VALUE2686 2687
+#define BSLS_MACROINCREMENTED_VALUE2687 2688
+#define BSLS_MACROINCREMENTED_VALUE2688 2689
+#define BSLS_MACROINCREMENTED_VALUE2689 2690
+#define BSLS_MACROINCREMENTED_VALUE2690 2691
+#define BSLS_MACROINCREMENTED_VALUE2691 2692
+#define BSLS_MACROINCREMENTED_VALUE2692 2693
+#define BSLS_MACROINCREMENTED_VALUE2693 2694
+#define BSLS_MACROINCREMENTED_VALUE2694 2695
+#define BSLS_MACROINCREMENTED_VALUE2695 2696
+#define BSLS_MACROINCREMENTED_VALUE2696 2697
+#define BSLS_MACROINCREMENTED_VALUE2697 2698
+#define BSLS_MACROINCREMENTED_VALUE2698 2699
+#define BSLS_MACROINCREMENTED_VALUE2699 2700
+#define BSLS_MACROINCREMENTED_VALUE2700 2701
+#define BSLS_MACROINCREMENTED_VALUE2701 2702
+#define BSLS_MACROINCREMENTED_VALUE2702 2703
+#define BSLS_MACROINCREMENTED_VALUE2703 2704
+#define BSLS_MACROINCREMENTED_VALUE2704 2705
+#define BSLS_MACROINCREMENTED_VALUE2705 2706
+#define BSLS_MACROINCREMENTED_VALUE2706 2707
+#define BSLS_MACROINCREMENTED_VALUE2707 2708
+#define BSLS_MACROINCREMENTED_VALUE2708 2709
+#define BSLS_MACROINCREMENTED_VALUE2709 2710
+#define BSLS_MACROINCREMENTED_VALUE2710 2711
+#define BSLS_MACROINCREMENTED_VALUE2711 2712
+#define BSLS_MACROINCREMENTED_VALUE2712 2713
+#define BSLS_MACROINCREMENTED_VALUE2713 2714
+#define BSLS_MACROINCREMENTED_VALUE2714 2715
+#define BSLS_MACROINCREMENTED_VALUE2715 2716
+#define BSLS_MACROINCREMENTED_VALUE2716 2717
+#define BSLS_MACROINCREMENTED_VALUE2717 2718
+#define BSLS_MACROINCREMENTED_VALUE2718 2719
+#define BSLS_MACROINCREMENTED_VALUE2719 2720
+#define BSLS_MACROINCREMENTED_VALUE2720 2721
+#define BSLS_MACROINCREMENTED_VALUE2721 2722
+#define BSLS_MACROINCREMENTED_VALUE2722 2723
+#define BSLS_MACROINCREMENTED_VALUE2723 2724
+#define BSLS_MACROINCREMENTED_VALUE2724 2725
+#define BSLS_MACROINCREMENTED_VALUE2725 2726
+#define BSLS_MACROINCREMENTED_VALUE2726 2727
+#define BSLS_MACROINCREMENTED_VALUE2727 2728
+#define BSLS_MACROINCREMENTED_VALUE2728 2729
+#define BSLS_MACROINCREMENTED_VALUE2729 2730
+#define BSLS_MACROINCREMENTED_VALUE2730 2731
+#define BSLS_MACROINCREMENTED_VALUE2731 2732
+#define BSLS_MACROINCREMENTED_VALUE2732 2733
+#define BSLS_MACROINCREMENTED_VALUE2733 2734
+#define BSLS_MACROINCREMENTED_VALUE2734 2735
+#define BSLS_MACROINCREMENTED_VALUE2735 2736
+#define BSLS_MACROINCREMENTED_VALUE2736 2737
+#define BSLS_MACROINCREMENTED_VALUE2737 2738
+#define BSLS_MACROINCREMENTED_VALUE2738 2739
+#define BSLS_MACROINCREMENTED_VALUE2739 2740
+#define BSLS_MACROINCREMENTED_VALUE2740 2741
+#define BSLS_MACROINCREMENTED_VALUE2741 2742
+#define BSLS_MACROINCREMENTED_VALUE2742 2743
+#define BSLS_MACROINCREMENTED_VALUE2743 2744
+#define BSLS_MACROINCREMENTED_VALUE2744 2745
+#define BSLS_MACROINCREMENTED_VALUE2745 2746
+#define BSLS_MACROINCREMENTED_VALUE2746 2747
+#define BSLS_MACROINCREMENTED_VALUE2747 2748
+#define BSLS_MACROINCREMENTED_VALUE2748 2749
+#define BSLS_MACROINCREMENTED_VALUE2749 2750
+#define BSLS_MACROINCREMENTED_VALUE2750 2751
+#define BSLS_MACROINCREMENTED_VALUE2751 2752
+#define BSLS_MACROINCREMENTED_VALUE2752 2753
+#define BSLS_MACROINCREMENTED_VALUE2753 2754
+#define BSLS_MACROINCREMENTED_VALUE2754 2755
+#define BSLS_MACROINCREMENTED_VALUE2755 2756
+#define BSLS_MACROINCREMENTED_VALUE2756 2757
+#define BSLS_MACROINCREMENTED_VALUE2757 2758
+#define BSLS_MACROINCREMENTED_VALUE2758 2759
+#define BSLS_MACROINCREMENTED_VALUE2759 2760
+#define BSLS_MACROINCREMENTED_VALUE2760 2761
+#define BSLS_MACROINCREMENTED_VALUE2761 2762
+#define BSLS_MACROINCREMENTED_VALUE2762 2763
+#define BSLS_MACROINCREMENTED_VALUE2763 2764
+#define BSLS_MACROINCREMENTED_VALUE2764 2765
+#define BSLS_MACROINCREMENTED_VALUE2765 2766
+#define BSLS_MACROINCREMENTED_VALUE2766 2767
+#define BSLS_MACROINCREMENTED_VALUE2767 2768
+#define BSLS_MACROINCREMENTED_VALUE2768 2769
+#define BSLS_MACROINCREMENTED_VALUE2769 2770
+#define BSLS_MACROINCREMENTED_VALUE2770 2771
+#define BSLS_MACROINCREMENTED_VALUE2771 2772
+#define BSLS_MACROINCREMENTED_VALUE2772 2773
+#define BSLS_MACROINCREMENTED_VALUE2773 2774
+#define BSLS_MACROINCREMENTED_VALUE2774 2775
+#define BSLS_MACROINCREMENTED_VALUE2775 2776
+#define BSLS_MACROINCREMENTED_VALUE2776 2777
+#define BSLS_MACROINCREMENTED_VALUE2777 2778
+#define BSLS_MACROINCREMENTED_VALUE2778 2779
+#define BSLS_MACROINCREMENTED_VALUE2779 2780
+#define BSLS_MACROINCREMENTED_VALUE2780 2781
+#define BSLS_MACROINCREMENTED_VALUE2781 2782
+#define BSLS_MACROINCREMENTED_VALUE2782 2783
+#define BSLS_MACROINCREMENTED_VALUE2783 2784
+#define BSLS_MACROINCREMENTED_VALUE2784 2785
+#define BSLS_MACROINCREMENTED_VALUE2785 2786
+#define BSLS_MACROINCREMENTED_VALUE2786 2787
+#define BSLS_MACROINCREMENTED_VALUE2787 2788
+#define BSLS_MACROINCREMENTED_VALUE2788 2789
+#define BSLS_MACROINCREMENTED_VALUE2789 2790
+#define BSLS_MACROINCREMENTED_VALUE2790 2791
+#define BSLS_MACROINCREMENTED_VALUE2791 2792
+#define BSLS_MACROINCREMENTED_VALUE2792 2793
+#define BSLS_MACROINCREMENTED_VALUE2793 2794
+#define BSLS_MACROINCREMENTED_VALUE2794 2795
+#define BSLS_MACROINCREMENTED_VALUE2795 2796
+#define BSLS_MACROINCREMENTED_VALUE2796 2797
+#define BSLS_MACROINCREMENTED_VALUE2797 2798
+#define BSLS_MACROINCREMENTED_VALUE2798 2799
+#define BSLS_MACROINCREMENTED_VALUE2799 2800
+#define BSLS_MACROINCREMENTED_VALUE2800 2801
+#define BSLS_MACROINCREMENTED_VALUE2801 2802
+#define BSLS_MACROINCREMENTED_VALUE2802 2803
+#define BSLS_MACROINCREMENTED_VALUE2803 2804
+#define BSLS_MACROINCREMENTED_VALUE2804 2805
+#define BSLS_MACROINCREMENTED_VALUE2805 2806
+#define BSLS_MACROINCREMENTED_VALUE2806 2807
+#define BSLS_MACROINCREMENTED_VALUE2807 2808
+#define BSLS_MACROINCREMENTED_VALUE2808 2809
+#define BSLS_MACROINCREMENTED_VALUE2809 2810
+#define BSLS_MACROINCREMENTED_VALUE2810 2811
+#define BSLS_MACROINCREMENTED_VALUE2811 2812
+#define BSLS_MACROINCREMENTED_VALUE2812 2813
+#define BSLS_MACROINCREMENTED_VALUE2813 2814
+#define BSLS_MACROINCREMENTED_VALUE2814 2815
+#define BSLS_MACROINCREMENTED_VALUE2815 2816
+#define BSLS_MACROINCREMENTED_VALUE2816 2817
+#define BSLS_MACROINCREMENTED_VALUE2817 2818
+#define BSLS_MACROINCREMENTED_VALUE2818 2819
+#define BSLS_MACROINCREMENTED_VALUE2819 2820
+#define BSLS_MACROINCREMENTED_VALUE2820 2821
+#define BSLS_MACROINCREMENTED_VALUE2821 2822
+#define BSLS_MACROINCREMENTED_VALUE2822 2823
+#define BSLS_MACROINCREMENTED_VALUE2823 2824
+#define BSLS_MACROINCREMENTED_VALUE2824 2825
+#define BSLS_MACROINCREMENTED_VALUE2825 2826
+#define BSLS_MACROINCREMENTED_VALUE2826 2827
+#define BSLS_MACROINCREMENTED_VALUE2827 2828
+#define BSLS_MACROINCREMENTED_VALUE2828 2829
+#define BSLS_MACROINCREMENTED_VALUE2829 2830
+#define BSLS_MACROINCREMENTED_VALUE2830 2831
+#define BSLS_MACROINCREMENTED_VALUE2831 2832
+#define BSLS_MACROINCREMENTED_VALUE2832 2833
+#define BSLS_MACROINCREMENTED_VALUE2833 2834
+#define BSLS_MACROINCREMENTED_VALUE2834 2835
+#define BSLS_MACROINCREMENTED_VALUE2835 2836
+#define BSLS_MACROINCREMENTED_VALUE2836 2837
+#define BSLS_MACROINCREMENTED_VALUE2837 2838
+#define BSLS_MACROINCREMENTED_VALUE2838 2839
+#define BSLS_MACROINCREMENTED_VALUE2839 2840
+#define BSLS_MACROINCREMENTED_VALUE2840 2841
+#define BSLS_MACROINCREMENTED_VALUE2841 2842
+#define BSLS_MACROINCREMENTED_VALUE2842 2843
+#define BSLS_MACROINCREMENTED_VALUE2843 2844
+#define BSLS_MACROINCREMENTED_VALUE2844 2845
+#define BSLS_MACROINCREMENTED_VALUE2845 2846
+#define BSLS_MACROINCREMENTED_VALUE2846 2847
+#define BSLS_MACROINCREMENTED_VALUE2847 2848
+#define BSLS_MACROINCREMENTED_VALUE2848 2849
+#define BSLS_MACROINCREMENTED_VALUE2849 2850
+#define BSLS_MACROINCREMENTED_VALUE2850 2851
+#define BSLS_MACROINCREMENTED_VALUE2851 2852
+#define BSLS_MACROINCREMENTED_VALUE2852 2853
+#define BSLS_MACROINCREMENTED_VALUE2853 2854
+#define BSLS_MACROINCREMENTED_VALUE2854 2855
+#define BSLS_MACROINCREMENTED_VALUE2855 2856
+#define BSLS_MACROINCREMENTED_VALUE2856 2857
+#define BSLS_MACROINCREMENTED_VALUE2857 2858
+#define BSLS_MACROINCREMENTED_VALUE2858 2859
+#define BSLS_MACROINCREMENTED_VALUE2859 2860
+#define BSLS_MACROINCREMENTED_VALUE2860 2861
+#define BSLS_MACROINCREMENTED_VALUE2861 2862
+#define BSLS_MACROINCREMENTED_VALUE2862 2863
+#define BSLS_MACROINCREMENTED_VALUE2863 2864
+#define BSLS_MACROINCREMENTED_VALUE2864 2865
+#define BSLS_MACROINCREMENTED_VALUE2865 2866
+#define BSLS_MACROINCREMENTED_VALUE2866 2867
+#define BSLS_MACROINCREMENTED_VALUE2867 2868
+#define BSLS_MACROINCREMENTED_VALUE2868 2869
+#define BSLS_MACROINCREMENTED_VALUE2869 2870
+#define BSLS_MACROINCREMENTED_VALUE2870 2871
+#define BSLS_MACROINCREMENTED_VALUE2871 2872
+#define BSLS_MACROINCREMENTED_VALUE2872 2873
+#define BSLS_MACROINCREMENTED_VALUE2873 2874
+#define BSLS_MACROINCREMENTED_VALUE2874 2875
+#define BSLS_MACROINCREMENTED_VALUE2875 2876
+#define BSLS_MACROINCREMENTED_VALUE2876 2877
+#define BSLS_MACROINCREMENTED_VALUE2877 2878
+#define BSLS_MACROINCREMENTED_VALUE2878 2879
+#define BSLS_MACROINCREMENTED_VALUE2879 2880
+#define BSLS_MACROINCREMENTED_VALUE2880 2881
+#define BSLS_MACROINCREMENTED_VALUE2881 2882
+#define BSLS_MACROINCREMENTED_VALUE2882 2883
+#define BSLS_MACROINCREMENTED_VALUE2883 2884
+#define BSLS_MACROINCREMENTED_VALUE2884 2885
+#define BSLS_MACROINCREMENTED_VALUE2885 2886
+#define BSLS_MACROINCREMENTED_VALUE2886 2887
+#define BSLS_MACROINCREMENTED_VALUE2887 2888
+#define BSLS_MACROINCREMENTED_VALUE2888 2889
+#define BSLS_MACROINCREMENTED_VALUE2889 2890
+#define BSLS_MACROINCREMENTED_VALUE2890 2891
+#define BSLS_MACROINCREMENTED_VALUE2891 2892
+#define BSLS_MACROINCREMENTED_VALUE2892 2893
+#define BSLS_MACROINCREMENTED_VALUE2893 2894
+#define BSLS_MACROINCREMENTED_VALUE2894 2895
+#define BSLS_MACROINCREMENTED_VALUE2895 2896
+#define BSLS_MACROINCREMENTED_VALUE2896 2897
+#define BSLS_MACROINCREMENTED_VALUE2897 2898
+#define BSLS_MACROINCREMENTED_VALUE2898 2899
+#define BSLS_MACROINCREMENTED_VALUE2899 2900
+#define BSLS_MACROINCREMENTED_VALUE2900 2901
+#define BSLS_MACROINCREMENTED_VALUE2901 2902
+#define BSLS_MACROINCREMENTED_VALUE2902 2903
+#define BSLS_MACROINCREMENTED_VALUE2903 2904
+#define BSLS_MACROINCREMENTED_VALUE2904 2905
+#define BSLS_MACROINCREMENTED_VALUE2905 2906
+#define BSLS_MACROINCREMENTED_VALUE2906 2907
+#define BSLS_MACROINCREMENTED_VALUE2907 2908
+#define BSLS_MACROINCREMENTED_VALUE2908 2909
+#define BSLS_MACROINCREMENTED_VALUE2909 2910
+#define BSLS_MACROINCREMENTED_VALUE2910 2911
+#define BSLS_MACROINCREMENTED_VALUE2911 2912
+#define BSLS_MACROINCREMENTED_VALUE2912 2913
+#define BSLS_MACROINCREMENTED_VALUE2913 2914
+#define BSLS_MACROINCREMENTED_VALUE2914 2915
+#define BSLS_MACROINCREMENTED_VALUE2915 2916
+#define BSLS_MACROINCREMENTED_VALUE2916 2917
+#define BSLS_MACROINCREMENTED_VALUE2917 2918
+#define BSLS_MACROINCREMENTED_VALUE2918 2919
+#define BSLS_MACROINCREMENTED_VALUE2919 2920
+#define BSLS_MACROINCREMENTED_VALUE2920 2921
+#define BSLS_MACROINCREMENTED_VALUE2921 2922
+#define BSLS_MACROINCREMENTED_VALUE2922 2923
+#define BSLS_MACROINCREMENTED_VALUE2923 2924
+#define BSLS_MACROINCREMENTED_VALUE2924 2925
+#define BSLS_MACROINCREMENTED_VALUE2925 2926
+#define BSLS_MACROINCREMENTED_VALUE2926 2927
+#define BSLS_MACROINCREMENTED_VALUE2927 2928
+#define BSLS_MACROINCREMENTED_VALUE2928 2929
+#define BSLS_MACROINCREMENTED_VALUE2929 2930
+#define BSLS_MACROINCREMENTED_VALUE2930 2931
+#define BSLS_MACROINCREMENTED_VALUE2931 2932
+#define BSLS_MACROINCREMENTED_VALUE2932 2933
+#define BSLS_MACROINCREMENTED_VALUE2933 2934
+#define BSLS_MACROINCREMENTED_VALUE2934 2935
+#define BSLS_MACROINCREMENTED_VALUE2935 2936
+#define BSLS_MACROINCREMENTED_VALUE2936 2937
+#define BSLS_MACROINCREMENTED_VALUE2937 2938
+#define BSLS_MACROINCREMENTED_VALUE2938 2939
+#define BSLS_MACROINCREMENTED_VALUE2939 2940
+#define BSLS_MACROINCREMENTED_VALUE2940 2941
+#define BSLS_MACROINCREMENTED_VALUE2941 2942
+#define BSLS_MACROINCREMENTED_VALUE2942 2943
+#define BSLS_MACROINCREMENTED_VALUE2943 2944
+#define BSLS_MACROINCREMENTED_VALUE2944 2945
+#define BSLS_MACROINCREMENTED_VALUE2945 2946
+#define BSLS_MACROINCREMENTED_VALUE2946 2947
+#define BSLS_MACROINCREMENTED_VALUE2947 2948
+#define BSLS_MACROINCREMENTED_VALUE2948 2949
+#define BSLS_MACROINCREMENTED_VALUE2949 2950
+#define BSLS_MACROINCREMENTED_VALUE2950 2951
+#define BSLS_MACROINCREMENTED_VALUE2951 2952
+#define BSLS_MACROINCREMENTED_VALUE2952 2953
+#define BSLS_MACROINCREMENTED_VALUE2953 2954
+#define BSLS_MACROINCREMENTED_VALUE2954 2955
+#define BSLS_MACROINCREMENTED_VALUE2955 2956
+#define BSLS_MACROINCREMENTED_VALUE2956 2957
+#define BSLS_MACROINCREMENTED_VALUE2957 2958
+#define BSLS_MACROINCREMENTED_VALUE2958 2959
+#define BSLS_MACROINCREMENTED_VALUE2959 2960
+#define BSLS_MACROINCREMENTED_VALUE2960 2961
+#define BSLS_MACROINCREMENTED_VALUE2961 2962
+#define BSLS_MACROINCREMENTED_VALUE2962 2963
+#define BSLS_MACROINCREMENTED_VALUE2963 2964
+#define BSLS_MACROINCREMENTED_VALUE2964 2965
+#define BSLS_MACROINCREMENTED_VALUE2965 2966
+#define BSLS_MACROINCREMENTED_VALUE2966 2967
+#define BSLS_MACROINCREMENTED_VALUE2967 2968
+#define BSLS_MACROINCREMENTED_VALUE2968 2969
+#define BSLS_MACROINCREMENTED_VALUE2969 2970
+#define BSLS_MACROINCREMENTED_VALUE2970 2971
+#define BSLS_MACROINCREMENTED_VALUE2971 2972
+#define BSLS_MACROINCREMENTED_VALUE2972 2973
+#define BSLS_MACROINCREMENTED_VALUE2973 2974
+#define BSLS_MACROINCREMENTED_VALUE2974 2975
+#define BSLS_MACROINCREMENTED_VALUE2975 2976
+#define BSLS_MACROINCREMENTED_VALUE2976 2977
+#define BSLS_MACROINCREMENTED_VALUE2977 2978
+#define BSLS_MACROINCREMENTED_VALUE2978 2979
+#define BSLS_MACROINCREMENTED_VALUE2979 2980
+#define BSLS_MACROINCREMENTED_VALUE2980 2981
+#define BSLS_MACROINCREMENTED_VALUE2981 2982
+#define BSLS_MACROINCREMENTED_VALUE2982 2983
+#define BSLS_MACROINCREMENTED_VALUE2983 2984
+#define BSLS_MACROINCREMENTED_VALUE2984 2985
+#define BSLS_MACROINCREMENTED_VALUE2985 2986
+#define BSLS_MACROINCREMENTED_VALUE2986 2987
+#define BSLS_MACROINCREMENTED_VALUE2987 2988
+#define BSLS_MACROINCREMENTED_VALUE2988 2989
+#define BSLS_MACROINCREMENTED_VALUE2989 2990
+#define BSLS_MACROINCREMENTED_VALUE2990 2991
+#define BSLS_MACROINCREMENTED_VALUE2991 2992
+#define BSLS_MACROINCREMENTED_VALUE2992 2993
+#define BSLS_MACROINCREMENTED_VALUE2993 2994
+#define BSLS_MACROINCREMENTED_VALUE2994 2995
+#define BSLS_MACROINCREMENTED_VALUE2995 2996
+#define BSLS_MACROINCREMENTED_VALUE2996 2997
+#define BSLS_MACROINCREMENTED_VALUE2997 2998
+#define BSLS_MACROINCREMENTED_VALUE2998 2999
+#define BSLS_MACROINCREMENTED_VALUE2999 3000
+#define BSLS_MACROINCREMENTED_VALUE3000 3001
+#define BSLS_MACROINCREMENTED_VALUE3001 3002
+#define BSLS_MACROINCREMENTED_VALUE3002 3003
+#define BSLS_MACROINCREMENTED_VALUE3003 3004
+#define BSLS_MACROINCREMENTED_VALUE3004 3005
+#define BSLS_MACROINCREMENTED_VALUE3005 3006
+#define BSLS_MACROINCREMENTED_VALUE3006 3007
+#define BSLS_MACROINCREMENTED_VALUE3007 3008
+#define BSLS_MACROINCREMENTED_VALUE3008 3009
+#define BSLS_MACROINCREMENTED_VALUE3009 3010
+#define BSLS_MACROINCREMENTED_VALUE3010 3011
+#define BSLS_MACROINCREMENTED_VALUE3011 3012
+#define BSLS_MACROINCREMENTED_VALUE3012 3013
+#define BSLS_MACROINCREMENTED_VALUE3013 3014
+#define BSLS_MACROINCREMENTED_VALUE3014 3015
+#define BSLS_MACROINCREMENTED_VALUE3015 3016
+#define BSLS_MACROINCREMENTED_VALUE3016 3017
+#define BSLS_MACROINCREMENTED_VALUE3017 3018
+#define BSLS_MACROINCREMENTED_VALUE3018 3019
+#define BSLS_MACROINCREMENTED_VALUE3019 3020
+#define BSLS_MACROINCREMENTED_VALUE3020 3021
+#define BSLS_MACROINCREMENTED_VALUE3021 3022
+#define BSLS_MACROINCREMENTED_VALUE3022 3023
+#define BSLS_MACROINCREMENTED_VALUE3023 3024
+#define BSLS_MACROINCREMENTED_VALUE3024 3025
+#define BSLS_MACROINCREMENTED_VALUE3025 3026
+#define BSLS_MACROINCREMENTED_VALUE3026 3027
+#define BSLS_MACROINCREMENTED_VALUE3027 3028
+#define BSLS_MACROINCREMENTED_VALUE3028 3029
+#define BSLS_MACROINCREMENTED_VALUE3029 3030
+#define BSLS_MACROINCREMENTED_VALUE3030 3031
+#define BSLS_MACROINCREMENTED_VALUE3031 3032
+#define BSLS_MACROINCREMENTED_VALUE3032 3033
+#define BSLS_MACROINCREMENTED_VALUE3033 3034
+#define BSLS_MACROINCREMENTED_VALUE3034 3035
+#define BSLS_MACROINCREMENTED_VALUE3035 3036
+#define BSLS_MACROINCREMENTED_VALUE3036 3037
+#define BSLS_MACROINCREMENTED_VALUE3037 3038
+#define BSLS_MACROINCREMENTED_VALUE3038 3039
+#define BSLS_MACROINCREMENTED_VALUE3039 3040
+#define BSLS_MACROINCREMENTED_VALUE3040 3041
+#define BSLS_MACROINCREMENTED_VALUE3041 3042
+#define BSLS_MACROINCREMENTED_VALUE3042 3043
+#define BSLS_MACROINCREMENTED_VALUE3043 3044
+#define BSLS_MACROINCREMENTED_VALUE3044 3045
+#define BSLS_MACROINCREMENTED_VALUE3045 3046
+#define BSLS_MACROINCREMENTED_VALUE3046 3047
+#define BSLS_MACROINCREMENTED_VALUE3047 3048
+#define BSLS_MACROINCREMENTED_VALUE3048 3049
+#define BSLS_MACROINCREMENTED_VALUE3049 3050
+#define BSLS_MACROINCREMENTED_VALUE3050 3051
+#define BSLS_MACROINCREMENTED_VALUE3051 3052
+#define BSLS_MACROINCREMENTED_VALUE3052 3053
+#define BSLS_MACROINCREMENTED_VALUE3053 3054
+#define BSLS_MACROINCREMENTED_VALUE3054 3055
+#define BSLS_MACROINCREMENTED_VALUE3055 3056
+#define BSLS_MACROINCREMENTED_VALUE3056 3057
+#define BSLS_MACROINCREMENTED_VALUE3057 3058
+#define BSLS_MACROINCREMENTED_VALUE3058 3059
+#define BSLS_MACROINCREMENTED_VALUE3059 3060
+#define BSLS_MACROINCREMENTED_VALUE3060 3061
+#define BSLS_MACROINCREMENTED_VALUE3061 3062
+#define BSLS_MACROINCREMENTED_VALUE3062 3063
+#define BSLS_MACROINCREMENTED_VALUE3063 3064
+#define BSLS_MACROINCREMENTED_VALUE3064 3065
+#define BSLS_MACROINCREMENTED_VALUE3065 3066
+#define BSLS_MACROINCREMENTED_VALUE3066 3067
+#define BSLS_MACROINCREMENTED_VALUE3067 3068
+#define BSLS_MACROINCREMENTED_VALUE3068 3069
+#define BSLS_MACROINCREMENTED_VALUE3069 3070
+#define BSLS_MACROINCREMENTED_VALUE3070 3071
+#define BSLS_MACROINCREMENTED_VALUE3071 3072
+#define BSLS_MACROINCREMENTED_VALUE3072 3073
+#define BSLS_MACROINCREMENTED_VALUE3073 3074
+#define BSLS_MACROINCREMENTED_VALUE3074 3075
+#define BSLS_MACROINCREMENTED_VALUE3075 3076
+#define BSLS_MACROINCREMENTED_VALUE3076 3077
+#define BSLS_MACROINCREMENTED_VALUE3077 3078
+#define BSLS_MACROINCREMENTED_VALUE3078 3079
+#define BSLS_MACROINCREMENTED_VALUE3079 3080
+#define BSLS_MACROINCREMENTED_VALUE3080 3081
+#define BSLS_MACROINCREMENTED_VALUE3081 3082
+#define BSLS_MACROINCREMENTED_VALUE3082 3083
+#define BSLS_MACROINCREMENTED_VALUE3083 3084
+#define BSLS_MACROINCREMENTED_VALUE3084 3085
+#define BSLS_MACROINCREMENTED_VALUE3085 3086
+#define BSLS_MACROINCREMENTED_VALUE3086 3087
+#define BSLS_MACROINCREMENTED_VALUE3087 3088
+#define BSLS_MACROINCREMENTED_VALUE3088 3089
+#define BSLS_MACROINCREMENTED_VALUE3089 3090
+#define BSLS_MACROINCREMENTED_VALUE3090 3091
+#define BSLS_MACROINCREMENTED_VALUE3091 3092
+#define BSLS_MACROINCREMENTED_VALUE3092 3093
+#define BSLS_MACROINCREMENTED_VALUE3093 3094
+#define BSLS_MACROINCREMENTED_VALUE3094 3095
+#define BSLS_MACROINCREMENTED_VALUE3095 3096
+#define BSLS_MACROINCREMENTED_VALUE3096 3097
+#define BSLS_MACROINCREMENTED_VALUE3097 3098
+#define BSLS_MACROINCREMENTED_VALUE3098 3099
+#define BSLS_MACROINCREMENTED_VALUE3099 3100
+#define BSLS_MACROINCREMENTED_VALUE3100 3101
+#define BSLS_MACROINCREMENTED_VALUE3101 3102
+#define BSLS_MACROINCREMENTED_VALUE3102 3103
+#define BSLS_MACROINCREMENTED_VALUE3103 3104
+#define BSLS_MACROINCREMENTED_VALUE3104 3105
+#define BSLS_MACROINCREMENTED_VALUE3105 3106
+#define BSLS_MACROINCREMENTED_VALUE3106 3107
+#define BSLS_MACROINCREMENTED_VALUE3107 3108
+#define BSLS_MACROINCREMENTED_VALUE3108 3109
+#define BSLS_MACROINCREMENTED_VALUE3109 3110
+#define BSLS_MACROINCREMENTED_VALUE3110 3111
+#define BSLS_MACROINCREMENTED_VALUE3111 3112
+#define BSLS_MACROINCREMENTED_VALUE3112 3113
+#define BSLS_MACROINCREMENTED_VALUE3113 3114
+#define BSLS_MACROINCREMENTED_VALUE3114 3115
+#define BSLS_MACROINCREMENTED_VALUE3115 3116
+#define BSLS_MACROINCREMENTED_VALUE3116 3117
+#define BSLS_MACROINCREMENTED_VALUE3117 3118
+#define BSLS_MACROINCREMENTED_VALUE3118 3119
+#define BSLS_MACROINCREMENTED_VALUE3119 3120
+#define BSLS_MACROINCREMENTED_VALUE3120 3121
+#define BSLS_MACROINCREMENTED_VALUE3121 3122
+#define BSLS_MACROINCREMENTED_VALUE3122 3123
+#define BSLS_MACROINCREMENTED_VALUE3123 3124
+#define BSLS_MACROINCREMENTED_VALUE3124 3125
+#define BSLS_MACROINCREMENTED_VALUE3125 3126
+#define BSLS_MACROINCREMENTED_VALUE3126 3127
+#define BSLS_MACROINCREMENTED_VALUE3127 3128
+#define BSLS_MACROINCREMENTED_VALUE3128 3129
+#define BSLS_MACROINCREMENTED_VALUE3129 3130
+#define BSLS_MACROINCREMENTED_VALUE3130 3131
+#define BSLS_MACROINCREMENTED_VALUE3131 3132
+#define BSLS_MACROINCREMENTED_VALUE3132 3133
+#define BSLS_MACROINCREMENTED_VALUE3133 3134
+#define BSLS_MACROINCREMENTED_VALUE3134 3135
+#define BSLS_MACROINCREMENTED_VALUE3135 3136
+#define BSLS_MACROINCREMENTED_VALUE3136 3137
+#define BSLS_MACROINCREMENTED_VALUE3137 3138
+#define BSLS_MACROINCREMENTED_VALUE3138 3139
+#define BSLS_MACROINCREMENTED_VALUE3139 3140
+#define BSLS_MACROINCREMENTED_VALUE3140 3141
+#define BSLS_MACROINCREMENTED_VALUE3141 3142
+#define BSLS_MACROINCREMENTED_VALUE3142 3143
+#define BSLS_MACROINCREMENTED_VALUE3143 3144
+#define BSLS_MACROINCREMENTED_VALUE3144 3145
+#define BSLS_MACROINCREMENTED_VALUE3145 3146
+#define BSLS_MACROINCREMENTED_VALUE3146 3147
+#define BSLS_MACROINCREMENTED_VALUE3147 3148
+#define BSLS_MACROINCREMENTED_VALUE3148 3149
+#define BSLS_MACROINCREMENTED_VALUE3149 3150
+#define BSLS_MACROINCREMENTED_VALUE3150 3151
+#define BSLS_MACROINCREMENTED_VALUE3151 3152
+#define BSLS_MACROINCREMENTED_VALUE3152 3153
+#define BSLS_MACROINCREMENTED_VALUE3153 3154
+#define BSLS_MACROINCREMENTED_VALUE3154 3155
+#define BSLS_MACROINCREMENTED_VALUE3155 3156
+#define BSLS_MACROINCREMENTED_VALUE3156 3157
+#define BSLS_MACROINCREMENTED_VALUE3157 3158
+#define BSLS_MACROINCREMENTED_VALUE3158 3159
+#define BSLS_MACROINCREMENTED_VALUE3159 3160
+#define BSLS_MACROINCREMENTED_VALUE3160 3161
+#define BSLS_MACROINCREMENTED_VALUE3161 3162
+#define BSLS_MACROINCREMENTED_VALUE3162 3163
+#define BSLS_MACROINCREMENTED_VALUE3163 3164
+#define BSLS_MACROINCREMENTED_VALUE3164 3165
+#define BSLS_MACROINCREMENTED_VALUE3165 3166
+#define BSLS_MACROINCREMENTED_VALUE3166 3167
+#define BSLS_MACROINCREMENTED_VALUE3167 3168
+#define BSLS_MACROINCREMENTED_VALUE3168 3169
+#define BSLS_MACROINCREMENTED_VALUE3169 3170
+#define BSLS_MACROINCREMENTED_VALUE3170 3171
+#define BSLS_MACROINCREMENTED_VALUE3171 3172
+#define BSLS_MACROINCREMENTED_VALUE3172 3173
+#define BSLS_MACROINCREMENTED_VALUE3173 3174
+#define BSLS_MACROINCREMENTED_VALUE3174 3175
+#define BSLS_MACROINCREMENTED_VALUE3175 3176
+#define BSLS_MACROINCREMENTED_VALUE3176 3177
+#define BSLS_MACROINCREMENTED_VALUE3177 3178
+#define BSLS_MACROINCREMENTED_VALUE3178 3179
+#define BSLS_MACROINCREMENTED_VALUE3179 3180
+#define BSLS_MACROINCREMENTED_VALUE3180 3181
+#define BSLS_MACROINCREMENTED_VALUE3181 3182
+#define BSLS_MACROINCREMENTED_VALUE3182 3183
+#define BSLS_MACROINCREMENTED_VALUE3183 3184
+#define BSLS_MACROINCREMENTED_VALUE3184 3185
+#define BSLS_MACROINCREMENTED_VALUE3185 3186
+#define BSLS_MACROINCREMENTED_VALUE3186 3187
+#define BSLS_MACROINCREMENTED_VALUE3187 3188
+#define BSLS_MACROINCREMENTED_VALUE3188 3189
+#define BSLS_MACROINCREMENTED_VALUE3189 3190
+#define BSLS_MACROINCREMENTED_VALUE3190 3191
+#define BSLS_MACROINCREMENTED_VALUE3191 3192
+#define BSLS_MACROINCREMENTED_VALUE3192 3193
+#define BSLS_MACROINCREMENTED_VALUE3193 3194
+#define BSLS_MACROINCREMENTED_VALUE3194 3195
+#define BSLS_MACROINCREMENTED_VALUE3195 3196
+#define BSLS_MACROINCREMENTED_VALUE3196 3197
+#define BSLS_MACROINCREMENTED_VALUE3197 3198
+#define BSLS_MACROINCREMENTED_VALUE3198 3199
+#define BSLS_MACROINCREMENTED_VALUE3199 3200
+#define BSLS_MACROINCREMENTED_VALUE3200 3201
+#define BSLS_MACROINCREMENTED_VALUE3201 3202
+#define BSLS_MACROINCREMENTED_VALUE3202 3203
+#define BSLS_MACROINCREMENTED_VALUE3203 3204
+#define BSLS_MACROINCREMENTED_VALUE3204 3205
+#define BSLS_MACROINCREMENTED_VALUE3205 3206
+#define BSLS_MACROINCREMENTED_VALUE3206 3207
+#define BSLS_MACROINCREMENTED_VALUE3207 3208
+#define BSLS_MACROINCREMENTED_VALUE3208 3209
+#define BSLS_MACROINCREMENTED_VALUE3209 3210
+#define BSLS_MACROINCREMENTED_VALUE3210 3211
+#define BSLS_MACROINCREMENTED_VALUE3211 3212
+#define BSLS_MACROINCREMENTED_VALUE3212 3213
+#define BSLS_MACROINCREMENTED_VALUE3213 3214
+#define BSLS_MACROINCREMENTED_VALUE3214 3215
+#define BSLS_MACROINCREMENTED_VALUE3215 3216
+#define BSLS_MACROINCREMENTED_VALUE3216 3217
+#define BSLS_MACROINCREMENTED_VALUE3217 3218
+#define BSLS_MACROINCREMENTED_VALUE3218 3219
+#define BSLS_MACROINCREMENTED_VALUE3219 3220
+#define BSLS_MACROINCREMENTED_VALUE3220 3221
+#define BSLS_MACROINCREMENTED_VALUE3221 3222
+#define BSLS_MACROINCREMENTED_VALUE3222 3223
+#define BSLS_MACROINCREMENTED_VALUE3223 3224
+#define BSLS_MACROINCREMENTED_VALUE3224 3225
+#define BSLS_MACROINCREMENTED_VALUE3225 3226
+#define BSLS_MACROINCREMENTED_VALUE3226 3227
+#define BSLS_MACROINCREMENTED_VALUE3227 3228
+#define BSLS_MACROINCREMENTED_VALUE3228 3229
+#define BSLS_MACROINCREMENTED_VALUE3229 3230
+#define BSLS_MACROINCREMENTED_VALUE3230 3231
+#define BSLS_MACROINCREMENTED_VALUE3231 3232
+#define BSLS_MACROINCREMENTED_VALUE3232 3233
+#define BSLS_MACROINCREMENTED_VALUE3233 3234
+#define BSLS_MACROINCREMENTED_VALUE3234 3235
+#define BSLS_MACROINCREMENTED_VALUE3235 3236
+#define BSLS_MACROINCREMENTED_VALUE3236 3237
+#define BSLS_MACROINCREMENTED_VALUE3237 3238
+#define BSLS_MACROINCREMENTED_VALUE3238 3239
+#define BSLS_MACROINCREMENTED_VALUE3239 3240
+#define BSLS_MACROINCREMENTED_VALUE3240 3241
+#define BSLS_MACROINCREMENTED_VALUE3241 3242
+#define BSLS_MACROINCREMENTED_VALUE3242 3243
+#define BSLS_MACROINCREMENTED_VALUE3243 3244
+#define BSLS_MACROINCREMENTED_VALUE3244 3245
+#define BSLS_MACROINCREMENTED_VALUE3245 3246
+#define BSLS_MACROINCREMENTED_VALUE3246 3247
+#define BSLS_MACROINCREMENTED_VALUE3247 3248
+#define BSLS_MACROINCREMENTED_VALUE3248 3249
+#define BSLS_MACROINCREMENTED_VALUE3249 3250
+#define BSLS_MACROINCREMENTED_VALUE3250 3251
+#define BSLS_MACROINCREMENTED_VALUE3251 3252
+#define BSLS_MACROINCREMENTED_VALUE3252 3253
+#define BSLS_MACROINCREMENTED_VALUE3253 3254
+#define BSLS_MACROINCREMENTED_VALUE3254 3255
+#define BSLS_MACROINCREMENTED_VALUE3255 3256
+#define BSLS_MACROINCREMENTED_VALUE3256 3257
+#define BSLS_MACROINCREMENTED_VALUE3257 3258
+#define BSLS_MACROINCREMENTED_VALUE3258 3259
+#define BSLS_MACROINCREMENTED_VALUE3259 3260
+#define BSLS_MACROINCREMENTED_VALUE3260 3261
+#define BSLS_MACROINCREMENTED_VALUE3261 3262
+#define BSLS_MACROINCREMENTED_VALUE3262 3263
+#define BSLS_MACROINCREMENTED_VALUE3263 3264
+#define BSLS_MACROINCREMENTED_VALUE3264 3265
+#define BSLS_MACROINCREMENTED_VALUE3265 3266
+#define BSLS_MACROINCREMENTED_VALUE3266 3267
+#define BSLS_MACROINCREMENTED_VALUE3267 3268
+#define BSLS_MACROINCREMENTED_VALUE3268 3269
+#define BSLS_MACROINCREMENTED_VALUE3269 3270
+#define BSLS_MACROINCREMENTED_VALUE3270 3271
+#define BSLS_MACROINCREMENTED_VALUE3271 3272
+#define BSLS_MACROINCREMENTED_VALUE3272 3273
+#define BSLS_MACROINCREMENTED_VALUE3273 3274
+#define BSLS_MACROINCREMENTED_VALUE3274 3275
+#define BSLS_MACROINCREMENTED_VALUE3275 3276
+#define BSLS_MACROINCREMENTED_VALUE3276 3277
+#define BSLS_MACROINCREMENTED_VALUE3277 3278
+#define BSLS_MACROINCREMENTED_VALUE3278 3279
+#define BSLS_MACROINCREMENTED_VALUE3279 3280
+#define BSLS_MACROINCREMENTED_VALUE3280 3281
+#define BSLS_MACROINCREMENTED_VALUE3281 3282
+#define BSLS_MACROINCREMENTED_VALUE3282 3283
+#define BSLS_MACROINCREMENTED_VALUE3283 3284
+#define BSLS_MACROINCREMENTED_VALUE3284 3285
+#define BSLS_MACROINCREMENTED_VALUE3285 3286
+#define BSLS_MACROINCREMENTED_VALUE3286 3287
+#define BSLS_MACROINCREMENTED_VALUE3287 3288
+#define BSLS_MACROINCREMENTED_VALUE3288 3289
+#define BSLS_MACROINCREMENTED_VALUE3289 3290
+#define BSLS_MACROINCREMENTED_VALUE3290 3291
+#define BSLS_MACROINCREMENTED_VALUE3291 3292
+#define BSLS_MACROINCREMENTED_VALUE3292 3293
+#define BSLS_MACROINCREMENTED_VALUE3293 3294
+#define BSLS_MACROINCREMENTED_VALUE3294 3295
+#define BSLS_MACROINCREMENTED_VALUE3295 3296
+#define BSLS_MACROINCREMENTED_VALUE3296 3297
+#define BSLS_MACROINCREMENTED_VALUE3297 3298
+#define BSLS_MACROINCREMENTED_VALUE3298 3299
+#define BSLS_MACROINCREMENTED_VALUE3299 3300
+#define BSLS_MACROINCREMENTED_VALUE3300 3301
+#define BSLS_MACROINCREMENTED_VALUE3301 3302
+#define BSLS_MACROINCREMENTED_VALUE3302 3303
+#define BSLS_MACROINCREMENTED_VALUE3303 3304
+#define BSLS_MACROINCREMENTED_VALUE3304 3305
+#define BSLS_MACROINCREMENTED_VALUE3305 3306
+#define BSLS_MACROINCREMENTED_VALUE3306 3307
+#define BSLS_MACROINCREMENTED_VALUE3307 3308
+#define BSLS_MACROINCREMENTED_VALUE3308 3309
+#define BSLS_MACROINCREMENTED_VALUE3309 3310
+#define BSLS_MACROINCREMENTED_VALUE3310 3311
+#define BSLS_MACROINCREMENTED_VALUE3311 3312
+#define BSLS_MACROINCREMENTED_VALUE3312 3313
+#define BSLS_MACROINCREMENTED_VALUE3313 3314
+#define BSLS_MACROINCREMENTED_VALUE3314 3315
+#define BSLS_MACROINCREMENTED_VALUE3315 3316
+#define BSLS_MACROINCREMENTED_VALUE3316 3317
+#define BSLS_MACROINCREMENTED_VALUE3317 3318
+#define BSLS_MACROINCREMENTED_VALUE3318 3319
+#define BSLS_MACROINCREMENTED_VALUE3319 3320
+#define BSLS_MACROINCREMENTED_VALUE3320 3321
+#define BSLS_MACROINCREMENTED_VALUE3321 3322
+#define BSLS_MACROINCREMENTED_VALUE3322 3323
+#define BSLS_MACROINCREMENTED_VALUE3323 3324
+#define BSLS_MACROINCREMENTED_VALUE3324 3325
+#define BSLS_MACROINCREMENTED_VALUE3325 3326
+#define BSLS_MACROINCREMENTED_VALUE3326 3327
+#define BSLS_MACROINCREMENTED_VALUE3327 3328
+#define BSLS_MACROINCREMENTED_VALUE3328 3329
+#define BSLS_MACROINCREMENTED_VALUE3329 3330
+#define BSLS_MACROINCREMENTED_VALUE3330 3331
+#define BSLS_MACROINCREMENTED_VALUE3331 3332
+#define BSLS_MACROINCREMENTED_VALUE3332 3333
+#define BSLS_MACROINCREMENTED_VALUE3333 3334
+#define BSLS_MACROINCREMENTED_VALUE3334 3335
+#define BSLS_MACROINCREMENTED_VALUE3335 3336
+#define BSLS_MACROINCREMENTED_VALUE3336 3337
+#define BSLS_MACROINCREMENTED_VALUE3337 3338
+#define BSLS_MACROINCREMENTED_VALUE3338 3339
+#define BSLS_MACROINCREMENTED_VALUE3339 3340
+#define BSLS_MACROINCREMENTED_VALUE3340 3341
+#define BSLS_MACROINCREMENTED_VALUE3341 3342
+#define BSLS_MACROINCREMENTED_VALUE3342 3343
+#define BSLS_MACROINCREMENTED_VALUE3343 3344
+#define BSLS_MACROINCREMENTED_VALUE3344 3345
+#define BSLS_MACROINCREMENTED_VALUE3345 3346
+#define BSLS_MACROINCREMENTED_VALUE3346 3347
+#define BSLS_MACROINCREMENTED_VALUE3347 3348
+#define BSLS_MACROINCREMENTED_VALUE3348 3349
+#define BSLS_MACROINCREMENTED_VALUE3349 3350
+#define BSLS_MACROINCREMENTED_VALUE3350 3351
+#define BSLS_MACROINCREMENTED_VALUE3351 3352
+#define BSLS_MACROINCREMENTED_VALUE3352 3353
+#define BSLS_MACROINCREMENTED_VALUE3353 3354
+#define BSLS_MACROINCREMENTED_VALUE3354 3355
+#define BSLS_MACROINCREMENTED_VALUE3355 3356
+#define BSLS_MACROINCREMENTED_VALUE3356 3357
+#define BSLS_MACROINCREMENTED_VALUE3357 3358
+#define BSLS_MACROINCREMENTED_VALUE3358 3359
+#define BSLS_MACROINCREMENTED_VALUE3359 3360
+#define BSLS_MACROINCREMENTED_VALUE3360 3361
+#define BSLS_MACROINCREMENTED_VALUE3361 3362
+#define BSLS_MACROINCREMENTED_VALUE3362 3363
+#define BSLS_MACROINCREMENTED_VALUE3363 3364
+#define BSLS_MACROINCREMENTED_VALUE3364 3365
+#define BSLS_MACROINCREMENTED_VALUE3365 3366
+#define BSLS_MACROINCREMENTED_VALUE3366 3367
+#define BSLS_MACROINCREMENTED_VALUE3367 3368
+#define BSLS_MACROINCREMENTED_VALUE3368 3369
+#define BSLS_MACROINCREMENTED_VALUE3369 3370
+#define BSLS_MACROINCREMENTED_VALUE3370 3371
+#define BSLS_MACROINCREMENTED_VALUE3371 3372
+#define BSLS_MACROINCREMENTED_VALUE3372 3373
+#define BSLS_MACROINCREMENTED_VALUE3373 3374
+#define BSLS_MACROINCREMENTED_VALUE3374 3375
+#define BSLS_MACROINCREMENTED_VALUE3375 3376
+#define BSLS_MACROINCREMENTED_VALUE3376 3377
+#define BSLS_MACROINCREMENTED_VALUE3377 3378
+#define BSLS_MACROINCREMENTED_VALUE3378 3379
+#define BSLS_MACROINCREMENTED_VALUE3379 3380
+#define BSLS_MACROINCREMENTED_VALUE3380 3381
+#define BSLS_MACROINCREMENTED_VALUE3381 3382
+#define BSLS_MACROINCREMENTED_VALUE3382 3383
+#define BSLS_MACROINCREMENTED_VALUE3383 3384
+#define BSLS_MACROINCREMENTED_VALUE3384 3385
+#define BSLS_MACROINCREMENTED_VALUE3385 3386
+#define BSLS_MACROINCREMENTED_VALUE3386 3387
+#define BSLS_MACROINCREMENTED_VALUE3387 3388
+#define BSLS_MACROINCREMENTED_VALUE3388 3389
+#define BSLS_MACROINCREMENTED_VALUE3389 3390
+#define BSLS_MACROINCREMENTED_VALUE3390 3391
+#define BSLS_MACROINCREMENTED_VALUE3391 3392
+#define BSLS_MACROINCREMENTED_VALUE3392 3393
+#define BSLS_MACROINCREMENTED_VALUE3393 3394
+#define BSLS_MACROINCREMENTED_VALUE3394 3395
+#define BSLS_MACROINCREMENTED_VALUE3395 3396
+#define BSLS_MACROINCREMENTED_VALUE3396 3397
+#define BSLS_MACROINCREMENTED_VALUE3397 3398
+#define BSLS_MACROINCREMENTED_VALUE3398 3399
+#define BSLS_MACROINCREMENTED_VALUE3399 3400
+#define BSLS_MACROINCREMENTED_VALUE3400 3401
+#define BSLS_MACROINCREMENTED_VALUE3401 3402
+#define BSLS_MACROINCREMENTED_VALUE3402 3403
+#define BSLS_MACROINCREMENTED_VALUE3403 3404
+#define BSLS_MACROINCREMENTED_VALUE3404 3405
+#define BSLS_MACROINCREMENTED_VALUE3405 3406
+#define BSLS_MACROINCREMENTED_VALUE3406 3407
+#define BSLS_MACROINCREMENTED_VALUE3407 3408
+#define BSLS_MACROINCREMENTED_VALUE3408 3409
+#define BSLS_MACROINCREMENTED_VALUE3409 3410
+#define BSLS_MACROINCREMENTED_VALUE3410 3411
+#define BSLS_MACROINCREMENTED_VALUE3411 3412
+#define BSLS_MACROINCREMENTED_VALUE3412 3413
+#define BSLS_MACROINCREMENTED_VALUE3413 3414
+#define BSLS_MACROINCREMENTED_VALUE3414 3415
+#define BSLS_MACROINCREMENTED_VALUE3415 3416
+#define BSLS_MACROINCREMENTED_VALUE3416 3417
+#define BSLS_MACROINCREMENTED_VALUE3417 3418
+#define BSLS_MACROINCREMENTED_VALUE3418 3419
+#define BSLS_MACROINCREMENTED_VALUE3419 3420
+#define BSLS_MACROINCREMENTED_VALUE3420 3421
+#define BSLS_MACROINCREMENTED_VALUE3421 3422
+#define BSLS_MACROINCREMENTED_VALUE3422 3423
+#define BSLS_MACROINCREMENTED_VALUE3423 3424
+#define BSLS_MACROINCREMENTED_VALUE3424 3425
+#define BSLS_MACROINCREMENTED_VALUE3425 3426
+#define BSLS_MACROINCREMENTED_VALUE3426 3427
+#define BSLS_MACROINCREMENTED_VALUE3427 3428
+#define BSLS_MACROINCREMENTED_VALUE3428 3429
+#define BSLS_MACROINCREMENTED_VALUE3429 3430
+#define BSLS_MACROINCREMENTED_VALUE3430 3431
+#define BSLS_MACROINCREMENTED_VALUE3431 3432
+#define BSLS_MACROINCREMENTED_VALUE3432 3433
+#define BSLS_MACROINCREMENTED_VALUE3433 3434
+#define BSLS_MACROINCREMENTED_VALUE3434 3435
+#define BSLS_MACROINCREMENTED_VALUE3435 3436
+#define BSLS_MACROINCREMENTED_VALUE3436 3437
+#define BSLS_MACROINCREMENTED_VALUE3437 3438
+#define BSLS_MACROINCREMENTED_VALUE3438 3439
+#define BSLS_MACROINCREMENTED_VALUE3439 3440
+#define BSLS_MACROINCREMENTED_VALUE3440 3441
+#define BSLS_MACROINCREMENTED_VALUE3441 3442
+#define BSLS_MACROINCREMENTED_VALUE3442 3443
+#define BSLS_MACROINCREMENTED_VALUE3443 3444
+#define BSLS_MACROINCREMENTED_VALUE3444 3445
+#define BSLS_MACROINCREMENTED_VALUE3445 3446
+#define BSLS_MACROINCREMENTED_VALUE3446 3447
+#define BSLS_MACROINCREMENTED_VALUE3447 3448
+#define BSLS_MACROINCREMENTED_VALUE3448 3449
+#define BSLS_MACROINCREMENTED_VALUE3449 3450
+#define BSLS_MACROINCREMENTED_VALUE3450 3451
+#define BSLS_MACROINCREMENTED_VALUE3451 3452
+#define BSLS_MACROINCREMENTED_VALUE3452 3453
+#define BSLS_MACROINCREMENTED_VALUE3453 3454
+#define BSLS_MACROINCREMENTED_VALUE3454 3455
+#define BSLS_MACROINCREMENTED_VALUE3455 3456
+#define BSLS_MACROINCREMENTED_VALUE3456 3457
+#define BSLS_MACROINCREMENTED_VALUE3457 3458
+#define BSLS_MACROINCREMENTED_VALUE3458 3459
+#define BSLS_MACROINCREMENTED_VALUE3459 3460
+#define BSLS_MACROINCREMENTED_VALUE3460 3461
+#define BSLS_MACROINCREMENTED_VALUE3461 3462
+#define BSLS_MACROINCREMENTED_VALUE3462 3463
+#define BSLS_MACROINCREMENTED_VALUE3463 3464
+#define BSLS_MACROINCREMENTED_VALUE3464 3465
+#define BSLS_MACROINCREMENTED_VALUE3465 3466
+#define BSLS_MACROINCREMENTED_VALUE3466 3467
+#define BSLS_MACROINCREMENTED_VALUE3467 3468
+#define BSLS_MACROINCREMENTED_VALUE3468 3469
+#define BSLS_MACROINCREMENTED_VALUE3469 3470
+#define BSLS_MACROINCREMENTED_VALUE3470 3471
+#define BSLS_MACROINCREMENTED_VALUE3471 3472
+#define BSLS_MACROINCREMENTED_VALUE3472 3473
+#define BSLS_MACROINCREMENTED_VALUE3473 3474
+#define BSLS_MACROINCREMENTED_VALUE3474 3475
+#define BSLS_MACROINCREMENTED_VALUE3475 3476
+#define BSLS_MACROINCREMENTED_VALUE3476 3477
+#define BSLS_MACROINCREMENTED_VALUE3477 3478
+#define BSLS_MACROINCREMENTED_VALUE3478 3479
+#define BSLS_MACROINCREMENTED_VALUE3479 3480
+#define BSLS_MACROINCREMENTED_VALUE3480 3481
+#define BSLS_MACROINCREMENTED_VALUE3481 3482
+#define BSLS_MACROINCREMENTED_VALUE3482 3483
+#define BSLS_MACROINCREMENTED_VALUE3483 3484
+#define BSLS_MACROINCREMENTED_VALUE3484 3485
+#define BSLS_MACROINCREMENTED_VALUE3485 3486
+#define BSLS_MACROINCREMENTED_VALUE3486 3487
+#define BSLS_MACROINCREMENTED_VALUE3487 3488
+#define BSLS_MACROINCREMENTED_VALUE3488 3489
+#define BSLS_MACROINCREMENTED_VALUE3489 3490
+#define BSLS_MACROINCREMENTED_VALUE3490 3491
+#define BSLS_MACROINCREMENTED_VALUE3491 3492
+#define BSLS_MACROINCREMENTED_VALUE3492 3493
+#define BSLS_MACROINCREMENTED_VALUE3493 3494
+#define BSLS_MACROINCREMENTED_VALUE3494 3495
+#define BSLS_MACROINCREMENTED_VALUE3495 3496
+#define BSLS_MACROINCREMENTED_VALUE3496 3497
+#define BSLS_MACROINCREMENTED_VALUE3497 3498
+#define BSLS_MACROINCREMENTED_VALUE3498 3499
+#define BSLS_MACROINCREMENTED_VALUE3499 3500
+#define BSLS_MACROINCREMENTED_VALUE3500 3501
+#define BSLS_MACROINCREMENTED_VALUE3501 3502
+#define BSLS_MACROINCREMENTED_VALUE3502 3503
+#define BSLS_MACROINCREMENTED_VALUE3503 3504
+#define BSLS_MACROINCREMENTED_VALUE3504 3505
+#define BSLS_MACROINCREMENTED_VALUE3505 3506
+#define BSLS_MACROINCREMENTED_VALUE3506 3507
+#define BSLS_MACROINCREMENTED_VALUE3507 3508
+#define BSLS_MACROINCREMENTED_VALUE3508 3509
+#define BSLS_MACROINCREMENTED_VALUE3509 3510
+#define BSLS_MACROINCREMENTED_VALUE3510 3511
+#define BSLS_MACROINCREMENTED_VALUE3511 3512
+#define BSLS_MACROINCREMENTED_VALUE3512 3513
+#define BSLS_MACROINCREMENTED_VALUE3513 3514
+#define BSLS_MACROINCREMENTED_VALUE3514 3515
+#define BSLS_MACROINCREMENTED_VALUE3515 3516
+#define BSLS_MACROINCREMENTED_VALUE3516 3517
+#define BSLS_MACROINCREMENTED_VALUE3517 3518
+#define BSLS_MACROINCREMENTED_VALUE3518 3519
+#define BSLS_MACROINCREMENTED_VALUE3519 3520
+#define BSLS_MACROINCREMENTED_VALUE3520 3521
+#define BSLS_MACROINCREMENTED_VALUE3521 3522
+#define BSLS_MACROINCREMENTED_VALUE3522 3523
+#define BSLS_MACROINCREMENTED_VALUE3523 3524
+#define BSLS_MACROINCREMENTED_VALUE3524 3525
+#define BSLS_MACROINCREMENTED_VALUE3525 3526
+#define BSLS_MACROINCREMENTED_VALUE3526 3527
+#define BSLS_MACROINCREMENTED_VALUE3527 3528
+#define BSLS_MACROINCREMENTED_VALUE3528 3529
+#define BSLS_MACROINCREMENTED_VALUE3529 3530
+#define BSLS_MACROINCREMENTED_VALUE3530 3531
+#define BSLS_MACROINCREMENTED_VALUE3531 3532
+#define BSLS_MACROINCREMENTED_VALUE3532 3533
+#define BSLS_MACROINCREMENTED_VALUE3533 3534
+#define BSLS_MACROINCREMENTED_VALUE3534 3535
+#define BSLS_MACROINCREMENTED_VALUE3535 3536
+#define BSLS_MACROINCREMENTED_VALUE3536 3537
+#define BSLS_MACROINCREMENTED_VALUE3537 3538
+#define BSLS_MACROINCREMENTED_VALUE3538 3539
+#define BSLS_MACROINCREMENTED_VALUE3539 3540
+#define BSLS_MACROINCREMENTED_VALUE3540 3541
+#define BSLS_MACROINCREMENTED_VALUE3541 3542
+#define BSLS_MACROINCREMENTED_VALUE3542 3543
+#define BSLS_MACROINCREMENTED_VALUE3543 3544
+#define BSLS_MACROINCREMENTED_VALUE3544 3545
+#define BSLS_MACROINCREMENTED_VALUE3545 3546
+#define BSLS_MACROINCREMENTED_VALUE3546 3547
+#define BSLS_MACROINCREMENTED_VALUE3547 3548
+#define BSLS_MACROINCREMENTED_VALUE3548 3549
+#define BSLS_MACROINCREMENTED_VALUE3549 3550
+#define BSLS_MACROINCREMENTED_VALUE3550 3551
+#define BSLS_MACROINCREMENTED_VALUE3551 3552
+#define BSLS_MACROINCREMENTED_VALUE3552 3553
+#define BSLS_MACROINCREMENTED_VALUE3553 3554
+#define BSLS_MACROINCREMENTED_VALUE3554 3555
+#define BSLS_MACROINCREMENTED_VALUE3555 3556
+#define BSLS_MACROINCREMENTED_VALUE3556 3557
+#define BSLS_MACROINCREMENTED_VALUE3557 3558
+#define BSLS_MACROINCREMENTED_VALUE3558 3559
+#define BSLS_MACROINCREMENTED_VALUE3559 3560
+#define BSLS_MACROINCREMENTED_VALUE3560 3561
+#define BSLS_MACROINCREMENTED_VALUE3561 3562
+#define BSLS_MACROINCREMENTED_VALUE3562 3563
+#define BSLS_MACROINCREMENTED_VALUE3563 3564
+#define BSLS_MACROINCREMENTED_VALUE3564 3565
+#define BSLS_MACROINCREMENTED_VALUE3565 3566
+#define BSLS_MACROINCREMENTED_VALUE3566 3567
+#define BSLS_MACROINCREMENTED_VALUE3567 3568
+#define BSLS_MACROINCREMENTED_VALUE3568 3569
+#define BSLS_MACROINCREMENTED_VALUE3569 3570
+#define BSLS_MACROINCREMENTED_VALUE3570 3571
+#define BSLS_MACROINCREMENTED_VALUE3571 3572
+#define BSLS_MACROINCREMENTED_VALUE3572 3573
+#define BSLS_MACROINCREMENTED_VALUE3573 3574
+#define BSLS_MACROINCREMENTED_VALUE3574 3575
+#define BSLS_MACROINCREMENTED_VALUE3575 3576
+#define BSLS_MACROINCREMENTED_VALUE3576 3577
+#define BSLS_MACROINCREMENTED_VALUE3577 3578
+#define BSLS_MACROINCREMENTED_VALUE3578 3579
+#define BSLS_MACROINCREMENTED_VALUE3579 3580
+#define BSLS_MACROINCREMENTED_VALUE3580 3581
+#define BSLS_MACROINCREMENTED_VALUE3581 3582
+#define BSLS_MACROINCREMENTED_VALUE3582 3583
+#define BSLS_MACROINCREMENTED_VALUE3583 3584
+#define BSLS_MACROINCREMENTED_VALUE3584 3585
+#define BSLS_MACROINCREMENTED_VALUE3585 3586
+#define BSLS_MACROINCREMENTED_VALUE3586 3587
+#define BSLS_MACROINCREMENTED_VALUE3587 3588
+#define BSLS_MACROINCREMENTED_VALUE3588 3589
+#define BSLS_MACROINCREMENTED_VALUE3589 3590
+#define BSLS_MACROINCREMENTED_VALUE3590 3591
+#define BSLS_MACROINCREMENTED_VALUE3591 3592
+#define BSLS_MACROINCREMENTED_VALUE3592 3593
+#define BSLS_MACROINCREMENTED_VALUE3593 3594
+#define BSLS_MACROINCREMENTED_VALUE3594 3595
+#define BSLS_MACROINCREMENTED_VALUE3595 3596
+#define BSLS_MACROINCREMENTED_VALUE3596 3597
+#define BSLS_MACROINCREMENTED_VALUE3597 3598
+#define BSLS_MACROINCREMENTED_VALUE3598 3599
+#define BSLS_MACROINCREMENTED_VALUE3599 3600
+#define BSLS_MACROINCREMENTED_VALUE3600 3601
+#define BSLS_MACROINCREMENTED_VALUE3601 3602
+#define BSLS_MACROINCREMENTED_VALUE3602 3603
+#define BSLS_MACROINCREMENTED_VALUE3603 3604
+#define BSLS_MACROINCREMENTED_VALUE3604 3605
+#define BSLS_MACROINCREMENTED_VALUE3605 3606
+#define BSLS_MACROINCREMENTED_VALUE3606 3607
+#define BSLS_MACROINCREMENTED_VALUE3607 3608
+#define BSLS_MACROINCREMENTED_VALUE3608 3609
+#define BSLS_MACROINCREMENTED_VALUE3609 3610
+#define BSLS_MACROINCREMENTED_VALUE3610 3611
+#define BSLS_MACROINCREMENTED_VALUE3611 3612
+#define BSLS_MACROINCREMENTED_VALUE3612 3613
+#define BSLS_MACROINCREMENTED_VALUE3613 3614
+#define BSLS_MACROINCREMENTED_VALUE3614 3615
+#define BSLS_MACROINCREMENTED_VALUE3615 3616
+#define BSLS_MACROINCREMENTED_VALUE3616 3617
+#define BSLS_MACROINCREMENTED_VALUE3617 3618
+#define BSLS_MACROINCREMENTED_VALUE3618 3619
+#define BSLS_MACROINCREMENTED_VALUE3619 3620
+#define BSLS_MACROINCREMENTED_VALUE3620 3621
+#define BSLS_MACROINCREMENTED_VALUE3621 3622
+#define BSLS_MACROINCREMENTED_VALUE3622 3623
+#define BSLS_MACROINCREMENTED_VALUE3623 3624
+#define BSLS_MACROINCREMENTED_VALUE3624 3625
+#define BSLS_MACROINCREMENTED_VALUE3625 3626
+#define BSLS_MACROINCREMENTED_VALUE3626 3627
+#define BSLS_MACROINCREMENTED_VALUE3627 3628
+#define BSLS_MACROINCREMENTED_VALUE3628 3629
+#define BSLS_MACROINCREMENTED_VALUE3629 3630
+#define BSLS_MACROINCREMENTED_VALUE3630 3631
+#define BSLS_MACROINCREMENTED_VALUE3631 3632
+#define BSLS_MACROINCREMENTED_VALUE3632 3633
+#define BSLS_MACROINCREMENTED_VALUE3633 3634
+#define BSLS_MACROINCREMENTED_VALUE3634 3635
+#define BSLS_MACROINCREMENTED_VALUE3635 3636
+#define BSLS_MACROINCREMENTED_VALUE3636 3637
+#define BSLS_MACROINCREMENTED_VALUE3637 3638
+#define BSLS_MACROINCREMENTED_VALUE3638 3639
+#define BSLS_MACROINCREMENTED_VALUE3639 3640
+#define BSLS_MACROINCREMENTED_VALUE3640 3641
+#define BSLS_MACROINCREMENTED_VALUE3641 3642
+#define BSLS_MACROINCREMENTED_VALUE3642 3643
+#define BSLS_MACROINCREMENTED_VALUE3643 3644
+#define BSLS_MACROINCREMENTED_VALUE3644 3645
+#define BSLS_MACROINCREMENTED_VALUE3645 3646
+#define BSLS_MACROINCREMENTED_VALUE3646 3647
+#define BSLS_MACROINCREMENTED_VALUE3647 3648
+#define BSLS_MACROINCREMENTED_VALUE3648 3649
+#define BSLS_MACROINCREMENTED_VALUE3649 3650
+#define BSLS_MACROINCREMENTED_VALUE3650 3651
+#define BSLS_MACROINCREMENTED_VALUE3651 3652
+#define BSLS_MACROINCREMENTED_VALUE3652 3653
+#define BSLS_MACROINCREMENTED_VALUE3653 3654
+#define BSLS_MACROINCREMENTED_VALUE3654 3655
+#define BSLS_MACROINCREMENTED_VALUE3655 3656
+#define BSLS_MACROINCREMENTED_VALUE3656 3657
+#define BSLS_MACROINCREMENTED_VALUE3657 3658
+#define BSLS_MACROINCREMENTED_VALUE3658 3659
+#define BSLS_MACROINCREMENTED_VALUE3659 3660
+#define BSLS_MACROINCREMENTED_VALUE3660 3661
+#define BSLS_MACROINCREMENTED_VALUE3661 3662
+#define BSLS_MACROINCREMENTED_VALUE3662 3663
+#define BSLS_MACROINCREMENTED_VALUE3663 3664
+#define BSLS_MACROINCREMENTED_VALUE3664 3665
+#define BSLS_MACROINCREMENTED_VALUE3665 3666
+#define BSLS_MACROINCREMENTED_VALUE3666 3667
+#define BSLS_MACROINCREMENTED_VALUE3667 3668
+#define BSLS_MACROINCREMENTED_VALUE3668 3669
+#define BSLS_MACROINCREMENTED_VALUE3669 3670
+#define BSLS_MACROINCREMENTED_VALUE3670 3671
+#define BSLS_MACROINCREMENTED_VALUE3671 3672
+#define BSLS_MACROINCREMENTED_VALUE3672 3673
+#define BSLS_MACROINCREMENTED_VALUE3673 3674
+#define BSLS_MACROINCREMENTED_VALUE3674 3675
+#define BSLS_MACROINCREMENTED_VALUE3675 3676
+#define BSLS_MACROINCREMENTED_VALUE3676 3677
+#define BSLS_MACROINCREMENTED_VALUE3677 3678
+#define BSLS_MACROINCREMENTED_VALUE3678 3679
+#define BSLS_MACROINCREMENTED_VALUE3679 3680
+#define BSLS_MACROINCREMENTED_VALUE3680 3681
+#define BSLS_MACROINCREMENTED_VALUE3681 3682
+#define BSLS_MACROINCREMENTED_VALUE3682 3683
+#define BSLS_MACROINCREMENTED_VALUE3683 3684
+#define BSLS_MACROINCREMENTED_VALUE3684 3685
+#define BSLS_MACROINCREMENTED_VALUE3685 3686
+#define BSLS_MACROINCREMENTED_VALUE3686 3687
+#define BSLS_MACROINCREMENTED_VALUE3687 3688
+#define BSLS_MACROINCREMENTED_VALUE3688 3689
+#define BSLS_MACROINCREMENTED_VALUE3689 3690
+#define BSLS_MACROINCREMENTED_VALUE3690 3691
+#define BSLS_MACROINCREMENTED_VALUE3691 3692
+#define BSLS_MACROINCREMENTED_VALUE3692 3693
+#define BSLS_MACROINCREMENTED_VALUE3693 3694
+#define BSLS_MACROINCREMENTED_VALUE3694 3695
+#define BSLS_MACROINCREMENTED_VALUE3695 3696
+#define BSLS_MACROINCREMENTED_VALUE3696 3697
+#define BSLS_MACROINCREMENTED_VALUE3697 3698
+#define BSLS_MACROINCREMENTED_VALUE3698 3699
+#define BSLS_MACROINCREMENTED_VALUE3699 3700
+#define BSLS_MACROINCREMENTED_VALUE3700 3701
+#define BSLS_MACROINCREMENTED_VALUE3701 3702
+#define BSLS_MACROINCREMENTED_VALUE3702 3703
+#define BSLS_MACROINCREMENTED_VALUE3703 3704
+#define BSLS_MACROINCREMENTED_VALUE3704 3705
+#define BSLS_MACROINCREMENTED_VALUE3705 3706
+#define BSLS_MACROINCREMENTED_VALUE3706 3707
+#define BSLS_MACROINCREMENTED_VALUE3707 3708
+#define BSLS_MACROINCREMENTED_VALUE3708 3709
+#define BSLS_MACROINCREMENTED_VALUE3709 3710
+#define BSLS_MACROINCREMENTED_VALUE3710 3711
+#define BSLS_MACROINCREMENTED_VALUE3711 3712
+#define BSLS_MACROINCREMENTED_VALUE3712 3713
+#define BSLS_MACROINCREMENTED_VALUE3713 3714
+#define BSLS_MACROINCREMENTED_VALUE3714 3715
+#define BSLS_MACROINCREMENTED_VALUE3715 3716
+#define BSLS_MACROINCREMENTED_VALUE3716 3717
+#define BSLS_MACROINCREMENTED_VALUE3717 3718
+#define BSLS_MACROINCREMENTED_VALUE3718 3719
+#define BSLS_MACROINCREMENTED_VALUE3719 3720
+#define BSLS_MACROINCREMENTED_VALUE3720 3721
+#define BSLS_MACROINCREMENTED_VALUE3721 3722
+#define BSLS_MACROINCREMENTED_VALUE3722 3723
+#define BSLS_MACROINCREMENTED_VALUE3723 3724
+#define BSLS_MACROINCREMENTED_VALUE3724 3725
+#define BSLS_MACROINCREMENTED_VALUE3725 3726
+#define BSLS_MACROINCREMENTED_VALUE3726 3727
+#define BSLS_MACROINCREMENTED_VALUE3727 3728
+#define BSLS_MACROINCREMENTED_VALUE3728 3729
+#define BSLS_MACROINCREMENTED_VALUE3729 3730
+#define BSLS_MACROINCREMENTED_VALUE3730 3731
+#define BSLS_MACROINCREMENTED_VALUE3731 3732
+#define BSLS_MACROINCREMENTED_VALUE3732 3733
+#define BSLS_MACROINCREMENTED_VALUE3733 3734
+#define BSLS_MACROINCREMENTED_VALUE3734 3735
+#define BSLS_MACROINCREMENTED_VALUE3735 3736
+#define BSLS_MACROINCREMENTED_VALUE3736 3737
+#define BSLS_MACROINCREMENTED_VALUE3737 3738
+#define BSLS_MACROINCREMENTED_VALUE3738 3739
+#define BSLS_MACROINCREMENTED_VALUE3739 3740
+#define BSLS_MACROINCREMENTED_VALUE3740 3741
+#define BSLS_MACROINCREMENTED_VALUE3741 3742
+#define BSLS_MACROINCREMENTED_VALUE3742 3743
+#define BSLS_MACROINCREMENTED_VALUE3743 3744
+#define BSLS_MACROINCREMENTED_VALUE3744 3745
+#define BSLS_MACROINCREMENTED_VALUE3745 3746
+#define BSLS_MACROINCREMENTED_VALUE3746 3747
+#define BSLS_MACROINCREMENTED_VALUE3747 3748
+#define BSLS_MACROINCREMENTED_VALUE3748 3749
+#define BSLS_MACROINCREMENTED_VALUE3749 3750
+#define BSLS_MACROINCREMENTED_VALUE3750 3751
+#define BSLS_MACROINCREMENTED_VALUE3751 3752
+#define BSLS_MACROINCREMENTED_VALUE3752 3753
+#define BSLS_MACROINCREMENTED_VALUE3753 3754
+#define BSLS_MACROINCREMENTED_VALUE3754 3755
+#define BSLS_MACROINCREMENTED_VALUE3755 3756
+#define BSLS_MACROINCREMENTED_VALUE3756 3757
+#define BSLS_MACROINCREMENTED_VALUE3757 3758
+#define BSLS_MACROINCREMENTED_VALUE3758 3759
+#define BSLS_MACROINCREMENTED_VALUE3759 3760
+#define BSLS_MACROINCREMENTED_VALUE3760 3761
+#define BSLS_MACROINCREMENTED_VALUE3761 3762
+#define BSLS_MACROINCREMENTED_VALUE3762 3763
+#define BSLS_MACROINCREMENTED_VALUE3763 3764
+#define BSLS_MACROINCREMENTED_VALUE3764 3765
+#define BSLS_MACROINCREMENTED_VALUE3765 3766
+#define BSLS_MACROINCREMENTED_VALUE3766 3767
+#define BSLS_MACROINCREMENTED_VALUE3767 3768
+#define BSLS_MACROINCREMENTED_VALUE3768 3769
+#define BSLS_MACROINCREMENTED_VALUE3769 3770
+#define BSLS_MACROINCREMENTED_VALUE3770 3771
+#define BSLS_MACROINCREMENTED_VALUE3771 3772
+#define BSLS_MACROINCREMENTED_VALUE3772 3773
+#define BSLS_MACROINCREMENTED_VALUE3773 3774
+#define BSLS_MACROINCREMENTED_VALUE3774 3775
+#define BSLS_MACROINCREMENTED_VALUE3775 3776
+#define BSLS_MACROINCREMENTED_VALUE3776 3777
+#define BSLS_MACROINCREMENTED_VALUE3777 3778
+#define BSLS_MACROINCREMENTED_VALUE3778 3779
+#define BSLS_MACROINCREMENTED_VALUE3779 3780
+#define BSLS_MACROINCREMENTED_VALUE3780 3781
+#define BSLS_MACROINCREMENTED_VALUE3781 3782
+#define BSLS_MACROINCREMENTED_VALUE3782 3783
+#define BSLS_MACROINCREMENTED_VALUE3783 3784
+#define BSLS_MACROINCREMENTED_VALUE3784 3785
+#define BSLS_MACROINCREMENTED_VALUE3785 3786
+#define BSLS_MACROINCREMENTED_VALUE3786 3787
+#define BSLS_MACROINCREMENTED_VALUE3787 3788
+#define BSLS_MACROINCREMENTED_VALUE3788 3789
+#define BSLS_MACROINCREMENTED_VALUE3789 3790
+#define BSLS_MACROINCREMENTED_VALUE3790 3791
+#define BSLS_MACROINCREMENTED_VALUE3791 3792
+#define BSLS_MACROINCREMENTED_VALUE3792 3793
+#define BSLS_MACROINCREMENTED_VALUE3793 3794
+#define BSLS_MACROINCREMENTED_VALUE3794 3795
+#define BSLS_MACROINCREMENTED_VALUE3795 3796
+#define BSLS_MACROINCREMENTED_VALUE3796 3797
+#define BSLS_MACROINCREMENTED_VALUE3797 3798
+#define BSLS_MACROINCREMENTED_VALUE3798 3799
+#define BSLS_MACROINCREMENTED_VALUE3799 3800
+#define BSLS_MACROINCREMENTED_VALUE3800 3801
+#define BSLS_MACROINCREMENTED_VALUE3801 3802
+#define BSLS_MACROINCREMENTED_VALUE3802 3803
+#define BSLS_MACROINCREMENTED_VALUE3803 3804
+#define BSLS_MACROINCREMENTED_VALUE3804 3805
+#define BSLS_MACROINCREMENTED_VALUE3805 3806
+#define BSLS_MACROINCREMENTED_VALUE3806 3807
+#define BSLS_MACROINCREMENTED_VALUE3807 3808
+#define BSLS_MACROINCREMENTED_VALUE3808 3809
+#define BSLS_MACROINCREMENTED_VALUE3809 3810
+#define BSLS_MACROINCREMENTED_VALUE3810 3811
+#define BSLS_MACROINCREMENTED_VALUE3811 3812
+#define BSLS_MACROINCREMENTED_VALUE3812 3813
+#define BSLS_MACROINCREMENTED_VALUE3813 3814
+#define BSLS_MACROINCREMENTED_VALUE3814 3815
+#define BSLS_MACROINCREMENTED_VALUE3815 3816
+#define BSLS_MACROINCREMENTED_VALUE3816 3817
+#define BSLS_MACROINCREMENTED_VALUE3817 3818
+#define BSLS_MACROINCREMENTED_VALUE3818 3819
+#define BSLS_MACROINCREMENTED_VALUE3819 3820
+#define BSLS_MACROINCREMENTED_VALUE3820 3821
+#define BSLS_MACROINCREMENTED_VALUE3821 3822
+#define BSLS_MACROINCREMENTED_VALUE3822 3823
+#define BSLS_MACROINCREMENTED_VALUE3823 3824
+#define BSLS_MACROINCREMENTED_VALUE3824 3825
+#define BSLS_MACROINCREMENTED_VALUE3825 3826
+#define BSLS_MACROINCREMENTED_VALUE3826 3827
+#define BSLS_MACROINCREMENTED_VALUE3827 3828
+#define BSLS_MACROINCREMENTED_VALUE3828 3829
+#define BSLS_MACROINCREMENTED_VALUE3829 3830
+#define BSLS_MACROINCREMENTED_VALUE3830 3831
+#define BSLS_MACROINCREMENTED_VALUE3831 3832
+#define BSLS_MACROINCREMENTED_VALUE3832 3833
+#define BSLS_MACROINCREMENTED_VALUE3833 3834
+#define BSLS_MACROINCREMENTED_VALUE3834 3835
+#define BSLS_MACROINCREMENTED_VALUE3835 3836
+#define BSLS_MACROINCREMENTED_VALUE3836 3837
+#define BSLS_MACROINCREMENTED_VALUE3837 3838
+#define BSLS_MACROINCREMENTED_VALUE3838 3839
+#define BSLS_MACROINCREMENTED_VALUE3839 3840
+#define BSLS_MACROINCREMENTED_VALUE3840 3841
+#define BSLS_MACROINCREMENTED_VALUE3841 3842
+#define BSLS_MACROINCREMENTED_VALUE3842 3843
+#define BSLS_MACROINCREMENTED_VALUE3843 3844
+#define BSLS_MACROINCREMENTED_VALUE3844 3845
+#define BSLS_MACROINCREMENTED_VALUE3845 3846
+#define BSLS_MACROINCREMENTED_VALUE3846 3847
+#define BSLS_MACROINCREMENTED_VALUE3847 3848
+#define BSLS_MACROINCREMENTED_VALUE3848 3849
+#define BSLS_MACROINCREMENTED_VALUE3849 3850
+#define BSLS_MACROINCREMENTED_VALUE3850 3851
+#define BSLS_MACROINCREMENTED_VALUE3851 3852
+#define BSLS_MACROINCREMENTED_VALUE3852 3853
+#define BSLS_MACROINCREMENTED_VALUE3853 3854
+#define BSLS_MACROINCREMENTED_VALUE3854 3855
+#define BSLS_MACROINCREMENTED_VALUE3855 3856
+#define BSLS_MACROINCREMENTED_VALUE3856 3857
+#define BSLS_MACROINCREMENTED_VALUE3857 3858
+#define BSLS_MACROINCREMENTED_VALUE3858 3859
+#define BSLS_MACROINCREMENTED_VALUE3859 3860
+#define BSLS_MACROINCREMENTED_VALUE3860 3861
+#define BSLS_MACROINCREMENTED_VALUE3861 3862
+#define BSLS_MACROINCREMENTED_VALUE3862 3863
+#define BSLS_MACROINCREMENTED_VALUE3863 3864
+#define BSLS_MACROINCREMENTED_VALUE3864 3865
+#define BSLS_MACROINCREMENTED_VALUE3865 3866
+#define BSLS_MACROINCREMENTED_VALUE3866 3867
+#define BSLS_MACROINCREMENTED_VALUE3867 3868
+#define BSLS_MACROINCREMENTED_VALUE3868 3869
+#define BSLS_MACROINCREMENTED_VALUE3869 3870
+#define BSLS_MACROINCREMENTED_VALUE3870 3871
+#define BSLS_MACROINCREMENTED_VALUE3871 3872
+#define BSLS_MACROINCREMENTED_VALUE3872 3873
+#define BSLS_MACROINCREMENTED_VALUE3873 3874
+#define BSLS_MACROINCREMENTED_VALUE3874 3875
+#define BSLS_MACROINCREMENTED_VALUE3875 3876
+#define BSLS_MACROINCREMENTED_VALUE3876 3877
+#define BSLS_MACROINCREMENTED_VALUE3877 3878
+#define BSLS_MACROINCREMENTED_VALUE3878 3879
+#define BSLS_MACROINCREMENTED_VALUE3879 3880
+#define BSLS_MACROINCREMENTED_VALUE3880 3881
+#define BSLS_MACROINCREMENTED_VALUE3881 3882
+#define BSLS_MACROINCREMENTED_VALUE3882 3883
+#define BSLS_MACROINCREMENTED_VALUE3883 3884
+#define BSLS_MACROINCREMENTED_VALUE3884 3885
+#define BSLS_MACROINCREMENTED_VALUE3885 3886
+#define BSLS_MACROINCREMENTED_VALUE3886 3887
+#define BSLS_MACROINCREMENTED_VALUE3887 3888
+#define BSLS_MACROINCREMENTED_VALUE3888 3889
+#define BSLS_MACROINCREMENTED_VALUE3889 3890
+#define BSLS_MACROINCREMENTED_VALUE3890 3891
+#define BSLS_MACROINCREMENTED_VALUE3891 3892
+#define BSLS_MACROINCREMENTED_VALUE3892 3893
+#define BSLS_MACROINCREMENTED_VALUE3893 3894
+#define BSLS_MACROINCREMENTED_VALUE3894 3895
+#define BSLS_MACROINCREMENTED_VALUE3895 3896
+#define BSLS_MACROINCREMENTED_VALUE3896 3897
+#define BSLS_MACROINCREMENTED_VALUE3897 3898
+#define BSLS_MACROINCREMENTED_VALUE3898 3899
+#define BSLS_MACROINCREMENTED_VALUE3899 3900
+#define BSLS_MACROINCREMENTED_VALUE3900 3901
+#define BSLS_MACROINCREMENTED_VALUE3901 3902
+#define BSLS_MACROINCREMENTED_VALUE3902 3903
+#define BSLS_MACROINCREMENTED_VALUE3903 3904
+#define BSLS_MACROINCREMENTED_VALUE3904 3905
+#define BSLS_MACROINCREMENTED_VALUE3905 3906
+#define BSLS_MACROINCREMENTED_VALUE3906 3907
+#define BSLS_MACROINCREMENTED_VALUE3907 3908
+#define BSLS_MACROINCREMENTED_VALUE3908 3909
+#define BSLS_MACROINCREMENTED_VALUE3909 3910
+#define BSLS_MACROINCREMENTED_VALUE3910 3911
+#define BSLS_MACROINCREMENTED_VALUE3911 3912
+#define BSLS_MACROINCREMENTED_VALUE3912 3913
+#define BSLS_MACROINCREMENTED_VALUE3913 3914
+#define BSLS_MACROINCREMENTED_VALUE3914 3915
+#define BSLS_MACROINCREMENTED_VALUE3915 3916
+#define BSLS_MACROINCREMENTED_VALUE3916 3917
+#define BSLS_MACROINCREMENTED_VALUE3917 3918
+#define BSLS_MACROINCREMENTED_VALUE3918 3919
+#define BSLS_MACROINCREMENTED_VALUE3919 3920
+#define BSLS_MACROINCREMENTED_VALUE3920 3921
+#define BSLS_MACROINCREMENTED_VALUE3921 3922
+#define BSLS_MACROINCREMENTED_VALUE3922 3923
+#define BSLS_MACROINCREMENTED_VALUE3923 3924
+#define BSLS_MACROINCREMENTED_VALUE3924 3925
+#define BSLS_MACROINCREMENTED_VALUE3925 3926
+#define BSLS_MACROINCREMENTED_VALUE3926 3927
+#define BSLS_MACROINCREMENTED_VALUE3927 3928
+#define BSLS_MACROINCREMENTED_VALUE3928 3929
+#define BSLS_MACROINCREMENTED_VALUE3929 3930
+#define BSLS_MACROINCREMENTED_VALUE3930 3931
+#define BSLS_MACROINCREMENTED_VALUE3931 3932
+#define BSLS_MACROINCREMENTED_VALUE3932 3933
+#define BSLS_MACROINCREMENTED_VALUE3933 3934
+#define BSLS_MACROINCREMENTED_VALUE3934 3935
+#define BSLS_MACROINCREMENTED_VALUE3935 3936
+#define BSLS_MACROINCREMENTED_VALUE3936 3937
+#define BSLS_MACROINCREMENTED_VALUE3937 3938
+#define BSLS_MACROINCREMENTED_VALUE3938 3939
+#define BSLS_MACROINCREMENTED_VALUE3939 3940
+#define BSLS_MACROINCREMENTED_VALUE3940 3941
+#define BSLS_MACROINCREMENTED_VALUE3941 3942
+#define BSLS_MACROINCREMENTED_VALUE3942 3943
+#define BSLS_MACROINCREMENTED_VALUE3943 3944
+#define BSLS_MACROINCREMENTED_VALUE3944 3945
+#define BSLS_MACROINCREMENTED_VALUE3945 3946
+#define BSLS_MACROINCREMENTED_VALUE3946 3947
+#define BSLS_MACROINCREMENTED_VALUE3947 3948
+#define BSLS_MACROINCREMENTED_VALUE3948 3949
+#define BSLS_MACROINCREMENTED_VALUE3949 3950
+#define BSLS_MACROINCREMENTED_VALUE3950 3951
+#define BSLS_MACROINCREMENTED_VALUE3951 3952
+#define BSLS_MACROINCREMENTED_VALUE3952 3953
+#define BSLS_MACROINCREMENTED_VALUE3953 3954
+#define BSLS_MACROINCREMENTED_VALUE3954 3955
+#define BSLS_MACROINCREMENTED_VALUE3955 3956
+#define BSLS_MACROINCREMENTED_VALUE3956 3957
+#define BSLS_MACROINCREMENTED_VALUE3957 3958
+#define BSLS_MACROINCREMENTED_VALUE3958 3959
+#define BSLS_MACROINCREMENTED_VALUE3959 3960
+#define BSLS_MACROINCREMENTED_VALUE3960 3961
+#define BSLS_MACROINCREMENTED_VALUE3961 3962
+#define BSLS_MACROINCREMENTED_VALUE3962 3963
+#define BSLS_MACROINCREMENTED_VALUE3963 3964
+#define BSLS_MACROINCREMENTED_VALUE3964 3965
+#define BSLS_MACROINCREMENTED_VALUE3965 3966
+#define BSLS_MACROINCREMENTED_VALUE3966 3967
+#define BSLS_MACROINCREMENTED_VALUE3967 3968
+#define BSLS_MACROINCREMENTED_VALUE3968 3969
+#define BSLS_MACROINCREMENTED_VALUE3969 3970
+#define BSLS_MACROINCREMENTED_VALUE3970 3971
+#define BSLS_MACROINCREMENTED_VALUE3971 3972
+#define BSLS_MACROINCREMENTED_VALUE3972 3973
+#define BSLS_MACROINCREMENTED_VALUE3973 3974
+#define BSLS_MACROINCREMENTED_VALUE3974 3975
+#define BSLS_MACROINCREMENTED_VALUE3975 3976
+#define BSLS_MACROINCREMENTED_VALUE3976 3977
+#define BSLS_MACROINCREMENTED_VALUE3977 3978
+#define BSLS_MACROINCREMENTED_VALUE3978 3979
+#define BSLS_MACROINCREMENTED_VALUE3979 3980
+#define BSLS_MACROINCREMENTED_VALUE3980 3981
+#define BSLS_MACROINCREMENTED_VALUE3981 3982
+#define BSLS_MACROINCREMENTED_VALUE3982 3983
+#define BSLS_MACROINCREMENTED_VALUE3983 3984
+#define BSLS_MACROINCREMENTED_VALUE3984 3985
+#define BSLS_MACROINCREMENTED_VALUE3985 3986
+#define BSLS_MACROINCREMENTED_VALUE3986 3987
+#define BSLS_MACROINCREMENTED_VALUE3987 3988
+#define BSLS_MACROINCREMENTED_VALUE3988 3989
+#define BSLS_MACROINCREMENTED_VALUE3989 3990
+#define BSLS_MACROINCREMENTED_VALUE3990 3991
+#define BSLS_MACROINCREMENTED_VALUE3991 3992
+#define BSLS_MACROINCREMENTED_VALUE3992 3993
+#define BSLS_MACROINCREMENTED_VALUE3993 3994
+#define BSLS_MACROINCREMENTED_VALUE3994 3995
+#define BSLS_MACROINCREMENTED_VALUE3995 3996
+#define BSLS_MACROINCREMENTED_VALUE3996 3997
+#define BSLS_MACROINCREMENTED_VALUE3997 3998
+#define BSLS_MACROINCREMENTED_VALUE3998 3999
+#define BSLS_MACROINCREMENTED_VALUE3999 4000
+#define BSLS_MACROINCREMENTED_VALUE4000 4001
+#define BSLS_MACROINCREMENTED_VALUE4001 4002
+#define BSLS_MACROINCREMENTED_VALUE4002 4003
+#define BSLS_MACROINCREMENTED_VALUE4003 4004
+#define BSLS_MACROINCREMENTED_VALUE4004 4005
+#define BSLS_MACROINCREMENTED_VALUE4005 4006
+#define BSLS_MACROINCREMENTED_VALUE4006 4007
+#define BSLS_MACROINCREMENTED_VALUE4007 4008
+#define BSLS_MACROINCREMENTED_VALUE4008 4009
+#define BSLS_MACROINCREMENTED_VALUE4009 4010
+#define BSLS_MACROINCREMENTED_VALUE4010 4011
+#define BSLS_MACROINCREMENTED_VALUE4011 4012
+#define BSLS_MACROINCREMENTED_VALUE4012 4013
+#define BSLS_MACROINCREMENTED_VALUE4013 4014
+#define BSLS_MACROINCREMENTED_VALUE4014 4015
+#define BSLS_MACROINCREMENTED_VALUE4015 4016
+#define BSLS_MACROINCREMENTED_VALUE4016 4017
+#define BSLS_MACROINCREMENTED_VALUE4017 4018
+#define BSLS_MACROINCREMENTED_VALUE4018 4019
+#define BSLS_MACROINCREMENTED_VALUE4019 4020
+#define BSLS_MACROINCREMENTED_VALUE4020 4021
+#define BSLS_MACROINCREMENTED_VALUE4021 4022
+#define BSLS_MACROINCREMENTED_VALUE4022 4023
+#define BSLS_MACROINCREMENTED_VALUE4023 4024
+#define BSLS_MACROINCREMENTED_VALUE4024 4025
+#define BSLS_MACROINCREMENTED_VALUE4025 4026
+#define BSLS_MACROINCREMENTED_VALUE4026 4027
+#define BSLS_MACROINCREMENTED_VALUE4027 4028
+#define BSLS_MACROINCREMENTED_VALUE4028 4029
+#define BSLS_MACROINCREMENTED_VALUE4029 4030
+#define BSLS_MACROINCREMENTED_VALUE4030 4031
+#define BSLS_MACROINCREMENTED_VALUE4031 4032
+#define BSLS_MACROINCREMENTED_VALUE4032 4033
+#define BSLS_MACROINCREMENTED_VALUE4033 4034
+#define BSLS_MACROINCREMENTED_VALUE4034 4035
+#define BSLS_MACROINCREMENTED_VALUE4035 4036
+#define BSLS_MACROINCREMENTED_VALUE4036 4037
+#define BSLS_MACROINCREMENTED_VALUE4037 4038
+#define BSLS_MACROINCREMENTED_VALUE4038 4039
+#define BSLS_MACROINCREMENTED_VALUE4039 4040
+#define BSLS_MACROINCREMENTED_VALUE4040 4041
+#define BSLS_MACROINCREMENTED_VALUE4041 4042
+#define BSLS_MACROINCREMENTED_VALUE4042 4043
+#define BSLS_MACROINCREMENTED_VALUE4043 4044
+#define BSLS_MACROINCREMENTED_VALUE4044 4045
+#define BSLS_MACROINCREMENTED_VALUE4045 4046
+#define BSLS_MACROINCREMENTED_VALUE4046 4047
+#define BSLS_MACROINCREMENTED_VALUE4047 4048
+#define BSLS_MACROINCREMENTED_VALUE4048 4049
+#define BSLS_MACROINCREMENTED_VALUE4049 4050
+#define BSLS_MACROINCREMENTED_VALUE4050 4051
+#define BSLS_MACROINCREMENTED_VALUE4051 4052
+#define BSLS_MACROINCREMENTED_VALUE4052 4053
+#define BSLS_MACROINCREMENTED_VALUE4053 4054
+#define BSLS_MACROINCREMENTED_VALUE4054 4055
+#define BSLS_MACROINCREMENTED_VALUE4055 4056
+#define BSLS_MACROINCREMENTED_VALUE4056 4057
+#define BSLS_MACROINCREMENTED_VALUE4057 4058
+#define BSLS_MACROINCREMENTED_VALUE4058 4059
+#define BSLS_MACROINCREMENTED_VALUE4059 4060
+#define BSLS_MACROINCREMENTED_VALUE4060 4061
+#define BSLS_MACROINCREMENTED_VALUE4061 4062
+#define BSLS_MACROINCREMENTED_VALUE4062 4063
+#define BSLS_MACROINCREMENTED_VALUE4063 4064
+#define BSLS_MACROINCREMENTED_VALUE4064 4065
+#define BSLS_MACROINCREMENTED_VALUE4065 4066
+#define BSLS_MACROINCREMENTED_VALUE4066 4067
+#define BSLS_MACROINCREMENTED_VALUE4067 4068
+#define BSLS_MACROINCREMENTED_VALUE4068 4069
+#define BSLS_MACROINCREMENTED_VALUE4069 4070
+#define BSLS_MACROINCREMENTED_VALUE4070 4071
+#define BSLS_MACROINCREMENTED_VALUE4071 4072
+#define BSLS_MACROINCREMENTED_VALUE4072 4073
+#define BSLS_MACROINCREMENTED_VALUE4073 4074
+#define BSLS_MACROINCREMENTED_VALUE4074 4075
+#define BSLS_MACROINCREMENTED_VALUE4075 4076
+#define BSLS_MACROINCREMENTED_VALUE4076 4077
+#define BSLS_MACROINCREMENTED_VALUE4077 4078
+#define BSLS_MACROINCREMENTED_VALUE4078 4079
+#define BSLS_MACROINCREMENTED_VALUE4079 4080
+#define BSLS_MACROINCREMENTED_VALUE4080 4081
+#define BSLS_MACROINCREMENTED_VALUE4081 4082
+#define BSLS_MACROINCREMENTED_VALUE4082 4083
+#define BSLS_MACROINCREMENTED_VALUE4083 4084
+#define BSLS_MACROINCREMENTED_VALUE4084 4085
+#define BSLS_MACROINCREMENTED_VALUE4085 4086
+#define BSLS_MACROINCREMENTED_VALUE4086 4087
+#define BSLS_MACROINCREMENTED_VALUE4087 4088
+#define BSLS_MACROINCREMENTED_VALUE4088 4089
+#define BSLS_MACROINCREMENTED_VALUE4089 4090
+#define BSLS_MACROINCREMENTED_VALUE4090 4091
+#define BSLS_MACROINCREMENTED_VALUE4091 4092
+#define BSLS_MACROINCREMENTED_VALUE4092 4093
+#define BSLS_MACROINCREMENTED_VALUE4093 4094
+#define BSLS_MACROINCREMENTED_VALUE4094 4095
+#define BSLS_MACROINCREMENTED_VALUE4095 4096
+#define BSLS_MACROINCREMENTED_VALUE4096 4097
+#define BSLS_MACROINCREMENTED_VALUE4097 4098
+#define BSLS_MACROINCREMENTED_VALUE4098 4099
+#define BSLS_MACROINCREMENTED_VALUE4099 4100
+#define BSLS_MACROINCREMENTED_VALUE4100 4101
+#define BSLS_MACROINCREMENTED_VALUE4101 4102
+#define BSLS_MACROINCREMENTED_VALUE4102 4103
+#define BSLS_MACROINCREMENTED_VALUE4103 4104
+#define BSLS_MACROINCREMENTED_VALUE4104 4105
+#define BSLS_MACROINCREMENTED_VALUE4105 4106
+#define BSLS_MACROINCREMENTED_VALUE4106 4107
+#define BSLS_MACROINCREMENTED_VALUE4107 4108
+#define BSLS_MACROINCREMENTED_VALUE4108 4109
+#define BSLS_MACROINCREMENTED_VALUE4109 4110
+#define BSLS_MACROINCREMENTED_VALUE4110 4111
+#define BSLS_MACROINCREMENTED_VALUE4111 4112
+#define BSLS_MACROINCREMENTED_VALUE4112 4113
+#define BSLS_MACROINCREMENTED_VALUE4113 4114
+#define BSLS_MACROINCREMENTED_VALUE4114 4115
+#define BSLS_MACROINCREMENTED_VALUE4115 4116
+#define BSLS_MACROINCREMENTED_VALUE4116 4117
+#define BSLS_MACROINCREMENTED_VALUE4117 4118
+#define BSLS_MACROINCREMENTED_VALUE4118 4119
+#define BSLS_MACROINCREMENTED_VALUE4119 4120
+#define BSLS_MACROINCREMENTED_VALUE4120 4121
+#define BSLS_MACROINCREMENTED_VALUE4121 4122
+#define BSLS_MACROINCREMENTED_VALUE4122 4123
+#define BSLS_MACROINCREMENTED_VALUE4123 4124
+#define BSLS_MACROINCREMENTED_VALUE4124 4125
+#define BSLS_MACROINCREMENTED_VALUE4125 4126
+#define BSLS_MACROINCREMENTED_VALUE4126 4127
+#define BSLS_MACROINCREMENTED_VALUE4127 4128
+#define BSLS_MACROINCREMENTED_VALUE4128 4129
+#define BSLS_MACROINCREMENTED_VALUE4129 4130
+#define BSLS_MACROINCREMENTED_VALUE4130 4131
+#define BSLS_MACROINCREMENTED_VALUE4131 4132
+#define BSLS_MACROINCREMENTED_VALUE4132 4133
+#define BSLS_MACROINCREMENTED_VALUE4133 4134
+#define BSLS_MACROINCREMENTED_VALUE4134 4135
+#define BSLS_MACROINCREMENTED_VALUE4135 4136
+#define BSLS_MACROINCREMENTED_VALUE4136 4137
+#define BSLS_MACROINCREMENTED_VALUE4137 4138
+#define BSLS_MACROINCREMENTED_VALUE4138 4139
+#define BSLS_MACROINCREMENTED_VALUE4139 4140
+#define BSLS_MACROINCREMENTED_VALUE4140 4141
+#define BSLS_MACROINCREMENTED_VALUE4141 4142
+#define BSLS_MACROINCREMENTED_VALUE4142 4143
+#define BSLS_MACROINCREMENTED_VALUE4143 4144
+#define BSLS_MACROINCREMENTED_VALUE4144 4145
+#define BSLS_MACROINCREMENTED_VALUE4145 4146
+#define BSLS_MACROINCREMENTED_VALUE4146 4147
+#define BSLS_MACROINCREMENTED_VALUE4147 4148
+#define BSLS_MACROINCREMENTED_VALUE4148 4149
+#define BSLS_MACROINCREMENTED_VALUE4149 4150
+#define BSLS_MACROINCREMENTED_VALUE4150 4151
+#define BSLS_MACROINCREMENTED_VALUE4151 4152
+#define BSLS_MACROINCREMENTED_VALUE4152 4153
+#define BSLS_MACROINCREMENTED_VALUE4153 4154
+#define BSLS_MACROINCREMENTED_VALUE4154 4155
+#define BSLS_MACROINCREMENTED_VALUE4155 4156
+#define BSLS_MACROINCREMENTED_VALUE4156 4157
+#define BSLS_MACROINCREMENTED_VALUE4157 4158
+#define BSLS_MACROINCREMENTED_VALUE4158 4159
+#define BSLS_MACROINCREMENTED_VALUE4159 4160
+#define BSLS_MACROINCREMENTED_VALUE4160 4161
+#define BSLS_MACROINCREMENTED_VALUE4161 4162
+#define BSLS_MACROINCREMENTED_VALUE4162 4163
+#define BSLS_MACROINCREMENTED_VALUE4163 4164
+#define BSLS_MACROINCREMENTED_VALUE4164 4165
+#define BSLS_MACROINCREMENTED_VALUE4165 4166
+#define BSLS_MACROINCREMENTED_VALUE4166 4167
+#define BSLS_MACROINCREMENTED_VALUE4167 4168
+#define BSLS_MACROINCREMENTED_VALUE4168 4169
+#define BSLS_MACROINCREMENTED_VALUE4169 4170
+#define BSLS_MACROINCREMENTED_VALUE4170 4171
+#define BSLS_MACROINCREMENTED_VALUE4171 4172
+#define BSLS_MACROINCREMENTED_VALUE4172 4173
+#define BSLS_MACROINCREMENTED_VALUE4173 4174
+#define BSLS_MACROINCREMENTED_VALUE4174 4175
+#define BSLS_MACROINCREMENTED_VALUE4175 4176
+#define BSLS_MACROINCREMENTED_VALUE4176 4177
+#define BSLS_MACROINCREMENTED_VALUE4177 4178
+#define BSLS_MACROINCREMENTED_VALUE4178 4179
+#define BSLS_MACROINCREMENTED_VALUE4179 4180
+#define BSLS_MACROINCREMENTED_VALUE4180 4181
+#define BSLS_MACROINCREMENTED_VALUE4181 4182
+#define BSLS_MACROINCREMENTED_VALUE4182 4183
+#define BSLS_MACROINCREMENTED_VALUE4183 4184
+#define BSLS_MACROINCREMENTED_VALUE4184 4185
+#define BSLS_MACROINCREMENTED_VALUE4185 4186
+#define BSLS_MACROINCREMENTED_VALUE4186 4187
+#define BSLS_MACROINCREMENTED_VALUE4187 4188
+#define BSLS_MACROINCREMENTED_VALUE4188 4189
+#define BSLS_MACROINCREMENTED_VALUE4189 4190
+#define BSLS_MACROINCREMENTED_VALUE4190 4191
+#define BSLS_MACROINCREMENTED_VALUE4191 4192
+#define BSLS_MACROINCREMENTED_VALUE4192 4193
+#define BSLS_MACROINCREMENTED_VALUE4193 4194
+#define BSLS_MACROINCREMENTED_VALUE4194 4195
+#define BSLS_MACROINCREMENTED_VALUE4195 4196
+#define BSLS_MACROINCREMENTED_VALUE4196 4197
+#define BSLS_MACROINCREMENTED_VALUE4197 4198
+#define BSLS_MACROINCREMENTED_VALUE4198 4199
+#define BSLS_MACROINCREMENTED_VALUE4199 4200
+#define BSLS_MACROINCREMENTED_VALUE4200 4201
+#define BSLS_MACROINCREMENTED_VALUE4201 4202
+#define BSLS_MACROINCREMENTED_VALUE4202 4203
+#define BSLS_MACROINCREMENTED_VALUE4203 4204
+#define BSLS_MACROINCREMENTED_VALUE4204 4205
+#define BSLS_MACROINCREMENTED_VALUE4205 4206
+#define BSLS_MACROINCREMENTED_VALUE4206 4207
+#define BSLS_MACROINCREMENTED_VALUE4207 4208
+#define BSLS_MACROINCREMENTED_VALUE4208 4209
+#define BSLS_MACROINCREMENTED_VALUE4209 4210
+#define BSLS_MACROINCREMENTED_VALUE4210 4211
+#define BSLS_MACROINCREMENTED_VALUE4211 4212
+#define BSLS_MACROINCREMENTED_VALUE4212 4213
+#define BSLS_MACROINCREMENTED_VALUE4213 4214
+#define BSLS_MACROINCREMENTED_VALUE4214 4215
+#define BSLS_MACROINCREMENTED_VALUE4215 4216
+#define BSLS_MACROINCREMENTED_VALUE4216 4217
+#define BSLS_MACROINCREMENTED_VALUE4217 4218
+#define BSLS_MACROINCREMENTED_VALUE4218 4219
+#define BSLS_MACROINCREMENTED_VALUE4219 4220
+#define BSLS_MACROINCREMENTED_VALUE4220 4221
+#define BSLS_MACROINCREMENTED_VALUE4221 4222
+#define BSLS_MACROINCREMENTED_VALUE4222 4223
+#define BSLS_MACROINCREMENTED_VALUE4223 4224
+#define BSLS_MACROINCREMENTED_VALUE4224 4225
+#define BSLS_MACROINCREMENTED_VALUE4225 4226
+#define BSLS_MACROINCREMENTED_VALUE4226 4227
+#define BSLS_MACROINCREMENTED_VALUE4227 4228
+#define BSLS_MACROINCREMENTED_VALUE4228 4229
+#define BSLS_MACROINCREMENTED_VALUE4229 4230
+#define BSLS_MACROINCREMENTED_VALUE4230 4231
+#define BSLS_MACROINCREMENTED_VALUE4231 4232
+#define BSLS_MACROINCREMENTED_VALUE4232 4233
+#define BSLS_MACROINCREMENTED_VALUE4233 4234
+#define BSLS_MACROINCREMENTED_VALUE4234 4235
+#define BSLS_MACROINCREMENTED_VALUE4235 4236
+#define BSLS_MACROINCREMENTED_VALUE4236 4237
+#define BSLS_MACROINCREMENTED_VALUE4237 4238
+#define BSLS_MACROINCREMENTED_VALUE4238 4239
+#define BSLS_MACROINCREMENTED_VALUE4239 4240
+#define BSLS_MACROINCREMENTED_VALUE4240 4241
+#define BSLS_MACROINCREMENTED_VALUE4241 4242
+#define BSLS_MACROINCREMENTED_VALUE4242 4243
+#define BSLS_MACROINCREMENTED_VALUE4243 4244
+#define BSLS_MACROINCREMENTED_VALUE4244 4245
+#define BSLS_MACROINCREMENTED_VALUE4245 4246
+#define BSLS_MACROINCREMENTED_VALUE4246 4247
+#define BSLS_MACROINCREMENTED_VALUE4247 4248
+#define BSLS_MACROINCREMENTED_VALUE4248 4249
+#define BSLS_MACROINCREMENTED_VALUE4249 4250
+#define BSLS_MACROINCREMENTED_VALUE4250 4251
+#define BSLS_MACROINCREMENTED_VALUE4251 4252
+#define BSLS_MACROINCREMENTED_VALUE4252 4253
+#define BSLS_MACROINCREMENTED_VALUE4253 4254
+#define BSLS_MACROINCREMENTED_VALUE4254 4255
+#define BSLS_MACROINCREMENTED_VALUE4255 4256
+#define BSLS_MACROINCREMENTED_VALUE4256 4257
+#define BSLS_MACROINCREMENTED_VALUE4257 4258
+#define BSLS_MACROINCREMENTED_VALUE4258 4259
+#define BSLS_MACROINCREMENTED_VALUE4259 4260
+#define BSLS_MACROINCREMENTED_VALUE4260 4261
+#define BSLS_MACROINCREMENTED_VALUE4261 4262
+#define BSLS_MACROINCREMENTED_VALUE4262 4263
+#define BSLS_MACROINCREMENTED_VALUE4263 4264
+#define BSLS_MACROINCREMENTED_VALUE4264 4265
+#define BSLS_MACROINCREMENTED_VALUE4265 4266
+#define BSLS_MACROINCREMENTED_VALUE4266 4267
+#define BSLS_MACROINCREMENTED_VALUE4267 4268
+#define BSLS_MACROINCREMENTED_VALUE4268 4269
+#define BSLS_MACROINCREMENTED_VALUE4269 4270
+#define BSLS_MACROINCREMENTED_VALUE4270 4271
+#define BSLS_MACROINCREMENTED_VALUE4271 4272
+#define BSLS_MACROINCREMENTED_VALUE4272 4273
+#define BSLS_MACROINCREMENTED_VALUE4273 4274
+#define BSLS_MACROINCREMENTED_VALUE4274 4275
+#define BSLS_MACROINCREMENTED_VALUE4275 4276
+#define BSLS_MACROINCREMENTED_VALUE4276 4277
+#define BSLS_MACROINCREMENTED_VALUE4277 4278
+#define BSLS_MACROINCREMENTED_VALUE4278 4279
+#define BSLS_MACROINCREMENTED_VALUE4279 4280
+#define BSLS_MACROINCREMENTED_VALUE4280 4281
+#define BSLS_MACROINCREMENTED_VALUE4281 4282
+#define BSLS_MACROINCREMENTED_VALUE4282 4283
+#define BSLS_MACROINCREMENTED_VALUE4283 4284
+#define BSLS_MACROINCREMENTED_VALUE4284 4285
+#define BSLS_MACROINCREMENTED_VALUE4285 4286
+#define BSLS_MACROINCREMENTED_VALUE4286 4287
+#define BSLS_MACROINCREMENTED_VALUE4287 4288
+#define BSLS_MACROINCREMENTED_VALUE4288 4289
+#define BSLS_MACROINCREMENTED_VALUE4289 4290
+#define BSLS_MACROINCREMENTED_VALUE4290 4291
+#define BSLS_MACROINCREMENTED_VALUE4291 4292
+#define BSLS_MACROINCREMENTED_VALUE4292 4293
+#define BSLS_MACROINCREMENTED_VALUE4293 4294
+#define BSLS_MACROINCREMENTED_VALUE4294 4295
+#define BSLS_MACROINCREMENTED_VALUE4295 4296
+#define BSLS_MACROINCREMENTED_VALUE4296 4297
+#define BSLS_MACROINCREMENTED_VALUE4297 4298
+#define BSLS_MACROINCREMENTED_VALUE4298 4299
+#define BSLS_MACROINCREMENTED_VALUE4299 4300
+#define BSLS_MACROINCREMENTED_VALUE4300 4301
+#define BSLS_MACROINCREMENTED_VALUE4301 4302
+#define BSLS_MACROINCREMENTED_VALUE4302 4303
+#define BSLS_MACROINCREMENTED_VALUE4303 4304
+#define BSLS_MACROINCREMENTED_VALUE4304 4305
+#define BSLS_MACROINCREMENTED_VALUE4305 4306
+#define BSLS_MACROINCREMENTED_VALUE4306 4307
+#define BSLS_MACROINCREMENTED_VALUE4307 4308
+#define BSLS_MACROINCREMENTED_VALUE4308 4309
+#define BSLS_MACROINCREMENTED_VALUE4309 4310
+#define BSLS_MACROINCREMENTED_VALUE4310 4311
+#define BSLS_MACROINCREMENTED_VALUE4311 4312
+#define BSLS_MACROINCREMENTED_VALUE4312 4313
+#define BSLS_MACROINCREMENTED_VALUE4313 4314
+#define BSLS_MACROINCREMENTED_VALUE4314 4315
+#define BSLS_MACROINCREMENTED_VALUE4315 4316
+#define BSLS_MACROINCREMENTED_VALUE4316 4317
+#define BSLS_MACROINCREMENTED_VALUE4317 4318
+#define BSLS_MACROINCREMENTED_VALUE4318 4319
+#define BSLS_MACROINCREMENTED_VALUE4319 4320
+#define BSLS_MACROINCREMENTED_VALUE4320 4321
+#define BSLS_MACROINCREMENTED_VALUE4321 4322
+#define BSLS_MACROINCREMENTED_VALUE4322 4323
+#define BSLS_MACROINCREMENTED_VALUE4323 4324
+#define BSLS_MACROINCREMENTED_VALUE4324 4325
+#define BSLS_MACROINCREMENTED_VALUE4325 4326
+#define BSLS_MACROINCREMENTED_VALUE4326 4327
+#define BSLS_MACROINCREMENTED_VALUE4327 4328
+#define BSLS_MACROINCREMENTED_VALUE4328 4329
+#define BSLS_MACROINCREMENTED_VALUE4329 4330
+#define BSLS_MACROINCREMENTED_VALUE4330 4331
+#define BSLS_MACROINCREMENTED_VALUE4331 4332
+#define BSLS_MACROINCREMENTED_VALUE4332 4333
+#define BSLS_MACROINCREMENTED_VALUE4333 4334
+#define BSLS_MACROINCREMENTED_VALUE4334 4335
+#define BSLS_MACROINCREMENTED_VALUE4335 4336
+#define BSLS_MACROINCREMENTED_VALUE4336 4337
+#define BSLS_MACROINCREMENTED_VALUE4337 4338
+#define BSLS_MACROINCREMENTED_VALUE4338 4339
+#define BSLS_MACROINCREMENTED_VALUE4339 4340
+#define BSLS_MACROINCREMENTED_VALUE4340 4341
+#define BSLS_MACROINCREMENTED_VALUE4341 4342
+#define BSLS_MACROINCREMENTED_VALUE4342 4343
+#define BSLS_MACROINCREMENTED_VALUE4343 4344
+#define BSLS_MACROINCREMENTED_VALUE4344 4345
+#define BSLS_MACROINCREMENTED_VALUE4345 4346
+#define BSLS_MACROINCREMENTED_VALUE4346 4347
+#define BSLS_MACROINCREMENTED_VALUE4347 4348
+#define BSLS_MACROINCREMENTED_VALUE4348 4349
+#define BSLS_MACROINCREMENTED_VALUE4349 4350
+#define BSLS_MACROINCREMENTED_VALUE4350 4351
+#define BSLS_MACROINCREMENTED_VALUE4351 4352
+#define BSLS_MACROINCREMENTED_VALUE4352 4353
+#define BSLS_MACROINCREMENTED_VALUE4353 4354
+#define BSLS_MACROINCREMENTED_VALUE4354 4355
+#define BSLS_MACROINCREMENTED_VALUE4355 4356
+#define BSLS_MACROINCREMENTED_VALUE4356 4357
+#define BSLS_MACROINCREMENTED_VALUE4357 4358
+#define BSLS_MACROINCREMENTED_VALUE4358 4359
+#define BSLS_MACROINCREMENTED_VALUE4359 4360
+#define BSLS_MACROINCREMENTED_VALUE4360 4361
+#define BSLS_MACROINCREMENTED_VALUE4361 4362
+#define BSLS_MACROINCREMENTED_VALUE4362 4363
+#define BSLS_MACROINCREMENTED_VALUE4363 4364
+#define BSLS_MACROINCREMENTED_VALUE4364 4365
+#define BSLS_MACROINCREMENTED_VALUE4365 4366
+#define BSLS_MACROINCREMENTED_VALUE4366 4367
+#define BSLS_MACROINCREMENTED_VALUE4367 4368
+#define BSLS_MACROINCREMENTED_VALUE4368 4369
+#define BSLS_MACROINCREMENTED_VALUE4369 4370
+#define BSLS_MACROINCREMENTED_VALUE4370 4371
+#define BSLS_MACROINCREMENTED_VALUE4371 4372
+#define BSLS_MACROINCREMENTED_VALUE4372 4373
+#define BSLS_MACROINCREMENTED_VALUE4373 4374
+#define BSLS_MACROINCREMENTED_VALUE4374 4375
+#define BSLS_MACROINCREMENTED_VALUE4375 4376
+#define BSLS_MACROINCREMENTED_VALUE4376 4377
+#define BSLS_MACROINCREMENTED_VALUE4377 4378
+#define BSLS_MACROINCREMENTED_VALUE4378 4379
+#define BSLS_MACROINCREMENTED_VALUE4379 4380
+#define BSLS_MACROINCREMENTED_VALUE4380 4381
+#define BSLS_MACROINCREMENTED_VALUE4381 4382
+#define BSLS_MACROINCREMENTED_VALUE4382 4383
+#define BSLS_MACROINCREMENTED_VALUE4383 4384
+#define BSLS_MACROINCREMENTED_VALUE4384 4385
+#define BSLS_MACROINCREMENTED_VALUE4385 4386
+#define BSLS_MACROINCREMENTED_VALUE4386 4387
+#define BSLS_MACROINCREMENTED_VALUE4387 4388
+#define BSLS_MACROINCREMENTED_VALUE4388 4389
+#define BSLS_MACROINCREMENTED_VALUE4389 4390
+#define BSLS_MACROINCREMENTED_VALUE4390 4391
+#define BSLS_MACROINCREMENTED_VALUE4391 4392
+#define BSLS_MACROINCREMENTED_VALUE4392 4393
+#define BSLS_MACROINCREMENTED_VALUE4393 4394
+#define BSLS_MACROINCREMENTED_VALUE4394 4395
+#define BSLS_MACROINCREMENTED_VALUE4395 4396
+#define BSLS_MACROINCREMENTED_VALUE4396 4397
+#define BSLS_MACROINCREMENTED_VALUE4397 4398
+#define BSLS_MACROINCREMENTED_VALUE4398 4399
+#define BSLS_MACROINCREMENTED_VALUE4399 4400
+#define BSLS_MACROINCREMENTED_VALUE4400 4401
+#define BSLS_MACROINCREMENTED_VALUE4401 4402
+#define BSLS_MACROINCREMENTED_VALUE4402 4403
+#define BSLS_MACROINCREMENTED_VALUE4403 4404
+#define BSLS_MACROINCREMENTED_VALUE4404 4405
+#define BSLS_MACROINCREMENTED_VALUE4405 4406
+#define BSLS_MACROINCREMENTED_VALUE4406 4407
+#define BSLS_MACROINCREMENTED_VALUE4407 4408
+#define BSLS_MACROINCREMENTED_VALUE4408 4409
+#define BSLS_MACROINCREMENTED_VALUE4409 4410
+#define BSLS_MACROINCREMENTED_VALUE4410 4411
+#define BSLS_MACROINCREMENTED_VALUE4411 4412
+#define BSLS_MACROINCREMENTED_VALUE4412 4413
+#define BSLS_MACROINCREMENTED_VALUE4413 4414
+#define BSLS_MACROINCREMENTED_VALUE4414 4415
+#define BSLS_MACROINCREMENTED_VALUE4415 4416
+#define BSLS_MACROINCREMENTED_VALUE4416 4417
+#define BSLS_MACROINCREMENTED_VALUE4417 4418
+#define BSLS_MACROINCREMENTED_VALUE4418 4419
+#define BSLS_MACROINCREMENTED_VALUE4419 4420
+#define BSLS_MACROINCREMENTED_VALUE4420 4421
+#define BSLS_MACROINCREMENTED_VALUE4421 4422
+#define BSLS_MACROINCREMENTED_VALUE4422 4423
+#define BSLS_MACROINCREMENTED_VALUE4423 4424
+#define BSLS_MACROINCREMENTED_VALUE4424 4425
+#define BSLS_MACROINCREMENTED_VALUE4425 4426
+#define BSLS_MACROINCREMENTED_VALUE4426 4427
+#define BSLS_MACROINCREMENTED_VALUE4427 4428
+#define BSLS_MACROINCREMENTED_VALUE4428 4429
+#define BSLS_MACROINCREMENTED_VALUE4429 4430
+#define BSLS_MACROINCREMENTED_VALUE4430 4431
+#define BSLS_MACROINCREMENTED_VALUE4431 4432
+#define BSLS_MACROINCREMENTED_VALUE4432 4433
+#define BSLS_MACROINCREMENTED_VALUE4433 4434
+#define BSLS_MACROINCREMENTED_VALUE4434 4435
+#define BSLS_MACROINCREMENTED_VALUE4435 4436
+#define BSLS_MACROINCREMENTED_VALUE4436 4437
+#define BSLS_MACROINCREMENTED_VALUE4437 4438
+#define BSLS_MACROINCREMENTED_VALUE4438 4439
+#define BSLS_MACROINCREMENTED_VALUE4439 4440
+#define BSLS_MACROINCREMENTED_VALUE4440 4441
+#define BSLS_MACROINCREMENTED_VALUE4441 4442
+#define BSLS_MACROINCREMENTED_VALUE4442 4443
+#define BSLS_MACROINCREMENTED_VALUE4443 4444
+#define BSLS_MACROINCREMENTED_VALUE4444 4445
+#define BSLS_MACROINCREMENTED_VALUE4445 4446
+#define BSLS_MACROINCREMENTED_VALUE4446 4447
+#define BSLS_MACROINCREMENTED_VALUE4447 4448
+#define BSLS_MACROINCREMENTED_VALUE4448 4449
+#define BSLS_MACROINCREMENTED_VALUE4449 4450
+#define BSLS_MACROINCREMENTED_VALUE4450 4451
+#define BSLS_MACROINCREMENTED_VALUE4451 4452
+#define BSLS_MACROINCREMENTED_VALUE4452 4453
+#define BSLS_MACROINCREMENTED_VALUE4453 4454
+#define BSLS_MACROINCREMENTED_VALUE4454 4455
+#define BSLS_MACROINCREMENTED_VALUE4455 4456
+#define BSLS_MACROINCREMENTED_VALUE4456 4457
+#define BSLS_MACROINCREMENTED_VALUE4457 4458
+#define BSLS_MACROINCREMENTED_VALUE4458 4459
+#define BSLS_MACROINCREMENTED_VALUE4459 4460
+#define BSLS_MACROINCREMENTED_VALUE4460 4461
+#define BSLS_MACROINCREMENTED_VALUE4461 4462
+#define BSLS_MACROINCREMENTED_VALUE4462 4463
+#define BSLS_MACROINCREMENTED_VALUE4463 4464
+#define BSLS_MACROINCREMENTED_VALUE4464 4465
+#define BSLS_MACROINCREMENTED_VALUE4465 4466
+#define BSLS_MACROINCREMENTED_VALUE4466 4467
+#define BSLS_MACROINCREMENTED_VALUE4467 4468
+#define BSLS_MACROINCREMENTED_VALUE4468 4469
+#define BSLS_MACROINCREMENTED_VALUE4469 4470
+#define BSLS_MACROINCREMENTED_VALUE4470 4471
+#define BSLS_MACROINCREMENTED_VALUE4471 4472
+#define BSLS_MACROINCREMENTED_VALUE4472 4473
+#define BSLS_MACROINCREMENTED_VALUE4473 4474
+#define BSLS_MACROINCREMENTED_VALUE4474 4475
+#define BSLS_MACROINCREMENTED_VALUE4475 4476
+#define BSLS_MACROINCREMENTED_VALUE4476 4477
+#define BSLS_MACROINCREMENTED_VALUE4477 4478
+#define BSLS_MACROINCREMENTED_VALUE4478 4479
+#define BSLS_MACROINCREMENTED_VALUE4479 4480
+#define BSLS_MACROINCREMENTED_VALUE4480 4481
+#define BSLS_MACROINCREMENTED_VALUE4481 4482
+#define BSLS_MACROINCREMENTED_VALUE4482 4483
+#define BSLS_MACROINCREMENTED_VALUE4483 4484
+#define BSLS_MACROINCREMENTED_VALUE4484 4485
+#define BSLS_MACROINCREMENTED_VALUE4485 4486
+#define BSLS_MACROINCREMENTED_VALUE4486 4487
+#define BSLS_MACROINCREMENTED_VALUE4487 4488
+#define BSLS_MACROINCREMENTED_VALUE4488 4489
+#define BSLS_MACROINCREMENTED_VALUE4489 4490
+#define BSLS_MACROINCREMENTED_VALUE4490 4491
+#define BSLS_MACROINCREMENTED_VALUE4491 4492
+#define BSLS_MACROINCREMENTED_VALUE4492 4493
+#define BSLS_MACROINCREMENTED_VALUE4493 4494
+#define BSLS_MACROINCREMENTED_VALUE4494 4495
+#define BSLS_MACROINCREMENTED_VALUE4495 4496
+#define BSLS_MACROINCREMENTED_VALUE4496 4497
+#define BSLS_MACROINCREMENTED_VALUE4497 4498
+#define BSLS_MACROINCREMENTED_VALUE4498 4499
+#define BSLS_MACROINCREMENTED_VALUE4499 4500
+#define BSLS_MACROINCREMENTED_VALUE4500 4501
+#define BSLS_MACROINCREMENTED_VALUE4501 4502
+#define BSLS_MACROINCREMENTED_VALUE4502 4503
+#define BSLS_MACROINCREMENTED_VALUE4503 4504
+#define BSLS_MACROINCREMENTED_VALUE4504 4505
+#define BSLS_MACROINCREMENTED_VALUE4505 4506
+#define BSLS_MACROINCREMENTED_VALUE4506 4507
+#define BSLS_MACROINCREMENTED_VALUE4507 4508
+#define BSLS_MACROINCREMENTED_VALUE4508 4509
+#define BSLS_MACROINCREMENTED_VALUE4509 4510
+#define BSLS_MACROINCREMENTED_VALUE4510 4511
+#define BSLS_MACROINCREMENTED_VALUE4511 4512
+#define BSLS_MACROINCREMENTED_VALUE4512 4513
+#define BSLS_MACROINCREMENTED_VALUE4513 4514
+#define BSLS_MACROINCREMENTED_VALUE4514 4515
+#define BSLS_MACROINCREMENTED_VALUE4515 4516
+#define BSLS_MACROINCREMENTED_VALUE4516 4517
+#define BSLS_MACROINCREMENTED_VALUE4517 4518
+#define BSLS_MACROINCREMENTED_VALUE4518 4519
+#define BSLS_MACROINCREMENTED_VALUE4519 4520
+#define BSLS_MACROINCREMENTED_VALUE4520 4521
+#define BSLS_MACROINCREMENTED_VALUE4521 4522
+#define BSLS_MACROINCREMENTED_VALUE4522 4523
+#define BSLS_MACROINCREMENTED_VALUE4523 4524
+#define BSLS_MACROINCREMENTED_VALUE4524 4525
+#define BSLS_MACROINCREMENTED_VALUE4525 4526
+#define BSLS_MACROINCREMENTED_VALUE4526 4527
+#define BSLS_MACROINCREMENTED_VALUE4527 4528
+#define BSLS_MACROINCREMENTED_VALUE4528 4529
+#define BSLS_MACROINCREMENTED_VALUE4529 4530
+#define BSLS_MACROINCREMENTED_VALUE4530 4531
+#define BSLS_MACROINCREMENTED_VALUE4531 4532
+#define BSLS_MACROINCREMENTED_VALUE4532 4533
+#define BSLS_MACROINCREMENTED_VALUE4533 4534
+#define BSLS_MACROINCREMENTED_VALUE4534 4535
+#define BSLS_MACROINCREMENTED_VALUE4535 4536
+#define BSLS_MACROINCREMENTED_VALUE4536 4537
+#define BSLS_MACROINCREMENTED_VALUE4537 4538
+#define BSLS_MACROINCREMENTED_VALUE4538 4539
+#define BSLS_MACROINCREMENTED_VALUE4539 4540
+#define BSLS_MACROINCREMENTED_VALUE4540 4541
+#define BSLS_MACROINCREMENTED_VALUE4541 4542
+#define BSLS_MACROINCREMENTED_VALUE4542 4543
+#define BSLS_MACROINCREMENTED_VALUE4543 4544
+#define BSLS_MACROINCREMENTED_VALUE4544 4545
+#define BSLS_MACROINCREMENTED_VALUE4545 4546
+#define BSLS_MACROINCREMENTED_VALUE4546 4547
+#define BSLS_MACROINCREMENTED_VALUE4547 4548
+#define BSLS_MACROINCREMENTED_VALUE4548 4549
+#define BSLS_MACROINCREMENTED_VALUE4549 4550
+#define BSLS_MACROINCREMENTED_VALUE4550 4551
+#define BSLS_MACROINCREMENTED_VALUE4551 4552
+#define BSLS_MACROINCREMENTED_VALUE4552 4553
+#define BSLS_MACROINCREMENTED_VALUE4553 4554
+#define BSLS_MACROINCREMENTED_VALUE4554 4555
+#define BSLS_MACROINCREMENTED_VALUE4555 4556
+#define BSLS_MACROINCREMENTED_VALUE4556 4557
+#define BSLS_MACROINCREMENTED_VALUE4557 4558
+#define BSLS_MACROINCREMENTED_VALUE4558 4559
+#define BSLS_MACROINCREMENTED_VALUE4559 4560
+#define BSLS_MACROINCREMENTED_VALUE4560 4561
+#define BSLS_MACROINCREMENTED_VALUE4561 4562
+#define BSLS_MACROINCREMENTED_VALUE4562 4563
+#define BSLS_MACROINCREMENTED_VALUE4563 4564
+#define BSLS_MACROINCREMENTED_VALUE4564 4565
+#define BSLS_MACROINCREMENTED_VALUE4565 4566
+#define BSLS_MACROINCREMENTED_VALUE4566 4567
+#define BSLS_MACROINCREMENTED_VALUE4567 4568
+#define BSLS_MACROINCREMENTED_VALUE4568 4569
+#define BSLS_MACROINCREMENTED_VALUE4569 4570
+#define BSLS_MACROINCREMENTED_VALUE4570 4571
+#define BSLS_MACROINCREMENTED_VALUE4571 4572
+#define BSLS_MACROINCREMENTED_VALUE4572 4573
+#define BSLS_MACROINCREMENTED_VALUE4573 4574
+#define BSLS_MACROINCREMENTED_VALUE4574 4575
+#define BSLS_MACROINCREMENTED_VALUE4575 4576
+#define BSLS_MACROINCREMENTED_VALUE4576 4577
+#define BSLS_MACROINCREMENTED_VALUE4577 4578
+#define BSLS_MACROINCREMENTED_VALUE4578 4579
+#define BSLS_MACROINCREMENTED_VALUE4579 4580
+#define BSLS_MACROINCREMENTED_VALUE4580 4581
+#define BSLS_MACROINCREMENTED_VALUE4581 4582
+#define BSLS_MACROINCREMENTED_VALUE4582 4583
+#define BSLS_MACROINCREMENTED_VALUE4583 4584
+#define BSLS_MACROINCREMENTED_VALUE4584 4585
+#define BSLS_MACROINCREMENTED_VALUE4585 4586
+#define BSLS_MACROINCREMENTED_VALUE4586 4587
+#define BSLS_MACROINCREMENTED_VALUE4587 4588
+#define BSLS_MACROINCREMENTED_VALUE4588 4589
+#define BSLS_MACROINCREMENTED_VALUE4589 4590
+#define BSLS_MACROINCREMENTED_VALUE4590 4591
+#define BSLS_MACROINCREMENTED_VALUE4591 4592
+#define BSLS_MACROINCREMENTED_VALUE4592 4593
+#define BSLS_MACROINCREMENTED_VALUE4593 4594
+#define BSLS_MACROINCREMENTED_VALUE4594 4595
+#define BSLS_MACROINCREMENTED_VALUE4595 4596
+#define BSLS_MACROINCREMENTED_VALUE4596 4597
+#define BSLS_MACROINCREMENTED_VALUE4597 4598
+#define BSLS_MACROINCREMENTED_VALUE4598 4599
+#define BSLS_MACROINCREMENTED_VALUE4599 4600
+#define BSLS_MACROINCREMENTED_VALUE4600 4601
+#define BSLS_MACROINCREMENTED_VALUE4601 4602
+#define BSLS_MACROINCREMENTED_VALUE4602 4603
+#define BSLS_MACROINCREMENTED_VALUE4603 4604
+#define BSLS_MACROINCREMENTED_VALUE4604 4605
+#define BSLS_MACROINCREMENTED_VALUE4605 4606
+#define BSLS_MACROINCREMENTED_VALUE4606 4607
+#define BSLS_MACROINCREMENTED_VALUE4607 4608
+#define BSLS_MACROINCREMENTED_VALUE4608 4609
+#define BSLS_MACROINCREMENTED_VALUE4609 4610
+#define BSLS_MACROINCREMENTED_VALUE4610 4611
+#define BSLS_MACROINCREMENTED_VALUE4611 4612
+#define BSLS_MACROINCREMENTED_VALUE4612 4613
+#define BSLS_MACROINCREMENTED_VALUE4613 4614
+#define BSLS_MACROINCREMENTED_VALUE4614 4615
+#define BSLS_MACROINCREMENTED_VALUE4615 4616
+#define BSLS_MACROINCREMENTED_VALUE4616 4617
+#define BSLS_MACROINCREMENTED_VALUE4617 4618
+#define BSLS_MACROINCREMENTED_VALUE4618 4619
+#define BSLS_MACROINCREMENTED_VALUE4619 4620
+#define BSLS_MACROINCREMENTED_VALUE4620 4621
+#define BSLS_MACROINCREMENTED_VALUE4621 4622
+#define BSLS_MACROINCREMENTED_VALUE4622 4623
+#define BSLS_MACROINCREMENTED_VALUE4623 4624
+#define BSLS_MACROINCREMENTED_VALUE4624 4625
+#define BSLS_MACROINCREMENTED_VALUE4625 4626
+#define BSLS_MACROINCREMENTED_VALUE4626 4627
+#define BSLS_MACROINCREMENTED_VALUE4627 4628
+#define BSLS_MACROINCREMENTED_VALUE4628 4629
+#define BSLS_MACROINCREMENTED_VALUE4629 4630
+#define BSLS_MACROINCREMENTED_VALUE4630 4631
+#define BSLS_MACROINCREMENTED_VALUE4631 4632
+#define BSLS_MACROINCREMENTED_VALUE4632 4633
+#define BSLS_MACROINCREMENTED_VALUE4633 4634
+#define BSLS_MACROINCREMENTED_VALUE4634 4635
+#define BSLS_MACROINCREMENTED_VALUE4635 4636
+#define BSLS_MACROINCREMENTED_VALUE4636 4637
+#define BSLS_MACROINCREMENTED_VALUE4637 4638
+#define BSLS_MACROINCREMENTED_VALUE4638 4639
+#define BSLS_MACROINCREMENTED_VALUE4639 4640
+#define BSLS_MACROINCREMENTED_VALUE4640 4641
+#define BSLS_MACROINCREMENTED_VALUE4641 4642
+#define BSLS_MACROINCREMENTED_VALUE4642 4643
+#define BSLS_MACROINCREMENTED_VALUE4643 4644
+#define BSLS_MACROINCREMENTED_VALUE4644 4645
+#define BSLS_MACROINCREMENTED_VALUE4645 4646
+#define BSLS_MACROINCREMENTED_VALUE4646 4647
+#define BSLS_MACROINCREMENTED_VALUE4647 4648
+#define BSLS_MACROINCREMENTED_VALUE4648 4649
+#define BSLS_MACROINCREMENTED_VALUE4649 4650
+#define BSLS_MACROINCREMENTED_VALUE4650 4651
+#define BSLS_MACROINCREMENTED_VALUE4651 4652
+#define BSLS_MACROINCREMENTED_VALUE4652 4653
+#define BSLS_MACROINCREMENTED_VALUE4653 4654
+#define BSLS_MACROINCREMENTED_VALUE4654 4655
+#define BSLS_MACROINCREMENTED_VALUE4655 4656
+#define BSLS_MACROINCREMENTED_VALUE4656 4657
+#define BSLS_MACROINCREMENTED_VALUE4657 4658
+#define BSLS_MACROINCREMENTED_VALUE4658 4659
+#define BSLS_MACROINCREMENTED_VALUE4659 4660
+#define BSLS_MACROINCREMENTED_VALUE4660 4661
+#define BSLS_MACROINCREMENTED_VALUE4661 4662
+#define BSLS_MACROINCREMENTED_VALUE4662 4663
+#define BSLS_MACROINCREMENTED_VALUE4663 4664
+#define BSLS_MACROINCREMENTED_VALUE4664 4665
+#define BSLS_MACROINCREMENTED_VALUE4665 4666
+#define BSLS_MACROINCREMENTED_VALUE4666 4667
+#define BSLS_MACROINCREMENTED_VALUE4667 4668
+#define BSLS_MACROINCREMENTED_VALUE4668 4669
+#define BSLS_MACROINCREMENTED_VALUE4669 4670
+#define BSLS_MACROINCREMENTED_VALUE4670 4671
+#define BSLS_MACROINCREMENTED_VALUE4671 4672
+#define BSLS_MACROINCREMENTED_VALUE4672 4673
+#define BSLS_MACROINCREMENTED_VALUE4673 4674
+#define BSLS_MACROINCREMENTED_VALUE4674 4675
+#define BSLS_MACROINCREMENTED_VALUE4675 4676
+#define BSLS_MACROINCREMENTED_VALUE4676 4677
+#define BSLS_MACROINCREMENTED_VALUE4677 4678
+#define BSLS_MACROINCREMENTED_VALUE4678 4679
+#define BSLS_MACROINCREMENTED_VALUE4679 4680
+#define BSLS_MACROINCREMENTED_VALUE4680 4681
+#define BSLS_MACROINCREMENTED_VALUE4681 4682
+#define BSLS_MACROINCREMENTED_VALUE4682 4683
+#define BSLS_MACROINCREMENTED_VALUE4683 4684
+#define BSLS_MACROINCREMENTED_VALUE4684 4685
+#define BSLS_MACROINCREMENTED_VALUE4685 4686
+#define BSLS_MACROINCREMENTED_VALUE4686 4687
+#define BSLS_MACROINCREMENTED_VALUE4687 4688
+#define BSLS_MACROINCREMENTED_VALUE4688 4689
+#define BSLS_MACROINCREMENTED_VALUE4689 4690
+#define BSLS_MACROINCREMENTED_VALUE4690 4691
+#define BSLS_MACROINCREMENTED_VALUE4691 4692
+#define BSLS_MACROINCREMENTED_VALUE4692 4693
+#define BSLS_MACROINCREMENTED_VALUE4693 4694
+#define BSLS_MACROINCREMENTED_VALUE4694 4695
+#define BSLS_MACROINCREMENTED_VALUE4695 4696
+#define BSLS_MACROINCREMENTED_VALUE4696 4697
+#define BSLS_MACROINCREMENTED_VALUE4697 4698
+#define BSLS_MACROINCREMENTED_VALUE4698 4699
+#define BSLS_MACROINCREMENTED_VALUE4699 4700
+#define BSLS_MACROINCREMENTED_VALUE4700 4701
+#define BSLS_MACROINCREMENTED_VALUE4701 4702
+#define BSLS_MACROINCREMENTED_VALUE4702 4703
+#define BSLS_MACROINCREMENTED_VALUE4703 4704
+#define BSLS_MACROINCREMENTED_VALUE4704 4705
+#define BSLS_MACROINCREMENTED_VALUE4705 4706
+#define BSLS_MACROINCREMENTED_VALUE4706 4707
+#define BSLS_MACROINCREMENTED_VALUE4707 4708
+#define BSLS_MACROINCREMENTED_VALUE4708 4709
+#define BSLS_MACROINCREMENTED_VALUE4709 4710
+#define BSLS_MACROINCREMENTED_VALUE4710 4711
+#define BSLS_MACROINCREMENTED_VALUE4711 4712
+#define BSLS_MACROINCREMENTED_VALUE4712 4713
+#define BSLS_MACROINCREMENTED_VALUE4713 4714
+#define BSLS_MACROINCREMENTED_VALUE4714 4715
+#define BSLS_MACROINCREMENTED_VALUE4715 4716
+#define BSLS_MACROINCREMENTED_VALUE4716 4717
+#define BSLS_MACROINCREMENTED_VALUE4717 4718
+#define BSLS_MACROINCREMENTED_VALUE4718 4719
+#define BSLS_MACROINCREMENTED_VALUE4719 4720
+#define BSLS_MACROINCREMENTED_VALUE4720 4721
+#define BSLS_MACROINCREMENTED_VALUE4721 4722
+#define BSLS_MACROINCREMENTED_VALUE4722 4723
+#define BSLS_MACROINCREMENTED_VALUE4723 4724
+#define BSLS_MACROINCREMENTED_VALUE4724 4725
+#define BSLS_MACROINCREMENTED_VALUE4725 4726
+#define BSLS_MACROINCREMENTED_VALUE4726 4727
+#define BSLS_MACROINCREMENTED_VALUE4727 4728
+#define BSLS_MACROINCREMENTED_VALUE4728 4729
+#define BSLS_MACROINCREMENTED_VALUE4729 4730
+#define BSLS_MACROINCREMENTED_VALUE4730 4731
+#define BSLS_MACROINCREMENTED_VALUE4731 4732
+#define BSLS_MACROINCREMENTED_VALUE4732 4733
+#define BSLS_MACROINCREMENTED_VALUE4733 4734
+#define BSLS_MACROINCREMENTED_VALUE4734 4735
+#define BSLS_MACROINCREMENTED_VALUE4735 4736
+#define BSLS_MACROINCREMENTED_VALUE4736 4737
+#define BSLS_MACROINCREMENTED_VALUE4737 4738
+#define BSLS_MACROINCREMENTED_VALUE4738 4739
+#define BSLS_MACROINCREMENTED_VALUE4739 4740
+#define BSLS_MACROINCREMENTED_VALUE4740 4741
+#define BSLS_MACROINCREMENTED_VALUE4741 4742
+#define BSLS_MACROINCREMENTED_VALUE4742 4743
+#define BSLS_MACROINCREMENTED_VALUE4743 4744
+#define BSLS_MACROINCREMENTED_VALUE4744 4745
+#define BSLS_MACROINCREMENTED_VALUE4745 4746
+#define BSLS_MACROINCREMENTED_VALUE4746 4747
+#define BSLS_MACROINCREMENTED_VALUE4747 4748
+#define BSLS_MACROINCREMENTED_VALUE4748 4749
+#define BSLS_MACROINCREMENTED_VALUE4749 4750
+#define BSLS_MACROINCREMENTED_VALUE4750 4751
+#define BSLS_MACROINCREMENTED_VALUE4751 4752
+#define BSLS_MACROINCREMENTED_VALUE4752 4753
+#define BSLS_MACROINCREMENTED_VALUE4753 4754
+#define BSLS_MACROINCREMENTED_VALUE4754 4755
+#define BSLS_MACROINCREMENTED_VALUE4755 4756
+#define BSLS_MACROINCREMENTED_VALUE4756 4757
+#define BSLS_MACROINCREMENTED_VALUE4757 4758
+#define BSLS_MACROINCREMENTED_VALUE4758 4759
+#define BSLS_MACROINCREMENTED_VALUE4759 4760
+#define BSLS_MACROINCREMENTED_VALUE4760 4761
+#define BSLS_MACROINCREMENTED_VALUE4761 4762
+#define BSLS_MACROINCREMENTED_VALUE4762 4763
+#define BSLS_MACROINCREMENTED_VALUE4763 4764
+#define BSLS_MACROINCREMENTED_VALUE4764 4765
+#define BSLS_MACROINCREMENTED_VALUE4765 4766
+#define BSLS_MACROINCREMENTED_VALUE4766 4767
+#define BSLS_MACROINCREMENTED_VALUE4767 4768
+#define BSLS_MACROINCREMENTED_VALUE4768 4769
+#define BSLS_MACROINCREMENTED_VALUE4769 4770
+#define BSLS_MACROINCREMENTED_VALUE4770 4771
+#define BSLS_MACROINCREMENTED_VALUE4771 4772
+#define BSLS_MACROINCREMENTED_VALUE4772 4773
+#define BSLS_MACROINCREMENTED_VALUE4773 4774
+#define BSLS_MACROINCREMENTED_VALUE4774 4775
+#define BSLS_MACROINCREMENTED_VALUE4775 4776
+#define BSLS_MACROINCREMENTED_VALUE4776 4777
+#define BSLS_MACROINCREMENTED_VALUE4777 4778
+#define BSLS_MACROINCREMENTED_VALUE4778 4779
+#define BSLS_MACROINCREMENTED_VALUE4779 4780
+#define BSLS_MACROINCREMENTED_VALUE4780 4781
+#define BSLS_MACROINCREMENTED_VALUE4781 4782
+#define BSLS_MACROINCREMENTED_VALUE4782 4783
+#define BSLS_MACROINCREMENTED_VALUE4783 4784
+#define BSLS_MACROINCREMENTED_VALUE4784 4785
+#define BSLS_MACROINCREMENTED_VALUE4785 4786
+#define BSLS_MACROINCREMENTED_VALUE4786 4787
+#define BSLS_MACROINCREMENTED_VALUE4787 4788
+#define BSLS_MACROINCREMENTED_VALUE4788 4789
+#define BSLS_MACROINCREMENTED_VALUE4789 4790
+#define BSLS_MACROINCREMENTED_VALUE4790 4791
+#define BSLS_MACROINCREMENTED_VALUE4791 4792
+#define BSLS_MACROINCREMENTED_VALUE4792 4793
+#define BSLS_MACROINCREMENTED_VALUE4793 4794
+#define BSLS_MACROINCREMENTED_VALUE4794 4795
+#define BSLS_MACROINCREMENTED_VALUE4795 4796
+#define BSLS_MACROINCREMENTED_VALUE4796 4797
+#define BSLS_MACROINCREMENTED_VALUE4797 4798
+#define BSLS_MACROINCREMENTED_VALUE4798 4799
+#define BSLS_MACROINCREMENTED_VALUE4799 4800
+#define BSLS_MACROINCREMENTED_VALUE4800 4801
+#define BSLS_MACROINCREMENTED_VALUE4801 4802
+#define BSLS_MACROINCREMENTED_VALUE4802 4803
+#define BSLS_MACROINCREMENTED_VALUE4803 4804
+#define BSLS_MACROINCREMENTED_VALUE4804 4805
+#define BSLS_MACROINCREMENTED_VALUE4805 4806
+#define BSLS_MACROINCREMENTED_VALUE4806 4807
+#define BSLS_MACROINCREMENTED_VALUE4807 4808
+#define BSLS_MACROINCREMENTED_VALUE4808 4809
+#define BSLS_MACROINCREMENTED_VALUE4809 4810
+#define BSLS_MACROINCREMENTED_VALUE4810 4811
+#define BSLS_MACROINCREMENTED_VALUE4811 4812
+#define BSLS_MACROINCREMENTED_VALUE4812 4813
+#define BSLS_MACROINCREMENTED_VALUE4813 4814
+#define BSLS_MACROINCREMENTED_VALUE4814 4815
+#define BSLS_MACROINCREMENTED_VALUE4815 4816
+#define BSLS_MACROINCREMENTED_VALUE4816 4817
+#define BSLS_MACROINCREMENTED_VALUE4817 4818
+#define BSLS_MACROINCREMENTED_VALUE4818 4819
+#define BSLS_MACROINCREMENTED_VALUE4819 4820
+#define BSLS_MACROINCREMENTED_VALUE4820 4821
+#define BSLS_MACROINCREMENTED_VALUE4821 4822
+#define BSLS_MACROINCREMENTED_VALUE4822 4823
+#define BSLS_MACROINCREMENTED_VALUE4823 4824
+#define BSLS_MACROINCREMENTED_VALUE4824 4825
+#define BSLS_MACROINCREMENTED_VALUE4825 4826
+#define BSLS_MACROINCREMENTED_VALUE4826 4827
+#define BSLS_MACROINCREMENTED_VALUE4827 4828
+#define BSLS_MACROINCREMENTED_VALUE4828 4829
+#define BSLS_MACROINCREMENTED_VALUE4829 4830
+#define BSLS_MACROINCREMENTED_VALUE4830 4831
+#define BSLS_MACROINCREMENTED_VALUE4831 4832
+#define BSLS_MACROINCREMENTED_VALUE4832 4833
+#define BSLS_MACROINCREMENTED_VALUE4833 4834
+#define BSLS_MACROINCREMENTED_VALUE4834 4835
+#define BSLS_MACROINCREMENTED_VALUE4835 4836
+#define BSLS_MACROINCREMENTED_VALUE4836 4837
+#define BSLS_MACROINCREMENTED_VALUE4837 4838
+#define BSLS_MACROINCREMENTED_VALUE4838 4839
+#define BSLS_MACROINCREMENTED_VALUE4839 4840
+#define BSLS_MACROINCREMENTED_VALUE4840 4841
+#define BSLS_MACROINCREMENTED_VALUE4841 4842
+#define BSLS_MACROINCREMENTED_VALUE4842 4843
+#define BSLS_MACROINCREMENTED_VALUE4843 4844
+#define BSLS_MACROINCREMENTED_VALUE4844 4845
+#define BSLS_MACROINCREMENTED_VALUE4845 4846
+#define BSLS_MACROINCREMENTED_VALUE4846 4847
+#define BSLS_MACROINCREMENTED_VALUE4847 4848
+#define BSLS_MACROINCREMENTED_VALUE4848 4849
+#define BSLS_MACROINCREMENTED_VALUE4849 4850
+#define BSLS_MACROINCREMENTED_VALUE4850 4851
+#define BSLS_MACROINCREMENTED_VALUE4851 4852
+#define BSLS_MACROINCREMENTED_VALUE4852 4853
+#define BSLS_MACROINCREMENTED_VALUE4853 4854
+#define BSLS_MACROINCREMENTED_VALUE4854 4855
+#define BSLS_MACROINCREMENTED_VALUE4855 4856
+#define BSLS_MACROINCREMENTED_VALUE4856 4857
+#define BSLS_MACROINCREMENTED_VALUE4857 4858
+#define BSLS_MACROINCREMENTED_VALUE4858 4859
+#define BSLS_MACROINCREMENTED_VALUE4859 4860
+#define BSLS_MACROINCREMENTED_VALUE4860 4861
+#define BSLS_MACROINCREMENTED_VALUE4861 4862
+#define BSLS_MACROINCREMENTED_VALUE4862 4863
+#define BSLS_MACROINCREMENTED_VALUE4863 4864
+#define BSLS_MACROINCREMENTED_VALUE4864 4865
+#define BSLS_MACROINCREMENTED_VALUE4865 4866
+#define BSLS_MACROINCREMENTED_VALUE4866 4867
+#define BSLS_MACROINCREMENTED_VALUE4867 4868
+#define BSLS_MACROINCREMENTED_VALUE4868 4869
+#define BSLS_MACROINCREMENTED_VALUE4869 4870
+#define BSLS_MACROINCREMENTED_VALUE4870 4871
+#define BSLS_MACROINCREMENTED_VALUE4871 4872
+#define BSLS_MACROINCREMENTED_VALUE4872 4873
+#define BSLS_MACROINCREMENTED_VALUE4873 4874
+#define BSLS_MACROINCREMENTED_VALUE4874 4875
+#define BSLS_MACROINCREMENTED_VALUE4875 4876
+#define BSLS_MACROINCREMENTED_VALUE4876 4877
+#define BSLS_MACROINCREMENTED_VALUE4877 4878
+#define BSLS_MACROINCREMENTED_VALUE4878 4879
+#define BSLS_MACROINCREMENTED_VALUE4879 4880
+#define BSLS_MACROINCREMENTED_VALUE4880 4881
+#define BSLS_MACROINCREMENTED_VALUE4881 4882
+#define BSLS_MACROINCREMENTED_VALUE4882 4883
+#define BSLS_MACROINCREMENTED_VALUE4883 4884
+#define BSLS_MACROINCREMENTED_VALUE4884 4885
+#define BSLS_MACROINCREMENTED_VALUE4885 4886
+#define BSLS_MACROINCREMENTED_VALUE4886 4887
+#define BSLS_MACROINCREMENTED_VALUE4887 4888
+#define BSLS_MACROINCREMENTED_VALUE4888 4889
+#define BSLS_MACROINCREMENTED_VALUE4889 4890
+#define BSLS_MACROINCREMENTED_VALUE4890 4891
+#define BSLS_MACROINCREMENTED_VALUE4891 4892
+#define BSLS_MACROINCREMENTED_VALUE4892 4893
+#define BSLS_MACROINCREMENTED_VALUE4893 4894
+#define BSLS_MACROINCREMENTED_VALUE4894 4895
+#define BSLS_MACROINCREMENTED_VALUE4895 4896
+#define BSLS_MACROINCREMENTED_VALUE4896 4897
+#define BSLS_MACROINCREMENTED_VALUE4897 4898
+#define BSLS_MACROINCREMENTED_VALUE4898 4899
+#define BSLS_MACROINCREMENTED_VALUE4899 4900
+#define BSLS_MACROINCREMENTED_VALUE4900 4901
+#define BSLS_MACROINCREMENTED_VALUE4901 4902
+#define BSLS_MACROINCREMENTED_VALUE4902 4903
+#define BSLS_MACROINCREMENTED_VALUE4903 4904
+#define BSLS_MACROINCREMENTED_VALUE4904 4905
+#define BSLS_MACROINCREMENTED_VALUE4905 4906
+#define BSLS_MACROINCREMENTED_VALUE4906 4907
+#define BSLS_MACROINCREMENTED_VALUE4907 4908
+#define BSLS_MACROINCREMENTED_VALUE4908 4909
+#define BSLS_MACROINCREMENTED_VALUE4909 4910
+#define BSLS_MACROINCREMENTED_VALUE4910 4911
+#define BSLS_MACROINCREMENTED_VALUE4911 4912
+#define BSLS_MACROINCREMENTED_VALUE4912 4913
+#define BSLS_MACROINCREMENTED_VALUE4913 4914
+#define BSLS_MACROINCREMENTED_VALUE4914 4915
+#define BSLS_MACROINCREMENTED_VALUE4915 4916
+#define BSLS_MACROINCREMENTED_VALUE4916 4917
+#define BSLS_MACROINCREMENTED_VALUE4917 4918
+#define BSLS_MACROINCREMENTED_VALUE4918 4919
+#define BSLS_MACROINCREMENTED_VALUE4919 4920
+#define BSLS_MACROINCREMENTED_VALUE4920 4921
+#define BSLS_MACROINCREMENTED_VALUE4921 4922
+#define BSLS_MACROINCREMENTED_VALUE4922 4923
+#define BSLS_MACROINCREMENTED_VALUE4923 4924
+#define BSLS_MACROINCREMENTED_VALUE4924 4925
+#define BSLS_MACROINCREMENTED_VALUE4925 4926
+#define BSLS_MACROINCREMENTED_VALUE4926 4927
+#define BSLS_MACROINCREMENTED_VALUE4927 4928
+#define BSLS_MACROINCREMENTED_VALUE4928 4929
+#define BSLS_MACROINCREMENTED_VALUE4929 4930
+#define BSLS_MACROINCREMENTED_VALUE4930 4931
+#define BSLS_MACROINCREMENTED_VALUE4931 4932
+#define BSLS_MACROINCREMENTED_VALUE4932 4933
+#define BSLS_MACROINCREMENTED_VALUE4933 4934
+#define BSLS_MACROINCREMENTED_VALUE4934 4935
+#define BSLS_MACROINCREMENTED_VALUE4935 4936
+#define BSLS_MACROINCREMENTED_VALUE4936 4937
+#define BSLS_MACROINCREMENTED_VALUE4937 4938
+#define BSLS_MACROINCREMENTED_VALUE4938 4939
+#define BSLS_MACROINCREMENTED_VALUE4939 4940
+#define BSLS_MACROINCREMENTED_VALUE4940 4941
+#define BSLS_MACROINCREMENTED_VALUE4941 4942
+#define BSLS_MACROINCREMENTED_VALUE4942 4943
+#define BSLS_MACROINCREMENTED_VALUE4943 4944
+#define BSLS_MACROINCREMENTED_VALUE4944 4945
+#define BSLS_MACROINCREMENTED_VALUE4945 4946
+#define BSLS_MACROINCREMENTED_VALUE4946 4947
+#define BSLS_MACROINCREMENTED_VALUE4947 4948
+#define BSLS_MACROINCREMENTED_VALUE4948 4949
+#define BSLS_MACROINCREMENTED_VALUE4949 4950
+#define BSLS_MACROINCREMENTED_VALUE4950 4951
+#define BSLS_MACROINCREMENTED_VALUE4951 4952
+#define BSLS_MACROINCREMENTED_VALUE4952 4953
+#define BSLS_MACROINCREMENTED_VALUE4953 4954
+#define BSLS_MACROINCREMENTED_VALUE4954 4955
+#define BSLS_MACROINCREMENTED_VALUE4955 4956
+#define BSLS_MACROINCREMENTED_VALUE4956 4957
+#define BSLS_MACROINCREMENTED_VALUE4957 4958
+#define BSLS_MACROINCREMENTED_VALUE4958 4959
+#define BSLS_MACROINCREMENTED_VALUE4959 4960
+#define BSLS_MACROINCREMENTED_VALUE4960 4961
+#define BSLS_MACROINCREMENTED_VALUE4961 4962
+#define BSLS_MACROINCREMENTED_VALUE4962 4963
+#define BSLS_MACROINCREMENTED_VALUE4963 4964
+#define BSLS_MACROINCREMENTED_VALUE4964 4965
+#define BSLS_MACROINCREMENTED_VALUE4965 4966
+#define BSLS_MACROINCREMENTED_VALUE4966 4967
+#define BSLS_MACROINCREMENTED_VALUE4967 4968
+#define BSLS_MACROINCREMENTED_VALUE4968 4969
+#define BSLS_MACROINCREMENTED_VALUE4969 4970
+#define BSLS_MACROINCREMENTED_VALUE4970 4971
+#define BSLS_MACROINCREMENTED_VALUE4971 4972
+#define BSLS_MACROINCREMENTED_VALUE4972 4973
+#define BSLS_MACROINCREMENTED_VALUE4973 4974
+#define BSLS_MACROINCREMENTED_VALUE4974 4975
+#define BSLS_MACROINCREMENTED_VALUE4975 4976
+#define BSLS_MACROINCREMENTED_VALUE4976 4977
+#define BSLS_MACROINCREMENTED_VALUE4977 4978
+#define BSLS_MACROINCREMENTED_VALUE4978 4979
+#define BSLS_MACROINCREMENTED_VALUE4979 4980
+#define BSLS_MACROINCREMENTED_VALUE4980 4981
+#define BSLS_MACROINCREMENTED_VALUE4981 4982
+#define BSLS_MACROINCREMENTED_VALUE4982 4983
+#define BSLS_MACROINCREMENTED_VALUE4983 4984
+#define BSLS_MACROINCREMENTED_VALUE4984 4985
+#define BSLS_MACROINCREMENTED_VALUE4985 4986
+#define BSLS_MACROINCREMENTED_VALUE4986 4987
+#define BSLS_MACROINCREMENTED_VALUE4987 4988
+#define BSLS_MACROINCREMENTED_VALUE4988 4989
+#define BSLS_MACROINCREMENTED_VALUE4989 4990
+#define BSLS_MACROINCREMENTED_VALUE4990 4991
+#define BSLS_MACROINCREMENTED_VALUE4991 4992
+#define BSLS_MACROINCREMENTED_VALUE4992 4993
+#define BSLS_MACROINCREMENTED_VALUE4993 4994
+#define BSLS_MACROINCREMENTED_VALUE4994 4995
+#define BSLS_MACROINCREMENTED_VALUE4995 4996
+#define BSLS_MACROINCREMENTED_VALUE4996 4997
+#define BSLS_MACROINCREMENTED_VALUE4997 4998
+#define BSLS_MACROINCREMENTED_VALUE4998 4999
+#define BSLS_MACROINCREMENTED_VALUE4999 5000
+#define BSLS_MACROINCREMENTED_VALUE5000 5001
+#define BSLS_MACROINCREMENTED_VALUE5001 5002
+#define BSLS_MACROINCREMENTED_VALUE5002 5003
+#define BSLS_MACROINCREMENTED_VALUE5003 5004
+#define BSLS_MACROINCREMENTED_VALUE5004 5005
+#define BSLS_MACROINCREMENTED_VALUE5005 5006
+#define BSLS_MACROINCREMENTED_VALUE5006 5007
+#define BSLS_MACROINCREMENTED_VALUE5007 5008
+#define BSLS_MACROINCREMENTED_VALUE5008 5009
+#define BSLS_MACROINCREMENTED_VALUE5009 5010
+#define BSLS_MACROINCREMENTED_VALUE5010 5011
+#define BSLS_MACROINCREMENTED_VALUE5011 5012
+#define BSLS_MACROINCREMENTED_VALUE5012 5013
+#define BSLS_MACROINCREMENTED_VALUE5013 5014
+#define BSLS_MACROINCREMENTED_VALUE5014 5015
+#define BSLS_MACROINCREMENTED_VALUE5015 5016
+#define BSLS_MACROINCREMENTED_VALUE5016 5017
+#define BSLS_MACROINCREMENTED_VALUE5017 5018
+#define BSLS_MACROINCREMENTED_VALUE5018 5019
+#define BSLS_MACROINCREMENTED_VALUE5019 5020
+#define BSLS_MACROINCREMENTED_VALUE5020 5021
+#define BSLS_MACROINCREMENTED_VALUE5021 5022
+#define BSLS_MACROINCREMENTED_VALUE5022 5023
+#define BSLS_MACROINCREMENTED_VALUE5023 5024
+#define BSLS_MACROINCREMENTED_VALUE5024 5025
+#define BSLS_MACROINCREMENTED_VALUE5025 5026
+#define BSLS_MACROINCREMENTED_VALUE5026 5027
+#define BSLS_MACROINCREMENTED_VALUE5027 5028
+#define BSLS_MACROINCREMENTED_VALUE5028 5029
+#define BSLS_MACROINCREMENTED_VALUE5029 5030
+#define BSLS_MACROINCREMENTED_VALUE5030 5031
+#define BSLS_MACROINCREMENTED_VALUE5031 5032
+#define BSLS_MACROINCREMENTED_VALUE5032 5033
+#define BSLS_MACROINCREMENTED_VALUE5033 5034
+#define BSLS_MACROINCREMENTED_VALUE5034 5035
+#define BSLS_MACROINCREMENTED_VALUE5035 5036
+#define BSLS_MACROINCREMENTED_VALUE5036 5037
+#define BSLS_MACROINCREMENTED_VALUE5037 5038
+#define BSLS_MACROINCREMENTED_VALUE5038 5039
+#define BSLS_MACROINCREMENTED_VALUE5039 5040
+#define BSLS_MACROINCREMENTED_VALUE5040 5041
+#define BSLS_MACROINCREMENTED_VALUE5041 5042
+#define BSLS_MACROINCREMENTED_VALUE5042 5043
+#define BSLS_MACROINCREMENTED_VALUE5043 5044
+#define BSLS_MACROINCREMENTED_VALUE5044 5045
+#define BSLS_MACROINCREMENTED_VALUE5045 5046
+#define BSLS_MACROINCREMENTED_VALUE5046 5047
+#define BSLS_MACROINCREMENTED_VALUE5047 5048
+#define BSLS_MACROINCREMENTED_VALUE5048 5049
+#define BSLS_MACROINCREMENTED_VALUE5049 5050
+#define BSLS_MACROINCREMENTED_VALUE5050 5051
+#define BSLS_MACROINCREMENTED_VALUE5051 5052
+#define BSLS_MACROINCREMENTED_VALUE5052 5053
+#define BSLS_MACROINCREMENTED_VALUE5053 5054
+#define BSLS_MACROINCREMENTED_VALUE5054 5055
+#define BSLS_MACROINCREMENTED_VALUE5055 5056
+#define BSLS_MACROINCREMENTED_VALUE5056 5057
+#define BSLS_MACROINCREMENTED_VALUE5057 5058
+#define BSLS_MACROINCREMENTED_VALUE5058 5059
+#define BSLS_MACROINCREMENTED_VALUE5059 5060
+#define BSLS_MACROINCREMENTED_VALUE5060 5061
+#define BSLS_MACROINCREMENTED_VALUE5061 5062
+#define BSLS_MACROINCREMENTED_VALUE5062 5063
+#define BSLS_MACROINCREMENTED_VALUE5063 5064
+#define BSLS_MACROINCREMENTED_VALUE5064 5065
+#define BSLS_MACROINCREMENTED_VALUE5065 5066
+#define BSLS_MACROINCREMENTED_VALUE5066 5067
+#define BSLS_MACROINCREMENTED_VALUE5067 5068
+#define BSLS_MACROINCREMENTED_VALUE5068 5069
+#define BSLS_MACROINCREMENTED_VALUE5069 5070
+#define BSLS_MACROINCREMENTED_VALUE5070 5071
+#define BSLS_MACROINCREMENTED_VALUE5071 5072
+#define BSLS_MACROINCREMENTED_VALUE5072 5073
+#define BSLS_MACROINCREMENTED_VALUE5073 5074
+#define BSLS_MACROINCREMENTED_VALUE5074 5075
+#define BSLS_MACROINCREMENTED_VALUE5075 5076
+#define BSLS_MACROINCREMENTED_VALUE5076 5077
+#define BSLS_MACROINCREMENTED_VALUE5077 5078
+#define BSLS_MACROINCREMENTED_VALUE5078 5079
+#define BSLS_MACROINCREMENTED_VALUE5079 5080
+#define BSLS_MACROINCREMENTED_VALUE5080 5081
+#define BSLS_MACROINCREMENTED_VALUE5081 5082
+#define BSLS_MACROINCREMENTED_VALUE5082 5083
+#define BSLS_MACROINCREMENTED_VALUE5083 5084
+#define BSLS_MACROINCREMENTED_VALUE5084 5085
+#define BSLS_MACROINCREMENTED_VALUE5085 5086
+#define BSLS_MACROINCREMENTED_VALUE5086 5087
+#define BSLS_MACROINCREMENTED_VALUE5087 5088
+#define BSLS_MACROINCREMENTED_VALUE5088 5089
+#define BSLS_MACROINCREMENTED_VALUE5089 5090
+#define BSLS_MACROINCREMENTED_VALUE5090 5091
+#define BSLS_MACROINCREMENTED_VALUE5091 5092
+#define BSLS_MACROINCREMENTED_VALUE5092 5093
+#define BSLS_MACROINCREMENTED_VALUE5093 5094
+#define BSLS_MACROINCREMENTED_VALUE5094 5095
+#define BSLS_MACROINCREMENTED_VALUE5095 5096
+#define BSLS_MACROINCREMENTED_VALUE5096 5097
+#define BSLS_MACROINCREMENTED_VALUE5097 5098
+#define BSLS_MACROINCREMENTED_VALUE5098 5099
+#define BSLS_MACROINCREMENTED_VALUE5099 5100
+#define BSLS_MACROINCREMENTED_VALUE5100 5101
+#define BSLS_MACROINCREMENTED_VALUE5101 5102
+#define BSLS_MACROINCREMENTED_VALUE5102 5103
+#define BSLS_MACROINCREMENTED_VALUE5103 5104
+#define BSLS_MACROINCREMENTED_VALUE5104 5105
+#define BSLS_MACROINCREMENTED_VALUE5105 5106
+#define BSLS_MACROINCREMENTED_VALUE5106 5107
+#define BSLS_MACROINCREMENTED_VALUE5107 5108
+#define BSLS_MACROINCREMENTED_VALUE5108 5109
+#define BSLS_MACROINCREMENTED_VALUE5109 5110
+#define BSLS_MACROINCREMENTED_VALUE5110 5111
+#define BSLS_MACROINCREMENTED_VALUE5111 5112
+#define BSLS_MACROINCREMENTED_VALUE5112 5113
+#define BSLS_MACROINCREMENTED_VALUE5113 5114
+#define BSLS_MACROINCREMENTED_VALUE5114 5115
+#define BSLS_MACROINCREMENTED_VALUE5115 5116
+#define BSLS_MACROINCREMENTED_VALUE5116 5117
+#define BSLS_MACROINCREMENTED_VALUE5117 5118
+#define BSLS_MACROINCREMENTED_VALUE5118 5119
+#define BSLS_MACROINCREMENTED_VALUE5119 5120
+#define BSLS_MACROINCREMENTED_VALUE5120 5121
+#define BSLS_MACROINCREMENTED_VALUE5121 5122
+#define BSLS_MACROINCREMENTED_VALUE5122 5123
+#define BSLS_MACROINCREMENTED_VALUE5123 5124
+#define BSLS_MACROINCREMENTED_VALUE5124 5125
+#define BSLS_MACROINCREMENTED_VALUE5125 5126
+#define BSLS_MACROINCREMENTED_VALUE5126 5127
+#define BSLS_MACROINCREMENTED_VALUE5127 5128
+#define BSLS_MACROINCREMENTED_VALUE5128 5129
+#define BSLS_MACROINCREMENTED_VALUE5129 5130
+#define BSLS_MACROINCREMENTED_VALUE5130 5131
+#define BSLS_MACROINCREMENTED_VALUE5131 5132
+#define BSLS_MACROINCREMENTED_VALUE5132 5133
+#define BSLS_MACROINCREMENTED_VALUE5133 5134
+#define BSLS_MACROINCREMENTED_VALUE5134 5135
+#define BSLS_MACROINCREMENTED_VALUE5135 5136
+#define BSLS_MACROINCREMENTED_VALUE5136 5137
+#define BSLS_MACROINCREMENTED_VALUE5137 5138
+#define BSLS_MACROINCREMENTED_VALUE5138 5139
+#define BSLS_MACROINCREMENTED_VALUE5139 5140
+#define BSLS_MACROINCREMENTED_VALUE5140 5141
+#define BSLS_MACROINCREMENTED_VALUE5141 5142
+#define BSLS_MACROINCREMENTED_VALUE5142 5143
+#define BSLS_MACROINCREMENTED_VALUE5143 5144
+#define BSLS_MACROINCREMENTED_VALUE5144 5145
+#define BSLS_MACROINCREMENTED_VALUE5145 5146
+#define BSLS_MACROINCREMENTED_VALUE5146 5147
+#define BSLS_MACROINCREMENTED_VALUE5147 5148
+#define BSLS_MACROINCREMENTED_VALUE5148 5149
+#define BSLS_MACROINCREMENTED_VALUE5149 5150
+#define BSLS_MACROINCREMENTED_VALUE5150 5151
+#define BSLS_MACROINCREMENTED_VALUE5151 5152
+#define BSLS_MACROINCREMENTED_VALUE5152 5153
+#define BSLS_MACROINCREMENTED_VALUE5153 5154
+#define BSLS_MACROINCREMENTED_VALUE5154 5155
+#define BSLS_MACROINCREMENTED_VALUE5155 5156
+#define BSLS_MACROINCREMENTED_VALUE5156 5157
+#define BSLS_MACROINCREMENTED_VALUE5157 5158
+#define BSLS_MACROINCREMENTED_VALUE5158 5159
+#define BSLS_MACROINCREMENTED_VALUE5159 5160
+#define BSLS_MACROINCREMENTED_VALUE5160 5161
+#define BSLS_MACROINCREMENTED_VALUE5161 5162
+#define BSLS_MACROINCREMENTED_VALUE5162 5163
+#define BSLS_MACROINCREMENTED_VALUE5163 5164
+#define BSLS_MACROINCREMENTED_VALUE5164 5165
+#define BSLS_MACROINCREMENTED_VALUE5165 5166
+#define BSLS_MACROINCREMENTED_VALUE5166 5167
+#define BSLS_MACROINCREMENTED_VALUE5167 5168
+#define BSLS_MACROINCREMENTED_VALUE5168 5169
+#define BSLS_MACROINCREMENTED_VALUE5169 5170
+#define BSLS_MACROINCREMENTED_VALUE5170 5171
+#define BSLS_MACROINCREMENTED_VALUE5171 5172
+#define BSLS_MACROINCREMENTED_VALUE5172 5173
+#define BSLS_MACROINCREMENTED_VALUE5173 5174
+#define BSLS_MACROINCREMENTED_VALUE5174 5175
+#define BSLS_MACROINCREMENTED_VALUE5175 5176
+#define BSLS_MACROINCREMENTED_VALUE5176 5177
+#define BSLS_MACROINCREMENTED_VALUE5177 5178
+#define BSLS_MACROINCREMENTED_VALUE5178 5179
+#define BSLS_MACROINCREMENTED_VALUE5179 5180
+#define BSLS_MACROINCREMENTED_VALUE5180 5181
+#define BSLS_MACROINCREMENTED_VALUE5181 5182
+#define BSLS_MACROINCREMENTED_VALUE5182 5183
+#define BSLS_MACROINCREMENTED_VALUE5183 5184
+#define BSLS_MACROINCREMENTED_VALUE5184 5185
+#define BSLS_MACROINCREMENTED_VALUE5185 5186
+#define BSLS_MACROINCREMENTED_VALUE5186 5187
+#define BSLS_MACROINCREMENTED_VALUE5187 5188
+#define BSLS_MACROINCREMENTED_VALUE5188 5189
+#define BSLS_MACROINCREMENTED_VALUE5189 5190
+#define BSLS_MACROINCREMENTED_VALUE5190 5191
+#define BSLS_MACROINCREMENTED_VALUE5191 5192
+#define BSLS_MACROINCREMENTED_VALUE5192 5193
+#define BSLS_MACROINCREMENTED_VALUE5193 5194
+#define BSLS_MACROINCREMENTED_VALUE5194 5195
+#define BSLS_MACROINCREMENTED_VALUE5195 5196
+#define BSLS_MACROINCREMENTED_VALUE5196 5197
+#define BSLS_MACROINCREMENTED_VALUE5197 5198
+#define BSLS_MACROINCREMENTED_VALUE5198 5199
+#define BSLS_MACROINCREMENTED_VALUE5199 5200
+#define BSLS_MACROINCREMENTED_VALUE5200 5201
+#define BSLS_MACROINCREMENTED_VALUE5201 5202
+#define BSLS_MACROINCREMENTED_VALUE5202 5203
+#define BSLS_MACROINCREMENTED_VALUE5203 5204
+#define BSLS_MACROINCREMENTED_VALUE5204 5205
+#define BSLS_MACROINCREMENTED_VALUE5205 5206
+#define BSLS_MACROINCREMENTED_VALUE5206 5207
+#define BSLS_MACROINCREMENTED_VALUE5207 5208
+#define BSLS_MACROINCREMENTED_VALUE5208 5209
+#define BSLS_MACROINCREMENTED_VALUE5209 5210
+#define BSLS_MACROINCREMENTED_VALUE5210 5211
+#define BSLS_MACROINCREMENTED_VALUE5211 5212
+#define BSLS_MACROINCREMENTED_VALUE5212 5213
+#define BSLS_MACROINCREMENTED_VALUE5213 5214
+#define BSLS_MACROINCREMENTED_VALUE5214 5215
+#define BSLS_MACROINCREMENTED_VALUE5215 5216
+#define BSLS_MACROINCREMENTED_VALUE5216 5217
+#define BSLS_MACROINCREMENTED_VALUE5217 5218
+#define BSLS_MACROINCREMENTED_VALUE5218 5219
+#define BSLS_MACROINCREMENTED_VALUE5219 5220
+#define BSLS_MACROINCREMENTED_VALUE5220 5221
+#define BSLS_MACROINCREMENTED_VALUE5221 5222
+#define BSLS_MACROINCREMENTED_VALUE5222 5223
+#define BSLS_MACROINCREMENTED_VALUE5223 5224
+#define BSLS_MACROINCREMENTED_VALUE5224 5225
+#define BSLS_MACROINCREMENTED_VALUE5225 5226
+#define BSLS_MACROINCREMENTED_VALUE5226 5227
+#define BSLS_MACROINCREMENTED_VALUE5227 5228
+#define BSLS_MACROINCREMENTED_VALUE5228 5229
+#define BSLS_MACROINCREMENTED_VALUE5229 5230
+#define BSLS_MACROINCREMENTED_VALUE5230 5231
+#define BSLS_MACROINCREMENTED_VALUE5231 5232
+#define BSLS_MACROINCREMENTED_VALUE5232 5233
+#define BSLS_MACROINCREMENTED_VALUE5233 5234
+#define BSLS_MACROINCREMENTED_VALUE5234 5235
+#define BSLS_MACROINCREMENTED_VALUE5235 5236
+#define BSLS_MACROINCREMENTED_VALUE5236 5237
+#define BSLS_MACROINCREMENTED_VALUE5237 5238
+#define BSLS_MACROINCREMENTED_VALUE5238 5239
+#define BSLS_MACROINCREMENTED_VALUE5239 5240
+#define BSLS_MACROINCREMENTED_VALUE5240 5241
+#define BSLS_MACROINCREMENTED_VALUE5241 5242
+#define BSLS_MACROINCREMENTED_VALUE5242 5243
+#define BSLS_MACROINCREMENTED_VALUE5243 5244
+#define BSLS_MACROINCREMENTED_VALUE5244 5245
+#define BSLS_MACROINCREMENTED_VALUE5245 5246
+#define BSLS_MACROINCREMENTED_VALUE5246 5247
+#define BSLS_MACROINCREMENTED_VALUE5247 5248
+#define BSLS_MACROINCREMENTED_VALUE5248 5249
+#define BSLS_MACROINCREMENTED_VALUE5249 5250
+#define BSLS_MACROINCREMENTED_VALUE5250 5251
+#define BSLS_MACROINCREMENTED_VALUE5251 5252
+#define BSLS_MACROINCREMENTED_VALUE5252 5253
+#define BSLS_MACROINCREMENTED_VALUE5253 5254
+#define BSLS_MACROINCREMENTED_VALUE5254 5255
+#define BSLS_MACROINCREMENTED_VALUE5255 5256
+#define BSLS_MACROINCREMENTED_VALUE5256 5257
+#define BSLS_MACROINCREMENTED_VALUE5257 5258
+#define BSLS_MACROINCREMENTED_VALUE5258 5259
+#define BSLS_MACROINCREMENTED_VALUE5259 5260
+#define BSLS_MACROINCREMENTED_VALUE5260 5261
+#define BSLS_MACROINCREMENTED_VALUE5261 5262
+#define BSLS_MACROINCREMENTED_VALUE5262 5263
+#define BSLS_MACROINCREMENTED_VALUE5263 5264
+#define BSLS_MACROINCREMENTED_VALUE5264 5265
+#define BSLS_MACROINCREMENTED_VALUE5265 5266
+#define BSLS_MACROINCREMENTED_VALUE5266 5267
+#define BSLS_MACROINCREMENTED_VALUE5267 5268
+#define BSLS_MACROINCREMENTED_VALUE5268 5269
+#define BSLS_MACROINCREMENTED_VALUE5269 5270
+#define BSLS_MACROINCREMENTED_VALUE5270 5271
+#define BSLS_MACROINCREMENTED_VALUE5271 5272
+#define BSLS_MACROINCREMENTED_VALUE5272 5273
+#define BSLS_MACROINCREMENTED_VALUE5273 5274
+#define BSLS_MACROINCREMENTED_VALUE5274 5275
+#define BSLS_MACROINCREMENTED_VALUE5275 5276
+#define BSLS_MACROINCREMENTED_VALUE5276 5277
+#define BSLS_MACROINCREMENTED_VALUE5277 5278
+#define BSLS_MACROINCREMENTED_VALUE5278 5279
+#define BSLS_MACROINCREMENTED_VALUE5279 5280
+#define BSLS_MACROINCREMENTED_VALUE5280 5281
+#define BSLS_MACROINCREMENTED_VALUE5281 5282
+#define BSLS_MACROINCREMENTED_VALUE5282 5283
+#define BSLS_MACROINCREMENTED_VALUE5283 5284
+#define BSLS_MACROINCREMENTED_VALUE5284 5285
+#define BSLS_MACROINCREMENTED_VALUE5285 5286
+#define BSLS_MACROINCREMENTED_VALUE5286 5287
+#define BSLS_MACROINCREMENTED_VALUE5287 5288
+#define BSLS_MACROINCREMENTED_VALUE5288 5289
+#define BSLS_MACROINCREMENTED_VALUE5289 5290
+#define BSLS_MACROINCREMENTED_VALUE5290 5291
+#define BSLS_MACROINCREMENTED_VALUE5291 5292
+#define BSLS_MACROINCREMENTED_VALUE5292 5293
+#define BSLS_MACROINCREMENTED_VALUE5293 5294
+#define BSLS_MACROINCREMENTED_VALUE5294 5295
+#define BSLS_MACROINCREMENTED_VALUE5295 5296
+#define BSLS_MACROINCREMENTED_VALUE5296 5297
+#define BSLS_MACROINCREMENTED_VALUE5297 5298
+#define BSLS_MACROINCREMENTED_VALUE5298 5299
+#define BSLS_MACROINCREMENTED_VALUE5299 5300
+#define BSLS_MACROINCREMENTED_VALUE5300 5301
+#define BSLS_MACROINCREMENTED_VALUE5301 5302
+#define BSLS_MACROINCREMENTED_VALUE5302 5303
+#define BSLS_MACROINCREMENTED_VALUE5303 5304
+#define BSLS_MACROINCREMENTED_VALUE5304 5305
+#define BSLS_MACROINCREMENTED_VALUE5305 5306
+#define BSLS_MACROINCREMENTED_VALUE5306 5307
+#define BSLS_MACROINCREMENTED_VALUE5307 5308
+#define BSLS_MACROINCREMENTED_VALUE5308 5309
+#define BSLS_MACROINCREMENTED_VALUE5309 5310
+#define BSLS_MACROINCREMENTED_VALUE5310 5311
+#define BSLS_MACROINCREMENTED_VALUE5311 5312
+#define BSLS_MACROINCREMENTED_VALUE5312 5313
+#define BSLS_MACROINCREMENTED_VALUE5313 5314
+#define BSLS_MACROINCREMENTED_VALUE5314 5315
+#define BSLS_MACROINCREMENTED_VALUE5315 5316
+#define BSLS_MACROINCREMENTED_VALUE5316 5317
+#define BSLS_MACROINCREMENTED_VALUE5317 5318
+#define BSLS_MACROINCREMENTED_VALUE5318 5319
+#define BSLS_MACROINCREMENTED_VALUE5319 5320
+#define BSLS_MACROINCREMENTED_VALUE5320 5321
+#define BSLS_MACROINCREMENTED_VALUE5321 5322
+#define BSLS_MACROINCREMENTED_VALUE5322 5323
+#define BSLS_MACROINCREMENTED_VALUE5323 5324
+#define BSLS_MACROINCREMENTED_VALUE5324 5325
+#define BSLS_MACROINCREMENTED_VALUE5325 5326
+#define BSLS_MACROINCREMENTED_VALUE5326 5327
+#define BSLS_MACROINCREMENTED_VALUE5327 5328
+#define BSLS_MACROINCREMENTED_VALUE5328 5329
+#define BSLS_MACROINCREMENTED_VALUE5329 5330
+#define BSLS_MACROINCREMENTED_VALUE5330 5331
+#define BSLS_MACROINCREMENTED_VALUE5331 5332
+#define BSLS_MACROINCREMENTED_VALUE5332 5333
+#define BSLS_MACROINCREMENTED_VALUE5333 5334
+#define BSLS_MACROINCREMENTED_VALUE5334 5335
+#define BSLS_MACROINCREMENTED_VALUE5335 5336
+#define BSLS_MACROINCREMENTED_VALUE5336 5337
+#define BSLS_MACROINCREMENTED_VALUE5337 5338
+#define BSLS_MACROINCREMENTED_VALUE5338 5339
+#define BSLS_MACROINCREMENTED_VALUE5339 5340
+#define BSLS_MACROINCREMENTED_VALUE5340 5341
+#define BSLS_MACROINCREMENTED_VALUE5341 5342
+#define BSLS_MACROINCREMENTED_VALUE5342 5343
+#define BSLS_MACROINCREMENTED_VALUE5343 5344
+#define BSLS_MACROINCREMENTED_VALUE5344 5345
+#define BSLS_MACROINCREMENTED_VALUE5345 5346
+#define BSLS_MACROINCREMENTED_VALUE5346 5347
+#define BSLS_MACROINCREMENTED_VALUE5347 5348
+#define BSLS_MACROINCREMENTED_VALUE5348 5349
+#define BSLS_MACROINCREMENTED_VALUE5349 5350
+#define BSLS_MACROINCREMENTED_VALUE5350 5351
+#define BSLS_MACROINCREMENTED_VALUE5351 5352
+#define BSLS_MACROINCREMENTED_VALUE5352 5353
+#define BSLS_MACROINCREMENTED_VALUE5353 5354
+#define BSLS_MACROINCREMENTED_VALUE5354 5355
+#define BSLS_MACROINCREMENTED_VALUE5355 5356
+#define BSLS_MACROINCREMENTED_VALUE5356 5357
+#define BSLS_MACROINCREMENTED_VALUE5357 5358
+#define BSLS_MACROINCREMENTED_VALUE5358 5359
+#define BSLS_MACROINCREMENTED_VALUE5359 5360
+#define BSLS_MACROINCREMENTED_VALUE5360 5361
+#define BSLS_MACROINCREMENTED_VALUE5361 5362
+#define BSLS_MACROINCREMENTED_VALUE5362 5363
+#define BSLS_MACROINCREMENTED_VALUE5363 5364
+#define BSLS_MACROINCREMENTED_VALUE5364 5365
+#define BSLS_MACROINCREMENTED_VALUE5365 5366
+#define BSLS_MACROINCREMENTED_VALUE5366 5367
+#define BSLS_MACROINCREMENTED_VALUE5367 5368
+#define BSLS_MACROINCREMENTED_VALUE5368 5369
+#define BSLS_MACROINCREMENTED_VALUE5369 5370
+#define BSLS_MACROINCREMENTED_VALUE5370 5371
+#define BSLS_MACROINCREMENTED_VALUE5371 5372
+#define BSLS_MACROINCREMENTED_VALUE5372 5373
+#define BSLS_MACROINCREMENTED_VALUE5373 5374
+#define BSLS_MACROINCREMENTED_VALUE5374 5375
+#define BSLS_MACROINCREMENTED_VALUE5375 5376
+#define BSLS_MACROINCREMENTED_VALUE5376 5377
+#define BSLS_MACROINCREMENTED_VALUE5377 5378
+#define BSLS_MACROINCREMENTED_VALUE5378 5379
+#define BSLS_MACROINCREMENTED_VALUE5379 5380
+#define BSLS_MACROINCREMENTED_VALUE5380 5381
+#define BSLS_MACROINCREMENTED_VALUE5381 5382
+#define BSLS_MACROINCREMENTED_VALUE5382 5383
+#define BSLS_MACROINCREMENTED_VALUE5383 5384
+#define BSLS_MACROINCREMENTED_VALUE5384 5385
+#define BSLS_MACROINCREMENTED_VALUE5385 5386
+#define BSLS_MACROINCREMENTED_VALUE5386 5387
+#define BSLS_MACROINCREMENTED_VALUE5387 5388
+#define BSLS_MACROINCREMENTED_VALUE5388 5389
+#define BSLS_MACROINCREMENTED_VALUE5389 5390
+#define BSLS_MACROINCREMENTED_VALUE5390 5391
+#define BSLS_MACROINCREMENTED_VALUE5391 5392
+#define BSLS_MACROINCREMENTED_VALUE5392 5393
+#define BSLS_MACROINCREMENTED_VALUE5393 5394
+#define BSLS_MACROINCREMENTED_VALUE5394 5395
+#define BSLS_MACROINCREMENTED_VALUE5395 5396
+#define BSLS_MACROINCREMENTED_VALUE5396 5397
+#define BSLS_MACROINCREMENTED_VALUE5397 5398
+#define BSLS_MACROINCREMENTED_VALUE5398 5399
+#define BSLS_MACROINCREMENTED_VALUE5399 5400
+#define BSLS_MACROINCREMENTED_VALUE5400 5401
+#define BSLS_MACROINCREMENTED_VALUE5401 5402
+#define BSLS_MACROINCREMENTED_VALUE5402 5403
+#define BSLS_MACROINCREMENTED_VALUE5403 5404
+#define BSLS_MACROINCREMENTED_VALUE5404 5405
+#define BSLS_MACROINCREMENTED_VALUE5405 5406
+#define BSLS_MACROINCREMENTED_VALUE5406 5407
+#define BSLS_MACROINCREMENTED_VALUE5407 5408
+#define BSLS_MACROINCREMENTED_VALUE5408 5409
+#define BSLS_MACROINCREMENTED_VALUE5409 5410
+#define BSLS_MACROINCREMENTED_VALUE5410 5411
+#define BSLS_MACROINCREMENTED_VALUE5411 5412
+#define BSLS_MACROINCREMENTED_VALUE5412 5413
+#define BSLS_MACROINCREMENTED_VALUE5413 5414
+#define BSLS_MACROINCREMENTED_VALUE5414 5415
+#define BSLS_MACROINCREMENTED_VALUE5415 5416
+#define BSLS_MACROINCREMENTED_VALUE5416 5417
+#define BSLS_MACROINCREMENTED_VALUE5417 5418
+#define BSLS_MACROINCREMENTED_VALUE5418 5419
+#define BSLS_MACROINCREMENTED_VALUE5419 5420
+#define BSLS_MACROINCREMENTED_VALUE5420 5421
+#define BSLS_MACROINCREMENTED_VALUE5421 5422
+#define BSLS_MACROINCREMENTED_VALUE5422 5423
+#define BSLS_MACROINCREMENTED_VALUE5423 5424
+#define BSLS_MACROINCREMENTED_VALUE5424 5425
+#define BSLS_MACROINCREMENTED_VALUE5425 5426
+#define BSLS_MACROINCREMENTED_VALUE5426 5427
+#define BSLS_MACROINCREMENTED_VALUE5427 5428
+#define BSLS_MACROINCREMENTED_VALUE5428 5429
+#define BSLS_MACROINCREMENTED_VALUE5429 5430
+#define BSLS_MACROINCREMENTED_VALUE5430 5431
+#define BSLS_MACROINCREMENTED_VALUE5431 5432
+#define BSLS_MACROINCREMENTED_VALUE5432 5433
+#define BSLS_MACROINCREMENTED_VALUE5433 5434
+#define BSLS_MACROINCREMENTED_VALUE5434 5435
+#define BSLS_MACROINCREMENTED_VALUE5435 5436
+#define BSLS_MACROINCREMENTED_VALUE5436 5437
+#define BSLS_MACROINCREMENTED_VALUE5437 5438
+#define BSLS_MACROINCREMENTED_VALUE5438 5439
+#define BSLS_MACROINCREMENTED_VALUE5439 5440
+#define BSLS_MACROINCREMENTED_VALUE5440 5441
+#define BSLS_MACROINCREMENTED_VALUE5441 5442
+#define BSLS_MACROINCREMENTED_VALUE5442 5443
+#define BSLS_MACROINCREMENTED_VALUE5443 5444
+#define BSLS_MACROINCREMENTED_VALUE5444 5445
+#define BSLS_MACROINCREMENTED_VALUE5445 5446
+#define BSLS_MACROINCREMENTED_VALUE5446 5447
+#define BSLS_MACROINCREMENTED_VALUE5447 5448
+#define BSLS_MACROINCREMENTED_VALUE5448 5449
+#define BSLS_MACROINCREMENTED_VALUE5449 5450
+#define BSLS_MACROINCREMENTED_VALUE5450 5451
+#define BSLS_MACROINCREMENTED_VALUE5451 5452
+#define BSLS_MACROINCREMENTED_VALUE5452 5453
+#define BSLS_MACROINCREMENTED_VALUE5453 5454
+#define BSLS_MACROINCREMENTED_VALUE5454 5455
+#define BSLS_MACROINCREMENTED_VALUE5455 5456
+#define BSLS_MACROINCREMENTED_VALUE5456 5457
+#define BSLS_MACROINCREMENTED_VALUE5457 5458
+#define BSLS_MACROINCREMENTED_VALUE5458 5459
+#define BSLS_MACROINCREMENTED_VALUE5459 5460
+#define BSLS_MACROINCREMENTED_VALUE5460 5461
+#define BSLS_MACROINCREMENTED_VALUE5461 5462
+#define BSLS_MACROINCREMENTED_VALUE5462 5463
+#define BSLS_MACROINCREMENTED_VALUE5463 5464
+#define BSLS_MACROINCREMENTED_VALUE5464 5465
+#define BSLS_MACROINCREMENTED_VALUE5465 5466
+#define BSLS_MACROINCREMENTED_VALUE5466 5467
+#define BSLS_MACROINCREMENTED_VALUE5467 5468
+#define BSLS_MACROINCREMENTED_VALUE5468 5469
+#define BSLS_MACROINCREMENTED_VALUE5469 5470
+#define BSLS_MACROINCREMENTED_VALUE5470 5471
+#define BSLS_MACROINCREMENTED_VALUE5471 5472
+#define BSLS_MACROINCREMENTED_VALUE5472 5473
+#define BSLS_MACROINCREMENTED_VALUE5473 5474
+#define BSLS_MACROINCREMENTED_VALUE5474 5475
+#define BSLS_MACROINCREMENTED_VALUE5475 5476
+#define BSLS_MACROINCREMENTED_VALUE5476 5477
+#define BSLS_MACROINCREMENTED_VALUE5477 5478
+#define BSLS_MACROINCREMENTED_VALUE5478 5479
+#define BSLS_MACROINCREMENTED_VALUE5479 5480
+#define BSLS_MACROINCREMENTED_VALUE5480 5481
+#define BSLS_MACROINCREMENTED_VALUE5481 5482
+#define BSLS_MACROINCREMENTED_VALUE5482 5483
+#define BSLS_MACROINCREMENTED_VALUE5483 5484
+#define BSLS_MACROINCREMENTED_VALUE5484 5485
+#define BSLS_MACROINCREMENTED_VALUE5485 5486
+#define BSLS_MACROINCREMENTED_VALUE5486 5487
+#define BSLS_MACROINCREMENTED_VALUE5487 5488
+#define BSLS_MACROINCREMENTED_VALUE5488 5489
+#define BSLS_MACROINCREMENTED_VALUE5489 5490
+#define BSLS_MACROINCREMENTED_VALUE5490 5491
+#define BSLS_MACROINCREMENTED_VALUE5491 5492
+#define BSLS_MACROINCREMENTED_VALUE5492 5493
+#define BSLS_MACROINCREMENTED_VALUE5493 5494
+#define BSLS_MACROINCREMENTED_VALUE5494 5495
+#define BSLS_MACROINCREMENTED_VALUE5495 5496
+#define BSLS_MACROINCREMENTED_VALUE5496 5497
+#define BSLS_MACROINCREMENTED_VALUE5497 5498
+#define BSLS_MACROINCREMENTED_VALUE5498 5499
+#define BSLS_MACROINCREMENTED_VALUE5499 5500
+#define BSLS_MACROINCREMENTED_VALUE5500 5501
+#define BSLS_MACROINCREMENTED_VALUE5501 5502
+#define BSLS_MACROINCREMENTED_VALUE5502 5503
+#define BSLS_MACROINCREMENTED_VALUE5503 5504
+#define BSLS_MACROINCREMENTED_VALUE5504 5505
+#define BSLS_MACROINCREMENTED_VALUE5505 5506
+#define BSLS_MACROINCREMENTED_VALUE5506 5507
+#define BSLS_MACROINCREMENTED_VALUE5507 5508
+#define BSLS_MACROINCREMENTED_VALUE5508 5509
+#define BSLS_MACROINCREMENTED_VALUE5509 5510
+#define BSLS_MACROINCREMENTED_VALUE5510 5511
+#define BSLS_MACROINCREMENTED_VALUE5511 5512
+#define BSLS_MACROINCREMENTED_VALUE5512 5513
+#define BSLS_MACROINCREMENTED_VALUE5513 5514
+#define BSLS_MACROINCREMENTED_VALUE5514 5515
+#define BSLS_MACROINCREMENTED_VALUE5515 5516
+#define BSLS_MACROINCREMENTED_VALUE5516 5517
+#define BSLS_MACROINCREMENTED_VALUE5517 5518
+#define BSLS_MACROINCREMENTED_VALUE5518 5519
+#define BSLS_MACROINCREMENTED_VALUE5519 5520
+#define BSLS_MACROINCREMENTED_VALUE5520 5521
+#define BSLS_MACROINCREMENTED_VALUE5521 5522
+#define BSLS_MACROINCREMENTED_VALUE5522 5523
+#define BSLS_MACROINCREMENTED_VALUE5523 5524
+#define BSLS_MACROINCREMENTED_VALUE5524 5525
+#define BSLS_MACROINCREMENTED_VALUE5525 5526
+#define BSLS_MACROINCREMENTED_VALUE5526 5527
+#define BSLS_MACROINCREMENTED_VALUE5527 5528
+#define BSLS_MACROINCREMENTED_VALUE5528 5529
+#define BSLS_MACROINCREMENTED_VALUE5529 5530
+#define BSLS_MACROINCREMENTED_VALUE5530 5531
+#define BSLS_MACROINCREMENTED_VALUE5531 5532
+#define BSLS_MACROINCREMENTED_VALUE5532 5533
+#define BSLS_MACROINCREMENTED_VALUE5533 5534
+#define BSLS_MACROINCREMENTED_VALUE5534 5535
+#define BSLS_MACROINCREMENTED_VALUE5535 5536
+#define BSLS_MACROINCREMENTED_VALUE5536 5537
+#define BSLS_MACROINCREMENTED_VALUE5537 5538
+#define BSLS_MACROINCREMENTED_VALUE5538 5539
+#define BSLS_MACROINCREMENTED_VALUE5539 5540
+#define BSLS_MACROINCREMENTED_VALUE5540 5541
+#define BSLS_MACROINCREMENTED_VALUE5541 5542
+#define BSLS_MACROINCREMENTED_VALUE5542 5543
+#define BSLS_MACROINCREMENTED_VALUE5543 5544
+#define BSLS_MACROINCREMENTED_VALUE5544 5545
+#define BSLS_MACROINCREMENTED_VALUE5545 5546
+#define BSLS_MACROINCREMENTED_VALUE5546 5547
+#define BSLS_MACROINCREMENTED_VALUE5547 5548
+#define BSLS_MACROINCREMENTED_VALUE5548 5549
+#define BSLS_MACROINCREMENTED_VALUE5549 5550
+#define BSLS_MACROINCREMENTED_VALUE5550 5551
+#define BSLS_MACROINCREMENTED_VALUE5551 5552
+#define BSLS_MACROINCREMENTED_VALUE5552 5553
+#define BSLS_MACROINCREMENTED_VALUE5553 5554
+#define BSLS_MACROINCREMENTED_VALUE5554 5555
+#define BSLS_MACROINCREMENTED_VALUE5555 5556
+#define BSLS_MACROINCREMENTED_VALUE5556 5557
+#define BSLS_MACROINCREMENTED_VALUE5557 5558
+#define BSLS_MACROINCREMENTED_VALUE5558 5559
+#define BSLS_MACROINCREMENTED_VALUE5559 5560
+#define BSLS_MACROINCREMENTED_VALUE5560 5561
+#define BSLS_MACROINCREMENTED_VALUE5561 5562
+#define BSLS_MACROINCREMENTED_VALUE5562 5563
+#define BSLS_MACROINCREMENTED_VALUE5563 5564
+#define BSLS_MACROINCREMENTED_VALUE5564 5565
+#define BSLS_MACROINCREMENTED_VALUE5565 5566
+#define BSLS_MACROINCREMENTED_VALUE5566 5567
+#define BSLS_MACROINCREMENTED_VALUE5567 5568
+#define BSLS_MACROINCREMENTED_VALUE5568 5569
+#define BSLS_MACROINCREMENTED_VALUE5569 5570
+#define BSLS_MACROINCREMENTED_VALUE5570 5571
+#define BSLS_MACROINCREMENTED_VALUE5571 5572
+#define BSLS_MACROINCREMENTED_VALUE5572 5573
+#define BSLS_MACROINCREMENTED_VALUE5573 5574
+#define BSLS_MACROINCREMENTED_VALUE5574 5575
+#define BSLS_MACROINCREMENTED_VALUE5575 5576
+#define BSLS_MACROINCREMENTED_VALUE5576 5577
+#define BSLS_MACROINCREMENTED_VALUE5577 5578
+#define BSLS_MACROINCREMENTED_VALUE5578 5579
+#define BSLS_MACROINCREMENTED_VALUE5579 5580
+#define BSLS_MACROINCREMENTED_VALUE5580 5581
+#define BSLS_MACROINCREMENTED_VALUE5581 5582
+#define BSLS_MACROINCREMENTED_VALUE5582 5583
+#define BSLS_MACROINCREMENTED_VALUE5583 5584
+#define BSLS_MACROINCREMENTED_VALUE5584 5585
+#define BSLS_MACROINCREMENTED_VALUE5585 5586
+#define BSLS_MACROINCREMENTED_VALUE5586 5587
+#define BSLS_MACROINCREMENTED_VALUE5587 5588
+#define BSLS_MACROINCREMENTED_VALUE5588 5589
+#define BSLS_MACROINCREMENTED_VALUE5589 5590
+#define BSLS_MACROINCREMENTED_VALUE5590 5591
+#define BSLS_MACROINCREMENTED_VALUE5591 5592
+#define BSLS_MACROINCREMENTED_VALUE5592 5593
+#define BSLS_MACROINCREMENTED_VALUE5593 5594
+#define BSLS_MACROINCREMENTED_VALUE5594 5595
+#define BSLS_MACROINCREMENTED_VALUE5595 5596
+#define BSLS_MACROINCREMENTED_VALUE5596 5597
+#define BSLS_MACROINCREMENTED_VALUE5597 5598
+#define BSLS_MACROINCREMENTED_VALUE5598 5599
+#define BSLS_MACROINCREMENTED_VALUE5599 5600
+#define BSLS_MACROINCREMENTED_VALUE5600 5601
+#define BSLS_MACROINCREMENTED_VALUE5601 5602
+#define BSLS_MACROINCREMENTED_VALUE5602 5603
+#define BSLS_MACROINCREMENTED_VALUE5603 5604
+#define BSLS_MACROINCREMENTED_VALUE5604 5605
+#define BSLS_MACROINCREMENTED_VALUE5605 5606
+#define BSLS_MACROINCREMENTED_VALUE5606 5607
+#define BSLS_MACROINCREMENTED_VALUE5607 5608
+#define BSLS_MACROINCREMENTED_VALUE5608 5609
+#define BSLS_MACROINCREMENTED_VALUE5609 5610
+#define BSLS_MACROINCREMENTED_VALUE5610 5611
+#define BSLS_MACROINCREMENTED_VALUE5611 5612
+#define BSLS_MACROINCREMENTED_VALUE5612 5613
+#define BSLS_MACROINCREMENTED_VALUE5613 5614
+#define BSLS_MACROINCREMENTED_VALUE5614 5615
+#define BSLS_MACROINCREMENTED_VALUE5615 5616
+#define BSLS_MACROINCREMENTED_VALUE5616 5617
+#define BSLS_MACROINCREMENTED_VALUE5617 5618
+#define BSLS_MACROINCREMENTED_VALUE5618 5619
+#define BSLS_MACROINCREMENTED_VALUE5619 5620
+#define BSLS_MACROINCREMENTED_VALUE5620 5621
+#define BSLS_MACROINCREMENTED_VALUE5621 5622
+#define BSLS_MACROINCREMENTED_VALUE5622 5623
+#define BSLS_MACROINCREMENTED_VALUE5623 5624
+#define BSLS_MACROINCREMENTED_VALUE5624 5625
+#define BSLS_MACROINCREMENTED_VALUE5625 5626
+#define BSLS_MACROINCREMENTED_VALUE5626 5627
+#define BSLS_MACROINCREMENTED_VALUE5627 5628
+#define BSLS_MACROINCREMENTED_VALUE5628 5629
+#define BSLS_MACROINCREMENTED_VALUE5629 5630
+#define BSLS_MACROINCREMENTED_VALUE5630 5631
+#define BSLS_MACROINCREMENTED_VALUE5631 5632
+#define BSLS_MACROINCREMENTED_VALUE5632 5633
+#define BSLS_MACROINCREMENTED_VALUE5633 5634
+#define BSLS_MACROINCREMENTED_VALUE5634 5635
+#define BSLS_MACROINCREMENTED_VALUE5635 5636
+#define BSLS_MACROINCREMENTED_VALUE5636 5637
+#define BSLS_MACROINCREMENTED_VALUE5637 5638
+#define BSLS_MACROINCREMENTED_VALUE5638 5639
+#define BSLS_MACROINCREMENTED_VALUE5639 5640
+#define BSLS_MACROINCREMENTED_VALUE5640 5641
+#define BSLS_MACROINCREMENTED_VALUE5641 5642
+#define BSLS_MACROINCREMENTED_VALUE5642 5643
+#define BSLS_MACROINCREMENTED_VALUE5643 5644
+#define BSLS_MACROINCREMENTED_VALUE5644 5645
+#define BSLS_MACROINCREMENTED_VALUE5645 5646
+#define BSLS_MACROINCREMENTED_VALUE5646 5647
+#define BSLS_MACROINCREMENTED_VALUE5647 5648
+#define BSLS_MACROINCREMENTED_VALUE5648 5649
+#define BSLS_MACROINCREMENTED_VALUE5649 5650
+#define BSLS_MACROINCREMENTED_VALUE5650 5651
+#define BSLS_MACROINCREMENTED_VALUE5651 5652
+#define BSLS_MACROINCREMENTED_VALUE5652 5653
+#define BSLS_MACROINCREMENTED_VALUE5653 5654
+#define BSLS_MACROINCREMENTED_VALUE5654 5655
+#define BSLS_MACROINCREMENTED_VALUE5655 5656
+#define BSLS_MACROINCREMENTED_VALUE5656 5657
+#define BSLS_MACROINCREMENTED_VALUE5657 5658
+#define BSLS_MACROINCREMENTED_VALUE5658 5659
+#define BSLS_MACROINCREMENTED_VALUE5659 5660
+#define BSLS_MACROINCREMENTED_VALUE5660 5661
+#define BSLS_MACROINCREMENTED_VALUE5661 5662
+#define BSLS_MACROINCREMENTED_VALUE5662 5663
+#define BSLS_MACROINCREMENTED_VALUE5663 5664
+#define BSLS_MACROINCREMENTED_VALUE5664 5665
+#define BSLS_MACROINCREMENTED_VALUE5665 5666
+#define BSLS_MACROINCREMENTED_VALUE5666 5667
+#define BSLS_MACROINCREMENTED_VALUE5667 5668
+#define BSLS_MACROINCREMENTED_VALUE5668 5669
+#define BSLS_MACROINCREMENTED_VALUE5669 5670
+#define BSLS_MACROINCREMENTED_VALUE5670 5671
+#define BSLS_MACROINCREMENTED_VALUE5671 5672
+#define BSLS_MACROINCREMENTED_VALUE5672 5673
+#define BSLS_MACROINCREMENTED_VALUE5673 5674
+#define BSLS_MACROINCREMENTED_VALUE5674 5675
+#define BSLS_MACROINCREMENTED_VALUE5675 5676
+#define BSLS_MACROINCREMENTED_VALUE5676 5677
+#define BSLS_MACROINCREMENTED_VALUE5677 5678
+#define BSLS_MACROINCREMENTED_VALUE5678 5679
+#define BSLS_MACROINCREMENTED_VALUE5679 5680
+#define BSLS_MACROINCREMENTED_VALUE5680 5681
+#define BSLS_MACROINCREMENTED_VALUE5681 5682
+#define BSLS_MACROINCREMENTED_VALUE5682 5683
+#define BSLS_MACROINCREMENTED_VALUE5683 5684
+#define BSLS_MACROINCREMENTED_VALUE5684 5685
+#define BSLS_MACROINCREMENTED_VALUE5685 5686
+#define BSLS_MACROINCREMENTED_VALUE5686 5687
+#define BSLS_MACROINCREMENTED_VALUE5687 5688
+#define BSLS_MACROINCREMENTED_VALUE5688 5689
+#define BSLS_MACROINCREMENTED_VALUE5689 5690
+#define BSLS_MACROINCREMENTED_VALUE5690 5691
+#define BSLS_MACROINCREMENTED_VALUE5691 5692
+#define BSLS_MACROINCREMENTED_VALUE5692 5693
+#define BSLS_MACROINCREMENTED_VALUE5693 5694
+#define BSLS_MACROINCREMENTED_VALUE5694 5695
+#define BSLS_MACROINCREMENTED_VALUE5695 5696
+#define BSLS_MACROINCREMENTED_VALUE5696 5697
+#define BSLS_MACROINCREMENTED_VALUE5697 5698
+#define BSLS_MACROINCREMENTED_VALUE5698 5699
+#define BSLS_MACROINCREMENTED_VALUE5699 5700
+#define BSLS_MACROINCREMENTED_VALUE5700 5701
+#define BSLS_MACROINCREMENTED_VALUE5701 5702
+#define BSLS_MACROINCREMENTED_VALUE5702 5703
+#define BSLS_MACROINCREMENTED_VALUE5703 5704
+#define BSLS_MACROINCREMENTED_VALUE5704 5705
+#define BSLS_MACROINCREMENTED_VALUE5705 5706
+#define BSLS_MACROINCREMENTED_VALUE5706 5707
+#define BSLS_MACROINCREMENTED_VALUE5707 5708
+#define BSLS_MACROINCREMENTED_VALUE5708 5709
+#define BSLS_MACROINCREMENTED_VALUE5709 5710
+#define BSLS_MACROINCREMENTED_VALUE5710 5711
+#define BSLS_MACROINCREMENTED_VALUE5711 5712
+#define BSLS_MACROINCREMENTED_VALUE5712 5713
+#define BSLS_MACROINCREMENTED_VALUE5713 5714
+#define BSLS_MACROINCREMENTED_VALUE5714 5715
+#define BSLS_MACROINCREMENTED_VALUE5715 5716
+#define BSLS_MACROINCREMENTED_VALUE5716 5717
+#define BSLS_MACROINCREMENTED_VALUE5717 5718
+#define BSLS_MACROINCREMENTED_VALUE5718 5719
+#define BSLS_MACROINCREMENTED_VALUE5719 5720
+#define BSLS_MACROINCREMENTED_VALUE5720 5721
+#define BSLS_MACROINCREMENTED_VALUE5721 5722
+#define BSLS_MACROINCREMENTED_VALUE5722 5723
+#define BSLS_MACROINCREMENTED_VALUE5723 5724
+#define BSLS_MACROINCREMENTED_VALUE5724 5725
+#define BSLS_MACROINCREMENTED_VALUE5725 5726
+#define BSLS_MACROINCREMENTED_VALUE5726 5727
+#define BSLS_MACROINCREMENTED_VALUE5727 5728
+#define BSLS_MACROINCREMENTED_VALUE5728 5729
+#define BSLS_MACROINCREMENTED_VALUE5729 5730
+#define BSLS_MACROINCREMENTED_VALUE5730 5731
+#define BSLS_MACROINCREMENTED_VALUE5731 5732
+#define BSLS_MACROINCREMENTED_VALUE5732 5733
+#define BSLS_MACROINCREMENTED_VALUE5733 5734
+#define BSLS_MACROINCREMENTED_VALUE5734 5735
+#define BSLS_MACROINCREMENTED_VALUE5735 5736
+#define BSLS_MACROINCREMENTED_VALUE5736 5737
+#define BSLS_MACROINCREMENTED_VALUE5737 5738
+#define BSLS_MACROINCREMENTED_VALUE5738 5739
+#define BSLS_MACROINCREMENTED_VALUE5739 5740
+#define BSLS_MACROINCREMENTED_VALUE5740 5741
+#define BSLS_MACROINCREMENTED_VALUE5741 5742
+#define BSLS_MACROINCREMENTED_VALUE5742 5743
+#define BSLS_MACROINCREMENTED_VALUE5743 5744
+#define BSLS_MACROINCREMENTED_VALUE5744 5745
+#define BSLS_MACROINCREMENTED_VALUE5745 5746
+#define BSLS_MACROINCREMENTED_VALUE5746 5747
+#define BSLS_MACROINCREMENTED_VALUE5747 5748
+#define BSLS_MACROINCREMENTED_VALUE5748 5749
+#define BSLS_MACROINCREMENTED_VALUE5749 5750
+#define BSLS_MACROINCREMENTED_VALUE5750 5751
+#define BSLS_MACROINCREMENTED_VALUE5751 5752
+#define BSLS_MACROINCREMENTED_VALUE5752 5753
+#define BSLS_MACROINCREMENTED_VALUE5753 5754
+#define BSLS_MACROINCREMENTED_VALUE5754 5755
+#define BSLS_MACROINCREMENTED_VALUE5755 5756
+#define BSLS_MACROINCREMENTED_VALUE5756 5757
+#define BSLS_MACROINCREMENTED_VALUE5757 5758
+#define BSLS_MACROINCREMENTED_VALUE5758 5759
+#define BSLS_MACROINCREMENTED_VALUE5759 5760
+#define BSLS_MACROINCREMENTED_VALUE5760 5761
+#define BSLS_MACROINCREMENTED_VALUE5761 5762
+#define BSLS_MACROINCREMENTED_VALUE5762 5763
+#define BSLS_MACROINCREMENTED_VALUE5763 5764
+#define BSLS_MACROINCREMENTED_VALUE5764 5765
+#define BSLS_MACROINCREMENTED_VALUE5765 5766
+#define BSLS_MACROINCREMENTED_VALUE5766 5767
+#define BSLS_MACROINCREMENTED_VALUE5767 5768
+#define BSLS_MACROINCREMENTED_VALUE5768 5769
+#define BSLS_MACROINCREMENTED_VALUE5769 5770
+#define BSLS_MACROINCREMENTED_VALUE5770 5771
+#define BSLS_MACROINCREMENTED_VALUE5771 5772
+#define BSLS_MACROINCREMENTED_VALUE5772 5773
+#define BSLS_MACROINCREMENTED_VALUE5773 5774
+#define BSLS_MACROINCREMENTED_VALUE5774 5775
+#define BSLS_MACROINCREMENTED_VALUE5775 5776
+#define BSLS_MACROINCREMENTED_VALUE5776 5777
+#define BSLS_MACROINCREMENTED_VALUE5777 5778
+#define BSLS_MACROINCREMENTED_VALUE5778 5779
+#define BSLS_MACROINCREMENTED_VALUE5779 5780
+#define BSLS_MACROINCREMENTED_VALUE5780 5781
+#define BSLS_MACROINCREMENTED_VALUE5781 5782
+#define BSLS_MACROINCREMENTED_VALUE5782 5783
+#define BSLS_MACROINCREMENTED_VALUE5783 5784
+#define BSLS_MACROINCREMENTED_VALUE5784 5785
+#define BSLS_MACROINCREMENTED_VALUE5785 5786
+#define BSLS_MACROINCREMENTED_VALUE5786 5787
+#define BSLS_MACROINCREMENTED_VALUE5787 5788
+#define BSLS_MACROINCREMENTED_VALUE5788 5789
+#define BSLS_MACROINCREMENTED_VALUE5789 5790
+#define BSLS_MACROINCREMENTED_VALUE5790 5791
+#define BSLS_MACROINCREMENTED_VALUE5791 5792
+#define BSLS_MACROINCREMENTED_VALUE5792 5793
+#define BSLS_MACROINCREMENTED_VALUE5793 5794
+#define BSLS_MACROINCREMENTED_VALUE5794 5795
+#define BSLS_MACROINCREMENTED_VALUE5795 5796
+#define BSLS_MACROINCREMENTED_VALUE5796 5797
+#define BSLS_MACROINCREMENTED_VALUE5797 5798
+#define BSLS_MACROINCREMENTED_VALUE5798 5799
+#define BSLS_MACROINCREMENTED_VALUE5799 5800
+#define BSLS_MACROINCREMENTED_VALUE5800 5801
+#define BSLS_MACROINCREMENTED_VALUE5801 5802
+#define BSLS_MACROINCREMENTED_VALUE5802 5803
+#define BSLS_MACROINCREMENTED_VALUE5803 5804
+#define BSLS_MACROINCREMENTED_VALUE5804 5805
+#define BSLS_MACROINCREMENTED_VALUE5805 5806
+#define BSLS_MACROINCREMENTED_VALUE5806 5807
+#define BSLS_MACROINCREMENTED_VALUE5807 5808
+#define BSLS_MACROINCREMENTED_VALUE5808 5809
+#define BSLS_MACROINCREMENTED_VALUE5809 5810
+#define BSLS_MACROINCREMENTED_VALUE5810 5811
+#define BSLS_MACROINCREMENTED_VALUE5811 5812
+#define BSLS_MACROINCREMENTED_VALUE5812 5813
+#define BSLS_MACROINCREMENTED_VALUE5813 5814
+#define BSLS_MACROINCREMENTED_VALUE5814 5815
+#define BSLS_MACROINCREMENTED_VALUE5815 5816
+#define BSLS_MACROINCREMENTED_VALUE5816 5817
+#define BSLS_MACROINCREMENTED_VALUE5817 5818
+#define BSLS_MACROINCREMENTED_VALUE5818 5819
+#define BSLS_MACROINCREMENTED_VALUE5819 5820
+#define BSLS_MACROINCREMENTED_VALUE5820 5821
+#define BSLS_MACROINCREMENTED_VALUE5821 5822
+#define BSLS_MACROINCREMENTED_VALUE5822 5823
+#define BSLS_MACROINCREMENTED_VALUE5823 5824
+#define BSLS_MACROINCREMENTED_VALUE5824 5825
+#define BSLS_MACROINCREMENTED_VALUE5825 5826
+#define BSLS_MACROINCREMENTED_VALUE5826 5827
+#define BSLS_MACROINCREMENTED_VALUE5827 5828
+#define BSLS_MACROINCREMENTED_VALUE5828 5829
+#define BSLS_MACROINCREMENTED_VALUE5829 5830
+#define BSLS_MACROINCREMENTED_VALUE5830 5831
+#define BSLS_MACROINCREMENTED_VALUE5831 5832
+#define BSLS_MACROINCREMENTED_VALUE5832 5833
+#define BSLS_MACROINCREMENTED_VALUE5833 5834
+#define BSLS_MACROINCREMENTED_VALUE5834 5835
+#define BSLS_MACROINCREMENTED_VALUE5835 5836
+#define BSLS_MACROINCREMENTED_VALUE5836 5837
+#define BSLS_MACROINCREMENTED_VALUE5837 5838
+#define BSLS_MACROINCREMENTED_VALUE5838 5839
+#define BSLS_MACROINCREMENTED_VALUE5839 5840
+#define BSLS_MACROINCREMENTED_VALUE5840 5841
+#define BSLS_MACROINCREMENTED_VALUE5841 5842
+#define BSLS_MACROINCREMENTED_VALUE5842 5843
+#define BSLS_MACROINCREMENTED_VALUE5843 5844
+#define BSLS_MACROINCREMENTED_VALUE5844 5845
+#define BSLS_MACROINCREMENTED_VALUE5845 5846
+#define BSLS_MACROINCREMENTED_VALUE5846 5847
+#define BSLS_MACROINCREMENTED_VALUE5847 5848
+#define BSLS_MACROINCREMENTED_VALUE5848 5849
+#define BSLS_MACROINCREMENTED_VALUE5849 5850
+#define BSLS_MACROINCREMENTED_VALUE5850 5851
+#define BSLS_MACROINCREMENTED_VALUE5851 5852
+#define BSLS_MACROINCREMENTED_VALUE5852 5853
+#define BSLS_MACROINCREMENTED_VALUE5853 5854
+#define BSLS_MACROINCREMENTED_VALUE5854 5855
+#define BSLS_MACROINCREMENTED_VALUE5855 5856
+#define BSLS_MACROINCREMENTED_VALUE5856 5857
+#define BSLS_MACROINCREMENTED_VALUE5857 5858
+#define BSLS_MACROINCREMENTED_VALUE5858 5859
+#define BSLS_MACROINCREMENTED_VALUE5859 5860
+#define BSLS_MACROINCREMENTED_VALUE5860 5861
+#define BSLS_MACROINCREMENTED_VALUE5861 5862
+#define BSLS_MACROINCREMENTED_VALUE5862 5863
+#define BSLS_MACROINCREMENTED_VALUE5863 5864
+#define BSLS_MACROINCREMENTED_VALUE5864 5865
+#define BSLS_MACROINCREMENTED_VALUE5865 5866
+#define BSLS_MACROINCREMENTED_VALUE5866 5867
+#define BSLS_MACROINCREMENTED_VALUE5867 5868
+#define BSLS_MACROINCREMENTED_VALUE5868 5869
+#define BSLS_MACROINCREMENTED_VALUE5869 5870
+#define BSLS_MACROINCREMENTED_VALUE5870 5871
+#define BSLS_MACROINCREMENTED_VALUE5871 5872
+#define BSLS_MACROINCREMENTED_VALUE5872 5873
+#define BSLS_MACROINCREMENTED_VALUE5873 5874
+#define BSLS_MACROINCREMENTED_VALUE5874 5875
+#define BSLS_MACROINCREMENTED_VALUE5875 5876
+#define BSLS_MACROINCREMENTED_VALUE5876 5877
+#define BSLS_MACROINCREMENTED_VALUE5877 5878
+#define BSLS_MACROINCREMENTED_VALUE5878 5879
+#define BSLS_MACROINCREMENTED_VALUE5879 5880
+#define BSLS_MACROINCREMENTED_VALUE5880 5881
+#define BSLS_MACROINCREMENTED_VALUE5881 5882
+#define BSLS_MACROINCREMENTED_VALUE5882 5883
+#define BSLS_MACROINCREMENTED_VALUE5883 5884
+#define BSLS_MACROINCREMENTED_VALUE5884 5885
+#define BSLS_MACROINCREMENTED_VALUE5885 5886
+#define BSLS_MACROINCREMENTED_VALUE5886 5887
+#define BSLS_MACROINCREMENTED_VALUE5887 5888
+#define BSLS_MACROINCREMENTED_VALUE5888 5889
+#define BSLS_MACROINCREMENTED_VALUE5889 5890
+#define BSLS_MACROINCREMENTED_VALUE5890 5891
+#define BSLS_MACROINCREMENTED_VALUE5891 5892
+#define BSLS_MACROINCREMENTED_VALUE5892 5893
+#define BSLS_MACROINCREMENTED_VALUE5893 5894
+#define BSLS_MACROINCREMENTED_VALUE5894 5895
+#define BSLS_MACROINCREMENTED_VALUE5895 5896
+#define BSLS_MACROINCREMENTED_VALUE5896 5897
+#define BSLS_MACROINCREMENTED_VALUE5897 5898
+#define BSLS_MACROINCREMENTED_VALUE5898 5899
+#define BSLS_MACROINCREMENTED_VALUE5899 5900
+#define BSLS_MACROINCREMENTED_VALUE5900 5901
+#define BSLS_MACROINCREMENTED_VALUE5901 5902
+#define BSLS_MACROINCREMENTED_VALUE5902 5903
+#define BSLS_MACROINCREMENTED_VALUE5903 5904
+#define BSLS_MACROINCREMENTED_VALUE5904 5905
+#define BSLS_MACROINCREMENTED_VALUE5905 5906
+#define BSLS_MACROINCREMENTED_VALUE5906 5907
+#define BSLS_MACROINCREMENTED_VALUE5907 5908
+#define BSLS_MACROINCREMENTED_VALUE5908 5909
+#define BSLS_MACROINCREMENTED_VALUE5909 5910
+#define BSLS_MACROINCREMENTED_VALUE5910 5911
+#define BSLS_MACROINCREMENTED_VALUE5911 5912
+#define BSLS_MACROINCREMENTED_VALUE5912 5913
+#define BSLS_MACROINCREMENTED_VALUE5913 5914
+#define BSLS_MACROINCREMENTED_VALUE5914 5915
+#define BSLS_MACROINCREMENTED_VALUE5915 5916
+#define BSLS_MACROINCREMENTED_VALUE5916 5917
+#define BSLS_MACROINCREMENTED_VALUE5917 5918
+#define BSLS_MACROINCREMENTED_VALUE5918 5919
+#define BSLS_MACROINCREMENTED_VALUE5919 5920
+#define BSLS_MACROINCREMENTED_VALUE5920 5921
+#define BSLS_MACROINCREMENTED_VALUE5921 5922
+#define BSLS_MACROINCREMENTED_VALUE5922 5923
+#define BSLS_MACROINCREMENTED_VALUE5923 5924
+#define BSLS_MACROINCREMENTED_VALUE5924 5925
+#define BSLS_MACROINCREMENTED_VALUE5925 5926
+#define BSLS_MACROINCREMENTED_VALUE5926 5927
+#define BSLS_MACROINCREMENTED_VALUE5927 5928
+#define BSLS_MACROINCREMENTED_VALUE5928 5929
+#define BSLS_MACROINCREMENTED_VALUE5929 5930
+#define BSLS_MACROINCREMENTED_VALUE5930 5931
+#define BSLS_MACROINCREMENTED_VALUE5931 5932
+#define BSLS_MACROINCREMENTED_VALUE5932 5933
+#define BSLS_MACROINCREMENTED_VALUE5933 5934
+#define BSLS_MACROINCREMENTED_VALUE5934 5935
+#define BSLS_MACROINCREMENTED_VALUE5935 5936
+#define BSLS_MACROINCREMENTED_VALUE5936 5937
+#define BSLS_MACROINCREMENTED_VALUE5937 5938
+#define BSLS_MACROINCREMENTED_VALUE5938 5939
+#define BSLS_MACROINCREMENTED_VALUE5939 5940
+#define BSLS_MACROINCREMENTED_VALUE5940 5941
+#define BSLS_MACROINCREMENTED_VALUE5941 5942
+#define BSLS_MACROINCREMENTED_VALUE5942 5943
+#define BSLS_MACROINCREMENTED_VALUE5943 5944
+#define BSLS_MACROINCREMENTED_VALUE5944 5945
+#define BSLS_MACROINCREMENTED_VALUE5945 5946
+#define BSLS_MACROINCREMENTED_VALUE5946 5947
+#define BSLS_MACROINCREMENTED_VALUE5947 5948
+#define BSLS_MACROINCREMENTED_VALUE5948 5949
+#define BSLS_MACROINCREMENTED_VALUE5949 5950
+#define BSLS_MACROINCREMENTED_VALUE5950 5951
+#define BSLS_MACROINCREMENTED_VALUE5951 5952
+#define BSLS_MACROINCREMENTED_VALUE5952 5953
+#define BSLS_MACROINCREMENTED_VALUE5953 5954
+#define BSLS_MACROINCREMENTED_VALUE5954 5955
+#define BSLS_MACROINCREMENTED_VALUE5955 5956
+#define BSLS_MACROINCREMENTED_VALUE5956 5957
+#define BSLS_MACROINCREMENTED_VALUE5957 5958
+#define BSLS_MACROINCREMENTED_VALUE5958 5959
+#define BSLS_MACROINCREMENTED_VALUE5959 5960
+#define BSLS_MACROINCREMENTED_VALUE5960 5961
+#define BSLS_MACROINCREMENTED_VALUE5961 5962
+#define BSLS_MACROINCREMENTED_VALUE5962 5963
+#define BSLS_MACROINCREMENTED_VALUE5963 5964
+#define BSLS_MACROINCREMENTED_VALUE5964 5965
+#define BSLS_MACROINCREMENTED_VALUE5965 5966
+#define BSLS_MACROINCREMENTED_VALUE5966 5967
+#define BSLS_MACROINCREMENTED_VALUE5967 5968
+#define BSLS_MACROINCREMENTED_VALUE5968 5969
+#define BSLS_MACROINCREMENTED_VALUE5969 5970
+#define BSLS_MACROINCREMENTED_VALUE5970 5971
+#define BSLS_MACROINCREMENTED_VALUE5971 5972
+#define BSLS_MACROINCREMENTED_VALUE5972 5973
+#define BSLS_MACROINCREMENTED_VALUE5973 5974
+#define BSLS_MACROINCREMENTED_VALUE5974 5975
+#define BSLS_MACROINCREMENTED_VALUE5975 5976
+#define BSLS_MACROINCREMENTED_VALUE5976 5977
+#define BSLS_MACROINCREMENTED_VALUE5977 5978
+#define BSLS_MACROINCREMENTED_VALUE5978 5979
+#define BSLS_MACROINCREMENTED_VALUE5979 5980
+#define BSLS_MACROINCREMENTED_VALUE5980 5981
+#define BSLS_MACROINCREMENTED_VALUE5981 5982
+#define BSLS_MACROINCREMENTED_VALUE5982 5983
+#define BSLS_MACROINCREMENTED_VALUE5983 5984
+#define BSLS_MACROINCREMENTED_VALUE5984 5985
+#define BSLS_MACROINCREMENTED_VALUE5985 5986
+#define BSLS_MACROINCREMENTED_VALUE5986 5987
+#define BSLS_MACROINCREMENTED_VALUE5987 5988
+#define BSLS_MACROINCREMENTED_VALUE5988 5989
+#define BSLS_MACROINCREMENTED_VALUE5989 5990
+#define BSLS_MACROINCREMENTED_VALUE5990 5991
+#define BSLS_MACROINCREMENTED_VALUE5991 5992
+#define BSLS_MACROINCREMENTED_VALUE5992 5993
+#define BSLS_MACROINCREMENTED_VALUE5993 5994
+#define BSLS_MACROINCREMENTED_VALUE5994 5995
+#define BSLS_MACROINCREMENTED_VALUE5995 5996
+#define BSLS_MACROINCREMENTED_VALUE5996 5997
+#define BSLS_MACROINCREMENTED_VALUE5997 5998
+#define BSLS_MACROINCREMENTED_VALUE5998 5999
+#define BSLS_MACROINCREMENTED_VALUE5999 6000
+#define BSLS_MACROINCREMENTED_VALUE6000 6001
+#define BSLS_MACROINCREMENTED_VALUE6001 6002
+#define BSLS_MACROINCREMENTED_VALUE6002 6003
+#define BSLS_MACROINCREMENTED_VALUE6003 6004
+#define BSLS_MACROINCREMENTED_VALUE6004 6005
+#define BSLS_MACROINCREMENTED_VALUE6005 6006
+#define BSLS_MACROINCREMENTED_VALUE6006 6007
+#define BSLS_MACROINCREMENTED_VALUE6007 6008
+#define BSLS_MACROINCREMENTED_VALUE6008 6009
+#define BSLS_MACROINCREMENTED_VALUE6009 6010
+#define BSLS_MACROINCREMENTED_VALUE6010 6011
+#define BSLS_MACROINCREMENTED_VALUE6011 6012
+#define BSLS_MACROINCREMENTED_VALUE6012 6013
+#define BSLS_MACROINCREMENTED_VALUE6013 6014
+#define BSLS_MACROINCREMENTED_VALUE6014 6015
+#define BSLS_MACROINCREMENTED_VALUE6015 6016
+#define BSLS_MACROINCREMENTED_VALUE6016 6017
+#define BSLS_MACROINCREMENTED_VALUE6017 6018
+#define BSLS_MACROINCREMENTED_VALUE6018 6019
+#define BSLS_MACROINCREMENTED_VALUE6019 6020
+#define BSLS_MACROINCREMENTED_VALUE6020 6021
+#define BSLS_MACROINCREMENTED_VALUE6021 6022
+#define BSLS_MACROINCREMENTED_VALUE6022 6023
+#define BSLS_MACROINCREMENTED_VALUE6023 6024
+#define BSLS_MACROINCREMENTED_VALUE6024 6025
+#define BSLS_MACROINCREMENTED_VALUE6025 6026
+#define BSLS_MACROINCREMENTED_VALUE6026 6027
+#define BSLS_MACROINCREMENTED_VALUE6027 6028
+#define BSLS_MACROINCREMENTED_VALUE6028 6029
+#define BSLS_MACROINCREMENTED_VALUE6029 6030
+#define BSLS_MACROINCREMENTED_VALUE6030 6031
+#define BSLS_MACROINCREMENTED_VALUE6031 6032
+#define BSLS_MACROINCREMENTED_VALUE6032 6033
+#define BSLS_MACROINCREMENTED_VALUE6033 6034
+#define BSLS_MACROINCREMENTED_VALUE6034 6035
+#define BSLS_MACROINCREMENTED_VALUE6035 6036
+#define BSLS_MACROINCREMENTED_VALUE6036 6037
+#define BSLS_MACROINCREMENTED_VALUE6037 6038
+#define BSLS_MACROINCREMENTED_VALUE6038 6039
+#define BSLS_MACROINCREMENTED_VALUE6039 6040
+#define BSLS_MACROINCREMENTED_VALUE6040 6041
+#define BSLS_MACROINCREMENTED_VALUE6041 6042
+#define BSLS_MACROINCREMENTED_VALUE6042 6043
+#define BSLS_MACROINCREMENTED_VALUE6043 6044
+#define BSLS_MACROINCREMENTED_VALUE6044 6045
+#define BSLS_MACROINCREMENTED_VALUE6045 6046
+#define BSLS_MACROINCREMENTED_VALUE6046 6047
+#define BSLS_MACROINCREMENTED_VALUE6047 6048
+#define BSLS_MACROINCREMENTED_VALUE6048 6049
+#define BSLS_MACROINCREMENTED_VALUE6049 6050
+#define BSLS_MACROINCREMENTED_VALUE6050 6051
+#define BSLS_MACROINCREMENTED_VALUE6051 6052
+#define BSLS_MACROINCREMENTED_VALUE6052 6053
+#define BSLS_MACROINCREMENTED_VALUE6053 6054
+#define BSLS_MACROINCREMENTED_VALUE6054 6055
+#define BSLS_MACROINCREMENTED_VALUE6055 6056
+#define BSLS_MACROINCREMENTED_VALUE6056 6057
+#define BSLS_MACROINCREMENTED_VALUE6057 6058
+#define BSLS_MACROINCREMENTED_VALUE6058 6059
+#define BSLS_MACROINCREMENTED_VALUE6059 6060
+#define BSLS_MACROINCREMENTED_VALUE6060 6061
+#define BSLS_MACROINCREMENTED_VALUE6061 6062
+#define BSLS_MACROINCREMENTED_VALUE6062 6063
+#define BSLS_MACROINCREMENTED_VALUE6063 6064
+#define BSLS_MACROINCREMENTED_VALUE6064 6065
+#define BSLS_MACROINCREMENTED_VALUE6065 6066
+#define BSLS_MACROINCREMENTED_VALUE6066 6067
+#define BSLS_MACROINCREMENTED_VALUE6067 6068
+#define BSLS_MACROINCREMENTED_VALUE6068 6069
+#define BSLS_MACROINCREMENTED_VALUE6069 6070
+#define BSLS_MACROINCREMENTED_VALUE6070 6071
+#define BSLS_MACROINCREMENTED_VALUE6071 6072
+#define BSLS_MACROINCREMENTED_VALUE6072 6073
+#define BSLS_MACROINCREMENTED_VALUE6073 6074
+#define BSLS_MACROINCREMENTED_VALUE6074 6075
+#define BSLS_MACROINCREMENTED_VALUE6075 6076
+#define BSLS_MACROINCREMENTED_VALUE6076 6077
+#define BSLS_MACROINCREMENTED_VALUE6077 6078
+#define BSLS_MACROINCREMENTED_VALUE6078 6079
+#define BSLS_MACROINCREMENTED_VALUE6079 6080
+#define BSLS_MACROINCREMENTED_VALUE6080 6081
+#define BSLS_MACROINCREMENTED_VALUE6081 6082
+#define BSLS_MACROINCREMENTED_VALUE6082 6083
+#define BSLS_MACROINCREMENTED_VALUE6083 6084
+#define BSLS_MACROINCREMENTED_VALUE6084 6085
+#define BSLS_MACROINCREMENTED_VALUE6085 6086
+#define BSLS_MACROINCREMENTED_VALUE6086 6087
+#define BSLS_MACROINCREMENTED_VALUE6087 6088
+#define BSLS_MACROINCREMENTED_VALUE6088 6089
+#define BSLS_MACROINCREMENTED_VALUE6089 6090
+#define BSLS_MACROINCREMENTED_VALUE6090 6091
+#define BSLS_MACROINCREMENTED_VALUE6091 6092
+#define BSLS_MACROINCREMENTED_VALUE6092 6093
+#define BSLS_MACROINCREMENTED_VALUE6093 6094
+#define BSLS_MACROINCREMENTED_VALUE6094 6095
+#define BSLS_MACROINCREMENTED_VALUE6095 6096
+#define BSLS_MACROINCREMENTED_VALUE6096 6097
+#define BSLS_MACROINCREMENTED_VALUE6097 6098
+#define BSLS_MACROINCREMENTED_VALUE6098 6099
+#define BSLS_MACROINCREMENTED_VALUE6099 6100
+#define BSLS_MACROINCREMENTED_VALUE6100 6101
+#define BSLS_MACROINCREMENTED_VALUE6101 6102
+#define BSLS_MACROINCREMENTED_VALUE6102 6103
+#define BSLS_MACROINCREMENTED_VALUE6103 6104
+#define BSLS_MACROINCREMENTED_VALUE6104 6105
+#define BSLS_MACROINCREMENTED_VALUE6105 6106
+#define BSLS_MACROINCREMENTED_VALUE6106 6107
+#define BSLS_MACROINCREMENTED_VALUE6107 6108
+#define BSLS_MACROINCREMENTED_VALUE6108 6109
+#define BSLS_MACROINCREMENTED_VALUE6109 6110
+#define BSLS_MACROINCREMENTED_VALUE6110 6111
+#define BSLS_MACROINCREMENTED_VALUE6111 6112
+#define BSLS_MACROINCREMENTED_VALUE6112 6113
+#define BSLS_MACROINCREMENTED_VALUE6113 6114
+#define BSLS_MACROINCREMENTED_VALUE6114 6115
+#define BSLS_MACROINCREMENTED_VALUE6115 6116
+#define BSLS_MACROINCREMENTED_VALUE6116 6117
+#define BSLS_MACROINCREMENTED_VALUE6117 6118
+#define BSLS_MACROINCREMENTED_VALUE6118 6119
+#define BSLS_MACROINCREMENTED_VALUE6119 6120
+#define BSLS_MACROINCREMENTED_VALUE6120 6121
+#define BSLS_MACROINCREMENTED_VALUE6121 6122
+#define BSLS_MACROINCREMENTED_VALUE6122 6123
+#define BSLS_MACROINCREMENTED_VALUE6123 6124
+#define BSLS_MACROINCREMENTED_VALUE6124 6125
+#define BSLS_MACROINCREMENTED_VALUE6125 6126
+#define BSLS_MACROINCREMENTED_VALUE6126 6127
+#define BSLS_MACROINCREMENTED_VALUE6127 6128
+#define BSLS_MACROINCREMENTED_VALUE6128 6129
+#define BSLS_MACROINCREMENTED_VALUE6129 6130
+#define BSLS_MACROINCREMENTED_VALUE6130 6131
+#define BSLS_MACROINCREMENTED_VALUE6131 6132
+#define BSLS_MACROINCREMENTED_VALUE6132 6133
+#define BSLS_MACROINCREMENTED_VALUE6133 6134
+#define BSLS_MACROINCREMENTED_VALUE6134 6135
+#define BSLS_MACROINCREMENTED_VALUE6135 6136
+#define BSLS_MACROINCREMENTED_VALUE6136 6137
+#define BSLS_MACROINCREMENTED_VALUE6137 6138
+#define BSLS_MACROINCREMENTED_VALUE6138 6139
+#define BSLS_MACROINCREMENTED_VALUE6139 6140
+#define BSLS_MACROINCREMENTED_VALUE6140 6141
+#define BSLS_MACROINCREMENTED_VALUE6141 6142
+#define BSLS_MACROINCREMENTED_VALUE6142 6143
+#define BSLS_MACROINCREMENTED_VALUE6143 6144
+#define BSLS_MACROINCREMENTED_VALUE6144 6145
+#define BSLS_MACROINCREMENTED_VALUE6145 6146
+#define BSLS_MACROINCREMENTED_VALUE6146 6147
+#define BSLS_MACROINCREMENTED_VALUE6147 6148
+#define BSLS_MACROINCREMENTED_VALUE6148 6149
+#define BSLS_MACROINCREMENTED_VALUE6149 6150
+#define BSLS_MACROINCREMENTED_VALUE6150 6151
+#define BSLS_MACROINCREMENTED_VALUE6151 6152
+#define BSLS_MACROINCREMENTED_VALUE6152 6153
+#define BSLS_MACROINCREMENTED_VALUE6153 6154
+#define BSLS_MACROINCREMENTED_VALUE6154 6155
+#define BSLS_MACROINCREMENTED_VALUE6155 6156
+#define BSLS_MACROINCREMENTED_VALUE6156 6157
+#define BSLS_MACROINCREMENTED_VALUE6157 6158
+#define BSLS_MACROINCREMENTED_VALUE6158 6159
+#define BSLS_MACROINCREMENTED_VALUE6159 6160
+#define BSLS_MACROINCREMENTED_VALUE6160 6161
+#define BSLS_MACROINCREMENTED_VALUE6161 6162
+#define BSLS_MACROINCREMENTED_VALUE6162 6163
+#define BSLS_MACROINCREMENTED_VALUE6163 6164
+#define BSLS_MACROINCREMENTED_VALUE6164 6165
+#define BSLS_MACROINCREMENTED_VALUE6165 6166
+#define BSLS_MACROINCREMENTED_VALUE6166 6167
+#define BSLS_MACROINCREMENTED_VALUE6167 6168
+#define BSLS_MACROINCREMENTED_VALUE6168 6169
+#define BSLS_MACROINCREMENTED_VALUE6169 6170
+#define BSLS_MACROINCREMENTED_VALUE6170 6171
+#define BSLS_MACROINCREMENTED_VALUE6171 6172
+#define BSLS_MACROINCREMENTED_VALUE6172 6173
+#define BSLS_MACROINCREMENTED_VALUE6173 6174
+#define BSLS_MACROINCREMENTED_VALUE6174 6175
+#define BSLS_MACROINCREMENTED_VALUE6175 6176
+#define BSLS_MACROINCREMENTED_VALUE6176 6177
+#define BSLS_MACROINCREMENTED_VALUE6177 6178
+#define BSLS_MACROINCREMENTED_VALUE6178 6179
+#define BSLS_MACROINCREMENTED_VALUE6179 6180
+#define BSLS_MACROINCREMENTED_VALUE6180 6181
+#define BSLS_MACROINCREMENTED_VALUE6181 6182
+#define BSLS_MACROINCREMENTED_VALUE6182 6183
+#define BSLS_MACROINCREMENTED_VALUE6183 6184
+#define BSLS_MACROINCREMENTED_VALUE6184 6185
+#define BSLS_MACROINCREMENTED_VALUE6185 6186
+#define BSLS_MACROINCREMENTED_VALUE6186 6187
+#define BSLS_MACROINCREMENTED_VALUE6187 6188
+#define BSLS_MACROINCREMENTED_VALUE6188 6189
+#define BSLS_MACROINCREMENTED_VALUE6189 6190
+#define BSLS_MACROINCREMENTED_VALUE6190 6191
+#define BSLS_MACROINCREMENTED_VALUE6191 6192
+#define BSLS_MACROINCREMENTED_VALUE6192 6193
+#define BSLS_MACROINCREMENTED_VALUE6193 6194
+#define BSLS_MACROINCREMENTED_VALUE6194 6195
+#define BSLS_MACROINCREMENTED_VALUE6195 6196
+#define BSLS_MACROINCREMENTED_VALUE6196 6197
+#define BSLS_MACROINCREMENTED_VALUE6197 6198
+#define BSLS_MACROINCREMENTED_VALUE6198 6199
+#define BSLS_MACROINCREMENTED_VALUE6199 6200
+#define BSLS_MACROINCREMENTED_VALUE6200 6201
+#define BSLS_MACROINCREMENTED_VALUE6201 6202
+#define BSLS_MACROINCREMENTED_VALUE6202 6203
+#define BSLS_MACROINCREMENTED_VALUE6203 6204
+#define BSLS_MACROINCREMENTED_VALUE6204 6205
+#define BSLS_MACROINCREMENTED_VALUE6205 6206
+#define BSLS_MACROINCREMENTED_VALUE6206 6207
+#define BSLS_MACROINCREMENTED_VALUE6207 6208
+#define BSLS_MACROINCREMENTED_VALUE6208 6209
+#define BSLS_MACROINCREMENTED_VALUE6209 6210
+#define BSLS_MACROINCREMENTED_VALUE6210 6211
+#define BSLS_MACROINCREMENTED_VALUE6211 6212
+#define BSLS_MACROINCREMENTED_VALUE6212 6213
+#define BSLS_MACROINCREMENTED_VALUE6213 6214
+#define BSLS_MACROINCREMENTED_VALUE6214 6215
+#define BSLS_MACROINCREMENTED_VALUE6215 6216
+#define BSLS_MACROINCREMENTED_VALUE6216 6217
+#define BSLS_MACROINCREMENTED_VALUE6217 6218
+#define BSLS_MACROINCREMENTED_VALUE6218 6219
+#define BSLS_MACROINCREMENTED_VALUE6219 6220
+#define BSLS_MACROINCREMENTED_VALUE6220 6221
+#define BSLS_MACROINCREMENTED_VALUE6221 6222
+#define BSLS_MACROINCREMENTED_VALUE6222 6223
+#define BSLS_MACROINCREMENTED_VALUE6223 6224
+#define BSLS_MACROINCREMENTED_VALUE6224 6225
+#define BSLS_MACROINCREMENTED_VALUE6225 6226
+#define BSLS_MACROINCREMENTED_VALUE6226 6227
+#define BSLS_MACROINCREMENTED_VALUE6227 6228
+#define BSLS_MACROINCREMENTED_VALUE6228 6229
+#define BSLS_MACROINCREMENTED_VALUE6229 6230
+#define BSLS_MACROINCREMENTED_VALUE6230 6231
+#define BSLS_MACROINCREMENTED_VALUE6231 6232
+#define BSLS_MACROINCREMENTED_VALUE6232 6233
+#define BSLS_MACROINCREMENTED_VALUE6233 6234
+#define BSLS_MACROINCREMENTED_VALUE6234 6235
+#define BSLS_MACROINCREMENTED_VALUE6235 6236
+#define BSLS_MACROINCREMENTED_VALUE6236 6237
+#define BSLS_MACROINCREMENTED_VALUE6237 6238
+#define BSLS_MACROINCREMENTED_VALUE6238 6239
+#define BSLS_MACROINCREMENTED_VALUE6239 6240
+#define BSLS_MACROINCREMENTED_VALUE6240 6241
+#define BSLS_MACROINCREMENTED_VALUE6241 6242
+#define BSLS_MACROINCREMENTED_VALUE6242 6243
+#define BSLS_MACROINCREMENTED_VALUE6243 6244
+#define BSLS_MACROINCREMENTED_VALUE6244 6245
+#define BSLS_MACROINCREMENTED_VALUE6245 6246
+#define BSLS_MACROINCREMENTED_VALUE6246 6247
+#define BSLS_MACROINCREMENTED_VALUE6247 6248
+#define BSLS_MACROINCREMENTED_VALUE6248 6249
+#define BSLS_MACROINCREMENTED_VALUE6249 6250
+#define BSLS_MACROINCREMENTED_VALUE6250 6251
+#define BSLS_MACROINCREMENTED_VALUE6251 6252
+#define BSLS_MACROINCREMENTED_VALUE6252 6253
+#define BSLS_MACROINCREMENTED_VALUE6253 6254
+#define BSLS_MACROINCREMENTED_VALUE6254 6255
+#define BSLS_MACROINCREMENTED_VALUE6255 6256
+#define BSLS_MACROINCREMENTED_VALUE6256 6257
+#define BSLS_MACROINCREMENTED_VALUE6257 6258
+#define BSLS_MACROINCREMENTED_VALUE6258 6259
+#define BSLS_MACROINCREMENTED_VALUE6259 6260
+#define BSLS_MACROINCREMENTED_VALUE6260 6261
+#define BSLS_MACROINCREMENTED_VALUE6261 6262
+#define BSLS_MACROINCREMENTED_VALUE6262 6263
+#define BSLS_MACROINCREMENTED_VALUE6263 6264
+#define BSLS_MACROINCREMENTED_VALUE6264 6265
+#define BSLS_MACROINCREMENTED_VALUE6265 6266
+#define BSLS_MACROINCREMENTED_VALUE6266 6267
+#define BSLS_MACROINCREMENTED_VALUE6267 6268
+#define BSLS_MACROINCREMENTED_VALUE6268 6269
+#define BSLS_MACROINCREMENTED_VALUE6269 6270
+#define BSLS_MACROINCREMENTED_VALUE6270 6271
+#define BSLS_MACROINCREMENTED_VALUE6271 6272
+#define BSLS_MACROINCREMENTED_VALUE6272 6273
+#define BSLS_MACROINCREMENTED_VALUE6273 6274
+#define BSLS_MACROINCREMENTED_VALUE6274 6275
+#define BSLS_MACROINCREMENTED_VALUE6275 6276
+#define BSLS_MACROINCREMENTED_VALUE6276 6277
+#define BSLS_MACROINCREMENTED_VALUE6277 6278
+#define BSLS_MACROINCREMENTED_VALUE6278 6279
+#define BSLS_MACROINCREMENTED_VALUE6279 6280
+#define BSLS_MACROINCREMENTED_VALUE6280 6281
+#define BSLS_MACROINCREMENTED_VALUE6281 6282
+#define BSLS_MACROINCREMENTED_VALUE6282 6283
+#define BSLS_MACROINCREMENTED_VALUE6283 6284
+#define BSLS_MACROINCREMENTED_VALUE6284 6285
+#define BSLS_MACROINCREMENTED_VALUE6285 6286
+#define BSLS_MACROINCREMENTED_VALUE6286 6287
+#define BSLS_MACROINCREMENTED_VALUE6287 6288
+#define BSLS_MACROINCREMENTED_VALUE6288 6289
+#define BSLS_MACROINCREMENTED_VALUE6289 6290
+#define BSLS_MACROINCREMENTED_VALUE6290 6291
+#define BSLS_MACROINCREMENTED_VALUE6291 6292
+#define BSLS_MACROINCREMENTED_VALUE6292 6293
+#define BSLS_MACROINCREMENTED_VALUE6293 6294
+#define BSLS_MACROINCREMENTED_VALUE6294 6295
+#define BSLS_MACROINCREMENTED_VALUE6295 6296
+#define BSLS_MACROINCREMENTED_VALUE6296 6297
+#define BSLS_MACROINCREMENTED_VALUE6297 6298
+#define BSLS_MACROINCREMENTED_VALUE6298 6299
+#define BSLS_MACROINCREMENTED_VALUE6299 6300
+#define BSLS_MACROINCREMENTED_VALUE6300 6301
+#define BSLS_MACROINCREMENTED_VALUE6301 6302
+#define BSLS_MACROINCREMENTED_VALUE6302 6303
+#define BSLS_MACROINCREMENTED_VALUE6303 6304
+#define BSLS_MACROINCREMENTED_VALUE6304 6305
+#define BSLS_MACROINCREMENTED_VALUE6305 6306
+#define BSLS_MACROINCREMENTED_VALUE6306 6307
+#define BSLS_MACROINCREMENTED_VALUE6307 6308
+#define BSLS_MACROINCREMENTED_VALUE6308 6309
+#define BSLS_MACROINCREMENTED_VALUE6309 6310
+#define BSLS_MACROINCREMENTED_VALUE6310 6311
+#define BSLS_MACROINCREMENTED_VALUE6311 6312
+#define BSLS_MACROINCREMENTED_VALUE6312 6313
+#define BSLS_MACROINCREMENTED_VALUE6313 6314
+#define BSLS_MACROINCREMENTED_VALUE6314 6315
+#define BSLS_MACROINCREMENTED_VALUE6315 6316
+#define BSLS_MACROINCREMENTED_VALUE6316 6317
+#define BSLS_MACROINCREMENTED_VALUE6317 6318
+#define BSLS_MACROINCREMENTED_VALUE6318 6319
+#define BSLS_MACROINCREMENTED_VALUE6319 6320
+#define BSLS_MACROINCREMENTED_VALUE6320 6321
+#define BSLS_MACROINCREMENTED_VALUE6321 6322
+#define BSLS_MACROINCREMENTED_VALUE6322 6323
+#define BSLS_MACROINCREMENTED_VALUE6323 6324
+#define BSLS_MACROINCREMENTED_VALUE6324 6325
+#define BSLS_MACROINCREMENTED_VALUE6325 6326
+#define BSLS_MACROINCREMENTED_VALUE6326 6327
+#define BSLS_MACROINCREMENTED_VALUE6327 6328
+#define BSLS_MACROINCREMENTED_VALUE6328 6329
+#define BSLS_MACROINCREMENTED_VALUE6329 6330
+#define BSLS_MACROINCREMENTED_VALUE6330 6331
+#define BSLS_MACROINCREMENTED_VALUE6331 6332
+#define BSLS_MACROINCREMENTED_VALUE6332 6333
+#define BSLS_MACROINCREMENTED_VALUE6333 6334
+#define BSLS_MACROINCREMENTED_VALUE6334 6335
+#define BSLS_MACROINCREMENTED_VALUE6335 6336
+#define BSLS_MACROINCREMENTED_VALUE6336 6337
+#define BSLS_MACROINCREMENTED_VALUE6337 6338
+#define BSLS_MACROINCREMENTED_VALUE6338 6339
+#define BSLS_MACROINCREMENTED_VALUE6339 6340
+#define BSLS_MACROINCREMENTED_VALUE6340 6341
+#define BSLS_MACROINCREMENTED_VALUE6341 6342
+#define BSLS_MACROINCREMENTED_VALUE6342 6343
+#define BSLS_MACROINCREMENTED_VALUE6343 6344
+#define BSLS_MACROINCREMENTED_VALUE6344 6345
+#define BSLS_MACROINCREMENTED_VALUE6345 6346
+#define BSLS_MACROINCREMENTED_VALUE6346 6347
+#define BSLS_MACROINCREMENTED_VALUE6347 6348
+#define BSLS_MACROINCREMENTED_VALUE6348 6349
+#define BSLS_MACROINCREMENTED_VALUE6349 6350
+#define BSLS_MACROINCREMENTED_VALUE6350 6351
+#define BSLS_MACROINCREMENTED_VALUE6351 6352
+#define BSLS_MACROINCREMENTED_VALUE6352 6353
+#define BSLS_MACROINCREMENTED_VALUE6353 6354
+#define BSLS_MACROINCREMENTED_VALUE6354 6355
+#define BSLS_MACROINCREMENTED_VALUE6355 6356
+#define BSLS_MACROINCREMENTED_VALUE6356 6357
+#define BSLS_MACROINCREMENTED_VALUE6357 6358
+#define BSLS_MACROINCREMENTED_VALUE6358 6359
+#define BSLS_MACROINCREMENTED_VALUE6359 6360
+#define BSLS_MACROINCREMENTED_VALUE6360 6361
+#define BSLS_MACROINCREMENTED_VALUE6361 6362
+#define BSLS_MACROINCREMENTED_VALUE6362 6363
+#define BSLS_MACROINCREMENTED_VALUE6363 6364
+#define BSLS_MACROINCREMENTED_VALUE6364 6365
+#define BSLS_MACROINCREMENTED_VALUE6365 6366
+#define BSLS_MACROINCREMENTED_VALUE6366 6367
+#define BSLS_MACROINCREMENTED_VALUE6367 6368
+#define BSLS_MACROINCREMENTED_VALUE6368 6369
+#define BSLS_MACROINCREMENTED_VALUE6369 6370
+#define BSLS_MACROINCREMENTED_VALUE6370 6371
+#define BSLS_MACROINCREMENTED_VALUE6371 6372
+#define BSLS_MACROINCREMENTED_VALUE6372 6373
+#define BSLS_MACROINCREMENTED_VALUE6373 6374
+#define BSLS_MACROINCREMENTED_VALUE6374 6375
+#define BSLS_MACROINCREMENTED_VALUE6375 6376
+#define BSLS_MACROINCREMENTED_VALUE6376 6377
+#define BSLS_MACROINCREMENTED_VALUE6377 6378
+#define BSLS_MACROINCREMENTED_VALUE6378 6379
+#define BSLS_MACROINCREMENTED_VALUE6379 6380
+#define BSLS_MACROINCREMENTED_VALUE6380 6381
+#define BSLS_MACROINCREMENTED_VALUE6381 6382
+#define BSLS_MACROINCREMENTED_VALUE6382 6383
+#define BSLS_MACROINCREMENTED_VALUE6383 6384
+#define BSLS_MACROINCREMENTED_VALUE6384 6385
+#define BSLS_MACROINCREMENTED_VALUE6385 6386
+#define BSLS_MACROINCREMENTED_VALUE6386 6387
+#define BSLS_MACROINCREMENTED_VALUE6387 6388
+#define BSLS_MACROINCREMENTED_VALUE6388 6389
+#define BSLS_MACROINCREMENTED_VALUE6389 6390
+#define BSLS_MACROINCREMENTED_VALUE6390 6391
+#define BSLS_MACROINCREMENTED_VALUE6391 6392
+#define BSLS_MACROINCREMENTED_VALUE6392 6393
+#define BSLS_MACROINCREMENTED_VALUE6393 6394
+#define BSLS_MACROINCREMENTED_VALUE6394 6395
+#define BSLS_MACROINCREMENTED_VALUE6395 6396
+#define BSLS_MACROINCREMENTED_VALUE6396 6397
+#define BSLS_MACROINCREMENTED_VALUE6397 6398
+#define BSLS_MACROINCREMENTED_VALUE6398 6399
+#define BSLS_MACROINCREMENTED_VALUE6399 6400
+#define BSLS_MACROINCREMENTED_VALUE6400 6401
+#define BSLS_MACROINCREMENTED_VALUE6401 6402
+#define BSLS_MACROINCREMENTED_VALUE6402 6403
+#define BSLS_MACROINCREMENTED_VALUE6403 6404
+#define BSLS_MACROINCREMENTED_VALUE6404 6405
+#define BSLS_MACROINCREMENTED_VALUE6405 6406
+#define BSLS_MACROINCREMENTED_VALUE6406 6407
+#define BSLS_MACROINCREMENTED_VALUE6407 6408
+#define BSLS_MACROINCREMENTED_VALUE6408 6409
+#define BSLS_MACROINCREMENTED_VALUE6409 6410
+#define BSLS_MACROINCREMENTED_VALUE6410 6411
+#define BSLS_MACROINCREMENTED_VALUE6411 6412
+#define BSLS_MACROINCREMENTED_VALUE6412 6413
+#define BSLS_MACROINCREMENTED_VALUE6413 6414
+#define BSLS_MACROINCREMENTED_VALUE6414 6415
+#define BSLS_MACROINCREMENTED_VALUE6415 6416
+#define BSLS_MACROINCREMENTED_VALUE6416 6417
+#define BSLS_MACROINCREMENTED_VALUE6417 6418
+#define BSLS_MACROINCREMENTED_VALUE6418 6419
+#define BSLS_MACROINCREMENTED_VALUE6419 6420
+#define BSLS_MACROINCREMENTED_VALUE6420 6421
+#define BSLS_MACROINCREMENTED_VALUE6421 6422
+#define BSLS_MACROINCREMENTED_VALUE6422 6423
+#define BSLS_MACROINCREMENTED_VALUE6423 6424
+#define BSLS_MACROINCREMENTED_VALUE6424 6425
+#define BSLS_MACROINCREMENTED_VALUE6425 6426
+#define BSLS_MACROINCREMENTED_VALUE6426 6427
+#define BSLS_MACROINCREMENTED_VALUE6427 6428
+#define BSLS_MACROINCREMENTED_VALUE6428 6429
+#define BSLS_MACROINCREMENTED_VALUE6429 6430
+#define BSLS_MACROINCREMENTED_VALUE6430 6431
+#define BSLS_MACROINCREMENTED_VALUE6431 6432
+#define BSLS_MACROINCREMENTED_VALUE6432 6433
+#define BSLS_MACROINCREMENTED_VALUE6433 6434
+#define BSLS_MACROINCREMENTED_VALUE6434 6435
+#define BSLS_MACROINCREMENTED_VALUE6435 6436
+#define BSLS_MACROINCREMENTED_VALUE6436 6437
+#define BSLS_MACROINCREMENTED_VALUE6437 6438
+#define BSLS_MACROINCREMENTED_VALUE6438 6439
+#define BSLS_MACROINCREMENTED_VALUE6439 6440
+#define BSLS_MACROINCREMENTED_VALUE6440 6441
+#define BSLS_MACROINCREMENTED_VALUE6441 6442
+#define BSLS_MACROINCREMENTED_VALUE6442 6443
+#define BSLS_MACROINCREMENTED_VALUE6443 6444
+#define BSLS_MACROINCREMENTED_VALUE6444 6445
+#define BSLS_MACROINCREMENTED_VALUE6445 6446
+#define BSLS_MACROINCREMENTED_VALUE6446 6447
+#define BSLS_MACROINCREMENTED_VALUE6447 6448
+#define BSLS_MACROINCREMENTED_VALUE6448 6449
+#define BSLS_MACROINCREMENTED_VALUE6449 6450
+#define BSLS_MACROINCREMENTED_VALUE6450 6451
+#define BSLS_MACROINCREMENTED_VALUE6451 6452
+#define BSLS_MACROINCREMENTED_VALUE6452 6453
+#define BSLS_MACROINCREMENTED_VALUE6453 6454
+#define BSLS_MACROINCREMENTED_VALUE6454 6455
+#define BSLS_MACROINCREMENTED_VALUE6455 6456
+#define BSLS_MACROINCREMENTED_VALUE6456 6457
+#define BSLS_MACROINCREMENTED_VALUE6457 6458
+#define BSLS_MACROINCREMENTED_VALUE6458 6459
+#define BSLS_MACROINCREMENTED_VALUE6459 6460
+#define BSLS_MACROINCREMENTED_VALUE6460 6461
+#define BSLS_MACROINCREMENTED_VALUE6461 6462
+#define BSLS_MACROINCREMENTED_VALUE6462 6463
+#define BSLS_MACROINCREMENTED_VALUE6463 6464
+#define BSLS_MACROINCREMENTED_VALUE6464 6465
+#define BSLS_MACROINCREMENTED_VALUE6465 6466
+#define BSLS_MACROINCREMENTED_VALUE6466 6467
+#define BSLS_MACROINCREMENTED_VALUE6467 6468
+#define BSLS_MACROINCREMENTED_VALUE6468 6469
+#define BSLS_MACROINCREMENTED_VALUE6469 6470
+#define BSLS_MACROINCREMENTED_VALUE6470 6471
+#define BSLS_MACROINCREMENTED_VALUE6471 6472
+#define BSLS_MACROINCREMENTED_VALUE6472 6473
+#define BSLS_MACROINCREMENTED_VALUE6473 6474
+#define BSLS_MACROINCREMENTED_VALUE6474 6475
+#define BSLS_MACROINCREMENTED_VALUE6475 6476
+#define BSLS_MACROINCREMENTED_VALUE6476 6477
+#define BSLS_MACROINCREMENTED_VALUE6477 6478
+#define BSLS_MACROINCREMENTED_VALUE6478 6479
+#define BSLS_MACROINCREMENTED_VALUE6479 6480
+#define BSLS_MACROINCREMENTED_VALUE6480 6481
+#define BSLS_MACROINCREMENTED_VALUE6481 6482
+#define BSLS_MACROINCREMENTED_VALUE6482 6483
+#define BSLS_MACROINCREMENTED_VALUE6483 6484
+#define BSLS_MACROINCREMENTED_VALUE6484 6485
+#define BSLS_MACROINCREMENTED_VALUE6485 6486
+#define BSLS_MACROINCREMENTED_VALUE6486 6487
+#define BSLS_MACROINCREMENTED_VALUE6487 6488
+#define BSLS_MACROINCREMENTED_VALUE6488 6489
+#define BSLS_MACROINCREMENTED_VALUE6489 6490
+#define BSLS_MACROINCREMENTED_VALUE6490 6491
+#define BSLS_MACROINCREMENTED_VALUE6491 6492
+#define BSLS_MACROINCREMENTED_VALUE6492 6493
+#define BSLS_MACROINCREMENTED_VALUE6493 6494
+#define BSLS_MACROINCREMENTED_VALUE6494 6495
+#define BSLS_MACROINCREMENTED_VALUE6495 6496
+#define BSLS_MACROINCREMENTED_VALUE6496 6497
+#define BSLS_MACROINCREMENTED_VALUE6497 6498
+#define BSLS_MACROINCREMENTED_VALUE6498 6499
+#define BSLS_MACROINCREMENTED_VALUE6499 6500
+#define BSLS_MACROINCREMENTED_VALUE6500 6501
+#define BSLS_MACROINCREMENTED_VALUE6501 6502
+#define BSLS_MACROINCREMENTED_VALUE6502 6503
+#define BSLS_MACROINCREMENTED_VALUE6503 6504
+#define BSLS_MACROINCREMENTED_VALUE6504 6505
+#define BSLS_MACROINCREMENTED_VALUE6505 6506
+#define BSLS_MACROINCREMENTED_VALUE6506 6507
+#define BSLS_MACROINCREMENTED_VALUE6507 6508
+#define BSLS_MACROINCREMENTED_VALUE6508 6509
+#define BSLS_MACROINCREMENTED_VALUE6509 6510
+#define BSLS_MACROINCREMENTED_VALUE6510 6511
+#define BSLS_MACROINCREMENTED_VALUE6511 6512
+#define BSLS_MACROINCREMENTED_VALUE6512 6513
+#define BSLS_MACROINCREMENTED_VALUE6513 6514
+#define BSLS_MACROINCREMENTED_VALUE6514 6515
+#define BSLS_MACROINCREMENTED_VALUE6515 6516
+#define BSLS_MACROINCREMENTED_VALUE6516 6517
+#define BSLS_MACROINCREMENTED_VALUE6517 6518
+#define BSLS_MACROINCREMENTED_VALUE6518 6519
+#define BSLS_MACROINCREMENTED_VALUE6519 6520
+#define BSLS_MACROINCREMENTED_VALUE6520 6521
+#define BSLS_MACROINCREMENTED_VALUE6521 6522
+#define BSLS_MACROINCREMENTED_VALUE6522 6523
+#define BSLS_MACROINCREMENTED_VALUE6523 6524
+#define BSLS_MACROINCREMENTED_VALUE6524 6525
+#define BSLS_MACROINCREMENTED_VALUE6525 6526
+#define BSLS_MACROINCREMENTED_VALUE6526 6527
+#define BSLS_MACROINCREMENTED_VALUE6527 6528
+#define BSLS_MACROINCREMENTED_VALUE6528 6529
+#define BSLS_MACROINCREMENTED_VALUE6529 6530
+#define BSLS_MACROINCREMENTED_VALUE6530 6531
+#define BSLS_MACROINCREMENTED_VALUE6531 6532
+#define BSLS_MACROINCREMENTED_VALUE6532 6533
+#define BSLS_MACROINCREMENTED_VALUE6533 6534
+#define BSLS_MACROINCREMENTED_VALUE6534 6535
+#define BSLS_MACROINCREMENTED_VALUE6535 6536
+#define BSLS_MACROINCREMENTED_VALUE6536 6537
+#define BSLS_MACROINCREMENTED_VALUE6537 6538
+#define BSLS_MACROINCREMENTED_VALUE6538 6539
+#define BSLS_MACROINCREMENTED_VALUE6539 6540
+#define BSLS_MACROINCREMENTED_VALUE6540 6541
+#define BSLS_MACROINCREMENTED_VALUE6541 6542
+#define BSLS_MACROINCREMENTED_VALUE6542 6543
+#define BSLS_MACROINCREMENTED_VALUE6543 6544
+#define BSLS_MACROINCREMENTED_VALUE6544 6545
+#define BSLS_MACROINCREMENTED_VALUE6545 6546
+#define BSLS_MACROINCREMENTED_VALUE6546 6547
+#define BSLS_MACROINCREMENTED_VALUE6547 6548
+#define BSLS_MACROINCREMENTED_VALUE6548 6549
+#define BSLS_MACROINCREMENTED_VALUE6549 6550
+#define BSLS_MACROINCREMENTED_VALUE6550 6551
+#define BSLS_MACROINCREMENTED_VALUE6551 6552
+#define BSLS_MACROINCREMENTED_VALUE6552 6553
+#define BSLS_MACROINCREMENTED_VALUE6553 6554
+#define BSLS_MACROINCREMENTED_VALUE6554 6555
+#define BSLS_MACROINCREMENTED_VALUE6555 6556
+#define BSLS_MACROINCREMENTED_VALUE6556 6557
+#define BSLS_MACROINCREMENTED_VALUE6557 6558
+#define BSLS_MACROINCREMENTED_VALUE6558 6559
+#define BSLS_MACROINCREMENTED_VALUE6559 6560
+#define BSLS_MACROINCREMENTED_VALUE6560 6561
+#define BSLS_MACROINCREMENTED_VALUE6561 6562
+#define BSLS_MACROINCREMENTED_VALUE6562 6563
+#define BSLS_MACROINCREMENTED_VALUE6563 6564
+#define BSLS_MACROINCREMENTED_VALUE6564 6565
+#define BSLS_MACROINCREMENTED_VALUE6565 6566
+#define BSLS_MACROINCREMENTED_VALUE6566 6567
+#define BSLS_MACROINCREMENTED_VALUE6567 6568
+#define BSLS_MACROINCREMENTED_VALUE6568 6569
+#define BSLS_MACROINCREMENTED_VALUE6569 6570
+#define BSLS_MACROINCREMENTED_VALUE6570 6571
+#define BSLS_MACROINCREMENTED_VALUE6571 6572
+#define BSLS_MACROINCREMENTED_VALUE6572 6573
+#define BSLS_MACROINCREMENTED_VALUE6573 6574
+#define BSLS_MACROINCREMENTED_VALUE6574 6575
+#define BSLS_MACROINCREMENTED_VALUE6575 6576
+#define BSLS_MACROINCREMENTED_VALUE6576 6577
+#define BSLS_MACROINCREMENTED_VALUE6577 6578
+#define BSLS_MACROINCREMENTED_VALUE6578 6579
+#define BSLS_MACROINCREMENTED_VALUE6579 6580
+#define BSLS_MACROINCREMENTED_VALUE6580 6581
+#define BSLS_MACROINCREMENTED_VALUE6581 6582
+#define BSLS_MACROINCREMENTED_VALUE6582 6583
+#define BSLS_MACROINCREMENTED_VALUE6583 6584
+#define BSLS_MACROINCREMENTED_VALUE6584 6585
+#define BSLS_MACROINCREMENTED_VALUE6585 6586
+#define BSLS_MACROINCREMENTED_VALUE6586 6587
+#define BSLS_MACROINCREMENTED_VALUE6587 6588
+#define BSLS_MACROINCREMENTED_VALUE6588 6589
+#define BSLS_MACROINCREMENTED_VALUE6589 6590
+#define BSLS_MACROINCREMENTED_VALUE6590 6591
+#define BSLS_MACROINCREMENTED_VALUE6591 6592
+#define BSLS_MACROINCREMENTED_VALUE6592 6593
+#define BSLS_MACROINCREMENTED_VALUE6593 6594
+#define BSLS_MACROINCREMENTED_VALUE6594 6595
+#define BSLS_MACROINCREMENTED_VALUE6595 6596
+#define BSLS_MACROINCREMENTED_VALUE6596 6597
+#define BSLS_MACROINCREMENTED_VALUE6597 6598
+#define BSLS_MACROINCREMENTED_VALUE6598 6599
+#define BSLS_MACROINCREMENTED_VALUE6599 6600
+#define BSLS_MACROINCREMENTED_VALUE6600 6601
+#define BSLS_MACROINCREMENTED_VALUE6601 6602
+#define BSLS_MACROINCREMENTED_VALUE6602 6603
+#define BSLS_MACROINCREMENTED_VALUE6603 6604
+#define BSLS_MACROINCREMENTED_VALUE6604 6605
+#define BSLS_MACROINCREMENTED_VALUE6605 6606
+#define BSLS_MACROINCREMENTED_VALUE6606 6607
+#define BSLS_MACROINCREMENTED_VALUE6607 6608
+#define BSLS_MACROINCREMENTED_VALUE6608 6609
+#define BSLS_MACROINCREMENTED_VALUE6609 6610
+#define BSLS_MACROINCREMENTED_VALUE6610 6611
+#define BSLS_MACROINCREMENTED_VALUE6611 6612
+#define BSLS_MACROINCREMENTED_VALUE6612 6613
+#define BSLS_MACROINCREMENTED_VALUE6613 6614
+#define BSLS_MACROINCREMENTED_VALUE6614 6615
+#define BSLS_MACROINCREMENTED_VALUE6615 6616
+#define BSLS_MACROINCREMENTED_VALUE6616 6617
+#define BSLS_MACROINCREMENTED_VALUE6617 6618
+#define BSLS_MACROINCREMENTED_VALUE6618 6619
+#define BSLS_MACROINCREMENTED_VALUE6619 6620
+#define BSLS_MACROINCREMENTED_VALUE6620 6621
+#define BSLS_MACROINCREMENTED_VALUE6621 6622
+#define BSLS_MACROINCREMENTED_VALUE6622 6623
+#define BSLS_MACROINCREMENTED_VALUE6623 6624
+#define BSLS_MACROINCREMENTED_VALUE6624 6625
+#define BSLS_MACROINCREMENTED_VALUE6625 6626
+#define BSLS_MACROINCREMENTED_VALUE6626 6627
+#define BSLS_MACROINCREMENTED_VALUE6627 6628
+#define BSLS_MACROINCREMENTED_VALUE6628 6629
+#define BSLS_MACROINCREMENTED_VALUE6629 6630
+#define BSLS_MACROINCREMENTED_VALUE6630 6631
+#define BSLS_MACROINCREMENTED_VALUE6631 6632
+#define BSLS_MACROINCREMENTED_VALUE6632 6633
+#define BSLS_MACROINCREMENTED_VALUE6633 6634
+#define BSLS_MACROINCREMENTED_VALUE6634 6635
+#define BSLS_MACROINCREMENTED_VALUE6635 6636
+#define BSLS_MACROINCREMENTED_VALUE6636 6637
+#define BSLS_MACROINCREMENTED_VALUE6637 6638
+#define BSLS_MACROINCREMENTED_VALUE6638 6639
+#define BSLS_MACROINCREMENTED_VALUE6639 6640
+#define BSLS_MACROINCREMENTED_VALUE6640 6641
+#define BSLS_MACROINCREMENTED_VALUE6641 6642
+#define BSLS_MACROINCREMENTED_VALUE6642 6643
+#define BSLS_MACROINCREMENTED_VALUE6643 6644
+#define BSLS_MACROINCREMENTED_VALUE6644 6645
+#define BSLS_MACROINCREMENTED_VALUE6645 6646
+#define BSLS_MACROINCREMENTED_VALUE6646 6647
+#define BSLS_MACROINCREMENTED_VALUE6647 6648
+#define BSLS_MACROINCREMENTED_VALUE6648 6649
+#define BSLS_MACROINCREMENTED_VALUE6649 6650
+#define BSLS_MACROINCREMENTED_VALUE6650 6651
+#define BSLS_MACROINCREMENTED_VALUE6651 6652
+#define BSLS_MACROINCREMENTED_VALUE6652 6653
+#define BSLS_MACROINCREMENTED_VALUE6653 6654
+#define BSLS_MACROINCREMENTED_VALUE6654 6655
+#define BSLS_MACROINCREMENTED_VALUE6655 6656
+#define BSLS_MACROINCREMENTED_VALUE6656 6657
+#define BSLS_MACROINCREMENTED_VALUE6657 6658
+#define BSLS_MACROINCREMENTED_VALUE6658 6659
+#define BSLS_MACROINCREMENTED_VALUE6659 6660
+#define BSLS_MACROINCREMENTED_VALUE6660 6661
+#define BSLS_MACROINCREMENTED_VALUE6661 6662
+#define BSLS_MACROINCREMENTED_VALUE6662 6663
+#define BSLS_MACROINCREMENTED_VALUE6663 6664
+#define BSLS_MACROINCREMENTED_VALUE6664 6665
+#define BSLS_MACROINCREMENTED_VALUE6665 6666
+#define BSLS_MACROINCREMENTED_VALUE6666 6667
+#define BSLS_MACROINCREMENTED_VALUE6667 6668
+#define BSLS_MACROINCREMENTED_VALUE6668 6669
+#define BSLS_MACROINCREMENTED_VALUE6669 6670
+#define BSLS_MACROINCREMENTED_VALUE6670 6671
+#define BSLS_MACROINCREMENTED_VALUE6671 6672
+#define BSLS_MACROINCREMENTED_VALUE6672 6673
+#define BSLS_MACROINCREMENTED_VALUE6673 6674
+#define BSLS_MACROINCREMENTED_VALUE6674 6675
+#define BSLS_MACROINCREMENTED_VALUE6675 6676
+#define BSLS_MACROINCREMENTED_VALUE6676 6677
+#define BSLS_MACROINCREMENTED_VALUE6677 6678
+#define BSLS_MACROINCREMENTED_VALUE6678 6679
+#define BSLS_MACROINCREMENTED_VALUE6679 6680
+#define BSLS_MACROINCREMENTED_VALUE6680 6681
+#define BSLS_MACROINCREMENTED_VALUE6681 6682
+#define BSLS_MACROINCREMENTED_VALUE6682 6683
+#define BSLS_MACROINCREMENTED_VALUE6683 6684
+#define BSLS_MACROINCREMENTED_VALUE6684 6685
+#define BSLS_MACROINCREMENTED_VALUE6685 6686
+#define BSLS_MACROINCREMENTED_VALUE6686 6687
+#define BSLS_MACROINCREMENTED_VALUE6687 6688
+#define BSLS_MACROINCREMENTED_VALUE6688 6689
+#define BSLS_MACROINCREMENTED_VALUE6689 6690
+#define BSLS_MACROINCREMENTED_VALUE6690 6691
+#define BSLS_MACROINCREMENTED_VALUE6691 6692
+#define BSLS_MACROINCREMENTED_VALUE6692 6693
+#define BSLS_MACROINCREMENTED_VALUE6693 6694
+#define BSLS_MACROINCREMENTED_VALUE6694 6695
+#define BSLS_MACROINCREMENTED_VALUE6695 6696
+#define BSLS_MACROINCREMENTED_VALUE6696 6697
+#define BSLS_MACROINCREMENTED_VALUE6697 6698
+#define BSLS_MACROINCREMENTED_VALUE6698 6699
+#define BSLS_MACROINCREMENTED_VALUE6699 6700
+#define BSLS_MACROINCREMENTED_VALUE6700 6701
+#define BSLS_MACROINCREMENTED_VALUE6701 6702
+#define BSLS_MACROINCREMENTED_VALUE6702 6703
+#define BSLS_MACROINCREMENTED_VALUE6703 6704
+#define BSLS_MACROINCREMENTED_VALUE6704 6705
+#define BSLS_MACROINCREMENTED_VALUE6705 6706
+#define BSLS_MACROINCREMENTED_VALUE6706 6707
+#define BSLS_MACROINCREMENTED_VALUE6707 6708
+#define BSLS_MACROINCREMENTED_VALUE6708 6709
+#define BSLS_MACROINCREMENTED_VALUE6709 6710
+#define BSLS_MACROINCREMENTED_VALUE6710 6711
+#define BSLS_MACROINCREMENTED_VALUE6711 6712
+#define BSLS_MACROINCREMENTED_VALUE6712 6713
+#define BSLS_MACROINCREMENTED_VALUE6713 6714
+#define BSLS_MACROINCREMENTED_VALUE6714 6715
+#define BSLS_MACROINCREMENTED_VALUE6715 6716
+#define BSLS_MACROINCREMENTED_VALUE6716 6717
+#define BSLS_MACROINCREMENTED_VALUE6717 6718
+#define BSLS_MACROINCREMENTED_VALUE6718 6719
+#define BSLS_MACROINCREMENTED_VALUE6719 6720
+#define BSLS_MACROINCREMENTED_VALUE6720 6721
+#define BSLS_MACROINCREMENTED_VALUE6721 6722
+#define BSLS_MACROINCREMENTED_VALUE6722 6723
+#define BSLS_MACROINCREMENTED_VALUE6723 6724
+#define BSLS_MACROINCREMENTED_VALUE6724 6725
+#define BSLS_MACROINCREMENTED_VALUE6725 6726
+#define BSLS_MACROINCREMENTED_VALUE6726 6727
+#define BSLS_MACROINCREMENTED_VALUE6727 6728
+#define BSLS_MACROINCREMENTED_VALUE6728 6729
+#define BSLS_MACROINCREMENTED_VALUE6729 6730
+#define BSLS_MACROINCREMENTED_VALUE6730 6731
+#define BSLS_MACROINCREMENTED_VALUE6731 6732
+#define BSLS_MACROINCREMENTED_VALUE6732 6733
+#define BSLS_MACROINCREMENTED_VALUE6733 6734
+#define BSLS_MACROINCREMENTED_VALUE6734 6735
+#define BSLS_MACROINCREMENTED_VALUE6735 6736
+#define BSLS_MACROINCREMENTED_VALUE6736 6737
+#define BSLS_MACROINCREMENTED_VALUE6737 6738
+#define BSLS_MACROINCREMENTED_VALUE6738 6739
+#define BSLS_MACROINCREMENTED_VALUE6739 6740
+#define BSLS_MACROINCREMENTED_VALUE6740 6741
+#define BSLS_MACROINCREMENTED_VALUE6741 6742
+#define BSLS_MACROINCREMENTED_VALUE6742 6743
+#define BSLS_MACROINCREMENTED_VALUE6743 6744
+#define BSLS_MACROINCREMENTED_VALUE6744 6745
+#define BSLS_MACROINCREMENTED_VALUE6745 6746
+#define BSLS_MACROINCREMENTED_VALUE6746 6747
+#define BSLS_MACROINCREMENTED_VALUE6747 6748
+#define BSLS_MACROINCREMENTED_VALUE6748 6749
+#define BSLS_MACROINCREMENTED_VALUE6749 6750
+#define BSLS_MACROINCREMENTED_VALUE6750 6751
+#define BSLS_MACROINCREMENTED_VALUE6751 6752
+#define BSLS_MACROINCREMENTED_VALUE6752 6753
+#define BSLS_MACROINCREMENTED_VALUE6753 6754
+#define BSLS_MACROINCREMENTED_VALUE6754 6755
+#define BSLS_MACROINCREMENTED_VALUE6755 6756
+#define BSLS_MACROINCREMENTED_VALUE6756 6757
+#define BSLS_MACROINCREMENTED_VALUE6757 6758
+#define BSLS_MACROINCREMENTED_VALUE6758 6759
+#define BSLS_MACROINCREMENTED_VALUE6759 6760
+#define BSLS_MACROINCREMENTED_VALUE6760 6761
+#define BSLS_MACROINCREMENTED_VALUE6761 6762
+#define BSLS_MACROINCREMENTED_VALUE6762 6763
+#define BSLS_MACROINCREMENTED_VALUE6763 6764
+#define BSLS_MACROINCREMENTED_VALUE6764 6765
+#define BSLS_MACROINCREMENTED_VALUE6765 6766
+#define BSLS_MACROINCREMENTED_VALUE6766 6767
+#define BSLS_MACROINCREMENTED_VALUE6767 6768
+#define BSLS_MACROINCREMENTED_VALUE6768 6769
+#define BSLS_MACROINCREMENTED_VALUE6769 6770
+#define BSLS_MACROINCREMENTED_VALUE6770 6771
+#define BSLS_MACROINCREMENTED_VALUE6771 6772
+#define BSLS_MACROINCREMENTED_VALUE6772 6773
+#define BSLS_MACROINCREMENTED_VALUE6773 6774
+#define BSLS_MACROINCREMENTED_VALUE6774 6775
+#define BSLS_MACROINCREMENTED_VALUE6775 6776
+#define BSLS_MACROINCREMENTED_VALUE6776 6777
+#define BSLS_MACROINCREMENTED_VALUE6777 6778
+#define BSLS_MACROINCREMENTED_VALUE6778 6779
+#define BSLS_MACROINCREMENTED_VALUE6779 6780
+#define BSLS_MACROINCREMENTED_VALUE6780 6781
+#define BSLS_MACROINCREMENTED_VALUE6781 6782
+#define BSLS_MACROINCREMENTED_VALUE6782 6783
+#define BSLS_MACROINCREMENTED_VALUE6783 6784
+#define BSLS_MACROINCREMENTED_VALUE6784 6785
+#define BSLS_MACROINCREMENTED_VALUE6785 6786
+#define BSLS_MACROINCREMENTED_VALUE6786 6787
+#define BSLS_MACROINCREMENTED_VALUE6787 6788
+#define BSLS_MACROINCREMENTED_VALUE6788 6789
+#define BSLS_MACROINCREMENTED_VALUE6789 6790
+#define BSLS_MACROINCREMENTED_VALUE6790 6791
+#define BSLS_MACROINCREMENTED_VALUE6791 6792
+#define BSLS_MACROINCREMENTED_VALUE6792 6793
+#define BSLS_MACROINCREMENTED_VALUE6793 6794
+#define BSLS_MACROINCREMENTED_VALUE6794 6795
+#define BSLS_MACROINCREMENTED_VALUE6795 6796
+#define BSLS_MACROINCREMENTED_VALUE6796 6797
+#define BSLS_MACROINCREMENTED_VALUE6797 6798
+#define BSLS_MACROINCREMENTED_VALUE6798 6799
+#define BSLS_MACROINCREMENTED_VALUE6799 6800
+#define BSLS_MACROINCREMENTED_VALUE6800 6801
+#define BSLS_MACROINCREMENTED_VALUE6801 6802
+#define BSLS_MACROINCREMENTED_VALUE6802 6803
+#define BSLS_MACROINCREMENTED_VALUE6803 6804
+#define BSLS_MACROINCREMENTED_VALUE6804 6805
+#define BSLS_MACROINCREMENTED_VALUE6805 6806
+#define BSLS_MACROINCREMENTED_VALUE6806 6807
+#define BSLS_MACROINCREMENTED_VALUE6807 6808
+#define BSLS_MACROINCREMENTED_VALUE6808 6809
+#define BSLS_MACROINCREMENTED_VALUE6809 6810
+#define BSLS_MACROINCREMENTED_VALUE6810 6811
+#define BSLS_MACROINCREMENTED_VALUE6811 6812
+#define BSLS_MACROINCREMENTED_VALUE6812 6813
+#define BSLS_MACROINCREMENTED_VALUE6813 6814
+#define BSLS_MACROINCREMENTED_VALUE6814 6815
+#define BSLS_MACROINCREMENTED_VALUE6815 6816
+#define BSLS_MACROINCREMENTED_VALUE6816 6817
+#define BSLS_MACROINCREMENTED_VALUE6817 6818
+#define BSLS_MACROINCREMENTED_VALUE6818 6819
+#define BSLS_MACROINCREMENTED_VALUE6819 6820
+#define BSLS_MACROINCREMENTED_VALUE6820 6821
+#define BSLS_MACROINCREMENTED_VALUE6821 6822
+#define BSLS_MACROINCREMENTED_VALUE6822 6823
+#define BSLS_MACROINCREMENTED_VALUE6823 6824
+#define BSLS_MACROINCREMENTED_VALUE6824 6825
+#define BSLS_MACROINCREMENTED_VALUE6825 6826
+#define BSLS_MACROINCREMENTED_VALUE6826 6827
+#define BSLS_MACROINCREMENTED_VALUE6827 6828
+#define BSLS_MACROINCREMENTED_VALUE6828 6829
+#define BSLS_MACROINCREMENTED_VALUE6829 6830
+#define BSLS_MACROINCREMENTED_VALUE6830 6831
+#define BSLS_MACROINCREMENTED_VALUE6831 6832
+#define BSLS_MACROINCREMENTED_VALUE6832 6833
+#define BSLS_MACROINCREMENTED_VALUE6833 6834
+#define BSLS_MACROINCREMENTED_VALUE6834 6835
+#define BSLS_MACROINCREMENTED_VALUE6835 6836
+#define BSLS_MACROINCREMENTED_VALUE6836 6837
+#define BSLS_MACROINCREMENTED_VALUE6837 6838
+#define BSLS_MACROINCREMENTED_VALUE6838 6839
+#define BSLS_MACROINCREMENTED_VALUE6839 6840
+#define BSLS_MACROINCREMENTED_VALUE6840 6841
+#define BSLS_MACROINCREMENTED_VALUE6841 6842
+#define BSLS_MACROINCREMENTED_VALUE6842 6843
+#define BSLS_MACROINCREMENTED_VALUE6843 6844
+#define BSLS_MACROINCREMENTED_VALUE6844 6845
+#define BSLS_MACROINCREMENTED_VALUE6845 6846
+#define BSLS_MACROINCREMENTED_VALUE6846 6847
+#define BSLS_MACROINCREMENTED_VALUE6847 6848
+#define BSLS_MACROINCREMENTED_VALUE6848 6849
+#define BSLS_MACROINCREMENTED_VALUE6849 6850
+#define BSLS_MACROINCREMENTED_VALUE6850 6851
+#define BSLS_MACROINCREMENTED_VALUE6851 6852
+#define BSLS_MACROINCREMENTED_VALUE6852 6853
+#define BSLS_MACROINCREMENTED_VALUE6853 6854
+#define BSLS_MACROINCREMENTED_VALUE6854 6855
+#define BSLS_MACROINCREMENTED_VALUE6855 6856
+#define BSLS_MACROINCREMENTED_VALUE6856 6857
+#define BSLS_MACROINCREMENTED_VALUE6857 6858
+#define BSLS_MACROINCREMENTED_VALUE6858 6859
+#define BSLS_MACROINCREMENTED_VALUE6859 6860
+#define BSLS_MACROINCREMENTED_VALUE6860 6861
+#define BSLS_MACROINCREMENTED_VALUE6861 6862
+#define BSLS_MACROINCREMENTED_VALUE6862 6863
+#define BSLS_MACROINCREMENTED_VALUE6863 6864
+#define BSLS_MACROINCREMENTED_VALUE6864 6865
+#define BSLS_MACROINCREMENTED_VALUE6865 6866
+#define BSLS_MACROINCREMENTED_VALUE6866 6867
+#define BSLS_MACROINCREMENTED_VALUE6867 6868
+#define BSLS_MACROINCREMENTED_VALUE6868 6869
+#define BSLS_MACROINCREMENTED_VALUE6869 6870
+#define BSLS_MACROINCREMENTED_VALUE6870 6871
+#define BSLS_MACROINCREMENTED_VALUE6871 6872
+#define BSLS_MACROINCREMENTED_VALUE6872 6873
+#define BSLS_MACROINCREMENTED_VALUE6873 6874
+#define BSLS_MACROINCREMENTED_VALUE6874 6875
+#define BSLS_MACROINCREMENTED_VALUE6875 6876
+#define BSLS_MACROINCREMENTED_VALUE6876 6877
+#define BSLS_MACROINCREMENTED_VALUE6877 6878
+#define BSLS_MACROINCREMENTED_VALUE6878 6879
+#define BSLS_MACROINCREMENTED_VALUE6879 6880
+#define BSLS_MACROINCREMENTED_VALUE6880 6881
+#define BSLS_MACROINCREMENTED_VALUE6881 6882
+#define BSLS_MACROINCREMENTED_VALUE6882 6883
+#define BSLS_MACROINCREMENTED_VALUE6883 6884
+#define BSLS_MACROINCREMENTED_VALUE6884 6885
+#define BSLS_MACROINCREMENTED_VALUE6885 6886
+#define BSLS_MACROINCREMENTED_VALUE6886 6887
+#define BSLS_MACROINCREMENTED_VALUE6887 6888
+#define BSLS_MACROINCREMENTED_VALUE6888 6889
+#define BSLS_MACROINCREMENTED_VALUE6889 6890
+#define BSLS_MACROINCREMENTED_VALUE6890 6891
+#define BSLS_MACROINCREMENTED_VALUE6891 6892
+#define BSLS_MACROINCREMENTED_VALUE6892 6893
+#define BSLS_MACROINCREMENTED_VALUE6893 6894
+#define BSLS_MACROINCREMENTED_VALUE6894 6895
+#define BSLS_MACROINCREMENTED_VALUE6895 6896
+#define BSLS_MACROINCREMENTED_VALUE6896 6897
+#define BSLS_MACROINCREMENTED_VALUE6897 6898
+#define BSLS_MACROINCREMENTED_VALUE6898 6899
+#define BSLS_MACROINCREMENTED_VALUE6899 6900
+#define BSLS_MACROINCREMENTED_VALUE6900 6901
+#define BSLS_MACROINCREMENTED_VALUE6901 6902
+#define BSLS_MACROINCREMENTED_VALUE6902 6903
+#define BSLS_MACROINCREMENTED_VALUE6903 6904
+#define BSLS_MACROINCREMENTED_VALUE6904 6905
+#define BSLS_MACROINCREMENTED_VALUE6905 6906
+#define BSLS_MACROINCREMENTED_VALUE6906 6907
+#define BSLS_MACROINCREMENTED_VALUE6907 6908
+#define BSLS_MACROINCREMENTED_VALUE6908 6909
+#define BSLS_MACROINCREMENTED_VALUE6909 6910
+#define BSLS_MACROINCREMENTED_VALUE6910 6911
+#define BSLS_MACROINCREMENTED_VALUE6911 6912
+#define BSLS_MACROINCREMENTED_VALUE6912 6913
+#define BSLS_MACROINCREMENTED_VALUE6913 6914
+#define BSLS_MACROINCREMENTED_VALUE6914 6915
+#define BSLS_MACROINCREMENTED_VALUE6915 6916
+#define BSLS_MACROINCREMENTED_VALUE6916 6917
+#define BSLS_MACROINCREMENTED_VALUE6917 6918
+#define BSLS_MACROINCREMENTED_VALUE6918 6919
+#define BSLS_MACROINCREMENTED_VALUE6919 6920
+#define BSLS_MACROINCREMENTED_VALUE6920 6921
+#define BSLS_MACROINCREMENTED_VALUE6921 6922
+#define BSLS_MACROINCREMENTED_VALUE6922 6923
+#define BSLS_MACROINCREMENTED_VALUE6923 6924
+#define BSLS_MACROINCREMENTED_VALUE6924 6925
+#define BSLS_MACROINCREMENTED_VALUE6925 6926
+#define BSLS_MACROINCREMENTED_VALUE6926 6927
+#define BSLS_MACROINCREMENTED_VALUE6927 6928
+#define BSLS_MACROINCREMENTED_VALUE6928 6929
+#define BSLS_MACROINCREMENTED_VALUE6929 6930
+#define BSLS_MACROINCREMENTED_VALUE6930 6931
+#define BSLS_MACROINCREMENTED_VALUE6931 6932
+#define BSLS_MACROINCREMENTED_VALUE6932 6933
+#define BSLS_MACROINCREMENTED_VALUE6933 6934
+#define BSLS_MACROINCREMENTED_VALUE6934 6935
+#define BSLS_MACROINCREMENTED_VALUE6935 6936
+#define BSLS_MACROINCREMENTED_VALUE6936 6937
+#define BSLS_MACROINCREMENTED_VALUE6937 6938
+#define BSLS_MACROINCREMENTED_VALUE6938 6939
+#define BSLS_MACROINCREMENTED_VALUE6939 6940
+#define BSLS_MACROINCREMENTED_VALUE6940 6941
+#define BSLS_MACROINCREMENTED_VALUE6941 6942
+#define BSLS_MACROINCREMENTED_VALUE6942 6943
+#define BSLS_MACROINCREMENTED_VALUE6943 6944
+#define BSLS_MACROINCREMENTED_VALUE6944 6945
+#define BSLS_MACROINCREMENTED_VALUE6945 6946
+#define BSLS_MACROINCREMENTED_VALUE6946 6947
+#define BSLS_MACROINCREMENTED_VALUE6947 6948
+#define BSLS_MACROINCREMENTED_VALUE6948 6949
+#define BSLS_MACROINCREMENTED_VALUE6949 6950
+#define BSLS_MACROINCREMENTED_VALUE6950 6951
+#define BSLS_MACROINCREMENTED_VALUE6951 6952
+#define BSLS_MACROINCREMENTED_VALUE6952 6953
+#define BSLS_MACROINCREMENTED_VALUE6953 6954
+#define BSLS_MACROINCREMENTED_VALUE6954 6955
+#define BSLS_MACROINCREMENTED_VALUE6955 6956
+#define BSLS_MACROINCREMENTED_VALUE6956 6957
+#define BSLS_MACROINCREMENTED_VALUE6957 6958
+#define BSLS_MACROINCREMENTED_VALUE6958 6959
+#define BSLS_MACROINCREMENTED_VALUE6959 6960
+#define BSLS_MACROINCREMENTED_VALUE6960 6961
+#define BSLS_MACROINCREMENTED_VALUE6961 6962
+#define BSLS_MACROINCREMENTED_VALUE6962 6963
+#define BSLS_MACROINCREMENTED_VALUE6963 6964
+#define BSLS_MACROINCREMENTED_VALUE6964 6965
+#define BSLS_MACROINCREMENTED_VALUE6965 6966
+#define BSLS_MACROINCREMENTED_VALUE6966 6967
+#define BSLS_MACROINCREMENTED_VALUE6967 6968
+#define BSLS_MACROINCREMENTED_VALUE6968 6969
+#define BSLS_MACROINCREMENTED_VALUE6969 6970
+#define BSLS_MACROINCREMENTED_VALUE6970 6971
+#define BSLS_MACROINCREMENTED_VALUE6971 6972
+#define BSLS_MACROINCREMENTED_VALUE6972 6973
+#define BSLS_MACROINCREMENTED_VALUE6973 6974
+#define BSLS_MACROINCREMENTED_VALUE6974 6975
+#define BSLS_MACROINCREMENTED_VALUE6975 6976
+#define BSLS_MACROINCREMENTED_VALUE6976 6977
+#define BSLS_MACROINCREMENTED_VALUE6977 6978
+#define BSLS_MACROINCREMENTED_VALUE6978 6979
+#define BSLS_MACROINCREMENTED_VALUE6979 6980
+#define BSLS_MACROINCREMENTED_VALUE6980 6981
+#define BSLS_MACROINCREMENTED_VALUE6981 6982
+#define BSLS_MACROINCREMENTED_VALUE6982 6983
+#define BSLS_MACROINCREMENTED_VALUE6983 6984
+#define BSLS_MACROINCREMENTED_VALUE6984 6985
+#define BSLS_MACROINCREMENTED_VALUE6985 6986
+#define BSLS_MACROINCREMENTED_VALUE6986 6987
+#define BSLS_MACROINCREMENTED_VALUE6987 6988
+#define BSLS_MACROINCREMENTED_VALUE6988 6989
+#define BSLS_MACROINCREMENTED_VALUE6989 6990
+#define BSLS_MACROINCREMENTED_VALUE6990 6991
+#define BSLS_MACROINCREMENTED_VALUE6991 6992
+#define BSLS_MACROINCREMENTED_VALUE6992 6993
+#define BSLS_MACROINCREMENTED_VALUE6993 6994
+#define BSLS_MACROINCREMENTED_VALUE6994 6995
+#define BSLS_MACROINCREMENTED_VALUE6995 6996
+#define BSLS_MACROINCREMENTED_VALUE6996 6997
+#define BSLS_MACROINCREMENTED_VALUE6997 6998
+#define BSLS_MACROINCREMENTED_VALUE6998 6999
+#define BSLS_MACROINCREMENTED_VALUE6999 7000
+#define BSLS_MACROINCREMENTED_VALUE7000 7001
+#define BSLS_MACROINCREMENTED_VALUE7001 7002
+#define BSLS_MACROINCREMENTED_VALUE7002 7003
+#define BSLS_MACROINCREMENTED_VALUE7003 7004
+#define BSLS_MACROINCREMENTED_VALUE7004 7005
+#define BSLS_MACROINCREMENTED_VALUE7005 7006
+#define BSLS_MACROINCREMENTED_VALUE7006 7007
+#define BSLS_MACROINCREMENTED_VALUE7007 7008
+#define BSLS_MACROINCREMENTED_VALUE7008 7009
+#define BSLS_MACROINCREMENTED_VALUE7009 7010
+#define BSLS_MACROINCREMENTED_VALUE7010 7011
+#define BSLS_MACROINCREMENTED_VALUE7011 7012
+#define BSLS_MACROINCREMENTED_VALUE7012 7013
+#define BSLS_MACROINCREMENTED_VALUE7013 7014
+#define BSLS_MACROINCREMENTED_VALUE7014 7015
+#define BSLS_MACROINCREMENTED_VALUE7015 7016
+#define BSLS_MACROINCREMENTED_VALUE7016 7017
+#define BSLS_MACROINCREMENTED_VALUE7017 7018
+#define BSLS_MACROINCREMENTED_VALUE7018 7019
+#define BSLS_MACROINCREMENTED_VALUE7019 7020
+#define BSLS_MACROINCREMENTED_VALUE7020 7021
+#define BSLS_MACROINCREMENTED_VALUE7021 7022
+#define BSLS_MACROINCREMENTED_VALUE7022 7023
+#define BSLS_MACROINCREMENTED_VALUE7023 7024
+#define BSLS_MACROINCREMENTED_VALUE7024 7025
+#define BSLS_MACROINCREMENTED_VALUE7025 7026
+#define BSLS_MACROINCREMENTED_VALUE7026 7027
+#define BSLS_MACROINCREMENTED_VALUE7027 7028
+#define BSLS_MACROINCREMENTED_VALUE7028 7029
+#define BSLS_MACROINCREMENTED_VALUE7029 7030
+#define BSLS_MACROINCREMENTED_VALUE7030 7031
+#define BSLS_MACROINCREMENTED_VALUE7031 7032
+#define BSLS_MACROINCREMENTED_VALUE7032 7033
+#define BSLS_MACROINCREMENTED_VALUE7033 7034
+#define BSLS_MACROINCREMENTED_VALUE7034 7035
+#define BSLS_MACROINCREMENTED_VALUE7035 7036
+#define BSLS_MACROINCREMENTED_VALUE7036 7037
+#define BSLS_MACROINCREMENTED_VALUE7037 7038
+#define BSLS_MACROINCREMENTED_VALUE7038 7039
+#define BSLS_MACROINCREMENTED_VALUE7039 7040
+#define BSLS_MACROINCREMENTED_VALUE7040 7041
+#define BSLS_MACROINCREMENTED_VALUE7041 7042
+#define BSLS_MACROINCREMENTED_VALUE7042 7043
+#define BSLS_MACROINCREMENTED_VALUE7043 7044
+#define BSLS_MACROINCREMENTED_VALUE7044 7045
+#define BSLS_MACROINCREMENTED_VALUE7045 7046
+#define BSLS_MACROINCREMENTED_VALUE7046 7047
+#define BSLS_MACROINCREMENTED_VALUE7047 7048
+#define BSLS_MACROINCREMENTED_VALUE7048 7049
+#define BSLS_MACROINCREMENTED_VALUE7049 7050
+#define BSLS_MACROINCREMENTED_VALUE7050 7051
+#define BSLS_MACROINCREMENTED_VALUE7051 7052
+#define BSLS_MACROINCREMENTED_VALUE7052 7053
+#define BSLS_MACROINCREMENTED_VALUE7053 7054
+#define BSLS_MACROINCREMENTED_VALUE7054 7055
+#define BSLS_MACROINCREMENTED_VALUE7055 7056
+#define BSLS_MACROINCREMENTED_VALUE7056 7057
+#define BSLS_MACROINCREMENTED_VALUE7057 7058
+#define BSLS_MACROINCREMENTED_VALUE7058 7059
+#define BSLS_MACROINCREMENTED_VALUE7059 7060
+#define BSLS_MACROINCREMENTED_VALUE7060 7061
+#define BSLS_MACROINCREMENTED_VALUE7061 7062
+#define BSLS_MACROINCREMENTED_VALUE7062 7063
+#define BSLS_MACROINCREMENTED_VALUE7063 7064
+#define BSLS_MACROINCREMENTED_VALUE7064 7065
+#define BSLS_MACROINCREMENTED_VALUE7065 7066
+#define BSLS_MACROINCREMENTED_VALUE7066 7067
+#define BSLS_MACROINCREMENTED_VALUE7067 7068
+#define BSLS_MACROINCREMENTED_VALUE7068 7069
+#define BSLS_MACROINCREMENTED_VALUE7069 7070
+#define BSLS_MACROINCREMENTED_VALUE7070 7071
+#define BSLS_MACROINCREMENTED_VALUE7071 7072
+#define BSLS_MACROINCREMENTED_VALUE7072 7073
+#define BSLS_MACROINCREMENTED_VALUE7073 7074
+#define BSLS_MACROINCREMENTED_VALUE7074 7075
+#define BSLS_MACROINCREMENTED_VALUE7075 7076
+#define BSLS_MACROINCREMENTED_VALUE7076 7077
+#define BSLS_MACROINCREMENTED_VALUE7077 7078
+#define BSLS_MACROINCREMENTED_VALUE7078 7079
+#define BSLS_MACROINCREMENTED_VALUE7079 7080
+#define BSLS_MACROINCREMENTED_VALUE7080 7081
+#define BSLS_MACROINCREMENTED_VALUE7081 7082
+#define BSLS_MACROINCREMENTED_VALUE7082 7083
+#define BSLS_MACROINCREMENTED_VALUE7083 7084
+#define BSLS_MACROINCREMENTED_VALUE7084 7085
+#define BSLS_MACROINCREMENTED_VALUE7085 7086
+#define BSLS_MACROINCREMENTED_VALUE7086 7087
+#define BSLS_MACROINCREMENTED_VALUE7087 7088
+#define BSLS_MACROINCREMENTED_VALUE7088 7089
+#define BSLS_MACROINCREMENTED_VALUE7089 7090
+#define BSLS_MACROINCREMENTED_VALUE7090 7091
+#define BSLS_MACROINCREMENTED_VALUE7091 7092
+#define BSLS_MACROINCREMENTED_VALUE7092 7093
+#define BSLS_MACROINCREMENTED_VALUE7093 7094
+#define BSLS_MACROINCREMENTED_VALUE7094 7095
+#define BSLS_MACROINCREMENTED_VALUE7095 7096
+#define BSLS_MACROINCREMENTED_VALUE7096 7097
+#define BSLS_MACROINCREMENTED_VALUE7097 7098
+#define BSLS_MACROINCREMENTED_VALUE7098 7099
+#define BSLS_MACROINCREMENTED_VALUE7099 7100
+#define BSLS_MACROINCREMENTED_VALUE7100 7101
+#define BSLS_MACROINCREMENTED_VALUE7101 7102
+#define BSLS_MACROINCREMENTED_VALUE7102 7103
+#define BSLS_MACROINCREMENTED_VALUE7103 7104
+#define BSLS_MACROINCREMENTED_VALUE7104 7105
+#define BSLS_MACROINCREMENTED_VALUE7105 7106
+#define BSLS_MACROINCREMENTED_VALUE7106 7107
+#define BSLS_MACROINCREMENTED_VALUE7107 7108
+#define BSLS_MACROINCREMENTED_VALUE7108 7109
+#define BSLS_MACROINCREMENTED_VALUE7109 7110
+#define BSLS_MACROINCREMENTED_VALUE7110 7111
+#define BSLS_MACROINCREMENTED_VALUE7111 7112
+#define BSLS_MACROINCREMENTED_VALUE7112 7113
+#define BSLS_MACROINCREMENTED_VALUE7113 7114
+#define BSLS_MACROINCREMENTED_VALUE7114 7115
+#define BSLS_MACROINCREMENTED_VALUE7115 7116
+#define BSLS_MACROINCREMENTED_VALUE7116 7117
+#define BSLS_MACROINCREMENTED_VALUE7117 7118
+#define BSLS_MACROINCREMENTED_VALUE7118 7119
+#define BSLS_MACROINCREMENTED_VALUE7119 7120
+#define BSLS_MACROINCREMENTED_VALUE7120 7121
+#define BSLS_MACROINCREMENTED_VALUE7121 7122
+#define BSLS_MACROINCREMENTED_VALUE7122 7123
+#define BSLS_MACROINCREMENTED_VALUE7123 7124
+#define BSLS_MACROINCREMENTED_VALUE7124 7125
+#define BSLS_MACROINCREMENTED_VALUE7125 7126
+#define BSLS_MACROINCREMENTED_VALUE7126 7127
+#define BSLS_MACROINCREMENTED_VALUE7127 7128
+#define BSLS_MACROINCREMENTED_VALUE7128 7129
+#define BSLS_MACROINCREMENTED_VALUE7129 7130
+#define BSLS_MACROINCREMENTED_VALUE7130 7131
+#define BSLS_MACROINCREMENTED_VALUE7131 7132
+#define BSLS_MACROINCREMENTED_VALUE7132 7133
+#define BSLS_MACROINCREMENTED_VALUE7133 7134
+#define BSLS_MACROINCREMENTED_VALUE7134 7135
+#define BSLS_MACROINCREMENTED_VALUE7135 7136
+#define BSLS_MACROINCREMENTED_VALUE7136 7137
+#define BSLS_MACROINCREMENTED_VALUE7137 7138
+#define BSLS_MACROINCREMENTED_VALUE7138 7139
+#define BSLS_MACROINCREMENTED_VALUE7139 7140
+#define BSLS_MACROINCREMENTED_VALUE7140 7141
+#define BSLS_MACROINCREMENTED_VALUE7141 7142
+#define BSLS_MACROINCREMENTED_VALUE7142 7143
+#define BSLS_MACROINCREMENTED_VALUE7143 7144
+#define BSLS_MACROINCREMENTED_VALUE7144 7145
+#define BSLS_MACROINCREMENTED_VALUE7145 7146
+#define BSLS_MACROINCREMENTED_VALUE7146 7147
+#define BSLS_MACROINCREMENTED_VALUE7147 7148
+#define BSLS_MACROINCREMENTED_VALUE7148 7149
+#define BSLS_MACROINCREMENTED_VALUE7149 7150
+#define BSLS_MACROINCREMENTED_VALUE7150 7151
+#define BSLS_MACROINCREMENTED_VALUE7151 7152
+#define BSLS_MACROINCREMENTED_VALUE7152 7153
+#define BSLS_MACROINCREMENTED_VALUE7153 7154
+#define BSLS_MACROINCREMENTED_VALUE7154 7155
+#define BSLS_MACROINCREMENTED_VALUE7155 7156
+#define BSLS_MACROINCREMENTED_VALUE7156 7157
+#define BSLS_MACROINCREMENTED_VALUE7157 7158
+#define BSLS_MACROINCREMENTED_VALUE7158 7159
+#define BSLS_MACROINCREMENTED_VALUE7159 7160
+#define BSLS_MACROINCREMENTED_VALUE7160 7161
+#define BSLS_MACROINCREMENTED_VALUE7161 7162
+#define BSLS_MACROINCREMENTED_VALUE7162 7163
+#define BSLS_MACROINCREMENTED_VALUE7163 7164
+#define BSLS_MACROINCREMENTED_VALUE7164 7165
+#define BSLS_MACROINCREMENTED_VALUE7165 7166
+#define BSLS_MACROINCREMENTED_VALUE7166 7167
+#define BSLS_MACROINCREMENTED_VALUE7167 7168
+#define BSLS_MACROINCREMENTED_VALUE7168 7169
+#define BSLS_MACROINCREMENTED_VALUE7169 7170
+#define BSLS_MACROINCREMENTED_VALUE7170 7171
+#define BSLS_MACROINCREMENTED_VALUE7171 7172
+#define BSLS_MACROINCREMENTED_VALUE7172 7173
+#define BSLS_MACROINCREMENTED_VALUE7173 7174
+#define BSLS_MACROINCREMENTED_VALUE7174 7175
+#define BSLS_MACROINCREMENTED_VALUE7175 7176
+#define BSLS_MACROINCREMENTED_VALUE7176 7177
+#define BSLS_MACROINCREMENTED_VALUE7177 7178
+#define BSLS_MACROINCREMENTED_VALUE7178 7179
+#define BSLS_MACROINCREMENTED_VALUE7179 7180
+#define BSLS_MACROINCREMENTED_VALUE7180 7181
+#define BSLS_MACROINCREMENTED_VALUE7181 7182
+#define BSLS_MACROINCREMENTED_VALUE7182 7183
+#define BSLS_MACROINCREMENTED_VALUE7183 7184
+#define BSLS_MACROINCREMENTED_VALUE7184 7185
+#define BSLS_MACROINCREMENTED_VALUE7185 7186
+#define BSLS_MACROINCREMENTED_VALUE7186 7187
+#define BSLS_MACROINCREMENTED_VALUE7187 7188
+#define BSLS_MACROINCREMENTED_VALUE7188 7189
+#define BSLS_MACROINCREMENTED_VALUE7189 7190
+#define BSLS_MACROINCREMENTED_VALUE7190 7191
+#define BSLS_MACROINCREMENTED_VALUE7191 7192
+#define BSLS_MACROINCREMENTED_VALUE7192 7193
+#define BSLS_MACROINCREMENTED_VALUE7193 7194
+#define BSLS_MACROINCREMENTED_VALUE7194 7195
+#define BSLS_MACROINCREMENTED_VALUE7195 7196
+#define BSLS_MACROINCREMENTED_VALUE7196 7197
+#define BSLS_MACROINCREMENTED_VALUE7197 7198
+#define BSLS_MACROINCREMENTED_VALUE7198 7199
+#define BSLS_MACROINCREMENTED_VALUE7199 7200
+#define BSLS_MACROINCREMENTED_VALUE7200 7201
+#define BSLS_MACROINCREMENTED_VALUE7201 7202
+#define BSLS_MACROINCREMENTED_VALUE7202 7203
+#define BSLS_MACROINCREMENTED_VALUE7203 7204
+#define BSLS_MACROINCREMENTED_VALUE7204 7205
+#define BSLS_MACROINCREMENTED_VALUE7205 7206
+#define BSLS_MACROINCREMENTED_VALUE7206 7207
+#define BSLS_MACROINCREMENTED_VALUE7207 7208
+#define BSLS_MACROINCREMENTED_VALUE7208 7209
+#define BSLS_MACROINCREMENTED_VALUE7209 7210
+#define BSLS_MACROINCREMENTED_VALUE7210 7211
+#define BSLS_MACROINCREMENTED_VALUE7211 7212
+#define BSLS_MACROINCREMENTED_VALUE7212 7213
+#define BSLS_MACROINCREMENTED_VALUE7213 7214
+#define BSLS_MACROINCREMENTED_VALUE7214 7215
+#define BSLS_MACROINCREMENTED_VALUE7215 7216
+#define BSLS_MACROINCREMENTED_VALUE7216 7217
+#define BSLS_MACROINCREMENTED_VALUE7217 7218
+#define BSLS_MACROINCREMENTED_VALUE7218 7219
+#define BSLS_MACROINCREMENTED_VALUE7219 7220
+#define BSLS_MACROINCREMENTED_VALUE7220 7221
+#define BSLS_MACROINCREMENTED_VALUE7221 7222
+#define BSLS_MACROINCREMENTED_VALUE7222 7223
+#define BSLS_MACROINCREMENTED_VALUE7223 7224
+#define BSLS_MACROINCREMENTED_VALUE7224 7225
+#define BSLS_MACROINCREMENTED_VALUE7225 7226
+#define BSLS_MACROINCREMENTED_VALUE7226 7227
+#define BSLS_MACROINCREMENTED_VALUE7227 7228
+#define BSLS_MACROINCREMENTED_VALUE7228 7229
+#define BSLS_MACROINCREMENTED_VALUE7229 7230
+#define BSLS_MACROINCREMENTED_VALUE7230 7231
+#define BSLS_MACROINCREMENTED_VALUE7231 7232
+#define BSLS_MACROINCREMENTED_VALUE7232 7233
+#define BSLS_MACROINCREMENTED_VALUE7233 7234
+#define BSLS_MACROINCREMENTED_VALUE7234 7235
+#define BSLS_MACROINCREMENTED_VALUE7235 7236
+#define BSLS_MACROINCREMENTED_VALUE7236 7237
+#define BSLS_MACROINCREMENTED_VALUE7237 7238
+#define BSLS_MACROINCREMENTED_VALUE7238 7239
+#define BSLS_MACROINCREMENTED_VALUE7239 7240
+#define BSLS_MACROINCREMENTED_VALUE7240 7241
+#define BSLS_MACROINCREMENTED_VALUE7241 7242
+#define BSLS_MACROINCREMENTED_VALUE7242 7243
+#define BSLS_MACROINCREMENTED_VALUE7243 7244
+#define BSLS_MACROINCREMENTED_VALUE7244 7245
+#define BSLS_MACROINCREMENTED_VALUE7245 7246
+#define BSLS_MACROINCREMENTED_VALUE7246 7247
+#define BSLS_MACROINCREMENTED_VALUE7247 7248
+#define BSLS_MACROINCREMENTED_VALUE7248 7249
+#define BSLS_MACROINCREMENTED_VALUE7249 7250
+#define BSLS_MACROINCREMENTED_VALUE7250 7251
+#define BSLS_MACROINCREMENTED_VALUE7251 7252
+#define BSLS_MACROINCREMENTED_VALUE7252 7253
+#define BSLS_MACROINCREMENTED_VALUE7253 7254
+#define BSLS_MACROINCREMENTED_VALUE7254 7255
+#define BSLS_MACROINCREMENTED_VALUE7255 7256
+#define BSLS_MACROINCREMENTED_VALUE7256 7257
+#define BSLS_MACROINCREMENTED_VALUE7257 7258
+#define BSLS_MACROINCREMENTED_VALUE7258 7259
+#define BSLS_MACROINCREMENTED_VALUE7259 7260
+#define BSLS_MACROINCREMENTED_VALUE7260 7261
+#define BSLS_MACROINCREMENTED_VALUE7261 7262
+#define BSLS_MACROINCREMENTED_VALUE7262 7263
+#define BSLS_MACROINCREMENTED_VALUE7263 7264
+#define BSLS_MACROINCREMENTED_VALUE7264 7265
+#define BSLS_MACROINCREMENTED_VALUE7265 7266
+#define BSLS_MACROINCREMENTED_VALUE7266 7267
+#define BSLS_MACROINCREMENTED_VALUE7267 7268
+#define BSLS_MACROINCREMENTED_VALUE7268 7269
+#define BSLS_MACROINCREMENTED_VALUE7269 7270
+#define BSLS_MACROINCREMENTED_VALUE7270 7271
+#define BSLS_MACROINCREMENTED_VALUE7271 7272
+#define BSLS_MACROINCREMENTED_VALUE7272 7273
+#define BSLS_MACROINCREMENTED_VALUE7273 7274
+#define BSLS_MACROINCREMENTED_VALUE7274 7275
+#define BSLS_MACROINCREMENTED_VALUE7275 7276
+#define BSLS_MACROINCREMENTED_VALUE7276 7277
+#define BSLS_MACROINCREMENTED_VALUE7277 7278
+#define BSLS_MACROINCREMENTED_VALUE7278 7279
+#define BSLS_MACROINCREMENTED_VALUE7279 7280
+#define BSLS_MACROINCREMENTED_VALUE7280 7281
+#define BSLS_MACROINCREMENTED_VALUE7281 7282
+#define BSLS_MACROINCREMENTED_VALUE7282 7283
+#define BSLS_MACROINCREMENTED_VALUE7283 7284
+#define BSLS_MACROINCREMENTED_VALUE7284 7285
+#define BSLS_MACROINCREMENTED_VALUE7285 7286
+#define BSLS_MACROINCREMENTED_VALUE7286 7287
+#define BSLS_MACROINCREMENTED_VALUE7287 7288
+#define BSLS_MACROINCREMENTED_VALUE7288 7289
+#define BSLS_MACROINCREMENTED_VALUE7289 7290
+#define BSLS_MACROINCREMENTED_VALUE7290 7291
+#define BSLS_MACROINCREMENTED_VALUE7291 7292
+#define BSLS_MACROINCREMENTED_VALUE7292 7293
+#define BSLS_MACROINCREMENTED_VALUE7293 7294
+#define BSLS_MACROINCREMENTED_VALUE7294 7295
+#define BSLS_MACROINCREMENTED_VALUE7295 7296
+#define BSLS_MACROINCREMENTED_VALUE7296 7297
+#define BSLS_MACROINCREMENTED_VALUE7297 7298
+#define BSLS_MACROINCREMENTED_VALUE7298 7299
+#define BSLS_MACROINCREMENTED_VALUE7299 7300
+#define BSLS_MACROINCREMENTED_VALUE7300 7301
+#define BSLS_MACROINCREMENTED_VALUE7301 7302
+#define BSLS_MACROINCREMENTED_VALUE7302 7303
+#define BSLS_MACROINCREMENTED_VALUE7303 7304
+#define BSLS_MACROINCREMENTED_VALUE7304 7305
+#define BSLS_MACROINCREMENTED_VALUE7305 7306
+#define BSLS_MACROINCREMENTED_VALUE7306 7307
+#define BSLS_MACROINCREMENTED_VALUE7307 7308
+#define BSLS_MACROINCREMENTED_VALUE7308 7309
+#define BSLS_MACROINCREMENTED_VALUE7309 7310
+#define BSLS_MACROINCREMENTED_VALUE7310 7311
+#define BSLS_MACROINCREMENTED_VALUE7311 7312
+#define BSLS_MACROINCREMENTED_VALUE7312 7313
+#define BSLS_MACROINCREMENTED_VALUE7313 7314
+#define BSLS_MACROINCREMENTED_VALUE7314 7315
+#define BSLS_MACROINCREMENTED_VALUE7315 7316
+#define BSLS_MACROINCREMENTED_VALUE7316 7317
+#define BSLS_MACROINCREMENTED_VALUE7317 7318
+#define BSLS_MACROINCREMENTED_VALUE7318 7319
+#define BSLS_MACROINCREMENTED_VALUE7319 7320
+#define BSLS_MACROINCREMENTED_VALUE7320 7321
+#define BSLS_MACROINCREMENTED_VALUE7321 7322
+#define BSLS_MACROINCREMENTED_VALUE7322 7323
+#define BSLS_MACROINCREMENTED_VALUE7323 7324
+#define BSLS_MACROINCREMENTED_VALUE7324 7325
+#define BSLS_MACROINCREMENTED_VALUE7325 7326
+#define BSLS_MACROINCREMENTED_VALUE7326 7327
+#define BSLS_MACROINCREMENTED_VALUE7327 7328
+#define BSLS_MACROINCREMENTED_VALUE7328 7329
+#define BSLS_MACROINCREMENTED_VALUE7329 7330
+#define BSLS_MACROINCREMENTED_VALUE7330 7331
+#define BSLS_MACROINCREMENTED_VALUE7331 7332
+#define BSLS_MACROINCREMENTED_VALUE7332 7333
+#define BSLS_MACROINCREMENTED_VALUE7333 7334
+#define BSLS_MACROINCREMENTED_VALUE7334 7335
+#define BSLS_MACROINCREMENTED_VALUE7335 7336
+#define BSLS_MACROINCREMENTED_VALUE7336 7337
+#define BSLS_MACROINCREMENTED_VALUE7337 7338
+#define BSLS_MACROINCREMENTED_VALUE7338 7339
+#define BSLS_MACROINCREMENTED_VALUE7339 7340
+#define BSLS_MACROINCREMENTED_VALUE7340 7341
+#define BSLS_MACROINCREMENTED_VALUE7341 7342
+#define BSLS_MACROINCREMENTED_VALUE7342 7343
+#define BSLS_MACROINCREMENTED_VALUE7343 7344
+#define BSLS_MACROINCREMENTED_VALUE7344 7345
+#define BSLS_MACROINCREMENTED_VALUE7345 7346
+#define BSLS_MACROINCREMENTED_VALUE7346 7347
+#define BSLS_MACROINCREMENTED_VALUE7347 7348
+#define BSLS_MACROINCREMENTED_VALUE7348 7349
+#define BSLS_MACROINCREMENTED_VALUE7349 7350
+#define BSLS_MACROINCREMENTED_VALUE7350 7351
+#define BSLS_MACROINCREMENTED_VALUE7351 7352
+#define BSLS_MACROINCREMENTED_VALUE7352 7353
+#define BSLS_MACROINCREMENTED_VALUE7353 7354
+#define BSLS_MACROINCREMENTED_VALUE7354 7355
+#define BSLS_MACROINCREMENTED_VALUE7355 7356
+#define BSLS_MACROINCREMENTED_VALUE7356 7357
+#define BSLS_MACROINCREMENTED_VALUE7357 7358
+#define BSLS_MACROINCREMENTED_VALUE7358 7359
+#define BSLS_MACROINCREMENTED_VALUE7359 7360
+#define BSLS_MACROINCREMENTED_VALUE7360 7361
+#define BSLS_MACROINCREMENTED_VALUE7361 7362
+#define BSLS_MACROINCREMENTED_VALUE7362 7363
+#define BSLS_MACROINCREMENTED_VALUE7363 7364
+#define BSLS_MACROINCREMENTED_VALUE7364 7365
+#define BSLS_MACROINCREMENTED_VALUE7365 7366
+#define BSLS_MACROINCREMENTED_VALUE7366 7367
+#define BSLS_MACROINCREMENTED_VALUE7367 7368
+#define BSLS_MACROINCREMENTED_VALUE7368 7369
+#define BSLS_MACROINCREMENTED_VALUE7369 7370
+#define BSLS_MACROINCREMENTED_VALUE7370 7371
+#define BSLS_MACROINCREMENTED_VALUE7371 7372
+#define BSLS_MACROINCREMENTED_VALUE7372 7373
+#define BSLS_MACROINCREMENTED_VALUE7373 7374
+#define BSLS_MACROINCREMENTED_VALUE7374 7375
+#define BSLS_MACROINCREMENTED_VALUE7375 7376
+#define BSLS_MACROINCREMENTED_VALUE7376 7377
+#define BSLS_MACROINCREMENTED_VALUE7377 7378
+#define BSLS_MACROINCREMENTED_VALUE7378 7379
+#define BSLS_MACROINCREMENTED_VALUE7379 7380
+#define BSLS_MACROINCREMENTED_VALUE7380 7381
+#define BSLS_MACROINCREMENTED_VALUE7381 7382
+#define BSLS_MACROINCREMENTED_VALUE7382 7383
+#define BSLS_MACROINCREMENTED_VALUE7383 7384
+#define BSLS_MACROINCREMENTED_VALUE7384 7385
+#define BSLS_MACROINCREMENTED_VALUE7385 7386
+#define BSLS_MACROINCREMENTED_VALUE7386 7387
+#define BSLS_MACROINCREMENTED_VALUE7387 7388
+#define BSLS_MACROINCREMENTED_VALUE7388 7389
+#define BSLS_MACROINCREMENTED_VALUE7389 7390
+#define BSLS_MACROINCREMENTED_VALUE7390 7391
+#define BSLS_MACROINCREMENTED_VALUE7391 7392
+#define BSLS_MACROINCREMENTED_VALUE7392 7393
+#define BSLS_MACROINCREMENTED_VALUE7393 7394
+#define BSLS_MACROINCREMENTED_VALUE7394 7395
+#define BSLS_MACROINCREMENTED_VALUE7395 7396
+#define BSLS_MACROINCREMENTED_VALUE7396 7397
+#define BSLS_MACROINCREMENTED_VALUE7397 7398
+#define BSLS_MACROINCREMENTED_VALUE7398 7399
+#define BSLS_MACROINCREMENTED_VALUE7399 7400
+#define BSLS_MACROINCREMENTED_VALUE7400 7401
+#define BSLS_MACROINCREMENTED_VALUE7401 7402
+#define BSLS_MACROINCREMENTED_VALUE7402 7403
+#define BSLS_MACROINCREMENTED_VALUE7403 7404
+#define BSLS_MACROINCREMENTED_VALUE7404 7405
+#define BSLS_MACROINCREMENTED_VALUE7405 7406
+#define BSLS_MACROINCREMENTED_VALUE7406 7407
+#define BSLS_MACROINCREMENTED_VALUE7407 7408
+#define BSLS_MACROINCREMENTED_VALUE7408 7409
+#define BSLS_MACROINCREMENTED_VALUE7409 7410
+#define BSLS_MACROINCREMENTED_VALUE7410 7411
+#define BSLS_MACROINCREMENTED_VALUE7411 7412
+#define BSLS_MACROINCREMENTED_VALUE7412 7413
+#define BSLS_MACROINCREMENTED_VALUE7413 7414
+#define BSLS_MACROINCREMENTED_VALUE7414 7415
+#define BSLS_MACROINCREMENTED_VALUE7415 7416
+#define BSLS_MACROINCREMENTED_VALUE7416 7417
+#define BSLS_MACROINCREMENTED_VALUE7417 7418
+#define BSLS_MACROINCREMENTED_VALUE7418 7419
+#define BSLS_MACROINCREMENTED_VALUE7419 7420
+#define BSLS_MACROINCREMENTED_VALUE7420 7421
+#define BSLS_MACROINCREMENTED_VALUE7421 7422
+#define BSLS_MACROINCREMENTED_VALUE7422 7423
+#define BSLS_MACROINCREMENTED_VALUE7423 7424
+#define BSLS_MACROINCREMENTED_VALUE7424 7425
+#define BSLS_MACROINCREMENTED_VALUE7425 7426
+#define BSLS_MACROINCREMENTED_VALUE7426 7427
+#define BSLS_MACROINCREMENTED_VALUE7427 7428
+#define BSLS_MACROINCREMENTED_VALUE7428 7429
+#define BSLS_MACROINCREMENTED_VALUE7429 7430
+#define BSLS_MACROINCREMENTED_VALUE7430 7431
+#define BSLS_MACROINCREMENTED_VALUE7431 7432
+#define BSLS_MACROINCREMENTED_VALUE7432 7433
+#define BSLS_MACROINCREMENTED_VALUE7433 7434
+#define BSLS_MACROINCREMENTED_VALUE7434 7435
+#define BSLS_MACROINCREMENTED_VALUE7435 7436
+#define BSLS_MACROINCREMENTED_VALUE7436 7437
+#define BSLS_MACROINCREMENTED_VALUE7437 7438
+#define BSLS_MACROINCREMENTED_VALUE7438 7439
+#define BSLS_MACROINCREMENTED_VALUE7439 7440
+#define BSLS_MACROINCREMENTED_VALUE7440 7441
+#define BSLS_MACROINCREMENTED_VALUE7441 7442
+#define BSLS_MACROINCREMENTED_VALUE7442 7443
+#define BSLS_MACROINCREMENTED_VALUE7443 7444
+#define BSLS_MACROINCREMENTED_VALUE7444 7445
+#define BSLS_MACROINCREMENTED_VALUE7445 7446
+#define BSLS_MACROINCREMENTED_VALUE7446 7447
+#define BSLS_MACROINCREMENTED_VALUE7447 7448
+#define BSLS_MACROINCREMENTED_VALUE7448 7449
+#define BSLS_MACROINCREMENTED_VALUE7449 7450
+#define BSLS_MACROINCREMENTED_VALUE7450 7451
+#define BSLS_MACROINCREMENTED_VALUE7451 7452
+#define BSLS_MACROINCREMENTED_VALUE7452 7453
+#define BSLS_MACROINCREMENTED_VALUE7453 7454
+#define BSLS_MACROINCREMENTED_VALUE7454 7455
+#define BSLS_MACROINCREMENTED_VALUE7455 7456
+#define BSLS_MACROINCREMENTED_VALUE7456 7457
+#define BSLS_MACROINCREMENTED_VALUE7457 7458
+#define BSLS_MACROINCREMENTED_VALUE7458 7459
+#define BSLS_MACROINCREMENTED_VALUE7459 7460
+#define BSLS_MACROINCREMENTED_VALUE7460 7461
+#define BSLS_MACROINCREMENTED_VALUE7461 7462
+#define BSLS_MACROINCREMENTED_VALUE7462 7463
+#define BSLS_MACROINCREMENTED_VALUE7463 7464
+#define BSLS_MACROINCREMENTED_VALUE7464 7465
+#define BSLS_MACROINCREMENTED_VALUE7465 7466
+#define BSLS_MACROINCREMENTED_VALUE7466 7467
+#define BSLS_MACROINCREMENTED_VALUE7467 7468
+#define BSLS_MACROINCREMENTED_VALUE7468 7469
+#define BSLS_MACROINCREMENTED_VALUE7469 7470
+#define BSLS_MACROINCREMENTED_VALUE7470 7471
+#define BSLS_MACROINCREMENTED_VALUE7471 7472
+#define BSLS_MACROINCREMENTED_VALUE7472 7473
+#define BSLS_MACROINCREMENTED_VALUE7473 7474
+#define BSLS_MACROINCREMENTED_VALUE7474 7475
+#define BSLS_MACROINCREMENTED_VALUE7475 7476
+#define BSLS_MACROINCREMENTED_VALUE7476 7477
+#define BSLS_MACROINCREMENTED_VALUE7477 7478
+#define BSLS_MACROINCREMENTED_VALUE7478 7479
+#define BSLS_MACROINCREMENTED_VALUE7479 7480
+#define BSLS_MACROINCREMENTED_VALUE7480 7481
+#define BSLS_MACROINCREMENTED_VALUE7481 7482
+#define BSLS_MACROINCREMENTED_VALUE7482 7483
+#define BSLS_MACROINCREMENTED_VALUE7483 7484
+#define BSLS_MACROINCREMENTED_VALUE7484 7485
+#define BSLS_MACROINCREMENTED_VALUE7485 7486
+#define BSLS_MACROINCREMENTED_VALUE7486 7487
+#define BSLS_MACROINCREMENTED_VALUE7487 7488
+#define BSLS_MACROINCREMENTED_VALUE7488 7489
+#define BSLS_MACROINCREMENTED_VALUE7489 7490
+#define BSLS_MACROINCREMENTED_VALUE7490 7491
+#define BSLS_MACROINCREMENTED_VALUE7491 7492
+#define BSLS_MACROINCREMENTED_VALUE7492 7493
+#define BSLS_MACROINCREMENTED_VALUE7493 7494
+#define BSLS_MACROINCREMENTED_VALUE7494 7495
+#define BSLS_MACROINCREMENTED_VALUE7495 7496
+#define BSLS_MACROINCREMENTED_VALUE7496 7497
+#define BSLS_MACROINCREMENTED_VALUE7497 7498
+#define BSLS_MACROINCREMENTED_VALUE7498 7499
+#define BSLS_MACROINCREMENTED_VALUE7499 7500
+#define BSLS_MACROINCREMENTED_VALUE7500 7501
+#define BSLS_MACROINCREMENTED_VALUE7501 7502
+#define BSLS_MACROINCREMENTED_VALUE7502 7503
+#define BSLS_MACROINCREMENTED_VALUE7503 7504
+#define BSLS_MACROINCREMENTED_VALUE7504 7505
+#define BSLS_MACROINCREMENTED_VALUE7505 7506
+#define BSLS_MACROINCREMENTED_VALUE7506 7507
+#define BSLS_MACROINCREMENTED_VALUE7507 7508
+#define BSLS_MACROINCREMENTED_VALUE7508 7509
+#define BSLS_MACROINCREMENTED_VALUE7509 7510
+#define BSLS_MACROINCREMENTED_VALUE7510 7511
+#define BSLS_MACROINCREMENTED_VALUE7511 7512
+#define BSLS_MACROINCREMENTED_VALUE7512 7513
+#define BSLS_MACROINCREMENTED_VALUE7513 7514
+#define BSLS_MACROINCREMENTED_VALUE7514 7515
+#define BSLS_MACROINCREMENTED_VALUE7515 7516
+#define BSLS_MACROINCREMENTED_VALUE7516 7517
+#define BSLS_MACROINCREMENTED_VALUE7517 7518
+#define BSLS_MACROINCREMENTED_VALUE7518 7519
+#define BSLS_MACROINCREMENTED_VALUE7519 7520
+#define BSLS_MACROINCREMENTED_VALUE7520 7521
+#define BSLS_MACROINCREMENTED_VALUE7521 7522
+#define BSLS_MACROINCREMENTED_VALUE7522 7523
+#define BSLS_MACROINCREMENTED_VALUE7523 7524
+#define BSLS_MACROINCREMENTED_VALUE7524 7525
+#define BSLS_MACROINCREMENTED_VALUE7525 7526
+#define BSLS_MACROINCREMENTED_VALUE7526 7527
+#define BSLS_MACROINCREMENTED_VALUE7527 7528
+#define BSLS_MACROINCREMENTED_VALUE7528 7529
+#define BSLS_MACROINCREMENTED_VALUE7529 7530
+#define BSLS_MACROINCREMENTED_VALUE7530 7531
+#define BSLS_MACROINCREMENTED_VALUE7531 7532
+#define BSLS_MACROINCREMENTED_VALUE7532 7533
+#define BSLS_MACROINCREMENTED_VALUE7533 7534
+#define BSLS_MACROINCREMENTED_VALUE7534 7535
+#define BSLS_MACROINCREMENTED_VALUE7535 7536
+#define BSLS_MACROINCREMENTED_VALUE7536 7537
+#define BSLS_MACROINCREMENTED_VALUE7537 7538
+#define BSLS_MACROINCREMENTED_VALUE7538 7539
+#define BSLS_MACROINCREMENTED_VALUE7539 7540
+#define BSLS_MACROINCREMENTED_VALUE7540 7541
+#define BSLS_MACROINCREMENTED_VALUE7541 7542
+#define BSLS_MACROINCREMENTED_VALUE7542 7543
+#define BSLS_MACROINCREMENTED_VALUE7543 7544
+#define BSLS_MACROINCREMENTED_VALUE7544 7545
+#define BSLS_MACROINCREMENTED_VALUE7545 7546
+#define BSLS_MACROINCREMENTED_VALUE7546 7547
+#define BSLS_MACROINCREMENTED_VALUE7547 7548
+#define BSLS_MACROINCREMENTED_VALUE7548 7549
+#define BSLS_MACROINCREMENTED_VALUE7549 7550
+#define BSLS_MACROINCREMENTED_VALUE7550 7551
+#define BSLS_MACROINCREMENTED_VALUE7551 7552
+#define BSLS_MACROINCREMENTED_VALUE7552 7553
+#define BSLS_MACROINCREMENTED_VALUE7553 7554
+#define BSLS_MACROINCREMENTED_VALUE7554 7555
+#define BSLS_MACROINCREMENTED_VALUE7555 7556
+#define BSLS_MACROINCREMENTED_VALUE7556 7557
+#define BSLS_MACROINCREMENTED_VALUE7557 7558
+#define BSLS_MACROINCREMENTED_VALUE7558 7559
+#define BSLS_MACROINCREMENTED_VALUE7559 7560
+#define BSLS_MACROINCREMENTED_VALUE7560 7561
+#define BSLS_MACROINCREMENTED_VALUE7561 7562
+#define BSLS_MACROINCREMENTED_VALUE7562 7563
+#define BSLS_MACROINCREMENTED_VALUE7563 7564
+#define BSLS_MACROINCREMENTED_VALUE7564 7565
+#define BSLS_MACROINCREMENTED_VALUE7565 7566
+#define BSLS_MACROINCREMENTED_VALUE7566 7567
+#define BSLS_MACROINCREMENTED_VALUE7567 7568
+#define BSLS_MACROINCREMENTED_VALUE7568 7569
+#define BSLS_MACROINCREMENTED_VALUE7569 7570
+#define BSLS_MACROINCREMENTED_VALUE7570 7571
+#define BSLS_MACROINCREMENTED_VALUE7571 7572
+#define BSLS_MACROINCREMENTED_VALUE7572 7573
+#define BSLS_MACROINCREMENTED_VALUE7573 7574
+#define BSLS_MACROINCREMENTED_VALUE7574 7575
+#define BSLS_MACROINCREMENTED_VALUE7575 7576
+#define BSLS_MACROINCREMENTED_VALUE7576 7577
+#define BSLS_MACROINCREMENTED_VALUE7577 7578
+#define BSLS_MACROINCREMENTED_VALUE7578 7579
+#define BSLS_MACROINCREMENTED_VALUE7579 7580
+#define BSLS_MACROINCREMENTED_VALUE7580 7581
+#define BSLS_MACROINCREMENTED_VALUE7581 7582
+#define BSLS_MACROINCREMENTED_VALUE7582 7583
+#define BSLS_MACROINCREMENTED_VALUE7583 7584
+#define BSLS_MACROINCREMENTED_VALUE7584 7585
+#define BSLS_MACROINCREMENTED_VALUE7585 7586
+#define BSLS_MACROINCREMENTED_VALUE7586 7587
+#define BSLS_MACROINCREMENTED_VALUE7587 7588
+#define BSLS_MACROINCREMENTED_VALUE7588 7589
+#define BSLS_MACROINCREMENTED_VALUE7589 7590
+#define BSLS_MACROINCREMENTED_VALUE7590 7591
+#define BSLS_MACROINCREMENTED_VALUE7591 7592
+#define BSLS_MACROINCREMENTED_VALUE7592 7593
+#define BSLS_MACROINCREMENTED_VALUE7593 7594
+#define BSLS_MACROINCREMENTED_VALUE7594 7595
+#define BSLS_MACROINCREMENTED_VALUE7595 7596
+#define BSLS_MACROINCREMENTED_VALUE7596 7597
+#define BSLS_MACROINCREMENTED_VALUE7597 7598
+#define BSLS_MACROINCREMENTED_VALUE7598 7599
+#define BSLS_MACROINCREMENTED_VALUE7599 7600
+#define BSLS_MACROINCREMENTED_VALUE7600 7601
+#define BSLS_MACROINCREMENTED_VALUE7601 7602
+#define BSLS_MACROINCREMENTED_VALUE7602 7603
+#define BSLS_MACROINCREMENTED_VALUE7603 7604
+#define BSLS_MACROINCREMENTED_VALUE7604 7605
+#define BSLS_MACROINCREMENTED_VALUE7605 7606
+#define BSLS_MACROINCREMENTED_VALUE7606 7607
+#define BSLS_MACROINCREMENTED_VALUE7607 7608
+#define BSLS_MACROINCREMENTED_VALUE7608 7609
+#define BSLS_MACROINCREMENTED_VALUE7609 7610
+#define BSLS_MACROINCREMENTED_VALUE7610 7611
+#define BSLS_MACROINCREMENTED_VALUE7611 7612
+#define BSLS_MACROINCREMENTED_VALUE7612 7613
+#define BSLS_MACROINCREMENTED_VALUE7613 7614
+#define BSLS_MACROINCREMENTED_VALUE7614 7615
+#define BSLS_MACROINCREMENTED_VALUE7615 7616
+#define BSLS_MACROINCREMENTED_VALUE7616 7617
+#define BSLS_MACROINCREMENTED_VALUE7617 7618
+#define BSLS_MACROINCREMENTED_VALUE7618 7619
+#define BSLS_MACROINCREMENTED_VALUE7619 7620
+#define BSLS_MACROINCREMENTED_VALUE7620 7621
+#define BSLS_MACROINCREMENTED_VALUE7621 7622
+#define BSLS_MACROINCREMENTED_VALUE7622 7623
+#define BSLS_MACROINCREMENTED_VALUE7623 7624
+#define BSLS_MACROINCREMENTED_VALUE7624 7625
+#define BSLS_MACROINCREMENTED_VALUE7625 7626
+#define BSLS_MACROINCREMENTED_VALUE7626 7627
+#define BSLS_MACROINCREMENTED_VALUE7627 7628
+#define BSLS_MACROINCREMENTED_VALUE7628 7629
+#define BSLS_MACROINCREMENTED_VALUE7629 7630
+#define BSLS_MACROINCREMENTED_VALUE7630 7631
+#define BSLS_MACROINCREMENTED_VALUE7631 7632
+#define BSLS_MACROINCREMENTED_VALUE7632 7633
+#define BSLS_MACROINCREMENTED_VALUE7633 7634
+#define BSLS_MACROINCREMENTED_VALUE7634 7635
+#define BSLS_MACROINCREMENTED_VALUE7635 7636
+#define BSLS_MACROINCREMENTED_VALUE7636 7637
+#define BSLS_MACROINCREMENTED_VALUE7637 7638
+#define BSLS_MACROINCREMENTED_VALUE7638 7639
+#define BSLS_MACROINCREMENTED_VALUE7639 7640
+#define BSLS_MACROINCREMENTED_VALUE7640 7641
+#define BSLS_MACROINCREMENTED_VALUE7641 7642
+#define BSLS_MACROINCREMENTED_VALUE7642 7643
+#define BSLS_MACROINCREMENTED_VALUE7643 7644
+#define BSLS_MACROINCREMENTED_VALUE7644 7645
+#define BSLS_MACROINCREMENTED_VALUE7645 7646
+#define BSLS_MACROINCREMENTED_VALUE7646 7647
+#define BSLS_MACROINCREMENTED_VALUE7647 7648
+#define BSLS_MACROINCREMENTED_VALUE7648 7649
+#define BSLS_MACROINCREMENTED_VALUE7649 7650
+#define BSLS_MACROINCREMENTED_VALUE7650 7651
+#define BSLS_MACROINCREMENTED_VALUE7651 7652
+#define BSLS_MACROINCREMENTED_VALUE7652 7653
+#define BSLS_MACROINCREMENTED_VALUE7653 7654
+#define BSLS_MACROINCREMENTED_VALUE7654 7655
+#define BSLS_MACROINCREMENTED_VALUE7655 7656
+#define BSLS_MACROINCREMENTED_VALUE7656 7657
+#define BSLS_MACROINCREMENTED_VALUE7657 7658
+#define BSLS_MACROINCREMENTED_VALUE7658 7659
+#define BSLS_MACROINCREMENTED_VALUE7659 7660
+#define BSLS_MACROINCREMENTED_VALUE7660 7661
+#define BSLS_MACROINCREMENTED_VALUE7661 7662
+#define BSLS_MACROINCREMENTED_VALUE7662 7663
+#define BSLS_MACROINCREMENTED_VALUE7663 7664
+#define BSLS_MACROINCREMENTED_VALUE7664 7665
+#define BSLS_MACROINCREMENTED_VALUE7665 7666
+#define BSLS_MACROINCREMENTED_VALUE7666 7667
+#define BSLS_MACROINCREMENTED_VALUE7667 7668
+#define BSLS_MACROINCREMENTED_VALUE7668 7669
+#define BSLS_MACROINCREMENTED_VALUE7669 7670
+#define BSLS_MACROINCREMENTED_VALUE7670 7671
+#define BSLS_MACROINCREMENTED_VALUE7671 7672
+#define BSLS_MACROINCREMENTED_VALUE7672 7673
+#define BSLS_MACROINCREMENTED_VALUE7673 7674
+#define BSLS_MACROINCREMENTED_VALUE7674 7675
+#define BSLS_MACROINCREMENTED_VALUE7675 7676
+#define BSLS_MACROINCREMENTED_VALUE7676 7677
+#define BSLS_MACROINCREMENTED_VALUE7677 7678
+#define BSLS_MACROINCREMENTED_VALUE7678 7679
+#define BSLS_MACROINCREMENTED_VALUE7679 7680
+#define BSLS_MACROINCREMENTED_VALUE7680 7681
+#define BSLS_MACROINCREMENTED_VALUE7681 7682
+#define BSLS_MACROINCREMENTED_VALUE7682 7683
+#define BSLS_MACROINCREMENTED_VALUE7683 7684
+#define BSLS_MACROINCREMENTED_VALUE7684 7685
+#define BSLS_MACROINCREMENTED_VALUE7685 7686
+#define BSLS_MACROINCREMENTED_VALUE7686 7687
+#define BSLS_MACROINCREMENTED_VALUE7687 7688
+#define BSLS_MACROINCREMENTED_VALUE7688 7689
+#define BSLS_MACROINCREMENTED_VALUE7689 7690
+#define BSLS_MACROINCREMENTED_VALUE7690 7691
+#define BSLS_MACROINCREMENTED_VALUE7691 7692
+#define BSLS_MACROINCREMENTED_VALUE7692 7693
+#define BSLS_MACROINCREMENTED_VALUE7693 7694
+#define BSLS_MACROINCREMENTED_VALUE7694 7695
+#define BSLS_MACROINCREMENTED_VALUE7695 7696
+#define BSLS_MACROINCREMENTED_VALUE7696 7697
+#define BSLS_MACROINCREMENTED_VALUE7697 7698
+#define BSLS_MACROINCREMENTED_VALUE7698 7699
+#define BSLS_MACROINCREMENTED_VALUE7699 7700
+#define BSLS_MACROINCREMENTED_VALUE7700 7701
+#define BSLS_MACROINCREMENTED_VALUE7701 7702
+#define BSLS_MACROINCREMENTED_VALUE7702 7703
+#define BSLS_MACROINCREMENTED_VALUE7703 7704
+#define BSLS_MACROINCREMENTED_VALUE7704 7705
+#define BSLS_MACROINCREMENTED_VALUE7705 7706
+#define BSLS_MACROINCREMENTED_VALUE7706 7707
+#define BSLS_MACROINCREMENTED_VALUE7707 7708
+#define BSLS_MACROINCREMENTED_VALUE7708 7709
+#define BSLS_MACROINCREMENTED_VALUE7709 7710
+#define BSLS_MACROINCREMENTED_VALUE7710 7711
+#define BSLS_MACROINCREMENTED_VALUE7711 7712
+#define BSLS_MACROINCREMENTED_VALUE7712 7713
+#define BSLS_MACROINCREMENTED_VALUE7713 7714
+#define BSLS_MACROINCREMENTED_VALUE7714 7715
+#define BSLS_MACROINCREMENTED_VALUE7715 7716
+#define BSLS_MACROINCREMENTED_VALUE7716 7717
+#define BSLS_MACROINCREMENTED_VALUE7717 7718
+#define BSLS_MACROINCREMENTED_VALUE7718 7719
+#define BSLS_MACROINCREMENTED_VALUE7719 7720
+#define BSLS_MACROINCREMENTED_VALUE7720 7721
+#define BSLS_MACROINCREMENTED_VALUE7721 7722
+#define BSLS_MACROINCREMENTED_VALUE7722 7723
+#define BSLS_MACROINCREMENTED_VALUE7723 7724
+#define BSLS_MACROINCREMENTED_VALUE7724 7725
+#define BSLS_MACROINCREMENTED_VALUE7725 7726
+#define BSLS_MACROINCREMENTED_VALUE7726 7727
+#define BSLS_MACROINCREMENTED_VALUE7727 7728
+#define BSLS_MACROINCREMENTED_VALUE7728 7729
+#define BSLS_MACROINCREMENTED_VALUE7729 7730
+#define BSLS_MACROINCREMENTED_VALUE7730 7731
+#define BSLS_MACROINCREMENTED_VALUE7731 7732
+#define BSLS_MACROINCREMENTED_VALUE7732 7733
+#define BSLS_MACROINCREMENTED_VALUE7733 7734
+#define BSLS_MACROINCREMENTED_VALUE7734 7735
+#define BSLS_MACROINCREMENTED_VALUE7735 7736
+#define BSLS_MACROINCREMENTED_VALUE7736 7737
+#define BSLS_MACROINCREMENTED_VALUE7737 7738
+#define BSLS_MACROINCREMENTED_VALUE7738 7739
+#define BSLS_MACROINCREMENTED_VALUE7739 7740
+#define BSLS_MACROINCREMENTED_VALUE7740 7741
+#define BSLS_MACROINCREMENTED_VALUE7741 7742
+#define BSLS_MACROINCREMENTED_VALUE7742 7743
+#define BSLS_MACROINCREMENTED_VALUE7743 7744
+#define BSLS_MACROINCREMENTED_VALUE7744 7745
+#define BSLS_MACROINCREMENTED_VALUE7745 7746
+#define BSLS_MACROINCREMENTED_VALUE7746 7747
+#define BSLS_MACROINCREMENTED_VALUE7747 7748
+#define BSLS_MACROINCREMENTED_VALUE7748 7749
+#define BSLS_MACROINCREMENTED_VALUE7749 7750
+#define BSLS_MACROINCREMENTED_VALUE7750 7751
+#define BSLS_MACROINCREMENTED_VALUE7751 7752
+#define BSLS_MACROINCREMENTED_VALUE7752 7753
+#define BSLS_MACROINCREMENTED_VALUE7753 7754
+#define BSLS_MACROINCREMENTED_VALUE7754 7755
+#define BSLS_MACROINCREMENTED_VALUE7755 7756
+#define BSLS_MACROINCREMENTED_VALUE7756 7757
+#define BSLS_MACROINCREMENTED_VALUE7757 7758
+#define BSLS_MACROINCREMENTED_VALUE7758 7759
+#define BSLS_MACROINCREMENTED_VALUE7759 7760
+#define BSLS_MACROINCREMENTED_VALUE7760 7761
+#define BSLS_MACROINCREMENTED_VALUE7761 7762
+#define BSLS_MACROINCREMENTED_VALUE7762 7763
+#define BSLS_MACROINCREMENTED_VALUE7763 7764
+#define BSLS_MACROINCREMENTED_VALUE7764 7765
+#define BSLS_MACROINCREMENTED_VALUE7765 7766
+#define BSLS_MACROINCREMENTED_VALUE7766 7767
+#define BSLS_MACROINCREMENTED_VALUE7767 7768
+#define BSLS_MACROINCREMENTED_VALUE7768 7769
+#define BSLS_MACROINCREMENTED_VALUE7769 7770
+#define BSLS_MACROINCREMENTED_VALUE7770 7771
+#define BSLS_MACROINCREMENTED_VALUE7771 7772
+#define BSLS_MACROINCREMENTED_VALUE7772 7773
+#define BSLS_MACROINCREMENTED_VALUE7773 7774
+#define BSLS_MACROINCREMENTED_VALUE7774 7775
+#define BSLS_MACROINCREMENTED_VALUE7775 7776
+#define BSLS_MACROINCREMENTED_VALUE7776 7777
+#define BSLS_MACROINCREMENTED_VALUE7777 7778
+#define BSLS_MACROINCREMENTED_VALUE7778 7779
+#define BSLS_MACROINCREMENTED_VALUE7779 7780
+#define BSLS_MACROINCREMENTED_VALUE7780 7781
+#define BSLS_MACROINCREMENTED_VALUE7781 7782
+#define BSLS_MACROINCREMENTED_VALUE7782 7783
+#define BSLS_MACROINCREMENTED_VALUE7783 7784
+#define BSLS_MACROINCREMENTED_VALUE7784 7785
+#define BSLS_MACROINCREMENTED_VALUE7785 7786
+#define BSLS_MACROINCREMENTED_VALUE7786 7787
+#define BSLS_MACROINCREMENTED_VALUE7787 7788
+#define BSLS_MACROINCREMENTED_VALUE7788 7789
+#define BSLS_MACROINCREMENTED_VALUE7789 7790
+#define BSLS_MACROINCREMENTED_VALUE7790 7791
+#define BSLS_MACROINCREMENTED_VALUE7791 7792
+#define BSLS_MACROINCREMENTED_VALUE7792 7793
+#define BSLS_MACROINCREMENTED_VALUE7793 7794
+#define BSLS_MACROINCREMENTED_VALUE7794 7795
+#define BSLS_MACROINCREMENTED_VALUE7795 7796
+#define BSLS_MACROINCREMENTED_VALUE7796 7797
+#define BSLS_MACROINCREMENTED_VALUE7797 7798
+#define BSLS_MACROINCREMENTED_VALUE7798 7799
+#define BSLS_MACROINCREMENTED_VALUE7799 7800
+#define BSLS_MACROINCREMENTED_VALUE7800 7801
+#define BSLS_MACROINCREMENTED_VALUE7801 7802
+#define BSLS_MACROINCREMENTED_VALUE7802 7803
+#define BSLS_MACROINCREMENTED_VALUE7803 7804
+#define BSLS_MACROINCREMENTED_VALUE7804 7805
+#define BSLS_MACROINCREMENTED_VALUE7805 7806
+#define BSLS_MACROINCREMENTED_VALUE7806 7807
+#define BSLS_MACROINCREMENTED_VALUE7807 7808
+#define BSLS_MACROINCREMENTED_VALUE7808 7809
+#define BSLS_MACROINCREMENTED_VALUE7809 7810
+#define BSLS_MACROINCREMENTED_VALUE7810 7811
+#define BSLS_MACROINCREMENTED_VALUE7811 7812
+#define BSLS_MACROINCREMENTED_VALUE7812 7813
+#define BSLS_MACROINCREMENTED_VALUE7813 7814
+#define BSLS_MACROINCREMENTED_VALUE7814 7815
+#define BSLS_MACROINCREMENTED_VALUE7815 7816
+#define BSLS_MACROINCREMENTED_VALUE7816 7817
+#define BSLS_MACROINCREMENTED_VALUE7817 7818
+#define BSLS_MACROINCREMENTED_VALUE7818 7819
+#define BSLS_MACROINCREMENTED_VALUE7819 7820
+#define BSLS_MACROINCREMENTED_VALUE7820 7821
+#define BSLS_MACROINCREMENTED_VALUE7821 7822
+#define BSLS_MACROINCREMENTED_VALUE7822 7823
+#define BSLS_MACROINCREMENTED_VALUE7823 7824
+#define BSLS_MACROINCREMENTED_VALUE7824 7825
+#define BSLS_MACROINCREMENTED_VALUE7825 7826
+#define BSLS_MACROINCREMENTED_VALUE7826 7827
+#define BSLS_MACROINCREMENTED_VALUE7827 7828
+#define BSLS_MACROINCREMENTED_VALUE7828 7829
+#define BSLS_MACROINCREMENTED_VALUE7829 7830
+#define BSLS_MACROINCREMENTED_VALUE7830 7831
+#define BSLS_MACROINCREMENTED_VALUE7831 7832
+#define BSLS_MACROINCREMENTED_VALUE7832 7833
+#define BSLS_MACROINCREMENTED_VALUE7833 7834
+#define BSLS_MACROINCREMENTED_VALUE7834 7835
+#define BSLS_MACROINCREMENTED_VALUE7835 7836
+#define BSLS_MACROINCREMENTED_VALUE7836 7837
+#define BSLS_MACROINCREMENTED_VALUE7837 7838
+#define BSLS_MACROINCREMENTED_VALUE7838 7839
+#define BSLS_MACROINCREMENTED_VALUE7839 7840
+#define BSLS_MACROINCREMENTED_VALUE7840 7841
+#define BSLS_MACROINCREMENTED_VALUE7841 7842
+#define BSLS_MACROINCREMENTED_VALUE7842 7843
+#define BSLS_MACROINCREMENTED_VALUE7843 7844
+#define BSLS_MACROINCREMENTED_VALUE7844 7845
+#define BSLS_MACROINCREMENTED_VALUE7845 7846
+#define BSLS_MACROINCREMENTED_VALUE7846 7847
+#define BSLS_MACROINCREMENTED_VALUE7847 7848
+#define BSLS_MACROINCREMENTED_VALUE7848 7849
+#define BSLS_MACROINCREMENTED_VALUE7849 7850
+#define BSLS_MACROINCREMENTED_VALUE7850 7851
+#define BSLS_MACROINCREMENTED_VALUE7851 7852
+#define BSLS_MACROINCREMENTED_VALUE7852 7853
+#define BSLS_MACROINCREMENTED_VALUE7853 7854
+#define BSLS_MACROINCREMENTED_VALUE7854 7855
+#define BSLS_MACROINCREMENTED_VALUE7855 7856
+#define BSLS_MACROINCREMENTED_VALUE7856 7857
+#define BSLS_MACROINCREMENTED_VALUE7857 7858
+#define BSLS_MACROINCREMENTED_VALUE7858 7859
+#define BSLS_MACROINCREMENTED_VALUE7859 7860
+#define BSLS_MACROINCREMENTED_VALUE7860 7861
+#define BSLS_MACROINCREMENTED_VALUE7861 7862
+#define BSLS_MACROINCREMENTED_VALUE7862 7863
+#define BSLS_MACROINCREMENTED_VALUE7863 7864
+#define BSLS_MACROINCREMENTED_VALUE7864 7865
+#define BSLS_MACROINCREMENTED_VALUE7865 7866
+#define BSLS_MACROINCREMENTED_VALUE7866 7867
+#define BSLS_MACROINCREMENTED_VALUE7867 7868
+#define BSLS_MACROINCREMENTED_VALUE7868 7869
+#define BSLS_MACROINCREMENTED_VALUE7869 7870
+#define BSLS_MACROINCREMENTED_VALUE7870 7871
+#define BSLS_MACROINCREMENTED_VALUE7871 7872
+#define BSLS_MACROINCREMENTED_VALUE7872 7873
+#define BSLS_MACROINCREMENTED_VALUE7873 7874
+#define BSLS_MACROINCREMENTED_VALUE7874 7875
+#define BSLS_MACROINCREMENTED_VALUE7875 7876
+#define BSLS_MACROINCREMENTED_VALUE7876 7877
+#define BSLS_MACROINCREMENTED_VALUE7877 7878
+#define BSLS_MACROINCREMENTED_VALUE7878 7879
+#define BSLS_MACROINCREMENTED_VALUE7879 7880
+#define BSLS_MACROINCREMENTED_VALUE7880 7881
+#define BSLS_MACROINCREMENTED_VALUE7881 7882
+#define BSLS_MACROINCREMENTED_VALUE7882 7883
+#define BSLS_MACROINCREMENTED_VALUE7883 7884
+#define BSLS_MACROINCREMENTED_VALUE7884 7885
+#define BSLS_MACROINCREMENTED_VALUE7885 7886
+#define BSLS_MACROINCREMENTED_VALUE7886 7887
+#define BSLS_MACROINCREMENTED_VALUE7887 7888
+#define BSLS_MACROINCREMENTED_VALUE7888 7889
+#define BSLS_MACROINCREMENTED_VALUE7889 7890
+#define BSLS_MACROINCREMENTED_VALUE7890 7891
+#define BSLS_MACROINCREMENTED_VALUE7891 7892
+#define BSLS_MACROINCREMENTED_VALUE7892 7893
+#define BSLS_MACROINCREMENTED_VALUE7893 7894
+#define BSLS_MACROINCREMENTED_VALUE7894 7895
+#define BSLS_MACROINCREMENTED_VALUE7895 7896
+#define BSLS_MACROINCREMENTED_VALUE7896 7897
+#define BSLS_MACROINCREMENTED_VALUE7897 7898
+#define BSLS_MACROINCREMENTED_VALUE7898 7899
+#define BSLS_MACROINCREMENTED_VALUE7899 7900
+#define BSLS_MACROINCREMENTED_VALUE7900 7901
+#define BSLS_MACROINCREMENTED_VALUE7901 7902
+#define BSLS_MACROINCREMENTED_VALUE7902 7903
+#define BSLS_MACROINCREMENTED_VALUE7903 7904
+#define BSLS_MACROINCREMENTED_VALUE7904 7905
+#define BSLS_MACROINCREMENTED_VALUE7905 7906
+#define BSLS_MACROINCREMENTED_VALUE7906 7907
+#define BSLS_MACROINCREMENTED_VALUE7907 7908
+#define BSLS_MACROINCREMENTED_VALUE7908 7909
+#define BSLS_MACROINCREMENTED_VALUE7909 7910
+#define BSLS_MACROINCREMENTED_VALUE7910 7911
+#define BSLS_MACROINCREMENTED_VALUE7911 7912
+#define BSLS_MACROINCREMENTED_VALUE7912 7913
+#define BSLS_MACROINCREMENTED_VALUE7913 7914
+#define BSLS_MACROINCREMENTED_VALUE7914 7915
+#define BSLS_MACROINCREMENTED_VALUE7915 7916
+#define BSLS_MACROINCREMENTED_VALUE7916 7917
+#define BSLS_MACROINCREMENTED_VALUE7917 7918
+#define BSLS_MACROINCREMENTED_VALUE7918 7919
+#define BSLS_MACROINCREMENTED_VALUE7919 7920
+#define BSLS_MACROINCREMENTED_VALUE7920 7921
+#define BSLS_MACROINCREMENTED_VALUE7921 7922
+#define BSLS_MACROINCREMENTED_VALUE7922 7923
+#define BSLS_MACROINCREMENTED_VALUE7923 7924
+#define BSLS_MACROINCREMENTED_VALUE7924 7925
+#define BSLS_MACROINCREMENTED_VALUE7925 7926
+#define BSLS_MACROINCREMENTED_VALUE7926 7927
+#define BSLS_MACROINCREMENTED_VALUE7927 7928
+#define BSLS_MACROINCREMENTED_VALUE7928 7929
+#define BSLS_MACROINCREMENTED_VALUE7929 7930
+#define BSLS_MACROINCREMENTED_VALUE7930 7931
+#define BSLS_MACROINCREMENTED_VALUE7931 7932
+#define BSLS_MACROINCREMENTED_VALUE7932 7933
+#define BSLS_MACROINCREMENTED_VALUE7933 7934
+#define BSLS_MACROINCREMENTED_VALUE7934 7935
+#define BSLS_MACROINCREMENTED_VALUE7935 7936
+#define BSLS_MACROINCREMENTED_VALUE7936 7937
+#define BSLS_MACROINCREMENTED_VALUE7937 7938
+#define BSLS_MACROINCREMENTED_VALUE7938 7939
+#define BSLS_MACROINCREMENTED_VALUE7939 7940
+#define BSLS_MACROINCREMENTED_VALUE7940 7941
+#define BSLS_MACROINCREMENTED_VALUE7941 7942
+#define BSLS_MACROINCREMENTED_VALUE7942 7943
+#define BSLS_MACROINCREMENTED_VALUE7943 7944
+#define BSLS_MACROINCREMENTED_VALUE7944 7945
+#define BSLS_MACROINCREMENTED_VALUE7945 7946
+#define BSLS_MACROINCREMENTED_VALUE7946 7947
+#define BSLS_MACROINCREMENTED_VALUE7947 7948
+#define BSLS_MACROINCREMENTED_VALUE7948 7949
+#define BSLS_MACROINCREMENTED_VALUE7949 7950
+#define BSLS_MACROINCREMENTED_VALUE7950 7951
+#define BSLS_MACROINCREMENTED_VALUE7951 7952
+#define BSLS_MACROINCREMENTED_VALUE7952 7953
+#define BSLS_MACROINCREMENTED_VALUE7953 7954
+#define BSLS_MACROINCREMENTED_VALUE7954 7955
+#define BSLS_MACROINCREMENTED_VALUE7955 7956
+#define BSLS_MACROINCREMENTED_VALUE7956 7957
+#define BSLS_MACROINCREMENTED_VALUE7957 7958
+#define BSLS_MACROINCREMENTED_VALUE7958 7959
+#define BSLS_MACROINCREMENTED_VALUE7959 7960
+#define BSLS_MACROINCREMENTED_VALUE7960 7961
+#define BSLS_MACROINCREMENTED_VALUE7961 7962
+#define BSLS_MACROINCREMENTED_VALUE7962 7963
+#define BSLS_MACROINCREMENTED_VALUE7963 7964
+#define BSLS_MACROINCREMENTED_VALUE7964 7965
+#define BSLS_MACROINCREMENTED_VALUE7965 7966
+#define BSLS_MACROINCREMENTED_VALUE7966 7967
+#define BSLS_MACROINCREMENTED_VALUE7967 7968
+#define BSLS_MACROINCREMENTED_VALUE7968 7969
+#define BSLS_MACROINCREMENTED_VALUE7969 7970
+#define BSLS_MACROINCREMENTED_VALUE7970 7971
+#define BSLS_MACROINCREMENTED_VALUE7971 7972
+#define BSLS_MACROINCREMENTED_VALUE7972 7973
+#define BSLS_MACROINCREMENTED_VALUE7973 7974
+#define BSLS_MACROINCREMENTED_VALUE7974 7975
+#define BSLS_MACROINCREMENTED_VALUE7975 7976
+#define BSLS_MACROINCREMENTED_VALUE7976 7977
+#define BSLS_MACROINCREMENTED_VALUE7977 7978
+#define BSLS_MACROINCREMENTED_VALUE7978 7979
+#define BSLS_MACROINCREMENTED_VALUE7979 7980
+#define BSLS_MACROINCREMENTED_VALUE7980 7981
+#define BSLS_MACROINCREMENTED_VALUE7981 7982
+#define BSLS_MACROINCREMENTED_VALUE7982 7983
+#define BSLS_MACROINCREMENTED_VALUE7983 7984
+#define BSLS_MACROINCREMENTED_VALUE7984 7985
+#define BSLS_MACROINCREMENTED_VALUE7985 7986
+#define BSLS_MACROINCREMENTED_VALUE7986 7987
+#define BSLS_MACROINCREMENTED_VALUE7987 7988
+#define BSLS_MACROINCREMENTED_VALUE7988 7989
+#define BSLS_MACROINCREMENTED_VALUE7989 7990
+#define BSLS_MACROINCREMENTED_VALUE7990 7991
+#define BSLS_MACROINCREMENTED_VALUE7991 7992
+#define BSLS_MACROINCREMENTED_VALUE7992 7993
+#define BSLS_MACROINCREMENTED_VALUE7993 7994
+#define BSLS_MACROINCREMENTED_VALUE7994 7995
+#define BSLS_MACROINCREMENTED_VALUE7995 7996
+#define BSLS_MACROINCREMENTED_VALUE7996 7997
+#define BSLS_MACROINCREMENTED_VALUE7997 7998
+#define BSLS_MACROINCREMENTED_VALUE7998 7999
+#define BSLS_MACROINCREMENTED_VALUE7999 8000
+#define BSLS_MACROINCREMENTED_VALUE8000 8001
+#define BSLS_MACROINCREMENTED_VALUE8001 8002
+#define BSLS_MACROINCREMENTED_VALUE8002 8003
+#define BSLS_MACROINCREMENTED_VALUE8003 8004
+#define BSLS_MACROINCREMENTED_VALUE8004 8005
+#define BSLS_MACROINCREMENTED_VALUE8005 8006
+#define BSLS_MACROINCREMENTED_VALUE8006 8007
+#define BSLS_MACROINCREMENTED_VALUE8007 8008
+#define BSLS_MACROINCREMENTED_VALUE8008 8009
+#define BSLS_MACROINCREMENTED_VALUE8009 8010
+#define BSLS_MACROINCREMENTED_VALUE8010 8011
+#define BSLS_MACROINCREMENTED_VALUE8011 8012
+#define BSLS_MACROINCREMENTED_VALUE8012 8013
+#define BSLS_MACROINCREMENTED_VALUE8013 8014
+#define BSLS_MACROINCREMENTED_VALUE8014 8015
+#define BSLS_MACROINCREMENTED_VALUE8015 8016
+#define BSLS_MACROINCREMENTED_VALUE8016 8017
+#define BSLS_MACROINCREMENTED_VALUE8017 8018
+#define BSLS_MACROINCREMENTED_VALUE8018 8019
+#define BSLS_MACROINCREMENTED_VALUE8019 8020
+#define BSLS_MACROINCREMENTED_VALUE8020 8021
+#define BSLS_MACROINCREMENTED_VALUE8021 8022
+#define BSLS_MACROINCREMENTED_VALUE8022 8023
+#define BSLS_MACROINCREMENTED_VALUE8023 8024
+#define BSLS_MACROINCREMENTED_VALUE8024 8025
+#define BSLS_MACROINCREMENTED_VALUE8025 8026
+#define BSLS_MACROINCREMENTED_VALUE8026 8027
+#define BSLS_MACROINCREMENTED_VALUE8027 8028
+#define BSLS_MACROINCREMENTED_VALUE8028 8029
+#define BSLS_MACROINCREMENTED_VALUE8029 8030
+#define BSLS_MACROINCREMENTED_VALUE8030 8031
+#define BSLS_MACROINCREMENTED_VALUE8031 8032
+#define BSLS_MACROINCREMENTED_VALUE8032 8033
+#define BSLS_MACROINCREMENTED_VALUE8033 8034
+#define BSLS_MACROINCREMENTED_VALUE8034 8035
+#define BSLS_MACROINCREMENTED_VALUE8035 8036
+#define BSLS_MACROINCREMENTED_VALUE8036 8037
+#define BSLS_MACROINCREMENTED_VALUE8037 8038
+#define BSLS_MACROINCREMENTED_VALUE8038 8039
+#define BSLS_MACROINCREMENTED_VALUE8039 8040
+#define BSLS_MACROINCREMENTED_VALUE8040 8041
+#define BSLS_MACROINCREMENTED_VALUE8041 8042
+#define BSLS_MACROINCREMENTED_VALUE8042 8043
+#define BSLS_MACROINCREMENTED_VALUE8043 8044
+#define BSLS_MACROINCREMENTED_VALUE8044 8045
+#define BSLS_MACROINCREMENTED_VALUE8045 8046
+#define BSLS_MACROINCREMENTED_VALUE8046 8047
+#define BSLS_MACROINCREMENTED_VALUE8047 8048
+#define BSLS_MACROINCREMENTED_VALUE8048 8049
+#define BSLS_MACROINCREMENTED_VALUE8049 8050
+#define BSLS_MACROINCREMENTED_VALUE8050 8051
+#define BSLS_MACROINCREMENTED_VALUE8051 8052
+#define BSLS_MACROINCREMENTED_VALUE8052 8053
+#define BSLS_MACROINCREMENTED_VALUE8053 8054
+#define BSLS_MACROINCREMENTED_VALUE8054 8055
+#define BSLS_MACROINCREMENTED_VALUE8055 8056
+#define BSLS_MACROINCREMENTED_VALUE8056 8057
+#define BSLS_MACROINCREMENTED_VALUE8057 8058
+#define BSLS_MACROINCREMENTED_VALUE8058 8059
+#define BSLS_MACROINCREMENTED_VALUE8059 8060
+#define BSLS_MACROINCREMENTED_VALUE8060 8061
+#define BSLS_MACROINCREMENTED_VALUE8061 8062
+#define BSLS_MACROINCREMENTED_VALUE8062 8063
+#define BSLS_MACROINCREMENTED_VALUE8063 8064
+#define BSLS_MACROINCREMENTED_VALUE8064 8065
+#define BSLS_MACROINCREMENTED_VALUE8065 8066
+#define BSLS_MACROINCREMENTED_VALUE8066 8067
+#define BSLS_MACROINCREMENTED_VALUE8067 8068
+#define BSLS_MACROINCREMENTED_VALUE8068 8069
+#define BSLS_MACROINCREMENTED_VALUE8069 8070
+#define BSLS_MACROINCREMENTED_VALUE8070 8071
+#define BSLS_MACROINCREMENTED_VALUE8071 8072
+#define BSLS_MACROINCREMENTED_VALUE8072 8073
+#define BSLS_MACROINCREMENTED_VALUE8073 8074
+#define BSLS_MACROINCREMENTED_VALUE8074 8075
+#define BSLS_MACROINCREMENTED_VALUE8075 8076
+#define BSLS_MACROINCREMENTED_VALUE8076 8077
+#define BSLS_MACROINCREMENTED_VALUE8077 8078
+#define BSLS_MACROINCREMENTED_VALUE8078 8079
+#define BSLS_MACROINCREMENTED_VALUE8079 8080
+#define BSLS_MACROINCREMENTED_VALUE8080 8081
+#define BSLS_MACROINCREMENTED_VALUE8081 8082
+#define BSLS_MACROINCREMENTED_VALUE8082 8083
+#define BSLS_MACROINCREMENTED_VALUE8083 8084
+#define BSLS_MACROINCREMENTED_VALUE8084 8085
+#define BSLS_MACROINCREMENTED_VALUE8085 8086
+#define BSLS_MACROINCREMENTED_VALUE8086 8087
+#define BSLS_MACROINCREMENTED_VALUE8087 8088
+#define BSLS_MACROINCREMENTED_VALUE8088 8089
+#define BSLS_MACROINCREMENTED_VALUE8089 8090
+#define BSLS_MACROINCREMENTED_VALUE8090 8091
+#define BSLS_MACROINCREMENTED_VALUE8091 8092
+#define BSLS_MACROINCREMENTED_VALUE8092 8093
+#define BSLS_MACROINCREMENTED_VALUE8093 8094
+#define BSLS_MACROINCREMENTED_VALUE8094 8095
+#define BSLS_MACROINCREMENTED_VALUE8095 8096
+#define BSLS_MACROINCREMENTED_VALUE8096 8097
+#define BSLS_MACROINCREMENTED_VALUE8097 8098
+#define BSLS_MACROINCREMENTED_VALUE8098 8099
+#define BSLS_MACROINCREMENTED_VALUE8099 8100
+#define BSLS_MACROINCREMENTED_VALUE8100 8101
+#define BSLS_MACROINCREMENTED_VALUE8101 8102
+#define BSLS_MACROINCREMENTED_VALUE8102 8103
+#define BSLS_MACROINCREMENTED_VALUE8103 8104
+#define BSLS_MACROINCREMENTED_VALUE8104 8105
+#define BSLS_MACROINCREMENTED_VALUE8105 8106
+#define BSLS_MACROINCREMENTED_VALUE8106 8107
+#define BSLS_MACROINCREMENTED_VALUE8107 8108
+#define BSLS_MACROINCREMENTED_VALUE8108 8109
+#define BSLS_MACROINCREMENTED_VALUE8109 8110
+#define BSLS_MACROINCREMENTED_VALUE8110 8111
+#define BSLS_MACROINCREMENTED_VALUE8111 8112
+#define BSLS_MACROINCREMENTED_VALUE8112 8113
+#define BSLS_MACROINCREMENTED_VALUE8113 8114
+#define BSLS_MACROINCREMENTED_VALUE8114 8115
+#define BSLS_MACROINCREMENTED_VALUE8115 8116
+#define BSLS_MACROINCREMENTED_VALUE8116 8117
+#define BSLS_MACROINCREMENTED_VALUE8117 8118
+#define BSLS_MACROINCREMENTED_VALUE8118 8119
+#define BSLS_MACROINCREMENTED_VALUE8119 8120
+#define BSLS_MACROINCREMENTED_VALUE8120 8121
+#define BSLS_MACROINCREMENTED_VALUE8121 8122
+#define BSLS_MACROINCREMENTED_VALUE8122 8123
+#define BSLS_MACROINCREMENTED_VALUE8123 8124
+#define BSLS_MACROINCREMENTED_VALUE8124 8125
+#define BSLS_MACROINCREMENTED_VALUE8125 8126
+#define BSLS_MACROINCREMENTED_VALUE8126 8127
+#define BSLS_MACROINCREMENTED_VALUE8127 8128
+#define BSLS_MACROINCREMENTED_VALUE8128 8129
+#define BSLS_MACROINCREMENTED_VALUE8129 8130
+#define BSLS_MACROINCREMENTED_VALUE8130 8131
+#define BSLS_MACROINCREMENTED_VALUE8131 8132
+#define BSLS_MACROINCREMENTED_VALUE8132 8133
+#define BSLS_MACROINCREMENTED_VALUE8133 8134
+#define BSLS_MACROINCREMENTED_VALUE8134 8135
+#define BSLS_MACROINCREMENTED_VALUE8135 8136
+#define BSLS_MACROINCREMENTED_VALUE8136 8137
+#define BSLS_MACROINCREMENTED_VALUE8137 8138
+#define BSLS_MACROINCREMENTED_VALUE8138 8139
+#define BSLS_MACROINCREMENTED_VALUE8139 8140
+#define BSLS_MACROINCREMENTED_VALUE8140 8141
+#define BSLS_MACROINCREMENTED_VALUE8141 8142
+#define BSLS_MACROINCREMENTED_VALUE8142 8143
+#define BSLS_MACROINCREMENTED_VALUE8143 8144
+#define BSLS_MACROINCREMENTED_VALUE8144 8145
+#define BSLS_MACROINCREMENTED_VALUE8145 8146
+#define BSLS_MACROINCREMENTED_VALUE8146 8147
+#define BSLS_MACROINCREMENTED_VALUE8147 8148
+#define BSLS_MACROINCREMENTED_VALUE8148 8149
+#define BSLS_MACROINCREMENTED_VALUE8149 8150
+#define BSLS_MACROINCREMENTED_VALUE8150 8151
+#define BSLS_MACROINCREMENTED_VALUE8151 8152
+#define BSLS_MACROINCREMENTED_VALUE8152 8153
+#define BSLS_MACROINCREMENTED_VALUE8153 8154
+#define BSLS_MACROINCREMENTED_VALUE8154 8155
+#define BSLS_MACROINCREMENTED_VALUE8155 8156
+#define BSLS_MACROINCREMENTED_VALUE8156 8157
+#define BSLS_MACROINCREMENTED_VALUE8157 8158
+#define BSLS_MACROINCREMENTED_VALUE8158 8159
+#define BSLS_MACROINCREMENTED_VALUE8159 8160
+#define BSLS_MACROINCREMENTED_VALUE8160 8161
+#define BSLS_MACROINCREMENTED_VALUE8161 8162
+#define BSLS_MACROINCREMENTED_VALUE8162 8163
+#define BSLS_MACROINCREMENTED_VALUE8163 8164
+#define BSLS_MACROINCREMENTED_VALUE8164 8165
+#define BSLS_MACROINCREMENTED_VALUE8165 8166
+#define BSLS_MACROINCREMENTED_VALUE8166 8167
+#define BSLS_MACROINCREMENTED_VALUE8167 8168
+#define BSLS_MACROINCREMENTED_VALUE8168 8169
+#define BSLS_MACROINCREMENTED_VALUE8169 8170
+#define BSLS_MACROINCREMENTED_VALUE8170 8171
+#define BSLS_MACROINCREMENTED_VALUE8171 8172
+#define BSLS_MACROINCREMENTED_VALUE8172 8173
+#define BSLS_MACROINCREMENTED_VALUE8173 8174
+#define BSLS_MACROINCREMENTED_VALUE8174 8175
+#define BSLS_MACROINCREMENTED_VALUE8175 8176
+#define BSLS_MACROINCREMENTED_VALUE8176 8177
+#define BSLS_MACROINCREMENTED_VALUE8177 8178
+#define BSLS_MACROINCREMENTED_VALUE8178 8179
+#define BSLS_MACROINCREMENTED_VALUE8179 8180
+#define BSLS_MACROINCREMENTED_VALUE8180 8181
+#define BSLS_MACROINCREMENTED_VALUE8181 8182
+#define BSLS_MACROINCREMENTED_VALUE8182 8183
+#define BSLS_MACROINCREMENTED_VALUE8183 8184
+#define BSLS_MACROINCREMENTED_VALUE8184 8185
+#define BSLS_MACROINCREMENTED_VALUE8185 8186
+#define BSLS_MACROINCREMENTED_VALUE8186 8187
+#define BSLS_MACROINCREMENTED_VALUE8187 8188
+#define BSLS_MACROINCREMENTED_VALUE8188 8189
+#define BSLS_MACROINCREMENTED_VALUE8189 8190
+#define BSLS_MACROINCREMENTED_VALUE8190 8191
+#define BSLS_MACROINCREMENTED_VALUE8191 8192
+#define BSLS_MACROINCREMENTED_VALUE8192 8193
+#define BSLS_MACROINCREMENTED_VALUE8193 8194
+#define BSLS_MACROINCREMENTED_VALUE8194 8195
+#define BSLS_MACROINCREMENTED_VALUE8195 8196
+#define BSLS_MACROINCREMENTED_VALUE8196 8197
+#define BSLS_MACROINCREMENTED_VALUE8197 8198
+#define BSLS_MACROINCREMENTED_VALUE8198 8199
+#define BSLS_MACROINCREMENTED_VALUE8199 8200
+#define BSLS_MACROINCREMENTED_VALUE8200 8201
+#define BSLS_MACROINCREMENTED_VALUE8201 8202
+#define BSLS_MACROINCREMENTED_VALUE8202 8203
+#define BSLS_MACROINCREMENTED_VALUE8203 8204
+#define BSLS_MACROINCREMENTED_VALUE8204 8205
+#define BSLS_MACROINCREMENTED_VALUE8205 8206
+#define BSLS_MACROINCREMENTED_VALUE8206 8207
+#define BSLS_MACROINCREMENTED_VALUE8207 8208
+#define BSLS_MACROINCREMENTED_VALUE8208 8209
+#define BSLS_MACROINCREMENTED_VALUE8209 8210
+#define BSLS_MACROINCREMENTED_VALUE8210 8211
+#define BSLS_MACROINCREMENTED_VALUE8211 8212
+#define BSLS_MACROINCREMENTED_VALUE8212 8213
+#define BSLS_MACROINCREMENTED_VALUE8213 8214
+#define BSLS_MACROINCREMENTED_VALUE8214 8215
+#define BSLS_MACROINCREMENTED_VALUE8215 8216
+#define BSLS_MACROINCREMENTED_VALUE8216 8217
+#define BSLS_MACROINCREMENTED_VALUE8217 8218
+#define BSLS_MACROINCREMENTED_VALUE8218 8219
+#define BSLS_MACROINCREMENTED_VALUE8219 8220
+#define BSLS_MACROINCREMENTED_VALUE8220 8221
+#define BSLS_MACROINCREMENTED_VALUE8221 8222
+#define BSLS_MACROINCREMENTED_VALUE8222 8223
+#define BSLS_MACROINCREMENTED_VALUE8223 8224
+#define BSLS_MACROINCREMENTED_VALUE8224 8225
+#define BSLS_MACROINCREMENTED_VALUE8225 8226
+#define BSLS_MACROINCREMENTED_VALUE8226 8227
+#define BSLS_MACROINCREMENTED_VALUE8227 8228
+#define BSLS_MACROINCREMENTED_VALUE8228 8229
+#define BSLS_MACROINCREMENTED_VALUE8229 8230
+#define BSLS_MACROINCREMENTED_VALUE8230 8231
+#define BSLS_MACROINCREMENTED_VALUE8231 8232
+#define BSLS_MACROINCREMENTED_VALUE8232 8233
+#define BSLS_MACROINCREMENTED_VALUE8233 8234
+#define BSLS_MACROINCREMENTED_VALUE8234 8235
+#define BSLS_MACROINCREMENTED_VALUE8235 8236
+#define BSLS_MACROINCREMENTED_VALUE8236 8237
+#define BSLS_MACROINCREMENTED_VALUE8237 8238
+#define BSLS_MACROINCREMENTED_VALUE8238 8239
+#define BSLS_MACROINCREMENTED_VALUE8239 8240
+#define BSLS_MACROINCREMENTED_VALUE8240 8241
+#define BSLS_MACROINCREMENTED_VALUE8241 8242
+#define BSLS_MACROINCREMENTED_VALUE8242 8243
+#define BSLS_MACROINCREMENTED_VALUE8243 8244
+#define BSLS_MACROINCREMENTED_VALUE8244 8245
+#define BSLS_MACROINCREMENTED_VALUE8245 8246
+#define BSLS_MACROINCREMENTED_VALUE8246 8247
+#define BSLS_MACROINCREMENTED_VALUE8247 8248
+#define BSLS_MACROINCREMENTED_VALUE8248 8249
+#define BSLS_MACROINCREMENTED_VALUE8249 8250
+#define BSLS_MACROINCREMENTED_VALUE8250 8251
+#define BSLS_MACROINCREMENTED_VALUE8251 8252
+#define BSLS_MACROINCREMENTED_VALUE8252 8253
+#define BSLS_MACROINCREMENTED_VALUE8253 8254
+#define BSLS_MACROINCREMENTED_VALUE8254 8255
+#define BSLS_MACROINCREMENTED_VALUE8255 8256
+#define BSLS_MACROINCREMENTED_VALUE8256 8257
+#define BSLS_MACROINCREMENTED_VALUE8257 8258
+#define BSLS_MACROINCREMENTED_VALUE8258 8259
+#define BSLS_MACROINCREMENTED_VALUE8259 8260
+#define BSLS_MACROINCREMENTED_VALUE8260 8261
+#define BSLS_MACROINCREMENTED_VALUE8261 8262
+#define BSLS_MACROINCREMENTED_VALUE8262 8263
+#define BSLS_MACROINCREMENTED_VALUE8263 8264
+#define BSLS_MACROINCREMENTED_VALUE8264 8265
+#define BSLS_MACROINCREMENTED_VALUE8265 8266
+#define BSLS_MACROINCREMENTED_VALUE8266 8267
+#define BSLS_MACROINCREMENTED_VALUE8267 8268
+#define BSLS_MACROINCREMENTED_VALUE8268 8269
+#define BSLS_MACROINCREMENTED_VALUE8269 8270
+#define BSLS_MACROINCREMENTED_VALUE8270 8271
+#define BSLS_MACROINCREMENTED_VALUE8271 8272
+#define BSLS_MACROINCREMENTED_VALUE8272 8273
+#define BSLS_MACROINCREMENTED_VALUE8273 8274
+#define BSLS_MACROINCREMENTED_VALUE8274 8275
+#define BSLS_MACROINCREMENTED_VALUE8275 8276
+#define BSLS_MACROINCREMENTED_VALUE8276 8277
+#define BSLS_MACROINCREMENTED_VALUE8277 8278
+#define BSLS_MACROINCREMENTED_VALUE8278 8279
+#define BSLS_MACROINCREMENTED_VALUE8279 8280
+#define BSLS_MACROINCREMENTED_VALUE8280 8281
+#define BSLS_MACROINCREMENTED_VALUE8281 8282
+#define BSLS_MACROINCREMENTED_VALUE8282 8283
+#define BSLS_MACROINCREMENTED_VALUE8283 8284
+#define BSLS_MACROINCREMENTED_VALUE8284 8285
+#define BSLS_MACROINCREMENTED_VALUE8285 8286
+#define BSLS_MACROINCREMENTED_VALUE8286 8287
+#define BSLS_MACROINCREMENTED_VALUE8287 8288
+#define BSLS_MACROINCREMENTED_VALUE8288 8289
+#define BSLS_MACROINCREMENTED_VALUE8289 8290
+#define BSLS_MACROINCREMENTED_VALUE8290 8291
+#define BSLS_MACROINCREMENTED_VALUE8291 8292
+#define BSLS_MACROINCREMENTED_VALUE8292 8293
+#define BSLS_MACROINCREMENTED_VALUE8293 8294
+#define BSLS_MACROINCREMENTED_VALUE8294 8295
+#define BSLS_MACROINCREMENTED_VALUE8295 8296
+#define BSLS_MACROINCREMENTED_VALUE8296 8297
+#define BSLS_MACROINCREMENTED_VALUE8297 8298
+#define BSLS_MACROINCREMENTED_VALUE8298 8299
+#define BSLS_MACROINCREMENTED_VALUE8299 8300
+#define BSLS_MACROINCREMENTED_VALUE8300 8301
+#define BSLS_MACROINCREMENTED_VALUE8301 8302
+#define BSLS_MACROINCREMENTED_VALUE8302 8303
+#define BSLS_MACROINCREMENTED_VALUE8303 8304
+#define BSLS_MACROINCREMENTED_VALUE8304 8305
+#define BSLS_MACROINCREMENTED_VALUE8305 8306
+#define BSLS_MACROINCREMENTED_VALUE8306 8307
+#define BSLS_MACROINCREMENTED_VALUE8307 8308
+#define BSLS_MACROINCREMENTED_VALUE8308 8309
+#define BSLS_MACROINCREMENTED_VALUE8309 8310
+#define BSLS_MACROINCREMENTED_VALUE8310 8311
+#define BSLS_MACROINCREMENTED_VALUE8311 8312
+#define BSLS_MACROINCREMENTED_VALUE8312 8313
+#define BSLS_MACROINCREMENTED_VALUE8313 8314
+#define BSLS_MACROINCREMENTED_VALUE8314 8315
+#define BSLS_MACROINCREMENTED_VALUE8315 8316
+#define BSLS_MACROINCREMENTED_VALUE8316 8317
+#define BSLS_MACROINCREMENTED_VALUE8317 8318
+#define BSLS_MACROINCREMENTED_VALUE8318 8319
+#define BSLS_MACROINCREMENTED_VALUE8319 8320
+#define BSLS_MACROINCREMENTED_VALUE8320 8321
+#define BSLS_MACROINCREMENTED_VALUE8321 8322
+#define BSLS_MACROINCREMENTED_VALUE8322 8323
+#define BSLS_MACROINCREMENTED_VALUE8323 8324
+#define BSLS_MACROINCREMENTED_VALUE8324 8325
+#define BSLS_MACROINCREMENTED_VALUE8325 8326
+#define BSLS_MACROINCREMENTED_VALUE8326 8327
+#define BSLS_MACROINCREMENTED_VALUE8327 8328
+#define BSLS_MACROINCREMENTED_VALUE8328 8329
+#define BSLS_MACROINCREMENTED_VALUE8329 8330
+#define BSLS_MACROINCREMENTED_VALUE8330 8331
+#define BSLS_MACROINCREMENTED_VALUE8331 8332
+#define BSLS_MACROINCREMENTED_VALUE8332 8333
+#define BSLS_MACROINCREMENTED_VALUE8333 8334
+#define BSLS_MACROINCREMENTED_VALUE8334 8335
+#define BSLS_MACROINCREMENTED_VALUE8335 8336
+#define BSLS_MACROINCREMENTED_VALUE8336 8337
+#define BSLS_MACROINCREMENTED_VALUE8337 8338
+#define BSLS_MACROINCREMENTED_VALUE8338 8339
+#define BSLS_MACROINCREMENTED_VALUE8339 8340
+#define BSLS_MACROINCREMENTED_VALUE8340 8341
+#define BSLS_MACROINCREMENTED_VALUE8341 8342
+#define BSLS_MACROINCREMENTED_VALUE8342 8343
+#define BSLS_MACROINCREMENTED_VALUE8343 8344
+#define BSLS_MACROINCREMENTED_VALUE8344 8345
+#define BSLS_MACROINCREMENTED_VALUE8345 8346
+#define BSLS_MACROINCREMENTED_VALUE8346 8347
+#define BSLS_MACROINCREMENTED_VALUE8347 8348
+#define BSLS_MACROINCREMENTED_VALUE8348 8349
+#define BSLS_MACROINCREMENTED_VALUE8349 8350
+#define BSLS_MACROINCREMENTED_VALUE8350 8351
+#define BSLS_MACROINCREMENTED_VALUE8351 8352
+#define BSLS_MACROINCREMENTED_VALUE8352 8353
+#define BSLS_MACROINCREMENTED_VALUE8353 8354
+#define BSLS_MACROINCREMENTED_VALUE8354 8355
+#define BSLS_MACROINCREMENTED_VALUE8355 8356
+#define BSLS_MACROINCREMENTED_VALUE8356 8357
+#define BSLS_MACROINCREMENTED_VALUE8357 8358
+#define BSLS_MACROINCREMENTED_VALUE8358 8359
+#define BSLS_MACROINCREMENTED_VALUE8359 8360
+#define BSLS_MACROINCREMENTED_VALUE8360 8361
+#define BSLS_MACROINCREMENTED_VALUE8361 8362
+#define BSLS_MACROINCREMENTED_VALUE8362 8363
+#define BSLS_MACROINCREMENTED_VALUE8363 8364
+#define BSLS_MACROINCREMENTED_VALUE8364 8365
+#define BSLS_MACROINCREMENTED_VALUE8365 8366
+#define BSLS_MACROINCREMENTED_VALUE8366 8367
+#define BSLS_MACROINCREMENTED_VALUE8367 8368
+#define BSLS_MACROINCREMENTED_VALUE8368 8369
+#define BSLS_MACROINCREMENTED_VALUE8369 8370
+#define BSLS_MACROINCREMENTED_VALUE8370 8371
+#define BSLS_MACROINCREMENTED_VALUE8371 8372
+#define BSLS_MACROINCREMENTED_VALUE8372 8373
+#define BSLS_MACROINCREMENTED_VALUE8373 8374
+#define BSLS_MACROINCREMENTED_VALUE8374 8375
+#define BSLS_MACROINCREMENTED_VALUE8375 8376
+#define BSLS_MACROINCREMENTED_VALUE8376 8377
+#define BSLS_MACROINCREMENTED_VALUE8377 8378
+#define BSLS_MACROINCREMENTED_VALUE8378 8379
+#define BSLS_MACROINCREMENTED_VALUE8379 8380
+#define BSLS_MACROINCREMENTED_VALUE8380 8381
+#define BSLS_MACROINCREMENTED_VALUE8381 8382
+#define BSLS_MACROINCREMENTED_VALUE8382 8383
+#define BSLS_MACROINCREMENTED_VALUE8383 8384
+#define BSLS_MACROINCREMENTED_VALUE8384 8385
+#define BSLS_MACROINCREMENTED_VALUE8385 8386
+#define BSLS_MACROINCREMENTED_VALUE8386 8387
+#define BSLS_MACROINCREMENTED_VALUE8387 8388
+#define BSLS_MACROINCREMENTED_VALUE8388 8389
+#define BSLS_MACROINCREMENTED_VALUE8389 8390
+#define BSLS_MACROINCREMENTED_VALUE8390 8391
+#define BSLS_MACROINCREMENTED_VALUE8391 8392
+#define BSLS_MACROINCREMENTED_VALUE8392 8393
+#define BSLS_MACROINCREMENTED_VALUE8393 8394
+#define BSLS_MACROINCREMENTED_VALUE8394 8395
+#define BSLS_MACROINCREMENTED_VALUE8395 8396
+#define BSLS_MACROINCREMENTED_VALUE8396 8397
+#define BSLS_MACROINCREMENTED_VALUE8397 8398
+#define BSLS_MACROINCREMENTED_VALUE8398 8399
+#define BSLS_MACROINCREMENTED_VALUE8399 8400
+#define BSLS_MACROINCREMENTED_VALUE8400 8401
+#define BSLS_MACROINCREMENTED_VALUE8401 8402
+#define BSLS_MACROINCREMENTED_VALUE8402 8403
+#define BSLS_MACROINCREMENTED_VALUE8403 8404
+#define BSLS_MACROINCREMENTED_VALUE8404 8405
+#define BSLS_MACROINCREMENTED_VALUE8405 8406
+#define BSLS_MACROINCREMENTED_VALUE8406 8407
+#define BSLS_MACROINCREMENTED_VALUE8407 8408
+#define BSLS_MACROINCREMENTED_VALUE8408 8409
+#define BSLS_MACROINCREMENTED_VALUE8409 8410
+#define BSLS_MACROINCREMENTED_VALUE8410 8411
+#define BSLS_MACROINCREMENTED_VALUE8411 8412
+#define BSLS_MACROINCREMENTED_VALUE8412 8413
+#define BSLS_MACROINCREMENTED_VALUE8413 8414
+#define BSLS_MACROINCREMENTED_VALUE8414 8415
+#define BSLS_MACROINCREMENTED_VALUE8415 8416
+#define BSLS_MACROINCREMENTED_VALUE8416 8417
+#define BSLS_MACROINCREMENTED_VALUE8417 8418
+#define BSLS_MACROINCREMENTED_VALUE8418 8419
+#define BSLS_MACROINCREMENTED_VALUE8419 8420
+#define BSLS_MACROINCREMENTED_VALUE8420 8421
+#define BSLS_MACROINCREMENTED_VALUE8421 8422
+#define BSLS_MACROINCREMENTED_VALUE8422 8423
+#define BSLS_MACROINCREMENTED_VALUE8423 8424
+#define BSLS_MACROINCREMENTED_VALUE8424 8425
+#define BSLS_MACROINCREMENTED_VALUE8425 8426
+#define BSLS_MACROINCREMENTED_VALUE8426 8427
+#define BSLS_MACROINCREMENTED_VALUE8427 8428
+#define BSLS_MACROINCREMENTED_VALUE8428 8429
+#define BSLS_MACROINCREMENTED_VALUE8429 8430
+#define BSLS_MACROINCREMENTED_VALUE8430 8431
+#define BSLS_MACROINCREMENTED_VALUE8431 8432
+#define BSLS_MACROINCREMENTED_VALUE8432 8433
+#define BSLS_MACROINCREMENTED_VALUE8433 8434
+#define BSLS_MACROINCREMENTED_VALUE8434 8435
+#define BSLS_MACROINCREMENTED_VALUE8435 8436
+#define BSLS_MACROINCREMENTED_VALUE8436 8437
+#define BSLS_MACROINCREMENTED_VALUE8437 8438
+#define BSLS_MACROINCREMENTED_VALUE8438 8439
+#define BSLS_MACROINCREMENTED_VALUE8439 8440
+#define BSLS_MACROINCREMENTED_VALUE8440 8441
+#define BSLS_MACROINCREMENTED_VALUE8441 8442
+#define BSLS_MACROINCREMENTED_VALUE8442 8443
+#define BSLS_MACROINCREMENTED_VALUE8443 8444
+#define BSLS_MACROINCREMENTED_VALUE8444 8445
+#define BSLS_MACROINCREMENTED_VALUE8445 8446
+#define BSLS_MACROINCREMENTED_VALUE8446 8447
+#define BSLS_MACROINCREMENTED_VALUE8447 8448
+#define BSLS_MACROINCREMENTED_VALUE8448 8449
+#define BSLS_MACROINCREMENTED_VALUE8449 8450
+#define BSLS_MACROINCREMENTED_VALUE8450 8451
+#define BSLS_MACROINCREMENTED_VALUE8451 8452
+#define BSLS_MACROINCREMENTED_VALUE8452 8453
+#define BSLS_MACROINCREMENTED_VALUE8453 8454
+#define BSLS_MACROINCREMENTED_VALUE8454 8455
+#define BSLS_MACROINCREMENTED_VALUE8455 8456
+#define BSLS_MACROINCREMENTED_VALUE8456 8457
+#define BSLS_MACROINCREMENTED_VALUE8457 8458
+#define BSLS_MACROINCREMENTED_VALUE8458 8459
+#define BSLS_MACROINCREMENTED_VALUE8459 8460
+#define BSLS_MACROINCREMENTED_VALUE8460 8461
+#define BSLS_MACROINCREMENTED_VALUE8461 8462
+#define BSLS_MACROINCREMENTED_VALUE8462 8463
+#define BSLS_MACROINCREMENTED_VALUE8463 8464
+#define BSLS_MACROINCREMENTED_VALUE8464 8465
+#define BSLS_MACROINCREMENTED_VALUE8465 8466
+#define BSLS_MACROINCREMENTED_VALUE8466 8467
+#define BSLS_MACROINCREMENTED_VALUE8467 8468
+#define BSLS_MACROINCREMENTED_VALUE8468 8469
+#define BSLS_MACROINCREMENTED_VALUE8469 8470
+#define BSLS_MACROINCREMENTED_VALUE8470 8471
+#define BSLS_MACROINCREMENTED_VALUE8471 8472
+#define BSLS_MACROINCREMENTED_VALUE8472 8473
+#define BSLS_MACROINCREMENTED_VALUE8473 8474
+#define BSLS_MACROINCREMENTED_VALUE8474 8475
+#define BSLS_MACROINCREMENTED_VALUE8475 8476
+#define BSLS_MACROINCREMENTED_VALUE8476 8477
+#define BSLS_MACROINCREMENTED_VALUE8477 8478
+#define BSLS_MACROINCREMENTED_VALUE8478 8479
+#define BSLS_MACROINCREMENTED_VALUE8479 8480
+#define BSLS_MACROINCREMENTED_VALUE8480 8481
+#define BSLS_MACROINCREMENTED_VALUE8481 8482
+#define BSLS_MACROINCREMENTED_VALUE8482 8483
+#define BSLS_MACROINCREMENTED_VALUE8483 8484
+#define BSLS_MACROINCREMENTED_VALUE8484 8485
+#define BSLS_MACROINCREMENTED_VALUE8485 8486
+#define BSLS_MACROINCREMENTED_VALUE8486 8487
+#define BSLS_MACROINCREMENTED_VALUE8487 8488
+#define BSLS_MACROINCREMENTED_VALUE8488 8489
+#define BSLS_MACROINCREMENTED_VALUE8489 8490
+#define BSLS_MACROINCREMENTED_VALUE8490 8491
+#define BSLS_MACROINCREMENTED_VALUE8491 8492
+#define BSLS_MACROINCREMENTED_VALUE8492 8493
+#define BSLS_MACROINCREMENTED_VALUE8493 8494
+#define BSLS_MACROINCREMENTED_VALUE8494 8495
+#define BSLS_MACROINCREMENTED_VALUE8495 8496
+#define BSLS_MACROINCREMENTED_VALUE8496 8497
+#define BSLS_MACROINCREMENTED_VALUE8497 8498
+#define BSLS_MACROINCREMENTED_VALUE8498 8499
+#define BSLS_MACROINCREMENTED_VALUE8499 8500
+#define BSLS_MACROINCREMENTED_VALUE8500 8501
+#define BSLS_MACROINCREMENTED_VALUE8501 8502
+#define BSLS_MACROINCREMENTED_VALUE8502 8503
+#define BSLS_MACROINCREMENTED_VALUE8503 8504
+#define BSLS_MACROINCREMENTED_VALUE8504 8505
+#define BSLS_MACROINCREMENTED_VALUE8505 8506
+#define BSLS_MACROINCREMENTED_VALUE8506 8507
+#define BSLS_MACROINCREMENTED_VALUE8507 8508
+#define BSLS_MACROINCREMENTED_VALUE8508 8509
+#define BSLS_MACROINCREMENTED_VALUE8509 8510
+#define BSLS_MACROINCREMENTED_VALUE8510 8511
+#define BSLS_MACROINCREMENTED_VALUE8511 8512
+#define BSLS_MACROINCREMENTED_VALUE8512 8513
+#define BSLS_MACROINCREMENTED_VALUE8513 8514
+#define BSLS_MACROINCREMENTED_VALUE8514 8515
+#define BSLS_MACROINCREMENTED_VALUE8515 8516
+#define BSLS_MACROINCREMENTED_VALUE8516 8517
+#define BSLS_MACROINCREMENTED_VALUE8517 8518
+#define BSLS_MACROINCREMENTED_VALUE8518 8519
+#define BSLS_MACROINCREMENTED_VALUE8519 8520
+#define BSLS_MACROINCREMENTED_VALUE8520 8521
+#define BSLS_MACROINCREMENTED_VALUE8521 8522
+#define BSLS_MACROINCREMENTED_VALUE8522 8523
+#define BSLS_MACROINCREMENTED_VALUE8523 8524
+#define BSLS_MACROINCREMENTED_VALUE8524 8525
+#define BSLS_MACROINCREMENTED_VALUE8525 8526
+#define BSLS_MACROINCREMENTED_VALUE8526 8527
+#define BSLS_MACROINCREMENTED_VALUE8527 8528
+#define BSLS_MACROINCREMENTED_VALUE8528 8529
+#define BSLS_MACROINCREMENTED_VALUE8529 8530
+#define BSLS_MACROINCREMENTED_VALUE8530 8531
+#define BSLS_MACROINCREMENTED_VALUE8531 8532
+#define BSLS_MACROINCREMENTED_VALUE8532 8533
+#define BSLS_MACROINCREMENTED_VALUE8533 8534
+#define BSLS_MACROINCREMENTED_VALUE8534 8535
+#define BSLS_MACROINCREMENTED_VALUE8535 8536
+#define BSLS_MACROINCREMENTED_VALUE8536 8537
+#define BSLS_MACROINCREMENTED_VALUE8537 8538
+#define BSLS_MACROINCREMENTED_VALUE8538 8539
+#define BSLS_MACROINCREMENTED_VALUE8539 8540
+#define BSLS_MACROINCREMENTED_VALUE8540 8541
+#define BSLS_MACROINCREMENTED_VALUE8541 8542
+#define BSLS_MACROINCREMENTED_VALUE8542 8543
+#define BSLS_MACROINCREMENTED_VALUE8543 8544
+#define BSLS_MACROINCREMENTED_VALUE8544 8545
+#define BSLS_MACROINCREMENTED_VALUE8545 8546
+#define BSLS_MACROINCREMENTED_VALUE8546 8547
+#define BSLS_MACROINCREMENTED_VALUE8547 8548
+#define BSLS_MACROINCREMENTED_VALUE8548 8549
+#define BSLS_MACROINCREMENTED_VALUE8549 8550
+#define BSLS_MACROINCREMENTED_VALUE8550 8551
+#define BSLS_MACROINCREMENTED_VALUE8551 8552
+#define BSLS_MACROINCREMENTED_VALUE8552 8553
+#define BSLS_MACROINCREMENTED_VALUE8553 8554
+#define BSLS_MACROINCREMENTED_VALUE8554 8555
+#define BSLS_MACROINCREMENTED_VALUE8555 8556
+#define BSLS_MACROINCREMENTED_VALUE8556 8557
+#define BSLS_MACROINCREMENTED_VALUE8557 8558
+#define BSLS_MACROINCREMENTED_VALUE8558 8559
+#define BSLS_MACROINCREMENTED_VALUE8559 8560
+#define BSLS_MACROINCREMENTED_VALUE8560 8561
+#define BSLS_MACROINCREMENTED_VALUE8561 8562
+#define BSLS_MACROINCREMENTED_VALUE8562 8563
+#define BSLS_MACROINCREMENTED_VALUE8563 8564
+#define BSLS_MACROINCREMENTED_VALUE8564 8565
+#define BSLS_MACROINCREMENTED_VALUE8565 8566
+#define BSLS_MACROINCREMENTED_VALUE8566 8567
+#define BSLS_MACROINCREMENTED_VALUE8567 8568
+#define BSLS_MACROINCREMENTED_VALUE8568 8569
+#define BSLS_MACROINCREMENTED_VALUE8569 8570
+#define BSLS_MACROINCREMENTED_VALUE8570 8571
+#define BSLS_MACROINCREMENTED_VALUE8571 8572
+#define BSLS_MACROINCREMENTED_VALUE8572 8573
+#define BSLS_MACROINCREMENTED_VALUE8573 8574
+#define BSLS_MACROINCREMENTED_VALUE8574 8575
+#define BSLS_MACROINCREMENTED_VALUE8575 8576
+#define BSLS_MACROINCREMENTED_VALUE8576 8577
+#define BSLS_MACROINCREMENTED_VALUE8577 8578
+#define BSLS_MACROINCREMENTED_VALUE8578 8579
+#define BSLS_MACROINCREMENTED_VALUE8579 8580
+#define BSLS_MACROINCREMENTED_VALUE8580 8581
+#define BSLS_MACROINCREMENTED_VALUE8581 8582
+#define BSLS_MACROINCREMENTED_VALUE8582 8583
+#define BSLS_MACROINCREMENTED_VALUE8583 8584
+#define BSLS_MACROINCREMENTED_VALUE8584 8585
+#define BSLS_MACROINCREMENTED_VALUE8585 8586
+#define BSLS_MACROINCREMENTED_VALUE8586 8587
+#define BSLS_MACROINCREMENTED_VALUE8587 8588
+#define BSLS_MACROINCREMENTED_VALUE8588 8589
+#define BSLS_MACROINCREMENTED_VALUE8589 8590
+#define BSLS_MACROINCREMENTED_VALUE8590 8591
+#define BSLS_MACROINCREMENTED_VALUE8591 8592
+#define BSLS_MACROINCREMENTED_VALUE8592 8593
+#define BSLS_MACROINCREMENTED_VALUE8593 8594
+#define BSLS_MACROINCREMENTED_VALUE8594 8595
+#define BSLS_MACROINCREMENTED_VALUE8595 8596
+#define BSLS_MACROINCREMENTED_VALUE8596 8597
+#define BSLS_MACROINCREMENTED_VALUE8597 8598
+#define BSLS_MACROINCREMENTED_VALUE8598 8599
+#define BSLS_MACROINCREMENTED_VALUE8599 8600
+#define BSLS_MACROINCREMENTED_VALUE8600 8601
+#define BSLS_MACROINCREMENTED_VALUE8601 8602
+#define BSLS_MACROINCREMENTED_VALUE8602 8603
+#define BSLS_MACROINCREMENTED_VALUE8603 8604
+#define BSLS_MACROINCREMENTED_VALUE8604 8605
+#define BSLS_MACROINCREMENTED_VALUE8605 8606
+#define BSLS_MACROINCREMENTED_VALUE8606 8607
+#define BSLS_MACROINCREMENTED_VALUE8607 8608
+#define BSLS_MACROINCREMENTED_VALUE8608 8609
+#define BSLS_MACROINCREMENTED_VALUE8609 8610
+#define BSLS_MACROINCREMENTED_VALUE8610 8611
+#define BSLS_MACROINCREMENTED_VALUE8611 8612
+#define BSLS_MACROINCREMENTED_VALUE8612 8613
+#define BSLS_MACROINCREMENTED_VALUE8613 8614
+#define BSLS_MACROINCREMENTED_VALUE8614 8615
+#define BSLS_MACROINCREMENTED_VALUE8615 8616
+#define BSLS_MACROINCREMENTED_VALUE8616 8617
+#define BSLS_MACROINCREMENTED_VALUE8617 8618
+#define BSLS_MACROINCREMENTED_VALUE8618 8619
+#define BSLS_MACROINCREMENTED_VALUE8619 8620
+#define BSLS_MACROINCREMENTED_VALUE8620 8621
+#define BSLS_MACROINCREMENTED_VALUE8621 8622
+#define BSLS_MACROINCREMENTED_VALUE8622 8623
+#define BSLS_MACROINCREMENTED_VALUE8623 8624
+#define BSLS_MACROINCREMENTED_VALUE8624 8625
+#define BSLS_MACROINCREMENTED_VALUE8625 8626
+#define BSLS_MACROINCREMENTED_VALUE8626 8627
+#define BSLS_MACROINCREMENTED_VALUE8627 8628
+#define BSLS_MACROINCREMENTED_VALUE8628 8629
+#define BSLS_MACROINCREMENTED_VALUE8629 8630
+#define BSLS_MACROINCREMENTED_VALUE8630 8631
+#define BSLS_MACROINCREMENTED_VALUE8631 8632
+#define BSLS_MACROINCREMENTED_VALUE8632 8633
+#define BSLS_MACROINCREMENTED_VALUE8633 8634
+#define BSLS_MACROINCREMENTED_VALUE8634 8635
+#define BSLS_MACROINCREMENTED_VALUE8635 8636
+#define BSLS_MACROINCREMENTED_VALUE8636 8637
+#define BSLS_MACROINCREMENTED_VALUE8637 8638
+#define BSLS_MACROINCREMENTED_VALUE8638 8639
+#define BSLS_MACROINCREMENTED_VALUE8639 8640
+#define BSLS_MACROINCREMENTED_VALUE8640 8641
+#define BSLS_MACROINCREMENTED_VALUE8641 8642
+#define BSLS_MACROINCREMENTED_VALUE8642 8643
+#define BSLS_MACROINCREMENTED_VALUE8643 8644
+#define BSLS_MACROINCREMENTED_VALUE8644 8645
+#define BSLS_MACROINCREMENTED_VALUE8645 8646
+#define BSLS_MACROINCREMENTED_VALUE8646 8647
+#define BSLS_MACROINCREMENTED_VALUE8647 8648
+#define BSLS_MACROINCREMENTED_VALUE8648 8649
+#define BSLS_MACROINCREMENTED_VALUE8649 8650
+#define BSLS_MACROINCREMENTED_VALUE8650 8651
+#define BSLS_MACROINCREMENTED_VALUE8651 8652
+#define BSLS_MACROINCREMENTED_VALUE8652 8653
+#define BSLS_MACROINCREMENTED_VALUE8653 8654
+#define BSLS_MACROINCREMENTED_VALUE8654 8655
+#define BSLS_MACROINCREMENTED_VALUE8655 8656
+#define BSLS_MACROINCREMENTED_VALUE8656 8657
+#define BSLS_MACROINCREMENTED_VALUE8657 8658
+#define BSLS_MACROINCREMENTED_VALUE8658 8659
+#define BSLS_MACROINCREMENTED_VALUE8659 8660
+#define BSLS_MACROINCREMENTED_VALUE8660 8661
+#define BSLS_MACROINCREMENTED_VALUE8661 8662
+#define BSLS_MACROINCREMENTED_VALUE8662 8663
+#define BSLS_MACROINCREMENTED_VALUE8663 8664
+#define BSLS_MACROINCREMENTED_VALUE8664 8665
+#define BSLS_MACROINCREMENTED_VALUE8665 8666
+#define BSLS_MACROINCREMENTED_VALUE8666 8667
+#define BSLS_MACROINCREMENTED_VALUE8667 8668
+#define BSLS_MACROINCREMENTED_VALUE8668 8669
+#define BSLS_MACROINCREMENTED_VALUE8669 8670
+#define BSLS_MACROINCREMENTED_VALUE8670 8671
+#define BSLS_MACROINCREMENTED_VALUE8671 8672
+#define BSLS_MACROINCREMENTED_VALUE8672 8673
+#define BSLS_MACROINCREMENTED_VALUE8673 8674
+#define BSLS_MACROINCREMENTED_VALUE8674 8675
+#define BSLS_MACROINCREMENTED_VALUE8675 8676
+#define BSLS_MACROINCREMENTED_VALUE8676 8677
+#define BSLS_MACROINCREMENTED_VALUE8677 8678
+#define BSLS_MACROINCREMENTED_VALUE8678 8679
+#define BSLS_MACROINCREMENTED_VALUE8679 8680
+#define BSLS_MACROINCREMENTED_VALUE8680 8681
+#define BSLS_MACROINCREMENTED_VALUE8681 8682
+#define BSLS_MACROINCREMENTED_VALUE8682 8683
+#define BSLS_MACROINCREMENTED_VALUE8683 8684
+#define BSLS_MACROINCREMENTED_VALUE8684 8685
+#define BSLS_MACROINCREMENTED_VALUE8685 8686
+#define BSLS_MACROINCREMENTED_VALUE8686 8687
+#define BSLS_MACROINCREMENTED_VALUE8687 8688
+#define BSLS_MACROINCREMENTED_VALUE8688 8689
+#define BSLS_MACROINCREMENTED_VALUE8689 8690
+#define BSLS_MACROINCREMENTED_VALUE8690 8691
+#define BSLS_MACROINCREMENTED_VALUE8691 8692
+#define BSLS_MACROINCREMENTED_VALUE8692 8693
+#define BSLS_MACROINCREMENTED_VALUE8693 8694
+#define BSLS_MACROINCREMENTED_VALUE8694 8695
+#define BSLS_MACROINCREMENTED_VALUE8695 8696
+#define BSLS_MACROINCREMENTED_VALUE8696 8697
+#define BSLS_MACROINCREMENTED_VALUE8697 8698
+#define BSLS_MACROINCREMENTED_VALUE8698 8699
+#define BSLS_MACROINCREMENTED_VALUE8699 8700
+#define BSLS_MACROINCREMENTED_VALUE8700 8701
+#define BSLS_MACROINCREMENTED_VALUE8701 8702
+#define BSLS_MACROINCREMENTED_VALUE8702 8703
+#define BSLS_MACROINCREMENTED_VALUE8703 8704
+#define BSLS_MACROINCREMENTED_VALUE8704 8705
+#define BSLS_MACROINCREMENTED_VALUE8705 8706
+#define BSLS_MACROINCREMENTED_VALUE8706 8707
+#define BSLS_MACROINCREMENTED_VALUE8707 8708
+#define BSLS_MACROINCREMENTED_VALUE8708 8709
+#define BSLS_MACROINCREMENTED_VALUE8709 8710
+#define BSLS_MACROINCREMENTED_VALUE8710 8711
+#define BSLS_MACROINCREMENTED_VALUE8711 8712
+#define BSLS_MACROINCREMENTED_VALUE8712 8713
+#define BSLS_MACROINCREMENTED_VALUE8713 8714
+#define BSLS_MACROINCREMENTED_VALUE8714 8715
+#define BSLS_MACROINCREMENTED_VALUE8715 8716
+#define BSLS_MACROINCREMENTED_VALUE8716 8717
+#define BSLS_MACROINCREMENTED_VALUE8717 8718
+#define BSLS_MACROINCREMENTED_VALUE8718 8719
+#define BSLS_MACROINCREMENTED_VALUE8719 8720
+#define BSLS_MACROINCREMENTED_VALUE8720 8721
+#define BSLS_MACROINCREMENTED_VALUE8721 8722
+#define BSLS_MACROINCREMENTED_VALUE8722 8723
+#define BSLS_MACROINCREMENTED_VALUE8723 8724
+#define BSLS_MACROINCREMENTED_VALUE8724 8725
+#define BSLS_MACROINCREMENTED_VALUE8725 8726
+#define BSLS_MACROINCREMENTED_VALUE8726 8727
+#define BSLS_MACROINCREMENTED_VALUE8727 8728
+#define BSLS_MACROINCREMENTED_VALUE8728 8729
+#define BSLS_MACROINCREMENTED_VALUE8729 8730
+#define BSLS_MACROINCREMENTED_VALUE8730 8731
+#define BSLS_MACROINCREMENTED_VALUE8731 8732
+#define BSLS_MACROINCREMENTED_VALUE8732 8733
+#define BSLS_MACROINCREMENTED_VALUE8733 8734
+#define BSLS_MACROINCREMENTED_VALUE8734 8735
+#define BSLS_MACROINCREMENTED_VALUE8735 8736
+#define BSLS_MACROINCREMENTED_VALUE8736 8737
+#define BSLS_MACROINCREMENTED_VALUE8737 8738
+#define BSLS_MACROINCREMENTED_VALUE8738 8739
+#define BSLS_MACROINCREMENTED_VALUE8739 8740
+#define BSLS_MACROINCREMENTED_VALUE8740 8741
+#define BSLS_MACROINCREMENTED_VALUE8741 8742
+#define BSLS_MACROINCREMENTED_VALUE8742 8743
+#define BSLS_MACROINCREMENTED_VALUE8743 8744
+#define BSLS_MACROINCREMENTED_VALUE8744 8745
+#define BSLS_MACROINCREMENTED_VALUE8745 8746
+#define BSLS_MACROINCREMENTED_VALUE8746 8747
+#define BSLS_MACROINCREMENTED_VALUE8747 8748
+#define BSLS_MACROINCREMENTED_VALUE8748 8749
+#define BSLS_MACROINCREMENTED_VALUE8749 8750
+#define BSLS_MACROINCREMENTED_VALUE8750 8751
+#define BSLS_MACROINCREMENTED_VALUE8751 8752
+#define BSLS_MACROINCREMENTED_VALUE8752 8753
+#define BSLS_MACROINCREMENTED_VALUE8753 8754
+#define BSLS_MACROINCREMENTED_VALUE8754 8755
+#define BSLS_MACROINCREMENTED_VALUE8755 8756
+#define BSLS_MACROINCREMENTED_VALUE8756 8757
+#define BSLS_MACROINCREMENTED_VALUE8757 8758
+#define BSLS_MACROINCREMENTED_VALUE8758 8759
+#define BSLS_MACROINCREMENTED_VALUE8759 8760
+#define BSLS_MACROINCREMENTED_VALUE8760 8761
+#define BSLS_MACROINCREMENTED_VALUE8761 8762
+#define BSLS_MACROINCREMENTED_VALUE8762 8763
+#define BSLS_MACROINCREMENTED_VALUE8763 8764
+#define BSLS_MACROINCREMENTED_VALUE8764 8765
+#define BSLS_MACROINCREMENTED_VALUE8765 8766
+#define BSLS_MACROINCREMENTED_VALUE8766 8767
+#define BSLS_MACROINCREMENTED_VALUE8767 8768
+#define BSLS_MACROINCREMENTED_VALUE8768 8769
+#define BSLS_MACROINCREMENTED_VALUE8769 8770
+#define BSLS_MACROINCREMENTED_VALUE8770 8771
+#define BSLS_MACROINCREMENTED_VALUE8771 8772
+#define BSLS_MACROINCREMENTED_VALUE8772 8773
+#define BSLS_MACROINCREMENTED_VALUE8773 8774
+#define BSLS_MACROINCREMENTED_VALUE8774 8775
+#define BSLS_MACROINCREMENTED_VALUE8775 8776
+#define BSLS_MACROINCREMENTED_VALUE8776 8777
+#define BSLS_MACROINCREMENTED_VALUE8777 8778
+#define BSLS_MACROINCREMENTED_VALUE8778 8779
+#define BSLS_MACROINCREMENTED_VALUE8779 8780
+#define BSLS_MACROINCREMENTED_VALUE8780 8781
+#define BSLS_MACROINCREMENTED_VALUE8781 8782
+#define BSLS_MACROINCREMENTED_VALUE8782 8783
+#define BSLS_MACROINCREMENTED_VALUE8783 8784
+#define BSLS_MACROINCREMENTED_VALUE8784 8785
+#define BSLS_MACROINCREMENTED_VALUE8785 8786
+#define BSLS_MACROINCREMENTED_VALUE8786 8787
+#define BSLS_MACROINCREMENTED_VALUE8787 8788
+#define BSLS_MACROINCREMENTED_VALUE8788 8789
+#define BSLS_MACROINCREMENTED_VALUE8789 8790
+#define BSLS_MACROINCREMENTED_VALUE8790 8791
+#define BSLS_MACROINCREMENTED_VALUE8791 8792
+#define BSLS_MACROINCREMENTED_VALUE8792 8793
+#define BSLS_MACROINCREMENTED_VALUE8793 8794
+#define BSLS_MACROINCREMENTED_VALUE8794 8795
+#define BSLS_MACROINCREMENTED_VALUE8795 8796
+#define BSLS_MACROINCREMENTED_VALUE8796 8797
+#define BSLS_MACROINCREMENTED_VALUE8797 8798
+#define BSLS_MACROINCREMENTED_VALUE8798 8799
+#define BSLS_MACROINCREMENTED_VALUE8799 8800
+#define BSLS_MACROINCREMENTED_VALUE8800 8801
+#define BSLS_MACROINCREMENTED_VALUE8801 8802
+#define BSLS_MACROINCREMENTED_VALUE8802 8803
+#define BSLS_MACROINCREMENTED_VALUE8803 8804
+#define BSLS_MACROINCREMENTED_VALUE8804 8805
+#define BSLS_MACROINCREMENTED_VALUE8805 8806
+#define BSLS_MACROINCREMENTED_VALUE8806 8807
+#define BSLS_MACROINCREMENTED_VALUE8807 8808
+#define BSLS_MACROINCREMENTED_VALUE8808 8809
+#define BSLS_MACROINCREMENTED_VALUE8809 8810
+#define BSLS_MACROINCREMENTED_VALUE8810 8811
+#define BSLS_MACROINCREMENTED_VALUE8811 8812
+#define BSLS_MACROINCREMENTED_VALUE8812 8813
+#define BSLS_MACROINCREMENTED_VALUE8813 8814
+#define BSLS_MACROINCREMENTED_VALUE8814 8815
+#define BSLS_MACROINCREMENTED_VALUE8815 8816
+#define BSLS_MACROINCREMENTED_VALUE8816 8817
+#define BSLS_MACROINCREMENTED_VALUE8817 8818
+#define BSLS_MACROINCREMENTED_VALUE8818 8819
+#define BSLS_MACROINCREMENTED_VALUE8819 8820
+#define BSLS_MACROINCREMENTED_VALUE8820 8821
+#define BSLS_MACROINCREMENTED_VALUE8821 8822
+#define BSLS_MACROINCREMENTED_VALUE8822 8823
+#define BSLS_MACROINCREMENTED_VALUE8823 8824
+#define BSLS_MACROINCREMENTED_VALUE8824 8825
+#define BSLS_MACROINCREMENTED_VALUE8825 8826
+#define BSLS_MACROINCREMENTED_VALUE8826 8827
+#define BSLS_MACROINCREMENTED_VALUE8827 8828
+#define BSLS_MACROINCREMENTED_VALUE8828 8829
+#define BSLS_MACROINCREMENTED_VALUE8829 8830
+#define BSLS_MACROINCREMENTED_VALUE8830 8831
+#define BSLS_MACROINCREMENTED_VALUE8831 8832
+#define BSLS_MACROINCREMENTED_VALUE8832 8833
+#define BSLS_MACROINCREMENTED_VALUE8833 8834
+#define BSLS_MACROINCREMENTED_VALUE8834 8835
+#define BSLS_MACROINCREMENTED_VALUE8835 8836
+#define BSLS_MACROINCREMENTED_VALUE8836 8837
+#define BSLS_MACROINCREMENTED_VALUE8837 8838
+#define BSLS_MACROINCREMENTED_VALUE8838 8839
+#define BSLS_MACROINCREMENTED_VALUE8839 8840
+#define BSLS_MACROINCREMENTED_VALUE8840 8841
+#define BSLS_MACROINCREMENTED_VALUE8841 8842
+#define BSLS_MACROINCREMENTED_VALUE8842 8843
+#define BSLS_MACROINCREMENTED_VALUE8843 8844
+#define BSLS_MACROINCREMENTED_VALUE8844 8845
+#define BSLS_MACROINCREMENTED_VALUE8845 8846
+#define BSLS_MACROINCREMENTED_VALUE8846 8847
+#define BSLS_MACROINCREMENTED_VALUE8847 8848
+#define BSLS_MACROINCREMENTED_VALUE8848 8849
+#define BSLS_MACROINCREMENTED_VALUE8849 8850
+#define BSLS_MACROINCREMENTED_VALUE8850 8851
+#define BSLS_MACROINCREMENTED_VALUE8851 8852
+#define BSLS_MACROINCREMENTED_VALUE8852 8853
+#define BSLS_MACROINCREMENTED_VALUE8853 8854
+#define BSLS_MACROINCREMENTED_VALUE8854 8855
+#define BSLS_MACROINCREMENTED_VALUE8855 8856
+#define BSLS_MACROINCREMENTED_VALUE8856 8857
+#define BSLS_MACROINCREMENTED_VALUE8857 8858
+#define BSLS_MACROINCREMENTED_VALUE8858 8859
+#define BSLS_MACROINCREMENTED_VALUE8859 8860
+#define BSLS_MACROINCREMENTED_VALUE8860 8861
+#define BSLS_MACROINCREMENTED_VALUE8861 8862
+#define BSLS_MACROINCREMENTED_VALUE8862 8863
+#define BSLS_MACROINCREMENTED_VALUE8863 8864
+#define BSLS_MACROINCREMENTED_VALUE8864 8865
+#define BSLS_MACROINCREMENTED_VALUE8865 8866
+#define BSLS_MACROINCREMENTED_VALUE8866 8867
+#define BSLS_MACROINCREMENTED_VALUE8867 8868
+#define BSLS_MACROINCREMENTED_VALUE8868 8869
+#define BSLS_MACROINCREMENTED_VALUE8869 8870
+#define BSLS_MACROINCREMENTED_VALUE8870 8871
+#define BSLS_MACROINCREMENTED_VALUE8871 8872
+#define BSLS_MACROINCREMENTED_VALUE8872 8873
+#define BSLS_MACROINCREMENTED_VALUE8873 8874
+#define BSLS_MACROINCREMENTED_VALUE8874 8875
+#define BSLS_MACROINCREMENTED_VALUE8875 8876
+#define BSLS_MACROINCREMENTED_VALUE8876 8877
+#define BSLS_MACROINCREMENTED_VALUE8877 8878
+#define BSLS_MACROINCREMENTED_VALUE8878 8879
+#define BSLS_MACROINCREMENTED_VALUE8879 8880
+#define BSLS_MACROINCREMENTED_VALUE8880 8881
+#define BSLS_MACROINCREMENTED_VALUE8881 8882
+#define BSLS_MACROINCREMENTED_VALUE8882 8883
+#define BSLS_MACROINCREMENTED_VALUE8883 8884
+#define BSLS_MACROINCREMENTED_VALUE8884 8885
+#define BSLS_MACROINCREMENTED_VALUE8885 8886
+#define BSLS_MACROINCREMENTED_VALUE8886 8887
+#define BSLS_MACROINCREMENTED_VALUE8887 8888
+#define BSLS_MACROINCREMENTED_VALUE8888 8889
+#define BSLS_MACROINCREMENTED_VALUE8889 8890
+#define BSLS_MACROINCREMENTED_VALUE8890 8891
+#define BSLS_MACROINCREMENTED_VALUE8891 8892
+#define BSLS_MACROINCREMENTED_VALUE8892 8893
+#define BSLS_MACROINCREMENTED_VALUE8893 8894
+#define BSLS_MACROINCREMENTED_VALUE8894 8895
+#define BSLS_MACROINCREMENTED_VALUE8895 8896
+#define BSLS_MACROINCREMENTED_VALUE8896 8897
+#define BSLS_MACROINCREMENTED_VALUE8897 8898
+#define BSLS_MACROINCREMENTED_VALUE8898 8899
+#define BSLS_MACROINCREMENTED_VALUE8899 8900
+#define BSLS_MACROINCREMENTED_VALUE8900 8901
+#define BSLS_MACROINCREMENTED_VALUE8901 8902
+#define BSLS_MACROINCREMENTED_VALUE8902 8903
+#define BSLS_MACROINCREMENTED_VALUE8903 8904
+#define BSLS_MACROINCREMENTED_VALUE8904 8905
+#define BSLS_MACROINCREMENTED_VALUE8905 8906
+#define BSLS_MACROINCREMENTED_VALUE8906 8907
+#define BSLS_MACROINCREMENTED_VALUE8907 8908
+#define BSLS_MACROINCREMENTED_VALUE8908 8909
+#define BSLS_MACROINCREMENTED_VALUE8909 8910
+#define BSLS_MACROINCREMENTED_VALUE8910 8911
+#define BSLS_MACROINCREMENTED_VALUE8911 8912
+#define BSLS_MACROINCREMENTED_VALUE8912 8913
+#define BSLS_MACROINCREMENTED_VALUE8913 8914
+#define BSLS_MACROINCREMENTED_VALUE8914 8915
+#define BSLS_MACROINCREMENTED_VALUE8915 8916
+#define BSLS_MACROINCREMENTED_VALUE8916 8917
+#define BSLS_MACROINCREMENTED_VALUE8917 8918
+#define BSLS_MACROINCREMENTED_VALUE8918 8919
+#define BSLS_MACROINCREMENTED_VALUE8919 8920
+#define BSLS_MACROINCREMENTED_VALUE8920 8921
+#define BSLS_MACROINCREMENTED_VALUE8921 8922
+#define BSLS_MACROINCREMENTED_VALUE8922 8923
+#define BSLS_MACROINCREMENTED_VALUE8923 8924
+#define BSLS_MACROINCREMENTED_VALUE8924 8925
+#define BSLS_MACROINCREMENTED_VALUE8925 8926
+#define BSLS_MACROINCREMENTED_VALUE8926 8927
+#define BSLS_MACROINCREMENTED_VALUE8927 8928
+#define BSLS_MACROINCREMENTED_VALUE8928 8929
+#define BSLS_MACROINCREMENTED_VALUE8929 8930
+#define BSLS_MACROINCREMENTED_VALUE8930 8931
+#define BSLS_MACROINCREMENTED_VALUE8931 8932
+#define BSLS_MACROINCREMENTED_VALUE8932 8933
+#define BSLS_MACROINCREMENTED_VALUE8933 8934
+#define BSLS_MACROINCREMENTED_VALUE8934 8935
+#define BSLS_MACROINCREMENTED_VALUE8935 8936
+#define BSLS_MACROINCREMENTED_VALUE8936 8937
+#define BSLS_MACROINCREMENTED_VALUE8937 8938
+#define BSLS_MACROINCREMENTED_VALUE8938 8939
+#define BSLS_MACROINCREMENTED_VALUE8939 8940
+#define BSLS_MACROINCREMENTED_VALUE8940 8941
+#define BSLS_MACROINCREMENTED_VALUE8941 8942
+#define BSLS_MACROINCREMENTED_VALUE8942 8943
+#define BSLS_MACROINCREMENTED_VALUE8943 8944
+#define BSLS_MACROINCREMENTED_VALUE8944 8945
+#define BSLS_MACROINCREMENTED_VALUE8945 8946
+#define BSLS_MACROINCREMENTED_VALUE8946 8947
+#define BSLS_MACROINCREMENTED_VALUE8947 8948
+#define BSLS_MACROINCREMENTED_VALUE8948 8949
+#define BSLS_MACROINCREMENTED_VALUE8949 8950
+#define BSLS_MACROINCREMENTED_VALUE8950 8951
+#define BSLS_MACROINCREMENTED_VALUE8951 8952
+#define BSLS_MACROINCREMENTED_VALUE8952 8953
+#define BSLS_MACROINCREMENTED_VALUE8953 8954
+#define BSLS_MACROINCREMENTED_VALUE8954 8955
+#define BSLS_MACROINCREMENTED_VALUE8955 8956
+#define BSLS_MACROINCREMENTED_VALUE8956 8957
+#define BSLS_MACROINCREMENTED_VALUE8957 8958
+#define BSLS_MACROINCREMENTED_VALUE8958 8959
+#define BSLS_MACROINCREMENTED_VALUE8959 8960
+#define BSLS_MACROINCREMENTED_VALUE8960 8961
+#define BSLS_MACROINCREMENTED_VALUE8961 8962
+#define BSLS_MACROINCREMENTED_VALUE8962 8963
+#define BSLS_MACROINCREMENTED_VALUE8963 8964
+#define BSLS_MACROINCREMENTED_VALUE8964 8965
+#define BSLS_MACROINCREMENTED_VALUE8965 8966
+#define BSLS_MACROINCREMENTED_VALUE8966 8967
+#define BSLS_MACROINCREMENTED_VALUE8967 8968
+#define BSLS_MACROINCREMENTED_VALUE8968 8969
+#define BSLS_MACROINCREMENTED_VALUE8969 8970
+#define BSLS_MACROINCREMENTED_VALUE8970 8971
+#define BSLS_MACROINCREMENTED_VALUE8971 8972
+#define BSLS_MACROINCREMENTED_VALUE8972 8973
+#define BSLS_MACROINCREMENTED_VALUE8973 8974
+#define BSLS_MACROINCREMENTED_VALUE8974 8975
+#define BSLS_MACROINCREMENTED_VALUE8975 8976
+#define BSLS_MACROINCREMENTED_VALUE8976 8977
+#define BSLS_MACROINCREMENTED_VALUE8977 8978
+#define BSLS_MACROINCREMENTED_VALUE8978 8979
+#define BSLS_MACROINCREMENTED_VALUE8979 8980
+#define BSLS_MACROINCREMENTED_VALUE8980 8981
+#define BSLS_MACROINCREMENTED_VALUE8981 8982
+#define BSLS_MACROINCREMENTED_VALUE8982 8983
+#define BSLS_MACROINCREMENTED_VALUE8983 8984
+#define BSLS_MACROINCREMENTED_VALUE8984 8985
+#define BSLS_MACROINCREMENTED_VALUE8985 8986
+#define BSLS_MACROINCREMENTED_VALUE8986 8987
+#define BSLS_MACROINCREMENTED_VALUE8987 8988
+#define BSLS_MACROINCREMENTED_VALUE8988 8989
+#define BSLS_MACROINCREMENTED_VALUE8989 8990
+#define BSLS_MACROINCREMENTED_VALUE8990 8991
+#define BSLS_MACROINCREMENTED_VALUE8991 8992
+#define BSLS_MACROINCREMENTED_VALUE8992 8993
+#define BSLS_MACROINCREMENTED_VALUE8993 8994
+#define BSLS_MACROINCREMENTED_VALUE8994 8995
+#define BSLS_MACROINCREMENTED_VALUE8995 8996
+#define BSLS_MACROINCREMENTED_VALUE8996 8997
+#define BSLS_MACROINCREMENTED_VALUE8997 8998
+#define BSLS_MACROINCREMENTED_VALUE8998 8999
+#define BSLS_MACROINCREMENTED_VALUE8999 9000
+#define BSLS_MACROINCREMENTED_VALUE9000 9001
+#define BSLS_MACROINCREMENTED_VALUE9001 9002
+#define BSLS_MACROINCREMENTED_VALUE9002 9003
+#define BSLS_MACROINCREMENTED_VALUE9003 9004
+#define BSLS_MACROINCREMENTED_VALUE9004 9005
+#define BSLS_MACROINCREMENTED_VALUE9005 9006
+#define BSLS_MACROINCREMENTED_VALUE9006 9007
+#define BSLS_MACROINCREMENTED_VALUE9007 9008
+#define BSLS_MACROINCREMENTED_VALUE9008 9009
+#define BSLS_MACROINCREMENTED_VALUE9009 9010
+#define BSLS_MACROINCREMENTED_VALUE9010 9011
+#define BSLS_MACROINCREMENTED_VALUE9011 9012
+#define BSLS_MACROINCREMENTED_VALUE9012 9013
+#define BSLS_MACROINCREMENTED_VALUE9013 9014
+#define BSLS_MACROINCREMENTED_VALUE9014 9015
+#define BSLS_MACROINCREMENTED_VALUE9015 9016
+#define BSLS_MACROINCREMENTED_VALUE9016 9017
+#define BSLS_MACROINCREMENTED_VALUE9017 9018
+#define BSLS_MACROINCREMENTED_VALUE9018 9019
+#define BSLS_MACROINCREMENTED_VALUE9019 9020
+#define BSLS_MACROINCREMENTED_VALUE9020 9021
+#define BSLS_MACROINCREMENTED_VALUE9021 9022
+#define BSLS_MACROINCREMENTED_VALUE9022 9023
+#define BSLS_MACROINCREMENTED_VALUE9023 9024
+#define BSLS_MACROINCREMENTED_VALUE9024 9025
+#define BSLS_MACROINCREMENTED_VALUE9025 9026
+#define BSLS_MACROINCREMENTED_VALUE9026 9027
+#define BSLS_MACROINCREMENTED_VALUE9027 9028
+#define BSLS_MACROINCREMENTED_VALUE9028 9029
+#define BSLS_MACROINCREMENTED_VALUE9029 9030
+#define BSLS_MACROINCREMENTED_VALUE9030 9031
+#define BSLS_MACROINCREMENTED_VALUE9031 9032
+#define BSLS_MACROINCREMENTED_VALUE9032 9033
+#define BSLS_MACROINCREMENTED_VALUE9033 9034
+#define BSLS_MACROINCREMENTED_VALUE9034 9035
+#define BSLS_MACROINCREMENTED_VALUE9035 9036
+#define BSLS_MACROINCREMENTED_VALUE9036 9037
+#define BSLS_MACROINCREMENTED_VALUE9037 9038
+#define BSLS_MACROINCREMENTED_VALUE9038 9039
+#define BSLS_MACROINCREMENTED_VALUE9039 9040
+#define BSLS_MACROINCREMENTED_VALUE9040 9041
+#define BSLS_MACROINCREMENTED_VALUE9041 9042
+#define BSLS_MACROINCREMENTED_VALUE9042 9043
+#define BSLS_MACROINCREMENTED_VALUE9043 9044
+#define BSLS_MACROINCREMENTED_VALUE9044 9045
+#define BSLS_MACROINCREMENTED_VALUE9045 9046
+#define BSLS_MACROINCREMENTED_VALUE9046 9047
+#define BSLS_MACROINCREMENTED_VALUE9047 9048
+#define BSLS_MACROINCREMENTED_VALUE9048 9049
+#define BSLS_MACROINCREMENTED_VALUE9049 9050
+#define BSLS_MACROINCREMENTED_VALUE9050 9051
+#define BSLS_MACROINCREMENTED_VALUE9051 9052
+#define BSLS_MACROINCREMENTED_VALUE9052 9053
+#define BSLS_MACROINCREMENTED_VALUE9053 9054
+#define BSLS_MACROINCREMENTED_VALUE9054 9055
+#define BSLS_MACROINCREMENTED_VALUE9055 9056
+#define BSLS_MACROINCREMENTED_VALUE9056 9057
+#define BSLS_MACROINCREMENTED_VALUE9057 9058
+#define BSLS_MACROINCREMENTED_VALUE9058 9059
+#define BSLS_MACROINCREMENTED_VALUE9059 9060
+#define BSLS_MACROINCREMENTED_VALUE9060 9061
+#define BSLS_MACROINCREMENTED_VALUE9061 9062
+#define BSLS_MACROINCREMENTED_VALUE9062 9063
+#define BSLS_MACROINCREMENTED_VALUE9063 9064
+#define BSLS_MACROINCREMENTED_VALUE9064 9065
+#define BSLS_MACROINCREMENTED_VALUE9065 9066
+#define BSLS_MACROINCREMENTED_VALUE9066 9067
+#define BSLS_MACROINCREMENTED_VALUE9067 9068
+#define BSLS_MACROINCREMENTED_VALUE9068 9069
+#define BSLS_MACROINCREMENTED_VALUE9069 9070
+#define BSLS_MACROINCREMENTED_VALUE9070 9071
+#define BSLS_MACROINCREMENTED_VALUE9071 9072
+#define BSLS_MACROINCREMENTED_VALUE9072 9073
+#define BSLS_MACROINCREMENTED_VALUE9073 9074
+#define BSLS_MACROINCREMENTED_VALUE9074 9075
+#define BSLS_MACROINCREMENTED_VALUE9075 9076
+#define BSLS_MACROINCREMENTED_VALUE9076 9077
+#define BSLS_MACROINCREMENTED_VALUE9077 9078
+#define BSLS_MACROINCREMENTED_VALUE9078 9079
+#define BSLS_MACROINCREMENTED_VALUE9079 9080
+#define BSLS_MACROINCREMENTED_VALUE9080 9081
+#define BSLS_MACROINCREMENTED_VALUE9081 9082
+#define BSLS_MACROINCREMENTED_VALUE9082 9083
+#define BSLS_MACROINCREMENTED_VALUE9083 9084
+#define BSLS_MACROINCREMENTED_VALUE9084 9085
+#define BSLS_MACROINCREMENTED_VALUE9085 9086
+#define BSLS_MACROINCREMENTED_VALUE9086 9087
+#define BSLS_MACROINCREMENTED_VALUE9087 9088
+#define BSLS_MACROINCREMENTED_VALUE9088 9089
+#define BSLS_MACROINCREMENTED_VALUE9089 9090
+#define BSLS_MACROINCREMENTED_VALUE9090 9091
+#define BSLS_MACROINCREMENTED_VALUE9091 9092
+#define BSLS_MACROINCREMENTED_VALUE9092 9093
+#define BSLS_MACROINCREMENTED_VALUE9093 9094
+#define BSLS_MACROINCREMENTED_VALUE9094 9095
+#define BSLS_MACROINCREMENTED_VALUE9095 9096
+#define BSLS_MACROINCREMENTED_VALUE9096 9097
+#define BSLS_MACROINCREMENTED_VALUE9097 9098
+#define BSLS_MACROINCREMENTED_VALUE9098 9099
+#define BSLS_MACROINCREMENTED_VALUE9099 9100
+#define BSLS_MACROINCREMENTED_VALUE9100 9101
+#define BSLS_MACROINCREMENTED_VALUE9101 9102
+#define BSLS_MACROINCREMENTED_VALUE9102 9103
+#define BSLS_MACROINCREMENTED_VALUE9103 9104
+#define BSLS_MACROINCREMENTED_VALUE9104 9105
+#define BSLS_MACROINCREMENTED_VALUE9105 9106
+#define BSLS_MACROINCREMENTED_VALUE9106 9107
+#define BSLS_MACROINCREMENTED_VALUE9107 9108
+#define BSLS_MACROINCREMENTED_VALUE9108 9109
+#define BSLS_MACROINCREMENTED_VALUE9109 9110
+#define BSLS_MACROINCREMENTED_VALUE9110 9111
+#define BSLS_MACROINCREMENTED_VALUE9111 9112
+#define BSLS_MACROINCREMENTED_VALUE9112 9113
+#define BSLS_MACROINCREMENTED_VALUE9113 9114
+#define BSLS_MACROINCREMENTED_VALUE9114 9115
+#define BSLS_MACROINCREMENTED_VALUE9115 9116
+#define BSLS_MACROINCREMENTED_VALUE9116 9117
+#define BSLS_MACROINCREMENTED_VALUE9117 9118
+#define BSLS_MACROINCREMENTED_VALUE9118 9119
+#define BSLS_MACROINCREMENTED_VALUE9119 9120
+#define BSLS_MACROINCREMENTED_VALUE9120 9121
+#define BSLS_MACROINCREMENTED_VALUE9121 9122
+#define BSLS_MACROINCREMENTED_VALUE9122 9123
+#define BSLS_MACROINCREMENTED_VALUE9123 9124
+#define BSLS_MACROINCREMENTED_VALUE9124 9125
+#define BSLS_MACROINCREMENTED_VALUE9125 9126
+#define BSLS_MACROINCREMENTED_VALUE9126 9127
+#define BSLS_MACROINCREMENTED_VALUE9127 9128
+#define BSLS_MACROINCREMENTED_VALUE9128 9129
+#define BSLS_MACROINCREMENTED_VALUE9129 9130
+#define BSLS_MACROINCREMENTED_VALUE9130 9131
+#define BSLS_MACROINCREMENTED_VALUE9131 9132
+#define BSLS_MACROINCREMENTED_VALUE9132 9133
+#define BSLS_MACROINCREMENTED_VALUE9133 9134
+#define BSLS_MACROINCREMENTED_VALUE9134 9135
+#define BSLS_MACROINCREMENTED_VALUE9135 9136
+#define BSLS_MACROINCREMENTED_VALUE9136 9137
+#define BSLS_MACROINCREMENTED_VALUE9137 9138
+#define BSLS_MACROINCREMENTED_VALUE9138 9139
+#define BSLS_MACROINCREMENTED_VALUE9139 9140
+#define BSLS_MACROINCREMENTED_VALUE9140 9141
+#define BSLS_MACROINCREMENTED_VALUE9141 9142
+#define BSLS_MACROINCREMENTED_VALUE9142 9143
+#define BSLS_MACROINCREMENTED_VALUE9143 9144
+#define BSLS_MACROINCREMENTED_VALUE9144 9145
+#define BSLS_MACROINCREMENTED_VALUE9145 9146
+#define BSLS_MACROINCREMENTED_VALUE9146 9147
+#define BSLS_MACROINCREMENTED_VALUE9147 9148
+#define BSLS_MACROINCREMENTED_VALUE9148 9149
+#define BSLS_MACROINCREMENTED_VALUE9149 9150
+#define BSLS_MACROINCREMENTED_VALUE9150 9151
+#define BSLS_MACROINCREMENTED_VALUE9151 9152
+#define BSLS_MACROINCREMENTED_VALUE9152 9153
+#define BSLS_MACROINCREMENTED_VALUE9153 9154
+#define BSLS_MACROINCREMENTED_VALUE9154 9155
+#define BSLS_MACROINCREMENTED_VALUE9155 9156
+#define BSLS_MACROINCREMENTED_VALUE9156 9157
+#define BSLS_MACROINCREMENTED_VALUE9157 9158
+#define BSLS_MACROINCREMENTED_VALUE9158 9159
+#define BSLS_MACROINCREMENTED_VALUE9159 9160
+#define BSLS_MACROINCREMENTED_VALUE9160 9161
+#define BSLS_MACROINCREMENTED_VALUE9161 9162
+#define BSLS_MACROINCREMENTED_VALUE9162 9163
+#define BSLS_MACROINCREMENTED_VALUE9163 9164
+#define BSLS_MACROINCREMENTED_VALUE9164 9165
+#define BSLS_MACROINCREMENTED_VALUE9165 9166
+#define BSLS_MACROINCREMENTED_VALUE9166 9167
+#define BSLS_MACROINCREMENTED_VALUE9167 9168
+#define BSLS_MACROINCREMENTED_VALUE9168 9169
+#define BSLS_MACROINCREMENTED_VALUE9169 9170
+#define BSLS_MACROINCREMENTED_VALUE9170 9171
+#define BSLS_MACROINCREMENTED_VALUE9171 9172
+#define BSLS_MACROINCREMENTED_VALUE9172 9173
+#define BSLS_MACROINCREMENTED_VALUE9173 9174
+#define BSLS_MACROINCREMENTED_VALUE9174 9175
+#define BSLS_MACROINCREMENTED_VALUE9175 9176
+#define BSLS_MACROINCREMENTED_VALUE9176 9177
+#define BSLS_MACROINCREMENTED_VALUE9177 9178
+#define BSLS_MACROINCREMENTED_VALUE9178 9179
+#define BSLS_MACROINCREMENTED_VALUE9179 9180
+#define BSLS_MACROINCREMENTED_VALUE9180 9181
+#define BSLS_MACROINCREMENTED_VALUE9181 9182
+#define BSLS_MACROINCREMENTED_VALUE9182 9183
+#define BSLS_MACROINCREMENTED_VALUE9183 9184
+#define BSLS_MACROINCREMENTED_VALUE9184 9185
+#define BSLS_MACROINCREMENTED_VALUE9185 9186
+#define BSLS_MACROINCREMENTED_VALUE9186 9187
+#define BSLS_MACROINCREMENTED_VALUE9187 9188
+#define BSLS_MACROINCREMENTED_VALUE9188 9189
+#define BSLS_MACROINCREMENTED_VALUE9189 9190
+#define BSLS_MACROINCREMENTED_VALUE9190 9191
+#define BSLS_MACROINCREMENTED_VALUE9191 9192
+#define BSLS_MACROINCREMENTED_VALUE9192 9193
+#define BSLS_MACROINCREMENTED_VALUE9193 9194
+#define BSLS_MACROINCREMENTED_VALUE9194 9195
+#define BSLS_MACROINCREMENTED_VALUE9195 9196
+#define BSLS_MACROINCREMENTED_VALUE9196 9197
+#define BSLS_MACROINCREMENTED_VALUE9197 9198
+#define BSLS_MACROINCREMENTED_VALUE9198 9199
+#define BSLS_MACROINCREMENTED_VALUE9199 9200
+#define BSLS_MACROINCREMENTED_VALUE9200 9201
+#define BSLS_MACROINCREMENTED_VALUE9201 9202
+#define BSLS_MACROINCREMENTED_VALUE9202 9203
+#define BSLS_MACROINCREMENTED_VALUE9203 9204
+#define BSLS_MACROINCREMENTED_VALUE9204 9205
+#define BSLS_MACROINCREMENTED_VALUE9205 9206
+#define BSLS_MACROINCREMENTED_VALUE9206 9207
+#define BSLS_MACROINCREMENTED_VALUE9207 9208
+#define BSLS_MACROINCREMENTED_VALUE9208 9209
+#define BSLS_MACROINCREMENTED_VALUE9209 9210
+#define BSLS_MACROINCREMENTED_VALUE9210 9211
+#define BSLS_MACROINCREMENTED_VALUE9211 9212
+#define BSLS_MACROINCREMENTED_VALUE9212 9213
+#define BSLS_MACROINCREMENTED_VALUE9213 9214
+#define BSLS_MACROINCREMENTED_VALUE9214 9215
+#define BSLS_MACROINCREMENTED_VALUE9215 9216
+#define BSLS_MACROINCREMENTED_VALUE9216 9217
+#define BSLS_MACROINCREMENTED_VALUE9217 9218
+#define BSLS_MACROINCREMENTED_VALUE9218 9219
+#define BSLS_MACROINCREMENTED_VALUE9219 9220
+#define BSLS_MACROINCREMENTED_VALUE9220 9221
+#define BSLS_MACROINCREMENTED_VALUE9221 9222
+#define BSLS_MACROINCREMENTED_VALUE9222 9223
+#define BSLS_MACROINCREMENTED_VALUE9223 9224
+#define BSLS_MACROINCREMENTED_VALUE9224 9225
+#define BSLS_MACROINCREMENTED_VALUE9225 9226
+#define BSLS_MACROINCREMENTED_VALUE9226 9227
+#define BSLS_MACROINCREMENTED_VALUE9227 9228
+#define BSLS_MACROINCREMENTED_VALUE9228 9229
+#define BSLS_MACROINCREMENTED_VALUE9229 9230
+#define BSLS_MACROINCREMENTED_VALUE9230 9231
+#define BSLS_MACROINCREMENTED_VALUE9231 9232
+#define BSLS_MACROINCREMENTED_VALUE9232 9233
+#define BSLS_MACROINCREMENTED_VALUE9233 9234
+#define BSLS_MACROINCREMENTED_VALUE9234 9235
+#define BSLS_MACROINCREMENTED_VALUE9235 9236
+#define BSLS_MACROINCREMENTED_VALUE9236 9237
+#define BSLS_MACROINCREMENTED_VALUE9237 9238
+#define BSLS_MACROINCREMENTED_VALUE9238 9239
+#define BSLS_MACROINCREMENTED_VALUE9239 9240
+#define BSLS_MACROINCREMENTED_VALUE9240 9241
+#define BSLS_MACROINCREMENTED_VALUE9241 9242
+#define BSLS_MACROINCREMENTED_VALUE9242 9243
+#define BSLS_MACROINCREMENTED_VALUE9243 9244
+#define BSLS_MACROINCREMENTED_VALUE9244 9245
+#define BSLS_MACROINCREMENTED_VALUE9245 9246
+#define BSLS_MACROINCREMENTED_VALUE9246 9247
+#define BSLS_MACROINCREMENTED_VALUE9247 9248
+#define BSLS_MACROINCREMENTED_VALUE9248 9249
+#define BSLS_MACROINCREMENTED_VALUE9249 9250
+#define BSLS_MACROINCREMENTED_VALUE9250 9251
+#define BSLS_MACROINCREMENTED_VALUE9251 9252
+#define BSLS_MACROINCREMENTED_VALUE9252 9253
+#define BSLS_MACROINCREMENTED_VALUE9253 9254
+#define BSLS_MACROINCREMENTED_VALUE9254 9255
+#define BSLS_MACROINCREMENTED_VALUE9255 9256
+#define BSLS_MACROINCREMENTED_VALUE9256 9257
+#define BSLS_MACROINCREMENTED_VALUE9257 9258
+#define BSLS_MACROINCREMENTED_VALUE9258 9259
+#define BSLS_MACROINCREMENTED_VALUE9259 9260
+#define BSLS_MACROINCREMENTED_VALUE9260 9261
+#define BSLS_MACROINCREMENTED_VALUE9261 9262
+#define BSLS_MACROINCREMENTED_VALUE9262 9263
+#define BSLS_MACROINCREMENTED_VALUE9263 9264
+#define BSLS_MACROINCREMENTED_VALUE9264 9265
+#define BSLS_MACROINCREMENTED_VALUE9265 9266
+#define BSLS_MACROINCREMENTED_VALUE9266 9267
+#define BSLS_MACROINCREMENTED_VALUE9267 9268
+#define BSLS_MACROINCREMENTED_VALUE9268 9269
+#define BSLS_MACROINCREMENTED_VALUE9269 9270
+#define BSLS_MACROINCREMENTED_VALUE9270 9271
+#define BSLS_MACROINCREMENTED_VALUE9271 9272
+#define BSLS_MACROINCREMENTED_VALUE9272 9273
+#define BSLS_MACROINCREMENTED_VALUE9273 9274
+#define BSLS_MACROINCREMENTED_VALUE9274 9275
+#define BSLS_MACROINCREMENTED_VALUE9275 9276
+#define BSLS_MACROINCREMENTED_VALUE9276 9277
+#define BSLS_MACROINCREMENTED_VALUE9277 9278
+#define BSLS_MACROINCREMENTED_VALUE9278 9279
+#define BSLS_MACROINCREMENTED_VALUE9279 9280
+#define BSLS_MACROINCREMENTED_VALUE9280 9281
+#define BSLS_MACROINCREMENTED_VALUE9281 9282
+#define BSLS_MACROINCREMENTED_VALUE9282 9283
+#define BSLS_MACROINCREMENTED_VALUE9283 9284
+#define BSLS_MACROINCREMENTED_VALUE9284 9285
+#define BSLS_MACROINCREMENTED_VALUE9285 9286
+#define BSLS_MACROINCREMENTED_VALUE9286 9287
+#define BSLS_MACROINCREMENTED_VALUE9287 9288
+#define BSLS_MACROINCREMENTED_VALUE9288 9289
+#define BSLS_MACROINCREMENTED_VALUE9289 9290
+#define BSLS_MACROINCREMENTED_VALUE9290 9291
+#define BSLS_MACROINCREMENTED_VALUE9291 9292
+#define BSLS_MACROINCREMENTED_VALUE9292 9293
+#define BSLS_MACROINCREMENTED_VALUE9293 9294
+#define BSLS_MACROINCREMENTED_VALUE9294 9295
+#define BSLS_MACROINCREMENTED_VALUE9295 9296
+#define BSLS_MACROINCREMENTED_VALUE9296 9297
+#define BSLS_MACROINCREMENTED_VALUE9297 9298
+#define BSLS_MACROINCREMENTED_VALUE9298 9299
+#define BSLS_MACROINCREMENTED_VALUE9299 9300
+#define BSLS_MACROINCREMENTED_VALUE9300 9301
+#define BSLS_MACROINCREMENTED_VALUE9301 9302
+#define BSLS_MACROINCREMENTED_VALUE9302 9303
+#define BSLS_MACROINCREMENTED_VALUE9303 9304
+#define BSLS_MACROINCREMENTED_VALUE9304 9305
+#define BSLS_MACROINCREMENTED_VALUE9305 9306
+#define BSLS_MACROINCREMENTED_VALUE9306 9307
+#define BSLS_MACROINCREMENTED_VALUE9307 9308
+#define BSLS_MACROINCREMENTED_VALUE9308 9309
+#define BSLS_MACROINCREMENTED_VALUE9309 9310
+#define BSLS_MACROINCREMENTED_VALUE9310 9311
+#define BSLS_MACROINCREMENTED_VALUE9311 9312
+#define BSLS_MACROINCREMENTED_VALUE9312 9313
+#define BSLS_MACROINCREMENTED_VALUE9313 9314
+#define BSLS_MACROINCREMENTED_VALUE9314 9315
+#define BSLS_MACROINCREMENTED_VALUE9315 9316
+#define BSLS_MACROINCREMENTED_VALUE9316 9317
+#define BSLS_MACROINCREMENTED_VALUE9317 9318
+#define BSLS_MACROINCREMENTED_VALUE9318 9319
+#define BSLS_MACROINCREMENTED_VALUE9319 9320
+#define BSLS_MACROINCREMENTED_VALUE9320 9321
+#define BSLS_MACROINCREMENTED_VALUE9321 9322
+#define BSLS_MACROINCREMENTED_VALUE9322 9323
+#define BSLS_MACROINCREMENTED_VALUE9323 9324
+#define BSLS_MACROINCREMENTED_VALUE9324 9325
+#define BSLS_MACROINCREMENTED_VALUE9325 9326
+#define BSLS_MACROINCREMENTED_VALUE9326 9327
+#define BSLS_MACROINCREMENTED_VALUE9327 9328
+#define BSLS_MACROINCREMENTED_VALUE9328 9329
+#define BSLS_MACROINCREMENTED_VALUE9329 9330
+#define BSLS_MACROINCREMENTED_VALUE9330 9331
+#define BSLS_MACROINCREMENTED_VALUE9331 9332
+#define BSLS_MACROINCREMENTED_VALUE9332 9333
+#define BSLS_MACROINCREMENTED_VALUE9333 9334
+#define BSLS_MACROINCREMENTED_VALUE9334 9335
+#define BSLS_MACROINCREMENTED_VALUE9335 9336
+#define BSLS_MACROINCREMENTED_VALUE9336 9337
+#define BSLS_MACROINCREMENTED_VALUE9337 9338
+#define BSLS_MACROINCREMENTED_VALUE9338 9339
+#define BSLS_MACROINCREMENTED_VALUE9339 9340
+#define BSLS_MACROINCREMENTED_VALUE9340 9341
+#define BSLS_MACROINCREMENTED_VALUE9341 9342
+#define BSLS_MACROINCREMENTED_VALUE9342 9343
+#define BSLS_MACROINCREMENTED_VALUE9343 9344
+#define BSLS_MACROINCREMENTED_VALUE9344 9345
+#define BSLS_MACROINCREMENTED_VALUE9345 9346
+#define BSLS_MACROINCREMENTED_VALUE9346 9347
+#define BSLS_MACROINCREMENTED_VALUE9347 9348
+#define BSLS_MACROINCREMENTED_VALUE9348 9349
+#define BSLS_MACROINCREMENTED_VALUE9349 9350
+#define BSLS_MACROINCREMENTED_VALUE9350 9351
+#define BSLS_MACROINCREMENTED_VALUE9351 9352
+#define BSLS_MACROINCREMENTED_VALUE9352 9353
+#define BSLS_MACROINCREMENTED_VALUE9353 9354
+#define BSLS_MACROINCREMENTED_VALUE9354 9355
+#define BSLS_MACROINCREMENTED_VALUE9355 9356
+#define BSLS_MACROINCREMENTED_VALUE9356 9357
+#define BSLS_MACROINCREMENTED_VALUE9357 9358
+#define BSLS_MACROINCREMENTED_VALUE9358 9359
+#define BSLS_MACROINCREMENTED_VALUE9359 9360
+#define BSLS_MACROINCREMENTED_VALUE9360 9361
+#define BSLS_MACROINCREMENTED_VALUE9361 9362
+#define BSLS_MACROINCREMENTED_VALUE9362 9363
+#define BSLS_MACROINCREMENTED_VALUE9363 9364
+#define BSLS_MACROINCREMENTED_VALUE9364 9365
+#define BSLS_MACROINCREMENTED_VALUE9365 9366
+#define BSLS_MACROINCREMENTED_VALUE9366 9367
+#define BSLS_MACROINCREMENTED_VALUE9367 9368
+#define BSLS_MACROINCREMENTED_VALUE9368 9369
+#define BSLS_MACROINCREMENTED_VALUE9369 9370
+#define BSLS_MACROINCREMENTED_VALUE9370 9371
+#define BSLS_MACROINCREMENTED_VALUE9371 9372
+#define BSLS_MACROINCREMENTED_VALUE9372 9373
+#define BSLS_MACROINCREMENTED_VALUE9373 9374
+#define BSLS_MACROINCREMENTED_VALUE9374 9375
+#define BSLS_MACROINCREMENTED_VALUE9375 9376
+#define BSLS_MACROINCREMENTED_VALUE9376 9377
+#define BSLS_MACROINCREMENTED_VALUE9377 9378
+#define BSLS_MACROINCREMENTED_VALUE9378 9379
+#define BSLS_MACROINCREMENTED_VALUE9379 9380
+#define BSLS_MACROINCREMENTED_VALUE9380 9381
+#define BSLS_MACROINCREMENTED_VALUE9381 9382
+#define BSLS_MACROINCREMENTED_VALUE9382 9383
+#define BSLS_MACROINCREMENTED_VALUE9383 9384
+#define BSLS_MACROINCREMENTED_VALUE9384 9385
+#define BSLS_MACROINCREMENTED_VALUE9385 9386
+#define BSLS_MACROINCREMENTED_VALUE9386 9387
+#define BSLS_MACROINCREMENTED_VALUE9387 9388
+#define BSLS_MACROINCREMENTED_VALUE9388 9389
+#define BSLS_MACROINCREMENTED_VALUE9389 9390
+#define BSLS_MACROINCREMENTED_VALUE9390 9391
+#define BSLS_MACROINCREMENTED_VALUE9391 9392
+#define BSLS_MACROINCREMENTED_VALUE9392 9393
+#define BSLS_MACROINCREMENTED_VALUE9393 9394
+#define BSLS_MACROINCREMENTED_VALUE9394 9395
+#define BSLS_MACROINCREMENTED_VALUE9395 9396
+#define BSLS_MACROINCREMENTED_VALUE9396 9397
+#define BSLS_MACROINCREMENTED_VALUE9397 9398
+#define BSLS_MACROINCREMENTED_VALUE9398 9399
+#define BSLS_MACROINCREMENTED_VALUE9399 9400
+#define BSLS_MACROINCREMENTED_VALUE9400 9401
+#define BSLS_MACROINCREMENTED_VALUE9401 9402
+#define BSLS_MACROINCREMENTED_VALUE9402 9403
+#define BSLS_MACROINCREMENTED_VALUE9403 9404
+#define BSLS_MACROINCREMENTED_VALUE9404 9405
+#define BSLS_MACROINCREMENTED_VALUE9405 9406
+#define BSLS_MACROINCREMENTED_VALUE9406 9407
+#define BSLS_MACROINCREMENTED_VALUE9407 9408
+#define BSLS_MACROINCREMENTED_VALUE9408 9409
+#define BSLS_MACROINCREMENTED_VALUE9409 9410
+#define BSLS_MACROINCREMENTED_VALUE9410 9411
+#define BSLS_MACROINCREMENTED_VALUE9411 9412
+#define BSLS_MACROINCREMENTED_VALUE9412 9413
+#define BSLS_MACROINCREMENTED_VALUE9413 9414
+#define BSLS_MACROINCREMENTED_VALUE9414 9415
+#define BSLS_MACROINCREMENTED_VALUE9415 9416
+#define BSLS_MACROINCREMENTED_VALUE9416 9417
+#define BSLS_MACROINCREMENTED_VALUE9417 9418
+#define BSLS_MACROINCREMENTED_VALUE9418 9419
+#define BSLS_MACROINCREMENTED_VALUE9419 9420
+#define BSLS_MACROINCREMENTED_VALUE9420 9421
+#define BSLS_MACROINCREMENTED_VALUE9421 9422
+#define BSLS_MACROINCREMENTED_VALUE9422 9423
+#define BSLS_MACROINCREMENTED_VALUE9423 9424
+#define BSLS_MACROINCREMENTED_VALUE9424 9425
+#define BSLS_MACROINCREMENTED_VALUE9425 9426
+#define BSLS_MACROINCREMENTED_VALUE9426 9427
+#define BSLS_MACROINCREMENTED_VALUE9427 9428
+#define BSLS_MACROINCREMENTED_VALUE9428 9429
+#define BSLS_MACROINCREMENTED_VALUE9429 9430
+#define BSLS_MACROINCREMENTED_VALUE9430 9431
+#define BSLS_MACROINCREMENTED_VALUE9431 9432
+#define BSLS_MACROINCREMENTED_VALUE9432 9433
+#define BSLS_MACROINCREMENTED_VALUE9433 9434
+#define BSLS_MACROINCREMENTED_VALUE9434 9435
+#define BSLS_MACROINCREMENTED_VALUE9435 9436
+#define BSLS_MACROINCREMENTED_VALUE9436 9437
+#define BSLS_MACROINCREMENTED_VALUE9437 9438
+#define BSLS_MACROINCREMENTED_VALUE9438 9439
+#define BSLS_MACROINCREMENTED_VALUE9439 9440
+#define BSLS_MACROINCREMENTED_VALUE9440 9441
+#define BSLS_MACROINCREMENTED_VALUE9441 9442
+#define BSLS_MACROINCREMENTED_VALUE9442 9443
+#define BSLS_MACROINCREMENTED_VALUE9443 9444
+#define BSLS_MACROINCREMENTED_VALUE9444 9445
+#define BSLS_MACROINCREMENTED_VALUE9445 9446
+#define BSLS_MACROINCREMENTED_VALUE9446 9447
+#define BSLS_MACROINCREMENTED_VALUE9447 9448
+#define BSLS_MACROINCREMENTED_VALUE9448 9449
+#define BSLS_MACROINCREMENTED_VALUE9449 9450
+#define BSLS_MACROINCREMENTED_VALUE9450 9451
+#define BSLS_MACROINCREMENTED_VALUE9451 9452
+#define BSLS_MACROINCREMENTED_VALUE9452 9453
+#define BSLS_MACROINCREMENTED_VALUE9453 9454
+#define BSLS_MACROINCREMENTED_VALUE9454 9455
+#define BSLS_MACROINCREMENTED_VALUE9455 9456
+#define BSLS_MACROINCREMENTED_VALUE9456 9457
+#define BSLS_MACROINCREMENTED_VALUE9457 9458
+#define BSLS_MACROINCREMENTED_VALUE9458 9459
+#define BSLS_MACROINCREMENTED_VALUE9459 9460
+#define BSLS_MACROINCREMENTED_VALUE9460 9461
+#define BSLS_MACROINCREMENTED_VALUE9461 9462
+#define BSLS_MACROINCREMENTED_VALUE9462 9463
+#define BSLS_MACROINCREMENTED_VALUE9463 9464
+#define BSLS_MACROINCREMENTED_VALUE9464 9465
+#define BSLS_MACROINCREMENTED_VALUE9465 9466
+#define BSLS_MACROINCREMENTED_VALUE9466 9467
+#define BSLS_MACROINCREMENTED_VALUE9467 9468
+#define BSLS_MACROINCREMENTED_VALUE9468 9469
+#define BSLS_MACROINCREMENTED_VALUE9469 9470
+#define BSLS_MACROINCREMENTED_VALUE9470 9471
+#define BSLS_MACROINCREMENTED_VALUE9471 9472
+#define BSLS_MACROINCREMENTED_VALUE9472 9473
+#define BSLS_MACROINCREMENTED_VALUE9473 9474
+#define BSLS_MACROINCREMENTED_VALUE9474 9475
+#define BSLS_MACROINCREMENTED_VALUE9475 9476
+#define BSLS_MACROINCREMENTED_VALUE9476 9477
+#define BSLS_MACROINCREMENTED_VALUE9477 9478
+#define BSLS_MACROINCREMENTED_VALUE9478 9479
+#define BSLS_MACROINCREMENTED_VALUE9479 9480
+#define BSLS_MACROINCREMENTED_VALUE9480 9481
+#define BSLS_MACROINCREMENTED_VALUE9481 9482
+#define BSLS_MACROINCREMENTED_VALUE9482 9483
+#define BSLS_MACROINCREMENTED_VALUE9483 9484
+#define BSLS_MACROINCREMENTED_VALUE9484 9485
+#define BSLS_MACROINCREMENTED_VALUE9485 9486
+#define BSLS_MACROINCREMENTED_VALUE9486 9487
+#define BSLS_MACROINCREMENTED_VALUE9487 9488
+#define BSLS_MACROINCREMENTED_VALUE9488 9489
+#define BSLS_MACROINCREMENTED_VALUE9489 9490
+#define BSLS_MACROINCREMENTED_VALUE9490 9491
+#define BSLS_MACROINCREMENTED_VALUE9491 9492
+#define BSLS_MACROINCREMENTED_VALUE9492 9493
+#define BSLS_MACROINCREMENTED_VALUE9493 9494
+#define BSLS_MACROINCREMENTED_VALUE9494 9495
+#define BSLS_MACROINCREMENTED_VALUE9495 9496
+#define BSLS_MACROINCREMENTED_VALUE9496 9497
+#define BSLS_MACROINCREMENTED_VALUE9497 9498
+#define BSLS_MACROINCREMENTED_VALUE9498 9499
+#define BSLS_MACROINCREMENTED_VALUE9499 9500
+#define BSLS_MACROINCREMENTED_VALUE9500 9501
+#define BSLS_MACROINCREMENTED_VALUE9501 9502
+#define BSLS_MACROINCREMENTED_VALUE9502 9503
+#define BSLS_MACROINCREMENTED_VALUE9503 9504
+#define BSLS_MACROINCREMENTED_VALUE9504 9505
+#define BSLS_MACROINCREMENTED_VALUE9505 9506
+#define BSLS_MACROINCREMENTED_VALUE9506 9507
+#define BSLS_MACROINCREMENTED_VALUE9507 9508
+#define BSLS_MACROINCREMENTED_VALUE9508 9509
+#define BSLS_MACROINCREMENTED_VALUE9509 9510
+#define BSLS_MACROINCREMENTED_VALUE9510 9511
+#define BSLS_MACROINCREMENTED_VALUE9511 9512
+#define BSLS_MACROINCREMENTED_VALUE9512 9513
+#define BSLS_MACROINCREMENTED_VALUE9513 9514
+#define BSLS_MACROINCREMENTED_VALUE9514 9515
+#define BSLS_MACROINCREMENTED_VALUE9515 9516
+#define BSLS_MACROINCREMENTED_VALUE9516 9517
+#define BSLS_MACROINCREMENTED_VALUE9517 9518
+#define BSLS_MACROINCREMENTED_VALUE9518 9519
+#define BSLS_MACROINCREMENTED_VALUE9519 9520
+#define BSLS_MACROINCREMENTED_VALUE9520 9521
+#define BSLS_MACROINCREMENTED_VALUE9521 9522
+#define BSLS_MACROINCREMENTED_VALUE9522 9523
+#define BSLS_MACROINCREMENTED_VALUE9523 9524
+#define BSLS_MACROINCREMENTED_VALUE9524 9525
+#define BSLS_MACROINCREMENTED_VALUE9525 9526
+#define BSLS_MACROINCREMENTED_VALUE9526 9527
+#define BSLS_MACROINCREMENTED_VALUE9527 9528
+#define BSLS_MACROINCREMENTED_VALUE9528 9529
+#define BSLS_MACROINCREMENTED_VALUE9529 9530
+#define BSLS_MACROINCREMENTED_VALUE9530 9531
+#define BSLS_MACROINCREMENTED_VALUE9531 9532
+#define BSLS_MACROINCREMENTED_VALUE9532 9533
+#define BSLS_MACROINCREMENTED_VALUE9533 9534
+#define BSLS_MACROINCREMENTED_VALUE9534 9535
+#define BSLS_MACROINCREMENTED_VALUE9535 9536
+#define BSLS_MACROINCREMENTED_VALUE9536 9537
+#define BSLS_MACROINCREMENTED_VALUE9537 9538
+#define BSLS_MACROINCREMENTED_VALUE9538 9539
+#define BSLS_MACROINCREMENTED_VALUE9539 9540
+#define BSLS_MACROINCREMENTED_VALUE9540 9541
+#define BSLS_MACROINCREMENTED_VALUE9541 9542
+#define BSLS_MACROINCREMENTED_VALUE9542 9543
+#define BSLS_MACROINCREMENTED_VALUE9543 9544
+#define BSLS_MACROINCREMENTED_VALUE9544 9545
+#define BSLS_MACROINCREMENTED_VALUE9545 9546
+#define BSLS_MACROINCREMENTED_VALUE9546 9547
+#define BSLS_MACROINCREMENTED_VALUE9547 9548
+#define BSLS_MACROINCREMENTED_VALUE9548 9549
+#define BSLS_MACROINCREMENTED_VALUE9549 9550
+#define BSLS_MACROINCREMENTED_VALUE9550 9551
+#define BSLS_MACROINCREMENTED_VALUE9551 9552
+#define BSLS_MACROINCREMENTED_VALUE9552 9553
+#define BSLS_MACROINCREMENTED_VALUE9553 9554
+#define BSLS_MACROINCREMENTED_VALUE9554 9555
+#define BSLS_MACROINCREMENTED_VALUE9555 9556
+#define BSLS_MACROINCREMENTED_VALUE9556 9557
+#define BSLS_MACROINCREMENTED_VALUE9557 9558
+#define BSLS_MACROINCREMENTED_VALUE9558 9559
+#define BSLS_MACROINCREMENTED_VALUE9559 9560
+#define BSLS_MACROINCREMENTED_VALUE9560 9561
+#define BSLS_MACROINCREMENTED_VALUE9561 9562
+#define BSLS_MACROINCREMENTED_VALUE9562 9563
+#define BSLS_MACROINCREMENTED_VALUE9563 9564
+#define BSLS_MACROINCREMENTED_VALUE9564 9565
+#define BSLS_MACROINCREMENTED_VALUE9565 9566
+#define BSLS_MACROINCREMENTED_VALUE9566 9567
+#define BSLS_MACROINCREMENTED_VALUE9567 9568
+#define BSLS_MACROINCREMENTED_VALUE9568 9569
+#define BSLS_MACROINCREMENTED_VALUE9569 9570
+#define BSLS_MACROINCREMENTED_VALUE9570 9571
+#define BSLS_MACROINCREMENTED_VALUE9571 9572
+#define BSLS_MACROINCREMENTED_VALUE9572 9573
+#define BSLS_MACROINCREMENTED_VALUE9573 9574
+#define BSLS_MACROINCREMENTED_VALUE9574 9575
+#define BSLS_MACROINCREMENTED_VALUE9575 9576
+#define BSLS_MACROINCREMENTED_VALUE9576 9577
+#define BSLS_MACROINCREMENTED_VALUE9577 9578
+#define BSLS_MACROINCREMENTED_VALUE9578 9579
+#define BSLS_MACROINCREMENTED_VALUE9579 9580
+#define BSLS_MACROINCREMENTED_VALUE9580 9581
+#define BSLS_MACROINCREMENTED_VALUE9581 9582
+#define BSLS_MACROINCREMENTED_VALUE9582 9583
+#define BSLS_MACROINCREMENTED_VALUE9583 9584
+#define BSLS_MACROINCREMENTED_VALUE9584 9585
+#define BSLS_MACROINCREMENTED_VALUE9585 9586
+#define BSLS_MACROINCREMENTED_VALUE9586 9587
+#define BSLS_MACROINCREMENTED_VALUE9587 9588
+#define BSLS_MACROINCREMENTED_VALUE9588 9589
+#define BSLS_MACROINCREMENTED_VALUE9589 9590
+#define BSLS_MACROINCREMENTED_VALUE9590 9591
+#define BSLS_MACROINCREMENTED_VALUE9591 9592
+#define BSLS_MACROINCREMENTED_VALUE9592 9593
+#define BSLS_MACROINCREMENTED_VALUE9593 9594
+#define BSLS_MACROINCREMENTED_VALUE9594 9595
+#define BSLS_MACROINCREMENTED_VALUE9595 9596
+#define BSLS_MACROINCREMENTED_VALUE9596 9597
+#define BSLS_MACROINCREMENTED_VALUE9597 9598
+#define BSLS_MACROINCREMENTED_VALUE9598 9599
+#define BSLS_MACROINCREMENTED_VALUE9599 9600
+#define BSLS_MACROINCREMENTED_VALUE9600 9601
+#define BSLS_MACROINCREMENTED_VALUE9601 9602
+#define BSLS_MACROINCREMENTED_VALUE9602 9603
+#define BSLS_MACROINCREMENTED_VALUE9603 9604
+#define BSLS_MACROINCREMENTED_VALUE9604 9605
+#define BSLS_MACROINCREMENTED_VALUE9605 9606
+#define BSLS_MACROINCREMENTED_VALUE9606 9607
+#define BSLS_MACROINCREMENTED_VALUE9607 9608
+#define BSLS_MACROINCREMENTED_VALUE9608 9609
+#define BSLS_MACROINCREMENTED_VALUE9609 9610
+#define BSLS_MACROINCREMENTED_VALUE9610 9611
+#define BSLS_MACROINCREMENTED_VALUE9611 9612
+#define BSLS_MACROINCREMENTED_VALUE9612 9613
+#define BSLS_MACROINCREMENTED_VALUE9613 9614
+#define BSLS_MACROINCREMENTED_VALUE9614 9615
+#define BSLS_MACROINCREMENTED_VALUE9615 9616
+#define BSLS_MACROINCREMENTED_VALUE9616 9617
+#define BSLS_MACROINCREMENTED_VALUE9617 9618
+#define BSLS_MACROINCREMENTED_VALUE9618 9619
+#define BSLS_MACROINCREMENTED_VALUE9619 9620
+#define BSLS_MACROINCREMENTED_VALUE9620 9621
+#define BSLS_MACROINCREMENTED_VALUE9621 9622
+#define BSLS_MACROINCREMENTED_VALUE9622 9623
+#define BSLS_MACROINCREMENTED_VALUE9623 9624
+#define BSLS_MACROINCREMENTED_VALUE9624 9625
+#define BSLS_MACROINCREMENTED_VALUE9625 9626
+#define BSLS_MACROINCREMENTED_VALUE9626 9627
+#define BSLS_MACROINCREMENTED_VALUE9627 9628
+#define BSLS_MACROINCREMENTED_VALUE9628 9629
+#define BSLS_MACROINCREMENTED_VALUE9629 9630
+#define BSLS_MACROINCREMENTED_VALUE9630 9631
+#define BSLS_MACROINCREMENTED_VALUE9631 9632
+#define BSLS_MACROINCREMENTED_VALUE9632 9633
+#define BSLS_MACROINCREMENTED_VALUE9633 9634
+#define BSLS_MACROINCREMENTED_VALUE9634 9635
+#define BSLS_MACROINCREMENTED_VALUE9635 9636
+#define BSLS_MACROINCREMENTED_VALUE9636 9637
+#define BSLS_MACROINCREMENTED_VALUE9637 9638
+#define BSLS_MACROINCREMENTED_VALUE9638 9639
+#define BSLS_MACROINCREMENTED_VALUE9639 9640
+#define BSLS_MACROINCREMENTED_VALUE9640 9641
+#define BSLS_MACROINCREMENTED_VALUE9641 9642
+#define BSLS_MACROINCREMENTED_VALUE9642 9643
+#define BSLS_MACROINCREMENTED_VALUE9643 9644
+#define BSLS_MACROINCREMENTED_VALUE9644 9645
+#define BSLS_MACROINCREMENTED_VALUE9645 9646
+#define BSLS_MACROINCREMENTED_VALUE9646 9647
+#define BSLS_MACROINCREMENTED_VALUE9647 9648
+#define BSLS_MACROINCREMENTED_VALUE9648 9649
+#define BSLS_MACROINCREMENTED_VALUE9649 9650
+#define BSLS_MACROINCREMENTED_VALUE9650 9651
+#define BSLS_MACROINCREMENTED_VALUE9651 9652
+#define BSLS_MACROINCREMENTED_VALUE9652 9653
+#define BSLS_MACROINCREMENTED_VALUE9653 9654
+#define BSLS_MACROINCREMENTED_VALUE9654 9655
+#define BSLS_MACROINCREMENTED_VALUE9655 9656
+#define BSLS_MACROINCREMENTED_VALUE9656 9657
+#define BSLS_MACROINCREMENTED_VALUE9657 9658
+#define BSLS_MACROINCREMENTED_VALUE9658 9659
+#define BSLS_MACROINCREMENTED_VALUE9659 9660
+#define BSLS_MACROINCREMENTED_VALUE9660 9661
+#define BSLS_MACROINCREMENTED_VALUE9661 9662
+#define BSLS_MACROINCREMENTED_VALUE9662 9663
+#define BSLS_MACROINCREMENTED_VALUE9663 9664
+#define BSLS_MACROINCREMENTED_VALUE9664 9665
+#define BSLS_MACROINCREMENTED_VALUE9665 9666
+#define BSLS_MACROINCREMENTED_VALUE9666 9667
+#define BSLS_MACROINCREMENTED_VALUE9667 9668
+#define BSLS_MACROINCREMENTED_VALUE9668 9669
+#define BSLS_MACROINCREMENTED_VALUE9669 9670
+#define BSLS_MACROINCREMENTED_VALUE9670 9671
+#define BSLS_MACROINCREMENTED_VALUE9671 9672
+#define BSLS_MACROINCREMENTED_VALUE9672 9673
+#define BSLS_MACROINCREMENTED_VALUE9673 9674
+#define BSLS_MACROINCREMENTED_VALUE9674 9675
+#define BSLS_MACROINCREMENTED_VALUE9675 9676
+#define BSLS_MACROINCREMENTED_VALUE9676 9677
+#define BSLS_MACROINCREMENTED_VALUE9677 9678
+#define BSLS_MACROINCREMENTED_VALUE9678 9679
+#define BSLS_MACROINCREMENTED_VALUE9679 9680
+#define BSLS_MACROINCREMENTED_VALUE9680 9681
+#define BSLS_MACROINCREMENTED_VALUE9681 9682
+#define BSLS_MACROINCREMENTED_VALUE9682 9683
+#define BSLS_MACROINCREMENTED_VALUE9683 9684
+#define BSLS_MACROINCREMENTED_VALUE9684 9685
+#define BSLS_MACROINCREMENTED_VALUE9685 9686
+#define BSLS_MACROINCREMENTED_VALUE9686 9687
+#define BSLS_MACROINCREMENTED_VALUE9687 9688
+#define BSLS_MACROINCREMENTED_VALUE9688 9689
+#define BSLS_MACROINCREMENTED_VALUE9689 9690
+#define BSLS_MACROINCREMENTED_VALUE9690 9691
+#define BSLS_MACROINCREMENTED_VALUE9691 9692
+#define BSLS_MACROINCREMENTED_VALUE9692 9693
+#define BSLS_MACROINCREMENTED_VALUE9693 9694
+#define BSLS_MACROINCREMENTED_VALUE9694 9695
+#define BSLS_MACROINCREMENTED_VALUE9695 9696
+#define BSLS_MACROINCREMENTED_VALUE9696 9697
+#define BSLS_MACROINCREMENTED_VALUE9697 9698
+#define BSLS_MACROINCREMENTED_VALUE9698 9699
+#define BSLS_MACROINCREMENTED_VALUE9699 9700
+#define BSLS_MACROINCREMENTED_VALUE9700 9701
+#define BSLS_MACROINCREMENTED_VALUE9701 9702
+#define BSLS_MACROINCREMENTED_VALUE9702 9703
+#define BSLS_MACROINCREMENTED_VALUE9703 9704
+#define BSLS_MACROINCREMENTED_VALUE9704 9705
+#define BSLS_MACROINCREMENTED_VALUE9705 9706
+#define BSLS_MACROINCREMENTED_VALUE9706 9707
+#define BSLS_MACROINCREMENTED_VALUE9707 9708
+#define BSLS_MACROINCREMENTED_VALUE9708 9709
+#define BSLS_MACROINCREMENTED_VALUE9709 9710
+#define BSLS_MACROINCREMENTED_VALUE9710 9711
+#define BSLS_MACROINCREMENTED_VALUE9711 9712
+#define BSLS_MACROINCREMENTED_VALUE9712 9713
+#define BSLS_MACROINCREMENTED_VALUE9713 9714
+#define BSLS_MACROINCREMENTED_VALUE9714 9715
+#define BSLS_MACROINCREMENTED_VALUE9715 9716
+#define BSLS_MACROINCREMENTED_VALUE9716 9717
+#define BSLS_MACROINCREMENTED_VALUE9717 9718
+#define BSLS_MACROINCREMENTED_VALUE9718 9719
+#define BSLS_MACROINCREMENTED_VALUE9719 9720
+#define BSLS_MACROINCREMENTED_VALUE9720 9721
+#define BSLS_MACROINCREMENTED_VALUE9721 9722
+#define BSLS_MACROINCREMENTED_VALUE9722 9723
+#define BSLS_MACROINCREMENTED_VALUE9723 9724
+#define BSLS_MACROINCREMENTED_VALUE9724 9725
+#define BSLS_MACROINCREMENTED_VALUE9725 9726
+#define BSLS_MACROINCREMENTED_VALUE9726 9727
+#define BSLS_MACROINCREMENTED_VALUE9727 9728
+#define BSLS_MACROINCREMENTED_VALUE9728 9729
+#define BSLS_MACROINCREMENTED_VALUE9729 9730
+#define BSLS_MACROINCREMENTED_VALUE9730 9731
+#define BSLS_MACROINCREMENTED_VALUE9731 9732
+#define BSLS_MACROINCREMENTED_VALUE9732 9733
+#define BSLS_MACROINCREMENTED_VALUE9733 9734
+#define BSLS_MACROINCREMENTED_VALUE9734 9735
+#define BSLS_MACROINCREMENTED_VALUE9735 9736
+#define BSLS_MACROINCREMENTED_VALUE9736 9737
+#define BSLS_MACROINCREMENTED_VALUE9737 9738
+#define BSLS_MACROINCREMENTED_VALUE9738 9739
+#define BSLS_MACROINCREMENTED_VALUE9739 9740
+#define BSLS_MACROINCREMENTED_VALUE9740 9741
+#define BSLS_MACROINCREMENTED_VALUE9741 9742
+#define BSLS_MACROINCREMENTED_VALUE9742 9743
+#define BSLS_MACROINCREMENTED_VALUE9743 9744
+#define BSLS_MACROINCREMENTED_VALUE9744 9745
+#define BSLS_MACROINCREMENTED_VALUE9745 9746
+#define BSLS_MACROINCREMENTED_VALUE9746 9747
+#define BSLS_MACROINCREMENTED_VALUE9747 9748
+#define BSLS_MACROINCREMENTED_VALUE9748 9749
+#define BSLS_MACROINCREMENTED_VALUE9749 9750
+#define BSLS_MACROINCREMENTED_VALUE9750 9751
+#define BSLS_MACROINCREMENTED_VALUE9751 9752
+#define BSLS_MACROINCREMENTED_VALUE9752 9753
+#define BSLS_MACROINCREMENTED_VALUE9753 9754
+#define BSLS_MACROINCREMENTED_VALUE9754 9755
+#define BSLS_MACROINCREMENTED_VALUE9755 9756
+#define BSLS_MACROINCREMENTED_VALUE9756 9757
+#define BSLS_MACROINCREMENTED_VALUE9757 9758
+#define BSLS_MACROINCREMENTED_VALUE9758 9759
+#define BSLS_MACROINCREMENTED_VALUE9759 9760
+#define BSLS_MACROINCREMENTED_VALUE9760 9761
+#define BSLS_MACROINCREMENTED_VALUE9761 9762
+#define BSLS_MACROINCREMENTED_VALUE9762 9763
+#define BSLS_MACROINCREMENTED_VALUE9763 9764
+#define BSLS_MACROINCREMENTED_VALUE9764 9765
+#define BSLS_MACROINCREMENTED_VALUE9765 9766
+#define BSLS_MACROINCREMENTED_VALUE9766 9767
+#define BSLS_MACROINCREMENTED_VALUE9767 9768
+#define BSLS_MACROINCREMENTED_VALUE9768 9769
+#define BSLS_MACROINCREMENTED_VALUE9769 9770
+#define BSLS_MACROINCREMENTED_VALUE9770 9771
+#define BSLS_MACROINCREMENTED_VALUE9771 9772
+#define BSLS_MACROINCREMENTED_VALUE9772 9773
+#define BSLS_MACROINCREMENTED_VALUE9773 9774
+#define BSLS_MACROINCREMENTED_VALUE9774 9775
+#define BSLS_MACROINCREMENTED_VALUE9775 9776
+#define BSLS_MACROINCREMENTED_VALUE9776 9777
+#define BSLS_MACROINCREMENTED_VALUE9777 9778
+#define BSLS_MACROINCREMENTED_VALUE9778 9779
+#define BSLS_MACROINCREMENTED_VALUE9779 9780
+#define BSLS_MACROINCREMENTED_VALUE9780 9781
+#define BSLS_MACROINCREMENTED_VALUE9781 9782
+#define BSLS_MACROINCREMENTED_VALUE9782 9783
+#define BSLS_MACROINCREMENTED_VALUE9783 9784
+#define BSLS_MACROINCREMENTED_VALUE9784 9785
+#define BSLS_MACROINCREMENTED_VALUE9785 9786
+#define BSLS_MACROINCREMENTED_VALUE9786 9787
+#define BSLS_MACROINCREMENTED_VALUE9787 9788
+#define BSLS_MACROINCREMENTED_VALUE9788 9789
+#define BSLS_MACROINCREMENTED_VALUE9789 9790
+#define BSLS_MACROINCREMENTED_VALUE9790 9791
+#define BSLS_MACROINCREMENTED_VALUE9791 9792
+#define BSLS_MACROINCREMENTED_VALUE9792 9793
+#define BSLS_MACROINCREMENTED_VALUE9793 9794
+#define BSLS_MACROINCREMENTED_VALUE9794 9795
+#define BSLS_MACROINCREMENTED_VALUE9795 9796
+#define BSLS_MACROINCREMENTED_VALUE9796 9797
+#define BSLS_MACROINCREMENTED_VALUE9797 9798
+#define BSLS_MACROINCREMENTED_VALUE9798 9799
+#define BSLS_MACROINCREMENTED_VALUE9799 9800
+#define BSLS_MACROINCREMENTED_VALUE9800 9801
+#define BSLS_MACROINCREMENTED_VALUE9801 9802
+#define BSLS_MACROINCREMENTED_VALUE9802 9803
+#define BSLS_MACROINCREMENTED_VALUE9803 9804
+#define BSLS_MACROINCREMENTED_VALUE9804 9805
+#define BSLS_MACROINCREMENTED_VALUE9805 9806
+#define BSLS_MACROINCREMENTED_VALUE9806 9807
+#define BSLS_MACROINCREMENTED_VALUE9807 9808
+#define BSLS_MACROINCREMENTED_VALUE9808 9809
+#define BSLS_MACROINCREMENTED_VALUE9809 9810
+#define BSLS_MACROINCREMENTED_VALUE9810 9811
+#define BSLS_MACROINCREMENTED_VALUE9811 9812
+#define BSLS_MACROINCREMENTED_VALUE9812 9813
+#define BSLS_MACROINCREMENTED_VALUE9813 9814
+#define BSLS_MACROINCREMENTED_VALUE9814 9815
+#define BSLS_MACROINCREMENTED_VALUE9815 9816
+#define BSLS_MACROINCREMENTED_VALUE9816 9817
+#define BSLS_MACROINCREMENTED_VALUE9817 9818
+#define BSLS_MACROINCREMENTED_VALUE9818 9819
+#define BSLS_MACROINCREMENTED_VALUE9819 9820
+#define BSLS_MACROINCREMENTED_VALUE9820 9821
+#define BSLS_MACROINCREMENTED_VALUE9821 9822
+#define BSLS_MACROINCREMENTED_VALUE9822 9823
+#define BSLS_MACROINCREMENTED_VALUE9823 9824
+#define BSLS_MACROINCREMENTED_VALUE9824 9825
+#define BSLS_MACROINCREMENTED_VALUE9825 9826
+#define BSLS_MACROINCREMENTED_VALUE9826 9827
+#define BSLS_MACROINCREMENTED_VALUE9827 9828
+#define BSLS_MACROINCREMENTED_VALUE9828 9829
+#define BSLS_MACROINCREMENTED_VALUE9829 9830
+#define BSLS_MACROINCREMENTED_VALUE9830 9831
+#define BSLS_MACROINCREMENTED_VALUE9831 9832
+#define BSLS_MACROINCREMENTED_VALUE9832 9833
+#define BSLS_MACROINCREMENTED_VALUE9833 9834
+#define BSLS_MACROINCREMENTED_VALUE9834 9835
+#define BSLS_MACROINCREMENTED_VALUE9835 9836
+#define BSLS_MACROINCREMENTED_VALUE9836 9837
+#define BSLS_MACROINCREMENTED_VALUE9837 9838
+#define BSLS_MACROINCREMENTED_VALUE9838 9839
+#define BSLS_MACROINCREMENTED_VALUE9839 9840
+#define BSLS_MACROINCREMENTED_VALUE9840 9841
+#define BSLS_MACROINCREMENTED_VALUE9841 9842
+#define BSLS_MACROINCREMENTED_VALUE9842 9843
+#define BSLS_MACROINCREMENTED_VALUE9843 9844
+#define BSLS_MACROINCREMENTED_VALUE9844 9845
+#define BSLS_MACROINCREMENTED_VALUE9845 9846
+#define BSLS_MACROINCREMENTED_VALUE9846 9847
+#define BSLS_MACROINCREMENTED_VALUE9847 9848
+#define BSLS_MACROINCREMENTED_VALUE9848 9849
+#define BSLS_MACROINCREMENTED_VALUE9849 9850
+#define BSLS_MACROINCREMENTED_VALUE9850 9851
+#define BSLS_MACROINCREMENTED_VALUE9851 9852
+#define BSLS_MACROINCREMENTED_VALUE9852 9853
+#define BSLS_MACROINCREMENTED_VALUE9853 9854
+#define BSLS_MACROINCREMENTED_VALUE9854 9855
+#define BSLS_MACROINCREMENTED_VALUE9855 9856
+#define BSLS_MACROINCREMENTED_VALUE9856 9857
+#define BSLS_MACROINCREMENTED_VALUE9857 9858
+#define BSLS_MACROINCREMENTED_VALUE9858 9859
+#define BSLS_MACROINCREMENTED_VALUE9859 9860
+#define BSLS_MACROINCREMENTED_VALUE9860 9861
+#define BSLS_MACROINCREMENTED_VALUE9861 9862
+#define BSLS_MACROINCREMENTED_VALUE9862 9863
+#define BSLS_MACROINCREMENTED_VALUE9863 9864
+#define BSLS_MACROINCREMENTED_VALUE9864 9865
+#define BSLS_MACROINCREMENTED_VALUE9865 9866
+#define BSLS_MACROINCREMENTED_VALUE9866 9867
+#define BSLS_MACROINCREMENTED_VALUE9867 9868
+#define BSLS_MACROINCREMENTED_VALUE9868 9869
+#define BSLS_MACROINCREMENTED_VALUE9869 9870
+#define BSLS_MACROINCREMENTED_VALUE9870 9871
+#define BSLS_MACROINCREMENTED_VALUE9871 9872
+#define BSLS_MACROINCREMENTED_VALUE9872 9873
+#define BSLS_MACROINCREMENTED_VALUE9873 9874
+#define BSLS_MACROINCREMENTED_VALUE9874 9875
+#define BSLS_MACROINCREMENTED_VALUE9875 9876
+#define BSLS_MACROINCREMENTED_VALUE9876 9877
+#define BSLS_MACROINCREMENTED_VALUE9877 9878
+#define BSLS_MACROINCREMENTED_VALUE9878 9879
+#define BSLS_MACROINCREMENTED_VALUE9879 9880
+#define BSLS_MACROINCREMENTED_VALUE9880 9881
+#define BSLS_MACROINCREMENTED_VALUE9881 9882
+#define BSLS_MACROINCREMENTED_VALUE9882 9883
+#define BSLS_MACROINCREMENTED_VALUE9883 9884
+#define BSLS_MACROINCREMENTED_VALUE9884 9885
+#define BSLS_MACROINCREMENTED_VALUE9885 9886
+#define BSLS_MACROINCREMENTED_VALUE9886 9887
+#define BSLS_MACROINCREMENTED_VALUE9887 9888
+#define BSLS_MACROINCREMENTED_VALUE9888 9889
+#define BSLS_MACROINCREMENTED_VALUE9889 9890
+#define BSLS_MACROINCREMENTED_VALUE9890 9891
+#define BSLS_MACROINCREMENTED_VALUE9891 9892
+#define BSLS_MACROINCREMENTED_VALUE9892 9893
+#define BSLS_MACROINCREMENTED_VALUE9893 9894
+#define BSLS_MACROINCREMENTED_VALUE9894 9895
+#define BSLS_MACROINCREMENTED_VALUE9895 9896
+#define BSLS_MACROINCREMENTED_VALUE9896 9897
+#define BSLS_MACROINCREMENTED_VALUE9897 9898
+#define BSLS_MACROINCREMENTED_VALUE9898 9899
+#define BSLS_MACROINCREMENTED_VALUE9899 9900
+#define BSLS_MACROINCREMENTED_VALUE9900 9901
+#define BSLS_MACROINCREMENTED_VALUE9901 9902
+#define BSLS_MACROINCREMENTED_VALUE9902 9903
+#define BSLS_MACROINCREMENTED_VALUE9903 9904
+#define BSLS_MACROINCREMENTED_VALUE9904 9905
+#define BSLS_MACROINCREMENTED_VALUE9905 9906
+#define BSLS_MACROINCREMENTED_VALUE9906 9907
+#define BSLS_MACROINCREMENTED_VALUE9907 9908
+#define BSLS_MACROINCREMENTED_VALUE9908 9909
+#define BSLS_MACROINCREMENTED_VALUE9909 9910
+#define BSLS_MACROINCREMENTED_VALUE9910 9911
+#define BSLS_MACROINCREMENTED_VALUE9911 9912
+#define BSLS_MACROINCREMENTED_VALUE9912 9913
+#define BSLS_MACROINCREMENTED_VALUE9913 9914
+#define BSLS_MACROINCREMENTED_VALUE9914 9915
+#define BSLS_MACROINCREMENTED_VALUE9915 9916
+#define BSLS_MACROINCREMENTED_VALUE9916 9917
+#define BSLS_MACROINCREMENTED_VALUE9917 9918
+#define BSLS_MACROINCREMENTED_VALUE9918 9919
+#define BSLS_MACROINCREMENTED_VALUE9919 9920
+#define BSLS_MACROINCREMENTED_VALUE9920 9921
+#define BSLS_MACROINCREMENTED_VALUE9921 9922
+#define BSLS_MACROINCREMENTED_VALUE9922 9923
+#define BSLS_MACROINCREMENTED_VALUE9923 9924
+#define BSLS_MACROINCREMENTED_VALUE9924 9925
+#define BSLS_MACROINCREMENTED_VALUE9925 9926
+#define BSLS_MACROINCREMENTED_VALUE9926 9927
+#define BSLS_MACROINCREMENTED_VALUE9927 9928
+#define BSLS_MACROINCREMENTED_VALUE9928 9929
+#define BSLS_MACROINCREMENTED_VALUE9929 9930
+#define BSLS_MACROINCREMENTED_VALUE9930 9931
+#define BSLS_MACROINCREMENTED_VALUE9931 9932
+#define BSLS_MACROINCREMENTED_VALUE9932 9933
+#define BSLS_MACROINCREMENTED_VALUE9933 9934
+#define BSLS_MACROINCREMENTED_VALUE9934 9935
+#define BSLS_MACROINCREMENTED_VALUE9935 9936
+#define BSLS_MACROINCREMENTED_VALUE9936 9937
+#define BSLS_MACROINCREMENTED_VALUE9937 9938
+#define BSLS_MACROINCREMENTED_VALUE9938 9939
+#define BSLS_MACROINCREMENTED_VALUE9939 9940
+#define BSLS_MACROINCREMENTED_VALUE9940 9941
+#define BSLS_MACROINCREMENTED_VALUE9941 9942
+#define BSLS_MACROINCREMENTED_VALUE9942 9943
+#define BSLS_MACROINCREMENTED_VALUE9943 9944
+#define BSLS_MACROINCREMENTED_VALUE9944 9945
+#define BSLS_MACROINCREMENTED_VALUE9945 9946
+#define BSLS_MACROINCREMENTED_VALUE9946 9947
+#define BSLS_MACROINCREMENTED_VALUE9947 9948
+#define BSLS_MACROINCREMENTED_VALUE9948 9949
+#define BSLS_MACROINCREMENTED_VALUE9949 9950
+#define BSLS_MACROINCREMENTED_VALUE9950 9951
+#define BSLS_MACROINCREMENTED_VALUE9951 9952
+#define BSLS_MACROINCREMENTED_VALUE9952 9953
+#define BSLS_MACROINCREMENTED_VALUE9953 9954
+#define BSLS_MACROINCREMENTED_VALUE9954 9955
+#define BSLS_MACROINCREMENTED_VALUE9955 9956
+#define BSLS_MACROINCREMENTED_VALUE9956 9957
+#define BSLS_MACROINCREMENTED_VALUE9957 9958
+#define BSLS_MACROINCREMENTED_VALUE9958 9959
+#define BSLS_MACROINCREMENTED_VALUE9959 9960
+#define BSLS_MACROINCREMENTED_VALUE9960 9961
+#define BSLS_MACROINCREMENTED_VALUE9961 9962
+#define BSLS_MACROINCREMENTED_VALUE9962 9963
+#define BSLS_MACROINCREMENTED_VALUE9963 9964
+#define BSLS_MACROINCREMENTED_VALUE9964 9965
+#define BSLS_MACROINCREMENTED_VALUE9965 9966
+#define BSLS_MACROINCREMENTED_VALUE9966 9967
+#define BSLS_MACROINCREMENTED_VALUE9967 9968
+#define BSLS_MACROINCREMENTED_VALUE9968 9969
+#define BSLS_MACROINCREMENTED_VALUE9969 9970
+#define BSLS_MACROINCREMENTED_VALUE9970 9971
+#define BSLS_MACROINCREMENTED_VALUE9971 9972
+#define BSLS_MACROINCREMENTED_VALUE9972 9973
+#define BSLS_MACROINCREMENTED_VALUE9973 9974
+#define BSLS_MACROINCREMENTED_VALUE9974 9975
+#define BSLS_MACROINCREMENTED_VALUE9975 9976
+#define BSLS_MACROINCREMENTED_VALUE9976 9977
+#define BSLS_MACROINCREMENTED_VALUE9977 9978
+#define BSLS_MACROINCREMENTED_VALUE9978 9979
+#define BSLS_MACROINCREMENTED_VALUE9979 9980
+#define BSLS_MACROINCREMENTED_VALUE9980 9981
+#define BSLS_MACROINCREMENTED_VALUE9981 9982
+#define BSLS_MACROINCREMENTED_VALUE9982 9983
+#define BSLS_MACROINCREMENTED_VALUE9983 9984
+#define BSLS_MACROINCREMENTED_VALUE9984 9985
+#define BSLS_MACROINCREMENTED_VALUE9985 9986
+#define BSLS_MACROINCREMENTED_VALUE9986 9987
+#define BSLS_MACROINCREMENTED_VALUE9987 9988
+#define BSLS_MACROINCREMENTED_VALUE9988 9989
+#define BSLS_MACROINCREMENTED_VALUE9989 9990
+#define BSLS_MACROINCREMENTED_VALUE9990 9991
+#define BSLS_MACROINCREMENTED_VALUE9991 9992
+#define BSLS_MACROINCREMENTED_VALUE9992 9993
+#define BSLS_MACROINCREMENTED_VALUE9993 9994
+#define BSLS_MACROINCREMENTED_VALUE9994 9995
+#define BSLS_MACROINCREMENTED_VALUE9995 9996
+#define BSLS_MACROINCREMENTED_VALUE9996 9997
+#define BSLS_MACROINCREMENTED_VALUE9997 9998
+#define BSLS_MACROINCREMENTED_VALUE9998 9999
+#define BSLS_MACROINCREMENTED_VALUE9999 10000
+#define BSLS_MACROINCREMENTED_VALUE10000 10001
+#define BSLS_MACROINCREMENTED_VALUE10001 10002
+#define BSLS_MACROINCREMENTED_VALUE10002 10003
+#define BSLS_MACROINCREMENTED_VALUE10003 10004
+#define BSLS_MACROINCREMENTED_VALUE10004 10005
+#define BSLS_MACROINCREMENTED_VALUE10005 10006
+#define BSLS_MACROINCREMENTED_VALUE10006 10007
+#define BSLS_MACROINCREMENTED_VALUE10007 10008
+#define BSLS_MACROINCREMENTED_VALUE10008 10009
+#define BSLS_MACROINCREMENTED_VALUE10009 10010
+#define BSLS_MACROINCREMENTED_VALUE10010 10011
+#define BSLS_MACROINCREMENTED_VALUE10011 10012
+#define BSLS_MACROINCREMENTED_VALUE10012 10013
+#define BSLS_MACROINCREMENTED_VALUE10013 10014
+#define BSLS_MACROINCREMENTED_VALUE10014 10015
+#define BSLS_MACROINCREMENTED_VALUE10015 10016
+#define BSLS_MACROINCREMENTED_VALUE10016 10017
+#define BSLS_MACROINCREMENTED_VALUE10017 10018
+#define BSLS_MACROINCREMENTED_VALUE10018 10019
+#define BSLS_MACROINCREMENTED_VALUE10019 10020
+#define BSLS_MACROINCREMENTED_VALUE10020 10021
+#define BSLS_MACROINCREMENTED_VALUE10021 10022
+#define BSLS_MACROINCREMENTED_VALUE10022 10023
+#define BSLS_MACROINCREMENTED_VALUE10023 10024
+#define BSLS_MACROINCREMENTED_VALUE10024 10025
+#define BSLS_MACROINCREMENTED_VALUE10025 10026
+#define BSLS_MACROINCREMENTED_VALUE10026 10027
+#define BSLS_MACROINCREMENTED_VALUE10027 10028
+#define BSLS_MACROINCREMENTED_VALUE10028 10029
+#define BSLS_MACROINCREMENTED_VALUE10029 10030
+#define BSLS_MACROINCREMENTED_VALUE10030 10031
+#define BSLS_MACROINCREMENTED_VALUE10031 10032
+#define BSLS_MACROINCREMENTED_VALUE10032 10033
+#define BSLS_MACROINCREMENTED_VALUE10033 10034
+#define BSLS_MACROINCREMENTED_VALUE10034 10035
+#define BSLS_MACROINCREMENTED_VALUE10035 10036
+#define BSLS_MACROINCREMENTED_VALUE10036 10037
+#define BSLS_MACROINCREMENTED_VALUE10037 10038
+#define BSLS_MACROINCREMENTED_VALUE10038 10039
+#define BSLS_MACROINCREMENTED_VALUE10039 10040
+#define BSLS_MACROINCREMENTED_VALUE10040 10041
+#define BSLS_MACROINCREMENTED_VALUE10041 10042
+#define BSLS_MACROINCREMENTED_VALUE10042 10043
+#define BSLS_MACROINCREMENTED_VALUE10043 10044
+#define BSLS_MACROINCREMENTED_VALUE10044 10045
+#define BSLS_MACROINCREMENTED_VALUE10045 10046
+#define BSLS_MACROINCREMENTED_VALUE10046 10047
+#define BSLS_MACROINCREMENTED_VALUE10047 10048
+#define BSLS_MACROINCREMENTED_VALUE10048 10049
+#define BSLS_MACROINCREMENTED_VALUE10049 10050
+#define BSLS_MACROINCREMENTED_VALUE10050 10051
+#define BSLS_MACROINCREMENTED_VALUE10051 10052
+#define BSLS_MACROINCREMENTED_VALUE10052 10053
+#define BSLS_MACROINCREMENTED_VALUE10053 10054
+#define BSLS_MACROINCREMENTED_VALUE10054 10055
+#define BSLS_MACROINCREMENTED_VALUE10055 10056
+#define BSLS_MACROINCREMENTED_VALUE10056 10057
+#define BSLS_MACROINCREMENTED_VALUE10057 10058
+#define BSLS_MACROINCREMENTED_VALUE10058 10059
+#define BSLS_MACROINCREMENTED_VALUE10059 10060
+#define BSLS_MACROINCREMENTED_VALUE10060 10061
+#define BSLS_MACROINCREMENTED_VALUE10061 10062
+#define BSLS_MACROINCREMENTED_VALUE10062 10063
+#define BSLS_MACROINCREMENTED_VALUE10063 10064
+#define BSLS_MACROINCREMENTED_VALUE10064 10065
+#define BSLS_MACROINCREMENTED_VALUE10065 10066
+#define BSLS_MACROINCREMENTED_VALUE10066 10067
+#define BSLS_MACROINCREMENTED_VALUE10067 10068
+#define BSLS_MACROINCREMENTED_VALUE10068 10069
+#define BSLS_MACROINCREMENTED_VALUE10069 10070
+#define BSLS_MACROINCREMENTED_VALUE10070 10071
+#define BSLS_MACROINCREMENTED_VALUE10071 10072
+#define BSLS_MACROINCREMENTED_VALUE10072 10073
+#define BSLS_MACROINCREMENTED_VALUE10073 10074
+#define BSLS_MACROINCREMENTED_VALUE10074 10075
+#define BSLS_MACROINCREMENTED_VALUE10075 10076
+#define BSLS_MACROINCREMENTED_VALUE10076 10077
+#define BSLS_MACROINCREMENTED_VALUE10077 10078
+#define BSLS_MACROINCREMENTED_VALUE10078 10079
+#define BSLS_MACROINCREMENTED_VALUE10079 10080
+#define BSLS_MACROINCREMENTED_VALUE10080 10081
+#define BSLS_MACROINCREMENTED_VALUE10081 10082
+#define BSLS_MACROINCREMENTED_VALUE10082 10083
+#define BSLS_MACROINCREMENTED_VALUE10083 10084
+#define BSLS_MACROINCREMENTED_VALUE10084 10085
+#define BSLS_MACROINCREMENTED_VALUE10085 10086
+#define BSLS_MACROINCREMENTED_VALUE10086 10087
+#define BSLS_MACROINCREMENTED_VALUE10087 10088
+#define BSLS_MACROINCREMENTED_VALUE10088 10089
+#define BSLS_MACROINCREMENTED_VALUE10089 10090
+#define BSLS_MACROINCREMENTED_VALUE10090 10091
+#define BSLS_MACROINCREMENTED_VALUE10091 10092
+#define BSLS_MACROINCREMENTED_VALUE10092 10093
+#define BSLS_MACROINCREMENTED_VALUE10093 10094
+#define BSLS_MACROINCREMENTED_VALUE10094 10095
+#define BSLS_MACROINCREMENTED_VALUE10095 10096
+#define BSLS_MACROINCREMENTED_VALUE10096 10097
+#define BSLS_MACROINCREMENTED_VALUE10097 10098
+#define BSLS_MACROINCREMENTED_VALUE10098 10099
+#define BSLS_MACROINCREMENTED_VALUE10099 10100
+#define BSLS_MACROINCREMENTED_VALUE10100 10101
+#define BSLS_MACROINCREMENTED_VALUE10101 10102
+#define BSLS_MACROINCREMENTED_VALUE10102 10103
+#define BSLS_MACROINCREMENTED_VALUE10103 10104
+#define BSLS_MACROINCREMENTED_VALUE10104 10105
+#define BSLS_MACROINCREMENTED_VALUE10105 10106
+#define BSLS_MACROINCREMENTED_VALUE10106 10107
+#define BSLS_MACROINCREMENTED_VALUE10107 10108
+#define BSLS_MACROINCREMENTED_VALUE10108 10109
+#define BSLS_MACROINCREMENTED_VALUE10109 10110
+#define BSLS_MACROINCREMENTED_VALUE10110 10111
+#define BSLS_MACROINCREMENTED_VALUE10111 10112
+#define BSLS_MACROINCREMENTED_VALUE10112 10113
+#define BSLS_MACROINCREMENTED_VALUE10113 10114
+#define BSLS_MACROINCREMENTED_VALUE10114 10115
+#define BSLS_MACROINCREMENTED_VALUE10115 10116
+#define BSLS_MACROINCREMENTED_VALUE10116 10117
+#define BSLS_MACROINCREMENTED_VALUE10117 10118
+#define BSLS_MACROINCREMENTED_VALUE10118 10119
+#define BSLS_MACROINCREMENTED_VALUE10119 10120
+#define BSLS_MACROINCREMENTED_VALUE10120 10121
+#define BSLS_MACROINCREMENTED_VALUE10121 10122
+#define BSLS_MACROINCREMENTED_VALUE10122 10123
+#define BSLS_MACROINCREMENTED_VALUE10123 10124
+#define BSLS_MACROINCREMENTED_VALUE10124 10125
+#define BSLS_MACROINCREMENTED_VALUE10125 10126
+#define BSLS_MACROINCREMENTED_VALUE10126 10127
+#define BSLS_MACROINCREMENTED_VALUE10127 10128
+#define BSLS_MACROINCREMENTED_VALUE10128 10129
+#define BSLS_MACROINCREMENTED_VALUE10129 10130
+#define BSLS_MACROINCREMENTED_VALUE10130 10131
+#define BSLS_MACROINCREMENTED_VALUE10131 10132
+#define BSLS_MACROINCREMENTED_VALUE10132 10133
+#define BSLS_MACROINCREMENTED_VALUE10133 10134
+#define BSLS_MACROINCREMENTED_VALUE10134 10135
+#define BSLS_MACROINCREMENTED_VALUE10135 10136
+#define BSLS_MACROINCREMENTED_VALUE10136 10137
+#define BSLS_MACROINCREMENTED_VALUE10137 10138
+#define BSLS_MACROINCREMENTED_VALUE10138 10139
+#define BSLS_MACROINCREMENTED_VALUE10139 10140
+#define BSLS_MACROINCREMENTED_VALUE10140 10141
+#define BSLS_MACROINCREMENTED_VALUE10141 10142
+#define BSLS_MACROINCREMENTED_VALUE10142 10143
+#define BSLS_MACROINCREMENTED_VALUE10143 10144
+#define BSLS_MACROINCREMENTED_VALUE10144 10145
+#define BSLS_MACROINCREMENTED_VALUE10145 10146
+#define BSLS_MACROINCREMENTED_VALUE10146 10147
+#define BSLS_MACROINCREMENTED_VALUE10147 10148
+#define BSLS_MACROINCREMENTED_VALUE10148 10149
+#define BSLS_MACROINCREMENTED_VALUE10149 10150
+#define BSLS_MACROINCREMENTED_VALUE10150 10151
+#define BSLS_MACROINCREMENTED_VALUE10151 10152
+#define BSLS_MACROINCREMENTED_VALUE10152 10153
+#define BSLS_MACROINCREMENTED_VALUE10153 10154
+#define BSLS_MACROINCREMENTED_VALUE10154 10155
+#define BSLS_MACROINCREMENTED_VALUE10155 10156
+#define BSLS_MACROINCREMENTED_VALUE10156 10157
+#define BSLS_MACROINCREMENTED_VALUE10157 10158
+#define BSLS_MACROINCREMENTED_VALUE10158 10159
+#define BSLS_MACROINCREMENTED_VALUE10159 10160
+#define BSLS_MACROINCREMENTED_VALUE10160 10161
+#define BSLS_MACROINCREMENTED_VALUE10161 10162
+#define BSLS_MACROINCREMENTED_VALUE10162 10163
+#define BSLS_MACROINCREMENTED_VALUE10163 10164
+#define BSLS_MACROINCREMENTED_VALUE10164 10165
+#define BSLS_MACROINCREMENTED_VALUE10165 10166
+#define BSLS_MACROINCREMENTED_VALUE10166 10167
+#define BSLS_MACROINCREMENTED_VALUE10167 10168
+#define BSLS_MACROINCREMENTED_VALUE10168 10169
+#define BSLS_MACROINCREMENTED_VALUE10169 10170
+#define BSLS_MACROINCREMENTED_VALUE10170 10171
+#define BSLS_MACROINCREMENTED_VALUE10171 10172
+#define BSLS_MACROINCREMENTED_VALUE10172 10173
+#define BSLS_MACROINCREMENTED_VALUE10173 10174
+#define BSLS_MACROINCREMENTED_VALUE10174 10175
+#define BSLS_MACROINCREMENTED_VALUE10175 10176
+#define BSLS_MACROINCREMENTED_VALUE10176 10177
+#define BSLS_MACROINCREMENTED_VALUE10177 10178
+#define BSLS_MACROINCREMENTED_VALUE10178 10179
+#define BSLS_MACROINCREMENTED_VALUE10179 10180
+#define BSLS_MACROINCREMENTED_VALUE10180 10181
+#define BSLS_MACROINCREMENTED_VALUE10181 10182
+#define BSLS_MACROINCREMENTED_VALUE10182 10183
+#define BSLS_MACROINCREMENTED_VALUE10183 10184
+#define BSLS_MACROINCREMENTED_VALUE10184 10185
+#define BSLS_MACROINCREMENTED_VALUE10185 10186
+#define BSLS_MACROINCREMENTED_VALUE10186 10187
+#define BSLS_MACROINCREMENTED_VALUE10187 10188
+#define BSLS_MACROINCREMENTED_VALUE10188 10189
+#define BSLS_MACROINCREMENTED_VALUE10189 10190
+#define BSLS_MACROINCREMENTED_VALUE10190 10191
+#define BSLS_MACROINCREMENTED_VALUE10191 10192
+#define BSLS_MACROINCREMENTED_VALUE10192 10193
+#define BSLS_MACROINCREMENTED_VALUE10193 10194
+#define BSLS_MACROINCREMENTED_VALUE10194 10195
+#define BSLS_MACROINCREMENTED_VALUE10195 10196
+#define BSLS_MACROINCREMENTED_VALUE10196 10197
+#define BSLS_MACROINCREMENTED_VALUE10197 10198
+#define BSLS_MACROINCREMENTED_VALUE10198 10199
+#define BSLS_MACROINCREMENTED_VALUE10199 10200
+#define BSLS_MACROINCREMENTED_VALUE10200 10201
+#define BSLS_MACROINCREMENTED_VALUE10201 10202
+#define BSLS_MACROINCREMENTED_VALUE10202 10203
+#define BSLS_MACROINCREMENTED_VALUE10203 10204
+#define BSLS_MACROINCREMENTED_VALUE10204 10205
+#define BSLS_MACROINCREMENTED_VALUE10205 10206
+#define BSLS_MACROINCREMENTED_VALUE10206 10207
+#define BSLS_MACROINCREMENTED_VALUE10207 10208
+#define BSLS_MACROINCREMENTED_VALUE10208 10209
+#define BSLS_MACROINCREMENTED_VALUE10209 10210
+#define BSLS_MACROINCREMENTED_VALUE10210 10211
+#define BSLS_MACROINCREMENTED_VALUE10211 10212
+#define BSLS_MACROINCREMENTED_VALUE10212 10213
+#define BSLS_MACROINCREMENTED_VALUE10213 10214
+#define BSLS_MACROINCREMENTED_VALUE10214 10215
+#define BSLS_MACROINCREMENTED_VALUE10215 10216
+#define BSLS_MACROINCREMENTED_VALUE10216 10217
+#define BSLS_MACROINCREMENTED_VALUE10217 10218
+#define BSLS_MACROINCREMENTED_VALUE10218 10219
+#define BSLS_MACROINCREMENTED_VALUE10219 10220
+#define BSLS_MACROINCREMENTED_VALUE10220 10221
+#define BSLS_MACROINCREMENTED_VALUE10221 10222
+#define BSLS_MACROINCREMENTED_VALUE10222 10223
+#define BSLS_MACROINCREMENTED_VALUE10223 10224
+#define BSLS_MACROINCREMENTED_VALUE10224 10225
+#define BSLS_MACROINCREMENTED_VALUE10225 10226
+#define BSLS_MACROINCREMENTED_VALUE10226 10227
+#define BSLS_MACROINCREMENTED_VALUE10227 10228
+#define BSLS_MACROINCREMENTED_VALUE10228 10229
+#define BSLS_MACROINCREMENTED_VALUE10229 10230
+#define BSLS_MACROINCREMENTED_VALUE10230 10231
+#define BSLS_MACROINCREMENTED_VALUE10231 10232
+#define BSLS_MACROINCREMENTED_VALUE10232 10233
+#define BSLS_MACROINCREMENTED_VALUE10233 10234
+#define BSLS_MACROINCREMENTED_VALUE10234 10235
+#define BSLS_MACROINCREMENTED_VALUE10235 10236
+#define BSLS_MACROINCREMENTED_VALUE10236 10237
+#define BSLS_MACROINCREMENTED_VALUE10237 10238
+#define BSLS_MACROINCREMENTED_VALUE10238 10239
+#define BSLS_MACROINCREMENTED_VALUE10239 10240
+#define BSLS_MACROINCREMENTED_VALUE10240 10241
+#define BSLS_MACROINCREMENTED_VALUE10241 10242
+#define BSLS_MACROINCREMENTED_VALUE10242 10243
+#define BSLS_MACROINCREMENTED_VALUE10243 10244
+#define BSLS_MACROINCREMENTED_VALUE10244 10245
+#define BSLS_MACROINCREMENTED_VALUE10245 10246
+#define BSLS_MACROINCREMENTED_VALUE10246 10247
+#define BSLS_MACROINCREMENTED_VALUE10247 10248
+#define BSLS_MACROINCREMENTED_VALUE10248 10249
+#define BSLS_MACROINCREMENTED_VALUE10249 10250
+#define BSLS_MACROINCREMENTED_VALUE10250 10251
+#define BSLS_MACROINCREMENTED_VALUE10251 10252
+#define BSLS_MACROINCREMENTED_VALUE10252 10253
+#define BSLS_MACROINCREMENTED_VALUE10253 10254
+#define BSLS_MACROINCREMENTED_VALUE10254 10255
+#define BSLS_MACROINCREMENTED_VALUE10255 10256
+#define BSLS_MACROINCREMENTED_VALUE10256 10257
+#define BSLS_MACROINCREMENTED_VALUE10257 10258
+#define BSLS_MACROINCREMENTED_VALUE10258 10259
+#define BSLS_MACROINCREMENTED_VALUE10259 10260
+#define BSLS_MACROINCREMENTED_VALUE10260 10261
+#define BSLS_MACROINCREMENTED_VALUE10261 10262
+#define BSLS_MACROINCREMENTED_VALUE10262 10263
+#define BSLS_MACROINCREMENTED_VALUE10263 10264
+#define BSLS_MACROINCREMENTED_VALUE10264 10265
+#define BSLS_MACROINCREMENTED_VALUE10265 10266
+#define BSLS_MACROINCREMENTED_VALUE10266 10267
+#define BSLS_MACROINCREMENTED_VALUE10267 10268
+#define BSLS_MACROINCREMENTED_VALUE10268 10269
+#define BSLS_MACROINCREMENTED_VALUE10269 10270
+#define BSLS_MACROINCREMENTED_VALUE10270 10271
+#define BSLS_MACROINCREMENTED_VALUE10271 10272
+#define BSLS_MACROINCREMENTED_VALUE10272 10273
+#define BSLS_MACROINCREMENTED_VALUE10273 10274
+#define BSLS_MACROINCREMENTED_VALUE10274 10275
+#define BSLS_MACROINCREMENTED_VALUE10275 10276
+#define BSLS_MACROINCREMENTED_VALUE10276 10277
+#define BSLS_MACROINCREMENTED_VALUE10277 10278
+#define BSLS_MACROINCREMENTED_VALUE10278 10279
+#define BSLS_MACROINCREMENTED_VALUE10279 10280
+#define BSLS_MACROINCREMENTED_VALUE10280 10281
+#define BSLS_MACROINCREMENTED_VALUE10281 10282
+#define BSLS_MACROINCREMENTED_VALUE10282 10283
+#define BSLS_MACROINCREMENTED_VALUE10283 10284
+#define BSLS_MACROINCREMENTED_VALUE10284 10285
+#define BSLS_MACROINCREMENTED_VALUE10285 10286
+#define BSLS_MACROINCREMENTED_VALUE10286 10287
+#define BSLS_MACROINCREMENTED_VALUE10287 10288
+#define BSLS_MACROINCREMENTED_VALUE10288 10289
+#define BSLS_MACROINCREMENTED_VALUE10289 10290
+#define BSLS_MACROINCREMENTED_VALUE10290 10291
+#define BSLS_MACROINCREMENTED_VALUE10291 10292
+#define BSLS_MACROINCREMENTED_VALUE10292 10293
+#define BSLS_MACROINCREMENTED_VALUE10293 10294
+#define BSLS_MACROINCREMENTED_VALUE10294 10295
+#define BSLS_MACROINCREMENTED_VALUE10295 10296
+#define BSLS_MACROINCREMENTED_VALUE10296 10297
+#define BSLS_MACROINCREMENTED_VALUE10297 10298
+#define BSLS_MACROINCREMENTED_VALUE10298 10299
+#define BSLS_MACROINCREMENTED_VALUE10299 10300
+#define BSLS_MACROINCREMENTED_VALUE10300 10301
+#define BSLS_MACROINCREMENTED_VALUE10301 10302
+#define BSLS_MACROINCREMENTED_VALUE10302 10303
+#define BSLS_MACROINCREMENTED_VALUE10303 10304
+#define BSLS_MACROINCREMENTED_VALUE10304 10305
+#define BSLS_MACROINCREMENTED_VALUE10305 10306
+#define BSLS_MACROINCREMENTED_VALUE10306 10307
+#define BSLS_MACROINCREMENTED_VALUE10307 10308
+#define BSLS_MACROINCREMENTED_VALUE10308 10309
+#define BSLS_MACROINCREMENTED_VALUE10309 10310
+#define BSLS_MACROINCREMENTED_VALUE10310 10311
+#define BSLS_MACROINCREMENTED_VALUE10311 10312
+#define BSLS_MACROINCREMENTED_VALUE10312 10313
+#define BSLS_MACROINCREMENTED_VALUE10313 10314
+#define BSLS_MACROINCREMENTED_VALUE10314 10315
+#define BSLS_MACROINCREMENTED_VALUE10315 10316
+#define BSLS_MACROINCREMENTED_VALUE10316 10317
+#define BSLS_MACROINCREMENTED_VALUE10317 10318
+#define BSLS_MACROINCREMENTED_VALUE10318 10319
+#define BSLS_MACROINCREMENTED_VALUE10319 10320
+#define BSLS_MACROINCREMENTED_VALUE10320 10321
+#define BSLS_MACROINCREMENTED_VALUE10321 10322
+#define BSLS_MACROINCREMENTED_VALUE10322 10323
+#define BSLS_MACROINCREMENTED_VALUE10323 10324
+#define BSLS_MACROINCREMENTED_VALUE10324 10325
+#define BSLS_MACROINCREMENTED_VALUE10325 10326
+#define BSLS_MACROINCREMENTED_VALUE10326 10327
+#define BSLS_MACROINCREMENTED_VALUE10327 10328
+#define BSLS_MACROINCREMENTED_VALUE10328 10329
+#define BSLS_MACROINCREMENTED_VALUE10329 10330
+#define BSLS_MACROINCREMENTED_VALUE10330 10331
+#define BSLS_MACROINCREMENTED_VALUE10331 10332
+#define BSLS_MACROINCREMENTED_VALUE10332 10333
+#define BSLS_MACROINCREMENTED_VALUE10333 10334
+#define BSLS_MACROINCREMENTED_VALUE10334 10335
+#define BSLS_MACROINCREMENTED_VALUE10335 10336
+#define BSLS_MACROINCREMENTED_VALUE10336 10337
+#define BSLS_MACROINCREMENTED_VALUE10337 10338
+#define BSLS_MACROINCREMENTED_VALUE10338 10339
+#define BSLS_MACROINCREMENTED_VALUE10339 10340
+#define BSLS_MACROINCREMENTED_VALUE10340 10341
+#define BSLS_MACROINCREMENTED_VALUE10341 10342
+#define BSLS_MACROINCREMENTED_VALUE10342 10343
+#define BSLS_MACROINCREMENTED_VALUE10343 10344
+#define BSLS_MACROINCREMENTED_VALUE10344 10345
+#define BSLS_MACROINCREMENTED_VALUE10345 10346
+#define BSLS_MACROINCREMENTED_VALUE10346 10347
+#define BSLS_MACROINCREMENTED_VALUE10347 10348
+#define BSLS_MACROINCREMENTED_VALUE10348 10349
+#define BSLS_MACROINCREMENTED_VALUE10349 10350
+#define BSLS_MACROINCREMENTED_VALUE10350 10351
+#define BSLS_MACROINCREMENTED_VALUE10351 10352
+#define BSLS_MACROINCREMENTED_VALUE10352 10353
+#define BSLS_MACROINCREMENTED_VALUE10353 10354
+#define BSLS_MACROINCREMENTED_VALUE10354 10355
+#define BSLS_MACROINCREMENTED_VALUE10355 10356
+#define BSLS_MACROINCREMENTED_VALUE10356 10357
+#define BSLS_MACROINCREMENTED_VALUE10357 10358
+#define BSLS_MACROINCREMENTED_VALUE10358 10359
+#define BSLS_MACROINCREMENTED_VALUE10359 10360
+#define BSLS_MACROINCREMENTED_VALUE10360 10361
+#define BSLS_MACROINCREMENTED_VALUE10361 10362
+#define BSLS_MACROINCREMENTED_VALUE10362 10363
+#define BSLS_MACROINCREMENTED_VALUE10363 10364
+#define BSLS_MACROINCREMENTED_VALUE10364 10365
+#define BSLS_MACROINCREMENTED_VALUE10365 10366
+#define BSLS_MACROINCREMENTED_VALUE10366 10367
+#define BSLS_MACROINCREMENTED_VALUE10367 10368
+#define BSLS_MACROINCREMENTED_VALUE10368 10369
+#define BSLS_MACROINCREMENTED_VALUE10369 10370
+#define BSLS_MACROINCREMENTED_VALUE10370 10371
+#define BSLS_MACROINCREMENTED_VALUE10371 10372
+#define BSLS_MACROINCREMENTED_VALUE10372 10373
+#define BSLS_MACROINCREMENTED_VALUE10373 10374
+#define BSLS_MACROINCREMENTED_VALUE10374 10375
+#define BSLS_MACROINCREMENTED_VALUE10375 10376
+#define BSLS_MACROINCREMENTED_VALUE10376 10377
+#define BSLS_MACROINCREMENTED_VALUE10377 10378
+#define BSLS_MACROINCREMENTED_VALUE10378 10379
+#define BSLS_MACROINCREMENTED_VALUE10379 10380
+#define BSLS_MACROINCREMENTED_VALUE10380 10381
+#define BSLS_MACROINCREMENTED_VALUE10381 10382
+#define BSLS_MACROINCREMENTED_VALUE10382 10383
+#define BSLS_MACROINCREMENTED_VALUE10383 10384
+#define BSLS_MACROINCREMENTED_VALUE10384 10385
+#define BSLS_MACROINCREMENTED_VALUE10385 10386
+#define BSLS_MACROINCREMENTED_VALUE10386 10387
+#define BSLS_MACROINCREMENTED_VALUE10387 10388
+#define BSLS_MACROINCREMENTED_VALUE10388 10389
+#define BSLS_MACROINCREMENTED_VALUE10389 10390
+#define BSLS_MACROINCREMENTED_VALUE10390 10391
+#define BSLS_MACROINCREMENTED_VALUE10391 10392
+#define BSLS_MACROINCREMENTED_VALUE10392 10393
+#define BSLS_MACROINCREMENTED_VALUE10393 10394
+#define BSLS_MACROINCREMENTED_VALUE10394 10395
+#define BSLS_MACROINCREMENTED_VALUE10395 10396
+#define BSLS_MACROINCREMENTED_VALUE10396 10397
+#define BSLS_MACROINCREMENTED_VALUE10397 10398
+#define BSLS_MACROINCREMENTED_VALUE10398 10399
+#define BSLS_MACROINCREMENTED_VALUE10399 10400
+#define BSLS_MACROINCREMENTED_VALUE10400 10401
+#define BSLS_MACROINCREMENTED_VALUE10401 10402
+#define BSLS_MACROINCREMENTED_VALUE10402 10403
+#define BSLS_MACROINCREMENTED_VALUE10403 10404
+#define BSLS_MACROINCREMENTED_VALUE10404 10405
+#define BSLS_MACROINCREMENTED_VALUE10405 10406
+#define BSLS_MACROINCREMENTED_VALUE10406 10407
+#define BSLS_MACROINCREMENTED_VALUE10407 10408
+#define BSLS_MACROINCREMENTED_VALUE10408 10409
+#define BSLS_MACROINCREMENTED_VALUE10409 10410
+#define BSLS_MACROINCREMENTED_VALUE10410 10411
+#define BSLS_MACROINCREMENTED_VALUE10411 10412
+#define BSLS_MACROINCREMENTED_VALUE10412 10413
+#define BSLS_MACROINCREMENTED_VALUE10413 10414
+#define BSLS_MACROINCREMENTED_VALUE10414 10415
+#define BSLS_MACROINCREMENTED_VALUE10415 10416
+#define BSLS_MACROINCREMENTED_VALUE10416 10417
+#define BSLS_MACROINCREMENTED_VALUE10417 10418
+#define BSLS_MACROINCREMENTED_VALUE10418 10419
+#define BSLS_MACROINCREMENTED_VALUE10419 10420
+#define BSLS_MACROINCREMENTED_VALUE10420 10421
+#define BSLS_MACROINCREMENTED_VALUE10421 10422
+#define BSLS_MACROINCREMENTED_VALUE10422 10423
+#define BSLS_MACROINCREMENTED_VALUE10423 10424
+#define BSLS_MACROINCREMENTED_VALUE10424 10425
+#define BSLS_MACROINCREMENTED_VALUE10425 10426
+#define BSLS_MACROINCREMENTED_VALUE10426 10427
+#define BSLS_MACROINCREMENTED_VALUE10427 10428
+#define BSLS_MACROINCREMENTED_VALUE10428 10429
+#define BSLS_MACROINCREMENTED_VALUE10429 10430
+#define BSLS_MACROINCREMENTED_VALUE10430 10431
+#define BSLS_MACROINCREMENTED_VALUE10431 10432
+#define BSLS_MACROINCREMENTED_VALUE10432 10433
+#define BSLS_MACROINCREMENTED_VALUE10433 10434
+#define BSLS_MACROINCREMENTED_VALUE10434 10435
+#define BSLS_MACROINCREMENTED_VALUE10435 10436
+#define BSLS_MACROINCREMENTED_VALUE10436 10437
+#define BSLS_MACROINCREMENTED_VALUE10437 10438
+#define BSLS_MACROINCREMENTED_VALUE10438 10439
+#define BSLS_MACROINCREMENTED_VALUE10439 10440
+#define BSLS_MACROINCREMENTED_VALUE10440 10441
+#define BSLS_MACROINCREMENTED_VALUE10441 10442
+#define BSLS_MACROINCREMENTED_VALUE10442 10443
+#define BSLS_MACROINCREMENTED_VALUE10443 10444
+#define BSLS_MACROINCREMENTED_VALUE10444 10445
+#define BSLS_MACROINCREMENTED_VALUE10445 10446
+#define BSLS_MACROINCREMENTED_VALUE10446 10447
+#define BSLS_MACROINCREMENTED_VALUE10447 10448
+#define BSLS_MACROINCREMENTED_VALUE10448 10449
+#define BSLS_MACROINCREMENTED_VALUE10449 10450
+#define BSLS_MACROINCREMENTED_VALUE10450 10451
+#define BSLS_MACROINCREMENTED_VALUE10451 10452
+#define BSLS_MACROINCREMENTED_VALUE10452 10453
+#define BSLS_MACROINCREMENTED_VALUE10453 10454
+#define BSLS_MACROINCREMENTED_VALUE10454 10455
+#define BSLS_MACROINCREMENTED_VALUE10455 10456
+#define BSLS_MACROINCREMENTED_VALUE10456 10457
+#define BSLS_MACROINCREMENTED_VALUE10457 10458
+#define BSLS_MACROINCREMENTED_VALUE10458 10459
+#define BSLS_MACROINCREMENTED_VALUE10459 10460
+#define BSLS_MACROINCREMENTED_VALUE10460 10461
+#define BSLS_MACROINCREMENTED_VALUE10461 10462
+#define BSLS_MACROINCREMENTED_VALUE10462 10463
+#define BSLS_MACROINCREMENTED_VALUE10463 10464
+#define BSLS_MACROINCREMENTED_VALUE10464 10465
+#define BSLS_MACROINCREMENTED_VALUE10465 10466
+#define BSLS_MACROINCREMENTED_VALUE10466 10467
+#define BSLS_MACROINCREMENTED_VALUE10467 10468
+#define BSLS_MACROINCREMENTED_VALUE10468 10469
+#define BSLS_MACROINCREMENTED_VALUE10469 10470
+#define BSLS_MACROINCREMENTED_VALUE10470 10471
+#define BSLS_MACROINCREMENTED_VALUE10471 10472
+#define BSLS_MACROINCREMENTED_VALUE10472 10473
+#define BSLS_MACROINCREMENTED_VALUE10473 10474
+#define BSLS_MACROINCREMENTED_VALUE10474 10475
+#define BSLS_MACROINCREMENTED_VALUE10475 10476
+#define BSLS_MACROINCREMENTED_VALUE10476 10477
+#define BSLS_MACROINCREMENTED_VALUE10477 10478
+#define BSLS_MACROINCREMENTED_VALUE10478 10479
+#define BSLS_MACROINCREMENTED_VALUE10479 10480
+#define BSLS_MACROINCREMENTED_VALUE10480 10481
+#define BSLS_MACROINCREMENTED_VALUE10481 10482
+#define BSLS_MACROINCREMENTED_VALUE10482 10483
+#define BSLS_MACROINCREMENTED_VALUE10483 10484
+#define BSLS_MACROINCREMENTED_VALUE10484 10485
+#define BSLS_MACROINCREMENTED_VALUE10485 10486
+#define BSLS_MACROINCREMENTED_VALUE10486 10487
+#define BSLS_MACROINCREMENTED_VALUE10487 10488
+#define BSLS_MACROINCREMENTED_VALUE10488 10489
+#define BSLS_MACROINCREMENTED_VALUE10489 10490
+#define BSLS_MACROINCREMENTED_VALUE10490 10491
+#define BSLS_MACROINCREMENTED_VALUE10491 10492
+#define BSLS_MACROINCREMENTED_VALUE10492 10493
+#define BSLS_MACROINCREMENTED_VALUE10493 10494
+#define BSLS_MACROINCREMENTED_VALUE10494 10495
+#define BSLS_MACROINCREMENTED_VALUE10495 10496
+#define BSLS_MACROINCREMENTED_VALUE10496 10497
+#define BSLS_MACROINCREMENTED_VALUE10497 10498
+#define BSLS_MACROINCREMENTED_VALUE10498 10499
+#define BSLS_MACROINCREMENTED_VALUE10499 10500
+#define BSLS_MACROINCREMENTED_VALUE10500 10501
+#define BSLS_MACROINCREMENTED_VALUE10501 10502
+#define BSLS_MACROINCREMENTED_VALUE10502 10503
+#define BSLS_MACROINCREMENTED_VALUE10503 10504
+#define BSLS_MACROINCREMENTED_VALUE10504 10505
+#define BSLS_MACROINCREMENTED_VALUE10505 10506
+#define BSLS_MACROINCREMENTED_VALUE10506 10507
+#define BSLS_MACROINCREMENTED_VALUE10507 10508
+#define BSLS_MACROINCREMENTED_VALUE10508 10509
+#define BSLS_MACROINCREMENTED_VALUE10509 10510
+#define BSLS_MACROINCREMENTED_VALUE10510 10511
+#define BSLS_MACROINCREMENTED_VALUE10511 10512
+#define BSLS_MACROINCREMENTED_VALUE10512 10513
+#define BSLS_MACROINCREMENTED_VALUE10513 10514
+#define BSLS_MACROINCREMENTED_VALUE10514 10515
+#define BSLS_MACROINCREMENTED_VALUE10515 10516
+#define BSLS_MACROINCREMENTED_VALUE10516 10517
+#define BSLS_MACROINCREMENTED_VALUE10517 10518
+#define BSLS_MACROINCREMENTED_VALUE10518 10519
+#define BSLS_MACROINCREMENTED_VALUE10519 10520
+#define BSLS_MACROINCREMENTED_VALUE10520 10521
+#define BSLS_MACROINCREMENTED_VALUE10521 10522
+#define BSLS_MACROINCREMENTED_VALUE10522 10523
+#define BSLS_MACROINCREMENTED_VALUE10523 10524
+#define BSLS_MACROINCREMENTED_VALUE10524 10525
+#define BSLS_MACROINCREMENTED_VALUE10525 10526
+#define BSLS_MACROINCREMENTED_VALUE10526 10527
+#define BSLS_MACROINCREMENTED_VALUE10527 10528
+#define BSLS_MACROINCREMENTED_VALUE10528 10529
+#define BSLS_MACROINCREMENTED_VALUE10529 10530
+#define BSLS_MACROINCREMENTED_VALUE10530 10531
+#define BSLS_MACROINCREMENTED_VALUE10531 10532
+#define BSLS_MACROINCREMENTED_VALUE10532 10533
+#define BSLS_MACROINCREMENTED_VALUE10533 10534
+#define BSLS_MACROINCREMENTED_VALUE10534 10535
+#define BSLS_MACROINCREMENTED_VALUE10535 10536
+#define BSLS_MACROINCREMENTED_VALUE10536 10537
+#define BSLS_MACROINCREMENTED_VALUE10537 10538
+#define BSLS_MACROINCREMENTED_VALUE10538 10539
+#define BSLS_MACROINCREMENTED_VALUE10539 10540
+#define BSLS_MACROINCREMENTED_VALUE10540 10541
+#define BSLS_MACROINCREMENTED_VALUE10541 10542
+#define BSLS_MACROINCREMENTED_VALUE10542 10543
+#define BSLS_MACROINCREMENTED_VALUE10543 10544
+#define BSLS_MACROINCREMENTED_VALUE10544 10545
+#define BSLS_MACROINCREMENTED_VALUE10545 10546
+#define BSLS_MACROINCREMENTED_VALUE10546 10547
+#define BSLS_MACROINCREMENTED_VALUE10547 10548
+#define BSLS_MACROINCREMENTED_VALUE10548 10549
+#define BSLS_MACROINCREMENTED_VALUE10549 10550
+#define BSLS_MACROINCREMENTED_VALUE10550 10551
+#define BSLS_MACROINCREMENTED_VALUE10551 10552
+#define BSLS_MACROINCREMENTED_VALUE10552 10553
+#define BSLS_MACROINCREMENTED_VALUE10553 10554
+#define BSLS_MACROINCREMENTED_VALUE10554 10555
+#define BSLS_MACROINCREMENTED_VALUE10555 10556
+#define BSLS_MACROINCREMENTED_VALUE10556 10557
+#define BSLS_MACROINCREMENTED_VALUE10557 10558
+#define BSLS_MACROINCREMENTED_VALUE10558 10559
+#define BSLS_MACROINCREMENTED_VALUE10559 10560
+#define BSLS_MACROINCREMENTED_VALUE10560 10561
+#define BSLS_MACROINCREMENTED_VALUE10561 10562
+#define BSLS_MACROINCREMENTED_VALUE10562 10563
+#define BSLS_MACROINCREMENTED_VALUE10563 10564
+#define BSLS_MACROINCREMENTED_VALUE10564 10565
+#define BSLS_MACROINCREMENTED_VALUE10565 10566
+#define BSLS_MACROINCREMENTED_VALUE10566 10567
+#define BSLS_MACROINCREMENTED_VALUE10567 10568
+#define BSLS_MACROINCREMENTED_VALUE10568 10569
+#define BSLS_MACROINCREMENTED_VALUE10569 10570
+#define BSLS_MACROINCREMENTED_VALUE10570 10571
+#define BSLS_MACROINCREMENTED_VALUE10571 10572
+#define BSLS_MACROINCREMENTED_VALUE10572 10573
+#define BSLS_MACROINCREMENTED_VALUE10573 10574
+#define BSLS_MACROINCREMENTED_VALUE10574 10575
+#define BSLS_MACROINCREMENTED_VALUE10575 10576
+#define BSLS_MACROINCREMENTED_VALUE10576 10577
+#define BSLS_MACROINCREMENTED_VALUE10577 10578
+#define BSLS_MACROINCREMENTED_VALUE10578 10579
+#define BSLS_MACROINCREMENTED_VALUE10579 10580
+#define BSLS_MACROINCREMENTED_VALUE10580 10581
+#define BSLS_MACROINCREMENTED_VALUE10581 10582
+#define BSLS_MACROINCREMENTED_VALUE10582 10583
+#define BSLS_MACROINCREMENTED_VALUE10583 10584
+#define BSLS_MACROINCREMENTED_VALUE10584 10585
+#define BSLS_MACROINCREMENTED_VALUE10585 10586
+#define BSLS_MACROINCREMENTED_VALUE10586 10587
+#define BSLS_MACROINCREMENTED_VALUE10587 10588
+#define BSLS_MACROINCREMENTED_VALUE10588 10589
+#define BSLS_MACROINCREMENTED_VALUE10589 10590
+#define BSLS_MACROINCREMENTED_VALUE10590 10591
+#define BSLS_MACROINCREMENTED_VALUE10591 10592
+#define BSLS_MACROINCREMENTED_VALUE10592 10593
+#define BSLS_MACROINCREMENTED_VALUE10593 10594
+#define BSLS_MACROINCREMENTED_VALUE10594 10595
+#define BSLS_MACROINCREMENTED_VALUE10595 10596
+#define BSLS_MACROINCREMENTED_VALUE10596 10597
+#define BSLS_MACROINCREMENTED_VALUE10597 10598
+#define BSLS_MACROINCREMENTED_VALUE10598 10599
+#define BSLS_MACROINCREMENTED_VALUE10599 10600
+#define BSLS_MACROINCREMENTED_VALUE10600 10601
+#define BSLS_MACROINCREMENTED_VALUE10601 10602
+#define BSLS_MACROINCREMENTED_VALUE10602 10603
+#define BSLS_MACROINCREMENTED_VALUE10603 10604
+#define BSLS_MACROINCREMENTED_VALUE10604 10605
+#define BSLS_MACROINCREMENTED_VALUE10605 10606
+#define BSLS_MACROINCREMENTED_VALUE10606 10607
+#define BSLS_MACROINCREMENTED_VALUE10607 10608
+#define BSLS_MACROINCREMENTED_VALUE10608 10609
+#define BSLS_MACROINCREMENTED_VALUE10609 10610
+#define BSLS_MACROINCREMENTED_VALUE10610 10611
+#define BSLS_MACROINCREMENTED_VALUE10611 10612
+#define BSLS_MACROINCREMENTED_VALUE10612 10613
+#define BSLS_MACROINCREMENTED_VALUE10613 10614
+#define BSLS_MACROINCREMENTED_VALUE10614 10615
+#define BSLS_MACROINCREMENTED_VALUE10615 10616
+#define BSLS_MACROINCREMENTED_VALUE10616 10617
+#define BSLS_MACROINCREMENTED_VALUE10617 10618
+#define BSLS_MACROINCREMENTED_VALUE10618 10619
+#define BSLS_MACROINCREMENTED_VALUE10619 10620
+#define BSLS_MACROINCREMENTED_VALUE10620 10621
+#define BSLS_MACROINCREMENTED_VALUE10621 10622
+#define BSLS_MACROINCREMENTED_VALUE10622 10623
+#define BSLS_MACROINCREMENTED_VALUE10623 10624
+#define BSLS_MACROINCREMENTED_VALUE10624 10625
+#define BSLS_MACROINCREMENTED_VALUE10625 10626
+#define BSLS_MACROINCREMENTED_VALUE10626 10627
+#define BSLS_MACROINCREMENTED_VALUE10627 10628
+#define BSLS_MACROINCREMENTED_VALUE10628 10629
+#define BSLS_MACROINCREMENTED_VALUE10629 10630
+#define BSLS_MACROINCREMENTED_VALUE10630 10631
+#define BSLS_MACROINCREMENTED_VALUE10631 10632
+#define BSLS_MACROINCREMENTED_VALUE10632 10633
+#define BSLS_MACROINCREMENTED_VALUE10633 10634
+#define BSLS_MACROINCREMENTED_VALUE10634 10635
+#define BSLS_MACROINCREMENTED_VALUE10635 10636
+#define BSLS_MACROINCREMENTED_VALUE10636 10637
+#define BSLS_MACROINCREMENTED_VALUE10637 10638
+#define BSLS_MACROINCREMENTED_VALUE10638 10639
+#define BSLS_MACROINCREMENTED_VALUE10639 10640
+#define BSLS_MACROINCREMENTED_VALUE10640 10641
+#define BSLS_MACROINCREMENTED_VALUE10641 10642
+#define BSLS_MACROINCREMENTED_VALUE10642 10643
+#define BSLS_MACROINCREMENTED_VALUE10643 10644
+#define BSLS_MACROINCREMENTED_VALUE10644 10645
+#define BSLS_MACROINCREMENTED_VALUE10645 10646
+#define BSLS_MACROINCREMENTED_VALUE10646 10647
+#define BSLS_MACROINCREMENTED_VALUE10647 10648
+#define BSLS_MACROINCREMENTED_VALUE10648 10649
+#define BSLS_MACROINCREMENTED_VALUE10649 10650
+#define BSLS_MACROINCREMENTED_VALUE10650 10651
+#define BSLS_MACROINCREMENTED_VALUE10651 10652
+#define BSLS_MACROINCREMENTED_VALUE10652 10653
+#define BSLS_MACROINCREMENTED_VALUE10653 10654
+#define BSLS_MACROINCREMENTED_VALUE10654 10655
+#define BSLS_MACROINCREMENTED_VALUE10655 10656
+#define BSLS_MACROINCREMENTED_VALUE10656 10657
+#define BSLS_MACROINCREMENTED_VALUE10657 10658
+#define BSLS_MACROINCREMENTED_VALUE10658 10659
+#define BSLS_MACROINCREMENTED_VALUE10659 10660
+#define BSLS_MACROINCREMENTED_VALUE10660 10661
+#define BSLS_MACROINCREMENTED_VALUE10661 10662
+#define BSLS_MACROINCREMENTED_VALUE10662 10663
+#define BSLS_MACROINCREMENTED_VALUE10663 10664
+#define BSLS_MACROINCREMENTED_VALUE10664 10665
+#define BSLS_MACROINCREMENTED_VALUE10665 10666
+#define BSLS_MACROINCREMENTED_VALUE10666 10667
+#define BSLS_MACROINCREMENTED_VALUE10667 10668
+#define BSLS_MACROINCREMENTED_VALUE10668 10669
+#define BSLS_MACROINCREMENTED_VALUE10669 10670
+#define BSLS_MACROINCREMENTED_VALUE10670 10671
+#define BSLS_MACROINCREMENTED_VALUE10671 10672
+#define BSLS_MACROINCREMENTED_VALUE10672 10673
+#define BSLS_MACROINCREMENTED_VALUE10673 10674
+#define BSLS_MACROINCREMENTED_VALUE10674 10675
+#define BSLS_MACROINCREMENTED_VALUE10675 10676
+#define BSLS_MACROINCREMENTED_VALUE10676 10677
+#define BSLS_MACROINCREMENTED_VALUE10677 10678
+#define BSLS_MACROINCREMENTED_VALUE10678 10679
+#define BSLS_MACROINCREMENTED_VALUE10679 10680
+#define BSLS_MACROINCREMENTED_VALUE10680 10681
+#define BSLS_MACROINCREMENTED_VALUE10681 10682
+#define BSLS_MACROINCREMENTED_VALUE10682 10683
+#define BSLS_MACROINCREMENTED_VALUE10683 10684
+#define BSLS_MACROINCREMENTED_VALUE10684 10685
+#define BSLS_MACROINCREMENTED_VALUE10685 10686
+#define BSLS_MACROINCREMENTED_VALUE10686 10687
+#define BSLS_MACROINCREMENTED_VALUE10687 10688
+#define BSLS_MACROINCREMENTED_VALUE10688 10689
+#define BSLS_MACROINCREMENTED_VALUE10689 10690
+#define BSLS_MACROINCREMENTED_VALUE10690 10691
+#define BSLS_MACROINCREMENTED_VALUE10691 10692
+#define BSLS_MACROINCREMENTED_VALUE10692 10693
+#define BSLS_MACROINCREMENTED_VALUE10693 10694
+#define BSLS_MACROINCREMENTED_VALUE10694 10695
+#define BSLS_MACROINCREMENTED_VALUE10695 10696
+#define BSLS_MACROINCREMENTED_VALUE10696 10697
+#define BSLS_MACROINCREMENTED_VALUE10697 10698
+#define BSLS_MACROINCREMENTED_VALUE10698 10699
+#define BSLS_MACROINCREMENTED_VALUE10699 10700
+#define BSLS_MACROINCREMENTED_VALUE10700 10701
+#define BSLS_MACROINCREMENTED_VALUE10701 10702
+#define BSLS_MACROINCREMENTED_VALUE10702 10703
+#define BSLS_MACROINCREMENTED_VALUE10703 10704
+#define BSLS_MACROINCREMENTED_VALUE10704 10705
+#define BSLS_MACROINCREMENTED_VALUE10705 10706
+#define BSLS_MACROINCREMENTED_VALUE10706 10707
+#define BSLS_MACROINCREMENTED_VALUE10707 10708
+#define BSLS_MACROINCREMENTED_VALUE10708 10709
+#define BSLS_MACROINCREMENTED_VALUE10709 10710
+#define BSLS_MACROINCREMENTED_VALUE10710 10711
+#define BSLS_MACROINCREMENTED_VALUE10711 10712
+#define BSLS_MACROINCREMENTED_VALUE10712 10713
+#define BSLS_MACROINCREMENTED_VALUE10713 10714
+#define BSLS_MACROINCREMENTED_VALUE10714 10715
+#define BSLS_MACROINCREMENTED_VALUE10715 10716
+#define BSLS_MACROINCREMENTED_VALUE10716 10717
+#define BSLS_MACROINCREMENTED_VALUE10717 10718
+#define BSLS_MACROINCREMENTED_VALUE10718 10719
+#define BSLS_MACROINCREMENTED_VALUE10719 10720
+#define BSLS_MACROINCREMENTED_VALUE10720 10721
+#define BSLS_MACROINCREMENTED_VALUE10721 10722
+#define BSLS_MACROINCREMENTED_VALUE10722 10723
+#define BSLS_MACROINCREMENTED_VALUE10723 10724
+#define BSLS_MACROINCREMENTED_VALUE10724 10725
+#define BSLS_MACROINCREMENTED_VALUE10725 10726
+#define BSLS_MACROINCREMENTED_VALUE10726 10727
+#define BSLS_MACROINCREMENTED_VALUE10727 10728
+#define BSLS_MACROINCREMENTED_VALUE10728 10729
+#define BSLS_MACROINCREMENTED_VALUE10729 10730
+#define BSLS_MACROINCREMENTED_VALUE10730 10731
+#define BSLS_MACROINCREMENTED_VALUE10731 10732
+#define BSLS_MACROINCREMENTED_VALUE10732 10733
+#define BSLS_MACROINCREMENTED_VALUE10733 10734
+#define BSLS_MACROINCREMENTED_VALUE10734 10735
+#define BSLS_MACROINCREMENTED_VALUE10735 10736
+#define BSLS_MACROINCREMENTED_VALUE10736 10737
+#define BSLS_MACROINCREMENTED_VALUE10737 10738
+#define BSLS_MACROINCREMENTED_VALUE10738 10739
+#define BSLS_MACROINCREMENTED_VALUE10739 10740
+#define BSLS_MACROINCREMENTED_VALUE10740 10741
+#define BSLS_MACROINCREMENTED_VALUE10741 10742
+#define BSLS_MACROINCREMENTED_VALUE10742 10743
+#define BSLS_MACROINCREMENTED_VALUE10743 10744
+#define BSLS_MACROINCREMENTED_VALUE10744 10745
+#define BSLS_MACROINCREMENTED_VALUE10745 10746
+#define BSLS_MACROINCREMENTED_VALUE10746 10747
+#define BSLS_MACROINCREMENTED_VALUE10747 10748
+#define BSLS_MACROINCREMENTED_VALUE10748 10749
+#define BSLS_MACROINCREMENTED_VALUE10749 10750
+#define BSLS_MACROINCREMENTED_VALUE10750 10751
+#define BSLS_MACROINCREMENTED_VALUE10751 10752
+#define BSLS_MACROINCREMENTED_VALUE10752 10753
+#define BSLS_MACROINCREMENTED_VALUE10753 10754
+#define BSLS_MACROINCREMENTED_VALUE10754 10755
+#define BSLS_MACROINCREMENTED_VALUE10755 10756
+#define BSLS_MACROINCREMENTED_VALUE10756 10757
+#define BSLS_MACROINCREMENTED_VALUE10757 10758
+#define BSLS_MACROINCREMENTED_VALUE10758 10759
+#define BSLS_MACROINCREMENTED_VALUE10759 10760
+#define BSLS_MACROINCREMENTED_VALUE10760 10761
+#define BSLS_MACROINCREMENTED_VALUE10761 10762
+#define BSLS_MACROINCREMENTED_VALUE10762 10763
+#define BSLS_MACROINCREMENTED_VALUE10763 10764
+#define BSLS_MACROINCREMENTED_VALUE10764 10765
+#define BSLS_MACROINCREMENTED_VALUE10765 10766
+#define BSLS_MACROINCREMENTED_VALUE10766 10767
+#define BSLS_MACROINCREMENTED_VALUE10767 10768
+#define BSLS_MACROINCREMENTED_VALUE10768 10769
+#define BSLS_MACROINCREMENTED_VALUE10769 10770
+#define BSLS_MACROINCREMENTED_VALUE10770 10771
+#define BSLS_MACROINCREMENTED_VALUE10771 10772
+#define BSLS_MACROINCREMENTED_VALUE10772 10773
+#define BSLS_MACROINCREMENTED_VALUE10773 10774
+#define BSLS_MACROINCREMENTED_VALUE10774 10775
+#define BSLS_MACROINCREMENTED_VALUE10775 10776
+#define BSLS_MACROINCREMENTED_VALUE10776 10777
+#define BSLS_MACROINCREMENTED_VALUE10777 10778
+#define BSLS_MACROINCREMENTED_VALUE10778 10779
+#define BSLS_MACROINCREMENTED_VALUE10779 10780
+#define BSLS_MACROINCREMENTED_VALUE10780 10781
+#define BSLS_MACROINCREMENTED_VALUE10781 10782
+#define BSLS_MACROINCREMENTED_VALUE10782 10783
+#define BSLS_MACROINCREMENTED_VALUE10783 10784
+#define BSLS_MACROINCREMENTED_VALUE10784 10785
+#define BSLS_MACROINCREMENTED_VALUE10785 10786
+#define BSLS_MACROINCREMENTED_VALUE10786 10787
+#define BSLS_MACROINCREMENTED_VALUE10787 10788
+#define BSLS_MACROINCREMENTED_VALUE10788 10789
+#define BSLS_MACROINCREMENTED_VALUE10789 10790
+#define BSLS_MACROINCREMENTED_VALUE10790 10791
+#define BSLS_MACROINCREMENTED_VALUE10791 10792
+#define BSLS_MACROINCREMENTED_VALUE10792 10793
+#define BSLS_MACROINCREMENTED_VALUE10793 10794
+#define BSLS_MACROINCREMENTED_VALUE10794 10795
+#define BSLS_MACROINCREMENTED_VALUE10795 10796
+#define BSLS_MACROINCREMENTED_VALUE10796 10797
+#define BSLS_MACROINCREMENTED_VALUE10797 10798
+#define BSLS_MACROINCREMENTED_VALUE10798 10799
+#define BSLS_MACROINCREMENTED_VALUE10799 10800
+#define BSLS_MACROINCREMENTED_VALUE10800 10801
+#define BSLS_MACROINCREMENTED_VALUE10801 10802
+#define BSLS_MACROINCREMENTED_VALUE10802 10803
+#define BSLS_MACROINCREMENTED_VALUE10803 10804
+#define BSLS_MACROINCREMENTED_VALUE10804 10805
+#define BSLS_MACROINCREMENTED_VALUE10805 10806
+#define BSLS_MACROINCREMENTED_VALUE10806 10807
+#define BSLS_MACROINCREMENTED_VALUE10807 10808
+#define BSLS_MACROINCREMENTED_VALUE10808 10809
+#define BSLS_MACROINCREMENTED_VALUE10809 10810
+#define BSLS_MACROINCREMENTED_VALUE10810 10811
+#define BSLS_MACROINCREMENTED_VALUE10811 10812
+#define BSLS_MACROINCREMENTED_VALUE10812 10813
+#define BSLS_MACROINCREMENTED_VALUE10813 10814
+#define BSLS_MACROINCREMENTED_VALUE10814 10815
+#define BSLS_MACROINCREMENTED_VALUE10815 10816
+#define BSLS_MACROINCREMENTED_VALUE10816 10817
+#define BSLS_MACROINCREMENTED_VALUE10817 10818
+#define BSLS_MACROINCREMENTED_VALUE10818 10819
+#define BSLS_MACROINCREMENTED_VALUE10819 10820
+#define BSLS_MACROINCREMENTED_VALUE10820 10821
+#define BSLS_MACROINCREMENTED_VALUE10821 10822
+#define BSLS_MACROINCREMENTED_VALUE10822 10823
+#define BSLS_MACROINCREMENTED_VALUE10823 10824
+#define BSLS_MACROINCREMENTED_VALUE10824 10825
+#define BSLS_MACROINCREMENTED_VALUE10825 10826
+#define BSLS_MACROINCREMENTED_VALUE10826 10827
+#define BSLS_MACROINCREMENTED_VALUE10827 10828
+#define BSLS_MACROINCREMENTED_VALUE10828 10829
+#define BSLS_MACROINCREMENTED_VALUE10829 10830
+#define BSLS_MACROINCREMENTED_VALUE10830 10831
+#define BSLS_MACROINCREMENTED_VALUE10831 10832
+#define BSLS_MACROINCREMENTED_VALUE10832 10833
+#define BSLS_MACROINCREMENTED_VALUE10833 10834
+#define BSLS_MACROINCREMENTED_VALUE10834 10835
+#define BSLS_MACROINCREMENTED_VALUE10835 10836
+#define BSLS_MACROINCREMENTED_VALUE10836 10837
+#define BSLS_MACROINCREMENTED_VALUE10837 10838
+#define BSLS_MACROINCREMENTED_VALUE10838 10839
+#define BSLS_MACROINCREMENTED_VALUE10839 10840
+#define BSLS_MACROINCREMENTED_VALUE10840 10841
+#define BSLS_MACROINCREMENTED_VALUE10841 10842
+#define BSLS_MACROINCREMENTED_VALUE10842 10843
+#define BSLS_MACROINCREMENTED_VALUE10843 10844
+#define BSLS_MACROINCREMENTED_VALUE10844 10845
+#define BSLS_MACROINCREMENTED_VALUE10845 10846
+#define BSLS_MACROINCREMENTED_VALUE10846 10847
+#define BSLS_MACROINCREMENTED_VALUE10847 10848
+#define BSLS_MACROINCREMENTED_VALUE10848 10849
+#define BSLS_MACROINCREMENTED_VALUE10849 10850
+#define BSLS_MACROINCREMENTED_VALUE10850 10851
+#define BSLS_MACROINCREMENTED_VALUE10851 10852
+#define BSLS_MACROINCREMENTED_VALUE10852 10853
+#define BSLS_MACROINCREMENTED_VALUE10853 10854
+#define BSLS_MACROINCREMENTED_VALUE10854 10855
+#define BSLS_MACROINCREMENTED_VALUE10855 10856
+#define BSLS_MACROINCREMENTED_VALUE10856 10857
+#define BSLS_MACROINCREMENTED_VALUE10857 10858
+#define BSLS_MACROINCREMENTED_VALUE10858 10859
+#define BSLS_MACROINCREMENTED_VALUE10859 10860
+#define BSLS_MACROINCREMENTED_VALUE10860 10861
+#define BSLS_MACROINCREMENTED_VALUE10861 10862
+#define BSLS_MACROINCREMENTED_VALUE10862 10863
+#define BSLS_MACROINCREMENTED_VALUE10863 10864
+#define BSLS_MACROINCREMENTED_VALUE10864 10865
+#define BSLS_MACROINCREMENTED_VALUE10865 10866
+#define BSLS_MACROINCREMENTED_VALUE10866 10867
+#define BSLS_MACROINCREMENTED_VALUE10867 10868
+#define BSLS_MACROINCREMENTED_VALUE10868 10869
+#define BSLS_MACROINCREMENTED_VALUE10869 10870
+#define BSLS_MACROINCREMENTED_VALUE10870 10871
+#define BSLS_MACROINCREMENTED_VALUE10871 10872
+#define BSLS_MACROINCREMENTED_VALUE10872 10873
+#define BSLS_MACROINCREMENTED_VALUE10873 10874
+#define BSLS_MACROINCREMENTED_VALUE10874 10875
+#define BSLS_MACROINCREMENTED_VALUE10875 10876
+#define BSLS_MACROINCREMENTED_VALUE10876 10877
+#define BSLS_MACROINCREMENTED_VALUE10877 10878
+#define BSLS_MACROINCREMENTED_VALUE10878 10879
+#define BSLS_MACROINCREMENTED_VALUE10879 10880
+#define BSLS_MACROINCREMENTED_VALUE10880 10881
+#define BSLS_MACROINCREMENTED_VALUE10881 10882
+#define BSLS_MACROINCREMENTED_VALUE10882 10883
+#define BSLS_MACROINCREMENTED_VALUE10883 10884
+#define BSLS_MACROINCREMENTED_VALUE10884 10885
+#define BSLS_MACROINCREMENTED_VALUE10885 10886
+#define BSLS_MACROINCREMENTED_VALUE10886 10887
+#define BSLS_MACROINCREMENTED_VALUE10887 10888
+#define BSLS_MACROINCREMENTED_VALUE10888 10889
+#define BSLS_MACROINCREMENTED_VALUE10889 10890
+#define BSLS_MACROINCREMENTED_VALUE10890 10891
+#define BSLS_MACROINCREMENTED_VALUE10891 10892
+#define BSLS_MACROINCREMENTED_VALUE10892 10893
+#define BSLS_MACROINCREMENTED_VALUE10893 10894
+#define BSLS_MACROINCREMENTED_VALUE10894 10895
+#define BSLS_MACROINCREMENTED_VALUE10895 10896
+#define BSLS_MACROINCREMENTED_VALUE10896 10897
+#define BSLS_MACROINCREMENTED_VALUE10897 10898
+#define BSLS_MACROINCREMENTED_VALUE10898 10899
+#define BSLS_MACROINCREMENTED_VALUE10899 10900
+#define BSLS_MACROINCREMENTED_VALUE10900 10901
+#define BSLS_MACROINCREMENTED_VALUE10901 10902
+#define BSLS_MACROINCREMENTED_VALUE10902 10903
+#define BSLS_MACROINCREMENTED_VALUE10903 10904
+#define BSLS_MACROINCREMENTED_VALUE10904 10905
+#define BSLS_MACROINCREMENTED_VALUE10905 10906
+#define BSLS_MACROINCREMENTED_VALUE10906 10907
+#define BSLS_MACROINCREMENTED_VALUE10907 10908
+#define BSLS_MACROINCREMENTED_VALUE10908 10909
+#define BSLS_MACROINCREMENTED_VALUE10909 10910
+#define BSLS_MACROINCREMENTED_VALUE10910 10911
+#define BSLS_MACROINCREMENTED_VALUE10911 10912
+#define BSLS_MACROINCREMENTED_VALUE10912 10913
+#define BSLS_MACROINCREMENTED_VALUE10913 10914
+#define BSLS_MACROINCREMENTED_VALUE10914 10915
+#define BSLS_MACROINCREMENTED_VALUE10915 10916
+#define BSLS_MACROINCREMENTED_VALUE10916 10917
+#define BSLS_MACROINCREMENTED_VALUE10917 10918
+#define BSLS_MACROINCREMENTED_VALUE10918 10919
+#define BSLS_MACROINCREMENTED_VALUE10919 10920
+#define BSLS_MACROINCREMENTED_VALUE10920 10921
+#define BSLS_MACROINCREMENTED_VALUE10921 10922
+#define BSLS_MACROINCREMENTED_VALUE10922 10923
+#define BSLS_MACROINCREMENTED_VALUE10923 10924
+#define BSLS_MACROINCREMENTED_VALUE10924 10925
+#define BSLS_MACROINCREMENTED_VALUE10925 10926
+#define BSLS_MACROINCREMENTED_VALUE10926 10927
+#define BSLS_MACROINCREMENTED_VALUE10927 10928
+#define BSLS_MACROINCREMENTED_VALUE10928 10929
+#define BSLS_MACROINCREMENTED_VALUE10929 10930
+#define BSLS_MACROINCREMENTED_VALUE10930 10931
+#define BSLS_MACROINCREMENTED_VALUE10931 10932
+#define BSLS_MACROINCREMENTED_VALUE10932 10933
+#define BSLS_MACROINCREMENTED_VALUE10933 10934
+#define BSLS_MACROINCREMENTED_VALUE10934 10935
+#define BSLS_MACROINCREMENTED_VALUE10935 10936
+#define BSLS_MACROINCREMENTED_VALUE10936 10937
+#define BSLS_MACROINCREMENTED_VALUE10937 10938
+#define BSLS_MACROINCREMENTED_VALUE10938 10939
+#define BSLS_MACROINCREMENTED_VALUE10939 10940
+#define BSLS_MACROINCREMENTED_VALUE10940 10941
+#define BSLS_MACROINCREMENTED_VALUE10941 10942
+#define BSLS_MACROINCREMENTED_VALUE10942 10943
+#define BSLS_MACROINCREMENTED_VALUE10943 10944
+#define BSLS_MACROINCREMENTED_VALUE10944 10945
+#define BSLS_MACROINCREMENTED_VALUE10945 10946
+#define BSLS_MACROINCREMENTED_VALUE10946 10947
+#define BSLS_MACROINCREMENTED_VALUE10947 10948
+#define BSLS_MACROINCREMENTED_VALUE10948 10949
+#define BSLS_MACROINCREMENTED_VALUE10949 10950
+#define BSLS_MACROINCREMENTED_VALUE10950 10951
+#define BSLS_MACROINCREMENTED_VALUE10951 10952
+#define BSLS_MACROINCREMENTED_VALUE10952 10953
+#define BSLS_MACROINCREMENTED_VALUE10953 10954
+#define BSLS_MACROINCREMENTED_VALUE10954 10955
+#define BSLS_MACROINCREMENTED_VALUE10955 10956
+#define BSLS_MACROINCREMENTED_VALUE10956 10957
+#define BSLS_MACROINCREMENTED_VALUE10957 10958
+#define BSLS_MACROINCREMENTED_VALUE10958 10959
+#define BSLS_MACROINCREMENTED_VALUE10959 10960
+#define BSLS_MACROINCREMENTED_VALUE10960 10961
+#define BSLS_MACROINCREMENTED_VALUE10961 10962
+#define BSLS_MACROINCREMENTED_VALUE10962 10963
+#define BSLS_MACROINCREMENTED_VALUE10963 10964
+#define BSLS_MACROINCREMENTED_VALUE10964 10965
+#define BSLS_MACROINCREMENTED_VALUE10965 10966
+#define BSLS_MACROINCREMENTED_VALUE10966 10967
+#define BSLS_MACROINCREMENTED_VALUE10967 10968
+#define BSLS_MACROINCREMENTED_VALUE10968 10969
+#define BSLS_MACROINCREMENTED_VALUE10969 10970
+#define BSLS_MACROINCREMENTED_VALUE10970 10971
+#define BSLS_MACROINCREMENTED_VALUE10971 10972
+#define BSLS_MACROINCREMENTED_VALUE10972 10973
+#define BSLS_MACROINCREMENTED_VALUE10973 10974
+#define BSLS_MACROINCREMENTED_VALUE10974 10975
+#define BSLS_MACROINCREMENTED_VALUE10975 10976
+#define BSLS_MACROINCREMENTED_VALUE10976 10977
+#define BSLS_MACROINCREMENTED_VALUE10977 10978
+#define BSLS_MACROINCREMENTED_VALUE10978 10979
+#define BSLS_MACROINCREMENTED_VALUE10979 10980
+#define BSLS_MACROINCREMENTED_VALUE10980 10981
+#define BSLS_MACROINCREMENTED_VALUE10981 10982
+#define BSLS_MACROINCREMENTED_VALUE10982 10983
+#define BSLS_MACROINCREMENTED_VALUE10983 10984
+#define BSLS_MACROINCREMENTED_VALUE10984 10985
+#define BSLS_MACROINCREMENTED_VALUE10985 10986
+#define BSLS_MACROINCREMENTED_VALUE10986 10987
+#define BSLS_MACROINCREMENTED_VALUE10987 10988
+#define BSLS_MACROINCREMENTED_VALUE10988 10989
+#define BSLS_MACROINCREMENTED_VALUE10989 10990
+#define BSLS_MACROINCREMENTED_VALUE10990 10991
+#define BSLS_MACROINCREMENTED_VALUE10991 10992
+#define BSLS_MACROINCREMENTED_VALUE10992 10993
+#define BSLS_MACROINCREMENTED_VALUE10993 10994
+#define BSLS_MACROINCREMENTED_VALUE10994 10995
+#define BSLS_MACROINCREMENTED_VALUE10995 10996
+#define BSLS_MACROINCREMENTED_VALUE10996 10997
+#define BSLS_MACROINCREMENTED_VALUE10997 10998
+#define BSLS_MACROINCREMENTED_VALUE10998 10999
+#define BSLS_MACROINCREMENTED_VALUE10999 11000
+#define BSLS_MACROINCREMENTED_VALUE11000 11001
+#define BSLS_MACROINCREMENTED_VALUE11001 11002
+#define BSLS_MACROINCREMENTED_VALUE11002 11003
+#define BSLS_MACROINCREMENTED_VALUE11003 11004
+#define BSLS_MACROINCREMENTED_VALUE11004 11005
+#define BSLS_MACROINCREMENTED_VALUE11005 11006
+#define BSLS_MACROINCREMENTED_VALUE11006 11007
+#define BSLS_MACROINCREMENTED_VALUE11007 11008
+#define BSLS_MACROINCREMENTED_VALUE11008 11009
+#define BSLS_MACROINCREMENTED_VALUE11009 11010
+#define BSLS_MACROINCREMENTED_VALUE11010 11011
+#define BSLS_MACROINCREMENTED_VALUE11011 11012
+#define BSLS_MACROINCREMENTED_VALUE11012 11013
+#define BSLS_MACROINCREMENTED_VALUE11013 11014
+#define BSLS_MACROINCREMENTED_VALUE11014 11015
+#define BSLS_MACROINCREMENTED_VALUE11015 11016
+#define BSLS_MACROINCREMENTED_VALUE11016 11017
+#define BSLS_MACROINCREMENTED_VALUE11017 11018
+#define BSLS_MACROINCREMENTED_VALUE11018 11019
+#define BSLS_MACROINCREMENTED_VALUE11019 11020
+#define BSLS_MACROINCREMENTED_VALUE11020 11021
+#define BSLS_MACROINCREMENTED_VALUE11021 11022
+#define BSLS_MACROINCREMENTED_VALUE11022 11023
+#define BSLS_MACROINCREMENTED_VALUE11023 11024
+#define BSLS_MACROINCREMENTED_VALUE11024 11025
+#define BSLS_MACROINCREMENTED_VALUE11025 11026
+#define BSLS_MACROINCREMENTED_VALUE11026 11027
+#define BSLS_MACROINCREMENTED_VALUE11027 11028
+#define BSLS_MACROINCREMENTED_VALUE11028 11029
+#define BSLS_MACROINCREMENTED_VALUE11029 11030
+#define BSLS_MACROINCREMENTED_VALUE11030 11031
+#define BSLS_MACROINCREMENTED_VALUE11031 11032
+#define BSLS_MACROINCREMENTED_VALUE11032 11033
+#define BSLS_MACROINCREMENTED_VALUE11033 11034
+#define BSLS_MACROINCREMENTED_VALUE11034 11035
+#define BSLS_MACROINCREMENTED_VALUE11035 11036
+#define BSLS_MACROINCREMENTED_VALUE11036 11037
+#define BSLS_MACROINCREMENTED_VALUE11037 11038
+#define BSLS_MACROINCREMENTED_VALUE11038 11039
+#define BSLS_MACROINCREMENTED_VALUE11039 11040
+#define BSLS_MACROINCREMENTED_VALUE11040 11041
+#define BSLS_MACROINCREMENTED_VALUE11041 11042
+#define BSLS_MACROINCREMENTED_VALUE11042 11043
+#define BSLS_MACROINCREMENTED_VALUE11043 11044
+#define BSLS_MACROINCREMENTED_VALUE11044 11045
+#define BSLS_MACROINCREMENTED_VALUE11045 11046
+#define BSLS_MACROINCREMENTED_VALUE11046 11047
+#define BSLS_MACROINCREMENTED_VALUE11047 11048
+#define BSLS_MACROINCREMENTED_VALUE11048 11049
+#define BSLS_MACROINCREMENTED_VALUE11049 11050
+#define BSLS_MACROINCREMENTED_VALUE11050 11051
+#define BSLS_MACROINCREMENTED_VALUE11051 11052
+#define BSLS_MACROINCREMENTED_VALUE11052 11053
+#define BSLS_MACROINCREMENTED_VALUE11053 11054
+#define BSLS_MACROINCREMENTED_VALUE11054 11055
+#define BSLS_MACROINCREMENTED_VALUE11055 11056
+#define BSLS_MACROINCREMENTED_VALUE11056 11057
+#define BSLS_MACROINCREMENTED_VALUE11057 11058
+#define BSLS_MACROINCREMENTED_VALUE11058 11059
+#define BSLS_MACROINCREMENTED_VALUE11059 11060
+#define BSLS_MACROINCREMENTED_VALUE11060 11061
+#define BSLS_MACROINCREMENTED_VALUE11061 11062
+#define BSLS_MACROINCREMENTED_VALUE11062 11063
+#define BSLS_MACROINCREMENTED_VALUE11063 11064
+#define BSLS_MACROINCREMENTED_VALUE11064 11065
+#define BSLS_MACROINCREMENTED_VALUE11065 11066
+#define BSLS_MACROINCREMENTED_VALUE11066 11067
+#define BSLS_MACROINCREMENTED_VALUE11067 11068
+#define BSLS_MACROINCREMENTED_VALUE11068 11069
+#define BSLS_MACROINCREMENTED_VALUE11069 11070
+#define BSLS_MACROINCREMENTED_VALUE11070 11071
+#define BSLS_MACROINCREMENTED_VALUE11071 11072
+#define BSLS_MACROINCREMENTED_VALUE11072 11073
+#define BSLS_MACROINCREMENTED_VALUE11073 11074
+#define BSLS_MACROINCREMENTED_VALUE11074 11075
+#define BSLS_MACROINCREMENTED_VALUE11075 11076
+#define BSLS_MACROINCREMENTED_VALUE11076 11077
+#define BSLS_MACROINCREMENTED_VALUE11077 11078
+#define BSLS_MACROINCREMENTED_VALUE11078 11079
+#define BSLS_MACROINCREMENTED_VALUE11079 11080
+#define BSLS_MACROINCREMENTED_VALUE11080 11081
+#define BSLS_MACROINCREMENTED_VALUE11081 11082
+#define BSLS_MACROINCREMENTED_VALUE11082 11083
+#define BSLS_MACROINCREMENTED_VALUE11083 11084
+#define BSLS_MACROINCREMENTED_VALUE11084 11085
+#define BSLS_MACROINCREMENTED_VALUE11085 11086
+#define BSLS_MACROINCREMENTED_VALUE11086 11087
+#define BSLS_MACROINCREMENTED_VALUE11087 11088
+#define BSLS_MACROINCREMENTED_VALUE11088 11089
+#define BSLS_MACROINCREMENTED_VALUE11089 11090
+#define BSLS_MACROINCREMENTED_VALUE11090 11091
+#define BSLS_MACROINCREMENTED_VALUE11091 11092
+#define BSLS_MACROINCREMENTED_VALUE11092 11093
+#define BSLS_MACROINCREMENTED_VALUE11093 11094
+#define BSLS_MACROINCREMENTED_VALUE11094 11095
+#define BSLS_MACROINCREMENTED_VALUE11095 11096
+#define BSLS_MACROINCREMENTED_VALUE11096 11097
+#define BSLS_MACROINCREMENTED_VALUE11097 11098
+#define BSLS_MACROINCREMENTED_VALUE11098 11099
+#define BSLS_MACROINCREMENTED_VALUE11099 11100
+#define BSLS_MACROINCREMENTED_VALUE11100 11101
+#define BSLS_MACROINCREMENTED_VALUE11101 11102
+#define BSLS_MACROINCREMENTED_VALUE11102 11103
+#define BSLS_MACROINCREMENTED_VALUE11103 11104
+#define BSLS_MACROINCREMENTED_VALUE11104 11105
+#define BSLS_MACROINCREMENTED_VALUE11105 11106
+#define BSLS_MACROINCREMENTED_VALUE11106 11107
+#define BSLS_MACROINCREMENTED_VALUE11107 11108
+#define BSLS_MACROINCREMENTED_VALUE11108 11109
+#define BSLS_MACROINCREMENTED_VALUE11109 11110
+#define BSLS_MACROINCREMENTED_VALUE11110 11111
+#define BSLS_MACROINCREMENTED_VALUE11111 11112
+#define BSLS_MACROINCREMENTED_VALUE11112 11113
+#define BSLS_MACROINCREMENTED_VALUE11113 11114
+#define BSLS_MACROINCREMENTED_VALUE11114 11115
+#define BSLS_MACROINCREMENTED_VALUE11115 11116
+#define BSLS_MACROINCREMENTED_VALUE11116 11117
+#define BSLS_MACROINCREMENTED_VALUE11117 11118
+#define BSLS_MACROINCREMENTED_VALUE11118 11119
+#define BSLS_MACROINCREMENTED_VALUE11119 11120
+#define BSLS_MACROINCREMENTED_VALUE11120 11121
+#define BSLS_MACROINCREMENTED_VALUE11121 11122
+#define BSLS_MACROINCREMENTED_VALUE11122 11123
+#define BSLS_MACROINCREMENTED_VALUE11123 11124
+#define BSLS_MACROINCREMENTED_VALUE11124 11125
+#define BSLS_MACROINCREMENTED_VALUE11125 11126
+#define BSLS_MACROINCREMENTED_VALUE11126 11127
+#define BSLS_MACROINCREMENTED_VALUE11127 11128
+#define BSLS_MACROINCREMENTED_VALUE11128 11129
+#define BSLS_MACROINCREMENTED_VALUE11129 11130
+#define BSLS_MACROINCREMENTED_VALUE11130 11131
+#define BSLS_MACROINCREMENTED_VALUE11131 11132
+#define BSLS_MACROINCREMENTED_VALUE11132 11133
+#define BSLS_MACROINCREMENTED_VALUE11133 11134
+#define BSLS_MACROINCREMENTED_VALUE11134 11135
+#define BSLS_MACROINCREMENTED_VALUE11135 11136
+#define BSLS_MACROINCREMENTED_VALUE11136 11137
+#define BSLS_MACROINCREMENTED_VALUE11137 11138
+#define BSLS_MACROINCREMENTED_VALUE11138 11139
+#define BSLS_MACROINCREMENTED_VALUE11139 11140
+#define BSLS_MACROINCREMENTED_VALUE11140 11141
+#define BSLS_MACROINCREMENTED_VALUE11141 11142
+#define BSLS_MACROINCREMENTED_VALUE11142 11143
+#define BSLS_MACROINCREMENTED_VALUE11143 11144
+#define BSLS_MACROINCREMENTED_VALUE11144 11145
+#define BSLS_MACROINCREMENTED_VALUE11145 11146
+#define BSLS_MACROINCREMENTED_VALUE11146 11147
+#define BSLS_MACROINCREMENTED_VALUE11147 11148
+#define BSLS_MACROINCREMENTED_VALUE11148 11149
+#define BSLS_MACROINCREMENTED_VALUE11149 11150
+#define BSLS_MACROINCREMENTED_VALUE11150 11151
+#define BSLS_MACROINCREMENTED_VALUE11151 11152
+#define BSLS_MACROINCREMENTED_VALUE11152 11153
+#define BSLS_MACROINCREMENTED_VALUE11153 11154
+#define BSLS_MACROINCREMENTED_VALUE11154 11155
+#define BSLS_MACROINCREMENTED_VALUE11155 11156
+#define BSLS_MACROINCREMENTED_VALUE11156 11157
+#define BSLS_MACROINCREMENTED_VALUE11157 11158
+#define BSLS_MACROINCREMENTED_VALUE11158 11159
+#define BSLS_MACROINCREMENTED_VALUE11159 11160
+#define BSLS_MACROINCREMENTED_VALUE11160 11161
+#define BSLS_MACROINCREMENTED_VALUE11161 11162
+#define BSLS_MACROINCREMENTED_VALUE11162 11163
+#define BSLS_MACROINCREMENTED_VALUE11163 11164
+#define BSLS_MACROINCREMENTED_VALUE11164 11165
+#define BSLS_MACROINCREMENTED_VALUE11165 11166
+#define BSLS_MACROINCREMENTED_VALUE11166 11167
+#define BSLS_MACROINCREMENTED_VALUE11167 11168
+#define BSLS_MACROINCREMENTED_VALUE11168 11169
+#define BSLS_MACROINCREMENTED_VALUE11169 11170
+#define BSLS_MACROINCREMENTED_VALUE11170 11171
+#define BSLS_MACROINCREMENTED_VALUE11171 11172
+#define BSLS_MACROINCREMENTED_VALUE11172 11173
+#define BSLS_MACROINCREMENTED_VALUE11173 11174
+#define BSLS_MACROINCREMENTED_VALUE11174 11175
+#define BSLS_MACROINCREMENTED_VALUE11175 11176
+#define BSLS_MACROINCREMENTED_VALUE11176 11177
+#define BSLS_MACROINCREMENTED_VALUE11177 11178
+#define BSLS_MACROINCREMENTED_VALUE11178 11179
+#define BSLS_MACROINCREMENTED_VALUE11179 11180
+#define BSLS_MACROINCREMENTED_VALUE11180 11181
+#define BSLS_MACROINCREMENTED_VALUE11181 11182
+#define BSLS_MACROINCREMENTED_VALUE11182 11183
+#define BSLS_MACROINCREMENTED_VALUE11183 11184
+#define BSLS_MACROINCREMENTED_VALUE11184 11185
+#define BSLS_MACROINCREMENTED_VALUE11185 11186
+#define BSLS_MACROINCREMENTED_VALUE11186 11187
+#define BSLS_MACROINCREMENTED_VALUE11187 11188
+#define BSLS_MACROINCREMENTED_VALUE11188 11189
+#define BSLS_MACROINCREMENTED_VALUE11189 11190
+#define BSLS_MACROINCREMENTED_VALUE11190 11191
+#define BSLS_MACROINCREMENTED_VALUE11191 11192
+#define BSLS_MACROINCREMENTED_VALUE11192 11193
+#define BSLS_MACROINCREMENTED_VALUE11193 11194
+#define BSLS_MACROINCREMENTED_VALUE11194 11195
+#define BSLS_MACROINCREMENTED_VALUE11195 11196
+#define BSLS_MACROINCREMENTED_VALUE11196 11197
+#define BSLS_MACROINCREMENTED_VALUE11197 11198
+#define BSLS_MACROINCREMENTED_VALUE11198 11199
+#define BSLS_MACROINCREMENTED_VALUE11199 11200
+#define BSLS_MACROINCREMENTED_VALUE11200 11201
+#define BSLS_MACROINCREMENTED_VALUE11201 11202
+#define BSLS_MACROINCREMENTED_VALUE11202 11203
+#define BSLS_MACROINCREMENTED_VALUE11203 11204
+#define BSLS_MACROINCREMENTED_VALUE11204 11205
+#define BSLS_MACROINCREMENTED_VALUE11205 11206
+#define BSLS_MACROINCREMENTED_VALUE11206 11207
+#define BSLS_MACROINCREMENTED_VALUE11207 11208
+#define BSLS_MACROINCREMENTED_VALUE11208 11209
+#define BSLS_MACROINCREMENTED_VALUE11209 11210
+#define BSLS_MACROINCREMENTED_VALUE11210 11211
+#define BSLS_MACROINCREMENTED_VALUE11211 11212
+#define BSLS_MACROINCREMENTED_VALUE11212 11213
+#define BSLS_MACROINCREMENTED_VALUE11213 11214
+#define BSLS_MACROINCREMENTED_VALUE11214 11215
+#define BSLS_MACROINCREMENTED_VALUE11215 11216
+#define BSLS_MACROINCREMENTED_VALUE11216 11217
+#define BSLS_MACROINCREMENTED_VALUE11217 11218
+#define BSLS_MACROINCREMENTED_VALUE11218 11219
+#define BSLS_MACROINCREMENTED_VALUE11219 11220
+#define BSLS_MACROINCREMENTED_VALUE11220 11221
+#define BSLS_MACROINCREMENTED_VALUE11221 11222
+#define BSLS_MACROINCREMENTED_VALUE11222 11223
+#define BSLS_MACROINCREMENTED_VALUE11223 11224
+#define BSLS_MACROINCREMENTED_VALUE11224 11225
+#define BSLS_MACROINCREMENTED_VALUE11225 11226
+#define BSLS_MACROINCREMENTED_VALUE11226 11227
+#define BSLS_MACROINCREMENTED_VALUE11227 11228
+#define BSLS_MACROINCREMENTED_VALUE11228 11229
+#define BSLS_MACROINCREMENTED_VALUE11229 11230
+#define BSLS_MACROINCREMENTED_VALUE11230 11231
+#define BSLS_MACROINCREMENTED_VALUE11231 11232
+#define BSLS_MACROINCREMENTED_VALUE11232 11233
+#define BSLS_MACROINCREMENTED_VALUE11233 11234
+#define BSLS_MACROINCREMENTED_VALUE11234 11235
+#define BSLS_MACROINCREMENTED_VALUE11235 11236
+#define BSLS_MACROINCREMENTED_VALUE11236 11237
+#define BSLS_MACROINCREMENTED_VALUE11237 11238
+#define BSLS_MACROINCREMENTED_VALUE11238 11239
+#define BSLS_MACROINCREMENTED_VALUE11239 11240
+#define BSLS_MACROINCREMENTED_VALUE11240 11241
+#define BSLS_MACROINCREMENTED_VALUE11241 11242
+#define BSLS_MACROINCREMENTED_VALUE11242 11243
+#define BSLS_MACROINCREMENTED_VALUE11243 11244
+#define BSLS_MACROINCREMENTED_VALUE11244 11245
+#define BSLS_MACROINCREMENTED_VALUE11245 11246
+#define BSLS_MACROINCREMENTED_VALUE11246 11247
+#define BSLS_MACROINCREMENTED_VALUE11247 11248
+#define BSLS_MACROINCREMENTED_VALUE11248 11249
+#define BSLS_MACROINCREMENTED_VALUE11249 11250
+#define BSLS_MACROINCREMENTED_VALUE11250 11251
+#define BSLS_MACROINCREMENTED_VALUE11251 11252
+#define BSLS_MACROINCREMENTED_VALUE11252 11253
+#define BSLS_MACROINCREMENTED_VALUE11253 11254
+#define BSLS_MACROINCREMENTED_VALUE11254 11255
+#define BSLS_MACROINCREMENTED_VALUE11255 11256
+#define BSLS_MACROINCREMENTED_VALUE11256 11257
+#define BSLS_MACROINCREMENTED_VALUE11257 11258
+#define BSLS_MACROINCREMENTED_VALUE11258 11259
+#define BSLS_MACROINCREMENTED_VALUE11259 11260
+#define BSLS_MACROINCREMENTED_VALUE11260 11261
+#define BSLS_MACROINCREMENTED_VALUE11261 11262
+#define BSLS_MACROINCREMENTED_VALUE11262 11263
+#define BSLS_MACROINCREMENTED_VALUE11263 11264
+#define BSLS_MACROINCREMENTED_VALUE11264 11265
+#define BSLS_MACROINCREMENTED_VALUE11265 11266
+#define BSLS_MACROINCREMENTED_VALUE11266 11267
+#define BSLS_MACROINCREMENTED_VALUE11267 11268
+#define BSLS_MACROINCREMENTED_VALUE11268 11269
+#define BSLS_MACROINCREMENTED_VALUE11269 11270
+#define BSLS_MACROINCREMENTED_VALUE11270 11271
+#define BSLS_MACROINCREMENTED_VALUE11271 11272
+#define BSLS_MACROINCREMENTED_VALUE11272 11273
+#define BSLS_MACROINCREMENTED_VALUE11273 11274
+#define BSLS_MACROINCREMENTED_VALUE11274 11275
+#define BSLS_MACROINCREMENTED_VALUE11275 11276
+#define BSLS_MACROINCREMENTED_VALUE11276 11277
+#define BSLS_MACROINCREMENTED_VALUE11277 11278
+#define BSLS_MACROINCREMENTED_VALUE11278 11279
+#define BSLS_MACROINCREMENTED_VALUE11279 11280
+#define BSLS_MACROINCREMENTED_VALUE11280 11281
+#define BSLS_MACROINCREMENTED_VALUE11281 11282
+#define BSLS_MACROINCREMENTED_VALUE11282 11283
+#define BSLS_MACROINCREMENTED_VALUE11283 11284
+#define BSLS_MACROINCREMENTED_VALUE11284 11285
+#define BSLS_MACROINCREMENTED_VALUE11285 11286
+#define BSLS_MACROINCREMENTED_VALUE11286 11287
+#define BSLS_MACROINCREMENTED_VALUE11287 11288
+#define BSLS_MACROINCREMENTED_VALUE11288 11289
+#define BSLS_MACROINCREMENTED_VALUE11289 11290
+#define BSLS_MACROINCREMENTED_VALUE11290 11291
+#define BSLS_MACROINCREMENTED_VALUE11291 11292
+#define BSLS_MACROINCREMENTED_VALUE11292 11293
+#define BSLS_MACROINCREMENTED_VALUE11293 11294
+#define BSLS_MACROINCREMENTED_VALUE11294 11295
+#define BSLS_MACROINCREMENTED_VALUE11295 11296
+#define BSLS_MACROINCREMENTED_VALUE11296 11297
+#define BSLS_MACROINCREMENTED_VALUE11297 11298
+#define BSLS_MACROINCREMENTED_VALUE11298 11299
+#define BSLS_MACROINCREMENTED_VALUE11299 11300
+#define BSLS_MACROINCREMENTED_VALUE11300 11301
+#define BSLS_MACROINCREMENTED_VALUE11301 11302
+#define BSLS_MACROINCREMENTED_VALUE11302 11303
+#define BSLS_MACROINCREMENTED_VALUE11303 11304
+#define BSLS_MACROINCREMENTED_VALUE11304 11305
+#define BSLS_MACROINCREMENTED_VALUE11305 11306
+#define BSLS_MACROINCREMENTED_VALUE11306 11307
+#define BSLS_MACROINCREMENTED_VALUE11307 11308
+#define BSLS_MACROINCREMENTED_VALUE11308 11309
+#define BSLS_MACROINCREMENTED_VALUE11309 11310
+#define BSLS_MACROINCREMENTED_VALUE11310 11311
+#define BSLS_MACROINCREMENTED_VALUE11311 11312
+#define BSLS_MACROINCREMENTED_VALUE11312 11313
+#define BSLS_MACROINCREMENTED_VALUE11313 11314
+#define BSLS_MACROINCREMENTED_VALUE11314 11315
+#define BSLS_MACROINCREMENTED_VALUE11315 11316
+#define BSLS_MACROINCREMENTED_VALUE11316 11317
+#define BSLS_MACROINCREMENTED_VALUE11317 11318
+#define BSLS_MACROINCREMENTED_VALUE11318 11319
+#define BSLS_MACROINCREMENTED_VALUE11319 11320
+#define BSLS_MACROINCREMENTED_VALUE11320 11321
+#define BSLS_MACROINCREMENTED_VALUE11321 11322
+#define BSLS_MACROINCREMENTED_VALUE11322 11323
+#define BSLS_MACROINCREMENTED_VALUE11323 11324
+#define BSLS_MACROINCREMENTED_VALUE11324 11325
+#define BSLS_MACROINCREMENTED_VALUE11325 11326
+#define BSLS_MACROINCREMENTED_VALUE11326 11327
+#define BSLS_MACROINCREMENTED_VALUE11327 11328
+#define BSLS_MACROINCREMENTED_VALUE11328 11329
+#define BSLS_MACROINCREMENTED_VALUE11329 11330
+#define BSLS_MACROINCREMENTED_VALUE11330 11331
+#define BSLS_MACROINCREMENTED_VALUE11331 11332
+#define BSLS_MACROINCREMENTED_VALUE11332 11333
+#define BSLS_MACROINCREMENTED_VALUE11333 11334
+#define BSLS_MACROINCREMENTED_VALUE11334 11335
+#define BSLS_MACROINCREMENTED_VALUE11335 11336
+#define BSLS_MACROINCREMENTED_VALUE11336 11337
+#define BSLS_MACROINCREMENTED_VALUE11337 11338
+#define BSLS_MACROINCREMENTED_VALUE11338 11339
+#define BSLS_MACROINCREMENTED_VALUE11339 11340
+#define BSLS_MACROINCREMENTED_VALUE11340 11341
+#define BSLS_MACROINCREMENTED_VALUE11341 11342
+#define BSLS_MACROINCREMENTED_VALUE11342 11343
+#define BSLS_MACROINCREMENTED_VALUE11343 11344
+#define BSLS_MACROINCREMENTED_VALUE11344 11345
+#define BSLS_MACROINCREMENTED_VALUE11345 11346
+#define BSLS_MACROINCREMENTED_VALUE11346 11347
+#define BSLS_MACROINCREMENTED_VALUE11347 11348
+#define BSLS_MACROINCREMENTED_VALUE11348 11349
+#define BSLS_MACROINCREMENTED_VALUE11349 11350
+#define BSLS_MACROINCREMENTED_VALUE11350 11351
+#define BSLS_MACROINCREMENTED_VALUE11351 11352
+#define BSLS_MACROINCREMENTED_VALUE11352 11353
+#define BSLS_MACROINCREMENTED_VALUE11353 11354
+#define BSLS_MACROINCREMENTED_VALUE11354 11355
+#define BSLS_MACROINCREMENTED_VALUE11355 11356
+#define BSLS_MACROINCREMENTED_VALUE11356 11357
+#define BSLS_MACROINCREMENTED_VALUE11357 11358
+#define BSLS_MACROINCREMENTED_VALUE11358 11359
+#define BSLS_MACROINCREMENTED_VALUE11359 11360
+#define BSLS_MACROINCREMENTED_VALUE11360 11361
+#define BSLS_MACROINCREMENTED_VALUE11361 11362
+#define BSLS_MACROINCREMENTED_VALUE11362 11363
+#define BSLS_MACROINCREMENTED_VALUE11363 11364
+#define BSLS_MACROINCREMENTED_VALUE11364 11365
+#define BSLS_MACROINCREMENTED_VALUE11365 11366
+#define BSLS_MACROINCREMENTED_VALUE11366 11367
+#define BSLS_MACROINCREMENTED_VALUE11367 11368
+#define BSLS_MACROINCREMENTED_VALUE11368 11369
+#define BSLS_MACROINCREMENTED_VALUE11369 11370
+#define BSLS_MACROINCREMENTED_VALUE11370 11371
+#define BSLS_MACROINCREMENTED_VALUE11371 11372
+#define BSLS_MACROINCREMENTED_VALUE11372 11373
+#define BSLS_MACROINCREMENTED_VALUE11373 11374
+#define BSLS_MACROINCREMENTED_VALUE11374 11375
+#define BSLS_MACROINCREMENTED_VALUE11375 11376
+#define BSLS_MACROINCREMENTED_VALUE11376 11377
+#define BSLS_MACROINCREMENTED_VALUE11377 11378
+#define BSLS_MACROINCREMENTED_VALUE11378 11379
+#define BSLS_MACROINCREMENTED_VALUE11379 11380
+#define BSLS_MACROINCREMENTED_VALUE11380 11381
+#define BSLS_MACROINCREMENTED_VALUE11381 11382
+#define BSLS_MACROINCREMENTED_VALUE11382 11383
+#define BSLS_MACROINCREMENTED_VALUE11383 11384
+#define BSLS_MACROINCREMENTED_VALUE11384 11385
+#define BSLS_MACROINCREMENTED_VALUE11385 11386
+#define BSLS_MACROINCREMENTED_VALUE11386 11387
+#define BSLS_MACROINCREMENTED_VALUE11387 11388
+#define BSLS_MACROINCREMENTED_VALUE11388 11389
+#define BSLS_MACROINCREMENTED_VALUE11389 11390
+#define BSLS_MACROINCREMENTED_VALUE11390 11391
+#define BSLS_MACROINCREMENTED_VALUE11391 11392
+#define BSLS_MACROINCREMENTED_VALUE11392 11393
+#define BSLS_MACROINCREMENTED_VALUE11393 11394
+#define BSLS_MACROINCREMENTED_VALUE11394 11395
+#define BSLS_MACROINCREMENTED_VALUE11395 11396
+#define BSLS_MACROINCREMENTED_VALUE11396 11397
+#define BSLS_MACROINCREMENTED_VALUE11397 11398
+#define BSLS_MACROINCREMENTED_VALUE11398 11399
+#define BSLS_MACROINCREMENTED_VALUE11399 11400
+#define BSLS_MACROINCREMENTED_VALUE11400 11401
+#define BSLS_MACROINCREMENTED_VALUE11401 11402
+#define BSLS_MACROINCREMENTED_VALUE11402 11403
+#define BSLS_MACROINCREMENTED_VALUE11403 11404
+#define BSLS_MACROINCREMENTED_VALUE11404 11405
+#define BSLS_MACROINCREMENTED_VALUE11405 11406
+#define BSLS_MACROINCREMENTED_VALUE11406 11407
+#define BSLS_MACROINCREMENTED_VALUE11407 11408
+#define BSLS_MACROINCREMENTED_VALUE11408 11409
+#define BSLS_MACROINCREMENTED_VALUE11409 11410
+#define BSLS_MACROINCREMENTED_VALUE11410 11411
+#define BSLS_MACROINCREMENTED_VALUE11411 11412
+#define BSLS_MACROINCREMENTED_VALUE11412 11413
+#define BSLS_MACROINCREMENTED_VALUE11413 11414
+#define BSLS_MACROINCREMENTED_VALUE11414 11415
+#define BSLS_MACROINCREMENTED_VALUE11415 11416
+#define BSLS_MACROINCREMENTED_VALUE11416 11417
+#define BSLS_MACROINCREMENTED_VALUE11417 11418
+#define BSLS_MACROINCREMENTED_VALUE11418 11419
+#define BSLS_MACROINCREMENTED_VALUE11419 11420
+#define BSLS_MACROINCREMENTED_VALUE11420 11421
+#define BSLS_MACROINCREMENTED_VALUE11421 11422
+#define BSLS_MACROINCREMENTED_VALUE11422 11423
+#define BSLS_MACROINCREMENTED_VALUE11423 11424
+#define BSLS_MACROINCREMENTED_VALUE11424 11425
+#define BSLS_MACROINCREMENTED_VALUE11425 11426
+#define BSLS_MACROINCREMENTED_VALUE11426 11427
+#define BSLS_MACROINCREMENTED_VALUE11427 11428
+#define BSLS_MACROINCREMENTED_VALUE11428 11429
+#define BSLS_MACROINCREMENTED_VALUE11429 11430
+#define BSLS_MACROINCREMENTED_VALUE11430 11431
+#define BSLS_MACROINCREMENTED_VALUE11431 11432
+#define BSLS_MACROINCREMENTED_VALUE11432 11433
+#define BSLS_MACROINCREMENTED_VALUE11433 11434
+#define BSLS_MACROINCREMENTED_VALUE11434 11435
+#define BSLS_MACROINCREMENTED_VALUE11435 11436
+#define BSLS_MACROINCREMENTED_VALUE11436 11437
+#define BSLS_MACROINCREMENTED_VALUE11437 11438
+#define BSLS_MACROINCREMENTED_VALUE11438 11439
+#define BSLS_MACROINCREMENTED_VALUE11439 11440
+#define BSLS_MACROINCREMENTED_VALUE11440 11441
+#define BSLS_MACROINCREMENTED_VALUE11441 11442
+#define BSLS_MACROINCREMENTED_VALUE11442 11443
+#define BSLS_MACROINCREMENTED_VALUE11443 11444
+#define BSLS_MACROINCREMENTED_VALUE11444 11445
+#define BSLS_MACROINCREMENTED_VALUE11445 11446
+#define BSLS_MACROINCREMENTED_VALUE11446 11447
+#define BSLS_MACROINCREMENTED_VALUE11447 11448
+#define BSLS_MACROINCREMENTED_VALUE11448 11449
+#define BSLS_MACROINCREMENTED_VALUE11449 11450
+#define BSLS_MACROINCREMENTED_VALUE11450 11451
+#define BSLS_MACROINCREMENTED_VALUE11451 11452
+#define BSLS_MACROINCREMENTED_VALUE11452 11453
+#define BSLS_MACROINCREMENTED_VALUE11453 11454
+#define BSLS_MACROINCREMENTED_VALUE11454 11455
+#define BSLS_MACROINCREMENTED_VALUE11455 11456
+#define BSLS_MACROINCREMENTED_VALUE11456 11457
+#define BSLS_MACROINCREMENTED_VALUE11457 11458
+#define BSLS_MACROINCREMENTED_VALUE11458 11459
+#define BSLS_MACROINCREMENTED_VALUE11459 11460
+#define BSLS_MACROINCREMENTED_VALUE11460 11461
+#define BSLS_MACROINCREMENTED_VALUE11461 11462
+#define BSLS_MACROINCREMENTED_VALUE11462 11463
+#define BSLS_MACROINCREMENTED_VALUE11463 11464
+#define BSLS_MACROINCREMENTED_VALUE11464 11465
+#define BSLS_MACROINCREMENTED_VALUE11465 11466
+#define BSLS_MACROINCREMENTED_VALUE11466 11467
+#define BSLS_MACROINCREMENTED_VALUE11467 11468
+#define BSLS_MACROINCREMENTED_VALUE11468 11469
+#define BSLS_MACROINCREMENTED_VALUE11469 11470
+#define BSLS_MACROINCREMENTED_VALUE11470 11471
+#define BSLS_MACROINCREMENTED_VALUE11471 11472
+#define BSLS_MACROINCREMENTED_VALUE11472 11473
+#define BSLS_MACROINCREMENTED_VALUE11473 11474
+#define BSLS_MACROINCREMENTED_VALUE11474 11475
+#define BSLS_MACROINCREMENTED_VALUE11475 11476
+#define BSLS_MACROINCREMENTED_VALUE11476 11477
+#define BSLS_MACROINCREMENTED_VALUE11477 11478
+#define BSLS_MACROINCREMENTED_VALUE11478 11479
+#define BSLS_MACROINCREMENTED_VALUE11479 11480
+#define BSLS_MACROINCREMENTED_VALUE11480 11481
+#define BSLS_MACROINCREMENTED_VALUE11481 11482
+#define BSLS_MACROINCREMENTED_VALUE11482 11483
+#define BSLS_MACROINCREMENTED_VALUE11483 11484
+#define BSLS_MACROINCREMENTED_VALUE11484 11485
+#define BSLS_MACROINCREMENTED_VALUE11485 11486
+#define BSLS_MACROINCREMENTED_VALUE11486 11487
+#define BSLS_MACROINCREMENTED_VALUE11487 11488
+#define BSLS_MACROINCREMENTED_VALUE11488 11489
+#define BSLS_MACROINCREMENTED_VALUE11489 11490
+#define BSLS_MACROINCREMENTED_VALUE11490 11491
+#define BSLS_MACROINCREMENTED_VALUE11491 11492
+#define BSLS_MACROINCREMENTED_VALUE11492 11493
+#define BSLS_MACROINCREMENTED_VALUE11493 11494
+#define BSLS_MACROINCREMENTED_VALUE11494 11495
+#define BSLS_MACROINCREMENTED_VALUE11495 11496
+#define BSLS_MACROINCREMENTED_VALUE11496 11497
+#define BSLS_MACROINCREMENTED_VALUE11497 11498
+#define BSLS_MACROINCREMENTED_VALUE11498 11499
+#define BSLS_MACROINCREMENTED_VALUE11499 11500
+#define BSLS_MACROINCREMENTED_VALUE11500 11501
+#define BSLS_MACROINCREMENTED_VALUE11501 11502
+#define BSLS_MACROINCREMENTED_VALUE11502 11503
+#define BSLS_MACROINCREMENTED_VALUE11503 11504
+#define BSLS_MACROINCREMENTED_VALUE11504 11505
+#define BSLS_MACROINCREMENTED_VALUE11505 11506
+#define BSLS_MACROINCREMENTED_VALUE11506 11507
+#define BSLS_MACROINCREMENTED_VALUE11507 11508
+#define BSLS_MACROINCREMENTED_VALUE11508 11509
+#define BSLS_MACROINCREMENTED_VALUE11509 11510
+#define BSLS_MACROINCREMENTED_VALUE11510 11511
+#define BSLS_MACROINCREMENTED_VALUE11511 11512
+#define BSLS_MACROINCREMENTED_VALUE11512 11513
+#define BSLS_MACROINCREMENTED_VALUE11513 11514
+#define BSLS_MACROINCREMENTED_VALUE11514 11515
+#define BSLS_MACROINCREMENTED_VALUE11515 11516
+#define BSLS_MACROINCREMENTED_VALUE11516 11517
+#define BSLS_MACROINCREMENTED_VALUE11517 11518
+#define BSLS_MACROINCREMENTED_VALUE11518 11519
+#define BSLS_MACROINCREMENTED_VALUE11519 11520
+#define BSLS_MACROINCREMENTED_VALUE11520 11521
+#define BSLS_MACROINCREMENTED_VALUE11521 11522
+#define BSLS_MACROINCREMENTED_VALUE11522 11523
+#define BSLS_MACROINCREMENTED_VALUE11523 11524
+#define BSLS_MACROINCREMENTED_VALUE11524 11525
+#define BSLS_MACROINCREMENTED_VALUE11525 11526
+#define BSLS_MACROINCREMENTED_VALUE11526 11527
+#define BSLS_MACROINCREMENTED_VALUE11527 11528
+#define BSLS_MACROINCREMENTED_VALUE11528 11529
+#define BSLS_MACROINCREMENTED_VALUE11529 11530
+#define BSLS_MACROINCREMENTED_VALUE11530 11531
+#define BSLS_MACROINCREMENTED_VALUE11531 11532
+#define BSLS_MACROINCREMENTED_VALUE11532 11533
+#define BSLS_MACROINCREMENTED_VALUE11533 11534
+#define BSLS_MACROINCREMENTED_VALUE11534 11535
+#define BSLS_MACROINCREMENTED_VALUE11535 11536
+#define BSLS_MACROINCREMENTED_VALUE11536 11537
+#define BSLS_MACROINCREMENTED_VALUE11537 11538
+#define BSLS_MACROINCREMENTED_VALUE11538 11539
+#define BSLS_MACROINCREMENTED_VALUE11539 11540
+#define BSLS_MACROINCREMENTED_VALUE11540 11541
+#define BSLS_MACROINCREMENTED_VALUE11541 11542
+#define BSLS_MACROINCREMENTED_VALUE11542 11543
+#define BSLS_MACROINCREMENTED_VALUE11543 11544
+#define BSLS_MACROINCREMENTED_VALUE11544 11545
+#define BSLS_MACROINCREMENTED_VALUE11545 11546
+#define BSLS_MACROINCREMENTED_VALUE11546 11547
+#define BSLS_MACROINCREMENTED_VALUE11547 11548
+#define BSLS_MACROINCREMENTED_VALUE11548 11549
+#define BSLS_MACROINCREMENTED_VALUE11549 11550
+#define BSLS_MACROINCREMENTED_VALUE11550 11551
+#define BSLS_MACROINCREMENTED_VALUE11551 11552
+#define BSLS_MACROINCREMENTED_VALUE11552 11553
+#define BSLS_MACROINCREMENTED_VALUE11553 11554
+#define BSLS_MACROINCREMENTED_VALUE11554 11555
+#define BSLS_MACROINCREMENTED_VALUE11555 11556
+#define BSLS_MACROINCREMENTED_VALUE11556 11557
+#define BSLS_MACROINCREMENTED_VALUE11557 11558
+#define BSLS_MACROINCREMENTED_VALUE11558 11559
+#define BSLS_MACROINCREMENTED_VALUE11559 11560
+#define BSLS_MACROINCREMENTED_VALUE11560 11561
+#define BSLS_MACROINCREMENTED_VALUE11561 11562
+#define BSLS_MACROINCREMENTED_VALUE11562 11563
+#define BSLS_MACROINCREMENTED_VALUE11563 11564
+#define BSLS_MACROINCREMENTED_VALUE11564 11565
+#define BSLS_MACROINCREMENTED_VALUE11565 11566
+#define BSLS_MACROINCREMENTED_VALUE11566 11567
+#define BSLS_MACROINCREMENTED_VALUE11567 11568
+#define BSLS_MACROINCREMENTED_VALUE11568 11569
+#define BSLS_MACROINCREMENTED_VALUE11569 11570
+#define BSLS_MACROINCREMENTED_VALUE11570 11571
+#define BSLS_MACROINCREMENTED_VALUE11571 11572
+#define BSLS_MACROINCREMENTED_VALUE11572 11573
+#define BSLS_MACROINCREMENTED_VALUE11573 11574
+#define BSLS_MACROINCREMENTED_VALUE11574 11575
+#define BSLS_MACROINCREMENTED_VALUE11575 11576
+#define BSLS_MACROINCREMENTED_VALUE11576 11577
+#define BSLS_MACROINCREMENTED_VALUE11577 11578
+#define BSLS_MACROINCREMENTED_VALUE11578 11579
+#define BSLS_MACROINCREMENTED_VALUE11579 11580
+#define BSLS_MACROINCREMENTED_VALUE11580 11581
+#define BSLS_MACROINCREMENTED_VALUE11581 11582
+#define BSLS_MACROINCREMENTED_VALUE11582 11583
+#define BSLS_MACROINCREMENTED_VALUE11583 11584
+#define BSLS_MACROINCREMENTED_VALUE11584 11585
+#define BSLS_MACROINCREMENTED_VALUE11585 11586
+#define BSLS_MACROINCREMENTED_VALUE11586 11587
+#define BSLS_MACROINCREMENTED_VALUE11587 11588
+#define BSLS_MACROINCREMENTED_VALUE11588 11589
+#define BSLS_MACROINCREMENTED_VALUE11589 11590
+#define BSLS_MACROINCREMENTED_VALUE11590 11591
+#define BSLS_MACROINCREMENTED_VALUE11591 11592
+#define BSLS_MACROINCREMENTED_VALUE11592 11593
+#define BSLS_MACROINCREMENTED_VALUE11593 11594
+#define BSLS_MACROINCREMENTED_VALUE11594 11595
+#define BSLS_MACROINCREMENTED_VALUE11595 11596
+#define BSLS_MACROINCREMENTED_VALUE11596 11597
+#define BSLS_MACROINCREMENTED_VALUE11597 11598
+#define BSLS_MACROINCREMENTED_VALUE11598 11599
+#define BSLS_MACROINCREMENTED_VALUE11599 11600
+#define BSLS_MACROINCREMENTED_VALUE11600 11601
+#define BSLS_MACROINCREMENTED_VALUE11601 11602
+#define BSLS_MACROINCREMENTED_VALUE11602 11603
+#define BSLS_MACROINCREMENTED_VALUE11603 11604
+#define BSLS_MACROINCREMENTED_VALUE11604 11605
+#define BSLS_MACROINCREMENTED_VALUE11605 11606
+#define BSLS_MACROINCREMENTED_VALUE11606 11607
+#define BSLS_MACROINCREMENTED_VALUE11607 11608
+#define BSLS_MACROINCREMENTED_VALUE11608 11609
+#define BSLS_MACROINCREMENTED_VALUE11609 11610
+#define BSLS_MACROINCREMENTED_VALUE11610 11611
+#define BSLS_MACROINCREMENTED_VALUE11611 11612
+#define BSLS_MACROINCREMENTED_VALUE11612 11613
+#define BSLS_MACROINCREMENTED_VALUE11613 11614
+#define BSLS_MACROINCREMENTED_VALUE11614 11615
+#define BSLS_MACROINCREMENTED_VALUE11615 11616
+#define BSLS_MACROINCREMENTED_VALUE11616 11617
+#define BSLS_MACROINCREMENTED_VALUE11617 11618
+#define BSLS_MACROINCREMENTED_VALUE11618 11619
+#define BSLS_MACROINCREMENTED_VALUE11619 11620
+#define BSLS_MACROINCREMENTED_VALUE11620 11621
+#define BSLS_MACROINCREMENTED_VALUE11621 11622
+#define BSLS_MACROINCREMENTED_VALUE11622 11623
+#define BSLS_MACROINCREMENTED_VALUE11623 11624
+#define BSLS_MACROINCREMENTED_VALUE11624 11625
+#define BSLS_MACROINCREMENTED_VALUE11625 11626
+#define BSLS_MACROINCREMENTED_VALUE11626 11627
+#define BSLS_MACROINCREMENTED_VALUE11627 11628
+#define BSLS_MACROINCREMENTED_VALUE11628 11629
+#define BSLS_MACROINCREMENTED_VALUE11629 11630
+#define BSLS_MACROINCREMENTED_VALUE11630 11631
+#define BSLS_MACROINCREMENTED_VALUE11631 11632
+#define BSLS_MACROINCREMENTED_VALUE11632 11633
+#define BSLS_MACROINCREMENTED_VALUE11633 11634
+#define BSLS_MACROINCREMENTED_VALUE11634 11635
+#define BSLS_MACROINCREMENTED_VALUE11635 11636
+#define BSLS_MACROINCREMENTED_VALUE11636 11637
+#define BSLS_MACROINCREMENTED_VALUE11637 11638
+#define BSLS_MACROINCREMENTED_VALUE11638 11639
+#define BSLS_MACROINCREMENTED_VALUE11639 11640
+#define BSLS_MACROINCREMENTED_VALUE11640 11641
+#define BSLS_MACROINCREMENTED_VALUE11641 11642
+#define BSLS_MACROINCREMENTED_VALUE11642 11643
+#define BSLS_MACROINCREMENTED_VALUE11643 11644
+#define BSLS_MACROINCREMENTED_VALUE11644 11645
+#define BSLS_MACROINCREMENTED_VALUE11645 11646
+#define BSLS_MACROINCREMENTED_VALUE11646 11647
+#define BSLS_MACROINCREMENTED_VALUE11647 11648
+#define BSLS_MACROINCREMENTED_VALUE11648 11649
+#define BSLS_MACROINCREMENTED_VALUE11649 11650
+#define BSLS_MACROINCREMENTED_VALUE11650 11651
+#define BSLS_MACROINCREMENTED_VALUE11651 11652
+#define BSLS_MACROINCREMENTED_VALUE11652 11653
+#define BSLS_MACROINCREMENTED_VALUE11653 11654
+#define BSLS_MACROINCREMENTED_VALUE11654 11655
+#define BSLS_MACROINCREMENTED_VALUE11655 11656
+#define BSLS_MACROINCREMENTED_VALUE11656 11657
+#define BSLS_MACROINCREMENTED_VALUE11657 11658
+#define BSLS_MACROINCREMENTED_VALUE11658 11659
+#define BSLS_MACROINCREMENTED_VALUE11659 11660
+#define BSLS_MACROINCREMENTED_VALUE11660 11661
+#define BSLS_MACROINCREMENTED_VALUE11661 11662
+#define BSLS_MACROINCREMENTED_VALUE11662 11663
+#define BSLS_MACROINCREMENTED_VALUE11663 11664
+#define BSLS_MACROINCREMENTED_VALUE11664 11665
+#define BSLS_MACROINCREMENTED_VALUE11665 11666
+#define BSLS_MACROINCREMENTED_VALUE11666 11667
+#define BSLS_MACROINCREMENTED_VALUE11667 11668
+#define BSLS_MACROINCREMENTED_VALUE11668 11669
+#define BSLS_MACROINCREMENTED_VALUE11669 11670
+#define BSLS_MACROINCREMENTED_VALUE11670 11671
+#define BSLS_MACROINCREMENTED_VALUE11671 11672
+#define BSLS_MACROINCREMENTED_VALUE11672 11673
+#define BSLS_MACROINCREMENTED_VALUE11673 11674
+#define BSLS_MACROINCREMENTED_VALUE11674 11675
+#define BSLS_MACROINCREMENTED_VALUE11675 11676
+#define BSLS_MACROINCREMENTED_VALUE11676 11677
+#define BSLS_MACROINCREMENTED_VALUE11677 11678
+#define BSLS_MACROINCREMENTED_VALUE11678 11679
+#define BSLS_MACROINCREMENTED_VALUE11679 11680
+#define BSLS_MACROINCREMENTED_VALUE11680 11681
+#define BSLS_MACROINCREMENTED_VALUE11681 11682
+#define BSLS_MACROINCREMENTED_VALUE11682 11683
+#define BSLS_MACROINCREMENTED_VALUE11683 11684
+#define BSLS_MACROINCREMENTED_VALUE11684 11685
+#define BSLS_MACROINCREMENTED_VALUE11685 11686
+#define BSLS_MACROINCREMENTED_VALUE11686 11687
+#define BSLS_MACROINCREMENTED_VALUE11687 11688
+#define BSLS_MACROINCREMENTED_VALUE11688 11689
+#define BSLS_MACROINCREMENTED_VALUE11689 11690
+#define BSLS_MACROINCREMENTED_VALUE11690 11691
+#define BSLS_MACROINCREMENTED_VALUE11691 11692
+#define BSLS_MACROINCREMENTED_VALUE11692 11693
+#define BSLS_MACROINCREMENTED_VALUE11693 11694
+#define BSLS_MACROINCREMENTED_VALUE11694 11695
+#define BSLS_MACROINCREMENTED_VALUE11695 11696
+#define BSLS_MACROINCREMENTED_VALUE11696 11697
+#define BSLS_MACROINCREMENTED_VALUE11697 11698
+#define BSLS_MACROINCREMENTED_VALUE11698 11699
+#define BSLS_MACROINCREMENTED_VALUE11699 11700
+#define BSLS_MACROINCREMENTED_VALUE11700 11701
+#define BSLS_MACROINCREMENTED_VALUE11701 11702
+#define BSLS_MACROINCREMENTED_VALUE11702 11703
+#define BSLS_MACROINCREMENTED_VALUE11703 11704
+#define BSLS_MACROINCREMENTED_VALUE11704 11705
+#define BSLS_MACROINCREMENTED_VALUE11705 11706
+#define BSLS_MACROINCREMENTED_VALUE11706 11707
+#define BSLS_MACROINCREMENTED_VALUE11707 11708
+#define BSLS_MACROINCREMENTED_VALUE11708 11709
+#define BSLS_MACROINCREMENTED_VALUE11709 11710
+#define BSLS_MACROINCREMENTED_VALUE11710 11711
+#define BSLS_MACROINCREMENTED_VALUE11711 11712
+#define BSLS_MACROINCREMENTED_VALUE11712 11713
+#define BSLS_MACROINCREMENTED_VALUE11713 11714
+#define BSLS_MACROINCREMENTED_VALUE11714 11715
+#define BSLS_MACROINCREMENTED_VALUE11715 11716
+#define BSLS_MACROINCREMENTED_VALUE11716 11717
+#define BSLS_MACROINCREMENTED_VALUE11717 11718
+#define BSLS_MACROINCREMENTED_VALUE11718 11719
+#define BSLS_MACROINCREMENTED_VALUE11719 11720
+#define BSLS_MACROINCREMENTED_VALUE11720 11721
+#define BSLS_MACROINCREMENTED_VALUE11721 11722
+#define BSLS_MACROINCREMENTED_VALUE11722 11723
+#define BSLS_MACROINCREMENTED_VALUE11723 11724
+#define BSLS_MACROINCREMENTED_VALUE11724 11725
+#define BSLS_MACROINCREMENTED_VALUE11725 11726
+#define BSLS_MACROINCREMENTED_VALUE11726 11727
+#define BSLS_MACROINCREMENTED_VALUE11727 11728
+#define BSLS_MACROINCREMENTED_VALUE11728 11729
+#define BSLS_MACROINCREMENTED_VALUE11729 11730
+#define BSLS_MACROINCREMENTED_VALUE11730 11731
+#define BSLS_MACROINCREMENTED_VALUE11731 11732
+#define BSLS_MACROINCREMENTED_VALUE11732 11733
+#define BSLS_MACROINCREMENTED_VALUE11733 11734
+#define BSLS_MACROINCREMENTED_VALUE11734 11735
+#define BSLS_MACROINCREMENTED_VALUE11735 11736
+#define BSLS_MACROINCREMENTED_VALUE11736 11737
+#define BSLS_MACROINCREMENTED_VALUE11737 11738
+#define BSLS_MACROINCREMENTED_VALUE11738 11739
+#define BSLS_MACROINCREMENTED_VALUE11739 11740
+#define BSLS_MACROINCREMENTED_VALUE11740 11741
+#define BSLS_MACROINCREMENTED_VALUE11741 11742
+#define BSLS_MACROINCREMENTED_VALUE11742 11743
+#define BSLS_MACROINCREMENTED_VALUE11743 11744
+#define BSLS_MACROINCREMENTED_VALUE11744 11745
+#define BSLS_MACROINCREMENTED_VALUE11745 11746
+#define BSLS_MACROINCREMENTED_VALUE11746 11747
+#define BSLS_MACROINCREMENTED_VALUE11747 11748
+#define BSLS_MACROINCREMENTED_VALUE11748 11749
+#define BSLS_MACROINCREMENTED_VALUE11749 11750
+#define BSLS_MACROINCREMENTED_VALUE11750 11751
+#define BSLS_MACROINCREMENTED_VALUE11751 11752
+#define BSLS_MACROINCREMENTED_VALUE11752 11753
+#define BSLS_MACROINCREMENTED_VALUE11753 11754
+#define BSLS_MACROINCREMENTED_VALUE11754 11755
+#define BSLS_MACROINCREMENTED_VALUE11755 11756
+#define BSLS_MACROINCREMENTED_VALUE11756 11757
+#define BSLS_MACROINCREMENTED_VALUE11757 11758
+#define BSLS_MACROINCREMENTED_VALUE11758 11759
+#define BSLS_MACROINCREMENTED_VALUE11759 11760
+#define BSLS_MACROINCREMENTED_VALUE11760 11761
+#define BSLS_MACROINCREMENTED_VALUE11761 11762
+#define BSLS_MACROINCREMENTED_VALUE11762 11763
+#define BSLS_MACROINCREMENTED_VALUE11763 11764
+#define BSLS_MACROINCREMENTED_VALUE11764 11765
+#define BSLS_MACROINCREMENTED_VALUE11765 11766
+#define BSLS_MACROINCREMENTED_VALUE11766 11767
+#define BSLS_MACROINCREMENTED_VALUE11767 11768
+#define BSLS_MACROINCREMENTED_VALUE11768 11769
+#define BSLS_MACROINCREMENTED_VALUE11769 11770
+#define BSLS_MACROINCREMENTED_VALUE11770 11771
+#define BSLS_MACROINCREMENTED_VALUE11771 11772
+#define BSLS_MACROINCREMENTED_VALUE11772 11773
+#define BSLS_MACROINCREMENTED_VALUE11773 11774
+#define BSLS_MACROINCREMENTED_VALUE11774 11775
+#define BSLS_MACROINCREMENTED_VALUE11775 11776
+#define BSLS_MACROINCREMENTED_VALUE11776 11777
+#define BSLS_MACROINCREMENTED_VALUE11777 11778
+#define BSLS_MACROINCREMENTED_VALUE11778 11779
+#define BSLS_MACROINCREMENTED_VALUE11779 11780
+#define BSLS_MACROINCREMENTED_VALUE11780 11781
+#define BSLS_MACROINCREMENTED_VALUE11781 11782
+#define BSLS_MACROINCREMENTED_VALUE11782 11783
+#define BSLS_MACROINCREMENTED_VALUE11783 11784
+#define BSLS_MACROINCREMENTED_VALUE11784 11785
+#define BSLS_MACROINCREMENTED_VALUE11785 11786
+#define BSLS_MACROINCREMENTED_VALUE11786 11787
+#define BSLS_MACROINCREMENTED_VALUE11787 11788
+#define BSLS_MACROINCREMENTED_VALUE11788 11789
+#define BSLS_MACROINCREMENTED_VALUE11789 11790
+#define BSLS_MACROINCREMENTED_VALUE11790 11791
+#define BSLS_MACROINCREMENTED_VALUE11791 11792
+#define BSLS_MACROINCREMENTED_VALUE11792 11793
+#define BSLS_MACROINCREMENTED_VALUE11793 11794
+#define BSLS_MACROINCREMENTED_VALUE11794 11795
+#define BSLS_MACROINCREMENTED_VALUE11795 11796
+#define BSLS_MACROINCREMENTED_VALUE11796 11797
+#define BSLS_MACROINCREMENTED_VALUE11797 11798
+#define BSLS_MACROINCREMENTED_VALUE11798 11799
+#define BSLS_MACROINCREMENTED_VALUE11799 11800
+#define BSLS_MACROINCREMENTED_VALUE11800 11801
+#define BSLS_MACROINCREMENTED_VALUE11801 11802
+#define BSLS_MACROINCREMENTED_VALUE11802 11803
+#define BSLS_MACROINCREMENTED_VALUE11803 11804
+#define BSLS_MACROINCREMENTED_VALUE11804 11805
+#define BSLS_MACROINCREMENTED_VALUE11805 11806
+#define BSLS_MACROINCREMENTED_VALUE11806 11807
+#define BSLS_MACROINCREMENTED_VALUE11807 11808
+#define BSLS_MACROINCREMENTED_VALUE11808 11809
+#define BSLS_MACROINCREMENTED_VALUE11809 11810
+#define BSLS_MACROINCREMENTED_VALUE11810 11811
+#define BSLS_MACROINCREMENTED_VALUE11811 11812
+#define BSLS_MACROINCREMENTED_VALUE11812 11813
+#define BSLS_MACROINCREMENTED_VALUE11813 11814
+#define BSLS_MACROINCREMENTED_VALUE11814 11815
+#define BSLS_MACROINCREMENTED_VALUE11815 11816
+#define BSLS_MACROINCREMENTED_VALUE11816 11817
+#define BSLS_MACROINCREMENTED_VALUE11817 11818
+#define BSLS_MACROINCREMENTED_VALUE11818 11819
+#define BSLS_MACROINCREMENTED_VALUE11819 11820
+#define BSLS_MACROINCREMENTED_VALUE11820 11821
+#define BSLS_MACROINCREMENTED_VALUE11821 11822
+#define BSLS_MACROINCREMENTED_VALUE11822 11823
+#define BSLS_MACROINCREMENTED_VALUE11823 11824
+#define BSLS_MACROINCREMENTED_VALUE11824 11825
+#define BSLS_MACROINCREMENTED_VALUE11825 11826
+#define BSLS_MACROINCREMENTED_VALUE11826 11827
+#define BSLS_MACROINCREMENTED_VALUE11827 11828
+#define BSLS_MACROINCREMENTED_VALUE11828 11829
+#define BSLS_MACROINCREMENTED_VALUE11829 11830
+#define BSLS_MACROINCREMENTED_VALUE11830 11831
+#define BSLS_MACROINCREMENTED_VALUE11831 11832
+#define BSLS_MACROINCREMENTED_VALUE11832 11833
+#define BSLS_MACROINCREMENTED_VALUE11833 11834
+#define BSLS_MACROINCREMENTED_VALUE11834 11835
+#define BSLS_MACROINCREMENTED_VALUE11835 11836
+#define BSLS_MACROINCREMENTED_VALUE11836 11837
+#define BSLS_MACROINCREMENTED_VALUE11837 11838
+#define BSLS_MACROINCREMENTED_VALUE11838 11839
+#define BSLS_MACROINCREMENTED_VALUE11839 11840
+#define BSLS_MACROINCREMENTED_VALUE11840 11841
+#define BSLS_MACROINCREMENTED_VALUE11841 11842
+#define BSLS_MACROINCREMENTED_VALUE11842 11843
+#define BSLS_MACROINCREMENTED_VALUE11843 11844
+#define BSLS_MACROINCREMENTED_VALUE11844 11845
+#define BSLS_MACROINCREMENTED_VALUE11845 11846
+#define BSLS_MACROINCREMENTED_VALUE11846 11847
+#define BSLS_MACROINCREMENTED_VALUE11847 11848
+#define BSLS_MACROINCREMENTED_VALUE11848 11849
+#define BSLS_MACROINCREMENTED_VALUE11849 11850
+#define BSLS_MACROINCREMENTED_VALUE11850 11851
+#define BSLS_MACROINCREMENTED_VALUE11851 11852
+#define BSLS_MACROINCREMENTED_VALUE11852 11853
+#define BSLS_MACROINCREMENTED_VALUE11853 11854
+#define BSLS_MACROINCREMENTED_VALUE11854 11855
+#define BSLS_MACROINCREMENTED_VALUE11855 11856
+#define BSLS_MACROINCREMENTED_VALUE11856 11857
+#define BSLS_MACROINCREMENTED_VALUE11857 11858
+#define BSLS_MACROINCREMENTED_VALUE11858 11859
+#define BSLS_MACROINCREMENTED_VALUE11859 11860
+#define BSLS_MACROINCREMENTED_VALUE11860 11861
+#define BSLS_MACROINCREMENTED_VALUE11861 11862
+#define BSLS_MACROINCREMENTED_VALUE11862 11863
+#define BSLS_MACROINCREMENTED_VALUE11863 11864
+#define BSLS_MACROINCREMENTED_VALUE11864 11865
+#define BSLS_MACROINCREMENTED_VALUE11865 11866
+#define BSLS_MACROINCREMENTED_VALUE11866 11867
+#define BSLS_MACROINCREMENTED_VALUE11867 11868
+#define BSLS_MACROINCREMENTED_VALUE11868 11869
+#define BSLS_MACROINCREMENTED_VALUE11869 11870
+#define BSLS_MACROINCREMENTED_VALUE11870 11871
+#define BSLS_MACROINCREMENTED_VALUE11871 11872
+#define BSLS_MACROINCREMENTED_VALUE11872 11873
+#define BSLS_MACROINCREMENTED_VALUE11873 11874
+#define BSLS_MACROINCREMENTED_VALUE11874 11875
+#define BSLS_MACROINCREMENTED_VALUE11875 11876
+#define BSLS_MACROINCREMENTED_VALUE11876 11877
+#define BSLS_MACROINCREMENTED_VALUE11877 11878
+#define BSLS_MACROINCREMENTED_VALUE11878 11879
+#define BSLS_MACROINCREMENTED_VALUE11879 11880
+#define BSLS_MACROINCREMENTED_VALUE11880 11881
+#define BSLS_MACROINCREMENTED_VALUE11881 11882
+#define BSLS_MACROINCREMENTED_VALUE11882 11883
+#define BSLS_MACROINCREMENTED_VALUE11883 11884
+#define BSLS_MACROINCREMENTED_VALUE11884 11885
+#define BSLS_MACROINCREMENTED_VALUE11885 11886
+#define BSLS_MACROINCREMENTED_VALUE11886 11887
+#define BSLS_MACROINCREMENTED_VALUE11887 11888
+#define BSLS_MACROINCREMENTED_VALUE11888 11889
+#define BSLS_MACROINCREMENTED_VALUE11889 11890
+#define BSLS_MACROINCREMENTED_VALUE11890 11891
+#define BSLS_MACROINCREMENTED_VALUE11891 11892
+#define BSLS_MACROINCREMENTED_VALUE11892 11893
+#define BSLS_MACROINCREMENTED_VALUE11893 11894
+#define BSLS_MACROINCREMENTED_VALUE11894 11895
+#define BSLS_MACROINCREMENTED_VALUE11895 11896
+#define BSLS_MACROINCREMENTED_VALUE11896 11897
+#define BSLS_MACROINCREMENTED_VALUE11897 11898
+#define BSLS_MACROINCREMENTED_VALUE11898 11899
+#define BSLS_MACROINCREMENTED_VALUE11899 11900
+#define BSLS_MACROINCREMENTED_VALUE11900 11901
+#define BSLS_MACROINCREMENTED_VALUE11901 11902
+#define BSLS_MACROINCREMENTED_VALUE11902 11903
+#define BSLS_MACROINCREMENTED_VALUE11903 11904
+#define BSLS_MACROINCREMENTED_VALUE11904 11905
+#define BSLS_MACROINCREMENTED_VALUE11905 11906
+#define BSLS_MACROINCREMENTED_VALUE11906 11907
+#define BSLS_MACROINCREMENTED_VALUE11907 11908
+#define BSLS_MACROINCREMENTED_VALUE11908 11909
+#define BSLS_MACROINCREMENTED_VALUE11909 11910
+#define BSLS_MACROINCREMENTED_VALUE11910 11911
+#define BSLS_MACROINCREMENTED_VALUE11911 11912
+#define BSLS_MACROINCREMENTED_VALUE11912 11913
+#define BSLS_MACROINCREMENTED_VALUE11913 11914
+#define BSLS_MACROINCREMENTED_VALUE11914 11915
+#define BSLS_MACROINCREMENTED_VALUE11915 11916
+#define BSLS_MACROINCREMENTED_VALUE11916 11917
+#define BSLS_MACROINCREMENTED_VALUE11917 11918
+#define BSLS_MACROINCREMENTED_VALUE11918 11919
+#define BSLS_MACROINCREMENTED_VALUE11919 11920
+#define BSLS_MACROINCREMENTED_VALUE11920 11921
+#define BSLS_MACROINCREMENTED_VALUE11921 11922
+#define BSLS_MACROINCREMENTED_VALUE11922 11923
+#define BSLS_MACROINCREMENTED_VALUE11923 11924
+#define BSLS_MACROINCREMENTED_VALUE11924 11925
+#define BSLS_MACROINCREMENTED_VALUE11925 11926
+#define BSLS_MACROINCREMENTED_VALUE11926 11927
+#define BSLS_MACROINCREMENTED_VALUE11927 11928
+#define BSLS_MACROINCREMENTED_VALUE11928 11929
+#define BSLS_MACROINCREMENTED_VALUE11929 11930
+#define BSLS_MACROINCREMENTED_VALUE11930 11931
+#define BSLS_MACROINCREMENTED_VALUE11931 11932
+#define BSLS_MACROINCREMENTED_VALUE11932 11933
+#define BSLS_MACROINCREMENTED_VALUE11933 11934
+#define BSLS_MACROINCREMENTED_VALUE11934 11935
+#define BSLS_MACROINCREMENTED_VALUE11935 11936
+#define BSLS_MACROINCREMENTED_VALUE11936 11937
+#define BSLS_MACROINCREMENTED_VALUE11937 11938
+#define BSLS_MACROINCREMENTED_VALUE11938 11939
+#define BSLS_MACROINCREMENTED_VALUE11939 11940
+#define BSLS_MACROINCREMENTED_VALUE11940 11941
+#define BSLS_MACROINCREMENTED_VALUE11941 11942
+#define BSLS_MACROINCREMENTED_VALUE11942 11943
+#define BSLS_MACROINCREMENTED_VALUE11943 11944
+#define BSLS_MACROINCREMENTED_VALUE11944 11945
+#define BSLS_MACROINCREMENTED_VALUE11945 11946
+#define BSLS_MACROINCREMENTED_VALUE11946 11947
+#define BSLS_MACROINCREMENTED_VALUE11947 11948
+#define BSLS_MACROINCREMENTED_VALUE11948 11949
+#define BSLS_MACROINCREMENTED_VALUE11949 11950
+#define BSLS_MACROINCREMENTED_VALUE11950 11951
+#define BSLS_MACROINCREMENTED_VALUE11951 11952
+#define BSLS_MACROINCREMENTED_VALUE11952 11953
+#define BSLS_MACROINCREMENTED_VALUE11953 11954
+#define BSLS_MACROINCREMENTED_VALUE11954 11955
+#define BSLS_MACROINCREMENTED_VALUE11955 11956
+#define BSLS_MACROINCREMENTED_VALUE11956 11957
+#define BSLS_MACROINCREMENTED_VALUE11957 11958
+#define BSLS_MACROINCREMENTED_VALUE11958 11959
+#define BSLS_MACROINCREMENTED_VALUE11959 11960
+#define BSLS_MACROINCREMENTED_VALUE11960 11961
+#define BSLS_MACROINCREMENTED_VALUE11961 11962
+#define BSLS_MACROINCREMENTED_VALUE11962 11963
+#define BSLS_MACROINCREMENTED_VALUE11963 11964
+#define BSLS_MACROINCREMENTED_VALUE11964 11965
+#define BSLS_MACROINCREMENTED_VALUE11965 11966
+#define BSLS_MACROINCREMENTED_VALUE11966 11967
+#define BSLS_MACROINCREMENTED_VALUE11967 11968
+#define BSLS_MACROINCREMENTED_VALUE11968 11969
+#define BSLS_MACROINCREMENTED_VALUE11969 11970
+#define BSLS_MACROINCREMENTED_VALUE11970 11971
+#define BSLS_MACROINCREMENTED_VALUE11971 11972
+#define BSLS_MACROINCREMENTED_VALUE11972 11973
+#define BSLS_MACROINCREMENTED_VALUE11973 11974
+#define BSLS_MACROINCREMENTED_VALUE11974 11975
+#define BSLS_MACROINCREMENTED_VALUE11975 11976
+#define BSLS_MACROINCREMENTED_VALUE11976 11977
+#define BSLS_MACROINCREMENTED_VALUE11977 11978
+#define BSLS_MACROINCREMENTED_VALUE11978 11979
+#define BSLS_MACROINCREMENTED_VALUE11979 11980
+#define BSLS_MACROINCREMENTED_VALUE11980 11981
+#define BSLS_MACROINCREMENTED_VALUE11981 11982
+#define BSLS_MACROINCREMENTED_VALUE11982 11983
+#define BSLS_MACROINCREMENTED_VALUE11983 11984
+#define BSLS_MACROINCREMENTED_VALUE11984 11985
+#define BSLS_MACROINCREMENTED_VALUE11985 11986
+#define BSLS_MACROINCREMENTED_VALUE11986 11987
+#define BSLS_MACROINCREMENTED_VALUE11987 11988
+#define BSLS_MACROINCREMENTED_VALUE11988 11989
+#define BSLS_MACROINCREMENTED_VALUE11989 11990
+#define BSLS_MACROINCREMENTED_VALUE11990 11991
+#define BSLS_MACROINCREMENTED_VALUE11991 11992
+#define BSLS_MACROINCREMENTED_VALUE11992 11993
+#define BSLS_MACROINCREMENTED_VALUE11993 11994
+#define BSLS_MACROINCREMENTED_VALUE11994 11995
+#define BSLS_MACROINCREMENTED_VALUE11995 11996
+#define BSLS_MACROINCREMENTED_VALUE11996 11997
+#define BSLS_MACROINCREMENTED_VALUE11997 11998
+#define BSLS_MACROINCREMENTED_VALUE11998 11999
+#define BSLS_MACROINCREMENTED_VALUE11999 12000
+#define BSLS_MACROINCREMENTED_VALUE12000 12001
+#define BSLS_MACROINCREMENTED_VALUE12001 12002
+#define BSLS_MACROINCREMENTED_VALUE12002 12003
+#define BSLS_MACROINCREMENTED_VALUE12003 12004
+#define BSLS_MACROINCREMENTED_VALUE12004 12005
+#define BSLS_MACROINCREMENTED_VALUE12005 12006
+#define BSLS_MACROINCREMENTED_VALUE12006 12007
+#define BSLS_MACROINCREMENTED_VALUE12007 12008
+#define BSLS_MACROINCREMENTED_VALUE12008 12009
+#define BSLS_MACROINCREMENTED_VALUE12009 12010
+#define BSLS_MACROINCREMENTED_VALUE12010 12011
+#define BSLS_MACROINCREMENTED_VALUE12011 12012
+#define BSLS_MACROINCREMENTED_VALUE12012 12013
+#define BSLS_MACROINCREMENTED_VALUE12013 12014
+#define BSLS_MACROINCREMENTED_VALUE12014 12015
+#define BSLS_MACROINCREMENTED_VALUE12015 12016
+#define BSLS_MACROINCREMENTED_VALUE12016 12017
+#define BSLS_MACROINCREMENTED_VALUE12017 12018
+#define BSLS_MACROINCREMENTED_VALUE12018 12019
+#define BSLS_MACROINCREMENTED_VALUE12019 12020
+#define BSLS_MACROINCREMENTED_VALUE12020 12021
+#define BSLS_MACROINCREMENTED_VALUE12021 12022
+#define BSLS_MACROINCREMENTED_VALUE12022 12023
+#define BSLS_MACROINCREMENTED_VALUE12023 12024
+#define BSLS_MACROINCREMENTED_VALUE12024 12025
+#define BSLS_MACROINCREMENTED_VALUE12025 12026
+#define BSLS_MACROINCREMENTED_VALUE12026 12027
+#define BSLS_MACROINCREMENTED_VALUE12027 12028
+#define BSLS_MACROINCREMENTED_VALUE12028 12029
+#define BSLS_MACROINCREMENTED_VALUE12029 12030
+#define BSLS_MACROINCREMENTED_VALUE12030 12031
+#define BSLS_MACROINCREMENTED_VALUE12031 12032
+#define BSLS_MACROINCREMENTED_VALUE12032 12033
+#define BSLS_MACROINCREMENTED_VALUE12033 12034
+#define BSLS_MACROINCREMENTED_VALUE12034 12035
+#define BSLS_MACROINCREMENTED_VALUE12035 12036
+#define BSLS_MACROINCREMENTED_VALUE12036 12037
+#define BSLS_MACROINCREMENTED_VALUE12037 12038
+#define BSLS_MACROINCREMENTED_VALUE12038 12039
+#define BSLS_MACROINCREMENTED_VALUE12039 12040
+#define BSLS_MACROINCREMENTED_VALUE12040 12041
+#define BSLS_MACROINCREMENTED_VALUE12041 12042
+#define BSLS_MACROINCREMENTED_VALUE12042 12043
+#define BSLS_MACROINCREMENTED_VALUE12043 12044
+#define BSLS_MACROINCREMENTED_VALUE12044 12045
+#define BSLS_MACROINCREMENTED_VALUE12045 12046
+#define BSLS_MACROINCREMENTED_VALUE12046 12047
+#define BSLS_MACROINCREMENTED_VALUE12047 12048
+#define BSLS_MACROINCREMENTED_VALUE12048 12049
+#define BSLS_MACROINCREMENTED_VALUE12049 12050
+#define BSLS_MACROINCREMENTED_VALUE12050 12051
+#define BSLS_MACROINCREMENTED_VALUE12051 12052
+#define BSLS_MACROINCREMENTED_VALUE12052 12053
+#define BSLS_MACROINCREMENTED_VALUE12053 12054
+#define BSLS_MACROINCREMENTED_VALUE12054 12055
+#define BSLS_MACROINCREMENTED_VALUE12055 12056
+#define BSLS_MACROINCREMENTED_VALUE12056 12057
+#define BSLS_MACROINCREMENTED_VALUE12057 12058
+#define BSLS_MACROINCREMENTED_VALUE12058 12059
+#define BSLS_MACROINCREMENTED_VALUE12059 12060
+#define BSLS_MACROINCREMENTED_VALUE12060 12061
+#define BSLS_MACROINCREMENTED_VALUE12061 12062
+#define BSLS_MACROINCREMENTED_VALUE12062 12063
+#define BSLS_MACROINCREMENTED_VALUE12063 12064
+#define BSLS_MACROINCREMENTED_VALUE12064 12065
+#define BSLS_MACROINCREMENTED_VALUE12065 12066
+#define BSLS_MACROINCREMENTED_VALUE12066 12067
+#define BSLS_MACROINCREMENTED_VALUE12067 12068
+#define BSLS_MACROINCREMENTED_VALUE12068 12069
+#define BSLS_MACROINCREMENTED_VALUE12069 12070
+#define BSLS_MACROINCREMENTED_VALUE12070 12071
+#define BSLS_MACROINCREMENTED_VALUE12071 12072
+#define BSLS_MACROINCREMENTED_VALUE12072 12073
+#define BSLS_MACROINCREMENTED_VALUE12073 12074
+#define BSLS_MACROINCREMENTED_VALUE12074 12075
+#define BSLS_MACROINCREMENTED_VALUE12075 12076
+#define BSLS_MACROINCREMENTED_VALUE12076 12077
+#define BSLS_MACROINCREMENTED_VALUE12077 12078
+#define BSLS_MACROINCREMENTED_VALUE12078 12079
+#define BSLS_MACROINCREMENTED_VALUE12079 12080
+#define BSLS_MACROINCREMENTED_VALUE12080 12081
+#define BSLS_MACROINCREMENTED_VALUE12081 12082
+#define BSLS_MACROINCREMENTED_VALUE12082 12083
+#define BSLS_MACROINCREMENTED_VALUE12083 12084
+#define BSLS_MACROINCREMENTED_VALUE12084 12085
+#define BSLS_MACROINCREMENTED_VALUE12085 12086
+#define BSLS_MACROINCREMENTED_VALUE12086 12087
+#define BSLS_MACROINCREMENTED_VALUE12087 12088
+#define BSLS_MACROINCREMENTED_VALUE12088 12089
+#define BSLS_MACROINCREMENTED_VALUE12089 12090
+#define BSLS_MACROINCREMENTED_VALUE12090 12091
+#define BSLS_MACROINCREMENTED_VALUE12091 12092
+#define BSLS_MACROINCREMENTED_VALUE12092 12093
+#define BSLS_MACROINCREMENTED_VALUE12093 12094
+#define BSLS_MACROINCREMENTED_VALUE12094 12095
+#define BSLS_MACROINCREMENTED_VALUE12095 12096
+#define BSLS_MACROINCREMENTED_VALUE12096 12097
+#define BSLS_MACROINCREMENTED_VALUE12097 12098
+#define BSLS_MACROINCREMENTED_VALUE12098 12099
+#define BSLS_MACROINCREMENTED_VALUE12099 12100
+#define BSLS_MACROINCREMENTED_VALUE12100 12101
+#define BSLS_MACROINCREMENTED_VALUE12101 12102
+#define BSLS_MACROINCREMENTED_VALUE12102 12103
+#define BSLS_MACROINCREMENTED_VALUE12103 12104
+#define BSLS_MACROINCREMENTED_VALUE12104 12105
+#define BSLS_MACROINCREMENTED_VALUE12105 12106
+#define BSLS_MACROINCREMENTED_VALUE12106 12107
+#define BSLS_MACROINCREMENTED_VALUE12107 12108
+#define BSLS_MACROINCREMENTED_VALUE12108 12109
+#define BSLS_MACROINCREMENTED_VALUE12109 12110
+#define BSLS_MACROINCREMENTED_VALUE12110 12111
+#define BSLS_MACROINCREMENTED_VALUE12111 12112
+#define BSLS_MACROINCREMENTED_VALUE12112 12113
+#define BSLS_MACROINCREMENTED_VALUE12113 12114
+#define BSLS_MACROINCREMENTED_VALUE12114 12115
+#define BSLS_MACROINCREMENTED_VALUE12115 12116
+#define BSLS_MACROINCREMENTED_VALUE12116 12117
+#define BSLS_MACROINCREMENTED_VALUE12117 12118
+#define BSLS_MACROINCREMENTED_VALUE12118 12119
+#define BSLS_MACROINCREMENTED_VALUE12119 12120
+#define BSLS_MACROINCREMENTED_VALUE12120 12121
+#define BSLS_MACROINCREMENTED_VALUE12121 12122
+#define BSLS_MACROINCREMENTED_VALUE12122 12123
+#define BSLS_MACROINCREMENTED_VALUE12123 12124
+#define BSLS_MACROINCREMENTED_VALUE12124 12125
+#define BSLS_MACROINCREMENTED_VALUE12125 12126
+#define BSLS_MACROINCREMENTED_VALUE12126 12127
+#define BSLS_MACROINCREMENTED_VALUE12127 12128
+#define BSLS_MACROINCREMENTED_VALUE12128 12129
+#define BSLS_MACROINCREMENTED_VALUE12129 12130
+#define BSLS_MACROINCREMENTED_VALUE12130 12131
+#define BSLS_MACROINCREMENTED_VALUE12131 12132
+#define BSLS_MACROINCREMENTED_VALUE12132 12133
+#define BSLS_MACROINCREMENTED_VALUE12133 12134
+#define BSLS_MACROINCREMENTED_VALUE12134 12135
+#define BSLS_MACROINCREMENTED_VALUE12135 12136
+#define BSLS_MACROINCREMENTED_VALUE12136 12137
+#define BSLS_MACROINCREMENTED_VALUE12137 12138
+#define BSLS_MACROINCREMENTED_VALUE12138 12139
+#define BSLS_MACROINCREMENTED_VALUE12139 12140
+#define BSLS_MACROINCREMENTED_VALUE12140 12141
+#define BSLS_MACROINCREMENTED_VALUE12141 12142
+#define BSLS_MACROINCREMENTED_VALUE12142 12143
+#define BSLS_MACROINCREMENTED_VALUE12143 12144
+#define BSLS_MACROINCREMENTED_VALUE12144 12145
+#define BSLS_MACROINCREMENTED_VALUE12145 12146
+#define BSLS_MACROINCREMENTED_VALUE12146 12147
+#define BSLS_MACROINCREMENTED_VALUE12147 12148
+#define BSLS_MACROINCREMENTED_VALUE12148 12149
+#define BSLS_MACROINCREMENTED_VALUE12149 12150
+#define BSLS_MACROINCREMENTED_VALUE12150 12151
+#define BSLS_MACROINCREMENTED_VALUE12151 12152
+#define BSLS_MACROINCREMENTED_VALUE12152 12153
+#define BSLS_MACROINCREMENTED_VALUE12153 12154
+#define BSLS_MACROINCREMENTED_VALUE12154 12155
+#define BSLS_MACROINCREMENTED_VALUE12155 12156
+#define BSLS_MACROINCREMENTED_VALUE12156 12157
+#define BSLS_MACROINCREMENTED_VALUE12157 12158
+#define BSLS_MACROINCREMENTED_VALUE12158 12159
+#define BSLS_MACROINCREMENTED_VALUE12159 12160
+#define BSLS_MACROINCREMENTED_VALUE12160 12161
+#define BSLS_MACROINCREMENTED_VALUE12161 12162
+#define BSLS_MACROINCREMENTED_VALUE12162 12163
+#define BSLS_MACROINCREMENTED_VALUE12163 12164
+#define BSLS_MACROINCREMENTED_VALUE12164 12165
+#define BSLS_MACROINCREMENTED_VALUE12165 12166
+#define BSLS_MACROINCREMENTED_VALUE12166 12167
+#define BSLS_MACROINCREMENTED_VALUE12167 12168
+#define BSLS_MACROINCREMENTED_VALUE12168 12169
+#define BSLS_MACROINCREMENTED_VALUE12169 12170
+#define BSLS_MACROINCREMENTED_VALUE12170 12171
+#define BSLS_MACROINCREMENTED_VALUE12171 12172
+#define BSLS_MACROINCREMENTED_VALUE12172 12173
+#define BSLS_MACROINCREMENTED_VALUE12173 12174
+#define BSLS_MACROINCREMENTED_VALUE12174 12175
+#define BSLS_MACROINCREMENTED_VALUE12175 12176
+#define BSLS_MACROINCREMENTED_VALUE12176 12177
+#define BSLS_MACROINCREMENTED_VALUE12177 12178
+#define BSLS_MACROINCREMENTED_VALUE12178 12179
+#define BSLS_MACROINCREMENTED_VALUE12179 12180
+#define BSLS_MACROINCREMENTED_VALUE12180 12181
+#define BSLS_MACROINCREMENTED_VALUE12181 12182
+#define BSLS_MACROINCREMENTED_VALUE12182 12183
+#define BSLS_MACROINCREMENTED_VALUE12183 12184
+#define BSLS_MACROINCREMENTED_VALUE12184 12185
+#define BSLS_MACROINCREMENTED_VALUE12185 12186
+#define BSLS_MACROINCREMENTED_VALUE12186 12187
+#define BSLS_MACROINCREMENTED_VALUE12187 12188
+#define BSLS_MACROINCREMENTED_VALUE12188 12189
+#define BSLS_MACROINCREMENTED_VALUE12189 12190
+#define BSLS_MACROINCREMENTED_VALUE12190 12191
+#define BSLS_MACROINCREMENTED_VALUE12191 12192
+#define BSLS_MACROINCREMENTED_VALUE12192 12193
+#define BSLS_MACROINCREMENTED_VALUE12193 12194
+#define BSLS_MACROINCREMENTED_VALUE12194 12195
+#define BSLS_MACROINCREMENTED_VALUE12195 12196
+#define BSLS_MACROINCREMENTED_VALUE12196 12197
+#define BSLS_MACROINCREMENTED_VALUE12197 12198
+#define BSLS_MACROINCREMENTED_VALUE12198 12199
+#define BSLS_MACROINCREMENTED_VALUE12199 12200
+#define BSLS_MACROINCREMENTED_VALUE12200 12201
+#define BSLS_MACROINCREMENTED_VALUE12201 12202
+#define BSLS_MACROINCREMENTED_VALUE12202 12203
+#define BSLS_MACROINCREMENTED_VALUE12203 12204
+#define BSLS_MACROINCREMENTED_VALUE12204 12205
+#define BSLS_MACROINCREMENTED_VALUE12205 12206
+#define BSLS_MACROINCREMENTED_VALUE12206 12207
+#define BSLS_MACROINCREMENTED_VALUE12207 12208
+#define BSLS_MACROINCREMENTED_VALUE12208 12209
+#define BSLS_MACROINCREMENTED_VALUE12209 12210
+#define BSLS_MACROINCREMENTED_VALUE12210 12211
+#define BSLS_MACROINCREMENTED_VALUE12211 12212
+#define BSLS_MACROINCREMENTED_VALUE12212 12213
+#define BSLS_MACROINCREMENTED_VALUE12213 12214
+#define BSLS_MACROINCREMENTED_VALUE12214 12215
+#define BSLS_MACROINCREMENTED_VALUE12215 12216
+#define BSLS_MACROINCREMENTED_VALUE12216 12217
+#define BSLS_MACROINCREMENTED_VALUE12217 12218
+#define BSLS_MACROINCREMENTED_VALUE12218 12219
+#define BSLS_MACROINCREMENTED_VALUE12219 12220
+#define BSLS_MACROINCREMENTED_VALUE12220 12221
+#define BSLS_MACROINCREMENTED_VALUE12221 12222
+#define BSLS_MACROINCREMENTED_VALUE12222 12223
+#define BSLS_MACROINCREMENTED_VALUE12223 12224
+#define BSLS_MACROINCREMENTED_VALUE12224 12225
+#define BSLS_MACROINCREMENTED_VALUE12225 12226
+#define BSLS_MACROINCREMENTED_VALUE12226 12227
+#define BSLS_MACROINCREMENTED_VALUE12227 12228
+#define BSLS_MACROINCREMENTED_VALUE12228 12229
+#define BSLS_MACROINCREMENTED_VALUE12229 12230
+#define BSLS_MACROINCREMENTED_VALUE12230 12231
+#define BSLS_MACROINCREMENTED_VALUE12231 12232
+#define BSLS_MACROINCREMENTED_VALUE12232 12233
+#define BSLS_MACROINCREMENTED_VALUE12233 12234
+#define BSLS_MACROINCREMENTED_VALUE12234 12235
+#define BSLS_MACROINCREMENTED_VALUE12235 12236
+#define BSLS_MACROINCREMENTED_VALUE12236 12237
+#define BSLS_MACROINCREMENTED_VALUE12237 12238
+#define BSLS_MACROINCREMENTED_VALUE12238 12239
+#define BSLS_MACROINCREMENTED_VALUE12239 12240
+#define BSLS_MACROINCREMENTED_VALUE12240 12241
+#define BSLS_MACROINCREMENTED_VALUE12241 12242
+#define BSLS_MACROINCREMENTED_VALUE12242 12243
+#define BSLS_MACROINCREMENTED_VALUE12243 12244
+#define BSLS_MACROINCREMENTED_VALUE12244 12245
+#define BSLS_MACROINCREMENTED_VALUE12245 12246
+#define BSLS_MACROINCREMENTED_VALUE12246 12247
+#define BSLS_MACROINCREMENTED_VALUE12247 12248
+#define BSLS_MACROINCREMENTED_VALUE12248 12249
+#define BSLS_MACROINCREMENTED_VALUE12249 12250
+#define BSLS_MACROINCREMENTED_VALUE12250 12251
+#define BSLS_MACROINCREMENTED_VALUE12251 12252
+#define BSLS_MACROINCREMENTED_VALUE12252 12253
+#define BSLS_MACROINCREMENTED_VALUE12253 12254
+#define BSLS_MACROINCREMENTED_VALUE12254 12255
+#define BSLS_MACROINCREMENTED_VALUE12255 12256
+#define BSLS_MACROINCREMENTED_VALUE12256 12257
+#define BSLS_MACROINCREMENTED_VALUE12257 12258
+#define BSLS_MACROINCREMENTED_VALUE12258 12259
+#define BSLS_MACROINCREMENTED_VALUE12259 12260
+#define BSLS_MACROINCREMENTED_VALUE12260 12261
+#define BSLS_MACROINCREMENTED_VALUE12261 12262
+#define BSLS_MACROINCREMENTED_VALUE12262 12263
+#define BSLS_MACROINCREMENTED_VALUE12263 12264
+#define BSLS_MACROINCREMENTED_VALUE12264 12265
+#define BSLS_MACROINCREMENTED_VALUE12265 12266
+#define BSLS_MACROINCREMENTED_VALUE12266 12267
+#define BSLS_MACROINCREMENTED_VALUE12267 12268
+#define BSLS_MACROINCREMENTED_VALUE12268 12269
+#define BSLS_MACROINCREMENTED_VALUE12269 12270
+#define BSLS_MACROINCREMENTED_VALUE12270 12271
+#define BSLS_MACROINCREMENTED_VALUE12271 12272
+#define BSLS_MACROINCREMENTED_VALUE12272 12273
+#define BSLS_MACROINCREMENTED_VALUE12273 12274
+#define BSLS_MACROINCREMENTED_VALUE12274 12275
+#define BSLS_MACROINCREMENTED_VALUE12275 12276
+#define BSLS_MACROINCREMENTED_VALUE12276 12277
+#define BSLS_MACROINCREMENTED_VALUE12277 12278
+#define BSLS_MACROINCREMENTED_VALUE12278 12279
+#define BSLS_MACROINCREMENTED_VALUE12279 12280
+#define BSLS_MACROINCREMENTED_VALUE12280 12281
+#define BSLS_MACROINCREMENTED_VALUE12281 12282
+#define BSLS_MACROINCREMENTED_VALUE12282 12283
+#define BSLS_MACROINCREMENTED_VALUE12283 12284
+#define BSLS_MACROINCREMENTED_VALUE12284 12285
+#define BSLS_MACROINCREMENTED_VALUE12285 12286
+#define BSLS_MACROINCREMENTED_VALUE12286 12287
+#define BSLS_MACROINCREMENTED_VALUE12287 12288
+#define BSLS_MACROINCREMENTED_VALUE12288 12289
+#define BSLS_MACROINCREMENTED_VALUE12289 12290
+#define BSLS_MACROINCREMENTED_VALUE12290 12291
+#define BSLS_MACROINCREMENTED_VALUE12291 12292
+#define BSLS_MACROINCREMENTED_VALUE12292 12293
+#define BSLS_MACROINCREMENTED_VALUE12293 12294
+#define BSLS_MACROINCREMENTED_VALUE12294 12295
+#define BSLS_MACROINCREMENTED_VALUE12295 12296
+#define BSLS_MACROINCREMENTED_VALUE12296 12297
+#define BSLS_MACROINCREMENTED_VALUE12297 12298
+#define BSLS_MACROINCREMENTED_VALUE12298 12299
+#define BSLS_MACROINCREMENTED_VALUE12299 12300
+#define BSLS_MACROINCREMENTED_VALUE12300 12301
+#define BSLS_MACROINCREMENTED_VALUE12301 12302
+#define BSLS_MACROINCREMENTED_VALUE12302 12303
+#define BSLS_MACROINCREMENTED_VALUE12303 12304
+#define BSLS_MACROINCREMENTED_VALUE12304 12305
+#define BSLS_MACROINCREMENTED_VALUE12305 12306
+#define BSLS_MACROINCREMENTED_VALUE12306 12307
+#define BSLS_MACROINCREMENTED_VALUE12307 12308
+#define BSLS_MACROINCREMENTED_VALUE12308 12309
+#define BSLS_MACROINCREMENTED_VALUE12309 12310
+#define BSLS_MACROINCREMENTED_VALUE12310 12311
+#define BSLS_MACROINCREMENTED_VALUE12311 12312
+#define BSLS_MACROINCREMENTED_VALUE12312 12313
+#define BSLS_MACROINCREMENTED_VALUE12313 12314
+#define BSLS_MACROINCREMENTED_VALUE12314 12315
+#define BSLS_MACROINCREMENTED_VALUE12315 12316
+#define BSLS_MACROINCREMENTED_VALUE12316 12317
+#define BSLS_MACROINCREMENTED_VALUE12317 12318
+#define BSLS_MACROINCREMENTED_VALUE12318 12319
+#define BSLS_MACROINCREMENTED_VALUE12319 12320
+#define BSLS_MACROINCREMENTED_VALUE12320 12321
+#define BSLS_MACROINCREMENTED_VALUE12321 12322
+#define BSLS_MACROINCREMENTED_VALUE12322 12323
+#define BSLS_MACROINCREMENTED_VALUE12323 12324
+#define BSLS_MACROINCREMENTED_VALUE12324 12325
+#define BSLS_MACROINCREMENTED_VALUE12325 12326
+#define BSLS_MACROINCREMENTED_VALUE12326 12327
+#define BSLS_MACROINCREMENTED_VALUE12327 12328
+#define BSLS_MACROINCREMENTED_VALUE12328 12329
+#define BSLS_MACROINCREMENTED_VALUE12329 12330
+#define BSLS_MACROINCREMENTED_VALUE12330 12331
+#define BSLS_MACROINCREMENTED_VALUE12331 12332
+#define BSLS_MACROINCREMENTED_VALUE12332 12333
+#define BSLS_MACROINCREMENTED_VALUE12333 12334
+#define BSLS_MACROINCREMENTED_VALUE12334 12335
+#define BSLS_MACROINCREMENTED_VALUE12335 12336
+#define BSLS_MACROINCREMENTED_VALUE12336 12337
+#define BSLS_MACROINCREMENTED_VALUE12337 12338
+#define BSLS_MACROINCREMENTED_VALUE12338 12339
+#define BSLS_MACROINCREMENTED_VALUE12339 12340
+#define BSLS_MACROINCREMENTED_VALUE12340 12341
+#define BSLS_MACROINCREMENTED_VALUE12341 12342
+#define BSLS_MACROINCREMENTED_VALUE12342 12343
+#define BSLS_MACROINCREMENTED_VALUE12343 12344
+#define BSLS_MACROINCREMENTED_VALUE12344 12345
+#define BSLS_MACROINCREMENTED_VALUE12345 12346
+#define BSLS_MACROINCREMENTED_VALUE12346 12347
+#define BSLS_MACROINCREMENTED_VALUE12347 12348
+#define BSLS_MACROINCREMENTED_VALUE12348 12349
+#define BSLS_MACROINCREMENTED_VALUE12349 12350
+#define BSLS_MACROINCREMENTED_VALUE12350 12351
+#define BSLS_MACROINCREMENTED_VALUE12351 12352
+#define BSLS_MACROINCREMENTED_VALUE12352 12353
+#define BSLS_MACROINCREMENTED_VALUE12353 12354
+#define BSLS_MACROINCREMENTED_VALUE12354 12355
+#define BSLS_MACROINCREMENTED_VALUE12355 12356
+#define BSLS_MACROINCREMENTED_VALUE12356 12357
+#define BSLS_MACROINCREMENTED_VALUE12357 12358
+#define BSLS_MACROINCREMENTED_VALUE12358 12359
+#define BSLS_MACROINCREMENTED_VALUE12359 12360
+#define BSLS_MACROINCREMENTED_VALUE12360 12361
+#define BSLS_MACROINCREMENTED_VALUE12361 12362
+#define BSLS_MACROINCREMENTED_VALUE12362 12363
+#define BSLS_MACROINCREMENTED_VALUE12363 12364
+#define BSLS_MACROINCREMENTED_VALUE12364 12365
+#define BSLS_MACROINCREMENTED_VALUE12365 12366
+#define BSLS_MACROINCREMENTED_VALUE12366 12367
+#define BSLS_MACROINCREMENTED_VALUE12367 12368
+#define BSLS_MACROINCREMENTED_VALUE12368 12369
+#define BSLS_MACROINCREMENTED_VALUE12369 12370
+#define BSLS_MACROINCREMENTED_VALUE12370 12371
+#define BSLS_MACROINCREMENTED_VALUE12371 12372
+#define BSLS_MACROINCREMENTED_VALUE12372 12373
+#define BSLS_MACROINCREMENTED_VALUE12373 12374
+#define BSLS_MACROINCREMENTED_VALUE12374 12375
+#define BSLS_MACROINCREMENTED_VALUE12375 12376
+#define BSLS_MACROINCREMENTED_VALUE12376 12377
+#define BSLS_MACROINCREMENTED_VALUE12377 12378
+#define BSLS_MACROINCREMENTED_VALUE12378 12379
+#define BSLS_MACROINCREMENTED_VALUE12379 12380
+#define BSLS_MACROINCREMENTED_VALUE12380 12381
+#define BSLS_MACROINCREMENTED_VALUE12381 12382
+#define BSLS_MACROINCREMENTED_VALUE12382 12383
+#define BSLS_MACROINCREMENTED_VALUE12383 12384
+#define BSLS_MACROINCREMENTED_VALUE12384 12385
+#define BSLS_MACROINCREMENTED_VALUE12385 12386
+#define BSLS_MACROINCREMENTED_VALUE12386 12387
+#define BSLS_MACROINCREMENTED_VALUE12387 12388
+#define BSLS_MACROINCREMENTED_VALUE12388 12389
+#define BSLS_MACROINCREMENTED_VALUE12389 12390
+#define BSLS_MACROINCREMENTED_VALUE12390 12391
+#define BSLS_MACROINCREMENTED_VALUE12391 12392
+#define BSLS_MACROINCREMENTED_VALUE12392 12393
+#define BSLS_MACROINCREMENTED_VALUE12393 12394
+#define BSLS_MACROINCREMENTED_VALUE12394 12395
+#define BSLS_MACROINCREMENTED_VALUE12395 12396
+#define BSLS_MACROINCREMENTED_VALUE12396 12397
+#define BSLS_MACROINCREMENTED_VALUE12397 12398
+#define BSLS_MACROINCREMENTED_VALUE12398 12399
+#define BSLS_MACROINCREMENTED_VALUE12399 12400
+#define BSLS_MACROINCREMENTED_VALUE12400 12401
+#define BSLS_MACROINCREMENTED_VALUE12401 12402
+#define BSLS_MACROINCREMENTED_VALUE12402 12403
+#define BSLS_MACROINCREMENTED_VALUE12403 12404
+#define BSLS_MACROINCREMENTED_VALUE12404 12405
+#define BSLS_MACROINCREMENTED_VALUE12405 12406
+#define BSLS_MACROINCREMENTED_VALUE12406 12407
+#define BSLS_MACROINCREMENTED_VALUE12407 12408
+#define BSLS_MACROINCREMENTED_VALUE12408 12409
+#define BSLS_MACROINCREMENTED_VALUE12409 12410
+#define BSLS_MACROINCREMENTED_VALUE12410 12411
+#define BSLS_MACROINCREMENTED_VALUE12411 12412
+#define BSLS_MACROINCREMENTED_VALUE12412 12413
+#define BSLS_MACROINCREMENTED_VALUE12413 12414
+#define BSLS_MACROINCREMENTED_VALUE12414 12415
+#define BSLS_MACROINCREMENTED_VALUE12415 12416
+#define BSLS_MACROINCREMENTED_VALUE12416 12417
+#define BSLS_MACROINCREMENTED_VALUE12417 12418
+#define BSLS_MACROINCREMENTED_VALUE12418 12419
+#define BSLS_MACROINCREMENTED_VALUE12419 12420
+#define BSLS_MACROINCREMENTED_VALUE12420 12421
+#define BSLS_MACROINCREMENTED_VALUE12421 12422
+#define BSLS_MACROINCREMENTED_VALUE12422 12423
+#define BSLS_MACROINCREMENTED_VALUE12423 12424
+#define BSLS_MACROINCREMENTED_VALUE12424 12425
+#define BSLS_MACROINCREMENTED_VALUE12425 12426
+#define BSLS_MACROINCREMENTED_VALUE12426 12427
+#define BSLS_MACROINCREMENTED_VALUE12427 12428
+#define BSLS_MACROINCREMENTED_VALUE12428 12429
+#define BSLS_MACROINCREMENTED_VALUE12429 12430
+#define BSLS_MACROINCREMENTED_VALUE12430 12431
+#define BSLS_MACROINCREMENTED_VALUE12431 12432
+#define BSLS_MACROINCREMENTED_VALUE12432 12433
+#define BSLS_MACROINCREMENTED_VALUE12433 12434
+#define BSLS_MACROINCREMENTED_VALUE12434 12435
+#define BSLS_MACROINCREMENTED_VALUE12435 12436
+#define BSLS_MACROINCREMENTED_VALUE12436 12437
+#define BSLS_MACROINCREMENTED_VALUE12437 12438
+#define BSLS_MACROINCREMENTED_VALUE12438 12439
+#define BSLS_MACROINCREMENTED_VALUE12439 12440
+#define BSLS_MACROINCREMENTED_VALUE12440 12441
+#define BSLS_MACROINCREMENTED_VALUE12441 12442
+#define BSLS_MACROINCREMENTED_VALUE12442 12443
+#define BSLS_MACROINCREMENTED_VALUE12443 12444
+#define BSLS_MACROINCREMENTED_VALUE12444 12445
+#define BSLS_MACROINCREMENTED_VALUE12445 12446
+#define BSLS_MACROINCREMENTED_VALUE12446 12447
+#define BSLS_MACROINCREMENTED_VALUE12447 12448
+#define BSLS_MACROINCREMENTED_VALUE12448 12449
+#define BSLS_MACROINCREMENTED_VALUE12449 12450
+#define BSLS_MACROINCREMENTED_VALUE12450 12451
+#define BSLS_MACROINCREMENTED_VALUE12451 12452
+#define BSLS_MACROINCREMENTED_VALUE12452 12453
+#define BSLS_MACROINCREMENTED_VALUE12453 12454
+#define BSLS_MACROINCREMENTED_VALUE12454 12455
+#define BSLS_MACROINCREMENTED_VALUE12455 12456
+#define BSLS_MACROINCREMENTED_VALUE12456 12457
+#define BSLS_MACROINCREMENTED_VALUE12457 12458
+#define BSLS_MACROINCREMENTED_VALUE12458 12459
+#define BSLS_MACROINCREMENTED_VALUE12459 12460
+#define BSLS_MACROINCREMENTED_VALUE12460 12461
+#define BSLS_MACROINCREMENTED_VALUE12461 12462
+#define BSLS_MACROINCREMENTED_VALUE12462 12463
+#define BSLS_MACROINCREMENTED_VALUE12463 12464
+#define BSLS_MACROINCREMENTED_VALUE12464 12465
+#define BSLS_MACROINCREMENTED_VALUE12465 12466
+#define BSLS_MACROINCREMENTED_VALUE12466 12467
+#define BSLS_MACROINCREMENTED_VALUE12467 12468
+#define BSLS_MACROINCREMENTED_VALUE12468 12469
+#define BSLS_MACROINCREMENTED_VALUE12469 12470
+#define BSLS_MACROINCREMENTED_VALUE12470 12471
+#define BSLS_MACROINCREMENTED_VALUE12471 12472
+#define BSLS_MACROINCREMENTED_VALUE12472 12473
+#define BSLS_MACROINCREMENTED_VALUE12473 12474
+#define BSLS_MACROINCREMENTED_VALUE12474 12475
+#define BSLS_MACROINCREMENTED_VALUE12475 12476
+#define BSLS_MACROINCREMENTED_VALUE12476 12477
+#define BSLS_MACROINCREMENTED_VALUE12477 12478
+#define BSLS_MACROINCREMENTED_VALUE12478 12479
+#define BSLS_MACROINCREMENTED_VALUE12479 12480
+#define BSLS_MACROINCREMENTED_VALUE12480 12481
+#define BSLS_MACROINCREMENTED_VALUE12481 12482
+#define BSLS_MACROINCREMENTED_VALUE12482 12483
+#define BSLS_MACROINCREMENTED_VALUE12483 12484
+#define BSLS_MACROINCREMENTED_VALUE12484 12485
+#define BSLS_MACROINCREMENTED_VALUE12485 12486
+#define BSLS_MACROINCREMENTED_VALUE12486 12487
+#define BSLS_MACROINCREMENTED_VALUE12487 12488
+#define BSLS_MACROINCREMENTED_VALUE12488 12489
+#define BSLS_MACROINCREMENTED_VALUE12489 12490
+#define BSLS_MACROINCREMENTED_VALUE12490 12491
+#define BSLS_MACROINCREMENTED_VALUE12491 12492
+#define BSLS_MACROINCREMENTED_VALUE12492 12493
+#define BSLS_MACROINCREMENTED_VALUE12493 12494
+#define BSLS_MACROINCREMENTED_VALUE12494 12495
+#define BSLS_MACROINCREMENTED_VALUE12495 12496
+#define BSLS_MACROINCREMENTED_VALUE12496 12497
+#define BSLS_MACROINCREMENTED_VALUE12497 12498
+#define BSLS_MACROINCREMENTED_VALUE12498 12499
+#define BSLS_MACROINCREMENTED_VALUE12499 12500
+#define BSLS_MACROINCREMENTED_VALUE12500 12501
+#define BSLS_MACROINCREMENTED_VALUE12501 12502
+#define BSLS_MACROINCREMENTED_VALUE12502 12503
+#define BSLS_MACROINCREMENTED_VALUE12503 12504
+#define BSLS_MACROINCREMENTED_VALUE12504 12505
+#define BSLS_MACROINCREMENTED_VALUE12505 12506
+#define BSLS_MACROINCREMENTED_VALUE12506 12507
+#define BSLS_MACROINCREMENTED_VALUE12507 12508
+#define BSLS_MACROINCREMENTED_VALUE12508 12509
+#define BSLS_MACROINCREMENTED_VALUE12509 12510
+#define BSLS_MACROINCREMENTED_VALUE12510 12511
+#define BSLS_MACROINCREMENTED_VALUE12511 12512
+#define BSLS_MACROINCREMENTED_VALUE12512 12513
+#define BSLS_MACROINCREMENTED_VALUE12513 12514
+#define BSLS_MACROINCREMENTED_VALUE12514 12515
+#define BSLS_MACROINCREMENTED_VALUE12515 12516
+#define BSLS_MACROINCREMENTED_VALUE12516 12517
+#define BSLS_MACROINCREMENTED_VALUE12517 12518
+#define BSLS_MACROINCREMENTED_VALUE12518 12519
+#define BSLS_MACROINCREMENTED_VALUE12519 12520
+#define BSLS_MACROINCREMENTED_VALUE12520 12521
+#define BSLS_MACROINCREMENTED_VALUE12521 12522
+#define BSLS_MACROINCREMENTED_VALUE12522 12523
+#define BSLS_MACROINCREMENTED_VALUE12523 12524
+#define BSLS_MACROINCREMENTED_VALUE12524 12525
+#define BSLS_MACROINCREMENTED_VALUE12525 12526
+#define BSLS_MACROINCREMENTED_VALUE12526 12527
+#define BSLS_MACROINCREMENTED_VALUE12527 12528
+#define BSLS_MACROINCREMENTED_VALUE12528 12529
+#define BSLS_MACROINCREMENTED_VALUE12529 12530
+#define BSLS_MACROINCREMENTED_VALUE12530 12531
+#define BSLS_MACROINCREMENTED_VALUE12531 12532
+#define BSLS_MACROINCREMENTED_VALUE12532 12533
+#define BSLS_MACROINCREMENTED_VALUE12533 12534
+#define BSLS_MACROINCREMENTED_VALUE12534 12535
+#define BSLS_MACROINCREMENTED_VALUE12535 12536
+#define BSLS_MACROINCREMENTED_VALUE12536 12537
+#define BSLS_MACROINCREMENTED_VALUE12537 12538
+#define BSLS_MACROINCREMENTED_VALUE12538 12539
+#define BSLS_MACROINCREMENTED_VALUE12539 12540
+#define BSLS_MACROINCREMENTED_VALUE12540 12541
+#define BSLS_MACROINCREMENTED_VALUE12541 12542
+#define BSLS_MACROINCREMENTED_VALUE12542 12543
+#define BSLS_MACROINCREMENTED_VALUE12543 12544
+#define BSLS_MACROINCREMENTED_VALUE12544 12545
+#define BSLS_MACROINCREMENTED_VALUE12545 12546
+#define BSLS_MACROINCREMENTED_VALUE12546 12547
+#define BSLS_MACROINCREMENTED_VALUE12547 12548
+#define BSLS_MACROINCREMENTED_VALUE12548 12549
+#define BSLS_MACROINCREMENTED_VALUE12549 12550
+#define BSLS_MACROINCREMENTED_VALUE12550 12551
+#define BSLS_MACROINCREMENTED_VALUE12551 12552
+#define BSLS_MACROINCREMENTED_VALUE12552 12553
+#define BSLS_MACROINCREMENTED_VALUE12553 12554
+#define BSLS_MACROINCREMENTED_VALUE12554 12555
+#define BSLS_MACROINCREMENTED_VALUE12555 12556
+#define BSLS_MACROINCREMENTED_VALUE12556 12557
+#define BSLS_MACROINCREMENTED_VALUE12557 12558
+#define BSLS_MACROINCREMENTED_VALUE12558 12559
+#define BSLS_MACROINCREMENTED_VALUE12559 12560
+#define BSLS_MACROINCREMENTED_VALUE12560 12561
+#define BSLS_MACROINCREMENTED_VALUE12561 12562
+#define BSLS_MACROINCREMENTED_VALUE12562 12563
+#define BSLS_MACROINCREMENTED_VALUE12563 12564
+#define BSLS_MACROINCREMENTED_VALUE12564 12565
+#define BSLS_MACROINCREMENTED_VALUE12565 12566
+#define BSLS_MACROINCREMENTED_VALUE12566 12567
+#define BSLS_MACROINCREMENTED_VALUE12567 12568
+#define BSLS_MACROINCREMENTED_VALUE12568 12569
+#define BSLS_MACROINCREMENTED_VALUE12569 12570
+#define BSLS_MACROINCREMENTED_VALUE12570 12571
+#define BSLS_MACROINCREMENTED_VALUE12571 12572
+#define BSLS_MACROINCREMENTED_VALUE12572 12573
+#define BSLS_MACROINCREMENTED_VALUE12573 12574
+#define BSLS_MACROINCREMENTED_VALUE12574 12575
+#define BSLS_MACROINCREMENTED_VALUE12575 12576
+#define BSLS_MACROINCREMENTED_VALUE12576 12577
+#define BSLS_MACROINCREMENTED_VALUE12577 12578
+#define BSLS_MACROINCREMENTED_VALUE12578 12579
+#define BSLS_MACROINCREMENTED_VALUE12579 12580
+#define BSLS_MACROINCREMENTED_VALUE12580 12581
+#define BSLS_MACROINCREMENTED_VALUE12581 12582
+#define BSLS_MACROINCREMENTED_VALUE12582 12583
+#define BSLS_MACROINCREMENTED_VALUE12583 12584
+#define BSLS_MACROINCREMENTED_VALUE12584 12585
+#define BSLS_MACROINCREMENTED_VALUE12585 12586
+#define BSLS_MACROINCREMENTED_VALUE12586 12587
+#define BSLS_MACROINCREMENTED_VALUE12587 12588
+#define BSLS_MACROINCREMENTED_VALUE12588 12589
+#define BSLS_MACROINCREMENTED_VALUE12589 12590
+#define BSLS_MACROINCREMENTED_VALUE12590 12591
+#define BSLS_MACROINCREMENTED_VALUE12591 12592
+#define BSLS_MACROINCREMENTED_VALUE12592 12593
+#define BSLS_MACROINCREMENTED_VALUE12593 12594
+#define BSLS_MACROINCREMENTED_VALUE12594 12595
+#define BSLS_MACROINCREMENTED_VALUE12595 12596
+#define BSLS_MACROINCREMENTED_VALUE12596 12597
+#define BSLS_MACROINCREMENTED_VALUE12597 12598
+#define BSLS_MACROINCREMENTED_VALUE12598 12599
+#define BSLS_MACROINCREMENTED_VALUE12599 12600
+#define BSLS_MACROINCREMENTED_VALUE12600 12601
+#define BSLS_MACROINCREMENTED_VALUE12601 12602
+#define BSLS_MACROINCREMENTED_VALUE12602 12603
+#define BSLS_MACROINCREMENTED_VALUE12603 12604
+#define BSLS_MACROINCREMENTED_VALUE12604 12605
+#define BSLS_MACROINCREMENTED_VALUE12605 12606
+#define BSLS_MACROINCREMENTED_VALUE12606 12607
+#define BSLS_MACROINCREMENTED_VALUE12607 12608
+#define BSLS_MACROINCREMENTED_VALUE12608 12609
+#define BSLS_MACROINCREMENTED_VALUE12609 12610
+#define BSLS_MACROINCREMENTED_VALUE12610 12611
+#define BSLS_MACROINCREMENTED_VALUE12611 12612
+#define BSLS_MACROINCREMENTED_VALUE12612 12613
+#define BSLS_MACROINCREMENTED_VALUE12613 12614
+#define BSLS_MACROINCREMENTED_VALUE12614 12615
+#define BSLS_MACROINCREMENTED_VALUE12615 12616
+#define BSLS_MACROINCREMENTED_VALUE12616 12617
+#define BSLS_MACROINCREMENTED_VALUE12617 12618
+#define BSLS_MACROINCREMENTED_VALUE12618 12619
+#define BSLS_MACROINCREMENTED_VALUE12619 12620
+#define BSLS_MACROINCREMENTED_VALUE12620 12621
+#define BSLS_MACROINCREMENTED_VALUE12621 12622
+#define BSLS_MACROINCREMENTED_VALUE12622 12623
+#define BSLS_MACROINCREMENTED_VALUE12623 12624
+#define BSLS_MACROINCREMENTED_VALUE12624 12625
+#define BSLS_MACROINCREMENTED_VALUE12625 12626
+#define BSLS_MACROINCREMENTED_VALUE12626 12627
+#define BSLS_MACROINCREMENTED_VALUE12627 12628
+#define BSLS_MACROINCREMENTED_VALUE12628 12629
+#define BSLS_MACROINCREMENTED_VALUE12629 12630
+#define BSLS_MACROINCREMENTED_VALUE12630 12631
+#define BSLS_MACROINCREMENTED_VALUE12631 12632
+#define BSLS_MACROINCREMENTED_VALUE12632 12633
+#define BSLS_MACROINCREMENTED_VALUE12633 12634
+#define BSLS_MACROINCREMENTED_VALUE12634 12635
+#define BSLS_MACROINCREMENTED_VALUE12635 12636
+#define BSLS_MACROINCREMENTED_VALUE12636 12637
+#define BSLS_MACROINCREMENTED_VALUE12637 12638
+#define BSLS_MACROINCREMENTED_VALUE12638 12639
+#define BSLS_MACROINCREMENTED_VALUE12639 12640
+#define BSLS_MACROINCREMENTED_VALUE12640 12641
+#define BSLS_MACROINCREMENTED_VALUE12641 12642
+#define BSLS_MACROINCREMENTED_VALUE12642 12643
+#define BSLS_MACROINCREMENTED_VALUE12643 12644
+#define BSLS_MACROINCREMENTED_VALUE12644 12645
+#define BSLS_MACROINCREMENTED_VALUE12645 12646
+#define BSLS_MACROINCREMENTED_VALUE12646 12647
+#define BSLS_MACROINCREMENTED_VALUE12647 12648
+#define BSLS_MACROINCREMENTED_VALUE12648 12649
+#define BSLS_MACROINCREMENTED_VALUE12649 12650
+#define BSLS_MACROINCREMENTED_VALUE12650 12651
+#define BSLS_MACROINCREMENTED_VALUE12651 12652
+#define BSLS_MACROINCREMENTED_VALUE12652 12653
+#define BSLS_MACROINCREMENTED_VALUE12653 12654
+#define BSLS_MACROINCREMENTED_VALUE12654 12655
+#define BSLS_MACROINCREMENTED_VALUE12655 12656
+#define BSLS_MACROINCREMENTED_VALUE12656 12657
+#define BSLS_MACROINCREMENTED_VALUE12657 12658
+#define BSLS_MACROINCREMENTED_VALUE12658 12659
+#define BSLS_MACROINCREMENTED_VALUE12659 12660
+#define BSLS_MACROINCREMENTED_VALUE12660 12661
+#define BSLS_MACROINCREMENTED_VALUE12661 12662
+#define BSLS_MACROINCREMENTED_VALUE12662 12663
+#define BSLS_MACROINCREMENTED_VALUE12663 12664
+#define BSLS_MACROINCREMENTED_VALUE12664 12665
+#define BSLS_MACROINCREMENTED_VALUE12665 12666
+#define BSLS_MACROINCREMENTED_VALUE12666 12667
+#define BSLS_MACROINCREMENTED_VALUE12667 12668
+#define BSLS_MACROINCREMENTED_VALUE12668 12669
+#define BSLS_MACROINCREMENTED_VALUE12669 12670
+#define BSLS_MACROINCREMENTED_VALUE12670 12671
+#define BSLS_MACROINCREMENTED_VALUE12671 12672
+#define BSLS_MACROINCREMENTED_VALUE12672 12673
+#define BSLS_MACROINCREMENTED_VALUE12673 12674
+#define BSLS_MACROINCREMENTED_VALUE12674 12675
+#define BSLS_MACROINCREMENTED_VALUE12675 12676
+#define BSLS_MACROINCREMENTED_VALUE12676 12677
+#define BSLS_MACROINCREMENTED_VALUE12677 12678
+#define BSLS_MACROINCREMENTED_VALUE12678 12679
+#define BSLS_MACROINCREMENTED_VALUE12679 12680
+#define BSLS_MACROINCREMENTED_VALUE12680 12681
+#define BSLS_MACROINCREMENTED_VALUE12681 12682
+#define BSLS_MACROINCREMENTED_VALUE12682 12683
+#define BSLS_MACROINCREMENTED_VALUE12683 12684
+#define BSLS_MACROINCREMENTED_VALUE12684 12685
+#define BSLS_MACROINCREMENTED_VALUE12685 12686
+#define BSLS_MACROINCREMENTED_VALUE12686 12687
+#define BSLS_MACROINCREMENTED_VALUE12687 12688
+#define BSLS_MACROINCREMENTED_VALUE12688 12689
+#define BSLS_MACROINCREMENTED_VALUE12689 12690
+#define BSLS_MACROINCREMENTED_VALUE12690 12691
+#define BSLS_MACROINCREMENTED_VALUE12691 12692
+#define BSLS_MACROINCREMENTED_VALUE12692 12693
+#define BSLS_MACROINCREMENTED_VALUE12693 12694
+#define BSLS_MACROINCREMENTED_VALUE12694 12695
+#define BSLS_MACROINCREMENTED_VALUE12695 12696
+#define BSLS_MACROINCREMENTED_VALUE12696 12697
+#define BSLS_MACROINCREMENTED_VALUE12697 12698
+#define BSLS_MACROINCREMENTED_VALUE12698 12699
+#define BSLS_MACROINCREMENTED_VALUE12699 12700
+#define BSLS_MACROINCREMENTED_VALUE12700 12701
+#define BSLS_MACROINCREMENTED_VALUE12701 12702
+#define BSLS_MACROINCREMENTED_VALUE12702 12703
+#define BSLS_MACROINCREMENTED_VALUE12703 12704
+#define BSLS_MACROINCREMENTED_VALUE12704 12705
+#define BSLS_MACROINCREMENTED_VALUE12705 12706
+#define BSLS_MACROINCREMENTED_VALUE12706 12707
+#define BSLS_MACROINCREMENTED_VALUE12707 12708
+#define BSLS_MACROINCREMENTED_VALUE12708 12709
+#define BSLS_MACROINCREMENTED_VALUE12709 12710
+#define BSLS_MACROINCREMENTED_VALUE12710 12711
+#define BSLS_MACROINCREMENTED_VALUE12711 12712
+#define BSLS_MACROINCREMENTED_VALUE12712 12713
+#define BSLS_MACROINCREMENTED_VALUE12713 12714
+#define BSLS_MACROINCREMENTED_VALUE12714 12715
+#define BSLS_MACROINCREMENTED_VALUE12715 12716
+#define BSLS_MACROINCREMENTED_VALUE12716 12717
+#define BSLS_MACROINCREMENTED_VALUE12717 12718
+#define BSLS_MACROINCREMENTED_VALUE12718 12719
+#define BSLS_MACROINCREMENTED_VALUE12719 12720
+#define BSLS_MACROINCREMENTED_VALUE12720 12721
+#define BSLS_MACROINCREMENTED_VALUE12721 12722
+#define BSLS_MACROINCREMENTED_VALUE12722 12723
+#define BSLS_MACROINCREMENTED_VALUE12723 12724
+#define BSLS_MACROINCREMENTED_VALUE12724 12725
+#define BSLS_MACROINCREMENTED_VALUE12725 12726
+#define BSLS_MACROINCREMENTED_VALUE12726 12727
+#define BSLS_MACROINCREMENTED_VALUE12727 12728
+#define BSLS_MACROINCREMENTED_VALUE12728 12729
+#define BSLS_MACROINCREMENTED_VALUE12729 12730
+#define BSLS_MACROINCREMENTED_VALUE12730 12731
+#define BSLS_MACROINCREMENTED_VALUE12731 12732
+#define BSLS_MACROINCREMENTED_VALUE12732 12733
+#define BSLS_MACROINCREMENTED_VALUE12733 12734
+#define BSLS_MACROINCREMENTED_VALUE12734 12735
+#define BSLS_MACROINCREMENTED_VALUE12735 12736
+#define BSLS_MACROINCREMENTED_VALUE12736 12737
+#define BSLS_MACROINCREMENTED_VALUE12737 12738
+#define BSLS_MACROINCREMENTED_VALUE12738 12739
+#define BSLS_MACROINCREMENTED_VALUE12739 12740
+#define BSLS_MACROINCREMENTED_VALUE12740 12741
+#define BSLS_MACROINCREMENTED_VALUE12741 12742
+#define BSLS_MACROINCREMENTED_VALUE12742 12743
+#define BSLS_MACROINCREMENTED_VALUE12743 12744
+#define BSLS_MACROINCREMENTED_VALUE12744 12745
+#define BSLS_MACROINCREMENTED_VALUE12745 12746
+#define BSLS_MACROINCREMENTED_VALUE12746 12747
+#define BSLS_MACROINCREMENTED_VALUE12747 12748
+#define BSLS_MACROINCREMENTED_VALUE12748 12749
+#define BSLS_MACROINCREMENTED_VALUE12749 12750
+#define BSLS_MACROINCREMENTED_VALUE12750 12751
+#define BSLS_MACROINCREMENTED_VALUE12751 12752
+#define BSLS_MACROINCREMENTED_VALUE12752 12753
+#define BSLS_MACROINCREMENTED_VALUE12753 12754
+#define BSLS_MACROINCREMENTED_VALUE12754 12755
+#define BSLS_MACROINCREMENTED_VALUE12755 12756
+#define BSLS_MACROINCREMENTED_VALUE12756 12757
+#define BSLS_MACROINCREMENTED_VALUE12757 12758
+#define BSLS_MACROINCREMENTED_VALUE12758 12759
+#define BSLS_MACROINCREMENTED_VALUE12759 12760
+#define BSLS_MACROINCREMENTED_VALUE12760 12761
+#define BSLS_MACROINCREMENTED_VALUE12761 12762
+#define BSLS_MACROINCREMENTED_VALUE12762 12763
+#define BSLS_MACROINCREMENTED_VALUE12763 12764
+#define BSLS_MACROINCREMENTED_VALUE12764 12765
+#define BSLS_MACROINCREMENTED_VALUE12765 12766
+#define BSLS_MACROINCREMENTED_VALUE12766 12767
+#define BSLS_MACROINCREMENTED_VALUE12767 12768
+#define BSLS_MACROINCREMENTED_VALUE12768 12769
+#define BSLS_MACROINCREMENTED_VALUE12769 12770
+#define BSLS_MACROINCREMENTED_VALUE12770 12771
+#define BSLS_MACROINCREMENTED_VALUE12771 12772
+#define BSLS_MACROINCREMENTED_VALUE12772 12773
+#define BSLS_MACROINCREMENTED_VALUE12773 12774
+#define BSLS_MACROINCREMENTED_VALUE12774 12775
+#define BSLS_MACROINCREMENTED_VALUE12775 12776
+#define BSLS_MACROINCREMENTED_VALUE12776 12777
+#define BSLS_MACROINCREMENTED_VALUE12777 12778
+#define BSLS_MACROINCREMENTED_VALUE12778 12779
+#define BSLS_MACROINCREMENTED_VALUE12779 12780
+#define BSLS_MACROINCREMENTED_VALUE12780 12781
+#define BSLS_MACROINCREMENTED_VALUE12781 12782
+#define BSLS_MACROINCREMENTED_VALUE12782 12783
+#define BSLS_MACROINCREMENTED_VALUE12783 12784
+#define BSLS_MACROINCREMENTED_VALUE12784 12785
+#define BSLS_MACROINCREMENTED_VALUE12785 12786
+#define BSLS_MACROINCREMENTED_VALUE12786 12787
+#define BSLS_MACROINCREMENTED_VALUE12787 12788
+#define BSLS_MACROINCREMENTED_VALUE12788 12789
+#define BSLS_MACROINCREMENTED_VALUE12789 12790
+#define BSLS_MACROINCREMENTED_VALUE12790 12791
+#define BSLS_MACROINCREMENTED_VALUE12791 12792
+#define BSLS_MACROINCREMENTED_VALUE12792 12793
+#define BSLS_MACROINCREMENTED_VALUE12793 12794
+#define BSLS_MACROINCREMENTED_VALUE12794 12795
+#define BSLS_MACROINCREMENTED_VALUE12795 12796
+#define BSLS_MACROINCREMENTED_VALUE12796 12797
+#define BSLS_MACROINCREMENTED_VALUE12797 12798
+#define BSLS_MACROINCREMENTED_VALUE12798 12799
+#define BSLS_MACROINCREMENTED_VALUE12799 12800
+#define BSLS_MACROINCREMENTED_VALUE12800 12801
+#define BSLS_MACROINCREMENTED_VALUE12801 12802
+#define BSLS_MACROINCREMENTED_VALUE12802 12803
+#define BSLS_MACROINCREMENTED_VALUE12803 12804
+#define BSLS_MACROINCREMENTED_VALUE12804 12805
+#define BSLS_MACROINCREMENTED_VALUE12805 12806
+#define BSLS_MACROINCREMENTED_VALUE12806 12807
+#define BSLS_MACROINCREMENTED_VALUE12807 12808
+#define BSLS_MACROINCREMENTED_VALUE12808 12809
+#define BSLS_MACROINCREMENTED_VALUE12809 12810
+#define BSLS_MACROINCREMENTED_VALUE12810 12811
+#define BSLS_MACROINCREMENTED_VALUE12811 12812
+#define BSLS_MACROINCREMENTED_VALUE12812 12813
+#define BSLS_MACROINCREMENTED_VALUE12813 12814
+#define BSLS_MACROINCREMENTED_VALUE12814 12815
+#define BSLS_MACROINCREMENTED_VALUE12815 12816
+#define BSLS_MACROINCREMENTED_VALUE12816 12817
+#define BSLS_MACROINCREMENTED_VALUE12817 12818
+#define BSLS_MACROINCREMENTED_VALUE12818 12819
+#define BSLS_MACROINCREMENTED_VALUE12819 12820
+#define BSLS_MACROINCREMENTED_VALUE12820 12821
+#define BSLS_MACROINCREMENTED_VALUE12821 12822
+#define BSLS_MACROINCREMENTED_VALUE12822 12823
+#define BSLS_MACROINCREMENTED_VALUE12823 12824
+#define BSLS_MACROINCREMENTED_VALUE12824 12825
+#define BSLS_MACROINCREMENTED_VALUE12825 12826
+#define BSLS_MACROINCREMENTED_VALUE12826 12827
+#define BSLS_MACROINCREMENTED_VALUE12827 12828
+#define BSLS_MACROINCREMENTED_VALUE12828 12829
+#define BSLS_MACROINCREMENTED_VALUE12829 12830
+#define BSLS_MACROINCREMENTED_VALUE12830 12831
+#define BSLS_MACROINCREMENTED_VALUE12831 12832
+#define BSLS_MACROINCREMENTED_VALUE12832 12833
+#define BSLS_MACROINCREMENTED_VALUE12833 12834
+#define BSLS_MACROINCREMENTED_VALUE12834 12835
+#define BSLS_MACROINCREMENTED_VALUE12835 12836
+#define BSLS_MACROINCREMENTED_VALUE12836 12837
+#define BSLS_MACROINCREMENTED_VALUE12837 12838
+#define BSLS_MACROINCREMENTED_VALUE12838 12839
+#define BSLS_MACROINCREMENTED_VALUE12839 12840
+#define BSLS_MACROINCREMENTED_VALUE12840 12841
+#define BSLS_MACROINCREMENTED_VALUE12841 12842
+#define BSLS_MACROINCREMENTED_VALUE12842 12843
+#define BSLS_MACROINCREMENTED_VALUE12843 12844
+#define BSLS_MACROINCREMENTED_VALUE12844 12845
+#define BSLS_MACROINCREMENTED_VALUE12845 12846
+#define BSLS_MACROINCREMENTED_VALUE12846 12847
+#define BSLS_MACROINCREMENTED_VALUE12847 12848
+#define BSLS_MACROINCREMENTED_VALUE12848 12849
+#define BSLS_MACROINCREMENTED_VALUE12849 12850
+#define BSLS_MACROINCREMENTED_VALUE12850 12851
+#define BSLS_MACROINCREMENTED_VALUE12851 12852
+#define BSLS_MACROINCREMENTED_VALUE12852 12853
+#define BSLS_MACROINCREMENTED_VALUE12853 12854
+#define BSLS_MACROINCREMENTED_VALUE12854 12855
+#define BSLS_MACROINCREMENTED_VALUE12855 12856
+#define BSLS_MACROINCREMENTED_VALUE12856 12857
+#define BSLS_MACROINCREMENTED_VALUE12857 12858
+#define BSLS_MACROINCREMENTED_VALUE12858 12859
+#define BSLS_MACROINCREMENTED_VALUE12859 12860
+#define BSLS_MACROINCREMENTED_VALUE12860 12861
+#define BSLS_MACROINCREMENTED_VALUE12861 12862
+#define BSLS_MACROINCREMENTED_VALUE12862 12863
+#define BSLS_MACROINCREMENTED_VALUE12863 12864
+#define BSLS_MACROINCREMENTED_VALUE12864 12865
+#define BSLS_MACROINCREMENTED_VALUE12865 12866
+#define BSLS_MACROINCREMENTED_VALUE12866 12867
+#define BSLS_MACROINCREMENTED_VALUE12867 12868
+#define BSLS_MACROINCREMENTED_VALUE12868 12869
+#define BSLS_MACROINCREMENTED_VALUE12869 12870
+#define BSLS_MACROINCREMENTED_VALUE12870 12871
+#define BSLS_MACROINCREMENTED_VALUE12871 12872
+#define BSLS_MACROINCREMENTED_VALUE12872 12873
+#define BSLS_MACROINCREMENTED_VALUE12873 12874
+#define BSLS_MACROINCREMENTED_VALUE12874 12875
+#define BSLS_MACROINCREMENTED_VALUE12875 12876
+#define BSLS_MACROINCREMENTED_VALUE12876 12877
+#define BSLS_MACROINCREMENTED_VALUE12877 12878
+#define BSLS_MACROINCREMENTED_VALUE12878 12879
+#define BSLS_MACROINCREMENTED_VALUE12879 12880
+#define BSLS_MACROINCREMENTED_VALUE12880 12881
+#define BSLS_MACROINCREMENTED_VALUE12881 12882
+#define BSLS_MACROINCREMENTED_VALUE12882 12883
+#define BSLS_MACROINCREMENTED_VALUE12883 12884
+#define BSLS_MACROINCREMENTED_VALUE12884 12885
+#define BSLS_MACROINCREMENTED_VALUE12885 12886
+#define BSLS_MACROINCREMENTED_VALUE12886 12887
+#define BSLS_MACROINCREMENTED_VALUE12887 12888
+#define BSLS_MACROINCREMENTED_VALUE12888 12889
+#define BSLS_MACROINCREMENTED_VALUE12889 12890
+#define BSLS_MACROINCREMENTED_VALUE12890 12891
+#define BSLS_MACROINCREMENTED_VALUE12891 12892
+#define BSLS_MACROINCREMENTED_VALUE12892 12893
+#define BSLS_MACROINCREMENTED_VALUE12893 12894
+#define BSLS_MACROINCREMENTED_VALUE12894 12895
+#define BSLS_MACROINCREMENTED_VALUE12895 12896
+#define BSLS_MACROINCREMENTED_VALUE12896 12897
+#define BSLS_MACROINCREMENTED_VALUE12897 12898
+#define BSLS_MACROINCREMENTED_VALUE12898 12899
+#define BSLS_MACROINCREMENTED_VALUE12899 12900
+#define BSLS_MACROINCREMENTED_VALUE12900 12901
+#define BSLS_MACROINCREMENTED_VALUE12901 12902
+#define BSLS_MACROINCREMENTED_VALUE12902 12903
+#define BSLS_MACROINCREMENTED_VALUE12903 12904
+#define BSLS_MACROINCREMENTED_VALUE12904 12905
+#define BSLS_MACROINCREMENTED_VALUE12905 12906
+#define BSLS_MACROINCREMENTED_VALUE12906 12907
+#define BSLS_MACROINCREMENTED_VALUE12907 12908
+#define BSLS_MACROINCREMENTED_VALUE12908 12909
+#define BSLS_MACROINCREMENTED_VALUE12909 12910
+#define BSLS_MACROINCREMENTED_VALUE12910 12911
+#define BSLS_MACROINCREMENTED_VALUE12911 12912
+#define BSLS_MACROINCREMENTED_VALUE12912 12913
+#define BSLS_MACROINCREMENTED_VALUE12913 12914
+#define BSLS_MACROINCREMENTED_VALUE12914 12915
+#define BSLS_MACROINCREMENTED_VALUE12915 12916
+#define BSLS_MACROINCREMENTED_VALUE12916 12917
+#define BSLS_MACROINCREMENTED_VALUE12917 12918
+#define BSLS_MACROINCREMENTED_VALUE12918 12919
+#define BSLS_MACROINCREMENTED_VALUE12919 12920
+#define BSLS_MACROINCREMENTED_VALUE12920 12921
+#define BSLS_MACROINCREMENTED_VALUE12921 12922
+#define BSLS_MACROINCREMENTED_VALUE12922 12923
+#define BSLS_MACROINCREMENTED_VALUE12923 12924
+#define BSLS_MACROINCREMENTED_VALUE12924 12925
+#define BSLS_MACROINCREMENTED_VALUE12925 12926
+#define BSLS_MACROINCREMENTED_VALUE12926 12927
+#define BSLS_MACROINCREMENTED_VALUE12927 12928
+#define BSLS_MACROINCREMENTED_VALUE12928 12929
+#define BSLS_MACROINCREMENTED_VALUE12929 12930
+#define BSLS_MACROINCREMENTED_VALUE12930 12931
+#define BSLS_MACROINCREMENTED_VALUE12931 12932
+#define BSLS_MACROINCREMENTED_VALUE12932 12933
+#define BSLS_MACROINCREMENTED_VALUE12933 12934
+#define BSLS_MACROINCREMENTED_VALUE12934 12935
+#define BSLS_MACROINCREMENTED_VALUE12935 12936
+#define BSLS_MACROINCREMENTED_VALUE12936 12937
+#define BSLS_MACROINCREMENTED_VALUE12937 12938
+#define BSLS_MACROINCREMENTED_VALUE12938 12939
+#define BSLS_MACROINCREMENTED_VALUE12939 12940
+#define BSLS_MACROINCREMENTED_VALUE12940 12941
+#define BSLS_MACROINCREMENTED_VALUE12941 12942
+#define BSLS_MACROINCREMENTED_VALUE12942 12943
+#define BSLS_MACROINCREMENTED_VALUE12943 12944
+#define BSLS_MACROINCREMENTED_VALUE12944 12945
+#define BSLS_MACROINCREMENTED_VALUE12945 12946
+#define BSLS_MACROINCREMENTED_VALUE12946 12947
+#define BSLS_MACROINCREMENTED_VALUE12947 12948
+#define BSLS_MACROINCREMENTED_VALUE12948 12949
+#define BSLS_MACROINCREMENTED_VALUE12949 12950
+#define BSLS_MACROINCREMENTED_VALUE12950 12951
+#define BSLS_MACROINCREMENTED_VALUE12951 12952
+#define BSLS_MACROINCREMENTED_VALUE12952 12953
+#define BSLS_MACROINCREMENTED_VALUE12953 12954
+#define BSLS_MACROINCREMENTED_VALUE12954 12955
+#define BSLS_MACROINCREMENTED_VALUE12955 12956
+#define BSLS_MACROINCREMENTED_VALUE12956 12957
+#define BSLS_MACROINCREMENTED_VALUE12957 12958
+#define BSLS_MACROINCREMENTED_VALUE12958 12959
+#define BSLS_MACROINCREMENTED_VALUE12959 12960
+#define BSLS_MACROINCREMENTED_VALUE12960 12961
+#define BSLS_MACROINCREMENTED_VALUE12961 12962
+#define BSLS_MACROINCREMENTED_VALUE12962 12963
+#define BSLS_MACROINCREMENTED_VALUE12963 12964
+#define BSLS_MACROINCREMENTED_VALUE12964 12965
+#define BSLS_MACROINCREMENTED_VALUE12965 12966
+#define BSLS_MACROINCREMENTED_VALUE12966 12967
+#define BSLS_MACROINCREMENTED_VALUE12967 12968
+#define BSLS_MACROINCREMENTED_VALUE12968 12969
+#define BSLS_MACROINCREMENTED_VALUE12969 12970
+#define BSLS_MACROINCREMENTED_VALUE12970 12971
+#define BSLS_MACROINCREMENTED_VALUE12971 12972
+#define BSLS_MACROINCREMENTED_VALUE12972 12973
+#define BSLS_MACROINCREMENTED_VALUE12973 12974
+#define BSLS_MACROINCREMENTED_VALUE12974 12975
+#define BSLS_MACROINCREMENTED_VALUE12975 12976
+#define BSLS_MACROINCREMENTED_VALUE12976 12977
+#define BSLS_MACROINCREMENTED_VALUE12977 12978
+#define BSLS_MACROINCREMENTED_VALUE12978 12979
+#define BSLS_MACROINCREMENTED_VALUE12979 12980
+#define BSLS_MACROINCREMENTED_VALUE12980 12981
+#define BSLS_MACROINCREMENTED_VALUE12981 12982
+#define BSLS_MACROINCREMENTED_VALUE12982 12983
+#define BSLS_MACROINCREMENTED_VALUE12983 12984
+#define BSLS_MACROINCREMENTED_VALUE12984 12985
+#define BSLS_MACROINCREMENTED_VALUE12985 12986
+#define BSLS_MACROINCREMENTED_VALUE12986 12987
+#define BSLS_MACROINCREMENTED_VALUE12987 12988
+#define BSLS_MACROINCREMENTED_VALUE12988 12989
+#define BSLS_MACROINCREMENTED_VALUE12989 12990
+#define BSLS_MACROINCREMENTED_VALUE12990 12991
+#define BSLS_MACROINCREMENTED_VALUE12991 12992
+#define BSLS_MACROINCREMENTED_VALUE12992 12993
+#define BSLS_MACROINCREMENTED_VALUE12993 12994
+#define BSLS_MACROINCREMENTED_VALUE12994 12995
+#define BSLS_MACROINCREMENTED_VALUE12995 12996
+#define BSLS_MACROINCREMENTED_VALUE12996 12997
+#define BSLS_MACROINCREMENTED_VALUE12997 12998
+#define BSLS_MACROINCREMENTED_VALUE12998 12999
+#define BSLS_MACROINCREMENTED_VALUE12999 13000
+#define BSLS_MACROINCREMENTED_VALUE13000 13001
+#define BSLS_MACROINCREMENTED_VALUE13001 13002
+#define BSLS_MACROINCREMENTED_VALUE13002 13003
+#define BSLS_MACROINCREMENTED_VALUE13003 13004
+#define BSLS_MACROINCREMENTED_VALUE13004 13005
+#define BSLS_MACROINCREMENTED_VALUE13005 13006
+#define BSLS_MACROINCREMENTED_VALUE13006 13007
+#define BSLS_MACROINCREMENTED_VALUE13007 13008
+#define BSLS_MACROINCREMENTED_VALUE13008 13009
+#define BSLS_MACROINCREMENTED_VALUE13009 13010
+#define BSLS_MACROINCREMENTED_VALUE13010 13011
+#define BSLS_MACROINCREMENTED_VALUE13011 13012
+#define BSLS_MACROINCREMENTED_VALUE13012 13013
+#define BSLS_MACROINCREMENTED_VALUE13013 13014
+#define BSLS_MACROINCREMENTED_VALUE13014 13015
+#define BSLS_MACROINCREMENTED_VALUE13015 13016
+#define BSLS_MACROINCREMENTED_VALUE13016 13017
+#define BSLS_MACROINCREMENTED_VALUE13017 13018
+#define BSLS_MACROINCREMENTED_VALUE13018 13019
+#define BSLS_MACROINCREMENTED_VALUE13019 13020
+#define BSLS_MACROINCREMENTED_VALUE13020 13021
+#define BSLS_MACROINCREMENTED_VALUE13021 13022
+#define BSLS_MACROINCREMENTED_VALUE13022 13023
+#define BSLS_MACROINCREMENTED_VALUE13023 13024
+#define BSLS_MACROINCREMENTED_VALUE13024 13025
+#define BSLS_MACROINCREMENTED_VALUE13025 13026
+#define BSLS_MACROINCREMENTED_VALUE13026 13027
+#define BSLS_MACROINCREMENTED_VALUE13027 13028
+#define BSLS_MACROINCREMENTED_VALUE13028 13029
+#define BSLS_MACROINCREMENTED_VALUE13029 13030
+#define BSLS_MACROINCREMENTED_VALUE13030 13031
+#define BSLS_MACROINCREMENTED_VALUE13031 13032
+#define BSLS_MACROINCREMENTED_VALUE13032 13033
+#define BSLS_MACROINCREMENTED_VALUE13033 13034
+#define BSLS_MACROINCREMENTED_VALUE13034 13035
+#define BSLS_MACROINCREMENTED_VALUE13035 13036
+#define BSLS_MACROINCREMENTED_VALUE13036 13037
+#define BSLS_MACROINCREMENTED_VALUE13037 13038
+#define BSLS_MACROINCREMENTED_VALUE13038 13039
+#define BSLS_MACROINCREMENTED_VALUE13039 13040
+#define BSLS_MACROINCREMENTED_VALUE13040 13041
+#define BSLS_MACROINCREMENTED_VALUE13041 13042
+#define BSLS_MACROINCREMENTED_VALUE13042 13043
+#define BSLS_MACROINCREMENTED_VALUE13043 13044
+#define BSLS_MACROINCREMENTED_VALUE13044 13045
+#define BSLS_MACROINCREMENTED_VALUE13045 13046
+#define BSLS_MACROINCREMENTED_VALUE13046 13047
+#define BSLS_MACROINCREMENTED_VALUE13047 13048
+#define BSLS_MACROINCREMENTED_VALUE13048 13049
+#define BSLS_MACROINCREMENTED_VALUE13049 13050
+#define BSLS_MACROINCREMENTED_VALUE13050 13051
+#define BSLS_MACROINCREMENTED_VALUE13051 13052
+#define BSLS_MACROINCREMENTED_VALUE13052 13053
+#define BSLS_MACROINCREMENTED_VALUE13053 13054
+#define BSLS_MACROINCREMENTED_VALUE13054 13055
+#define BSLS_MACROINCREMENTED_VALUE13055 13056
+#define BSLS_MACROINCREMENTED_VALUE13056 13057
+#define BSLS_MACROINCREMENTED_VALUE13057 13058
+#define BSLS_MACROINCREMENTED_VALUE13058 13059
+#define BSLS_MACROINCREMENTED_VALUE13059 13060
+#define BSLS_MACROINCREMENTED_VALUE13060 13061
+#define BSLS_MACROINCREMENTED_VALUE13061 13062
+#define BSLS_MACROINCREMENTED_VALUE13062 13063
+#define BSLS_MACROINCREMENTED_VALUE13063 13064
+#define BSLS_MACROINCREMENTED_VALUE13064 13065
+#define BSLS_MACROINCREMENTED_VALUE13065 13066
+#define BSLS_MACROINCREMENTED_VALUE13066 13067
+#define BSLS_MACROINCREMENTED_VALUE13067 13068
+#define BSLS_MACROINCREMENTED_VALUE13068 13069
+#define BSLS_MACROINCREMENTED_VALUE13069 13070
+#define BSLS_MACROINCREMENTED_VALUE13070 13071
+#define BSLS_MACROINCREMENTED_VALUE13071 13072
+#define BSLS_MACROINCREMENTED_VALUE13072 13073
+#define BSLS_MACROINCREMENTED_VALUE13073 13074
+#define BSLS_MACROINCREMENTED_VALUE13074 13075
+#define BSLS_MACROINCREMENTED_VALUE13075 13076
+#define BSLS_MACROINCREMENTED_VALUE13076 13077
+#define BSLS_MACROINCREMENTED_VALUE13077 13078
+#define BSLS_MACROINCREMENTED_VALUE13078 13079
+#define BSLS_MACROINCREMENTED_VALUE13079 13080
+#define BSLS_MACROINCREMENTED_VALUE13080 13081
+#define BSLS_MACROINCREMENTED_VALUE13081 13082
+#define BSLS_MACROINCREMENTED_VALUE13082 13083
+#define BSLS_MACROINCREMENTED_VALUE13083 13084
+#define BSLS_MACROINCREMENTED_VALUE13084 13085
+#define BSLS_MACROINCREMENTED_VALUE13085 13086
+#define BSLS_MACROINCREMENTED_VALUE13086 13087
+#define BSLS_MACROINCREMENTED_VALUE13087 13088
+#define BSLS_MACROINCREMENTED_VALUE13088 13089
+#define BSLS_MACROINCREMENTED_VALUE13089 13090
+#define BSLS_MACROINCREMENTED_VALUE13090 13091
+#define BSLS_MACROINCREMENTED_VALUE13091 13092
+#define BSLS_MACROINCREMENTED_VALUE13092 13093
+#define BSLS_MACROINCREMENTED_VALUE13093 13094
+#define BSLS_MACROINCREMENTED_VALUE13094 13095
+#define BSLS_MACROINCREMENTED_VALUE13095 13096
+#define BSLS_MACROINCREMENTED_VALUE13096 13097
+#define BSLS_MACROINCREMENTED_VALUE13097 13098
+#define BSLS_MACROINCREMENTED_VALUE13098 13099
+#define BSLS_MACROINCREMENTED_VALUE13099 13100
+#define BSLS_MACROINCREMENTED_VALUE13100 13101
+#define BSLS_MACROINCREMENTED_VALUE13101 13102
+#define BSLS_MACROINCREMENTED_VALUE13102 13103
+#define BSLS_MACROINCREMENTED_VALUE13103 13104
+#define BSLS_MACROINCREMENTED_VALUE13104 13105
+#define BSLS_MACROINCREMENTED_VALUE13105 13106
+#define BSLS_MACROINCREMENTED_VALUE13106 13107
+#define BSLS_MACROINCREMENTED_VALUE13107 13108
+#define BSLS_MACROINCREMENTED_VALUE13108 13109
+#define BSLS_MACROINCREMENTED_VALUE13109 13110
+#define BSLS_MACROINCREMENTED_VALUE13110 13111
+#define BSLS_MACROINCREMENTED_VALUE13111 13112
+#define BSLS_MACROINCREMENTED_VALUE13112 13113
+#define BSLS_MACROINCREMENTED_VALUE13113 13114
+#define BSLS_MACROINCREMENTED_VALUE13114 13115
+#define BSLS_MACROINCREMENTED_VALUE13115 13116
+#define BSLS_MACROINCREMENTED_VALUE13116 13117
+#define BSLS_MACROINCREMENTED_VALUE13117 13118
+#define BSLS_MACROINCREMENTED_VALUE13118 13119
+#define BSLS_MACROINCREMENTED_VALUE13119 13120
+#define BSLS_MACROINCREMENTED_VALUE13120 13121
+#define BSLS_MACROINCREMENTED_VALUE13121 13122
+#define BSLS_MACROINCREMENTED_VALUE13122 13123
+#define BSLS_MACROINCREMENTED_VALUE13123 13124
+#define BSLS_MACROINCREMENTED_VALUE13124 13125
+#define BSLS_MACROINCREMENTED_VALUE13125 13126
+#define BSLS_MACROINCREMENTED_VALUE13126 13127
+#define BSLS_MACROINCREMENTED_VALUE13127 13128
+#define BSLS_MACROINCREMENTED_VALUE13128 13129
+#define BSLS_MACROINCREMENTED_VALUE13129 13130
+#define BSLS_MACROINCREMENTED_VALUE13130 13131
+#define BSLS_MACROINCREMENTED_VALUE13131 13132
+#define BSLS_MACROINCREMENTED_VALUE13132 13133
+#define BSLS_MACROINCREMENTED_VALUE13133 13134
+#define BSLS_MACROINCREMENTED_VALUE13134 13135
+#define BSLS_MACROINCREMENTED_VALUE13135 13136
+#define BSLS_MACROINCREMENTED_VALUE13136 13137
+#define BSLS_MACROINCREMENTED_VALUE13137 13138
+#define BSLS_MACROINCREMENTED_VALUE13138 13139
+#define BSLS_MACROINCREMENTED_VALUE13139 13140
+#define BSLS_MACROINCREMENTED_VALUE13140 13141
+#define BSLS_MACROINCREMENTED_VALUE13141 13142
+#define BSLS_MACROINCREMENTED_VALUE13142 13143
+#define BSLS_MACROINCREMENTED_VALUE13143 13144
+#define BSLS_MACROINCREMENTED_VALUE13144 13145
+#define BSLS_MACROINCREMENTED_VALUE13145 13146
+#define BSLS_MACROINCREMENTED_VALUE13146 13147
+#define BSLS_MACROINCREMENTED_VALUE13147 13148
+#define BSLS_MACROINCREMENTED_VALUE13148 13149
+#define BSLS_MACROINCREMENTED_VALUE13149 13150
+#define BSLS_MACROINCREMENTED_VALUE13150 13151
+#define BSLS_MACROINCREMENTED_VALUE13151 13152
+#define BSLS_MACROINCREMENTED_VALUE13152 13153
+#define BSLS_MACROINCREMENTED_VALUE13153 13154
+#define BSLS_MACROINCREMENTED_VALUE13154 13155
+#define BSLS_MACROINCREMENTED_VALUE13155 13156
+#define BSLS_MACROINCREMENTED_VALUE13156 13157
+#define BSLS_MACROINCREMENTED_VALUE13157 13158
+#define BSLS_MACROINCREMENTED_VALUE13158 13159
+#define BSLS_MACROINCREMENTED_VALUE13159 13160
+#define BSLS_MACROINCREMENTED_VALUE13160 13161
+#define BSLS_MACROINCREMENTED_VALUE13161 13162
+#define BSLS_MACROINCREMENTED_VALUE13162 13163
+#define BSLS_MACROINCREMENTED_VALUE13163 13164
+#define BSLS_MACROINCREMENTED_VALUE13164 13165
+#define BSLS_MACROINCREMENTED_VALUE13165 13166
+#define BSLS_MACROINCREMENTED_VALUE13166 13167
+#define BSLS_MACROINCREMENTED_VALUE13167 13168
+#define BSLS_MACROINCREMENTED_VALUE13168 13169
+#define BSLS_MACROINCREMENTED_VALUE13169 13170
+#define BSLS_MACROINCREMENTED_VALUE13170 13171
+#define BSLS_MACROINCREMENTED_VALUE13171 13172
+#define BSLS_MACROINCREMENTED_VALUE13172 13173
+#define BSLS_MACROINCREMENTED_VALUE13173 13174
+#define BSLS_MACROINCREMENTED_VALUE13174 13175
+#define BSLS_MACROINCREMENTED_VALUE13175 13176
+#define BSLS_MACROINCREMENTED_VALUE13176 13177
+#define BSLS_MACROINCREMENTED_VALUE13177 13178
+#define BSLS_MACROINCREMENTED_VALUE13178 13179
+#define BSLS_MACROINCREMENTED_VALUE13179 13180
+#define BSLS_MACROINCREMENTED_VALUE13180 13181
+#define BSLS_MACROINCREMENTED_VALUE13181 13182
+#define BSLS_MACROINCREMENTED_VALUE13182 13183
+#define BSLS_MACROINCREMENTED_VALUE13183 13184
+#define BSLS_MACROINCREMENTED_VALUE13184 13185
+#define BSLS_MACROINCREMENTED_VALUE13185 13186
+#define BSLS_MACROINCREMENTED_VALUE13186 13187
+#define BSLS_MACROINCREMENTED_VALUE13187 13188
+#define BSLS_MACROINCREMENTED_VALUE13188 13189
+#define BSLS_MACROINCREMENTED_VALUE13189 13190
+#define BSLS_MACROINCREMENTED_VALUE13190 13191
+#define BSLS_MACROINCREMENTED_VALUE13191 13192
+#define BSLS_MACROINCREMENTED_VALUE13192 13193
+#define BSLS_MACROINCREMENTED_VALUE13193 13194
+#define BSLS_MACROINCREMENTED_VALUE13194 13195
+#define BSLS_MACROINCREMENTED_VALUE13195 13196
+#define BSLS_MACROINCREMENTED_VALUE13196 13197
+#define BSLS_MACROINCREMENTED_VALUE13197 13198
+#define BSLS_MACROINCREMENTED_VALUE13198 13199
+#define BSLS_MACROINCREMENTED_VALUE13199 13200
+#define BSLS_MACROINCREMENTED_VALUE13200 13201
+#define BSLS_MACROINCREMENTED_VALUE13201 13202
+#define BSLS_MACROINCREMENTED_VALUE13202 13203
+#define BSLS_MACROINCREMENTED_VALUE13203 13204
+#define BSLS_MACROINCREMENTED_VALUE13204 13205
+#define BSLS_MACROINCREMENTED_VALUE13205 13206
+#define BSLS_MACROINCREMENTED_VALUE13206 13207
+#define BSLS_MACROINCREMENTED_VALUE13207 13208
+#define BSLS_MACROINCREMENTED_VALUE13208 13209
+#define BSLS_MACROINCREMENTED_VALUE13209 13210
+#define BSLS_MACROINCREMENTED_VALUE13210 13211
+#define BSLS_MACROINCREMENTED_VALUE13211 13212
+#define BSLS_MACROINCREMENTED_VALUE13212 13213
+#define BSLS_MACROINCREMENTED_VALUE13213 13214
+#define BSLS_MACROINCREMENTED_VALUE13214 13215
+#define BSLS_MACROINCREMENTED_VALUE13215 13216
+#define BSLS_MACROINCREMENTED_VALUE13216 13217
+#define BSLS_MACROINCREMENTED_VALUE13217 13218
+#define BSLS_MACROINCREMENTED_VALUE13218 13219
+#define BSLS_MACROINCREMENTED_VALUE13219 13220
+#define BSLS_MACROINCREMENTED_VALUE13220 13221
+#define BSLS_MACROINCREMENTED_VALUE13221 13222
+#define BSLS_MACROINCREMENTED_VALUE13222 13223
+#define BSLS_MACROINCREMENTED_VALUE13223 13224
+#define BSLS_MACROINCREMENTED_VALUE13224 13225
+#define BSLS_MACROINCREMENTED_VALUE13225 13226
+#define BSLS_MACROINCREMENTED_VALUE13226 13227
+#define BSLS_MACROINCREMENTED_VALUE13227 13228
+#define BSLS_MACROINCREMENTED_VALUE13228 13229
+#define BSLS_MACROINCREMENTED_VALUE13229 13230
+#define BSLS_MACROINCREMENTED_VALUE13230 13231
+#define BSLS_MACROINCREMENTED_VALUE13231 13232
+#define BSLS_MACROINCREMENTED_VALUE13232 13233
+#define BSLS_MACROINCREMENTED_VALUE13233 13234
+#define BSLS_MACROINCREMENTED_VALUE13234 13235
+#define BSLS_MACROINCREMENTED_VALUE13235 13236
+#define BSLS_MACROINCREMENTED_VALUE13236 13237
+#define BSLS_MACROINCREMENTED_VALUE13237 13238
+#define BSLS_MACROINCREMENTED_VALUE13238 13239
+#define BSLS_MACROINCREMENTED_VALUE13239 13240
+#define BSLS_MACROINCREMENTED_VALUE13240 13241
+#define BSLS_MACROINCREMENTED_VALUE13241 13242
+#define BSLS_MACROINCREMENTED_VALUE13242 13243
+#define BSLS_MACROINCREMENTED_VALUE13243 13244
+#define BSLS_MACROINCREMENTED_VALUE13244 13245
+#define BSLS_MACROINCREMENTED_VALUE13245 13246
+#define BSLS_MACROINCREMENTED_VALUE13246 13247
+#define BSLS_MACROINCREMENTED_VALUE13247 13248
+#define BSLS_MACROINCREMENTED_VALUE13248 13249
+#define BSLS_MACROINCREMENTED_VALUE13249 13250
+#define BSLS_MACROINCREMENTED_VALUE13250 13251
+#define BSLS_MACROINCREMENTED_VALUE13251 13252
+#define BSLS_MACROINCREMENTED_VALUE13252 13253
+#define BSLS_MACROINCREMENTED_VALUE13253 13254
+#define BSLS_MACROINCREMENTED_VALUE13254 13255
+#define BSLS_MACROINCREMENTED_VALUE13255 13256
+#define BSLS_MACROINCREMENTED_VALUE13256 13257
+#define BSLS_MACROINCREMENTED_VALUE13257 13258
+#define BSLS_MACROINCREMENTED_VALUE13258 13259
+#define BSLS_MACROINCREMENTED_VALUE13259 13260
+#define BSLS_MACROINCREMENTED_VALUE13260 13261
+#define BSLS_MACROINCREMENTED_VALUE13261 13262
+#define BSLS_MACROINCREMENTED_VALUE13262 13263
+#define BSLS_MACROINCREMENTED_VALUE13263 13264
+#define BSLS_MACROINCREMENTED_VALUE13264 13265
+#define BSLS_MACROINCREMENTED_VALUE13265 13266
+#define BSLS_MACROINCREMENTED_VALUE13266 13267
+#define BSLS_MACROINCREMENTED_VALUE13267 13268
+#define BSLS_MACROINCREMENTED_VALUE13268 13269
+#define BSLS_MACROINCREMENTED_VALUE13269 13270
+#define BSLS_MACROINCREMENTED_VALUE13270 13271
+#define BSLS_MACROINCREMENTED_VALUE13271 13272
+#define BSLS_MACROINCREMENTED_VALUE13272 13273
+#define BSLS_MACROINCREMENTED_VALUE13273 13274
+#define BSLS_MACROINCREMENTED_VALUE13274 13275
+#define BSLS_MACROINCREMENTED_VALUE13275 13276
+#define BSLS_MACROINCREMENTED_VALUE13276 13277
+#define BSLS_MACROINCREMENTED_VALUE13277 13278
+#define BSLS_MACROINCREMENTED_VALUE13278 13279
+#define BSLS_MACROINCREMENTED_VALUE13279 13280
+#define BSLS_MACROINCREMENTED_VALUE13280 13281
+#define BSLS_MACROINCREMENTED_VALUE13281 13282
+#define BSLS_MACROINCREMENTED_VALUE13282 13283
+#define BSLS_MACROINCREMENTED_VALUE13283 13284
+#define BSLS_MACROINCREMENTED_VALUE13284 13285
+#define BSLS_MACROINCREMENTED_VALUE13285 13286
+#define BSLS_MACROINCREMENTED_VALUE13286 13287
+#define BSLS_MACROINCREMENTED_VALUE13287 13288
+#define BSLS_MACROINCREMENTED_VALUE13288 13289
+#define BSLS_MACROINCREMENTED_VALUE13289 13290
+#define BSLS_MACROINCREMENTED_VALUE13290 13291
+#define BSLS_MACROINCREMENTED_VALUE13291 13292
+#define BSLS_MACROINCREMENTED_VALUE13292 13293
+#define BSLS_MACROINCREMENTED_VALUE13293 13294
+#define BSLS_MACROINCREMENTED_VALUE13294 13295
+#define BSLS_MACROINCREMENTED_VALUE13295 13296
+#define BSLS_MACROINCREMENTED_VALUE13296 13297
+#define BSLS_MACROINCREMENTED_VALUE13297 13298
+#define BSLS_MACROINCREMENTED_VALUE13298 13299
+#define BSLS_MACROINCREMENTED_VALUE13299 13300
+#define BSLS_MACROINCREMENTED_VALUE13300 13301
+#define BSLS_MACROINCREMENTED_VALUE13301 13302
+#define BSLS_MACROINCREMENTED_VALUE13302 13303
+#define BSLS_MACROINCREMENTED_VALUE13303 13304
+#define BSLS_MACROINCREMENTED_VALUE13304 13305
+#define BSLS_MACROINCREMENTED_VALUE13305 13306
+#define BSLS_MACROINCREMENTED_VALUE13306 13307
+#define BSLS_MACROINCREMENTED_VALUE13307 13308
+#define BSLS_MACROINCREMENTED_VALUE13308 13309
+#define BSLS_MACROINCREMENTED_VALUE13309 13310
+#define BSLS_MACROINCREMENTED_VALUE13310 13311
+#define BSLS_MACROINCREMENTED_VALUE13311 13312
+#define BSLS_MACROINCREMENTED_VALUE13312 13313
+#define BSLS_MACROINCREMENTED_VALUE13313 13314
+#define BSLS_MACROINCREMENTED_VALUE13314 13315
+#define BSLS_MACROINCREMENTED_VALUE13315 13316
+#define BSLS_MACROINCREMENTED_VALUE13316 13317
+#define BSLS_MACROINCREMENTED_VALUE13317 13318
+#define BSLS_MACROINCREMENTED_VALUE13318 13319
+#define BSLS_MACROINCREMENTED_VALUE13319 13320
+#define BSLS_MACROINCREMENTED_VALUE13320 13321
+#define BSLS_MACROINCREMENTED_VALUE13321 13322
+#define BSLS_MACROINCREMENTED_VALUE13322 13323
+#define BSLS_MACROINCREMENTED_VALUE13323 13324
+#define BSLS_MACROINCREMENTED_VALUE13324 13325
+#define BSLS_MACROINCREMENTED_VALUE13325 13326
+#define BSLS_MACROINCREMENTED_VALUE13326 13327
+#define BSLS_MACROINCREMENTED_VALUE13327 13328
+#define BSLS_MACROINCREMENTED_VALUE13328 13329
+#define BSLS_MACROINCREMENTED_VALUE13329 13330
+#define BSLS_MACROINCREMENTED_VALUE13330 13331
+#define BSLS_MACROINCREMENTED_VALUE13331 13332
+#define BSLS_MACROINCREMENTED_VALUE13332 13333
+#define BSLS_MACROINCREMENTED_VALUE13333 13334
+#define BSLS_MACROINCREMENTED_VALUE13334 13335
+#define BSLS_MACROINCREMENTED_VALUE13335 13336
+#define BSLS_MACROINCREMENTED_VALUE13336 13337
+#define BSLS_MACROINCREMENTED_VALUE13337 13338
+#define BSLS_MACROINCREMENTED_VALUE13338 13339
+#define BSLS_MACROINCREMENTED_VALUE13339 13340
+#define BSLS_MACROINCREMENTED_VALUE13340 13341
+#define BSLS_MACROINCREMENTED_VALUE13341 13342
+#define BSLS_MACROINCREMENTED_VALUE13342 13343
+#define BSLS_MACROINCREMENTED_VALUE13343 13344
+#define BSLS_MACROINCREMENTED_VALUE13344 13345
+#define BSLS_MACROINCREMENTED_VALUE13345 13346
+#define BSLS_MACROINCREMENTED_VALUE13346 13347
+#define BSLS_MACROINCREMENTED_VALUE13347 13348
+#define BSLS_MACROINCREMENTED_VALUE13348 13349
+#define BSLS_MACROINCREMENTED_VALUE13349 13350
+#define BSLS_MACROINCREMENTED_VALUE13350 13351
+#define BSLS_MACROINCREMENTED_VALUE13351 13352
+#define BSLS_MACROINCREMENTED_VALUE13352 13353
+#define BSLS_MACROINCREMENTED_VALUE13353 13354
+#define BSLS_MACROINCREMENTED_VALUE13354 13355
+#define BSLS_MACROINCREMENTED_VALUE13355 13356
+#define BSLS_MACROINCREMENTED_VALUE13356 13357
+#define BSLS_MACROINCREMENTED_VALUE13357 13358
+#define BSLS_MACROINCREMENTED_VALUE13358 13359
+#define BSLS_MACROINCREMENTED_VALUE13359 13360
+#define BSLS_MACROINCREMENTED_VALUE13360 13361
+#define BSLS_MACROINCREMENTED_VALUE13361 13362
+#define BSLS_MACROINCREMENTED_VALUE13362 13363
+#define BSLS_MACROINCREMENTED_VALUE13363 13364
+#define BSLS_MACROINCREMENTED_VALUE13364 13365
+#define BSLS_MACROINCREMENTED_VALUE13365 13366
+#define BSLS_MACROINCREMENTED_VALUE13366 13367
+#define BSLS_MACROINCREMENTED_VALUE13367 13368
+#define BSLS_MACROINCREMENTED_VALUE13368 13369
+#define BSLS_MACROINCREMENTED_VALUE13369 13370
+#define BSLS_MACROINCREMENTED_VALUE13370 13371
+#define BSLS_MACROINCREMENTED_VALUE13371 13372
+#define BSLS_MACROINCREMENTED_VALUE13372 13373
+#define BSLS_MACROINCREMENTED_VALUE13373 13374
+#define BSLS_MACROINCREMENTED_VALUE13374 13375
+#define BSLS_MACROINCREMENTED_VALUE13375 13376
+#define BSLS_MACROINCREMENTED_VALUE13376 13377
+#define BSLS_MACROINCREMENTED_VALUE13377 13378
+#define BSLS_MACROINCREMENTED_VALUE13378 13379
+#define BSLS_MACROINCREMENTED_VALUE13379 13380
+#define BSLS_MACROINCREMENTED_VALUE13380 13381
+#define BSLS_MACROINCREMENTED_VALUE13381 13382
+#define BSLS_MACROINCREMENTED_VALUE13382 13383
+#define BSLS_MACROINCREMENTED_VALUE13383 13384
+#define BSLS_MACROINCREMENTED_VALUE13384 13385
+#define BSLS_MACROINCREMENTED_VALUE13385 13386
+#define BSLS_MACROINCREMENTED_VALUE13386 13387
+#define BSLS_MACROINCREMENTED_VALUE13387 13388
+#define BSLS_MACROINCREMENTED_VALUE13388 13389
+#define BSLS_MACROINCREMENTED_VALUE13389 13390
+#define BSLS_MACROINCREMENTED_VALUE13390 13391
+#define BSLS_MACROINCREMENTED_VALUE13391 13392
+#define BSLS_MACROINCREMENTED_VALUE13392 13393
+#define BSLS_MACROINCREMENTED_VALUE13393 13394
+#define BSLS_MACROINCREMENTED_VALUE13394 13395
+#define BSLS_MACROINCREMENTED_VALUE13395 13396
+#define BSLS_MACROINCREMENTED_VALUE13396 13397
+#define BSLS_MACROINCREMENTED_VALUE13397 13398
+#define BSLS_MACROINCREMENTED_VALUE13398 13399
+#define BSLS_MACROINCREMENTED_VALUE13399 13400
+#define BSLS_MACROINCREMENTED_VALUE13400 13401
+#define BSLS_MACROINCREMENTED_VALUE13401 13402
+#define BSLS_MACROINCREMENTED_VALUE13402 13403
+#define BSLS_MACROINCREMENTED_VALUE13403 13404
+#define BSLS_MACROINCREMENTED_VALUE13404 13405
+#define BSLS_MACROINCREMENTED_VALUE13405 13406
+#define BSLS_MACROINCREMENTED_VALUE13406 13407
+#define BSLS_MACROINCREMENTED_VALUE13407 13408
+#define BSLS_MACROINCREMENTED_VALUE13408 13409
+#define BSLS_MACROINCREMENTED_VALUE13409 13410
+#define BSLS_MACROINCREMENTED_VALUE13410 13411
+#define BSLS_MACROINCREMENTED_VALUE13411 13412
+#define BSLS_MACROINCREMENTED_VALUE13412 13413
+#define BSLS_MACROINCREMENTED_VALUE13413 13414
+#define BSLS_MACROINCREMENTED_VALUE13414 13415
+#define BSLS_MACROINCREMENTED_VALUE13415 13416
+#define BSLS_MACROINCREMENTED_VALUE13416 13417
+#define BSLS_MACROINCREMENTED_VALUE13417 13418
+#define BSLS_MACROINCREMENTED_VALUE13418 13419
+#define BSLS_MACROINCREMENTED_VALUE13419 13420
+#define BSLS_MACROINCREMENTED_VALUE13420 13421
+#define BSLS_MACROINCREMENTED_VALUE13421 13422
+#define BSLS_MACROINCREMENTED_VALUE13422 13423
+#define BSLS_MACROINCREMENTED_VALUE13423 13424
+#define BSLS_MACROINCREMENTED_VALUE13424 13425
+#define BSLS_MACROINCREMENTED_VALUE13425 13426
+#define BSLS_MACROINCREMENTED_VALUE13426 13427
+#define BSLS_MACROINCREMENTED_VALUE13427 13428
+#define BSLS_MACROINCREMENTED_VALUE13428 13429
+#define BSLS_MACROINCREMENTED_VALUE13429 13430
+#define BSLS_MACROINCREMENTED_VALUE13430 13431
+#define BSLS_MACROINCREMENTED_VALUE13431 13432
+#define BSLS_MACROINCREMENTED_VALUE13432 13433
+#define BSLS_MACROINCREMENTED_VALUE13433 13434
+#define BSLS_MACROINCREMENTED_VALUE13434 13435
+#define BSLS_MACROINCREMENTED_VALUE13435 13436
+#define BSLS_MACROINCREMENTED_VALUE13436 13437
+#define BSLS_MACROINCREMENTED_VALUE13437 13438
+#define BSLS_MACROINCREMENTED_VALUE13438 13439
+#define BSLS_MACROINCREMENTED_VALUE13439 13440
+#define BSLS_MACROINCREMENTED_VALUE13440 13441
+#define BSLS_MACROINCREMENTED_VALUE13441 13442
+#define BSLS_MACROINCREMENTED_VALUE13442 13443
+#define BSLS_MACROINCREMENTED_VALUE13443 13444
+#define BSLS_MACROINCREMENTED_VALUE13444 13445
+#define BSLS_MACROINCREMENTED_VALUE13445 13446
+#define BSLS_MACROINCREMENTED_VALUE13446 13447
+#define BSLS_MACROINCREMENTED_VALUE13447 13448
+#define BSLS_MACROINCREMENTED_VALUE13448 13449
+#define BSLS_MACROINCREMENTED_VALUE13449 13450
+#define BSLS_MACROINCREMENTED_VALUE13450 13451
+#define BSLS_MACROINCREMENTED_VALUE13451 13452
+#define BSLS_MACROINCREMENTED_VALUE13452 13453
+#define BSLS_MACROINCREMENTED_VALUE13453 13454
+#define BSLS_MACROINCREMENTED_VALUE13454 13455
+#define BSLS_MACROINCREMENTED_VALUE13455 13456
+#define BSLS_MACROINCREMENTED_VALUE13456 13457
+#define BSLS_MACROINCREMENTED_VALUE13457 13458
+#define BSLS_MACROINCREMENTED_VALUE13458 13459
+#define BSLS_MACROINCREMENTED_VALUE13459 13460
+#define BSLS_MACROINCREMENTED_VALUE13460 13461
+#define BSLS_MACROINCREMENTED_VALUE13461 13462
+#define BSLS_MACROINCREMENTED_VALUE13462 13463
+#define BSLS_MACROINCREMENTED_VALUE13463 13464
+#define BSLS_MACROINCREMENTED_VALUE13464 13465
+#define BSLS_MACROINCREMENTED_VALUE13465 13466
+#define BSLS_MACROINCREMENTED_VALUE13466 13467
+#define BSLS_MACROINCREMENTED_VALUE13467 13468
+#define BSLS_MACROINCREMENTED_VALUE13468 13469
+#define BSLS_MACROINCREMENTED_VALUE13469 13470
+#define BSLS_MACROINCREMENTED_VALUE13470 13471
+#define BSLS_MACROINCREMENTED_VALUE13471 13472
+#define BSLS_MACROINCREMENTED_VALUE13472 13473
+#define BSLS_MACROINCREMENTED_VALUE13473 13474
+#define BSLS_MACROINCREMENTED_VALUE13474 13475
+#define BSLS_MACROINCREMENTED_VALUE13475 13476
+#define BSLS_MACROINCREMENTED_VALUE13476 13477
+#define BSLS_MACROINCREMENTED_VALUE13477 13478
+#define BSLS_MACROINCREMENTED_VALUE13478 13479
+#define BSLS_MACROINCREMENTED_VALUE13479 13480
+#define BSLS_MACROINCREMENTED_VALUE13480 13481
+#define BSLS_MACROINCREMENTED_VALUE13481 13482
+#define BSLS_MACROINCREMENTED_VALUE13482 13483
+#define BSLS_MACROINCREMENTED_VALUE13483 13484
+#define BSLS_MACROINCREMENTED_VALUE13484 13485
+#define BSLS_MACROINCREMENTED_VALUE13485 13486
+#define BSLS_MACROINCREMENTED_VALUE13486 13487
+#define BSLS_MACROINCREMENTED_VALUE13487 13488
+#define BSLS_MACROINCREMENTED_VALUE13488 13489
+#define BSLS_MACROINCREMENTED_VALUE13489 13490
+#define BSLS_MACROINCREMENTED_VALUE13490 13491
+#define BSLS_MACROINCREMENTED_VALUE13491 13492
+#define BSLS_MACROINCREMENTED_VALUE13492 13493
+#define BSLS_MACROINCREMENTED_VALUE13493 13494
+#define BSLS_MACROINCREMENTED_VALUE13494 13495
+#define BSLS_MACROINCREMENTED_VALUE13495 13496
+#define BSLS_MACROINCREMENTED_VALUE13496 13497
+#define BSLS_MACROINCREMENTED_VALUE13497 13498
+#define BSLS_MACROINCREMENTED_VALUE13498 13499
+#define BSLS_MACROINCREMENTED_VALUE13499 13500
+#define BSLS_MACROINCREMENTED_VALUE13500 13501
+#define BSLS_MACROINCREMENTED_VALUE13501 13502
+#define BSLS_MACROINCREMENTED_VALUE13502 13503
+#define BSLS_MACROINCREMENTED_VALUE13503 13504
+#define BSLS_MACROINCREMENTED_VALUE13504 13505
+#define BSLS_MACROINCREMENTED_VALUE13505 13506
+#define BSLS_MACROINCREMENTED_VALUE13506 13507
+#define BSLS_MACROINCREMENTED_VALUE13507 13508
+#define BSLS_MACROINCREMENTED_VALUE13508 13509
+#define BSLS_MACROINCREMENTED_VALUE13509 13510
+#define BSLS_MACROINCREMENTED_VALUE13510 13511
+#define BSLS_MACROINCREMENTED_VALUE13511 13512
+#define BSLS_MACROINCREMENTED_VALUE13512 13513
+#define BSLS_MACROINCREMENTED_VALUE13513 13514
+#define BSLS_MACROINCREMENTED_VALUE13514 13515
+#define BSLS_MACROINCREMENTED_VALUE13515 13516
+#define BSLS_MACROINCREMENTED_VALUE13516 13517
+#define BSLS_MACROINCREMENTED_VALUE13517 13518
+#define BSLS_MACROINCREMENTED_VALUE13518 13519
+#define BSLS_MACROINCREMENTED_VALUE13519 13520
+#define BSLS_MACROINCREMENTED_VALUE13520 13521
+#define BSLS_MACROINCREMENTED_VALUE13521 13522
+#define BSLS_MACROINCREMENTED_VALUE13522 13523
+#define BSLS_MACROINCREMENTED_VALUE13523 13524
+#define BSLS_MACROINCREMENTED_VALUE13524 13525
+#define BSLS_MACROINCREMENTED_VALUE13525 13526
+#define BSLS_MACROINCREMENTED_VALUE13526 13527
+#define BSLS_MACROINCREMENTED_VALUE13527 13528
+#define BSLS_MACROINCREMENTED_VALUE13528 13529
+#define BSLS_MACROINCREMENTED_VALUE13529 13530
+#define BSLS_MACROINCREMENTED_VALUE13530 13531
+#define BSLS_MACROINCREMENTED_VALUE13531 13532
+#define BSLS_MACROINCREMENTED_VALUE13532 13533
+#define BSLS_MACROINCREMENTED_VALUE13533 13534
+#define BSLS_MACROINCREMENTED_VALUE13534 13535
+#define BSLS_MACROINCREMENTED_VALUE13535 13536
+#define BSLS_MACROINCREMENTED_VALUE13536 13537
+#define BSLS_MACROINCREMENTED_VALUE13537 13538
+#define BSLS_MACROINCREMENTED_VALUE13538 13539
+#define BSLS_MACROINCREMENTED_VALUE13539 13540
+#define BSLS_MACROINCREMENTED_VALUE13540 13541
+#define BSLS_MACROINCREMENTED_VALUE13541 13542
+#define BSLS_MACROINCREMENTED_VALUE13542 13543
+#define BSLS_MACROINCREMENTED_VALUE13543 13544
+#define BSLS_MACROINCREMENTED_VALUE13544 13545
+#define BSLS_MACROINCREMENTED_VALUE13545 13546
+#define BSLS_MACROINCREMENTED_VALUE13546 13547
+#define BSLS_MACROINCREMENTED_VALUE13547 13548
+#define BSLS_MACROINCREMENTED_VALUE13548 13549
+#define BSLS_MACROINCREMENTED_VALUE13549 13550
+#define BSLS_MACROINCREMENTED_VALUE13550 13551
+#define BSLS_MACROINCREMENTED_VALUE13551 13552
+#define BSLS_MACROINCREMENTED_VALUE13552 13553
+#define BSLS_MACROINCREMENTED_VALUE13553 13554
+#define BSLS_MACROINCREMENTED_VALUE13554 13555
+#define BSLS_MACROINCREMENTED_VALUE13555 13556
+#define BSLS_MACROINCREMENTED_VALUE13556 13557
+#define BSLS_MACROINCREMENTED_VALUE13557 13558
+#define BSLS_MACROINCREMENTED_VALUE13558 13559
+#define BSLS_MACROINCREMENTED_VALUE13559 13560
+#define BSLS_MACROINCREMENTED_VALUE13560 13561
+#define BSLS_MACROINCREMENTED_VALUE13561 13562
+#define BSLS_MACROINCREMENTED_VALUE13562 13563
+#define BSLS_MACROINCREMENTED_VALUE13563 13564
+#define BSLS_MACROINCREMENTED_VALUE13564 13565
+#define BSLS_MACROINCREMENTED_VALUE13565 13566
+#define BSLS_MACROINCREMENTED_VALUE13566 13567
+#define BSLS_MACROINCREMENTED_VALUE13567 13568
+#define BSLS_MACROINCREMENTED_VALUE13568 13569
+#define BSLS_MACROINCREMENTED_VALUE13569 13570
+#define BSLS_MACROINCREMENTED_VALUE13570 13571
+#define BSLS_MACROINCREMENTED_VALUE13571 13572
+#define BSLS_MACROINCREMENTED_VALUE13572 13573
+#define BSLS_MACROINCREMENTED_VALUE13573 13574
+#define BSLS_MACROINCREMENTED_VALUE13574 13575
+#define BSLS_MACROINCREMENTED_VALUE13575 13576
+#define BSLS_MACROINCREMENTED_VALUE13576 13577
+#define BSLS_MACROINCREMENTED_VALUE13577 13578
+#define BSLS_MACROINCREMENTED_VALUE13578 13579
+#define BSLS_MACROINCREMENTED_VALUE13579 13580
+#define BSLS_MACROINCREMENTED_VALUE13580 13581
+#define BSLS_MACROINCREMENTED_VALUE13581 13582
+#define BSLS_MACROINCREMENTED_VALUE13582 13583
+#define BSLS_MACROINCREMENTED_VALUE13583 13584
+#define BSLS_MACROINCREMENTED_VALUE13584 13585
+#define BSLS_MACROINCREMENTED_VALUE13585 13586
+#define BSLS_MACROINCREMENTED_VALUE13586 13587
+#define BSLS_MACROINCREMENTED_VALUE13587 13588
+#define BSLS_MACROINCREMENTED_VALUE13588 13589
+#define BSLS_MACROINCREMENTED_VALUE13589 13590
+#define BSLS_MACROINCREMENTED_VALUE13590 13591
+#define BSLS_MACROINCREMENTED_VALUE13591 13592
+#define BSLS_MACROINCREMENTED_VALUE13592 13593
+#define BSLS_MACROINCREMENTED_VALUE13593 13594
+#define BSLS_MACROINCREMENTED_VALUE13594 13595
+#define BSLS_MACROINCREMENTED_VALUE13595 13596
+#define BSLS_MACROINCREMENTED_VALUE13596 13597
+#define BSLS_MACROINCREMENTED_VALUE13597 13598
+#define BSLS_MACROINCREMENTED_VALUE13598 13599
+#define BSLS_MACROINCREMENTED_VALUE13599 13600
+#define BSLS_MACROINCREMENTED_VALUE13600 13601
+#define BSLS_MACROINCREMENTED_VALUE13601 13602
+#define BSLS_MACROINCREMENTED_VALUE13602 13603
+#define BSLS_MACROINCREMENTED_VALUE13603 13604
+#define BSLS_MACROINCREMENTED_VALUE13604 13605
+#define BSLS_MACROINCREMENTED_VALUE13605 13606
+#define BSLS_MACROINCREMENTED_VALUE13606 13607
+#define BSLS_MACROINCREMENTED_VALUE13607 13608
+#define BSLS_MACROINCREMENTED_VALUE13608 13609
+#define BSLS_MACROINCREMENTED_VALUE13609 13610
+#define BSLS_MACROINCREMENTED_VALUE13610 13611
+#define BSLS_MACROINCREMENTED_VALUE13611 13612
+#define BSLS_MACROINCREMENTED_VALUE13612 13613
+#define BSLS_MACROINCREMENTED_VALUE13613 13614
+#define BSLS_MACROINCREMENTED_VALUE13614 13615
+#define BSLS_MACROINCREMENTED_VALUE13615 13616
+#define BSLS_MACROINCREMENTED_VALUE13616 13617
+#define BSLS_MACROINCREMENTED_VALUE13617 13618
+#define BSLS_MACROINCREMENTED_VALUE13618 13619
+#define BSLS_MACROINCREMENTED_VALUE13619 13620
+#define BSLS_MACROINCREMENTED_VALUE13620 13621
+#define BSLS_MACROINCREMENTED_VALUE13621 13622
+#define BSLS_MACROINCREMENTED_VALUE13622 13623
+#define BSLS_MACROINCREMENTED_VALUE13623 13624
+#define BSLS_MACROINCREMENTED_VALUE13624 13625
+#define BSLS_MACROINCREMENTED_VALUE13625 13626
+#define BSLS_MACROINCREMENTED_VALUE13626 13627
+#define BSLS_MACROINCREMENTED_VALUE13627 13628
+#define BSLS_MACROINCREMENTED_VALUE13628 13629
+#define BSLS_MACROINCREMENTED_VALUE13629 13630
+#define BSLS_MACROINCREMENTED_VALUE13630 13631
+#define BSLS_MACROINCREMENTED_VALUE13631 13632
+#define BSLS_MACROINCREMENTED_VALUE13632 13633
+#define BSLS_MACROINCREMENTED_VALUE13633 13634
+#define BSLS_MACROINCREMENTED_VALUE13634 13635
+#define BSLS_MACROINCREMENTED_VALUE13635 13636
+#define BSLS_MACROINCREMENTED_VALUE13636 13637
+#define BSLS_MACROINCREMENTED_VALUE13637 13638
+#define BSLS_MACROINCREMENTED_VALUE13638 13639
+#define BSLS_MACROINCREMENTED_VALUE13639 13640
+#define BSLS_MACROINCREMENTED_VALUE13640 13641
+#define BSLS_MACROINCREMENTED_VALUE13641 13642
+#define BSLS_MACROINCREMENTED_VALUE13642 13643
+#define BSLS_MACROINCREMENTED_VALUE13643 13644
+#define BSLS_MACROINCREMENTED_VALUE13644 13645
+#define BSLS_MACROINCREMENTED_VALUE13645 13646
+#define BSLS_MACROINCREMENTED_VALUE13646 13647
+#define BSLS_MACROINCREMENTED_VALUE13647 13648
+#define BSLS_MACROINCREMENTED_VALUE13648 13649
+#define BSLS_MACROINCREMENTED_VALUE13649 13650
+#define BSLS_MACROINCREMENTED_VALUE13650 13651
+#define BSLS_MACROINCREMENTED_VALUE13651 13652
+#define BSLS_MACROINCREMENTED_VALUE13652 13653
+#define BSLS_MACROINCREMENTED_VALUE13653 13654
+#define BSLS_MACROINCREMENTED_VALUE13654 13655
+#define BSLS_MACROINCREMENTED_VALUE13655 13656
+#define BSLS_MACROINCREMENTED_VALUE13656 13657
+#define BSLS_MACROINCREMENTED_VALUE13657 13658
+#define BSLS_MACROINCREMENTED_VALUE13658 13659
+#define BSLS_MACROINCREMENTED_VALUE13659 13660
+#define BSLS_MACROINCREMENTED_VALUE13660 13661
+#define BSLS_MACROINCREMENTED_VALUE13661 13662
+#define BSLS_MACROINCREMENTED_VALUE13662 13663
+#define BSLS_MACROINCREMENTED_VALUE13663 13664
+#define BSLS_MACROINCREMENTED_VALUE13664 13665
+#define BSLS_MACROINCREMENTED_VALUE13665 13666
+#define BSLS_MACROINCREMENTED_VALUE13666 13667
+#define BSLS_MACROINCREMENTED_VALUE13667 13668
+#define BSLS_MACROINCREMENTED_VALUE13668 13669
+#define BSLS_MACROINCREMENTED_VALUE13669 13670
+#define BSLS_MACROINCREMENTED_VALUE13670 13671
+#define BSLS_MACROINCREMENTED_VALUE13671 13672
+#define BSLS_MACROINCREMENTED_VALUE13672 13673
+#define BSLS_MACROINCREMENTED_VALUE13673 13674
+#define BSLS_MACROINCREMENTED_VALUE13674 13675
+#define BSLS_MACROINCREMENTED_VALUE13675 13676
+#define BSLS_MACROINCREMENTED_VALUE13676 13677
+#define BSLS_MACROINCREMENTED_VALUE13677 13678
+#define BSLS_MACROINCREMENTED_VALUE13678 13679
+#define BSLS_MACROINCREMENTED_VALUE13679 13680
+#define BSLS_MACROINCREMENTED_VALUE13680 13681
+#define BSLS_MACROINCREMENTED_VALUE13681 13682
+#define BSLS_MACROINCREMENTED_VALUE13682 13683
+#define BSLS_MACROINCREMENTED_VALUE13683 13684
+#define BSLS_MACROINCREMENTED_VALUE13684 13685
+#define BSLS_MACROINCREMENTED_VALUE13685 13686
+#define BSLS_MACROINCREMENTED_VALUE13686 13687
+#define BSLS_MACROINCREMENTED_VALUE13687 13688
+#define BSLS_MACROINCREMENTED_VALUE13688 13689
+#define BSLS_MACROINCREMENTED_VALUE13689 13690
+#define BSLS_MACROINCREMENTED_VALUE13690 13691
+#define BSLS_MACROINCREMENTED_VALUE13691 13692
+#define BSLS_MACROINCREMENTED_VALUE13692 13693
+#define BSLS_MACROINCREMENTED_VALUE13693 13694
+#define BSLS_MACROINCREMENTED_VALUE13694 13695
+#define BSLS_MACROINCREMENTED_VALUE13695 13696
+#define BSLS_MACROINCREMENTED_VALUE13696 13697
+#define BSLS_MACROINCREMENTED_VALUE13697 13698
+#define BSLS_MACROINCREMENTED_VALUE13698 13699
+#define BSLS_MACROINCREMENTED_VALUE13699 13700
+#define BSLS_MACROINCREMENTED_VALUE13700 13701
+#define BSLS_MACROINCREMENTED_VALUE13701 13702
+#define BSLS_MACROINCREMENTED_VALUE13702 13703
+#define BSLS_MACROINCREMENTED_VALUE13703 13704
+#define BSLS_MACROINCREMENTED_VALUE13704 13705
+#define BSLS_MACROINCREMENTED_VALUE13705 13706
+#define BSLS_MACROINCREMENTED_VALUE13706 13707
+#define BSLS_MACROINCREMENTED_VALUE13707 13708
+#define BSLS_MACROINCREMENTED_VALUE13708 13709
+#define BSLS_MACROINCREMENTED_VALUE13709 13710
+#define BSLS_MACROINCREMENTED_VALUE13710 13711
+#define BSLS_MACROINCREMENTED_VALUE13711 13712
+#define BSLS_MACROINCREMENTED_VALUE13712 13713
+#define BSLS_MACROINCREMENTED_VALUE13713 13714
+#define BSLS_MACROINCREMENTED_VALUE13714 13715
+#define BSLS_MACROINCREMENTED_VALUE13715 13716
+#define BSLS_MACROINCREMENTED_VALUE13716 13717
+#define BSLS_MACROINCREMENTED_VALUE13717 13718
+#define BSLS_MACROINCREMENTED_VALUE13718 13719
+#define BSLS_MACROINCREMENTED_VALUE13719 13720
+#define BSLS_MACROINCREMENTED_VALUE13720 13721
+#define BSLS_MACROINCREMENTED_VALUE13721 13722
+#define BSLS_MACROINCREMENTED_VALUE13722 13723
+#define BSLS_MACROINCREMENTED_VALUE13723 13724
+#define BSLS_MACROINCREMENTED_VALUE13724 13725
+#define BSLS_MACROINCREMENTED_VALUE13725 13726
+#define BSLS_MACROINCREMENTED_VALUE13726 13727
+#define BSLS_MACROINCREMENTED_VALUE13727 13728
+#define BSLS_MACROINCREMENTED_VALUE13728 13729
+#define BSLS_MACROINCREMENTED_VALUE13729 13730
+#define BSLS_MACROINCREMENTED_VALUE13730 13731
+#define BSLS_MACROINCREMENTED_VALUE13731 13732
+#define BSLS_MACROINCREMENTED_VALUE13732 13733
+#define BSLS_MACROINCREMENTED_VALUE13733 13734
+#define BSLS_MACROINCREMENTED_VALUE13734 13735
+#define BSLS_MACROINCREMENTED_VALUE13735 13736
+#define BSLS_MACROINCREMENTED_VALUE13736 13737
+#define BSLS_MACROINCREMENTED_VALUE13737 13738
+#define BSLS_MACROINCREMENTED_VALUE13738 13739
+#define BSLS_MACROINCREMENTED_VALUE13739 13740
+#define BSLS_MACROINCREMENTED_VALUE13740 13741
+#define BSLS_MACROINCREMENTED_VALUE13741 13742
+#define BSLS_MACROINCREMENTED_VALUE13742 13743
+#define BSLS_MACROINCREMENTED_VALUE13743 13744
+#define BSLS_MACROINCREMENTED_VALUE13744 13745
+#define BSLS_MACROINCREMENTED_VALUE13745 13746
+#define BSLS_MACROINCREMENTED_VALUE13746 13747
+#define BSLS_MACROINCREMENTED_VALUE13747 13748
+#define BSLS_MACROINCREMENTED_VALUE13748 13749
+#define BSLS_MACROINCREMENTED_VALUE13749 13750
+#define BSLS_MACROINCREMENTED_VALUE13750 13751
+#define BSLS_MACROINCREMENTED_VALUE13751 13752
+#define BSLS_MACROINCREMENTED_VALUE13752 13753
+#define BSLS_MACROINCREMENTED_VALUE13753 13754
+#define BSLS_MACROINCREMENTED_VALUE13754 13755
+#define BSLS_MACROINCREMENTED_VALUE13755 13756
+#define BSLS_MACROINCREMENTED_VALUE13756 13757
+#define BSLS_MACROINCREMENTED_VALUE13757 13758
+#define BSLS_MACROINCREMENTED_VALUE13758 13759
+#define BSLS_MACROINCREMENTED_VALUE13759 13760
+#define BSLS_MACROINCREMENTED_VALUE13760 13761
+#define BSLS_MACROINCREMENTED_VALUE13761 13762
+#define BSLS_MACROINCREMENTED_VALUE13762 13763
+#define BSLS_MACROINCREMENTED_VALUE13763 13764
+#define BSLS_MACROINCREMENTED_VALUE13764 13765
+#define BSLS_MACROINCREMENTED_VALUE13765 13766
+#define BSLS_MACROINCREMENTED_VALUE13766 13767
+#define BSLS_MACROINCREMENTED_VALUE13767 13768
+#define BSLS_MACROINCREMENTED_VALUE13768 13769
+#define BSLS_MACROINCREMENTED_VALUE13769 13770
+#define BSLS_MACROINCREMENTED_VALUE13770 13771
+#define BSLS_MACROINCREMENTED_VALUE13771 13772
+#define BSLS_MACROINCREMENTED_VALUE13772 13773
+#define BSLS_MACROINCREMENTED_VALUE13773 13774
+#define BSLS_MACROINCREMENTED_VALUE13774 13775
+#define BSLS_MACROINCREMENTED_VALUE13775 13776
+#define BSLS_MACROINCREMENTED_VALUE13776 13777
+#define BSLS_MACROINCREMENTED_VALUE13777 13778
+#define BSLS_MACROINCREMENTED_VALUE13778 13779
+#define BSLS_MACROINCREMENTED_VALUE13779 13780
+#define BSLS_MACROINCREMENTED_VALUE13780 13781
+#define BSLS_MACROINCREMENTED_VALUE13781 13782
+#define BSLS_MACROINCREMENTED_VALUE13782 13783
+#define BSLS_MACROINCREMENTED_VALUE13783 13784
+#define BSLS_MACROINCREMENTED_VALUE13784 13785
+#define BSLS_MACROINCREMENTED_VALUE13785 13786
+#define BSLS_MACROINCREMENTED_VALUE13786 13787
+#define BSLS_MACROINCREMENTED_VALUE13787 13788
+#define BSLS_MACROINCREMENTED_VALUE13788 13789
+#define BSLS_MACROINCREMENTED_VALUE13789 13790
+#define BSLS_MACROINCREMENTED_VALUE13790 13791
+#define BSLS_MACROINCREMENTED_VALUE13791 13792
+#define BSLS_MACROINCREMENTED_VALUE13792 13793
+#define BSLS_MACROINCREMENTED_VALUE13793 13794
+#define BSLS_MACROINCREMENTED_VALUE13794 13795
+#define BSLS_MACROINCREMENTED_VALUE13795 13796
+#define BSLS_MACROINCREMENTED_VALUE13796 13797
+#define BSLS_MACROINCREMENTED_VALUE13797 13798
+#define BSLS_MACROINCREMENTED_VALUE13798 13799
+#define BSLS_MACROINCREMENTED_VALUE13799 13800
+#define BSLS_MACROINCREMENTED_VALUE13800 13801
+#define BSLS_MACROINCREMENTED_VALUE13801 13802
+#define BSLS_MACROINCREMENTED_VALUE13802 13803
+#define BSLS_MACROINCREMENTED_VALUE13803 13804
+#define BSLS_MACROINCREMENTED_VALUE13804 13805
+#define BSLS_MACROINCREMENTED_VALUE13805 13806
+#define BSLS_MACROINCREMENTED_VALUE13806 13807
+#define BSLS_MACROINCREMENTED_VALUE13807 13808
+#define BSLS_MACROINCREMENTED_VALUE13808 13809
+#define BSLS_MACROINCREMENTED_VALUE13809 13810
+#define BSLS_MACROINCREMENTED_VALUE13810 13811
+#define BSLS_MACROINCREMENTED_VALUE13811 13812
+#define BSLS_MACROINCREMENTED_VALUE13812 13813
+#define BSLS_MACROINCREMENTED_VALUE13813 13814
+#define BSLS_MACROINCREMENTED_VALUE13814 13815
+#define BSLS_MACROINCREMENTED_VALUE13815 13816
+#define BSLS_MACROINCREMENTED_VALUE13816 13817
+#define BSLS_MACROINCREMENTED_VALUE13817 13818
+#define BSLS_MACROINCREMENTED_VALUE13818 13819
+#define BSLS_MACROINCREMENTED_VALUE13819 13820
+#define BSLS_MACROINCREMENTED_VALUE13820 13821
+#define BSLS_MACROINCREMENTED_VALUE13821 13822
+#define BSLS_MACROINCREMENTED_VALUE13822 13823
+#define BSLS_MACROINCREMENTED_VALUE13823 13824
+#define BSLS_MACROINCREMENTED_VALUE13824 13825
+#define BSLS_MACROINCREMENTED_VALUE13825 13826
+#define BSLS_MACROINCREMENTED_VALUE13826 13827
+#define BSLS_MACROINCREMENTED_VALUE13827 13828
+#define BSLS_MACROINCREMENTED_VALUE13828 13829
+#define BSLS_MACROINCREMENTED_VALUE13829 13830
+#define BSLS_MACROINCREMENTED_VALUE13830 13831
+#define BSLS_MACROINCREMENTED_VALUE13831 13832
+#define BSLS_MACROINCREMENTED_VALUE13832 13833
+#define BSLS_MACROINCREMENTED_VALUE13833 13834
+#define BSLS_MACROINCREMENTED_VALUE13834 13835
+#define BSLS_MACROINCREMENTED_VALUE13835 13836
+#define BSLS_MACROINCREMENTED_VALUE13836 13837
+#define BSLS_MACROINCREMENTED_VALUE13837 13838
+#define BSLS_MACROINCREMENTED_VALUE13838 13839
+#define BSLS_MACROINCREMENTED_VALUE13839 13840
+#define BSLS_MACROINCREMENTED_VALUE13840 13841
+#define BSLS_MACROINCREMENTED_VALUE13841 13842
+#define BSLS_MACROINCREMENTED_VALUE13842 13843
+#define BSLS_MACROINCREMENTED_VALUE13843 13844
+#define BSLS_MACROINCREMENTED_VALUE13844 13845
+#define BSLS_MACROINCREMENTED_VALUE13845 13846
+#define BSLS_MACROINCREMENTED_VALUE13846 13847
+#define BSLS_MACROINCREMENTED_VALUE13847 13848
+#define BSLS_MACROINCREMENTED_VALUE13848 13849
+#define BSLS_MACROINCREMENTED_VALUE13849 13850
+#define BSLS_MACROINCREMENTED_VALUE13850 13851
+#define BSLS_MACROINCREMENTED_VALUE13851 13852
+#define BSLS_MACROINCREMENTED_VALUE13852 13853
+#define BSLS_MACROINCREMENTED_VALUE13853 13854
+#define BSLS_MACROINCREMENTED_VALUE13854 13855
+#define BSLS_MACROINCREMENTED_VALUE13855 13856
+#define BSLS_MACROINCREMENTED_VALUE13856 13857
+#define BSLS_MACROINCREMENTED_VALUE13857 13858
+#define BSLS_MACROINCREMENTED_VALUE13858 13859
+#define BSLS_MACROINCREMENTED_VALUE13859 13860
+#define BSLS_MACROINCREMENTED_VALUE13860 13861
+#define BSLS_MACROINCREMENTED_VALUE13861 13862
+#define BSLS_MACROINCREMENTED_VALUE13862 13863
+#define BSLS_MACROINCREMENTED_VALUE13863 13864
+#define BSLS_MACROINCREMENTED_VALUE13864 13865
+#define BSLS_MACROINCREMENTED_VALUE13865 13866
+#define BSLS_MACROINCREMENTED_VALUE13866 13867
+#define BSLS_MACROINCREMENTED_VALUE13867 13868
+#define BSLS_MACROINCREMENTED_VALUE13868 13869
+#define BSLS_MACROINCREMENTED_VALUE13869 13870
+#define BSLS_MACROINCREMENTED_VALUE13870 13871
+#define BSLS_MACROINCREMENTED_VALUE13871 13872
+#define BSLS_MACROINCREMENTED_VALUE13872 13873
+#define BSLS_MACROINCREMENTED_VALUE13873 13874
+#define BSLS_MACROINCREMENTED_VALUE13874 13875
+#define BSLS_MACROINCREMENTED_VALUE13875 13876
+#define BSLS_MACROINCREMENTED_VALUE13876 13877
+#define BSLS_MACROINCREMENTED_VALUE13877 13878
+#define BSLS_MACROINCREMENTED_VALUE13878 13879
+#define BSLS_MACROINCREMENTED_VALUE13879 13880
+#define BSLS_MACROINCREMENTED_VALUE13880 13881
+#define BSLS_MACROINCREMENTED_VALUE13881 13882
+#define BSLS_MACROINCREMENTED_VALUE13882 13883
+#define BSLS_MACROINCREMENTED_VALUE13883 13884
+#define BSLS_MACROINCREMENTED_VALUE13884 13885
+#define BSLS_MACROINCREMENTED_VALUE13885 13886
+#define BSLS_MACROINCREMENTED_VALUE13886 13887
+#define BSLS_MACROINCREMENTED_VALUE13887 13888
+#define BSLS_MACROINCREMENTED_VALUE13888 13889
+#define BSLS_MACROINCREMENTED_VALUE13889 13890
+#define BSLS_MACROINCREMENTED_VALUE13890 13891
+#define BSLS_MACROINCREMENTED_VALUE13891 13892
+#define BSLS_MACROINCREMENTED_VALUE13892 13893
+#define BSLS_MACROINCREMENTED_VALUE13893 13894
+#define BSLS_MACROINCREMENTED_VALUE13894 13895
+#define BSLS_MACROINCREMENTED_VALUE13895 13896
+#define BSLS_MACROINCREMENTED_VALUE13896 13897
+#define BSLS_MACROINCREMENTED_VALUE13897 13898
+#define BSLS_MACROINCREMENTED_VALUE13898 13899
+#define BSLS_MACROINCREMENTED_VALUE13899 13900
+#define BSLS_MACROINCREMENTED_VALUE13900 13901
+#define BSLS_MACROINCREMENTED_VALUE13901 13902
+#define BSLS_MACROINCREMENTED_VALUE13902 13903
+#define BSLS_MACROINCREMENTED_VALUE13903 13904
+#define BSLS_MACROINCREMENTED_VALUE13904 13905
+#define BSLS_MACROINCREMENTED_VALUE13905 13906
+#define BSLS_MACROINCREMENTED_VALUE13906 13907
+#define BSLS_MACROINCREMENTED_VALUE13907 13908
+#define BSLS_MACROINCREMENTED_VALUE13908 13909
+#define BSLS_MACROINCREMENTED_VALUE13909 13910
+#define BSLS_MACROINCREMENTED_VALUE13910 13911
+#define BSLS_MACROINCREMENTED_VALUE13911 13912
+#define BSLS_MACROINCREMENTED_VALUE13912 13913
+#define BSLS_MACROINCREMENTED_VALUE13913 13914
+#define BSLS_MACROINCREMENTED_VALUE13914 13915
+#define BSLS_MACROINCREMENTED_VALUE13915 13916
+#define BSLS_MACROINCREMENTED_VALUE13916 13917
+#define BSLS_MACROINCREMENTED_VALUE13917 13918
+#define BSLS_MACROINCREMENTED_VALUE13918 13919
+#define BSLS_MACROINCREMENTED_VALUE13919 13920
+#define BSLS_MACROINCREMENTED_VALUE13920 13921
+#define BSLS_MACROINCREMENTED_VALUE13921 13922
+#define BSLS_MACROINCREMENTED_VALUE13922 13923
+#define BSLS_MACROINCREMENTED_VALUE13923 13924
+#define BSLS_MACROINCREMENTED_VALUE13924 13925
+#define BSLS_MACROINCREMENTED_VALUE13925 13926
+#define BSLS_MACROINCREMENTED_VALUE13926 13927
+#define BSLS_MACROINCREMENTED_VALUE13927 13928
+#define BSLS_MACROINCREMENTED_VALUE13928 13929
+#define BSLS_MACROINCREMENTED_VALUE13929 13930
+#define BSLS_MACROINCREMENTED_VALUE13930 13931
+#define BSLS_MACROINCREMENTED_VALUE13931 13932
+#define BSLS_MACROINCREMENTED_VALUE13932 13933
+#define BSLS_MACROINCREMENTED_VALUE13933 13934
+#define BSLS_MACROINCREMENTED_VALUE13934 13935
+#define BSLS_MACROINCREMENTED_VALUE13935 13936
+#define BSLS_MACROINCREMENTED_VALUE13936 13937
+#define BSLS_MACROINCREMENTED_VALUE13937 13938
+#define BSLS_MACROINCREMENTED_VALUE13938 13939
+#define BSLS_MACROINCREMENTED_VALUE13939 13940
+#define BSLS_MACROINCREMENTED_VALUE13940 13941
+#define BSLS_MACROINCREMENTED_VALUE13941 13942
+#define BSLS_MACROINCREMENTED_VALUE13942 13943
+#define BSLS_MACROINCREMENTED_VALUE13943 13944
+#define BSLS_MACROINCREMENTED_VALUE13944 13945
+#define BSLS_MACROINCREMENTED_VALUE13945 13946
+#define BSLS_MACROINCREMENTED_VALUE13946 13947
+#define BSLS_MACROINCREMENTED_VALUE13947 13948
+#define BSLS_MACROINCREMENTED_VALUE13948 13949
+#define BSLS_MACROINCREMENTED_VALUE13949 13950
+#define BSLS_MACROINCREMENTED_VALUE13950 13951
+#define BSLS_MACROINCREMENTED_VALUE13951 13952
+#define BSLS_MACROINCREMENTED_VALUE13952 13953
+#define BSLS_MACROINCREMENTED_VALUE13953 13954
+#define BSLS_MACROINCREMENTED_VALUE13954 13955
+#define BSLS_MACROINCREMENTED_VALUE13955 13956
+#define BSLS_MACROINCREMENTED_VALUE13956 13957
+#define BSLS_MACROINCREMENTED_VALUE13957 13958
+#define BSLS_MACROINCREMENTED_VALUE13958 13959
+#define BSLS_MACROINCREMENTED_VALUE13959 13960
+#define BSLS_MACROINCREMENTED_VALUE13960 13961
+#define BSLS_MACROINCREMENTED_VALUE13961 13962
+#define BSLS_MACROINCREMENTED_VALUE13962 13963
+#define BSLS_MACROINCREMENTED_VALUE13963 13964
+#define BSLS_MACROINCREMENTED_VALUE13964 13965
+#define BSLS_MACROINCREMENTED_VALUE13965 13966
+#define BSLS_MACROINCREMENTED_VALUE13966 13967
+#define BSLS_MACROINCREMENTED_VALUE13967 13968
+#define BSLS_MACROINCREMENTED_VALUE13968 13969
+#define BSLS_MACROINCREMENTED_VALUE13969 13970
+#define BSLS_MACROINCREMENTED_VALUE13970 13971
+#define BSLS_MACROINCREMENTED_VALUE13971 13972
+#define BSLS_MACROINCREMENTED_VALUE13972 13973
+#define BSLS_MACROINCREMENTED_VALUE13973 13974
+#define BSLS_MACROINCREMENTED_VALUE13974 13975
+#define BSLS_MACROINCREMENTED_VALUE13975 13976
+#define BSLS_MACROINCREMENTED_VALUE13976 13977
+#define BSLS_MACROINCREMENTED_VALUE13977 13978
+#define BSLS_MACROINCREMENTED_VALUE13978 13979
+#define BSLS_MACROINCREMENTED_VALUE13979 13980
+#define BSLS_MACROINCREMENTED_VALUE13980 13981
+#define BSLS_MACROINCREMENTED_VALUE13981 13982
+#define BSLS_MACROINCREMENTED_VALUE13982 13983
+#define BSLS_MACROINCREMENTED_VALUE13983 13984
+#define BSLS_MACROINCREMENTED_VALUE13984 13985
+#define BSLS_MACROINCREMENTED_VALUE13985 13986
+#define BSLS_MACROINCREMENTED_VALUE13986 13987
+#define BSLS_MACROINCREMENTED_VALUE13987 13988
+#define BSLS_MACROINCREMENTED_VALUE13988 13989
+#define BSLS_MACROINCREMENTED_VALUE13989 13990
+#define BSLS_MACROINCREMENTED_VALUE13990 13991
+#define BSLS_MACROINCREMENTED_VALUE13991 13992
+#define BSLS_MACROINCREMENTED_VALUE13992 13993
+#define BSLS_MACROINCREMENTED_VALUE13993 13994
+#define BSLS_MACROINCREMENTED_VALUE13994 13995
+#define BSLS_MACROINCREMENTED_VALUE13995 13996
+#define BSLS_MACROINCREMENTED_VALUE13996 13997
+#define BSLS_MACROINCREMENTED_VALUE13997 13998
+#define BSLS_MACROINCREMENTED_VALUE13998 13999
+#define BSLS_MACROINCREMENTED_VALUE13999 14000
+#define BSLS_MACROINCREMENTED_VALUE14000 14001
+#define BSLS_MACROINCREMENTED_VALUE14001 14002
+#define BSLS_MACROINCREMENTED_VALUE14002 14003
+#define BSLS_MACROINCREMENTED_VALUE14003 14004
+#define BSLS_MACROINCREMENTED_VALUE14004 14005
+#define BSLS_MACROINCREMENTED_VALUE14005 14006
+#define BSLS_MACROINCREMENTED_VALUE14006 14007
+#define BSLS_MACROINCREMENTED_VALUE14007 14008
+#define BSLS_MACROINCREMENTED_VALUE14008 14009
+#define BSLS_MACROINCREMENTED_VALUE14009 14010
+#define BSLS_MACROINCREMENTED_VALUE14010 14011
+#define BSLS_MACROINCREMENTED_VALUE14011 14012
+#define BSLS_MACROINCREMENTED_VALUE14012 14013
+#define BSLS_MACROINCREMENTED_VALUE14013 14014
+#define BSLS_MACROINCREMENTED_VALUE14014 14015
+#define BSLS_MACROINCREMENTED_VALUE14015 14016
+#define BSLS_MACROINCREMENTED_VALUE14016 14017
+#define BSLS_MACROINCREMENTED_VALUE14017 14018
+#define BSLS_MACROINCREMENTED_VALUE14018 14019
+#define BSLS_MACROINCREMENTED_VALUE14019 14020
+#define BSLS_MACROINCREMENTED_VALUE14020 14021
+#define BSLS_MACROINCREMENTED_VALUE14021 14022
+#define BSLS_MACROINCREMENTED_VALUE14022 14023
+#define BSLS_MACROINCREMENTED_VALUE14023 14024
+#define BSLS_MACROINCREMENTED_VALUE14024 14025
+#define BSLS_MACROINCREMENTED_VALUE14025 14026
+#define BSLS_MACROINCREMENTED_VALUE14026 14027
+#define BSLS_MACROINCREMENTED_VALUE14027 14028
+#define BSLS_MACROINCREMENTED_VALUE14028 14029
+#define BSLS_MACROINCREMENTED_VALUE14029 14030
+#define BSLS_MACROINCREMENTED_VALUE14030 14031
+#define BSLS_MACROINCREMENTED_VALUE14031 14032
+#define BSLS_MACROINCREMENTED_VALUE14032 14033
+#define BSLS_MACROINCREMENTED_VALUE14033 14034
+#define BSLS_MACROINCREMENTED_VALUE14034 14035
+#define BSLS_MACROINCREMENTED_VALUE14035 14036
+#define BSLS_MACROINCREMENTED_VALUE14036 14037
+#define BSLS_MACROINCREMENTED_VALUE14037 14038
+#define BSLS_MACROINCREMENTED_VALUE14038 14039
+#define BSLS_MACROINCREMENTED_VALUE14039 14040
+#define BSLS_MACROINCREMENTED_VALUE14040 14041
+#define BSLS_MACROINCREMENTED_VALUE14041 14042
+#define BSLS_MACROINCREMENTED_VALUE14042 14043
+#define BSLS_MACROINCREMENTED_VALUE14043 14044
+#define BSLS_MACROINCREMENTED_VALUE14044 14045
+#define BSLS_MACROINCREMENTED_VALUE14045 14046
+#define BSLS_MACROINCREMENTED_VALUE14046 14047
+#define BSLS_MACROINCREMENTED_VALUE14047 14048
+#define BSLS_MACROINCREMENTED_VALUE14048 14049
+#define BSLS_MACROINCREMENTED_VALUE14049 14050
+#define BSLS_MACROINCREMENTED_VALUE14050 14051
+#define BSLS_MACROINCREMENTED_VALUE14051 14052
+#define BSLS_MACROINCREMENTED_VALUE14052 14053
+#define BSLS_MACROINCREMENTED_VALUE14053 14054
+#define BSLS_MACROINCREMENTED_VALUE14054 14055
+#define BSLS_MACROINCREMENTED_VALUE14055 14056
+#define BSLS_MACROINCREMENTED_VALUE14056 14057
+#define BSLS_MACROINCREMENTED_VALUE14057 14058
+#define BSLS_MACROINCREMENTED_VALUE14058 14059
+#define BSLS_MACROINCREMENTED_VALUE14059 14060
+#define BSLS_MACROINCREMENTED_VALUE14060 14061
+#define BSLS_MACROINCREMENTED_VALUE14061 14062
+#define BSLS_MACROINCREMENTED_VALUE14062 14063
+#define BSLS_MACROINCREMENTED_VALUE14063 14064
+#define BSLS_MACROINCREMENTED_VALUE14064 14065
+#define BSLS_MACROINCREMENTED_VALUE14065 14066
+#define BSLS_MACROINCREMENTED_VALUE14066 14067
+#define BSLS_MACROINCREMENTED_VALUE14067 14068
+#define BSLS_MACROINCREMENTED_VALUE14068 14069
+#define BSLS_MACROINCREMENTED_VALUE14069 14070
+#define BSLS_MACROINCREMENTED_VALUE14070 14071
+#define BSLS_MACROINCREMENTED_VALUE14071 14072
+#define BSLS_MACROINCREMENTED_VALUE14072 14073
+#define BSLS_MACROINCREMENTED_VALUE14073 14074
+#define BSLS_MACROINCREMENTED_VALUE14074 14075
+#define BSLS_MACROINCREMENTED_VALUE14075 14076
+#define BSLS_MACROINCREMENTED_VALUE14076 14077
+#define BSLS_MACROINCREMENTED_VALUE14077 14078
+#define BSLS_MACROINCREMENTED_VALUE14078 14079
+#define BSLS_MACROINCREMENTED_VALUE14079 14080
+#define BSLS_MACROINCREMENTED_VALUE14080 14081
+#define BSLS_MACROINCREMENTED_VALUE14081 14082
+#define BSLS_MACROINCREMENTED_VALUE14082 14083
+#define BSLS_MACROINCREMENTED_VALUE14083 14084
+#define BSLS_MACROINCREMENTED_VALUE14084 14085
+#define BSLS_MACROINCREMENTED_VALUE14085 14086
+#define BSLS_MACROINCREMENTED_VALUE14086 14087
+#define BSLS_MACROINCREMENTED_VALUE14087 14088
+#define BSLS_MACROINCREMENTED_VALUE14088 14089
+#define BSLS_MACROINCREMENTED_VALUE14089 14090
+#define BSLS_MACROINCREMENTED_VALUE14090 14091
+#define BSLS_MACROINCREMENTED_VALUE14091 14092
+#define BSLS_MACROINCREMENTED_VALUE14092 14093
+#define BSLS_MACROINCREMENTED_VALUE14093 14094
+#define BSLS_MACROINCREMENTED_VALUE14094 14095
+#define BSLS_MACROINCREMENTED_VALUE14095 14096
+#define BSLS_MACROINCREMENTED_VALUE14096 14097
+#define BSLS_MACROINCREMENTED_VALUE14097 14098
+#define BSLS_MACROINCREMENTED_VALUE14098 14099
+#define BSLS_MACROINCREMENTED_VALUE14099 14100
+#define BSLS_MACROINCREMENTED_VALUE14100 14101
+#define BSLS_MACROINCREMENTED_VALUE14101 14102
+#define BSLS_MACROINCREMENTED_VALUE14102 14103
+#define BSLS_MACROINCREMENTED_VALUE14103 14104
+#define BSLS_MACROINCREMENTED_VALUE14104 14105
+#define BSLS_MACROINCREMENTED_VALUE14105 14106
+#define BSLS_MACROINCREMENTED_VALUE14106 14107
+#define BSLS_MACROINCREMENTED_VALUE14107 14108
+#define BSLS_MACROINCREMENTED_VALUE14108 14109
+#define BSLS_MACROINCREMENTED_VALUE14109 14110
+#define BSLS_MACROINCREMENTED_VALUE14110 14111
+#define BSLS_MACROINCREMENTED_VALUE14111 14112
+#define BSLS_MACROINCREMENTED_VALUE14112 14113
+#define BSLS_MACROINCREMENTED_VALUE14113 14114
+#define BSLS_MACROINCREMENTED_VALUE14114 14115
+#define BSLS_MACROINCREMENTED_VALUE14115 14116
+#define BSLS_MACROINCREMENTED_VALUE14116 14117
+#define BSLS_MACROINCREMENTED_VALUE14117 14118
+#define BSLS_MACROINCREMENTED_VALUE14118 14119
+#define BSLS_MACROINCREMENTED_VALUE14119 14120
+#define BSLS_MACROINCREMENTED_VALUE14120 14121
+#define BSLS_MACROINCREMENTED_VALUE14121 14122
+#define BSLS_MACROINCREMENTED_VALUE14122 14123
+#define BSLS_MACROINCREMENTED_VALUE14123 14124
+#define BSLS_MACROINCREMENTED_VALUE14124 14125
+#define BSLS_MACROINCREMENTED_VALUE14125 14126
+#define BSLS_MACROINCREMENTED_VALUE14126 14127
+#define BSLS_MACROINCREMENTED_VALUE14127 14128
+#define BSLS_MACROINCREMENTED_VALUE14128 14129
+#define BSLS_MACROINCREMENTED_VALUE14129 14130
+#define BSLS_MACROINCREMENTED_VALUE14130 14131
+#define BSLS_MACROINCREMENTED_VALUE14131 14132
+#define BSLS_MACROINCREMENTED_VALUE14132 14133
+#define BSLS_MACROINCREMENTED_VALUE14133 14134
+#define BSLS_MACROINCREMENTED_VALUE14134 14135
+#define BSLS_MACROINCREMENTED_VALUE14135 14136
+#define BSLS_MACROINCREMENTED_VALUE14136 14137
+#define BSLS_MACROINCREMENTED_VALUE14137 14138
+#define BSLS_MACROINCREMENTED_VALUE14138 14139
+#define BSLS_MACROINCREMENTED_VALUE14139 14140
+#define BSLS_MACROINCREMENTED_VALUE14140 14141
+#define BSLS_MACROINCREMENTED_VALUE14141 14142
+#define BSLS_MACROINCREMENTED_VALUE14142 14143
+#define BSLS_MACROINCREMENTED_VALUE14143 14144
+#define BSLS_MACROINCREMENTED_VALUE14144 14145
+#define BSLS_MACROINCREMENTED_VALUE14145 14146
+#define BSLS_MACROINCREMENTED_VALUE14146 14147
+#define BSLS_MACROINCREMENTED_VALUE14147 14148
+#define BSLS_MACROINCREMENTED_VALUE14148 14149
+#define BSLS_MACROINCREMENTED_VALUE14149 14150
+#define BSLS_MACROINCREMENTED_VALUE14150 14151
+#define BSLS_MACROINCREMENTED_VALUE14151 14152
+#define BSLS_MACROINCREMENTED_VALUE14152 14153
+#define BSLS_MACROINCREMENTED_VALUE14153 14154
+#define BSLS_MACROINCREMENTED_VALUE14154 14155
+#define BSLS_MACROINCREMENTED_VALUE14155 14156
+#define BSLS_MACROINCREMENTED_VALUE14156 14157
+#define BSLS_MACROINCREMENTED_VALUE14157 14158
+#define BSLS_MACROINCREMENTED_VALUE14158 14159
+#define BSLS_MACROINCREMENTED_VALUE14159 14160
+#define BSLS_MACROINCREMENTED_VALUE14160 14161
+#define BSLS_MACROINCREMENTED_VALUE14161 14162
+#define BSLS_MACROINCREMENTED_VALUE14162 14163
+#define BSLS_MACROINCREMENTED_VALUE14163 14164
+#define BSLS_MACROINCREMENTED_VALUE14164 14165
+#define BSLS_MACROINCREMENTED_VALUE14165 14166
+#define BSLS_MACROINCREMENTED_VALUE14166 14167
+#define BSLS_MACROINCREMENTED_VALUE14167 14168
+#define BSLS_MACROINCREMENTED_VALUE14168 14169
+#define BSLS_MACROINCREMENTED_VALUE14169 14170
+#define BSLS_MACROINCREMENTED_VALUE14170 14171
+#define BSLS_MACROINCREMENTED_VALUE14171 14172
+#define BSLS_MACROINCREMENTED_VALUE14172 14173
+#define BSLS_MACROINCREMENTED_VALUE14173 14174
+#define BSLS_MACROINCREMENTED_VALUE14174 14175
+#define BSLS_MACROINCREMENTED_VALUE14175 14176
+#define BSLS_MACROINCREMENTED_VALUE14176 14177
+#define BSLS_MACROINCREMENTED_VALUE14177 14178
+#define BSLS_MACROINCREMENTED_VALUE14178 14179
+#define BSLS_MACROINCREMENTED_VALUE14179 14180
+#define BSLS_MACROINCREMENTED_VALUE14180 14181
+#define BSLS_MACROINCREMENTED_VALUE14181 14182
+#define BSLS_MACROINCREMENTED_VALUE14182 14183
+#define BSLS_MACROINCREMENTED_VALUE14183 14184
+#define BSLS_MACROINCREMENTED_VALUE14184 14185
+#define BSLS_MACROINCREMENTED_VALUE14185 14186
+#define BSLS_MACROINCREMENTED_VALUE14186 14187
+#define BSLS_MACROINCREMENTED_VALUE14187 14188
+#define BSLS_MACROINCREMENTED_VALUE14188 14189
+#define BSLS_MACROINCREMENTED_VALUE14189 14190
+#define BSLS_MACROINCREMENTED_VALUE14190 14191
+#define BSLS_MACROINCREMENTED_VALUE14191 14192
+#define BSLS_MACROINCREMENTED_VALUE14192 14193
+#define BSLS_MACROINCREMENTED_VALUE14193 14194
+#define BSLS_MACROINCREMENTED_VALUE14194 14195
+#define BSLS_MACROINCREMENTED_VALUE14195 14196
+#define BSLS_MACROINCREMENTED_VALUE14196 14197
+#define BSLS_MACROINCREMENTED_VALUE14197 14198
+#define BSLS_MACROINCREMENTED_VALUE14198 14199
+#define BSLS_MACROINCREMENTED_VALUE14199 14200
+#define BSLS_MACROINCREMENTED_VALUE14200 14201
+#define BSLS_MACROINCREMENTED_VALUE14201 14202
+#define BSLS_MACROINCREMENTED_VALUE14202 14203
+#define BSLS_MACROINCREMENTED_VALUE14203 14204
+#define BSLS_MACROINCREMENTED_VALUE14204 14205
+#define BSLS_MACROINCREMENTED_VALUE14205 14206
+#define BSLS_MACROINCREMENTED_VALUE14206 14207
+#define BSLS_MACROINCREMENTED_VALUE14207 14208
+#define BSLS_MACROINCREMENTED_VALUE14208 14209
+#define BSLS_MACROINCREMENTED_VALUE14209 14210
+#define BSLS_MACROINCREMENTED_VALUE14210 14211
+#define BSLS_MACROINCREMENTED_VALUE14211 14212
+#define BSLS_MACROINCREMENTED_VALUE14212 14213
+#define BSLS_MACROINCREMENTED_VALUE14213 14214
+#define BSLS_MACROINCREMENTED_VALUE14214 14215
+#define BSLS_MACROINCREMENTED_VALUE14215 14216
+#define BSLS_MACROINCREMENTED_VALUE14216 14217
+#define BSLS_MACROINCREMENTED_VALUE14217 14218
+#define BSLS_MACROINCREMENTED_VALUE14218 14219
+#define BSLS_MACROINCREMENTED_VALUE14219 14220
+#define BSLS_MACROINCREMENTED_VALUE14220 14221
+#define BSLS_MACROINCREMENTED_VALUE14221 14222
+#define BSLS_MACROINCREMENTED_VALUE14222 14223
+#define BSLS_MACROINCREMENTED_VALUE14223 14224
+#define BSLS_MACROINCREMENTED_VALUE14224 14225
+#define BSLS_MACROINCREMENTED_VALUE14225 14226
+#define BSLS_MACROINCREMENTED_VALUE14226 14227
+#define BSLS_MACROINCREMENTED_VALUE14227 14228
+#define BSLS_MACROINCREMENTED_VALUE14228 14229
+#define BSLS_MACROINCREMENTED_VALUE14229 14230
+#define BSLS_MACROINCREMENTED_VALUE14230 14231
+#define BSLS_MACROINCREMENTED_VALUE14231 14232
+#define BSLS_MACROINCREMENTED_VALUE14232 14233
+#define BSLS_MACROINCREMENTED_VALUE14233 14234
+#define BSLS_MACROINCREMENTED_VALUE14234 14235
+#define BSLS_MACROINCREMENTED_VALUE14235 14236
+#define BSLS_MACROINCREMENTED_VALUE14236 14237
+#define BSLS_MACROINCREMENTED_VALUE14237 14238
+#define BSLS_MACROINCREMENTED_VALUE14238 14239
+#define BSLS_MACROINCREMENTED_VALUE14239 14240
+#define BSLS_MACROINCREMENTED_VALUE14240 14241
+#define BSLS_MACROINCREMENTED_VALUE14241 14242
+#define BSLS_MACROINCREMENTED_VALUE14242 14243
+#define BSLS_MACROINCREMENTED_VALUE14243 14244
+#define BSLS_MACROINCREMENTED_VALUE14244 14245
+#define BSLS_MACROINCREMENTED_VALUE14245 14246
+#define BSLS_MACROINCREMENTED_VALUE14246 14247
+#define BSLS_MACROINCREMENTED_VALUE14247 14248
+#define BSLS_MACROINCREMENTED_VALUE14248 14249
+#define BSLS_MACROINCREMENTED_VALUE14249 14250
+#define BSLS_MACROINCREMENTED_VALUE14250 14251
+#define BSLS_MACROINCREMENTED_VALUE14251 14252
+#define BSLS_MACROINCREMENTED_VALUE14252 14253
+#define BSLS_MACROINCREMENTED_VALUE14253 14254
+#define BSLS_MACROINCREMENTED_VALUE14254 14255
+#define BSLS_MACROINCREMENTED_VALUE14255 14256
+#define BSLS_MACROINCREMENTED_VALUE14256 14257
+#define BSLS_MACROINCREMENTED_VALUE14257 14258
+#define BSLS_MACROINCREMENTED_VALUE14258 14259
+#define BSLS_MACROINCREMENTED_VALUE14259 14260
+#define BSLS_MACROINCREMENTED_VALUE14260 14261
+#define BSLS_MACROINCREMENTED_VALUE14261 14262
+#define BSLS_MACROINCREMENTED_VALUE14262 14263
+#define BSLS_MACROINCREMENTED_VALUE14263 14264
+#define BSLS_MACROINCREMENTED_VALUE14264 14265
+#define BSLS_MACROINCREMENTED_VALUE14265 14266
+#define BSLS_MACROINCREMENTED_VALUE14266 14267
+#define BSLS_MACROINCREMENTED_VALUE14267 14268
+#define BSLS_MACROINCREMENTED_VALUE14268 14269
+#define BSLS_MACROINCREMENTED_VALUE14269 14270
+#define BSLS_MACROINCREMENTED_VALUE14270 14271
+#define BSLS_MACROINCREMENTED_VALUE14271 14272
+#define BSLS_MACROINCREMENTED_VALUE14272 14273
+#define BSLS_MACROINCREMENTED_VALUE14273 14274
+#define BSLS_MACROINCREMENTED_VALUE14274 14275
+#define BSLS_MACROINCREMENTED_VALUE14275 14276
+#define BSLS_MACROINCREMENTED_VALUE14276 14277
+#define BSLS_MACROINCREMENTED_VALUE14277 14278
+#define BSLS_MACROINCREMENTED_VALUE14278 14279
+#define BSLS_MACROINCREMENTED_VALUE14279 14280
+#define BSLS_MACROINCREMENTED_VALUE14280 14281
+#define BSLS_MACROINCREMENTED_VALUE14281 14282
+#define BSLS_MACROINCREMENTED_VALUE14282 14283
+#define BSLS_MACROINCREMENTED_VALUE14283 14284
+#define BSLS_MACROINCREMENTED_VALUE14284 14285
+#define BSLS_MACROINCREMENTED_VALUE14285 14286
+#define BSLS_MACROINCREMENTED_VALUE14286 14287
+#define BSLS_MACROINCREMENTED_VALUE14287 14288
+#define BSLS_MACROINCREMENTED_VALUE14288 14289
+#define BSLS_MACROINCREMENTED_VALUE14289 14290
+#define BSLS_MACROINCREMENTED_VALUE14290 14291
+#define BSLS_MACROINCREMENTED_VALUE14291 14292
+#define BSLS_MACROINCREMENTED_VALUE14292 14293
+#define BSLS_MACROINCREMENTED_VALUE14293 14294
+#define BSLS_MACROINCREMENTED_VALUE14294 14295
+#define BSLS_MACROINCREMENTED_VALUE14295 14296
+#define BSLS_MACROINCREMENTED_VALUE14296 14297
+#define BSLS_MACROINCREMENTED_VALUE14297 14298
+#define BSLS_MACROINCREMENTED_VALUE14298 14299
+#define BSLS_MACROINCREMENTED_VALUE14299 14300
+#define BSLS_MACROINCREMENTED_VALUE14300 14301
+#define BSLS_MACROINCREMENTED_VALUE14301 14302
+#define BSLS_MACROINCREMENTED_VALUE14302 14303
+#define BSLS_MACROINCREMENTED_VALUE14303 14304
+#define BSLS_MACROINCREMENTED_VALUE14304 14305
+#define BSLS_MACROINCREMENTED_VALUE14305 14306
+#define BSLS_MACROINCREMENTED_VALUE14306 14307
+#define BSLS_MACROINCREMENTED_VALUE14307 14308
+#define BSLS_MACROINCREMENTED_VALUE14308 14309
+#define BSLS_MACROINCREMENTED_VALUE14309 14310
+#define BSLS_MACROINCREMENTED_VALUE14310 14311
+#define BSLS_MACROINCREMENTED_VALUE14311 14312
+#define BSLS_MACROINCREMENTED_VALUE14312 14313
+#define BSLS_MACROINCREMENTED_VALUE14313 14314
+#define BSLS_MACROINCREMENTED_VALUE14314 14315
+#define BSLS_MACROINCREMENTED_VALUE14315 14316
+#define BSLS_MACROINCREMENTED_VALUE14316 14317
+#define BSLS_MACROINCREMENTED_VALUE14317 14318
+#define BSLS_MACROINCREMENTED_VALUE14318 14319
+#define BSLS_MACROINCREMENTED_VALUE14319 14320
+#define BSLS_MACROINCREMENTED_VALUE14320 14321
+#define BSLS_MACROINCREMENTED_VALUE14321 14322
+#define BSLS_MACROINCREMENTED_VALUE14322 14323
+#define BSLS_MACROINCREMENTED_VALUE14323 14324
+#define BSLS_MACROINCREMENTED_VALUE14324 14325
+#define BSLS_MACROINCREMENTED_VALUE14325 14326
+#define BSLS_MACROINCREMENTED_VALUE14326 14327
+#define BSLS_MACROINCREMENTED_VALUE14327 14328
+#define BSLS_MACROINCREMENTED_VALUE14328 14329
+#define BSLS_MACROINCREMENTED_VALUE14329 14330
+#define BSLS_MACROINCREMENTED_VALUE14330 14331
+#define BSLS_MACROINCREMENTED_VALUE14331 14332
+#define BSLS_MACROINCREMENTED_VALUE14332 14333
+#define BSLS_MACROINCREMENTED_VALUE14333 14334
+#define BSLS_MACROINCREMENTED_VALUE14334 14335
+#define BSLS_MACROINCREMENTED_VALUE14335 14336
+#define BSLS_MACROINCREMENTED_VALUE14336 14337
+#define BSLS_MACROINCREMENTED_VALUE14337 14338
+#define BSLS_MACROINCREMENTED_VALUE14338 14339
+#define BSLS_MACROINCREMENTED_VALUE14339 14340
+#define BSLS_MACROINCREMENTED_VALUE14340 14341
+#define BSLS_MACROINCREMENTED_VALUE14341 14342
+#define BSLS_MACROINCREMENTED_VALUE14342 14343
+#define BSLS_MACROINCREMENTED_VALUE14343 14344
+#define BSLS_MACROINCREMENTED_VALUE14344 14345
+#define BSLS_MACROINCREMENTED_VALUE14345 14346
+#define BSLS_MACROINCREMENTED_VALUE14346 14347
+#define BSLS_MACROINCREMENTED_VALUE14347 14348
+#define BSLS_MACROINCREMENTED_VALUE14348 14349
+#define BSLS_MACROINCREMENTED_VALUE14349 14350
+#define BSLS_MACROINCREMENTED_VALUE14350 14351
+#define BSLS_MACROINCREMENTED_VALUE14351 14352
+#define BSLS_MACROINCREMENTED_VALUE14352 14353
+#define BSLS_MACROINCREMENTED_VALUE14353 14354
+#define BSLS_MACROINCREMENTED_VALUE14354 14355
+#define BSLS_MACROINCREMENTED_VALUE14355 14356
+#define BSLS_MACROINCREMENTED_VALUE14356 14357
+#define BSLS_MACROINCREMENTED_VALUE14357 14358
+#define BSLS_MACROINCREMENTED_VALUE14358 14359
+#define BSLS_MACROINCREMENTED_VALUE14359 14360
+#define BSLS_MACROINCREMENTED_VALUE14360 14361
+#define BSLS_MACROINCREMENTED_VALUE14361 14362
+#define BSLS_MACROINCREMENTED_VALUE14362 14363
+#define BSLS_MACROINCREMENTED_VALUE14363 14364
+#define BSLS_MACROINCREMENTED_VALUE14364 14365
+#define BSLS_MACROINCREMENTED_VALUE14365 14366
+#define BSLS_MACROINCREMENTED_VALUE14366 14367
+#define BSLS_MACROINCREMENTED_VALUE14367 14368
+#define BSLS_MACROINCREMENTED_VALUE14368 14369
+#define BSLS_MACROINCREMENTED_VALUE14369 14370
+#define BSLS_MACROINCREMENTED_VALUE14370 14371
+#define BSLS_MACROINCREMENTED_VALUE14371 14372
+#define BSLS_MACROINCREMENTED_VALUE14372 14373
+#define BSLS_MACROINCREMENTED_VALUE14373 14374
+#define BSLS_MACROINCREMENTED_VALUE14374 14375
+#define BSLS_MACROINCREMENTED_VALUE14375 14376
+#define BSLS_MACROINCREMENTED_VALUE14376 14377
+#define BSLS_MACROINCREMENTED_VALUE14377 14378
+#define BSLS_MACROINCREMENTED_VALUE14378 14379
+#define BSLS_MACROINCREMENTED_VALUE14379 14380
+#define BSLS_MACROINCREMENTED_VALUE14380 14381
+#define BSLS_MACROINCREMENTED_VALUE14381 14382
+#define BSLS_MACROINCREMENTED_VALUE14382 14383
+#define BSLS_MACROINCREMENTED_VALUE14383 14384
+#define BSLS_MACROINCREMENTED_VALUE14384 14385
+#define BSLS_MACROINCREMENTED_VALUE14385 14386
+#define BSLS_MACROINCREMENTED_VALUE14386 14387
+#define BSLS_MACROINCREMENTED_VALUE14387 14388
+#define BSLS_MACROINCREMENTED_VALUE14388 14389
+#define BSLS_MACROINCREMENTED_VALUE14389 14390
+#define BSLS_MACROINCREMENTED_VALUE14390 14391
+#define BSLS_MACROINCREMENTED_VALUE14391 14392
+#define BSLS_MACROINCREMENTED_VALUE14392 14393
+#define BSLS_MACROINCREMENTED_VALUE14393 14394
+#define BSLS_MACROINCREMENTED_VALUE14394 14395
+#define BSLS_MACROINCREMENTED_VALUE14395 14396
+#define BSLS_MACROINCREMENTED_VALUE14396 14397
+#define BSLS_MACROINCREMENTED_VALUE14397 14398
+#define BSLS_MACROINCREMENTED_VALUE14398 14399
+#define BSLS_MACROINCREMENTED_VALUE14399 14400
+#define BSLS_MACROINCREMENTED_VALUE14400 14401
+#define BSLS_MACROINCREMENTED_VALUE14401 14402
+#define BSLS_MACROINCREMENTED_VALUE14402 14403
+#define BSLS_MACROINCREMENTED_VALUE14403 14404
+#define BSLS_MACROINCREMENTED_VALUE14404 14405
+#define BSLS_MACROINCREMENTED_VALUE14405 14406
+#define BSLS_MACROINCREMENTED_VALUE14406 14407
+#define BSLS_MACROINCREMENTED_VALUE14407 14408
+#define BSLS_MACROINCREMENTED_VALUE14408 14409
+#define BSLS_MACROINCREMENTED_VALUE14409 14410
+#define BSLS_MACROINCREMENTED_VALUE14410 14411
+#define BSLS_MACROINCREMENTED_VALUE14411 14412
+#define BSLS_MACROINCREMENTED_VALUE14412 14413
+#define BSLS_MACROINCREMENTED_VALUE14413 14414
+#define BSLS_MACROINCREMENTED_VALUE14414 14415
+#define BSLS_MACROINCREMENTED_VALUE14415 14416
+#define BSLS_MACROINCREMENTED_VALUE14416 14417
+#define BSLS_MACROINCREMENTED_VALUE14417 14418
+#define BSLS_MACROINCREMENTED_VALUE14418 14419
+#define BSLS_MACROINCREMENTED_VALUE14419 14420
+#define BSLS_MACROINCREMENTED_VALUE14420 14421
+#define BSLS_MACROINCREMENTED_VALUE14421 14422
+#define BSLS_MACROINCREMENTED_VALUE14422 14423
+#define BSLS_MACROINCREMENTED_VALUE14423 14424
+#define BSLS_MACROINCREMENTED_VALUE14424 14425
+#define BSLS_MACROINCREMENTED_VALUE14425 14426
+#define BSLS_MACROINCREMENTED_VALUE14426 14427
+#define BSLS_MACROINCREMENTED_VALUE14427 14428
+#define BSLS_MACROINCREMENTED_VALUE14428 14429
+#define BSLS_MACROINCREMENTED_VALUE14429 14430
+#define BSLS_MACROINCREMENTED_VALUE14430 14431
+#define BSLS_MACROINCREMENTED_VALUE14431 14432
+#define BSLS_MACROINCREMENTED_VALUE14432 14433
+#define BSLS_MACROINCREMENTED_VALUE14433 14434
+#define BSLS_MACROINCREMENTED_VALUE14434 14435
+#define BSLS_MACROINCREMENTED_VALUE14435 14436
+#define BSLS_MACROINCREMENTED_VALUE14436 14437
+#define BSLS_MACROINCREMENTED_VALUE14437 14438
+#define BSLS_MACROINCREMENTED_VALUE14438 14439
+#define BSLS_MACROINCREMENTED_VALUE14439 14440
+#define BSLS_MACROINCREMENTED_VALUE14440 14441
+#define BSLS_MACROINCREMENTED_VALUE14441 14442
+#define BSLS_MACROINCREMENTED_VALUE14442 14443
+#define BSLS_MACROINCREMENTED_VALUE14443 14444
+#define BSLS_MACROINCREMENTED_VALUE14444 14445
+#define BSLS_MACROINCREMENTED_VALUE14445 14446
+#define BSLS_MACROINCREMENTED_VALUE14446 14447
+#define BSLS_MACROINCREMENTED_VALUE14447 14448
+#define BSLS_MACROINCREMENTED_VALUE14448 14449
+#define BSLS_MACROINCREMENTED_VALUE14449 14450
+#define BSLS_MACROINCREMENTED_VALUE14450 14451
+#define BSLS_MACROINCREMENTED_VALUE14451 14452
+#define BSLS_MACROINCREMENTED_VALUE14452 14453
+#define BSLS_MACROINCREMENTED_VALUE14453 14454
+#define BSLS_MACROINCREMENTED_VALUE14454 14455
+#define BSLS_MACROINCREMENTED_VALUE14455 14456
+#define BSLS_MACROINCREMENTED_VALUE14456 14457
+#define BSLS_MACROINCREMENTED_VALUE14457 14458
+#define BSLS_MACROINCREMENTED_VALUE14458 14459
+#define BSLS_MACROINCREMENTED_VALUE14459 14460
+#define BSLS_MACROINCREMENTED_VALUE14460 14461
+#define BSLS_MACROINCREMENTED_VALUE14461 14462
+#define BSLS_MACROINCREMENTED_VALUE14462 14463
+#define BSLS_MACROINCREMENTED_VALUE14463 14464
+#define BSLS_MACROINCREMENTED_VALUE14464 14465
+#define BSLS_MACROINCREMENTED_VALUE14465 14466
+#define BSLS_MACROINCREMENTED_VALUE14466 14467
+#define BSLS_MACROINCREMENTED_VALUE14467 14468
+#define BSLS_MACROINCREMENTED_VALUE14468 14469
+#define BSLS_MACROINCREMENTED_VALUE14469 14470
+#define BSLS_MACROINCREMENTED_VALUE14470 14471
+#define BSLS_MACROINCREMENTED_VALUE14471 14472
+#define BSLS_MACROINCREMENTED_VALUE14472 14473
+#define BSLS_MACROINCREMENTED_VALUE14473 14474
+#define BSLS_MACROINCREMENTED_VALUE14474 14475
+#define BSLS_MACROINCREMENTED_VALUE14475 14476
+#define BSLS_MACROINCREMENTED_VALUE14476 14477
+#define BSLS_MACROINCREMENTED_VALUE14477 14478
+#define BSLS_MACROINCREMENTED_VALUE14478 14479
+#define BSLS_MACROINCREMENTED_VALUE14479 14480
+#define BSLS_MACROINCREMENTED_VALUE14480 14481
+#define BSLS_MACROINCREMENTED_VALUE14481 14482
+#define BSLS_MACROINCREMENTED_VALUE14482 14483
+#define BSLS_MACROINCREMENTED_VALUE14483 14484
+#define BSLS_MACROINCREMENTED_VALUE14484 14485
+#define BSLS_MACROINCREMENTED_VALUE14485 14486
+#define BSLS_MACROINCREMENTED_VALUE14486 14487
+#define BSLS_MACROINCREMENTED_VALUE14487 14488
+#define BSLS_MACROINCREMENTED_VALUE14488 14489
+#define BSLS_MACROINCREMENTED_VALUE14489 14490
+#define BSLS_MACROINCREMENTED_VALUE14490 14491
+#define BSLS_MACROINCREMENTED_VALUE14491 14492
+#define BSLS_MACROINCREMENTED_VALUE14492 14493
+#define BSLS_MACROINCREMENTED_VALUE14493 14494
+#define BSLS_MACROINCREMENTED_VALUE14494 14495
+#define BSLS_MACROINCREMENTED_VALUE14495 14496
+#define BSLS_MACROINCREMENTED_VALUE14496 14497
+#define BSLS_MACROINCREMENTED_VALUE14497 14498
+#define BSLS_MACROINCREMENTED_VALUE14498 14499
+#define BSLS_MACROINCREMENTED_VALUE14499 14500
+#define BSLS_MACROINCREMENTED_VALUE14500 14501
+#define BSLS_MACROINCREMENTED_VALUE14501 14502
+#define BSLS_MACROINCREMENTED_VALUE14502 14503
+#define BSLS_MACROINCREMENTED_VALUE14503 14504
+#define BSLS_MACROINCREMENTED_VALUE14504 14505
+#define BSLS_MACROINCREMENTED_VALUE14505 14506
+#define BSLS_MACROINCREMENTED_VALUE14506 14507
+#define BSLS_MACROINCREMENTED_VALUE14507 14508
+#define BSLS_MACROINCREMENTED_VALUE14508 14509
+#define BSLS_MACROINCREMENTED_VALUE14509 14510
+#define BSLS_MACROINCREMENTED_VALUE14510 14511
+#define BSLS_MACROINCREMENTED_VALUE14511 14512
+#define BSLS_MACROINCREMENTED_VALUE14512 14513
+#define BSLS_MACROINCREMENTED_VALUE14513 14514
+#define BSLS_MACROINCREMENTED_VALUE14514 14515
+#define BSLS_MACROINCREMENTED_VALUE14515 14516
+#define BSLS_MACROINCREMENTED_VALUE14516 14517
+#define BSLS_MACROINCREMENTED_VALUE14517 14518
+#define BSLS_MACROINCREMENTED_VALUE14518 14519
+#define BSLS_MACROINCREMENTED_VALUE14519 14520
+#define BSLS_MACROINCREMENTED_VALUE14520 14521
+#define BSLS_MACROINCREMENTED_VALUE14521 14522
+#define BSLS_MACROINCREMENTED_VALUE14522 14523
+#define BSLS_MACROINCREMENTED_VALUE14523 14524
+#define BSLS_MACROINCREMENTED_VALUE14524 14525
+#define BSLS_MACROINCREMENTED_VALUE14525 14526
+#define BSLS_MACROINCREMENTED_VALUE14526 14527
+#define BSLS_MACROINCREMENTED_VALUE14527 14528
+#define BSLS_MACROINCREMENTED_VALUE14528 14529
+#define BSLS_MACROINCREMENTED_VALUE14529 14530
+#define BSLS_MACROINCREMENTED_VALUE14530 14531
+#define BSLS_MACROINCREMENTED_VALUE14531 14532
+#define BSLS_MACROINCREMENTED_VALUE14532 14533
+#define BSLS_MACROINCREMENTED_VALUE14533 14534
+#define BSLS_MACROINCREMENTED_VALUE14534 14535
+#define BSLS_MACROINCREMENTED_VALUE14535 14536
+#define BSLS_MACROINCREMENTED_VALUE14536 14537
+#define BSLS_MACROINCREMENTED_VALUE14537 14538
+#define BSLS_MACROINCREMENTED_VALUE14538 14539
+#define BSLS_MACROINCREMENTED_VALUE14539 14540
+#define BSLS_MACROINCREMENTED_VALUE14540 14541
+#define BSLS_MACROINCREMENTED_VALUE14541 14542
+#define BSLS_MACROINCREMENTED_VALUE14542 14543
+#define BSLS_MACROINCREMENTED_VALUE14543 14544
+#define BSLS_MACROINCREMENTED_VALUE14544 14545
+#define BSLS_MACROINCREMENTED_VALUE14545 14546
+#define BSLS_MACROINCREMENTED_VALUE14546 14547
+#define BSLS_MACROINCREMENTED_VALUE14547 14548
+#define BSLS_MACROINCREMENTED_VALUE14548 14549
+#define BSLS_MACROINCREMENTED_VALUE14549 14550
+#define BSLS_MACROINCREMENTED_VALUE14550 14551
+#define BSLS_MACROINCREMENTED_VALUE14551 14552
+#define BSLS_MACROINCREMENTED_VALUE14552 14553
+#define BSLS_MACROINCREMENTED_VALUE14553 14554
+#define BSLS_MACROINCREMENTED_VALUE14554 14555
+#define BSLS_MACROINCREMENTED_VALUE14555 14556
+#define BSLS_MACROINCREMENTED_VALUE14556 14557
+#define BSLS_MACROINCREMENTED_VALUE14557 14558
+#define BSLS_MACROINCREMENTED_VALUE14558 14559
+#define BSLS_MACROINCREMENTED_VALUE14559 14560
+#define BSLS_MACROINCREMENTED_VALUE14560 14561
+#define BSLS_MACROINCREMENTED_VALUE14561 14562
+#define BSLS_MACROINCREMENTED_VALUE14562 14563
+#define BSLS_MACROINCREMENTED_VALUE14563 14564
+#define BSLS_MACROINCREMENTED_VALUE14564 14565
+#define BSLS_MACROINCREMENTED_VALUE14565 14566
+#define BSLS_MACROINCREMENTED_VALUE14566 14567
+#define BSLS_MACROINCREMENTED_VALUE14567 14568
+#define BSLS_MACROINCREMENTED_VALUE14568 14569
+#define BSLS_MACROINCREMENTED_VALUE14569 14570
+#define BSLS_MACROINCREMENTED_VALUE14570 14571
+#define BSLS_MACROINCREMENTED_VALUE14571 14572
+#define BSLS_MACROINCREMENTED_VALUE14572 14573
+#define BSLS_MACROINCREMENTED_VALUE14573 14574
+#define BSLS_MACROINCREMENTED_VALUE14574 14575
+#define BSLS_MACROINCREMENTED_VALUE14575 14576
+#define BSLS_MACROINCREMENTED_VALUE14576 14577
+#define BSLS_MACROINCREMENTED_VALUE14577 14578
+#define BSLS_MACROINCREMENTED_VALUE14578 14579
+#define BSLS_MACROINCREMENTED_VALUE14579 14580
+#define BSLS_MACROINCREMENTED_VALUE14580 14581
+#define BSLS_MACROINCREMENTED_VALUE14581 14582
+#define BSLS_MACROINCREMENTED_VALUE14582 14583
+#define BSLS_MACROINCREMENTED_VALUE14583 14584
+#define BSLS_MACROINCREMENTED_VALUE14584 14585
+#define BSLS_MACROINCREMENTED_VALUE14585 14586
+#define BSLS_MACROINCREMENTED_VALUE14586 14587
+#define BSLS_MACROINCREMENTED_VALUE14587 14588
+#define BSLS_MACROINCREMENTED_VALUE14588 14589
+#define BSLS_MACROINCREMENTED_VALUE14589 14590
+#define BSLS_MACROINCREMENTED_VALUE14590 14591
+#define BSLS_MACROINCREMENTED_VALUE14591 14592
+#define BSLS_MACROINCREMENTED_VALUE14592 14593
+#define BSLS_MACROINCREMENTED_VALUE14593 14594
+#define BSLS_MACROINCREMENTED_VALUE14594 14595
+#define BSLS_MACROINCREMENTED_VALUE14595 14596
+#define BSLS_MACROINCREMENTED_VALUE14596 14597
+#define BSLS_MACROINCREMENTED_VALUE14597 14598
+#define BSLS_MACROINCREMENTED_VALUE14598 14599
+#define BSLS_MACROINCREMENTED_VALUE14599 14600
+#define BSLS_MACROINCREMENTED_VALUE14600 14601
+#define BSLS_MACROINCREMENTED_VALUE14601 14602
+#define BSLS_MACROINCREMENTED_VALUE14602 14603
+#define BSLS_MACROINCREMENTED_VALUE14603 14604
+#define BSLS_MACROINCREMENTED_VALUE14604 14605
+#define BSLS_MACROINCREMENTED_VALUE14605 14606
+#define BSLS_MACROINCREMENTED_VALUE14606 14607
+#define BSLS_MACROINCREMENTED_VALUE14607 14608
+#define BSLS_MACROINCREMENTED_VALUE14608 14609
+#define BSLS_MACROINCREMENTED_VALUE14609 14610
+#define BSLS_MACROINCREMENTED_VALUE14610 14611
+#define BSLS_MACROINCREMENTED_VALUE14611 14612
+#define BSLS_MACROINCREMENTED_VALUE14612 14613
+#define BSLS_MACROINCREMENTED_VALUE14613 14614
+#define BSLS_MACROINCREMENTED_VALUE14614 14615
+#define BSLS_MACROINCREMENTED_VALUE14615 14616
+#define BSLS_MACROINCREMENTED_VALUE14616 14617
+#define BSLS_MACROINCREMENTED_VALUE14617 14618
+#define BSLS_MACROINCREMENTED_VALUE14618 14619
+#define BSLS_MACROINCREMENTED_VALUE14619 14620
+#define BSLS_MACROINCREMENTED_VALUE14620 14621
+#define BSLS_MACROINCREMENTED_VALUE14621 14622
+#define BSLS_MACROINCREMENTED_VALUE14622 14623
+#define BSLS_MACROINCREMENTED_VALUE14623 14624
+#define BSLS_MACROINCREMENTED_VALUE14624 14625
+#define BSLS_MACROINCREMENTED_VALUE14625 14626
+#define BSLS_MACROINCREMENTED_VALUE14626 14627
+#define BSLS_MACROINCREMENTED_VALUE14627 14628
+#define BSLS_MACROINCREMENTED_VALUE14628 14629
+#define BSLS_MACROINCREMENTED_VALUE14629 14630
+#define BSLS_MACROINCREMENTED_VALUE14630 14631
+#define BSLS_MACROINCREMENTED_VALUE14631 14632
+#define BSLS_MACROINCREMENTED_VALUE14632 14633
+#define BSLS_MACROINCREMENTED_VALUE14633 14634
+#define BSLS_MACROINCREMENTED_VALUE14634 14635
+#define BSLS_MACROINCREMENTED_VALUE14635 14636
+#define BSLS_MACROINCREMENTED_VALUE14636 14637
+#define BSLS_MACROINCREMENTED_VALUE14637 14638
+#define BSLS_MACROINCREMENTED_VALUE14638 14639
+#define BSLS_MACROINCREMENTED_VALUE14639 14640
+#define BSLS_MACROINCREMENTED_VALUE14640 14641
+#define BSLS_MACROINCREMENTED_VALUE14641 14642
+#define BSLS_MACROINCREMENTED_VALUE14642 14643
+#define BSLS_MACROINCREMENTED_VALUE14643 14644
+#define BSLS_MACROINCREMENTED_VALUE14644 14645
+#define BSLS_MACROINCREMENTED_VALUE14645 14646
+#define BSLS_MACROINCREMENTED_VALUE14646 14647
+#define BSLS_MACROINCREMENTED_VALUE14647 14648
+#define BSLS_MACROINCREMENTED_VALUE14648 14649
+#define BSLS_MACROINCREMENTED_VALUE14649 14650
+#define BSLS_MACROINCREMENTED_VALUE14650 14651
+#define BSLS_MACROINCREMENTED_VALUE14651 14652
+#define BSLS_MACROINCREMENTED_VALUE14652 14653
+#define BSLS_MACROINCREMENTED_VALUE14653 14654
+#define BSLS_MACROINCREMENTED_VALUE14654 14655
+#define BSLS_MACROINCREMENTED_VALUE14655 14656
+#define BSLS_MACROINCREMENTED_VALUE14656 14657
+#define BSLS_MACROINCREMENTED_VALUE14657 14658
+#define BSLS_MACROINCREMENTED_VALUE14658 14659
+#define BSLS_MACROINCREMENTED_VALUE14659 14660
+#define BSLS_MACROINCREMENTED_VALUE14660 14661
+#define BSLS_MACROINCREMENTED_VALUE14661 14662
+#define BSLS_MACROINCREMENTED_VALUE14662 14663
+#define BSLS_MACROINCREMENTED_VALUE14663 14664
+#define BSLS_MACROINCREMENTED_VALUE14664 14665
+#define BSLS_MACROINCREMENTED_VALUE14665 14666
+#define BSLS_MACROINCREMENTED_VALUE14666 14667
+#define BSLS_MACROINCREMENTED_VALUE14667 14668
+#define BSLS_MACROINCREMENTED_VALUE14668 14669
+#define BSLS_MACROINCREMENTED_VALUE14669 14670
+#define BSLS_MACROINCREMENTED_VALUE14670 14671
+#define BSLS_MACROINCREMENTED_VALUE14671 14672
+#define BSLS_MACROINCREMENTED_VALUE14672 14673
+#define BSLS_MACROINCREMENTED_VALUE14673 14674
+#define BSLS_MACROINCREMENTED_VALUE14674 14675
+#define BSLS_MACROINCREMENTED_VALUE14675 14676
+#define BSLS_MACROINCREMENTED_VALUE14676 14677
+#define BSLS_MACROINCREMENTED_VALUE14677 14678
+#define BSLS_MACROINCREMENTED_VALUE14678 14679
+#define BSLS_MACROINCREMENTED_VALUE14679 14680
+#define BSLS_MACROINCREMENTED_VALUE14680 14681
+#define BSLS_MACROINCREMENTED_VALUE14681 14682
+#define BSLS_MACROINCREMENTED_VALUE14682 14683
+#define BSLS_MACROINCREMENTED_VALUE14683 14684
+#define BSLS_MACROINCREMENTED_VALUE14684 14685
+#define BSLS_MACROINCREMENTED_VALUE14685 14686
+#define BSLS_MACROINCREMENTED_VALUE14686 14687
+#define BSLS_MACROINCREMENTED_VALUE14687 14688
+#define BSLS_MACROINCREMENTED_VALUE14688 14689
+#define BSLS_MACROINCREMENTED_VALUE14689 14690
+#define BSLS_MACROINCREMENTED_VALUE14690 14691
+#define BSLS_MACROINCREMENTED_VALUE14691 14692
+#define BSLS_MACROINCREMENTED_VALUE14692 14693
+#define BSLS_MACROINCREMENTED_VALUE14693 14694
+#define BSLS_MACROINCREMENTED_VALUE14694 14695
+#define BSLS_MACROINCREMENTED_VALUE14695 14696
+#define BSLS_MACROINCREMENTED_VALUE14696 14697
+#define BSLS_MACROINCREMENTED_VALUE14697 14698
+#define BSLS_MACROINCREMENTED_VALUE14698 14699
+#define BSLS_MACROINCREMENTED_VALUE14699 14700
+#define BSLS_MACROINCREMENTED_VALUE14700 14701
+#define BSLS_MACROINCREMENTED_VALUE14701 14702
+#define BSLS_MACROINCREMENTED_VALUE14702 14703
+#define BSLS_MACROINCREMENTED_VALUE14703 14704
+#define BSLS_MACROINCREMENTED_VALUE14704 14705
+#define BSLS_MACROINCREMENTED_VALUE14705 14706
+#define BSLS_MACROINCREMENTED_VALUE14706 14707
+#define BSLS_MACROINCREMENTED_VALUE14707 14708
+#define BSLS_MACROINCREMENTED_VALUE14708 14709
+#define BSLS_MACROINCREMENTED_VALUE14709 14710
+#define BSLS_MACROINCREMENTED_VALUE14710 14711
+#define BSLS_MACROINCREMENTED_VALUE14711 14712
+#define BSLS_MACROINCREMENTED_VALUE14712 14713
+#define BSLS_MACROINCREMENTED_VALUE14713 14714
+#define BSLS_MACROINCREMENTED_VALUE14714 14715
+#define BSLS_MACROINCREMENTED_VALUE14715 14716
+#define BSLS_MACROINCREMENTED_VALUE14716 14717
+#define BSLS_MACROINCREMENTED_VALUE14717 14718
+#define BSLS_MACROINCREMENTED_VALUE14718 14719
+#define BSLS_MACROINCREMENTED_VALUE14719 14720
+#define BSLS_MACROINCREMENTED_VALUE14720 14721
+#define BSLS_MACROINCREMENTED_VALUE14721 14722
+#define BSLS_MACROINCREMENTED_VALUE14722 14723
+#define BSLS_MACROINCREMENTED_VALUE14723 14724
+#define BSLS_MACROINCREMENTED_VALUE14724 14725
+#define BSLS_MACROINCREMENTED_VALUE14725 14726
+#define BSLS_MACROINCREMENTED_VALUE14726 14727
+#define BSLS_MACROINCREMENTED_VALUE14727 14728
+#define BSLS_MACROINCREMENTED_VALUE14728 14729
+#define BSLS_MACROINCREMENTED_VALUE14729 14730
+#define BSLS_MACROINCREMENTED_VALUE14730 14731
+#define BSLS_MACROINCREMENTED_VALUE14731 14732
+#define BSLS_MACROINCREMENTED_VALUE14732 14733
+#define BSLS_MACROINCREMENTED_VALUE14733 14734
+#define BSLS_MACROINCREMENTED_VALUE14734 14735
+#define BSLS_MACROINCREMENTED_VALUE14735 14736
+#define BSLS_MACROINCREMENTED_VALUE14736 14737
+#define BSLS_MACROINCREMENTED_VALUE14737 14738
+#define BSLS_MACROINCREMENTED_VALUE14738 14739
+#define BSLS_MACROINCREMENTED_VALUE14739 14740
+#define BSLS_MACROINCREMENTED_VALUE14740 14741
+#define BSLS_MACROINCREMENTED_VALUE14741 14742
+#define BSLS_MACROINCREMENTED_VALUE14742 14743
+#define BSLS_MACROINCREMENTED_VALUE14743 14744
+#define BSLS_MACROINCREMENTED_VALUE14744 14745
+#define BSLS_MACROINCREMENTED_VALUE14745 14746
+#define BSLS_MACROINCREMENTED_VALUE14746 14747
+#define BSLS_MACROINCREMENTED_VALUE14747 14748
+#define BSLS_MACROINCREMENTED_VALUE14748 14749
+#define BSLS_MACROINCREMENTED_VALUE14749 14750
+#define BSLS_MACROINCREMENTED_VALUE14750 14751
+#define BSLS_MACROINCREMENTED_VALUE14751 14752
+#define BSLS_MACROINCREMENTED_VALUE14752 14753
+#define BSLS_MACROINCREMENTED_VALUE14753 14754
+#define BSLS_MACROINCREMENTED_VALUE14754 14755
+#define BSLS_MACROINCREMENTED_VALUE14755 14756
+#define BSLS_MACROINCREMENTED_VALUE14756 14757
+#define BSLS_MACROINCREMENTED_VALUE14757 14758
+#define BSLS_MACROINCREMENTED_VALUE14758 14759
+#define BSLS_MACROINCREMENTED_VALUE14759 14760
+#define BSLS_MACROINCREMENTED_VALUE14760 14761
+#define BSLS_MACROINCREMENTED_VALUE14761 14762
+#define BSLS_MACROINCREMENTED_VALUE14762 14763
+#define BSLS_MACROINCREMENTED_VALUE14763 14764
+#define BSLS_MACROINCREMENTED_VALUE14764 14765
+#define BSLS_MACROINCREMENTED_VALUE14765 14766
+#define BSLS_MACROINCREMENTED_VALUE14766 14767
+#define BSLS_MACROINCREMENTED_VALUE14767 14768
+#define BSLS_MACROINCREMENTED_VALUE14768 14769
+#define BSLS_MACROINCREMENTED_VALUE14769 14770
+#define BSLS_MACROINCREMENTED_VALUE14770 14771
+#define BSLS_MACROINCREMENTED_VALUE14771 14772
+#define BSLS_MACROINCREMENTED_VALUE14772 14773
+#define BSLS_MACROINCREMENTED_VALUE14773 14774
+#define BSLS_MACROINCREMENTED_VALUE14774 14775
+#define BSLS_MACROINCREMENTED_VALUE14775 14776
+#define BSLS_MACROINCREMENTED_VALUE14776 14777
+#define BSLS_MACROINCREMENTED_VALUE14777 14778
+#define BSLS_MACROINCREMENTED_VALUE14778 14779
+#define BSLS_MACROINCREMENTED_VALUE14779 14780
+#define BSLS_MACROINCREMENTED_VALUE14780 14781
+#define BSLS_MACROINCREMENTED_VALUE14781 14782
+#define BSLS_MACROINCREMENTED_VALUE14782 14783
+#define BSLS_MACROINCREMENTED_VALUE14783 14784
+#define BSLS_MACROINCREMENTED_VALUE14784 14785
+#define BSLS_MACROINCREMENTED_VALUE14785 14786
+#define BSLS_MACROINCREMENTED_VALUE14786 14787
+#define BSLS_MACROINCREMENTED_VALUE14787 14788
+#define BSLS_MACROINCREMENTED_VALUE14788 14789
+#define BSLS_MACROINCREMENTED_VALUE14789 14790
+#define BSLS_MACROINCREMENTED_VALUE14790 14791
+#define BSLS_MACROINCREMENTED_VALUE14791 14792
+#define BSLS_MACROINCREMENTED_VALUE14792 14793
+#define BSLS_MACROINCREMENTED_VALUE14793 14794
+#define BSLS_MACROINCREMENTED_VALUE14794 14795
+#define BSLS_MACROINCREMENTED_VALUE14795 14796
+#define BSLS_MACROINCREMENTED_VALUE14796 14797
+#define BSLS_MACROINCREMENTED_VALUE14797 14798
+#define BSLS_MACROINCREMENTED_VALUE14798 14799
+#define BSLS_MACROINCREMENTED_VALUE14799 14800
+#define BSLS_MACROINCREMENTED_VALUE14800 14801
+#define BSLS_MACROINCREMENTED_VALUE14801 14802
+#define BSLS_MACROINCREMENTED_VALUE14802 14803
+#define BSLS_MACROINCREMENTED_VALUE14803 14804
+#define BSLS_MACROINCREMENTED_VALUE14804 14805
+#define BSLS_MACROINCREMENTED_VALUE14805 14806
+#define BSLS_MACROINCREMENTED_VALUE14806 14807
+#define BSLS_MACROINCREMENTED_VALUE14807 14808
+#define BSLS_MACROINCREMENTED_VALUE14808 14809
+#define BSLS_MACROINCREMENTED_VALUE14809 14810
+#define BSLS_MACROINCREMENTED_VALUE14810 14811
+#define BSLS_MACROINCREMENTED_VALUE14811 14812
+#define BSLS_MACROINCREMENTED_VALUE14812 14813
+#define BSLS_MACROINCREMENTED_VALUE14813 14814
+#define BSLS_MACROINCREMENTED_VALUE14814 14815
+#define BSLS_MACROINCREMENTED_VALUE14815 14816
+#define BSLS_MACROINCREMENTED_VALUE14816 14817
+#define BSLS_MACROINCREMENTED_VALUE14817 14818
+#define BSLS_MACROINCREMENTED_VALUE14818 14819
+#define BSLS_MACROINCREMENTED_VALUE14819 14820
+#define BSLS_MACROINCREMENTED_VALUE14820 14821
+#define BSLS_MACROINCREMENTED_VALUE14821 14822
+#define BSLS_MACROINCREMENTED_VALUE14822 14823
+#define BSLS_MACROINCREMENTED_VALUE14823 14824
+#define BSLS_MACROINCREMENTED_VALUE14824 14825
+#define BSLS_MACROINCREMENTED_VALUE14825 14826
+#define BSLS_MACROINCREMENTED_VALUE14826 14827
+#define BSLS_MACROINCREMENTED_VALUE14827 14828
+#define BSLS_MACROINCREMENTED_VALUE14828 14829
+#define BSLS_MACROINCREMENTED_VALUE14829 14830
+#define BSLS_MACROINCREMENTED_VALUE14830 14831
+#define BSLS_MACROINCREMENTED_VALUE14831 14832
+#define BSLS_MACROINCREMENTED_VALUE14832 14833
+#define BSLS_MACROINCREMENTED_VALUE14833 14834
+#define BSLS_MACROINCREMENTED_VALUE14834 14835
+#define BSLS_MACROINCREMENTED_VALUE14835 14836
+#define BSLS_MACROINCREMENTED_VALUE14836 14837
+#define BSLS_MACROINCREMENTED_VALUE14837 14838
+#define BSLS_MACROINCREMENTED_VALUE14838 14839
+#define BSLS_MACROINCREMENTED_VALUE14839 14840
+#define BSLS_MACROINCREMENTED_VALUE14840 14841
+#define BSLS_MACROINCREMENTED_VALUE14841 14842
+#define BSLS_MACROINCREMENTED_VALUE14842 14843
+#define BSLS_MACROINCREMENTED_VALUE14843 14844
+#define BSLS_MACROINCREMENTED_VALUE14844 14845
+#define BSLS_MACROINCREMENTED_VALUE14845 14846
+#define BSLS_MACROINCREMENTED_VALUE14846 14847
+#define BSLS_MACROINCREMENTED_VALUE14847 14848
+#define BSLS_MACROINCREMENTED_VALUE14848 14849
+#define BSLS_MACROINCREMENTED_VALUE14849 14850
+#define BSLS_MACROINCREMENTED_VALUE14850 14851
+#define BSLS_MACROINCREMENTED_VALUE14851 14852
+#define BSLS_MACROINCREMENTED_VALUE14852 14853
+#define BSLS_MACROINCREMENTED_VALUE14853 14854
+#define BSLS_MACROINCREMENTED_VALUE14854 14855
+#define BSLS_MACROINCREMENTED_VALUE14855 14856
+#define BSLS_MACROINCREMENTED_VALUE14856 14857
+#define BSLS_MACROINCREMENTED_VALUE14857 14858
+#define BSLS_MACROINCREMENTED_VALUE14858 14859
+#define BSLS_MACROINCREMENTED_VALUE14859 14860
+#define BSLS_MACROINCREMENTED_VALUE14860 14861
+#define BSLS_MACROINCREMENTED_VALUE14861 14862
+#define BSLS_MACROINCREMENTED_VALUE14862 14863
+#define BSLS_MACROINCREMENTED_VALUE14863 14864
+#define BSLS_MACROINCREMENTED_VALUE14864 14865
+#define BSLS_MACROINCREMENTED_VALUE14865 14866
+#define BSLS_MACROINCREMENTED_VALUE14866 14867
+#define BSLS_MACROINCREMENTED_VALUE14867 14868
+#define BSLS_MACROINCREMENTED_VALUE14868 14869
+#define BSLS_MACROINCREMENTED_VALUE14869 14870
+#define BSLS_MACROINCREMENTED_VALUE14870 14871
+#define BSLS_MACROINCREMENTED_VALUE14871 14872
+#define BSLS_MACROINCREMENTED_VALUE14872 14873
+#define BSLS_MACROINCREMENTED_VALUE14873 14874
+#define BSLS_MACROINCREMENTED_VALUE14874 14875
+#define BSLS_MACROINCREMENTED_VALUE14875 14876
+#define BSLS_MACROINCREMENTED_VALUE14876 14877
+#define BSLS_MACROINCREMENTED_VALUE14877 14878
+#define BSLS_MACROINCREMENTED_VALUE14878 14879
+#define BSLS_MACROINCREMENTED_VALUE14879 14880
+#define BSLS_MACROINCREMENTED_VALUE14880 14881
+#define BSLS_MACROINCREMENTED_VALUE14881 14882
+#define BSLS_MACROINCREMENTED_VALUE14882 14883
+#define BSLS_MACROINCREMENTED_VALUE14883 14884
+#define BSLS_MACROINCREMENTED_VALUE14884 14885
+#define BSLS_MACROINCREMENTED_VALUE14885 14886
+#define BSLS_MACROINCREMENTED_VALUE14886 14887
+#define BSLS_MACROINCREMENTED_VALUE14887 14888
+#define BSLS_MACROINCREMENTED_VALUE14888 14889
+#define BSLS_MACROINCREMENTED_VALUE14889 14890
+#define BSLS_MACROINCREMENTED_VALUE14890 14891
+#define BSLS_MACROINCREMENTED_VALUE14891 14892
+#define BSLS_MACROINCREMENTED_VALUE14892 14893
+#define BSLS_MACROINCREMENTED_VALUE14893 14894
+#define BSLS_MACROINCREMENTED_VALUE14894 14895
+#define BSLS_MACROINCREMENTED_VALUE14895 14896
+#define BSLS_MACROINCREMENTED_VALUE14896 14897
+#define BSLS_MACROINCREMENTED_VALUE14897 14898
+#define BSLS_MACROINCREMENTED_VALUE14898 14899
+#define BSLS_MACROINCREMENTED_VALUE14899 14900
+#define BSLS_MACROINCREMENTED_VALUE14900 14901
+#define BSLS_MACROINCREMENTED_VALUE14901 14902
+#define BSLS_MACROINCREMENTED_VALUE14902 14903
+#define BSLS_MACROINCREMENTED_VALUE14903 14904
+#define BSLS_MACROINCREMENTED_VALUE14904 14905
+#define BSLS_MACROINCREMENTED_VALUE14905 14906
+#define BSLS_MACROINCREMENTED_VALUE14906 14907
+#define BSLS_MACROINCREMENTED_VALUE14907 14908
+#define BSLS_MACROINCREMENTED_VALUE14908 14909
+#define BSLS_MACROINCREMENTED_VALUE14909 14910
+#define BSLS_MACROINCREMENTED_VALUE14910 14911
+#define BSLS_MACROINCREMENTED_VALUE14911 14912
+#define BSLS_MACROINCREMENTED_VALUE14912 14913
+#define BSLS_MACROINCREMENTED_VALUE14913 14914
+#define BSLS_MACROINCREMENTED_VALUE14914 14915
+#define BSLS_MACROINCREMENTED_VALUE14915 14916
+#define BSLS_MACROINCREMENTED_VALUE14916 14917
+#define BSLS_MACROINCREMENTED_VALUE14917 14918
+#define BSLS_MACROINCREMENTED_VALUE14918 14919
+#define BSLS_MACROINCREMENTED_VALUE14919 14920
+#define BSLS_MACROINCREMENTED_VALUE14920 14921
+#define BSLS_MACROINCREMENTED_VALUE14921 14922
+#define BSLS_MACROINCREMENTED_VALUE14922 14923
+#define BSLS_MACROINCREMENTED_VALUE14923 14924
+#define BSLS_MACROINCREMENTED_VALUE14924 14925
+#define BSLS_MACROINCREMENTED_VALUE14925 14926
+#define BSLS_MACROINCREMENTED_VALUE14926 14927
+#define BSLS_MACROINCREMENTED_VALUE14927 14928
+#define BSLS_MACROINCREMENTED_VALUE14928 14929
+#define BSLS_MACROINCREMENTED_VALUE14929 14930
+#define BSLS_MACROINCREMENTED_VALUE14930 14931
+#define BSLS_MACROINCREMENTED_VALUE14931 14932
+#define BSLS_MACROINCREMENTED_VALUE14932 14933
+#define BSLS_MACROINCREMENTED_VALUE14933 14934
+#define BSLS_MACROINCREMENTED_VALUE14934 14935
+#define BSLS_MACROINCREMENTED_VALUE14935 14936
+#define BSLS_MACROINCREMENTED_VALUE14936 14937
+#define BSLS_MACROINCREMENTED_VALUE14937 14938
+#define BSLS_MACROINCREMENTED_VALUE14938 14939
+#define BSLS_MACROINCREMENTED_VALUE14939 14940
+#define BSLS_MACROINCREMENTED_VALUE14940 14941
+#define BSLS_MACROINCREMENTED_VALUE14941 14942
+#define BSLS_MACROINCREMENTED_VALUE14942 14943
+#define BSLS_MACROINCREMENTED_VALUE14943 14944
+#define BSLS_MACROINCREMENTED_VALUE14944 14945
+#define BSLS_MACROINCREMENTED_VALUE14945 14946
+#define BSLS_MACROINCREMENTED_VALUE14946 14947
+#define BSLS_MACROINCREMENTED_VALUE14947 14948
+#define BSLS_MACROINCREMENTED_VALUE14948 14949
+#define BSLS_MACROINCREMENTED_VALUE14949 14950
+#define BSLS_MACROINCREMENTED_VALUE14950 14951
+#define BSLS_MACROINCREMENTED_VALUE14951 14952
+#define BSLS_MACROINCREMENTED_VALUE14952 14953
+#define BSLS_MACROINCREMENTED_VALUE14953 14954
+#define BSLS_MACROINCREMENTED_VALUE14954 14955
+#define BSLS_MACROINCREMENTED_VALUE14955 14956
+#define BSLS_MACROINCREMENTED_VALUE14956 14957
+#define BSLS_MACROINCREMENTED_VALUE14957 14958
+#define BSLS_MACROINCREMENTED_VALUE14958 14959
+#define BSLS_MACROINCREMENTED_VALUE14959 14960
+#define BSLS_MACROINCREMENTED_VALUE14960 14961
+#define BSLS_MACROINCREMENTED_VALUE14961 14962
+#define BSLS_MACROINCREMENTED_VALUE14962 14963
+#define BSLS_MACROINCREMENTED_VALUE14963 14964
+#define BSLS_MACROINCREMENTED_VALUE14964 14965
+#define BSLS_MACROINCREMENTED_VALUE14965 14966
+#define BSLS_MACROINCREMENTED_VALUE14966 14967
+#define BSLS_MACROINCREMENTED_VALUE14967 14968
+#define BSLS_MACROINCREMENTED_VALUE14968 14969
+#define BSLS_MACROINCREMENTED_VALUE14969 14970
+#define BSLS_MACROINCREMENTED_VALUE14970 14971
+#define BSLS_MACROINCREMENTED_VALUE14971 14972
+#define BSLS_MACROINCREMENTED_VALUE14972 14973
+#define BSLS_MACROINCREMENTED_VALUE14973 14974
+#define BSLS_MACROINCREMENTED_VALUE14974 14975
+#define BSLS_MACROINCREMENTED_VALUE14975 14976
+#define BSLS_MACROINCREMENTED_VALUE14976 14977
+#define BSLS_MACROINCREMENTED_VALUE14977 14978
+#define BSLS_MACROINCREMENTED_VALUE14978 14979
+#define BSLS_MACROINCREMENTED_VALUE14979 14980
+#define BSLS_MACROINCREMENTED_VALUE14980 14981
+#define BSLS_MACROINCREMENTED_VALUE14981 14982
+#define BSLS_MACROINCREMENTED_VALUE14982 14983
+#define BSLS_MACROINCREMENTED_VALUE14983 14984
+#define BSLS_MACROINCREMENTED_VALUE14984 14985
+#define BSLS_MACROINCREMENTED_VALUE14985 14986
+#define BSLS_MACROINCREMENTED_VALUE14986 14987
+#define BSLS_MACROINCREMENTED_VALUE14987 14988
+#define BSLS_MACROINCREMENTED_VALUE14988 14989
+#define BSLS_MACROINCREMENTED_VALUE14989 14990
+#define BSLS_MACROINCREMENTED_VALUE14990 14991
+#define BSLS_MACROINCREMENTED_VALUE14991 14992
+#define BSLS_MACROINCREMENTED_VALUE14992 14993
+#define BSLS_MACROINCREMENTED_VALUE14993 14994
+#define BSLS_MACROINCREMENTED_VALUE14994 14995
+#define BSLS_MACROINCREMENTED_VALUE14995 14996
+#define BSLS_MACROINCREMENTED_VALUE14996 14997
+#define BSLS_MACROINCREMENTED_VALUE14997 14998
+#define BSLS_MACROINCREMENTED_VALUE14998 14999
+#define BSLS_MACROINCREMENTED_VALUE14999 15000
+#define BSLS_MACROINCREMENTED_VALUE15000 15001
+#define BSLS_MACROINCREMENTED_VALUE15001 15002
+#define BSLS_MACROINCREMENTED_VALUE15002 15003
+#define BSLS_MACROINCREMENTED_VALUE15003 15004
+#define BSLS_MACROINCREMENTED_VALUE15004 15005
+#define BSLS_MACROINCREMENTED_VALUE15005 15006
+#define BSLS_MACROINCREMENTED_VALUE15006 15007
+#define BSLS_MACROINCREMENTED_VALUE15007 15008
+#define BSLS_MACROINCREMENTED_VALUE15008 15009
+#define BSLS_MACROINCREMENTED_VALUE15009 15010
+#define BSLS_MACROINCREMENTED_VALUE15010 15011
+#define BSLS_MACROINCREMENTED_VALUE15011 15012
+#define BSLS_MACROINCREMENTED_VALUE15012 15013
+#define BSLS_MACROINCREMENTED_VALUE15013 15014
+#define BSLS_MACROINCREMENTED_VALUE15014 15015
+#define BSLS_MACROINCREMENTED_VALUE15015 15016
+#define BSLS_MACROINCREMENTED_VALUE15016 15017
+#define BSLS_MACROINCREMENTED_VALUE15017 15018
+#define BSLS_MACROINCREMENTED_VALUE15018 15019
+#define BSLS_MACROINCREMENTED_VALUE15019 15020
+#define BSLS_MACROINCREMENTED_VALUE15020 15021
+#define BSLS_MACROINCREMENTED_VALUE15021 15022
+#define BSLS_MACROINCREMENTED_VALUE15022 15023
+#define BSLS_MACROINCREMENTED_VALUE15023 15024
+#define BSLS_MACROINCREMENTED_VALUE15024 15025
+#define BSLS_MACROINCREMENTED_VALUE15025 15026
+#define BSLS_MACROINCREMENTED_VALUE15026 15027
+#define BSLS_MACROINCREMENTED_VALUE15027 15028
+#define BSLS_MACROINCREMENTED_VALUE15028 15029
+#define BSLS_MACROINCREMENTED_VALUE15029 15030
+#define BSLS_MACROINCREMENTED_VALUE15030 15031
+#define BSLS_MACROINCREMENTED_VALUE15031 15032
+#define BSLS_MACROINCREMENTED_VALUE15032 15033
+#define BSLS_MACROINCREMENTED_VALUE15033 15034
+#define BSLS_MACROINCREMENTED_VALUE15034 15035
+#define BSLS_MACROINCREMENTED_VALUE15035 15036
+#define BSLS_MACROINCREMENTED_VALUE15036 15037
+#define BSLS_MACROINCREMENTED_VALUE15037 15038
+#define BSLS_MACROINCREMENTED_VALUE15038 15039
+#define BSLS_MACROINCREMENTED_VALUE15039 15040
+#define BSLS_MACROINCREMENTED_VALUE15040 15041
+#define BSLS_MACROINCREMENTED_VALUE15041 15042
+#define BSLS_MACROINCREMENTED_VALUE15042 15043
+#define BSLS_MACROINCREMENTED_VALUE15043 15044
+#define BSLS_MACROINCREMENTED_VALUE15044 15045
+#define BSLS_MACROINCREMENTED_VALUE15045 15046
+#define BSLS_MACROINCREMENTED_VALUE15046 15047
+#define BSLS_MACROINCREMENTED_VALUE15047 15048
+#define BSLS_MACROINCREMENTED_VALUE15048 15049
+#define BSLS_MACROINCREMENTED_VALUE15049 15050
+#define BSLS_MACROINCREMENTED_VALUE15050 15051
+#define BSLS_MACROINCREMENTED_VALUE15051 15052
+#define BSLS_MACROINCREMENTED_VALUE15052 15053
+#define BSLS_MACROINCREMENTED_VALUE15053 15054
+#define BSLS_MACROINCREMENTED_VALUE15054 15055
+#define BSLS_MACROINCREMENTED_VALUE15055 15056
+#define BSLS_MACROINCREMENTED_VALUE15056 15057
+#define BSLS_MACROINCREMENTED_VALUE15057 15058
+#define BSLS_MACROINCREMENTED_VALUE15058 15059
+#define BSLS_MACROINCREMENTED_VALUE15059 15060
+#define BSLS_MACROINCREMENTED_VALUE15060 15061
+#define BSLS_MACROINCREMENTED_VALUE15061 15062
+#define BSLS_MACROINCREMENTED_VALUE15062 15063
+#define BSLS_MACROINCREMENTED_VALUE15063 15064
+#define BSLS_MACROINCREMENTED_VALUE15064 15065
+#define BSLS_MACROINCREMENTED_VALUE15065 15066
+#define BSLS_MACROINCREMENTED_VALUE15066 15067
+#define BSLS_MACROINCREMENTED_VALUE15067 15068
+#define BSLS_MACROINCREMENTED_VALUE15068 15069
+#define BSLS_MACROINCREMENTED_VALUE15069 15070
+#define BSLS_MACROINCREMENTED_VALUE15070 15071
+#define BSLS_MACROINCREMENTED_VALUE15071 15072
+#define BSLS_MACROINCREMENTED_VALUE15072 15073
+#define BSLS_MACROINCREMENTED_VALUE15073 15074
+#define BSLS_MACROINCREMENTED_VALUE15074 15075
+#define BSLS_MACROINCREMENTED_VALUE15075 15076
+#define BSLS_MACROINCREMENTED_VALUE15076 15077
+#define BSLS_MACROINCREMENTED_VALUE15077 15078
+#define BSLS_MACROINCREMENTED_VALUE15078 15079
+#define BSLS_MACROINCREMENTED_VALUE15079 15080
+#define BSLS_MACROINCREMENTED_VALUE15080 15081
+#define BSLS_MACROINCREMENTED_VALUE15081 15082
+#define BSLS_MACROINCREMENTED_VALUE15082 15083
+#define BSLS_MACROINCREMENTED_VALUE15083 15084
+#define BSLS_MACROINCREMENTED_VALUE15084 15085
+#define BSLS_MACROINCREMENTED_VALUE15085 15086
+#define BSLS_MACROINCREMENTED_VALUE15086 15087
+#define BSLS_MACROINCREMENTED_VALUE15087 15088
+#define BSLS_MACROINCREMENTED_VALUE15088 15089
+#define BSLS_MACROINCREMENTED_VALUE15089 15090
+#define BSLS_MACROINCREMENTED_VALUE15090 15091
+#define BSLS_MACROINCREMENTED_VALUE15091 15092
+#define BSLS_MACROINCREMENTED_VALUE15092 15093
+#define BSLS_MACROINCREMENTED_VALUE15093 15094
+#define BSLS_MACROINCREMENTED_VALUE15094 15095
+#define BSLS_MACROINCREMENTED_VALUE15095 15096
+#define BSLS_MACROINCREMENTED_VALUE15096 15097
+#define BSLS_MACROINCREMENTED_VALUE15097 15098
+#define BSLS_MACROINCREMENTED_VALUE15098 15099
+#define BSLS_MACROINCREMENTED_VALUE15099 15100
+#define BSLS_MACROINCREMENTED_VALUE15100 15101
+#define BSLS_MACROINCREMENTED_VALUE15101 15102
+#define BSLS_MACROINCREMENTED_VALUE15102 15103
+#define BSLS_MACROINCREMENTED_VALUE15103 15104
+#define BSLS_MACROINCREMENTED_VALUE15104 15105
+#define BSLS_MACROINCREMENTED_VALUE15105 15106
+#define BSLS_MACROINCREMENTED_VALUE15106 15107
+#define BSLS_MACROINCREMENTED_VALUE15107 15108
+#define BSLS_MACROINCREMENTED_VALUE15108 15109
+#define BSLS_MACROINCREMENTED_VALUE15109 15110
+#define BSLS_MACROINCREMENTED_VALUE15110 15111
+#define BSLS_MACROINCREMENTED_VALUE15111 15112
+#define BSLS_MACROINCREMENTED_VALUE15112 15113
+#define BSLS_MACROINCREMENTED_VALUE15113 15114
+#define BSLS_MACROINCREMENTED_VALUE15114 15115
+#define BSLS_MACROINCREMENTED_VALUE15115 15116
+#define BSLS_MACROINCREMENTED_VALUE15116 15117
+#define BSLS_MACROINCREMENTED_VALUE15117 15118
+#define BSLS_MACROINCREMENTED_VALUE15118 15119
+#define BSLS_MACROINCREMENTED_VALUE15119 15120
+#define BSLS_MACROINCREMENTED_VALUE15120 15121
+#define BSLS_MACROINCREMENTED_VALUE15121 15122
+#define BSLS_MACROINCREMENTED_VALUE15122 15123
+#define BSLS_MACROINCREMENTED_VALUE15123 15124
+#define BSLS_MACROINCREMENTED_VALUE15124 15125
+#define BSLS_MACROINCREMENTED_VALUE15125 15126
+#define BSLS_MACROINCREMENTED_VALUE15126 15127
+#define BSLS_MACROINCREMENTED_VALUE15127 15128
+#define BSLS_MACROINCREMENTED_VALUE15128 15129
+#define BSLS_MACROINCREMENTED_VALUE15129 15130
+#define BSLS_MACROINCREMENTED_VALUE15130 15131
+#define BSLS_MACROINCREMENTED_VALUE15131 15132
+#define BSLS_MACROINCREMENTED_VALUE15132 15133
+#define BSLS_MACROINCREMENTED_VALUE15133 15134
+#define BSLS_MACROINCREMENTED_VALUE15134 15135
+#define BSLS_MACROINCREMENTED_VALUE15135 15136
+#define BSLS_MACROINCREMENTED_VALUE15136 15137
+#define BSLS_MACROINCREMENTED_VALUE15137 15138
+#define BSLS_MACROINCREMENTED_VALUE15138 15139
+#define BSLS_MACROINCREMENTED_VALUE15139 15140
+#define BSLS_MACROINCREMENTED_VALUE15140 15141
+#define BSLS_MACROINCREMENTED_VALUE15141 15142
+#define BSLS_MACROINCREMENTED_VALUE15142 15143
+#define BSLS_MACROINCREMENTED_VALUE15143 15144
+#define BSLS_MACROINCREMENTED_VALUE15144 15145
+#define BSLS_MACROINCREMENTED_VALUE15145 15146
+#define BSLS_MACROINCREMENTED_VALUE15146 15147
+#define BSLS_MACROINCREMENTED_VALUE15147 15148
+#define BSLS_MACROINCREMENTED_VALUE15148 15149
+#define BSLS_MACROINCREMENTED_VALUE15149 15150
+#define BSLS_MACROINCREMENTED_VALUE15150 15151
+#define BSLS_MACROINCREMENTED_VALUE15151 15152
+#define BSLS_MACROINCREMENTED_VALUE15152 15153
+#define BSLS_MACROINCREMENTED_VALUE15153 15154
+#define BSLS_MACROINCREMENTED_VALUE15154 15155
+#define BSLS_MACROINCREMENTED_VALUE15155 15156
+#define BSLS_MACROINCREMENTED_VALUE15156 15157
+#define BSLS_MACROINCREMENTED_VALUE15157 15158
+#define BSLS_MACROINCREMENTED_VALUE15158 15159
+#define BSLS_MACROINCREMENTED_VALUE15159 15160
+#define BSLS_MACROINCREMENTED_VALUE15160 15161
+#define BSLS_MACROINCREMENTED_VALUE15161 15162
+#define BSLS_MACROINCREMENTED_VALUE15162 15163
+#define BSLS_MACROINCREMENTED_VALUE15163 15164
+#define BSLS_MACROINCREMENTED_VALUE15164 15165
+#define BSLS_MACROINCREMENTED_VALUE15165 15166
+#define BSLS_MACROINCREMENTED_VALUE15166 15167
+#define BSLS_MACROINCREMENTED_VALUE15167 15168
+#define BSLS_MACROINCREMENTED_VALUE15168 15169
+#define BSLS_MACROINCREMENTED_VALUE15169 15170
+#define BSLS_MACROINCREMENTED_VALUE15170 15171
+#define BSLS_MACROINCREMENTED_VALUE15171 15172
+#define BSLS_MACROINCREMENTED_VALUE15172 15173
+#define BSLS_MACROINCREMENTED_VALUE15173 15174
+#define BSLS_MACROINCREMENTED_VALUE15174 15175
+#define BSLS_MACROINCREMENTED_VALUE15175 15176
+#define BSLS_MACROINCREMENTED_VALUE15176 15177
+#define BSLS_MACROINCREMENTED_VALUE15177 15178
+#define BSLS_MACROINCREMENTED_VALUE15178 15179
+#define BSLS_MACROINCREMENTED_VALUE15179 15180
+#define BSLS_MACROINCREMENTED_VALUE15180 15181
+#define BSLS_MACROINCREMENTED_VALUE15181 15182
+#define BSLS_MACROINCREMENTED_VALUE15182 15183
+#define BSLS_MACROINCREMENTED_VALUE15183 15184
+#define BSLS_MACROINCREMENTED_VALUE15184 15185
+#define BSLS_MACROINCREMENTED_VALUE15185 15186
+#define BSLS_MACROINCREMENTED_VALUE15186 15187
+#define BSLS_MACROINCREMENTED_VALUE15187 15188
+#define BSLS_MACROINCREMENTED_VALUE15188 15189
+#define BSLS_MACROINCREMENTED_VALUE15189 15190
+#define BSLS_MACROINCREMENTED_VALUE15190 15191
+#define BSLS_MACROINCREMENTED_VALUE15191 15192
+#define BSLS_MACROINCREMENTED_VALUE15192 15193
+#define BSLS_MACROINCREMENTED_VALUE15193 15194
+#define BSLS_MACROINCREMENTED_VALUE15194 15195
+#define BSLS_MACROINCREMENTED_VALUE15195 15196
+#define BSLS_MACROINCREMENTED_VALUE15196 15197
+#define BSLS_MACROINCREMENTED_VALUE15197 15198
+#define BSLS_MACROINCREMENTED_VALUE15198 15199
+#define BSLS_MACROINCREMENTED_VALUE15199 15200
+#define BSLS_MACROINCREMENTED_VALUE15200 15201
+#define BSLS_MACROINCREMENTED_VALUE15201 15202
+#define BSLS_MACROINCREMENTED_VALUE15202 15203
+#define BSLS_MACROINCREMENTED_VALUE15203 15204
+#define BSLS_MACROINCREMENTED_VALUE15204 15205
+#define BSLS_MACROINCREMENTED_VALUE15205 15206
+#define BSLS_MACROINCREMENTED_VALUE15206 15207
+#define BSLS_MACROINCREMENTED_VALUE15207 15208
+#define BSLS_MACROINCREMENTED_VALUE15208 15209
+#define BSLS_MACROINCREMENTED_VALUE15209 15210
+#define BSLS_MACROINCREMENTED_VALUE15210 15211
+#define BSLS_MACROINCREMENTED_VALUE15211 15212
+#define BSLS_MACROINCREMENTED_VALUE15212 15213
+#define BSLS_MACROINCREMENTED_VALUE15213 15214
+#define BSLS_MACROINCREMENTED_VALUE15214 15215
+#define BSLS_MACROINCREMENTED_VALUE15215 15216
+#define BSLS_MACROINCREMENTED_VALUE15216 15217
+#define BSLS_MACROINCREMENTED_VALUE15217 15218
+#define BSLS_MACROINCREMENTED_VALUE15218 15219
+#define BSLS_MACROINCREMENTED_VALUE15219 15220
+#define BSLS_MACROINCREMENTED_VALUE15220 15221
+#define BSLS_MACROINCREMENTED_VALUE15221 15222
+#define BSLS_MACROINCREMENTED_VALUE15222 15223
+#define BSLS_MACROINCREMENTED_VALUE15223 15224
+#define BSLS_MACROINCREMENTED_VALUE15224 15225
+#define BSLS_MACROINCREMENTED_VALUE15225 15226
+#define BSLS_MACROINCREMENTED_VALUE15226 15227
+#define BSLS_MACROINCREMENTED_VALUE15227 15228
+#define BSLS_MACROINCREMENTED_VALUE15228 15229
+#define BSLS_MACROINCREMENTED_VALUE15229 15230
+#define BSLS_MACROINCREMENTED_VALUE15230 15231
+#define BSLS_MACROINCREMENTED_VALUE15231 15232
+#define BSLS_MACROINCREMENTED_VALUE15232 15233
+#define BSLS_MACROINCREMENTED_VALUE15233 15234
+#define BSLS_MACROINCREMENTED_VALUE15234 15235
+#define BSLS_MACROINCREMENTED_VALUE15235 15236
+#define BSLS_MACROINCREMENTED_VALUE15236 15237
+#define BSLS_MACROINCREMENTED_VALUE15237 15238
+#define BSLS_MACROINCREMENTED_VALUE15238 15239
+#define BSLS_MACROINCREMENTED_VALUE15239 15240
+#define BSLS_MACROINCREMENTED_VALUE15240 15241
+#define BSLS_MACROINCREMENTED_VALUE15241 15242
+#define BSLS_MACROINCREMENTED_VALUE15242 15243
+#define BSLS_MACROINCREMENTED_VALUE15243 15244
+#define BSLS_MACROINCREMENTED_VALUE15244 15245
+#define BSLS_MACROINCREMENTED_VALUE15245 15246
+#define BSLS_MACROINCREMENTED_VALUE15246 15247
+#define BSLS_MACROINCREMENTED_VALUE15247 15248
+#define BSLS_MACROINCREMENTED_VALUE15248 15249
+#define BSLS_MACROINCREMENTED_VALUE15249 15250
+#define BSLS_MACROINCREMENTED_VALUE15250 15251
+#define BSLS_MACROINCREMENTED_VALUE15251 15252
+#define BSLS_MACROINCREMENTED_VALUE15252 15253
+#define BSLS_MACROINCREMENTED_VALUE15253 15254
+#define BSLS_MACROINCREMENTED_VALUE15254 15255
+#define BSLS_MACROINCREMENTED_VALUE15255 15256
+#define BSLS_MACROINCREMENTED_VALUE15256 15257
+#define BSLS_MACROINCREMENTED_VALUE15257 15258
+#define BSLS_MACROINCREMENTED_VALUE15258 15259
+#define BSLS_MACROINCREMENTED_VALUE15259 15260
+#define BSLS_MACROINCREMENTED_VALUE15260 15261
+#define BSLS_MACROINCREMENTED_VALUE15261 15262
+#define BSLS_MACROINCREMENTED_VALUE15262 15263
+#define BSLS_MACROINCREMENTED_VALUE15263 15264
+#define BSLS_MACROINCREMENTED_VALUE15264 15265
+#define BSLS_MACROINCREMENTED_VALUE15265 15266
+#define BSLS_MACROINCREMENTED_VALUE15266 15267
+#define BSLS_MACROINCREMENTED_VALUE15267 15268
+#define BSLS_MACROINCREMENTED_VALUE15268 15269
+#define BSLS_MACROINCREMENTED_VALUE15269 15270
+#define BSLS_MACROINCREMENTED_VALUE15270 15271
+#define BSLS_MACROINCREMENTED_VALUE15271 15272
+#define BSLS_MACROINCREMENTED_VALUE15272 15273
+#define BSLS_MACROINCREMENTED_VALUE15273 15274
+#define BSLS_MACROINCREMENTED_VALUE15274 15275
+#define BSLS_MACROINCREMENTED_VALUE15275 15276
+#define BSLS_MACROINCREMENTED_VALUE15276 15277
+#define BSLS_MACROINCREMENTED_VALUE15277 15278
+#define BSLS_MACROINCREMENTED_VALUE15278 15279
+#define BSLS_MACROINCREMENTED_VALUE15279 15280
+#define BSLS_MACROINCREMENTED_VALUE15280 15281
+#define BSLS_MACROINCREMENTED_VALUE15281 15282
+#define BSLS_MACROINCREMENTED_VALUE15282 15283
+#define BSLS_MACROINCREMENTED_VALUE15283 15284
+#define BSLS_MACROINCREMENTED_VALUE15284 15285
+#define BSLS_MACROINCREMENTED_VALUE15285 15286
+#define BSLS_MACROINCREMENTED_VALUE15286 15287
+#define BSLS_MACROINCREMENTED_VALUE15287 15288
+#define BSLS_MACROINCREMENTED_VALUE15288 15289
+#define BSLS_MACROINCREMENTED_VALUE15289 15290
+#define BSLS_MACROINCREMENTED_VALUE15290 15291
+#define BSLS_MACROINCREMENTED_VALUE15291 15292
+#define BSLS_MACROINCREMENTED_VALUE15292 15293
+#define BSLS_MACROINCREMENTED_VALUE15293 15294
+#define BSLS_MACROINCREMENTED_VALUE15294 15295
+#define BSLS_MACROINCREMENTED_VALUE15295 15296
+#define BSLS_MACROINCREMENTED_VALUE15296 15297
+#define BSLS_MACROINCREMENTED_VALUE15297 15298
+#define BSLS_MACROINCREMENTED_VALUE15298 15299
+#define BSLS_MACROINCREMENTED_VALUE15299 15300
+#define BSLS_MACROINCREMENTED_VALUE15300 15301
+#define BSLS_MACROINCREMENTED_VALUE15301 15302
+#define BSLS_MACROINCREMENTED_VALUE15302 15303
+#define BSLS_MACROINCREMENTED_VALUE15303 15304
+#define BSLS_MACROINCREMENTED_VALUE15304 15305
+#define BSLS_MACROINCREMENTED_VALUE15305 15306
+#define BSLS_MACROINCREMENTED_VALUE15306 15307
+#define BSLS_MACROINCREMENTED_VALUE15307 15308
+#define BSLS_MACROINCREMENTED_VALUE15308 15309
+#define BSLS_MACROINCREMENTED_VALUE15309 15310
+#define BSLS_MACROINCREMENTED_VALUE15310 15311
+#define BSLS_MACROINCREMENTED_VALUE15311 15312
+#define BSLS_MACROINCREMENTED_VALUE15312 15313
+#define BSLS_MACROINCREMENTED_VALUE15313 15314
+#define BSLS_MACROINCREMENTED_VALUE15314 15315
+#define BSLS_MACROINCREMENTED_VALUE15315 15316
+#define BSLS_MACROINCREMENTED_VALUE15316 15317
+#define BSLS_MACROINCREMENTED_VALUE15317 15318
+#define BSLS_MACROINCREMENTED_VALUE15318 15319
+#define BSLS_MACROINCREMENTED_VALUE15319 15320
+#define BSLS_MACROINCREMENTED_VALUE15320 15321
+#define BSLS_MACROINCREMENTED_VALUE15321 15322
+#define BSLS_MACROINCREMENTED_VALUE15322 15323
+#define BSLS_MACROINCREMENTED_VALUE15323 15324
+#define BSLS_MACROINCREMENTED_VALUE15324 15325
+#define BSLS_MACROINCREMENTED_VALUE15325 15326
+#define BSLS_MACROINCREMENTED_VALUE15326 15327
+#define BSLS_MACROINCREMENTED_VALUE15327 15328
+#define BSLS_MACROINCREMENTED_VALUE15328 15329
+#define BSLS_MACROINCREMENTED_VALUE15329 15330
+#define BSLS_MACROINCREMENTED_VALUE15330 15331
+#define BSLS_MACROINCREMENTED_VALUE15331 15332
+#define BSLS_MACROINCREMENTED_VALUE15332 15333
+#define BSLS_MACROINCREMENTED_VALUE15333 15334
+#define BSLS_MACROINCREMENTED_VALUE15334 15335
+#define BSLS_MACROINCREMENTED_VALUE15335 15336
+#define BSLS_MACROINCREMENTED_VALUE15336 15337
+#define BSLS_MACROINCREMENTED_VALUE15337 15338
+#define BSLS_MACROINCREMENTED_VALUE15338 15339
+#define BSLS_MACROINCREMENTED_VALUE15339 15340
+#define BSLS_MACROINCREMENTED_VALUE15340 15341
+#define BSLS_MACROINCREMENTED_VALUE15341 15342
+#define BSLS_MACROINCREMENTED_VALUE15342 15343
+#define BSLS_MACROINCREMENTED_VALUE15343 15344
+#define BSLS_MACROINCREMENTED_VALUE15344 15345
+#define BSLS_MACROINCREMENTED_VALUE15345 15346
+#define BSLS_MACROINCREMENTED_VALUE15346 15347
+#define BSLS_MACROINCREMENTED_VALUE15347 15348
+#define BSLS_MACROINCREMENTED_VALUE15348 15349
+#define BSLS_MACROINCREMENTED_VALUE15349 15350
+#define BSLS_MACROINCREMENTED_VALUE15350 15351
+#define BSLS_MACROINCREMENTED_VALUE15351 15352
+#define BSLS_MACROINCREMENTED_VALUE15352 15353
+#define BSLS_MACROINCREMENTED_VALUE15353 15354
+#define BSLS_MACROINCREMENTED_VALUE15354 15355
+#define BSLS_MACROINCREMENTED_VALUE15355 15356
+#define BSLS_MACROINCREMENTED_VALUE15356 15357
+#define BSLS_MACROINCREMENTED_VALUE15357 15358
+#define BSLS_MACROINCREMENTED_VALUE15358 15359
+#define BSLS_MACROINCREMENTED_VALUE15359 15360
+#define BSLS_MACROINCREMENTED_VALUE15360 15361
+#define BSLS_MACROINCREMENTED_VALUE15361 15362
+#define BSLS_MACROINCREMENTED_VALUE15362 15363
+#define BSLS_MACROINCREMENTED_VALUE15363 15364
+#define BSLS_MACROINCREMENTED_VALUE15364 15365
+#define BSLS_MACROINCREMENTED_VALUE15365 15366
+#define BSLS_MACROINCREMENTED_VALUE15366 15367
+#define BSLS_MACROINCREMENTED_VALUE15367 15368
+#define BSLS_MACROINCREMENTED_VALUE15368 15369
+#define BSLS_MACROINCREMENTED_VALUE15369 15370
+#define BSLS_MACROINCREMENTED_VALUE15370 15371
+#define BSLS_MACROINCREMENTED_VALUE15371 15372
+#define BSLS_MACROINCREMENTED_VALUE15372 15373
+#define BSLS_MACROINCREMENTED_VALUE15373 15374
+#define BSLS_MACROINCREMENTED_VALUE15374 15375
+#define BSLS_MACROINCREMENTED_VALUE15375 15376
+#define BSLS_MACROINCREMENTED_VALUE15376 15377
+#define BSLS_MACROINCREMENTED_VALUE15377 15378
+#define BSLS_MACROINCREMENTED_VALUE15378 15379
+#define BSLS_MACROINCREMENTED_VALUE15379 15380
+#define BSLS_MACROINCREMENTED_VALUE15380 15381
+#define BSLS_MACROINCREMENTED_VALUE15381 15382
+#define BSLS_MACROINCREMENTED_VALUE15382 15383
+#define BSLS_MACROINCREMENTED_VALUE15383 15384
+#define BSLS_MACROINCREMENTED_VALUE15384 15385
+#define BSLS_MACROINCREMENTED_VALUE15385 15386
+#define BSLS_MACROINCREMENTED_VALUE15386 15387
+#define BSLS_MACROINCREMENTED_VALUE15387 15388
+#define BSLS_MACROINCREMENTED_VALUE15388 15389
+#define BSLS_MACROINCREMENTED_VALUE15389 15390
+#define BSLS_MACROINCREMENTED_VALUE15390 15391
+#define BSLS_MACROINCREMENTED_VALUE15391 15392
+#define BSLS_MACROINCREMENTED_VALUE15392 15393
+#define BSLS_MACROINCREMENTED_VALUE15393 15394
+#define BSLS_MACROINCREMENTED_VALUE15394 15395
+#define BSLS_MACROINCREMENTED_VALUE15395 15396
+#define BSLS_MACROINCREMENTED_VALUE15396 15397
+#define BSLS_MACROINCREMENTED_VALUE15397 15398
+#define BSLS_MACROINCREMENTED_VALUE15398 15399
+#define BSLS_MACROINCREMENTED_VALUE15399 15400
+#define BSLS_MACROINCREMENTED_VALUE15400 15401
+#define BSLS_MACROINCREMENTED_VALUE15401 15402
+#define BSLS_MACROINCREMENTED_VALUE15402 15403
+#define BSLS_MACROINCREMENTED_VALUE15403 15404
+#define BSLS_MACROINCREMENTED_VALUE15404 15405
+#define BSLS_MACROINCREMENTED_VALUE15405 15406
+#define BSLS_MACROINCREMENTED_VALUE15406 15407
+#define BSLS_MACROINCREMENTED_VALUE15407 15408
+#define BSLS_MACROINCREMENTED_VALUE15408 15409
+#define BSLS_MACROINCREMENTED_VALUE15409 15410
+#define BSLS_MACROINCREMENTED_VALUE15410 15411
+#define BSLS_MACROINCREMENTED_VALUE15411 15412
+#define BSLS_MACROINCREMENTED_VALUE15412 15413
+#define BSLS_MACROINCREMENTED_VALUE15413 15414
+#define BSLS_MACROINCREMENTED_VALUE15414 15415
+#define BSLS_MACROINCREMENTED_VALUE15415 15416
+#define BSLS_MACROINCREMENTED_VALUE15416 15417
+#define BSLS_MACROINCREMENTED_VALUE15417 15418
+#define BSLS_MACROINCREMENTED_VALUE15418 15419
+#define BSLS_MACROINCREMENTED_VALUE15419 15420
+#define BSLS_MACROINCREMENTED_VALUE15420 15421
+#define BSLS_MACROINCREMENTED_VALUE15421 15422
+#define BSLS_MACROINCREMENTED_VALUE15422 15423
+#define BSLS_MACROINCREMENTED_VALUE15423 15424
+#define BSLS_MACROINCREMENTED_VALUE15424 15425
+#define BSLS_MACROINCREMENTED_VALUE15425 15426
+#define BSLS_MACROINCREMENTED_VALUE15426 15427
+#define BSLS_MACROINCREMENTED_VALUE15427 15428
+#define BSLS_MACROINCREMENTED_VALUE15428 15429
+#define BSLS_MACROINCREMENTED_VALUE15429 15430
+#define BSLS_MACROINCREMENTED_VALUE15430 15431
+#define BSLS_MACROINCREMENTED_VALUE15431 15432
+#define BSLS_MACROINCREMENTED_VALUE15432 15433
+#define BSLS_MACROINCREMENTED_VALUE15433 15434
+#define BSLS_MACROINCREMENTED_VALUE15434 15435
+#define BSLS_MACROINCREMENTED_VALUE15435 15436
+#define BSLS_MACROINCREMENTED_VALUE15436 15437
+#define BSLS_MACROINCREMENTED_VALUE15437 15438
+#define BSLS_MACROINCREMENTED_VALUE15438 15439
+#define BSLS_MACROINCREMENTED_VALUE15439 15440
+#define BSLS_MACROINCREMENTED_VALUE15440 15441
+#define BSLS_MACROINCREMENTED_VALUE15441 15442
+#define BSLS_MACROINCREMENTED_VALUE15442 15443
+#define BSLS_MACROINCREMENTED_VALUE15443 15444
+#define BSLS_MACROINCREMENTED_VALUE15444 15445
+#define BSLS_MACROINCREMENTED_VALUE15445 15446
+#define BSLS_MACROINCREMENTED_VALUE15446 15447
+#define BSLS_MACROINCREMENTED_VALUE15447 15448
+#define BSLS_MACROINCREMENTED_VALUE15448 15449
+#define BSLS_MACROINCREMENTED_VALUE15449 15450
+#define BSLS_MACROINCREMENTED_VALUE15450 15451
+#define BSLS_MACROINCREMENTED_VALUE15451 15452
+#define BSLS_MACROINCREMENTED_VALUE15452 15453
+#define BSLS_MACROINCREMENTED_VALUE15453 15454
+#define BSLS_MACROINCREMENTED_VALUE15454 15455
+#define BSLS_MACROINCREMENTED_VALUE15455 15456
+#define BSLS_MACROINCREMENTED_VALUE15456 15457
+#define BSLS_MACROINCREMENTED_VALUE15457 15458
+#define BSLS_MACROINCREMENTED_VALUE15458 15459
+#define BSLS_MACROINCREMENTED_VALUE15459 15460
+#define BSLS_MACROINCREMENTED_VALUE15460 15461
+#define BSLS_MACROINCREMENTED_VALUE15461 15462
+#define BSLS_MACROINCREMENTED_VALUE15462 15463
+#define BSLS_MACROINCREMENTED_VALUE15463 15464
+#define BSLS_MACROINCREMENTED_VALUE15464 15465
+#define BSLS_MACROINCREMENTED_VALUE15465 15466
+#define BSLS_MACROINCREMENTED_VALUE15466 15467
+#define BSLS_MACROINCREMENTED_VALUE15467 15468
+#define BSLS_MACROINCREMENTED_VALUE15468 15469
+#define BSLS_MACROINCREMENTED_VALUE15469 15470
+#define BSLS_MACROINCREMENTED_VALUE15470 15471
+#define BSLS_MACROINCREMENTED_VALUE15471 15472
+#define BSLS_MACROINCREMENTED_VALUE15472 15473
+#define BSLS_MACROINCREMENTED_VALUE15473 15474
+#define BSLS_MACROINCREMENTED_VALUE15474 15475
+#define BSLS_MACROINCREMENTED_VALUE15475 15476
+#define BSLS_MACROINCREMENTED_VALUE15476 15477
+#define BSLS_MACROINCREMENTED_VALUE15477 15478
+#define BSLS_MACROINCREMENTED_VALUE15478 15479
+#define BSLS_MACROINCREMENTED_VALUE15479 15480
+#define BSLS_MACROINCREMENTED_VALUE15480 15481
+#define BSLS_MACROINCREMENTED_VALUE15481 15482
+#define BSLS_MACROINCREMENTED_VALUE15482 15483
+#define BSLS_MACROINCREMENTED_VALUE15483 15484
+#define BSLS_MACROINCREMENTED_VALUE15484 15485
+#define BSLS_MACROINCREMENTED_VALUE15485 15486
+#define BSLS_MACROINCREMENTED_VALUE15486 15487
+#define BSLS_MACROINCREMENTED_VALUE15487 15488
+#define BSLS_MACROINCREMENTED_VALUE15488 15489
+#define BSLS_MACROINCREMENTED_VALUE15489 15490
+#define BSLS_MACROINCREMENTED_VALUE15490 15491
+#define BSLS_MACROINCREMENTED_VALUE15491 15492
+#define BSLS_MACROINCREMENTED_VALUE15492 15493
+#define BSLS_MACROINCREMENTED_VALUE15493 15494
+#define BSLS_MACROINCREMENTED_VALUE15494 15495
+#define BSLS_MACROINCREMENTED_VALUE15495 15496
+#define BSLS_MACROINCREMENTED_VALUE15496 15497
+#define BSLS_MACROINCREMENTED_VALUE15497 15498
+#define BSLS_MACROINCREMENTED_VALUE15498 15499
+#define BSLS_MACROINCREMENTED_VALUE15499 15500
+#define BSLS_MACROINCREMENTED_VALUE15500 15501
+#define BSLS_MACROINCREMENTED_VALUE15501 15502
+#define BSLS_MACROINCREMENTED_VALUE15502 15503
+#define BSLS_MACROINCREMENTED_VALUE15503 15504
+#define BSLS_MACROINCREMENTED_VALUE15504 15505
+#define BSLS_MACROINCREMENTED_VALUE15505 15506
+#define BSLS_MACROINCREMENTED_VALUE15506 15507
+#define BSLS_MACROINCREMENTED_VALUE15507 15508
+#define BSLS_MACROINCREMENTED_VALUE15508 15509
+#define BSLS_MACROINCREMENTED_VALUE15509 15510
+#define BSLS_MACROINCREMENTED_VALUE15510 15511
+#define BSLS_MACROINCREMENTED_VALUE15511 15512
+#define BSLS_MACROINCREMENTED_VALUE15512 15513
+#define BSLS_MACROINCREMENTED_VALUE15513 15514
+#define BSLS_MACROINCREMENTED_VALUE15514 15515
+#define BSLS_MACROINCREMENTED_VALUE15515 15516
+#define BSLS_MACROINCREMENTED_VALUE15516 15517
+#define BSLS_MACROINCREMENTED_VALUE15517 15518
+#define BSLS_MACROINCREMENTED_VALUE15518 15519
+#define BSLS_MACROINCREMENTED_VALUE15519 15520
+#define BSLS_MACROINCREMENTED_VALUE15520 15521
+#define BSLS_MACROINCREMENTED_VALUE15521 15522
+#define BSLS_MACROINCREMENTED_VALUE15522 15523
+#define BSLS_MACROINCREMENTED_VALUE15523 15524
+#define BSLS_MACROINCREMENTED_VALUE15524 15525
+#define BSLS_MACROINCREMENTED_VALUE15525 15526
+#define BSLS_MACROINCREMENTED_VALUE15526 15527
+#define BSLS_MACROINCREMENTED_VALUE15527 15528
+#define BSLS_MACROINCREMENTED_VALUE15528 15529
+#define BSLS_MACROINCREMENTED_VALUE15529 15530
+#define BSLS_MACROINCREMENTED_VALUE15530 15531
+#define BSLS_MACROINCREMENTED_VALUE15531 15532
+#define BSLS_MACROINCREMENTED_VALUE15532 15533
+#define BSLS_MACROINCREMENTED_VALUE15533 15534
+#define BSLS_MACROINCREMENTED_VALUE15534 15535
+#define BSLS_MACROINCREMENTED_VALUE15535 15536
+#define BSLS_MACROINCREMENTED_VALUE15536 15537
+#define BSLS_MACROINCREMENTED_VALUE15537 15538
+#define BSLS_MACROINCREMENTED_VALUE15538 15539
+#define BSLS_MACROINCREMENTED_VALUE15539 15540
+#define BSLS_MACROINCREMENTED_VALUE15540 15541
+#define BSLS_MACROINCREMENTED_VALUE15541 15542
+#define BSLS_MACROINCREMENTED_VALUE15542 15543
+#define BSLS_MACROINCREMENTED_VALUE15543 15544
+#define BSLS_MACROINCREMENTED_VALUE15544 15545
+#define BSLS_MACROINCREMENTED_VALUE15545 15546
+#define BSLS_MACROINCREMENTED_VALUE15546 15547
+#define BSLS_MACROINCREMENTED_VALUE15547 15548
+#define BSLS_MACROINCREMENTED_VALUE15548 15549
+#define BSLS_MACROINCREMENTED_VALUE15549 15550
+#define BSLS_MACROINCREMENTED_VALUE15550 15551
+#define BSLS_MACROINCREMENTED_VALUE15551 15552
+#define BSLS_MACROINCREMENTED_VALUE15552 15553
+#define BSLS_MACROINCREMENTED_VALUE15553 15554
+#define BSLS_MACROINCREMENTED_VALUE15554 15555
+#define BSLS_MACROINCREMENTED_VALUE15555 15556
+#define BSLS_MACROINCREMENTED_VALUE15556 15557
+#define BSLS_MACROINCREMENTED_VALUE15557 15558
+#define BSLS_MACROINCREMENTED_VALUE15558 15559
+#define BSLS_MACROINCREMENTED_VALUE15559 15560
+#define BSLS_MACROINCREMENTED_VALUE15560 15561
+#define BSLS_MACROINCREMENTED_VALUE15561 15562
+#define BSLS_MACROINCREMENTED_VALUE15562 15563
+#define BSLS_MACROINCREMENTED_VALUE15563 15564
+#define BSLS_MACROINCREMENTED_VALUE15564 15565
+#define BSLS_MACROINCREMENTED_VALUE15565 15566
+#define BSLS_MACROINCREMENTED_VALUE15566 15567
+#define BSLS_MACROINCREMENTED_VALUE15567 15568
+#define BSLS_MACROINCREMENTED_VALUE15568 15569
+#define BSLS_MACROINCREMENTED_VALUE15569 15570
+#define BSLS_MACROINCREMENTED_VALUE15570 15571
+#define BSLS_MACROINCREMENTED_VALUE15571 15572
+#define BSLS_MACROINCREMENTED_VALUE15572 15573
+#define BSLS_MACROINCREMENTED_VALUE15573 15574
+#define BSLS_MACROINCREMENTED_VALUE15574 15575
+#define BSLS_MACROINCREMENTED_VALUE15575 15576
+#define BSLS_MACROINCREMENTED_VALUE15576 15577
+#define BSLS_MACROINCREMENTED_VALUE15577 15578
+#define BSLS_MACROINCREMENTED_VALUE15578 15579
+#define BSLS_MACROINCREMENTED_VALUE15579 15580
+#define BSLS_MACROINCREMENTED_VALUE15580 15581
+#define BSLS_MACROINCREMENTED_VALUE15581 15582
+#define BSLS_MACROINCREMENTED_VALUE15582 15583
+#define BSLS_MACROINCREMENTED_VALUE15583 15584
+#define BSLS_MACROINCREMENTED_VALUE15584 15585
+#define BSLS_MACROINCREMENTED_VALUE15585 15586
+#define BSLS_MACROINCREMENTED_VALUE15586 15587
+#define BSLS_MACROINCREMENTED_VALUE15587 15588
+#define BSLS_MACROINCREMENTED_VALUE15588 15589
+#define BSLS_MACROINCREMENTED_VALUE15589 15590
+#define BSLS_MACROINCREMENTED_VALUE15590 15591
+#define BSLS_MACROINCREMENTED_VALUE15591 15592
+#define BSLS_MACROINCREMENTED_VALUE15592 15593
+#define BSLS_MACROINCREMENTED_VALUE15593 15594
+#define BSLS_MACROINCREMENTED_VALUE15594 15595
+#define BSLS_MACROINCREMENTED_VALUE15595 15596
+#define BSLS_MACROINCREMENTED_VALUE15596 15597
+#define BSLS_MACROINCREMENTED_VALUE15597 15598
+#define BSLS_MACROINCREMENTED_VALUE15598 15599
+#define BSLS_MACROINCREMENTED_VALUE15599 15600
+#define BSLS_MACROINCREMENTED_VALUE15600 15601
+#define BSLS_MACROINCREMENTED_VALUE15601 15602
+#define BSLS_MACROINCREMENTED_VALUE15602 15603
+#define BSLS_MACROINCREMENTED_VALUE15603 15604
+#define BSLS_MACROINCREMENTED_VALUE15604 15605
+#define BSLS_MACROINCREMENTED_VALUE15605 15606
+#define BSLS_MACROINCREMENTED_VALUE15606 15607
+#define BSLS_MACROINCREMENTED_VALUE15607 15608
+#define BSLS_MACROINCREMENTED_VALUE15608 15609
+#define BSLS_MACROINCREMENTED_VALUE15609 15610
+#define BSLS_MACROINCREMENTED_VALUE15610 15611
+#define BSLS_MACROINCREMENTED_VALUE15611 15612
+#define BSLS_MACROINCREMENTED_VALUE15612 15613
+#define BSLS_MACROINCREMENTED_VALUE15613 15614
+#define BSLS_MACROINCREMENTED_VALUE15614 15615
+#define BSLS_MACROINCREMENTED_VALUE15615 15616
+#define BSLS_MACROINCREMENTED_VALUE15616 15617
+#define BSLS_MACROINCREMENTED_VALUE15617 15618
+#define BSLS_MACROINCREMENTED_VALUE15618 15619
+#define BSLS_MACROINCREMENTED_VALUE15619 15620
+#define BSLS_MACROINCREMENTED_VALUE15620 15621
+#define BSLS_MACROINCREMENTED_VALUE15621 15622
+#define BSLS_MACROINCREMENTED_VALUE15622 15623
+#define BSLS_MACROINCREMENTED_VALUE15623 15624
+#define BSLS_MACROINCREMENTED_VALUE15624 15625
+#define BSLS_MACROINCREMENTED_VALUE15625 15626
+#define BSLS_MACROINCREMENTED_VALUE15626 15627
+#define BSLS_MACROINCREMENTED_VALUE15627 15628
+#define BSLS_MACROINCREMENTED_VALUE15628 15629
+#define BSLS_MACROINCREMENTED_VALUE15629 15630
+#define BSLS_MACROINCREMENTED_VALUE15630 15631
+#define BSLS_MACROINCREMENTED_VALUE15631 15632
+#define BSLS_MACROINCREMENTED_VALUE15632 15633
+#define BSLS_MACROINCREMENTED_VALUE15633 15634
+#define BSLS_MACROINCREMENTED_VALUE15634 15635
+#define BSLS_MACROINCREMENTED_VALUE15635 15636
+#define BSLS_MACROINCREMENTED_VALUE15636 15637
+#define BSLS_MACROINCREMENTED_VALUE15637 15638
+#define BSLS_MACROINCREMENTED_VALUE15638 15639
+#define BSLS_MACROINCREMENTED_VALUE15639 15640
+#define BSLS_MACROINCREMENTED_VALUE15640 15641
+#define BSLS_MACROINCREMENTED_VALUE15641 15642
+#define BSLS_MACROINCREMENTED_VALUE15642 15643
+#define BSLS_MACROINCREMENTED_VALUE15643 15644
+#define BSLS_MACROINCREMENTED_VALUE15644 15645
+#define BSLS_MACROINCREMENTED_VALUE15645 15646
+#define BSLS_MACROINCREMENTED_VALUE15646 15647
+#define BSLS_MACROINCREMENTED_VALUE15647 15648
+#define BSLS_MACROINCREMENTED_VALUE15648 15649
+#define BSLS_MACROINCREMENTED_VALUE15649 15650
+#define BSLS_MACROINCREMENTED_VALUE15650 15651
+#define BSLS_MACROINCREMENTED_VALUE15651 15652
+#define BSLS_MACROINCREMENTED_VALUE15652 15653
+#define BSLS_MACROINCREMENTED_VALUE15653 15654
+#define BSLS_MACROINCREMENTED_VALUE15654 15655
+#define BSLS_MACROINCREMENTED_VALUE15655 15656
+#define BSLS_MACROINCREMENTED_VALUE15656 15657
+#define BSLS_MACROINCREMENTED_VALUE15657 15658
+#define BSLS_MACROINCREMENTED_VALUE15658 15659
+#define BSLS_MACROINCREMENTED_VALUE15659 15660
+#define BSLS_MACROINCREMENTED_VALUE15660 15661
+#define BSLS_MACROINCREMENTED_VALUE15661 15662
+#define BSLS_MACROINCREMENTED_VALUE15662 15663
+#define BSLS_MACROINCREMENTED_VALUE15663 15664
+#define BSLS_MACROINCREMENTED_VALUE15664 15665
+#define BSLS_MACROINCREMENTED_VALUE15665 15666
+#define BSLS_MACROINCREMENTED_VALUE15666 15667
+#define BSLS_MACROINCREMENTED_VALUE15667 15668
+#define BSLS_MACROINCREMENTED_VALUE15668 15669
+#define BSLS_MACROINCREMENTED_VALUE15669 15670
+#define BSLS_MACROINCREMENTED_VALUE15670 15671
+#define BSLS_MACROINCREMENTED_VALUE15671 15672
+#define BSLS_MACROINCREMENTED_VALUE15672 15673
+#define BSLS_MACROINCREMENTED_VALUE15673 15674
+#define BSLS_MACROINCREMENTED_VALUE15674 15675
+#define BSLS_MACROINCREMENTED_VALUE15675 15676
+#define BSLS_MACROINCREMENTED_VALUE15676 15677
+#define BSLS_MACROINCREMENTED_VALUE15677 15678
+#define BSLS_MACROINCREMENTED_VALUE15678 15679
+#define BSLS_MACROINCREMENTED_VALUE15679 15680
+#define BSLS_MACROINCREMENTED_VALUE15680 15681
+#define BSLS_MACROINCREMENTED_VALUE15681 15682
+#define BSLS_MACROINCREMENTED_VALUE15682 15683
+#define BSLS_MACROINCREMENTED_VALUE15683 15684
+#define BSLS_MACROINCREMENTED_VALUE15684 15685
+#define BSLS_MACROINCREMENTED_VALUE15685 15686
+#define BSLS_MACROINCREMENTED_VALUE15686 15687
+#define BSLS_MACROINCREMENTED_VALUE15687 15688
+#define BSLS_MACROINCREMENTED_VALUE15688 15689
+#define BSLS_MACROINCREMENTED_VALUE15689 15690
+#define BSLS_MACROINCREMENTED_VALUE15690 15691
+#define BSLS_MACROINCREMENTED_VALUE15691 15692
+#define BSLS_MACROINCREMENTED_VALUE15692 15693
+#define BSLS_MACROINCREMENTED_VALUE15693 15694
+#define BSLS_MACROINCREMENTED_VALUE15694 15695
+#define BSLS_MACROINCREMENTED_VALUE15695 15696
+#define BSLS_MACROINCREMENTED_VALUE15696 15697
+#define BSLS_MACROINCREMENTED_VALUE15697 15698
+#define BSLS_MACROINCREMENTED_VALUE15698 15699
+#define BSLS_MACROINCREMENTED_VALUE15699 15700
+#define BSLS_MACROINCREMENTED_VALUE15700 15701
+#define BSLS_MACROINCREMENTED_VALUE15701 15702
+#define BSLS_MACROINCREMENTED_VALUE15702 15703
+#define BSLS_MACROINCREMENTED_VALUE15703 15704
+#define BSLS_MACROINCREMENTED_VALUE15704 15705
+#define BSLS_MACROINCREMENTED_VALUE15705 15706
+#define BSLS_MACROINCREMENTED_VALUE15706 15707
+#define BSLS_MACROINCREMENTED_VALUE15707 15708
+#define BSLS_MACROINCREMENTED_VALUE15708 15709
+#define BSLS_MACROINCREMENTED_VALUE15709 15710
+#define BSLS_MACROINCREMENTED_VALUE15710 15711
+#define BSLS_MACROINCREMENTED_VALUE15711 15712
+#define BSLS_MACROINCREMENTED_VALUE15712 15713
+#define BSLS_MACROINCREMENTED_VALUE15713 15714
+#define BSLS_MACROINCREMENTED_VALUE15714 15715
+#define BSLS_MACROINCREMENTED_VALUE15715 15716
+#define BSLS_MACROINCREMENTED_VALUE15716 15717
+#define BSLS_MACROINCREMENTED_VALUE15717 15718
+#define BSLS_MACROINCREMENTED_VALUE15718 15719
+#define BSLS_MACROINCREMENTED_VALUE15719 15720
+#define BSLS_MACROINCREMENTED_VALUE15720 15721
+#define BSLS_MACROINCREMENTED_VALUE15721 15722
+#define BSLS_MACROINCREMENTED_VALUE15722 15723
+#define BSLS_MACROINCREMENTED_VALUE15723 15724
+#define BSLS_MACROINCREMENTED_VALUE15724 15725
+#define BSLS_MACROINCREMENTED_VALUE15725 15726
+#define BSLS_MACROINCREMENTED_VALUE15726 15727
+#define BSLS_MACROINCREMENTED_VALUE15727 15728
+#define BSLS_MACROINCREMENTED_VALUE15728 15729
+#define BSLS_MACROINCREMENTED_VALUE15729 15730
+#define BSLS_MACROINCREMENTED_VALUE15730 15731
+#define BSLS_MACROINCREMENTED_VALUE15731 15732
+#define BSLS_MACROINCREMENTED_VALUE15732 15733
+#define BSLS_MACROINCREMENTED_VALUE15733 15734
+#define BSLS_MACROINCREMENTED_VALUE15734 15735
+#define BSLS_MACROINCREMENTED_VALUE15735 15736
+#define BSLS_MACROINCREMENTED_VALUE15736 15737
+#define BSLS_MACROINCREMENTED_VALUE15737 15738
+#define BSLS_MACROINCREMENTED_VALUE15738 15739
+#define BSLS_MACROINCREMENTED_VALUE15739 15740
+#define BSLS_MACROINCREMENTED_VALUE15740 15741
+#define BSLS_MACROINCREMENTED_VALUE15741 15742
+#define BSLS_MACROINCREMENTED_VALUE15742 15743
+#define BSLS_MACROINCREMENTED_VALUE15743 15744
+#define BSLS_MACROINCREMENTED_VALUE15744 15745
+#define BSLS_MACROINCREMENTED_VALUE15745 15746
+#define BSLS_MACROINCREMENTED_VALUE15746 15747
+#define BSLS_MACROINCREMENTED_VALUE15747 15748
+#define BSLS_MACROINCREMENTED_VALUE15748 15749
+#define BSLS_MACROINCREMENTED_VALUE15749 15750
+#define BSLS_MACROINCREMENTED_VALUE15750 15751
+#define BSLS_MACROINCREMENTED_VALUE15751 15752
+#define BSLS_MACROINCREMENTED_VALUE15752 15753
+#define BSLS_MACROINCREMENTED_VALUE15753 15754
+#define BSLS_MACROINCREMENTED_VALUE15754 15755
+#define BSLS_MACROINCREMENTED_VALUE15755 15756
+#define BSLS_MACROINCREMENTED_VALUE15756 15757
+#define BSLS_MACROINCREMENTED_VALUE15757 15758
+#define BSLS_MACROINCREMENTED_VALUE15758 15759
+#define BSLS_MACROINCREMENTED_VALUE15759 15760
+#define BSLS_MACROINCREMENTED_VALUE15760 15761
+#define BSLS_MACROINCREMENTED_VALUE15761 15762
+#define BSLS_MACROINCREMENTED_VALUE15762 15763
+#define BSLS_MACROINCREMENTED_VALUE15763 15764
+#define BSLS_MACROINCREMENTED_VALUE15764 15765
+#define BSLS_MACROINCREMENTED_VALUE15765 15766
+#define BSLS_MACROINCREMENTED_VALUE15766 15767
+#define BSLS_MACROINCREMENTED_VALUE15767 15768
+#define BSLS_MACROINCREMENTED_VALUE15768 15769
+#define BSLS_MACROINCREMENTED_VALUE15769 15770
+#define BSLS_MACROINCREMENTED_VALUE15770 15771
+#define BSLS_MACROINCREMENTED_VALUE15771 15772
+#define BSLS_MACROINCREMENTED_VALUE15772 15773
+#define BSLS_MACROINCREMENTED_VALUE15773 15774
+#define BSLS_MACROINCREMENTED_VALUE15774 15775
+#define BSLS_MACROINCREMENTED_VALUE15775 15776
+#define BSLS_MACROINCREMENTED_VALUE15776 15777
+#define BSLS_MACROINCREMENTED_VALUE15777 15778
+#define BSLS_MACROINCREMENTED_VALUE15778 15779
+#define BSLS_MACROINCREMENTED_VALUE15779 15780
+#define BSLS_MACROINCREMENTED_VALUE15780 15781
+#define BSLS_MACROINCREMENTED_VALUE15781 15782
+#define BSLS_MACROINCREMENTED_VALUE15782 15783
+#define BSLS_MACROINCREMENTED_VALUE15783 15784
+#define BSLS_MACROINCREMENTED_VALUE15784 15785
+#define BSLS_MACROINCREMENTED_VALUE15785 15786
+#define BSLS_MACROINCREMENTED_VALUE15786 15787
+#define BSLS_MACROINCREMENTED_VALUE15787 15788
+#define BSLS_MACROINCREMENTED_VALUE15788 15789
+#define BSLS_MACROINCREMENTED_VALUE15789 15790
+#define BSLS_MACROINCREMENTED_VALUE15790 15791
+#define BSLS_MACROINCREMENTED_VALUE15791 15792
+#define BSLS_MACROINCREMENTED_VALUE15792 15793
+#define BSLS_MACROINCREMENTED_VALUE15793 15794
+#define BSLS_MACROINCREMENTED_VALUE15794 15795
+#define BSLS_MACROINCREMENTED_VALUE15795 15796
+#define BSLS_MACROINCREMENTED_VALUE15796 15797
+#define BSLS_MACROINCREMENTED_VALUE15797 15798
+#define BSLS_MACROINCREMENTED_VALUE15798 15799
+#define BSLS_MACROINCREMENTED_VALUE15799 15800
+#define BSLS_MACROINCREMENTED_VALUE15800 15801
+#define BSLS_MACROINCREMENTED_VALUE15801 15802
+#define BSLS_MACROINCREMENTED_VALUE15802 15803
+#define BSLS_MACROINCREMENTED_VALUE15803 15804
+#define BSLS_MACROINCREMENTED_VALUE15804 15805
+#define BSLS_MACROINCREMENTED_VALUE15805 15806
+#define BSLS_MACROINCREMENTED_VALUE15806 15807
+#define BSLS_MACROINCREMENTED_VALUE15807 15808
+#define BSLS_MACROINCREMENTED_VALUE15808 15809
+#define BSLS_MACROINCREMENTED_VALUE15809 15810
+#define BSLS_MACROINCREMENTED_VALUE15810 15811
+#define BSLS_MACROINCREMENTED_VALUE15811 15812
+#define BSLS_MACROINCREMENTED_VALUE15812 15813
+#define BSLS_MACROINCREMENTED_VALUE15813 15814
+#define BSLS_MACROINCREMENTED_VALUE15814 15815
+#define BSLS_MACROINCREMENTED_VALUE15815 15816
+#define BSLS_MACROINCREMENTED_VALUE15816 15817
+#define BSLS_MACROINCREMENTED_VALUE15817 15818
+#define BSLS_MACROINCREMENTED_VALUE15818 15819
+#define BSLS_MACROINCREMENTED_VALUE15819 15820
+#define BSLS_MACROINCREMENTED_VALUE15820 15821
+#define BSLS_MACROINCREMENTED_VALUE15821 15822
+#define BSLS_MACROINCREMENTED_VALUE15822 15823
+#define BSLS_MACROINCREMENTED_VALUE15823 15824
+#define BSLS_MACROINCREMENTED_VALUE15824 15825
+#define BSLS_MACROINCREMENTED_VALUE15825 15826
+#define BSLS_MACROINCREMENTED_VALUE15826 15827
+#define BSLS_MACROINCREMENTED_VALUE15827 15828
+#define BSLS_MACROINCREMENTED_VALUE15828 15829
+#define BSLS_MACROINCREMENTED_VALUE15829 15830
+#define BSLS_MACROINCREMENTED_VALUE15830 15831
+#define BSLS_MACROINCREMENTED_VALUE15831 15832
+#define BSLS_MACROINCREMENTED_VALUE15832 15833
+#define BSLS_MACROINCREMENTED_VALUE15833 15834
+#define BSLS_MACROINCREMENTED_VALUE15834 15835
+#define BSLS_MACROINCREMENTED_VALUE15835 15836
+#define BSLS_MACROINCREMENTED_VALUE15836 15837
+#define BSLS_MACROINCREMENTED_VALUE15837 15838
+#define BSLS_MACROINCREMENTED_VALUE15838 15839
+#define BSLS_MACROINCREMENTED_VALUE15839 15840
+#define BSLS_MACROINCREMENTED_VALUE15840 15841
+#define BSLS_MACROINCREMENTED_VALUE15841 15842
+#define BSLS_MACROINCREMENTED_VALUE15842 15843
+#define BSLS_MACROINCREMENTED_VALUE15843 15844
+#define BSLS_MACROINCREMENTED_VALUE15844 15845
+#define BSLS_MACROINCREMENTED_VALUE15845 15846
+#define BSLS_MACROINCREMENTED_VALUE15846 15847
+#define BSLS_MACROINCREMENTED_VALUE15847 15848
+#define BSLS_MACROINCREMENTED_VALUE15848 15849
+#define BSLS_MACROINCREMENTED_VALUE15849 15850
+#define BSLS_MACROINCREMENTED_VALUE15850 15851
+#define BSLS_MACROINCREMENTED_VALUE15851 15852
+#define BSLS_MACROINCREMENTED_VALUE15852 15853
+#define BSLS_MACROINCREMENTED_VALUE15853 15854
+#define BSLS_MACROINCREMENTED_VALUE15854 15855
+#define BSLS_MACROINCREMENTED_VALUE15855 15856
+#define BSLS_MACROINCREMENTED_VALUE15856 15857
+#define BSLS_MACROINCREMENTED_VALUE15857 15858
+#define BSLS_MACROINCREMENTED_VALUE15858 15859
+#define BSLS_MACROINCREMENTED_VALUE15859 15860
+#define BSLS_MACROINCREMENTED_VALUE15860 15861
+#define BSLS_MACROINCREMENTED_VALUE15861 15862
+#define BSLS_MACROINCREMENTED_VALUE15862 15863
+#define BSLS_MACROINCREMENTED_VALUE15863 15864
+#define BSLS_MACROINCREMENTED_VALUE15864 15865
+#define BSLS_MACROINCREMENTED_VALUE15865 15866
+#define BSLS_MACROINCREMENTED_VALUE15866 15867
+#define BSLS_MACROINCREMENTED_VALUE15867 15868
+#define BSLS_MACROINCREMENTED_VALUE15868 15869
+#define BSLS_MACROINCREMENTED_VALUE15869 15870
+#define BSLS_MACROINCREMENTED_VALUE15870 15871
+#define BSLS_MACROINCREMENTED_VALUE15871 15872
+#define BSLS_MACROINCREMENTED_VALUE15872 15873
+#define BSLS_MACROINCREMENTED_VALUE15873 15874
+#define BSLS_MACROINCREMENTED_VALUE15874 15875
+#define BSLS_MACROINCREMENTED_VALUE15875 15876
+#define BSLS_MACROINCREMENTED_VALUE15876 15877
+#define BSLS_MACROINCREMENTED_VALUE15877 15878
+#define BSLS_MACROINCREMENTED_VALUE15878 15879
+#define BSLS_MACROINCREMENTED_VALUE15879 15880
+#define BSLS_MACROINCREMENTED_VALUE15880 15881
+#define BSLS_MACROINCREMENTED_VALUE15881 15882
+#define BSLS_MACROINCREMENTED_VALUE15882 15883
+#define BSLS_MACROINCREMENTED_VALUE15883 15884
+#define BSLS_MACROINCREMENTED_VALUE15884 15885
+#define BSLS_MACROINCREMENTED_VALUE15885 15886
+#define BSLS_MACROINCREMENTED_VALUE15886 15887
+#define BSLS_MACROINCREMENTED_VALUE15887 15888
+#define BSLS_MACROINCREMENTED_VALUE15888 15889
+#define BSLS_MACROINCREMENTED_VALUE15889 15890
+#define BSLS_MACROINCREMENTED_VALUE15890 15891
+#define BSLS_MACROINCREMENTED_VALUE15891 15892
+#define BSLS_MACROINCREMENTED_VALUE15892 15893
+#define BSLS_MACROINCREMENTED_VALUE15893 15894
+#define BSLS_MACROINCREMENTED_VALUE15894 15895
+#define BSLS_MACROINCREMENTED_VALUE15895 15896
+#define BSLS_MACROINCREMENTED_VALUE15896 15897
+#define BSLS_MACROINCREMENTED_VALUE15897 15898
+#define BSLS_MACROINCREMENTED_VALUE15898 15899
+#define BSLS_MACROINCREMENTED_VALUE15899 15900
+#define BSLS_MACROINCREMENTED_VALUE15900 15901
+#define BSLS_MACROINCREMENTED_VALUE15901 15902
+#define BSLS_MACROINCREMENTED_VALUE15902 15903
+#define BSLS_MACROINCREMENTED_VALUE15903 15904
+#define BSLS_MACROINCREMENTED_VALUE15904 15905
+#define BSLS_MACROINCREMENTED_VALUE15905 15906
+#define BSLS_MACROINCREMENTED_VALUE15906 15907
+#define BSLS_MACROINCREMENTED_VALUE15907 15908
+#define BSLS_MACROINCREMENTED_VALUE15908 15909
+#define BSLS_MACROINCREMENTED_VALUE15909 15910
+#define BSLS_MACROINCREMENTED_VALUE15910 15911
+#define BSLS_MACROINCREMENTED_VALUE15911 15912
+#define BSLS_MACROINCREMENTED_VALUE15912 15913
+#define BSLS_MACROINCREMENTED_VALUE15913 15914
+#define BSLS_MACROINCREMENTED_VALUE15914 15915
+#define BSLS_MACROINCREMENTED_VALUE15915 15916
+#define BSLS_MACROINCREMENTED_VALUE15916 15917
+#define BSLS_MACROINCREMENTED_VALUE15917 15918
+#define BSLS_MACROINCREMENTED_VALUE15918 15919
+#define BSLS_MACROINCREMENTED_VALUE15919 15920
+#define BSLS_MACROINCREMENTED_VALUE15920 15921
+#define BSLS_MACROINCREMENTED_VALUE15921 15922
+#define BSLS_MACROINCREMENTED_VALUE15922 15923
+#define BSLS_MACROINCREMENTED_VALUE15923 15924
+#define BSLS_MACROINCREMENTED_VALUE15924 15925
+#define BSLS_MACROINCREMENTED_VALUE15925 15926
+#define BSLS_MACROINCREMENTED_VALUE15926 15927
+#define BSLS_MACROINCREMENTED_VALUE15927 15928
+#define BSLS_MACROINCREMENTED_VALUE15928 15929
+#define BSLS_MACROINCREMENTED_VALUE15929 15930
+#define BSLS_MACROINCREMENTED_VALUE15930 15931
+#define BSLS_MACROINCREMENTED_VALUE15931 15932
+#define BSLS_MACROINCREMENTED_VALUE15932 15933
+#define BSLS_MACROINCREMENTED_VALUE15933 15934
+#define BSLS_MACROINCREMENTED_VALUE15934 15935
+#define BSLS_MACROINCREMENTED_VALUE15935 15936
+#define BSLS_MACROINCREMENTED_VALUE15936 15937
+#define BSLS_MACROINCREMENTED_VALUE15937 15938
+#define BSLS_MACROINCREMENTED_VALUE15938 15939
+#define BSLS_MACROINCREMENTED_VALUE15939 15940
+#define BSLS_MACROINCREMENTED_VALUE15940 15941
+#define BSLS_MACROINCREMENTED_VALUE15941 15942
+#define BSLS_MACROINCREMENTED_VALUE15942 15943
+#define BSLS_MACROINCREMENTED_VALUE15943 15944
+#define BSLS_MACROINCREMENTED_VALUE15944 15945
+#define BSLS_MACROINCREMENTED_VALUE15945 15946
+#define BSLS_MACROINCREMENTED_VALUE15946 15947
+#define BSLS_MACROINCREMENTED_VALUE15947 15948
+#define BSLS_MACROINCREMENTED_VALUE15948 15949
+#define BSLS_MACROINCREMENTED_VALUE15949 15950
+#define BSLS_MACROINCREMENTED_VALUE15950 15951
+#define BSLS_MACROINCREMENTED_VALUE15951 15952
+#define BSLS_MACROINCREMENTED_VALUE15952 15953
+#define BSLS_MACROINCREMENTED_VALUE15953 15954
+#define BSLS_MACROINCREMENTED_VALUE15954 15955
+#define BSLS_MACROINCREMENTED_VALUE15955 15956
+#define BSLS_MACROINCREMENTED_VALUE15956 15957
+#define BSLS_MACROINCREMENTED_VALUE15957 15958
+#define BSLS_MACROINCREMENTED_VALUE15958 15959
+#define BSLS_MACROINCREMENTED_VALUE15959 15960
+#define BSLS_MACROINCREMENTED_VALUE15960 15961
+#define BSLS_MACROINCREMENTED_VALUE15961 15962
+#define BSLS_MACROINCREMENTED_VALUE15962 15963
+#define BSLS_MACROINCREMENTED_VALUE15963 15964
+#define BSLS_MACROINCREMENTED_VALUE15964 15965
+#define BSLS_MACROINCREMENTED_VALUE15965 15966
+#define BSLS_MACROINCREMENTED_VALUE15966 15967
+#define BSLS_MACROINCREMENTED_VALUE15967 15968
+#define BSLS_MACROINCREMENTED_VALUE15968 15969
+#define BSLS_MACROINCREMENTED_VALUE15969 15970
+#define BSLS_MACROINCREMENTED_VALUE15970 15971
+#define BSLS_MACROINCREMENTED_VALUE15971 15972
+#define BSLS_MACROINCREMENTED_VALUE15972 15973
+#define BSLS_MACROINCREMENTED_VALUE15973 15974
+#define BSLS_MACROINCREMENTED_VALUE15974 15975
+#define BSLS_MACROINCREMENTED_VALUE15975 15976
+#define BSLS_MACROINCREMENTED_VALUE15976 15977
+#define BSLS_MACROINCREMENTED_VALUE15977 15978
+#define BSLS_MACROINCREMENTED_VALUE15978 15979
+#define BSLS_MACROINCREMENTED_VALUE15979 15980
+#define BSLS_MACROINCREMENTED_VALUE15980 15981
+#define BSLS_MACROINCREMENTED_VALUE15981 15982
+#define BSLS_MACROINCREMENTED_VALUE15982 15983
+#define BSLS_MACROINCREMENTED_VALUE15983 15984
+#define BSLS_MACROINCREMENTED_VALUE15984 15985
+#define BSLS_MACROINCREMENTED_VALUE15985 15986
+#define BSLS_MACROINCREMENTED_VALUE15986 15987
+#define BSLS_MACROINCREMENTED_VALUE15987 15988
+#define BSLS_MACROINCREMENTED_VALUE15988 15989
+#define BSLS_MACROINCREMENTED_VALUE15989 15990
+#define BSLS_MACROINCREMENTED_VALUE15990 15991
+#define BSLS_MACROINCREMENTED_VALUE15991 15992
+#define BSLS_MACROINCREMENTED_VALUE15992 15993
+#define BSLS_MACROINCREMENTED_VALUE15993 15994
+#define BSLS_MACROINCREMENTED_VALUE15994 15995
+#define BSLS_MACROINCREMENTED_VALUE15995 15996
+#define BSLS_MACROINCREMENTED_VALUE15996 15997
+#define BSLS_MACROINCREMENTED_VALUE15997 15998
+#define BSLS_MACROINCREMENTED_VALUE15998 15999
+#define BSLS_MACROINCREMENTED_VALUE15999 16000
+#define BSLS_MACROINCREMENTED_VALUE16000 16001
+#define BSLS_MACROINCREMENTED_VALUE16001 16002
+#define BSLS_MACROINCREMENTED_VALUE16002 16003
+#define BSLS_MACROINCREMENTED_VALUE16003 16004
+#define BSLS_MACROINCREMENTED_VALUE16004 16005
+#define BSLS_MACROINCREMENTED_VALUE16005 16006
+#define BSLS_MACROINCREMENTED_VALUE16006 16007
+#define BSLS_MACROINCREMENTED_VALUE16007 16008
+#define BSLS_MACROINCREMENTED_VALUE16008 16009
+#define BSLS_MACROINCREMENTED_VALUE16009 16010
+#define BSLS_MACROINCREMENTED_VALUE16010 16011
+#define BSLS_MACROINCREMENTED_VALUE16011 16012
+#define BSLS_MACROINCREMENTED_VALUE16012 16013
+#define BSLS_MACROINCREMENTED_VALUE16013 16014
+#define BSLS_MACROINCREMENTED_VALUE16014 16015
+#define BSLS_MACROINCREMENTED_VALUE16015 16016
+#define BSLS_MACROINCREMENTED_VALUE16016 16017
+#define BSLS_MACROINCREMENTED_VALUE16017 16018
+#define BSLS_MACROINCREMENTED_VALUE16018 16019
+#define BSLS_MACROINCREMENTED_VALUE16019 16020
+#define BSLS_MACROINCREMENTED_VALUE16020 16021
+#define BSLS_MACROINCREMENTED_VALUE16021 16022
+#define BSLS_MACROINCREMENTED_VALUE16022 16023
+#define BSLS_MACROINCREMENTED_VALUE16023 16024
+#define BSLS_MACROINCREMENTED_VALUE16024 16025
+#define BSLS_MACROINCREMENTED_VALUE16025 16026
+#define BSLS_MACROINCREMENTED_VALUE16026 16027
+#define BSLS_MACROINCREMENTED_VALUE16027 16028
+#define BSLS_MACROINCREMENTED_VALUE16028 16029
+#define BSLS_MACROINCREMENTED_VALUE16029 16030
+#define BSLS_MACROINCREMENTED_VALUE16030 16031
+#define BSLS_MACROINCREMENTED_VALUE16031 16032
+#define BSLS_MACROINCREMENTED_VALUE16032 16033
+#define BSLS_MACROINCREMENTED_VALUE16033 16034
+#define BSLS_MACROINCREMENTED_VALUE16034 16035
+#define BSLS_MACROINCREMENTED_VALUE16035 16036
+#define BSLS_MACROINCREMENTED_VALUE16036 16037
+#define BSLS_MACROINCREMENTED_VALUE16037 16038
+#define BSLS_MACROINCREMENTED_VALUE16038 16039
+#define BSLS_MACROINCREMENTED_VALUE16039 16040
+#define BSLS_MACROINCREMENTED_VALUE16040 16041
+#define BSLS_MACROINCREMENTED_VALUE16041 16042
+#define BSLS_MACROINCREMENTED_VALUE16042 16043
+#define BSLS_MACROINCREMENTED_VALUE16043 16044
+#define BSLS_MACROINCREMENTED_VALUE16044 16045
+#define BSLS_MACROINCREMENTED_VALUE16045 16046
+#define BSLS_MACROINCREMENTED_VALUE16046 16047
+#define BSLS_MACROINCREMENTED_VALUE16047 16048
+#define BSLS_MACROINCREMENTED_VALUE16048 16049
+#define BSLS_MACROINCREMENTED_VALUE16049 16050
+#define BSLS_MACROINCREMENTED_VALUE16050 16051
+#define BSLS_MACROINCREMENTED_VALUE16051 16052
+#define BSLS_MACROINCREMENTED_VALUE16052 16053
+#define BSLS_MACROINCREMENTED_VALUE16053 16054
+#define BSLS_MACROINCREMENTED_VALUE16054 16055
+#define BSLS_MACROINCREMENTED_VALUE16055 16056
+#define BSLS_MACROINCREMENTED_VALUE16056 16057
+#define BSLS_MACROINCREMENTED_VALUE16057 16058
+#define BSLS_MACROINCREMENTED_VALUE16058 16059
+#define BSLS_MACROINCREMENTED_VALUE16059 16060
+#define BSLS_MACROINCREMENTED_VALUE16060 16061
+#define BSLS_MACROINCREMENTED_VALUE16061 16062
+#define BSLS_MACROINCREMENTED_VALUE16062 16063
+#define BSLS_MACROINCREMENTED_VALUE16063 16064
+#define BSLS_MACROINCREMENTED_VALUE16064 16065
+#define BSLS_MACROINCREMENTED_VALUE16065 16066
+#define BSLS_MACROINCREMENTED_VALUE16066 16067
+#define BSLS_MACROINCREMENTED_VALUE16067 16068
+#define BSLS_MACROINCREMENTED_VALUE16068 16069
+#define BSLS_MACROINCREMENTED_VALUE16069 16070
+#define BSLS_MACROINCREMENTED_VALUE16070 16071
+#define BSLS_MACROINCREMENTED_VALUE16071 16072
+#define BSLS_MACROINCREMENTED_VALUE16072 16073
+#define BSLS_MACROINCREMENTED_VALUE16073 16074
+#define BSLS_MACROINCREMENTED_VALUE16074 16075
+#define BSLS_MACROINCREMENTED_VALUE16075 16076
+#define BSLS_MACROINCREMENTED_VALUE16076 16077
+#define BSLS_MACROINCREMENTED_VALUE16077 16078
+#define BSLS_MACROINCREMENTED_VALUE16078 16079
+#define BSLS_MACROINCREMENTED_VALUE16079 16080
+#define BSLS_MACROINCREMENTED_VALUE16080 16081
+#define BSLS_MACROINCREMENTED_VALUE16081 16082
+#define BSLS_MACROINCREMENTED_VALUE16082 16083
+#define BSLS_MACROINCREMENTED_VALUE16083 16084
+#define BSLS_MACROINCREMENTED_VALUE16084 16085
+#define BSLS_MACROINCREMENTED_VALUE16085 16086
+#define BSLS_MACROINCREMENTED_VALUE16086 16087
+#define BSLS_MACROINCREMENTED_VALUE16087 16088
+#define BSLS_MACROINCREMENTED_VALUE16088 16089
+#define BSLS_MACROINCREMENTED_VALUE16089 16090
+#define BSLS_MACROINCREMENTED_VALUE16090 16091
+#define BSLS_MACROINCREMENTED_VALUE16091 16092
+#define BSLS_MACROINCREMENTED_VALUE16092 16093
+#define BSLS_MACROINCREMENTED_VALUE16093 16094
+#define BSLS_MACROINCREMENTED_VALUE16094 16095
+#define BSLS_MACROINCREMENTED_VALUE16095 16096
+#define BSLS_MACROINCREMENTED_VALUE16096 16097
+#define BSLS_MACROINCREMENTED_VALUE16097 16098
+#define BSLS_MACROINCREMENTED_VALUE16098 16099
+#define BSLS_MACROINCREMENTED_VALUE16099 16100
+#define BSLS_MACROINCREMENTED_VALUE16100 16101
+#define BSLS_MACROINCREMENTED_VALUE16101 16102
+#define BSLS_MACROINCREMENTED_VALUE16102 16103
+#define BSLS_MACROINCREMENTED_VALUE16103 16104
+#define BSLS_MACROINCREMENTED_VALUE16104 16105
+#define BSLS_MACROINCREMENTED_VALUE16105 16106
+#define BSLS_MACROINCREMENTED_VALUE16106 16107
+#define BSLS_MACROINCREMENTED_VALUE16107 16108
+#define BSLS_MACROINCREMENTED_VALUE16108 16109
+#define BSLS_MACROINCREMENTED_VALUE16109 16110
+#define BSLS_MACROINCREMENTED_VALUE16110 16111
+#define BSLS_MACROINCREMENTED_VALUE16111 16112
+#define BSLS_MACROINCREMENTED_VALUE16112 16113
+#define BSLS_MACROINCREMENTED_VALUE16113 16114
+#define BSLS_MACROINCREMENTED_VALUE16114 16115
+#define BSLS_MACROINCREMENTED_VALUE16115 16116
+#define BSLS_MACROINCREMENTED_VALUE16116 16117
+#define BSLS_MACROINCREMENTED_VALUE16117 16118
+#define BSLS_MACROINCREMENTED_VALUE16118 16119
+#define BSLS_MACROINCREMENTED_VALUE16119 16120
+#define BSLS_MACROINCREMENTED_VALUE16120 16121
+#define BSLS_MACROINCREMENTED_VALUE16121 16122
+#define BSLS_MACROINCREMENTED_VALUE16122 16123
+#define BSLS_MACROINCREMENTED_VALUE16123 16124
+#define BSLS_MACROINCREMENTED_VALUE16124 16125
+#define BSLS_MACROINCREMENTED_VALUE16125 16126
+#define BSLS_MACROINCREMENTED_VALUE16126 16127
+#define BSLS_MACROINCREMENTED_VALUE16127 16128
+#define BSLS_MACROINCREMENTED_VALUE16128 16129
+#define BSLS_MACROINCREMENTED_VALUE16129 16130
+#define BSLS_MACROINCREMENTED_VALUE16130 16131
+#define BSLS_MACROINCREMENTED_VALUE16131 16132
+#define BSLS_MACROINCREMENTED_VALUE16132 16133
+#define BSLS_MACROINCREMENTED_VALUE16133 16134
+#define BSLS_MACROINCREMENTED_VALUE16134 16135
+#define BSLS_MACROINCREMENTED_VALUE16135 16136
+#define BSLS_MACROINCREMENTED_VALUE16136 16137
+#define BSLS_MACROINCREMENTED_VALUE16137 16138
+#define BSLS_MACROINCREMENTED_VALUE16138 16139
+#define BSLS_MACROINCREMENTED_VALUE16139 16140
+#define BSLS_MACROINCREMENTED_VALUE16140 16141
+#define BSLS_MACROINCREMENTED_VALUE16141 16142
+#define BSLS_MACROINCREMENTED_VALUE16142 16143
+#define BSLS_MACROINCREMENTED_VALUE16143 16144
+#define BSLS_MACROINCREMENTED_VALUE16144 16145
+#define BSLS_MACROINCREMENTED_VALUE16145 16146
+#define BSLS_MACROINCREMENTED_VALUE16146 16147
+#define BSLS_MACROINCREMENTED_VALUE16147 16148
+#define BSLS_MACROINCREMENTED_VALUE16148 16149
+#define BSLS_MACROINCREMENTED_VALUE16149 16150
+#define BSLS_MACROINCREMENTED_VALUE16150 16151
+#define BSLS_MACROINCREMENTED_VALUE16151 16152
+#define BSLS_MACROINCREMENTED_VALUE16152 16153
+#define BSLS_MACROINCREMENTED_VALUE16153 16154
+#define BSLS_MACROINCREMENTED_VALUE16154 16155
+#define BSLS_MACROINCREMENTED_VALUE16155 16156
+#define BSLS_MACROINCREMENTED_VALUE16156 16157
+#define BSLS_MACROINCREMENTED_VALUE16157 16158
+#define BSLS_MACROINCREMENTED_VALUE16158 16159
+#define BSLS_MACROINCREMENTED_VALUE16159 16160
+#define BSLS_MACROINCREMENTED_VALUE16160 16161
+#define BSLS_MACROINCREMENTED_VALUE16161 16162
+#define BSLS_MACROINCREMENTED_VALUE16162 16163
+#define BSLS_MACROINCREMENTED_VALUE16163 16164
+#define BSLS_MACROINCREMENTED_VALUE16164 16165
+#define BSLS_MACROINCREMENTED_VALUE16165 16166
+#define BSLS_MACROINCREMENTED_VALUE16166 16167
+#define BSLS_MACROINCREMENTED_VALUE16167 16168
+#define BSLS_MACROINCREMENTED_VALUE16168 16169
+#define BSLS_MACROINCREMENTED_VALUE16169 16170
+#define BSLS_MACROINCREMENTED_VALUE16170 16171
+#define BSLS_MACROINCREMENTED_VALUE16171 16172
+#define BSLS_MACROINCREMENTED_VALUE16172 16173
+#define BSLS_MACROINCREMENTED_VALUE16173 16174
+#define BSLS_MACROINCREMENTED_VALUE16174 16175
+#define BSLS_MACROINCREMENTED_VALUE16175 16176
+#define BSLS_MACROINCREMENTED_VALUE16176 16177
+#define BSLS_MACROINCREMENTED_VALUE16177 16178
+#define BSLS_MACROINCREMENTED_VALUE16178 16179
+#define BSLS_MACROINCREMENTED_VALUE16179 16180
+#define BSLS_MACROINCREMENTED_VALUE16180 16181
+#define BSLS_MACROINCREMENTED_VALUE16181 16182
+#define BSLS_MACROINCREMENTED_VALUE16182 16183
+#define BSLS_MACROINCREMENTED_VALUE16183 16184
+#define BSLS_MACROINCREMENTED_VALUE16184 16185
+#define BSLS_MACROINCREMENTED_VALUE16185 16186
+#define BSLS_MACROINCREMENTED_VALUE16186 16187
+#define BSLS_MACROINCREMENTED_VALUE16187 16188
+#define BSLS_MACROINCREMENTED_VALUE16188 16189
+#define BSLS_MACROINCREMENTED_VALUE16189 16190
+#define BSLS_MACROINCREMENTED_VALUE16190 16191
+#define BSLS_MACROINCREMENTED_VALUE16191 16192
+#define BSLS_MACROINCREMENTED_VALUE16192 16193
+#define BSLS_MACROINCREMENTED_VALUE16193 16194
+#define BSLS_MACROINCREMENTED_VALUE16194 16195
+#define BSLS_MACROINCREMENTED_VALUE16195 16196
+#define BSLS_MACROINCREMENTED_VALUE16196 16197
+#define BSLS_MACROINCREMENTED_VALUE16197 16198
+#define BSLS_MACROINCREMENTED_VALUE16198 16199
+#define BSLS_MACROINCREMENTED_VALUE16199 16200
+#define BSLS_MACROINCREMENTED_VALUE16200 16201
+#define BSLS_MACROINCREMENTED_VALUE16201 16202
+#define BSLS_MACROINCREMENTED_VALUE16202 16203
+#define BSLS_MACROINCREMENTED_VALUE16203 16204
+#define BSLS_MACROINCREMENTED_VALUE16204 16205
+#define BSLS_MACROINCREMENTED_VALUE16205 16206
+#define BSLS_MACROINCREMENTED_VALUE16206 16207
+#define BSLS_MACROINCREMENTED_VALUE16207 16208
+#define BSLS_MACROINCREMENTED_VALUE16208 16209
+#define BSLS_MACROINCREMENTED_VALUE16209 16210
+#define BSLS_MACROINCREMENTED_VALUE16210 16211
+#define BSLS_MACROINCREMENTED_VALUE16211 16212
+#define BSLS_MACROINCREMENTED_VALUE16212 16213
+#define BSLS_MACROINCREMENTED_VALUE16213 16214
+#define BSLS_MACROINCREMENTED_VALUE16214 16215
+#define BSLS_MACROINCREMENTED_VALUE16215 16216
+#define BSLS_MACROINCREMENTED_VALUE16216 16217
+#define BSLS_MACROINCREMENTED_VALUE16217 16218
+#define BSLS_MACROINCREMENTED_VALUE16218 16219
+#define BSLS_MACROINCREMENTED_VALUE16219 16220
+#define BSLS_MACROINCREMENTED_VALUE16220 16221
+#define BSLS_MACROINCREMENTED_VALUE16221 16222
+#define BSLS_MACROINCREMENTED_VALUE16222 16223
+#define BSLS_MACROINCREMENTED_VALUE16223 16224
+#define BSLS_MACROINCREMENTED_VALUE16224 16225
+#define BSLS_MACROINCREMENTED_VALUE16225 16226
+#define BSLS_MACROINCREMENTED_VALUE16226 16227
+#define BSLS_MACROINCREMENTED_VALUE16227 16228
+#define BSLS_MACROINCREMENTED_VALUE16228 16229
+#define BSLS_MACROINCREMENTED_VALUE16229 16230
+#define BSLS_MACROINCREMENTED_VALUE16230 16231
+#define BSLS_MACROINCREMENTED_VALUE16231 16232
+#define BSLS_MACROINCREMENTED_VALUE16232 16233
+#define BSLS_MACROINCREMENTED_VALUE16233 16234
+#define BSLS_MACROINCREMENTED_VALUE16234 16235
+#define BSLS_MACROINCREMENTED_VALUE16235 16236
+#define BSLS_MACROINCREMENTED_VALUE16236 16237
+#define BSLS_MACROINCREMENTED_VALUE16237 16238
+#define BSLS_MACROINCREMENTED_VALUE16238 16239
+#define BSLS_MACROINCREMENTED_VALUE16239 16240
+#define BSLS_MACROINCREMENTED_VALUE16240 16241
+#define BSLS_MACROINCREMENTED_VALUE16241 16242
+#define BSLS_MACROINCREMENTED_VALUE16242 16243
+#define BSLS_MACROINCREMENTED_VALUE16243 16244
+#define BSLS_MACROINCREMENTED_VALUE16244 16245
+#define BSLS_MACROINCREMENTED_VALUE16245 16246
+#define BSLS_MACROINCREMENTED_VALUE16246 16247
+#define BSLS_MACROINCREMENTED_VALUE16247 16248
+#define BSLS_MACROINCREMENTED_VALUE16248 16249
+#define BSLS_MACROINCREMENTED_VALUE16249 16250
+#define BSLS_MACROINCREMENTED_VALUE16250 16251
+#define BSLS_MACROINCREMENTED_VALUE16251 16252
+#define BSLS_MACROINCREMENTED_VALUE16252 16253
+#define BSLS_MACROINCREMENTED_VALUE16253 16254
+#define BSLS_MACROINCREMENTED_VALUE16254 16255
+#define BSLS_MACROINCREMENTED_VALUE16255 16256
+#define BSLS_MACROINCREMENTED_VALUE16256 16257
+#define BSLS_MACROINCREMENTED_VALUE16257 16258
+#define BSLS_MACROINCREMENTED_VALUE16258 16259
+#define BSLS_MACROINCREMENTED_VALUE16259 16260
+#define BSLS_MACROINCREMENTED_VALUE16260 16261
+#define BSLS_MACROINCREMENTED_VALUE16261 16262
+#define BSLS_MACROINCREMENTED_VALUE16262 16263
+#define BSLS_MACROINCREMENTED_VALUE16263 16264
+#define BSLS_MACROINCREMENTED_VALUE16264 16265
+#define BSLS_MACROINCREMENTED_VALUE16265 16266
+#define BSLS_MACROINCREMENTED_VALUE16266 16267
+#define BSLS_MACROINCREMENTED_VALUE16267 16268
+#define BSLS_MACROINCREMENTED_VALUE16268 16269
+#define BSLS_MACROINCREMENTED_VALUE16269 16270
+#define BSLS_MACROINCREMENTED_VALUE16270 16271
+#define BSLS_MACROINCREMENTED_VALUE16271 16272
+#define BSLS_MACROINCREMENTED_VALUE16272 16273
+#define BSLS_MACROINCREMENTED_VALUE16273 16274
+#define BSLS_MACROINCREMENTED_VALUE16274 16275
+#define BSLS_MACROINCREMENTED_VALUE16275 16276
+#define BSLS_MACROINCREMENTED_VALUE16276 16277
+#define BSLS_MACROINCREMENTED_VALUE16277 16278
+#define BSLS_MACROINCREMENTED_VALUE16278 16279
+#define BSLS_MACROINCREMENTED_VALUE16279 16280
+#define BSLS_MACROINCREMENTED_VALUE16280 16281
+#define BSLS_MACROINCREMENTED_VALUE16281 16282
+#define BSLS_MACROINCREMENTED_VALUE16282 16283
+#define BSLS_MACROINCREMENTED_VALUE16283 16284
+#define BSLS_MACROINCREMENTED_VALUE16284 16285
+#define BSLS_MACROINCREMENTED_VALUE16285 16286
+#define BSLS_MACROINCREMENTED_VALUE16286 16287
+#define BSLS_MACROINCREMENTED_VALUE16287 16288
+#define BSLS_MACROINCREMENTED_VALUE16288 16289
+#define BSLS_MACROINCREMENTED_VALUE16289 16290
+#define BSLS_MACROINCREMENTED_VALUE16290 16291
+#define BSLS_MACROINCREMENTED_VALUE16291 16292
+#define BSLS_MACROINCREMENTED_VALUE16292 16293
+#define BSLS_MACROINCREMENTED_VALUE16293 16294
+#define BSLS_MACROINCREMENTED_VALUE16294 16295
+#define BSLS_MACROINCREMENTED_VALUE16295 16296
+#define BSLS_MACROINCREMENTED_VALUE16296 16297
+#define BSLS_MACROINCREMENTED_VALUE16297 16298
+#define BSLS_MACROINCREMENTED_VALUE16298 16299
+#define BSLS_MACROINCREMENTED_VALUE16299 16300
+#define BSLS_MACROINCREMENTED_VALUE16300 16301
+#define BSLS_MACROINCREMENTED_VALUE16301 16302
+#define BSLS_MACROINCREMENTED_VALUE16302 16303
+#define BSLS_MACROINCREMENTED_VALUE16303 16304
+#define BSLS_MACROINCREMENTED_VALUE16304 16305
+#define BSLS_MACROINCREMENTED_VALUE16305 16306
+#define BSLS_MACROINCREMENTED_VALUE16306 16307
+#define BSLS_MACROINCREMENTED_VALUE16307 16308
+#define BSLS_MACROINCREMENTED_VALUE16308 16309
+#define BSLS_MACROINCREMENTED_VALUE16309 16310
+#define BSLS_MACROINCREMENTED_VALUE16310 16311
+#define BSLS_MACROINCREMENTED_VALUE16311 16312
+#define BSLS_MACROINCREMENTED_VALUE16312 16313
+#define BSLS_MACROINCREMENTED_VALUE16313 16314
+#define BSLS_MACROINCREMENTED_VALUE16314 16315
+#define BSLS_MACROINCREMENTED_VALUE16315 16316
+#define BSLS_MACROINCREMENTED_VALUE16316 16317
+#define BSLS_MACROINCREMENTED_VALUE16317 16318
+#define BSLS_MACROINCREMENTED_VALUE16318 16319
+#define BSLS_MACROINCREMENTED_VALUE16319 16320
+#define BSLS_MACROINCREMENTED_VALUE16320 16321
+#define BSLS_MACROINCREMENTED_VALUE16321 16322
+#define BSLS_MACROINCREMENTED_VALUE16322 16323
+#define BSLS_MACROINCREMENTED_VALUE16323 16324
+#define BSLS_MACROINCREMENTED_VALUE16324 16325
+#define BSLS_MACROINCREMENTED_VALUE16325 16326
+#define BSLS_MACROINCREMENTED_VALUE16326 16327
+#define BSLS_MACROINCREMENTED_VALUE16327 16328
+#define BSLS_MACROINCREMENTED_VALUE16328 16329
+#define BSLS_MACROINCREMENTED_VALUE16329 16330
+#define BSLS_MACROINCREMENTED_VALUE16330 16331
+#define BSLS_MACROINCREMENTED_VALUE16331 16332
+#define BSLS_MACROINCREMENTED_VALUE16332 16333
+#define BSLS_MACROINCREMENTED_VALUE16333 16334
+#define BSLS_MACROINCREMENTED_VALUE16334 16335
+#define BSLS_MACROINCREMENTED_VALUE16335 16336
+#define BSLS_MACROINCREMENTED_VALUE16336 16337
+#define BSLS_MACROINCREMENTED_VALUE16337 16338
+#define BSLS_MACROINCREMENTED_VALUE16338 16339
+#define BSLS_MACROINCREMENTED_VALUE16339 16340
+#define BSLS_MACROINCREMENTED_VALUE16340 16341
+#define BSLS_MACROINCREMENTED_VALUE16341 16342
+#define BSLS_MACROINCREMENTED_VALUE16342 16343
+#define BSLS_MACROINCREMENTED_VALUE16343 16344
+#define BSLS_MACROINCREMENTED_VALUE16344 16345
+#define BSLS_MACROINCREMENTED_VALUE16345 16346
+#define BSLS_MACROINCREMENTED_VALUE16346 16347
+#define BSLS_MACROINCREMENTED_VALUE16347 16348
+#define BSLS_MACROINCREMENTED_VALUE16348 16349
+#define BSLS_MACROINCREMENTED_VALUE16349 16350
+#define BSLS_MACROINCREMENTED_VALUE16350 16351
+#define BSLS_MACROINCREMENTED_VALUE16351 16352
+#define BSLS_MACROINCREMENTED_VALUE16352 16353
+#define BSLS_MACROINCREMENTED_VALUE16353 16354
+#define BSLS_MACROINCREMENTED_VALUE16354 16355
+#define BSLS_MACROINCREMENTED_VALUE16355 16356
+#define BSLS_MACROINCREMENTED_VALUE16356 16357
+#define BSLS_MACROINCREMENTED_VALUE16357 16358
+#define BSLS_MACROINCREMENTED_VALUE16358 16359
+#define BSLS_MACROINCREMENTED_VALUE16359 16360
+#define BSLS_MACROINCREMENTED_VALUE16360 16361
+#define BSLS_MACROINCREMENTED_VALUE16361 16362
+#define BSLS_MACROINCREMENTED_VALUE16362 16363
+#define BSLS_MACROINCREMENTED_VALUE16363 16364
+#define BSLS_MACROINCREMENTED_VALUE16364 16365
+#define BSLS_MACROINCREMENTED_VALUE16365 16366
+#define BSLS_MACROINCREMENTED_VALUE16366 16367
+#define BSLS_MACROINCREMENTED_VALUE16367 16368
+#define BSLS_MACROINCREMENTED_VALUE16368 16369
+#define BSLS_MACROINCREMENTED_VALUE16369 16370
+#define BSLS_MACROINCREMENTED_VALUE16370 16371
+#define BSLS_MACROINCREMENTED_VALUE16371 16372
+#define BSLS_MACROINCREMENTED_VALUE16372 16373
+#define BSLS_MACROINCREMENTED_VALUE16373 16374
+#define BSLS_MACROINCREMENTED_VALUE16374 16375
+#define BSLS_MACROINCREMENTED_VALUE16375 16376
+#define BSLS_MACROINCREMENTED_VALUE16376 16377
+#define BSLS_MACROINCREMENTED_VALUE16377 16378
+#define BSLS_MACROINCREMENTED_VALUE16378 16379
+#define BSLS_MACROINCREMENTED_VALUE16379 16380
+#define BSLS_MACROINCREMENTED_VALUE16380 16381
+#define BSLS_MACROINCREMENTED_VALUE16381 16382
+#define BSLS_MACROINCREMENTED_VALUE16382 16383
+#define BSLS_MACROINCREMENTED_VALUE16383 16384
+#define BSLS_MACROINCREMENTED_VALUE16384 16385
+#define BSLS_MACROINCREMENTED_VALUE16385 16386
+#define BSLS_MACROINCREMENTED_VALUE16386 16387
+#define BSLS_MACROINCREMENTED_VALUE16387 16388
+#define BSLS_MACROINCREMENTED_VALUE16388 16389
+#define BSLS_MACROINCREMENTED_VALUE16389 16390
+#define BSLS_MACROINCREMENTED_VALUE16390 16391
+#define BSLS_MACROINCREMENTED_VALUE16391 16392
+#define BSLS_MACROINCREMENTED_VALUE16392 16393
+#define BSLS_MACROINCREMENTED_VALUE16393 16394
+#define BSLS_MACROINCREMENTED_VALUE16394 16395
+#define BSLS_MACROINCREMENTED_VALUE16395 16396
+#define BSLS_MACROINCREMENTED_VALUE16396 16397
+#define BSLS_MACROINCREMENTED_VALUE16397 16398
+#define BSLS_MACROINCREMENTED_VALUE16398 16399
+#define BSLS_MACROINCREMENTED_VALUE16399 16400
+#define BSLS_MACROINCREMENTED_VALUE16400 16401
+#define BSLS_MACROINCREMENTED_VALUE16401 16402
+#define BSLS_MACROINCREMENTED_VALUE16402 16403
+#define BSLS_MACROINCREMENTED_VALUE16403 16404
+#define BSLS_MACROINCREMENTED_VALUE16404 16405
+#define BSLS_MACROINCREMENTED_VALUE16405 16406
+#define BSLS_MACROINCREMENTED_VALUE16406 16407
+#define BSLS_MACROINCREMENTED_VALUE16407 16408
+#define BSLS_MACROINCREMENTED_VALUE16408 16409
+#define BSLS_MACROINCREMENTED_VALUE16409 16410
+#define BSLS_MACROINCREMENTED_VALUE16410 16411
+#define BSLS_MACROINCREMENTED_VALUE16411 16412
+#define BSLS_MACROINCREMENTED_VALUE16412 16413
+#define BSLS_MACROINCREMENTED_VALUE16413 16414
+#define BSLS_MACROINCREMENTED_VALUE16414 16415
+#define BSLS_MACROINCREMENTED_VALUE16415 16416
+#define BSLS_MACROINCREMENTED_VALUE16416 16417
+#define BSLS_MACROINCREMENTED_VALUE16417 16418
+#define BSLS_MACROINCREMENTED_VALUE16418 16419
+#define BSLS_MACROINCREMENTED_VALUE16419 16420
+#define BSLS_MACROINCREMENTED_VALUE16420 16421
+#define BSLS_MACROINCREMENTED_VALUE16421 16422
+#define BSLS_MACROINCREMENTED_VALUE16422 16423
+#define BSLS_MACROINCREMENTED_VALUE16423 16424
+#define BSLS_MACROINCREMENTED_VALUE16424 16425
+#define BSLS_MACROINCREMENTED_VALUE16425 16426
+#define BSLS_MACROINCREMENTED_VALUE16426 16427
+#define BSLS_MACROINCREMENTED_VALUE16427 16428
+#define BSLS_MACROINCREMENTED_VALUE16428 16429
+#define BSLS_MACROINCREMENTED_VALUE16429 16430
+#define BSLS_MACROINCREMENTED_VALUE16430 16431
+#define BSLS_MACROINCREMENTED_VALUE16431 16432
+#define BSLS_MACROINCREMENTED_VALUE16432 16433
+#define BSLS_MACROINCREMENTED_VALUE16433 16434
+#define BSLS_MACROINCREMENTED_VALUE16434 16435
+#define BSLS_MACROINCREMENTED_VALUE16435 16436
+#define BSLS_MACROINCREMENTED_VALUE16436 16437
+#define BSLS_MACROINCREMENTED_VALUE16437 16438
+#define BSLS_MACROINCREMENTED_VALUE16438 16439
+#define BSLS_MACROINCREMENTED_VALUE16439 16440
+#define BSLS_MACROINCREMENTED_VALUE16440 16441
+#define BSLS_MACROINCREMENTED_VALUE16441 16442
+#define BSLS_MACROINCREMENTED_VALUE16442 16443
+#define BSLS_MACROINCREMENTED_VALUE16443 16444
+#define BSLS_MACROINCREMENTED_VALUE16444 16445
+#define BSLS_MACROINCREMENTED_VALUE16445 16446
+#define BSLS_MACROINCREMENTED_VALUE16446 16447
+#define BSLS_MACROINCREMENTED_VALUE16447 16448
+#define BSLS_MACROINCREMENTED_VALUE16448 16449
+#define BSLS_MACROINCREMENTED_VALUE16449 16450
+#define BSLS_MACROINCREMENTED_VALUE16450 16451
+#define BSLS_MACROINCREMENTED_VALUE16451 16452
+#define BSLS_MACROINCREMENTED_VALUE16452 16453
+#define BSLS_MACROINCREMENTED_VALUE16453 16454
+#define BSLS_MACROINCREMENTED_VALUE16454 16455
+#define BSLS_MACROINCREMENTED_VALUE16455 16456
+#define BSLS_MACROINCREMENTED_VALUE16456 16457
+#define BSLS_MACROINCREMENTED_VALUE16457 16458
+#define BSLS_MACROINCREMENTED_VALUE16458 16459
+#define BSLS_MACROINCREMENTED_VALUE16459 16460
+#define BSLS_MACROINCREMENTED_VALUE16460 16461
+#define BSLS_MACROINCREMENTED_VALUE16461 16462
+#define BSLS_MACROINCREMENTED_VALUE16462 16463
+#define BSLS_MACROINCREMENTED_VALUE16463 16464
+#define BSLS_MACROINCREMENTED_VALUE16464 16465
+#define BSLS_MACROINCREMENTED_VALUE16465 16466
+#define BSLS_MACROINCREMENTED_VALUE16466 16467
+#define BSLS_MACROINCREMENTED_VALUE16467 16468
+#define BSLS_MACROINCREMENTED_VALUE16468 16469
+#define BSLS_MACROINCREMENTED_VALUE16469 16470
+#define BSLS_MACROINCREMENTED_VALUE16470 16471
+#define BSLS_MACROINCREMENTED_VALUE16471 16472
+#define BSLS_MACROINCREMENTED_VALUE16472 16473
+#define BSLS_MACROINCREMENTED_VALUE16473 16474
+#define BSLS_MACROINCREMENTED_VALUE16474 16475
+#define BSLS_MACROINCREMENTED_VALUE16475 16476
+#define BSLS_MACROINCREMENTED_VALUE16476 16477
+#define BSLS_MACROINCREMENTED_VALUE16477 16478
+#define BSLS_MACROINCREMENTED_VALUE16478 16479
+#define BSLS_MACROINCREMENTED_VALUE16479 16480
+#define BSLS_MACROINCREMENTED_VALUE16480 16481
+#define BSLS_MACROINCREMENTED_VALUE16481 16482
+#define BSLS_MACROINCREMENTED_VALUE16482 16483
+#define BSLS_MACROINCREMENTED_VALUE16483 16484
+#define BSLS_MACROINCREMENTED_VALUE16484 16485
+#define BSLS_MACROINCREMENTED_VALUE16485 16486
+#define BSLS_MACROINCREMENTED_VALUE16486 16487
+#define BSLS_MACROINCREMENTED_VALUE16487 16488
+#define BSLS_MACROINCREMENTED_VALUE16488 16489
+#define BSLS_MACROINCREMENTED_VALUE16489 16490
+#define BSLS_MACROINCREMENTED_VALUE16490 16491
+#define BSLS_MACROINCREMENTED_VALUE16491 16492
+#define BSLS_MACROINCREMENTED_VALUE16492 16493
+#define BSLS_MACROINCREMENTED_VALUE16493 16494
+#define BSLS_MACROINCREMENTED_VALUE16494 16495
+#define BSLS_MACROINCREMENTED_VALUE16495 16496
+#define BSLS_MACROINCREMENTED_VALUE16496 16497
+#define BSLS_MACROINCREMENTED_VALUE16497 16498
+#define BSLS_MACROINCREMENTED_VALUE16498 16499
+#define BSLS_MACROINCREMENTED_VALUE16499 16500
+#define BSLS_MACROINCREMENTED_VALUE16500 16501
+#define BSLS_MACROINCREMENTED_VALUE16501 16502
+#define BSLS_MACROINCREMENTED_VALUE16502 16503
+#define BSLS_MACROINCREMENTED_VALUE16503 16504
+#define BSLS_MACROINCREMENTED_VALUE16504 16505
+#define BSLS_MACROINCREMENTED_VALUE16505 16506
+#define BSLS_MACROINCREMENTED_VALUE16506 16507
+#define BSLS_MACROINCREMENTED_VALUE16507 16508
+#define BSLS_MACROINCREMENTED_VALUE16508 16509
+#define BSLS_MACROINCREMENTED_VALUE16509 16510
+#define BSLS_MACROINCREMENTED_VALUE16510 16511
+#define BSLS_MACROINCREMENTED_VALUE16511 16512
+#define BSLS_MACROINCREMENTED_VALUE16512 16513
+#define BSLS_MACROINCREMENTED_VALUE16513 16514
+#define BSLS_MACROINCREMENTED_VALUE16514 16515
+#define BSLS_MACROINCREMENTED_VALUE16515 16516
+#define BSLS_MACROINCREMENTED_VALUE16516 16517
+#define BSLS_MACROINCREMENTED_VALUE16517 16518
+#define BSLS_MACROINCREMENTED_VALUE16518 16519
+#define BSLS_MACROINCREMENTED_VALUE16519 16520
+#define BSLS_MACROINCREMENTED_VALUE16520 16521
+#define BSLS_MACROINCREMENTED_VALUE16521 16522
+#define BSLS_MACROINCREMENTED_VALUE16522 16523
+#define BSLS_MACROINCREMENTED_VALUE16523 16524
+#define BSLS_MACROINCREMENTED_VALUE16524 16525
+#define BSLS_MACROINCREMENTED_VALUE16525 16526
+#define BSLS_MACROINCREMENTED_VALUE16526 16527
+#define BSLS_MACROINCREMENTED_VALUE16527 16528
+#define BSLS_MACROINCREMENTED_VALUE16528 16529
+#define BSLS_MACROINCREMENTED_VALUE16529 16530
+#define BSLS_MACROINCREMENTED_VALUE16530 16531
+#define BSLS_MACROINCREMENTED_VALUE16531 16532
+#define BSLS_MACROINCREMENTED_VALUE16532 16533
+#define BSLS_MACROINCREMENTED_VALUE16533 16534
+#define BSLS_MACROINCREMENTED_VALUE16534 16535
+#define BSLS_MACROINCREMENTED_VALUE16535 16536
+#define BSLS_MACROINCREMENTED_VALUE16536 16537
+#define BSLS_MACROINCREMENTED_VALUE16537 16538
+#define BSLS_MACROINCREMENTED_VALUE16538 16539
+#define BSLS_MACROINCREMENTED_VALUE16539 16540
+#define BSLS_MACROINCREMENTED_VALUE16540 16541
+#define BSLS_MACROINCREMENTED_VALUE16541 16542
+#define BSLS_MACROINCREMENTED_VALUE16542 16543
+#define BSLS_MACROINCREMENTED_VALUE16543 16544
+#define BSLS_MACROINCREMENTED_VALUE16544 16545
+#define BSLS_MACROINCREMENTED_VALUE16545 16546
+#define BSLS_MACROINCREMENTED_VALUE16546 16547
+#define BSLS_MACROINCREMENTED_VALUE16547 16548
+#define BSLS_MACROINCREMENTED_VALUE16548 16549
+#define BSLS_MACROINCREMENTED_VALUE16549 16550
+#define BSLS_MACROINCREMENTED_VALUE16550 16551
+#define BSLS_MACROINCREMENTED_VALUE16551 16552
+#define BSLS_MACROINCREMENTED_VALUE16552 16553
+#define BSLS_MACROINCREMENTED_VALUE16553 16554
+#define BSLS_MACROINCREMENTED_VALUE16554 16555
+#define BSLS_MACROINCREMENTED_VALUE16555 16556
+#define BSLS_MACROINCREMENTED_VALUE16556 16557
+#define BSLS_MACROINCREMENTED_VALUE16557 16558
+#define BSLS_MACROINCREMENTED_VALUE16558 16559
+#define BSLS_MACROINCREMENTED_VALUE16559 16560
+#define BSLS_MACROINCREMENTED_VALUE16560 16561
+#define BSLS_MACROINCREMENTED_VALUE16561 16562
+#define BSLS_MACROINCREMENTED_VALUE16562 16563
+#define BSLS_MACROINCREMENTED_VALUE16563 16564
+#define BSLS_MACROINCREMENTED_VALUE16564 16565
+#define BSLS_MACROINCREMENTED_VALUE16565 16566
+#define BSLS_MACROINCREMENTED_VALUE16566 16567
+#define BSLS_MACROINCREMENTED_VALUE16567 16568
+#define BSLS_MACROINCREMENTED_VALUE16568 16569
+#define BSLS_MACROINCREMENTED_VALUE16569 16570
+#define BSLS_MACROINCREMENTED_VALUE16570 16571
+#define BSLS_MACROINCREMENTED_VALUE16571 16572
+#define BSLS_MACROINCREMENTED_VALUE16572 16573
+#define BSLS_MACROINCREMENTED_VALUE16573 16574
+#define BSLS_MACROINCREMENTED_VALUE16574 16575
+#define BSLS_MACROINCREMENTED_VALUE16575 16576
+#define BSLS_MACROINCREMENTED_VALUE16576 16577
+#define BSLS_MACROINCREMENTED_VALUE16577 16578
+#define BSLS_MACROINCREMENTED_VALUE16578 16579
+#define BSLS_MACROINCREMENTED_VALUE16579 16580
+#define BSLS_MACROINCREMENTED_VALUE16580 16581
+#define BSLS_MACROINCREMENTED_VALUE16581 16582
+#define BSLS_MACROINCREMENTED_VALUE16582 16583
+#define BSLS_MACROINCREMENTED_VALUE16583 16584
+#define BSLS_MACROINCREMENTED_VALUE16584 16585
+#define BSLS_MACROINCREMENTED_VALUE16585 16586
+#define BSLS_MACROINCREMENTED_VALUE16586 16587
+#define BSLS_MACROINCREMENTED_VALUE16587 16588
+#define BSLS_MACROINCREMENTED_VALUE16588 16589
+#define BSLS_MACROINCREMENTED_VALUE16589 16590
+#define BSLS_MACROINCREMENTED_VALUE16590 16591
+#define BSLS_MACROINCREMENTED_VALUE16591 16592
+#define BSLS_MACROINCREMENTED_VALUE16592 16593
+#define BSLS_MACROINCREMENTED_VALUE16593 16594
+#define BSLS_MACROINCREMENTED_VALUE16594 16595
+#define BSLS_MACROINCREMENTED_VALUE16595 16596
+#define BSLS_MACROINCREMENTED_VALUE16596 16597
+#define BSLS_MACROINCREMENTED_VALUE16597 16598
+#define BSLS_MACROINCREMENTED_VALUE16598 16599
+#define BSLS_MACROINCREMENTED_VALUE16599 16600
+#define BSLS_MACROINCREMENTED_VALUE16600 16601
+#define BSLS_MACROINCREMENTED_VALUE16601 16602
+#define BSLS_MACROINCREMENTED_VALUE16602 16603
+#define BSLS_MACROINCREMENTED_VALUE16603 16604
+#define BSLS_MACROINCREMENTED_VALUE16604 16605
+#define BSLS_MACROINCREMENTED_VALUE16605 16606
+#define BSLS_MACROINCREMENTED_VALUE16606 16607
+#define BSLS_MACROINCREMENTED_VALUE16607 16608
+#define BSLS_MACROINCREMENTED_VALUE16608 16609
+#define BSLS_MACROINCREMENTED_VALUE16609 16610
+#define BSLS_MACROINCREMENTED_VALUE16610 16611
+#define BSLS_MACROINCREMENTED_VALUE16611 16612
+#define BSLS_MACROINCREMENTED_VALUE16612 16613
+#define BSLS_MACROINCREMENTED_VALUE16613 16614
+#define BSLS_MACROINCREMENTED_VALUE16614 16615
+#define BSLS_MACROINCREMENTED_VALUE16615 16616
+#define BSLS_MACROINCREMENTED_VALUE16616 16617
+#define BSLS_MACROINCREMENTED_VALUE16617 16618
+#define BSLS_MACROINCREMENTED_VALUE16618 16619
+#define BSLS_MACROINCREMENTED_VALUE16619 16620
+#define BSLS_MACROINCREMENTED_VALUE16620 16621
+#define BSLS_MACROINCREMENTED_VALUE16621 16622
+#define BSLS_MACROINCREMENTED_VALUE16622 16623
+#define BSLS_MACROINCREMENTED_VALUE16623 16624
+#define BSLS_MACROINCREMENTED_VALUE16624 16625
+#define BSLS_MACROINCREMENTED_VALUE16625 16626
+#define BSLS_MACROINCREMENTED_VALUE16626 16627
+#define BSLS_MACROINCREMENTED_VALUE16627 16628
+#define BSLS_MACROINCREMENTED_VALUE16628 16629
+#define BSLS_MACROINCREMENTED_VALUE16629 16630
+#define BSLS_MACROINCREMENTED_VALUE16630 16631
+#define BSLS_MACROINCREMENTED_VALUE16631 16632
+#define BSLS_MACROINCREMENTED_VALUE16632 16633
+#define BSLS_MACROINCREMENTED_VALUE16633 16634
+#define BSLS_MACROINCREMENTED_VALUE16634 16635
+#define BSLS_MACROINCREMENTED_VALUE16635 16636
+#define BSLS_MACROINCREMENTED_VALUE16636 16637
+#define BSLS_MACROINCREMENTED_VALUE16637 16638
+#define BSLS_MACROINCREMENTED_VALUE16638 16639
+#define BSLS_MACROINCREMENTED_VALUE16639 16640
+#define BSLS_MACROINCREMENTED_VALUE16640 16641
+#define BSLS_MACROINCREMENTED_VALUE16641 16642
+#define BSLS_MACROINCREMENTED_VALUE16642 16643
+#define BSLS_MACROINCREMENTED_VALUE16643 16644
+#define BSLS_MACROINCREMENTED_VALUE16644 16645
+#define BSLS_MACROINCREMENTED_VALUE16645 16646
+#define BSLS_MACROINCREMENTED_VALUE16646 16647
+#define BSLS_MACROINCREMENTED_VALUE16647 16648
+#define BSLS_MACROINCREMENTED_VALUE16648 16649
+#define BSLS_MACROINCREMENTED_VALUE16649 16650
+#define BSLS_MACROINCREMENTED_VALUE16650 16651
+#define BSLS_MACROINCREMENTED_VALUE16651 16652
+#define BSLS_MACROINCREMENTED_VALUE16652 16653
+#define BSLS_MACROINCREMENTED_VALUE16653 16654
+#define BSLS_MACROINCREMENTED_VALUE16654 16655
+#define BSLS_MACROINCREMENTED_VALUE16655 16656
+#define BSLS_MACROINCREMENTED_VALUE16656 16657
+#define BSLS_MACROINCREMENTED_VALUE16657 16658
+#define BSLS_MACROINCREMENTED_VALUE16658 16659
+#define BSLS_MACROINCREMENTED_VALUE16659 16660
+#define BSLS_MACROINCREMENTED_VALUE16660 16661
+#define BSLS_MACROINCREMENTED_VALUE16661 16662
+#define BSLS_MACROINCREMENTED_VALUE16662 16663
+#define BSLS_MACROINCREMENTED_VALUE16663 16664
+#define BSLS_MACROINCREMENTED_VALUE16664 16665
+#define BSLS_MACROINCREMENTED_VALUE16665 16666
+#define BSLS_MACROINCREMENTED_VALUE16666 16667
+#define BSLS_MACROINCREMENTED_VALUE16667 16668
+#define BSLS_MACROINCREMENTED_VALUE16668 16669
+#define BSLS_MACROINCREMENTED_VALUE16669 16670
+#define BSLS_MACROINCREMENTED_VALUE16670 16671
+#define BSLS_MACROINCREMENTED_VALUE16671 16672
+#define BSLS_MACROINCREMENTED_VALUE16672 16673
+#define BSLS_MACROINCREMENTED_VALUE16673 16674
+#define BSLS_MACROINCREMENTED_VALUE16674 16675
+#define BSLS_MACROINCREMENTED_VALUE16675 16676
+#define BSLS_MACROINCREMENTED_VALUE16676 16677
+#define BSLS_MACROINCREMENTED_VALUE16677 16678
+#define BSLS_MACROINCREMENTED_VALUE16678 16679
+#define BSLS_MACROINCREMENTED_VALUE16679 16680
+#define BSLS_MACROINCREMENTED_VALUE16680 16681
+#define BSLS_MACROINCREMENTED_VALUE16681 16682
+#define BSLS_MACROINCREMENTED_VALUE16682 16683
+#define BSLS_MACROINCREMENTED_VALUE16683 16684
+#define BSLS_MACROINCREMENTED_VALUE16684 16685
+#define BSLS_MACROINCREMENTED_VALUE16685 16686
+#define BSLS_MACROINCREMENTED_VALUE16686 16687
+#define BSLS_MACROINCREMENTED_VALUE16687 16688
+#define BSLS_MACROINCREMENTED_VALUE16688 16689
+#define BSLS_MACROINCREMENTED_VALUE16689 16690
+#define BSLS_MACROINCREMENTED_VALUE16690 16691
+#define BSLS_MACROINCREMENTED_VALUE16691 16692
+#define BSLS_MACROINCREMENTED_VALUE16692 16693
+#define BSLS_MACROINCREMENTED_VALUE16693 16694
+#define BSLS_MACROINCREMENTED_VALUE16694 16695
+#define BSLS_MACROINCREMENTED_VALUE16695 16696
+#define BSLS_MACROINCREMENTED_VALUE16696 16697
+#define BSLS_MACROINCREMENTED_VALUE16697 16698
+#define BSLS_MACROINCREMENTED_VALUE16698 16699
+#define BSLS_MACROINCREMENTED_VALUE16699 16700
+#define BSLS_MACROINCREMENTED_VALUE16700 16701
+#define BSLS_MACROINCREMENTED_VALUE16701 16702
+#define BSLS_MACROINCREMENTED_VALUE16702 16703
+#define BSLS_MACROINCREMENTED_VALUE16703 16704
+#define BSLS_MACROINCREMENTED_VALUE16704 16705
+#define BSLS_MACROINCREMENTED_VALUE16705 16706
+#define BSLS_MACROINCREMENTED_VALUE16706 16707
+#define BSLS_MACROINCREMENTED_VALUE16707 16708
+#define BSLS_MACROINCREMENTED_VALUE16708 16709
+#define BSLS_MACROINCREMENTED_VALUE16709 16710
+#define BSLS_MACROINCREMENTED_VALUE16710 16711
+#define BSLS_MACROINCREMENTED_VALUE16711 16712
+#define BSLS_MACROINCREMENTED_VALUE16712 16713
+#define BSLS_MACROINCREMENTED_VALUE16713 16714
+#define BSLS_MACROINCREMENTED_VALUE16714 16715
+#define BSLS_MACROINCREMENTED_VALUE16715 16716
+#define BSLS_MACROINCREMENTED_VALUE16716 16717
+#define BSLS_MACROINCREMENTED_VALUE16717 16718
+#define BSLS_MACROINCREMENTED_VALUE16718 16719
+#define BSLS_MACROINCREMENTED_VALUE16719 16720
+#define BSLS_MACROINCREMENTED_VALUE16720 16721
+#define BSLS_MACROINCREMENTED_VALUE16721 16722
+#define BSLS_MACROINCREMENTED_VALUE16722 16723
+#define BSLS_MACROINCREMENTED_VALUE16723 16724
+#define BSLS_MACROINCREMENTED_VALUE16724 16725
+#define BSLS_MACROINCREMENTED_VALUE16725 16726
+#define BSLS_MACROINCREMENTED_VALUE16726 16727
+#define BSLS_MACROINCREMENTED_VALUE16727 16728
+#define BSLS_MACROINCREMENTED_VALUE16728 16729
+#define BSLS_MACROINCREMENTED_VALUE16729 16730
+#define BSLS_MACROINCREMENTED_VALUE16730 16731
+#define BSLS_MACROINCREMENTED_VALUE16731 16732
+#define BSLS_MACROINCREMENTED_VALUE16732 16733
+#define BSLS_MACROINCREMENTED_VALUE16733 16734
+#define BSLS_MACROINCREMENTED_VALUE16734 16735
+#define BSLS_MACROINCREMENTED_VALUE16735 16736
+#define BSLS_MACROINCREMENTED_VALUE16736 16737
+#define BSLS_MACROINCREMENTED_VALUE16737 16738
+#define BSLS_MACROINCREMENTED_VALUE16738 16739
+#define BSLS_MACROINCREMENTED_VALUE16739 16740
+#define BSLS_MACROINCREMENTED_VALUE16740 16741
+#define BSLS_MACROINCREMENTED_VALUE16741 16742
+#define BSLS_MACROINCREMENTED_VALUE16742 16743
+#define BSLS_MACROINCREMENTED_VALUE16743 16744
+#define BSLS_MACROINCREMENTED_VALUE16744 16745
+#define BSLS_MACROINCREMENTED_VALUE16745 16746
+#define BSLS_MACROINCREMENTED_VALUE16746 16747
+#define BSLS_MACROINCREMENTED_VALUE16747 16748
+#define BSLS_MACROINCREMENTED_VALUE16748 16749
+#define BSLS_MACROINCREMENTED_VALUE16749 16750
+#define BSLS_MACROINCREMENTED_VALUE16750 16751
+#define BSLS_MACROINCREMENTED_VALUE16751 16752
+#define BSLS_MACROINCREMENTED_VALUE16752 16753
+#define BSLS_MACROINCREMENTED_VALUE16753 16754
+#define BSLS_MACROINCREMENTED_VALUE16754 16755
+#define BSLS_MACROINCREMENTED_VALUE16755 16756
+#define BSLS_MACROINCREMENTED_VALUE16756 16757
+#define BSLS_MACROINCREMENTED_VALUE16757 16758
+#define BSLS_MACROINCREMENTED_VALUE16758 16759
+#define BSLS_MACROINCREMENTED_VALUE16759 16760
+#define BSLS_MACROINCREMENTED_VALUE16760 16761
+#define BSLS_MACROINCREMENTED_VALUE16761 16762
+#define BSLS_MACROINCREMENTED_VALUE16762 16763
+#define BSLS_MACROINCREMENTED_VALUE16763 16764
+#define BSLS_MACROINCREMENTED_VALUE16764 16765
+#define BSLS_MACROINCREMENTED_VALUE16765 16766
+#define BSLS_MACROINCREMENTED_VALUE16766 16767
+#define BSLS_MACROINCREMENTED_VALUE16767 16768
+#define BSLS_MACROINCREMENTED_VALUE16768 16769
+#define BSLS_MACROINCREMENTED_VALUE16769 16770
+#define BSLS_MACROINCREMENTED_VALUE16770 16771
+#define BSLS_MACROINCREMENTED_VALUE16771 16772
+#define BSLS_MACROINCREMENTED_VALUE16772 16773
+#define BSLS_MACROINCREMENTED_VALUE16773 16774
+#define BSLS_MACROINCREMENTED_VALUE16774 16775
+#define BSLS_MACROINCREMENTED_VALUE16775 16776
+#define BSLS_MACROINCREMENTED_VALUE16776 16777
+#define BSLS_MACROINCREMENTED_VALUE16777 16778
+#define BSLS_MACROINCREMENTED_VALUE16778 16779
+#define BSLS_MACROINCREMENTED_VALUE16779 16780
+#define BSLS_MACROINCREMENTED_VALUE16780 16781
+#define BSLS_MACROINCREMENTED_VALUE16781 16782
+#define BSLS_MACROINCREMENTED_VALUE16782 16783
+#define BSLS_MACROINCREMENTED_VALUE16783 16784
+#define BSLS_MACROINCREMENTED_VALUE16784 16785
+#define BSLS_MACROINCREMENTED_VALUE16785 16786
+#define BSLS_MACROINCREMENTED_VALUE16786 16787
+#define BSLS_MACROINCREMENTED_VALUE16787 16788
+#define BSLS_MACROINCREMENTED_VALUE16788 16789
+#define BSLS_MACROINCREMENTED_VALUE16789 16790
+#define BSLS_MACROINCREMENTED_VALUE16790 16791
+#define BSLS_MACROINCREMENTED_VALUE16791 16792
+#define BSLS_MACROINCREMENTED_VALUE16792 16793
+#define BSLS_MACROINCREMENTED_VALUE16793 16794
+#define BSLS_MACROINCREMENTED_VALUE16794 16795
+#define BSLS_MACROINCREMENTED_VALUE16795 16796
+#define BSLS_MACROINCREMENTED_VALUE16796 16797
+#define BSLS_MACROINCREMENTED_VALUE16797 16798
+#define BSLS_MACROINCREMENTED_VALUE16798 16799
+#define BSLS_MACROINCREMENTED_VALUE16799 16800
+#define BSLS_MACROINCREMENTED_VALUE16800 16801
+#define BSLS_MACROINCREMENTED_VALUE16801 16802
+#define BSLS_MACROINCREMENTED_VALUE16802 16803
+#define BSLS_MACROINCREMENTED_VALUE16803 16804
+#define BSLS_MACROINCREMENTED_VALUE16804 16805
+#define BSLS_MACROINCREMENTED_VALUE16805 16806
+#define BSLS_MACROINCREMENTED_VALUE16806 16807
+#define BSLS_MACROINCREMENTED_VALUE16807 16808
+#define BSLS_MACROINCREMENTED_VALUE16808 16809
+#define BSLS_MACROINCREMENTED_VALUE16809 16810
+#define BSLS_MACROINCREMENTED_VALUE16810 16811
+#define BSLS_MACROINCREMENTED_VALUE16811 16812
+#define BSLS_MACROINCREMENTED_VALUE16812 16813
+#define BSLS_MACROINCREMENTED_VALUE16813 16814
+#define BSLS_MACROINCREMENTED_VALUE16814 16815
+#define BSLS_MACROINCREMENTED_VALUE16815 16816
+#define BSLS_MACROINCREMENTED_VALUE16816 16817
+#define BSLS_MACROINCREMENTED_VALUE16817 16818
+#define BSLS_MACROINCREMENTED_VALUE16818 16819
+#define BSLS_MACROINCREMENTED_VALUE16819 16820
+#define BSLS_MACROINCREMENTED_VALUE16820 16821
+#define BSLS_MACROINCREMENTED_VALUE16821 16822
+#define BSLS_MACROINCREMENTED_VALUE16822 16823
+#define BSLS_MACROINCREMENTED_VALUE16823 16824
+#define BSLS_MACROINCREMENTED_VALUE16824 16825
+#define BSLS_MACROINCREMENTED_VALUE16825 16826
+#define BSLS_MACROINCREMENTED_VALUE16826 16827
+#define BSLS_MACROINCREMENTED_VALUE16827 16828
+#define BSLS_MACROINCREMENTED_VALUE16828 16829
+#define BSLS_MACROINCREMENTED_VALUE16829 16830
+#define BSLS_MACROINCREMENTED_VALUE16830 16831
+#define BSLS_MACROINCREMENTED_VALUE16831 16832
+#define BSLS_MACROINCREMENTED_VALUE16832 16833
+#define BSLS_MACROINCREMENTED_VALUE16833 16834
+#define BSLS_MACROINCREMENTED_VALUE16834 16835
+#define BSLS_MACROINCREMENTED_VALUE16835 16836
+#define BSLS_MACROINCREMENTED_VALUE16836 16837
+#define BSLS_MACROINCREMENTED_VALUE16837 16838
+#define BSLS_MACROINCREMENTED_VALUE16838 16839
+#define BSLS_MACROINCREMENTED_VALUE16839 16840
+#define BSLS_MACROINCREMENTED_VALUE16840 16841
+#define BSLS_MACROINCREMENTED_VALUE16841 16842
+#define BSLS_MACROINCREMENTED_VALUE16842 16843
+#define BSLS_MACROINCREMENTED_VALUE16843 16844
+#define BSLS_MACROINCREMENTED_VALUE16844 16845
+#define BSLS_MACROINCREMENTED_VALUE16845 16846
+#define BSLS_MACROINCREMENTED_VALUE16846 16847
+#define BSLS_MACROINCREMENTED_VALUE16847 16848
+#define BSLS_MACROINCREMENTED_VALUE16848 16849
+#define BSLS_MACROINCREMENTED_VALUE16849 16850
+#define BSLS_MACROINCREMENTED_VALUE16850 16851
+#define BSLS_MACROINCREMENTED_VALUE16851 16852
+#define BSLS_MACROINCREMENTED_VALUE16852 16853
+#define BSLS_MACROINCREMENTED_VALUE16853 16854
+#define BSLS_MACROINCREMENTED_VALUE16854 16855
+#define BSLS_MACROINCREMENTED_VALUE16855 16856
+#define BSLS_MACROINCREMENTED_VALUE16856 16857
+#define BSLS_MACROINCREMENTED_VALUE16857 16858
+#define BSLS_MACROINCREMENTED_VALUE16858 16859
+#define BSLS_MACROINCREMENTED_VALUE16859 16860
+#define BSLS_MACROINCREMENTED_VALUE16860 16861
+#define BSLS_MACROINCREMENTED_VALUE16861 16862
+#define BSLS_MACROINCREMENTED_VALUE16862 16863
+#define BSLS_MACROINCREMENTED_VALUE16863 16864
+#define BSLS_MACROINCREMENTED_VALUE16864 16865
+#define BSLS_MACROINCREMENTED_VALUE16865 16866
+#define BSLS_MACROINCREMENTED_VALUE16866 16867
+#define BSLS_MACROINCREMENTED_VALUE16867 16868
+#define BSLS_MACROINCREMENTED_VALUE16868 16869
+#define BSLS_MACROINCREMENTED_VALUE16869 16870
+#define BSLS_MACROINCREMENTED_VALUE16870 16871
+#define BSLS_MACROINCREMENTED_VALUE16871 16872
+#define BSLS_MACROINCREMENTED_VALUE16872 16873
+#define BSLS_MACROINCREMENTED_VALUE16873 16874
+#define BSLS_MACROINCREMENTED_VALUE16874 16875
+#define BSLS_MACROINCREMENTED_VALUE16875 16876
+#define BSLS_MACROINCREMENTED_VALUE16876 16877
+#define BSLS_MACROINCREMENTED_VALUE16877 16878
+#define BSLS_MACROINCREMENTED_VALUE16878 16879
+#define BSLS_MACROINCREMENTED_VALUE16879 16880
+#define BSLS_MACROINCREMENTED_VALUE16880 16881
+#define BSLS_MACROINCREMENTED_VALUE16881 16882
+#define BSLS_MACROINCREMENTED_VALUE16882 16883
+#define BSLS_MACROINCREMENTED_VALUE16883 16884
+#define BSLS_MACROINCREMENTED_VALUE16884 16885
+#define BSLS_MACROINCREMENTED_VALUE16885 16886
+#define BSLS_MACROINCREMENTED_VALUE16886 16887
+#define BSLS_MACROINCREMENTED_VALUE16887 16888
+#define BSLS_MACROINCREMENTED_VALUE16888 16889
+#define BSLS_MACROINCREMENTED_VALUE16889 16890
+#define BSLS_MACROINCREMENTED_VALUE16890 16891
+#define BSLS_MACROINCREMENTED_VALUE16891 16892
+#define BSLS_MACROINCREMENTED_VALUE16892 16893
+#define BSLS_MACROINCREMENTED_VALUE16893 16894
+#define BSLS_MACROINCREMENTED_VALUE16894 16895
+#define BSLS_MACROINCREMENTED_VALUE16895 16896
+#define BSLS_MACROINCREMENTED_VALUE16896 16897
+#define BSLS_MACROINCREMENTED_VALUE16897 16898
+#define BSLS_MACROINCREMENTED_VALUE16898 16899
+#define BSLS_MACROINCREMENTED_VALUE16899 16900
+#define BSLS_MACROINCREMENTED_VALUE16900 16901
+#define BSLS_MACROINCREMENTED_VALUE16901 16902
+#define BSLS_MACROINCREMENTED_VALUE16902 16903
+#define BSLS_MACROINCREMENTED_VALUE16903 16904
+#define BSLS_MACROINCREMENTED_VALUE16904 16905
+#define BSLS_MACROINCREMENTED_VALUE16905 16906
+#define BSLS_MACROINCREMENTED_VALUE16906 16907
+#define BSLS_MACROINCREMENTED_VALUE16907 16908
+#define BSLS_MACROINCREMENTED_VALUE16908 16909
+#define BSLS_MACROINCREMENTED_VALUE16909 16910
+#define BSLS_MACROINCREMENTED_VALUE16910 16911
+#define BSLS_MACROINCREMENTED_VALUE16911 16912
+#define BSLS_MACROINCREMENTED_VALUE16912 16913
+#define BSLS_MACROINCREMENTED_VALUE16913 16914
+#define BSLS_MACROINCREMENTED_VALUE16914 16915
+#define BSLS_MACROINCREMENTED_VALUE16915 16916
+#define BSLS_MACROINCREMENTED_VALUE16916 16917
+#define BSLS_MACROINCREMENTED_VALUE16917 16918
+#define BSLS_MACROINCREMENTED_VALUE16918 16919
+#define BSLS_MACROINCREMENTED_VALUE16919 16920
+#define BSLS_MACROINCREMENTED_VALUE16920 16921
+#define BSLS_MACROINCREMENTED_VALUE16921 16922
+#define BSLS_MACROINCREMENTED_VALUE16922 16923
+#define BSLS_MACROINCREMENTED_VALUE16923 16924
+#define BSLS_MACROINCREMENTED_VALUE16924 16925
+#define BSLS_MACROINCREMENTED_VALUE16925 16926
+#define BSLS_MACROINCREMENTED_VALUE16926 16927
+#define BSLS_MACROINCREMENTED_VALUE16927 16928
+#define BSLS_MACROINCREMENTED_VALUE16928 16929
+#define BSLS_MACROINCREMENTED_VALUE16929 16930
+#define BSLS_MACROINCREMENTED_VALUE16930 16931
+#define BSLS_MACROINCREMENTED_VALUE16931 16932
+#define BSLS_MACROINCREMENTED_VALUE16932 16933
+#define BSLS_MACROINCREMENTED_VALUE16933 16934
+#define BSLS_MACROINCREMENTED_VALUE16934 16935
+#define BSLS_MACROINCREMENTED_VALUE16935 16936
+#define BSLS_MACROINCREMENTED_VALUE16936 16937
+#define BSLS_MACROINCREMENTED_VALUE16937 16938
+#define BSLS_MACROINCREMENTED_VALUE16938 16939
+#define BSLS_MACROINCREMENTED_VALUE16939 16940
+#define BSLS_MACROINCREMENTED_VALUE16940 16941
+#define BSLS_MACROINCREMENTED_VALUE16941 16942
+#define BSLS_MACROINCREMENTED_VALUE16942 16943
+#define BSLS_MACROINCREMENTED_VALUE16943 16944
+#define BSLS_MACROINCREMENTED_VALUE16944 16945
+#define BSLS_MACROINCREMENTED_VALUE16945 16946
+#define BSLS_MACROINCREMENTED_VALUE16946 16947
+#define BSLS_MACROINCREMENTED_VALUE16947 16948
+#define BSLS_MACROINCREMENTED_VALUE16948 16949
+#define BSLS_MACROINCREMENTED_VALUE16949 16950
+#define BSLS_MACROINCREMENTED_VALUE16950 16951
+#define BSLS_MACROINCREMENTED_VALUE16951 16952
+#define BSLS_MACROINCREMENTED_VALUE16952 16953
+#define BSLS_MACROINCREMENTED_VALUE16953 16954
+#define BSLS_MACROINCREMENTED_VALUE16954 16955
+#define BSLS_MACROINCREMENTED_VALUE16955 16956
+#define BSLS_MACROINCREMENTED_VALUE16956 16957
+#define BSLS_MACROINCREMENTED_VALUE16957 16958
+#define BSLS_MACROINCREMENTED_VALUE16958 16959
+#define BSLS_MACROINCREMENTED_VALUE16959 16960
+#define BSLS_MACROINCREMENTED_VALUE16960 16961
+#define BSLS_MACROINCREMENTED_VALUE16961 16962
+#define BSLS_MACROINCREMENTED_VALUE16962 16963
+#define BSLS_MACROINCREMENTED_VALUE16963 16964
+#define BSLS_MACROINCREMENTED_VALUE16964 16965
+#define BSLS_MACROINCREMENTED_VALUE16965 16966
+#define BSLS_MACROINCREMENTED_VALUE16966 16967
+#define BSLS_MACROINCREMENTED_VALUE16967 16968
+#define BSLS_MACROINCREMENTED_VALUE16968 16969
+#define BSLS_MACROINCREMENTED_VALUE16969 16970
+#define BSLS_MACROINCREMENTED_VALUE16970 16971
+#define BSLS_MACROINCREMENTED_VALUE16971 16972
+#define BSLS_MACROINCREMENTED_VALUE16972 16973
+#define BSLS_MACROINCREMENTED_VALUE16973 16974
+#define BSLS_MACROINCREMENTED_VALUE16974 16975
+#define BSLS_MACROINCREMENTED_VALUE16975 16976
+#define BSLS_MACROINCREMENTED_VALUE16976 16977
+#define BSLS_MACROINCREMENTED_VALUE16977 16978
+#define BSLS_MACROINCREMENTED_VALUE16978 16979
+#define BSLS_MACROINCREMENTED_VALUE16979 16980
+#define BSLS_MACROINCREMENTED_VALUE16980 16981
+#define BSLS_MACROINCREMENTED_VALUE16981 16982
+#define BSLS_MACROINCREMENTED_VALUE16982 16983
+#define BSLS_MACROINCREMENTED_VALUE16983 16984
+#define BSLS_MACROINCREMENTED_VALUE16984 16985
+#define BSLS_MACROINCREMENTED_VALUE16985 16986
+#define BSLS_MACROINCREMENTED_VALUE16986 16987
+#define BSLS_MACROINCREMENTED_VALUE16987 16988
+#define BSLS_MACROINCREMENTED_VALUE16988 16989
+#define BSLS_MACROINCREMENTED_VALUE16989 16990
+#define BSLS_MACROINCREMENTED_VALUE16990 16991
+#define BSLS_MACROINCREMENTED_VALUE16991 16992
+#define BSLS_MACROINCREMENTED_VALUE16992 16993
+#define BSLS_MACROINCREMENTED_VALUE16993 16994
+#define BSLS_MACROINCREMENTED_VALUE16994 16995
+#define BSLS_MACROINCREMENTED_VALUE16995 16996
+#define BSLS_MACROINCREMENTED_VALUE16996 16997
+#define BSLS_MACROINCREMENTED_VALUE16997 16998
+#define BSLS_MACROINCREMENTED_VALUE16998 16999
+#define BSLS_MACROINCREMENTED_VALUE16999 17000
+#define BSLS_MACROINCREMENTED_VALUE17000 17001
+#define BSLS_MACROINCREMENTED_VALUE17001 17002
+#define BSLS_MACROINCREMENTED_VALUE17002 17003
+#define BSLS_MACROINCREMENTED_VALUE17003 17004
+#define BSLS_MACROINCREMENTED_VALUE17004 17005
+#define BSLS_MACROINCREMENTED_VALUE17005 17006
+#define BSLS_MACROINCREMENTED_VALUE17006 17007
+#define BSLS_MACROINCREMENTED_VALUE17007 17008
+#define BSLS_MACROINCREMENTED_VALUE17008 17009
+#define BSLS_MACROINCREMENTED_VALUE17009 17010
+#define BSLS_MACROINCREMENTED_VALUE17010 17011
+#define BSLS_MACROINCREMENTED_VALUE17011 17012
+#define BSLS_MACROINCREMENTED_VALUE17012 17013
+#define BSLS_MACROINCREMENTED_VALUE17013 17014
+#define BSLS_MACROINCREMENTED_VALUE17014 17015
+#define BSLS_MACROINCREMENTED_VALUE17015 17016
+#define BSLS_MACROINCREMENTED_VALUE17016 17017
+#define BSLS_MACROINCREMENTED_VALUE17017 17018
+#define BSLS_MACROINCREMENTED_VALUE17018 17019
+#define BSLS_MACROINCREMENTED_VALUE17019 17020
+#define BSLS_MACROINCREMENTED_VALUE17020 17021
+#define BSLS_MACROINCREMENTED_VALUE17021 17022
+#define BSLS_MACROINCREMENTED_VALUE17022 17023
+#define BSLS_MACROINCREMENTED_VALUE17023 17024
+#define BSLS_MACROINCREMENTED_VALUE17024 17025
+#define BSLS_MACROINCREMENTED_VALUE17025 17026
+#define BSLS_MACROINCREMENTED_VALUE17026 17027
+#define BSLS_MACROINCREMENTED_VALUE17027 17028
+#define BSLS_MACROINCREMENTED_VALUE17028 17029
+#define BSLS_MACROINCREMENTED_VALUE17029 17030
+#define BSLS_MACROINCREMENTED_VALUE17030 17031
+#define BSLS_MACROINCREMENTED_VALUE17031 17032
+#define BSLS_MACROINCREMENTED_VALUE17032 17033
+#define BSLS_MACROINCREMENTED_VALUE17033 17034
+#define BSLS_MACROINCREMENTED_VALUE17034 17035
+#define BSLS_MACROINCREMENTED_VALUE17035 17036
+#define BSLS_MACROINCREMENTED_VALUE17036 17037
+#define BSLS_MACROINCREMENTED_VALUE17037 17038
+#define BSLS_MACROINCREMENTED_VALUE17038 17039
+#define BSLS_MACROINCREMENTED_VALUE17039 17040
+#define BSLS_MACROINCREMENTED_VALUE17040 17041
+#define BSLS_MACROINCREMENTED_VALUE17041 17042
+#define BSLS_MACROINCREMENTED_VALUE17042 17043
+#define BSLS_MACROINCREMENTED_VALUE17043 17044
+#define BSLS_MACROINCREMENTED_VALUE17044 17045
+#define BSLS_MACROINCREMENTED_VALUE17045 17046
+#define BSLS_MACROINCREMENTED_VALUE17046 17047
+#define BSLS_MACROINCREMENTED_VALUE17047 17048
+#define BSLS_MACROINCREMENTED_VALUE17048 17049
+#define BSLS_MACROINCREMENTED_VALUE17049 17050
+#define BSLS_MACROINCREMENTED_VALUE17050 17051
+#define BSLS_MACROINCREMENTED_VALUE17051 17052
+#define BSLS_MACROINCREMENTED_VALUE17052 17053
+#define BSLS_MACROINCREMENTED_VALUE17053 17054
+#define BSLS_MACROINCREMENTED_VALUE17054 17055
+#define BSLS_MACROINCREMENTED_VALUE17055 17056
+#define BSLS_MACROINCREMENTED_VALUE17056 17057
+#define BSLS_MACROINCREMENTED_VALUE17057 17058
+#define BSLS_MACROINCREMENTED_VALUE17058 17059
+#define BSLS_MACROINCREMENTED_VALUE17059 17060
+#define BSLS_MACROINCREMENTED_VALUE17060 17061
+#define BSLS_MACROINCREMENTED_VALUE17061 17062
+#define BSLS_MACROINCREMENTED_VALUE17062 17063
+#define BSLS_MACROINCREMENTED_VALUE17063 17064
+#define BSLS_MACROINCREMENTED_VALUE17064 17065
+#define BSLS_MACROINCREMENTED_VALUE17065 17066
+#define BSLS_MACROINCREMENTED_VALUE17066 17067
+#define BSLS_MACROINCREMENTED_VALUE17067 17068
+#define BSLS_MACROINCREMENTED_VALUE17068 17069
+#define BSLS_MACROINCREMENTED_VALUE17069 17070
+#define BSLS_MACROINCREMENTED_VALUE17070 17071
+#define BSLS_MACROINCREMENTED_VALUE17071 17072
+#define BSLS_MACROINCREMENTED_VALUE17072 17073
+#define BSLS_MACROINCREMENTED_VALUE17073 17074
+#define BSLS_MACROINCREMENTED_VALUE17074 17075
+#define BSLS_MACROINCREMENTED_VALUE17075 17076
+#define BSLS_MACROINCREMENTED_VALUE17076 17077
+#define BSLS_MACROINCREMENTED_VALUE17077 17078
+#define BSLS_MACROINCREMENTED_VALUE17078 17079
+#define BSLS_MACROINCREMENTED_VALUE17079 17080
+#define BSLS_MACROINCREMENTED_VALUE17080 17081
+#define BSLS_MACROINCREMENTED_VALUE17081 17082
+#define BSLS_MACROINCREMENTED_VALUE17082 17083
+#define BSLS_MACROINCREMENTED_VALUE17083 17084
+#define BSLS_MACROINCREMENTED_VALUE17084 17085
+#define BSLS_MACROINCREMENTED_VALUE17085 17086
+#define BSLS_MACROINCREMENTED_VALUE17086 17087
+#define BSLS_MACROINCREMENTED_VALUE17087 17088
+#define BSLS_MACROINCREMENTED_VALUE17088 17089
+#define BSLS_MACROINCREMENTED_VALUE17089 17090
+#define BSLS_MACROINCREMENTED_VALUE17090 17091
+#define BSLS_MACROINCREMENTED_VALUE17091 17092
+#define BSLS_MACROINCREMENTED_VALUE17092 17093
+#define BSLS_MACROINCREMENTED_VALUE17093 17094
+#define BSLS_MACROINCREMENTED_VALUE17094 17095
+#define BSLS_MACROINCREMENTED_VALUE17095 17096
+#define BSLS_MACROINCREMENTED_VALUE17096 17097
+#define BSLS_MACROINCREMENTED_VALUE17097 17098
+#define BSLS_MACROINCREMENTED_VALUE17098 17099
+#define BSLS_MACROINCREMENTED_VALUE17099 17100
+#define BSLS_MACROINCREMENTED_VALUE17100 17101
+#define BSLS_MACROINCREMENTED_VALUE17101 17102
+#define BSLS_MACROINCREMENTED_VALUE17102 17103
+#define BSLS_MACROINCREMENTED_VALUE17103 17104
+#define BSLS_MACROINCREMENTED_VALUE17104 17105
+#define BSLS_MACROINCREMENTED_VALUE17105 17106
+#define BSLS_MACROINCREMENTED_VALUE17106 17107
+#define BSLS_MACROINCREMENTED_VALUE17107 17108
+#define BSLS_MACROINCREMENTED_VALUE17108 17109
+#define BSLS_MACROINCREMENTED_VALUE17109 17110
+#define BSLS_MACROINCREMENTED_VALUE17110 17111
+#define BSLS_MACROINCREMENTED_VALUE17111 17112
+#define BSLS_MACROINCREMENTED_VALUE17112 17113
+#define BSLS_MACROINCREMENTED_VALUE17113 17114
+#define BSLS_MACROINCREMENTED_VALUE17114 17115
+#define BSLS_MACROINCREMENTED_VALUE17115 17116
+#define BSLS_MACROINCREMENTED_VALUE17116 17117
+#define BSLS_MACROINCREMENTED_VALUE17117 17118
+#define BSLS_MACROINCREMENTED_VALUE17118 17119
+#define BSLS_MACROINCREMENTED_VALUE17119 17120
+#define BSLS_MACROINCREMENTED_VALUE17120 17121
+#define BSLS_MACROINCREMENTED_VALUE17121 17122
+#define BSLS_MACROINCREMENTED_VALUE17122 17123
+#define BSLS_MACROINCREMENTED_VALUE17123 17124
+#define BSLS_MACROINCREMENTED_VALUE17124 17125
+#define BSLS_MACROINCREMENTED_VALUE17125 17126
+#define BSLS_MACROINCREMENTED_VALUE17126 17127
+#define BSLS_MACROINCREMENTED_VALUE17127 17128
+#define BSLS_MACROINCREMENTED_VALUE17128 17129
+#define BSLS_MACROINCREMENTED_VALUE17129 17130
+#define BSLS_MACROINCREMENTED_VALUE17130 17131
+#define BSLS_MACROINCREMENTED_VALUE17131 17132
+#define BSLS_MACROINCREMENTED_VALUE17132 17133
+#define BSLS_MACROINCREMENTED_VALUE17133 17134
+#define BSLS_MACROINCREMENTED_VALUE17134 17135
+#define BSLS_MACROINCREMENTED_VALUE17135 17136
+#define BSLS_MACROINCREMENTED_VALUE17136 17137
+#define BSLS_MACROINCREMENTED_VALUE17137 17138
+#define BSLS_MACROINCREMENTED_VALUE17138 17139
+#define BSLS_MACROINCREMENTED_VALUE17139 17140
+#define BSLS_MACROINCREMENTED_VALUE17140 17141
+#define BSLS_MACROINCREMENTED_VALUE17141 17142
+#define BSLS_MACROINCREMENTED_VALUE17142 17143
+#define BSLS_MACROINCREMENTED_VALUE17143 17144
+#define BSLS_MACROINCREMENTED_VALUE17144 17145
+#define BSLS_MACROINCREMENTED_VALUE17145 17146
+#define BSLS_MACROINCREMENTED_VALUE17146 17147
+#define BSLS_MACROINCREMENTED_VALUE17147 17148
+#define BSLS_MACROINCREMENTED_VALUE17148 17149
+#define BSLS_MACROINCREMENTED_VALUE17149 17150
+#define BSLS_MACROINCREMENTED_VALUE17150 17151
+#define BSLS_MACROINCREMENTED_VALUE17151 17152
+#define BSLS_MACROINCREMENTED_VALUE17152 17153
+#define BSLS_MACROINCREMENTED_VALUE17153 17154
+#define BSLS_MACROINCREMENTED_VALUE17154 17155
+#define BSLS_MACROINCREMENTED_VALUE17155 17156
+#define BSLS_MACROINCREMENTED_VALUE17156 17157
+#define BSLS_MACROINCREMENTED_VALUE17157 17158
+#define BSLS_MACROINCREMENTED_VALUE17158 17159
+#define BSLS_MACROINCREMENTED_VALUE17159 17160
+#define BSLS_MACROINCREMENTED_VALUE17160 17161
+#define BSLS_MACROINCREMENTED_VALUE17161 17162
+#define BSLS_MACROINCREMENTED_VALUE17162 17163
+#define BSLS_MACROINCREMENTED_VALUE17163 17164
+#define BSLS_MACROINCREMENTED_VALUE17164 17165
+#define BSLS_MACROINCREMENTED_VALUE17165 17166
+#define BSLS_MACROINCREMENTED_VALUE17166 17167
+#define BSLS_MACROINCREMENTED_VALUE17167 17168
+#define BSLS_MACROINCREMENTED_VALUE17168 17169
+#define BSLS_MACROINCREMENTED_VALUE17169 17170
+#define BSLS_MACROINCREMENTED_VALUE17170 17171
+#define BSLS_MACROINCREMENTED_VALUE17171 17172
+#define BSLS_MACROINCREMENTED_VALUE17172 17173
+#define BSLS_MACROINCREMENTED_VALUE17173 17174
+#define BSLS_MACROINCREMENTED_VALUE17174 17175
+#define BSLS_MACROINCREMENTED_VALUE17175 17176
+#define BSLS_MACROINCREMENTED_VALUE17176 17177
+#define BSLS_MACROINCREMENTED_VALUE17177 17178
+#define BSLS_MACROINCREMENTED_VALUE17178 17179
+#define BSLS_MACROINCREMENTED_VALUE17179 17180
+#define BSLS_MACROINCREMENTED_VALUE17180 17181
+#define BSLS_MACROINCREMENTED_VALUE17181 17182
+#define BSLS_MACROINCREMENTED_VALUE17182 17183
+#define BSLS_MACROINCREMENTED_VALUE17183 17184
+#define BSLS_MACROINCREMENTED_VALUE17184 17185
+#define BSLS_MACROINCREMENTED_VALUE17185 17186
+#define BSLS_MACROINCREMENTED_VALUE17186 17187
+#define BSLS_MACROINCREMENTED_VALUE17187 17188
+#define BSLS_MACROINCREMENTED_VALUE17188 17189
+#define BSLS_MACROINCREMENTED_VALUE17189 17190
+#define BSLS_MACROINCREMENTED_VALUE17190 17191
+#define BSLS_MACROINCREMENTED_VALUE17191 17192
+#define BSLS_MACROINCREMENTED_VALUE17192 17193
+#define BSLS_MACROINCREMENTED_VALUE17193 17194
+#define BSLS_MACROINCREMENTED_VALUE17194 17195
+#define BSLS_MACROINCREMENTED_VALUE17195 17196
+#define BSLS_MACROINCREMENTED_VALUE17196 17197
+#define BSLS_MACROINCREMENTED_VALUE17197 17198
+#define BSLS_MACROINCREMENTED_VALUE17198 17199
+#define BSLS_MACROINCREMENTED_VALUE17199 17200
+#define BSLS_MACROINCREMENTED_VALUE17200 17201
+#define BSLS_MACROINCREMENTED_VALUE17201 17202
+#define BSLS_MACROINCREMENTED_VALUE17202 17203
+#define BSLS_MACROINCREMENTED_VALUE17203 17204
+#define BSLS_MACROINCREMENTED_VALUE17204 17205
+#define BSLS_MACROINCREMENTED_VALUE17205 17206
+#define BSLS_MACROINCREMENTED_VALUE17206 17207
+#define BSLS_MACROINCREMENTED_VALUE17207 17208
+#define BSLS_MACROINCREMENTED_VALUE17208 17209
+#define BSLS_MACROINCREMENTED_VALUE17209 17210
+#define BSLS_MACROINCREMENTED_VALUE17210 17211
+#define BSLS_MACROINCREMENTED_VALUE17211 17212
+#define BSLS_MACROINCREMENTED_VALUE17212 17213
+#define BSLS_MACROINCREMENTED_VALUE17213 17214
+#define BSLS_MACROINCREMENTED_VALUE17214 17215
+#define BSLS_MACROINCREMENTED_VALUE17215 17216
+#define BSLS_MACROINCREMENTED_VALUE17216 17217
+#define BSLS_MACROINCREMENTED_VALUE17217 17218
+#define BSLS_MACROINCREMENTED_VALUE17218 17219
+#define BSLS_MACROINCREMENTED_VALUE17219 17220
+#define BSLS_MACROINCREMENTED_VALUE17220 17221
+#define BSLS_MACROINCREMENTED_VALUE17221 17222
+#define BSLS_MACROINCREMENTED_VALUE17222 17223
+#define BSLS_MACROINCREMENTED_VALUE17223 17224
+#define BSLS_MACROINCREMENTED_VALUE17224 17225
+#define BSLS_MACROINCREMENTED_VALUE17225 17226
+#define BSLS_MACROINCREMENTED_VALUE17226 17227
+#define BSLS_MACROINCREMENTED_VALUE17227 17228
+#define BSLS_MACROINCREMENTED_VALUE17228 17229
+#define BSLS_MACROINCREMENTED_VALUE17229 17230
+#define BSLS_MACROINCREMENTED_VALUE17230 17231
+#define BSLS_MACROINCREMENTED_VALUE17231 17232
+#define BSLS_MACROINCREMENTED_VALUE17232 17233
+#define BSLS_MACROINCREMENTED_VALUE17233 17234
+#define BSLS_MACROINCREMENTED_VALUE17234 17235
+#define BSLS_MACROINCREMENTED_VALUE17235 17236
+#define BSLS_MACROINCREMENTED_VALUE17236 17237
+#define BSLS_MACROINCREMENTED_VALUE17237 17238
+#define BSLS_MACROINCREMENTED_VALUE17238 17239
+#define BSLS_MACROINCREMENTED_VALUE17239 17240
+#define BSLS_MACROINCREMENTED_VALUE17240 17241
+#define BSLS_MACROINCREMENTED_VALUE17241 17242
+#define BSLS_MACROINCREMENTED_VALUE17242 17243
+#define BSLS_MACROINCREMENTED_VALUE17243 17244
+#define BSLS_MACROINCREMENTED_VALUE17244 17245
+#define BSLS_MACROINCREMENTED_VALUE17245 17246
+#define BSLS_MACROINCREMENTED_VALUE17246 17247
+#define BSLS_MACROINCREMENTED_VALUE17247 17248
+#define BSLS_MACROINCREMENTED_VALUE17248 17249
+#define BSLS_MACROINCREMENTED_VALUE17249 17250
+#define BSLS_MACROINCREMENTED_VALUE17250 17251
+#define BSLS_MACROINCREMENTED_VALUE17251 17252
+#define BSLS_MACROINCREMENTED_VALUE17252 17253
+#define BSLS_MACROINCREMENTED_VALUE17253 17254
+#define BSLS_MACROINCREMENTED_VALUE17254 17255
+#define BSLS_MACROINCREMENTED_VALUE17255 17256
+#define BSLS_MACROINCREMENTED_VALUE17256 17257
+#define BSLS_MACROINCREMENTED_VALUE17257 17258
+#define BSLS_MACROINCREMENTED_VALUE17258 17259
+#define BSLS_MACROINCREMENTED_VALUE17259 17260
+#define BSLS_MACROINCREMENTED_VALUE17260 17261
+#define BSLS_MACROINCREMENTED_VALUE17261 17262
+#define BSLS_MACROINCREMENTED_VALUE17262 17263
+#define BSLS_MACROINCREMENTED_VALUE17263 17264
+#define BSLS_MACROINCREMENTED_VALUE17264 17265
+#define BSLS_MACROINCREMENTED_VALUE17265 17266
+#define BSLS_MACROINCREMENTED_VALUE17266 17267
+#define BSLS_MACROINCREMENTED_VALUE17267 17268
+#define BSLS_MACROINCREMENTED_VALUE17268 17269
+#define BSLS_MACROINCREMENTED_VALUE17269 17270
+#define BSLS_MACROINCREMENTED_VALUE17270 17271
+#define BSLS_MACROINCREMENTED_VALUE17271 17272
+#define BSLS_MACROINCREMENTED_VALUE17272 17273
+#define BSLS_MACROINCREMENTED_VALUE17273 17274
+#define BSLS_MACROINCREMENTED_VALUE17274 17275
+#define BSLS_MACROINCREMENTED_VALUE17275 17276
+#define BSLS_MACROINCREMENTED_VALUE17276 17277
+#define BSLS_MACROINCREMENTED_VALUE17277 17278
+#define BSLS_MACROINCREMENTED_VALUE17278 17279
+#define BSLS_MACROINCREMENTED_VALUE17279 17280
+#define BSLS_MACROINCREMENTED_VALUE17280 17281
+#define BSLS_MACROINCREMENTED_VALUE17281 17282
+#define BSLS_MACROINCREMENTED_VALUE17282 17283
+#define BSLS_MACROINCREMENTED_VALUE17283 17284
+#define BSLS_MACROINCREMENTED_VALUE17284 17285
+#define BSLS_MACROINCREMENTED_VALUE17285 17286
+#define BSLS_MACROINCREMENTED_VALUE17286 17287
+#define BSLS_MACROINCREMENTED_VALUE17287 17288
+#define BSLS_MACROINCREMENTED_VALUE17288 17289
+#define BSLS_MACROINCREMENTED_VALUE17289 17290
+#define BSLS_MACROINCREMENTED_VALUE17290 17291
+#define BSLS_MACROINCREMENTED_VALUE17291 17292
+#define BSLS_MACROINCREMENTED_VALUE17292 17293
+#define BSLS_MACROINCREMENTED_VALUE17293 17294
+#define BSLS_MACROINCREMENTED_VALUE17294 17295
+#define BSLS_MACROINCREMENTED_VALUE17295 17296
+#define BSLS_MACROINCREMENTED_VALUE17296 17297
+#define BSLS_MACROINCREMENTED_VALUE17297 17298
+#define BSLS_MACROINCREMENTED_VALUE17298 17299
+#define BSLS_MACROINCREMENTED_VALUE17299 17300
+#define BSLS_MACROINCREMENTED_VALUE17300 17301
+#define BSLS_MACROINCREMENTED_VALUE17301 17302
+#define BSLS_MACROINCREMENTED_VALUE17302 17303
+#define BSLS_MACROINCREMENTED_VALUE17303 17304
+#define BSLS_MACROINCREMENTED_VALUE17304 17305
+#define BSLS_MACROINCREMENTED_VALUE17305 17306
+#define BSLS_MACROINCREMENTED_VALUE17306 17307
+#define BSLS_MACROINCREMENTED_VALUE17307 17308
+#define BSLS_MACROINCREMENTED_VALUE17308 17309
+#define BSLS_MACROINCREMENTED_VALUE17309 17310
+#define BSLS_MACROINCREMENTED_VALUE17310 17311
+#define BSLS_MACROINCREMENTED_VALUE17311 17312
+#define BSLS_MACROINCREMENTED_VALUE17312 17313
+#define BSLS_MACROINCREMENTED_VALUE17313 17314
+#define BSLS_MACROINCREMENTED_VALUE17314 17315
+#define BSLS_MACROINCREMENTED_VALUE17315 17316
+#define BSLS_MACROINCREMENTED_VALUE17316 17317
+#define BSLS_MACROINCREMENTED_VALUE17317 17318
+#define BSLS_MACROINCREMENTED_VALUE17318 17319
+#define BSLS_MACROINCREMENTED_VALUE17319 17320
+#define BSLS_MACROINCREMENTED_VALUE17320 17321
+#define BSLS_MACROINCREMENTED_VALUE17321 17322
+#define BSLS_MACROINCREMENTED_VALUE17322 17323
+#define BSLS_MACROINCREMENTED_VALUE17323 17324
+#define BSLS_MACROINCREMENTED_VALUE17324 17325
+#define BSLS_MACROINCREMENTED_VALUE17325 17326
+#define BSLS_MACROINCREMENTED_VALUE17326 17327
+#define BSLS_MACROINCREMENTED_VALUE17327 17328
+#define BSLS_MACROINCREMENTED_VALUE17328 17329
+#define BSLS_MACROINCREMENTED_VALUE17329 17330
+#define BSLS_MACROINCREMENTED_VALUE17330 17331
+#define BSLS_MACROINCREMENTED_VALUE17331 17332
+#define BSLS_MACROINCREMENTED_VALUE17332 17333
+#define BSLS_MACROINCREMENTED_VALUE17333 17334
+#define BSLS_MACROINCREMENTED_VALUE17334 17335
+#define BSLS_MACROINCREMENTED_VALUE17335 17336
+#define BSLS_MACROINCREMENTED_VALUE17336 17337
+#define BSLS_MACROINCREMENTED_VALUE17337 17338
+#define BSLS_MACROINCREMENTED_VALUE17338 17339
+#define BSLS_MACROINCREMENTED_VALUE17339 17340
+#define BSLS_MACROINCREMENTED_VALUE17340 17341
+#define BSLS_MACROINCREMENTED_VALUE17341 17342
+#define BSLS_MACROINCREMENTED_VALUE17342 17343
+#define BSLS_MACROINCREMENTED_VALUE17343 17344
+#define BSLS_MACROINCREMENTED_VALUE17344 17345
+#define BSLS_MACROINCREMENTED_VALUE17345 17346
+#define BSLS_MACROINCREMENTED_VALUE17346 17347
+#define BSLS_MACROINCREMENTED_VALUE17347 17348
+#define BSLS_MACROINCREMENTED_VALUE17348 17349
+#define BSLS_MACROINCREMENTED_VALUE17349 17350
+#define BSLS_MACROINCREMENTED_VALUE17350 17351
+#define BSLS_MACROINCREMENTED_VALUE17351 17352
+#define BSLS_MACROINCREMENTED_VALUE17352 17353
+#define BSLS_MACROINCREMENTED_VALUE17353 17354
+#define BSLS_MACROINCREMENTED_VALUE17354 17355
+#define BSLS_MACROINCREMENTED_VALUE17355 17356
+#define BSLS_MACROINCREMENTED_VALUE17356 17357
+#define BSLS_MACROINCREMENTED_VALUE17357 17358
+#define BSLS_MACROINCREMENTED_VALUE17358 17359
+#define BSLS_MACROINCREMENTED_VALUE17359 17360
+#define BSLS_MACROINCREMENTED_VALUE17360 17361
+#define BSLS_MACROINCREMENTED_VALUE17361 17362
+#define BSLS_MACROINCREMENTED_VALUE17362 17363
+#define BSLS_MACROINCREMENTED_VALUE17363 17364
+#define BSLS_MACROINCREMENTED_VALUE17364 17365
+#define BSLS_MACROINCREMENTED_VALUE17365 17366
+#define BSLS_MACROINCREMENTED_VALUE17366 17367
+#define BSLS_MACROINCREMENTED_VALUE17367 17368
+#define BSLS_MACROINCREMENTED_VALUE17368 17369
+#define BSLS_MACROINCREMENTED_VALUE17369 17370
+#define BSLS_MACROINCREMENTED_VALUE17370 17371
+#define BSLS_MACROINCREMENTED_VALUE17371 17372
+#define BSLS_MACROINCREMENTED_VALUE17372 17373
+#define BSLS_MACROINCREMENTED_VALUE17373 17374
+#define BSLS_MACROINCREMENTED_VALUE17374 17375
+#define BSLS_MACROINCREMENTED_VALUE17375 17376
+#define BSLS_MACROINCREMENTED_VALUE17376 17377
+#define BSLS_MACROINCREMENTED_VALUE17377 17378
+#define BSLS_MACROINCREMENTED_VALUE17378 17379
+#define BSLS_MACROINCREMENTED_VALUE17379 17380
+#define BSLS_MACROINCREMENTED_VALUE17380 17381
+#define BSLS_MACROINCREMENTED_VALUE17381 17382
+#define BSLS_MACROINCREMENTED_VALUE17382 17383
+#define BSLS_MACROINCREMENTED_VALUE17383 17384
+#define BSLS_MACROINCREMENTED_VALUE17384 17385
+#define BSLS_MACROINCREMENTED_VALUE17385 17386
+#define BSLS_MACROINCREMENTED_VALUE17386 17387
+#define BSLS_MACROINCREMENTED_VALUE17387 17388
+#define BSLS_MACROINCREMENTED_VALUE17388 17389
+#define BSLS_MACROINCREMENTED_VALUE17389 17390
+#define BSLS_MACROINCREMENTED_VALUE17390 17391
+#define BSLS_MACROINCREMENTED_VALUE17391 17392
+#define BSLS_MACROINCREMENTED_VALUE17392 17393
+#define BSLS_MACROINCREMENTED_VALUE17393 17394
+#define BSLS_MACROINCREMENTED_VALUE17394 17395
+#define BSLS_MACROINCREMENTED_VALUE17395 17396
+#define BSLS_MACROINCREMENTED_VALUE17396 17397
+#define BSLS_MACROINCREMENTED_VALUE17397 17398
+#define BSLS_MACROINCREMENTED_VALUE17398 17399
+#define BSLS_MACROINCREMENTED_VALUE17399 17400
+#define BSLS_MACROINCREMENTED_VALUE17400 17401
+#define BSLS_MACROINCREMENTED_VALUE17401 17402
+#define BSLS_MACROINCREMENTED_VALUE17402 17403
+#define BSLS_MACROINCREMENTED_VALUE17403 17404
+#define BSLS_MACROINCREMENTED_VALUE17404 17405
+#define BSLS_MACROINCREMENTED_VALUE17405 17406
+#define BSLS_MACROINCREMENTED_VALUE17406 17407
+#define BSLS_MACROINCREMENTED_VALUE17407 17408
+#define BSLS_MACROINCREMENTED_VALUE17408 17409
+#define BSLS_MACROINCREMENTED_VALUE17409 17410
+#define BSLS_MACROINCREMENTED_VALUE17410 17411
+#define BSLS_MACROINCREMENTED_VALUE17411 17412
+#define BSLS_MACROINCREMENTED_VALUE17412 17413
+#define BSLS_MACROINCREMENTED_VALUE17413 17414
+#define BSLS_MACROINCREMENTED_VALUE17414 17415
+#define BSLS_MACROINCREMENTED_VALUE17415 17416
+#define BSLS_MACROINCREMENTED_VALUE17416 17417
+#define BSLS_MACROINCREMENTED_VALUE17417 17418
+#define BSLS_MACROINCREMENTED_VALUE17418 17419
+#define BSLS_MACROINCREMENTED_VALUE17419 17420
+#define BSLS_MACROINCREMENTED_VALUE17420 17421
+#define BSLS_MACROINCREMENTED_VALUE17421 17422
+#define BSLS_MACROINCREMENTED_VALUE17422 17423
+#define BSLS_MACROINCREMENTED_VALUE17423 17424
+#define BSLS_MACROINCREMENTED_VALUE17424 17425
+#define BSLS_MACROINCREMENTED_VALUE17425 17426
+#define BSLS_MACROINCREMENTED_VALUE17426 17427
+#define BSLS_MACROINCREMENTED_VALUE17427 17428
+#define BSLS_MACROINCREMENTED_VALUE17428 17429
+#define BSLS_MACROINCREMENTED_VALUE17429 17430
+#define BSLS_MACROINCREMENTED_VALUE17430 17431
+#define BSLS_MACROINCREMENTED_VALUE17431 17432
+#define BSLS_MACROINCREMENTED_VALUE17432 17433
+#define BSLS_MACROINCREMENTED_VALUE17433 17434
+#define BSLS_MACROINCREMENTED_VALUE17434 17435
+#define BSLS_MACROINCREMENTED_VALUE17435 17436
+#define BSLS_MACROINCREMENTED_VALUE17436 17437
+#define BSLS_MACROINCREMENTED_VALUE17437 17438
+#define BSLS_MACROINCREMENTED_VALUE17438 17439
+#define BSLS_MACROINCREMENTED_VALUE17439 17440
+#define BSLS_MACROINCREMENTED_VALUE17440 17441
+#define BSLS_MACROINCREMENTED_VALUE17441 17442
+#define BSLS_MACROINCREMENTED_VALUE17442 17443
+#define BSLS_MACROINCREMENTED_VALUE17443 17444
+#define BSLS_MACROINCREMENTED_VALUE17444 17445
+#define BSLS_MACROINCREMENTED_VALUE17445 17446
+#define BSLS_MACROINCREMENTED_VALUE17446 17447
+#define BSLS_MACROINCREMENTED_VALUE17447 17448
+#define BSLS_MACROINCREMENTED_VALUE17448 17449
+#define BSLS_MACROINCREMENTED_VALUE17449 17450
+#define BSLS_MACROINCREMENTED_VALUE17450 17451
+#define BSLS_MACROINCREMENTED_VALUE17451 17452
+#define BSLS_MACROINCREMENTED_VALUE17452 17453
+#define BSLS_MACROINCREMENTED_VALUE17453 17454
+#define BSLS_MACROINCREMENTED_VALUE17454 17455
+#define BSLS_MACROINCREMENTED_VALUE17455 17456
+#define BSLS_MACROINCREMENTED_VALUE17456 17457
+#define BSLS_MACROINCREMENTED_VALUE17457 17458
+#define BSLS_MACROINCREMENTED_VALUE17458 17459
+#define BSLS_MACROINCREMENTED_VALUE17459 17460
+#define BSLS_MACROINCREMENTED_VALUE17460 17461
+#define BSLS_MACROINCREMENTED_VALUE17461 17462
+#define BSLS_MACROINCREMENTED_VALUE17462 17463
+#define BSLS_MACROINCREMENTED_VALUE17463 17464
+#define BSLS_MACROINCREMENTED_VALUE17464 17465
+#define BSLS_MACROINCREMENTED_VALUE17465 17466
+#define BSLS_MACROINCREMENTED_VALUE17466 17467
+#define BSLS_MACROINCREMENTED_VALUE17467 17468
+#define BSLS_MACROINCREMENTED_VALUE17468 17469
+#define BSLS_MACROINCREMENTED_VALUE17469 17470
+#define BSLS_MACROINCREMENTED_VALUE17470 17471
+#define BSLS_MACROINCREMENTED_VALUE17471 17472
+#define BSLS_MACROINCREMENTED_VALUE17472 17473
+#define BSLS_MACROINCREMENTED_VALUE17473 17474
+#define BSLS_MACROINCREMENTED_VALUE17474 17475
+#define BSLS_MACROINCREMENTED_VALUE17475 17476
+#define BSLS_MACROINCREMENTED_VALUE17476 17477
+#define BSLS_MACROINCREMENTED_VALUE17477 17478
+#define BSLS_MACROINCREMENTED_VALUE17478 17479
+#define BSLS_MACROINCREMENTED_VALUE17479 17480
+#define BSLS_MACROINCREMENTED_VALUE17480 17481
+#define BSLS_MACROINCREMENTED_VALUE17481 17482
+#define BSLS_MACROINCREMENTED_VALUE17482 17483
+#define BSLS_MACROINCREMENTED_VALUE17483 17484
+#define BSLS_MACROINCREMENTED_VALUE17484 17485
+#define BSLS_MACROINCREMENTED_VALUE17485 17486
+#define BSLS_MACROINCREMENTED_VALUE17486 17487
+#define BSLS_MACROINCREMENTED_VALUE17487 17488
+#define BSLS_MACROINCREMENTED_VALUE17488 17489
+#define BSLS_MACROINCREMENTED_VALUE17489 17490
+#define BSLS_MACROINCREMENTED_VALUE17490 17491
+#define BSLS_MACROINCREMENTED_VALUE17491 17492
+#define BSLS_MACROINCREMENTED_VALUE17492 17493
+#define BSLS_MACROINCREMENTED_VALUE17493 17494
+#define BSLS_MACROINCREMENTED_VALUE17494 17495
+#define BSLS_MACROINCREMENTED_VALUE17495 17496
+#define BSLS_MACROINCREMENTED_VALUE17496 17497
+#define BSLS_MACROINCREMENTED_VALUE17497 17498
+#define BSLS_MACROINCREMENTED_VALUE17498 17499
+#define BSLS_MACROINCREMENTED_VALUE17499 17500
+#define BSLS_MACROINCREMENTED_VALUE17500 17501
+#define BSLS_MACROINCREMENTED_VALUE17501 17502
+#define BSLS_MACROINCREMENTED_VALUE17502 17503
+#define BSLS_MACROINCREMENTED_VALUE17503 17504
+#define BSLS_MACROINCREMENTED_VALUE17504 17505
+#define BSLS_MACROINCREMENTED_VALUE17505 17506
+#define BSLS_MACROINCREMENTED_VALUE17506 17507
+#define BSLS_MACROINCREMENTED_VALUE17507 17508
+#define BSLS_MACROINCREMENTED_VALUE17508 17509
+#define BSLS_MACROINCREMENTED_VALUE17509 17510
+#define BSLS_MACROINCREMENTED_VALUE17510 17511
+#define BSLS_MACROINCREMENTED_VALUE17511 17512
+#define BSLS_MACROINCREMENTED_VALUE17512 17513
+#define BSLS_MACROINCREMENTED_VALUE17513 17514
+#define BSLS_MACROINCREMENTED_VALUE17514 17515
+#define BSLS_MACROINCREMENTED_VALUE17515 17516
+#define BSLS_MACROINCREMENTED_VALUE17516 17517
+#define BSLS_MACROINCREMENTED_VALUE17517 17518
+#define BSLS_MACROINCREMENTED_VALUE17518 17519
+#define BSLS_MACROINCREMENTED_VALUE17519 17520
+#define BSLS_MACROINCREMENTED_VALUE17520 17521
+#define BSLS_MACROINCREMENTED_VALUE17521 17522
+#define BSLS_MACROINCREMENTED_VALUE17522 17523
+#define BSLS_MACROINCREMENTED_VALUE17523 17524
+#define BSLS_MACROINCREMENTED_VALUE17524 17525
+#define BSLS_MACROINCREMENTED_VALUE17525 17526
+#define BSLS_MACROINCREMENTED_VALUE17526 17527
+#define BSLS_MACROINCREMENTED_VALUE17527 17528
+#define BSLS_MACROINCREMENTED_VALUE17528 17529
+#define BSLS_MACROINCREMENTED_VALUE17529 17530
+#define BSLS_MACROINCREMENTED_VALUE17530 17531
+#define BSLS_MACROINCREMENTED_VALUE17531 17532
+#define BSLS_MACROINCREMENTED_VALUE17532 17533
+#define BSLS_MACROINCREMENTED_VALUE17533 17534
+#define BSLS_MACROINCREMENTED_VALUE17534 17535
+#define BSLS_MACROINCREMENTED_VALUE17535 17536
+#define BSLS_MACROINCREMENTED_VALUE17536 17537
+#define BSLS_MACROINCREMENTED_VALUE17537 17538
+#define BSLS_MACROINCREMENTED_VALUE17538 17539
+#define BSLS_MACROINCREMENTED_VALUE17539 17540
+#define BSLS_MACROINCREMENTED_VALUE17540 17541
+#define BSLS_MACROINCREMENTED_VALUE17541 17542
+#define BSLS_MACROINCREMENTED_VALUE17542 17543
+#define BSLS_MACROINCREMENTED_VALUE17543 17544
+#define BSLS_MACROINCREMENTED_VALUE17544 17545
+#define BSLS_MACROINCREMENTED_VALUE17545 17546
+#define BSLS_MACROINCREMENTED_VALUE17546 17547
+#define BSLS_MACROINCREMENTED_VALUE17547 17548
+#define BSLS_MACROINCREMENTED_VALUE17548 17549
+#define BSLS_MACROINCREMENTED_VALUE17549 17550
+#define BSLS_MACROINCREMENTED_VALUE17550 17551
+#define BSLS_MACROINCREMENTED_VALUE17551 17552
+#define BSLS_MACROINCREMENTED_VALUE17552 17553
+#define BSLS_MACROINCREMENTED_VALUE17553 17554
+#define BSLS_MACROINCREMENTED_VALUE17554 17555
+#define BSLS_MACROINCREMENTED_VALUE17555 17556
+#define BSLS_MACROINCREMENTED_VALUE17556 17557
+#define BSLS_MACROINCREMENTED_VALUE17557 17558
+#define BSLS_MACROINCREMENTED_VALUE17558 17559
+#define BSLS_MACROINCREMENTED_VALUE17559 17560
+#define BSLS_MACROINCREMENTED_VALUE17560 17561
+#define BSLS_MACROINCREMENTED_VALUE17561 17562
+#define BSLS_MACROINCREMENTED_VALUE17562 17563
+#define BSLS_MACROINCREMENTED_VALUE17563 17564
+#define BSLS_MACROINCREMENTED_VALUE17564 17565
+#define BSLS_MACROINCREMENTED_VALUE17565 17566
+#define BSLS_MACROINCREMENTED_VALUE17566 17567
+#define BSLS_MACROINCREMENTED_VALUE17567 17568
+#define BSLS_MACROINCREMENTED_VALUE17568 17569
+#define BSLS_MACROINCREMENTED_VALUE17569 17570
+#define BSLS_MACROINCREMENTED_VALUE17570 17571
+#define BSLS_MACROINCREMENTED_VALUE17571 17572
+#define BSLS_MACROINCREMENTED_VALUE17572 17573
+#define BSLS_MACROINCREMENTED_VALUE17573 17574
+#define BSLS_MACROINCREMENTED_VALUE17574 17575
+#define BSLS_MACROINCREMENTED_VALUE17575 17576
+#define BSLS_MACROINCREMENTED_VALUE17576 17577
+#define BSLS_MACROINCREMENTED_VALUE17577 17578
+#define BSLS_MACROINCREMENTED_VALUE17578 17579
+#define BSLS_MACROINCREMENTED_VALUE17579 17580
+#define BSLS_MACROINCREMENTED_VALUE17580 17581
+#define BSLS_MACROINCREMENTED_VALUE17581 17582
+#define BSLS_MACROINCREMENTED_VALUE17582 17583
+#define BSLS_MACROINCREMENTED_VALUE17583 17584
+#define BSLS_MACROINCREMENTED_VALUE17584 17585
+#define BSLS_MACROINCREMENTED_VALUE17585 17586
+#define BSLS_MACROINCREMENTED_VALUE17586 17587
+#define BSLS_MACROINCREMENTED_VALUE17587 17588
+#define BSLS_MACROINCREMENTED_VALUE17588 17589
+#define BSLS_MACROINCREMENTED_VALUE17589 17590
+#define BSLS_MACROINCREMENTED_VALUE17590 17591
+#define BSLS_MACROINCREMENTED_VALUE17591 17592
+#define BSLS_MACROINCREMENTED_VALUE17592 17593
+#define BSLS_MACROINCREMENTED_VALUE17593 17594
+#define BSLS_MACROINCREMENTED_VALUE17594 17595
+#define BSLS_MACROINCREMENTED_VALUE17595 17596
+#define BSLS_MACROINCREMENTED_VALUE17596 17597
+#define BSLS_MACROINCREMENTED_VALUE17597 17598
+#define BSLS_MACROINCREMENTED_VALUE17598 17599
+#define BSLS_MACROINCREMENTED_VALUE17599 17600
+#define BSLS_MACROINCREMENTED_VALUE17600 17601
+#define BSLS_MACROINCREMENTED_VALUE17601 17602
+#define BSLS_MACROINCREMENTED_VALUE17602 17603
+#define BSLS_MACROINCREMENTED_VALUE17603 17604
+#define BSLS_MACROINCREMENTED_VALUE17604 17605
+#define BSLS_MACROINCREMENTED_VALUE17605 17606
+#define BSLS_MACROINCREMENTED_VALUE17606 17607
+#define BSLS_MACROINCREMENTED_VALUE17607 17608
+#define BSLS_MACROINCREMENTED_VALUE17608 17609
+#define BSLS_MACROINCREMENTED_VALUE17609 17610
+#define BSLS_MACROINCREMENTED_VALUE17610 17611
+#define BSLS_MACROINCREMENTED_VALUE17611 17612
+#define BSLS_MACROINCREMENTED_VALUE17612 17613
+#define BSLS_MACROINCREMENTED_VALUE17613 17614
+#define BSLS_MACROINCREMENTED_VALUE17614 17615
+#define BSLS_MACROINCREMENTED_VALUE17615 17616
+#define BSLS_MACROINCREMENTED_VALUE17616 17617
+#define BSLS_MACROINCREMENTED_VALUE17617 17618
+#define BSLS_MACROINCREMENTED_VALUE17618 17619
+#define BSLS_MACROINCREMENTED_VALUE17619 17620
+#define BSLS_MACROINCREMENTED_VALUE17620 17621
+#define BSLS_MACROINCREMENTED_VALUE17621 17622
+#define BSLS_MACROINCREMENTED_VALUE17622 17623
+#define BSLS_MACROINCREMENTED_VALUE17623 17624
+#define BSLS_MACROINCREMENTED_VALUE17624 17625
+#define BSLS_MACROINCREMENTED_VALUE17625 17626
+#define BSLS_MACROINCREMENTED_VALUE17626 17627
+#define BSLS_MACROINCREMENTED_VALUE17627 17628
+#define BSLS_MACROINCREMENTED_VALUE17628 17629
+#define BSLS_MACROINCREMENTED_VALUE17629 17630
+#define BSLS_MACROINCREMENTED_VALUE17630 17631
+#define BSLS_MACROINCREMENTED_VALUE17631 17632
+#define BSLS_MACROINCREMENTED_VALUE17632 17633
+#define BSLS_MACROINCREMENTED_VALUE17633 17634
+#define BSLS_MACROINCREMENTED_VALUE17634 17635
+#define BSLS_MACROINCREMENTED_VALUE17635 17636
+#define BSLS_MACROINCREMENTED_VALUE17636 17637
+#define BSLS_MACROINCREMENTED_VALUE17637 17638
+#define BSLS_MACROINCREMENTED_VALUE17638 17639
+#define BSLS_MACROINCREMENTED_VALUE17639 17640
+#define BSLS_MACROINCREMENTED_VALUE17640 17641
+#define BSLS_MACROINCREMENTED_VALUE17641 17642
+#define BSLS_MACROINCREMENTED_VALUE17642 17643
+#define BSLS_MACROINCREMENTED_VALUE17643 17644
+#define BSLS_MACROINCREMENTED_VALUE17644 17645
+#define BSLS_MACROINCREMENTED_VALUE17645 17646
+#define BSLS_MACROINCREMENTED_VALUE17646 17647
+#define BSLS_MACROINCREMENTED_VALUE17647 17648
+#define BSLS_MACROINCREMENTED_VALUE17648 17649
+#define BSLS_MACROINCREMENTED_VALUE17649 17650
+#define BSLS_MACROINCREMENTED_VALUE17650 17651
+#define BSLS_MACROINCREMENTED_VALUE17651 17652
+#define BSLS_MACROINCREMENTED_VALUE17652 17653
+#define BSLS_MACROINCREMENTED_VALUE17653 17654
+#define BSLS_MACROINCREMENTED_VALUE17654 17655
+#define BSLS_MACROINCREMENTED_VALUE17655 17656
+#define BSLS_MACROINCREMENTED_VALUE17656 17657
+#define BSLS_MACROINCREMENTED_VALUE17657 17658
+#define BSLS_MACROINCREMENTED_VALUE17658 17659
+#define BSLS_MACROINCREMENTED_VALUE17659 17660
+#define BSLS_MACROINCREMENTED_VALUE17660 17661
+#define BSLS_MACROINCREMENTED_VALUE17661 17662
+#define BSLS_MACROINCREMENTED_VALUE17662 17663
+#define BSLS_MACROINCREMENTED_VALUE17663 17664
+#define BSLS_MACROINCREMENTED_VALUE17664 17665
+#define BSLS_MACROINCREMENTED_VALUE17665 17666
+#define BSLS_MACROINCREMENTED_VALUE17666 17667
+#define BSLS_MACROINCREMENTED_VALUE17667 17668
+#define BSLS_MACROINCREMENTED_VALUE17668 17669
+#define BSLS_MACROINCREMENTED_VALUE17669 17670
+#define BSLS_MACROINCREMENTED_VALUE17670 17671
+#define BSLS_MACROINCREMENTED_VALUE17671 17672
+#define BSLS_MACROINCREMENTED_VALUE17672 17673
+#define BSLS_MACROINCREMENTED_VALUE17673 17674
+#define BSLS_MACROINCREMENTED_VALUE17674 17675
+#define BSLS_MACROINCREMENTED_VALUE17675 17676
+#define BSLS_MACROINCREMENTED_VALUE17676 17677
+#define BSLS_MACROINCREMENTED_VALUE17677 17678
+#define BSLS_MACROINCREMENTED_VALUE17678 17679
+#define BSLS_MACROINCREMENTED_VALUE17679 17680
+#define BSLS_MACROINCREMENTED_VALUE17680 17681
+#define BSLS_MACROINCREMENTED_VALUE17681 17682
+#define BSLS_MACROINCREMENTED_VALUE17682 17683
+#define BSLS_MACROINCREMENTED_VALUE17683 17684
+#define BSLS_MACROINCREMENTED_VALUE17684 17685
+#define BSLS_MACROINCREMENTED_VALUE17685 17686
+#define BSLS_MACROINCREMENTED_VALUE17686 17687
+#define BSLS_MACROINCREMENTED_VALUE17687 17688
+#define BSLS_MACROINCREMENTED_VALUE17688 17689
+#define BSLS_MACROINCREMENTED_VALUE17689 17690
+#define BSLS_MACROINCREMENTED_VALUE17690 17691
+#define BSLS_MACROINCREMENTED_VALUE17691 17692
+#define BSLS_MACROINCREMENTED_VALUE17692 17693
+#define BSLS_MACROINCREMENTED_VALUE17693 17694
+#define BSLS_MACROINCREMENTED_VALUE17694 17695
+#define BSLS_MACROINCREMENTED_VALUE17695 17696
+#define BSLS_MACROINCREMENTED_VALUE17696 17697
+#define BSLS_MACROINCREMENTED_VALUE17697 17698
+#define BSLS_MACROINCREMENTED_VALUE17698 17699
+#define BSLS_MACROINCREMENTED_VALUE17699 17700
+#define BSLS_MACROINCREMENTED_VALUE17700 17701
+#define BSLS_MACROINCREMENTED_VALUE17701 17702
+#define BSLS_MACROINCREMENTED_VALUE17702 17703
+#define BSLS_MACROINCREMENTED_VALUE17703 17704
+#define BSLS_MACROINCREMENTED_VALUE17704 17705
+#define BSLS_MACROINCREMENTED_VALUE17705 17706
+#define BSLS_MACROINCREMENTED_VALUE17706 17707
+#define BSLS_MACROINCREMENTED_VALUE17707 17708
+#define BSLS_MACROINCREMENTED_VALUE17708 17709
+#define BSLS_MACROINCREMENTED_VALUE17709 17710
+#define BSLS_MACROINCREMENTED_VALUE17710 17711
+#define BSLS_MACROINCREMENTED_VALUE17711 17712
+#define BSLS_MACROINCREMENTED_VALUE17712 17713
+#define BSLS_MACROINCREMENTED_VALUE17713 17714
+#define BSLS_MACROINCREMENTED_VALUE17714 17715
+#define BSLS_MACROINCREMENTED_VALUE17715 17716
+#define BSLS_MACROINCREMENTED_VALUE17716 17717
+#define BSLS_MACROINCREMENTED_VALUE17717 17718
+#define BSLS_MACROINCREMENTED_VALUE17718 17719
+#define BSLS_MACROINCREMENTED_VALUE17719 17720
+#define BSLS_MACROINCREMENTED_VALUE17720 17721
+#define BSLS_MACROINCREMENTED_VALUE17721 17722
+#define BSLS_MACROINCREMENTED_VALUE17722 17723
+#define BSLS_MACROINCREMENTED_VALUE17723 17724
+#define BSLS_MACROINCREMENTED_VALUE17724 17725
+#define BSLS_MACROINCREMENTED_VALUE17725 17726
+#define BSLS_MACROINCREMENTED_VALUE17726 17727
+#define BSLS_MACROINCREMENTED_VALUE17727 17728
+#define BSLS_MACROINCREMENTED_VALUE17728 17729
+#define BSLS_MACROINCREMENTED_VALUE17729 17730
+#define BSLS_MACROINCREMENTED_VALUE17730 17731
+#define BSLS_MACROINCREMENTED_VALUE17731 17732
+#define BSLS_MACROINCREMENTED_VALUE17732 17733
+#define BSLS_MACROINCREMENTED_VALUE17733 17734
+#define BSLS_MACROINCREMENTED_VALUE17734 17735
+#define BSLS_MACROINCREMENTED_VALUE17735 17736
+#define BSLS_MACROINCREMENTED_VALUE17736 17737
+#define BSLS_MACROINCREMENTED_VALUE17737 17738
+#define BSLS_MACROINCREMENTED_VALUE17738 17739
+#define BSLS_MACROINCREMENTED_VALUE17739 17740
+#define BSLS_MACROINCREMENTED_VALUE17740 17741
+#define BSLS_MACROINCREMENTED_VALUE17741 17742
+#define BSLS_MACROINCREMENTED_VALUE17742 17743
+#define BSLS_MACROINCREMENTED_VALUE17743 17744
+#define BSLS_MACROINCREMENTED_VALUE17744 17745
+#define BSLS_MACROINCREMENTED_VALUE17745 17746
+#define BSLS_MACROINCREMENTED_VALUE17746 17747
+#define BSLS_MACROINCREMENTED_VALUE17747 17748
+#define BSLS_MACROINCREMENTED_VALUE17748 17749
+#define BSLS_MACROINCREMENTED_VALUE17749 17750
+#define BSLS_MACROINCREMENTED_VALUE17750 17751
+#define BSLS_MACROINCREMENTED_VALUE17751 17752
+#define BSLS_MACROINCREMENTED_VALUE17752 17753
+#define BSLS_MACROINCREMENTED_VALUE17753 17754
+#define BSLS_MACROINCREMENTED_VALUE17754 17755
+#define BSLS_MACROINCREMENTED_VALUE17755 17756
+#define BSLS_MACROINCREMENTED_VALUE17756 17757
+#define BSLS_MACROINCREMENTED_VALUE17757 17758
+#define BSLS_MACROINCREMENTED_VALUE17758 17759
+#define BSLS_MACROINCREMENTED_VALUE17759 17760
+#define BSLS_MACROINCREMENTED_VALUE17760 17761
+#define BSLS_MACROINCREMENTED_VALUE17761 17762
+#define BSLS_MACROINCREMENTED_VALUE17762 17763
+#define BSLS_MACROINCREMENTED_VALUE17763 17764
+#define BSLS_MACROINCREMENTED_VALUE17764 17765
+#define BSLS_MACROINCREMENTED_VALUE17765 17766
+#define BSLS_MACROINCREMENTED_VALUE17766 17767
+#define BSLS_MACROINCREMENTED_VALUE17767 17768
+#define BSLS_MACROINCREMENTED_VALUE17768 17769
+#define BSLS_MACROINCREMENTED_VALUE17769 17770
+#define BSLS_MACROINCREMENTED_VALUE17770 17771
+#define BSLS_MACROINCREMENTED_VALUE17771 17772
+#define BSLS_MACROINCREMENTED_VALUE17772 17773
+#define BSLS_MACROINCREMENTED_VALUE17773 17774
+#define BSLS_MACROINCREMENTED_VALUE17774 17775
+#define BSLS_MACROINCREMENTED_VALUE17775 17776
+#define BSLS_MACROINCREMENTED_VALUE17776 17777
+#define BSLS_MACROINCREMENTED_VALUE17777 17778
+#define BSLS_MACROINCREMENTED_VALUE17778 17779
+#define BSLS_MACROINCREMENTED_VALUE17779 17780
+#define BSLS_MACROINCREMENTED_VALUE17780 17781
+#define BSLS_MACROINCREMENTED_VALUE17781 17782
+#define BSLS_MACROINCREMENTED_VALUE17782 17783
+#define BSLS_MACROINCREMENTED_VALUE17783 17784
+#define BSLS_MACROINCREMENTED_VALUE17784 17785
+#define BSLS_MACROINCREMENTED_VALUE17785 17786
+#define BSLS_MACROINCREMENTED_VALUE17786 17787
+#define BSLS_MACROINCREMENTED_VALUE17787 17788
+#define BSLS_MACROINCREMENTED_VALUE17788 17789
+#define BSLS_MACROINCREMENTED_VALUE17789 17790
+#define BSLS_MACROINCREMENTED_VALUE17790 17791
+#define BSLS_MACROINCREMENTED_VALUE17791 17792
+#define BSLS_MACROINCREMENTED_VALUE17792 17793
+#define BSLS_MACROINCREMENTED_VALUE17793 17794
+#define BSLS_MACROINCREMENTED_VALUE17794 17795
+#define BSLS_MACROINCREMENTED_VALUE17795 17796
+#define BSLS_MACROINCREMENTED_VALUE17796 17797
+#define BSLS_MACROINCREMENTED_VALUE17797 17798
+#define BSLS_MACROINCREMENTED_VALUE17798 17799
+#define BSLS_MACROINCREMENTED_VALUE17799 17800
+#define BSLS_MACROINCREMENTED_VALUE17800 17801
+#define BSLS_MACROINCREMENTED_VALUE17801 17802
+#define BSLS_MACROINCREMENTED_VALUE17802 17803
+#define BSLS_MACROINCREMENTED_VALUE17803 17804
+#define BSLS_MACROINCREMENTED_VALUE17804 17805
+#define BSLS_MACROINCREMENTED_VALUE17805 17806
+#define BSLS_MACROINCREMENTED_VALUE17806 17807
+#define BSLS_MACROINCREMENTED_VALUE17807 17808
+#define BSLS_MACROINCREMENTED_VALUE17808 17809
+#define BSLS_MACROINCREMENTED_VALUE17809 17810
+#define BSLS_MACROINCREMENTED_VALUE17810 17811
+#define BSLS_MACROINCREMENTED_VALUE17811 17812
+#define BSLS_MACROINCREMENTED_VALUE17812 17813
+#define BSLS_MACROINCREMENTED_VALUE17813 17814
+#define BSLS_MACROINCREMENTED_VALUE17814 17815
+#define BSLS_MACROINCREMENTED_VALUE17815 17816
+#define BSLS_MACROINCREMENTED_VALUE17816 17817
+#define BSLS_MACROINCREMENTED_VALUE17817 17818
+#define BSLS_MACROINCREMENTED_VALUE17818 17819
+#define BSLS_MACROINCREMENTED_VALUE17819 17820
+#define BSLS_MACROINCREMENTED_VALUE17820 17821
+#define BSLS_MACROINCREMENTED_VALUE17821 17822
+#define BSLS_MACROINCREMENTED_VALUE17822 17823
+#define BSLS_MACROINCREMENTED_VALUE17823 17824
+#define BSLS_MACROINCREMENTED_VALUE17824 17825
+#define BSLS_MACROINCREMENTED_VALUE17825 17826
+#define BSLS_MACROINCREMENTED_VALUE17826 17827
+#define BSLS_MACROINCREMENTED_VALUE17827 17828
+#define BSLS_MACROINCREMENTED_VALUE17828 17829
+#define BSLS_MACROINCREMENTED_VALUE17829 17830
+#define BSLS_MACROINCREMENTED_VALUE17830 17831
+#define BSLS_MACROINCREMENTED_VALUE17831 17832
+#define BSLS_MACROINCREMENTED_VALUE17832 17833
+#define BSLS_MACROINCREMENTED_VALUE17833 17834
+#define BSLS_MACROINCREMENTED_VALUE17834 17835
+#define BSLS_MACROINCREMENTED_VALUE17835 17836
+#define BSLS_MACROINCREMENTED_VALUE17836 17837
+#define BSLS_MACROINCREMENTED_VALUE17837 17838
+#define BSLS_MACROINCREMENTED_VALUE17838 17839
+#define BSLS_MACROINCREMENTED_VALUE17839 17840
+#define BSLS_MACROINCREMENTED_VALUE17840 17841
+#define BSLS_MACROINCREMENTED_VALUE17841 17842
+#define BSLS_MACROINCREMENTED_VALUE17842 17843
+#define BSLS_MACROINCREMENTED_VALUE17843 17844
+#define BSLS_MACROINCREMENTED_VALUE17844 17845
+#define BSLS_MACROINCREMENTED_VALUE17845 17846
+#define BSLS_MACROINCREMENTED_VALUE17846 17847
+#define BSLS_MACROINCREMENTED_VALUE17847 17848
+#define BSLS_MACROINCREMENTED_VALUE17848 17849
+#define BSLS_MACROINCREMENTED_VALUE17849 17850
+#define BSLS_MACROINCREMENTED_VALUE17850 17851
+#define BSLS_MACROINCREMENTED_VALUE17851 17852
+#define BSLS_MACROINCREMENTED_VALUE17852 17853
+#define BSLS_MACROINCREMENTED_VALUE17853 17854
+#define BSLS_MACROINCREMENTED_VALUE17854 17855
+#define BSLS_MACROINCREMENTED_VALUE17855 17856
+#define BSLS_MACROINCREMENTED_VALUE17856 17857
+#define BSLS_MACROINCREMENTED_VALUE17857 17858
+#define BSLS_MACROINCREMENTED_VALUE17858 17859
+#define BSLS_MACROINCREMENTED_VALUE17859 17860
+#define BSLS_MACROINCREMENTED_VALUE17860 17861
+#define BSLS_MACROINCREMENTED_VALUE17861 17862
+#define BSLS_MACROINCREMENTED_VALUE17862 17863
+#define BSLS_MACROINCREMENTED_VALUE17863 17864
+#define BSLS_MACROINCREMENTED_VALUE17864 17865
+#define BSLS_MACROINCREMENTED_VALUE17865 17866
+#define BSLS_MACROINCREMENTED_VALUE17866 17867
+#define BSLS_MACROINCREMENTED_VALUE17867 17868
+#define BSLS_MACROINCREMENTED_VALUE17868 17869
+#define BSLS_MACROINCREMENTED_VALUE17869 17870
+#define BSLS_MACROINCREMENTED_VALUE17870 17871
+#define BSLS_MACROINCREMENTED_VALUE17871 17872
+#define BSLS_MACROINCREMENTED_VALUE17872 17873
+#define BSLS_MACROINCREMENTED_VALUE17873 17874
+#define BSLS_MACROINCREMENTED_VALUE17874 17875
+#define BSLS_MACROINCREMENTED_VALUE17875 17876
+#define BSLS_MACROINCREMENTED_VALUE17876 17877
+#define BSLS_MACROINCREMENTED_VALUE17877 17878
+#define BSLS_MACROINCREMENTED_VALUE17878 17879
+#define BSLS_MACROINCREMENTED_VALUE17879 17880
+#define BSLS_MACROINCREMENTED_VALUE17880 17881
+#define BSLS_MACROINCREMENTED_VALUE17881 17882
+#define BSLS_MACROINCREMENTED_VALUE17882 17883
+#define BSLS_MACROINCREMENTED_VALUE17883 17884
+#define BSLS_MACROINCREMENTED_VALUE17884 17885
+#define BSLS_MACROINCREMENTED_VALUE17885 17886
+#define BSLS_MACROINCREMENTED_VALUE17886 17887
+#define BSLS_MACROINCREMENTED_VALUE17887 17888
+#define BSLS_MACROINCREMENTED_VALUE17888 17889
+#define BSLS_MACROINCREMENTED_VALUE17889 17890
+#define BSLS_MACROINCREMENTED_VALUE17890 17891
+#define BSLS_MACROINCREMENTED_VALUE17891 17892
+#define BSLS_MACROINCREMENTED_VALUE17892 17893
+#define BSLS_MACROINCREMENTED_VALUE17893 17894
+#define BSLS_MACROINCREMENTED_VALUE17894 17895
+#define BSLS_MACROINCREMENTED_VALUE17895 17896
+#define BSLS_MACROINCREMENTED_VALUE17896 17897
+#define BSLS_MACROINCREMENTED_VALUE17897 17898
+#define BSLS_MACROINCREMENTED_VALUE17898 17899
+#define BSLS_MACROINCREMENTED_VALUE17899 17900
+#define BSLS_MACROINCREMENTED_VALUE17900 17901
+#define BSLS_MACROINCREMENTED_VALUE17901 17902
+#define BSLS_MACROINCREMENTED_VALUE17902 17903
+#define BSLS_MACROINCREMENTED_VALUE17903 17904
+#define BSLS_MACROINCREMENTED_VALUE17904 17905
+#define BSLS_MACROINCREMENTED_VALUE17905 17906
+#define BSLS_MACROINCREMENTED_VALUE17906 17907
+#define BSLS_MACROINCREMENTED_VALUE17907 17908
+#define BSLS_MACROINCREMENTED_VALUE17908 17909
+#define BSLS_MACROINCREMENTED_VALUE17909 17910
+#define BSLS_MACROINCREMENTED_VALUE17910 17911
+#define BSLS_MACROINCREMENTED_VALUE17911 17912
+#define BSLS_MACROINCREMENTED_VALUE17912 17913
+#define BSLS_MACROINCREMENTED_VALUE17913 17914
+#define BSLS_MACROINCREMENTED_VALUE17914 17915
+#define BSLS_MACROINCREMENTED_VALUE17915 17916
+#define BSLS_MACROINCREMENTED_VALUE17916 17917
+#define BSLS_MACROINCREMENTED_VALUE17917 17918
+#define BSLS_MACROINCREMENTED_VALUE17918 17919
+#define BSLS_MACROINCREMENTED_VALUE17919 17920
+#define BSLS_MACROINCREMENTED_VALUE17920 17921
+#define BSLS_MACROINCREMENTED_VALUE17921 17922
+#define BSLS_MACROINCREMENTED_VALUE17922 17923
+#define BSLS_MACROINCREMENTED_VALUE17923 17924
+#define BSLS_MACROINCREMENTED_VALUE17924 17925
+#define BSLS_MACROINCREMENTED_VALUE17925 17926
+#define BSLS_MACROINCREMENTED_VALUE17926 17927
+#define BSLS_MACROINCREMENTED_VALUE17927 17928
+#define BSLS_MACROINCREMENTED_VALUE17928 17929
+#define BSLS_MACROINCREMENTED_VALUE17929 17930
+#define BSLS_MACROINCREMENTED_VALUE17930 17931
+#define BSLS_MACROINCREMENTED_VALUE17931 17932
+#define BSLS_MACROINCREMENTED_VALUE17932 17933
+#define BSLS_MACROINCREMENTED_VALUE17933 17934
+#define BSLS_MACROINCREMENTED_VALUE17934 17935
+#define BSLS_MACROINCREMENTED_VALUE17935 17936
+#define BSLS_MACROINCREMENTED_VALUE17936 17937
+#define BSLS_MACROINCREMENTED_VALUE17937 17938
+#define BSLS_MACROINCREMENTED_VALUE17938 17939
+#define BSLS_MACROINCREMENTED_VALUE17939 17940
+#define BSLS_MACROINCREMENTED_VALUE17940 17941
+#define BSLS_MACROINCREMENTED_VALUE17941 17942
+#define BSLS_MACROINCREMENTED_VALUE17942 17943
+#define BSLS_MACROINCREMENTED_VALUE17943 17944
+#define BSLS_MACROINCREMENTED_VALUE17944 17945
+#define BSLS_MACROINCREMENTED_VALUE17945 17946
+#define BSLS_MACROINCREMENTED_VALUE17946 17947
+#define BSLS_MACROINCREMENTED_VALUE17947 17948
+#define BSLS_MACROINCREMENTED_VALUE17948 17949
+#define BSLS_MACROINCREMENTED_VALUE17949 17950
+#define BSLS_MACROINCREMENTED_VALUE17950 17951
+#define BSLS_MACROINCREMENTED_VALUE17951 17952
+#define BSLS_MACROINCREMENTED_VALUE17952 17953
+#define BSLS_MACROINCREMENTED_VALUE17953 17954
+#define BSLS_MACROINCREMENTED_VALUE17954 17955
+#define BSLS_MACROINCREMENTED_VALUE17955 17956
+#define BSLS_MACROINCREMENTED_VALUE17956 17957
+#define BSLS_MACROINCREMENTED_VALUE17957 17958
+#define BSLS_MACROINCREMENTED_VALUE17958 17959
+#define BSLS_MACROINCREMENTED_VALUE17959 17960
+#define BSLS_MACROINCREMENTED_VALUE17960 17961
+#define BSLS_MACROINCREMENTED_VALUE17961 17962
+#define BSLS_MACROINCREMENTED_VALUE17962 17963
+#define BSLS_MACROINCREMENTED_VALUE17963 17964
+#define BSLS_MACROINCREMENTED_VALUE17964 17965
+#define BSLS_MACROINCREMENTED_VALUE17965 17966
+#define BSLS_MACROINCREMENTED_VALUE17966 17967
+#define BSLS_MACROINCREMENTED_VALUE17967 17968
+#define BSLS_MACROINCREMENTED_VALUE17968 17969
+#define BSLS_MACROINCREMENTED_VALUE17969 17970
+#define BSLS_MACROINCREMENTED_VALUE17970 17971
+#define BSLS_MACROINCREMENTED_VALUE17971 17972
+#define BSLS_MACROINCREMENTED_VALUE17972 17973
+#define BSLS_MACROINCREMENTED_VALUE17973 17974
+#define BSLS_MACROINCREMENTED_VALUE17974 17975
+#define BSLS_MACROINCREMENTED_VALUE17975 17976
+#define BSLS_MACROINCREMENTED_VALUE17976 17977
+#define BSLS_MACROINCREMENTED_VALUE17977 17978
+#define BSLS_MACROINCREMENTED_VALUE17978 17979
+#define BSLS_MACROINCREMENTED_VALUE17979 17980
+#define BSLS_MACROINCREMENTED_VALUE17980 17981
+#define BSLS_MACROINCREMENTED_VALUE17981 17982
+#define BSLS_MACROINCREMENTED_VALUE17982 17983
+#define BSLS_MACROINCREMENTED_VALUE17983 17984
+#define BSLS_MACROINCREMENTED_VALUE17984 17985
+#define BSLS_MACROINCREMENTED_VALUE17985 17986
+#define BSLS_MACROINCREMENTED_VALUE17986 17987
+#define BSLS_MACROINCREMENTED_VALUE17987 17988
+#define BSLS_MACROINCREMENTED_VALUE17988 17989
+#define BSLS_MACROINCREMENTED_VALUE17989 17990
+#define BSLS_MACROINCREMENTED_VALUE17990 17991
+#define BSLS_MACROINCREMENTED_VALUE17991 17992
+#define BSLS_MACROINCREMENTED_VALUE17992 17993
+#define BSLS_MACROINCREMENTED_VALUE17993 17994
+#define BSLS_MACROINCREMENTED_VALUE17994 17995
+#define BSLS_MACROINCREMENTED_VALUE17995 17996
+#define BSLS_MACROINCREMENTED_VALUE17996 17997
+#define BSLS_MACROINCREMENTED_VALUE17997 17998
+#define BSLS_MACROINCREMENTED_VALUE17998 17999
+#define BSLS_MACROINCREMENTED_VALUE17999 18000
+#define BSLS_MACROINCREMENTED_VALUE18000 18001
+#define BSLS_MACROINCREMENTED_VALUE18001 18002
+#define BSLS_MACROINCREMENTED_VALUE18002 18003
+#define BSLS_MACROINCREMENTED_VALUE18003 18004
+#define BSLS_MACROINCREMENTED_VALUE18004 18005
+#define BSLS_MACROINCREMENTED_VALUE18005 18006
+#define BSLS_MACROINCREMENTED_VALUE18006 18007
+#define BSLS_MACROINCREMENTED_VALUE18007 18008
+#define BSLS_MACROINCREMENTED_VALUE18008 18009
+#define BSLS_MACROINCREMENTED_VALUE18009 18010
+#define BSLS_MACROINCREMENTED_VALUE18010 18011
+#define BSLS_MACROINCREMENTED_VALUE18011 18012
+#define BSLS_MACROINCREMENTED_VALUE18012 18013
+#define BSLS_MACROINCREMENTED_VALUE18013 18014
+#define BSLS_MACROINCREMENTED_VALUE18014 18015
+#define BSLS_MACROINCREMENTED_VALUE18015 18016
+#define BSLS_MACROINCREMENTED_VALUE18016 18017
+#define BSLS_MACROINCREMENTED_VALUE18017 18018
+#define BSLS_MACROINCREMENTED_VALUE18018 18019
+#define BSLS_MACROINCREMENTED_VALUE18019 18020
+#define BSLS_MACROINCREMENTED_VALUE18020 18021
+#define BSLS_MACROINCREMENTED_VALUE18021 18022
+#define BSLS_MACROINCREMENTED_VALUE18022 18023
+#define BSLS_MACROINCREMENTED_VALUE18023 18024
+#define BSLS_MACROINCREMENTED_VALUE18024 18025
+#define BSLS_MACROINCREMENTED_VALUE18025 18026
+#define BSLS_MACROINCREMENTED_VALUE18026 18027
+#define BSLS_MACROINCREMENTED_VALUE18027 18028
+#define BSLS_MACROINCREMENTED_VALUE18028 18029
+#define BSLS_MACROINCREMENTED_VALUE18029 18030
+#define BSLS_MACROINCREMENTED_VALUE18030 18031
+#define BSLS_MACROINCREMENTED_VALUE18031 18032
+#define BSLS_MACROINCREMENTED_VALUE18032 18033
+#define BSLS_MACROINCREMENTED_VALUE18033 18034
+#define BSLS_MACROINCREMENTED_VALUE18034 18035
+#define BSLS_MACROINCREMENTED_VALUE18035 18036
+#define BSLS_MACROINCREMENTED_VALUE18036 18037
+#define BSLS_MACROINCREMENTED_VALUE18037 18038
+#define BSLS_MACROINCREMENTED_VALUE18038 18039
+#define BSLS_MACROINCREMENTED_VALUE18039 18040
+#define BSLS_MACROINCREMENTED_VALUE18040 18041
+#define BSLS_MACROINCREMENTED_VALUE18041 18042
+#define BSLS_MACROINCREMENTED_VALUE18042 18043
+#define BSLS_MACROINCREMENTED_VALUE18043 18044
+#define BSLS_MACROINCREMENTED_VALUE18044 18045
+#define BSLS_MACROINCREMENTED_VALUE18045 18046
+#define BSLS_MACROINCREMENTED_VALUE18046 18047
+#define BSLS_MACROINCREMENTED_VALUE18047 18048
+#define BSLS_MACROINCREMENTED_VALUE18048 18049
+#define BSLS_MACROINCREMENTED_VALUE18049 18050
+#define BSLS_MACROINCREMENTED_VALUE18050 18051
+#define BSLS_MACROINCREMENTED_VALUE18051 18052
+#define BSLS_MACROINCREMENTED_VALUE18052 18053
+#define BSLS_MACROINCREMENTED_VALUE18053 18054
+#define BSLS_MACROINCREMENTED_VALUE18054 18055
+#define BSLS_MACROINCREMENTED_VALUE18055 18056
+#define BSLS_MACROINCREMENTED_VALUE18056 18057
+#define BSLS_MACROINCREMENTED_VALUE18057 18058
+#define BSLS_MACROINCREMENTED_VALUE18058 18059
+#define BSLS_MACROINCREMENTED_VALUE18059 18060
+#define BSLS_MACROINCREMENTED_VALUE18060 18061
+#define BSLS_MACROINCREMENTED_VALUE18061 18062
+#define BSLS_MACROINCREMENTED_VALUE18062 18063
+#define BSLS_MACROINCREMENTED_VALUE18063 18064
+#define BSLS_MACROINCREMENTED_VALUE18064 18065
+#define BSLS_MACROINCREMENTED_VALUE18065 18066
+#define BSLS_MACROINCREMENTED_VALUE18066 18067
+#define BSLS_MACROINCREMENTED_VALUE18067 18068
+#define BSLS_MACROINCREMENTED_VALUE18068 18069
+#define BSLS_MACROINCREMENTED_VALUE18069 18070
+#define BSLS_MACROINCREMENTED_VALUE18070 18071
+#define BSLS_MACROINCREMENTED_VALUE18071 18072
+#define BSLS_MACROINCREMENTED_VALUE18072 18073
+#define BSLS_MACROINCREMENTED_VALUE18073 18074
+#define BSLS_MACROINCREMENTED_VALUE18074 18075
+#define BSLS_MACROINCREMENTED_VALUE18075 18076
+#define BSLS_MACROINCREMENTED_VALUE18076 18077
+#define BSLS_MACROINCREMENTED_VALUE18077 18078
+#define BSLS_MACROINCREMENTED_VALUE18078 18079
+#define BSLS_MACROINCREMENTED_VALUE18079 18080
+#define BSLS_MACROINCREMENTED_VALUE18080 18081
+#define BSLS_MACROINCREMENTED_VALUE18081 18082
+#define BSLS_MACROINCREMENTED_VALUE18082 18083
+#define BSLS_MACROINCREMENTED_VALUE18083 18084
+#define BSLS_MACROINCREMENTED_VALUE18084 18085
+#define BSLS_MACROINCREMENTED_VALUE18085 18086
+#define BSLS_MACROINCREMENTED_VALUE18086 18087
+#define BSLS_MACROINCREMENTED_VALUE18087 18088
+#define BSLS_MACROINCREMENTED_VALUE18088 18089
+#define BSLS_MACROINCREMENTED_VALUE18089 18090
+#define BSLS_MACROINCREMENTED_VALUE18090 18091
+#define BSLS_MACROINCREMENTED_VALUE18091 18092
+#define BSLS_MACROINCREMENTED_VALUE18092 18093
+#define BSLS_MACROINCREMENTED_VALUE18093 18094
+#define BSLS_MACROINCREMENTED_VALUE18094 18095
+#define BSLS_MACROINCREMENTED_VALUE18095 18096
+#define BSLS_MACROINCREMENTED_VALUE18096 18097
+#define BSLS_MACROINCREMENTED_VALUE18097 18098
+#define BSLS_MACROINCREMENTED_VALUE18098 18099
+#define BSLS_MACROINCREMENTED_VALUE18099 18100
+#define BSLS_MACROINCREMENTED_VALUE18100 18101
+#define BSLS_MACROINCREMENTED_VALUE18101 18102
+#define BSLS_MACROINCREMENTED_VALUE18102 18103
+#define BSLS_MACROINCREMENTED_VALUE18103 18104
+#define BSLS_MACROINCREMENTED_VALUE18104 18105
+#define BSLS_MACROINCREMENTED_VALUE18105 18106
+#define BSLS_MACROINCREMENTED_VALUE18106 18107
+#define BSLS_MACROINCREMENTED_VALUE18107 18108
+#define BSLS_MACROINCREMENTED_VALUE18108 18109
+#define BSLS_MACROINCREMENTED_VALUE18109 18110
+#define BSLS_MACROINCREMENTED_VALUE18110 18111
+#define BSLS_MACROINCREMENTED_VALUE18111 18112
+#define BSLS_MACROINCREMENTED_VALUE18112 18113
+#define BSLS_MACROINCREMENTED_VALUE18113 18114
+#define BSLS_MACROINCREMENTED_VALUE18114 18115
+#define BSLS_MACROINCREMENTED_VALUE18115 18116
+#define BSLS_MACROINCREMENTED_VALUE18116 18117
+#define BSLS_MACROINCREMENTED_VALUE18117 18118
+#define BSLS_MACROINCREMENTED_VALUE18118 18119
+#define BSLS_MACROINCREMENTED_VALUE18119 18120
+#define BSLS_MACROINCREMENTED_VALUE18120 18121
+#define BSLS_MACROINCREMENTED_VALUE18121 18122
+#define BSLS_MACROINCREMENTED_VALUE18122 18123
+#define BSLS_MACROINCREMENTED_VALUE18123 18124
+#define BSLS_MACROINCREMENTED_VALUE18124 18125
+#define BSLS_MACROINCREMENTED_VALUE18125 18126
+#define BSLS_MACROINCREMENTED_VALUE18126 18127
+#define BSLS_MACROINCREMENTED_VALUE18127 18128
+#define BSLS_MACROINCREMENTED_VALUE18128 18129
+#define BSLS_MACROINCREMENTED_VALUE18129 18130
+#define BSLS_MACROINCREMENTED_VALUE18130 18131
+#define BSLS_MACROINCREMENTED_VALUE18131 18132
+#define BSLS_MACROINCREMENTED_VALUE18132 18133
+#define BSLS_MACROINCREMENTED_VALUE18133 18134
+#define BSLS_MACROINCREMENTED_VALUE18134 18135
+#define BSLS_MACROINCREMENTED_VALUE18135 18136
+#define BSLS_MACROINCREMENTED_VALUE18136 18137
+#define BSLS_MACROINCREMENTED_VALUE18137 18138
+#define BSLS_MACROINCREMENTED_VALUE18138 18139
+#define BSLS_MACROINCREMENTED_VALUE18139 18140
+#define BSLS_MACROINCREMENTED_VALUE18140 18141
+#define BSLS_MACROINCREMENTED_VALUE18141 18142
+#define BSLS_MACROINCREMENTED_VALUE18142 18143
+#define BSLS_MACROINCREMENTED_VALUE18143 18144
+#define BSLS_MACROINCREMENTED_VALUE18144 18145
+#define BSLS_MACROINCREMENTED_VALUE18145 18146
+#define BSLS_MACROINCREMENTED_VALUE18146 18147
+#define BSLS_MACROINCREMENTED_VALUE18147 18148
+#define BSLS_MACROINCREMENTED_VALUE18148 18149
+#define BSLS_MACROINCREMENTED_VALUE18149 18150
+#define BSLS_MACROINCREMENTED_VALUE18150 18151
+#define BSLS_MACROINCREMENTED_VALUE18151 18152
+#define BSLS_MACROINCREMENTED_VALUE18152 18153
+#define BSLS_MACROINCREMENTED_VALUE18153 18154
+#define BSLS_MACROINCREMENTED_VALUE18154 18155
+#define BSLS_MACROINCREMENTED_VALUE18155 18156
+#define BSLS_MACROINCREMENTED_VALUE18156 18157
+#define BSLS_MACROINCREMENTED_VALUE18157 18158
+#define BSLS_MACROINCREMENTED_VALUE18158 18159
+#define BSLS_MACROINCREMENTED_VALUE18159 18160
+#define BSLS_MACROINCREMENTED_VALUE18160 18161
+#define BSLS_MACROINCREMENTED_VALUE18161 18162
+#define BSLS_MACROINCREMENTED_VALUE18162 18163
+#define BSLS_MACROINCREMENTED_VALUE18163 18164
+#define BSLS_MACROINCREMENTED_VALUE18164 18165
+#define BSLS_MACROINCREMENTED_VALUE18165 18166
+#define BSLS_MACROINCREMENTED_VALUE18166 18167
+#define BSLS_MACROINCREMENTED_VALUE18167 18168
+#define BSLS_MACROINCREMENTED_VALUE18168 18169
+#define BSLS_MACROINCREMENTED_VALUE18169 18170
+#define BSLS_MACROINCREMENTED_VALUE18170 18171
+#define BSLS_MACROINCREMENTED_VALUE18171 18172
+#define BSLS_MACROINCREMENTED_VALUE18172 18173
+#define BSLS_MACROINCREMENTED_VALUE18173 18174
+#define BSLS_MACROINCREMENTED_VALUE18174 18175
+#define BSLS_MACROINCREMENTED_VALUE18175 18176
+#define BSLS_MACROINCREMENTED_VALUE18176 18177
+#define BSLS_MACROINCREMENTED_VALUE18177 18178
+#define BSLS_MACROINCREMENTED_VALUE18178 18179
+#define BSLS_MACROINCREMENTED_VALUE18179 18180
+#define BSLS_MACROINCREMENTED_VALUE18180 18181
+#define BSLS_MACROINCREMENTED_VALUE18181 18182
+#define BSLS_MACROINCREMENTED_VALUE18182 18183
+#define BSLS_MACROINCREMENTED_VALUE18183 18184
+#define BSLS_MACROINCREMENTED_VALUE18184 18185
+#define BSLS_MACROINCREMENTED_VALUE18185 18186
+#define BSLS_MACROINCREMENTED_VALUE18186 18187
+#define BSLS_MACROINCREMENTED_VALUE18187 18188
+#define BSLS_MACROINCREMENTED_VALUE18188 18189
+#define BSLS_MACROINCREMENTED_VALUE18189 18190
+#define BSLS_MACROINCREMENTED_VALUE18190 18191
+#define BSLS_MACROINCREMENTED_VALUE18191 18192
+#define BSLS_MACROINCREMENTED_VALUE18192 18193
+#define BSLS_MACROINCREMENTED_VALUE18193 18194
+#define BSLS_MACROINCREMENTED_VALUE18194 18195
+#define BSLS_MACROINCREMENTED_VALUE18195 18196
+#define BSLS_MACROINCREMENTED_VALUE18196 18197
+#define BSLS_MACROINCREMENTED_VALUE18197 18198
+#define BSLS_MACROINCREMENTED_VALUE18198 18199
+#define BSLS_MACROINCREMENTED_VALUE18199 18200
+#define BSLS_MACROINCREMENTED_VALUE18200 18201
+#define BSLS_MACROINCREMENTED_VALUE18201 18202
+#define BSLS_MACROINCREMENTED_VALUE18202 18203
+#define BSLS_MACROINCREMENTED_VALUE18203 18204
+#define BSLS_MACROINCREMENTED_VALUE18204 18205
+#define BSLS_MACROINCREMENTED_VALUE18205 18206
+#define BSLS_MACROINCREMENTED_VALUE18206 18207
+#define BSLS_MACROINCREMENTED_VALUE18207 18208
+#define BSLS_MACROINCREMENTED_VALUE18208 18209
+#define BSLS_MACROINCREMENTED_VALUE18209 18210
+#define BSLS_MACROINCREMENTED_VALUE18210 18211
+#define BSLS_MACROINCREMENTED_VALUE18211 18212
+#define BSLS_MACROINCREMENTED_VALUE18212 18213
+#define BSLS_MACROINCREMENTED_VALUE18213 18214
+#define BSLS_MACROINCREMENTED_VALUE18214 18215
+#define BSLS_MACROINCREMENTED_VALUE18215 18216
+#define BSLS_MACROINCREMENTED_VALUE18216 18217
+#define BSLS_MACROINCREMENTED_VALUE18217 18218
+#define BSLS_MACROINCREMENTED_VALUE18218 18219
+#define BSLS_MACROINCREMENTED_VALUE18219 18220
+#define BSLS_MACROINCREMENTED_VALUE18220 18221
+#define BSLS_MACROINCREMENTED_VALUE18221 18222
+#define BSLS_MACROINCREMENTED_VALUE18222 18223
+#define BSLS_MACROINCREMENTED_VALUE18223 18224
+#define BSLS_MACROINCREMENTED_VALUE18224 18225
+#define BSLS_MACROINCREMENTED_VALUE18225 18226
+#define BSLS_MACROINCREMENTED_VALUE18226 18227
+#define BSLS_MACROINCREMENTED_VALUE18227 18228
+#define BSLS_MACROINCREMENTED_VALUE18228 18229
+#define BSLS_MACROINCREMENTED_VALUE18229 18230
+#define BSLS_MACROINCREMENTED_VALUE18230 18231
+#define BSLS_MACROINCREMENTED_VALUE18231 18232
+#define BSLS_MACROINCREMENTED_VALUE18232 18233
+#define BSLS_MACROINCREMENTED_VALUE18233 18234
+#define BSLS_MACROINCREMENTED_VALUE18234 18235
+#define BSLS_MACROINCREMENTED_VALUE18235 18236
+#define BSLS_MACROINCREMENTED_VALUE18236 18237
+#define BSLS_MACROINCREMENTED_VALUE18237 18238
+#define BSLS_MACROINCREMENTED_VALUE18238 18239
+#define BSLS_MACROINCREMENTED_VALUE18239 18240
+#define BSLS_MACROINCREMENTED_VALUE18240 18241
+#define BSLS_MACROINCREMENTED_VALUE18241 18242
+#define BSLS_MACROINCREMENTED_VALUE18242 18243
+#define BSLS_MACROINCREMENTED_VALUE18243 18244
+#define BSLS_MACROINCREMENTED_VALUE18244 18245
+#define BSLS_MACROINCREMENTED_VALUE18245 18246
+#define BSLS_MACROINCREMENTED_VALUE18246 18247
+#define BSLS_MACROINCREMENTED_VALUE18247 18248
+#define BSLS_MACROINCREMENTED_VALUE18248 18249
+#define BSLS_MACROINCREMENTED_VALUE18249 18250
+#define BSLS_MACROINCREMENTED_VALUE18250 18251
+#define BSLS_MACROINCREMENTED_VALUE18251 18252
+#define BSLS_MACROINCREMENTED_VALUE18252 18253
+#define BSLS_MACROINCREMENTED_VALUE18253 18254
+#define BSLS_MACROINCREMENTED_VALUE18254 18255
+#define BSLS_MACROINCREMENTED_VALUE18255 18256
+#define BSLS_MACROINCREMENTED_VALUE18256 18257
+#define BSLS_MACROINCREMENTED_VALUE18257 18258
+#define BSLS_MACROINCREMENTED_VALUE18258 18259
+#define BSLS_MACROINCREMENTED_VALUE18259 18260
+#define BSLS_MACROINCREMENTED_VALUE18260 18261
+#define BSLS_MACROINCREMENTED_VALUE18261 18262
+#define BSLS_MACROINCREMENTED_VALUE18262 18263
+#define BSLS_MACROINCREMENTED_VALUE18263 18264
+#define BSLS_MACROINCREMENTED_VALUE18264 18265
+#define BSLS_MACROINCREMENTED_VALUE18265 18266
+#define BSLS_MACROINCREMENTED_VALUE18266 18267
+#define BSLS_MACROINCREMENTED_VALUE18267 18268
+#define BSLS_MACROINCREMENTED_VALUE18268 18269
+#define BSLS_MACROINCREMENTED_VALUE18269 18270
+#define BSLS_MACROINCREMENTED_VALUE18270 18271
+#define BSLS_MACROINCREMENTED_VALUE18271 18272
+#define BSLS_MACROINCREMENTED_VALUE18272 18273
+#define BSLS_MACROINCREMENTED_VALUE18273 18274
+#define BSLS_MACROINCREMENTED_VALUE18274 18275
+#define BSLS_MACROINCREMENTED_VALUE18275 18276
+#define BSLS_MACROINCREMENTED_VALUE18276 18277
+#define BSLS_MACROINCREMENTED_VALUE18277 18278
+#define BSLS_MACROINCREMENTED_VALUE18278 18279
+#define BSLS_MACROINCREMENTED_VALUE18279 18280
+#define BSLS_MACROINCREMENTED_VALUE18280 18281
+#define BSLS_MACROINCREMENTED_VALUE18281 18282
+#define BSLS_MACROINCREMENTED_VALUE18282 18283
+#define BSLS_MACROINCREMENTED_VALUE18283 18284
+#define BSLS_MACROINCREMENTED_VALUE18284 18285
+#define BSLS_MACROINCREMENTED_VALUE18285 18286
+#define BSLS_MACROINCREMENTED_VALUE18286 18287
+#define BSLS_MACROINCREMENTED_VALUE18287 18288
+#define BSLS_MACROINCREMENTED_VALUE18288 18289
+#define BSLS_MACROINCREMENTED_VALUE18289 18290
+#define BSLS_MACROINCREMENTED_VALUE18290 18291
+#define BSLS_MACROINCREMENTED_VALUE18291 18292
+#define BSLS_MACROINCREMENTED_VALUE18292 18293
+#define BSLS_MACROINCREMENTED_VALUE18293 18294
+#define BSLS_MACROINCREMENTED_VALUE18294 18295
+#define BSLS_MACROINCREMENTED_VALUE18295 18296
+#define BSLS_MACROINCREMENTED_VALUE18296 18297
+#define BSLS_MACROINCREMENTED_VALUE18297 18298
+#define BSLS_MACROINCREMENTED_VALUE18298 18299
+#define BSLS_MACROINCREMENTED_VALUE18299 18300
+#define BSLS_MACROINCREMENTED_VALUE18300 18301
+#define BSLS_MACROINCREMENTED_VALUE18301 18302
+#define BSLS_MACROINCREMENTED_VALUE18302 18303
+#define BSLS_MACROINCREMENTED_VALUE18303 18304
+#define BSLS_MACROINCREMENTED_VALUE18304 18305
+#define BSLS_MACROINCREMENTED_VALUE18305 18306
+#define BSLS_MACROINCREMENTED_VALUE18306 18307
+#define BSLS_MACROINCREMENTED_VALUE18307 18308
+#define BSLS_MACROINCREMENTED_VALUE18308 18309
+#define BSLS_MACROINCREMENTED_VALUE18309 18310
+#define BSLS_MACROINCREMENTED_VALUE18310 18311
+#define BSLS_MACROINCREMENTED_VALUE18311 18312
+#define BSLS_MACROINCREMENTED_VALUE18312 18313
+#define BSLS_MACROINCREMENTED_VALUE18313 18314
+#define BSLS_MACROINCREMENTED_VALUE18314 18315
+#define BSLS_MACROINCREMENTED_VALUE18315 18316
+#define BSLS_MACROINCREMENTED_VALUE18316 18317
+#define BSLS_MACROINCREMENTED_VALUE18317 18318
+#define BSLS_MACROINCREMENTED_VALUE18318 18319
+#define BSLS_MACROINCREMENTED_VALUE18319 18320
+#define BSLS_MACROINCREMENTED_VALUE18320 18321
+#define BSLS_MACROINCREMENTED_VALUE18321 18322
+#define BSLS_MACROINCREMENTED_VALUE18322 18323
+#define BSLS_MACROINCREMENTED_VALUE18323 18324
+#define BSLS_MACROINCREMENTED_VALUE18324 18325
+#define BSLS_MACROINCREMENTED_VALUE18325 18326
+#define BSLS_MACROINCREMENTED_VALUE18326 18327
+#define BSLS_MACROINCREMENTED_VALUE18327 18328
+#define BSLS_MACROINCREMENTED_VALUE18328 18329
+#define BSLS_MACROINCREMENTED_VALUE18329 18330
+#define BSLS_MACROINCREMENTED_VALUE18330 18331
+#define BSLS_MACROINCREMENTED_VALUE18331 18332
+#define BSLS_MACROINCREMENTED_VALUE18332 18333
+#define BSLS_MACROINCREMENTED_VALUE18333 18334
+#define BSLS_MACROINCREMENTED_VALUE18334 18335
+#define BSLS_MACROINCREMENTED_VALUE18335 18336
+#define BSLS_MACROINCREMENTED_VALUE18336 18337
+#define BSLS_MACROINCREMENTED_VALUE18337 18338
+#define BSLS_MACROINCREMENTED_VALUE18338 18339
+#define BSLS_MACROINCREMENTED_VALUE18339 18340
+#define BSLS_MACROINCREMENTED_VALUE18340 18341
+#define BSLS_MACROINCREMENTED_VALUE18341 18342
+#define BSLS_MACROINCREMENTED_VALUE18342 18343
+#define BSLS_MACROINCREMENTED_VALUE18343 18344
+#define BSLS_MACROINCREMENTED_VALUE18344 18345
+#define BSLS_MACROINCREMENTED_VALUE18345 18346
+#define BSLS_MACROINCREMENTED_VALUE18346 18347
+#define BSLS_MACROINCREMENTED_VALUE18347 18348
+#define BSLS_MACROINCREMENTED_VALUE18348 18349
+#define BSLS_MACROINCREMENTED_VALUE18349 18350
+#define BSLS_MACROINCREMENTED_VALUE18350 18351
+#define BSLS_MACROINCREMENTED_VALUE18351 18352
+#define BSLS_MACROINCREMENTED_VALUE18352 18353
+#define BSLS_MACROINCREMENTED_VALUE18353 18354
+#define BSLS_MACROINCREMENTED_VALUE18354 18355
+#define BSLS_MACROINCREMENTED_VALUE18355 18356
+#define BSLS_MACROINCREMENTED_VALUE18356 18357
+#define BSLS_MACROINCREMENTED_VALUE18357 18358
+#define BSLS_MACROINCREMENTED_VALUE18358 18359
+#define BSLS_MACROINCREMENTED_VALUE18359 18360
+#define BSLS_MACROINCREMENTED_VALUE18360 18361
+#define BSLS_MACROINCREMENTED_VALUE18361 18362
+#define BSLS_MACROINCREMENTED_VALUE18362 18363
+#define BSLS_MACROINCREMENTED_VALUE18363 18364
+#define BSLS_MACROINCREMENTED_VALUE18364 18365
+#define BSLS_MACROINCREMENTED_VALUE18365 18366
+#define BSLS_MACROINCREMENTED_VALUE18366 18367
+#define BSLS_MACROINCREMENTED_VALUE18367 18368
+#define BSLS_MACROINCREMENTED_VALUE18368 18369
+#define BSLS_MACROINCREMENTED_VALUE18369 18370
+#define BSLS_MACROINCREMENTED_VALUE18370 18371
+#define BSLS_MACROINCREMENTED_VALUE18371 18372
+#define BSLS_MACROINCREMENTED_VALUE18372 18373
+#define BSLS_MACROINCREMENTED_VALUE18373 18374
+#define BSLS_MACROINCREMENTED_VALUE18374 18375
+#define BSLS_MACROINCREMENTED_VALUE18375 18376
+#define BSLS_MACROINCREMENTED_VALUE18376 18377
+#define BSLS_MACROINCREMENTED_VALUE18377 18378
+#define BSLS_MACROINCREMENTED_VALUE18378 18379
+#define BSLS_MACROINCREMENTED_VALUE18379 18380
+#define BSLS_MACROINCREMENTED_VALUE18380 18381
+#define BSLS_MACROINCREMENTED_VALUE18381 18382
+#define BSLS_MACROINCREMENTED_VALUE18382 18383
+#define BSLS_MACROINCREMENTED_VALUE18383 18384
+#define BSLS_MACROINCREMENTED_VALUE18384 18385
+#define BSLS_MACROINCREMENTED_VALUE18385 18386
+#define BSLS_MACROINCREMENTED_VALUE18386 18387
+#define BSLS_MACROINCREMENTED_VALUE18387 18388
+#define BSLS_MACROINCREMENTED_VALUE18388 18389
+#define BSLS_MACROINCREMENTED_VALUE18389 18390
+#define BSLS_MACROINCREMENTED_VALUE18390 18391
+#define BSLS_MACROINCREMENTED_VALUE18391 18392
+#define BSLS_MACROINCREMENTED_VALUE18392 18393
+#define BSLS_MACROINCREMENTED_VALUE18393 18394
+#define BSLS_MACROINCREMENTED_VALUE18394 18395
+#define BSLS_MACROINCREMENTED_VALUE18395 18396
+#define BSLS_MACROINCREMENTED_VALUE18396 18397
+#define BSLS_MACROINCREMENTED_VALUE18397 18398
+#define BSLS_MACROINCREMENTED_VALUE18398 18399
+#define BSLS_MACROINCREMENTED_VALUE18399 18400
+#define BSLS_MACROINCREMENTED_VALUE18400 18401
+#define BSLS_MACROINCREMENTED_VALUE18401 18402
+#define BSLS_MACROINCREMENTED_VALUE18402 18403
+#define BSLS_MACROINCREMENTED_VALUE18403 18404
+#define BSLS_MACROINCREMENTED_VALUE18404 18405
+#define BSLS_MACROINCREMENTED_VALUE18405 18406
+#define BSLS_MACROINCREMENTED_VALUE18406 18407
+#define BSLS_MACROINCREMENTED_VALUE18407 18408
+#define BSLS_MACROINCREMENTED_VALUE18408 18409
+#define BSLS_MACROINCREMENTED_VALUE18409 18410
+#define BSLS_MACROINCREMENTED_VALUE18410 18411
+#define BSLS_MACROINCREMENTED_VALUE18411 18412
+#define BSLS_MACROINCREMENTED_VALUE18412 18413
+#define BSLS_MACROINCREMENTED_VALUE18413 18414
+#define BSLS_MACROINCREMENTED_VALUE18414 18415
+#define BSLS_MACROINCREMENTED_VALUE18415 18416
+#define BSLS_MACROINCREMENTED_VALUE18416 18417
+#define BSLS_MACROINCREMENTED_VALUE18417 18418
+#define BSLS_MACROINCREMENTED_VALUE18418 18419
+#define BSLS_MACROINCREMENTED_VALUE18419 18420
+#define BSLS_MACROINCREMENTED_VALUE18420 18421
+#define BSLS_MACROINCREMENTED_VALUE18421 18422
+#define BSLS_MACROINCREMENTED_VALUE18422 18423
+#define BSLS_MACROINCREMENTED_VALUE18423 18424
+#define BSLS_MACROINCREMENTED_VALUE18424 18425
+#define BSLS_MACROINCREMENTED_VALUE18425 18426
+#define BSLS_MACROINCREMENTED_VALUE18426 18427
+#define BSLS_MACROINCREMENTED_VALUE18427 18428
+#define BSLS_MACROINCREMENTED_VALUE18428 18429
+#define BSLS_MACROINCREMENTED_VALUE18429 18430
+#define BSLS_MACROINCREMENTED_VALUE18430 18431
+#define BSLS_MACROINCREMENTED_VALUE18431 18432
+#define BSLS_MACROINCREMENTED_VALUE18432 18433
+#define BSLS_MACROINCREMENTED_VALUE18433 18434
+#define BSLS_MACROINCREMENTED_VALUE18434 18435
+#define BSLS_MACROINCREMENTED_VALUE18435 18436
+#define BSLS_MACROINCREMENTED_VALUE18436 18437
+#define BSLS_MACROINCREMENTED_VALUE18437 18438
+#define BSLS_MACROINCREMENTED_VALUE18438 18439
+#define BSLS_MACROINCREMENTED_VALUE18439 18440
+#define BSLS_MACROINCREMENTED_VALUE18440 18441
+#define BSLS_MACROINCREMENTED_VALUE18441 18442
+#define BSLS_MACROINCREMENTED_VALUE18442 18443
+#define BSLS_MACROINCREMENTED_VALUE18443 18444
+#define BSLS_MACROINCREMENTED_VALUE18444 18445
+#define BSLS_MACROINCREMENTED_VALUE18445 18446
+#define BSLS_MACROINCREMENTED_VALUE18446 18447
+#define BSLS_MACROINCREMENTED_VALUE18447 18448
+#define BSLS_MACROINCREMENTED_VALUE18448 18449
+#define BSLS_MACROINCREMENTED_VALUE18449 18450
+#define BSLS_MACROINCREMENTED_VALUE18450 18451
+#define BSLS_MACROINCREMENTED_VALUE18451 18452
+#define BSLS_MACROINCREMENTED_VALUE18452 18453
+#define BSLS_MACROINCREMENTED_VALUE18453 18454
+#define BSLS_MACROINCREMENTED_VALUE18454 18455
+#define BSLS_MACROINCREMENTED_VALUE18455 18456
+#define BSLS_MACROINCREMENTED_VALUE18456 18457
+#define BSLS_MACROINCREMENTED_VALUE18457 18458
+#define BSLS_MACROINCREMENTED_VALUE18458 18459
+#define BSLS_MACROINCREMENTED_VALUE18459 18460
+#define BSLS_MACROINCREMENTED_VALUE18460 18461
+#define BSLS_MACROINCREMENTED_VALUE18461 18462
+#define BSLS_MACROINCREMENTED_VALUE18462 18463
+#define BSLS_MACROINCREMENTED_VALUE18463 18464
+#define BSLS_MACROINCREMENTED_VALUE18464 18465
+#define BSLS_MACROINCREMENTED_VALUE18465 18466
+#define BSLS_MACROINCREMENTED_VALUE18466 18467
+#define BSLS_MACROINCREMENTED_VALUE18467 18468
+#define BSLS_MACROINCREMENTED_VALUE18468 18469
+#define BSLS_MACROINCREMENTED_VALUE18469 18470
+#define BSLS_MACROINCREMENTED_VALUE18470 18471
+#define BSLS_MACROINCREMENTED_VALUE18471 18472
+#define BSLS_MACROINCREMENTED_VALUE18472 18473
+#define BSLS_MACROINCREMENTED_VALUE18473 18474
+#define BSLS_MACROINCREMENTED_VALUE18474 18475
+#define BSLS_MACROINCREMENTED_VALUE18475 18476
+#define BSLS_MACROINCREMENTED_VALUE18476 18477
+#define BSLS_MACROINCREMENTED_VALUE18477 18478
+#define BSLS_MACROINCREMENTED_VALUE18478 18479
+#define BSLS_MACROINCREMENTED_VALUE18479 18480
+#define BSLS_MACROINCREMENTED_VALUE18480 18481
+#define BSLS_MACROINCREMENTED_VALUE18481 18482
+#define BSLS_MACROINCREMENTED_VALUE18482 18483
+#define BSLS_MACROINCREMENTED_VALUE18483 18484
+#define BSLS_MACROINCREMENTED_VALUE18484 18485
+#define BSLS_MACROINCREMENTED_VALUE18485 18486
+#define BSLS_MACROINCREMENTED_VALUE18486 18487
+#define BSLS_MACROINCREMENTED_VALUE18487 18488
+#define BSLS_MACROINCREMENTED_VALUE18488 18489
+#define BSLS_MACROINCREMENTED_VALUE18489 18490
+#define BSLS_MACROINCREMENTED_VALUE18490 18491
+#define BSLS_MACROINCREMENTED_VALUE18491 18492
+#define BSLS_MACROINCREMENTED_VALUE18492 18493
+#define BSLS_MACROINCREMENTED_VALUE18493 18494
+#define BSLS_MACROINCREMENTED_VALUE18494 18495
+#define BSLS_MACROINCREMENTED_VALUE18495 18496
+#define BSLS_MACROINCREMENTED_VALUE18496 18497
+#define BSLS_MACROINCREMENTED_VALUE18497 18498
+#define BSLS_MACROINCREMENTED_VALUE18498 18499
+#define BSLS_MACROINCREMENTED_VALUE18499 18500
+#define BSLS_MACROINCREMENTED_VALUE18500 18501
+#define BSLS_MACROINCREMENTED_VALUE18501 18502
+#define BSLS_MACROINCREMENTED_VALUE18502 18503
+#define BSLS_MACROINCREMENTED_VALUE18503 18504
+#define BSLS_MACROINCREMENTED_VALUE18504 18505
+#define BSLS_MACROINCREMENTED_VALUE18505 18506
+#define BSLS_MACROINCREMENTED_VALUE18506 18507
+#define BSLS_MACROINCREMENTED_VALUE18507 18508
+#define BSLS_MACROINCREMENTED_VALUE18508 18509
+#define BSLS_MACROINCREMENTED_VALUE18509 18510
+#define BSLS_MACROINCREMENTED_VALUE18510 18511
+#define BSLS_MACROINCREMENTED_VALUE18511 18512
+#define BSLS_MACROINCREMENTED_VALUE18512 18513
+#define BSLS_MACROINCREMENTED_VALUE18513 18514
+#define BSLS_MACROINCREMENTED_VALUE18514 18515
+#define BSLS_MACROINCREMENTED_VALUE18515 18516
+#define BSLS_MACROINCREMENTED_VALUE18516 18517
+#define BSLS_MACROINCREMENTED_VALUE18517 18518
+#define BSLS_MACROINCREMENTED_VALUE18518 18519
+#define BSLS_MACROINCREMENTED_VALUE18519 18520
+#define BSLS_MACROINCREMENTED_VALUE18520 18521
+#define BSLS_MACROINCREMENTED_VALUE18521 18522
+#define BSLS_MACROINCREMENTED_VALUE18522 18523
+#define BSLS_MACROINCREMENTED_VALUE18523 18524
+#define BSLS_MACROINCREMENTED_VALUE18524 18525
+#define BSLS_MACROINCREMENTED_VALUE18525 18526
+#define BSLS_MACROINCREMENTED_VALUE18526 18527
+#define BSLS_MACROINCREMENTED_VALUE18527 18528
+#define BSLS_MACROINCREMENTED_VALUE18528 18529
+#define BSLS_MACROINCREMENTED_VALUE18529 18530
+#define BSLS_MACROINCREMENTED_VALUE18530 18531
+#define BSLS_MACROINCREMENTED_VALUE18531 18532
+#define BSLS_MACROINCREMENTED_VALUE18532 18533
+#define BSLS_MACROINCREMENTED_VALUE18533 18534
+#define BSLS_MACROINCREMENTED_VALUE18534 18535
+#define BSLS_MACROINCREMENTED_VALUE18535 18536
+#define BSLS_MACROINCREMENTED_VALUE18536 18537
+#define BSLS_MACROINCREMENTED_VALUE18537 18538
+#define BSLS_MACROINCREMENTED_VALUE18538 18539
+#define BSLS_MACROINCREMENTED_VALUE18539 18540
+#define BSLS_MACROINCREMENTED_VALUE18540 18541
+#define BSLS_MACROINCREMENTED_VALUE18541 18542
+#define BSLS_MACROINCREMENTED_VALUE18542 18543
+#define BSLS_MACROINCREMENTED_VALUE18543 18544
+#define BSLS_MACROINCREMENTED_VALUE18544 18545
+#define BSLS_MACROINCREMENTED_VALUE18545 18546
+#define BSLS_MACROINCREMENTED_VALUE18546 18547
+#define BSLS_MACROINCREMENTED_VALUE18547 18548
+#define BSLS_MACROINCREMENTED_VALUE18548 18549
+#define BSLS_MACROINCREMENTED_VALUE18549 18550
+#define BSLS_MACROINCREMENTED_VALUE18550 18551
+#define BSLS_MACROINCREMENTED_VALUE18551 18552
+#define BSLS_MACROINCREMENTED_VALUE18552 18553
+#define BSLS_MACROINCREMENTED_VALUE18553 18554
+#define BSLS_MACROINCREMENTED_VALUE18554 18555
+#define BSLS_MACROINCREMENTED_VALUE18555 18556
+#define BSLS_MACROINCREMENTED_VALUE18556 18557
+#define BSLS_MACROINCREMENTED_VALUE18557 18558
+#define BSLS_MACROINCREMENTED_VALUE18558 18559
+#define BSLS_MACROINCREMENTED_VALUE18559 18560
+#define BSLS_MACROINCREMENTED_VALUE18560 18561
+#define BSLS_MACROINCREMENTED_VALUE18561 18562
+#define BSLS_MACROINCREMENTED_VALUE18562 18563
+#define BSLS_MACROINCREMENTED_VALUE18563 18564
+#define BSLS_MACROINCREMENTED_VALUE18564 18565
+#define BSLS_MACROINCREMENTED_VALUE18565 18566
+#define BSLS_MACROINCREMENTED_VALUE18566 18567
+#define BSLS_MACROINCREMENTED_VALUE18567 18568
+#define BSLS_MACROINCREMENTED_VALUE18568 18569
+#define BSLS_MACROINCREMENTED_VALUE18569 18570
+#define BSLS_MACROINCREMENTED_VALUE18570 18571
+#define BSLS_MACROINCREMENTED_VALUE18571 18572
+#define BSLS_MACROINCREMENTED_VALUE18572 18573
+#define BSLS_MACROINCREMENTED_VALUE18573 18574
+#define BSLS_MACROINCREMENTED_VALUE18574 18575
+#define BSLS_MACROINCREMENTED_VALUE18575 18576
+#define BSLS_MACROINCREMENTED_VALUE18576 18577
+#define BSLS_MACROINCREMENTED_VALUE18577 18578
+#define BSLS_MACROINCREMENTED_VALUE18578 18579
+#define BSLS_MACROINCREMENTED_VALUE18579 18580
+#define BSLS_MACROINCREMENTED_VALUE18580 18581
+#define BSLS_MACROINCREMENTED_VALUE18581 18582
+#define BSLS_MACROINCREMENTED_VALUE18582 18583
+#define BSLS_MACROINCREMENTED_VALUE18583 18584
+#define BSLS_MACROINCREMENTED_VALUE18584 18585
+#define BSLS_MACROINCREMENTED_VALUE18585 18586
+#define BSLS_MACROINCREMENTED_VALUE18586 18587
+#define BSLS_MACROINCREMENTED_VALUE18587 18588
+#define BSLS_MACROINCREMENTED_VALUE18588 18589
+#define BSLS_MACROINCREMENTED_VALUE18589 18590
+#define BSLS_MACROINCREMENTED_VALUE18590 18591
+#define BSLS_MACROINCREMENTED_VALUE18591 18592
+#define BSLS_MACROINCREMENTED_VALUE18592 18593
+#define BSLS_MACROINCREMENTED_VALUE18593 18594
+#define BSLS_MACROINCREMENTED_VALUE18594 18595
+#define BSLS_MACROINCREMENTED_VALUE18595 18596
+#define BSLS_MACROINCREMENTED_VALUE18596 18597
+#define BSLS_MACROINCREMENTED_VALUE18597 18598
+#define BSLS_MACROINCREMENTED_VALUE18598 18599
+#define BSLS_MACROINCREMENTED_VALUE18599 18600
+#define BSLS_MACROINCREMENTED_VALUE18600 18601
+#define BSLS_MACROINCREMENTED_VALUE18601 18602
+#define BSLS_MACROINCREMENTED_VALUE18602 18603
+#define BSLS_MACROINCREMENTED_VALUE18603 18604
+#define BSLS_MACROINCREMENTED_VALUE18604 18605
+#define BSLS_MACROINCREMENTED_VALUE18605 18606
+#define BSLS_MACROINCREMENTED_VALUE18606 18607
+#define BSLS_MACROINCREMENTED_VALUE18607 18608
+#define BSLS_MACROINCREMENTED_VALUE18608 18609
+#define BSLS_MACROINCREMENTED_VALUE18609 18610
+#define BSLS_MACROINCREMENTED_VALUE18610 18611
+#define BSLS_MACROINCREMENTED_VALUE18611 18612
+#define BSLS_MACROINCREMENTED_VALUE18612 18613
+#define BSLS_MACROINCREMENTED_VALUE18613 18614
+#define BSLS_MACROINCREMENTED_VALUE18614 18615
+#define BSLS_MACROINCREMENTED_VALUE18615 18616
+#define BSLS_MACROINCREMENTED_VALUE18616 18617
+#define BSLS_MACROINCREMENTED_VALUE18617 18618
+#define BSLS_MACROINCREMENTED_VALUE18618 18619
+#define BSLS_MACROINCREMENTED_VALUE18619 18620
+#define BSLS_MACROINCREMENTED_VALUE18620 18621
+#define BSLS_MACROINCREMENTED_VALUE18621 18622
+#define BSLS_MACROINCREMENTED_VALUE18622 18623
+#define BSLS_MACROINCREMENTED_VALUE18623 18624
+#define BSLS_MACROINCREMENTED_VALUE18624 18625
+#define BSLS_MACROINCREMENTED_VALUE18625 18626
+#define BSLS_MACROINCREMENTED_VALUE18626 18627
+#define BSLS_MACROINCREMENTED_VALUE18627 18628
+#define BSLS_MACROINCREMENTED_VALUE18628 18629
+#define BSLS_MACROINCREMENTED_VALUE18629 18630
+#define BSLS_MACROINCREMENTED_VALUE18630 18631
+#define BSLS_MACROINCREMENTED_VALUE18631 18632
+#define BSLS_MACROINCREMENTED_VALUE18632 18633
+#define BSLS_MACROINCREMENTED_VALUE18633 18634
+#define BSLS_MACROINCREMENTED_VALUE18634 18635
+#define BSLS_MACROINCREMENTED_VALUE18635 18636
+#define BSLS_MACROINCREMENTED_VALUE18636 18637
+#define BSLS_MACROINCREMENTED_VALUE18637 18638
+#define BSLS_MACROINCREMENTED_VALUE18638 18639
+#define BSLS_MACROINCREMENTED_VALUE18639 18640
+#define BSLS_MACROINCREMENTED_VALUE18640 18641
+#define BSLS_MACROINCREMENTED_VALUE18641 18642
+#define BSLS_MACROINCREMENTED_VALUE18642 18643
+#define BSLS_MACROINCREMENTED_VALUE18643 18644
+#define BSLS_MACROINCREMENTED_VALUE18644 18645
+#define BSLS_MACROINCREMENTED_VALUE18645 18646
+#define BSLS_MACROINCREMENTED_VALUE18646 18647
+#define BSLS_MACROINCREMENTED_VALUE18647 18648
+#define BSLS_MACROINCREMENTED_VALUE18648 18649
+#define BSLS_MACROINCREMENTED_VALUE18649 18650
+#define BSLS_MACROINCREMENTED_VALUE18650 18651
+#define BSLS_MACROINCREMENTED_VALUE18651 18652
+#define BSLS_MACROINCREMENTED_VALUE18652 18653
+#define BSLS_MACROINCREMENTED_VALUE18653 18654
+#define BSLS_MACROINCREMENTED_VALUE18654 18655
+#define BSLS_MACROINCREMENTED_VALUE18655 18656
+#define BSLS_MACROINCREMENTED_VALUE18656 18657
+#define BSLS_MACROINCREMENTED_VALUE18657 18658
+#define BSLS_MACROINCREMENTED_VALUE18658 18659
+#define BSLS_MACROINCREMENTED_VALUE18659 18660
+#define BSLS_MACROINCREMENTED_VALUE18660 18661
+#define BSLS_MACROINCREMENTED_VALUE18661 18662
+#define BSLS_MACROINCREMENTED_VALUE18662 18663
+#define BSLS_MACROINCREMENTED_VALUE18663 18664
+#define BSLS_MACROINCREMENTED_VALUE18664 18665
+#define BSLS_MACROINCREMENTED_VALUE18665 18666
+#define BSLS_MACROINCREMENTED_VALUE18666 18667
+#define BSLS_MACROINCREMENTED_VALUE18667 18668
+#define BSLS_MACROINCREMENTED_VALUE18668 18669
+#define BSLS_MACROINCREMENTED_VALUE18669 18670
+#define BSLS_MACROINCREMENTED_VALUE18670 18671
+#define BSLS_MACROINCREMENTED_VALUE18671 18672
+#define BSLS_MACROINCREMENTED_VALUE18672 18673
+#define BSLS_MACROINCREMENTED_VALUE18673 18674
+#define BSLS_MACROINCREMENTED_VALUE18674 18675
+#define BSLS_MACROINCREMENTED_VALUE18675 18676
+#define BSLS_MACROINCREMENTED_VALUE18676 18677
+#define BSLS_MACROINCREMENTED_VALUE18677 18678
+#define BSLS_MACROINCREMENTED_VALUE18678 18679
+#define BSLS_MACROINCREMENTED_VALUE18679 18680
+#define BSLS_MACROINCREMENTED_VALUE18680 18681
+#define BSLS_MACROINCREMENTED_VALUE18681 18682
+#define BSLS_MACROINCREMENTED_VALUE18682 18683
+#define BSLS_MACROINCREMENTED_VALUE18683 18684
+#define BSLS_MACROINCREMENTED_VALUE18684 18685
+#define BSLS_MACROINCREMENTED_VALUE18685 18686
+#define BSLS_MACROINCREMENTED_VALUE18686 18687
+#define BSLS_MACROINCREMENTED_VALUE18687 18688
+#define BSLS_MACROINCREMENTED_VALUE18688 18689
+#define BSLS_MACROINCREMENTED_VALUE18689 18690
+#define BSLS_MACROINCREMENTED_VALUE18690 18691
+#define BSLS_MACROINCREMENTED_VALUE18691 18692
+#define BSLS_MACROINCREMENTED_VALUE18692 18693
+#define BSLS_MACROINCREMENTED_VALUE18693 18694
+#define BSLS_MACROINCREMENTED_VALUE18694 18695
+#define BSLS_MACROINCREMENTED_VALUE18695 18696
+#define BSLS_MACROINCREMENTED_VALUE18696 18697
+#define BSLS_MACROINCREMENTED_VALUE18697 18698
+#define BSLS_MACROINCREMENTED_VALUE18698 18699
+#define BSLS_MACROINCREMENTED_VALUE18699 18700
+#define BSLS_MACROINCREMENTED_VALUE18700 18701
+#define BSLS_MACROINCREMENTED_VALUE18701 18702
+#define BSLS_MACROINCREMENTED_VALUE18702 18703
+#define BSLS_MACROINCREMENTED_VALUE18703 18704
+#define BSLS_MACROINCREMENTED_VALUE18704 18705
+#define BSLS_MACROINCREMENTED_VALUE18705 18706
+#define BSLS_MACROINCREMENTED_VALUE18706 18707
+#define BSLS_MACROINCREMENTED_VALUE18707 18708
+#define BSLS_MACROINCREMENTED_VALUE18708 18709
+#define BSLS_MACROINCREMENTED_VALUE18709 18710
+#define BSLS_MACROINCREMENTED_VALUE18710 18711
+#define BSLS_MACROINCREMENTED_VALUE18711 18712
+#define BSLS_MACROINCREMENTED_VALUE18712 18713
+#define BSLS_MACROINCREMENTED_VALUE18713 18714
+#define BSLS_MACROINCREMENTED_VALUE18714 18715
+#define BSLS_MACROINCREMENTED_VALUE18715 18716
+#define BSLS_MACROINCREMENTED_VALUE18716 18717
+#define BSLS_MACROINCREMENTED_VALUE18717 18718
+#define BSLS_MACROINCREMENTED_VALUE18718 18719
+#define BSLS_MACROINCREMENTED_VALUE18719 18720
+#define BSLS_MACROINCREMENTED_VALUE18720 18721
+#define BSLS_MACROINCREMENTED_VALUE18721 18722
+#define BSLS_MACROINCREMENTED_VALUE18722 18723
+#define BSLS_MACROINCREMENTED_VALUE18723 18724
+#define BSLS_MACROINCREMENTED_VALUE18724 18725
+#define BSLS_MACROINCREMENTED_VALUE18725 18726
+#define BSLS_MACROINCREMENTED_VALUE18726 18727
+#define BSLS_MACROINCREMENTED_VALUE18727 18728
+#define BSLS_MACROINCREMENTED_VALUE18728 18729
+#define BSLS_MACROINCREMENTED_VALUE18729 18730
+#define BSLS_MACROINCREMENTED_VALUE18730 18731
+#define BSLS_MACROINCREMENTED_VALUE18731 18732
+#define BSLS_MACROINCREMENTED_VALUE18732 18733
+#define BSLS_MACROINCREMENTED_VALUE18733 18734
+#define BSLS_MACROINCREMENTED_VALUE18734 18735
+#define BSLS_MACROINCREMENTED_VALUE18735 18736
+#define BSLS_MACROINCREMENTED_VALUE18736 18737
+#define BSLS_MACROINCREMENTED_VALUE18737 18738
+#define BSLS_MACROINCREMENTED_VALUE18738 18739
+#define BSLS_MACROINCREMENTED_VALUE18739 18740
+#define BSLS_MACROINCREMENTED_VALUE18740 18741
+#define BSLS_MACROINCREMENTED_VALUE18741 18742
+#define BSLS_MACROINCREMENTED_VALUE18742 18743
+#define BSLS_MACROINCREMENTED_VALUE18743 18744
+#define BSLS_MACROINCREMENTED_VALUE18744 18745
+#define BSLS_MACROINCREMENTED_VALUE18745 18746
+#define BSLS_MACROINCREMENTED_VALUE18746 18747
+#define BSLS_MACROINCREMENTED_VALUE18747 18748
+#define BSLS_MACROINCREMENTED_VALUE18748 18749
+#define BSLS_MACROINCREMENTED_VALUE18749 18750
+#define BSLS_MACROINCREMENTED_VALUE18750 18751
+#define BSLS_MACROINCREMENTED_VALUE18751 18752
+#define BSLS_MACROINCREMENTED_VALUE18752 18753
+#define BSLS_MACROINCREMENTED_VALUE18753 18754
+#define BSLS_MACROINCREMENTED_VALUE18754 18755
+#define BSLS_MACROINCREMENTED_VALUE18755 18756
+#define BSLS_MACROINCREMENTED_VALUE18756 18757
+#define BSLS_MACROINCREMENTED_VALUE18757 18758
+#define BSLS_MACROINCREMENTED_VALUE18758 18759
+#define BSLS_MACROINCREMENTED_VALUE18759 18760
+#define BSLS_MACROINCREMENTED_VALUE18760 18761
+#define BSLS_MACROINCREMENTED_VALUE18761 18762
+#define BSLS_MACROINCREMENTED_VALUE18762 18763
+#define BSLS_MACROINCREMENTED_VALUE18763 18764
+#define BSLS_MACROINCREMENTED_VALUE18764 18765
+#define BSLS_MACROINCREMENTED_VALUE18765 18766
+#define BSLS_MACROINCREMENTED_VALUE18766 18767
+#define BSLS_MACROINCREMENTED_VALUE18767 18768
+#define BSLS_MACROINCREMENTED_VALUE18768 18769
+#define BSLS_MACROINCREMENTED_VALUE18769 18770
+#define BSLS_MACROINCREMENTED_VALUE18770 18771
+#define BSLS_MACROINCREMENTED_VALUE18771 18772
+#define BSLS_MACROINCREMENTED_VALUE18772 18773
+#define BSLS_MACROINCREMENTED_VALUE18773 18774
+#define BSLS_MACROINCREMENTED_VALUE18774 18775
+#define BSLS_MACROINCREMENTED_VALUE18775 18776
+#define BSLS_MACROINCREMENTED_VALUE18776 18777
+#define BSLS_MACROINCREMENTED_VALUE18777 18778
+#define BSLS_MACROINCREMENTED_VALUE18778 18779
+#define BSLS_MACROINCREMENTED_VALUE18779 18780
+#define BSLS_MACROINCREMENTED_VALUE18780 18781
+#define BSLS_MACROINCREMENTED_VALUE18781 18782
+#define BSLS_MACROINCREMENTED_VALUE18782 18783
+#define BSLS_MACROINCREMENTED_VALUE18783 18784
+#define BSLS_MACROINCREMENTED_VALUE18784 18785
+#define BSLS_MACROINCREMENTED_VALUE18785 18786
+#define BSLS_MACROINCREMENTED_VALUE18786 18787
+#define BSLS_MACROINCREMENTED_VALUE18787 18788
+#define BSLS_MACROINCREMENTED_VALUE18788 18789
+#define BSLS_MACROINCREMENTED_VALUE18789 18790
+#define BSLS_MACROINCREMENTED_VALUE18790 18791
+#define BSLS_MACROINCREMENTED_VALUE18791 18792
+#define BSLS_MACROINCREMENTED_VALUE18792 18793
+#define BSLS_MACROINCREMENTED_VALUE18793 18794
+#define BSLS_MACROINCREMENTED_VALUE18794 18795
+#define BSLS_MACROINCREMENTED_VALUE18795 18796
+#define BSLS_MACROINCREMENTED_VALUE18796 18797
+#define BSLS_MACROINCREMENTED_VALUE18797 18798
+#define BSLS_MACROINCREMENTED_VALUE18798 18799
+#define BSLS_MACROINCREMENTED_VALUE18799 18800
+#define BSLS_MACROINCREMENTED_VALUE18800 18801
+#define BSLS_MACROINCREMENTED_VALUE18801 18802
+#define BSLS_MACROINCREMENTED_VALUE18802 18803
+#define BSLS_MACROINCREMENTED_VALUE18803 18804
+#define BSLS_MACROINCREMENTED_VALUE18804 18805
+#define BSLS_MACROINCREMENTED_VALUE18805 18806
+#define BSLS_MACROINCREMENTED_VALUE18806 18807
+#define BSLS_MACROINCREMENTED_VALUE18807 18808
+#define BSLS_MACROINCREMENTED_VALUE18808 18809
+#define BSLS_MACROINCREMENTED_VALUE18809 18810
+#define BSLS_MACROINCREMENTED_VALUE18810 18811
+#define BSLS_MACROINCREMENTED_VALUE18811 18812
+#define BSLS_MACROINCREMENTED_VALUE18812 18813
+#define BSLS_MACROINCREMENTED_VALUE18813 18814
+#define BSLS_MACROINCREMENTED_VALUE18814 18815
+#define BSLS_MACROINCREMENTED_VALUE18815 18816
+#define BSLS_MACROINCREMENTED_VALUE18816 18817
+#define BSLS_MACROINCREMENTED_VALUE18817 18818
+#define BSLS_MACROINCREMENTED_VALUE18818 18819
+#define BSLS_MACROINCREMENTED_VALUE18819 18820
+#define BSLS_MACROINCREMENTED_VALUE18820 18821
+#define BSLS_MACROINCREMENTED_VALUE18821 18822
+#define BSLS_MACROINCREMENTED_VALUE18822 18823
+#define BSLS_MACROINCREMENTED_VALUE18823 18824
+#define BSLS_MACROINCREMENTED_VALUE18824 18825
+#define BSLS_MACROINCREMENTED_VALUE18825 18826
+#define BSLS_MACROINCREMENTED_VALUE18826 18827
+#define BSLS_MACROINCREMENTED_VALUE18827 18828
+#define BSLS_MACROINCREMENTED_VALUE18828 18829
+#define BSLS_MACROINCREMENTED_VALUE18829 18830
+#define BSLS_MACROINCREMENTED_VALUE18830 18831
+#define BSLS_MACROINCREMENTED_VALUE18831 18832
+#define BSLS_MACROINCREMENTED_VALUE18832 18833
+#define BSLS_MACROINCREMENTED_VALUE18833 18834
+#define BSLS_MACROINCREMENTED_VALUE18834 18835
+#define BSLS_MACROINCREMENTED_VALUE18835 18836
+#define BSLS_MACROINCREMENTED_VALUE18836 18837
+#define BSLS_MACROINCREMENTED_VALUE18837 18838
+#define BSLS_MACROINCREMENTED_VALUE18838 18839
+#define BSLS_MACROINCREMENTED_VALUE18839 18840
+#define BSLS_MACROINCREMENTED_VALUE18840 18841
+#define BSLS_MACROINCREMENTED_VALUE18841 18842
+#define BSLS_MACROINCREMENTED_VALUE18842 18843
+#define BSLS_MACROINCREMENTED_VALUE18843 18844
+#define BSLS_MACROINCREMENTED_VALUE18844 18845
+#define BSLS_MACROINCREMENTED_VALUE18845 18846
+#define BSLS_MACROINCREMENTED_VALUE18846 18847
+#define BSLS_MACROINCREMENTED_VALUE18847 18848
+#define BSLS_MACROINCREMENTED_VALUE18848 18849
+#define BSLS_MACROINCREMENTED_VALUE18849 18850
+#define BSLS_MACROINCREMENTED_VALUE18850 18851
+#define BSLS_MACROINCREMENTED_VALUE18851 18852
+#define BSLS_MACROINCREMENTED_VALUE18852 18853
+#define BSLS_MACROINCREMENTED_VALUE18853 18854
+#define BSLS_MACROINCREMENTED_VALUE18854 18855
+#define BSLS_MACROINCREMENTED_VALUE18855 18856
+#define BSLS_MACROINCREMENTED_VALUE18856 18857
+#define BSLS_MACROINCREMENTED_VALUE18857 18858
+#define BSLS_MACROINCREMENTED_VALUE18858 18859
+#define BSLS_MACROINCREMENTED_VALUE18859 18860
+#define BSLS_MACROINCREMENTED_VALUE18860 18861
+#define BSLS_MACROINCREMENTED_VALUE18861 18862
+#define BSLS_MACROINCREMENTED_VALUE18862 18863
+#define BSLS_MACROINCREMENTED_VALUE18863 18864
+#define BSLS_MACROINCREMENTED_VALUE18864 18865
+#define BSLS_MACROINCREMENTED_VALUE18865 18866
+#define BSLS_MACROINCREMENTED_VALUE18866 18867
+#define BSLS_MACROINCREMENTED_VALUE18867 18868
+#define BSLS_MACROINCREMENTED_VALUE18868 18869
+#define BSLS_MACROINCREMENTED_VALUE18869 18870
+#define BSLS_MACROINCREMENTED_VALUE18870 18871
+#define BSLS_MACROINCREMENTED_VALUE18871 18872
+#define BSLS_MACROINCREMENTED_VALUE18872 18873
+#define BSLS_MACROINCREMENTED_VALUE18873 18874
+#define BSLS_MACROINCREMENTED_VALUE18874 18875
+#define BSLS_MACROINCREMENTED_VALUE18875 18876
+#define BSLS_MACROINCREMENTED_VALUE18876 18877
+#define BSLS_MACROINCREMENTED_VALUE18877 18878
+#define BSLS_MACROINCREMENTED_VALUE18878 18879
+#define BSLS_MACROINCREMENTED_VALUE18879 18880
+#define BSLS_MACROINCREMENTED_VALUE18880 18881
+#define BSLS_MACROINCREMENTED_VALUE18881 18882
+#define BSLS_MACROINCREMENTED_VALUE18882 18883
+#define BSLS_MACROINCREMENTED_VALUE18883 18884
+#define BSLS_MACROINCREMENTED_VALUE18884 18885
+#define BSLS_MACROINCREMENTED_VALUE18885 18886
+#define BSLS_MACROINCREMENTED_VALUE18886 18887
+#define BSLS_MACROINCREMENTED_VALUE18887 18888
+#define BSLS_MACROINCREMENTED_VALUE18888 18889
+#define BSLS_MACROINCREMENTED_VALUE18889 18890
+#define BSLS_MACROINCREMENTED_VALUE18890 18891
+#define BSLS_MACROINCREMENTED_VALUE18891 18892
+#define BSLS_MACROINCREMENTED_VALUE18892 18893
+#define BSLS_MACROINCREMENTED_VALUE18893 18894
+#define BSLS_MACROINCREMENTED_VALUE18894 18895
+#define BSLS_MACROINCREMENTED_VALUE18895 18896
+#define BSLS_MACROINCREMENTED_VALUE18896 18897
+#define BSLS_MACROINCREMENTED_VALUE18897 18898
+#define BSLS_MACROINCREMENTED_VALUE18898 18899
+#define BSLS_MACROINCREMENTED_VALUE18899 18900
+#define BSLS_MACROINCREMENTED_VALUE18900 18901
+#define BSLS_MACROINCREMENTED_VALUE18901 18902
+#define BSLS_MACROINCREMENTED_VALUE18902 18903
+#define BSLS_MACROINCREMENTED_VALUE18903 18904
+#define BSLS_MACROINCREMENTED_VALUE18904 18905
+#define BSLS_MACROINCREMENTED_VALUE18905 18906
+#define BSLS_MACROINCREMENTED_VALUE18906 18907
+#define BSLS_MACROINCREMENTED_VALUE18907 18908
+#define BSLS_MACROINCREMENTED_VALUE18908 18909
+#define BSLS_MACROINCREMENTED_VALUE18909 18910
+#define BSLS_MACROINCREMENTED_VALUE18910 18911
+#define BSLS_MACROINCREMENTED_VALUE18911 18912
+#define BSLS_MACROINCREMENTED_VALUE18912 18913
+#define BSLS_MACROINCREMENTED_VALUE18913 18914
+#define BSLS_MACROINCREMENTED_VALUE18914 18915
+#define BSLS_MACROINCREMENTED_VALUE18915 18916
+#define BSLS_MACROINCREMENTED_VALUE18916 18917
+#define BSLS_MACROINCREMENTED_VALUE18917 18918
+#define BSLS_MACROINCREMENTED_VALUE18918 18919
+#define BSLS_MACROINCREMENTED_VALUE18919 18920
+#define BSLS_MACROINCREMENTED_VALUE18920 18921
+#define BSLS_MACROINCREMENTED_VALUE18921 18922
+#define BSLS_MACROINCREMENTED_VALUE18922 18923
+#define BSLS_MACROINCREMENTED_VALUE18923 18924
+#define BSLS_MACROINCREMENTED_VALUE18924 18925
+#define BSLS_MACROINCREMENTED_VALUE18925 18926
+#define BSLS_MACROINCREMENTED_VALUE18926 18927
+#define BSLS_MACROINCREMENTED_VALUE18927 18928
+#define BSLS_MACROINCREMENTED_VALUE18928 18929
+#define BSLS_MACROINCREMENTED_VALUE18929 18930
+#define BSLS_MACROINCREMENTED_VALUE18930 18931
+#define BSLS_MACROINCREMENTED_VALUE18931 18932
+#define BSLS_MACROINCREMENTED_VALUE18932 18933
+#define BSLS_MACROINCREMENTED_VALUE18933 18934
+#define BSLS_MACROINCREMENTED_VALUE18934 18935
+#define BSLS_MACROINCREMENTED_VALUE18935 18936
+#define BSLS_MACROINCREMENTED_VALUE18936 18937
+#define BSLS_MACROINCREMENTED_VALUE18937 18938
+#define BSLS_MACROINCREMENTED_VALUE18938 18939
+#define BSLS_MACROINCREMENTED_VALUE18939 18940
+#define BSLS_MACROINCREMENTED_VALUE18940 18941
+#define BSLS_MACROINCREMENTED_VALUE18941 18942
+#define BSLS_MACROINCREMENTED_VALUE18942 18943
+#define BSLS_MACROINCREMENTED_VALUE18943 18944
+#define BSLS_MACROINCREMENTED_VALUE18944 18945
+#define BSLS_MACROINCREMENTED_VALUE18945 18946
+#define BSLS_MACROINCREMENTED_VALUE18946 18947
+#define BSLS_MACROINCREMENTED_VALUE18947 18948
+#define BSLS_MACROINCREMENTED_VALUE18948 18949
+#define BSLS_MACROINCREMENTED_VALUE18949 18950
+#define BSLS_MACROINCREMENTED_VALUE18950 18951
+#define BSLS_MACROINCREMENTED_VALUE18951 18952
+#define BSLS_MACROINCREMENTED_VALUE18952 18953
+#define BSLS_MACROINCREMENTED_VALUE18953 18954
+#define BSLS_MACROINCREMENTED_VALUE18954 18955
+#define BSLS_MACROINCREMENTED_VALUE18955 18956
+#define BSLS_MACROINCREMENTED_VALUE18956 18957
+#define BSLS_MACROINCREMENTED_VALUE18957 18958
+#define BSLS_MACROINCREMENTED_VALUE18958 18959
+#define BSLS_MACROINCREMENTED_VALUE18959 18960
+#define BSLS_MACROINCREMENTED_VALUE18960 18961
+#define BSLS_MACROINCREMENTED_VALUE18961 18962
+#define BSLS_MACROINCREMENTED_VALUE18962 18963
+#define BSLS_MACROINCREMENTED_VALUE18963 18964
+#define BSLS_MACROINCREMENTED_VALUE18964 18965
+#define BSLS_MACROINCREMENTED_VALUE18965 18966
+#define BSLS_MACROINCREMENTED_VALUE18966 18967
+#define BSLS_MACROINCREMENTED_VALUE18967 18968
+#define BSLS_MACROINCREMENTED_VALUE18968 18969
+#define BSLS_MACROINCREMENTED_VALUE18969 18970
+#define BSLS_MACROINCREMENTED_VALUE18970 18971
+#define BSLS_MACROINCREMENTED_VALUE18971 18972
+#define BSLS_MACROINCREMENTED_VALUE18972 18973
+#define BSLS_MACROINCREMENTED_VALUE18973 18974
+#define BSLS_MACROINCREMENTED_VALUE18974 18975
+#define BSLS_MACROINCREMENTED_VALUE18975 18976
+#define BSLS_MACROINCREMENTED_VALUE18976 18977
+#define BSLS_MACROINCREMENTED_VALUE18977 18978
+#define BSLS_MACROINCREMENTED_VALUE18978 18979
+#define BSLS_MACROINCREMENTED_VALUE18979 18980
+#define BSLS_MACROINCREMENTED_VALUE18980 18981
+#define BSLS_MACROINCREMENTED_VALUE18981 18982
+#define BSLS_MACROINCREMENTED_VALUE18982 18983
+#define BSLS_MACROINCREMENTED_VALUE18983 18984
+#define BSLS_MACROINCREMENTED_VALUE18984 18985
+#define BSLS_MACROINCREMENTED_VALUE18985 18986
+#define BSLS_MACROINCREMENTED_VALUE18986 18987
+#define BSLS_MACROINCREMENTED_VALUE18987 18988
+#define BSLS_MACROINCREMENTED_VALUE18988 18989
+#define BSLS_MACROINCREMENTED_VALUE18989 18990
+#define BSLS_MACROINCREMENTED_VALUE18990 18991
+#define BSLS_MACROINCREMENTED_VALUE18991 18992
+#define BSLS_MACROINCREMENTED_VALUE18992 18993
+#define BSLS_MACROINCREMENTED_VALUE18993 18994
+#define BSLS_MACROINCREMENTED_VALUE18994 18995
+#define BSLS_MACROINCREMENTED_VALUE18995 18996
+#define BSLS_MACROINCREMENTED_VALUE18996 18997
+#define BSLS_MACROINCREMENTED_VALUE18997 18998
+#define BSLS_MACROINCREMENTED_VALUE18998 18999
+#define BSLS_MACROINCREMENTED_VALUE18999 19000
+#define BSLS_MACROINCREMENTED_VALUE19000 19001
+#define BSLS_MACROINCREMENTED_VALUE19001 19002
+#define BSLS_MACROINCREMENTED_VALUE19002 19003
+#define BSLS_MACROINCREMENTED_VALUE19003 19004
+#define BSLS_MACROINCREMENTED_VALUE19004 19005
+#define BSLS_MACROINCREMENTED_VALUE19005 19006
+#define BSLS_MACROINCREMENTED_VALUE19006 19007
+#define BSLS_MACROINCREMENTED_VALUE19007 19008
+#define BSLS_MACROINCREMENTED_VALUE19008 19009
+#define BSLS_MACROINCREMENTED_VALUE19009 19010
+#define BSLS_MACROINCREMENTED_VALUE19010 19011
+#define BSLS_MACROINCREMENTED_VALUE19011 19012
+#define BSLS_MACROINCREMENTED_VALUE19012 19013
+#define BSLS_MACROINCREMENTED_VALUE19013 19014
+#define BSLS_MACROINCREMENTED_VALUE19014 19015
+#define BSLS_MACROINCREMENTED_VALUE19015 19016
+#define BSLS_MACROINCREMENTED_VALUE19016 19017
+#define BSLS_MACROINCREMENTED_VALUE19017 19018
+#define BSLS_MACROINCREMENTED_VALUE19018 19019
+#define BSLS_MACROINCREMENTED_VALUE19019 19020
+#define BSLS_MACROINCREMENTED_VALUE19020 19021
+#define BSLS_MACROINCREMENTED_VALUE19021 19022
+#define BSLS_MACROINCREMENTED_VALUE19022 19023
+#define BSLS_MACROINCREMENTED_VALUE19023 19024
+#define BSLS_MACROINCREMENTED_VALUE19024 19025
+#define BSLS_MACROINCREMENTED_VALUE19025 19026
+#define BSLS_MACROINCREMENTED_VALUE19026 19027
+#define BSLS_MACROINCREMENTED_VALUE19027 19028
+#define BSLS_MACROINCREMENTED_VALUE19028 19029
+#define BSLS_MACROINCREMENTED_VALUE19029 19030
+#define BSLS_MACROINCREMENTED_VALUE19030 19031
+#define BSLS_MACROINCREMENTED_VALUE19031 19032
+#define BSLS_MACROINCREMENTED_VALUE19032 19033
+#define BSLS_MACROINCREMENTED_VALUE19033 19034
+#define BSLS_MACROINCREMENTED_VALUE19034 19035
+#define BSLS_MACROINCREMENTED_VALUE19035 19036
+#define BSLS_MACROINCREMENTED_VALUE19036 19037
+#define BSLS_MACROINCREMENTED_VALUE19037 19038
+#define BSLS_MACROINCREMENTED_VALUE19038 19039
+#define BSLS_MACROINCREMENTED_VALUE19039 19040
+#define BSLS_MACROINCREMENTED_VALUE19040 19041
+#define BSLS_MACROINCREMENTED_VALUE19041 19042
+#define BSLS_MACROINCREMENTED_VALUE19042 19043
+#define BSLS_MACROINCREMENTED_VALUE19043 19044
+#define BSLS_MACROINCREMENTED_VALUE19044 19045
+#define BSLS_MACROINCREMENTED_VALUE19045 19046
+#define BSLS_MACROINCREMENTED_VALUE19046 19047
+#define BSLS_MACROINCREMENTED_VALUE19047 19048
+#define BSLS_MACROINCREMENTED_VALUE19048 19049
+#define BSLS_MACROINCREMENTED_VALUE19049 19050
+#define BSLS_MACROINCREMENTED_VALUE19050 19051
+#define BSLS_MACROINCREMENTED_VALUE19051 19052
+#define BSLS_MACROINCREMENTED_VALUE19052 19053
+#define BSLS_MACROINCREMENTED_VALUE19053 19054
+#define BSLS_MACROINCREMENTED_VALUE19054 19055
+#define BSLS_MACROINCREMENTED_VALUE19055 19056
+#define BSLS_MACROINCREMENTED_VALUE19056 19057
+#define BSLS_MACROINCREMENTED_VALUE19057 19058
+#define BSLS_MACROINCREMENTED_VALUE19058 19059
+#define BSLS_MACROINCREMENTED_VALUE19059 19060
+#define BSLS_MACROINCREMENTED_VALUE19060 19061
+#define BSLS_MACROINCREMENTED_VALUE19061 19062
+#define BSLS_MACROINCREMENTED_VALUE19062 19063
+#define BSLS_MACROINCREMENTED_VALUE19063 19064
+#define BSLS_MACROINCREMENTED_VALUE19064 19065
+#define BSLS_MACROINCREMENTED_VALUE19065 19066
+#define BSLS_MACROINCREMENTED_VALUE19066 19067
+#define BSLS_MACROINCREMENTED_VALUE19067 19068
+#define BSLS_MACROINCREMENTED_VALUE19068 19069
+#define BSLS_MACROINCREMENTED_VALUE19069 19070
+#define BSLS_MACROINCREMENTED_VALUE19070 19071
+#define BSLS_MACROINCREMENTED_VALUE19071 19072
+#define BSLS_MACROINCREMENTED_VALUE19072 19073
+#define BSLS_MACROINCREMENTED_VALUE19073 19074
+#define BSLS_MACROINCREMENTED_VALUE19074 19075
+#define BSLS_MACROINCREMENTED_VALUE19075 19076
+#define BSLS_MACROINCREMENTED_VALUE19076 19077
+#define BSLS_MACROINCREMENTED_VALUE19077 19078
+#define BSLS_MACROINCREMENTED_VALUE19078 19079
+#define BSLS_MACROINCREMENTED_VALUE19079 19080
+#define BSLS_MACROINCREMENTED_VALUE19080 19081
+#define BSLS_MACROINCREMENTED_VALUE19081 19082
+#define BSLS_MACROINCREMENTED_VALUE19082 19083
+#define BSLS_MACROINCREMENTED_VALUE19083 19084
+#define BSLS_MACROINCREMENTED_VALUE19084 19085
+#define BSLS_MACROINCREMENTED_VALUE19085 19086
+#define BSLS_MACROINCREMENTED_VALUE19086 19087
+#define BSLS_MACROINCREMENTED_VALUE19087 19088
+#define BSLS_MACROINCREMENTED_VALUE19088 19089
+#define BSLS_MACROINCREMENTED_VALUE19089 19090
+#define BSLS_MACROINCREMENTED_VALUE19090 19091
+#define BSLS_MACROINCREMENTED_VALUE19091 19092
+#define BSLS_MACROINCREMENTED_VALUE19092 19093
+#define BSLS_MACROINCREMENTED_VALUE19093 19094
+#define BSLS_MACROINCREMENTED_VALUE19094 19095
+#define BSLS_MACROINCREMENTED_VALUE19095 19096
+#define BSLS_MACROINCREMENTED_VALUE19096 19097
+#define BSLS_MACROINCREMENTED_VALUE19097 19098
+#define BSLS_MACROINCREMENTED_VALUE19098 19099
+#define BSLS_MACROINCREMENTED_VALUE19099 19100
+#define BSLS_MACROINCREMENTED_VALUE19100 19101
+#define BSLS_MACROINCREMENTED_VALUE19101 19102
+#define BSLS_MACROINCREMENTED_VALUE19102 19103
+#define BSLS_MACROINCREMENTED_VALUE19103 19104
+#define BSLS_MACROINCREMENTED_VALUE19104 19105
+#define BSLS_MACROINCREMENTED_VALUE19105 19106
+#define BSLS_MACROINCREMENTED_VALUE19106 19107
+#define BSLS_MACROINCREMENTED_VALUE19107 19108
+#define BSLS_MACROINCREMENTED_VALUE19108 19109
+#define BSLS_MACROINCREMENTED_VALUE19109 19110
+#define BSLS_MACROINCREMENTED_VALUE19110 19111
+#define BSLS_MACROINCREMENTED_VALUE19111 19112
+#define BSLS_MACROINCREMENTED_VALUE19112 19113
+#define BSLS_MACROINCREMENTED_VALUE19113 19114
+#define BSLS_MACROINCREMENTED_VALUE19114 19115
+#define BSLS_MACROINCREMENTED_VALUE19115 19116
+#define BSLS_MACROINCREMENTED_VALUE19116 19117
+#define BSLS_MACROINCREMENTED_VALUE19117 19118
+#define BSLS_MACROINCREMENTED_VALUE19118 19119
+#define BSLS_MACROINCREMENTED_VALUE19119 19120
+#define BSLS_MACROINCREMENTED_VALUE19120 19121
+#define BSLS_MACROINCREMENTED_VALUE19121 19122
+#define BSLS_MACROINCREMENTED_VALUE19122 19123
+#define BSLS_MACROINCREMENTED_VALUE19123 19124
+#define BSLS_MACROINCREMENTED_VALUE19124 19125
+#define BSLS_MACROINCREMENTED_VALUE19125 19126
+#define BSLS_MACROINCREMENTED_VALUE19126 19127
+#define BSLS_MACROINCREMENTED_VALUE19127 19128
+#define BSLS_MACROINCREMENTED_VALUE19128 19129
+#define BSLS_MACROINCREMENTED_VALUE19129 19130
+#define BSLS_MACROINCREMENTED_VALUE19130 19131
+#define BSLS_MACROINCREMENTED_VALUE19131 19132
+#define BSLS_MACROINCREMENTED_VALUE19132 19133
+#define BSLS_MACROINCREMENTED_VALUE19133 19134
+#define BSLS_MACROINCREMENTED_VALUE19134 19135
+#define BSLS_MACROINCREMENTED_VALUE19135 19136
+#define BSLS_MACROINCREMENTED_VALUE19136 19137
+#define BSLS_MACROINCREMENTED_VALUE19137 19138
+#define BSLS_MACROINCREMENTED_VALUE19138 19139
+#define BSLS_MACROINCREMENTED_VALUE19139 19140
+#define BSLS_MACROINCREMENTED_VALUE19140 19141
+#define BSLS_MACROINCREMENTED_VALUE19141 19142
+#define BSLS_MACROINCREMENTED_VALUE19142 19143
+#define BSLS_MACROINCREMENTED_VALUE19143 19144
+#define BSLS_MACROINCREMENTED_VALUE19144 19145
+#define BSLS_MACROINCREMENTED_VALUE19145 19146
+#define BSLS_MACROINCREMENTED_VALUE19146 19147
+#define BSLS_MACROINCREMENTED_VALUE19147 19148
+#define BSLS_MACROINCREMENTED_VALUE19148 19149
+#define BSLS_MACROINCREMENTED_VALUE19149 19150
+#define BSLS_MACROINCREMENTED_VALUE19150 19151
+#define BSLS_MACROINCREMENTED_VALUE19151 19152
+#define BSLS_MACROINCREMENTED_VALUE19152 19153
+#define BSLS_MACROINCREMENTED_VALUE19153 19154
+#define BSLS_MACROINCREMENTED_VALUE19154 19155
+#define BSLS_MACROINCREMENTED_VALUE19155 19156
+#define BSLS_MACROINCREMENTED_VALUE19156 19157
+#define BSLS_MACROINCREMENTED_VALUE19157 19158
+#define BSLS_MACROINCREMENTED_VALUE19158 19159
+#define BSLS_MACROINCREMENTED_VALUE19159 19160
+#define BSLS_MACROINCREMENTED_VALUE19160 19161
+#define BSLS_MACROINCREMENTED_VALUE19161 19162
+#define BSLS_MACROINCREMENTED_VALUE19162 19163
+#define BSLS_MACROINCREMENTED_VALUE19163 19164
+#define BSLS_MACROINCREMENTED_VALUE19164 19165
+#define BSLS_MACROINCREMENTED_VALUE19165 19166
+#define BSLS_MACROINCREMENTED_VALUE19166 19167
+#define BSLS_MACROINCREMENTED_VALUE19167 19168
+#define BSLS_MACROINCREMENTED_VALUE19168 19169
+#define BSLS_MACROINCREMENTED_VALUE19169 19170
+#define BSLS_MACROINCREMENTED_VALUE19170 19171
+#define BSLS_MACROINCREMENTED_VALUE19171 19172
+#define BSLS_MACROINCREMENTED_VALUE19172 19173
+#define BSLS_MACROINCREMENTED_VALUE19173 19174
+#define BSLS_MACROINCREMENTED_VALUE19174 19175
+#define BSLS_MACROINCREMENTED_VALUE19175 19176
+#define BSLS_MACROINCREMENTED_VALUE19176 19177
+#define BSLS_MACROINCREMENTED_VALUE19177 19178
+#define BSLS_MACROINCREMENTED_VALUE19178 19179
+#define BSLS_MACROINCREMENTED_VALUE19179 19180
+#define BSLS_MACROINCREMENTED_VALUE19180 19181
+#define BSLS_MACROINCREMENTED_VALUE19181 19182
+#define BSLS_MACROINCREMENTED_VALUE19182 19183
+#define BSLS_MACROINCREMENTED_VALUE19183 19184
+#define BSLS_MACROINCREMENTED_VALUE19184 19185
+#define BSLS_MACROINCREMENTED_VALUE19185 19186
+#define BSLS_MACROINCREMENTED_VALUE19186 19187
+#define BSLS_MACROINCREMENTED_VALUE19187 19188
+#define BSLS_MACROINCREMENTED_VALUE19188 19189
+#define BSLS_MACROINCREMENTED_VALUE19189 19190
+#define BSLS_MACROINCREMENTED_VALUE19190 19191
+#define BSLS_MACROINCREMENTED_VALUE19191 19192
+#define BSLS_MACROINCREMENTED_VALUE19192 19193
+#define BSLS_MACROINCREMENTED_VALUE19193 19194
+#define BSLS_MACROINCREMENTED_VALUE19194 19195
+#define BSLS_MACROINCREMENTED_VALUE19195 19196
+#define BSLS_MACROINCREMENTED_VALUE19196 19197
+#define BSLS_MACROINCREMENTED_VALUE19197 19198
+#define BSLS_MACROINCREMENTED_VALUE19198 19199
+#define BSLS_MACROINCREMENTED_VALUE19199 19200
+#define BSLS_MACROINCREMENTED_VALUE19200 19201
+#define BSLS_MACROINCREMENTED_VALUE19201 19202
+#define BSLS_MACROINCREMENTED_VALUE19202 19203
+#define BSLS_MACROINCREMENTED_VALUE19203 19204
+#define BSLS_MACROINCREMENTED_VALUE19204 19205
+#define BSLS_MACROINCREMENTED_VALUE19205 19206
+#define BSLS_MACROINCREMENTED_VALUE19206 19207
+#define BSLS_MACROINCREMENTED_VALUE19207 19208
+#define BSLS_MACROINCREMENTED_VALUE19208 19209
+#define BSLS_MACROINCREMENTED_VALUE19209 19210
+#define BSLS_MACROINCREMENTED_VALUE19210 19211
+#define BSLS_MACROINCREMENTED_VALUE19211 19212
+#define BSLS_MACROINCREMENTED_VALUE19212 19213
+#define BSLS_MACROINCREMENTED_VALUE19213 19214
+#define BSLS_MACROINCREMENTED_VALUE19214 19215
+#define BSLS_MACROINCREMENTED_VALUE19215 19216
+#define BSLS_MACROINCREMENTED_VALUE19216 19217
+#define BSLS_MACROINCREMENTED_VALUE19217 19218
+#define BSLS_MACROINCREMENTED_VALUE19218 19219
+#define BSLS_MACROINCREMENTED_VALUE19219 19220
+#define BSLS_MACROINCREMENTED_VALUE19220 19221
+#define BSLS_MACROINCREMENTED_VALUE19221 19222
+#define BSLS_MACROINCREMENTED_VALUE19222 19223
+#define BSLS_MACROINCREMENTED_VALUE19223 19224
+#define BSLS_MACROINCREMENTED_VALUE19224 19225
+#define BSLS_MACROINCREMENTED_VALUE19225 19226
+#define BSLS_MACROINCREMENTED_VALUE19226 19227
+#define BSLS_MACROINCREMENTED_VALUE19227 19228
+#define BSLS_MACROINCREMENTED_VALUE19228 19229
+#define BSLS_MACROINCREMENTED_VALUE19229 19230
+#define BSLS_MACROINCREMENTED_VALUE19230 19231
+#define BSLS_MACROINCREMENTED_VALUE19231 19232
+#define BSLS_MACROINCREMENTED_VALUE19232 19233
+#define BSLS_MACROINCREMENTED_VALUE19233 19234
+#define BSLS_MACROINCREMENTED_VALUE19234 19235
+#define BSLS_MACROINCREMENTED_VALUE19235 19236
+#define BSLS_MACROINCREMENTED_VALUE19236 19237
+#define BSLS_MACROINCREMENTED_VALUE19237 19238
+#define BSLS_MACROINCREMENTED_VALUE19238 19239
+#define BSLS_MACROINCREMENTED_VALUE19239 19240
+#define BSLS_MACROINCREMENTED_VALUE19240 19241
+#define BSLS_MACROINCREMENTED_VALUE19241 19242
+#define BSLS_MACROINCREMENTED_VALUE19242 19243
+#define BSLS_MACROINCREMENTED_VALUE19243 19244
+#define BSLS_MACROINCREMENTED_VALUE19244 19245
+#define BSLS_MACROINCREMENTED_VALUE19245 19246
+#define BSLS_MACROINCREMENTED_VALUE19246 19247
+#define BSLS_MACROINCREMENTED_VALUE19247 19248
+#define BSLS_MACROINCREMENTED_VALUE19248 19249
+#define BSLS_MACROINCREMENTED_VALUE19249 19250
+#define BSLS_MACROINCREMENTED_VALUE19250 19251
+#define BSLS_MACROINCREMENTED_VALUE19251 19252
+#define BSLS_MACROINCREMENTED_VALUE19252 19253
+#define BSLS_MACROINCREMENTED_VALUE19253 19254
+#define BSLS_MACROINCREMENTED_VALUE19254 19255
+#define BSLS_MACROINCREMENTED_VALUE19255 19256
+#define BSLS_MACROINCREMENTED_VALUE19256 19257
+#define BSLS_MACROINCREMENTED_VALUE19257 19258
+#define BSLS_MACROINCREMENTED_VALUE19258 19259
+#define BSLS_MACROINCREMENTED_VALUE19259 19260
+#define BSLS_MACROINCREMENTED_VALUE19260 19261
+#define BSLS_MACROINCREMENTED_VALUE19261 19262
+#define BSLS_MACROINCREMENTED_VALUE19262 19263
+#define BSLS_MACROINCREMENTED_VALUE19263 19264
+#define BSLS_MACROINCREMENTED_VALUE19264 19265
+#define BSLS_MACROINCREMENTED_VALUE19265 19266
+#define BSLS_MACROINCREMENTED_VALUE19266 19267
+#define BSLS_MACROINCREMENTED_VALUE19267 19268
+#define BSLS_MACROINCREMENTED_VALUE19268 19269
+#define BSLS_MACROINCREMENTED_VALUE19269 19270
+#define BSLS_MACROINCREMENTED_VALUE19270 19271
+#define BSLS_MACROINCREMENTED_VALUE19271 19272
+#define BSLS_MACROINCREMENTED_VALUE19272 19273
+#define BSLS_MACROINCREMENTED_VALUE19273 19274
+#define BSLS_MACROINCREMENTED_VALUE19274 19275
+#define BSLS_MACROINCREMENTED_VALUE19275 19276
+#define BSLS_MACROINCREMENTED_VALUE19276 19277
+#define BSLS_MACROINCREMENTED_VALUE19277 19278
+#define BSLS_MACROINCREMENTED_VALUE19278 19279
+#define BSLS_MACROINCREMENTED_VALUE19279 19280
+#define BSLS_MACROINCREMENTED_VALUE19280 19281
+#define BSLS_MACROINCREMENTED_VALUE19281 19282
+#define BSLS_MACROINCREMENTED_VALUE19282 19283
+#define BSLS_MACROINCREMENTED_VALUE19283 19284
+#define BSLS_MACROINCREMENTED_VALUE19284 19285
+#define BSLS_MACROINCREMENTED_VALUE19285 19286
+#define BSLS_MACROINCREMENTED_VALUE19286 19287
+#define BSLS_MACROINCREMENTED_VALUE19287 19288
+#define BSLS_MACROINCREMENTED_VALUE19288 19289
+#define BSLS_MACROINCREMENTED_VALUE19289 19290
+#define BSLS_MACROINCREMENTED_VALUE19290 19291
+#define BSLS_MACROINCREMENTED_VALUE19291 19292
+#define BSLS_MACROINCREMENTED_VALUE19292 19293
+#define BSLS_MACROINCREMENTED_VALUE19293 19294
+#define BSLS_MACROINCREMENTED_VALUE19294 19295
+#define BSLS_MACROINCREMENTED_VALUE19295 19296
+#define BSLS_MACROINCREMENTED_VALUE19296 19297
+#define BSLS_MACROINCREMENTED_VALUE19297 19298
+#define BSLS_MACROINCREMENTED_VALUE19298 19299
+#define BSLS_MACROINCREMENTED_VALUE19299 19300
+#define BSLS_MACROINCREMENTED_VALUE19300 19301
+#define BSLS_MACROINCREMENTED_VALUE19301 19302
+#define BSLS_MACROINCREMENTED_VALUE19302 19303
+#define BSLS_MACROINCREMENTED_VALUE19303 19304
+#define BSLS_MACROINCREMENTED_VALUE19304 19305
+#define BSLS_MACROINCREMENTED_VALUE19305 19306
+#define BSLS_MACROINCREMENTED_VALUE19306 19307
+#define BSLS_MACROINCREMENTED_VALUE19307 19308
+#define BSLS_MACROINCREMENTED_VALUE19308 19309
+#define BSLS_MACROINCREMENTED_VALUE19309 19310
+#define BSLS_MACROINCREMENTED_VALUE19310 19311
+#define BSLS_MACROINCREMENTED_VALUE19311 19312
+#define BSLS_MACROINCREMENTED_VALUE19312 19313
+#define BSLS_MACROINCREMENTED_VALUE19313 19314
+#define BSLS_MACROINCREMENTED_VALUE19314 19315
+#define BSLS_MACROINCREMENTED_VALUE19315 19316
+#define BSLS_MACROINCREMENTED_VALUE19316 19317
+#define BSLS_MACROINCREMENTED_VALUE19317 19318
+#define BSLS_MACROINCREMENTED_VALUE19318 19319
+#define BSLS_MACROINCREMENTED_VALUE19319 19320
+#define BSLS_MACROINCREMENTED_VALUE19320 19321
+#define BSLS_MACROINCREMENTED_VALUE19321 19322
+#define BSLS_MACROINCREMENTED_VALUE19322 19323
+#define BSLS_MACROINCREMENTED_VALUE19323 19324
+#define BSLS_MACROINCREMENTED_VALUE19324 19325
+#define BSLS_MACROINCREMENTED_VALUE19325 19326
+#define BSLS_MACROINCREMENTED_VALUE19326 19327
+#define BSLS_MACROINCREMENTED_VALUE19327 19328
+#define BSLS_MACROINCREMENTED_VALUE19328 19329
+#define BSLS_MACROINCREMENTED_VALUE19329 19330
+#define BSLS_MACROINCREMENTED_VALUE19330 19331
+#define BSLS_MACROINCREMENTED_VALUE19331 19332
+#define BSLS_MACROINCREMENTED_VALUE19332 19333
+#define BSLS_MACROINCREMENTED_VALUE19333 19334
+#define BSLS_MACROINCREMENTED_VALUE19334 19335
+#define BSLS_MACROINCREMENTED_VALUE19335 19336
+#define BSLS_MACROINCREMENTED_VALUE19336 19337
+#define BSLS_MACROINCREMENTED_VALUE19337 19338
+#define BSLS_MACROINCREMENTED_VALUE19338 19339
+#define BSLS_MACROINCREMENTED_VALUE19339 19340
+#define BSLS_MACROINCREMENTED_VALUE19340 19341
+#define BSLS_MACROINCREMENTED_VALUE19341 19342
+#define BSLS_MACROINCREMENTED_VALUE19342 19343
+#define BSLS_MACROINCREMENTED_VALUE19343 19344
+#define BSLS_MACROINCREMENTED_VALUE19344 19345
+#define BSLS_MACROINCREMENTED_VALUE19345 19346
+#define BSLS_MACROINCREMENTED_VALUE19346 19347
+#define BSLS_MACROINCREMENTED_VALUE19347 19348
+#define BSLS_MACROINCREMENTED_VALUE19348 19349
+#define BSLS_MACROINCREMENTED_VALUE19349 19350
+#define BSLS_MACROINCREMENTED_VALUE19350 19351
+#define BSLS_MACROINCREMENTED_VALUE19351 19352
+#define BSLS_MACROINCREMENTED_VALUE19352 19353
+#define BSLS_MACROINCREMENTED_VALUE19353 19354
+#define BSLS_MACROINCREMENTED_VALUE19354 19355
+#define BSLS_MACROINCREMENTED_VALUE19355 19356
+#define BSLS_MACROINCREMENTED_VALUE19356 19357
+#define BSLS_MACROINCREMENTED_VALUE19357 19358
+#define BSLS_MACROINCREMENTED_VALUE19358 19359
+#define BSLS_MACROINCREMENTED_VALUE19359 19360
+#define BSLS_MACROINCREMENTED_VALUE19360 19361
+#define BSLS_MACROINCREMENTED_VALUE19361 19362
+#define BSLS_MACROINCREMENTED_VALUE19362 19363
+#define BSLS_MACROINCREMENTED_VALUE19363 19364
+#define BSLS_MACROINCREMENTED_VALUE19364 19365
+#define BSLS_MACROINCREMENTED_VALUE19365 19366
+#define BSLS_MACROINCREMENTED_VALUE19366 19367
+#define BSLS_MACROINCREMENTED_VALUE19367 19368
+#define BSLS_MACROINCREMENTED_VALUE19368 19369
+#define BSLS_MACROINCREMENTED_VALUE19369 19370
+#define BSLS_MACROINCREMENTED_VALUE19370 19371
+#define BSLS_MACROINCREMENTED_VALUE19371 19372
+#define BSLS_MACROINCREMENTED_VALUE19372 19373
+#define BSLS_MACROINCREMENTED_VALUE19373 19374
+#define BSLS_MACROINCREMENTED_VALUE19374 19375
+#define BSLS_MACROINCREMENTED_VALUE19375 19376
+#define BSLS_MACROINCREMENTED_VALUE19376 19377
+#define BSLS_MACROINCREMENTED_VALUE19377 19378
+#define BSLS_MACROINCREMENTED_VALUE19378 19379
+#define BSLS_MACROINCREMENTED_VALUE19379 19380
+#define BSLS_MACROINCREMENTED_VALUE19380 19381
+#define BSLS_MACROINCREMENTED_VALUE19381 19382
+#define BSLS_MACROINCREMENTED_VALUE19382 19383
+#define BSLS_MACROINCREMENTED_VALUE19383 19384
+#define BSLS_MACROINCREMENTED_VALUE19384 19385
+#define BSLS_MACROINCREMENTED_VALUE19385 19386
+#define BSLS_MACROINCREMENTED_VALUE19386 19387
+#define BSLS_MACROINCREMENTED_VALUE19387 19388
+#define BSLS_MACROINCREMENTED_VALUE19388 19389
+#define BSLS_MACROINCREMENTED_VALUE19389 19390
+#define BSLS_MACROINCREMENTED_VALUE19390 19391
+#define BSLS_MACROINCREMENTED_VALUE19391 19392
+#define BSLS_MACROINCREMENTED_VALUE19392 19393
+#define BSLS_MACROINCREMENTED_VALUE19393 19394
+#define BSLS_MACROINCREMENTED_VALUE19394 19395
+#define BSLS_MACROINCREMENTED_VALUE19395 19396
+#define BSLS_MACROINCREMENTED_VALUE19396 19397
+#define BSLS_MACROINCREMENTED_VALUE19397 19398
+#define BSLS_MACROINCREMENTED_VALUE19398 19399
+#define BSLS_MACROINCREMENTED_VALUE19399 19400
+#define BSLS_MACROINCREMENTED_VALUE19400 19401
+#define BSLS_MACROINCREMENTED_VALUE19401 19402
+#define BSLS_MACROINCREMENTED_VALUE19402 19403
+#define BSLS_MACROINCREMENTED_VALUE19403 19404
+#define BSLS_MACROINCREMENTED_VALUE19404 19405
+#define BSLS_MACROINCREMENTED_VALUE19405 19406
+#define BSLS_MACROINCREMENTED_VALUE19406 19407
+#define BSLS_MACROINCREMENTED_VALUE19407 19408
+#define BSLS_MACROINCREMENTED_VALUE19408 19409
+#define BSLS_MACROINCREMENTED_VALUE19409 19410
+#define BSLS_MACROINCREMENTED_VALUE19410 19411
+#define BSLS_MACROINCREMENTED_VALUE19411 19412
+#define BSLS_MACROINCREMENTED_VALUE19412 19413
+#define BSLS_MACROINCREMENTED_VALUE19413 19414
+#define BSLS_MACROINCREMENTED_VALUE19414 19415
+#define BSLS_MACROINCREMENTED_VALUE19415 19416
+#define BSLS_MACROINCREMENTED_VALUE19416 19417
+#define BSLS_MACROINCREMENTED_VALUE19417 19418
+#define BSLS_MACROINCREMENTED_VALUE19418 19419
+#define BSLS_MACROINCREMENTED_VALUE19419 19420
+#define BSLS_MACROINCREMENTED_VALUE19420 19421
+#define BSLS_MACROINCREMENTED_VALUE19421 19422
+#define BSLS_MACROINCREMENTED_VALUE19422 19423
+#define BSLS_MACROINCREMENTED_VALUE19423 19424
+#define BSLS_MACROINCREMENTED_VALUE19424 19425
+#define BSLS_MACROINCREMENTED_VALUE19425 19426
+#define BSLS_MACROINCREMENTED_VALUE19426 19427
+#define BSLS_MACROINCREMENTED_VALUE19427 19428
+#define BSLS_MACROINCREMENTED_VALUE19428 19429
+#define BSLS_MACROINCREMENTED_VALUE19429 19430
+#define BSLS_MACROINCREMENTED_VALUE19430 19431
+#define BSLS_MACROINCREMENTED_VALUE19431 19432
+#define BSLS_MACROINCREMENTED_VALUE19432 19433
+#define BSLS_MACROINCREMENTED_VALUE19433 19434
+#define BSLS_MACROINCREMENTED_VALUE19434 19435
+#define BSLS_MACROINCREMENTED_VALUE19435 19436
+#define BSLS_MACROINCREMENTED_VALUE19436 19437
+#define BSLS_MACROINCREMENTED_VALUE19437 19438
+#define BSLS_MACROINCREMENTED_VALUE19438 19439
+#define BSLS_MACROINCREMENTED_VALUE19439 19440
+#define BSLS_MACROINCREMENTED_VALUE19440 19441
+#define BSLS_MACROINCREMENTED_VALUE19441 19442
+#define BSLS_MACROINCREMENTED_VALUE19442 19443
+#define BSLS_MACROINCREMENTED_VALUE19443 19444
+#define BSLS_MACROINCREMENTED_VALUE19444 19445
+#define BSLS_MACROINCREMENTED_VALUE19445 19446
+#define BSLS_MACROINCREMENTED_VALUE19446 19447
+#define BSLS_MACROINCREMENTED_VALUE19447 19448
+#define BSLS_MACROINCREMENTED_VALUE19448 19449
+#define BSLS_MACROINCREMENTED_VALUE19449 19450
+#define BSLS_MACROINCREMENTED_VALUE19450 19451
+#define BSLS_MACROINCREMENTED_VALUE19451 19452
+#define BSLS_MACROINCREMENTED_VALUE19452 19453
+#define BSLS_MACROINCREMENTED_VALUE19453 19454
+#define BSLS_MACROINCREMENTED_VALUE19454 19455
+#define BSLS_MACROINCREMENTED_VALUE19455 19456
+#define BSLS_MACROINCREMENTED_VALUE19456 19457
+#define BSLS_MACROINCREMENTED_VALUE19457 19458
+#define BSLS_MACROINCREMENTED_VALUE19458 19459
+#define BSLS_MACROINCREMENTED_VALUE19459 19460
+#define BSLS_MACROINCREMENTED_VALUE19460 19461
+#define BSLS_MACROINCREMENTED_VALUE19461 19462
+#define BSLS_MACROINCREMENTED_VALUE19462 19463
+#define BSLS_MACROINCREMENTED_VALUE19463 19464
+#define BSLS_MACROINCREMENTED_VALUE19464 19465
+#define BSLS_MACROINCREMENTED_VALUE19465 19466
+#define BSLS_MACROINCREMENTED_VALUE19466 19467
+#define BSLS_MACROINCREMENTED_VALUE19467 19468
+#define BSLS_MACROINCREMENTED_VALUE19468 19469
+#define BSLS_MACROINCREMENTED_VALUE19469 19470
+#define BSLS_MACROINCREMENTED_VALUE19470 19471
+#define BSLS_MACROINCREMENTED_VALUE19471 19472
+#define BSLS_MACROINCREMENTED_VALUE19472 19473
+#define BSLS_MACROINCREMENTED_VALUE19473 19474
+#define BSLS_MACROINCREMENTED_VALUE19474 19475
+#define BSLS_MACROINCREMENTED_VALUE19475 19476
+#define BSLS_MACROINCREMENTED_VALUE19476 19477
+#define BSLS_MACROINCREMENTED_VALUE19477 19478
+#define BSLS_MACROINCREMENTED_VALUE19478 19479
+#define BSLS_MACROINCREMENTED_VALUE19479 19480
+#define BSLS_MACROINCREMENTED_VALUE19480 19481
+#define BSLS_MACROINCREMENTED_VALUE19481 19482
+#define BSLS_MACROINCREMENTED_VALUE19482 19483
+#define BSLS_MACROINCREMENTED_VALUE19483 19484
+#define BSLS_MACROINCREMENTED_VALUE19484 19485
+#define BSLS_MACROINCREMENTED_VALUE19485 19486
+#define BSLS_MACROINCREMENTED_VALUE19486 19487
+#define BSLS_MACROINCREMENTED_VALUE19487 19488
+#define BSLS_MACROINCREMENTED_VALUE19488 19489
+#define BSLS_MACROINCREMENTED_VALUE19489 19490
+#define BSLS_MACROINCREMENTED_VALUE19490 19491
+#define BSLS_MACROINCREMENTED_VALUE19491 19492
+#define BSLS_MACROINCREMENTED_VALUE19492 19493
+#define BSLS_MACROINCREMENTED_VALUE19493 19494
+#define BSLS_MACROINCREMENTED_VALUE19494 19495
+#define BSLS_MACROINCREMENTED_VALUE19495 19496
+#define BSLS_MACROINCREMENTED_VALUE19496 19497
+#define BSLS_MACROINCREMENTED_VALUE19497 19498
+#define BSLS_MACROINCREMENTED_VALUE19498 19499
+#define BSLS_MACROINCREMENTED_VALUE19499 19500
+#define BSLS_MACROINCREMENTED_VALUE19500 19501
+#define BSLS_MACROINCREMENTED_VALUE19501 19502
+#define BSLS_MACROINCREMENTED_VALUE19502 19503
+#define BSLS_MACROINCREMENTED_VALUE19503 19504
+#define BSLS_MACROINCREMENTED_VALUE19504 19505
+#define BSLS_MACROINCREMENTED_VALUE19505 19506
+#define BSLS_MACROINCREMENTED_VALUE19506 19507
+#define BSLS_MACROINCREMENTED_VALUE19507 19508
+#define BSLS_MACROINCREMENTED_VALUE19508 19509
+#define BSLS_MACROINCREMENTED_VALUE19509 19510
+#define BSLS_MACROINCREMENTED_VALUE19510 19511
+#define BSLS_MACROINCREMENTED_VALUE19511 19512
+#define BSLS_MACROINCREMENTED_VALUE19512 19513
+#define BSLS_MACROINCREMENTED_VALUE19513 19514
+#define BSLS_MACROINCREMENTED_VALUE19514 19515
+#define BSLS_MACROINCREMENTED_VALUE19515 19516
+#define BSLS_MACROINCREMENTED_VALUE19516 19517
+#define BSLS_MACROINCREMENTED_VALUE19517 19518
+#define BSLS_MACROINCREMENTED_VALUE19518 19519
+#define BSLS_MACROINCREMENTED_VALUE19519 19520
+#define BSLS_MACROINCREMENTED_VALUE19520 19521
+#define BSLS_MACROINCREMENTED_VALUE19521 19522
+#define BSLS_MACROINCREMENTED_VALUE19522 19523
+#define BSLS_MACROINCREMENTED_VALUE19523 19524
+#define BSLS_MACROINCREMENTED_VALUE19524 19525
+#define BSLS_MACROINCREMENTED_VALUE19525 19526
+#define BSLS_MACROINCREMENTED_VALUE19526 19527
+#define BSLS_MACROINCREMENTED_VALUE19527 19528
+#define BSLS_MACROINCREMENTED_VALUE19528 19529
+#define BSLS_MACROINCREMENTED_VALUE19529 19530
+#define BSLS_MACROINCREMENTED_VALUE19530 19531
+#define BSLS_MACROINCREMENTED_VALUE19531 19532
+#define BSLS_MACROINCREMENTED_VALUE19532 19533
+#define BSLS_MACROINCREMENTED_VALUE19533 19534
+#define BSLS_MACROINCREMENTED_VALUE19534 19535
+#define BSLS_MACROINCREMENTED_VALUE19535 19536
+#define BSLS_MACROINCREMENTED_VALUE19536 19537
+#define BSLS_MACROINCREMENTED_VALUE19537 19538
+#define BSLS_MACROINCREMENTED_VALUE19538 19539
+#define BSLS_MACROINCREMENTED_VALUE19539 19540
+#define BSLS_MACROINCREMENTED_VALUE19540 19541
+#define BSLS_MACROINCREMENTED_VALUE19541 19542
+#define BSLS_MACROINCREMENTED_VALUE19542 19543
+#define BSLS_MACROINCREMENTED_VALUE19543 19544
+#define BSLS_MACROINCREMENTED_VALUE19544 19545
+#define BSLS_MACROINCREMENTED_VALUE19545 19546
+#define BSLS_MACROINCREMENTED_VALUE19546 19547
+#define BSLS_MACROINCREMENTED_VALUE19547 19548
+#define BSLS_MACROINCREMENTED_VALUE19548 19549
+#define BSLS_MACROINCREMENTED_VALUE19549 19550
+#define BSLS_MACROINCREMENTED_VALUE19550 19551
+#define BSLS_MACROINCREMENTED_VALUE19551 19552
+#define BSLS_MACROINCREMENTED_VALUE19552 19553
+#define BSLS_MACROINCREMENTED_VALUE19553 19554
+#define BSLS_MACROINCREMENTED_VALUE19554 19555
+#define BSLS_MACROINCREMENTED_VALUE19555 19556
+#define BSLS_MACROINCREMENTED_VALUE19556 19557
+#define BSLS_MACROINCREMENTED_VALUE19557 19558
+#define BSLS_MACROINCREMENTED_VALUE19558 19559
+#define BSLS_MACROINCREMENTED_VALUE19559 19560
+#define BSLS_MACROINCREMENTED_VALUE19560 19561
+#define BSLS_MACROINCREMENTED_VALUE19561 19562
+#define BSLS_MACROINCREMENTED_VALUE19562 19563
+#define BSLS_MACROINCREMENTED_VALUE19563 19564
+#define BSLS_MACROINCREMENTED_VALUE19564 19565
+#define BSLS_MACROINCREMENTED_VALUE19565 19566
+#define BSLS_MACROINCREMENTED_VALUE19566 19567
+#define BSLS_MACROINCREMENTED_VALUE19567 19568
+#define BSLS_MACROINCREMENTED_VALUE19568 19569
+#define BSLS_MACROINCREMENTED_VALUE19569 19570
+#define BSLS_MACROINCREMENTED_VALUE19570 19571
+#define BSLS_MACROINCREMENTED_VALUE19571 19572
+#define BSLS_MACROINCREMENTED_VALUE19572 19573
+#define BSLS_MACROINCREMENTED_VALUE19573 19574
+#define BSLS_MACROINCREMENTED_VALUE19574 19575
+#define BSLS_MACROINCREMENTED_VALUE19575 19576
+#define BSLS_MACROINCREMENTED_VALUE19576 19577
+#define BSLS_MACROINCREMENTED_VALUE19577 19578
+#define BSLS_MACROINCREMENTED_VALUE19578 19579
+#define BSLS_MACROINCREMENTED_VALUE19579 19580
+#define BSLS_MACROINCREMENTED_VALUE19580 19581
+#define BSLS_MACROINCREMENTED_VALUE19581 19582
+#define BSLS_MACROINCREMENTED_VALUE19582 19583
+#define BSLS_MACROINCREMENTED_VALUE19583 19584
+#define BSLS_MACROINCREMENTED_VALUE19584 19585
+#define BSLS_MACROINCREMENTED_VALUE19585 19586
+#define BSLS_MACROINCREMENTED_VALUE19586 19587
+#define BSLS_MACROINCREMENTED_VALUE19587 19588
+#define BSLS_MACROINCREMENTED_VALUE19588 19589
+#define BSLS_MACROINCREMENTED_VALUE19589 19590
+#define BSLS_MACROINCREMENTED_VALUE19590 19591
+#define BSLS_MACROINCREMENTED_VALUE19591 19592
+#define BSLS_MACROINCREMENTED_VALUE19592 19593
+#define BSLS_MACROINCREMENTED_VALUE19593 19594
+#define BSLS_MACROINCREMENTED_VALUE19594 19595
+#define BSLS_MACROINCREMENTED_VALUE19595 19596
+#define BSLS_MACROINCREMENTED_VALUE19596 19597
+#define BSLS_MACROINCREMENTED_VALUE19597 19598
+#define BSLS_MACROINCREMENTED_VALUE19598 19599
+#define BSLS_MACROINCREMENTED_VALUE19599 19600
+#define BSLS_MACROINCREMENTED_VALUE19600 19601
+#define BSLS_MACROINCREMENTED_VALUE19601 19602
+#define BSLS_MACROINCREMENTED_VALUE19602 19603
+#define BSLS_MACROINCREMENTED_VALUE19603 19604
+#define BSLS_MACROINCREMENTED_VALUE19604 19605
+#define BSLS_MACROINCREMENTED_VALUE19605 19606
+#define BSLS_MACROINCREMENTED_VALUE19606 19607
+#define BSLS_MACROINCREMENTED_VALUE19607 19608
+#define BSLS_MACROINCREMENTED_VALUE19608 19609
+#define BSLS_MACROINCREMENTED_VALUE19609 19610
+#define BSLS_MACROINCREMENTED_VALUE19610 19611
+#define BSLS_MACROINCREMENTED_VALUE19611 19612
+#define BSLS_MACROINCREMENTED_VALUE19612 19613
+#define BSLS_MACROINCREMENTED_VALUE19613 19614
+#define BSLS_MACROINCREMENTED_VALUE19614 19615
+#define BSLS_MACROINCREMENTED_VALUE19615 19616
+#define BSLS_MACROINCREMENTED_VALUE19616 19617
+#define BSLS_MACROINCREMENTED_VALUE19617 19618
+#define BSLS_MACROINCREMENTED_VALUE19618 19619
+#define BSLS_MACROINCREMENTED_VALUE19619 19620
+#define BSLS_MACROINCREMENTED_VALUE19620 19621
+#define BSLS_MACROINCREMENTED_VALUE19621 19622
+#define BSLS_MACROINCREMENTED_VALUE19622 19623
+#define BSLS_MACROINCREMENTED_VALUE19623 19624
+#define BSLS_MACROINCREMENTED_VALUE19624 19625
+#define BSLS_MACROINCREMENTED_VALUE19625 19626
+#define BSLS_MACROINCREMENTED_VALUE19626 19627
+#define BSLS_MACROINCREMENTED_VALUE19627 19628
+#define BSLS_MACROINCREMENTED_VALUE19628 19629
+#define BSLS_MACROINCREMENTED_VALUE19629 19630
+#define BSLS_MACROINCREMENTED_VALUE19630 19631
+#define BSLS_MACROINCREMENTED_VALUE19631 19632
+#define BSLS_MACROINCREMENTED_VALUE19632 19633
+#define BSLS_MACROINCREMENTED_VALUE19633 19634
+#define BSLS_MACROINCREMENTED_VALUE19634 19635
+#define BSLS_MACROINCREMENTED_VALUE19635 19636
+#define BSLS_MACROINCREMENTED_VALUE19636 19637
+#define BSLS_MACROINCREMENTED_VALUE19637 19638
+#define BSLS_MACROINCREMENTED_VALUE19638 19639
+#define BSLS_MACROINCREMENTED_VALUE19639 19640
+#define BSLS_MACROINCREMENTED_VALUE19640 19641
+#define BSLS_MACROINCREMENTED_VALUE19641 19642
+#define BSLS_MACROINCREMENTED_VALUE19642 19643
+#define BSLS_MACROINCREMENTED_VALUE19643 19644
+#define BSLS_MACROINCREMENTED_VALUE19644 19645
+#define BSLS_MACROINCREMENTED_VALUE19645 19646
+#define BSLS_MACROINCREMENTED_VALUE19646 19647
+#define BSLS_MACROINCREMENTED_VALUE19647 19648
+#define BSLS_MACROINCREMENTED_VALUE19648 19649
+#define BSLS_MACROINCREMENTED_VALUE19649 19650
+#define BSLS_MACROINCREMENTED_VALUE19650 19651
+#define BSLS_MACROINCREMENTED_VALUE19651 19652
+#define BSLS_MACROINCREMENTED_VALUE19652 19653
+#define BSLS_MACROINCREMENTED_VALUE19653 19654
+#define BSLS_MACROINCREMENTED_VALUE19654 19655
+#define BSLS_MACROINCREMENTED_VALUE19655 19656
+#define BSLS_MACROINCREMENTED_VALUE19656 19657
+#define BSLS_MACROINCREMENTED_VALUE19657 19658
+#define BSLS_MACROINCREMENTED_VALUE19658 19659
+#define BSLS_MACROINCREMENTED_VALUE19659 19660
+#define BSLS_MACROINCREMENTED_VALUE19660 19661
+#define BSLS_MACROINCREMENTED_VALUE19661 19662
+#define BSLS_MACROINCREMENTED_VALUE19662 19663
+#define BSLS_MACROINCREMENTED_VALUE19663 19664
+#define BSLS_MACROINCREMENTED_VALUE19664 19665
+#define BSLS_MACROINCREMENTED_VALUE19665 19666
+#define BSLS_MACROINCREMENTED_VALUE19666 19667
+#define BSLS_MACROINCREMENTED_VALUE19667 19668
+#define BSLS_MACROINCREMENTED_VALUE19668 19669
+#define BSLS_MACROINCREMENTED_VALUE19669 19670
+#define BSLS_MACROINCREMENTED_VALUE19670 19671
+#define BSLS_MACROINCREMENTED_VALUE19671 19672
+#define BSLS_MACROINCREMENTED_VALUE19672 19673
+#define BSLS_MACROINCREMENTED_VALUE19673 19674
+#define BSLS_MACROINCREMENTED_VALUE19674 19675
+#define BSLS_MACROINCREMENTED_VALUE19675 19676
+#define BSLS_MACROINCREMENTED_VALUE19676 19677
+#define BSLS_MACROINCREMENTED_VALUE19677 19678
+#define BSLS_MACROINCREMENTED_VALUE19678 19679
+#define BSLS_MACROINCREMENTED_VALUE19679 19680
+#define BSLS_MACROINCREMENTED_VALUE19680 19681
+#define BSLS_MACROINCREMENTED_VALUE19681 19682
+#define BSLS_MACROINCREMENTED_VALUE19682 19683
+#define BSLS_MACROINCREMENTED_VALUE19683 19684
+#define BSLS_MACROINCREMENTED_VALUE19684 19685
+#define BSLS_MACROINCREMENTED_VALUE19685 19686
+#define BSLS_MACROINCREMENTED_VALUE19686 19687
+#define BSLS_MACROINCREMENTED_VALUE19687 19688
+#define BSLS_MACROINCREMENTED_VALUE19688 19689
+#define BSLS_MACROINCREMENTED_VALUE19689 19690
+#define BSLS_MACROINCREMENTED_VALUE19690 19691
+#define BSLS_MACROINCREMENTED_VALUE19691 19692
+#define BSLS_MACROINCREMENTED_VALUE19692 19693
+#define BSLS_MACROINCREMENTED_VALUE19693 19694
+#define BSLS_MACROINCREMENTED_VALUE19694 19695
+#define BSLS_MACROINCREMENTED_VALUE19695 19696
+#define BSLS_MACROINCREMENTED_VALUE19696 19697
+#define BSLS_MACROINCREMENTED_VALUE19697 19698
+#define BSLS_MACROINCREMENTED_VALUE19698 19699
+#define BSLS_MACROINCREMENTED_VALUE19699 19700
+#define BSLS_MACROINCREMENTED_VALUE19700 19701
+#define BSLS_MACROINCREMENTED_VALUE19701 19702
+#define BSLS_MACROINCREMENTED_VALUE19702 19703
+#define BSLS_MACROINCREMENTED_VALUE19703 19704
+#define BSLS_MACROINCREMENTED_VALUE19704 19705
+#define BSLS_MACROINCREMENTED_VALUE19705 19706
+#define BSLS_MACROINCREMENTED_VALUE19706 19707
+#define BSLS_MACROINCREMENTED_VALUE19707 19708
+#define BSLS_MACROINCREMENTED_VALUE19708 19709
+#define BSLS_MACROINCREMENTED_VALUE19709 19710
+#define BSLS_MACROINCREMENTED_VALUE19710 19711
+#define BSLS_MACROINCREMENTED_VALUE19711 19712
+#define BSLS_MACROINCREMENTED_VALUE19712 19713
+#define BSLS_MACROINCREMENTED_VALUE19713 19714
+#define BSLS_MACROINCREMENTED_VALUE19714 19715
+#define BSLS_MACROINCREMENTED_VALUE19715 19716
+#define BSLS_MACROINCREMENTED_VALUE19716 19717
+#define BSLS_MACROINCREMENTED_VALUE19717 19718
+#define BSLS_MACROINCREMENTED_VALUE19718 19719
+#define BSLS_MACROINCREMENTED_VALUE19719 19720
+#define BSLS_MACROINCREMENTED_VALUE19720 19721
+#define BSLS_MACROINCREMENTED_VALUE19721 19722
+#define BSLS_MACROINCREMENTED_VALUE19722 19723
+#define BSLS_MACROINCREMENTED_VALUE19723 19724
+#define BSLS_MACROINCREMENTED_VALUE19724 19725
+#define BSLS_MACROINCREMENTED_VALUE19725 19726
+#define BSLS_MACROINCREMENTED_VALUE19726 19727
+#define BSLS_MACROINCREMENTED_VALUE19727 19728
+#define BSLS_MACROINCREMENTED_VALUE19728 19729
+#define BSLS_MACROINCREMENTED_VALUE19729 19730
+#define BSLS_MACROINCREMENTED_VALUE19730 19731
+#define BSLS_MACROINCREMENTED_VALUE19731 19732
+#define BSLS_MACROINCREMENTED_VALUE19732 19733
+#define BSLS_MACROINCREMENTED_VALUE19733 19734
+#define BSLS_MACROINCREMENTED_VALUE19734 19735
+#define BSLS_MACROINCREMENTED_VALUE19735 19736
+#define BSLS_MACROINCREMENTED_VALUE19736 19737
+#define BSLS_MACROINCREMENTED_VALUE19737 19738
+#define BSLS_MACROINCREMENTED_VALUE19738 19739
+#define BSLS_MACROINCREMENTED_VALUE19739 19740
+#define BSLS_MACROINCREMENTED_VALUE19740 19741
+#define BSLS_MACROINCREMENTED_VALUE19741 19742
+#define BSLS_MACROINCREMENTED_VALUE19742 19743
+#define BSLS_MACROINCREMENTED_VALUE19743 19744
+#define BSLS_MACROINCREMENTED_VALUE19744 19745
+#define BSLS_MACROINCREMENTED_VALUE19745 19746
+#define BSLS_MACROINCREMENTED_VALUE19746 19747
+#define BSLS_MACROINCREMENTED_VALUE19747 19748
+#define BSLS_MACROINCREMENTED_VALUE19748 19749
+#define BSLS_MACROINCREMENTED_VALUE19749 19750
+#define BSLS_MACROINCREMENTED_VALUE19750 19751
+#define BSLS_MACROINCREMENTED_VALUE19751 19752
+#define BSLS_MACROINCREMENTED_VALUE19752 19753
+#define BSLS_MACROINCREMENTED_VALUE19753 19754
+#define BSLS_MACROINCREMENTED_VALUE19754 19755
+#define BSLS_MACROINCREMENTED_VALUE19755 19756
+#define BSLS_MACROINCREMENTED_VALUE19756 19757
+#define BSLS_MACROINCREMENTED_VALUE19757 19758
+#define BSLS_MACROINCREMENTED_VALUE19758 19759
+#define BSLS_MACROINCREMENTED_VALUE19759 19760
+#define BSLS_MACROINCREMENTED_VALUE19760 19761
+#define BSLS_MACROINCREMENTED_VALUE19761 19762
+#define BSLS_MACROINCREMENTED_VALUE19762 19763
+#define BSLS_MACROINCREMENTED_VALUE19763 19764
+#define BSLS_MACROINCREMENTED_VALUE19764 19765
+#define BSLS_MACROINCREMENTED_VALUE19765 19766
+#define BSLS_MACROINCREMENTED_VALUE19766 19767
+#define BSLS_MACROINCREMENTED_VALUE19767 19768
+#define BSLS_MACROINCREMENTED_VALUE19768 19769
+#define BSLS_MACROINCREMENTED_VALUE19769 19770
+#define BSLS_MACROINCREMENTED_VALUE19770 19771
+#define BSLS_MACROINCREMENTED_VALUE19771 19772
+#define BSLS_MACROINCREMENTED_VALUE19772 19773
+#define BSLS_MACROINCREMENTED_VALUE19773 19774
+#define BSLS_MACROINCREMENTED_VALUE19774 19775
+#define BSLS_MACROINCREMENTED_VALUE19775 19776
+#define BSLS_MACROINCREMENTED_VALUE19776 19777
+#define BSLS_MACROINCREMENTED_VALUE19777 19778
+#define BSLS_MACROINCREMENTED_VALUE19778 19779
+#define BSLS_MACROINCREMENTED_VALUE19779 19780
+#define BSLS_MACROINCREMENTED_VALUE19780 19781
+#define BSLS_MACROINCREMENTED_VALUE19781 19782
+#define BSLS_MACROINCREMENTED_VALUE19782 19783
+#define BSLS_MACROINCREMENTED_VALUE19783 19784
+#define BSLS_MACROINCREMENTED_VALUE19784 19785
+#define BSLS_MACROINCREMENTED_VALUE19785 19786
+#define BSLS_MACROINCREMENTED_VALUE19786 19787
+#define BSLS_MACROINCREMENTED_VALUE19787 19788
+#define BSLS_MACROINCREMENTED_VALUE19788 19789
+#define BSLS_MACROINCREMENTED_VALUE19789 19790
+#define BSLS_MACROINCREMENTED_VALUE19790 19791
+#define BSLS_MACROINCREMENTED_VALUE19791 19792
+#define BSLS_MACROINCREMENTED_VALUE19792 19793
+#define BSLS_MACROINCREMENTED_VALUE19793 19794
+#define BSLS_MACROINCREMENTED_VALUE19794 19795
+#define BSLS_MACROINCREMENTED_VALUE19795 19796
+#define BSLS_MACROINCREMENTED_VALUE19796 19797
+#define BSLS_MACROINCREMENTED_VALUE19797 19798
+#define BSLS_MACROINCREMENTED_VALUE19798 19799
+#define BSLS_MACROINCREMENTED_VALUE19799 19800
+#define BSLS_MACROINCREMENTED_VALUE19800 19801
+#define BSLS_MACROINCREMENTED_VALUE19801 19802
+#define BSLS_MACROINCREMENTED_VALUE19802 19803
+#define BSLS_MACROINCREMENTED_VALUE19803 19804
+#define BSLS_MACROINCREMENTED_VALUE19804 19805
+#define BSLS_MACROINCREMENTED_VALUE19805 19806
+#define BSLS_MACROINCREMENTED_VALUE19806 19807
+#define BSLS_MACROINCREMENTED_VALUE19807 19808
+#define BSLS_MACROINCREMENTED_VALUE19808 19809
+#define BSLS_MACROINCREMENTED_VALUE19809 19810
+#define BSLS_MACROINCREMENTED_VALUE19810 19811
+#define BSLS_MACROINCREMENTED_VALUE19811 19812
+#define BSLS_MACROINCREMENTED_VALUE19812 19813
+#define BSLS_MACROINCREMENTED_VALUE19813 19814
+#define BSLS_MACROINCREMENTED_VALUE19814 19815
+#define BSLS_MACROINCREMENTED_VALUE19815 19816
+#define BSLS_MACROINCREMENTED_VALUE19816 19817
+#define BSLS_MACROINCREMENTED_VALUE19817 19818
+#define BSLS_MACROINCREMENTED_VALUE19818 19819
+#define BSLS_MACROINCREMENTED_VALUE19819 19820
+#define BSLS_MACROINCREMENTED_VALUE19820 19821
+#define BSLS_MACROINCREMENTED_VALUE19821 19822
+#define BSLS_MACROINCREMENTED_VALUE19822 19823
+#define BSLS_MACROINCREMENTED_VALUE19823 19824
+#define BSLS_MACROINCREMENTED_VALUE19824 19825
+#define BSLS_MACROINCREMENTED_VALUE19825 19826
+#define BSLS_MACROINCREMENTED_VALUE19826 19827
+#define BSLS_MACROINCREMENTED_VALUE19827 19828
+#define BSLS_MACROINCREMENTED_VALUE19828 19829
+#define BSLS_MACROINCREMENTED_VALUE19829 19830
+#define BSLS_MACROINCREMENTED_VALUE19830 19831
+#define BSLS_MACROINCREMENTED_VALUE19831 19832
+#define BSLS_MACROINCREMENTED_VALUE19832 19833
+#define BSLS_MACROINCREMENTED_VALUE19833 19834
+#define BSLS_MACROINCREMENTED_VALUE19834 19835
+#define BSLS_MACROINCREMENTED_VALUE19835 19836
+#define BSLS_MACROINCREMENTED_VALUE19836 19837
+#define BSLS_MACROINCREMENTED_VALUE19837 19838
+#define BSLS_MACROINCREMENTED_VALUE19838 19839
+#define BSLS_MACROINCREMENTED_VALUE19839 19840
+#define BSLS_MACROINCREMENTED_VALUE19840 19841
+#define BSLS_MACROINCREMENTED_VALUE19841 19842
+#define BSLS_MACROINCREMENTED_VALUE19842 19843
+#define BSLS_MACROINCREMENTED_VALUE19843 19844
+#define BSLS_MACROINCREMENTED_VALUE19844 19845
+#define BSLS_MACROINCREMENTED_VALUE19845 19846
+#define BSLS_MACROINCREMENTED_VALUE19846 19847
+#define BSLS_MACROINCREMENTED_VALUE19847 19848
+#define BSLS_MACROINCREMENTED_VALUE19848 19849
+#define BSLS_MACROINCREMENTED_VALUE19849 19850
+#define BSLS_MACROINCREMENTED_VALUE19850 19851
+#define BSLS_MACROINCREMENTED_VALUE19851 19852
+#define BSLS_MACROINCREMENTED_VALUE19852 19853
+#define BSLS_MACROINCREMENTED_VALUE19853 19854
+#define BSLS_MACROINCREMENTED_VALUE19854 19855
+#define BSLS_MACROINCREMENTED_VALUE19855 19856
+#define BSLS_MACROINCREMENTED_VALUE19856 19857
+#define BSLS_MACROINCREMENTED_VALUE19857 19858
+#define BSLS_MACROINCREMENTED_VALUE19858 19859
+#define BSLS_MACROINCREMENTED_VALUE19859 19860
+#define BSLS_MACROINCREMENTED_VALUE19860 19861
+#define BSLS_MACROINCREMENTED_VALUE19861 19862
+#define BSLS_MACROINCREMENTED_VALUE19862 19863
+#define BSLS_MACROINCREMENTED_VALUE19863 19864
+#define BSLS_MACROINCREMENTED_VALUE19864 19865
+#define BSLS_MACROINCREMENTED_VALUE19865 19866
+#define BSLS_MACROINCREMENTED_VALUE19866 19867
+#define BSLS_MACROINCREMENTED_VALUE19867 19868
+#define BSLS_MACROINCREMENTED_VALUE19868 19869
+#define BSLS_MACROINCREMENTED_VALUE19869 19870
+#define BSLS_MACROINCREMENTED_VALUE19870 19871
+#define BSLS_MACROINCREMENTED_VALUE19871 19872
+#define BSLS_MACROINCREMENTED_VALUE19872 19873
+#define BSLS_MACROINCREMENTED_VALUE19873 19874
+#define BSLS_MACROINCREMENTED_VALUE19874 19875
+#define BSLS_MACROINCREMENTED_VALUE19875 19876
+#define BSLS_MACROINCREMENTED_VALUE19876 19877
+#define BSLS_MACROINCREMENTED_VALUE19877 19878
+#define BSLS_MACROINCREMENTED_VALUE19878 19879
+#define BSLS_MACROINCREMENTED_VALUE19879 19880
+#define BSLS_MACROINCREMENTED_VALUE19880 19881
+#define BSLS_MACROINCREMENTED_VALUE19881 19882
+#define BSLS_MACROINCREMENTED_VALUE19882 19883
+#define BSLS_MACROINCREMENTED_VALUE19883 19884
+#define BSLS_MACROINCREMENTED_VALUE19884 19885
+#define BSLS_MACROINCREMENTED_VALUE19885 19886
+#define BSLS_MACROINCREMENTED_VALUE19886 19887
+#define BSLS_MACROINCREMENTED_VALUE19887 19888
+#define BSLS_MACROINCREMENTED_VALUE19888 19889
+#define BSLS_MACROINCREMENTED_VALUE19889 19890
+#define BSLS_MACROINCREMENTED_VALUE19890 19891
+#define BSLS_MACROINCREMENTED_VALUE19891 19892
+#define BSLS_MACROINCREMENTED_VALUE19892 19893
+#define BSLS_MACROINCREMENTED_VALUE19893 19894
+#define BSLS_MACROINCREMENTED_VALUE19894 19895
+#define BSLS_MACROINCREMENTED_VALUE19895 19896
+#define BSLS_MACROINCREMENTED_VALUE19896 19897
+#define BSLS_MACROINCREMENTED_VALUE19897 19898
+#define BSLS_MACROINCREMENTED_VALUE19898 19899
+#define BSLS_MACROINCREMENTED_VALUE19899 19900
+#define BSLS_MACROINCREMENTED_VALUE19900 19901
+#define BSLS_MACROINCREMENTED_VALUE19901 19902
+#define BSLS_MACROINCREMENTED_VALUE19902 19903
+#define BSLS_MACROINCREMENTED_VALUE19903 19904
+#define BSLS_MACROINCREMENTED_VALUE19904 19905
+#define BSLS_MACROINCREMENTED_VALUE19905 19906
+#define BSLS_MACROINCREMENTED_VALUE19906 19907
+#define BSLS_MACROINCREMENTED_VALUE19907 19908
+#define BSLS_MACROINCREMENTED_VALUE19908 19909
+#define BSLS_MACROINCREMENTED_VALUE19909 19910
+#define BSLS_MACROINCREMENTED_VALUE19910 19911
+#define BSLS_MACROINCREMENTED_VALUE19911 19912
+#define BSLS_MACROINCREMENTED_VALUE19912 19913
+#define BSLS_MACROINCREMENTED_VALUE19913 19914
+#define BSLS_MACROINCREMENTED_VALUE19914 19915
+#define BSLS_MACROINCREMENTED_VALUE19915 19916
+#define BSLS_MACROINCREMENTED_VALUE19916 19917
+#define BSLS_MACROINCREMENTED_VALUE19917 19918
+#define BSLS_MACROINCREMENTED_VALUE19918 19919
+#define BSLS_MACROINCREMENTED_VALUE19919 19920
+#define BSLS_MACROINCREMENTED_VALUE19920 19921
+#define BSLS_MACROINCREMENTED_VALUE19921 19922
+#define BSLS_MACROINCREMENTED_VALUE19922 19923
+#define BSLS_MACROINCREMENTED_VALUE19923 19924
+#define BSLS_MACROINCREMENTED_VALUE19924 19925
+#define BSLS_MACROINCREMENTED_VALUE19925 19926
+#define BSLS_MACROINCREMENTED_VALUE19926 19927
+#define BSLS_MACROINCREMENTED_VALUE19927 19928
+#define BSLS_MACROINCREMENTED_VALUE19928 19929
+#define BSLS_MACROINCREMENTED_VALUE19929 19930
+#define BSLS_MACROINCREMENTED_VALUE19930 19931
+#define BSLS_MACROINCREMENTED_VALUE19931 19932
+#define BSLS_MACROINCREMENTED_VALUE19932 19933
+#define BSLS_MACROINCREMENTED_VALUE19933 19934
+#define BSLS_MACROINCREMENTED_VALUE19934 19935
+#define BSLS_MACROINCREMENTED_VALUE19935 19936
+#define BSLS_MACROINCREMENTED_VALUE19936 19937
+#define BSLS_MACROINCREMENTED_VALUE19937 19938
+#define BSLS_MACROINCREMENTED_VALUE19938 19939
+#define BSLS_MACROINCREMENTED_VALUE19939 19940
+#define BSLS_MACROINCREMENTED_VALUE19940 19941
+#define BSLS_MACROINCREMENTED_VALUE19941 19942
+#define BSLS_MACROINCREMENTED_VALUE19942 19943
+#define BSLS_MACROINCREMENTED_VALUE19943 19944
+#define BSLS_MACROINCREMENTED_VALUE19944 19945
+#define BSLS_MACROINCREMENTED_VALUE19945 19946
+#define BSLS_MACROINCREMENTED_VALUE19946 19947
+#define BSLS_MACROINCREMENTED_VALUE19947 19948
+#define BSLS_MACROINCREMENTED_VALUE19948 19949
+#define BSLS_MACROINCREMENTED_VALUE19949 19950
+#define BSLS_MACROINCREMENTED_VALUE19950 19951
+#define BSLS_MACROINCREMENTED_VALUE19951 19952
+#define BSLS_MACROINCREMENTED_VALUE19952 19953
+#define BSLS_MACROINCREMENTED_VALUE19953 19954
+#define BSLS_MACROINCREMENTED_VALUE19954 19955
+#define BSLS_MACROINCREMENTED_VALUE19955 19956
+#define BSLS_MACROINCREMENTED_VALUE19956 19957
+#define BSLS_MACROINCREMENTED_VALUE19957 19958
+#define BSLS_MACROINCREMENTED_VALUE19958 19959
+#define BSLS_MACROINCREMENTED_VALUE19959 19960
+#define BSLS_MACROINCREMENTED_VALUE19960 19961
+#define BSLS_MACROINCREMENTED_VALUE19961 19962
+#define BSLS_MACROINCREMENTED_VALUE19962 19963
+#define BSLS_MACROINCREMENTED_VALUE19963 19964
+#define BSLS_MACROINCREMENTED_VALUE19964 19965
+#define BSLS_MACROINCREMENTED_VALUE19965 19966
+#define BSLS_MACROINCREMENTED_VALUE19966 19967
+#define BSLS_MACROINCREMENTED_VALUE19967 19968
+#define BSLS_MACROINCREMENTED_VALUE19968 19969
+#define BSLS_MACROINCREMENTED_VALUE19969 19970
+#define BSLS_MACROINCREMENTED_VALUE19970 19971
+#define BSLS_MACROINCREMENTED_VALUE19971 19972
+#define BSLS_MACROINCREMENTED_VALUE19972 19973
+#define BSLS_MACROINCREMENTED_VALUE19973 19974
+#define BSLS_MACROINCREMENTED_VALUE19974 19975
+#define BSLS_MACROINCREMENTED_VALUE19975 19976
+#define BSLS_MACROINCREMENTED_VALUE19976 19977
+#define BSLS_MACROINCREMENTED_VALUE19977 19978
+#define BSLS_MACROINCREMENTED_VALUE19978 19979
+#define BSLS_MACROINCREMENTED_VALUE19979 19980
+#define BSLS_MACROINCREMENTED_VALUE19980 19981
+#define BSLS_MACROINCREMENTED_VALUE19981 19982
+#define BSLS_MACROINCREMENTED_VALUE19982 19983
+#define BSLS_MACROINCREMENTED_VALUE19983 19984
+#define BSLS_MACROINCREMENTED_VALUE19984 19985
+#define BSLS_MACROINCREMENTED_VALUE19985 19986
+#define BSLS_MACROINCREMENTED_VALUE19986 19987
+#define BSLS_MACROINCREMENTED_VALUE19987 19988
+#define BSLS_MACROINCREMENTED_VALUE19988 19989
+#define BSLS_MACROINCREMENTED_VALUE19989 19990
+#define BSLS_MACROINCREMENTED_VALUE19990 19991
+#define BSLS_MACROINCREMENTED_VALUE19991 19992
+#define BSLS_MACROINCREMENTED_VALUE19992 19993
+#define BSLS_MACROINCREMENTED_VALUE19993 19994
+#define BSLS_MACROINCREMENTED_VALUE19994 19995
+#define BSLS_MACROINCREMENTED_VALUE19995 19996
+#define BSLS_MACROINCREMENTED_VALUE19996 19997
+#define BSLS_MACROINCREMENTED_VALUE19997 19998
+#define BSLS_MACROINCREMENTED_VALUE19998 19999
+#define BSLS_MACROINCREMENTED_VALUE19999 20000
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
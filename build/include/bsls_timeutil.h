@@ -0,0 +1,517 @@
+// bsls_timeutil.h                                                    -*-C++-*-
+#ifndef INCLUDED_BSLS_TIMEUTIL
+#define INCLUDED_BSLS_TIMEUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a platform-neutral functional interface to system clocks.
+//
+//@CLASSES:
+//  bsls::TimeUtil: namespace for platform-neutral system-time pure procedures
+//
+//@SEE_ALSO: bsls_stopwatch
+//
+//@DESCRIPTION: This component provides a set of platform-neutral pure
+// procedures to access real-time system clock functionality.  High-resolution
+// time functions intended for interval-timing return a time interval in
+// nanoseconds (1 nsec = 1E-9 sec) as a 64-bit integer.
+//
+///Cycle Timer
+///-----------
+// In addition to the system timer, 'bsls::TimeUtil' provides an opt-in
+// *cycle* *timer*, accessed through 'getCycleTimerRaw' and 'getCycleTimer',
+// that is intended for stamping events at very high rates (e.g., millions of
+// messages per second), where the cost of a call to the system clock would
+// dominate.  On x86 and x86-64 processors that provide an *invariant*
+// time-stamp counter (TSC) -- i.e., a counter that ticks at a constant rate
+// regardless of frequency scaling and power states, as reported by 'cpuid' --
+// a raw cycle-timer value is simply the value of the TSC, which can be read in
+// a handful of nanoseconds without entering the kernel.  On all other
+// platforms, and on processors lacking an invariant TSC, the cycle timer falls
+// back to 'getTimer', and is then no faster than the system timer.
+// 'cycleTimerUsesCounter' reports which of the two sources is in use.
+//
+// The rate of the TSC is calibrated once per process, against 'getTimer', the
+// first time the cycle timer is used (or when 'initializeCycleTimer' is
+// called).  Calibration busy-waits for about 10 milliseconds; applications
+// that are sensitive to this latency should call 'initializeCycleTimer' at
+// start-up.  The 'convertRawTime' overload for 'OpaqueCycleTime' converts a
+// raw value to nanoseconds on the same time line as 'getTimer' (to within the
+// precision of the calibration), so that cycle-timer and system-timer values
+// may be compared, and differences of converted values are elapsed times.
+//
+// Note that reading the TSC is not a serializing operation: the processor may
+// execute the read before preceding instructions have completed, or after
+// subsequent ones have started.  The cycle timer is therefore suitable for
+// time-stamping events and timing sections of code that are long compared to
+// the out-of-order execution window of the processor (tens of nanoseconds),
+// but not for measuring individual instructions.  Also note that raw values
+// read on different processors are comparable only if the operating system
+// keeps the counters of all processors synchronized, which is the case on
+// virtually all modern multi-processor x86 systems.
+//
+///Accuracy and Precision
+///----------------------
+// 'bsls::TimeUtil' high-resolution functions return time values as absolute
+// nanoseconds from an arbitrary reference that will *in many cases* remain
+// fixed within a single process (and among running processes on a single
+// machine).  Absolute monotonic behavior is platform-dependent, however, as
+// are accuracy and useful precision, despite the nominal nanosecond precision
+// implied by the return value.  The user is advised to determine the actual
+// performance on each platform of interest.
+//
+///Accuracy on Windows
+///- - - - - - - - - -
+// On certain windows platform configurations, 'bsls::TimeUtil::getTimer' and
+// 'bsls::TimeUtil::getRawTimer' can produce unreliable results.  On some
+// machines, these high-resolution functions have been observed to run at
+// inconsistent speeds, with worst cases as slow as half the speed of actual
+// wall time.  This is known behavior of the underlying high-performance timer
+// function 'QueryPerformanceCounter', upon which the Windows implementation of
+// 'bsls::TimeUtil' relies.
+//
+///CPU Scaling
+/// -  -  -  -
+// The behavior of the timer on windows platforms depends on the interaction of
+// operating system, BIOS, and processor, and certain combinations of the three
+// (particularly older ones) are vulnerable to timer inaccuracy.  For example,
+// frequently the 'QueryPerformanceCounter' function that 'TmeUtil' uses on
+// Windows will utilize the CPU's timestamp counter (TSC), and CPUs with speed
+// scaling mechanisms such as SpeedStep (frequently used for power management)
+// will generally see the clock speed vary with the CPU frequency.  However,
+// newer processors often provide an 'Invariant TSC' that solves this
+// problem.  Also versions of Windows starting with Vista may internally handle
+// the inconsistency by automatically using a lower resolution, but accurate,
+// counter on processors that do not provide an 'Invariant TSC'.
+//
+///Multi-Core Issues
+/// -  -  -  -  -  -
+// In addition, on multi-core machines, each call to 'QueryPerformanceCounter'
+// may read the TSC from a different CPU.  The TSCs of the CPUs may be out of
+// sync, resulting in slightly inconsistent or even non-monotonic behavior.
+//
+// Reference: http://support.microsoft.com/kb/895980
+//
+///Ensuring Accurate Timers on Windows
+///- - - - - - - - - - - - - - - - - -
+// If a Windows machine appears to have a slow and/or inconsistent
+// high-resolution timer, it can be reconfigured to avoid using the TSC.  On
+// Windows XP and earlier versions, add the parameter '/usepmtimer' to the
+// operating system's boot configuration in 'boot.ini'.  On Windows Vista and
+// later, run the following command as an administrator:
+//..
+//  bcdedit /set useplatformclock true
+//..
+// Note that unless the machine has a High Performance Event Timer (HPET) and
+// it has been enabled in the BIOS, these steps might reduce the resolution of
+// the 'bsls::TimeUtil' high-resolution functions from the nanosecond range to
+// the microsecond range (or worse).
+//
+///Precision on Windows
+/// - - - - - - - - - -
+// Providing that the underlying timer is capable of reporting the
+// 'QueryPerformanceCounter' interface, the nanosecond values reported by
+// 'getTimer' or 'convertRawTime' will be in the range (t - 2, t], where t is
+// the real (infinitely precise floating point) number of nanoseconds expressed
+// by the current raw timer count.
+//
+///Usage
+///-----
+// The following snippets of code illustrate how to use 'bsls::TimeUtil'
+// functions to implement a very simple timer.  Only the most primitive
+// functionality is illustrated.  See the 'bsls::Stopwatch' component for a
+// better example of a timer interface.
+//..
+//  // my_timer.h
+//
+//  #ifndef INCLUDED_BSLS_TYPES
+//  #include <bsls_types.h>   // bsls::Types::Int64
+//  #endif
+//
+//  #ifndef INCLUDED_BSLS_TIMEUTIL
+//  #include <bsls_timeutil.h>
+//  #endif
+//
+// class my_Timer {
+//     // This class implements a simple interval timer that is created in
+//     // the "running" state, and may be queried for its cumulative
+//     // interval (as a 'double', in seconds) but never stopped or reset.
+//
+//     bsls::Types::Int64 d_startWallTime;   // time at creation (nsec)
+//     bsls::Types::Int64 d_startUserTime;   // time at creation (nsec)
+//     bsls::Types::Int64 d_startSystemTime; // time at creation (nsec)
+//
+//   public:
+//     // CREATORS
+//     my_Timer() {
+//         d_startWallTime = bsls::TimeUtil::getTimer();
+//         d_startUserTime = bsls::TimeUtil::getProcessUserTimer();
+//         d_startSystemTime = bsls::TimeUtil::getProcessSystemTimer();
+//     }
+//         // Create a timer object initialized with the times at creation.
+//         // All values returned by subsequent calls to 'elapsed<...>Time()'
+//         // are with respect to this creation time.
+//
+//     ~my_Timer() {}
+//
+//     // ACCESSORS
+//     double elapsedWallTime();
+//         // Return the total elapsed time in seconds since the creation of
+//         // this timer object.
+//     double elapsedUserTime();
+//         // Return the elapsed user time in seconds since the creation of
+//         // this timer object.
+//     double elapsedSystemTime();
+//         // Return the elapsed system time in seconds since the creation of
+//         // this timer object.
+// };
+//
+// inline
+// double my_Timer::elapsedWallTime()
+// {
+//     return (double) (bsls::TimeUtil::getTimer() - d_startWallTime) * 1.0E-9;
+// }
+//
+// inline
+// double my_Timer::elapsedUserTime()
+// {
+//     return (double) (bsls::TimeUtil::getProcessUserTimer()
+//                                                 - d_startUserTime) * 1.0E-9;
+// }
+//
+// inline
+// double my_Timer::elapsedSystemTime()
+// {
+//     return (double) (bsls::TimeUtil::getProcessSystemTimer()
+//                                               - d_startSystemTime) * 1.0E-9;
+// }
+//  // ...
+//..
+// The 'my_Timer' object may be used to time some section of code at runtime as
+// follows:
+//..
+//  // ...
+//  {
+//      my_Timer tw;
+//      for (int i = 0; i < 1000000; ++i) {
+//          // ...
+//      }
+//      double dTw = tw.elapsedWallTime();
+//      my_Timer tu;
+//      for (int i = 0; i < 1000000; ++i) {
+//          // ...
+//      }
+//      double dTu = tu.elapsedUserTime();
+//      my_Timer ts;
+//      for (int i = 0; i < 1000000; ++i) {
+//          // ...
+//      }
+//      double dTs = ts.elapsedSystemTime();
+//      std::cout << "elapsed wall time:   " << dTw << std::endl
+//                << "elapsed user time:   " << dTu << std::endl
+//                << "elapsed system time: " << dTs << std::endl;
+//  }
+//..
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+    #ifndef INCLUDED_TIME
+    #include <time.h>
+    #define INCLUDED_TIME
+    #endif
+#endif
+
+#if defined(BSLS_PLATFORM_OS_AIX) || defined(BSLS_PLATFORM_OS_FREEBSD)
+    #ifndef INCLUDED_SYS_TIME
+    #include <sys/time.h>
+    #define INCLUDED_SYS_TIME
+    #endif
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+    #if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+        #define BSLS_TIMEUTIL_CYCLE_TIMER_TSC 1
+    #elif defined(BSLS_PLATFORM_CMP_MSVC)
+        #define BSLS_TIMEUTIL_CYCLE_TIMER_TSC 1
+
+        #ifndef INCLUDED_INTRIN
+        #include <intrin.h>
+        #define INCLUDED_INTRIN
+        #endif
+
+        #pragma intrinsic(__rdtsc)
+    #endif
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                            // ===============
+                            // struct TimeUtil
+                            // ===============
+
+struct TimeUtil {
+    // This 'struct' provides a namespace for a set of platform-neutral pure
+    // procedures to access real-time system clock functionality.
+    // High-resolution time functions intended for interval-timing return an
+    // interval in nanoseconds (1 nsec = 1E-9 sec) as a platform-independent
+    // 64-bit integer.
+    //
+    // For maximum performance on some platforms where fetching the native
+    // clock is significantly faster than converting the fetched value to
+    // nanoseconds, this class also provides a "raw" method returning an opaque
+    // native time value and a conversion method returning a value in
+    // nanoseconds.
+
+    //
+    // In addition, this class provides a *cycle* *timer*, having a raw type,
+    // 'OpaqueCycleTime', that is distinct from 'OpaqueNativeTime', and that is
+    // read from the invariant time-stamp counter of the processor where one
+    // is available (see the "Cycle Timer" section of the component-level
+    // documentation).
+
+    // TYPES
+#if   defined BSLS_PLATFORM_OS_SOLARIS
+    typedef struct { Types::Int64 d_opaque; } OpaqueNativeTime;
+#elif defined BSLS_PLATFORM_OS_AIX
+    typedef timebasestruct_t                  OpaqueNativeTime;
+#elif defined BSLS_PLATFORM_OS_HPUX
+        typedef struct { Types::Int64 d_opaque; } OpaqueNativeTime;
+#elif defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_CYGWIN)
+        typedef timespec                          OpaqueNativeTime;
+#elif defined BSLS_PLATFORM_OS_UNIX
+    typedef timeval                           OpaqueNativeTime;
+#elif defined BSLS_PLATFORM_OS_WINDOWS
+    typedef struct { Types::Int64 d_opaque; } OpaqueNativeTime;
+#endif
+
+    typedef struct { Types::Int64 d_opaque; } OpaqueCycleTime;
+        // Raw value of the cycle timer: either a time-stamp counter value, or
+        // a 'getTimer' value if the time-stamp counter is not used.
+
+    // CLASS METHODS
+    static Types::Int64 convertRawTime(OpaqueNativeTime rawTime);
+        // Convert the specified 'rawTime' to a value in nanoseconds,
+        // referenced to an arbitrary but fixed origin, and return the result
+        // of the conversion.  Note that this method is thread-safe only if
+        // 'initialize' has been called before.
+
+    static Types::Int64 convertRawTime(OpaqueCycleTime rawTime);
+        // Convert the specified 'rawTime', obtained from 'getCycleTimerRaw',
+        // to a value in nanoseconds, referenced to the same origin as
+        // 'getTimer', and return the result of the conversion.  This method is
+        // thread-safe.
+
+    static bool cycleTimerUsesCounter();
+        // Return 'true' if the cycle timer reads the invariant time-stamp
+        // counter of the processor, and 'false' if it falls back to
+        // 'getTimer'.  Calibrate the cycle timer if it has not already been
+        // calibrated.  This method is thread-safe.
+
+    static Types::Int64 getCycleTimer();
+        // Return the instantaneous value of the cycle timer in absolute
+        // nanoseconds referenced to the same origin as 'getTimer'.  Calibrate
+        // the cycle timer if it has not already been calibrated.  This method
+        // is thread-safe.  Note that 'getCycleTimerRaw' should be preferred
+        // if values are read much more often than they are converted.
+
+    static Types::Int64 getProcessSystemTimer();
+        // Return the instantaneous values of a platform-dependent timer for
+        // the current process system time in absolute nanoseconds referenced
+        // to an arbitrary but fixed origin.  Note that this method is thread-
+        // safe only if 'initialize' has been called before.
+
+    static void getProcessTimers(Types::Int64 *systemTimer,
+                                 Types::Int64 *userTimer);
+        // Load into the specified 'systemTimer' and 'userTimer' the
+        // instantaneous values of platform-dependent system timer and user
+        // timer in absolute nanoseconds referenced to an arbitrary but fixed
+        // origin.  Note that this method is thread-safe only if 'initialize'
+        // has been called before.
+
+    static Types::Int64 getProcessUserTimer();
+        // Return the instantaneous values of a platform-dependent timer for
+        // the current process user time in absolute nanoseconds referenced to
+        // an arbitrary but fixed origin.  Note that this method is thread-safe
+        // only if 'initialize' has been called before.
+
+    static Types::Int64 getThreadCpuTimer();
+        // Return the instantaneous value of a platform-dependent timer for
+        // the CPU time (user and system time combined) consumed by the
+        // calling thread in absolute nanoseconds referenced to an arbitrary
+        // but fixed origin.  This method is thread-safe.  Note that, unlike
+        // the process timers, this timer is not affected by other threads of
+        // the process and, on Linux and Windows, its resolution is much finer
+        // than a clock tick; on platforms that do not provide a per-thread
+        // CPU clock, the sum of the process system and user times is returned
+        // instead.
+
+    static void getCycleTimerRaw(OpaqueCycleTime *timeValue);
+        // Load into the specified 'timeValue' the value of an opaque type
+        // representing the current value of the cycle timer.  'timeValue'
+        // must be converted by the 'convertRawTime' method to conventional
+        // units (nanoseconds).  Calibrate the cycle timer if it has not
+        // already been calibrated.  This method is thread-safe.  Note that,
+        // once the cycle timer is calibrated, this method reads the
+        // time-stamp counter inline, if it is used, and does not call into
+        // the operating system.
+
+    static Types::Int64 getTimer();
+        // Return the instantaneous value of a platform-dependent system timer
+        // in absolute nanoseconds referenced to an arbitrary but fixed origin.
+        // Note that this method is thread-safe only if 'initialize' has been
+        // called before.
+
+    static void getTimerRaw(OpaqueNativeTime *timeValue);
+        // Load into the specified 'timeValue' the value of an opaque,
+        // platform-dependent type representing the current time.  'timeValue'
+        // must be converted by the 'convertRawTime' method to conventional
+        // units (nanoseconds).  This method is intended to facilitate accurate
+        // timing of small segments of code, and care must be used in
+        // interpreting the results.  Note that this method is thread-safe only
+        // if 'initialize' has been called before.
+
+    static void initialize();
+        // Do a platform-dependent initialization for the utilities.  Note that
+        // only after a call to this method all the following methods are
+        // guaranteed to be thread-safe.
+
+    static void initializeCycleTimer();
+        // Determine whether the processor provides an invariant time-stamp
+        // counter and, if so, calibrate its rate against 'getTimer', unless
+        // this has already been done.  This method is thread-safe, and
+        // blocks for about 10 milliseconds the first time it is called.  Note
+        // that the cycle timer is calibrated automatically when first used;
+        // calling this method at start-up avoids paying the calibration cost
+        // on first use.
+};
+
+                         // ==========================
+                         // struct TimeUtil_CycleTimer
+                         // ==========================
+
+struct TimeUtil_CycleTimer {
+    // [!PRIVATE!] This component-private 'struct' provides the state and the
+    // primitive operations underlying the cycle timer of 'TimeUtil'.  Do not
+    // use outside of this component.
+
+    // TYPES
+    enum Mode {
+        k_UNINITIALIZED = 0,  // not yet calibrated
+        k_CALIBRATING   = 1,  // calibration in progress in some thread
+        k_COUNTER       = 2,  // raw values are time-stamp counter values
+        k_CLOCK         = 3   // raw values are 'TimeUtil::getTimer' values
+    };
+
+    // CLASS DATA
+    static AtomicOperations::AtomicTypes::Int s_mode;  // a 'Mode' value
+
+    // CLASS METHODS
+#ifdef BSLS_TIMEUTIL_CYCLE_TIMER_TSC
+    static Types::Int64 readCounter();
+        // Return the current value of the time-stamp counter of the processor
+        // executing the calling thread.
+#endif
+
+    static Types::Int64 readRaw();
+        // Calibrate the cycle timer if it has not already been calibrated,
+        // and return the current raw value of the cycle timer.  Note that
+        // this method is the out-of-line path of 'TimeUtil::getCycleTimerRaw'.
+};
+
+// ============================================================================
+//                          INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // --------------------------
+                         // struct TimeUtil_CycleTimer
+                         // --------------------------
+
+// CLASS METHODS
+#ifdef BSLS_TIMEUTIL_CYCLE_TIMER_TSC
+inline
+Types::Int64 TimeUtil_CycleTimer::readCounter()
+{
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    return static_cast<Types::Int64>(__rdtsc());
+#else
+    unsigned int low;
+    unsigned int high;
+    __asm__ __volatile__ ("rdtsc" : "=a" (low), "=d" (high));
+    return static_cast<Types::Int64>(
+                              (static_cast<Types::Uint64>(high) << 32) | low);
+#endif
+}
+#endif
+
+                              // ---------------
+                              // struct TimeUtil
+                              // ---------------
+
+// CLASS METHODS
+inline
+void TimeUtil::getCycleTimerRaw(OpaqueCycleTime *timeValue)
+{
+#ifdef BSLS_TIMEUTIL_CYCLE_TIMER_TSC
+    const int mode = AtomicOperations::getIntRelaxed(
+                                                 &TimeUtil_CycleTimer::s_mode);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                     TimeUtil_CycleTimer::k_COUNTER == mode)) {
+        timeValue->d_opaque = TimeUtil_CycleTimer::readCounter();
+        return;                                                       // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+#endif
+
+    timeValue->d_opaque = TimeUtil_CycleTimer::readRaw();
+}
+
+}  // close package namespace
+
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,71 @@
+// bslstl_sstream.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLSTL_SSTREAM
+#define INCLUDED_BSLSTL_SSTREAM
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide C++03-compatible 'stringstream' classes.
+//
+//@SEE_ALSO: bslstl_stringbuf, bslstl_istringstream, bslstl_ostringstream,
+//           bslstl_stringstream
+//
+//@DESCRIPTION: This component is for internal use only.  Please include
+// '<bsl_sstream.h>' instead.
+//
+///Usage
+///-----
+// This component is for use by the 'bsl+stdhdrs' package.
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "include <bsl_sstream.h> instead of <bslstl_sstream.h> in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ISTRINGSTREAM
+#include <bslstl_istringstream.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_OSTRINGSTREAM
+#include <bslstl_ostringstream.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRINGBUF
+#include <bslstl_stringbuf.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRINGSTREAM
+#include <bslstl_stringstream.h>
+#endif
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,828 @@
+// bslstl_stack.h                                                     -*-C++-*-
+#ifndef INCLUDED_BSLSTL_STACK
+#define INCLUDED_BSLSTL_STACK
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an STL-compliant stack class.
+//
+//@CLASSES:
+//   bslstl::stack: STL-compliant stack template
+//
+//@SEE_ALSO: bslstl_deque, bslstl_vector, bslstl_list, bslstl_queue,
+//           bslstl_priorityqueue
+//
+//@DESCRIPTION: This component defines a single class template 'bslstl::stack',
+// a container adapter that takes an underlying container and provides a stack
+// interface which the user accesses primarily through 'push', 'pop', and 'top'
+// operations.  A 'deque' (the default), 'vector', or 'list' may be used, but
+// any container which supports 'push_back', 'pop_back', 'back', and 'size',
+// plus a template specialization 'uses_allocator::type', may be used.
+//
+///Requirements of Parametrized 'CONTAINER' Type
+///---------------------------------------------
+// This class will accept 'bsl::queue', 'bsl::vector', or 'bsl::list' as the
+// template parameter 'CONTAINER'.  In addition, other container classes could
+// be supplied for the CONTAINER argument, but the supplied 'CONTAINER'
+// template parameter must support the following public types:
+//: o value_type
+//: o reference
+//: o const_reference
+//: o size_type
+// In addition, the supplied 'CONTAINER' template parameter must support the
+// following methods, (depending on the methods of 'stack' being used):
+//: o constructors used must take a parameter of type 'allocator_type'
+//: o void push_back(const value_type&)
+//: o void pop_back()
+//: o value_type& back()
+//: o size_type size()
+//: o '==', '!=', '<', '>', '<=', '>='
+//: o 'operator='
+//: o std::swap(CONTAINER&, CONTAINER&) must work
+//
+///Note on Parameterized 'VALUE' Type
+///----------------------------------
+// If the 'CONTAINER' type is specified, the 'VALUE' type specified is ignored
+// and 'CONTAINER::value_type' is used in its place.  It is recommended, if
+// 'CONTAINER' is specified, that a type equivalent to 'CONTAINER::value_type'
+// be specified to the 'VALUE' template parameter so as not to mislead readers.
+//
+///Memory Allocation
+///-----------------
+// No memory allocator template arg is directly supplied to this class, the
+// allocator type used is the allocator specified for the container class.
+// Some functions of this template only exist if type
+// 'CONTAINER::allocator_type' exists, and if it does exist it is assumed to be
+// the allocator type used by 'CONTAINER', and that 'CONTAINER' supports
+// constructors of this type.
+//
+///'bslma'-Style Allocators
+///------------------------
+// The constructors of this class take, as optional parameters, allocators of
+// the object's parameterized 'CONTAINER::allocator_type' type, and allocators
+// of this type are propagated to all constructors of the underlying container.
+// In the case of container types 'bsl::deque' (the default type),
+// 'bsl::vector', and 'bsl::list', 'CONTAINER::allocator_type' is
+// 'bsl::allocator' which is implicitly convertible from 'bslma_Allocator *',
+// and which can be converted to a 'bslma_Allocator *' through the 'mechanism'
+// accessor.
+//
+// Hence if the underlying container takes 'bsl::allocator', then the 'stack'
+// object can take 'bslma_Allocator *'s to supply memory allocation.  If no
+// allocator is specified, 'allocator()' is used, which winds up using
+// 'bslma::Default::allocator(0)'.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'stack':
+//..
+//  Legend
+//  ------
+//  'C'             - parameterized container-type of the stack
+//  'V'             - 'C::value_type'
+//  'c'             - container of type 'C'
+//  'nc'            - number of elements in container 'c'
+//  's', 't'        - two distinct objects of type 'stack<V, C>'
+//  'n', 'm'        - number of elements in 's' and 't' respectively
+//  'al'            - a STL-style memory allocator
+//  'v'             - an object of type 'V'
+//
+//  +----------------------------------------------------+--------------------+
+//  | Note: the following estimations of operation complexity assume the      |
+//  | underlying container is a 'bsl::deque', 'bsl::vector', or 'bsl::list'.  |
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | stack<V, C> s;    (default construction)           | O(1)               |
+//  | stack<V, C> s(al);                                 |                    |
+//  +----------------------------------------------------+--------------------+
+//  | stack<V, C> s(c);                                  | O(nc)              |
+//  | stack<V, C> s(c, al);                              |                    |
+//  +----------------------------------------------------+--------------------+
+//  | stack<V, C> s(t);                                  | O(n)               |
+//  | stack<V, C> s(t, al);                              |                    |
+//  +----------------------------------------------------+--------------------+
+//  | s.~stack(V, C>(); (destruction)                    | O(n)               |
+//  +----------------------------------------------------+--------------------+
+//  | s = t;          (assignment)                       | O(n)               |
+//  +----------------------------------------------------+--------------------+
+//  | s.push(v)                                          | O(1)               |
+//  +----------------------------------------------------+--------------------+
+//  | s.pop()                                            | O(1)               |
+//  +----------------------------------------------------+--------------------+
+//  | s.top()                                            | O(1)               |
+//  +----------------------------------------------------+--------------------+
+//  | s == t, s != t                                     | O(n)               |
+//  +---------------------------------------------------+--------------------+
+//  | s < t, s <= t, s > t, s >= t                       | O(n)               |
+//  +----------------------------------------------------+--------------------+
+//  | s.swap(t), swap(s,t)                               | depends on the     |
+//  |                                                    | container; for     |
+//  |                                                    | deque, vector, and |
+//  |                                                    | list:              |
+//  |                                                    | O(1) if 's' and    |
+//  |                                                    | 't' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O(n + m) otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | s.size()                                           | O(1) if 'C' is     |
+//  |                                                    | deque or vector    |
+//  +----------------------------------------------------+--------------------+
+//  | s.empty()                                          | O(1)               |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Household Chores To Do List
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose a husband wants to keep track of chores his wife has asked him to
+// do.  Over the years of being married, he has noticed that his wife generally
+// wants the most recently requested task done first.  If she has a new task in
+// mind that is low-priority, she will avoid asking for it until higher
+// priority tasks are finished.  When he has finished all tasks, he is to
+// report to his wife that he is ready for more.
+//
+// First, we define the class implementing the 'to-do' list.
+//..
+//  class ToDoList {
+//      // DATA
+//      bsl::stack<const char *> d_stack;
+//
+//    public:
+//      // MANIPULATORS
+//      void enqueueTask(const char *task);
+//          // Add the specified 'task', a string describing a task, to the
+//          // list.  Note the lifetime of the string referred to by 'task'
+//          // must exceed the lifetime of the task in this list.
+//
+//      bool finishTask();
+//          // Remove the current task from the list.  Return 'true' if a task
+//          // was removed and it was the last task on the list, and return
+//          // 'false' otherwise.
+//
+//      // ACCESSORS
+//      const char *currentTask() const;
+//          // Return the string representing the current task.  If there
+//          // is no current task, return the string "<EMPTY>", which is
+//          // not a valid task.
+//  };
+//
+//  // MANIPULATORS
+//  void ToDoList::enqueueTask(const char *task)
+//  {
+//      d_stack.push(task);
+//  }
+//
+//  bool ToDoList::finishTask()
+//  {
+//      if (!d_stack.empty()) {
+//          d_stack.pop();
+//
+//          return d_stack.empty();
+//      }
+//
+//      return false;
+//  };
+//
+//  // ACCESSORS
+//  const char *ToDoList::currentTask() const
+//  {
+//      if (d_stack.empty()) {
+//          return "<EMPTY>";
+//      }
+//
+//      return d_stack.top();
+//  }
+//..
+// Then, create an object of type 'ToDoList'.
+//
+//  ToDoList toDoList;
+//
+// Next, a few tasks are requested:
+//..
+//  toDoList.enqueueTask("Change the car's oil.");
+//  toDoList.enqueueTask("Pay the bills.");
+//..
+// Then, the husband watches the Yankee's game on TV.  Upon returning to the
+// list he consults the list to see what task is up next:
+//..
+//  assert(!strcmp("Pay the bills.", toDoList.currentTask()));
+//..
+// Next, he sees that he has to pay the bills.  When the bills are finished, he
+// flushes that task from the list:
+//..
+//  assert(false == toDoList.finishTask());
+//..
+// Then, he consults the list for the next task.
+//..
+//  assert(!strcmp("Change the car's oil.", toDoList.currentTask()));
+//..
+// Next, he sees he has to change the car's oil.  Before he can get started,
+// another request comes:
+//..
+//  toDoList.enqueueTask("Get some hot dogs.");
+//  assert(!strcmp("Get some hot dogs.", toDoList.currentTask()));
+//..
+// Then, he drives the car to the convenience store and picks up some hot dogs
+// and buns.  Upon returning home, he gives the hot dogs to his wife, updates
+// the list, and consults it for the next task.
+//..
+//  assert(false == toDoList.finishTask());
+//  assert(!strcmp("Change the car's oil.", toDoList.currentTask()));
+//..
+// Next, he finishes the oil change, updates the list, and consults it for the
+// next task.
+//..
+//  assert(true == toDoList.finishTask());
+//  assert(!strcmp("<EMPTY>", toDoList.currentTask()));
+//..
+// Finally, the wife has now been informed that everything is done, and she
+// makes another request:
+//..
+//  toDoList.enqueueTask("Clean the rain gutters.");
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "include <bsl_stack.h> instead of <bslstl_stack.h> in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_DEQUE
+#include <bslstl_deque.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ENABLEIF
+#include <bslmf_enableif.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>
+#define INCLUDED_ALGORITHM
+#endif
+
+namespace bsl {
+
+template <class CONTAINER>
+class Stack_HasAllocatorType {
+    // This 'class' computes a public constant 'VALUE', which is 'true' if the
+    // passed 'CONTAINER' defines a type 'CONTAINER::allocator_type' and
+    // 'false' otherwise.  This is used in conjunction with 'enable_if'
+    // to make methods of 'stack' that take allocator arguments exist if
+    // 'CONTAINER::allocator_type' is present, and remove them from the
+    // constructor overload set otherwise.
+
+    typedef char YesType;
+    struct NoType { char a[2]; };
+
+    template <typename TYPE>
+    static YesType match(const typename TYPE::allocator_type *);
+    template <typename TYPE>
+    static NoType match(...);
+
+  public:
+    enum { VALUE = (1 == sizeof(match<CONTAINER>(0))) };
+};
+
+template <class VALUE, class CONTAINER = deque<VALUE> >
+class stack {
+    // This 'class' defines a container adapter which supports access primarily
+    // via 'push', 'pop', and 'top'.  This type is value-semantic, and can be
+    // based on a variety of other container types, including 'deque',
+    // 'vector', and 'list'.
+    //
+    // Note that we never use 'VALUE' in the implementation except in the
+    // default argument of 'CONTAINER'.  We use 'CONTAINER::value_type' for
+    // everything, which means that if 'CONTAINER' is specified, then 'VALUE'
+    // is ignored.
+
+  public:
+    // PUBLIC TYPES
+
+    typedef typename CONTAINER::value_type      value_type;
+    typedef typename CONTAINER::reference       reference;
+    typedef typename CONTAINER::const_reference const_reference;
+    typedef typename CONTAINER::size_type       size_type;
+    typedef          CONTAINER                  container_type;
+
+  private:
+    // PRIVATE DATA
+    container_type  d_container;    // container in which objects are stored
+
+  protected:
+    // PROTECTED DATA
+    container_type& c;    // We are required by the standard to have the
+                          // container be a protected variable named 'c'.  Just
+                          // a reference to 'd_container'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION_IF(
+        stack,
+        BloombergLP::bslma::UsesBslmaAllocator,
+        BloombergLP::bslma::UsesBslmaAllocator<container_type>::value);
+
+  private:
+    // FRIENDS
+    template <class VAL, class CONT>
+    friend bool operator==(const stack<VAL, CONT>&, const stack<VAL, CONT>&);
+    template <class VAL, class CONT>
+    friend bool operator!=(const stack<VAL, CONT>&, const stack<VAL, CONT>&);
+    template <class VAL, class CONT>
+    friend bool operator< (const stack<VAL, CONT>&, const stack<VAL, CONT>&);
+    template <class VAL, class CONT>
+    friend bool operator> (const stack<VAL, CONT>&, const stack<VAL, CONT>&);
+    template <class VAL, class CONT>
+    friend bool operator<=(const stack<VAL, CONT>&, const stack<VAL, CONT>&);
+    template <class VAL, class CONT>
+    friend bool operator>=(const stack<VAL, CONT>&, const stack<VAL, CONT>&);
+
+  public:
+    // CREATORS
+    stack();
+        // Construct an empty stack.  No allocator will be provided to the
+        // underlying container, and the container's memory allocation will be
+        // provided by whatever is the default for the container type.
+
+    template <class ALLOCATOR>
+    explicit
+    stack(const ALLOCATOR& allocator,
+          typename enable_if<
+                                      Stack_HasAllocatorType<CONTAINER>::VALUE,
+                                      ALLOCATOR>::type * = 0);
+        // Construct an empty stack, and use 'allocator' to supply memory.  If
+        // 'CONTAINER::allocator_type' does not exist, this constructor may not
+        // be used.
+
+    explicit
+    stack(const CONTAINER& container);
+        // Construct a stack whose underlying container has the value of the
+        // specified 'container'.
+
+    template <class ALLOCATOR>
+    stack(const CONTAINER& container,
+          const ALLOCATOR& allocator,
+          typename enable_if<Stack_HasAllocatorType<CONTAINER>::VALUE,
+                             ALLOCATOR>::type * = 0);
+        // Construct a stack whose underlying container has the value of the
+        // specified 'container', and use the specified 'allocator' to supply
+        // memory.  If 'CONTAINER::allocator_type' does not exist, this
+        // constructor may not be used.
+
+    stack(const stack& original);
+        // Construct a stack having the same value as the specified 'original'.
+
+    template <class ALLOCATOR>
+    stack(const stack&     original,
+          const ALLOCATOR& allocator,
+          typename enable_if<Stack_HasAllocatorType<CONTAINER>::VALUE,
+                             ALLOCATOR>::type * = 0);
+        // Construct a stack having the same value as the specified stack
+        // 'original', and use the specified 'allocator' to supply memory.  If
+        // 'CONTAINER::allocator_type' does not exist, this constructor may not
+        // be used.
+
+#ifdef BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES
+    explicit
+    stack(CONTAINER&&                               container);
+
+    template <class ALLOCATOR>
+    stack(CONTAINER&&      container,
+          const ALLOCATOR& allocator,
+          typename enable_if<Stack_HasAllocatorType<CONTAINER>::VALUE,
+                             ALLOCATOR>::type * = 0);
+        // TBD
+
+    explicit
+    stack(stack&&          original);
+
+        // TBD
+    template <class ALLOCATOR>
+    stack(stack&&          original,
+          const ALLOCATOR& allocator,
+          typename enable_if<Stack_HasAllocatorType<CONTAINER>::VALUE,
+                             ALLOCATOR>::type * = 0);
+        // TBD
+#endif
+
+    // MANIPULATORS
+    stack& operator=(const stack& rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) && \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... Args>
+    void emplace(Args&&... args);
+        // TBD
+#endif
+
+    void pop();
+        // Remove the top element from this stack.  The behavior is undefined
+        // if the stack is empty.
+
+    void push(const value_type& value);
+        // Push the specified 'value' onto the top of the stack.
+
+#ifdef BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES
+    void push(value_type&& value);
+        // TBD
+#endif
+
+    void swap(stack& other);
+        // Exchange the value of this object with the value of the specified
+        // 'other' object.
+
+    reference top();
+        // Return a reference to the element at the top of this stack.  The
+        // behavior is undefined if the stack is empty.
+
+    // ACCESSORS
+    bool empty() const;
+        // Return 'true' if this stack contains no elements and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements contained in this stack.
+
+    const_reference top() const;
+        // Return a reference providing non-modifiable access to the element at
+        // the top of this stack.  The behavior is undefined if the stack is
+        // empty.
+};
+
+#if 0
+// 'uses_allocator' and 'is_constructible' depend on the underlying 'container'
+// having these constructs, which 'deque', 'vector', and 'list' don't yet.
+
+                            // ==============
+                            // uses_allocator
+                            // ==============
+
+template <class VALUE, class CONTAINER, class ALLOCATOR>
+struct uses_allocator<stack<VALUE, CONTAINER>, ALLOCATOR>
+: uses_allocator<CONTAINER, ALLOCATOR>::type {
+    // doc TBD
+};
+
+#endif
+
+//=============================================================================
+//                              FREE OPERATORS
+//=============================================================================
+
+template <class VALUE, class CONTAINER>
+bool operator==(const stack<VALUE, CONTAINER>& lhs,
+                const stack<VALUE, CONTAINER>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'stack' objects have the same value
+    // if their underlying containers have the same value.
+
+template <class VALUE, class CONTAINER>
+bool operator!=(const stack<VALUE, CONTAINER>& lhs,
+                const stack<VALUE, CONTAINER>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'stack' objects have the same
+    // value if their underlying containers have the same value.
+
+template <class VALUE, class CONTAINER>
+bool operator< (const stack<VALUE, CONTAINER>& lhs,
+                const stack<VALUE, CONTAINER>& rhs);
+    // Return 'true' if the specified 'lhs' is less than the specified 'rhs'.
+    // One 'stack' object is less than another if its underlying container is
+    // less than the other's underlying container.
+
+template <class VALUE, class CONTAINER>
+bool operator> (const stack<VALUE, CONTAINER>& lhs,
+                const stack<VALUE, CONTAINER>& rhs);
+    // Return 'true' if the specified 'lhs' is greater than the specified
+    // 'rhs'.  One 'stack' object is greater than another if its underlying
+    // container is greater than the other's underlying container.
+
+template <class VALUE, class CONTAINER>
+bool operator<=(const stack<VALUE, CONTAINER>& lhs,
+                const stack<VALUE, CONTAINER>& rhs);
+    // Return 'true' if the specified 'lhs' is less than or equal to the
+    // specified 'rhs'.  One 'stack' object is less than or equal to another if
+    // its underlying container is less than or equal to the other's underlying
+    // container.
+
+template <class VALUE, class CONTAINER>
+bool operator>=(const stack<VALUE, CONTAINER>& lhs,
+                const stack<VALUE, CONTAINER>& rhs);
+    // Return 'true' if the specified 'lhs' is greater than or equal to the
+    // specified 'rhs'.  One 'stack' object is greater than or equal to another
+    // if its underlying container is greater than or equal to the other's
+    // underlying container.
+
+template <class VALUE, class CONTAINER>
+void swap(stack<VALUE, CONTAINER>& lhs,
+          stack<VALUE, CONTAINER>& rhs);
+    // Swap the contents of 'lhs' and 'rhs'.  The behavior is undefined unless
+    // 'lhs' and 'rhs' use the same allocator.
+
+//=============================================================================
+//                          INLINE FUNCTION DEFINITIONS
+//=============================================================================
+
+// CREATORS
+template <class VALUE, class CONTAINER>
+inline
+stack<VALUE, CONTAINER>::stack()
+: d_container()
+, c(d_container)
+{}
+
+template <class VALUE, class CONTAINER>
+template <class ALLOCATOR>
+inline
+stack<VALUE, CONTAINER>::stack(const ALLOCATOR& allocator,
+                               typename enable_if<
+                                      Stack_HasAllocatorType<CONTAINER>::VALUE,
+                                      ALLOCATOR>::type *)
+: d_container(allocator)
+, c(d_container)
+{}
+
+template <class VALUE, class CONTAINER>
+inline
+stack<VALUE, CONTAINER>::stack(const CONTAINER& container)
+: d_container(container)
+, c(d_container)
+{}
+
+template <class VALUE, class CONTAINER>
+template <class ALLOCATOR>
+inline
+stack<VALUE, CONTAINER>::stack(
+                           const CONTAINER& container,
+                           const ALLOCATOR& allocator,
+                           typename enable_if<
+                                      Stack_HasAllocatorType<CONTAINER>::VALUE,
+                                      ALLOCATOR>::type *)
+: d_container(container, allocator)
+, c(d_container)
+{}
+
+template <class VALUE, class CONTAINER>
+inline
+stack<VALUE, CONTAINER>::stack(const stack& original)
+: d_container(original.d_container)
+, c(d_container)
+{}
+
+template <class VALUE, class CONTAINER>
+template <class ALLOCATOR>
+inline
+stack<VALUE, CONTAINER>::stack(
+                           const stack&     original,
+                           const ALLOCATOR& allocator,
+                           typename enable_if<
+                                      Stack_HasAllocatorType<CONTAINER>::VALUE,
+                                      ALLOCATOR>::type *)
+: d_container(original.d_container, allocator)
+, c(d_container)
+{}
+
+#ifdef BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES
+
+template <class VALUE, class CONTAINER>
+inline
+stack<VALUE, CONTAINER>::stack(CONTAINER&&           container)
+: d_container(std::move(container))
+, c(d_container)
+{}
+
+template <class VALUE, class CONTAINER>
+template <class ALLOCATOR>
+inline
+stack<VALUE, CONTAINER>::stack(
+                           CONTAINER&&                               container,
+                           const ALLOCATOR& allocator,
+                           typename enable_if<
+                                      Stack_HasAllocatorType<CONTAINER>::VALUE,
+                                      ALLOCATOR>::type *)
+: d_container(std::move(container), allocator)
+, c(d_container)
+{}
+
+template <class VALUE, class CONTAINER>
+inline
+stack<VALUE, CONTAINER>::stack(stack&&               original)
+: d_container(std::move(original.d_container))
+, c(d_container)
+{}
+
+template <class VALUE, class CONTAINER>
+template <class ALLOCATOR>
+inline
+stack<VALUE, CONTAINER>::stack(
+                           stack&&          original,
+                           const ALLOCATOR& allocator,
+                           typename enable_if<
+                                      Stack_HasAllocatorType<CONTAINER>::VALUE,
+                                      ALLOCATOR>::type *)
+: d_container(std::move(original.d_container), allocator)
+, c(d_container)
+{}
+
+#endif
+
+// MANIPULATORS
+template <class VALUE, class CONTAINER>
+inline
+stack<VALUE, CONTAINER>& stack<VALUE, CONTAINER>::operator=(const stack& rhs)
+{
+    d_container = rhs.d_container;
+
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) && \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+
+template <class VALUE, class CONTAINER>
+template <class... Args>
+inline
+void stack<VALUE, CONTAINER>::emplace(Args&&... args)
+{
+    d_container.emplace_back(std::forward<Args>(args)...);
+}
+
+#endif
+
+template <class VALUE, class CONTAINER>
+inline
+void stack<VALUE, CONTAINER>::pop()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    d_container.pop_back();
+}
+
+template <class VALUE, class CONTAINER>
+inline
+void stack<VALUE, CONTAINER>::push(const value_type& value)
+{
+    d_container.push_back(value);
+}
+
+#ifdef BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES
+
+template <class VALUE, class CONTAINER>
+inline
+void stack<VALUE, CONTAINER>::push(value_type&& value)
+{
+    d_container.push_back(std::move(value));
+}
+
+#endif
+
+template <class VALUE, class CONTAINER>
+inline
+void stack<VALUE, CONTAINER>::swap(stack& other)
+{
+    BloombergLP::bslalg::SwapUtil::swap(&d_container, &other.d_container);
+}
+
+template <class VALUE, class CONTAINER>
+inline
+typename CONTAINER::reference stack<VALUE, CONTAINER>::top()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return d_container.back();
+}
+
+// ACCESSORS
+template <class VALUE, class CONTAINER>
+inline
+bool stack<VALUE, CONTAINER>::empty() const
+{
+    return 0 == d_container.size();
+}
+
+template <class VALUE, class CONTAINER>
+inline
+typename CONTAINER::size_type stack<VALUE, CONTAINER>::size() const
+{
+    return d_container.size();
+}
+
+template <class VALUE, class CONTAINER>
+inline
+typename CONTAINER::const_reference stack<VALUE, CONTAINER>::top() const
+{
+    return d_container.back();
+}
+
+// FREE OPERATORS
+template <class VALUE, class CONTAINER>
+inline
+bool operator==(const stack<VALUE, CONTAINER>& lhs,
+                const stack<VALUE, CONTAINER>& rhs)
+{
+    return lhs.d_container == rhs.d_container;
+}
+
+template <class VALUE, class CONTAINER>
+inline
+bool operator!=(const stack<VALUE, CONTAINER>& lhs,
+                const stack<VALUE, CONTAINER>& rhs)
+{
+    return lhs.d_container != rhs.d_container;
+}
+
+template <class VALUE, class CONTAINER>
+inline
+bool operator< (const stack<VALUE, CONTAINER>& lhs,
+                const stack<VALUE, CONTAINER>& rhs)
+{
+    return lhs.d_container < rhs.d_container;
+}
+
+template <class VALUE, class CONTAINER>
+inline
+bool operator> (const stack<VALUE, CONTAINER>& lhs,
+                const stack<VALUE, CONTAINER>& rhs)
+{
+    return lhs.d_container > rhs.d_container;
+}
+
+template <class VALUE, class CONTAINER>
+inline
+bool operator<=(const stack<VALUE, CONTAINER>& lhs,
+                const stack<VALUE, CONTAINER>& rhs)
+{
+    return lhs.d_container <= rhs.d_container;
+}
+
+template <class VALUE, class CONTAINER>
+inline
+bool operator>=(const stack<VALUE, CONTAINER>& lhs,
+                const stack<VALUE, CONTAINER>& rhs)
+{
+    return lhs.d_container >= rhs.d_container;
+}
+
+template <class VALUE, class CONTAINER>
+inline
+void swap(stack<VALUE, CONTAINER>& lhs,
+          stack<VALUE, CONTAINER>& rhs)
+{
+    lhs.swap(rhs);
+}
+
+}  // close namespace bsl
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -100,6 +100,7 @@
         'bslalg/bslalg_dequeiterator.h',
         'bslalg/bslalg_dequeprimitives.h',
         'bslalg/bslalg_functoradapter.h',
+        'bslalg/bslalg_hashedbidirectionalnode.h',
         'bslalg/bslalg_hashtableanchor.h',
         'bslalg/bslalg_hashtablebucket.h',
         'bslalg/bslalg_hashtableimputil.h',
@@ -129,6 +130,8 @@
         'bslma/bslma_autodeallocator.h',
         'bslma/bslma_autodestructor.h',
         'bslma/bslma_autorawdeleter.h',
+        'bslma/bslma_concurrentpoolallocator.h',
+        'bslma/bslma_countingallocator.h',
         'bslma/bslma_deallocatorguard.h',
         'bslma/bslma_deallocatorproctor.h',
         'bslma/bslma_default.h',
@@ -137,13 +140,19 @@
         'bslma/bslma_destructorguard.h',
         'bslma/bslma_destructorproctor.h',
         'bslma/bslma_exceptionguard.h',
+        'bslma/bslma_localarena.h',
         'bslma/bslma_mallocfreeallocator.h',
+        'bslma/bslma_managedallocator.h',
+        'bslma/bslma_multipoolallocator.h',
         'bslma/bslma_newdeleteallocator.h',
         'bslma/bslma_rawdeleterguard.h',
         'bslma/bslma_rawdeleterproctor.h',
+        'bslma/bslma_samplingallocator.h',
+        'bslma/bslma_sequentialallocator.h',
         'bslma/bslma_testallocator.h',
         'bslma/bslma_testallocatorexception.h',
         'bslma/bslma_testallocatormonitor.h',
+        'bslma/bslma_threaddefaultallocatorguard.h',
         'bslma/bslma_usesbslmaallocator.h',
         'bslmf/bslmf_addconst.h',
         'bslmf/bslmf_addcv.h',
@@ -186,6 +195,7 @@
         'bslmf/bslmf_isreference.h',
         'bslmf/bslmf_isrvaluereference.h',
         'bslmf/bslmf_issame.h',
+        'bslmf/bslmf_istransparent.h',
         'bslmf/bslmf_istriviallycopyable.h',
         'bslmf/bslmf_istriviallydefaultconstructible.h',
         'bslmf/bslmf_isvoid.h',
@@ -217,6 +227,7 @@
         'bsls/bsls_asserttest.h',
         'bsls/bsls_asserttestexception.h',
         'bsls/bsls_atomic.h',
+        'bsls/bsls_atomicdoubleword.h',
         'bsls/bsls_atomicoperations.h',
         'bsls/bsls_atomicoperations_default.h',
         'bsls/bsls_atomicoperations_ia64_hp_acc.h',
@@ -238,10 +249,12 @@
         'bsls/bsls_compilerfeatures.h',
         'bsls/bsls_exceptionutil.h',
         'bsls/bsls_ident.h',
+        'bsls/bsls_latencyhistogram.h',
         'bsls/bsls_macroincrement.h',
         'bsls/bsls_nativestd.h',
         'bsls/bsls_nullptr.h',
         'bsls/bsls_objectbuffer.h',
+        'bsls/bsls_performancecounters.h',
         'bsls/bsls_performancehint.h',
         'bsls/bsls_platform.h',
         'bsls/bsls_protocoltest.h',
@@ -259,6 +272,9 @@
         'bslstl/bslstl_bitset.h',
         'bslstl/bslstl_deque.h',
         'bslstl/bslstl_equalto.h',
+        'bslstl/bslstl_flathashmap.h',
+        'bslstl/bslstl_flathashset.h',
+        'bslstl/bslstl_flathashtable.h',
         'bslstl/bslstl_forwarditerator.h',
         'bslstl/bslstl_hash.h',
         'bslstl/bslstl_hashtable.h',
@@ -303,9 +319,11 @@
         'bsltf/bsltf_alloctesttype.h',
         'bsltf/bsltf_bitwisemoveabletesttype.h',
         'bsltf/bsltf_convertiblevaluewrapper.h',
+        'bsltf/bsltf_countedkey.h',
         'bsltf/bsltf_degeneratefunctor.h',
         'bsltf/bsltf_enumeratedtesttype.h',
         'bsltf/bsltf_evilbooleantype.h',
+        'bsltf/bsltf_managedtestallocator.h',
         'bsltf/bsltf_nonassignabletesttype.h',
         'bsltf/bsltf_noncopyconstructibletesttype.h',
         'bsltf/bsltf_nondefaultconstructibletesttype.h',
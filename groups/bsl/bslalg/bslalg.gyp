@@ -15,6 +15,7 @@
       'bslalg_dequeiterator.cpp',
       'bslalg_dequeprimitives.cpp',
       'bslalg_functoradapter.cpp',
+      'bslalg_hashedbidirectionalnode.cpp',
       'bslalg_hashtableanchor.cpp',
       'bslalg_hashtablebucket.cpp',
       'bslalg_hashtableimputil.cpp',
@@ -54,6 +55,7 @@
       'bslalg_dequeiterator.t',
       'bslalg_dequeprimitives.t',
       'bslalg_functoradapter.t',
+      'bslalg_hashedbidirectionalnode.t',
       'bslalg_hashtableanchor.t',
       'bslalg_hashtablebucket.t',
       'bslalg_hashtableimputil.t',
@@ -93,6 +95,7 @@
       '<(PRODUCT_DIR)/bslalg_dequeiterator.t',
       '<(PRODUCT_DIR)/bslalg_dequeprimitives.t',
       '<(PRODUCT_DIR)/bslalg_functoradapter.t',
+      '<(PRODUCT_DIR)/bslalg_hashedbidirectionalnode.t',
       '<(PRODUCT_DIR)/bslalg_hashtableanchor.t',
       '<(PRODUCT_DIR)/bslalg_hashtablebucket.t',
       '<(PRODUCT_DIR)/bslalg_hashtableimputil.t',
@@ -289,6 +292,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslalg_functoradapter.t.cpp' ],
     },
+    {
+      'target_name': 'bslalg_hashedbidirectionalnode.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslalg_pkgdeps)', 'bslalg' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslalg_hashedbidirectionalnode.t.cpp' ],
+    },
     {
       'target_name': 'bslalg_hashtableanchor.t',
       'type': 'executable',
@@ -325,9 +325,9 @@ class ContainerBase : public
         // is not properly aligned for 'T'.
 
     void deallocate(pointer p, size_type n = 1);
-        // Return memory previously allocated with 'allocate' to the underlying
-        // mechanism object by calling 'deallocate' on the mechanism object.
-        // The 'n' argument is ignored by this allocator type.
+        // Return the memory at the specified 'p', previously allocated with
+        // 'allocate' for the specified 'n' objects, to the allocator returned
+        // by 'allocator'.
 
     template <class T>
     void deallocateN(T *p, size_type n)
@@ -0,0 +1,228 @@
+// bslalg_hashedbidirectionalnode.h                                   -*-C++-*-
+#ifndef INCLUDED_BSLALG_HASHEDBIDIRECTIONALNODE
+#define INCLUDED_BSLALG_HASHEDBIDIRECTIONALNODE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a node holding a value and its hash code in a linked list.
+//
+//@CLASSES:
+//   bslalg::HashedBidirectionalNode : node holding a value and its hash code
+//
+//@SEE_ALSO: bslalg_bidirectionalnode, bslalg_hashtableimputil
+//
+//@DESCRIPTION: This component provides a single POD-like class,
+// 'bslalg::HashedBidirectionalNode', used to represent a node in a
+// doubly-linked (bidirectional) list holding a value of a parameterized type,
+// together with the (non-adjusted) hash code of that value.  A
+// 'bslalg::HashedBidirectionalNode' publicly derives from
+// 'bslalg::BidirectionalNode', so it may be used wherever a
+// 'bslalg::BidirectionalNode' of the same 'VALUE' type is expected (in
+// particular, with the functions of 'bslalg::HashTableImpUtil' that extract a
+// key from a link), and adds an attribute 'hashCode'.  The following
+// inheritance hierarchy diagram shows the classes involved and their methods:
+//..
+//               ,-------------------------------.
+//              ( bslalg::HashedBidirectionalNode )
+//               `-------------------------------'
+//                               |      hashCode
+//                               |      setHashCode
+//                               |      (all CREATORS unimplemented)
+//                               V
+//                  ,-------------------------.
+//                 ( bslalg::BidirectionalNode )
+//                  `-------------------------'
+//                               |      value
+//                               |      (all CREATORS unimplemented)
+//                               V
+//                  ,-------------------------.
+//                 ( bslalg::BidirectionalLink )
+//                  `-------------------------'
+//                                      ctor
+//                                      dtor
+//                                      setNextLink
+//                                      setPreviousLink
+//                                      nextLink
+//                                      previousLink
+//..
+// A hash table storing its elements in nodes of this type need compute the
+// hash code of each element only once, when the element is inserted: the
+// cached hash code can then be used to redistribute the element when the
+// table is rehashed, and to reject an element whose hash code differs from
+// that of a key being searched for without invoking the (potentially
+// expensive) key-equality comparator.
+//
+// This class is "POD-like" to facilitate efficient allocation and use in the
+// context of container implementations.  In order to meet the essential
+// requirements of a POD type, this 'class' does not define a constructor or
+// destructor.  The 'value' attribute should be constructed in-place, for
+// example, by the appropriate 'bsl::allocator_traits' methods, and the
+// 'hashCode' attribute should be set, using 'setHashCode', before it is read.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Caching the Hash Code of a String
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are implementing a container of strings that, to avoid hashing
+// each string more than once, caches the hash code of each string alongside
+// it.
+//
+// First, we define a simple (and poor) hash function for null-terminated
+// strings:
+//..
+//  native_std::size_t hashString(const char *string)
+//  {
+//      native_std::size_t result = 0;
+//      while (*string) {
+//          result = result * 31 + static_cast<unsigned char>(*string++);
+//      }
+//      return result;
+//  }
+//..
+// Then, in 'main', we allocate the footprint of a node from a test allocator:
+//..
+//  typedef bslalg::HashedBidirectionalNode<const char *> Node;
+//
+//  bslma::TestAllocator oa;
+//  Node *node = static_cast<Node *>(oa.allocate(sizeof(Node)));
+//..
+// Next, we initialize the links, the value, and the hash code of the node:
+//..
+//  node->setNextLink(0);
+//  node->setPreviousLink(0);
+//  node->value() = "hello world";
+//  node->setHashCode(hashString(node->value()));
+//..
+// Now, code that has access only to the 'bslalg::BidirectionalLink' base of
+// the node can recover the hash code without hashing the string again:
+//..
+//  bslalg::BidirectionalLink *link = node;
+//  assert(hashString("hello world") ==
+//                                 static_cast<Node *>(link)->hashCode());
+//..
+// Finally, we return the footprint of the node to the allocator (note that as
+// a 'const char *' is trivially destructible, there is no need to destroy the
+// 'value' attribute):
+//..
+//  oa.deallocate(node);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_BIDIRECTIONALNODE
+#include <bslalg_bidirectionalnode.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslalg {
+
+                       // =============================
+                       // class HashedBidirectionalNode
+                       // =============================
+
+template <class VALUE>
+class HashedBidirectionalNode : public bslalg::BidirectionalNode<VALUE> {
+    // This POD-like 'class' describes a node suitable for use in a
+    // doubly-linked list of values of the template parameter type 'VALUE',
+    // that additionally stores the hash code of its value.  This class is
+    // "POD-like" to facilitate efficient allocation and use in the context of
+    // a container implementation.  In order to meet the essential
+    // requirements of a POD type, this 'class' does not define a constructor
+    // or destructor.  Note that the 'value' attribute is inherited from
+    // 'BidirectionalNode<VALUE>', so that a pointer to an object of this
+    // class may be safely converted to a pointer to its base class.
+
+  private:
+    // DATA
+    native_std::size_t d_hashCode;  // hash code of the value of this node
+
+    // The following creators are not defined because a
+    // 'HashedBidirectionalNode' should never be constructed, destructed, or
+    // assigned.
+
+  private:
+    // NOT IMPLEMENTED
+    HashedBidirectionalNode();
+    HashedBidirectionalNode(const HashedBidirectionalNode&);
+    HashedBidirectionalNode& operator=(const HashedBidirectionalNode&);
+    ~HashedBidirectionalNode();
+
+  public:
+    // MANIPULATORS
+    void setHashCode(native_std::size_t value);
+        // Set the 'hashCode' attribute of this object to the specified
+        // 'value'.
+
+    // ACCESSORS
+    native_std::size_t hashCode() const;
+        // Return the 'hashCode' attribute of this object.  The behavior is
+        // undefined unless 'setHashCode' has been called on this object.
+};
+
+// ===========================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ===========================================================================
+
+                       // -----------------------------
+                       // class HashedBidirectionalNode
+                       // -----------------------------
+
+// MANIPULATORS
+template <class VALUE>
+inline
+void HashedBidirectionalNode<VALUE>::setHashCode(native_std::size_t value)
+{
+    d_hashCode = value;
+}
+
+// ACCESSORS
+template <class VALUE>
+inline
+native_std::size_t HashedBidirectionalNode<VALUE>::hashCode() const
+{
+    return d_hashCode;
+}
+
+}  // close namespace bslalg
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
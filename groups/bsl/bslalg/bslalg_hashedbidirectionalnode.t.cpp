@@ -0,0 +1,374 @@
+// bslalg_hashedbidirectionalnode.t.cpp                               -*-C++-*-
+#include <bslalg_hashedbidirectionalnode.h>
+
+#include <bslalg_bidirectionallink.h>
+#include <bslalg_bidirectionalnode.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+
+#include <cstddef>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a POD-like class template that adds a single
+// 'hashCode' attribute to 'bslalg::BidirectionalNode'.  As the class cannot be
+// constructed, each test allocates the footprint of a node from a test
+// allocator, and exercises the attributes of the node in place.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//-----------------------------------------------------------------------------
+// [ 2] void setHashCode(size_t value);
+// [ 2] size_t hashCode() const;
+// [ 3] BASE CLASS MANIPULATORS AND ACCESSORS
+// ----------------------------------------------------------------------------
+// [ 4] USAGE EXAMPLE
+// [ 1] BREATHING TEST
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                             USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Caching the Hash Code of a String
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are implementing a container of strings that, to avoid hashing
+// each string more than once, caches the hash code of each string alongside
+// it.
+//
+// First, we define a simple (and poor) hash function for null-terminated
+// strings:
+//..
+    native_std::size_t hashString(const char *string)
+    {
+        native_std::size_t result = 0;
+        while (*string) {
+            result = result * 31 + static_cast<unsigned char>(*string++);
+        }
+        return result;
+    }
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+//  bool veryVeryVerbose     = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: In no case is memory allocated from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, in 'main', we allocate the footprint of a node from a test allocator:
+//..
+        typedef bslalg::HashedBidirectionalNode<const char *> Node;
+
+        bslma::TestAllocator oa;
+        Node *node = static_cast<Node *>(oa.allocate(sizeof(Node)));
+//..
+// Next, we initialize the links, the value, and the hash code of the node:
+//..
+        node->setNextLink(0);
+        node->setPreviousLink(0);
+        node->value() = "hello world";
+        node->setHashCode(hashString(node->value()));
+//..
+// Now, code that has access only to the 'bslalg::BidirectionalLink' base of
+// the node can recover the hash code without hashing the string again:
+//..
+        bslalg::BidirectionalLink *link = node;
+        ASSERT(hashString("hello world") ==
+                                       static_cast<Node *>(link)->hashCode());
+//..
+// Finally, we return the footprint of the node to the allocator (note that as
+// a 'const char *' is trivially destructible, there is no need to destroy the
+// 'value' attribute):
+//..
+        oa.deallocate(node);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // BASE CLASS MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A pointer to a 'HashedBidirectionalNode' converts to a pointer to
+        //:   its 'BidirectionalNode' and 'BidirectionalLink' bases, and back,
+        //:   with 'static_cast'.
+        //:
+        //: 2 The 'value' attribute accessed through the 'BidirectionalNode'
+        //:   base is the same object as that accessed through the derived
+        //:   class.
+        //:
+        //: 3 Setting the 'value' or the links does not affect the 'hashCode'
+        //:   attribute, and vice versa.
+        //
+        // Plan:
+        //: 1 Allocate the footprint of a node, and set each attribute through
+        //:   a pointer to each base class in turn, verifying all attributes
+        //:   through the derived class after each assignment.  (C-1..3)
+        //
+        // Testing:
+        //   BASE CLASS MANIPULATORS AND ACCESSORS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBASE CLASS MANIPULATORS AND ACCESSORS"
+                            "\n=====================================\n");
+
+        typedef bslalg::HashedBidirectionalNode<int> Obj;
+        typedef bslalg::BidirectionalNode<int>       Base;
+        typedef bslalg::BidirectionalLink            Link;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj *xPtr = static_cast<Obj *>(oa.allocate(sizeof(Obj)));
+        Obj& mX = *xPtr; const Obj& X = mX;
+
+        Link *link = xPtr;
+        Base *base = xPtr;
+
+        ASSERT(static_cast<Obj *>(link) == xPtr);
+        ASSERT(static_cast<Obj *>(base) == xPtr);
+        ASSERT(static_cast<Base *>(link) == base);
+
+        mX.setHashCode(42);
+        base->value() = 7;
+        link->setNextLink(link);
+        link->setPreviousLink(0);
+
+        ASSERTV(X.value(),    7 == X.value());
+        ASSERTV(X.hashCode(), 42 == X.hashCode());
+        ASSERT(link == X.nextLink());
+        ASSERT(0    == X.previousLink());
+
+        mX.setHashCode(~static_cast<native_std::size_t>(0));
+        ASSERTV(base->value(), 7 == base->value());
+        ASSERT(link == link->nextLink());
+
+        base->value() = -1;
+        ASSERT(~static_cast<native_std::size_t>(0) == X.hashCode());
+
+        oa.deallocate(xPtr);
+        ASSERTV(0 == oa.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 'hashCode' returns the value most recently passed to
+        //:   'setHashCode'.
+        //:
+        //: 2 The full range of 'size_t' values can be stored.
+        //:
+        //: 3 'hashCode' is declared 'const'.
+        //
+        // Plan:
+        //: 1 For a sequence of values spanning the range of 'size_t', set the
+        //:   'hashCode' attribute, and verify the value returned through a
+        //:   'const' reference.  (C-1..3)
+        //
+        // Testing:
+        //   void setHashCode(size_t value);
+        //   size_t hashCode() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMANIPULATORS AND ACCESSORS"
+                            "\n==========================\n");
+
+        typedef bslalg::HashedBidirectionalNode<double> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj *xPtr = static_cast<Obj *>(oa.allocate(sizeof(Obj)));
+        Obj& mX = *xPtr; const Obj& X = mX;
+
+        const native_std::size_t MAX = ~static_cast<native_std::size_t>(0);
+        const native_std::size_t VALUES[] = {
+            0, 1, 2, 127, 128, 0xFFFF, 0x12345678, MAX / 2, MAX - 1, MAX
+        };
+        const int NUM_VALUES = static_cast<int>(sizeof VALUES
+                                                / sizeof *VALUES);
+
+        for (int ti = 0; ti < NUM_VALUES; ++ti) {
+            const native_std::size_t VALUE = VALUES[ti];
+
+            if (veryVerbose) { T_ P_(ti) P(VALUE) }
+
+            mX.setHashCode(VALUE);
+            ASSERTV(ti, VALUE == X.hashCode());
+        }
+
+        oa.deallocate(xPtr);
+        ASSERTV(0 == oa.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator da("default");
+        bslma::DefaultAllocatorGuard defaultGuard(&da);
+
+        typedef bslalg::HashedBidirectionalNode<int> Obj;
+
+        ASSERT(sizeof(bslalg::BidirectionalNode<int>) < sizeof(Obj));
+
+        Obj *xPtr = static_cast<Obj *>(da.allocate(sizeof(Obj)));
+        Obj& mX = *xPtr; const Obj& X = mX;
+
+        mX.value() = 0;
+        mX.setHashCode(0);
+        ASSERTV(X.value(),    0 == X.value());
+        ASSERTV(X.hashCode(), 0 == X.hashCode());
+
+        mX.value() = 1;
+        mX.setHashCode(2);
+        ASSERTV(X.value(),    1 == X.value());
+        ASSERTV(X.hashCode(), 2 == X.hashCode());
+
+        da.deallocate(&mX);
+        ASSERTV(0 == da.numBytesInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case is memory allocated from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
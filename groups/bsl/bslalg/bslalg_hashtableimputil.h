@@ -71,7 +71,13 @@ BSLS_IDENT("$Id: $")
 // is more resilient to pathological behaviors when used in conjunction with a
 // hash function that may produce contiguous hash values (with the 'div' method
 // lower order bits do not participate to the final adjusted value); however,
-// the means of adjustment may change in the future.
+// the means of adjustment may change in the future.  When the number of
+// buckets is a power of two, the modulo is computed by masking the low-order
+// bits of the hash value, which produces the same adjusted value without the
+// cost of an integer division.  Hash tables that size their bucket arrays in
+// powers of two should therefore ensure that the low-order bits of the hash
+// codes they supply are well distributed (e.g., by post-mixing the value
+// returned by the user-supplied hash function).
 //
 ///Well-Formed 'HashTableAnchor' Objects
 ///--------------------------------------
@@ -96,6 +102,20 @@ BSLS_IDENT("$Id: $")
 //:   'computeBucketIndex(HASHER(extractKey(link)' is the index of the bucket,
 //:   and no other nodes.
 //
+///Cached Hash Codes
+///------------------
+// A hash table whose nodes are of type
+// 'HashedBidirectionalNode<KEY_CONFIG::ValueType>' (see
+// 'bslalg_hashedbidirectionalnode') stores the (non-adjusted) hash code of
+// each element in the node holding that element.  Such a hash table can use
+// 'findUsingCachedHashCodes', which compares the hash code of each node in
+// the searched bucket with the hash code of the sought key before invoking the
+// (potentially expensive) key-equality functor, and
+// 'rehashUsingCachedHashCodes', which redistributes the nodes of the table
+// without invoking a hash functor.  It is the responsibility of the hash table
+// to set the hash code of each node (using
+// 'HashedBidirectionalNode::setHashCode') before inserting the node.
+//
 ///'KEY_CONFIG' Template Parameter
 ///-------------------------------
 // Several of the operations provided by 'HashTableImpUtil' are template
@@ -510,6 +530,10 @@ BSLS_IDENT("$Id: $")
 #include <bslalg_bidirectionalnode.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_HASHEDBIDIRECTIONALNODE
+#include <bslalg_hashedbidirectionalnode.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_HASHTABLEANCHOR
 #include <bslalg_hashtableanchor.h>
 #endif
@@ -585,6 +609,52 @@ struct HashTableImpUtil_ExtractKeyResult {
                                       KeyType>::type>::type Type;
 };
 
+                      // ================================
+                      // class HashTableImpUtil_KeyHasher
+                      // ================================
+
+template <class KEY_CONFIG, class HASHER>
+class HashTableImpUtil_KeyHasher {
+    // This component-private class provides a functor that returns the hash
+    // code of the key held by a link, as computed by a (template parameter)
+    // 'HASHER' functor.  The behavior is undefined unless each link supplied
+    // to this functor refers to a node of type
+    // 'BidirectionalNode<KEY_CONFIG::ValueType>'.
+
+    // DATA
+    const HASHER& d_hasher;  // functor computing the hash code of a key
+
+  private:
+    // NOT IMPLEMENTED
+    HashTableImpUtil_KeyHasher& operator=(const HashTableImpUtil_KeyHasher&);
+
+  public:
+    // CREATORS
+    explicit HashTableImpUtil_KeyHasher(const HASHER& hasher);
+        // Create a 'HashTableImpUtil_KeyHasher' object that uses the specified
+        // 'hasher' to compute the hash code of the key held by a link.
+
+    // ACCESSORS
+    native_std::size_t operator()(BidirectionalLink *link) const;
+        // Return the hash code of the key held by the specified 'link'.
+};
+
+                    // ====================================
+                    // class HashTableImpUtil_CachedHasher
+                    // ====================================
+
+template <class KEY_CONFIG>
+struct HashTableImpUtil_CachedHasher {
+    // This component-private class provides a functor that returns the hash
+    // code cached in a link.  The behavior is undefined unless each link
+    // supplied to this functor refers to a node of type
+    // 'HashedBidirectionalNode<KEY_CONFIG::ValueType>'.
+
+    // ACCESSORS
+    native_std::size_t operator()(BidirectionalLink *link) const;
+        // Return the hash code cached in the specified 'link'.
+};
+
                           // ======================
                           // class HashTableImpUtil
                           // ======================
@@ -607,6 +677,46 @@ struct HashTableImpUtil {
         // 'computeBucketIndex').  The behavior is undefined if 'anchor'
         // has 0 buckets.
 
+    template <class LINK_HASHER>
+    static void rehashImp(HashTableAnchor    *newAnchor,
+                          BidirectionalLink  *elementList,
+                          const LINK_HASHER&  linkHasher);
+        // Populate the specified 'newAnchor' with all the elements in the
+        // specified 'elementList', using the specified 'linkHasher' to obtain
+        // the (non-adjusted) hash code of each link.  'LINK_HASHER' shall be a
+        // functor that can be called as if it had the following signature:
+        //..
+        //  native_std::size_t operator()(BidirectionalLink *link) const;
+        //..
+        // See 'rehash' for the remaining contract of this function.
+
+    template <class KEY_CONFIG, class KEY_EQUAL, class LOOKUP_KEY>
+    static BidirectionalLink *findImp(const HashTableAnchor&  anchor,
+                                      LOOKUP_KEY&             key,
+                                      const KEY_EQUAL&        equalityFunctor,
+                                      native_std::size_t      hashCode);
+        // Return the address of the first link in the bucket of the specified
+        // 'anchor' that holds elements with the specified 'hashCode' having a
+        // value matching (according to the specified 'equalityFunctor') the
+        // specified 'key', and 0 if no such link exists.  See 'find' for the
+        // remaining contract of this function.  Note that the (template
+        // parameter) type 'LOOKUP_KEY' may be 'const'-qualified, so that 'key'
+        // is supplied to 'equalityFunctor' with the same 'const'-ness as it
+        // was supplied to 'find'.
+
+    template <class KEY_CONFIG, class KEY_EQUAL, class LOOKUP_KEY>
+    static BidirectionalLink *findUsingCachedHashCodesImp(
+                                     const HashTableAnchor&  anchor,
+                                     LOOKUP_KEY&             key,
+                                     const KEY_EQUAL&        equalityFunctor,
+                                     native_std::size_t      hashCode);
+        // Return the address of the first link in the bucket of the specified
+        // 'anchor' that holds elements with the specified 'hashCode' having a
+        // cached hash code equal to 'hashCode' and a value matching (according
+        // to the specified 'equalityFunctor') the specified 'key', and 0 if no
+        // such link exists.  See 'findUsingCachedHashCodes' for the remaining
+        // contract of this function.
+
   public:
     // CLASS METHODS
     static bool bucketContainsLink(const HashTableBucket&  bucket,
@@ -677,6 +787,9 @@ struct HashTableImpUtil {
         // specified 'hashCode', where 'hashCode' (and the
         // hash-codes of the elements) are adjusted for the specified
         // 'numBuckets'.  The behavior is undefined if 'numBuckets' is 0.
+        // Note that the adjusted value is 'hashCode % numBuckets', and that
+        // it is computed without an integer division if 'numBuckets' is a
+        // power of two.
 
     static void insertAtFrontOfBucket(HashTableAnchor    *anchor,
                                       BidirectionalLink  *link,
@@ -727,12 +840,16 @@ struct HashTableImpUtil {
         // a node of type 'BidirectionalNode<KEY_CONFIG::ValueType>' and
         // 'HASHER(extractKey<KEY_CONFIG>(link))' returns 'hashCode'.
 
-    template <class KEY_CONFIG, class KEY_EQUAL>
-    static BidirectionalLink *find(
-              const HashTableAnchor&                                    anchor,
-              typename HashTableImpUtil_ExtractKeyResult<KEY_CONFIG>::Type key,
-              const KEY_EQUAL&                                 equalityFunctor,
-              native_std::size_t                                     hashCode);
+    template <class KEY_CONFIG, class KEY_EQUAL, class LOOKUP_KEY>
+    static BidirectionalLink *find(const HashTableAnchor&  anchor,
+                                   LOOKUP_KEY&             key,
+                                   const KEY_EQUAL&        equalityFunctor,
+                                   native_std::size_t      hashCode);
+    template <class KEY_CONFIG, class KEY_EQUAL, class LOOKUP_KEY>
+    static BidirectionalLink *find(const HashTableAnchor&  anchor,
+                                   const LOOKUP_KEY&       key,
+                                   const KEY_EQUAL&        equalityFunctor,
+                                   native_std::size_t      hashCode);
         // Return the address of the first link in the list element of
         // the specified 'anchor', having a value matching (according to the
         // specified 'equalityFunctor') the specified 'key' in the bucket that
@@ -750,9 +867,37 @@ struct HashTableImpUtil {
         // 'KEY_EQUAL' shall be a functor that can be called as if it had the
         // following signature:
         //..
-        //  bool operator()(const KEY_CONFIG::KeyType& key1,
+        //  bool operator()(const LOOKUP_KEY&          key1,
         //                  const KEY_CONFIG::KeyType& key2)
         //..
+        // Note that the (template parameter) type 'LOOKUP_KEY' is deduced, and
+        // is usually 'KEY_CONFIG::KeyType'; a different type may be supplied
+        // for heterogeneous lookup if 'KEY_EQUAL' can compare it with a
+        // 'KEY_CONFIG::KeyType' directly.  Also note that a modifiable 'key'
+        // is supplied to 'equalityFunctor' as a modifiable reference.
+
+    template <class KEY_CONFIG, class KEY_EQUAL, class LOOKUP_KEY>
+    static BidirectionalLink *findUsingCachedHashCodes(
+                                    const HashTableAnchor&  anchor,
+                                    LOOKUP_KEY&             key,
+                                    const KEY_EQUAL&        equalityFunctor,
+                                    native_std::size_t      hashCode);
+    template <class KEY_CONFIG, class KEY_EQUAL, class LOOKUP_KEY>
+    static BidirectionalLink *findUsingCachedHashCodes(
+                                    const HashTableAnchor&  anchor,
+                                    const LOOKUP_KEY&       key,
+                                    const KEY_EQUAL&        equalityFunctor,
+                                    native_std::size_t      hashCode);
+        // Return the address of the first link in the list element of the
+        // specified 'anchor', having a value matching (according to the
+        // specified 'equalityFunctor') the specified 'key' in the bucket that
+        // holds elements with the specified 'hashCode' if such a link exists,
+        // and return 0 otherwise.  'equalityFunctor' is invoked only for those
+        // links in the bucket whose cached hash code is equal to 'hashCode'.
+        // The behavior is undefined unless each link in 'anchor' refers to a
+        // node of type 'HashedBidirectionalNode<KEY_CONFIG::ValueType>' whose
+        // hash code has been set to the (non-adjusted) hash code of its key,
+        // and the requirements of 'find' are otherwise met.
 
     template <class KEY_CONFIG, class HASHER>
     static void rehash(HashTableAnchor   *newAnchor,
@@ -771,12 +916,66 @@ struct HashTableImpUtil {
         // whose nodes are each of type
         // 'BidirectionalNode<KEY_CONFIG::ValueType>', the previous address of
         // the first node and the next address of the last node are 0.
+
+    template <class KEY_CONFIG>
+    static void rehashUsingCachedHashCodes(HashTableAnchor   *newAnchor,
+                                           BidirectionalLink *elementList);
+        // Populate the specified 'newAnchor' with all the elements in the
+        // specified 'elementList', using the hash code cached in each node to
+        // determine the bucket of that node.  This operation does not throw.
+        // The buckets in the array in 'newAnchor' and the list root address in
+        // 'newAnchor' are assumed to be garbage and overwritten.  The behavior
+        // is undefined unless 'newAnchor' has one or more (empty) buckets, and
+        // 'elementList' is a well-formed bi-directional list (see
+        // 'BidirectionalLinkListUtil::isWellFormed') whose nodes are each of
+        // type 'HashedBidirectionalNode<KEY_CONFIG::ValueType>' having a set
+        // hash code, the previous address of the first node and the next
+        // address of the last node are 0.
 };
 
 // ===========================================================================
 //                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
 // ===========================================================================
 
+                      //---------------------------------
+                      // class HashTableImpUtil_KeyHasher
+                      //---------------------------------
+
+// CREATORS
+template <class KEY_CONFIG, class HASHER>
+inline
+HashTableImpUtil_KeyHasher<KEY_CONFIG, HASHER>::HashTableImpUtil_KeyHasher(
+                                                         const HASHER& hasher)
+: d_hasher(hasher)
+{
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class HASHER>
+inline
+native_std::size_t
+HashTableImpUtil_KeyHasher<KEY_CONFIG, HASHER>::operator()(
+                                                 BidirectionalLink *link) const
+{
+    return d_hasher(HashTableImpUtil::extractKey<KEY_CONFIG>(link));
+}
+
+                    //------------------------------------
+                    // class HashTableImpUtil_CachedHasher
+                    //------------------------------------
+
+// ACCESSORS
+template <class KEY_CONFIG>
+inline
+native_std::size_t HashTableImpUtil_CachedHasher<KEY_CONFIG>::operator()(
+                                                 BidirectionalLink *link) const
+{
+    BSLS_ASSERT_SAFE(link);
+
+    typedef HashedBidirectionalNode<typename KEY_CONFIG::ValueType> HNode;
+    return static_cast<HNode *>(link)->hashCode();
+}
+
                         //-----------------------
                         // class HashTableImpUtil
                         //-----------------------
@@ -796,6 +995,80 @@ HashTableBucket *HashTableImpUtil::findBucketForHashCode(
     return &(anchor.bucketArrayAddress()[bucketId]);
 }
 
+template <class LINK_HASHER>
+void HashTableImpUtil::rehashImp(HashTableAnchor    *newAnchor,
+                                 BidirectionalLink  *elementList,
+                                 const LINK_HASHER&  linkHasher)
+{
+    BSLS_ASSERT_SAFE(newAnchor);
+    BSLS_ASSERT_SAFE(newAnchor->bucketArrayAddress());
+    BSLS_ASSERT_SAFE(0 != newAnchor->bucketArraySize());
+    BSLS_ASSERT_SAFE(!elementList || !elementList->previousLink());
+
+    class Proctor {
+        // An object of this proctor class guarnatees that, on leaving scope,
+        // any remaining elements in the original specified 'elementList' are
+        // spliced to the front of the list rooted in the specified 'newAnchor'
+        // so that there is only one list for the client to clear if an
+        // exception is thrown by a user supplied hash functor.  Note that it
+        // might be possible to avoid creating such a proctor in C++11 if the
+        // hash functor is determined to be 'noexcept'.
+
+      private:
+        BidirectionalLink **d_sourceList;
+        HashTableAnchor    *d_targetAnchor;
+
+#if !defined(BSLS_PLATFORM_CMP_MSVC)           // Microsoft warns if these
+        Proctor(const Proctor&); // = delete;  // methods are declared private.
+        Proctor& operator=(const Proctor&); // = delete;
+#endif
+
+      public:
+        Proctor(BidirectionalLink **sourceList,
+                HashTableAnchor    *targetAnchor)
+        : d_sourceList(sourceList)
+        , d_targetAnchor(targetAnchor)
+        {
+            BSLS_ASSERT(sourceList);
+            BSLS_ASSERT(targetAnchor);
+        }
+
+        ~Proctor()
+        {
+            if (BidirectionalLink *lastLink = *d_sourceList) {
+                for( ; lastLink->nextLink(); lastLink = lastLink->nextLink()) {
+                    // This loop body is intentionally left blank.
+                }
+                BidirectionalLinkListUtil::spliceListBeforeTarget(
+                                           *d_sourceList,
+                                            lastLink,
+                                            d_targetAnchor->listRootAddress());
+            }
+        }
+    };
+
+    // The callers of this function should be rewritten to take into account
+    // that it is the responsibility of this function, not its callers, to zero
+    // out the buckets.
+
+    for (void **cursor     = (void **)  newAnchor->bucketArrayAddress(),
+              ** const end = (void **) (newAnchor->bucketArrayAddress() +
+                                        newAnchor->bucketArraySize());
+                                                      cursor < end; ++cursor) {
+        *cursor = 0;
+    }
+    newAnchor->setListRootAddress(0);
+
+    Proctor enforceSingleListOnExit(&elementList, newAnchor);
+
+    while (elementList) {
+        BidirectionalLink *nextNode = elementList;
+        elementList = elementList->nextLink();
+
+        insertAtBackOfBucket(newAnchor, nextNode, linkHasher(nextNode));
+    }
+}
+
 inline
 native_std::size_t HashTableImpUtil::computeBucketIndex(
                                                  native_std::size_t hashCode,
@@ -803,7 +1076,9 @@ native_std::size_t HashTableImpUtil::computeBucketIndex(
 {
     BSLS_ASSERT_SAFE(0 != numBuckets);
 
-    return hashCode % numBuckets;
+    const native_std::size_t mask = numBuckets - 1;
+    return 0 == (numBuckets & mask) ? hashCode & mask
+                                    : hashCode % numBuckets;
 }
 
 inline
@@ -852,13 +1127,13 @@ HashTableImpUtil::extractKey(BidirectionalLink *link)
     return KEY_CONFIG::extractKey(node->value());
 }
 
-template <class KEY_CONFIG, class KEY_EQUAL>
+template <class KEY_CONFIG, class KEY_EQUAL, class LOOKUP_KEY>
 inline
-BidirectionalLink *HashTableImpUtil::find(
-  const HashTableAnchor&                                       anchor,
-  typename HashTableImpUtil_ExtractKeyResult<KEY_CONFIG>::Type key,
-  const KEY_EQUAL&                                             equalityFunctor,
-  native_std::size_t                                           hashCode)
+BidirectionalLink *HashTableImpUtil::findImp(
+                                     const HashTableAnchor&  anchor,
+                                     LOOKUP_KEY&             key,
+                                     const KEY_EQUAL&        equalityFunctor,
+                                     native_std::size_t      hashCode)
 {
     BSLS_ASSERT_SAFE(anchor.bucketArrayAddress());
     BSLS_ASSERT_SAFE(anchor.bucketArraySize());
@@ -877,80 +1152,104 @@ BidirectionalLink *HashTableImpUtil::find(
     return 0;
 }
 
-template <class KEY_CONFIG, class HASHER>
-void HashTableImpUtil::rehash(HashTableAnchor   *newAnchor,
-                              BidirectionalLink *elementList,
-                              const HASHER&      hasher)
+template <class KEY_CONFIG, class KEY_EQUAL, class LOOKUP_KEY>
+inline
+BidirectionalLink *HashTableImpUtil::findUsingCachedHashCodesImp(
+                                     const HashTableAnchor&  anchor,
+                                     LOOKUP_KEY&             key,
+                                     const KEY_EQUAL&        equalityFunctor,
+                                     native_std::size_t      hashCode)
 {
-    BSLS_ASSERT_SAFE(newAnchor);
-    BSLS_ASSERT_SAFE(newAnchor->bucketArrayAddress());
-    BSLS_ASSERT_SAFE(0 != newAnchor->bucketArraySize());
-    BSLS_ASSERT_SAFE(!elementList || !elementList->previousLink());
-
-    class Proctor {
-        // An object of this proctor class guarnatees that, on leaving scope,
-        // any remaining elements in the original specified 'elementList' are
-        // spliced to the front of the list rooted in the specified 'newAnchor'
-        // so that there is only one list for the client to clear if an
-        // exception is thrown by a user supplied hash functor.  Note that it
-        // might be possible to avoid creating such a proctor in C++11 if the
-        // hash functor is determined to be 'noexcept'.
+    BSLS_ASSERT_SAFE(anchor.bucketArrayAddress());
+    BSLS_ASSERT_SAFE(anchor.bucketArraySize());
 
-      private:
-        BidirectionalLink **d_sourceList;
-        HashTableAnchor    *d_targetAnchor;
+    typedef HashedBidirectionalNode<typename KEY_CONFIG::ValueType> HNode;
 
-#if !defined(BSLS_PLATFORM_CMP_MSVC)           // Microsoft warns if these
-        Proctor(const Proctor&); // = delete;  // methods are declared private.
-        Proctor& operator=(const Proctor&); // = delete;
-#endif
+    const HashTableBucket *bucket = findBucketForHashCode(anchor, hashCode);
+    BSLS_ASSERT_SAFE(bucket);
 
-      public:
-        Proctor(BidirectionalLink **sourceList,
-                HashTableAnchor    *targetAnchor)
-        : d_sourceList(sourceList)
-        , d_targetAnchor(targetAnchor)
-        {
-            BSLS_ASSERT(sourceList);
-            BSLS_ASSERT(targetAnchor);
+    for (BidirectionalLink *cursor     = bucket->first(),
+                           * const end = bucket->end();
+                                 end != cursor; cursor = cursor->nextLink() ) {
+        if (hashCode == static_cast<HNode *>(cursor)->hashCode()
+         && equalityFunctor(key, extractKey<KEY_CONFIG>(cursor))) {
+            return cursor;                                            // RETURN
         }
+    }
 
-        ~Proctor()
-        {
-            if (BidirectionalLink *lastLink = *d_sourceList) {
-                for( ; lastLink->nextLink(); lastLink = lastLink->nextLink()) {
-                    // This loop body is intentionally left blank.
-                }
-                BidirectionalLinkListUtil::spliceListBeforeTarget(
-                                           *d_sourceList,
-                                            lastLink,
-                                            d_targetAnchor->listRootAddress());
-            }
-        }
-    };
+    return 0;
+}
 
-    // The callers of this function should be rewritten to take into account
-    // that it is the responsibility of this function, not its callers, to zero
-    // out the buckets.
+template <class KEY_CONFIG, class KEY_EQUAL, class LOOKUP_KEY>
+inline
+BidirectionalLink *HashTableImpUtil::find(
+                                     const HashTableAnchor&  anchor,
+                                     LOOKUP_KEY&             key,
+                                     const KEY_EQUAL&        equalityFunctor,
+                                     native_std::size_t      hashCode)
+{
+    return findImp<KEY_CONFIG>(anchor, key, equalityFunctor, hashCode);
+}
 
-    for (void **cursor     = (void **)  newAnchor->bucketArrayAddress(),
-              ** const end = (void **) (newAnchor->bucketArrayAddress() +
-                                        newAnchor->bucketArraySize());
-                                                      cursor < end; ++cursor) {
-        *cursor = 0;
-    }
-    newAnchor->setListRootAddress(0);
+template <class KEY_CONFIG, class KEY_EQUAL, class LOOKUP_KEY>
+inline
+BidirectionalLink *HashTableImpUtil::find(
+                                     const HashTableAnchor&  anchor,
+                                     const LOOKUP_KEY&       key,
+                                     const KEY_EQUAL&        equalityFunctor,
+                                     native_std::size_t      hashCode)
+{
+    return findImp<KEY_CONFIG>(anchor, key, equalityFunctor, hashCode);
+}
 
-    Proctor enforceSingleListOnExit(&elementList, newAnchor);
+template <class KEY_CONFIG, class KEY_EQUAL, class LOOKUP_KEY>
+inline
+BidirectionalLink *HashTableImpUtil::findUsingCachedHashCodes(
+                                     const HashTableAnchor&  anchor,
+                                     LOOKUP_KEY&             key,
+                                     const KEY_EQUAL&        equalityFunctor,
+                                     native_std::size_t      hashCode)
+{
+    return findUsingCachedHashCodesImp<KEY_CONFIG>(anchor,
+                                                   key,
+                                                   equalityFunctor,
+                                                   hashCode);
+}
 
-    while (elementList) {
-        BidirectionalLink *nextNode = elementList;
-        elementList = elementList->nextLink();
+template <class KEY_CONFIG, class KEY_EQUAL, class LOOKUP_KEY>
+inline
+BidirectionalLink *HashTableImpUtil::findUsingCachedHashCodes(
+                                     const HashTableAnchor&  anchor,
+                                     const LOOKUP_KEY&       key,
+                                     const KEY_EQUAL&        equalityFunctor,
+                                     native_std::size_t      hashCode)
+{
+    return findUsingCachedHashCodesImp<KEY_CONFIG>(anchor,
+                                                   key,
+                                                   equalityFunctor,
+                                                   hashCode);
+}
 
-        insertAtBackOfBucket(newAnchor,
-                             nextNode,
-                             hasher(extractKey<KEY_CONFIG>(nextNode)));
-    }
+template <class KEY_CONFIG, class HASHER>
+inline
+void HashTableImpUtil::rehash(HashTableAnchor   *newAnchor,
+                              BidirectionalLink *elementList,
+                              const HASHER&      hasher)
+{
+    rehashImp(newAnchor,
+              elementList,
+              HashTableImpUtil_KeyHasher<KEY_CONFIG, HASHER>(hasher));
+}
+
+template <class KEY_CONFIG>
+inline
+void HashTableImpUtil::rehashUsingCachedHashCodes(
+                                         HashTableAnchor   *newAnchor,
+                                         BidirectionalLink *elementList)
+{
+    rehashImp(newAnchor,
+              elementList,
+              HashTableImpUtil_CachedHasher<KEY_CONFIG>());
 }
 
 template <class KEY_CONFIG, class HASHER>
@@ -4,6 +4,7 @@
 
 #include <bslalg_bidirectionallinklistutil.h>
 #include <bslalg_bidirectionalnode.h>
+#include <bslalg_hashedbidirectionalnode.h>
 #include <bslalg_hashtablebucket.h>
 #include <bslalg_scalardestructionprimitives.h>
 #include <bslalg_scalarprimitives.h>
@@ -45,6 +46,8 @@ using namespace BloombergLP::bslalg;
 // ----------------------------------------------------------------------------
 // [  ] ...
 // ----------------------------------------------------------------------------
+// [12] findUsingCachedHashCodes(const Anchor& a, key, comparator, h);
+// [12] rehashUsingCachedHashCodes(Anchor *a, BidirectionalLink *r);
 // [10] remove(HashTableAnchor *a, BidirectionalLink *l, size_t  h);
 // [10] bucketContainsLink(const Bucket& b, BidirectionalLink *l);
 // [ 9] find(const HashTableAnchor& a, KeyType& key, comparator, size_t h);
@@ -335,6 +338,28 @@ struct Mod8Hasher {
     }
 };
 
+struct Mod16Hasher {
+    size_t operator()(int value) const
+    {
+        return value & 15;
+    }
+};
+
+struct CountingIntEquals {
+    // This functor compares two 'int' values for equality, and counts the
+    // number of comparisons it has performed.
+
+    int *d_count_p;  // number of comparisons (held, not owned)
+
+    explicit CountingIntEquals(int *count) : d_count_p(count) {}
+
+    bool operator()(int lhs, int rhs) const
+    {
+        ++*d_count_p;
+        return lhs == rhs;
+    }
+};
+
 template <class HASHER, class POLICY>
 struct HashNodeUsingHasherAndPolicy {
     HASHER d_hasher;
@@ -667,7 +692,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -748,6 +773,123 @@ int main(int argc, char *argv[])
         ASSERT(0 == hs.count("chomp"));
 //..
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING CACHED HASH CODES
+        //
+        // Concerns:
+        //: 1 'findUsingCachedHashCodes' returns the same link as 'find' for
+        //:   every key, whether or not the key is present.
+        //:
+        //: 2 'findUsingCachedHashCodes' invokes the equality functor only for
+        //:   links whose cached hash code matches the sought hash code.
+        //:
+        //: 3 Links whose keys differ but whose hash codes collide are still
+        //:   distinguished by the equality functor.
+        //:
+        //: 4 'rehashUsingCachedHashCodes' redistributes all links to the
+        //:   buckets selected by their cached hash codes, producing a
+        //:   well-formed anchor.
+        //
+        // Plan:
+        //: 1 Create 'HashedBidirectionalNode<int>' nodes holding the values
+        //:   '[0 .. 16]', caching the hash code 'value & 15' in each node so
+        //:   that 0 and 16 collide, and insert them into an anchor having 4
+        //:   buckets.
+        //:
+        //: 2 For every key in '[0 .. 20]', compare the result of
+        //:   'findUsingCachedHashCodes' with that of 'find', and verify,
+        //:   using a counting equality functor, that the number of
+        //:   comparisons is the number of nodes having the same hash code.
+        //:   (C-1..3)
+        //:
+        //: 3 Rehash the list into an anchor having 8 buckets, verify that the
+        //:   result is well-formed, and repeat P-2.  (C-4)
+        //
+        // Testing:
+        //   findUsingCachedHashCodes(const Anchor& a, key, comparator, h);
+        //   rehashUsingCachedHashCodes(Anchor *a, BidirectionalLink *r);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("TESTING CACHED HASH CODES\n"
+                            "=========================\n");
+
+        bslma::TestAllocator da("defaultAllocator", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard defaultGuard(&da);
+
+        bslma::TestAllocator oa("objectAllocator", veryVeryVeryVerbose);
+
+        typedef HashedBidirectionalNode<int> HNode;
+        typedef TestSetKeyPolicy<int>        TestPolicy;
+
+        enum { NUM_NODES = 17, MAX_KEY = 20 };
+
+        Mod16Hasher hasher;
+
+        Bucket buckets[4];
+        memset(buckets, 0, sizeof(buckets));
+        Anchor anchor(buckets, 4, 0);
+
+        for (int i = 0; i < NUM_NODES; ++i) {
+            HNode *node = static_cast<HNode *>(oa.allocate(sizeof(HNode)));
+            node->value() = i;
+            node->setHashCode(hasher(i));
+            node->reset();
+            Obj::insertAtBackOfBucket(&anchor, node, node->hashCode());
+        }
+        ASSERT(NUM_NODES == countElements(anchor.listRootAddress()));
+        ASSERT((Obj::isWellFormed<TestPolicy>(anchor, hasher, &oa)));
+
+        Bucket newBuckets[8];
+        Anchor newAnchor(newBuckets, 8, 0);
+
+        for (int pass = 0; pass < 2; ++pass) {
+            if (1 == pass) {
+                Obj::rehashUsingCachedHashCodes<TestPolicy>(
+                                                   &newAnchor,
+                                                   anchor.listRootAddress());
+                anchor = newAnchor;
+
+                ASSERT(NUM_NODES == countElements(anchor.listRootAddress()));
+                ASSERT((Obj::isWellFormed<TestPolicy>(anchor, hasher, &oa)));
+            }
+
+            for (int key = 0; key <= MAX_KEY; ++key) {
+                const size_t HASH = hasher(key);
+
+                int   numComparisons = 0;
+                Link *expected = Obj::find<TestPolicy, Equals<int> >(
+                                                                anchor,
+                                                                key,
+                                                                Equals<int>(),
+                                                                HASH);
+                Link *result = Obj::findUsingCachedHashCodes<TestPolicy>(
+                                           anchor,
+                                           key,
+                                           CountingIntEquals(&numComparisons),
+                                           HASH);
+
+                ASSERTV(pass, key, expected == result);
+                ASSERTV(pass, key, (key < NUM_NODES) == !!result);
+
+                // Nodes 0 and 16 collide, so up to 2 comparisons are made for
+                // a key having a hash code of 0, and at most 1 otherwise.
+
+                const int EXP_MAX = 0 == HASH ? 2 : 1;
+                ASSERTV(pass, key, numComparisons,
+                        numComparisons <= EXP_MAX);
+                ASSERTV(pass, key, numComparisons, 1 <= numComparisons);
+            }
+        }
+
+        for (Link *cursor = anchor.listRootAddress(); cursor; ) {
+            Link *next = cursor->nextLink();
+            oa.deallocate(cursor);
+            cursor = next;
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // ATTEMPTED USAGE EXAMPLE
@@ -2235,7 +2377,12 @@ int main(int argc, char *argv[])
             { L_,  81,  1,  0 },
             { L_, 100, 11,  1 },
             { L_, 100, 12,  4 },
-            { L_, 100,  7,  2 } };
+            { L_, 100,  7,  2 },
+            { L_,   7,  2,  1 },
+            { L_, 100,  8,  4 },
+            { L_, 100, 64, 36 },
+            { L_, 127, 64, 63 },
+            { L_, 128, 64,  0 } };
         const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
         for (int i = 0; i < NUM_DATA; ++i) {
@@ -2248,6 +2395,38 @@ int main(int argc, char *argv[])
                                                           NUM_BUCKETS);
             ASSERTV(LINE, RESULT, EXPECTED == RESULT);
         }
+
+        if (verbose) printf("	Power-of-two and other bucket counts.\n");
+        {
+            // Bucket counts that are powers of two are computed by masking,
+            // and must agree with the modulo for every hash code.
+
+            const size_t HASH_CODES[] = {
+                0, 1, 2, 3, 5, 255, 256, 65535, 65536, 0x7fffffff,
+                0x80000000u, 0xffffffffu, ~static_cast<size_t>(0),
+                ~static_cast<size_t>(0) >> 1
+            };
+            const int NUM_HASH_CODES = sizeof HASH_CODES / sizeof *HASH_CODES;
+
+            for (int bit = 0;
+                 bit < static_cast<int>(sizeof(size_t) * CHAR_BIT);
+                 ++bit) {
+                const size_t POW2 = static_cast<size_t>(1) << bit;
+                const size_t NUM_BUCKETS[] = { POW2, POW2 + 1, POW2 - 1 };
+
+                for (int j = 0; j < 3; ++j) {
+                    const size_t N = NUM_BUCKETS[j];
+                    if (0 == N) {
+                        continue;
+                    }
+                    for (int k = 0; k < NUM_HASH_CODES; ++k) {
+                        const size_t H = HASH_CODES[k];
+                        ASSERTV(bit, N, H,
+                                H % N == Obj::computeBucketIndex(H, N));
+                    }
+                }
+            }
+        }
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -6,6 +6,9 @@ BSLS_IDENT_RCSID(bslalg_hashutil_cpp,"$Id$ $CSID$")
 
 #include <bsls_assert.h>
 #include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <string.h>  // 'memcpy'
 
 // IMPLEMENTATION NOTES: See http://burtleburtle.net/bob/hash/evahash.html
 // In particular this hash function has the NoFunnel property, defined in that
@@ -30,6 +33,17 @@ BSLS_IDENT_RCSID(bslalg_hashutil_cpp,"$Id$ $CSID$")
 // where the funnel was.  A funnel of 32 bits to 31 is awfully non-serious,
 // though, so I let things be.
 //..
+//
+// 'computeBytesHash' follows the structure of the 64-bit variant of xxHash
+// (see http://code.google.com/p/xxhash/), and uses the same constants, so
+// that its results can be checked against the reference implementation.  The
+// body of the input is consumed in 32-byte stripes by four independent
+// accumulators, which lets the processor overlap the multiplications of
+// adjacent words; the remaining 0-31 bytes are folded in a word, a half-word,
+// and finally a byte at a time, before a final avalanche step.  Words are
+// always read as little-endian (and with 'memcpy', so that 'data' need not be
+// aligned), which makes the result independent of the endianness of the
+// platform.
 
 // STATIC HELPER FUNCTIONS
 #ifdef BSLS_PLATFORM__IS_BIG_ENDIAN
@@ -91,6 +105,135 @@ unsigned int reverse_hash(const char *data, int length)
 }
 #endif
 
+typedef BloombergLP::bsls::Types::Uint64 Uint64;
+
+static const Uint64 k_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+static const Uint64 k_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+static const Uint64 k_PRIME64_3 = 0x165667B19E3779F9ULL;
+static const Uint64 k_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+static const Uint64 k_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+static inline
+Uint64 rotateLeft(Uint64 value, int numBits)
+    // Return the specified 'value' rotated left by the specified 'numBits'.
+    // The behavior is undefined unless '0 < numBits < 64'.
+{
+    return (value << numBits) | (value >> (64 - numBits));
+}
+
+static inline
+Uint64 load64(const unsigned char *data)
+    // Return the 64-bit little-endian value stored in the 8 bytes starting at
+    // the specified 'data', which need not be aligned.
+{
+#ifdef BSLS_PLATFORM__IS_BIG_ENDIAN
+    return  (Uint64)data[0]        | ((Uint64)data[1] <<  8)
+         | ((Uint64)data[2] << 16) | ((Uint64)data[3] << 24)
+         | ((Uint64)data[4] << 32) | ((Uint64)data[5] << 40)
+         | ((Uint64)data[6] << 48) | ((Uint64)data[7] << 56);
+#else
+    Uint64 value;
+    memcpy(&value, data, sizeof value);
+    return value;
+#endif
+}
+
+static inline
+Uint64 load32(const unsigned char *data)
+    // Return the 32-bit little-endian value stored in the 4 bytes starting at
+    // the specified 'data', which need not be aligned.
+{
+#ifdef BSLS_PLATFORM__IS_BIG_ENDIAN
+    return  (Uint64)data[0]        | ((Uint64)data[1] <<  8)
+         | ((Uint64)data[2] << 16) | ((Uint64)data[3] << 24);
+#else
+    unsigned int value;
+    memcpy(&value, data, sizeof value);
+    return value;
+#endif
+}
+
+static inline
+Uint64 mixWord(Uint64 accumulator, Uint64 word)
+    // Return the result of folding the specified 'word' into the specified
+    // 'accumulator'.
+{
+    accumulator += word * k_PRIME64_2;
+    accumulator  = rotateLeft(accumulator, 31);
+    return accumulator * k_PRIME64_1;
+}
+
+static inline
+Uint64 mergeAccumulator(Uint64 hash, Uint64 accumulator)
+    // Return the result of merging the specified 'accumulator' into the
+    // specified 'hash'.
+{
+    hash ^= mixWord(0, accumulator);
+    return hash * k_PRIME64_1 + k_PRIME64_4;
+}
+
+static
+Uint64 bytesHash(const unsigned char *data, native_std::size_t length)
+    // Return the 64-bit hash of the specified 'length' bytes starting at the
+    // specified 'data'.
+{
+    const unsigned char *const end = data + length;
+    Uint64                     hash;
+
+    if (length >= 32) {
+        const unsigned char *const limit = end - 32;
+
+        Uint64 v1 = k_PRIME64_1 + k_PRIME64_2;
+        Uint64 v2 = k_PRIME64_2;
+        Uint64 v3 = 0;
+        Uint64 v4 = 0 - k_PRIME64_1;
+
+        do {
+            v1 = mixWord(v1, load64(data));
+            v2 = mixWord(v2, load64(data +  8));
+            v3 = mixWord(v3, load64(data + 16));
+            v4 = mixWord(v4, load64(data + 24));
+            data += 32;
+        } while (data <= limit);
+
+        hash = rotateLeft(v1,  1) + rotateLeft(v2,  7)
+             + rotateLeft(v3, 12) + rotateLeft(v4, 18);
+        hash = mergeAccumulator(hash, v1);
+        hash = mergeAccumulator(hash, v2);
+        hash = mergeAccumulator(hash, v3);
+        hash = mergeAccumulator(hash, v4);
+    }
+    else {
+        hash = k_PRIME64_5;
+    }
+
+    hash += static_cast<Uint64>(length);
+
+    for (; data + 8 <= end; data += 8) {
+        hash ^= mixWord(0, load64(data));
+        hash  = rotateLeft(hash, 27) * k_PRIME64_1 + k_PRIME64_4;
+    }
+
+    if (data + 4 <= end) {
+        hash ^= load32(data) * k_PRIME64_1;
+        hash  = rotateLeft(hash, 23) * k_PRIME64_2 + k_PRIME64_3;
+        data += 4;
+    }
+
+    for (; data < end; ++data) {
+        hash ^= static_cast<Uint64>(*data) * k_PRIME64_5;
+        hash  = rotateLeft(hash, 11) * k_PRIME64_1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= k_PRIME64_2;
+    hash ^= hash >> 29;
+    hash *= k_PRIME64_3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
 namespace BloombergLP {
 
 namespace bslalg {
@@ -166,6 +309,15 @@ native_std::size_t HashUtil::computeHash(const void *key)
 
 #undef HASH2
 
+native_std::size_t HashUtil::computeBytesHash(const void         *data,
+                                              native_std::size_t  numBytes)
+{
+    BSLS_ASSERT(data || 0 == numBytes);
+
+    return static_cast<native_std::size_t>(
+                bytesHash(static_cast<const unsigned char *>(data), numBytes));
+}
+
 }  // close namespace BloombergLP::bslalg
 }  // close namespace BloombergLP
 
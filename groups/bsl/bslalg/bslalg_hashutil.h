@@ -13,10 +13,25 @@ BSLS_IDENT("$Id: $")
 //  bslalg::HashUtil: utility for hash functions
 //
 //@DESCRIPTION: This component provides a namespace class, 'HashUtil', for
-// hash functions.  At the current time it has one hash function,
+// hash functions.  At the current time it has two families of hash functions:
 // 'HashUtil::computeHash', which will hash most fundamental types, and
-// pointers, rapidly.  Note that when a pointer is passed, only the bits in the
-// pointer itself are hashed, the memory the pointer refers to is not examined.
+// pointers, rapidly, and 'HashUtil::computeBytesHash', which will hash a
+// contiguous sequence of bytes (e.g., the characters of a string).  Note that
+// when a pointer is passed to 'computeHash', only the bits in the pointer
+// itself are hashed, the memory the pointer refers to is not examined.
+//
+///Hashing Contiguous Data
+///-----------------------
+// 'computeBytesHash' consumes its input a 64-bit word at a time, in four
+// independent lanes for inputs of 32 bytes or more, and finishes with a
+// full-avalanche mixing step, so that every input bit affects every bit of the
+// (64-bit) result.  It is intended to be used by all hash functors for
+// string-like types (e.g., 'bsl::hash<bsl::string>' and
+// 'bsl::hash<bslstl::StringRef>'), so that equal character sequences hash to
+// the same value regardless of the type holding them.  Like 'computeHash', the
+// value returned for a given sequence of bytes does not depend on the
+// endianness of the platform, but it does depend on the width of
+// 'native_std::size_t'.
 //
 ///Usage
 ///-----
@@ -255,6 +270,17 @@ struct HashUtil {
         // value -- when 'native_std::size_t' is 64 bits, the high-order 32
         // bits of the return value are all zero.  This is not a feature, it is
         // a bug that we will fix in a later release.
+
+    static native_std::size_t computeBytesHash(const void         *data,
+                                               native_std::size_t  numBytes);
+        // Return a 'size_t' hash value corresponding to the specified
+        // 'numBytes' bytes of memory starting at the specified 'data'.  The
+        // behavior is undefined unless 'data' refers to at least 'numBytes'
+        // readable bytes, or '0 == numBytes'.  Note that the full 64-bit
+        // result is well-distributed, so either the low-order or the
+        // high-order bits may be used to select a bucket.  Also note that, as
+        // for 'computeHash', we reserve the right to change the value returned
+        // for a given input in a later release.
 };
 
 // ===========================================================================
@@ -33,11 +33,14 @@ using bslalg::HashUtil;
 // two kinds of buffers (fixed-length - integer, and variable-length) during
 // the breathing test.  Together with the usage example which performs various
 // experiments to be reported on in the component-level documentation, this is
-// appropriate testing.  There are no other concerns about this component.
+// appropriate testing.  The hash of contiguous data is additionally checked
+// against known answers, for alignment independence, and for the quality of
+// the distribution of its values.
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] HASHING FUNDAMENTAL TYPES
-// [ 3] USAGE EXAMPLE
+// [ 3] size_t computeBytesHash(const void *data, size_t numBytes);
+// [ 4] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -118,6 +121,51 @@ void time_computeHash(const TYPE&   key,
     (void)value;
 }
 
+native_std::size_t multiplyAddHash(const char *data, native_std::size_t length)
+    // Return the hash of the specified 'length' characters starting at the
+    // specified 'data' computed by the character-at-a-time algorithm formerly
+    // used by 'bsl::hash<bsl::string>', for comparison purposes.
+{
+    unsigned long hashValue = 0;
+    for (native_std::size_t i = 0; i < length; ++i) {
+        hashValue = 5 * hashValue + data[i];
+    }
+    return hashValue;
+}
+
+int makeKey(char *buffer, int index)
+    // Load into the specified 'buffer' a symbol-table-like key, between 40 and
+    // 200 characters long, that is derived from the specified 'index', and
+    // return its length.  Keys for adjacent indices differ in only a few
+    // characters.  The behavior is undefined unless 'buffer' has room for at
+    // least 201 characters.
+{
+    int length = sprintf(buffer,
+                         "Enterprise::pkg::Component::symbol%d::",
+                         index);
+    const int target = 40 + index % 161;
+    while (length < target) {
+        buffer[length] = static_cast<char>('a' + length % 26);
+        ++length;
+    }
+    buffer[length] = '\0';
+    return length;
+}
+
+double chiSquare(const int *counts, int numBuckets, int numValues)
+    // Return the chi-square statistic of the specified 'counts' of the
+    // specified 'numValues' values distributed across the specified
+    // 'numBuckets' buckets, measured against the uniform distribution.
+{
+    const double expected = static_cast<double>(numValues) / numBuckets;
+    double       result   = 0;
+    for (int i = 0; i < numBuckets; ++i) {
+        const double diff = counts[i] - expected;
+        result += diff * diff / expected;
+    }
+    return result;
+}
+
 int countBits(native_std::size_t value)
 {
     int ret = 0;
@@ -145,7 +193,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 3: {
+      case 4: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   This test is at the same time a usage example and a set of
@@ -294,6 +342,196 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'computeBytesHash'
+        //
+        // Concerns:
+        //: 1 The hash of a given sequence of bytes is the value computed by
+        //:   the reference implementation of the algorithm, and so does not
+        //:   depend on the endianness of the platform.
+        //:
+        //: 2 The hash does not depend on the alignment of the data.
+        //:
+        //: 3 A zero-length sequence may be hashed through a null pointer.
+        //:
+        //: 4 Flipping any single input bit changes about half of the bits in
+        //:   the result.
+        //:
+        //: 5 Similar keys are distributed uniformly across buckets selected by
+        //:   either the low-order or the high-order bits of the result.
+        //
+        // Plan:
+        //: 1 Compare the return value for a table of strings, covering every
+        //:   code path (fewer than 4, 8 and 32 bytes, and several stripes),
+        //:   to values computed by the reference implementation.  (C-1)
+        //:
+        //: 2 Hash the same bytes copied at every offset within an aligned
+        //:   buffer, and verify that the result does not change.  (C-2)
+        //:
+        //: 3 Hash '(0, 0)' and compare to the hash of the empty string.  (C-3)
+        //:
+        //: 4 For keys of several lengths, flip every bit in turn and count the
+        //:   bits that changed in the result.  Verify that the average is
+        //:   within 1/8 of half the width of 'size_t'.  (C-4)
+        //:
+        //: 5 Hash 64K generated keys between 40 and 200 bytes long into 1024
+        //:   buckets, and verify that the chi-square statistic is within 8
+        //:   standard deviations of its expected value.  (C-5)
+        //
+        // Testing:
+        //   size_t computeBytesHash(const void *data, size_t numBytes);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'computeBytesHash'"
+                            "\n==========================\n");
+
+        if (verbose) printf("\nCompare to reference values.\n");
+        {
+            static const struct {
+                int                 d_line;
+                const char         *d_str;
+                bsls::Types::Uint64 d_hash;
+            } DATA[] = {
+                //LINE  STRING                         HASH
+                //----  ------                         ----
+                { L_,   "",                            0xEF46DB3751D8E999ULL },
+                { L_,   "a",                           0xD24EC4F1A98C6E5BULL },
+                { L_,   "abc",                         0x44BC2CF5AD770999ULL },
+                { L_,   "message digest",              0x066ED728FCEEB3BEULL },
+                { L_,   "abcdefghijklmnopqrstuvwxyz",  0xCFE1F278FA89835CULL },
+                { L_,   "The quick brown fox jumps over the lazy dog",
+                                                       0x0B242D361FDA71BCULL },
+                { L_,   "1234567890123456789012345678901234567890"
+                        "1234567890123456789012345678901234567890",
+                                                       0xE04A477F19EE145DULL },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int                LINE = DATA[ti].d_line;
+                const char *const        STR  = DATA[ti].d_str;
+                const native_std::size_t EXP  =
+                              static_cast<native_std::size_t>(DATA[ti].d_hash);
+
+                const native_std::size_t hash =
+                                  HashUtil::computeBytesHash(STR, strlen(STR));
+
+                if (veryVerbose) { P_(LINE) P_(STR) P(hash) }
+
+                LOOP_ASSERT(LINE, EXP == hash);
+            }
+        }
+
+        if (verbose) printf("\nHash is independent of alignment.\n");
+        {
+            const char *const STR = "Enterprise::pkg::Component::symbol";
+            const int         LEN = static_cast<int>(strlen(STR));
+
+            const native_std::size_t EXP =
+                                          HashUtil::computeBytesHash(STR, LEN);
+
+            union {
+                char                d_buffer[64];
+                bsls::Types::Uint64 d_align;
+            } u;
+
+            for (int offset = 0; offset < 16; ++offset) {
+                memset(u.d_buffer, 'X', sizeof u.d_buffer);
+                memcpy(u.d_buffer + offset, STR, LEN);
+
+                LOOP_ASSERT(offset,
+                        EXP == HashUtil::computeBytesHash(u.d_buffer + offset,
+                                                          LEN));
+            }
+        }
+
+        if (verbose) printf("\nHash zero bytes through a null pointer.\n");
+        {
+            ASSERT(HashUtil::computeBytesHash("", 0) ==
+                                             HashUtil::computeBytesHash(0, 0));
+        }
+
+        if (verbose) printf("\nAvalanche.\n");
+        {
+            const int BITS = static_cast<int>(sizeof(native_std::size_t) * 8);
+
+            static const int LENGTHS[] = { 1, 3, 4, 7, 8, 15, 31, 32, 33, 64,
+                                           100, 200 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const int LEN = LENGTHS[ti];
+
+                char buffer[256];
+                for (int i = 0; i < LEN; ++i) {
+                    buffer[i] = static_cast<char>('A' + i % 26);
+                }
+
+                const native_std::size_t base =
+                                       HashUtil::computeBytesHash(buffer, LEN);
+
+                int totalChanged = 0;
+                for (int bit = 0; bit < LEN * 8; ++bit) {
+                    buffer[bit / 8] ^= static_cast<char>(1 << bit % 8);
+                    totalChanged += countBits(
+                              base ^ HashUtil::computeBytesHash(buffer, LEN));
+                    buffer[bit / 8] ^= static_cast<char>(1 << bit % 8);
+                }
+
+                const double average =
+                             static_cast<double>(totalChanged) / (LEN * 8);
+
+                if (veryVerbose) { P_(LEN) P(average) }
+
+                LOOP2_ASSERT(LEN, average, average > BITS / 2 - BITS / 16);
+                LOOP2_ASSERT(LEN, average, average < BITS / 2 + BITS / 16);
+            }
+        }
+
+        if (verbose) printf("\nDistribution of similar keys.\n");
+        {
+            enum { NUM_KEYS = 1 << 16, NUM_BUCKETS = 1 << 10 };
+
+            // For 1023 degrees of freedom the chi-square statistic has an
+            // expected value of 1023 and a standard deviation of about 45.
+
+            const double LIMIT = 1023 + 8 * 45;
+
+            static int lowCounts[NUM_BUCKETS];
+            static int highCounts[NUM_BUCKETS];
+            static int oldCounts[NUM_BUCKETS];
+            memset(lowCounts,  0, sizeof lowCounts);
+            memset(highCounts, 0, sizeof highCounts);
+            memset(oldCounts,  0, sizeof oldCounts);
+
+            const int SHIFT =
+                         static_cast<int>(sizeof(native_std::size_t) * 8) - 10;
+
+            char key[256];
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const int                len  = makeKey(key, i);
+                const native_std::size_t hash =
+                                          HashUtil::computeBytesHash(key, len);
+
+                ++lowCounts[hash & (NUM_BUCKETS - 1)];
+                ++highCounts[hash >> SHIFT];
+                ++oldCounts[multiplyAddHash(key, len) & (NUM_BUCKETS - 1)];
+            }
+
+            const double lowChi  = chiSquare(lowCounts,  NUM_BUCKETS,
+                                             NUM_KEYS);
+            const double highChi = chiSquare(highCounts, NUM_BUCKETS,
+                                             NUM_KEYS);
+            const double oldChi  = chiSquare(oldCounts,  NUM_BUCKETS,
+                                             NUM_KEYS);
+
+            if (verbose) { P_(lowChi) P_(highChi) P(oldChi) }
+
+            LOOP_ASSERT(lowChi,  lowChi  < LIMIT);
+            LOOP_ASSERT(highChi, highChi < LIMIT);
+        }
+      } break;
       case 2: {
         // --------------------------------------------------------------------
         // TESTING HASHING FUNDAMENTAL TYPES
@@ -487,6 +725,75 @@ int main(int argc, char *argv[])
         time_computeHash((void*)0xffab13f1, "void*");
 #endif
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE OF 'computeBytesHash'
+        //
+        // Concerns:
+        //   Hashing typical symbol-table keys (40 to 200 bytes) a word at a
+        //   time should be significantly faster than the character-at-a-time
+        //   algorithm formerly used by 'bsl::hash<bsl::string>'.
+        //
+        // Plan:
+        //   Hash keys of several lengths repeatedly with both algorithms and
+        //   report the throughput of each using a 'bsls::Stopwatch'.
+        //
+        // Testing:
+        //   size_t computeBytesHash(const void *data, size_t numBytes);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE OF 'computeBytesHash'"
+                            "\n=================================\n");
+
+        static const int LENGTHS[] = { 8, 16, 40, 64, 100, 200, 1000 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        enum { TOTAL_BYTES = 1 << 28 };  // 256M
+
+        native_std::size_t sink = 0;
+
+        char buffer[1024];
+        for (int i = 0; i < (int) sizeof buffer; ++i) {
+            buffer[i] = static_cast<char>('A' + i % 26);
+        }
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LEN        = LENGTHS[ti];
+            const int ITERATIONS = TOTAL_BYTES / LEN;
+
+            native_std::size_t value = 0;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                buffer[i & 7] = static_cast<char>(i);
+                value += HashUtil::computeBytesHash(buffer, LEN);
+            }
+            timer.stop();
+            const double newTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                buffer[i & 7] = static_cast<char>(i);
+                value += multiplyAddHash(buffer, LEN);
+            }
+            timer.stop();
+            const double oldTime = timer.elapsedTime();
+
+            printf("%4d-byte keys: computeBytesHash %7.1f MB/s, "
+                   "5*h+c %7.1f MB/s\n",
+                   LEN,
+                   TOTAL_BYTES / newTime / (1 << 20),
+                   TOTAL_BYTES / oldTime / (1 << 20));
+
+            sink += value;  // prevent the loops from being optimized away
+        }
+
+        if (veryVerbose) {
+            printf("checksum: %lu\n", static_cast<unsigned long>(sink));
+        }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
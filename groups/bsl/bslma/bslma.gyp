@@ -5,6 +5,8 @@
       'bslma_autodeallocator.cpp',
       'bslma_autodestructor.cpp',
       'bslma_autorawdeleter.cpp',
+      'bslma_concurrentpoolallocator.cpp',
+      'bslma_countingallocator.cpp',
       'bslma_deallocatorguard.cpp',
       'bslma_deallocatorproctor.cpp',
       'bslma_default.cpp',
@@ -13,13 +15,19 @@
       'bslma_destructorguard.cpp',
       'bslma_destructorproctor.cpp',
       'bslma_exceptionguard.cpp',
+      'bslma_localarena.cpp',
       'bslma_mallocfreeallocator.cpp',
+      'bslma_managedallocator.cpp',
+      'bslma_multipoolallocator.cpp',
       'bslma_newdeleteallocator.cpp',
       'bslma_rawdeleterguard.cpp',
       'bslma_rawdeleterproctor.cpp',
+      'bslma_samplingallocator.cpp',
+      'bslma_sequentialallocator.cpp',
       'bslma_testallocator.cpp',
       'bslma_testallocatorexception.cpp',
       'bslma_testallocatormonitor.cpp',
+      'bslma_threaddefaultallocatorguard.cpp',
       'bslma_usesbslmaallocator.cpp',
     ],
     'bslma_tests': [
@@ -27,6 +35,8 @@
       'bslma_autodeallocator.t',
       'bslma_autodestructor.t',
       'bslma_autorawdeleter.t',
+      'bslma_concurrentpoolallocator.t',
+      'bslma_countingallocator.t',
       'bslma_deallocatorguard.t',
       'bslma_deallocatorproctor.t',
       'bslma_default.t',
@@ -35,13 +45,19 @@
       'bslma_destructorguard.t',
       'bslma_destructorproctor.t',
       'bslma_exceptionguard.t',
+      'bslma_localarena.t',
       'bslma_mallocfreeallocator.t',
+      'bslma_managedallocator.t',
+      'bslma_multipoolallocator.t',
       'bslma_newdeleteallocator.t',
       'bslma_rawdeleterguard.t',
       'bslma_rawdeleterproctor.t',
+      'bslma_samplingallocator.t',
+      'bslma_sequentialallocator.t',
       'bslma_testallocator.t',
       'bslma_testallocatorexception.t',
       'bslma_testallocatormonitor.t',
+      'bslma_threaddefaultallocatorguard.t',
       'bslma_usesbslmaallocator.t',
     ],
     'bslma_tests_paths': [
@@ -49,6 +65,8 @@
       '<(PRODUCT_DIR)/bslma_autodeallocator.t',
       '<(PRODUCT_DIR)/bslma_autodestructor.t',
       '<(PRODUCT_DIR)/bslma_autorawdeleter.t',
+      '<(PRODUCT_DIR)/bslma_concurrentpoolallocator.t',
+      '<(PRODUCT_DIR)/bslma_countingallocator.t',
       '<(PRODUCT_DIR)/bslma_deallocatorguard.t',
       '<(PRODUCT_DIR)/bslma_deallocatorproctor.t',
       '<(PRODUCT_DIR)/bslma_default.t',
@@ -57,13 +75,19 @@
       '<(PRODUCT_DIR)/bslma_destructorguard.t',
       '<(PRODUCT_DIR)/bslma_destructorproctor.t',
       '<(PRODUCT_DIR)/bslma_exceptionguard.t',
+      '<(PRODUCT_DIR)/bslma_localarena.t',
       '<(PRODUCT_DIR)/bslma_mallocfreeallocator.t',
+      '<(PRODUCT_DIR)/bslma_managedallocator.t',
+      '<(PRODUCT_DIR)/bslma_multipoolallocator.t',
       '<(PRODUCT_DIR)/bslma_newdeleteallocator.t',
       '<(PRODUCT_DIR)/bslma_rawdeleterguard.t',
       '<(PRODUCT_DIR)/bslma_rawdeleterproctor.t',
+      '<(PRODUCT_DIR)/bslma_samplingallocator.t',
+      '<(PRODUCT_DIR)/bslma_sequentialallocator.t',
       '<(PRODUCT_DIR)/bslma_testallocator.t',
       '<(PRODUCT_DIR)/bslma_testallocatorexception.t',
       '<(PRODUCT_DIR)/bslma_testallocatormonitor.t',
+      '<(PRODUCT_DIR)/bslma_threaddefaultallocatorguard.t',
       '<(PRODUCT_DIR)/bslma_usesbslmaallocator.t',
     ],
     'bslma_pkgdeps': [
@@ -152,6 +176,22 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslma_autorawdeleter.t.cpp' ],
     },
+    {
+      'target_name': 'bslma_concurrentpoolallocator.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslma_pkgdeps)', 'bslma' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslma_concurrentpoolallocator.t.cpp' ],
+    },
+    {
+      'target_name': 'bslma_countingallocator.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslma_pkgdeps)', 'bslma' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslma_countingallocator.t.cpp' ],
+    },
     {
       'target_name': 'bslma_deallocatorguard.t',
       'type': 'executable',
@@ -216,6 +256,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslma_exceptionguard.t.cpp' ],
     },
+    {
+      'target_name': 'bslma_localarena.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslma_pkgdeps)', 'bslma' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslma_localarena.t.cpp' ],
+    },
     {
       'target_name': 'bslma_mallocfreeallocator.t',
       'type': 'executable',
@@ -228,6 +276,22 @@
           { 'ldflags': [ '-bexpfull' ] } ],
       ],
     },
+    {
+      'target_name': 'bslma_managedallocator.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslma_pkgdeps)', 'bslma' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslma_managedallocator.t.cpp' ],
+    },
+    {
+      'target_name': 'bslma_multipoolallocator.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslma_pkgdeps)', 'bslma' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslma_multipoolallocator.t.cpp' ],
+    },
     {
       'target_name': 'bslma_newdeleteallocator.t',
       'type': 'executable',
@@ -256,6 +320,22 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslma_rawdeleterproctor.t.cpp' ],
     },
+    {
+      'target_name': 'bslma_samplingallocator.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslma_pkgdeps)', 'bslma' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslma_samplingallocator.t.cpp' ],
+    },
+    {
+      'target_name': 'bslma_sequentialallocator.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslma_pkgdeps)', 'bslma' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslma_sequentialallocator.t.cpp' ],
+    },
     {
       'target_name': 'bslma_testallocator.t',
       'type': 'executable',
@@ -284,6 +364,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslma_testallocatormonitor.t.cpp' ],
     },
+    {
+      'target_name': 'bslma_threaddefaultallocatorguard.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslma_pkgdeps)', 'bslma' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslma_threaddefaultallocatorguard.t.cpp' ],
+    },
     {
       'target_name': 'bslma_usesbslmaallocator.t',
       'type': 'executable',
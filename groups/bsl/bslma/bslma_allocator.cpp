@@ -4,12 +4,42 @@
 #include <bsls_ident.h>
 BSLS_IDENT("$Id$ $CSID$")
 
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
 #include <bsls_exceptionutil.h>
 
-#include <new>   // 'std::bad_alloc'
+#include <cstring>  // 'std::memcpy'
+#include <new>      // 'std::bad_alloc'
 
 namespace BloombergLP {
 
+namespace {
+
+typedef bslma::Allocator::size_type size_type;
+
+inline
+bool isAlignmentGuaranteed(size_type size, size_type alignment)
+    // Return 'true' if a block of the specified 'size' returned by
+    // 'Allocator::allocate' is guaranteed to have the specified 'alignment',
+    // and 'false' otherwise.
+{
+    return alignment <= static_cast<size_type>(
+            bsls::AlignmentUtil::calculateAlignmentFromSize(
+                                          static_cast<std::size_t>(size)));
+}
+
+inline
+size_type alignedBlockSize(size_type size, size_type alignment)
+    // Return the size of the block obtained from 'Allocator::allocate' to
+    // hold a block of the specified 'size' having the specified 'alignment',
+    // and the address of the obtained block, when the alignment of the
+    // obtained block is not guaranteed to be 'alignment'.
+{
+    return size + alignment + static_cast<size_type>(sizeof(void *));
+}
+
+}  // close unnamed namespace
+
 namespace bslma {
 
                         // ---------------
@@ -27,6 +57,59 @@ Allocator::~Allocator()
 {
 }
 
+// MANIPULATORS
+void Allocator::deallocateSized(void *address, size_type)
+{
+    deallocate(address);
+}
+
+void *Allocator::allocateAligned(size_type size, size_type alignment)
+{
+    BSLS_ASSERT_SAFE(0 <= size);
+    BSLS_ASSERT_SAFE(0 < alignment && 0 == (alignment & (alignment - 1)));
+
+    if (0 == size || isAlignmentGuaranteed(size, alignment)) {
+        return allocate(size);                                        // RETURN
+    }
+
+    // Obtain a block large enough to hold, after the address of the block
+    // itself, 'size' bytes at any offset modulo 'alignment', and store the
+    // address of the block immediately before the aligned address returned.
+
+    char *block   = static_cast<char *>(
+                                  allocate(alignedBlockSize(size, alignment)));
+    char *address = block + sizeof(void *);
+    address += bsls::AlignmentUtil::calculateAlignmentOffset(
+                                                address,
+                                                static_cast<int>(alignment));
+
+    std::memcpy(address - sizeof(void *), &block, sizeof(void *));
+    return address;
+}
+
+void Allocator::deallocateAligned(void      *address,
+                                  size_type  size,
+                                  size_type  alignment)
+{
+    BSLS_ASSERT_SAFE(0 <= size);
+    BSLS_ASSERT_SAFE(0 < alignment && 0 == (alignment & (alignment - 1)));
+
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    if (isAlignmentGuaranteed(size, alignment)) {
+        deallocateSized(address, size);
+        return;                                                       // RETURN
+    }
+
+    void *block;
+    std::memcpy(&block,
+                static_cast<char *>(address) - sizeof(void *),
+                sizeof(void *));
+    deallocateSized(block, alignedBlockSize(size, alignment));
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
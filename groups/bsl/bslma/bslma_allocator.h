@@ -68,6 +68,53 @@ BSLS_IDENT("$Id: $")
 // memory.  Memory is allocated from the pool until it is dry; only then does
 // new memory flow into the pool from the allocator.
 //
+///Sized Deallocation
+///------------------
+// In addition to the pure virtual 'deallocate' method, the protocol provides
+// a virtual 'deallocateSized' method that is also supplied the size of the
+// block being returned, i.e., the 'size' originally passed to 'allocate'.
+// Most clients that return memory -- in particular, containers -- know that
+// size at the point of deallocation, and a concrete allocator can use it to
+// return the block more efficiently (e.g., by computing the size class to
+// which the block belongs rather than reading it from a per-block header).
+//
+// The default implementation of 'deallocateSized' ignores the size and calls
+// 'deallocate', so concrete allocators written before 'deallocateSized' was
+// introduced, and those that have no use for the size, need not override it.
+// Note that 'deallocate' remains the method through which a block of unknown
+// size is returned, so a concrete allocator must continue to support it.
+//
+///Over-Aligned Allocation
+///------------------------
+// The memory returned by 'allocate' is guaranteed only to be sufficiently
+// aligned for any object of the requested size, which is never more than the
+// maximal alignment of the platform (e.g., 16 bytes on x86-64).  Memory having
+// a greater alignment -- e.g., a 64-byte cache line, or the 32- or 64-byte
+// alignment required by SIMD loads and stores -- is obtained from the
+// 'allocateAligned' method, which takes the required alignment as a second
+// argument, and is returned by the matching 'deallocateAligned' method, which
+// is supplied the same size and alignment:
+//..
+//  void *block = basicAllocator->allocateAligned(1024, 64);
+//  assert(0 == reinterpret_cast<bsls::Types::UintPtr>(block) % 64);
+//
+//  // ...
+//
+//  basicAllocator->deallocateAligned(block, 1024, 64);
+//..
+// The default implementations of these virtual methods are written in terms
+// of 'allocate' and 'deallocateSized', so that every concrete allocator
+// supports over-aligned allocation.  If the requested alignment is no greater
+// than the alignment that 'allocate' already guarantees for the requested
+// size, 'allocateAligned' simply calls 'allocate'; otherwise, it obtains a
+// block large enough to hold the requested size at the requested alignment,
+// together with the address of the block, which 'deallocateAligned' retrieves
+// to return the block.  A concrete allocator that can satisfy an alignment
+// requirement directly (e.g., by advancing a cursor to an aligned address)
+// may override both methods to avoid that overhead.  Note that memory
+// obtained from 'allocateAligned' must be returned by 'deallocateAligned', and
+// not by 'deallocate' or 'deallocateSized'.
+//
 ///Overloaded Global Operators 'new' and 'delete'
 ///----------------------------------------------
 // This component overloads the global operator 'new' to allow convenient
@@ -441,6 +488,39 @@ class Allocator {
         // behavior is undefined unless 'address' was allocated using this
         // allocator object and has not already been deallocated.
 
+    virtual void deallocateSized(void *address, size_type size);
+        // Return the memory block at the specified 'address', having the
+        // specified 'size' (in bytes), back to this allocator.  If 'address'
+        // is 0, this function has no effect.  The behavior is undefined
+        // unless 'address' was allocated using this allocator object by a
+        // call to 'allocate' with 'size', and has not already been
+        // deallocated.  Note that the default implementation ignores 'size'
+        // and calls 'deallocate(address)'.
+
+    virtual void *allocateAligned(size_type size, size_type alignment);
+        // Return a newly allocated block of memory of (at least) the
+        // specified positive 'size' (in bytes), aligned to (at least) the
+        // specified 'alignment'.  If 'size' is 0, a null pointer is returned
+        // with no other effect.  If this allocator cannot return the
+        // requested number of bytes, then it will throw a 'std::bad_alloc'
+        // exception in an exception-enabled build, or else will abort the
+        // program in a non-exception build.  The behavior is undefined unless
+        // '0 <= size' and 'alignment' is a positive, integral power of 2.
+        // Note that the returned memory must be returned to this allocator by
+        // 'deallocateAligned'.  Also note that the default implementation is
+        // written in terms of 'allocate' (see {Over-Aligned Allocation}).
+
+    virtual void deallocateAligned(void      *address,
+                                   size_type  size,
+                                   size_type  alignment);
+        // Return the memory block at the specified 'address', having the
+        // specified 'size' (in bytes) and the specified 'alignment', back to
+        // this allocator.  If 'address' is 0, this function has no effect.
+        // The behavior is undefined unless 'address' was allocated using this
+        // allocator object by a call to 'allocateAligned' with 'size' and
+        // 'alignment', and has not already been deallocated.  Note that the
+        // default implementation is written in terms of 'deallocateSized'.
+
     template <class TYPE>
     void deleteObject(const TYPE *object);
         // Destroy the specified 'object' based on its dynamic type and then
@@ -3,7 +3,9 @@
 #include <bslma_allocator.h>
 
 #include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
+#include <bsls_types.h>
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -33,11 +35,14 @@ using namespace BloombergLP;
 // [ 3] template<typename TYPE> deleteObjectRaw(const TYPE *);
 // [ 4] void *operator new(int size, bslma::Allocator& basicAllocator);
 // [ 5] void operator delete(void *address, bslma::Allocator& basicAllocator);
+// [ 6] virtual void deallocateSized(void *address, size_type size);
+// [ 7] virtual void *allocateAligned(size_type size, size_type alignment);
+// [ 7] virtual void deallocateAligned(void *, size_type, size_type);
 //-----------------------------------------------------------------------------
 // [ 1] PROTOCOL TEST - Make sure derived class compiles and links.
 // [ 4] OPERATOR TEST - Make sure overloaded operators call correct functions.
 // [ 5] EXCEPTION SAFETY - Ensure operator delete is invoked on an exception.
-// [ 6] USAGE EXAMPLE - Make sure usage examples compiles and works properly.
+// [ 8] USAGE EXAMPLE - Make sure usage examples compiles and works properly.
 //=============================================================================
 
 //=============================================================================
@@ -132,6 +137,95 @@ class my_Allocator : public bslma::Allocator {
         // Return number of times deallocate called.
 };
 
+class my_SizedAllocator : public my_Allocator {
+    // Test class used to verify that 'deallocateSized' may be overridden.
+
+    size_type d_size;                  // size passed to 'deallocateSized'
+
+    int       d_deallocateSizedCount;  // number of times 'deallocateSized'
+                                       // called
+
+  public:
+    my_SizedAllocator() : d_size(-1), d_deallocateSizedCount(0) { }
+    ~my_SizedAllocator() { }
+
+    void deallocateSized(void *, size_type size) {
+        d_size = size;
+        ++d_deallocateSizedCount;
+    }
+
+    size_type size() const { return d_size; }
+        // Return last argument value for 'deallocateSized'.
+
+    int deallocateSizedCount() const { return d_deallocateSizedCount; }
+        // Return number of times 'deallocateSized' called.
+};
+
+class my_MallocAllocator : public bslma::Allocator {
+    // Test class used to verify the default implementations of
+    // 'allocateAligned' and 'deallocateAligned'.
+
+    size_type  d_allocateSize;        // argument of last 'allocate'
+
+    void      *d_allocateAddress;     // result of last 'allocate'
+
+    size_type  d_deallocateSize;      // size of last deallocation
+
+    void      *d_deallocateAddress;   // address of last deallocation
+
+    int        d_numBlocksInUse;      // number of outstanding blocks
+
+  public:
+    my_MallocAllocator()
+    : d_allocateSize(-1)
+    , d_allocateAddress(0)
+    , d_deallocateSize(-1)
+    , d_deallocateAddress(0)
+    , d_numBlocksInUse(0)
+    {
+    }
+
+    ~my_MallocAllocator() { }
+
+    void *allocate(size_type size) {
+        d_allocateSize    = size;
+        d_allocateAddress = 0 == size ? 0 : malloc(size);
+        if (d_allocateAddress) {
+            ++d_numBlocksInUse;
+        }
+        return d_allocateAddress;
+    }
+
+    void deallocate(void *address) {
+        deallocateSized(address, -1);
+    }
+
+    void deallocateSized(void *address, size_type size) {
+        d_deallocateSize    = size;
+        d_deallocateAddress = address;
+        if (address) {
+            --d_numBlocksInUse;
+            free(address);
+        }
+    }
+
+    size_type allocateSize() const { return d_allocateSize; }
+        // Return last argument value for 'allocate'.
+
+    void *allocateAddress() const { return d_allocateAddress; }
+        // Return last value returned by 'allocate'.
+
+    size_type deallocateSize() const { return d_deallocateSize; }
+        // Return the size supplied to the last deallocation, or -1 if the
+        // last deallocation was by 'deallocate'.
+
+    void *deallocateAddress() const { return d_deallocateAddress; }
+        // Return the address supplied to the last deallocation.
+
+    int numBlocksInUse() const { return d_numBlocksInUse; }
+        // Return the number of blocks allocated but not yet deallocated.
+};
+
 class my_NewDeleteAllocator : public bslma::Allocator {
     // Test class used to verify examples.
 
@@ -425,7 +519,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 6: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -479,6 +573,161 @@ int main(int argc, char *argv[])
             deleteMyType(&a, t);
         }
 
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'allocateAligned' AND 'deallocateAligned' TEST:
+        //   We want to make sure that the default implementations of
+        //   'allocateAligned' and 'deallocateAligned' return memory having
+        //   the requested alignment, and return the block obtained from
+        //   'allocate' to 'deallocateSized' with the size that was allocated.
+        //
+        // Plan:
+        //   For each of a set of sizes, and each alignment from 1 to 256,
+        //   invoke 'allocateAligned' through a base class reference to an
+        //   allocator that records its calls to 'allocate' and
+        //   'deallocateSized'.  Verify that the returned address is aligned,
+        //   that the whole of the requested size is writable, and that
+        //   'allocate' was called with the requested size if the alignment is
+        //   already guaranteed for that size, and with a larger size
+        //   otherwise.  Then invoke 'deallocateAligned', and verify that the
+        //   block obtained from 'allocate' is supplied to 'deallocateSized'
+        //   with the size that was allocated.  Finally, verify that a size of
+        //   0 and a null address have no effect, and (in SAFE mode) that an
+        //   alignment that is not a power of 2 is detected.
+        //
+        // Testing:
+        //   virtual void *allocateAligned(size_type size, size_type align);
+        //   virtual void deallocateAligned(void *, size_type, size_type);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                        "\n'allocateAligned' AND 'deallocateAligned' TEST"
+                        "\n==============================================\n");
+
+        typedef bslma::Allocator::size_type size_type;
+
+        static const size_type SIZES[] = { 1, 2, 3, 7, 8, 15, 16, 31, 64,
+                                           100, 1000, 4096 };
+        enum { NUM_SIZES = sizeof SIZES / sizeof *SIZES };
+
+        my_MallocAllocator myA;
+        bslma::Allocator&  a = myA;
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const size_type SIZE = SIZES[i];
+
+            for (size_type ALIGN = 1; ALIGN <= 256; ALIGN *= 2) {
+                const bool GUARANTEED = ALIGN <= static_cast<size_type>(
+                   bsls::AlignmentUtil::calculateAlignmentFromSize(
+                                             static_cast<std::size_t>(SIZE)));
+
+                char *p = static_cast<char *>(a.allocateAligned(SIZE, ALIGN));
+
+                ASSERTV(SIZE, ALIGN, 0 != p);
+                ASSERTV(SIZE, ALIGN, 1 == myA.numBlocksInUse());
+                ASSERTV(SIZE, ALIGN,
+                        0 == reinterpret_cast<bsls::Types::UintPtr>(p)
+                                                                    % ALIGN);
+                memset(p, 0xa5, static_cast<std::size_t>(SIZE));
+
+                char            *block     = static_cast<char *>(
+                                                       myA.allocateAddress());
+                const size_type  BLOCKSIZE = myA.allocateSize();
+                if (GUARANTEED) {
+                    ASSERTV(SIZE, ALIGN, block == p);
+                    ASSERTV(SIZE, ALIGN, SIZE  == BLOCKSIZE);
+                }
+                else {
+                    ASSERTV(SIZE, ALIGN, SIZE < BLOCKSIZE);
+                    ASSERTV(SIZE, ALIGN, block < p);
+                    ASSERTV(SIZE, ALIGN, p + SIZE <= block + BLOCKSIZE);
+                }
+
+                a.deallocateAligned(p, SIZE, ALIGN);
+                ASSERTV(SIZE, ALIGN, 0         == myA.numBlocksInUse());
+                ASSERTV(SIZE, ALIGN, block     == myA.deallocateAddress());
+                ASSERTV(SIZE, ALIGN, BLOCKSIZE == myA.deallocateSize());
+            }
+        }
+
+        if (verbose) printf("\nTesting a size of 0 and a null address.\n");
+        {
+            ASSERT(0 == a.allocateAligned(0, 64));
+            ASSERT(0 == myA.numBlocksInUse());
+
+            a.deallocateAligned(0, 100, 64);
+            ASSERT(0 == myA.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            void *p = 0;
+            ASSERT_SAFE_PASS(p = a.allocateAligned(100, 64));
+            ASSERT_SAFE_PASS(a.deallocateAligned(p, 100, 64));
+
+            ASSERT_SAFE_FAIL(a.allocateAligned(100, 0));
+            ASSERT_SAFE_FAIL(a.allocateAligned(100, 48));
+            ASSERT_SAFE_FAIL(a.deallocateAligned(&p, 100, 48));
+        }
+        ASSERT(0 == myA.numBlocksInUse());
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'deallocateSized' TEST:
+        //   We want to make sure that the default implementation of
+        //   'deallocateSized' forwards to 'deallocate', and that a derived
+        //   class may override it.
+        //
+        // Plan:
+        //   Invoke 'deallocateSized' through a base class reference to an
+        //   allocator that does not override it, and verify that 'deallocate'
+        //   is called.  Repeat with an allocator that overrides it, and verify
+        //   that the override is called with the supplied size and that
+        //   'deallocate' is not called.
+        //
+        // Testing:
+        //   virtual void deallocateSized(void *address, size_type size);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'deallocateSized' TEST"
+                            "\n======================\n");
+
+        if (verbose) printf("\nTesting the default implementation.\n");
+        {
+            my_Allocator myA;
+            bslma::Allocator& a = myA;
+
+            void *p = a.allocate(15);
+            ASSERT(1 == myA.allocateCount());
+
+            a.deallocateSized(p, 15);
+            ASSERT(2 == myA.fun());
+            ASSERT(1 == myA.deallocateCount());
+        }
+
+        if (verbose) printf("\nTesting an overriding implementation.\n");
+        {
+            my_SizedAllocator myA;
+            bslma::Allocator& a = myA;
+
+            void *p = a.allocate(15);
+            ASSERT(1 == myA.allocateCount());
+
+            a.deallocateSized(p, 15);
+            ASSERT(1  == myA.deallocateSizedCount());
+            ASSERT(15 == myA.size());
+            ASSERT(0  == myA.deallocateCount());
+
+            a.deallocate(p);
+            ASSERT(1  == myA.deallocateSizedCount());
+            ASSERT(1  == myA.deallocateCount());
+        }
+
       } break;
       case 5: {
         // --------------------------------------------------------------------
@@ -0,0 +1,344 @@
+// bslma_concurrentpoolallocator.cpp                                  -*-C++-*-
+#include <bslma_concurrentpoolallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_types.h>
+
+#include <cstddef>  // 'offsetof'
+
+namespace BloombergLP {
+
+namespace bslma {
+
+                        // -----------------------------
+                        // class ConcurrentPoolAllocator
+                        // -----------------------------
+
+// PRIVATE MANIPULATORS
+ConcurrentPoolAllocator::FreeBlock *
+ConcurrentPoolAllocator::acquireMagazine(int poolIndex, int *length)
+{
+    BSLS_ASSERT(0 <= poolIndex);
+    BSLS_ASSERT(poolIndex < d_numPools);
+    BSLS_ASSERT(length);
+
+    typedef bsls::AtomicDoubleWord::Value Value;
+
+    // Pop the top magazine.  The modification count of the depot ensures
+    // that the compare-and-swap fails if the top magazine was popped, and
+    // pushed again with a different successor, in the meantime.
+
+    bsls::AtomicDoubleWord& depot = d_depots[poolIndex].d_top;
+    Value                   top   = depot.loadAcquire();
+    for (;;) {
+        FreeBlock *magazine = reinterpret_cast<FreeBlock *>(top.d_low);
+        if (!magazine) {
+            return allocateChunk(poolIndex, length);                  // RETURN
+        }
+
+        const Value newTop = {
+             reinterpret_cast<bsls::Types::Uint64>(magazine->d_nextMagazine_p),
+             top.d_high + 1 };
+
+        const Value old = depot.testAndSwapAcqRel(top, newTop);
+        if (old == top) {
+            *length = header(magazine)->d_info.d_magazineLength;
+            return magazine;                                          // RETURN
+        }
+        top = old;
+    }
+}
+
+ConcurrentPoolAllocator::FreeBlock *
+ConcurrentPoolAllocator::allocateChunk(int poolIndex, int *length)
+{
+    // Each block consists of a header followed by the memory of its size
+    // class, rounded up so that consecutive blocks are maximally aligned.
+
+    const size_type blockSize = bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                               sizeof(BlockHeader)
+                             + (static_cast<size_type>(k_MIN_BLOCK_SIZE)
+                                                                << poolIndex));
+
+    Chunk *chunk = static_cast<Chunk *>(
+         d_allocator_p->allocate(sizeof(Chunk) + k_MAGAZINE_SIZE * blockSize));
+
+    Chunk *head;
+    do {
+        head = static_cast<Chunk *>(const_cast<void *>(
+                               bsls::AtomicOperations::getPtr(&d_chunkList)));
+        chunk->d_next_p = head;
+    } while (head != bsls::AtomicOperations::testAndSwapPtrAcqRel(
+                                                  &d_chunkList, head, chunk));
+
+    // Stamp each block with its size class, and link all of the blocks into
+    // a single magazine.
+
+    char      *block = reinterpret_cast<char *>(chunk + 1);
+    FreeBlock *next  = 0;
+    for (int i = k_MAGAZINE_SIZE - 1; 0 <= i; --i) {
+        BlockHeader *blockHeader =
+                        reinterpret_cast<BlockHeader *>(block + i * blockSize);
+        blockHeader->d_info.d_poolIndex      = poolIndex;
+        blockHeader->d_info.d_magazineLength = 0;
+
+        FreeBlock *freeBlock = reinterpret_cast<FreeBlock *>(blockHeader + 1);
+        freeBlock->d_next_p         = next;
+        freeBlock->d_nextMagazine_p = 0;
+        next = freeBlock;
+    }
+
+    *length = k_MAGAZINE_SIZE;
+    return next;
+}
+
+void *ConcurrentPoolAllocator::allocateLarge(size_type size)
+{
+    BlockHeader *blockHeader = static_cast<BlockHeader *>(
+                         d_allocator_p->allocate(sizeof(BlockHeader) + size));
+
+    blockHeader->d_info.d_poolIndex      = -1;
+    blockHeader->d_info.d_magazineLength = 0;
+    return blockHeader + 1;
+}
+
+void ConcurrentPoolAllocator::deallocateLarge(BlockHeader *header)
+{
+    BSLS_ASSERT(-1 == header->d_info.d_poolIndex);
+
+    d_allocator_p->deallocate(header);
+}
+
+void ConcurrentPoolAllocator::init()
+{
+    BSLS_ASSERT(1 <= d_numPools);
+    BSLS_ASSERT(d_numPools <= k_MAX_NUM_POOLS);
+
+    bsls::AtomicOperations::initPointer(&d_chunkList, 0);
+}
+
+void ConcurrentPoolAllocator::releaseMagazine(int        poolIndex,
+                                              FreeBlock *magazine,
+                                              int        length)
+{
+    BSLS_ASSERT(magazine);
+    BSLS_ASSERT(0 < length);
+
+    header(magazine)->d_info.d_magazineLength = length;
+
+    typedef bsls::AtomicDoubleWord::Value Value;
+
+    bsls::AtomicDoubleWord& depot = d_depots[poolIndex].d_top;
+    Value                   top   = depot.loadRelaxed();
+    for (;;) {
+        magazine->d_nextMagazine_p = reinterpret_cast<FreeBlock *>(top.d_low);
+
+        const Value newTop = {
+                          reinterpret_cast<bsls::Types::Uint64>(magazine),
+                          top.d_high + 1 };
+
+        const Value old = depot.testAndSwapAcqRel(top, newTop);
+        if (old == top) {
+            return;                                                   // RETURN
+        }
+        top = old;
+    }
+}
+
+// CREATORS
+ConcurrentPoolAllocator::ConcurrentPoolAllocator(Allocator *basicAllocator)
+: d_numPools(k_DEFAULT_NUM_POOLS)
+, d_maxPooledBlockSize(static_cast<size_type>(k_MIN_BLOCK_SIZE)
+                                                  << (k_DEFAULT_NUM_POOLS - 1))
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+    init();
+}
+
+ConcurrentPoolAllocator::ConcurrentPoolAllocator(int        numPools,
+                                                 Allocator *basicAllocator)
+: d_numPools(numPools)
+, d_maxPooledBlockSize(static_cast<size_type>(k_MIN_BLOCK_SIZE)
+                                                             << (numPools - 1))
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numPools);
+    BSLS_ASSERT(numPools <= k_MAX_NUM_POOLS);
+
+    init();
+}
+
+ConcurrentPoolAllocator::~ConcurrentPoolAllocator()
+{
+    Chunk *chunk = static_cast<Chunk *>(const_cast<void *>(
+                               bsls::AtomicOperations::getPtr(&d_chunkList)));
+    while (chunk) {
+        Chunk *next = chunk->d_next_p;
+        d_allocator_p->deallocate(chunk);
+        chunk = next;
+    }
+}
+
+// MANIPULATORS
+void *ConcurrentPoolAllocator::allocate(size_type size)
+{
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    if (size > d_maxPooledBlockSize) {
+        return allocateLarge(size);                                   // RETURN
+    }
+
+    const int  index    = poolIndex(size);
+    int        length;
+    FreeBlock *magazine = acquireMagazine(index, &length);
+
+    // Return the remainder of the magazine, if any, to the depot.
+
+    if (1 < length) {
+        releaseMagazine(index, magazine->d_next_p, length - 1);
+    }
+    return magazine;
+}
+
+void ConcurrentPoolAllocator::deallocate(void *address)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    BlockHeader *blockHeader = header(address);
+    const int    index       = blockHeader->d_info.d_poolIndex;
+
+    if (index < 0) {
+        deallocateLarge(blockHeader);
+        return;                                                       // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(index < d_numPools);
+
+    FreeBlock *block = static_cast<FreeBlock *>(address);
+    block->d_next_p  = 0;
+    releaseMagazine(index, block, 1);
+}
+
+                        // -------------------------------
+                        // class ConcurrentPoolThreadCache
+                        // -------------------------------
+
+// PRIVATE MANIPULATORS
+void *ConcurrentPoolThreadCache::allocateSlow(int poolIndex)
+{
+    Slot& slot = d_slots[poolIndex];
+
+    BSLS_ASSERT(0 == slot.d_loaded.d_length);
+
+    if (0 < slot.d_previous.d_length) {
+        slot.d_loaded              = slot.d_previous;
+        slot.d_previous.d_blocks_p = 0;
+        slot.d_previous.d_length   = 0;
+    }
+    else {
+        slot.d_loaded.d_blocks_p = d_pool_p->acquireMagazine(
+                                                     poolIndex,
+                                                     &slot.d_loaded.d_length);
+    }
+
+    FreeBlock *block         = slot.d_loaded.d_blocks_p;
+    slot.d_loaded.d_blocks_p = block->d_next_p;
+    --slot.d_loaded.d_length;
+    return block;
+}
+
+void ConcurrentPoolThreadCache::deallocateSlow(int        poolIndex,
+                                               FreeBlock *block)
+{
+    Slot& slot = d_slots[poolIndex];
+
+    BSLS_ASSERT(ConcurrentPoolAllocator::k_MAGAZINE_SIZE ==
+                                                      slot.d_loaded.d_length);
+
+    if (0 < slot.d_previous.d_length) {
+        d_pool_p->releaseMagazine(poolIndex,
+                                  slot.d_previous.d_blocks_p,
+                                  slot.d_previous.d_length);
+    }
+    slot.d_previous          = slot.d_loaded;
+    slot.d_loaded.d_blocks_p = 0;
+    slot.d_loaded.d_length   = 0;
+
+    block->d_next_p          = 0;
+    slot.d_loaded.d_blocks_p = block;
+    slot.d_loaded.d_length   = 1;
+}
+
+// CREATORS
+ConcurrentPoolThreadCache::ConcurrentPoolThreadCache(
+                                                 ConcurrentPoolAllocator *pool)
+: d_pool_p(pool)
+{
+    BSLS_ASSERT(pool);
+
+    for (int i = 0; i < ConcurrentPoolAllocator::k_MAX_NUM_POOLS; ++i) {
+        d_slots[i].d_loaded.d_blocks_p   = 0;
+        d_slots[i].d_loaded.d_length     = 0;
+        d_slots[i].d_previous.d_blocks_p = 0;
+        d_slots[i].d_previous.d_length   = 0;
+    }
+}
+
+ConcurrentPoolThreadCache::~ConcurrentPoolThreadCache()
+{
+    flush();
+}
+
+// MANIPULATORS
+void ConcurrentPoolThreadCache::flush()
+{
+    for (int i = 0; i < d_pool_p->d_numPools; ++i) {
+        Magazine *magazines[] = { &d_slots[i].d_loaded,
+                                  &d_slots[i].d_previous };
+
+        for (int j = 0; j < 2; ++j) {
+            Magazine& magazine = *magazines[j];
+            if (0 < magazine.d_length) {
+                d_pool_p->releaseMagazine(i,
+                                          magazine.d_blocks_p,
+                                          magazine.d_length);
+                magazine.d_blocks_p = 0;
+                magazine.d_length   = 0;
+            }
+        }
+    }
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,655 @@
+// bslma_concurrentpoolallocator.h                                    -*-C++-*-
+#ifndef INCLUDED_BSLMA_CONCURRENTPOOLALLOCATOR
+#define INCLUDED_BSLMA_CONCURRENTPOOLALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe pool allocator with per-thread caches.
+//
+//@CLASSES:
+//  bslma::ConcurrentPoolAllocator: thread-safe multipool with shared depots
+//  bslma::ConcurrentPoolThreadCache: single-thread cache of a concurrent pool
+//
+//@SEE_ALSO: bslma_multipoolallocator, bsls_atomicoperations
+//
+//@DESCRIPTION: This component provides a thread-safe allocator,
+// 'bslma::ConcurrentPoolAllocator', that pools blocks in power-of-two size
+// classes (see {'bslma_multipoolallocator'}), and a companion allocator,
+// 'bslma::ConcurrentPoolThreadCache', through which a single thread obtains
+// blocks from, and returns blocks to, a concurrent pool at the speed of an
+// unsynchronized pool:
+//..
+//   ,-------------------------------.
+//  ( bslma::ConcurrentPoolThreadCache )
+//   `-------------------------------'
+//                  |        ctor/dtor
+//                  |        flush
+//                  |        pool
+//                  |
+//                  |      ,------------------------------.
+//                  |     ( bslma::ConcurrentPoolAllocator )
+//                  |      `------------------------------'
+//                  |                     |        ctor/dtor
+//                  |                     |        numPools
+//                  |                     |        maxPooledBlockSize
+//                  |                     |        allocator
+//                  V                     V
+//                   ,----------------.
+//                  ( bslma::Allocator )
+//                   `----------------'
+//                                   allocate
+//                                   deallocate
+//..
+//
+///Magazines and Depots
+///--------------------
+// Free blocks of each size class are grouped into *magazines*: linked lists
+// of up to 'k_MAGAZINE_SIZE' blocks.  The free magazines of each size class
+// are kept in a *depot* shared by all threads: a lock-free stack of
+// magazines implemented with 'bsls::AtomicDoubleWord'.
+//
+// A 'bslma::ConcurrentPoolThreadCache', which is owned by a single thread,
+// holds up to two magazines of each size class: a *loaded* magazine, from
+// which blocks are allocated and to which blocks are deallocated, and a
+// *previous* magazine.  Allocation and deallocation through a cache involve
+// no atomic operations unless the loaded magazine runs empty or overflows,
+// in which case the cache exchanges it with its previous magazine, or
+// exchanges a whole magazine with the depot.  Keeping a previous magazine
+// ensures that a thread alternating between allocation and deallocation at
+// the boundary of a magazine does not access the depot on every call.  When
+// the depot of a size class is empty, a chunk holding a full magazine of
+// blocks is obtained from the upstream allocator.
+//
+// Since blocks move between threads a magazine at a time, a pipeline in
+// which blocks are allocated by a producer thread and deallocated by a
+// consumer thread, each through its own cache, performs one atomic operation
+// on the shared depot per 'k_MAGAZINE_SIZE' blocks in each thread.
+//
+// The 'allocate' and 'deallocate' methods of 'bslma::ConcurrentPoolAllocator'
+// itself operate on the depots directly, and may be called from any thread
+// without a cache, at the cost of atomic operations on every call.  Memory
+// allocated through a cache (or the allocator itself) may be deallocated
+// through any cache of the same allocator (or the allocator itself).
+//
+// Each block carries a small header recording its size class, so that
+// 'deallocate' does not need to be told the size of a block.  All memory
+// dispensed is maximally aligned.  Requests larger than
+// 'maxPooledBlockSize()' are forwarded to the upstream allocator, and
+// returned to it on 'deallocate'.
+//
+// Note that the stack operations on a depot are immune to the "ABA" problem:
+// the address of the top magazine is paired with a count of the
+// modifications of the stack, and both are updated with a single double-word
+// compare-and-swap, so that popping a magazine fails if any other thread
+// has modified the stack in the meantime.  Since chunks are returned to the
+// upstream allocator only on destruction of the pool, reading the next
+// magazine of a magazine that another thread popped concurrently is
+// harmless.  Also note that, on x86-64, the double-word compare-and-swap
+// requires a 'bslma::ConcurrentPoolAllocator' object to be 16-byte aligned
+// (see 'bsls_atomicdoubleword'), as are the objects of static and automatic
+// storage duration, and the memory obtained from 'operator new' and from the
+// 'bslma' allocators.
+//
+///Thread Safety
+///-------------
+// 'bslma::ConcurrentPoolAllocator' is *fully thread-safe*: its 'allocate' and
+// 'deallocate' methods may be called concurrently from any number of
+// threads, and concurrently with the use of any of its caches.  The upstream
+// allocator supplied at construction must also be fully thread-safe (e.g.,
+// 'bslma::NewDeleteAllocator').
+//
+// 'bslma::ConcurrentPoolThreadCache' is *not* thread-safe: a cache object
+// may be used only by one thread at a time, and is intended to be created by
+// each thread that uses the concurrent pool.  All of the caches of a
+// concurrent pool must be destroyed before the pool.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing a Pool Between Threads
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a pipeline in which a producer thread creates
+// messages that are processed, and then destroyed, by a consumer thread.
+// Each thread accesses a shared concurrent pool through its own cache.
+//
+// First, we define a simple message type:
+//..
+//  struct my_Message {
+//      int  d_sequenceNumber;
+//      char d_payload[60];
+//  };
+//..
+// Then, we create the concurrent pool shared by the threads, supplying the
+// (thread-safe) new/delete allocator as its upstream allocator:
+//..
+//  bslma::ConcurrentPoolAllocator pool(
+//                                 &bslma::NewDeleteAllocator::singleton());
+//..
+// Next, each thread creates a cache of the pool for its own use.  For the
+// sake of brevity, we show the work of both threads in a single thread:
+//..
+//  bslma::ConcurrentPoolThreadCache producerCache(&pool);
+//  bslma::ConcurrentPoolThreadCache consumerCache(&pool);
+//..
+// Then, the producer creates messages using its cache:
+//..
+//  my_Message *messages[100];
+//  for (int i = 0; i < 100; ++i) {
+//      messages[i] = new (producerCache) my_Message();
+//      messages[i]->d_sequenceNumber = i;
+//  }
+//..
+// Next, the consumer processes, and destroys, the messages using its own
+// cache.  Note that the blocks accumulated by the consumer are returned to
+// the shared depot, a magazine at a time, as the consumer's cache fills up:
+//..
+//  for (int i = 0; i < 100; ++i) {
+//      assert(i == messages[i]->d_sequenceNumber);
+//      consumerCache.deleteObject(messages[i]);
+//  }
+//..
+// Finally, the producer creates more messages, reusing the magazines of
+// blocks returned by the consumer rather than obtaining more memory from the
+// upstream allocator:
+//..
+//  for (int i = 0; i < 50; ++i) {
+//      messages[i] = new (producerCache) my_Message();
+//  }
+//  for (int i = 0; i < 50; ++i) {
+//      producerCache.deleteObject(messages[i]);
+//  }
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICDOUBLEWORD
+#include <bsls_atomicdoubleword.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslma {
+
+class ConcurrentPoolThreadCache;
+
+                        // =============================
+                        // class ConcurrentPoolAllocator
+                        // =============================
+
+class ConcurrentPoolAllocator : public Allocator {
+    // This class provides a fully thread-safe allocator that dispenses
+    // memory from a lock-free depot of magazines of free blocks for each
+    // power-of-two size class, and that forwards requests larger than the
+    // largest size class to an upstream allocator.
+
+    // PRIVATE TYPES
+    typedef bsls::AtomicOperations::AtomicTypes AtomicTypes;
+
+    enum { k_CACHE_LINE_SIZE = 64 };  // assumed size of a cache line
+
+    struct BlockInfo {
+        // This 'struct' describes the information held in the header of
+        // each block.
+
+        int d_poolIndex;       // index of the size class, or -1 for a large
+                               // block
+
+        int d_magazineLength;  // number of blocks in the magazine, if the
+                               // block is free and first in its magazine
+    };
+
+    union BlockHeader {
+        // This 'union' precedes the memory of each block dispensed by this
+        // allocator.
+
+        BlockInfo                           d_info;       // block information
+
+        bsls::AlignmentUtil::MaxAlignedType d_alignment;  // ensure the block
+                                                          // memory is
+                                                          // maximally aligned
+    };
+
+    struct FreeBlock {
+        // This 'struct' occupies the memory of each free block, implementing
+        // the list of blocks of a magazine, and the stack of magazines of a
+        // depot.
+
+        FreeBlock *d_next_p;          // next block of the magazine
+
+        FreeBlock *d_nextMagazine_p;  // next magazine of the depot, if first
+                                      // in its magazine
+    };
+
+    union Chunk {
+        // This 'union' prepends each chunk of blocks obtained from the
+        // upstream allocator, implementing the list of chunks.
+
+        Chunk                               *d_next_p;     // next chunk
+
+        bsls::AlignmentUtil::MaxAlignedType  d_alignment;  // ensure each
+                                                           // block is aligned
+    };
+
+    struct Depot {
+        // This 'struct' holds the stack of free magazines of one size class,
+        // padded to occupy a cache line of its own.
+
+        bsls::AtomicDoubleWord d_top;  // address of the top magazine of
+                                       // the stack, and modification count
+
+        char                   d_pad[k_CACHE_LINE_SIZE
+                                     - sizeof(bsls::AtomicDoubleWord)];
+                                       // padding to a cache line
+    };
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_MIN_BLOCK_SIZE    = 16,   // size of the smallest size class
+
+        k_DEFAULT_NUM_POOLS = 8,    // default number of size classes
+
+        k_MAX_NUM_POOLS     = 16,   // maximum number of size classes
+
+        k_MAGAZINE_SIZE     = 32    // maximum number of blocks in a magazine
+    };
+
+  private:
+    // DATA
+    Depot                      d_depots[k_MAX_NUM_POOLS];
+                                                 // free magazines of each size
+                                                 // class
+
+    AtomicTypes::Pointer       d_chunkList;      // chunks obtained from the
+                                                 // upstream allocator
+
+    int                        d_numPools;       // number of size classes
+
+    size_type                  d_maxPooledBlockSize;
+                                                 // size of the largest size
+                                                 // class
+
+    Allocator                 *d_allocator_p;    // upstream allocator (held,
+                                                 // not owned)
+
+    // FRIENDS
+    friend class ConcurrentPoolThreadCache;
+
+  private:
+    // NOT IMPLEMENTED
+    ConcurrentPoolAllocator(const ConcurrentPoolAllocator&);
+    ConcurrentPoolAllocator& operator=(const ConcurrentPoolAllocator&);
+
+    // PRIVATE CLASS METHODS
+    static BlockHeader *header(void *address);
+        // Return the address of the header of the block at the specified
+        // 'address'.
+
+    static int poolIndex(size_type size);
+        // Return the index of the smallest size class that can hold a block
+        // of the specified 'size' (in bytes).  The behavior is undefined
+        // unless '0 < size'.
+
+    // PRIVATE MANIPULATORS
+    FreeBlock *acquireMagazine(int poolIndex, int *length);
+        // Remove a magazine from the depot of the size class at the
+        // specified 'poolIndex', or, if the depot is empty, create a full
+        // magazine from a chunk obtained from the upstream allocator, load
+        // the number of blocks of the magazine into the specified 'length',
+        // and return the address of its first block.
+
+    FreeBlock *allocateChunk(int poolIndex, int *length);
+        // Obtain a chunk of blocks of the size class at the specified
+        // 'poolIndex' from the upstream allocator, load the number of blocks
+        // into the specified 'length', and return the address of the first
+        // block of a magazine holding all of the blocks.
+
+    void *allocateLarge(size_type size);
+        // Return the address of a maximally-aligned block of memory of the
+        // specified 'size' (in bytes) obtained from the upstream allocator.
+
+    void deallocateLarge(BlockHeader *header);
+        // Return the large block having the specified 'header' to the
+        // upstream allocator.
+
+    void init();
+        // Initialize the list of chunks of this pool.  The behavior is
+        // undefined unless the number of size classes of this pool is in the
+        // range '[1 .. k_MAX_NUM_POOLS]'.  Note that the depots are
+        // initialized empty on construction.
+
+    void releaseMagazine(int poolIndex, FreeBlock *magazine, int length);
+        // Push the specified 'magazine' having the specified 'length' number
+        // of blocks onto the depot of the size class at the specified
+        // 'poolIndex'.  The behavior is undefined unless '0 < length'.
+
+  public:
+    // CREATORS
+    explicit ConcurrentPoolAllocator(Allocator *basicAllocator = 0);
+    explicit ConcurrentPoolAllocator(int        numPools,
+                                     Allocator *basicAllocator = 0);
+        // Create a concurrent pool allocator.  Optionally specify the
+        // 'numPools' number of power-of-two size classes, the smallest of
+        // which is 'k_MIN_BLOCK_SIZE'; if 'numPools' is not specified,
+        // 'k_DEFAULT_NUM_POOLS' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '1 <= numPools <= k_MAX_NUM_POOLS', and the
+        // upstream allocator is fully thread-safe.
+
+    virtual ~ConcurrentPoolAllocator();
+        // Destroy this allocator, returning all of the chunks obtained from
+        // the upstream allocator to the upstream allocator.  The behavior is
+        // undefined unless all of the caches of this allocator have been
+        // destroyed.  Note that blocks larger than 'maxPooledBlockSize()'
+        // that have not been deallocated are *not* returned.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return the address of a contiguous block of maximally-aligned
+        // memory of at least the specified 'size' (in bytes), taken from the
+        // depot of the appropriate size class.  If 'size' is 0, no memory is
+        // allocated and 0 is returned.  If 'size' exceeds
+        // 'maxPooledBlockSize()', the memory is obtained directly from the
+        // upstream allocator.  This method is thread-safe.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to the depot of
+        // its size class, or to the upstream allocator if it exceeds
+        // 'maxPooledBlockSize()'.  If 'address' is 0, this method has no
+        // effect.  This method is thread-safe.  The behavior is undefined
+        // unless 'address' was allocated by this allocator or one of its
+        // caches, and has not already been deallocated.
+
+    // ACCESSORS
+    int numPools() const;
+        // Return the number of size classes of this allocator.
+
+    size_type maxPooledBlockSize() const;
+        // Return the size (in bytes) of the largest size class of this
+        // allocator.  Larger requests are forwarded to the upstream
+        // allocator.
+
+    Allocator *allocator() const;
+        // Return the address of the upstream allocator used by this
+        // allocator to supply memory.
+};
+
+                        // ===============================
+                        // class ConcurrentPoolThreadCache
+                        // ===============================
+
+class ConcurrentPoolThreadCache : public Allocator {
+    // This class provides an allocator, for use by a single thread, that
+    // caches magazines of free blocks of a 'ConcurrentPoolAllocator', so that
+    // most allocations and deallocations involve no synchronization.
+
+    // PRIVATE TYPES
+    typedef ConcurrentPoolAllocator::FreeBlock FreeBlock;
+
+    struct Magazine {
+        // This 'struct' describes a magazine held by this cache.
+
+        FreeBlock *d_blocks_p;  // first free block, or 0 if empty
+        int        d_length;    // number of free blocks
+    };
+
+    struct Slot {
+        // This 'struct' holds the magazines of one size class.
+
+        Magazine d_loaded;    // magazine allocated from and deallocated to
+        Magazine d_previous;  // magazine exchanged with the loaded one
+    };
+
+    // DATA
+    Slot                     d_slots[ConcurrentPoolAllocator::k_MAX_NUM_POOLS];
+                                          // magazines of each size class
+
+    ConcurrentPoolAllocator *d_pool_p;    // cached pool (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ConcurrentPoolThreadCache(const ConcurrentPoolThreadCache&);
+    ConcurrentPoolThreadCache& operator=(const ConcurrentPoolThreadCache&);
+
+    // PRIVATE MANIPULATORS
+    void *allocateSlow(int poolIndex);
+        // Return the address of a block of the size class at the specified
+        // 'poolIndex', after exchanging the (empty) loaded magazine of that
+        // size class with the previous magazine or with a magazine from the
+        // depot.
+
+    void deallocateSlow(int poolIndex, FreeBlock *block);
+        // Add the specified 'block' of the size class at the specified
+        // 'poolIndex' to this cache, after exchanging the (full) loaded
+        // magazine of that size class with the previous magazine or with an
+        // empty magazine.
+
+  public:
+    // CREATORS
+    explicit ConcurrentPoolThreadCache(ConcurrentPoolAllocator *pool);
+        // Create a cache of the specified concurrent 'pool'.  The behavior is
+        // undefined unless 'pool' outlives this object.
+
+    virtual ~ConcurrentPoolThreadCache();
+        // Return all of the magazines held by this cache to the depots of the
+        // cached pool, and destroy this cache.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return the address of a contiguous block of maximally-aligned
+        // memory of at least the specified 'size' (in bytes), taken from the
+        // magazines of this cache if possible.  If 'size' is 0, no memory is
+        // allocated and 0 is returned.  If 'size' exceeds
+        // 'pool()->maxPooledBlockSize()', the memory is obtained directly
+        // from the upstream allocator of the cached pool.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to the magazines
+        // of this cache, or to the upstream allocator of the cached pool if
+        // it exceeds 'pool()->maxPooledBlockSize()'.  If 'address' is 0, this
+        // method has no effect.  The behavior is undefined unless 'address'
+        // was allocated by the cached pool or one of its caches, and has not
+        // already been deallocated.
+
+    void flush();
+        // Return all of the magazines held by this cache to the depots of the
+        // cached pool, making their blocks available to other threads.
+
+    // ACCESSORS
+    ConcurrentPoolAllocator *pool() const;
+        // Return the address of the concurrent pool cached by this object.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // -----------------------------
+                        // class ConcurrentPoolAllocator
+                        // -----------------------------
+
+// PRIVATE CLASS METHODS
+inline
+ConcurrentPoolAllocator::BlockHeader *
+ConcurrentPoolAllocator::header(void *address)
+{
+    return static_cast<BlockHeader *>(address) - 1;
+}
+
+inline
+int ConcurrentPoolAllocator::poolIndex(size_type size)
+{
+    BSLS_ASSERT_SAFE(0 < size);
+
+    if (size <= k_MIN_BLOCK_SIZE) {
+        return 0;                                                     // RETURN
+    }
+
+    // The size class of 'size' is the bit width of 'size - 1', offset by the
+    // bit width of 'k_MIN_BLOCK_SIZE - 1' (i.e., 4).
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return static_cast<int>(sizeof(unsigned long long) * 8)
+         - __builtin_clzll(static_cast<unsigned long long>(size - 1))
+         - 4;
+#else
+    int       index     = 1;
+    size_type blockSize = 2 * k_MIN_BLOCK_SIZE;
+    while (blockSize < size) {
+        blockSize *= 2;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+// ACCESSORS
+inline
+int ConcurrentPoolAllocator::numPools() const
+{
+    return d_numPools;
+}
+
+inline
+ConcurrentPoolAllocator::size_type
+ConcurrentPoolAllocator::maxPooledBlockSize() const
+{
+    return d_maxPooledBlockSize;
+}
+
+inline
+Allocator *ConcurrentPoolAllocator::allocator() const
+{
+    return d_allocator_p;
+}
+
+                        // -------------------------------
+                        // class ConcurrentPoolThreadCache
+                        // -------------------------------
+
+// MANIPULATORS
+inline
+void *ConcurrentPoolThreadCache::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                     size <= d_pool_p->d_maxPooledBlockSize)) {
+        const int  index  = ConcurrentPoolAllocator::poolIndex(size);
+        Magazine&  loaded = d_slots[index].d_loaded;
+        FreeBlock *block  = loaded.d_blocks_p;
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != block)) {
+            loaded.d_blocks_p = block->d_next_p;
+            --loaded.d_length;
+            return block;                                             // RETURN
+        }
+        return allocateSlow(index);                                   // RETURN
+    }
+
+    return d_pool_p->allocateLarge(size);
+}
+
+inline
+void ConcurrentPoolThreadCache::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    ConcurrentPoolAllocator::BlockHeader *header =
+                                      ConcurrentPoolAllocator::header(address);
+    const int index = header->d_info.d_poolIndex;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 <= index)) {
+        BSLS_ASSERT_SAFE(index < d_pool_p->d_numPools);
+
+        enum { k_MAGAZINE_SIZE = ConcurrentPoolAllocator::k_MAGAZINE_SIZE };
+
+        Magazine&  loaded = d_slots[index].d_loaded;
+        FreeBlock *block  = static_cast<FreeBlock *>(address);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                          loaded.d_length < k_MAGAZINE_SIZE)) {
+            block->d_next_p   = loaded.d_blocks_p;
+            loaded.d_blocks_p = block;
+            ++loaded.d_length;
+            return;                                                   // RETURN
+        }
+        deallocateSlow(index, block);
+        return;                                                       // RETURN
+    }
+
+    d_pool_p->deallocateLarge(header);
+}
+
+// ACCESSORS
+inline
+ConcurrentPoolAllocator *ConcurrentPoolThreadCache::pool() const
+{
+    return d_pool_p;
+}
+
+}  // close package namespace
+
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1174 @@
+// bslma_concurrentpoolallocator.t.cpp                                -*-C++-*-
+
+#include <bslma_concurrentpoolallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// For thread support
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE thread_t;
+#else
+#include <pthread.h>
+#include <sched.h>
+typedef pthread_t thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a thread-safe allocator that pools blocks
+// in power-of-two size classes, holding free blocks in lock-free depots of
+// magazines, and a single-threaded cache of magazines through which a thread
+// uses the pool.  We first verify, in a single thread, the size classes,
+// alignment, and reuse of blocks, and the movement of magazines between
+// caches and depots, using a 'bslma::TestAllocator' as the upstream
+// allocator.  We then stress the allocator from several threads, including a
+// producer/consumer pipeline in which blocks are allocated on one thread and
+// deallocated on another, using a thread-safe counting allocator as the
+// upstream allocator to verify that no memory is lost.
+//-----------------------------------------------------------------------------
+// 'ConcurrentPoolAllocator'
+// [ 2] explicit ConcurrentPoolAllocator(Allocator *basicAllocator = 0);
+// [ 2] explicit ConcurrentPoolAllocator(int numPools, Allocator * = 0);
+// [ 3] ~ConcurrentPoolAllocator();
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 2] int numPools() const;
+// [ 2] size_type maxPooledBlockSize() const;
+// [ 2] Allocator *allocator() const;
+//
+// 'ConcurrentPoolThreadCache'
+// [ 4] explicit ConcurrentPoolThreadCache(ConcurrentPoolAllocator *pool);
+// [ 4] ~ConcurrentPoolThreadCache();
+// [ 4] void *allocate(size_type size);
+// [ 4] void deallocate(void *address);
+// [ 4] void flush();
+// [ 4] ConcurrentPoolAllocator *pool() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENCY STRESS TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: PRODUCER/CONSUMER PIPELINE
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslma::ConcurrentPoolAllocator   Obj;
+typedef bslma::ConcurrentPoolThreadCache Cache;
+typedef bslma::Allocator::size_type      size_type;
+
+enum { MAGAZINE_SIZE = Obj::k_MAGAZINE_SIZE };
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == bsls::AlignmentUtil::calculateAlignmentOffset(
+                                   address,
+                                   bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+}
+
+static size_type sizeClass(size_type size)
+    // Return the size of the smallest size class that can hold a block of
+    // the specified 'size'.
+{
+    size_type result = Obj::k_MIN_BLOCK_SIZE;
+    while (result < size) {
+        result *= 2;
+    }
+    return result;
+}
+
+typedef void *(*thread_func)(void *arg);
+
+static thread_t createThread(thread_func func, void *arg)
+    // Create a thread running the specified 'func' with the specified 'arg',
+    // and return its handle.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE) func, arg, 0, 0);
+#else
+    thread_t thr;
+    pthread_create(&thr, 0, func, arg);
+    return thr;
+#endif
+}
+
+static void joinThread(thread_t thr)
+    // Wait for the thread having the specified handle 'thr' to complete.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(thr, INFINITE);
+    CloseHandle(thr);
+#else
+    pthread_join(thr, 0);
+#endif
+}
+
+static void yieldThread()
+    // Offer to give up the processor to another thread.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    Sleep(0);
+#else
+    sched_yield();
+#endif
+}
+
+                        // =======================
+                        // class CountingAllocator
+                        // =======================
+
+class CountingAllocator : public bslma::Allocator {
+    // This class provides a thread-safe allocator that obtains memory from
+    // 'bslma::NewDeleteAllocator', and atomically counts the blocks in use.
+
+    // DATA
+    bsls::AtomicInt d_numBlocksInUse;  // number of blocks in use
+    bsls::AtomicInt d_numBlocksTotal;  // number of blocks ever allocated
+
+  public:
+    // MANIPULATORS
+    virtual void *allocate(size_type size)
+    {
+        ++d_numBlocksInUse;
+        ++d_numBlocksTotal;
+        return bslma::NewDeleteAllocator::singleton().allocate(size);
+    }
+
+    virtual void deallocate(void *address)
+    {
+        if (address) {
+            --d_numBlocksInUse;
+        }
+        bslma::NewDeleteAllocator::singleton().deallocate(address);
+    }
+
+    // ACCESSORS
+    int numBlocksInUse() const
+    {
+        return d_numBlocksInUse;
+    }
+
+    int numBlocksTotal() const
+    {
+        return d_numBlocksTotal;
+    }
+};
+
+                        // ===============
+                        // class BlockRing
+                        // ===============
+
+class BlockRing {
+    // This class provides a bounded single-producer/single-consumer queue of
+    // block addresses.
+
+    enum { k_CAPACITY = 1024 };
+
+    // DATA
+    void            *d_blocks[k_CAPACITY];  // circular buffer
+    bsls::AtomicInt  d_head;                // number of blocks popped
+    bsls::AtomicInt  d_tail;                // number of blocks pushed
+
+  public:
+    // MANIPULATORS
+    void push(void *block)
+        // Append the specified 'block' to this queue, waiting while it is
+        // full.  This method may be called only by the producer thread.
+    {
+        const int tail = d_tail.loadRelaxed();
+        while (tail - d_head.loadAcquire() == k_CAPACITY) {
+            yieldThread();
+        }
+        d_blocks[tail % k_CAPACITY] = block;
+        d_tail.storeRelease(tail + 1);
+    }
+
+    void *pop()
+        // Remove and return the first block of this queue, waiting while it
+        // is empty.  This method may be called only by the consumer thread.
+    {
+        const int head = d_head.loadRelaxed();
+        while (d_tail.loadAcquire() == head) {
+            yieldThread();
+        }
+        void *block = d_blocks[head % k_CAPACITY];
+        d_head.storeRelease(head + 1);
+        return block;
+    }
+};
+
+                        // ==================
+                        // struct ThreadParam
+                        // ==================
+
+enum Mode {
+    // This enumeration identifies the allocator used by a test thread.
+
+    e_NEW_DELETE,  // 'bslma::NewDeleteAllocator'
+    e_POOL,        // the pool under test, directly
+    e_CACHE        // a cache of the pool under test
+};
+
+struct ThreadParam {
+    // This 'struct' holds the arguments of the test threads.
+
+    Obj             *d_pool_p;        // pool under test
+    BlockRing       *d_ring_p;        // queue of a pipeline, if any
+    int              d_id;            // identifier of the thread
+    int              d_iterations;    // number of iterations
+    Mode             d_mode;          // allocator used by the thread
+    bsls::AtomicInt *d_errors_p;      // number of errors detected
+};
+
+static bslma::Allocator *threadAllocator(const ThreadParam&  param,
+                                         Cache              *cache)
+    // Return the address of the allocator to be used by the thread having
+    // the specified 'param', given its specified 'cache'.
+{
+    switch (param.d_mode) {
+      case e_NEW_DELETE: return &bslma::NewDeleteAllocator::singleton();
+      case e_POOL:       return param.d_pool_p;
+      default:           return cache;
+    }
+}
+
+static size_type testSize(int id, int i)
+    // Return the size of the block allocated by the thread having the
+    // specified 'id' on the specified iteration 'i'.
+{
+    return static_cast<size_type>((i * 7 + id * 13) % 300 + 1);
+}
+
+static void *workerThread(void *arg)
+    // Repeatedly allocate blocks of various sizes from the pool specified by
+    // the 'ThreadParam' at the specified 'arg', fill them with a pattern
+    // identifying this thread, and deallocate them in an order different
+    // from that of allocation, counting any block whose pattern was
+    // corrupted.
+{
+    ThreadParam&      param = *static_cast<ThreadParam *>(arg);
+    Cache             cache(param.d_pool_p);
+    bslma::Allocator *allocator = threadAllocator(param, &cache);
+
+    enum { NUM_BLOCKS = 64 };
+    unsigned char *blocks[NUM_BLOCKS];
+    size_type      sizes[NUM_BLOCKS];
+
+    const unsigned char PATTERN = static_cast<unsigned char>(param.d_id);
+
+    for (int r = 0; r < param.d_iterations; ++r) {
+        for (int i = 0; i < NUM_BLOCKS; ++i) {
+            sizes[i]  = testSize(param.d_id, r + i);
+            blocks[i] = static_cast<unsigned char *>(
+                                               allocator->allocate(sizes[i]));
+            memset(blocks[i], PATTERN, sizes[i]);
+        }
+        for (int k = 0; k < 2; ++k) {
+            for (int i = k; i < NUM_BLOCKS; i += 2) {
+                for (size_type j = 0; j < sizes[i]; ++j) {
+                    if (PATTERN != blocks[i][j]) {
+                        ++*param.d_errors_p;
+                        break;
+                    }
+                }
+                allocator->deallocate(blocks[i]);
+            }
+        }
+    }
+    return 0;
+}
+
+static void *producerThread(void *arg)
+    // Allocate blocks from the pool specified by the 'ThreadParam' at the
+    // specified 'arg', write their sequence number into them, and pass them
+    // to the consumer through the queue of the 'ThreadParam'.
+{
+    ThreadParam&      param = *static_cast<ThreadParam *>(arg);
+    Cache             cache(param.d_pool_p);
+    bslma::Allocator *allocator = threadAllocator(param, &cache);
+
+    for (int i = 0; i < param.d_iterations; ++i) {
+        const size_type SIZE  = testSize(param.d_id, i);
+        int            *block = static_cast<int *>(allocator->allocate(SIZE));
+        if (sizeof(int) <= SIZE) {
+            *block = i;
+        }
+        param.d_ring_p->push(block);
+    }
+    return 0;
+}
+
+static void *consumerThread(void *arg)
+    // Receive blocks from the producer through the queue of the
+    // 'ThreadParam' at the specified 'arg', verify their sequence number, and
+    // deallocate them.
+{
+    ThreadParam&      param = *static_cast<ThreadParam *>(arg);
+    Cache             cache(param.d_pool_p);
+    bslma::Allocator *allocator = threadAllocator(param, &cache);
+
+    for (int i = 0; i < param.d_iterations; ++i) {
+        int *block = static_cast<int *>(param.d_ring_p->pop());
+        if (sizeof(int) <= testSize(param.d_id, i) && i != *block) {
+            ++*param.d_errors_p;
+        }
+        allocator->deallocate(block);
+    }
+    return 0;
+}
+
+static void *singleBlockThread(void *arg)
+    // Repeatedly allocate a single block of the smallest size class directly
+    // from the pool specified by the 'ThreadParam' at the specified 'arg',
+    // write the identifier of this thread into it, verify it, and deallocate
+    // it.
+{
+    ThreadParam& param = *static_cast<ThreadParam *>(arg);
+
+    for (int i = 0; i < param.d_iterations; ++i) {
+        int *block = static_cast<int *>(
+                                param.d_pool_p->allocate(sizeof(int)));
+        *block = param.d_id;
+        yieldThread();
+        if (param.d_id != *block) {
+            ++*param.d_errors_p;
+        }
+        param.d_pool_p->deallocate(block);
+    }
+    return 0;
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Example 1: Sharing a Pool Between Threads
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a pipeline in which a producer thread creates
+// messages that are processed, and then destroyed, by a consumer thread.
+// Each thread accesses a shared concurrent pool through its own cache.
+//
+// First, we define a simple message type:
+//..
+    struct my_Message {
+        int  d_sequenceNumber;
+        char d_payload[60];
+    };
+//..
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create the concurrent pool shared by the threads, supplying the
+// (thread-safe) new/delete allocator as its upstream allocator:
+//..
+    bslma::ConcurrentPoolAllocator pool(
+                                   &bslma::NewDeleteAllocator::singleton());
+//..
+// Next, each thread creates a cache of the pool for its own use.  For the
+// sake of brevity, we show the work of both threads in a single thread:
+//..
+    bslma::ConcurrentPoolThreadCache producerCache(&pool);
+    bslma::ConcurrentPoolThreadCache consumerCache(&pool);
+//..
+// Then, the producer creates messages using its cache:
+//..
+    my_Message *messages[100];
+    for (int i = 0; i < 100; ++i) {
+        messages[i] = new (producerCache) my_Message();
+        messages[i]->d_sequenceNumber = i;
+    }
+//..
+// Next, the consumer processes, and destroys, the messages using its own
+// cache.  Note that the blocks accumulated by the consumer are returned to
+// the shared depot, a magazine at a time, as the consumer's cache fills up:
+//..
+    for (int i = 0; i < 100; ++i) {
+        ASSERT(i == messages[i]->d_sequenceNumber);
+        consumerCache.deleteObject(messages[i]);
+    }
+//..
+// Finally, the producer creates more messages, reusing the magazines of
+// blocks returned by the consumer rather than obtaining more memory from the
+// upstream allocator:
+//..
+    for (int i = 0; i < 50; ++i) {
+        messages[i] = new (producerCache) my_Message();
+    }
+    for (int i = 0; i < 50; ++i) {
+        producerCache.deleteObject(messages[i]);
+    }
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY STRESS TEST
+        //
+        // Concerns:
+        //: 1 Blocks allocated concurrently from several threads, through
+        //:   caches or through the pool directly, are distinct.
+        //:
+        //: 2 Blocks allocated on one thread can be deallocated on another.
+        //:
+        //: 3 No memory is lost: once all caches are destroyed, every pooled
+        //:   block is in a depot, and the destructor returns every chunk to
+        //:   the upstream allocator.
+        //:
+        //: 4 A magazine being taken from a depot by one thread does not make
+        //:   the depot appear empty to other threads: threads holding few
+        //:   blocks at a time do not obtain more chunks than there are
+        //:   threads.
+        //
+        // Plan:
+        //: 1 Run several worker threads, some using caches and some using the
+        //:   pool directly, that fill each block they allocate with a pattern
+        //:   identifying the thread, and verify the pattern before
+        //:   deallocating the block.  (C-1)
+        //:
+        //: 2 Run producer/consumer pipelines, with and without caches, in
+        //:   which the producer writes a sequence number into each block, and
+        //:   the consumer verifies it and deallocates the block.  (C-2)
+        //:
+        //: 3 Use a thread-safe counting allocator as the upstream allocator,
+        //:   and verify that, after the threads complete, allocating as many
+        //:   blocks as were obtained from it does not obtain more memory, and
+        //:   that the destructor returns all of the memory.  (C-3)
+        //:
+        //: 4 Run several threads that each repeatedly allocate and deallocate
+        //:   a single block of the same size class directly from the pool,
+        //:   and verify that the number of chunks obtained from the upstream
+        //:   allocator does not exceed the number of threads.  (C-4)
+        //
+        // Testing:
+        //   CONCURRENCY STRESS TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENCY STRESS TEST"
+                            "\n=======================\n");
+
+        enum { NUM_WORKERS = 4, NUM_PIPELINES = 2 };
+
+        const int ITERATIONS = argc > 2 ? atoi(argv[2]) : 0;
+        const int NUM_ROUNDS = 0 < ITERATIONS ? ITERATIONS : 200;
+
+        if (verbose) printf("\tWorkers.\n");
+        {
+            CountingAllocator ca;
+            bsls::AtomicInt   errors(0);
+            {
+                Obj mX(&ca);
+
+                ThreadParam params[NUM_WORKERS];
+                thread_t    threads[NUM_WORKERS];
+                for (int i = 0; i < NUM_WORKERS; ++i) {
+                    const ThreadParam PARAM = {
+                        &mX, 0, i + 1, NUM_ROUNDS, i % 3 ? e_CACHE : e_POOL,
+                        &errors
+                    };
+                    params[i]  = PARAM;
+                    threads[i] = createThread(&workerThread, &params[i]);
+                }
+                for (int i = 0; i < NUM_WORKERS; ++i) {
+                    joinThread(threads[i]);
+                }
+                ASSERTV(errors, 0 == errors);
+                ASSERT(0 < ca.numBlocksInUse());
+            }
+            ASSERTV(ca.numBlocksInUse(), 0 == ca.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tPipelines.\n");
+        for (int useCache = 0; useCache < 2; ++useCache) {
+            CountingAllocator ca;
+            bsls::AtomicInt   errors(0);
+            {
+                Obj mX(&ca);
+
+                BlockRing   rings[NUM_PIPELINES];
+                ThreadParam params[2 * NUM_PIPELINES];
+                thread_t    threads[2 * NUM_PIPELINES];
+                for (int i = 0; i < NUM_PIPELINES; ++i) {
+                    const ThreadParam PARAM = {
+                        &mX, &rings[i], i, NUM_ROUNDS * 64,
+                        useCache ? e_CACHE : e_POOL, &errors
+                    };
+                    params[2 * i]     = PARAM;
+                    params[2 * i + 1] = PARAM;
+                    threads[2 * i]     = createThread(&producerThread,
+                                                      &params[2 * i]);
+                    threads[2 * i + 1] = createThread(&consumerThread,
+                                                      &params[2 * i + 1]);
+                }
+                for (int i = 0; i < 2 * NUM_PIPELINES; ++i) {
+                    joinThread(threads[i]);
+                }
+                LOOP2_ASSERT(useCache, errors, 0 == errors);
+
+                // Every block is now in a depot: allocating a block of each
+                // size class used by the pipelines (i.e., for sizes up to
+                // 300) does not obtain another chunk.
+
+                const int NUM_CHUNKS = ca.numBlocksTotal();
+                for (size_type size = Obj::k_MIN_BLOCK_SIZE;
+                     size <= 512;
+                     size *= 2) {
+                    Cache cache(&mX);
+                    cache.allocate(size);
+                    mX.allocate(size);
+                }
+                LOOP_ASSERT(useCache, NUM_CHUNKS == ca.numBlocksTotal());
+            }
+            LOOP_ASSERT(useCache, 0 == ca.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tSingle blocks.\n");
+        {
+            CountingAllocator ca;
+            bsls::AtomicInt   errors(0);
+            {
+                Obj mX(&ca);
+
+                ThreadParam params[NUM_WORKERS];
+                thread_t    threads[NUM_WORKERS];
+                for (int i = 0; i < NUM_WORKERS; ++i) {
+                    const ThreadParam PARAM = {
+                        &mX, 0, i + 1, NUM_ROUNDS * 64, e_POOL, &errors
+                    };
+                    params[i]  = PARAM;
+                    threads[i] = createThread(&singleBlockThread, &params[i]);
+                }
+                for (int i = 0; i < NUM_WORKERS; ++i) {
+                    joinThread(threads[i]);
+                }
+                ASSERTV(errors, 0 == errors);
+
+                // A thread obtains a chunk only if the depot is empty, i.e.,
+                // if the other threads have taken every magazine, each being
+                // between taking a magazine and returning its remainder.
+
+                ASSERTV(ca.numBlocksTotal(),
+                        ca.numBlocksTotal() <= NUM_WORKERS);
+            }
+            ASSERTV(ca.numBlocksInUse(), 0 == ca.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // THREAD CACHE
+        //
+        // Concerns:
+        //: 1 A cache dispenses distinct, maximally-aligned blocks of the
+        //:   appropriate size class, and reuses the blocks deallocated to it.
+        //:
+        //: 2 A cache obtains a full magazine from the upstream allocator only
+        //:   when both of its magazines of a size class and the depot are
+        //:   empty.
+        //:
+        //: 3 A cache keeps at most two magazines of a size class, returning
+        //:   full magazines to the depot, from which other caches take them.
+        //:
+        //: 4 'flush' and the destructor return the magazines of a cache to
+        //:   the depots.
+        //:
+        //: 5 Requests larger than 'maxPooledBlockSize()' are forwarded to the
+        //:   upstream allocator, and 'allocate(0)' returns 0.
+        //
+        // Plan:
+        //: 1 Allocate blocks of every pooled size through a cache, verifying
+        //:   their alignment, and that a deallocated block is reused.  (C-1)
+        //:
+        //: 2 Allocate several magazines of blocks of one size class through
+        //:   a cache, verifying the number of chunks obtained, then
+        //:   deallocate them through another cache, and verify that the first
+        //:   cache reuses them without obtaining more chunks.  (C-2..3)
+        //:
+        //: 3 'flush' a cache, and destroy another, and verify that their
+        //:   blocks are available to the pool directly.  (C-4)
+        //:
+        //: 4 Allocate and deallocate large blocks, and allocate 0 bytes,
+        //:   through a cache.  (C-5)
+        //
+        // Testing:
+        //   explicit ConcurrentPoolThreadCache(ConcurrentPoolAllocator *pool);
+        //   ~ConcurrentPoolThreadCache();
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   void flush();
+        //   ConcurrentPoolAllocator *pool() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTHREAD CACHE"
+                            "\n============\n");
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        if (verbose) printf("\tSize classes.\n");
+        {
+            Obj   mX(&ta);
+            Cache mC(&mX);  const Cache& C = mC;
+
+            ASSERT(&mX == C.pool());
+
+            const size_type MAX_SIZE = mX.maxPooledBlockSize();
+
+            for (size_type size = 1; size <= MAX_SIZE; ++size) {
+                const size_type CLASS = sizeClass(size);
+
+                char *p = static_cast<char *>(mC.allocate(size));
+                char *q = static_cast<char *>(mC.allocate(size));
+                LOOP_ASSERT(size, isMaximallyAligned(p));
+                LOOP_ASSERT(size, isMaximallyAligned(q));
+                LOOP_ASSERT(size, p + CLASS <= q || q + CLASS <= p);
+                memset(p, 0x5a, CLASS);
+                memset(q, 0xa5, CLASS);
+
+                mC.deallocate(p);
+                LOOP_ASSERT(size, p == mC.allocate(CLASS / 2 + 1));
+                mC.deallocate(p);
+                mC.deallocate(q);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tMagazines.\n");
+        {
+            Obj mX(&ta);
+
+            enum { NUM_BLOCKS = 4 * MAGAZINE_SIZE };
+            void *blocks[NUM_BLOCKS];
+
+            Cache mA(&mX);
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                blocks[i] = mA.allocate(100);
+                LOOP_ASSERT(i, i / MAGAZINE_SIZE + 1 == ta.numBlocksInUse());
+            }
+
+            // Alternating at the boundary of a magazine does not obtain
+            // memory.
+
+            for (int i = 0; i < 10; ++i) {
+                void *p = mA.allocate(100);
+                mA.deallocate(p);
+                mA.deallocate(mA.allocate(100));
+            }
+            ASSERT(5 == ta.numBlocksInUse());
+
+            {
+                // Blocks deallocated through 'mB' are returned to the depot
+                // a magazine at a time, and when 'mB' is destroyed.
+
+                Cache mB(&mX);
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    mB.deallocate(blocks[i]);
+                }
+            }
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                blocks[i] = mA.allocate(100);
+            }
+            ASSERT(5 == ta.numBlocksInUse());
+
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                mA.deallocate(blocks[i]);
+            }
+            mA.flush();
+
+            // All of the blocks are now available from the depot.
+
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                blocks[i] = mX.allocate(100);
+            }
+            ASSERT(5 == ta.numBlocksInUse());
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tLarge blocks and zero.\n");
+        {
+            Obj   mX(2, &ta);
+            Cache mC(&mX);
+
+            const size_type SIZE = mX.maxPooledBlockSize() + 1;
+
+            void *p = mC.allocate(SIZE);
+            ASSERT(isMaximallyAligned(p));
+            ASSERT(1 == ta.numBlocksInUse());
+            ASSERT(SIZE < ta.lastAllocatedNumBytes());
+            memset(p, 0x5a, SIZE);
+            mC.deallocate(p);
+            ASSERT(0 == ta.numBlocksInUse());
+
+            ASSERT(0 == mC.allocate(0));
+            mC.deallocate(0);
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE AND DEALLOCATE
+        //
+        // Concerns:
+        //: 1 'allocate' returns distinct, maximally-aligned, writable blocks
+        //:   of at least the requested size.
+        //:
+        //: 2 A deallocated block is reused by the next allocation of the same
+        //:   size class.
+        //:
+        //: 3 A chunk holding a magazine of blocks is obtained from the
+        //:   upstream allocator only when the depot is empty.
+        //:
+        //: 4 Requests larger than 'maxPooledBlockSize()' are forwarded to the
+        //:   upstream allocator, and returned to it on 'deallocate'.
+        //:
+        //: 5 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 6 The destructor returns all chunks to the upstream allocator.
+        //
+        // Plan:
+        //: 1 For each pooled size, allocate two blocks, fill them, and verify
+        //:   their alignment and distinctness.  Deallocate the first, and
+        //:   verify that the next allocation of its size class returns it.
+        //:   (C-1..2)
+        //:
+        //: 2 Allocate several magazines of blocks of one size class, and
+        //:   verify the number of chunks obtained.  (C-3)
+        //:
+        //: 3 Allocate and deallocate large blocks, and allocate 0 bytes.
+        //:   (C-4..5)
+        //:
+        //: 4 Destroy the pool with blocks outstanding, and verify that no
+        //:   memory remains in use.  (C-6)
+        //
+        // Testing:
+        //   ~ConcurrentPoolAllocator();
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nALLOCATE AND DEALLOCATE"
+                            "\n=======================\n");
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        if (verbose) printf("\tSize classes.\n");
+        {
+            Obj mX(&ta);
+
+            const size_type MAX_SIZE = mX.maxPooledBlockSize();
+
+            for (size_type size = 1; size <= MAX_SIZE; ++size) {
+                const size_type CLASS = sizeClass(size);
+
+                char *p = static_cast<char *>(mX.allocate(size));
+                char *q = static_cast<char *>(mX.allocate(size));
+                LOOP_ASSERT(size, isMaximallyAligned(p));
+                LOOP_ASSERT(size, isMaximallyAligned(q));
+                LOOP_ASSERT(size, p + CLASS <= q || q + CLASS <= p);
+                memset(p, 0x5a, CLASS);
+                memset(q, 0xa5, CLASS);
+
+                mX.deallocate(p);
+                LOOP_ASSERT(size, p == mX.allocate(CLASS));
+                mX.deallocate(p);
+                LOOP_ASSERT(size, p == mX.allocate(CLASS / 2 + 1));
+
+                mX.deallocate(p);
+                mX.deallocate(q);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tChunks.\n");
+        {
+            Obj mX(&ta);
+
+            for (int i = 0; i < 3 * MAGAZINE_SIZE; ++i) {
+                mX.allocate(50);
+                LOOP_ASSERT(i, i / MAGAZINE_SIZE + 1 == ta.numBlocksInUse());
+            }
+
+            // The destructor returns the chunks, although their blocks have
+            // not been deallocated.
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tLarge blocks and zero.\n");
+        {
+            Obj mX(4, &ta);
+
+            const size_type MAX_SIZE = mX.maxPooledBlockSize();
+            ASSERT(128 == MAX_SIZE);
+
+            void *blocks[4];
+            for (int i = 0; i < 4; ++i) {
+                const size_type SIZE = MAX_SIZE + 1 + i * 1000;
+                blocks[i] = mX.allocate(SIZE);
+                LOOP_ASSERT(i, isMaximallyAligned(blocks[i]));
+                LOOP_ASSERT(i, SIZE < ta.lastAllocatedNumBytes());
+                LOOP_ASSERT(i, i + 1 == ta.numBlocksInUse());
+                memset(blocks[i], 0x5a, SIZE);
+            }
+            for (int i = 0; i < 4; ++i) {
+                mX.deallocate(blocks[i]);
+                LOOP_ASSERT(i, 3 - i == ta.numBlocksInUse());
+            }
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The number of pools is 'k_DEFAULT_NUM_POOLS' unless specified,
+        //:   and the largest size class is 'k_MIN_BLOCK_SIZE' doubled once
+        //:   for each pool after the first.
+        //:
+        //: 2 The upstream allocator is the one supplied, or the default
+        //:   allocator if none is supplied.
+        //:
+        //: 3 Construction obtains no memory.
+        //:
+        //: 4 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects with each constructor and every valid number of
+        //:   pools, with and without an allocator, installing a test
+        //:   allocator as the default, and verify the accessors and the use
+        //:   of memory.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an invalid number of pools.  (C-4)
+        //
+        // Testing:
+        //   explicit ConcurrentPoolAllocator(Allocator *basicAllocator = 0);
+        //   explicit ConcurrentPoolAllocator(int numPools, Allocator * = 0);
+        //   int numPools() const;
+        //   size_type maxPooledBlockSize() const;
+        //   Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS AND ACCESSORS"
+                            "\n======================\n");
+
+        bslma::TestAllocator da("default",  veryVeryVerbose);
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_NUM_POOLS == X.numPools());
+            ASSERT(2048                     == X.maxPooledBlockSize());
+            ASSERT(&da                      == X.allocator());
+        }
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_NUM_POOLS == X.numPools());
+            ASSERT(&ta                      == X.allocator());
+        }
+
+        for (int numPools = 1; numPools <= Obj::k_MAX_NUM_POOLS; ++numPools) {
+            const size_type MIN_SIZE = Obj::k_MIN_BLOCK_SIZE;
+            const size_type EXP_MAX  = MIN_SIZE << (numPools - 1);
+
+            if (veryVerbose) { T_ P_(numPools) P(EXP_MAX) }
+
+            {
+                Obj mX(numPools);  const Obj& X = mX;
+                LOOP_ASSERT(numPools, numPools == X.numPools());
+                LOOP_ASSERT(numPools, EXP_MAX  == X.maxPooledBlockSize());
+                LOOP_ASSERT(numPools, &da      == X.allocator());
+            }
+            {
+                Obj mX(numPools, &ta);  const Obj& X = mX;
+                LOOP_ASSERT(numPools, numPools == X.numPools());
+                LOOP_ASSERT(numPools, EXP_MAX  == X.maxPooledBlockSize());
+                LOOP_ASSERT(numPools, &ta      == X.allocator());
+            }
+        }
+        ASSERT(0 == da.numBlocksTotal());
+        ASSERT(0 == ta.numBlocksTotal());
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_PASS(Obj(1, &ta));
+            ASSERT_FAIL(Obj(0, &ta));
+            ASSERT_PASS(Obj(Obj::k_MAX_NUM_POOLS, &ta));
+            ASSERT_FAIL(Obj(Obj::k_MAX_NUM_POOLS + 1, &ta));
+
+            ASSERT_FAIL(Cache(0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The classes are sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks of pooled and large sizes through
+        //:   the pool and through a cache, and verify that memory is reused
+        //:   and returned.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+        {
+            Obj mX(&ta);
+
+            void *p = mX.allocate(10);
+            void *q = mX.allocate(100);
+            ASSERT(p != q);
+            ASSERT(2 == ta.numBlocksInUse());
+
+            mX.deallocate(p);
+            ASSERT(p == mX.allocate(12));
+            mX.deallocate(p);
+
+            {
+                Cache mC(&mX);
+
+                void *r = mC.allocate(12);
+                ASSERT(p == r);
+                void *s = mC.allocate(100000);
+                ASSERT(3 == ta.numBlocksInUse());
+
+                mC.deallocate(s);
+                ASSERT(2 == ta.numBlocksInUse());
+                mC.deallocate(r);
+            }
+            mX.deallocate(q);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: PRODUCER/CONSUMER PIPELINE
+        //
+        // Concerns:
+        //: 1 Blocks allocated on a producer thread, and deallocated on a
+        //:   consumer thread, through caches of a concurrent pool are
+        //:   allocated substantially faster than with
+        //:   'bslma::NewDeleteAllocator'.
+        //
+        // Plan:
+        //: 1 Time pipelines, the number of which is optionally specified on
+        //:   the command line, in which the threads use the new/delete
+        //:   allocator, the pool directly, and caches of the pool, and report
+        //:   the allocation rates.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: PRODUCER/CONSUMER PIPELINE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: PRODUCER/CONSUMER PIPELINE"
+                            "\n=======================================\n");
+
+        enum { MAX_PIPELINES = 16, NUM_ITERATIONS = 1000000 };
+
+        const int NUM_PIPELINES = argc > 2 && 0 < atoi(argv[2])
+                                  && atoi(argv[2]) <= MAX_PIPELINES
+                                ? atoi(argv[2])
+                                : 1;
+
+        printf("%d pipeline(s)\n", NUM_PIPELINES);
+
+        static const char *const NAMES[] = {
+            "NewDeleteAllocator:",
+            "ConcurrentPoolAllocator:",
+            "ConcurrentPoolThreadCache:"
+        };
+
+        for (int mode = e_NEW_DELETE; mode <= e_CACHE; ++mode) {
+            bsls::AtomicInt errors(0);
+            Obj             mX(&bslma::NewDeleteAllocator::singleton());
+
+            BlockRing   rings[MAX_PIPELINES];
+            ThreadParam params[2 * MAX_PIPELINES];
+            thread_t    threads[2 * MAX_PIPELINES];
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_PIPELINES; ++i) {
+                const ThreadParam PARAM = {
+                    &mX, &rings[i], i, NUM_ITERATIONS, Mode(mode), &errors
+                };
+                params[2 * i]      = PARAM;
+                params[2 * i + 1]  = PARAM;
+                threads[2 * i]     = createThread(&producerThread,
+                                                  &params[2 * i]);
+                threads[2 * i + 1] = createThread(&consumerThread,
+                                                  &params[2 * i + 1]);
+            }
+            for (int i = 0; i < 2 * NUM_PIPELINES; ++i) {
+                joinThread(threads[i]);
+            }
+            timer.stop();
+
+            ASSERT(0 == errors);
+
+            const double NUM_TOTAL = double(NUM_ITERATIONS) * NUM_PIPELINES;
+            printf("%-28s %g allocations/s\n",
+                   NAMES[mode],
+                   NUM_TOTAL / timer.elapsedTime());
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,214 @@
+// bslma_countingallocator.cpp                                        -*-C++-*-
+#include <bslma_countingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+
+#include <new>  // placement 'new'
+
+namespace BloombergLP {
+
+namespace bslma {
+
+                        // -----------------------
+                        // class CountingAllocator
+                        // -----------------------
+
+// PRIVATE MANIPULATORS
+void CountingAllocator::init(int numShards)
+{
+    BSLS_ASSERT(1 <= numShards);
+    BSLS_ASSERT(numShards <= k_MAX_NUM_SHARDS);
+    BSLS_ASSERT(0 == (numShards & (numShards - 1)));
+
+    // Align the shards on a cache line, so that each shard occupies a cache
+    // line of its own.
+
+    d_shards_p = static_cast<Shard *>(d_allocator_p->allocateAligned(
+                                                    numShards * sizeof(Shard),
+                                                    k_CACHE_LINE_SIZE));
+    for (int i = 0; i < numShards; ++i) {
+        new (d_shards_p + i) Shard();
+    }
+    d_shardMask = numShards - 1;
+}
+
+// PRIVATE ACCESSORS
+void CountingAllocator::updatePeak(bsls::Types::Int64 numBytesInUse) const
+{
+    bsls::Types::Int64 peak = d_peakBytesInUse.loadRelaxed();
+    while (peak < numBytesInUse) {
+        const bsls::Types::Int64 previous =
+                            d_peakBytesInUse.testAndSwap(peak, numBytesInUse);
+        if (previous == peak) {
+            break;
+        }
+        peak = previous;
+    }
+}
+
+// CREATORS
+CountingAllocator::CountingAllocator(Allocator *basicAllocator)
+: d_peakBytesInUse(0)
+, d_name_p("")
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+    init(1);
+}
+
+CountingAllocator::CountingAllocator(const char *name,
+                                     Allocator  *basicAllocator)
+: d_peakBytesInUse(0)
+, d_name_p(name)
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(name);
+
+    init(1);
+}
+
+CountingAllocator::CountingAllocator(const char *name,
+                                     int         numShards,
+                                     Allocator  *basicAllocator)
+: d_peakBytesInUse(0)
+, d_name_p(name)
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(name);
+
+    init(numShards);
+}
+
+CountingAllocator::~CountingAllocator()
+{
+    d_allocator_p->deallocateAligned(d_shards_p,
+                                     numShards() * sizeof(Shard),
+                                     k_CACHE_LINE_SIZE);
+}
+
+// MANIPULATORS
+void *CountingAllocator::allocate(size_type size)
+{
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    BlockHeader *blockHeader = static_cast<BlockHeader *>(
+                          d_allocator_p->allocate(sizeof(BlockHeader) + size));
+    blockHeader->d_size = size;
+
+    const bsls::Types::Int64 bytes = static_cast<bsls::Types::Int64>(size);
+
+    Shard& shard = currentShard();
+    shard.d_numAllocations.addRelaxed(1);
+    const bsls::Types::Int64 numBytesAllocated =
+                                   shard.d_numBytesAllocated.addRelaxed(bytes);
+
+    // Only the single shard of an unsharded allocator holds the total number
+    // of bytes in use; the peak of a sharded allocator is maintained by
+    // 'snapshot'.
+
+    if (0 == d_shardMask) {
+        updatePeak(numBytesAllocated
+                   - shard.d_numBytesDeallocated.loadRelaxed());
+    }
+
+    return blockHeader + 1;
+}
+
+void CountingAllocator::deallocate(void *address)
+{
+    if (!address) {
+        return;                                                       // RETURN
+    }
+
+    BlockHeader     *blockHeader = header(address);
+    const size_type  size        = blockHeader->d_size;
+
+    Shard& shard = currentShard();
+    shard.d_numDeallocations.addRelaxed(1);
+    shard.d_numBytesDeallocated.addRelaxed(
+                                      static_cast<bsls::Types::Int64>(size));
+
+    d_allocator_p->deallocateSized(blockHeader, sizeof(BlockHeader) + size);
+}
+
+void CountingAllocator::deallocateSized(void *address, size_type size)
+{
+    BSLS_ASSERT_SAFE(!address || header(address)->d_size == size);
+    (void)size;
+
+    deallocate(address);
+}
+
+// ACCESSORS
+void CountingAllocator::snapshot(CountingAllocatorSnapshot *result) const
+{
+    BSLS_ASSERT(result);
+
+    CountingAllocatorSnapshot sum;
+    bsls::Types::Int64        numBytesDeallocated = 0;
+    for (int i = 0; i <= d_shardMask; ++i) {
+        const Shard& shard = d_shards_p[i];
+        sum.d_numDeallocations += shard.d_numDeallocations.loadRelaxed();
+        numBytesDeallocated    += shard.d_numBytesDeallocated.loadRelaxed();
+        sum.d_numAllocations   += shard.d_numAllocations.loadRelaxed();
+        sum.d_numBytesTotal    += shard.d_numBytesAllocated.loadRelaxed();
+    }
+    sum.d_numBytesInUse = sum.d_numBytesTotal - numBytesDeallocated;
+
+    if (d_shardMask) {
+        updatePeak(sum.d_numBytesInUse);
+    }
+    sum.d_peakBytesInUse = d_peakBytesInUse.loadRelaxed();
+
+    *result = sum;
+}
+
+bsls::Types::Int64 CountingAllocator::numBytesInUse() const
+{
+    bsls::Types::Int64 result = 0;
+    for (int i = 0; i <= d_shardMask; ++i) {
+        result -= d_shards_p[i].d_numBytesDeallocated.loadRelaxed();
+        result += d_shards_p[i].d_numBytesAllocated.loadRelaxed();
+    }
+    return result;
+}
+
+bsls::Types::Int64 CountingAllocator::peakBytesInUse() const
+{
+    if (d_shardMask) {
+        updatePeak(numBytesInUse());
+    }
+    return d_peakBytesInUse.loadRelaxed();
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
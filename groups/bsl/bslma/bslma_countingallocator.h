@@ -0,0 +1,509 @@
+// bslma_countingallocator.h                                          -*-C++-*-
+#ifndef INCLUDED_BSLMA_COUNTINGALLOCATOR
+#define INCLUDED_BSLMA_COUNTINGALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe allocator that counts its memory usage.
+//
+//@CLASSES:
+//  bslma::CountingAllocator: thread-safe allocator keeping usage statistics
+//  bslma::CountingAllocatorSnapshot: usage statistics of a counting allocator
+//
+//@SEE_ALSO: bslma_testallocator, bsls_atomic
+//
+//@DESCRIPTION: This component provides a lightweight, fully thread-safe
+// allocator, 'bslma::CountingAllocator', that forwards every request to an
+// upstream allocator, and counts the number of allocations and deallocations,
+// and the number of bytes in use, allocated in total, and in use at the peak,
+// so that the memory usage of a subsystem can be monitored in production.
+// The statistics are obtained, all at once, as a
+// 'bslma::CountingAllocatorSnapshot':
+//..
+//   ,-------------------------.
+//  ( bslma::CountingAllocator )
+//   `-------------------------'
+//                  |        ctor/dtor
+//                  |        snapshot
+//                  |        numBytesInUse
+//                  |        peakBytesInUse
+//                  |        name
+//                  |        numShards
+//                  |        allocator
+//                  V
+//          ,----------------.
+//         ( bslma::Allocator )
+//          `----------------'
+//                           allocate
+//                           deallocate
+//..
+// Unlike 'bslma::TestAllocator', which validates every block and serializes
+// every request with a mutex, a 'bslma::CountingAllocator' maintains its
+// counters with relaxed atomic operations (see {'bsls_atomic'}), so that its
+// overhead relative to the upstream allocator is two uncontended atomic
+// additions per request.  The size of each block is kept in a
+// maximally-aligned header preceding the block, so that the size need not be
+// supplied to 'deallocate'.
+//
+///Sharded Counters
+///----------------
+// When several threads allocate from the same allocator at a high rate, the
+// cache line holding the counters bounces between processors, and the
+// counting, rather than the allocation, can dominate the cost of a request.
+// A counting allocator may therefore be constructed with a number of
+// *shards*: copies of the counters, each occupying a cache line of its own.
+// Each request updates the counters of one shard, selected from the address
+// of the stack of the calling thread, so that distinct threads tend to update
+// distinct shards, and a snapshot sums the counters of all of the shards.
+// Note that a block may be deallocated through a shard other than the one
+// through which it was allocated, so the counters of an individual shard are
+// meaningless; only their sums are reported.
+//
+///Peak Usage
+///----------
+// An allocator having a single shard (the default) updates its peak number of
+// bytes in use on every allocation, at the cost of a compare-and-swap
+// whenever a new peak is reached.  The peak is exact unless deallocations by
+// other threads race with the allocation reaching it, in which case the
+// number of bytes in use seen by that allocation, and hence the peak, may be
+// slightly inexact.  An allocator having several shards cannot observe the
+// total number of bytes in use at the time of each request, so its peak is
+// instead the largest number of bytes in use observed by any snapshot taken
+// so far (including those taken by 'peakBytesInUse').
+//
+///Snapshot Consistency
+///--------------------
+// A snapshot reads each counter of each shard once, without locking.  A
+// snapshot taken while other threads are using the allocator is therefore
+// not necessarily a consistent picture of any single instant: e.g., a block
+// whose deallocation is counted by the snapshot may have been allocated
+// after the number of allocations was read.  Once all of the threads using
+// the allocator are quiescent, a snapshot is exact.
+//
+///Thread Safety
+///-------------
+// 'bslma::CountingAllocator' is *fully thread-safe*, provided that the
+// upstream allocator is fully thread-safe: 'allocate', 'deallocate', and all
+// of the accessors may be called concurrently from multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Monitoring the Memory Used by a Subsystem
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to report the memory used by a cache of strings, and
+// the largest amount of memory it has used.
+//
+// First, we create a counting allocator, named for the subsystem, that
+// obtains memory from the default allocator:
+//..
+//  bslma::CountingAllocator countingAllocator("string cache");
+//..
+// Then, we simulate the use of the cache by allocating and deallocating some
+// blocks:
+//..
+//  void *blocks[10];
+//  for (int i = 0; i < 10; ++i) {
+//      blocks[i] = countingAllocator.allocate(100);
+//  }
+//  for (int i = 0; i < 5; ++i) {
+//      countingAllocator.deallocate(blocks[i]);
+//  }
+//..
+// Next, we take a snapshot of the statistics of the allocator:
+//..
+//  bslma::CountingAllocatorSnapshot snapshot;
+//  countingAllocator.snapshot(&snapshot);
+//..
+// Now, we observe the statistics reported:
+//..
+//  assert(10   == snapshot.numAllocations());
+//  assert(5    == snapshot.numDeallocations());
+//  assert(5    == snapshot.numBlocksInUse());
+//  assert(500  == snapshot.numBytesInUse());
+//  assert(1000 == snapshot.numBytesTotal());
+//  assert(1000 == snapshot.peakBytesInUse());
+//..
+// Finally, we return the remaining blocks, and observe that the allocator no
+// longer has memory in use, while its peak is unchanged:
+//..
+//  for (int i = 5; i < 10; ++i) {
+//      countingAllocator.deallocate(blocks[i]);
+//  }
+//  assert(0    == countingAllocator.numBytesInUse());
+//  assert(1000 == countingAllocator.peakBytesInUse());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslma {
+
+class CountingAllocator;
+
+                        // ===============================
+                        // class CountingAllocatorSnapshot
+                        // ===============================
+
+class CountingAllocatorSnapshot {
+    // This class holds the usage statistics of a 'CountingAllocator' at the
+    // time a snapshot was taken.
+
+    // DATA
+    bsls::Types::Int64 d_numAllocations;    // number of blocks allocated
+
+    bsls::Types::Int64 d_numDeallocations;  // number of blocks deallocated
+
+    bsls::Types::Int64 d_numBytesInUse;     // number of bytes in use
+
+    bsls::Types::Int64 d_numBytesTotal;     // number of bytes ever allocated
+
+    bsls::Types::Int64 d_peakBytesInUse;    // largest number of bytes in use
+
+    // FRIENDS
+    friend class CountingAllocator;
+
+  public:
+    // CREATORS
+    CountingAllocatorSnapshot();
+        // Create a snapshot in which all of the statistics are 0.
+
+    // ACCESSORS
+    bsls::Types::Int64 numAllocations() const;
+        // Return the number of blocks allocated.
+
+    bsls::Types::Int64 numDeallocations() const;
+        // Return the number of blocks deallocated.
+
+    bsls::Types::Int64 numBlocksInUse() const;
+        // Return the number of blocks allocated but not yet deallocated.
+
+    bsls::Types::Int64 numBytesInUse() const;
+        // Return the number of bytes in the blocks allocated but not yet
+        // deallocated.
+
+    bsls::Types::Int64 numBytesTotal() const;
+        // Return the number of bytes in all of the blocks ever allocated.
+
+    bsls::Types::Int64 peakBytesInUse() const;
+        // Return the largest number of bytes in use (see {Peak Usage}).
+};
+
+                        // =======================
+                        // class CountingAllocator
+                        // =======================
+
+class CountingAllocator : public Allocator {
+    // This class provides a fully thread-safe allocator that forwards every
+    // request to an upstream allocator, and counts the blocks and bytes
+    // allocated and deallocated with relaxed atomic operations, optionally
+    // spread over several cache-line-sized shards.
+
+    // PRIVATE TYPES
+    enum { k_CACHE_LINE_SIZE = 64 };  // assumed size of a cache line
+
+    union BlockHeader {
+        // This 'union' precedes the memory of each block dispensed by this
+        // allocator.
+
+        size_type                           d_size;       // size of the
+                                                          // block
+
+        bsls::AlignmentUtil::MaxAlignedType d_alignment;  // ensure the block
+                                                          // memory is
+                                                          // maximally aligned
+    };
+
+    struct Shard {
+        // This 'struct' holds one copy of the counters of this allocator,
+        // padded to occupy a cache line of its own.
+
+        bsls::AtomicInt64 d_numAllocations;      // blocks allocated
+
+        bsls::AtomicInt64 d_numDeallocations;    // blocks deallocated
+
+        bsls::AtomicInt64 d_numBytesAllocated;   // bytes allocated
+
+        bsls::AtomicInt64 d_numBytesDeallocated; // bytes deallocated
+
+        char              d_pad[k_CACHE_LINE_SIZE
+                                - 4 * sizeof(bsls::AtomicInt64)];
+                                                 // padding to a cache line
+    };
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_MAX_NUM_SHARDS = 64  // maximum number of shards
+    };
+
+  private:
+    // DATA
+    Shard                     *d_shards_p;        // cache-line-aligned array
+                                                  // of counters
+
+    int                        d_shardMask;       // number of shards less 1
+
+    mutable bsls::AtomicInt64  d_peakBytesInUse;  // largest number of bytes
+                                                  // in use observed
+
+    const char                *d_name_p;          // name of this allocator
+                                                  // (held, not owned)
+
+    Allocator                 *d_allocator_p;     // upstream allocator (held,
+                                                  // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    CountingAllocator(const CountingAllocator&);
+    CountingAllocator& operator=(const CountingAllocator&);
+
+    // PRIVATE CLASS METHODS
+    static BlockHeader *header(void *address);
+        // Return the address of the header of the block at the specified
+        // 'address'.
+
+    // PRIVATE MANIPULATORS
+    void init(int numShards);
+        // Allocate and initialize the specified 'numShards' shards of
+        // counters.
+
+    // PRIVATE ACCESSORS
+    Shard& currentShard() const;
+        // Return a reference providing modifiable access to the shard of
+        // counters to be updated by the calling thread.
+
+    void updatePeak(bsls::Types::Int64 numBytesInUse) const;
+        // Raise the peak number of bytes in use of this allocator to the
+        // specified 'numBytesInUse', if it is larger.
+
+  public:
+    // CREATORS
+    explicit CountingAllocator(Allocator *basicAllocator = 0);
+    explicit CountingAllocator(const char *name,
+                               Allocator  *basicAllocator = 0);
+    CountingAllocator(const char *name,
+                      int         numShards,
+                      Allocator  *basicAllocator = 0);
+        // Create a counting allocator.  Optionally specify a 'name' that
+        // identifies this allocator in reports; if 'name' is not specified,
+        // the empty string is used.  Optionally specify the 'numShards'
+        // number of copies of the counters to maintain; if 'numShards' is
+        // not specified, 1 is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless 'name' (if specified) remains valid for the lifetime of this
+        // object, 'numShards' is a power of two such that
+        // '1 <= numShards <= k_MAX_NUM_SHARDS', and the upstream allocator is
+        // fully thread-safe.
+
+    virtual ~CountingAllocator();
+        // Destroy this allocator.  Note that blocks that have not been
+        // deallocated are *not* returned to the upstream allocator.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return the address of a contiguous block of maximally-aligned
+        // memory of the specified 'size' (in bytes) obtained from the
+        // upstream allocator, and count the allocation.  If 'size' is 0, no
+        // memory is allocated and 0 is returned.  This method is
+        // thread-safe.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to the upstream
+        // allocator, and count the deallocation.  If 'address' is 0, this
+        // method has no effect.  This method is thread-safe.  The behavior is
+        // undefined unless 'address' was allocated by this allocator, and has
+        // not already been deallocated.
+
+    virtual void deallocateSized(void *address, size_type size);
+        // Return the memory block at the specified 'address' of the specified
+        // 'size' (in bytes) to the upstream allocator, and count the
+        // deallocation.  If 'address' is 0, this method has no effect.  This
+        // method is thread-safe.  The behavior is undefined unless 'address'
+        // was allocated by this allocator with 'size', and has not already
+        // been deallocated.
+
+    // ACCESSORS
+    void snapshot(CountingAllocatorSnapshot *result) const;
+        // Load into the specified 'result' the current usage statistics of
+        // this allocator (see {Snapshot Consistency}).  This method is
+        // thread-safe.
+
+    bsls::Types::Int64 numBytesInUse() const;
+        // Return the number of bytes in the blocks allocated but not yet
+        // deallocated.  This method is thread-safe.
+
+    bsls::Types::Int64 peakBytesInUse() const;
+        // Return the largest number of bytes in use (see {Peak Usage}).  This
+        // method is thread-safe.
+
+    const char *name() const;
+        // Return the name of this allocator.
+
+    int numShards() const;
+        // Return the number of shards of counters of this allocator.
+
+    Allocator *allocator() const;
+        // Return the address of the upstream allocator used by this
+        // allocator to supply memory.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // -------------------------------
+                        // class CountingAllocatorSnapshot
+                        // -------------------------------
+
+// CREATORS
+inline
+CountingAllocatorSnapshot::CountingAllocatorSnapshot()
+: d_numAllocations(0)
+, d_numDeallocations(0)
+, d_numBytesInUse(0)
+, d_numBytesTotal(0)
+, d_peakBytesInUse(0)
+{
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 CountingAllocatorSnapshot::numAllocations() const
+{
+    return d_numAllocations;
+}
+
+inline
+bsls::Types::Int64 CountingAllocatorSnapshot::numDeallocations() const
+{
+    return d_numDeallocations;
+}
+
+inline
+bsls::Types::Int64 CountingAllocatorSnapshot::numBlocksInUse() const
+{
+    return d_numAllocations - d_numDeallocations;
+}
+
+inline
+bsls::Types::Int64 CountingAllocatorSnapshot::numBytesInUse() const
+{
+    return d_numBytesInUse;
+}
+
+inline
+bsls::Types::Int64 CountingAllocatorSnapshot::numBytesTotal() const
+{
+    return d_numBytesTotal;
+}
+
+inline
+bsls::Types::Int64 CountingAllocatorSnapshot::peakBytesInUse() const
+{
+    return d_peakBytesInUse;
+}
+
+                        // -----------------------
+                        // class CountingAllocator
+                        // -----------------------
+
+// PRIVATE CLASS METHODS
+inline
+CountingAllocator::BlockHeader *CountingAllocator::header(void *address)
+{
+    return static_cast<BlockHeader *>(address) - 1;
+}
+
+// PRIVATE ACCESSORS
+inline
+CountingAllocator::Shard& CountingAllocator::currentShard() const
+{
+    if (0 == d_shardMask) {
+        return *d_shards_p;                                           // RETURN
+    }
+
+    // The stacks of distinct threads are (at least) megabytes apart, whereas
+    // the stack of a single thread rarely grows by a megabyte, so the
+    // megabyte holding a local variable identifies the calling thread well
+    // enough to spread threads over the shards.
+
+    char                      local;
+    const bsls::Types::Uint64 megabyte =
+                         reinterpret_cast<bsls::Types::UintPtr>(&local) >> 20;
+
+    return d_shards_p[static_cast<int>((megabyte * 0x9E3779B97F4A7C15ULL)
+                                       >> 58) & d_shardMask];
+}
+
+// ACCESSORS
+inline
+const char *CountingAllocator::name() const
+{
+    return d_name_p;
+}
+
+inline
+int CountingAllocator::numShards() const
+{
+    return d_shardMask + 1;
+}
+
+inline
+Allocator *CountingAllocator::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
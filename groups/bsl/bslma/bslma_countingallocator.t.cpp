@@ -0,0 +1,1049 @@
+// bslma_countingallocator.t.cpp                                      -*-C++-*-
+
+#include <bslma_countingallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// For thread support
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE thread_t;
+#else
+#include <pthread.h>
+typedef pthread_t thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a thread-safe allocator that forwards
+// every request to an upstream allocator, and counts the blocks and bytes
+// allocated and deallocated in (optionally sharded) atomic counters.  We
+// first verify, in a single thread, that the requests are forwarded with the
+// expected sizes, and that the statistics reported by snapshots and by the
+// accessors are exact, for both unsharded and sharded allocators, using a
+// 'bslma::TestAllocator' as the upstream allocator.  We then stress the
+// allocator from several threads, and verify that, once the threads are
+// quiescent, the statistics are exact and no memory is lost.
+//-----------------------------------------------------------------------------
+// 'CountingAllocatorSnapshot'
+// [ 2] CountingAllocatorSnapshot();
+// [ 3] bsls::Types::Int64 numAllocations() const;
+// [ 3] bsls::Types::Int64 numDeallocations() const;
+// [ 3] bsls::Types::Int64 numBlocksInUse() const;
+// [ 3] bsls::Types::Int64 numBytesInUse() const;
+// [ 3] bsls::Types::Int64 numBytesTotal() const;
+// [ 3] bsls::Types::Int64 peakBytesInUse() const;
+//
+// 'CountingAllocator'
+// [ 2] explicit CountingAllocator(Allocator *basicAllocator = 0);
+// [ 2] explicit CountingAllocator(const char *name, Allocator * = 0);
+// [ 2] CountingAllocator(const char *name, int numShards, Allocator * = 0);
+// [ 2] ~CountingAllocator();
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 3] void deallocateSized(void *address, size_type size);
+// [ 3] void snapshot(CountingAllocatorSnapshot *result) const;
+// [ 3] bsls::Types::Int64 numBytesInUse() const;
+// [ 3] bsls::Types::Int64 peakBytesInUse() const;
+// [ 2] const char *name() const;
+// [ 2] int numShards() const;
+// [ 2] Allocator *allocator() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] SHARDED COUNTERS
+// [ 5] CONCURRENCY STRESS TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: OVERHEAD OVER THE UPSTREAM ALLOCATOR
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslma::CountingAllocator         Obj;
+typedef bslma::CountingAllocatorSnapshot Snapshot;
+typedef bslma::Allocator::size_type      size_type;
+typedef bsls::Types::Int64               Int64;
+
+// The size of the header that precedes each block dispensed by the allocator
+// under test.
+
+static const size_type HEADER_SIZE = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == bsls::AlignmentUtil::calculateAlignmentOffset(
+                                   address,
+                                   bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+}
+
+typedef void *(*thread_func)(void *arg);
+
+static thread_t createThread(thread_func func, void *arg)
+    // Create a thread running the specified 'func' with the specified 'arg',
+    // and return its handle.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE) func, arg, 0, 0);
+#else
+    thread_t thr;
+    pthread_create(&thr, 0, func, arg);
+    return thr;
+#endif
+}
+
+static void joinThread(thread_t thr)
+    // Wait for the thread having the specified handle 'thr' to complete.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(thr, INFINITE);
+    CloseHandle(thr);
+#else
+    pthread_join(thr, 0);
+#endif
+}
+
+                        // ==========================
+                        // class ThreadSafeAllocator
+                        // ==========================
+
+class ThreadSafeAllocator : public bslma::Allocator {
+    // This class provides a thread-safe allocator that obtains memory from
+    // 'bslma::NewDeleteAllocator', and atomically counts the blocks and bytes
+    // in use, taking the size of each deallocated block from
+    // 'deallocateSized'.
+
+    // DATA
+    bsls::AtomicInt   d_numBlocksInUse;  // number of blocks in use
+    bsls::AtomicInt64 d_numBytesInUse;   // number of bytes in use
+
+  public:
+    // MANIPULATORS
+    virtual void *allocate(size_type size)
+    {
+        ++d_numBlocksInUse;
+        d_numBytesInUse += static_cast<Int64>(size);
+        return bslma::NewDeleteAllocator::singleton().allocate(size);
+    }
+
+    virtual void deallocate(void *)
+    {
+        // Every block is expected to be returned through 'deallocateSized'.
+
+        ASSERT(!"'deallocate' called");
+    }
+
+    virtual void deallocateSized(void *address, size_type size)
+    {
+        if (address) {
+            --d_numBlocksInUse;
+            d_numBytesInUse -= static_cast<Int64>(size);
+        }
+        bslma::NewDeleteAllocator::singleton().deallocate(address);
+    }
+
+    // ACCESSORS
+    int numBlocksInUse() const
+    {
+        return d_numBlocksInUse;
+    }
+
+    Int64 numBytesInUse() const
+    {
+        return d_numBytesInUse;
+    }
+};
+
+                        // ==================
+                        // struct ThreadParam
+                        // ==================
+
+struct ThreadParam {
+    // This 'struct' holds the arguments of the test threads.
+
+    bslma::Allocator *d_allocator_p;   // allocator used by the thread
+    int               d_id;            // identifier of the thread
+    int               d_iterations;    // number of iterations
+    Int64             d_numBytes;      // number of bytes allocated by the
+                                       // thread (output)
+};
+
+extern "C" void *allocatingThread(void *arg)
+    // Allocate and deallocate blocks of various sizes from the allocator
+    // specified by the 'ThreadParam' at the specified 'arg', keeping up to 16
+    // blocks in use at a time, and load the total number of bytes allocated
+    // into the 'd_numBytes' field of that 'ThreadParam'.
+{
+    ThreadParam&      param     = *static_cast<ThreadParam *>(arg);
+    bslma::Allocator& allocator = *param.d_allocator_p;
+
+    enum { k_NUM_SLOTS = 16 };
+
+    void      *blocks[k_NUM_SLOTS] = { 0 };
+    size_type  sizes[k_NUM_SLOTS]  = { 0 };
+    Int64      numBytes            = 0;
+
+    for (int i = 0; i < param.d_iterations; ++i) {
+        const int slot = (i * 7 + param.d_id) % k_NUM_SLOTS;
+        if (blocks[slot]) {
+            if (i & 1) {
+                allocator.deallocate(blocks[slot]);
+            }
+            else {
+                allocator.deallocateSized(blocks[slot], sizes[slot]);
+            }
+        }
+        sizes[slot]  = 1 + (i * 13 + param.d_id) % 200;
+        blocks[slot] = allocator.allocate(sizes[slot]);
+        memset(blocks[slot], param.d_id, sizes[slot]);
+        numBytes += sizes[slot];
+    }
+    for (int slot = 0; slot < k_NUM_SLOTS; ++slot) {
+        allocator.deallocate(blocks[slot]);
+    }
+
+    param.d_numBytes = numBytes;
+    return 0;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+///Example 1: Monitoring the Memory Used by a Subsystem
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to report the memory used by a cache of strings, and
+// the largest amount of memory it has used.
+//
+// First, we create a counting allocator, named for the subsystem, that
+// obtains memory from the default allocator:
+//..
+    bslma::CountingAllocator countingAllocator("string cache");
+//..
+// Then, we simulate the use of the cache by allocating and deallocating some
+// blocks:
+//..
+    void *blocks[10];
+    for (int i = 0; i < 10; ++i) {
+        blocks[i] = countingAllocator.allocate(100);
+    }
+    for (int i = 0; i < 5; ++i) {
+        countingAllocator.deallocate(blocks[i]);
+    }
+//..
+// Next, we take a snapshot of the statistics of the allocator:
+//..
+    bslma::CountingAllocatorSnapshot snapshot;
+    countingAllocator.snapshot(&snapshot);
+//..
+// Now, we observe the statistics reported:
+//..
+    ASSERT(10   == snapshot.numAllocations());
+    ASSERT(5    == snapshot.numDeallocations());
+    ASSERT(5    == snapshot.numBlocksInUse());
+    ASSERT(500  == snapshot.numBytesInUse());
+    ASSERT(1000 == snapshot.numBytesTotal());
+    ASSERT(1000 == snapshot.peakBytesInUse());
+//..
+// Finally, we return the remaining blocks, and observe that the allocator no
+// longer has memory in use, while its peak is unchanged:
+//..
+    for (int i = 5; i < 10; ++i) {
+        countingAllocator.deallocate(blocks[i]);
+    }
+    ASSERT(0    == countingAllocator.numBytesInUse());
+    ASSERT(1000 == countingAllocator.peakBytesInUse());
+//..
+
+        if (veryVerbose) {
+            printf("%s: peak %lld bytes\n",
+                   countingAllocator.name(),
+                   countingAllocator.peakBytesInUse());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY STRESS TEST
+        //
+        // Concerns:
+        //: 1 Concurrent allocations and deallocations from several threads
+        //:   are all counted, for both unsharded and sharded allocators.
+        //:
+        //: 2 Every block is returned to the upstream allocator.
+        //:
+        //: 3 The peak of an unsharded allocator is at least the largest
+        //:   number of bytes held by any one thread, and at most the sum of
+        //:   the largest numbers of bytes that each thread can hold.
+        //:
+        //: 4 Snapshots may be taken while the allocator is in use.
+        //
+        // Plan:
+        //: 1 For 1, 4, and 64 shards, run several threads that allocate and
+        //:   deallocate blocks of various sizes, keeping up to 16 blocks in
+        //:   use each, while the main thread takes snapshots, and verify the
+        //:   statistics once the threads are joined, using a thread-safe
+        //:   counting allocator as the upstream allocator.  (C-1..4)
+        //
+        // Testing:
+        //   CONCURRENCY STRESS TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENCY STRESS TEST"
+                            "\n=======================\n");
+
+        enum { NUM_THREADS = 8, NUM_ITERATIONS = 100000 };
+
+        const int SHARDS[] = { 1, 4, 64 };
+        const int NUM_SHARDS = sizeof SHARDS / sizeof *SHARDS;
+
+        for (int ti = 0; ti < NUM_SHARDS; ++ti) {
+            const int SHARD = SHARDS[ti];
+
+            if (veryVerbose) { T_ P(SHARD) }
+
+            ThreadSafeAllocator ta;
+            {
+                Obj mX("stress", SHARD, &ta);  const Obj& X = mX;
+
+                ThreadParam params[NUM_THREADS];
+                thread_t    threads[NUM_THREADS];
+
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    const ThreadParam PARAM = { &mX, i, NUM_ITERATIONS, 0 };
+                    params[i]  = PARAM;
+                    threads[i] = createThread(&allocatingThread, &params[i]);
+                }
+
+                for (int i = 0; i < 100; ++i) {
+                    Snapshot s;
+                    X.snapshot(&s);
+                    LOOP_ASSERT(SHARD, 0 <= s.numBytesTotal());
+                    LOOP_ASSERT(SHARD,
+                                X.peakBytesInUse() <= Int64(NUM_THREADS)
+                                                      * 16 * 200);
+                }
+
+                Int64 numBytes = 0;
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    joinThread(threads[i]);
+                    numBytes += params[i].d_numBytes;
+                }
+
+                Snapshot s;
+                X.snapshot(&s);
+
+                const Int64 NUM_ALLOCATIONS = Int64(NUM_THREADS)
+                                            * NUM_ITERATIONS;
+
+                LOOP_ASSERT(SHARD, NUM_ALLOCATIONS == s.numAllocations());
+                LOOP_ASSERT(SHARD, NUM_ALLOCATIONS == s.numDeallocations());
+                LOOP_ASSERT(SHARD, 0               == s.numBlocksInUse());
+                LOOP_ASSERT(SHARD, 0               == s.numBytesInUse());
+                LOOP_ASSERT(SHARD, numBytes        == s.numBytesTotal());
+                LOOP_ASSERT(SHARD, 0               == X.numBytesInUse());
+
+                LOOP_ASSERT(SHARD, s.peakBytesInUse() <= Int64(NUM_THREADS)
+                                                         * 16 * 200);
+                if (1 == SHARD) {
+                    LOOP_ASSERT(SHARD, 200 <= s.peakBytesInUse());
+                }
+
+                ASSERT(1 == ta.numBlocksInUse());  // the shards
+            }
+            LOOP_ASSERT(SHARD, 0 == ta.numBlocksInUse());
+            LOOP_ASSERT(SHARD, 0 == ta.numBytesInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SHARDED COUNTERS
+        //
+        // Concerns:
+        //: 1 The statistics of a sharded allocator are the sums of the
+        //:   counters of all of its shards.
+        //:
+        //: 2 The peak of a sharded allocator is the largest number of bytes
+        //:   in use observed by a snapshot or by 'peakBytesInUse', and is
+        //:   never lowered.
+        //:
+        //: 3 Blocks may be deallocated by a thread other than the one that
+        //:   allocated them.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks from a sharded allocator, taking
+        //:   snapshots between the requests, and verify the statistics and
+        //:   the peak.  (C-1..2)
+        //:
+        //: 2 Allocate blocks on one thread, deallocate them on another, and
+        //:   verify that the statistics are exact.  (C-3)
+        //
+        // Testing:
+        //   SHARDED COUNTERS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSHARDED COUNTERS"
+                            "\n================\n");
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        if (verbose) printf("\nPeak observed by snapshots.\n");
+        {
+            Obj mX("sharded", 8, &ta);  const Obj& X = mX;
+
+            void *a = mX.allocate(100);
+            void *b = mX.allocate(200);
+
+            // No snapshot has observed the 300 bytes in use yet.
+
+            mX.deallocate(a);
+            mX.deallocate(b);
+
+            Snapshot s;
+            X.snapshot(&s);
+            ASSERT(2   == s.numAllocations());
+            ASSERT(2   == s.numDeallocations());
+            ASSERT(0   == s.numBytesInUse());
+            ASSERT(300 == s.numBytesTotal());
+            ASSERT(0   == s.peakBytesInUse());
+
+            a = mX.allocate(100);
+            b = mX.allocate(200);
+
+            ASSERT(300 == X.peakBytesInUse());
+
+            mX.deallocate(a);
+            ASSERT(300 == X.peakBytesInUse());
+
+            X.snapshot(&s);
+            ASSERT(200 == s.numBytesInUse());
+            ASSERT(300 == s.peakBytesInUse());
+
+            mX.deallocate(b);
+            X.snapshot(&s);
+            ASSERT(0   == s.numBytesInUse());
+            ASSERT(600 == s.numBytesTotal());
+            ASSERT(300 == s.peakBytesInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\nDeallocation on another thread.\n");
+        {
+            enum { NUM_BLOCKS = 100 };
+
+            Obj mX("handoff", 16, &ta);  const Obj& X = mX;
+
+            struct Local {
+                static void *deallocateAll(void *arg)
+                {
+                    void **blocks = static_cast<void **>(arg);
+                    Obj   *alloc  = static_cast<Obj *>(blocks[NUM_BLOCKS]);
+                    for (int i = 0; i < NUM_BLOCKS; ++i) {
+                        alloc->deallocate(blocks[i]);
+                    }
+                    return 0;
+                }
+            };
+
+            void *blocks[NUM_BLOCKS + 1];
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                blocks[i] = mX.allocate(i + 1);
+            }
+            blocks[NUM_BLOCKS] = &mX;
+
+            ASSERT(NUM_BLOCKS * (NUM_BLOCKS + 1) / 2 == X.numBytesInUse());
+            ASSERT(NUM_BLOCKS * (NUM_BLOCKS + 1) / 2 == X.peakBytesInUse());
+
+            joinThread(createThread(&Local::deallocateAll, blocks));
+
+            Snapshot s;
+            X.snapshot(&s);
+            ASSERT(NUM_BLOCKS == s.numAllocations());
+            ASSERT(NUM_BLOCKS == s.numDeallocations());
+            ASSERT(0          == s.numBlocksInUse());
+            ASSERT(0          == s.numBytesInUse());
+            ASSERT(NUM_BLOCKS * (NUM_BLOCKS + 1) / 2 == s.peakBytesInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE, DEALLOCATE, AND STATISTICS
+        //
+        // Concerns:
+        //: 1 'allocate' returns a maximally-aligned block obtained from the
+        //:   upstream allocator, which is larger than the request by the
+        //:   size of a header.
+        //:
+        //: 2 'deallocate' and 'deallocateSized' return the whole block to
+        //:   the upstream allocator, supplying its size.
+        //:
+        //: 3 Allocating 0 bytes returns 0, and deallocating 0 has no effect;
+        //:   neither is counted.
+        //:
+        //: 4 The snapshot and the accessors report exact statistics, and the
+        //:   peak of an unsharded allocator is exact.
+        //:
+        //: 5 Over-aligned allocations are supported and counted.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate a sequence of blocks, verifying the
+        //:   requests received by a 'bslma::TestAllocator' and the
+        //:   statistics after each request.  (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   void deallocateSized(void *address, size_type size);
+        //   void snapshot(CountingAllocatorSnapshot *result) const;
+        //   bsls::Types::Int64 numBytesInUse() const;
+        //   bsls::Types::Int64 peakBytesInUse() const;
+        //   bsls::Types::Int64 numAllocations() const;
+        //   bsls::Types::Int64 numDeallocations() const;
+        //   bsls::Types::Int64 numBlocksInUse() const;
+        //   bsls::Types::Int64 numBytesInUse() const;
+        //   bsls::Types::Int64 numBytesTotal() const;
+        //   bsls::Types::Int64 peakBytesInUse() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nALLOCATE, DEALLOCATE, AND STATISTICS"
+                            "\n====================================\n");
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+        {
+            Obj mX("counting", &ta);  const Obj& X = mX;
+
+            const Int64 SHARD_BLOCKS = ta.numBlocksInUse();
+            const Int64 SHARD_BYTES  = ta.numBytesInUse();
+
+            if (verbose) printf("\tZero-sized requests.\n");
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+            mX.deallocateSized(0, 0);
+
+            Snapshot s;
+            X.snapshot(&s);
+            ASSERT(0 == s.numAllocations());
+            ASSERT(0 == s.numDeallocations());
+            ASSERT(SHARD_BLOCKS == ta.numBlocksInUse());
+
+            if (verbose) printf("\tAllocations.\n");
+
+            static const struct {
+                int       d_line;   // source line number
+                size_type d_size;   // size of the request
+            } DATA[] = {
+                //LINE  SIZE
+                //----  ----
+                { L_,      1 },
+                { L_,      7 },
+                { L_,     16 },
+                { L_,    100 },
+                { L_,   1000 },
+                { L_,  65536 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            void  *blocks[NUM_DATA];
+            Int64  total = 0;
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int       LINE = DATA[ti].d_line;
+                const size_type SIZE = DATA[ti].d_size;
+
+                blocks[ti] = mX.allocate(SIZE);
+                total     += SIZE;
+
+                LOOP_ASSERT(LINE, blocks[ti]);
+                LOOP_ASSERT(LINE, isMaximallyAligned(blocks[ti]));
+                LOOP_ASSERT(LINE,
+                            SIZE + HEADER_SIZE == ta.lastAllocatedNumBytes());
+                LOOP_ASSERT(LINE, static_cast<char *>(blocks[ti])
+                                  - HEADER_SIZE
+                                      == ta.lastAllocatedAddress());
+                memset(blocks[ti], 0xa5, SIZE);
+
+                X.snapshot(&s);
+                LOOP_ASSERT(LINE, ti + 1 == s.numAllocations());
+                LOOP_ASSERT(LINE, 0      == s.numDeallocations());
+                LOOP_ASSERT(LINE, ti + 1 == s.numBlocksInUse());
+                LOOP_ASSERT(LINE, total  == s.numBytesInUse());
+                LOOP_ASSERT(LINE, total  == s.numBytesTotal());
+                LOOP_ASSERT(LINE, total  == s.peakBytesInUse());
+                LOOP_ASSERT(LINE, total  == X.numBytesInUse());
+                LOOP_ASSERT(LINE, total  == X.peakBytesInUse());
+            }
+
+            if (verbose) printf("\tDeallocations.\n");
+
+            const Int64 PEAK  = total;
+            Int64       inUse = total;
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int       LINE = DATA[ti].d_line;
+                const size_type SIZE = DATA[ti].d_size;
+
+                if (ti & 1) {
+                    mX.deallocateSized(blocks[ti], SIZE);
+                }
+                else {
+                    mX.deallocate(blocks[ti]);
+                }
+                inUse -= SIZE;
+
+                LOOP_ASSERT(LINE,
+                          SIZE + HEADER_SIZE == ta.lastDeallocatedNumBytes());
+                LOOP_ASSERT(LINE, static_cast<char *>(blocks[ti])
+                                  - HEADER_SIZE
+                                      == ta.lastDeallocatedAddress());
+
+                X.snapshot(&s);
+                LOOP_ASSERT(LINE, NUM_DATA          == s.numAllocations());
+                LOOP_ASSERT(LINE, ti + 1            == s.numDeallocations());
+                LOOP_ASSERT(LINE, NUM_DATA - ti - 1 == s.numBlocksInUse());
+                LOOP_ASSERT(LINE, inUse             == s.numBytesInUse());
+                LOOP_ASSERT(LINE, total             == s.numBytesTotal());
+                LOOP_ASSERT(LINE, PEAK              == s.peakBytesInUse());
+            }
+            ASSERT(SHARD_BLOCKS == ta.numBlocksInUse());
+            ASSERT(SHARD_BYTES  == ta.numBytesInUse());
+
+            if (verbose) printf("\tPeak of an unsharded allocator.\n");
+
+            // A new peak is recorded by the allocation that reaches it,
+            // without any intervening snapshot.
+
+            void *a = mX.allocate(PEAK);
+            void *b = mX.allocate(1);
+            mX.deallocate(a);
+            mX.deallocate(b);
+            ASSERT(PEAK + 1 == X.peakBytesInUse());
+            ASSERT(0        == X.numBytesInUse());
+
+            if (verbose) printf("\tOver-aligned allocations.\n");
+
+            void *c = mX.allocateAligned(100, 256);
+            ASSERT(0 == bsls::AlignmentUtil::calculateAlignmentOffset(c, 256));
+            ASSERT(0 < X.numBytesInUse());
+            mX.deallocateAligned(c, 100, 256);
+            ASSERT(0 == X.numBytesInUse());
+
+            if (verbose) printf("\tNegative testing.\n");
+            {
+                bsls::AssertFailureHandlerGuard hG(
+                                          bsls::AssertTest::failTestDriver);
+
+                void *d = mX.allocate(10);
+                ASSERT_SAFE_FAIL(mX.deallocateSized(d, 11));
+                ASSERT_SAFE_PASS(mX.deallocateSized(d, 10));
+
+                ASSERT_FAIL(X.snapshot(0));
+                ASSERT_PASS(X.snapshot(&s));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The upstream allocator is the one supplied at construction, or
+        //:   the default allocator.
+        //:
+        //: 2 The name is the one supplied at construction, or the empty
+        //:   string.
+        //:
+        //: 3 The number of shards is the one supplied at construction, or 1.
+        //:
+        //: 4 The shards are obtained from the upstream allocator at
+        //:   construction, and returned at destruction.
+        //:
+        //: 5 A default-constructed snapshot holds zero statistics.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 Construct allocators using each constructor, and verify the
+        //:   basic accessors and the memory obtained from the upstream
+        //:   allocator.  (C-1..4)
+        //:
+        //: 2 Default-construct a snapshot and verify its statistics.  (C-5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   CountingAllocatorSnapshot();
+        //   explicit CountingAllocator(Allocator *basicAllocator = 0);
+        //   explicit CountingAllocator(const char *name, Allocator * = 0);
+        //   CountingAllocator(const char *name, int numShards, Allocator *);
+        //   ~CountingAllocator();
+        //   const char *name() const;
+        //   int numShards() const;
+        //   Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS AND BASIC ACCESSORS"
+                            "\n============================\n");
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator         ta("upstream", veryVeryVerbose);
+
+        if (verbose) printf("\tDefault snapshot.\n");
+        {
+            const Snapshot S;
+            ASSERT(0 == S.numAllocations());
+            ASSERT(0 == S.numDeallocations());
+            ASSERT(0 == S.numBlocksInUse());
+            ASSERT(0 == S.numBytesInUse());
+            ASSERT(0 == S.numBytesTotal());
+            ASSERT(0 == S.peakBytesInUse());
+        }
+
+        if (verbose) printf("\tDefault constructor.\n");
+        {
+            const Obj X;
+            ASSERT(&da == X.allocator());
+            ASSERT(0   == strcmp("", X.name()));
+            ASSERT(1   == X.numShards());
+            ASSERT(1   == da.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        {
+            const Obj X(&ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(1   == ta.numBlocksInUse());
+            ASSERT(0   == da.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tNamed allocator.\n");
+        {
+            const Obj X("first");
+            ASSERT(&da == X.allocator());
+            ASSERT(0   == strcmp("first", X.name()));
+            ASSERT(1   == X.numShards());
+        }
+        {
+            const Obj X("second", &ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(0   == strcmp("second", X.name()));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tSharded allocator.\n");
+        for (int numShards = 1; numShards <= Obj::k_MAX_NUM_SHARDS;
+                                                              numShards *= 2) {
+            {
+                const Obj X("sharded", numShards);
+                LOOP_ASSERT(numShards, &da == X.allocator());
+                LOOP_ASSERT(numShards, numShards == X.numShards());
+            }
+            {
+                const Obj X("sharded", numShards, &ta);
+                LOOP_ASSERT(numShards, &ta == X.allocator());
+                LOOP_ASSERT(numShards, numShards == X.numShards());
+                LOOP_ASSERT(numShards, 1 == ta.numBlocksInUse());
+                LOOP_ASSERT(numShards,
+                            numShards * 64 <= ta.numBytesInUse());
+            }
+            LOOP_ASSERT(numShards, 0 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                          bsls::AssertTest::failTestDriver);
+
+            ASSERT_FAIL(Obj(0, &ta));
+            ASSERT_FAIL(Obj(0, 1, &ta));
+            ASSERT_FAIL(Obj("x", 0, &ta));
+            ASSERT_FAIL(Obj("x", 3, &ta));
+            ASSERT_FAIL(Obj("x", Obj::k_MAX_NUM_SHARDS * 2, &ta));
+            ASSERT_PASS(Obj("x", 2, &ta));
+            ASSERT_PASS(Obj("x", Obj::k_MAX_NUM_SHARDS, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate a few blocks from unsharded and sharded
+        //:   allocators, and verify the statistics.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        for (int numShards = 1; numShards <= 16; numShards *= 4) {
+            Obj mX("breathing", numShards, &ta);  const Obj& X = mX;
+
+            void *p = mX.allocate(10);
+            void *q = mX.allocate(20);
+            ASSERT(30 == X.numBytesInUse());
+            ASSERT(30 == X.peakBytesInUse());
+
+            mX.deallocate(p);
+            ASSERT(20 == X.numBytesInUse());
+
+            Snapshot s;
+            X.snapshot(&s);
+            ASSERT(2  == s.numAllocations());
+            ASSERT(1  == s.numDeallocations());
+            ASSERT(1  == s.numBlocksInUse());
+            ASSERT(20 == s.numBytesInUse());
+            ASSERT(30 == s.numBytesTotal());
+            ASSERT(30 == s.peakBytesInUse());
+
+            mX.deallocate(q);
+            ASSERT(0  == X.numBytesInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: OVERHEAD OVER THE UPSTREAM ALLOCATOR
+        //
+        // Concerns:
+        //: 1 Counting adds little to the cost of allocating from
+        //:   'bslma::NewDeleteAllocator', and sharding the counters keeps the
+        //:   overhead low when several threads allocate concurrently.
+        //
+        // Plan:
+        //: 1 Time threads, the number of which is optionally specified on
+        //:   the command line, that allocate and deallocate blocks from the
+        //:   new/delete allocator directly, and through unsharded and sharded
+        //:   counting allocators, and report the rates and the overheads.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: OVERHEAD OVER THE UPSTREAM ALLOCATOR
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: OVERHEAD OVER THE UPSTREAM"
+                            " ALLOCATOR"
+                            "\n======================================="
+                            "==========\n");
+
+        enum { MAX_THREADS = 64, NUM_ITERATIONS = 2000000 };
+
+        const int NUM_THREADS = argc > 2 && 0 < atoi(argv[2])
+                                && atoi(argv[2]) <= MAX_THREADS
+                              ? atoi(argv[2])
+                              : 1;
+
+        printf("%d thread(s)\n", NUM_THREADS);
+
+        bslma::NewDeleteAllocator& newDelete =
+                                        bslma::NewDeleteAllocator::singleton();
+
+        Obj unsharded("unsharded", 1, &newDelete);
+        Obj sharded("sharded", Obj::k_MAX_NUM_SHARDS, &newDelete);
+
+        bslma::Allocator *const ALLOCATORS[] = {
+            &newDelete, &unsharded, &sharded
+        };
+
+        static const char *const NAMES[] = {
+            "NewDeleteAllocator:",
+            "CountingAllocator(1 shard):",
+            "CountingAllocator(64 shards):"
+        };
+
+        double baseline = 0;
+        for (int mode = 0; mode < 3; ++mode) {
+            ThreadParam params[MAX_THREADS];
+            thread_t    threads[MAX_THREADS];
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                const ThreadParam PARAM = {
+                    ALLOCATORS[mode], i, NUM_ITERATIONS, 0
+                };
+                params[i]  = PARAM;
+                threads[i] = createThread(&allocatingThread, &params[i]);
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                joinThread(threads[i]);
+            }
+            timer.stop();
+
+            const double elapsed = timer.elapsedTime();
+            if (0 == mode) {
+                baseline = elapsed;
+            }
+
+            const double NUM_TOTAL = double(NUM_ITERATIONS) * NUM_THREADS;
+            printf("%-30s %g allocations/s (%+.1f%%)\n",
+                   NAMES[mode],
+                   NUM_TOTAL / elapsed,
+                   100.0 * (elapsed - baseline) / baseline);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
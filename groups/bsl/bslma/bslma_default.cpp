@@ -6,6 +6,13 @@ BSLS_IDENT("$Id$ $CSID$")
 
 #include <bslma_allocator.h>            // for testing only
 #include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define U_THREAD_LOCAL __declspec(thread)
+#else
+#define U_THREAD_LOCAL __thread
+#endif
 
 namespace BloombergLP {
 
@@ -24,6 +31,16 @@ class Allocator;
 bsls::AtomicOperations::AtomicTypes::Pointer Default::s_allocator = {0};
 bsls::AtomicOperations::AtomicTypes::Int     Default::s_locked    = {0};
 
+                        // *** thread default allocator ***
+
+bsls::AtomicOperations::AtomicTypes::Int Default::s_numThreadAllocators = {0};
+
+// The thread default allocator of each thread.  Note that a namespace-scope
+// pointer with a constant initializer may be held in (compiler-supported)
+// thread-local storage on all supported platforms.
+
+static U_THREAD_LOCAL Allocator *s_threadAllocator_p = 0;
+
                         // *** global allocator ***
 
 bsls::AtomicOperations::AtomicTypes::Pointer Default::s_globalAllocator = {0};
@@ -51,6 +68,31 @@ void Default::setDefaultAllocatorRaw(Allocator *basicAllocator)
     bsls::AtomicOperations::setPtrRelease(&s_allocator, basicAllocator);
 }
 
+                        // *** thread default allocator ***
+
+Allocator *Default::setThreadDefaultAllocator(Allocator *basicAllocator)
+{
+    Allocator *previous = s_threadAllocator_p;
+
+    // Maintain the number of threads having a thread default allocator, so
+    // that 'defaultAllocator' consults thread-local storage only when needed.
+
+    if (!previous && basicAllocator) {
+        bsls::AtomicOperations::addIntAcqRel(&s_numThreadAllocators, 1);
+    }
+    else if (previous && !basicAllocator) {
+        bsls::AtomicOperations::addIntAcqRel(&s_numThreadAllocators, -1);
+    }
+
+    s_threadAllocator_p = basicAllocator;
+    return previous;
+}
+
+Allocator *Default::threadDefaultAllocator()
+{
+    return s_threadAllocator_p;
+}
+
                         // *** global allocator ***
 
 Allocator *Default::setGlobalAllocator(Allocator *basicAllocator)
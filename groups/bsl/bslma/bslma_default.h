@@ -12,7 +12,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bslma::Default: namespace for default/global allocator management utilities
 //
-//@SEE_ALSO: bslma_allocator, bslma_newdeleteallocator
+//@SEE_ALSO: bslma_allocator, bslma_newdeleteallocator,
+//           bslma_threaddefaultallocatorguard
 //
 //@DESCRIPTION: This component provides a set of utility functions that manage
 // the addresses of two distinguished memory allocators: the *default*
@@ -79,6 +80,35 @@ BSLS_IDENT("$Id: $")
 // libraries that are on the link line.  *AVOID* file-scope static objects that
 // require runtime initialization, *especially* those that take an allocator.
 //
+///Thread Default Allocator
+///------------------------
+// In addition to the (process-wide) default allocator, each thread may
+// install a *thread* *default* *allocator* of its own by calling
+// 'bslma::Default::setThreadDefaultAllocator' (or, preferably, by creating a
+// 'bslma::ThreadDefaultAllocatorGuard').  While a thread default allocator is
+// installed, 'bslma::Default::defaultAllocator', and
+// 'bslma::Default::allocator' with no argument or an explicit 0, return it
+// when called from the thread that installed it, so that all of the objects
+// created without an explicit allocator on that thread (including temporaries
+// created deep within libraries) obtain their memory from, e.g., an arena or
+// pool dedicated to that thread.  Calls from other threads are unaffected.
+// Calling 'setThreadDefaultAllocator' with 0 uninstalls the thread default
+// allocator of the calling thread.  Note that, unlike the default allocator,
+// the thread default allocator is *not* subject to locking, and may be
+// installed and uninstalled at any time.
+//
+// The thread default allocator is held in thread-local storage, which is
+// consulted only while at least one thread in the process has a thread
+// default allocator installed: as long as the feature is not used, the cost
+// of 'defaultAllocator' is that of a single additional (relaxed) atomic load.
+// Note that a thread that exits without uninstalling its thread default
+// allocator continues to count as having one installed.
+//
+// The thread default allocator must outlive all of the objects created on the
+// thread that use it; this is most easily achieved by using the allocator
+// only for the short-lived objects created within the scope of a
+// 'bslma::ThreadDefaultAllocatorGuard'.
+//
 ///Global Allocator
 ///----------------
 // The interface pertaining to the global allocator is comparatively much
@@ -646,6 +676,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_atomicoperations.h>
 #endif
 
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
 #ifndef INCLUDED_BSLMA_NEWDELETEALLOCATOR
 #include <bslma_newdeleteallocator.h>
 #endif
@@ -671,6 +705,9 @@ struct Default {
     static bsls::AtomicOperations::AtomicTypes::Int     s_locked;
                                                   // lock to disable non-Raw
                                                   // 'set' of default allocator
+    static bsls::AtomicOperations::AtomicTypes::Int     s_numThreadAllocators;
+                                                  // number of threads having a
+                                                  // thread default allocator
     static bsls::AtomicOperations::AtomicTypes::Pointer s_globalAllocator;
                                                   // the global allocator
 
@@ -712,13 +749,14 @@ struct Default {
         // disabled by this method.
 
     static Allocator *defaultAllocator();
-        // Return the address of the default allocator and disable all
-        // subsequent calls to the 'setDefaultAllocator' method.  Note that
-        // prior to the first call to 'setDefaultAllocator' or
-        // 'setDefaultAllocatorRaw' methods, the address of the default
-        // allocator is that of the 'NewDeleteAllocator' singleton.  Also note
-        // that subsequent calls to 'setDefaultAllocatorRaw' method are *not*
-        // disabled by this method.
+        // Return the address of the thread default allocator of the calling
+        // thread if one is installed, and the address of the default
+        // allocator otherwise, and disable all subsequent calls to the
+        // 'setDefaultAllocator' method.  Note that prior to the first call to
+        // 'setDefaultAllocator' or 'setDefaultAllocatorRaw' methods, the
+        // address of the default allocator is that of the
+        // 'NewDeleteAllocator' singleton.  Also note that subsequent calls to
+        // 'setDefaultAllocatorRaw' method are *not* disabled by this method.
 
     static Allocator *allocator(Allocator *basicAllocator = 0);
         // Return the allocator returned by 'defaultAllocator' and disable all
@@ -726,6 +764,32 @@ struct Default {
         // optionally-specified 'basicAllocator' is 0; return 'basicAllocator'
         // otherwise.
 
+    static Allocator *processDefaultAllocator();
+        // Return the address of the default allocator, ignoring any thread
+        // default allocator of the calling thread, and disable all subsequent
+        // calls to the 'setDefaultAllocator' method.  Note that, unlike
+        // 'defaultAllocator', this method returns the same allocator on every
+        // thread, and is intended for components that save and restore the
+        // default allocator (e.g., 'bslma::DefaultAllocatorGuard').
+
+                        // *** thread default allocator ***
+
+    static Allocator *setThreadDefaultAllocator(Allocator *basicAllocator);
+        // Install the specified 'basicAllocator' as the thread default
+        // allocator of the calling thread, or uninstall the thread default
+        // allocator of the calling thread if 'basicAllocator' is 0.  Return
+        // the thread default allocator of the calling thread in effect
+        // immediately before calling this method, or 0 if none was installed.
+        // The behavior is undefined unless 'basicAllocator' is 0 or is the
+        // address of an allocator with sufficient lifetime to satisfy all of
+        // the allocation requests of the objects created on the calling thread
+        // while it is installed.  Note that this method does not affect the
+        // default allocator of any other thread.
+
+    static Allocator *threadDefaultAllocator();
+        // Return the thread default allocator of the calling thread, or 0 if
+        // none is installed.  Note that this method has no side-effects.
+
                         // *** global allocator ***
 
     static Allocator *globalAllocator(Allocator *basicAllocator = 0);
@@ -772,6 +836,36 @@ void Default::lockDefaultAllocator()
 
 inline
 Allocator *Default::defaultAllocator()
+{
+    Allocator *processAllocator = processDefaultAllocator();
+
+    // Thread-local storage is consulted only if some thread has installed a
+    // thread default allocator.  Note that a thread always observes its own
+    // installation of a thread default allocator.
+
+    const int numThreadAllocators =
+                bsls::AtomicOperations::getIntRelaxed(&s_numThreadAllocators);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != numThreadAllocators)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        Allocator *threadAllocator = threadDefaultAllocator();
+        if (threadAllocator) {
+            return threadAllocator;                                   // RETURN
+        }
+    }
+
+    return processAllocator;
+}
+
+inline
+Allocator *Default::allocator(Allocator *basicAllocator)
+{
+    return basicAllocator ? basicAllocator : defaultAllocator();
+}
+
+inline
+Allocator *Default::processDefaultAllocator()
 {
     if (!bsls::AtomicOperations::getPtrAcquire(&s_allocator)) {
         setDefaultAllocatorRaw(&NewDeleteAllocator::singleton());
@@ -785,12 +879,6 @@ Allocator *Default::defaultAllocator()
                          bsls::AtomicOperations::getPtrRelaxed(&s_allocator)));
 }
 
-inline
-Allocator *Default::allocator(Allocator *basicAllocator)
-{
-    return basicAllocator ? basicAllocator : defaultAllocator();
-}
-
                         // *** global allocator ***
 
 inline
@@ -9,6 +9,8 @@
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -16,6 +18,15 @@
 
 #include <new>
 
+// For thread support
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE thread_t;
+#else
+#include <pthread.h>
+typedef pthread_t thread_t;
+#endif
+
 using namespace BloombergLP;
 
 //=============================================================================
@@ -43,14 +54,19 @@ using namespace BloombergLP;
 // [ 3] void lockDefaultAllocator();
 // [ 2] bslma::Allocator *defaultAllocator();
 // [ 4] bslma::Allocator *allocator(*ba = 0);
+// [10] bslma::Allocator *processDefaultAllocator();
 // [ 9] bslma::Allocator *globalAllocator(*ba = 0);
 // [ 9] bslma::Allocator *setGlobalAllocator(*ba);
+// [10] bslma::Allocator *setThreadDefaultAllocator(*ba);
+// [10] bslma::Allocator *threadDefaultAllocator();
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] BOOTSTRAP TEST
-// [10] USAGE EXAMPLE 1
-// [11] USAGE EXAMPLE 2
-// [12] USAGE EXAMPLE 3
+// [10] THREAD DEFAULT ALLOCATOR
+// [11] USAGE EXAMPLE 1
+// [12] USAGE EXAMPLE 2
+// [13] USAGE EXAMPLE 3
+// [-1] PERFORMANCE: 'defaultAllocator'
 
 //=============================================================================
 //                  STANDARD BDE ASSERT TEST MACRO
@@ -107,6 +123,62 @@ typedef bslma::Default Obj;
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
 
+typedef void *(*thread_func)(void *arg);
+
+static thread_t createThread(thread_func func, void *arg)
+    // Create a thread running the specified 'func' with the specified 'arg',
+    // and return its handle.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE) func, arg, 0, 0);
+#else
+    thread_t thr;
+    pthread_create(&thr, 0, func, arg);
+    return thr;
+#endif
+}
+
+static void joinThread(thread_t thr)
+    // Wait for the thread having the specified handle 'thr' to complete.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(thr, INFINITE);
+    CloseHandle(thr);
+#else
+    pthread_join(thr, 0);
+#endif
+}
+
+struct ThreadDefaultAllocatorParam {
+    // This 'struct' holds the arguments and results of
+    // 'threadDefaultAllocatorThread'.
+
+    bslma::Allocator *d_threadAllocator_p;   // allocator to install
+    bslma::Allocator *d_initial_p;           // initial thread default
+    bslma::Allocator *d_default_p;           // default once installed
+    bslma::Allocator *d_previous_p;          // result of uninstalling
+    bslma::Allocator *d_final_p;             // default once uninstalled
+};
+
+extern "C" void *threadDefaultAllocatorThread(void *arg)
+    // Load into the 'ThreadDefaultAllocatorParam' at the specified 'arg' the
+    // initial thread default allocator of the calling thread, then install the
+    // allocator specified by that object as the thread default allocator of
+    // the calling thread and load the default allocator, then uninstall it,
+    // and load the previous thread default allocator and the default
+    // allocator.
+{
+    ThreadDefaultAllocatorParam& param =
+                                *static_cast<ThreadDefaultAllocatorParam *>(arg);
+
+    param.d_initial_p  = bslma::Default::threadDefaultAllocator();
+    bslma::Default::setThreadDefaultAllocator(param.d_threadAllocator_p);
+    param.d_default_p  = bslma::Default::defaultAllocator();
+    param.d_previous_p = bslma::Default::setThreadDefaultAllocator(0);
+    param.d_final_p    = bslma::Default::defaultAllocator();
+    return 0;
+}
+
 //=============================================================================
 //                  CLASSES FOR TESTING USAGE EXAMPLES
 //-----------------------------------------------------------------------------
@@ -508,7 +580,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 3
         //
@@ -564,7 +636,7 @@ int main(int argc, char *argv[])
 //..
 
       } break;
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         //
@@ -656,7 +728,7 @@ int main(int argc, char *argv[])
 // invocations (i.e., even with correct code).
 
       } break;
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         //
@@ -730,6 +802,115 @@ int main(int argc, char *argv[])
     ASSERT(1 == defaultCountingAllocator.numBlocksTotal());
 //..
 
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // THREAD DEFAULT ALLOCATOR
+        //
+        // Concerns:
+        //   1) Initially, no thread default allocator is installed.
+        //   2) 'setThreadDefaultAllocator' installs the thread default
+        //      allocator of the calling thread, uninstalls it when called
+        //      with 0, and returns the thread default allocator that was in
+        //      effect prior to the call (or 0).
+        //   3) While a thread default allocator is installed,
+        //      'defaultAllocator' and 'allocator', called with no argument,
+        //      return it; 'allocator', called with a non-zero argument,
+        //      returns that argument.
+        //   4) Installing a thread default allocator has no effect on the
+        //      default allocator, and is not prevented by locking the default
+        //      allocator; changing the default allocator has no effect on an
+        //      installed thread default allocator.
+        //   5) The thread default allocator of one thread has no effect on
+        //      other threads.
+        //   6) 'processDefaultAllocator' returns the default allocator,
+        //      whether or not a thread default allocator is installed, and
+        //      does not change the thread default allocator.
+        //
+        // Plan:
+        //   Install and uninstall thread default allocators on the main
+        //   thread, verifying the results of each method after each call.
+        //   Then, while a thread default allocator is installed on the main
+        //   thread, run a thread that installs and uninstalls a distinct
+        //   thread default allocator, and verify the default allocators
+        //   observed by each thread.  Verify the result of
+        //   'processDefaultAllocator' with and without a thread default
+        //   allocator installed.
+        //
+        // Testing:
+        //   bslma::Allocator *setThreadDefaultAllocator(*ba);
+        //   bslma::Allocator *threadDefaultAllocator();
+        //   bslma::Allocator *processDefaultAllocator();
+        //   THREAD DEFAULT ALLOCATOR
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTHREAD DEFAULT ALLOCATOR"
+                            "\n========================\n");
+
+        my_CountingAllocator mW;  bslma::Allocator *W = &mW;
+
+        if (veryVerbose) printf("\tInstalling on the main thread.\n");
+
+        ASSERT(  0 == Obj::threadDefaultAllocator());
+        ASSERT(NDA == Obj::defaultAllocator());  // locks default
+
+        ASSERT(  0 == Obj::setThreadDefaultAllocator(U));
+        ASSERT(  U == Obj::threadDefaultAllocator());
+        ASSERT(  U == Obj::defaultAllocator());
+        ASSERT(  U == Obj::allocator());
+        ASSERT(  U == Obj::allocator(0));
+        ASSERT(  V == Obj::allocator(V));
+
+        ASSERT(  U == Obj::setThreadDefaultAllocator(V));
+        ASSERT(  V == Obj::threadDefaultAllocator());
+        ASSERT(  V == Obj::defaultAllocator());
+        ASSERT(  V == Obj::allocator());
+
+        ASSERT(  V == Obj::setThreadDefaultAllocator(0));
+        ASSERT(  0 == Obj::threadDefaultAllocator());
+        ASSERT(NDA == Obj::defaultAllocator());
+        ASSERT(NDA == Obj::allocator());
+
+        ASSERT(  0 == Obj::setThreadDefaultAllocator(0));
+        ASSERT(  0 == Obj::threadDefaultAllocator());
+        ASSERT(NDA == Obj::defaultAllocator());
+
+        if (veryVerbose) printf("\tInteraction with the default.\n");
+
+        ASSERT(  0 != Obj::setDefaultAllocator(W));  // locked
+        ASSERT(  0 == Obj::setThreadDefaultAllocator(U));
+        ASSERT(  U == Obj::defaultAllocator());
+
+        Obj::setDefaultAllocatorRaw(W);
+        ASSERT(  U == Obj::defaultAllocator());
+        ASSERT(  W == Obj::processDefaultAllocator());
+        ASSERT(  U == Obj::threadDefaultAllocator());
+        ASSERT(  U == Obj::setThreadDefaultAllocator(0));
+        ASSERT(  W == Obj::defaultAllocator());
+        ASSERT(  W == Obj::processDefaultAllocator());
+        ASSERT(  0 == Obj::threadDefaultAllocator());
+
+        Obj::setDefaultAllocatorRaw(NDA);
+        ASSERT(NDA == Obj::defaultAllocator());
+
+        if (veryVerbose) printf("\tInstalling on another thread.\n");
+
+        ASSERT(  0 == Obj::setThreadDefaultAllocator(U));
+        {
+            ThreadDefaultAllocatorParam param = { V, 0, 0, 0, 0 };
+
+            joinThread(createThread(&threadDefaultAllocatorThread, &param));
+
+            ASSERT(  0 == param.d_initial_p);
+            ASSERT(  V == param.d_default_p);
+            ASSERT(  V == param.d_previous_p);
+            ASSERT(NDA == param.d_final_p);
+        }
+        ASSERT(  U == Obj::threadDefaultAllocator());
+        ASSERT(  U == Obj::defaultAllocator());
+        ASSERT(  U == Obj::setThreadDefaultAllocator(0));
+        ASSERT(NDA == Obj::defaultAllocator());
+
       } break;
       case 9: {
         // --------------------------------------------------------------------
@@ -1144,6 +1325,59 @@ int main(int argc, char *argv[])
         ASSERT(NDA == Obj::globalAllocator());
         ASSERT(  V == Obj::globalAllocator(V));
 
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'defaultAllocator'
+        //
+        // Concerns:
+        //   1) Supporting thread default allocators does not make
+        //      'defaultAllocator' measurably slower for programs that do not
+        //      install one.
+        //
+        // Plan:
+        //   Time calls to 'allocator' with no argument (which calls
+        //   'defaultAllocator'), first with no thread default allocator
+        //   installed on any thread, then with one installed on the calling
+        //   thread, and report the time per call.
+        //
+        // Testing:
+        //   PERFORMANCE: 'defaultAllocator'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: 'defaultAllocator'"
+                            "\n===============================\n");
+
+        enum { NUM_ITERATIONS = 100000000 };
+
+        static const char *const NAMES[] = {
+            "No thread default allocator:",
+            "Thread default allocator:"
+        };
+
+        for (int mode = 0; mode < 2; ++mode) {
+            if (1 == mode) {
+                Obj::setThreadDefaultAllocator(U);
+            }
+
+            bslma::Allocator *volatile  sink = 0;
+            bslma::Allocator *volatile  none = 0;
+            bsls::Stopwatch             timer;
+
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                sink = Obj::allocator(none);
+            }
+            timer.stop();
+
+            ASSERT((1 == mode ? U : NDA) == sink);
+
+            printf("%-30s %.2f ns/call\n",
+                   NAMES[mode],
+                   timer.elapsedTime() * 1e9 / NUM_ITERATIONS);
+        }
+        Obj::setThreadDefaultAllocator(0);
+
       } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
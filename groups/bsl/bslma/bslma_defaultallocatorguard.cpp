@@ -19,10 +19,15 @@ namespace bslma {
 
 // CREATORS
 DefaultAllocatorGuard::DefaultAllocatorGuard(Allocator *temporary)
-: d_original_p(Default::defaultAllocator())
+: d_original_p(0)
 {
     BSLS_ASSERT(temporary);
 
+    // Save the process-wide default allocator, rather than any thread default
+    // allocator of the calling thread, which 'defaultAllocator' would return.
+
+    d_original_p = Default::processDefaultAllocator();
+
     Default::setDefaultAllocatorRaw(temporary);
 }
 
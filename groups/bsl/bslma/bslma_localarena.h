@@ -0,0 +1,265 @@
+// bslma_localarena.h                                                 -*-C++-*-
+#ifndef INCLUDED_BSLMA_LOCALARENA
+#define INCLUDED_BSLMA_LOCALARENA
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sequential allocator seeded with an inline buffer.
+//
+//@CLASSES:
+//  bslma::LocalArena: sequential allocator with an inline buffer of N bytes
+//
+//@SEE_ALSO: bslma_sequentialallocator, bsls_alignedbuffer
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bslma::LocalArena', that is a 'bslma::SequentialAllocator' whose initial
+// buffer is a maximally-aligned 'bsls::AlignedBuffer' of 'BUFFER_SIZE' bytes
+// held *within* the allocator object:
+//..
+//   ,-------------------------------.
+//  ( bslma::LocalArena<BUFFER_SIZE> )
+//   `-------------------------------'
+//                  |        ctor/dtor
+//                  V
+//    ,--------------------------.
+//   ( bslma::SequentialAllocator )
+//    `--------------------------'
+//                  |        rewind
+//                  V
+//      ,-----------------------.
+//     ( bslma::ManagedAllocator )
+//      `-----------------------'
+//                  |        release
+//                  V
+//          ,----------------.
+//         ( bslma::Allocator )
+//          `----------------'
+//                           allocate
+//                           deallocate
+//..
+// A 'bslma::LocalArena' is intended to be created on the program stack: the
+// memory for small, short-lived data structures is then dispensed from the
+// stack frame itself, and the heap is used only if the data structures
+// outgrow the inline buffer.  Once the buffer is exhausted, the allocator
+// continues as a sequential arena whose blocks are obtained from the upstream
+// allocator supplied at construction (see {'bslma_sequentialallocator'}).
+// Unlike an allocator that simply forwards every request to the upstream
+// allocator once its buffer is exhausted, a 'bslma::LocalArena' continues to
+// dispense memory sequentially, so that an overflow costs one upstream
+// allocation per block, rather than one per request.
+//
+// As for any sequential allocator, 'deallocate' has no effect, and memory is
+// reclaimed by 'release', 'rewind', or the destructor.
+//
+///Thread Safety
+///-------------
+// 'bslma::LocalArena' is *not* thread-safe: an allocator object may not be
+// accessed concurrently from multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Building a Temporary Data Structure on the Stack
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to compute the number of distinct values in a
+// sequence of integers, using a temporary array that holds the distinct
+// values seen so far.  For most inputs the array is small, so we would like
+// to avoid using the heap for it.
+//
+// First, we define a function that obtains the memory for its temporary
+// array from a 'bslma::LocalArena' created on the stack, doubling the
+// capacity of the array as needed:
+//..
+//  int countDistinct(const int        *values,
+//                    int               numValues,
+//                    bslma::Allocator *basicAllocator = 0)
+//      // Return the number of distinct values in the specified 'values'
+//      // array of the specified 'numValues' length.  Optionally specify a
+//      // 'basicAllocator' used to supply memory if the temporary storage
+//      // needed exceeds the local buffer.  If 'basicAllocator' is 0, the
+//      // currently installed default allocator is used.
+//  {
+//      bslma::LocalArena<256> arena(basicAllocator);
+//
+//      int  capacity = 4;
+//      int  length   = 0;
+//      int *distinct = static_cast<int *>(
+//                                  arena.allocate(capacity * sizeof(int)));
+//
+//      for (int i = 0; i < numValues; ++i) {
+//          int j = 0;
+//          while (j < length && distinct[j] != values[i]) {
+//              ++j;
+//          }
+//          if (j < length) {
+//              continue;
+//          }
+//          if (length == capacity) {
+//              int *newDistinct = static_cast<int *>(
+//                              arena.allocate(2 * capacity * sizeof(int)));
+//              memcpy(newDistinct, distinct, length * sizeof(int));
+//              distinct  = newDistinct;
+//              capacity *= 2;
+//          }
+//          distinct[length++] = values[i];
+//      }
+//      return length;
+//  }
+//..
+// Notice that we do not deallocate the arrays that are outgrown: their
+// memory is reclaimed when 'arena' goes out of scope.
+//
+// Then, we call 'countDistinct' on a short sequence, supplying a test
+// allocator to observe that no memory is obtained from the heap:
+//..
+//  bslma::TestAllocator ta;
+//
+//  const int SHORT[] = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+//  assert(7 == countDistinct(SHORT, 11, &ta));
+//  assert(0 == ta.numBlocksTotal());
+//..
+// Finally, we call 'countDistinct' on a longer sequence, and observe that
+// the heap is used only once the local buffer is exhausted, and that all of
+// the memory is returned:
+//..
+//  int longSequence[1000];
+//  for (int i = 0; i < 1000; ++i) {
+//      longSequence[i] = i % 500;
+//  }
+//  assert(500 == countDistinct(longSequence, 1000, &ta));
+//  assert(0   <  ta.numBlocksTotal());
+//  assert(0   == ta.numBlocksInUse());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_SEQUENTIALALLOCATOR
+#include <bslma_sequentialallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNEDBUFFER
+#include <bsls_alignedbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BLOCKGROWTH
+#include <bsls_blockgrowth.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslma {
+
+                        // ================
+                        // class LocalArena
+                        // ================
+
+template <int BUFFER_SIZE>
+class LocalArena : public SequentialAllocator {
+    // This class template provides a sequential allocator that dispenses
+    // memory from a maximally-aligned buffer of (the template parameter)
+    // 'BUFFER_SIZE' bytes, held within the allocator object, before
+    // obtaining blocks from an upstream allocator.
+
+    BSLMF_ASSERT(0 < BUFFER_SIZE);
+
+    // DATA
+    bsls::AlignedBuffer<BUFFER_SIZE> d_buffer;  // inline initial buffer
+
+  private:
+    // NOT IMPLEMENTED
+    LocalArena(const LocalArena&);
+    LocalArena& operator=(const LocalArena&);
+
+  public:
+    // CREATORS
+    explicit LocalArena(Allocator *basicAllocator = 0);
+    explicit LocalArena(bsls::BlockGrowth::Strategy  growthStrategy,
+                        Allocator                   *basicAllocator = 0);
+        // Create a sequential allocator that dispenses memory from an inline
+        // buffer of 'BUFFER_SIZE' bytes before obtaining any block from the
+        // upstream allocator.  Optionally specify a 'growthStrategy' of the
+        // sizes of the blocks subsequently obtained; if 'growthStrategy' is
+        // not specified, geometric growth is used.  Optionally specify a
+        // 'basicAllocator' used to supply the blocks.  If 'basicAllocator' is
+        // 0, the currently installed default allocator is used.
+
+    virtual ~LocalArena();
+        // Destroy this allocator, returning all of the blocks obtained from
+        // the upstream allocator to the upstream allocator.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ----------------
+                        // class LocalArena
+                        // ----------------
+
+// CREATORS
+template <int BUFFER_SIZE>
+inline
+LocalArena<BUFFER_SIZE>::LocalArena(Allocator *basicAllocator)
+: SequentialAllocator(d_buffer.buffer(), BUFFER_SIZE, basicAllocator)
+{
+    // Note that the address of 'd_buffer' is valid before 'd_buffer' is
+    // initialized, and that 'bsls::AlignedBuffer' requires no
+    // initialization.
+}
+
+template <int BUFFER_SIZE>
+inline
+LocalArena<BUFFER_SIZE>::LocalArena(
+                                   bsls::BlockGrowth::Strategy  growthStrategy,
+                                   Allocator                   *basicAllocator)
+: SequentialAllocator(d_buffer.buffer(),
+                      BUFFER_SIZE,
+                      growthStrategy,
+                      basicAllocator)
+{
+}
+
+template <int BUFFER_SIZE>
+inline
+LocalArena<BUFFER_SIZE>::~LocalArena()
+{
+}
+
+}  // close package namespace
+
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,455 @@
+// bslma_localarena.t.cpp                                             -*-C++-*-
+
+#include <bslma_localarena.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_sequentialallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a class template deriving from
+// 'bslma::SequentialAllocator' that supplies an inline buffer to its base
+// class.  We verify that memory is dispensed from within the allocator object
+// itself, without using the upstream allocator, until the inline buffer is
+// exhausted; that the arena then obtains blocks of the expected size from the
+// upstream allocator; and that 'rewind' and 'release' make the inline buffer
+// available again.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit LocalArena(Allocator *basicAllocator = 0);
+// [ 2] explicit LocalArena(Strategy, Allocator *basicAllocator = 0);
+// [ 2] ~LocalArena();
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslma::Allocator::size_type size_type;
+
+static const bsls::BlockGrowth::Strategy GEO =
+                                          bsls::BlockGrowth::BSLS_GEOMETRIC;
+static const bsls::BlockGrowth::Strategy CON =
+                                          bsls::BlockGrowth::BSLS_CONSTANT;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static size_type blockHeaderSize()
+    // Return the number of bytes of overhead in each block that a sequential
+    // allocator obtains from its upstream allocator.
+{
+    bslma::TestAllocator       ta;
+    bslma::SequentialAllocator mX(&ta);
+    mX.allocate(1);
+    return ta.lastAllocatedNumBytes()
+         - bslma::SequentialAllocator::k_DEFAULT_INITIAL_SIZE;
+}
+
+template <class OBJECT>
+static bool isWithin(const void *address, const OBJECT& object)
+    // Return 'true' if the specified 'address' lies within the footprint of
+    // the specified 'object', and 'false' otherwise.
+{
+    const char *p     = static_cast<const char *>(address);
+    const char *begin = reinterpret_cast<const char *>(&object);
+    return begin <= p && p < begin + sizeof object;
+}
+
+template <int BUFFER_SIZE>
+static void testCreators(bool verbose, bool veryVerbose)
+    // Exercise the creators of 'bslma::LocalArena<BUFFER_SIZE>' with each
+    // growth strategy.  Print diagnostic information if the specified
+    // 'verbose' or 'veryVerbose' is 'true'.
+{
+    typedef bslma::LocalArena<BUFFER_SIZE> Obj;
+
+    if (verbose) printf("\tBUFFER_SIZE = %d\n", BUFFER_SIZE);
+
+    const size_type HEADER = blockHeaderSize();
+
+    bslma::TestAllocator da("default",  veryVerbose);
+    bslma::TestAllocator ta("upstream", veryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    for (int si = 0; si < 4; ++si) {
+        const bsls::BlockGrowth::Strategy STRATEGY = 1 == si % 2 ? CON : GEO;
+        bslma::TestAllocator&             oa       = si < 2 ? da : ta;
+        const size_type                   EXP_SIZE =
+                                            CON == STRATEGY ? BUFFER_SIZE
+                                                            : 2 * BUFFER_SIZE;
+
+        if (veryVerbose) { T_ P(si) }
+
+        Obj *objPtr;
+        switch (si) {
+          case 0:  objPtr = new (ta) Obj();         break;
+          case 1:  objPtr = new (ta) Obj(CON);      break;
+          case 2:  objPtr = new (ta) Obj(&ta);      break;
+          default: objPtr = new (ta) Obj(CON, &ta); break;
+        }
+        Obj&                        mX   = *objPtr;
+        bslma::SequentialAllocator& base = mX;
+
+        const bsls::Types::Int64 NUM_IN_USE = ta.numBlocksInUse();
+        const bsls::Types::Int64 DA_TOTAL   = da.numBlocksTotal();
+
+        LOOP_ASSERT(si, DA_TOTAL == da.numBlocksTotal());
+        LOOP_ASSERT(si, &oa == mX.allocator());
+
+        // The whole inline buffer is dispensed without using the heap.
+
+        char *first = static_cast<char *>(base.allocate(1));
+        LOOP_ASSERT(si, isWithin(first, mX));
+        for (int i = 1; i < BUFFER_SIZE; ++i) {
+            char *p = static_cast<char *>(mX.allocate(1));
+            LOOP2_ASSERT(si, i, first + i == p);
+            LOOP2_ASSERT(si, i, isWithin(p, mX));
+        }
+        LOOP_ASSERT(si, DA_TOTAL   == da.numBlocksTotal());
+        LOOP_ASSERT(si, NUM_IN_USE == ta.numBlocksInUse());
+
+        // The next allocation overflows to the upstream allocator.
+
+        char *next = static_cast<char *>(mX.allocate(1));
+        LOOP_ASSERT(si, !isWithin(next, mX));
+        LOOP_ASSERT(si, 1 == oa.numBlocksInUse() - (&oa == &ta ? NUM_IN_USE
+                                                                : 0));
+        LOOP3_ASSERT(si, HEADER + EXP_SIZE, oa.lastAllocatedNumBytes(),
+                     HEADER + EXP_SIZE == oa.lastAllocatedNumBytes());
+
+        // 'rewind' makes the inline buffer available again, retaining the
+        // overflow block.
+
+        mX.rewind();
+        LOOP_ASSERT(si, first == mX.allocate(1));
+
+        // 'release' returns the overflow block, and makes the inline buffer
+        // available again.
+
+        mX.release();
+        LOOP_ASSERT(si, 0          == da.numBlocksInUse());
+        LOOP_ASSERT(si, NUM_IN_USE == ta.numBlocksInUse());
+        LOOP_ASSERT(si, first      == mX.allocate(1));
+
+        // The destructor returns any overflow block.
+
+        for (int i = 0; i < 4 * BUFFER_SIZE; ++i) {
+            mX.allocate(1);
+        }
+        LOOP_ASSERT(si, 0 < oa.numBlocksInUse());
+
+        ta.deleteObject(objPtr);
+        LOOP_ASSERT(si, 0 == da.numBlocksInUse());
+        LOOP_ASSERT(si, 0 == ta.numBlocksInUse());
+    }
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Example 1: Building a Temporary Data Structure on the Stack
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to compute the number of distinct values in a
+// sequence of integers, using a temporary array that holds the distinct
+// values seen so far.  For most inputs the array is small, so we would like
+// to avoid using the heap for it.
+//
+// First, we define a function that obtains the memory for its temporary
+// array from a 'bslma::LocalArena' created on the stack, doubling the
+// capacity of the array as needed:
+//..
+    int countDistinct(const int        *values,
+                      int               numValues,
+                      bslma::Allocator *basicAllocator = 0)
+        // Return the number of distinct values in the specified 'values'
+        // array of the specified 'numValues' length.  Optionally specify a
+        // 'basicAllocator' used to supply memory if the temporary storage
+        // needed exceeds the local buffer.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.
+    {
+        bslma::LocalArena<256> arena(basicAllocator);
+
+        int  capacity = 4;
+        int  length   = 0;
+        int *distinct = static_cast<int *>(
+                                    arena.allocate(capacity * sizeof(int)));
+
+        for (int i = 0; i < numValues; ++i) {
+            int j = 0;
+            while (j < length && distinct[j] != values[i]) {
+                ++j;
+            }
+            if (j < length) {
+                continue;
+            }
+            if (length == capacity) {
+                int *newDistinct = static_cast<int *>(
+                                arena.allocate(2 * capacity * sizeof(int)));
+                memcpy(newDistinct, distinct, length * sizeof(int));
+                distinct  = newDistinct;
+                capacity *= 2;
+            }
+            distinct[length++] = values[i];
+        }
+        return length;
+    }
+//..
+// Notice that we do not deallocate the arrays that are outgrown: their
+// memory is reclaimed when 'arena' goes out of scope.
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we call 'countDistinct' on a short sequence, supplying a test
+// allocator to observe that no memory is obtained from the heap:
+//..
+    bslma::TestAllocator ta;
+
+    const int SHORT[] = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+    ASSERT(7 == countDistinct(SHORT, 11, &ta));
+    ASSERT(0 == ta.numBlocksTotal());
+//..
+// Finally, we call 'countDistinct' on a longer sequence, and observe that
+// the heap is used only once the local buffer is exhausted, and that all of
+// the memory is returned:
+//..
+    int longSequence[1000];
+    for (int i = 0; i < 1000; ++i) {
+        longSequence[i] = i % 500;
+    }
+    ASSERT(500 == countDistinct(longSequence, 1000, &ta));
+    ASSERT(0   <  ta.numBlocksTotal());
+    ASSERT(0   == ta.numBlocksInUse());
+//..
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS
+        //
+        // Concerns:
+        //: 1 The first 'BUFFER_SIZE' bytes are dispensed from within the
+        //:   allocator object, and no memory is obtained from the upstream
+        //:   allocator until they are exhausted.
+        //:
+        //: 2 Once the inline buffer is exhausted, the first block obtained
+        //:   from the upstream allocator has twice the size of the inline
+        //:   buffer under geometric growth (the default), and the size of the
+        //:   inline buffer under constant growth.
+        //:
+        //: 3 If no allocator is supplied, the default allocator is used as the
+        //:   upstream allocator.
+        //:
+        //: 4 'rewind' and 'release' make the inline buffer available again.
+        //:
+        //: 5 The destructor returns all memory to the upstream allocator.
+        //
+        // Plan:
+        //: 1 For several buffer sizes, and each constructor, install a test
+        //:   allocator as the default, create an object, and exhaust its
+        //:   inline buffer with single-byte allocations, verifying that each
+        //:   address lies within the object.  Then allocate once more, and
+        //:   verify the size of the block obtained from the expected
+        //:   allocator.  (C-1..3)
+        //:
+        //: 2 'rewind' and 'release' the object, and verify that the next
+        //:   allocation is at the start of the inline buffer.  (C-4)
+        //:
+        //: 3 Overflow the object again, destroy it, and verify that no memory
+        //:   is in use.  (C-5)
+        //
+        // Testing:
+        //   explicit LocalArena(Allocator *basicAllocator = 0);
+        //   explicit LocalArena(Strategy, Allocator *basicAllocator = 0);
+        //   ~LocalArena();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS"
+                            "\n========\n");
+
+        testCreators<1>(verbose, veryVerbose);
+        testCreators<8>(verbose, veryVerbose);
+        testCreators<100>(verbose, veryVerbose);
+        testCreators<1024>(verbose, veryVerbose);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an arena, allocate from it until it overflows, and
+        //:   verify that the upstream allocator is used only after the
+        //:   overflow, and that all memory is returned on destruction.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+        {
+            bslma::LocalArena<64> mX(&ta);
+
+            void *p = mX.allocate(32);
+            ASSERT(isWithin(p, mX));
+            void *q = mX.allocate(32);
+            ASSERT(isWithin(q, mX));
+            ASSERT(p != q);
+            ASSERT(0 == ta.numBlocksTotal());
+
+            mX.deallocate(p);
+            mX.deallocate(q);
+            ASSERT(0 == ta.numBlocksTotal());
+
+            void *r = mX.allocate(1);
+            ASSERT(!isWithin(r, mX));
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
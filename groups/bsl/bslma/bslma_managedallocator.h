@@ -0,0 +1,362 @@
+// bslma_managedallocator.h                                           -*-C++-*-
+#ifndef INCLUDED_BSLMA_MANAGEDALLOCATOR
+#define INCLUDED_BSLMA_MANAGEDALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a protocol for allocators that can release all memory.
+//
+//@CLASSES:
+//  bslma::ManagedAllocator: protocol for allocators having 'release'
+//  bslma::ManagedAllocatorUtil: namespace for detecting managed allocators
+//
+//@SEE_ALSO: bslma_allocator, bslma_sequentialallocator, bslma_localarena
+//
+//@DESCRIPTION: This component provides a protocol (pure abstract interface)
+// class, 'bslma::ManagedAllocator', that extends the 'bslma::Allocator'
+// protocol with a single method, 'release', that reclaims, all at once, all
+// of the memory dispensed by the allocator, whether or not that memory was
+// previously deallocated:
+//..
+//   ,-----------------------.
+//  ( bslma::ManagedAllocator )
+//   `-----------------------'
+//               |         release
+//               V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                       allocate
+//                       deallocate
+//..
+// The component also provides a utility 'struct',
+// 'bslma::ManagedAllocatorUtil', that determines whether an allocator (either
+// the address of a 'bslma::Allocator', or an STL-style allocator that wraps
+// one, such as 'bsl::allocator') is a managed allocator.
+//
+///Winking Out
+///-----------
+// Memory obtained from a managed allocator need not be deallocated: it is
+// reclaimed when the allocator is released or destroyed.  An object that
+// owns memory from a managed allocator, and that is being destroyed, may
+// therefore skip its teardown entirely -- neither destroying its
+// sub-objects, provided that they have trivial destructors, nor returning
+// its memory -- a technique known as "winking out".  For a large,
+// short-lived data structure (e.g., a node-based container built while
+// processing a single request), winking out replaces a walk of every element
+// with a handful of instructions.
+//
+// The 'bsl' containers built on 'bslstl::TreeNodePool' (e.g., 'bsl::map' and
+// 'bsl::set') and on 'bslstl::BidirectionalNodePool' (e.g.,
+// 'bsl::unordered_map'), as well as 'bsl::deque', wink out on destruction
+// when their allocator is a managed allocator and their elements are
+// trivially destructible.  Note that an object that winks out leaves its
+// memory allocated until the allocator is released, so winking out is
+// appropriate only for allocators that are released, or destroyed, after a
+// bounded amount of work.  In particular, an allocator that reuses the memory
+// returned to it (e.g., 'bslma::MultipoolAllocator') must not implement this
+// protocol, even if it can release all of its memory at once: the containers
+// using it would never return their memory for reuse, and the allocator
+// would grow without bound.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Container That Winks Out
+///- - - - - - - - - - - - - - - - - - -
+// Suppose that we have a simple singly-linked list of integers, each node of
+// which is allocated individually from a supplied allocator.
+//
+// First, we define the list, whose destructor returns each node to the
+// allocator unless the allocator is a managed allocator, in which case the
+// nodes are left for the allocator to reclaim:
+//..
+//  class IntList {
+//      // This class implements a singly-linked list of 'int' values.
+//
+//      // PRIVATE TYPES
+//      struct Node {
+//          Node *d_next_p;
+//          int   d_value;
+//      };
+//
+//      // DATA
+//      Node             *d_head_p;       // first node, or 0 if empty
+//      bslma::Allocator *d_allocator_p;  // allocator (held, not owned)
+//
+//      // NOT IMPLEMENTED
+//      IntList(const IntList&);
+//      IntList& operator=(const IntList&);
+//
+//    public:
+//      // CREATORS
+//      explicit IntList(bslma::Allocator *basicAllocator)
+//      : d_head_p(0)
+//      , d_allocator_p(basicAllocator)
+//      {
+//      }
+//
+//      ~IntList()
+//      {
+//          if (bslma::ManagedAllocatorUtil::isManaged(d_allocator_p)) {
+//              return;                                           // RETURN
+//          }
+//          while (d_head_p) {
+//              Node *next = d_head_p->d_next_p;
+//              d_allocator_p->deallocate(d_head_p);
+//              d_head_p = next;
+//          }
+//      }
+//
+//      // MANIPULATORS
+//      void pushFront(int value)
+//      {
+//          Node *node = static_cast<Node *>(
+//                                      d_allocator_p->allocate(sizeof(Node)));
+//          node->d_next_p  = d_head_p;
+//          node->d_value   = value;
+//          d_head_p        = node;
+//      }
+//  };
+//..
+// Then, we define a managed allocator that obtains its memory from the
+// global heap, tracking the blocks it dispenses so that 'release' can
+// reclaim them (a realistic managed allocator, such as
+// 'bslma::SequentialAllocator', would carve its blocks from larger chunks):
+//..
+//  class TrackingAllocator : public bslma::ManagedAllocator {
+//      // This class implements a managed allocator that records the blocks
+//      // it dispenses in a list threaded through their headers.
+//
+//      // PRIVATE TYPES
+//      union Header {
+//          Header                               *d_next_p;
+//          bsls::AlignmentUtil::MaxAlignedType   d_alignment;
+//      };
+//
+//      // DATA
+//      Header *d_blocks_p;         // list of dispensed blocks
+//      int     d_numDeallocations; // number of calls to 'deallocate'
+//
+//    public:
+//      // CREATORS
+//      TrackingAllocator() : d_blocks_p(0), d_numDeallocations(0) {}
+//
+//      virtual ~TrackingAllocator() { release(); }
+//
+//      // MANIPULATORS
+//      virtual void *allocate(size_type size)
+//      {
+//          Header *header = static_cast<Header *>(
+//                                   ::operator new(sizeof(Header) + size));
+//          header->d_next_p = d_blocks_p;
+//          d_blocks_p       = header;
+//          return header + 1;
+//      }
+//
+//      virtual void deallocate(void *)
+//      {
+//          ++d_numDeallocations;
+//      }
+//
+//      virtual void release()
+//      {
+//          while (d_blocks_p) {
+//              Header *next = d_blocks_p->d_next_p;
+//              ::operator delete(d_blocks_p);
+//              d_blocks_p = next;
+//          }
+//      }
+//
+//      // ACCESSORS
+//      int numDeallocations() const { return d_numDeallocations; }
+//  };
+//..
+// Next, we build a list using a 'TrackingAllocator':
+//..
+//  TrackingAllocator managed;
+//  {
+//      IntList list(&managed);
+//      for (int i = 0; i < 1000; ++i) {
+//          list.pushFront(i);
+//      }
+//  }
+//..
+// Then, we observe that the destructor of the list did not visit its nodes
+// to deallocate them:
+//..
+//  assert(0 == managed.numDeallocations());
+//..
+// Finally, we observe that a list built with an allocator that is not a
+// managed allocator, such as a 'bslma::TestAllocator', returns its nodes:
+//..
+//  bslma::TestAllocator ta;
+//  assert(false == bslma::ManagedAllocatorUtil::isManaged(&ta));
+//  {
+//      IntList list(&ta);
+//      for (int i = 0; i < 1000; ++i) {
+//          list.pushFront(i);
+//      }
+//  }
+//  assert(0 == ta.numBlocksInUse());
+//..
+// The memory of the first list is reclaimed when 'managed' is released or
+// destroyed.
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslma {
+
+                        // ======================
+                        // class ManagedAllocator
+                        // ======================
+
+class ManagedAllocator : public Allocator {
+    // This protocol class extends 'bslma::Allocator' for allocators that can
+    // reclaim, with a single call to 'release', all of the memory they have
+    // dispensed.
+
+  public:
+    // CREATORS
+    virtual ~ManagedAllocator();
+        // Destroy this allocator object.  Note that the behavior of
+        // destroying an allocator while memory is allocated from it is not
+        // specified.  (Unless you *know* that it is valid to do so, don't!)
+
+    // MANIPULATORS
+    virtual void release() = 0;
+        // Release all memory currently allocated through this allocator,
+        // whether or not it has been deallocated.  The behavior is undefined
+        // if any memory dispensed by this allocator is used after this call.
+};
+
+                        // ===========================
+                        // struct ManagedAllocatorUtil
+                        // ===========================
+
+struct ManagedAllocatorUtil {
+    // This 'struct' provides a namespace for functions that determine whether
+    // an allocator is a 'bslma::ManagedAllocator', so that an object being
+    // destroyed can decide whether it may wink out.
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class ALLOCATOR>
+    static bool hasManagedMechanism(const ALLOCATOR& allocator,
+                                    bsl::true_type);
+    template <class ALLOCATOR>
+    static bool hasManagedMechanism(const ALLOCATOR& allocator,
+                                    bsl::false_type);
+        // Return 'true' if the specified 'allocator' wraps the address of a
+        // 'bslma::ManagedAllocator', and 'false' otherwise.  The last
+        // argument is 'bsl::true_type' if 'allocator' wraps a
+        // 'bslma::Allocator' returned by 'allocator.mechanism()', and
+        // 'bsl::false_type' otherwise.
+
+  public:
+    // CLASS METHODS
+    static bool isManaged(const Allocator *allocator);
+        // Return 'true' if the specified 'allocator' is a
+        // 'bslma::ManagedAllocator', and 'false' otherwise (including if
+        // 'allocator' is 0).  Note that this function uses run-time type
+        // information, so callers that are sensitive to its (small) cost
+        // should first establish that winking out would be permitted.
+
+    template <class ALLOCATOR>
+    static bool hasManagedMechanism(const ALLOCATOR& allocator);
+        // Return 'true' if the (template parameter) type 'ALLOCATOR' is a
+        // bslma-compatible STL-style allocator (i.e., is convertible from
+        // 'bslma::Allocator *', as is 'bsl::allocator') and the specified
+        // 'allocator' wraps the address of a 'bslma::ManagedAllocator', and
+        // 'false' otherwise.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // struct ManagedAllocatorUtil
+                        // ---------------------------
+
+// PRIVATE CLASS METHODS
+template <class ALLOCATOR>
+inline
+bool ManagedAllocatorUtil::hasManagedMechanism(const ALLOCATOR& allocator,
+                                               bsl::true_type)
+{
+    return isManaged(allocator.mechanism());
+}
+
+template <class ALLOCATOR>
+inline
+bool ManagedAllocatorUtil::hasManagedMechanism(const ALLOCATOR&,
+                                               bsl::false_type)
+{
+    return false;
+}
+
+// CLASS METHODS
+inline
+bool ManagedAllocatorUtil::isManaged(const Allocator *allocator)
+{
+    return 0 != dynamic_cast<const ManagedAllocator *>(allocator);
+}
+
+template <class ALLOCATOR>
+inline
+bool ManagedAllocatorUtil::hasManagedMechanism(const ALLOCATOR& allocator)
+{
+    return hasManagedMechanism(
+                     allocator,
+                     typename bsl::is_convertible<Allocator *,
+                                                  ALLOCATOR>::type());
+}
+
+}  // close package namespace
+
+
+}  // close enterprise namespace
+
+#endif
+
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
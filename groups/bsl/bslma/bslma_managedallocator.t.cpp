@@ -0,0 +1,524 @@
+// bslma_managedallocator.t.cpp                                       -*-C++-*-
+
+#include <bslma_managedallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_localarena.h>
+#include <bslma_multipoolallocator.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_sequentialallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_protocoltest.h>
+
+#include <new>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a protocol class, which we verify using
+// 'bsls::ProtocolTest', and a utility 'struct' whose functions determine
+// whether an allocator is a managed allocator.  We verify the utility
+// functions for the addresses of managed and unmanaged allocators, for the
+// null address, and for STL-style allocators that do, and that do not, wrap
+// a 'bslma::Allocator'.
+//-----------------------------------------------------------------------------
+// class ManagedAllocator
+// [ 1] virtual ~ManagedAllocator();
+// [ 1] virtual void release() = 0;
+//
+// struct ManagedAllocatorUtil
+// [ 2] bool isManaged(const Allocator *allocator);
+// [ 2] bool hasManagedMechanism(const ALLOCATOR& allocator);
+//-----------------------------------------------------------------------------
+// [ 3] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL CLASSES/TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+struct ManagedAllocatorTestImp
+                           : bsls::ProtocolTestImp<bslma::ManagedAllocator> {
+    void *allocate(size_type) { return markDone(); }
+    void deallocate(void *)   { markDone(); }
+    void release()            { markDone(); }
+};
+
+template <class TYPE>
+class WrappingAllocator {
+    // This class template provides a minimal STL-style allocator that, like
+    // 'bsl::allocator', is implicitly convertible from 'bslma::Allocator *'
+    // and wraps the address of a 'bslma::Allocator'.
+
+    // DATA
+    bslma::Allocator *d_mechanism_p;  // wrapped allocator (held, not owned)
+
+  public:
+    // TYPES
+    typedef TYPE value_type;
+
+    // CREATORS
+    WrappingAllocator(bslma::Allocator *mechanism)                  // IMPLICIT
+    : d_mechanism_p(mechanism)
+    {
+    }
+
+    // ACCESSORS
+    bslma::Allocator *mechanism() const
+    {
+        return d_mechanism_p;
+    }
+};
+
+template <class TYPE>
+class PlainAllocator {
+    // This class template provides a minimal STL-style allocator that is not
+    // convertible from 'bslma::Allocator *'.  Note that, although it has a
+    // 'mechanism' method, that method is never called by the component under
+    // test.
+
+  public:
+    // TYPES
+    typedef TYPE value_type;
+
+    // ACCESSORS
+    bslma::Allocator *mechanism() const
+    {
+        return 0;
+    }
+};
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Container That Winks Out
+///- - - - - - - - - - - - - - - - - - -
+// Suppose that we have a simple singly-linked list of integers, each node of
+// which is allocated individually from a supplied allocator.
+//
+// First, we define the list, whose destructor returns each node to the
+// allocator unless the allocator is a managed allocator, in which case the
+// nodes are left for the allocator to reclaim:
+//..
+    class IntList {
+        // This class implements a singly-linked list of 'int' values.
+
+        // PRIVATE TYPES
+        struct Node {
+            Node *d_next_p;
+            int   d_value;
+        };
+
+        // DATA
+        Node             *d_head_p;       // first node, or 0 if empty
+        bslma::Allocator *d_allocator_p;  // allocator (held, not owned)
+
+        // NOT IMPLEMENTED
+        IntList(const IntList&);
+        IntList& operator=(const IntList&);
+
+      public:
+        // CREATORS
+        explicit IntList(bslma::Allocator *basicAllocator)
+        : d_head_p(0)
+        , d_allocator_p(basicAllocator)
+        {
+        }
+
+        ~IntList()
+        {
+            if (bslma::ManagedAllocatorUtil::isManaged(d_allocator_p)) {
+                return;                                           // RETURN
+            }
+            while (d_head_p) {
+                Node *next = d_head_p->d_next_p;
+                d_allocator_p->deallocate(d_head_p);
+                d_head_p = next;
+            }
+        }
+
+        // MANIPULATORS
+        void pushFront(int value)
+        {
+            Node *node = static_cast<Node *>(
+                                      d_allocator_p->allocate(sizeof(Node)));
+            node->d_next_p  = d_head_p;
+            node->d_value   = value;
+            d_head_p        = node;
+        }
+    };
+//..
+// Then, we define a managed allocator that obtains its memory from the
+// global heap, tracking the blocks it dispenses so that 'release' can
+// reclaim them (a realistic managed allocator, such as
+// 'bslma::SequentialAllocator', would carve its blocks from larger chunks):
+//..
+    class TrackingAllocator : public bslma::ManagedAllocator {
+        // This class implements a managed allocator that records the blocks
+        // it dispenses in a list threaded through their headers.
+
+        // PRIVATE TYPES
+        union Header {
+            Header                               *d_next_p;
+            bsls::AlignmentUtil::MaxAlignedType   d_alignment;
+        };
+
+        // DATA
+        Header *d_blocks_p;         // list of dispensed blocks
+        int     d_numDeallocations; // number of calls to 'deallocate'
+
+      public:
+        // CREATORS
+        TrackingAllocator() : d_blocks_p(0), d_numDeallocations(0) {}
+
+        virtual ~TrackingAllocator() { release(); }
+
+        // MANIPULATORS
+        virtual void *allocate(size_type size)
+        {
+            Header *header = static_cast<Header *>(
+                                     ::operator new(sizeof(Header) + size));
+            header->d_next_p = d_blocks_p;
+            d_blocks_p       = header;
+            return header + 1;
+        }
+
+        virtual void deallocate(void *)
+        {
+            ++d_numDeallocations;
+        }
+
+        virtual void release()
+        {
+            while (d_blocks_p) {
+                Header *next = d_blocks_p->d_next_p;
+                ::operator delete(d_blocks_p);
+                d_blocks_p = next;
+            }
+        }
+
+        // ACCESSORS
+        int numDeallocations() const { return d_numDeallocations; }
+    };
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Next, we build a list using a 'TrackingAllocator':
+//..
+    TrackingAllocator managed;
+    {
+        IntList list(&managed);
+        for (int i = 0; i < 1000; ++i) {
+            list.pushFront(i);
+        }
+    }
+//..
+// Then, we observe that the destructor of the list did not visit its nodes
+// to deallocate them:
+//..
+    ASSERT(0 == managed.numDeallocations());
+//..
+// Finally, we observe that a list built with an allocator that is not a
+// managed allocator, such as a 'bslma::TestAllocator', returns its nodes:
+//..
+    bslma::TestAllocator ta;
+    ASSERT(false == bslma::ManagedAllocatorUtil::isManaged(&ta));
+    {
+        IntList list(&ta);
+        for (int i = 0; i < 1000; ++i) {
+            list.pushFront(i);
+        }
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+//..
+// The memory of the first list is reclaimed when 'managed' is released or
+// destroyed.
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'ManagedAllocatorUtil'
+        //
+        // Concerns:
+        //: 1 'isManaged' returns 'true' for the address of any object derived
+        //:   from 'bslma::ManagedAllocator', whether the object's most
+        //:   derived type derives from it directly or indirectly.
+        //:
+        //: 2 'isManaged' returns 'false' for the address of an allocator that
+        //:   is not a managed allocator, even one having a 'release' method
+        //:   (e.g., 'bslma::MultipoolAllocator'), and for 0.
+        //:
+        //: 3 'hasManagedMechanism' returns the result of 'isManaged' for the
+        //:   wrapped allocator of an STL-style allocator convertible from
+        //:   'bslma::Allocator *', regardless of its 'value_type'.
+        //:
+        //: 4 'hasManagedMechanism' returns 'false' for an STL-style allocator
+        //:   not convertible from 'bslma::Allocator *', without calling its
+        //:   'mechanism' method.
+        //:
+        //: 5 Neither function allocates memory.
+        //
+        // Plan:
+        //: 1 Call 'isManaged' with the addresses of a sequential allocator, a
+        //:   local arena, a multipool allocator, a test allocator, and the
+        //:   new-delete allocator, each held as a 'bslma::Allocator *', and
+        //:   with 0.  (C-1..2)
+        //:
+        //: 2 Call 'hasManagedMechanism' with 'WrappingAllocator' objects of
+        //:   two value types wrapping each allocator in P-1, and with a
+        //:   'PlainAllocator'.  (C-3..4)
+        //:
+        //: 3 Install a test allocator as the default and global allocator,
+        //:   and verify that it is unused.  (C-5)
+        //
+        // Testing:
+        //   bool isManaged(const Allocator *allocator);
+        //   bool hasManagedMechanism(const ALLOCATOR& allocator);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'ManagedAllocatorUtil'"
+                            "\n======================\n");
+
+        typedef bslma::ManagedAllocatorUtil Util;
+
+        bslma::TestAllocator       ta("object", veryVeryVerbose);
+        bslma::SequentialAllocator sa(&ta);
+        bslma::LocalArena<64>      la(&ta);
+        bslma::MultipoolAllocator  ma(&ta);
+        bslma::TestAllocator       xa("unmanaged", veryVeryVerbose);
+
+        const int NUM_BLOCKS = ta.numBlocksTotal();
+
+        const struct {
+            int               d_line;
+            bslma::Allocator *d_allocator_p;
+            bool              d_isManaged;
+        } DATA[] = {
+            //LINE  ALLOCATOR                                   MANAGED
+            //----  ------------------------------------------  -------
+            { L_,   &sa,                                        true    },
+            { L_,   &la,                                        true    },
+            { L_,   &ma,                                        false   },
+            { L_,   &xa,                                        false   },
+            { L_,   &bslma::NewDeleteAllocator::singleton(),    false   },
+            { L_,   0,                                          false   },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) printf("\tTesting 'isManaged'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int               LINE    = DATA[ti].d_line;
+            const bslma::Allocator *ALLOC   = DATA[ti].d_allocator_p;
+            const bool              MANAGED = DATA[ti].d_isManaged;
+
+            LOOP_ASSERT(LINE, MANAGED == Util::isManaged(ALLOC));
+        }
+
+        if (verbose) printf("\tTesting 'hasManagedMechanism'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            bslma::Allocator *ALLOC   = DATA[ti].d_allocator_p;
+            const bool        MANAGED = DATA[ti].d_isManaged;
+
+            const WrappingAllocator<int>    X(ALLOC);
+            const WrappingAllocator<double> Y(ALLOC);
+
+            LOOP_ASSERT(LINE, MANAGED == Util::hasManagedMechanism(X));
+            LOOP_ASSERT(LINE, MANAGED == Util::hasManagedMechanism(Y));
+        }
+
+        const PlainAllocator<int> Z = PlainAllocator<int>();
+        ASSERT(false == Util::hasManagedMechanism(Z));
+
+        ASSERT(NUM_BLOCKS == ta.numBlocksTotal());
+        ASSERT(0          == xa.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // PROTOCOL TEST
+        //   Ensure this class is a properly defined protocol.
+        //
+        // Concerns:
+        //: 1 The protocol has no data members.
+        //:
+        //: 2 The protocol has a virtual destructor.
+        //:
+        //: 3 All methods of the protocol are virtual.
+        //:
+        //: 4 All methods of the protocol are publicly accessible.
+        //
+        // Plan:
+        //: 1 Define a concrete derived implementation,
+        //:   'ManagedAllocatorTestImp', of the protocol.
+        //:
+        //: 2 Create an object of the 'bsls::ProtocolTest' class template
+        //:   parameterized by 'ManagedAllocatorTestImp', and use it to verify
+        //:   that:
+        //:
+        //:   1 The protocol has no data members. (C-1)
+        //:
+        //:   2 The protocol has a virtual destructor. (C-2)
+        //:
+        //: 3 Use the 'BSLS_PROTOCOLTEST_ASSERT' macro to verify that
+        //:   non-creator methods of the protocol are:
+        //:
+        //:   1 virtual, (C-3)
+        //:
+        //:   2 publicly accessible. (C-4)
+        //
+        // Testing:
+        //   virtual ~ManagedAllocator();
+        //   virtual void release() = 0;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPROTOCOL TEST"
+                            "\n=============\n");
+
+        if (verbose) printf("\nCreate a test object.\n");
+
+        bsls::ProtocolTest<ManagedAllocatorTestImp> testObj(veryVerbose);
+
+        if (verbose) printf("\nVerify that there are no data members.\n");
+
+        ASSERT(testObj.testNoDataMembers());
+
+        if (verbose) printf("\nVerify that the destructor is virtual.\n");
+
+        ASSERT(testObj.testVirtualDestructor());
+
+        if (verbose) printf("\nVerify that methods are public and virtual.\n");
+
+        BSLS_PROTOCOLTEST_ASSERT(testObj, allocate(0));
+        BSLS_PROTOCOLTEST_ASSERT(testObj, deallocate(0));
+        BSLS_PROTOCOLTEST_ASSERT(testObj, release());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
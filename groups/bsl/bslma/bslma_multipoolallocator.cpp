@@ -0,0 +1,204 @@
+// bslma_multipoolallocator.cpp                                       -*-C++-*-
+#include <bslma_multipoolallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <cstddef>  // 'offsetof'
+
+namespace BloombergLP {
+
+namespace bslma {
+
+namespace {
+
+enum { k_MAX_BLOCKS_PER_CHUNK = 32 };  // limit of the geometric growth of the
+                                       // chunks of a pool (as for
+                                       // 'bslstl::SimplePool')
+
+}  // close unnamed namespace
+
+                        // ------------------------
+                        // class MultipoolAllocator
+                        // ------------------------
+
+// PRIVATE MANIPULATORS
+void *MultipoolAllocator::allocateFromNewChunk(int poolIndex)
+{
+    BSLS_ASSERT(0 <= poolIndex);
+    BSLS_ASSERT(poolIndex < d_numPools);
+
+    Pool& pool = d_pools_p[poolIndex];
+
+    // Each block consists of a header followed by the memory of its size
+    // class, rounded up so that consecutive blocks are maximally aligned.
+
+    const size_type blockSize = bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                               sizeof(BlockHeader)
+                             + (static_cast<size_type>(k_MIN_BLOCK_SIZE)
+                                                                << poolIndex));
+    const int       numBlocks = pool.d_blocksPerChunk;
+
+    Chunk *chunk = static_cast<Chunk *>(
+               d_allocator_p->allocate(sizeof(Chunk) + numBlocks * blockSize));
+    chunk->d_next_p    = pool.d_chunkList_p;
+    pool.d_chunkList_p = chunk;
+
+    if (numBlocks < k_MAX_BLOCKS_PER_CHUNK) {
+        pool.d_blocksPerChunk = 2 * numBlocks;
+    }
+
+    // Stamp each block with the index of this pool, and thread all but the
+    // first block onto the (empty) free list of this pool.
+
+    char *first = reinterpret_cast<char *>(chunk + 1);
+    char *last  = first + (numBlocks - 1) * blockSize;
+
+    Link *freeList = 0;
+    for (char *block = last; block != first; block -= blockSize) {
+        BlockHeader *header = reinterpret_cast<BlockHeader *>(block);
+        header->d_poolIndex = poolIndex;
+
+        Link *link     = reinterpret_cast<Link *>(header + 1);
+        link->d_next_p = freeList;
+        freeList       = link;
+    }
+    pool.d_freeList_p = freeList;
+
+    BlockHeader *header = reinterpret_cast<BlockHeader *>(first);
+    header->d_poolIndex = poolIndex;
+    return header + 1;
+}
+
+void *MultipoolAllocator::allocateLarge(size_type size)
+{
+    LargeBlock *block = static_cast<LargeBlock *>(
+                         d_allocator_p->allocate(sizeof(LargeBlock) + size));
+
+    block->d_header.d_poolIndex = -1;
+    block->d_next_p             = d_largeBlockList_p;
+    block->d_addrPrev_p         = &d_largeBlockList_p;
+    if (d_largeBlockList_p) {
+        d_largeBlockList_p->d_addrPrev_p = &block->d_next_p;
+    }
+    d_largeBlockList_p = block;
+
+    return &block->d_header + 1;
+}
+
+void MultipoolAllocator::deallocateLarge(BlockHeader *header)
+{
+    BSLS_ASSERT(-1 == header->d_poolIndex);
+
+    LargeBlock *block = reinterpret_cast<LargeBlock *>(
+                                  reinterpret_cast<char *>(header)
+                                - offsetof(LargeBlock, d_header));
+
+    *block->d_addrPrev_p = block->d_next_p;
+    if (block->d_next_p) {
+        block->d_next_p->d_addrPrev_p = block->d_addrPrev_p;
+    }
+
+    d_allocator_p->deallocate(block);
+}
+
+void MultipoolAllocator::init(int numPools)
+{
+    BSLS_ASSERT(1 <= numPools);
+    BSLS_ASSERT(numPools <= k_MAX_NUM_POOLS);
+
+    d_pools_p = static_cast<Pool *>(
+                             d_allocator_p->allocate(numPools * sizeof(Pool)));
+
+    for (int i = 0; i < numPools; ++i) {
+        d_pools_p[i].d_freeList_p     = 0;
+        d_pools_p[i].d_chunkList_p    = 0;
+        d_pools_p[i].d_blocksPerChunk = 1;
+    }
+}
+
+// CREATORS
+MultipoolAllocator::MultipoolAllocator(Allocator *basicAllocator)
+: d_pools_p(0)
+, d_numPools(k_DEFAULT_NUM_POOLS)
+, d_maxPooledBlockSize(static_cast<size_type>(k_MIN_BLOCK_SIZE)
+                                                  << (k_DEFAULT_NUM_POOLS - 1))
+, d_largeBlockList_p(0)
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+    init(d_numPools);
+}
+
+MultipoolAllocator::MultipoolAllocator(int        numPools,
+                                       Allocator *basicAllocator)
+: d_pools_p(0)
+, d_numPools(numPools)
+, d_maxPooledBlockSize(static_cast<size_type>(k_MIN_BLOCK_SIZE)
+                                                             << (numPools - 1))
+, d_largeBlockList_p(0)
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numPools);
+    BSLS_ASSERT(numPools <= k_MAX_NUM_POOLS);
+
+    init(d_numPools);
+}
+
+MultipoolAllocator::~MultipoolAllocator()
+{
+    release();
+    d_allocator_p->deallocate(d_pools_p);
+}
+
+// MANIPULATORS
+void MultipoolAllocator::release()
+{
+    for (int i = 0; i < d_numPools; ++i) {
+        Pool&  pool  = d_pools_p[i];
+        Chunk *chunk = pool.d_chunkList_p;
+        while (chunk) {
+            Chunk *next = chunk->d_next_p;
+            d_allocator_p->deallocate(chunk);
+            chunk = next;
+        }
+        pool.d_freeList_p     = 0;
+        pool.d_chunkList_p    = 0;
+        pool.d_blocksPerChunk = 1;
+    }
+
+    LargeBlock *block = d_largeBlockList_p;
+    while (block) {
+        LargeBlock *next = block->d_next_p;
+        d_allocator_p->deallocate(block);
+        block = next;
+    }
+    d_largeBlockList_p = 0;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,498 @@
+// bslma_multipoolallocator.h                                         -*-C++-*-
+#ifndef INCLUDED_BSLMA_MULTIPOOLALLOCATOR
+#define INCLUDED_BSLMA_MULTIPOOLALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator pooling blocks in power-of-two size classes.
+//
+//@CLASSES:
+//  bslma::MultipoolAllocator: allocator with a free-list pool per size class
+//
+//@SEE_ALSO: bslma_sequentialallocator, bslstl_simplepool
+//
+//@DESCRIPTION: This component provides a concrete allocator,
+// 'bslma::MultipoolAllocator', that implements the 'bslma::Allocator'
+// protocol by dispensing memory from a sequence of pools, one for each of a
+// number of power-of-two size classes:
+//..
+//   ,-------------------------.
+//  ( bslma::MultipoolAllocator )
+//   `-------------------------'
+//                |        ctor/dtor
+//                |        release
+//                |        numPools
+//                |        maxPooledBlockSize
+//                |        allocator
+//                V
+//        ,----------------.
+//       ( bslma::Allocator )
+//        `----------------'
+//                         allocate
+//                         deallocate
+//..
+// Each pool manages blocks of a single size in the manner of
+// 'bslstl::SimplePool': free blocks are kept on a singly-linked free list, so
+// that both 'allocate' and 'deallocate' take a few instructions in the common
+// case, and the free list is replenished with chunks of blocks, of
+// geometrically increasing size, obtained from the upstream allocator
+// supplied at construction.  Unlike 'bslstl::SimplePool', which serves the
+// nodes of a single container, a multipool allocator serves requests of any
+// size, so that, for example, several node-based containers with different
+// node types can share a single allocator and still obtain pool-speed
+// allocation.
+//
+///Size Classes
+///------------
+// The first pool serves requests of up to 'k_MIN_BLOCK_SIZE' (8) bytes, and
+// each subsequent pool serves blocks of twice the size of its predecessor, so
+// that a multipool allocator having the default 'k_DEFAULT_NUM_POOLS' (10)
+// pools serves requests of up to 4096 bytes from its pools.  A request is
+// served by the pool of the smallest size class that can hold it, and the
+// number of pools may be specified at construction.  Requests larger than
+// the largest size class, 'maxPooledBlockSize()', are forwarded to the
+// upstream allocator.
+//
+// Each block carries a small header recording the pool to which it belongs,
+// so that 'deallocate' returns the block to the correct pool without being
+// told its size.  When the size is supplied, as it is by 'deallocateSized'
+// (which 'bsl::allocator', and therefore every standard container, calls),
+// the pool is computed from the size instead, so that the header need not be
+// read.  All memory dispensed is maximally aligned.
+//
+///Reclaiming Memory
+///-----------------
+// Memory returned by 'deallocate' is retained by its pool for reuse, and
+// blocks larger than 'maxPooledBlockSize()' are returned to the upstream
+// allocator immediately.  'release' and the destructor return all of the
+// memory obtained from the upstream allocator, including that of any block
+// not yet deallocated.
+//
+// Note that 'bslma::MultipoolAllocator' is deliberately *not* a
+// 'bslma::ManagedAllocator' (see 'bslma_managedallocator'), although it has a
+// 'release' method.  Containers "wink out" when destroyed with a managed
+// allocator, skipping the deallocation of their memory.  A multipool is
+// typically long-lived and relies on its blocks being deallocated so that it
+// can reuse them, so containers that winked out would make it grow without
+// bound.
+//
+///Thread Safety
+///-------------
+// 'bslma::MultipoolAllocator' is *not* thread-safe: an allocator object may
+// not be accessed concurrently from multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing an Allocator Among Objects of Different Sizes
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a set of shapes described by objects of several
+// types, that are created and destroyed in no particular order.  A single
+// multipool allocator can supply the memory for objects of all of the types,
+// each being served by the pool of the appropriate size class.
+//
+// First, we define two simple shape types of different sizes:
+//..
+//  struct my_Point {
+//      double d_x;
+//      double d_y;
+//  };
+//
+//  struct my_Polygon {
+//      my_Point d_vertices[8];
+//      int      d_numVertices;
+//  };
+//..
+// Then, we create a multipool allocator that obtains its memory from a test
+// allocator:
+//..
+//  bslma::TestAllocator      ta;
+//  bslma::MultipoolAllocator multipool(&ta);
+//..
+// Next, we create several objects of each type, and destroy some of them:
+//..
+//  my_Point   *points[4];
+//  my_Polygon *polygons[4];
+//  for (int i = 0; i < 4; ++i) {
+//      points[i]   = new (multipool) my_Point();
+//      polygons[i] = new (multipool) my_Polygon();
+//  }
+//
+//  multipool.deleteObject(points[1]);
+//  multipool.deleteObject(polygons[2]);
+//..
+// Then, we observe that the memory of a destroyed object is reused by the
+// next object of the same size class, without involving the upstream
+// allocator:
+//..
+//  const bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+//
+//  my_Point *point = new (multipool) my_Point();
+//  assert(points[1] == point);
+//  assert(numBlocks == ta.numBlocksTotal());
+//..
+// Finally, we 'release' all of the memory at once, without destroying the
+// remaining objects individually (which is appropriate only because our
+// types have trivial destructors):
+//..
+//  multipool.release();
+//  assert(1 == ta.numBlocksInUse());  // the array of pools
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslma {
+
+                        // ========================
+                        // class MultipoolAllocator
+                        // ========================
+
+class MultipoolAllocator : public Allocator {
+    // This class provides a concrete allocator that dispenses memory from a
+    // sequence of pools, one for each power-of-two size class, and that
+    // forwards requests larger than the largest size class to an upstream
+    // allocator.
+
+    // PRIVATE TYPES
+    union BlockHeader {
+        // This 'union' precedes the memory of each block dispensed by this
+        // allocator, and records the pool from which the block was
+        // dispensed.
+
+        int                                 d_poolIndex;  // index of the
+                                                          // pool, or -1 for
+                                                          // a large block
+
+        bsls::AlignmentUtil::MaxAlignedType d_alignment;  // ensure the block
+                                                          // memory is
+                                                          // maximally aligned
+    };
+
+    struct Link {
+        // This 'struct' occupies the memory of each free block of a pool,
+        // implementing the free list of the pool.
+
+        Link *d_next_p;  // next free block
+    };
+
+    union Chunk {
+        // This 'union' prepends each chunk of blocks obtained from the
+        // upstream allocator, implementing the chunk list of a pool.
+
+        Chunk                               *d_next_p;     // next chunk
+
+        bsls::AlignmentUtil::MaxAlignedType  d_alignment;  // ensure each
+                                                           // block is aligned
+    };
+
+    struct LargeBlock {
+        // This 'struct' prepends each block larger than the largest size
+        // class, implementing a doubly-linked list of such blocks so that
+        // they can be reclaimed by 'release'.
+
+        LargeBlock  *d_next_p;      // next large block
+        LargeBlock **d_addrPrev_p;  // address of the link to this block
+        BlockHeader  d_header;      // header with a pool index of -1
+    };
+
+    struct Pool {
+        // This 'struct' describes the state of the pool of one size class.
+
+        Link  *d_freeList_p;      // free blocks of this pool
+        Chunk *d_chunkList_p;     // chunks obtained for this pool
+        int    d_blocksPerChunk;  // number of blocks in the next chunk
+    };
+
+    // DATA
+    Pool       *d_pools_p;             // array of 'd_numPools' pools
+
+    int         d_numPools;            // number of size classes
+
+    size_type   d_maxPooledBlockSize;  // size of the largest size class
+
+    LargeBlock *d_largeBlockList_p;    // blocks larger than the largest size
+                                       // class that are in use
+
+    Allocator  *d_allocator_p;         // upstream allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    MultipoolAllocator(const MultipoolAllocator&);
+    MultipoolAllocator& operator=(const MultipoolAllocator&);
+
+    // PRIVATE CLASS METHODS
+    static int poolIndex(size_type size);
+        // Return the index of the pool of the smallest size class that can
+        // hold a block of the specified 'size' (in bytes).  The behavior is
+        // undefined unless '0 < size'.
+
+    // PRIVATE MANIPULATORS
+    void *allocateFromNewChunk(int poolIndex);
+        // Replenish the free list of the pool at the specified 'poolIndex'
+        // with a chunk of blocks obtained from the upstream allocator, and
+        // return the address of the memory of one of the blocks.
+
+    void *allocateLarge(size_type size);
+        // Return the address of a maximally-aligned block of memory of the
+        // specified 'size' (in bytes) obtained from the upstream allocator.
+
+    void deallocateLarge(BlockHeader *header);
+        // Return the large block having the specified 'header' to the
+        // upstream allocator.
+
+    void init(int numPools);
+        // Obtain and initialize the array of the specified 'numPools' pools.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_MIN_BLOCK_SIZE    = 8,    // size of the smallest size class
+
+        k_DEFAULT_NUM_POOLS = 10,   // default number of size classes
+
+        k_MAX_NUM_POOLS     = 24    // maximum number of size classes
+    };
+
+    // CREATORS
+    explicit MultipoolAllocator(Allocator *basicAllocator = 0);
+    explicit MultipoolAllocator(int numPools, Allocator *basicAllocator = 0);
+        // Create a multipool allocator.  Optionally specify the 'numPools'
+        // number of power-of-two size classes, the smallest of which is
+        // 'k_MIN_BLOCK_SIZE'; if 'numPools' is not specified,
+        // 'k_DEFAULT_NUM_POOLS' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '1 <= numPools <= k_MAX_NUM_POOLS'.
+
+    virtual ~MultipoolAllocator();
+        // Destroy this allocator, returning all of the memory obtained from
+        // the upstream allocator, including that of blocks not yet
+        // deallocated, to the upstream allocator.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return the address of a contiguous block of maximally-aligned
+        // memory of at least the specified 'size' (in bytes).  If 'size' is
+        // 0, no memory is allocated and 0 is returned.  If 'size' exceeds
+        // 'maxPooledBlockSize()', the memory is obtained directly from the
+        // upstream allocator.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to the pool
+        // from which it was dispensed, or to the upstream allocator if it
+        // exceeds 'maxPooledBlockSize()'.  If 'address' is 0, this method has
+        // no effect.  The behavior is undefined unless 'address' was
+        // allocated by this allocator and has not already been deallocated.
+
+    virtual void deallocateSized(void *address, size_type size);
+        // Return the memory block at the specified 'address', having the
+        // specified 'size' (in bytes), to the pool of the size class of
+        // 'size', or to the upstream allocator if 'size' exceeds
+        // 'maxPooledBlockSize()'.  If 'address' is 0, this method has no
+        // effect.  The behavior is undefined unless 'address' was allocated
+        // by this allocator by a call to 'allocate' with 'size', and has not
+        // already been deallocated.
+
+    void release();
+        // Return all of the memory obtained from the upstream allocator for
+        // pooled and large blocks, including that of blocks not yet
+        // deallocated, to the upstream allocator.  The behavior is undefined
+        // if any memory dispensed by this allocator is used after this call.
+
+    // ACCESSORS
+    int numPools() const;
+        // Return the number of size classes of this allocator.
+
+    size_type maxPooledBlockSize() const;
+        // Return the size (in bytes) of the largest size class of this
+        // allocator.  Larger requests are forwarded to the upstream
+        // allocator.
+
+    Allocator *allocator() const;
+        // Return the address of the upstream allocator used by this
+        // allocator to supply memory.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ------------------------
+                        // class MultipoolAllocator
+                        // ------------------------
+
+// PRIVATE CLASS METHODS
+inline
+int MultipoolAllocator::poolIndex(size_type size)
+{
+    BSLS_ASSERT_SAFE(0 < size);
+
+    if (size <= k_MIN_BLOCK_SIZE) {
+        return 0;                                                     // RETURN
+    }
+
+    // The size class of 'size' is the bit width of 'size - 1', offset by the
+    // bit width of 'k_MIN_BLOCK_SIZE - 1' (i.e., 3).
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return static_cast<int>(sizeof(unsigned long long) * 8)
+         - __builtin_clzll(static_cast<unsigned long long>(size - 1))
+         - 3;
+#else
+    int       index     = 1;
+    size_type blockSize = 2 * k_MIN_BLOCK_SIZE;
+    while (blockSize < size) {
+        blockSize *= 2;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+// MANIPULATORS
+inline
+void *MultipoolAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size <= d_maxPooledBlockSize)) {
+        const int  index = poolIndex(size);
+        Pool&      pool  = d_pools_p[index];
+        Link      *block = pool.d_freeList_p;
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != block)) {
+            pool.d_freeList_p = block->d_next_p;
+            return block;                                             // RETURN
+        }
+        return allocateFromNewChunk(index);                           // RETURN
+    }
+
+    return allocateLarge(size);
+}
+
+inline
+void MultipoolAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    BlockHeader *header = static_cast<BlockHeader *>(address) - 1;
+    const int    index  = header->d_poolIndex;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 <= index)) {
+        BSLS_ASSERT_SAFE(index < d_numPools);
+
+        Pool& pool        = d_pools_p[index];
+        Link *block       = static_cast<Link *>(address);
+        block->d_next_p   = pool.d_freeList_p;
+        pool.d_freeList_p = block;
+        return;                                                       // RETURN
+    }
+
+    deallocateLarge(header);
+}
+
+inline
+void MultipoolAllocator::deallocateSized(void *address, size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size <= d_maxPooledBlockSize)) {
+        const int index = poolIndex(size);
+
+        BSLS_ASSERT_SAFE(index ==
+                    (static_cast<BlockHeader *>(address) - 1)->d_poolIndex);
+
+        Pool& pool        = d_pools_p[index];
+        Link *block       = static_cast<Link *>(address);
+        block->d_next_p   = pool.d_freeList_p;
+        pool.d_freeList_p = block;
+        return;                                                       // RETURN
+    }
+
+    deallocateLarge(static_cast<BlockHeader *>(address) - 1);
+}
+
+// ACCESSORS
+inline
+int MultipoolAllocator::numPools() const
+{
+    return d_numPools;
+}
+
+inline
+MultipoolAllocator::size_type MultipoolAllocator::maxPooledBlockSize() const
+{
+    return d_maxPooledBlockSize;
+}
+
+inline
+Allocator *MultipoolAllocator::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,796 @@
+// bslma_multipoolallocator.t.cpp                                     -*-C++-*-
+
+#include <bslma_multipoolallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a concrete implementation of the
+// 'bslma::Allocator' protocol that dispenses memory from a pool per
+// power-of-two size class, and forwards larger requests to an upstream
+// allocator.  We use a 'bslma::TestAllocator' as the upstream allocator to
+// observe the chunks and large blocks obtained, and verify that the memory
+// dispensed is distinct, maximally aligned, and reused by the pool of the
+// appropriate size class.  We then verify that 'release' and the destructor
+// return all of the memory to the upstream allocator.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit MultipoolAllocator(Allocator *basicAllocator = 0);
+// [ 2] explicit MultipoolAllocator(int numPools, Allocator * = 0);
+// [ 4] ~MultipoolAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 5] void deallocateSized(void *address, size_type size);
+// [ 4] void release();
+//
+// ACCESSORS
+// [ 2] int numPools() const;
+// [ 2] size_type maxPooledBlockSize() const;
+// [ 2] Allocator *allocator() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH 'NewDeleteAllocator'
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslma::MultipoolAllocator   Obj;
+typedef bslma::Allocator::size_type size_type;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == bsls::AlignmentUtil::calculateAlignmentOffset(
+                                   address,
+                                   bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+}
+
+static size_type sizeClass(size_type size)
+    // Return the size of the smallest size class that can hold a block of
+    // the specified 'size'.
+{
+    size_type result = Obj::k_MIN_BLOCK_SIZE;
+    while (result < size) {
+        result *= 2;
+    }
+    return result;
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Example 1: Sharing an Allocator Among Objects of Different Sizes
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a set of shapes described by objects of several
+// types, that are created and destroyed in no particular order.  A single
+// multipool allocator can supply the memory for objects of all of the types,
+// each being served by the pool of the appropriate size class.
+//
+// First, we define two simple shape types of different sizes:
+//..
+    struct my_Point {
+        double d_x;
+        double d_y;
+    };
+
+    struct my_Polygon {
+        my_Point d_vertices[8];
+        int      d_numVertices;
+    };
+//..
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create a multipool allocator that obtains its memory from a test
+// allocator:
+//..
+    bslma::TestAllocator      ta;
+    bslma::MultipoolAllocator multipool(&ta);
+//..
+// Next, we create several objects of each type, and destroy some of them:
+//..
+    my_Point   *points[4];
+    my_Polygon *polygons[4];
+    for (int i = 0; i < 4; ++i) {
+        points[i]   = new (multipool) my_Point();
+        polygons[i] = new (multipool) my_Polygon();
+    }
+
+    multipool.deleteObject(points[1]);
+    multipool.deleteObject(polygons[2]);
+//..
+// Then, we observe that the memory of a destroyed object is reused by the
+// next object of the same size class, without involving the upstream
+// allocator:
+//..
+    const bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+
+    my_Point *point = new (multipool) my_Point();
+    ASSERT(points[1] == point);
+    ASSERT(numBlocks == ta.numBlocksTotal());
+//..
+// Finally, we 'release' all of the memory at once, without destroying the
+// remaining objects individually (which is appropriate only because our
+// types have trivial destructors):
+//..
+    multipool.release();
+    ASSERT(1 == ta.numBlocksInUse());  // the array of pools
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // SIZED DEALLOCATION
+        //
+        // Concerns:
+        //: 1 'deallocateSized' returns a pooled block to the pool of its size
+        //:   class, from which it is reused by the next allocation of that
+        //:   size class.
+        //:
+        //: 2 'deallocateSized' returns a large block to the upstream
+        //:   allocator.
+        //:
+        //: 3 Blocks may be deallocated by either 'deallocate' or
+        //:   'deallocateSized', regardless of which was used for them before.
+        //:
+        //: 4 'deallocateSized(0, size)' has no effect.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each size up to twice 'maxPooledBlockSize()', allocate a
+        //:   block, deallocate it by 'deallocateSized', and verify that the
+        //:   next allocation of the largest size of its size class returns
+        //:   it if it is pooled, or that it is returned to the upstream
+        //:   allocator otherwise.  Deallocate the reallocated block by
+        //:   'deallocate'.  (C-1..3)
+        //:
+        //: 2 Call 'deallocateSized(0, size)'.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a size of a different size class (using the
+        //:   'BSLS_ASSERTTEST_*' macros).  (C-5)
+        //
+        // Testing:
+        //   void deallocateSized(void *address, size_type size);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSIZED DEALLOCATION"
+                            "\n==================\n");
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        if (verbose) printf("\tPooled and large blocks.\n");
+        {
+            Obj mX(4, &ta);
+
+            const size_type MAX_SIZE = mX.maxPooledBlockSize();
+
+            for (size_type size = 1; size <= 2 * MAX_SIZE; ++size) {
+                const bsls::Types::Int64 NUM_IN_USE = ta.numBlocksInUse();
+
+                void *p = mX.allocate(size);
+                memset(p, 0x5a, size);
+                mX.deallocateSized(p, size);
+
+                if (size <= MAX_SIZE) {
+                    LOOP_ASSERT(size, p == mX.allocate(sizeClass(size)));
+                    mX.deallocate(p);
+                }
+                else {
+                    LOOP_ASSERT(size, NUM_IN_USE == ta.numBlocksInUse());
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tZero.\n");
+        {
+            Obj mX(&ta);
+
+            const bsls::Types::Int64 NUM_DEALLOCATIONS =
+                                                        ta.numDeallocations();
+
+            mX.deallocateSized(0, 0);
+            mX.deallocateSized(0, 8);
+            ASSERT(NUM_DEALLOCATIONS == ta.numDeallocations());
+        }
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(&ta);
+
+            void *p = mX.allocate(24);
+
+            ASSERT_SAFE_FAIL(mX.deallocateSized(p, 16));
+            ASSERT_SAFE_FAIL(mX.deallocateSized(p, 33));
+            ASSERT_SAFE_PASS(mX.deallocateSized(p, 17));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RELEASE AND DESTRUCTOR
+        //
+        // Concerns:
+        //: 1 'release' returns all of the chunks and large blocks to the
+        //:   upstream allocator, including those of blocks not deallocated.
+        //:
+        //: 2 The allocator is usable after 'release', and the chunk sizes of
+        //:   its pools start over.
+        //:
+        //: 3 The destructor returns all of the memory obtained from the
+        //:   upstream allocator.
+        //
+        // Plan:
+        //: 1 Allocate blocks of many sizes, pooled and large, deallocating
+        //:   some of them, then 'release', and verify that only the array of
+        //:   pools remains in use.  (C-1)
+        //:
+        //: 2 Allocate again, and verify that a single-block chunk is obtained
+        //:   for the first allocation of a size class.  (C-2)
+        //:
+        //: 3 Destroy the allocator with blocks outstanding, and verify that
+        //:   no memory remains in use.  (C-3)
+        //
+        // Testing:
+        //   void release();
+        //   ~MultipoolAllocator();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRELEASE AND DESTRUCTOR"
+                            "\n======================\n");
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        for (int numPools = 1; numPools <= 12; ++numPools) {
+            if (veryVerbose) { T_ P(numPools) }
+
+            Obj *objPtr = new (ta) Obj(numPools, &ta);
+            Obj&  mX    = *objPtr;
+
+            const bsls::Types::Int64 NUM_IN_USE = ta.numBlocksInUse();
+            const size_type          MAX_SIZE   = mX.maxPooledBlockSize();
+
+            for (int round = 0; round < 2; ++round) {
+                void *blocks[64];
+                for (int i = 0; i < 64; ++i) {
+                    const size_type SIZE = (i * 37) % (2 * MAX_SIZE) + 1;
+                    blocks[i] = mX.allocate(SIZE);
+                    memset(blocks[i], 0xa5, SIZE);
+                }
+                for (int i = 0; i < 64; i += 3) {
+                    mX.deallocate(blocks[i]);
+                }
+                LOOP_ASSERT(numPools, NUM_IN_USE < ta.numBlocksInUse());
+
+                mX.release();
+                LOOP_ASSERT(numPools, NUM_IN_USE == ta.numBlocksInUse());
+
+                // The first allocation of a size class obtains a chunk
+                // holding a single block.
+
+                mX.allocate(1);
+                LOOP_ASSERT(numPools, NUM_IN_USE + 1 == ta.numBlocksInUse());
+                const bsls::Types::Int64 NUM_BYTES = ta.numBytesInUse();
+                mX.allocate(1);
+                LOOP_ASSERT(numPools, NUM_IN_USE + 2 == ta.numBlocksInUse());
+                LOOP_ASSERT(numPools, NUM_BYTES < ta.numBytesInUse());
+            }
+
+            ta.deleteObject(objPtr);
+            LOOP_ASSERT(numPools, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE AND DEALLOCATE
+        //
+        // Concerns:
+        //: 1 'allocate' returns distinct, maximally-aligned, writable blocks
+        //:   of at least the requested size.
+        //:
+        //: 2 A deallocated block is reused by the next allocation of the same
+        //:   size class, and by no other size class.
+        //:
+        //: 3 Once a pool has memory available, allocating from it and
+        //:   deallocating to it does not use the upstream allocator.
+        //:
+        //: 4 The chunks of a pool double in size up to a limit.
+        //:
+        //: 5 Requests larger than 'maxPooledBlockSize()' are forwarded to the
+        //:   upstream allocator, and returned to it on 'deallocate'.
+        //:
+        //: 6 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //
+        // Plan:
+        //: 1 For each size up to twice 'maxPooledBlockSize()', allocate two
+        //:   blocks, fill them, and verify their alignment and distinctness.
+        //:   Deallocate the first, and verify that allocating the largest
+        //:   and smallest sizes of its size class return it in turn, whereas
+        //:   allocating from the adjacent size classes does not.  (C-1..2)
+        //:
+        //: 2 Repeatedly allocate and deallocate blocks of a size class with
+        //:   available memory, and verify that the upstream allocator is not
+        //:   used.  (C-3)
+        //:
+        //: 3 Allocate many blocks of one size class, and verify the number of
+        //:   chunks obtained.  (C-4)
+        //:
+        //: 4 Allocate and deallocate large blocks, and verify the use of the
+        //:   upstream allocator.  (C-5)
+        //:
+        //: 5 Call 'allocate(0)' and 'deallocate(0)'.  (C-6)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nALLOCATE AND DEALLOCATE"
+                            "\n=======================\n");
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        if (verbose) printf("\tSize classes.\n");
+        {
+            Obj mX(&ta);
+
+            const size_type MAX_SIZE = mX.maxPooledBlockSize();
+
+            for (size_type size = 1; size <= MAX_SIZE; ++size) {
+                const size_type CLASS = sizeClass(size);
+
+                char *p = static_cast<char *>(mX.allocate(size));
+                char *q = static_cast<char *>(mX.allocate(size));
+                LOOP_ASSERT(size, isMaximallyAligned(p));
+                LOOP_ASSERT(size, isMaximallyAligned(q));
+                LOOP_ASSERT(size, p + CLASS <= q || q + CLASS <= p);
+                memset(p, 0x5a, CLASS);
+                memset(q, 0xa5, CLASS);
+
+                mX.deallocate(p);
+                if (CLASS < MAX_SIZE) {
+                    void *r = mX.allocate(CLASS + 1);
+                    LOOP_ASSERT(size, p != r);
+                    mX.deallocate(r);
+                }
+                if (Obj::k_MIN_BLOCK_SIZE < CLASS) {
+                    void *r = mX.allocate(CLASS / 2);
+                    LOOP_ASSERT(size, p != r);
+                    mX.deallocate(r);
+                }
+                LOOP_ASSERT(size, p == mX.allocate(CLASS));
+                mX.deallocate(p);
+                LOOP_ASSERT(size, p == mX.allocate(CLASS / 2 + 1));
+
+                mX.deallocate(p);
+                mX.deallocate(q);
+            }
+
+            // Each size class has memory available.
+
+            const bsls::Types::Int64 NUM_TOTAL = ta.numBlocksTotal();
+            for (int i = 0; i < 1000; ++i) {
+                const size_type SIZE = (i * 97) % MAX_SIZE + 1;
+                void *p = mX.allocate(SIZE);
+                mX.deallocate(mX.allocate(SIZE));
+                mX.deallocate(p);
+            }
+            ASSERT(NUM_TOTAL == ta.numBlocksTotal());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tChunk growth.\n");
+        {
+            Obj mX(&ta);
+
+            // Chunks hold 1, 2, 4, 8, 16, and then 32 blocks.
+
+            const bsls::Types::Int64 NUM_IN_USE = ta.numBlocksInUse();
+            const int                EXP[]      = { 1, 2, 4, 8, 16, 32, 32 };
+            const int                NUM_EXP    = sizeof EXP / sizeof *EXP;
+
+            for (int ci = 0; ci < NUM_EXP; ++ci) {
+                for (int bi = 0; bi < EXP[ci]; ++bi) {
+                    mX.allocate(24);
+                    LOOP2_ASSERT(ci, bi,
+                                 NUM_IN_USE + ci + 1 == ta.numBlocksInUse());
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tLarge blocks.\n");
+        {
+            Obj mX(4, &ta);
+
+            const size_type MAX_SIZE = mX.maxPooledBlockSize();
+            ASSERT(64 == MAX_SIZE);
+
+            const bsls::Types::Int64 NUM_IN_USE = ta.numBlocksInUse();
+
+            void *blocks[4];
+            for (int i = 0; i < 4; ++i) {
+                const size_type SIZE = MAX_SIZE + 1 + i * 1000;
+                blocks[i] = mX.allocate(SIZE);
+                LOOP_ASSERT(i, isMaximallyAligned(blocks[i]));
+                LOOP_ASSERT(i, SIZE < ta.lastAllocatedNumBytes());
+                LOOP_ASSERT(i, NUM_IN_USE + i + 1 == ta.numBlocksInUse());
+                memset(blocks[i], 0x5a, SIZE);
+            }
+
+            // Deallocate in an order that exercises unlinking from the front,
+            // middle, and back of the list of large blocks.
+
+            const int ORDER[] = { 2, 3, 0, 1 };
+            for (int i = 0; i < 4; ++i) {
+                mX.deallocate(blocks[ORDER[i]]);
+                LOOP_ASSERT(i, NUM_IN_USE + 3 - i == ta.numBlocksInUse());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tZero.\n");
+        {
+            Obj mX(&ta);
+
+            const bsls::Types::Int64 NUM_TOTAL = ta.numBlocksTotal();
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+            ASSERT(NUM_TOTAL == ta.numBlocksTotal());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The number of pools is 'k_DEFAULT_NUM_POOLS' unless specified,
+        //:   and the largest size class is 'k_MIN_BLOCK_SIZE' doubled once
+        //:   for each pool after the first.
+        //:
+        //: 2 The upstream allocator is the one supplied, or the default
+        //:   allocator if none is supplied.
+        //:
+        //: 3 Construction obtains only the array of pools from the upstream
+        //:   allocator.
+        //:
+        //: 4 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects with each constructor and every valid number of
+        //:   pools, with and without an allocator, installing a test
+        //:   allocator as the default, and verify the accessors and the use
+        //:   of memory.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an invalid number of pools.  (C-4)
+        //
+        // Testing:
+        //   explicit MultipoolAllocator(Allocator *basicAllocator = 0);
+        //   explicit MultipoolAllocator(int numPools, Allocator * = 0);
+        //   int numPools() const;
+        //   size_type maxPooledBlockSize() const;
+        //   Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS AND ACCESSORS"
+                            "\n======================\n");
+
+        bslma::TestAllocator da("default",  veryVeryVerbose);
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_NUM_POOLS == X.numPools());
+            ASSERT(4096                     == X.maxPooledBlockSize());
+            ASSERT(&da                      == X.allocator());
+            ASSERT(1                        == da.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_NUM_POOLS == X.numPools());
+            ASSERT(&ta                      == X.allocator());
+            ASSERT(1                        == ta.numBlocksInUse());
+            ASSERT(1                        == da.numBlocksTotal());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        for (int numPools = 1; numPools <= Obj::k_MAX_NUM_POOLS; ++numPools) {
+            const size_type MIN_SIZE = Obj::k_MIN_BLOCK_SIZE;
+            const size_type EXP_MAX  = MIN_SIZE << (numPools - 1);
+
+            if (veryVerbose) { T_ P_(numPools) P(EXP_MAX) }
+
+            {
+                Obj mX(numPools);  const Obj& X = mX;
+                LOOP_ASSERT(numPools, numPools == X.numPools());
+                LOOP_ASSERT(numPools, EXP_MAX  == X.maxPooledBlockSize());
+                LOOP_ASSERT(numPools, &da      == X.allocator());
+            }
+            {
+                Obj mX(numPools, &ta);  const Obj& X = mX;
+                LOOP_ASSERT(numPools, numPools == X.numPools());
+                LOOP_ASSERT(numPools, EXP_MAX  == X.maxPooledBlockSize());
+                LOOP_ASSERT(numPools, &ta      == X.allocator());
+                LOOP_ASSERT(numPools, 1        == ta.numBlocksInUse());
+            }
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_PASS(Obj(1, &ta));
+            ASSERT_FAIL(Obj(0, &ta));
+            ASSERT_PASS(Obj(Obj::k_MAX_NUM_POOLS, &ta));
+            ASSERT_FAIL(Obj(Obj::k_MAX_NUM_POOLS + 1, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks of pooled and large sizes, and
+        //:   verify that memory is reused and returned.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+        {
+            Obj mX(&ta);
+
+            void *p = mX.allocate(10);
+            void *q = mX.allocate(100);
+            void *r = mX.allocate(10000);
+            ASSERT(p != q);
+            ASSERT(q != r);
+
+            mX.deallocate(p);
+            ASSERT(p == mX.allocate(12));
+
+            const bsls::Types::Int64 NUM_IN_USE = ta.numBlocksInUse();
+            mX.deallocate(r);
+            ASSERT(NUM_IN_USE - 1 == ta.numBlocksInUse());
+
+            mX.deallocate(q);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'NewDeleteAllocator'
+        //
+        // Concerns:
+        //: 1 Allocating and deallocating blocks of mixed sizes with a
+        //:   multipool allocator is substantially faster than with
+        //:   'bslma::NewDeleteAllocator'.
+        //
+        // Plan:
+        //: 1 Time the allocation and deallocation of many small blocks of
+        //:   mixed sizes, in an interleaved order, with each allocator, and
+        //:   report the allocation rates.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'NewDeleteAllocator'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                  "\nPERFORMANCE: COMPARISON WITH 'NewDeleteAllocator'"
+                  "\n=================================================\n");
+
+        enum { NUM_ALLOCS = 1000, NUM_ROUNDS = 1000 };
+
+        static void *blocks[NUM_ALLOCS];
+
+        bslma::NewDeleteAllocator& nda =
+                                       bslma::NewDeleteAllocator::singleton();
+        Obj                        mX;
+
+        bslma::Allocator *const ALLOCATORS[] = { &nda, &mX };
+        const char       *const NAMES[]      = { "NewDeleteAllocator:",
+                                                 "MultipoolAllocator:" };
+        double                  times[2];
+
+        for (int ai = 0; ai < 2; ++ai) {
+            bslma::Allocator *allocator = ALLOCATORS[ai];
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int r = 0; r < NUM_ROUNDS; ++r) {
+                for (int i = 0; i < NUM_ALLOCS; ++i) {
+                    blocks[i] = allocator->allocate(i % 128 + 1);
+                }
+
+                // Deallocate the odd blocks, reallocate them, and then
+                // deallocate all of the blocks, so that the order of
+                // deallocation differs from that of allocation.
+
+                for (int i = 1; i < NUM_ALLOCS; i += 2) {
+                    allocator->deallocate(blocks[i]);
+                }
+                for (int i = 1; i < NUM_ALLOCS; i += 2) {
+                    blocks[i] = allocator->allocate(i % 128 + 1);
+                }
+                for (int i = 0; i < NUM_ALLOCS; ++i) {
+                    allocator->deallocate(blocks[i]);
+                }
+            }
+            timer.stop();
+            times[ai] = timer.elapsedTime();
+        }
+
+        const double NUM_TOTAL = 1.5 * NUM_ALLOCS * NUM_ROUNDS;
+
+        for (int ai = 0; ai < 2; ++ai) {
+            printf("%-20s %g allocations/s\n",
+                   NAMES[ai],
+                   NUM_TOTAL / times[ai]);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
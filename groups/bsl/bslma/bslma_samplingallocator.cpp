@@ -0,0 +1,533 @@
+// bslma_samplingallocator.cpp                                        -*-C++-*-
+#include <bslma_samplingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <cmath>    // 'log'
+#include <cstring>  // 'memcmp', 'memcpy', 'memset'
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+#include <windows.h>
+#define U_CAPTURE_STACK 1
+#elif defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_DARWIN)
+#include <execinfo.h>  // 'backtrace'
+#include <sched.h>     // 'sched_yield'
+#define U_CAPTURE_STACK 1
+#else
+#include <sched.h>     // 'sched_yield'
+#endif
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define U_THREAD_LOCAL __declspec(thread)
+#else
+#define U_THREAD_LOCAL __thread
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+struct ThreadState {
+    // This 'struct' holds the state of the sampling of the allocations made
+    // by one thread.
+
+    const void          *d_owner_p;           // sampling allocator whose
+                                              // allocations are counted down,
+                                              // or 0 if none
+
+    bsls::Types::Int64   d_samplingInterval;  // sampling interval of the
+                                              // owner
+
+    bsls::Types::Int64   d_bytesUntilSample;  // countdown of the bytes to
+                                              // allocate before the next
+                                              // sample
+
+    bsls::Types::Uint64  d_randomState;       // state of the generator of
+                                              // sampling intervals, or 0 if
+                                              // not yet seeded
+};
+
+// The sampling state of each thread.  Note that a namespace-scope aggregate
+// with a constant initializer may be held in (compiler-supported)
+// thread-local storage on all supported platforms.
+
+static U_THREAD_LOCAL ThreadState s_threadState = { 0, 0, 0, 0 };
+
+bsls::Types::Int64 nextInterval(ThreadState *state)
+    // Return a number of bytes, drawn from an exponential distribution whose
+    // mean is the sampling interval held in the specified 'state', to
+    // allocate before the next sample, and advance the generator of 'state'.
+{
+    if (1 == state->d_samplingInterval) {
+        return 1;                                                     // RETURN
+    }
+
+    // Advance a 64-bit "xorshift*" generator, and map the top 53 bits of its
+    // output to a uniform variate in '(0, 1]', whose negated logarithm is
+    // exponentially distributed with a mean of 1.  The generator of each
+    // thread is seeded from the address of the state of that thread, so that
+    // the threads do not sample in lockstep.
+
+    bsls::Types::Uint64 x = state->d_randomState;
+    if (0 == x) {
+        x = (reinterpret_cast<bsls::Types::UintPtr>(state)
+                                                     * 0x9E3779B97F4A7C15ULL)
+          | 1;
+    }
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    state->d_randomState = x;
+
+    const bsls::Types::Uint64 random = x * 2685821657736338717ULL;
+
+    const double uniform = static_cast<double>((random >> 11) + 1)
+                         * (1.0 / 9007199254740992.0);  // 2^-53
+
+    return 1 + static_cast<bsls::Types::Int64>(
+                    -std::log(uniform) * (state->d_samplingInterval - 1));
+}
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+__attribute__((noinline))
+#elif defined(BSLS_PLATFORM_CMP_MSVC)
+__declspec(noinline)
+#endif
+int captureStack(void **frames, int maxNumFrames)
+    // Load into the specified 'frames' up to the specified 'maxNumFrames'
+    // return addresses of the call stack of the caller of the function that
+    // calls this function, and return the number of addresses loaded.  Note
+    // that this function is never inlined, so that exactly two frames (its
+    // own and that of its caller) are skipped.
+{
+    enum { k_NUM_SKIPPED = 2 };
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+    return CaptureStackBackTrace(k_NUM_SKIPPED, maxNumFrames, frames, 0);
+#elif defined(U_CAPTURE_STACK)
+    void *buffer[bslma::SamplingAllocator::k_MAX_NUM_FRAMES + k_NUM_SKIPPED];
+    const int numFrames = backtrace(buffer, maxNumFrames + k_NUM_SKIPPED);
+    if (numFrames <= k_NUM_SKIPPED) {
+        return 0;                                                     // RETURN
+    }
+    std::memcpy(frames,
+                buffer + k_NUM_SKIPPED,
+                (numFrames - k_NUM_SKIPPED) * sizeof(void *));
+    return numFrames - k_NUM_SKIPPED;
+#else
+    (void)frames;
+    (void)maxNumFrames;
+    return 0;
+#endif
+}
+
+void yieldProcessor()
+    // Offer to give up the processor to another thread.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    Sleep(0);
+#else
+    sched_yield();
+#endif
+}
+
+unsigned int hashFrames(void *const *frames, int numFrames)
+    // Return a hash of the specified 'numFrames' return addresses at the
+    // specified 'frames'.
+{
+    bsls::Types::Uint64 hash = 14695981039346656037ULL;  // FNV-1a basis
+    for (int i = 0; i < numFrames; ++i) {
+        hash ^= reinterpret_cast<bsls::Types::UintPtr>(frames[i]);
+        hash *= 1099511628211ULL;                         // FNV-1a prime
+    }
+    return static_cast<unsigned int>(hash ^ (hash >> 32));
+}
+
+}  // close unnamed namespace
+
+namespace bslma {
+
+                        // -----------------------
+                        // class SamplingAllocator
+                        // -----------------------
+
+// PRIVATE MANIPULATORS
+void SamplingAllocator::recordSample(BlockHeader  *header,
+                                     void        **frames,
+                                     int           numFrames)
+{
+    BSLS_ASSERT(header);
+    BSLS_ASSERT(0 <= numFrames);
+    BSLS_ASSERT(numFrames <= k_MAX_NUM_FRAMES);
+
+    const unsigned int hash = hashFrames(frames, numFrames);
+    const bsls::Types::Int64 size =
+                        static_cast<bsls::Types::Int64>(header->d_info.d_size);
+
+    lock();
+
+    StackRecord *record = findStackRecord(hash, frames, numFrames);
+    StackRecord *spare  = 0;
+
+    if (!record) {
+        // Allocate the record of the new call stack without holding the lock,
+        // so that an exception thrown by the upstream allocator does not
+        // leave the lock held, then search again, as another thread may have
+        // recorded the same call stack in the meantime.
+
+        unlock();
+        spare = static_cast<StackRecord *>(
+                                 d_allocator_p->allocate(sizeof(StackRecord)));
+        lock();
+
+        record = findStackRecord(hash, frames, numFrames);
+    }
+
+    if (!record) {
+        record = spare;
+        spare  = 0;
+
+        StackRecord **bucket = d_buckets_p + (hash & (k_NUM_BUCKETS - 1));
+
+        record->d_next_p        = *bucket;
+        record->d_hash          = hash;
+        record->d_numFrames     = numFrames;
+        std::memcpy(record->d_frames, frames, numFrames * sizeof(void *));
+        record->d_numLive       = 0;
+        record->d_numLiveBytes  = 0;
+        record->d_numTotal      = 0;
+        record->d_numTotalBytes = 0;
+        *bucket = record;
+        ++d_numStacks;
+    }
+
+    ++record->d_numLive;
+    record->d_numLiveBytes  += size;
+    ++record->d_numTotal;
+    record->d_numTotalBytes += size;
+
+    ++d_numSamples;
+    ++d_numLiveSamples;
+
+    header->d_info.d_stack_p = record;
+
+    unlock();
+
+    if (spare) {
+        d_allocator_p->deallocateSized(spare, sizeof(StackRecord));
+    }
+}
+
+// PRIVATE ACCESSORS
+SamplingAllocator::StackRecord *
+SamplingAllocator::findStackRecord(unsigned int  hash,
+                                   void *const  *frames,
+                                   int           numFrames) const
+{
+    StackRecord *record = d_buckets_p[hash & (k_NUM_BUCKETS - 1)];
+    while (record
+        && (record->d_hash != hash
+         || record->d_numFrames != numFrames
+         || 0 != std::memcmp(record->d_frames,
+                             frames,
+                             numFrames * sizeof(void *)))) {
+        record = record->d_next_p;
+    }
+    return record;
+}
+
+void SamplingAllocator::lock() const
+{
+    while (0 != d_lock.testAndSwapAcqRel(0, 1)) {
+        while (0 != d_lock.loadRelaxed()) {
+            yieldProcessor();
+        }
+    }
+}
+
+void SamplingAllocator::unlock() const
+{
+    d_lock.storeRelease(0);
+}
+
+// CREATORS
+SamplingAllocator::SamplingAllocator(Allocator *basicAllocator)
+: d_samplingInterval(512 * 1024)
+, d_buckets_p(0)
+, d_numStacks(0)
+, d_numSamples(0)
+, d_numLiveSamples(0)
+, d_lock(0)
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+    d_buckets_p = static_cast<StackRecord **>(
+                  d_allocator_p->allocate(k_NUM_BUCKETS * sizeof(void *)));
+    std::memset(d_buckets_p, 0, k_NUM_BUCKETS * sizeof(void *));
+}
+
+SamplingAllocator::SamplingAllocator(bsls::Types::Int64  samplingInterval,
+                                     Allocator          *basicAllocator)
+: d_samplingInterval(samplingInterval)
+, d_buckets_p(0)
+, d_numStacks(0)
+, d_numSamples(0)
+, d_numLiveSamples(0)
+, d_lock(0)
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= samplingInterval);
+
+    d_buckets_p = static_cast<StackRecord **>(
+                  d_allocator_p->allocate(k_NUM_BUCKETS * sizeof(void *)));
+    std::memset(d_buckets_p, 0, k_NUM_BUCKETS * sizeof(void *));
+}
+
+SamplingAllocator::~SamplingAllocator()
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        StackRecord *record = d_buckets_p[i];
+        while (record) {
+            StackRecord *next = record->d_next_p;
+            d_allocator_p->deallocateSized(record, sizeof(StackRecord));
+            record = next;
+        }
+    }
+    d_allocator_p->deallocateSized(d_buckets_p,
+                                   k_NUM_BUCKETS * sizeof(void *));
+}
+
+// MANIPULATORS
+void *SamplingAllocator::allocate(size_type size)
+{
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    BlockHeader *blockHeader = static_cast<BlockHeader *>(
+                          d_allocator_p->allocate(sizeof(BlockHeader) + size));
+    blockHeader->d_info.d_stack_p = 0;
+    blockHeader->d_info.d_size    = size;
+
+    // Count the bytes down to the next sample in the state of the calling
+    // thread, restarting the countdown if the thread last allocated from
+    // another sampling allocator (or from this one, under another sampling
+    // interval); as the distance between samples is memoryless, restarting
+    // the countdown does not bias the sampling.
+
+    ThreadState *state = &s_threadState;
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                           state->d_owner_p          != this
+                        || state->d_samplingInterval != d_samplingInterval)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        state->d_owner_p          = this;
+        state->d_samplingInterval = d_samplingInterval;
+        state->d_bytesUntilSample = nextInterval(state);
+    }
+
+    state->d_bytesUntilSample -= static_cast<bsls::Types::Int64>(size);
+    const bool sample = state->d_bytesUntilSample <= 0;
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(sample)) {
+        state->d_bytesUntilSample = nextInterval(state);
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(sample)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        void      *frames[k_MAX_NUM_FRAMES];
+        const int  numFrames = captureStack(frames, k_MAX_NUM_FRAMES);
+
+        DeallocatorProctor<Allocator> proctor(blockHeader, d_allocator_p);
+        recordSample(blockHeader, frames, numFrames);
+        proctor.release();
+    }
+
+    return blockHeader + 1;
+}
+
+void SamplingAllocator::deallocate(void *address)
+{
+    if (!address) {
+        return;                                                       // RETURN
+    }
+
+    BlockHeader     *blockHeader = header(address);
+    StackRecord     *record      = blockHeader->d_info.d_stack_p;
+    const size_type  size        = blockHeader->d_info.d_size;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != record)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        lock();
+        --record->d_numLive;
+        record->d_numLiveBytes -= static_cast<bsls::Types::Int64>(size);
+        --d_numLiveSamples;
+        unlock();
+    }
+
+    d_allocator_p->deallocateSized(blockHeader, sizeof(BlockHeader) + size);
+}
+
+// ACCESSORS
+int SamplingAllocator::writeProfile(std::FILE *file) const
+{
+    BSLS_ASSERT(file);
+
+    // Copy the records under the lock, so that sampled allocations are not
+    // held up while the profile is written.  The copy is allocated without
+    // holding the lock, so that an exception thrown by the upstream allocator
+    // does not leave the lock held, and is reallocated if call stacks were
+    // recorded in the meantime.
+
+    StackRecord *records     = 0;
+    size_type    recordsSize = 0;
+    int          numRecords;
+    while (true) {
+        lock();
+        numRecords = d_numStacks;
+        if (numRecords * sizeof(StackRecord) <= recordsSize) {
+            break;
+        }
+        unlock();
+
+        if (records) {
+            d_allocator_p->deallocateSized(records, recordsSize);
+            records = 0;
+        }
+        recordsSize = numRecords * sizeof(StackRecord);
+        records     = static_cast<StackRecord *>(
+                                        d_allocator_p->allocate(recordsSize));
+    }
+
+    StackRecord *copy = records;
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        for (const StackRecord *record = d_buckets_p[i];
+             record;
+             record = record->d_next_p) {
+            *copy++ = *record;
+        }
+    }
+
+    unlock();
+
+    bsls::Types::Int64 numLive       = 0;
+    bsls::Types::Int64 numLiveBytes  = 0;
+    bsls::Types::Int64 numTotal      = 0;
+    bsls::Types::Int64 numTotalBytes = 0;
+    for (int i = 0; i < numRecords; ++i) {
+        numLive       += records[i].d_numLive;
+        numLiveBytes  += records[i].d_numLiveBytes;
+        numTotal      += records[i].d_numTotal;
+        numTotalBytes += records[i].d_numTotalBytes;
+    }
+
+    int rc = std::fprintf(file,
+                          "heap profile: %lld: %lld [%lld: %lld]"
+                          " @ heap_v2/%lld\n",
+                          numLive,
+                          numLiveBytes,
+                          numTotal,
+                          numTotalBytes,
+                          d_samplingInterval) < 0;
+
+    for (int i = 0; !rc && i < numRecords; ++i) {
+        const StackRecord& record = records[i];
+
+        rc = std::fprintf(file,
+                          "%lld: %lld [%lld: %lld] @",
+                          record.d_numLive,
+                          record.d_numLiveBytes,
+                          record.d_numTotal,
+                          record.d_numTotalBytes) < 0;
+
+        for (int j = 0; !rc && j < record.d_numFrames; ++j) {
+            rc = std::fprintf(file,
+                              " 0x%llx",
+                              static_cast<unsigned long long>(
+                                  reinterpret_cast<bsls::Types::UintPtr>(
+                                                   record.d_frames[j]))) < 0;
+        }
+
+        rc = rc || std::fputc('\n', file) == EOF;
+    }
+
+    d_allocator_p->deallocateSized(records, recordsSize);
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+    // Append the memory map of the process, from which 'pprof' locates the
+    // objects containing the return addresses.
+
+    std::FILE *maps = rc ? 0 : std::fopen("/proc/self/maps", "r");
+    if (maps) {
+        rc = std::fputs("\nMAPPED_LIBRARIES:\n", file) == EOF;
+
+        char        buffer[4096];
+        std::size_t length;
+        while (!rc && 0 < (length = std::fread(buffer, 1, sizeof buffer,
+                                                                    maps))) {
+            rc = std::fwrite(buffer, 1, length, file) != length;
+        }
+        std::fclose(maps);
+    }
+#endif
+
+    return rc || std::fflush(file) != 0 ? -1 : 0;
+}
+
+bsls::Types::Int64 SamplingAllocator::numSamples() const
+{
+    lock();
+    const bsls::Types::Int64 result = d_numSamples;
+    unlock();
+    return result;
+}
+
+bsls::Types::Int64 SamplingAllocator::numLiveSamples() const
+{
+    lock();
+    const bsls::Types::Int64 result = d_numLiveSamples;
+    unlock();
+    return result;
+}
+
+int SamplingAllocator::numStacks() const
+{
+    lock();
+    const int result = d_numStacks;
+    unlock();
+    return result;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,429 @@
+// bslma_samplingallocator.h                                          -*-C++-*-
+#ifndef INCLUDED_BSLMA_SAMPLINGALLOCATOR
+#define INCLUDED_BSLMA_SAMPLINGALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator that samples allocations to profile the heap.
+//
+//@CLASSES:
+//  bslma::SamplingAllocator: allocator profiling sampled bytes per call stack
+//
+//@SEE_ALSO: bslma_countingallocator, bslma_default
+//
+//@DESCRIPTION: This component provides a fully thread-safe allocator,
+// 'bslma::SamplingAllocator', that forwards every request to an upstream
+// allocator, samples the allocations, on average, once every
+// 'samplingInterval' bytes, captures the call stack of each sampled
+// allocation, and aggregates, per distinct call stack, the number of sampled
+// allocations and bytes that are still in use (*live*) and that were ever
+// allocated (*cumulative*).  The aggregated profile may be written at any
+// time, in the text format of heap profiles understood by 'pprof':
+//..
+//   ,-------------------------.
+//  ( bslma::SamplingAllocator )
+//   `-------------------------'
+//                  |        ctor/dtor
+//                  |        writeProfile
+//                  |        numSamples
+//                  |        numLiveSamples
+//                  |        numStacks
+//                  |        samplingInterval
+//                  |        allocator
+//                  V
+//          ,----------------.
+//         ( bslma::Allocator )
+//          `----------------'
+//                           allocate
+//                           deallocate
+//..
+// Unlike 'bslma::TestAllocator', which records every allocation, a
+// 'bslma::SamplingAllocator' does almost nothing for an allocation that is
+// not sampled: it subtracts the size of the allocation from a per-thread
+// countdown of the bytes remaining until the next sample, and stores the size
+// in a maximally-aligned header preceding the block, so that a whole process
+// can be profiled in production by installing a sampling allocator as the
+// default allocator (see {'bslma_default'}).
+//
+///Poisson Sampling
+///----------------
+// The distance, in bytes, between consecutive samples is drawn from an
+// exponential distribution whose mean is 'samplingInterval', so that the
+// sampled bytes form a Poisson process over the sequence of all of the bytes
+// allocated: an allocation of 'size' bytes is sampled with probability
+// '1 - exp(-size / samplingInterval)', independently of the sizes of the
+// allocations that preceded it.  Large allocations are therefore (almost)
+// always sampled, and small ones rarely.  An unbiased estimate of the number
+// of bytes allocated at a call stack is obtained by dividing each sampled
+// allocation by its probability of being sampled; 'pprof' performs this
+// scaling itself, using the sampling interval recorded in the profile.  Note
+// that, as a special case, a 'samplingInterval' of 1 samples every
+// allocation.
+//
+// The countdown of the bytes to the next sample, and the generator of the
+// distances between samples, are kept in thread-local storage, so that an
+// allocation that is not sampled touches no state shared with other threads,
+// and only the (rare) sampled allocations take the lock of the allocator.
+// Each thread counts down the allocations of one sampling allocator at a
+// time: when a thread allocates from a sampling allocator other than the one
+// it last allocated from, its countdown is restarted with a fresh distance.
+// As the exponential distribution is memoryless, restarting the countdown
+// does not bias the sampling.
+//
+///Call Stacks
+///-----------
+// Up to 'k_MAX_NUM_FRAMES' return addresses of the call stack of each sampled
+// allocation are captured, starting at the caller of 'allocate'.  Call stacks
+// are captured using 'backtrace' on Linux and Darwin, and using
+// 'CaptureStackBackTrace' on Windows; on other platforms, all of the samples
+// are attributed to a single, empty, call stack.  The aggregated statistics
+// of each distinct call stack are kept in a table whose memory is obtained
+// from the upstream allocator, and are updated under a lock that is taken
+// only for sampled allocations, and for deallocations of sampled blocks.
+//
+///Profile Format
+///--------------
+// 'writeProfile' writes the aggregated statistics in the (legacy) text format
+// of heap profiles produced by 'gperftools', which is understood by 'pprof':
+//..
+//  heap profile: 3: 4096 [ 5: 8192] @ heap_v2/524288
+//  2: 2048 [ 3: 4096] @ 0x4006d1 0x400812 0x7f33e2a1c0b3
+//  1: 2048 [ 2: 4096] @ 0x4006f4 0x400812 0x7f33e2a1c0b3
+//..
+// Each line after the first gives, for one call stack, the number of live
+// sampled allocations and bytes, followed, in brackets, by the number of
+// cumulative sampled allocations and bytes, and the return addresses of the
+// call stack; the first line gives the totals, and the sampling interval.  On
+// Linux, the profile is followed by the memory map of the process, so that
+// 'pprof' can symbolize the addresses.
+//
+///Thread Safety
+///-------------
+// 'bslma::SamplingAllocator' is *fully thread-safe*, provided that the
+// upstream allocator is fully thread-safe: 'allocate', 'deallocate', and all
+// of the accessors may be called concurrently from multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding the Call Stacks that Allocate Memory
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to find which code paths of a program allocate the
+// most memory, without slowing the program down substantially.
+//
+// First, we create a sampling allocator that samples, on average, once every
+// 64 kilobytes allocated, and install it as the default allocator, so that
+// every allocation of the program not supplied with an allocator is
+// profiled:
+//..
+//  bslma::SamplingAllocator     samplingAllocator(64 * 1024);
+//  bslma::DefaultAllocatorGuard guard(&samplingAllocator);
+//..
+// Then, we run (a simulation of) the program, which allocates 2000 blocks of
+// 1 kilobyte, and keeps the last 100 of them:
+//..
+//  bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+//
+//  void *blocks[100] = { 0 };
+//  for (int i = 0; i < 2000; ++i) {
+//      allocator->deallocate(blocks[i % 100]);
+//      blocks[i % 100] = allocator->allocate(1024);
+//  }
+//..
+// Next, we observe that only a small fraction of the allocations have been
+// sampled, all at the same call stack (note that the exact number of samples
+// depends on the random intervals drawn):
+//..
+//  assert(2000 > samplingAllocator.numSamples());
+//  assert(2    > samplingAllocator.numStacks());
+//..
+// Now, we write the profile to a file.  (In practice, the file would be named,
+// e.g., 'heap.prof', and examined with 'pprof --text ./program heap.prof'.)
+//..
+//  FILE *file = tmpfile();
+//  assert(file);
+//
+//  int rc = samplingAllocator.writeProfile(file);
+//  assert(0 == rc);
+//
+//  fclose(file);
+//..
+// Finally, we return the remaining blocks, and observe that no sampled
+// allocation is still live:
+//..
+//  for (int i = 0; i < 100; ++i) {
+//      allocator->deallocate(blocks[i]);
+//  }
+//  assert(0 == samplingAllocator.numLiveSamples());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_CSTDIO
+#include <cstdio>
+#define INCLUDED_CSTDIO
+#endif
+
+namespace BloombergLP {
+
+namespace bslma {
+
+                        // =======================
+                        // class SamplingAllocator
+                        // =======================
+
+class SamplingAllocator : public Allocator {
+    // This class provides a fully thread-safe allocator that forwards every
+    // request to an upstream allocator, samples allocations at an average
+    // interval of bytes, and aggregates the sampled allocations per call
+    // stack.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_MAX_NUM_FRAMES = 32  // maximum number of return addresses captured
+                               // per call stack
+    };
+
+  private:
+    // PRIVATE TYPES
+    enum { k_NUM_BUCKETS = 1024 };  // number of buckets of the stack table
+
+    struct StackRecord {
+        // This 'struct' holds the aggregated statistics of the sampled
+        // allocations made at one call stack, and links the records of a
+        // bucket of the stack table.
+
+        StackRecord        *d_next_p;                    // next record of the
+                                                         // bucket
+
+        unsigned int        d_hash;                      // hash of the frames
+
+        int                 d_numFrames;                 // number of frames
+
+        void               *d_frames[k_MAX_NUM_FRAMES];  // return addresses
+
+        bsls::Types::Int64  d_numLive;                   // live samples
+
+        bsls::Types::Int64  d_numLiveBytes;              // live sampled bytes
+
+        bsls::Types::Int64  d_numTotal;                  // cumulative samples
+
+        bsls::Types::Int64  d_numTotalBytes;             // cumulative sampled
+                                                         // bytes
+    };
+
+    struct BlockInfo {
+        // This 'struct' describes the information held in the header of
+        // each block.
+
+        StackRecord *d_stack_p;  // call stack of the allocation, or 0 if not
+                                 // sampled
+
+        size_type    d_size;     // size of the block
+    };
+
+    union BlockHeader {
+        // This 'union' precedes the memory of each block dispensed by this
+        // allocator.
+
+        BlockInfo                           d_info;       // block information
+
+        bsls::AlignmentUtil::MaxAlignedType d_alignment;  // ensure the block
+                                                          // memory is
+                                                          // maximally aligned
+    };
+
+    // DATA
+    bsls::Types::Int64     d_samplingInterval;  // mean number of bytes
+                                                // between samples
+
+    StackRecord          **d_buckets_p;         // buckets of the stack table
+
+    int                    d_numStacks;         // number of records in the
+                                                // stack table
+
+    bsls::Types::Int64     d_numSamples;        // cumulative samples
+
+    bsls::Types::Int64     d_numLiveSamples;    // live samples
+
+    mutable bsls::AtomicInt
+                           d_lock;              // spin lock guarding the
+                                                // stack table and the sample
+                                                // counts
+
+    Allocator             *d_allocator_p;       // upstream allocator (held,
+                                                // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    SamplingAllocator(const SamplingAllocator&);
+    SamplingAllocator& operator=(const SamplingAllocator&);
+
+    // PRIVATE CLASS METHODS
+    static BlockHeader *header(void *address);
+        // Return the address of the header of the block at the specified
+        // 'address'.
+
+    // PRIVATE MANIPULATORS
+    void recordSample(BlockHeader *header, void **frames, int numFrames);
+        // Attribute the block having the specified 'header' to the call stack
+        // having the specified 'numFrames' return addresses at the specified
+        // 'frames'.  If an exception is thrown, this allocator and the block
+        // are unchanged, and the lock of this allocator is not held.
+
+    // PRIVATE ACCESSORS
+    StackRecord *findStackRecord(unsigned int  hash,
+                                 void *const  *frames,
+                                 int           numFrames) const;
+        // Return the address of the record of the call stack having the
+        // specified 'hash' and the specified 'numFrames' return addresses at
+        // the specified 'frames', or 0 if that call stack is not recorded.
+        // The behavior is undefined unless the calling thread holds the lock
+        // of this allocator.
+
+    void lock() const;
+        // Acquire the lock of this allocator, waiting as necessary.
+
+    void unlock() const;
+        // Release the lock of this allocator.  The behavior is undefined
+        // unless the calling thread holds the lock.
+
+  public:
+    // CREATORS
+    explicit SamplingAllocator(Allocator *basicAllocator = 0);
+    explicit SamplingAllocator(bsls::Types::Int64  samplingInterval,
+                               Allocator          *basicAllocator = 0);
+        // Create a sampling allocator.  Optionally specify the
+        // 'samplingInterval' mean number of bytes allocated between samples;
+        // if 'samplingInterval' is not specified, 512 kilobytes is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '1 <= samplingInterval',
+        // and the upstream allocator is fully thread-safe.
+
+    virtual ~SamplingAllocator();
+        // Destroy this allocator.  The behavior is undefined unless all of
+        // the blocks allocated by this allocator have been deallocated.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return the address of a contiguous block of maximally-aligned
+        // memory of the specified 'size' (in bytes) obtained from the
+        // upstream allocator, sampling the allocation (see {Poisson
+        // Sampling}).  If 'size' is 0, no memory is allocated and 0 is
+        // returned.  This method is thread-safe.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to the upstream
+        // allocator, removing it from the live statistics of its call stack
+        // if it was sampled.  If 'address' is 0, this method has no effect.
+        // This method is thread-safe.  The behavior is undefined unless
+        // 'address' was allocated by this allocator, and has not already been
+        // deallocated.
+
+    // ACCESSORS
+    int writeProfile(std::FILE *file) const;
+        // Write the aggregated statistics of the sampled allocations to the
+        // specified 'file' in the text format of heap profiles (see {Profile
+        // Format}).  Return 0 on success, and a non-zero value if an error
+        // occurred while writing to 'file'.  This method is thread-safe.
+
+    bsls::Types::Int64 numSamples() const;
+        // Return the number of allocations sampled by this allocator.  This
+        // method is thread-safe.
+
+    bsls::Types::Int64 numLiveSamples() const;
+        // Return the number of sampled allocations that have not yet been
+        // deallocated.  This method is thread-safe.
+
+    int numStacks() const;
+        // Return the number of distinct call stacks at which sampled
+        // allocations have been made.  This method is thread-safe.
+
+    bsls::Types::Int64 samplingInterval() const;
+        // Return the mean number of bytes allocated between samples.
+
+    Allocator *allocator() const;
+        // Return the address of the upstream allocator used by this
+        // allocator to supply memory.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // -----------------------
+                        // class SamplingAllocator
+                        // -----------------------
+
+// PRIVATE CLASS METHODS
+inline
+SamplingAllocator::BlockHeader *SamplingAllocator::header(void *address)
+{
+    return static_cast<BlockHeader *>(address) - 1;
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 SamplingAllocator::samplingInterval() const
+{
+    return d_samplingInterval;
+}
+
+inline
+Allocator *SamplingAllocator::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
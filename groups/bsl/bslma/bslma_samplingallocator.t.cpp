@@ -0,0 +1,1337 @@
+// bslma_samplingallocator.t.cpp                                      -*-C++-*-
+
+#include <bslma_samplingallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// For thread support
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE thread_t;
+#else
+#include <pthread.h>
+typedef pthread_t thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a thread-safe allocator that forwards
+// every request to an upstream allocator, samples the allocations, captures
+// the call stacks of the sampled allocations, and writes the aggregated
+// statistics as a heap profile.  We first verify, using a sampling interval
+// of 1 (which samples every allocation), that the requests are forwarded with
+// the expected sizes, that samples are aggregated per call stack, and that
+// the profile written is well formed and consistent with the statistics.  We
+// then verify, with a larger interval, that the number of samples is
+// consistent with Poisson sampling, and that the usual estimate of the bytes
+// allocated from the samples is accurate.  Finally, we stress the allocator
+// from several threads.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit SamplingAllocator(Allocator *basicAllocator = 0);
+// [ 2] explicit SamplingAllocator(Int64 interval, Allocator *ba = 0);
+// [ 2] ~SamplingAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+//
+// ACCESSORS
+// [ 4] int writeProfile(std::FILE *file) const;
+// [ 3] bsls::Types::Int64 numSamples() const;
+// [ 3] bsls::Types::Int64 numLiveSamples() const;
+// [ 3] int numStacks() const;
+// [ 2] bsls::Types::Int64 samplingInterval() const;
+// [ 2] Allocator *allocator() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] POISSON SAMPLING
+// [ 6] CONCURRENCY STRESS TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: OVERHEAD OVER THE UPSTREAM ALLOCATOR
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslma::SamplingAllocator    Obj;
+typedef bslma::Allocator::size_type size_type;
+typedef bsls::Types::Int64          Int64;
+
+// The size of the header that precedes each block dispensed by the allocator
+// under test.
+
+static const size_type HEADER_SIZE = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+#if defined(BSLS_PLATFORM_OS_LINUX)   \
+ || defined(BSLS_PLATFORM_OS_DARWIN)  \
+ || defined(BSLS_PLATFORM_OS_WINDOWS)
+#define U_CAPTURES_STACKS 1
+#endif
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define U_NOINLINE __attribute__((noinline))
+#elif defined(BSLS_PLATFORM_CMP_MSVC)
+#define U_NOINLINE __declspec(noinline)
+#else
+#define U_NOINLINE
+#endif
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == bsls::AlignmentUtil::calculateAlignmentOffset(
+                                   address,
+                                   bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+}
+
+U_NOINLINE
+static void *allocateAtSiteA(bslma::Allocator *allocator, size_type size)
+    // Return a block of the specified 'size' allocated from the specified
+    // 'allocator'.  Note that this function is never inlined, and reads the
+    // result of 'allocate' through a 'volatile' variable so that 'allocate'
+    // is not a tail call, so that its frame is in the call stack of its
+    // allocations, which is distinct from that of 'allocateAtSiteB'.
+{
+    void *volatile result = allocator->allocate(size);
+    return result;
+}
+
+U_NOINLINE
+static void *allocateAtSiteB(bslma::Allocator *allocator, size_type size)
+    // Return a block of the specified 'size' allocated from the specified
+    // 'allocator'.  Note that this function is never inlined, and reads the
+    // result of 'allocate' through a 'volatile' variable so that 'allocate'
+    // is not a tail call, so that its frame is in the call stack of its
+    // allocations, which is distinct from that of 'allocateAtSiteA'.
+{
+    void *volatile result = allocator->allocate(size);
+    return result;
+}
+
+U_NOINLINE
+static void allocateBlocks(void             **blocks,
+                           int                numBlocks,
+                           bslma::Allocator  *allocator)
+    // Load into the specified 'blocks' the addresses of the specified
+    // 'numBlocks' blocks, of 10, 20, 30, ... bytes, allocated from the
+    // specified 'allocator' at a single call site.  Note that this function
+    // is never inlined, and that the number of iterations of its loop is
+    // read through a 'volatile' variable so that the loop is not unrolled,
+    // so that all of the allocations have the same call stack.
+{
+    const volatile int n = numBlocks;
+    for (int i = 0; i < n; ++i) {
+        blocks[i] = allocateAtSiteA(allocator, 10 + i * 10);
+    }
+}
+
+struct ProfileEntry {
+    // This 'struct' holds one parsed line of a heap profile.
+
+    Int64              d_numLive;        // live samples
+    Int64              d_numLiveBytes;   // live sampled bytes
+    Int64              d_numTotal;       // cumulative samples
+    Int64              d_numTotalBytes;  // cumulative sampled bytes
+    int                d_numFrames;      // number of addresses
+    bsls::Types::Uint64 d_firstFrame;    // first address, if any
+};
+
+static int parseProfile(ProfileEntry *header,
+                        ProfileEntry *entries,
+                        int           maxNumEntries,
+                        Int64        *interval,
+                        bool         *hasMaps,
+                        FILE         *file)
+    // Parse the heap profile in the specified 'file', loading its first line
+    // into the specified 'header', its sampling interval into the specified
+    // 'interval', up to the specified 'maxNumEntries' lines of call stacks
+    // into the specified 'entries', and whether it is followed by a memory
+    // map into the specified 'hasMaps', and return the number of lines of
+    // call stacks, or -1 if the profile is malformed.
+{
+    rewind(file);
+
+    char line[8192];
+    if (!fgets(line, sizeof line, file)
+     || 5 != sscanf(line,
+                    "heap profile: %lld: %lld [%lld: %lld] @ heap_v2/%lld",
+                    &header->d_numLive,
+                    &header->d_numLiveBytes,
+                    &header->d_numTotal,
+                    &header->d_numTotalBytes,
+                    interval)) {
+        return -1;                                                    // RETURN
+    }
+
+    int numEntries = 0;
+    *hasMaps = false;
+    while (fgets(line, sizeof line, file)) {
+        if (0 == strcmp(line, "\n")) {
+            continue;
+        }
+        if (0 == strcmp(line, "MAPPED_LIBRARIES:\n")) {
+            *hasMaps = true;
+            break;
+        }
+        if (numEntries == maxNumEntries) {
+            return -1;                                                // RETURN
+        }
+
+        ProfileEntry& entry = entries[numEntries++];
+        int           offset;
+        if (4 != sscanf(line,
+                        "%lld: %lld [%lld: %lld] @%n",
+                        &entry.d_numLive,
+                        &entry.d_numLiveBytes,
+                        &entry.d_numTotal,
+                        &entry.d_numTotalBytes,
+                        &offset)) {
+            return -1;                                                // RETURN
+        }
+
+        entry.d_numFrames  = 0;
+        entry.d_firstFrame = 0;
+
+        const char         *cursor = line + offset;
+        unsigned long long  address;
+        int                 length;
+        while (1 == sscanf(cursor, " 0x%llx%n", &address, &length)) {
+            if (0 == entry.d_numFrames) {
+                entry.d_firstFrame = address;
+            }
+            ++entry.d_numFrames;
+            cursor += length;
+        }
+        if (0 != strcmp(cursor, "\n")) {
+            return -1;                                                // RETURN
+        }
+    }
+    return numEntries;
+}
+
+typedef void *(*thread_func)(void *arg);
+
+static thread_t createThread(thread_func func, void *arg)
+    // Create a thread running the specified 'func' with the specified 'arg',
+    // and return its handle.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE) func, arg, 0, 0);
+#else
+    thread_t thr;
+    pthread_create(&thr, 0, func, arg);
+    return thr;
+#endif
+}
+
+static void joinThread(thread_t thr)
+    // Wait for the thread having the specified handle 'thr' to complete.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(thr, INFINITE);
+    CloseHandle(thr);
+#else
+    pthread_join(thr, 0);
+#endif
+}
+
+                        // =========================
+                        // class ThreadSafeAllocator
+                        // =========================
+
+class ThreadSafeAllocator : public bslma::Allocator {
+    // This class provides a thread-safe allocator that obtains memory from
+    // 'bslma::NewDeleteAllocator', and atomically counts the blocks in use.
+
+    // DATA
+    bsls::AtomicInt d_numBlocksInUse;  // number of blocks in use
+
+  public:
+    // MANIPULATORS
+    virtual void *allocate(size_type size)
+    {
+        void *result = bslma::NewDeleteAllocator::singleton().allocate(size);
+        if (result) {
+            ++d_numBlocksInUse;
+        }
+        return result;
+    }
+
+    virtual void deallocate(void *address)
+    {
+        if (address) {
+            --d_numBlocksInUse;
+        }
+        bslma::NewDeleteAllocator::singleton().deallocate(address);
+    }
+
+    // ACCESSORS
+    int numBlocksInUse() const
+    {
+        return d_numBlocksInUse;
+    }
+};
+
+                        // ==================
+                        // struct ThreadParam
+                        // ==================
+
+struct ThreadParam {
+    // This 'struct' holds the arguments of the test threads.
+
+    bslma::Allocator *d_allocator_p;   // allocator used by the thread
+    int               d_id;            // identifier of the thread
+    int               d_iterations;    // number of iterations
+};
+
+extern "C" void *allocatingThread(void *arg)
+    // Allocate and deallocate blocks of various sizes from the allocator
+    // specified by the 'ThreadParam' at the specified 'arg', keeping up to 16
+    // blocks in use at a time.
+{
+    ThreadParam&      param     = *static_cast<ThreadParam *>(arg);
+    bslma::Allocator& allocator = *param.d_allocator_p;
+
+    enum { k_NUM_SLOTS = 16 };
+
+    void *blocks[k_NUM_SLOTS] = { 0 };
+
+    for (int i = 0; i < param.d_iterations; ++i) {
+        const int       slot = (i * 7 + param.d_id) % k_NUM_SLOTS;
+        const size_type size = 1 + (i * 13 + param.d_id) % 200;
+
+        allocator.deallocate(blocks[slot]);
+        blocks[slot] = i & 1 ? allocateAtSiteA(&allocator, size)
+                             : allocateAtSiteB(&allocator, size);
+        memset(blocks[slot], param.d_id, size);
+    }
+    for (int slot = 0; slot < k_NUM_SLOTS; ++slot) {
+        allocator.deallocate(blocks[slot]);
+    }
+    return 0;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+///Example 1: Finding the Call Stacks that Allocate Memory
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to find which code paths of a program allocate the
+// most memory, without slowing the program down substantially.
+//
+// First, we create a sampling allocator that samples, on average, once every
+// 64 kilobytes allocated, and install it as the default allocator, so that
+// every allocation of the program not supplied with an allocator is
+// profiled:
+//..
+    bslma::SamplingAllocator     samplingAllocator(64 * 1024);
+    bslma::DefaultAllocatorGuard guard(&samplingAllocator);
+//..
+// Then, we run (a simulation of) the program, which allocates 2000 blocks of
+// 1 kilobyte, and keeps the last 100 of them:
+//..
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    void *blocks[100] = { 0 };
+    for (int i = 0; i < 2000; ++i) {
+        allocator->deallocate(blocks[i % 100]);
+        blocks[i % 100] = allocator->allocate(1024);
+    }
+//..
+// Next, we observe that only a small fraction of the allocations have been
+// sampled, all at the same call stack (note that the exact number of samples
+// depends on the random intervals drawn):
+//..
+    ASSERT(2000 > samplingAllocator.numSamples());
+    ASSERT(2    > samplingAllocator.numStacks());
+//..
+// Now, we write the profile to a file.  (In practice, the file would be named,
+// e.g., 'heap.prof', and examined with 'pprof --text ./program heap.prof'.)
+//..
+    FILE *file = tmpfile();
+    ASSERT(file);
+
+    int rc = samplingAllocator.writeProfile(file);
+    ASSERT(0 == rc);
+
+    fclose(file);
+//..
+// Finally, we return the remaining blocks, and observe that no sampled
+// allocation is still live:
+//..
+    for (int i = 0; i < 100; ++i) {
+        allocator->deallocate(blocks[i]);
+    }
+    ASSERT(0 == samplingAllocator.numLiveSamples());
+//..
+
+        if (veryVerbose) {
+            P(samplingAllocator.numSamples());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY STRESS TEST
+        //
+        // Concerns:
+        //: 1 Concurrent allocations and deallocations from several threads,
+        //:   some of which are sampled, are forwarded to the upstream
+        //:   allocator, and every block is returned to it.
+        //:
+        //: 2 The statistics of sampled allocations are consistent once the
+        //:   threads are joined; in particular, with a sampling interval of
+        //:   1, every allocation is sampled.
+        //:
+        //: 3 Profiles may be written while the allocator is in use.
+        //
+        // Plan:
+        //: 1 For sampling intervals of 1 and 1000 bytes, run several threads
+        //:   that allocate and deallocate blocks of various sizes at two call
+        //:   sites, while the main thread writes profiles, and verify the
+        //:   statistics once the threads are joined, using a thread-safe
+        //:   counting allocator as the upstream allocator.  (C-1..3)
+        //
+        // Testing:
+        //   CONCURRENCY STRESS TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENCY STRESS TEST"
+                            "\n=======================\n");
+
+        enum { NUM_THREADS = 8, NUM_ITERATIONS = 50000 };
+
+        const Int64 INTERVALS[] = { 1, 1000 };
+        const int   NUM_INTERVALS = sizeof INTERVALS / sizeof *INTERVALS;
+
+        for (int ti = 0; ti < NUM_INTERVALS; ++ti) {
+            const Int64 INTERVAL = INTERVALS[ti];
+
+            ThreadSafeAllocator ta;
+            {
+                Obj mX(INTERVAL, &ta);  const Obj& X = mX;
+
+                ThreadParam params[NUM_THREADS];
+                thread_t    threads[NUM_THREADS];
+
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    const ThreadParam PARAM = { &mX, i, NUM_ITERATIONS };
+                    params[i]  = PARAM;
+                    threads[i] = createThread(&allocatingThread, &params[i]);
+                }
+
+                for (int i = 0; i < 10; ++i) {
+                    FILE *file = tmpfile();
+                    LOOP_ASSERT(INTERVAL, file);
+                    LOOP_ASSERT(INTERVAL, 0 == X.writeProfile(file));
+                    fclose(file);
+                }
+
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    joinThread(threads[i]);
+                }
+
+                const Int64 NUM_ALLOCATIONS = Int64(NUM_THREADS)
+                                            * NUM_ITERATIONS;
+
+                if (veryVerbose) {
+                    T_ P_(INTERVAL) P_(X.numSamples()) P(X.numStacks())
+                }
+
+                LOOP_ASSERT(INTERVAL, 0 == X.numLiveSamples());
+                LOOP_ASSERT(INTERVAL, 0 <  X.numSamples());
+                LOOP_ASSERT(INTERVAL, NUM_ALLOCATIONS >= X.numSamples());
+                if (1 == INTERVAL) {
+                    LOOP_ASSERT(INTERVAL, NUM_ALLOCATIONS == X.numSamples());
+                }
+#ifdef U_CAPTURES_STACKS
+                LOOP_ASSERT(INTERVAL, 2 <= X.numStacks());
+#endif
+
+                // Only the bookkeeping of the allocator remains.
+
+                LOOP_ASSERT(INTERVAL,
+                            1 + X.numStacks() == ta.numBlocksInUse());
+            }
+            LOOP_ASSERT(INTERVAL, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // POISSON SAMPLING
+        //
+        // Concerns:
+        //: 1 The number of sampled allocations of a given size is consistent
+        //:   with each being sampled with probability
+        //:   '1 - exp(-size / samplingInterval)'.
+        //:
+        //: 2 Dividing the size of each sampled allocation by its probability
+        //:   of being sampled estimates the number of bytes allocated.
+        //:
+        //: 3 Allocations much larger than the sampling interval are always
+        //:   sampled.
+        //:
+        //: 4 Alternating the allocations of a thread between two sampling
+        //:   allocators, which restarts the (per-thread) countdown to the next
+        //:   sample at every allocation, does not bias the sampling of either
+        //:   allocator.
+        //
+        // Plan:
+        //: 1 For several allocation sizes, allocate many blocks with a
+        //:   sampling interval of 4096 bytes, and verify that the number of
+        //:   samples is within 10% of its expected value (more than 10
+        //:   standard deviations), and hence that the estimate of the bytes
+        //:   allocated is also within 10%.  (C-1..2)
+        //:
+        //: 2 Allocate blocks of 100 times the sampling interval, and verify
+        //:   that each is sampled.  (C-3)
+        //:
+        //: 3 Alternately allocate many blocks from two sampling allocators,
+        //:   and verify that the number of samples of each is within 10% of
+        //:   its expected value.  (C-4)
+        //
+        // Testing:
+        //   POISSON SAMPLING
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPOISSON SAMPLING"
+                            "\n================\n");
+
+        enum { INTERVAL = 4096 };
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        static const struct {
+            int       d_line;   // source line number
+            size_type d_size;   // size of each allocation
+            int       d_count;  // number of allocations
+        } DATA[] = {
+            //LINE  SIZE   COUNT
+            //----  -----  ------
+            { L_,      16, 400000 },
+            { L_,     100, 200000 },
+            { L_,    1000,  20000 },
+            { L_,    4096,  10000 },
+            { L_,   20000,   2000 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int       LINE  = DATA[ti].d_line;
+            const size_type SIZE  = DATA[ti].d_size;
+            const int       COUNT = DATA[ti].d_count;
+
+            Obj mX(INTERVAL, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < COUNT; ++i) {
+                mX.deallocate(mX.allocate(SIZE));
+            }
+
+            const double PROBABILITY = 1 - exp(-double(SIZE) / INTERVAL);
+            const double EXPECTED    = COUNT * PROBABILITY;
+            const double ACTUAL      = double(X.numSamples());
+            const double ESTIMATE    = ACTUAL * SIZE / PROBABILITY;
+            const double TOTAL       = double(COUNT) * SIZE;
+
+            if (veryVerbose) {
+                T_ P_(SIZE) P_(EXPECTED) P_(ACTUAL) P_(ESTIMATE) P(TOTAL)
+            }
+
+            LOOP3_ASSERT(LINE, EXPECTED, ACTUAL,
+                         fabs(ACTUAL - EXPECTED) < 0.1 * EXPECTED);
+            LOOP3_ASSERT(LINE, ESTIMATE, TOTAL,
+                         fabs(ESTIMATE - TOTAL) < 0.1 * TOTAL);
+            LOOP_ASSERT(LINE, 0 == X.numLiveSamples());
+        }
+
+        if (verbose) printf("\tAlternating allocators.\n");
+        {
+            enum { SIZE = 100, COUNT = 200000 };
+
+            Obj mX(INTERVAL, &ta);  const Obj& X = mX;
+            Obj mY(INTERVAL, &ta);  const Obj& Y = mY;
+
+            for (int i = 0; i < COUNT; ++i) {
+                mX.deallocate(mX.allocate(SIZE));
+                mY.deallocate(mY.allocate(SIZE));
+            }
+
+            const double PROBABILITY = 1 - exp(-double(SIZE) / INTERVAL);
+            const double EXPECTED    = COUNT * PROBABILITY;
+            const double ACTUAL_X    = double(X.numSamples());
+            const double ACTUAL_Y    = double(Y.numSamples());
+
+            if (veryVerbose) {
+                T_ P_(EXPECTED) P_(ACTUAL_X) P(ACTUAL_Y)
+            }
+
+            ASSERTV(EXPECTED, ACTUAL_X,
+                    fabs(ACTUAL_X - EXPECTED) < 0.1 * EXPECTED);
+            ASSERTV(EXPECTED, ACTUAL_Y,
+                    fabs(ACTUAL_Y - EXPECTED) < 0.1 * EXPECTED);
+        }
+
+        if (verbose) printf("\tLarge allocations.\n");
+        {
+            Obj mX(INTERVAL, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                mX.deallocate(mX.allocate(100 * INTERVAL));
+                LOOP_ASSERT(i, i + 1 == X.numSamples());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'writeProfile'
+        //
+        // Concerns:
+        //: 1 The profile begins with a header line holding the totals of the
+        //:   live and cumulative samples and bytes, and the sampling
+        //:   interval.
+        //:
+        //: 2 The profile holds one line per call stack, holding the live and
+        //:   cumulative samples and bytes of the call stack, followed by its
+        //:   return addresses.
+        //:
+        //: 3 On Linux, the profile is followed by the memory map of the
+        //:   process.
+        //:
+        //: 4 The first return address of a call stack is that of the caller
+        //:   of 'allocate'.
+        //:
+        //: 5 The profile of an allocator having no samples is well formed.
+        //:
+        //: 6 The memory used to write the profile is returned to the upstream
+        //:   allocator with the size with which it was allocated.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //:
+        //: 8 If the upstream allocator throws, no memory is leaked, and the
+        //:   allocator remains usable.
+        //
+        // Plan:
+        //: 1 Using a sampling interval of 1, allocate blocks at two call
+        //:   sites, deallocate some of them, write the profile to a
+        //:   temporary file, parse it, and verify its contents.  Verify that
+        //:   the upstream test allocator reports no mismatched deallocation.
+        //:   (C-1..4, 6)
+        //:
+        //: 2 Write and parse the profile of an allocator having no samples.
+        //:   (C-5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //:
+        //: 4 Make the upstream allocator throw on the allocation of the copy
+        //:   of the records, and verify that no memory is leaked, and that
+        //:   the statistics of the allocator and its profile remain
+        //:   available.  (C-8)
+        //
+        // Testing:
+        //   int writeProfile(std::FILE *file) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'writeProfile'"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        enum { MAX_ENTRIES = 8 };
+
+        ProfileEntry header;
+        ProfileEntry entries[MAX_ENTRIES];
+        Int64        interval;
+        bool         hasMaps;
+
+        if (verbose) printf("\tEmpty profile.\n");
+        {
+            const Obj X(&ta);
+
+            FILE *file = tmpfile();
+            ASSERT(file);
+            ASSERT(0 == X.writeProfile(file));
+
+            ASSERT(0 == parseProfile(&header,
+                                     entries,
+                                     MAX_ENTRIES,
+                                     &interval,
+                                     &hasMaps,
+                                     file));
+            ASSERT(512 * 1024 == interval);
+            ASSERT(0          == header.d_numLive);
+            ASSERT(0          == header.d_numLiveBytes);
+            ASSERT(0          == header.d_numTotal);
+            ASSERT(0          == header.d_numTotalBytes);
+            fclose(file);
+        }
+
+        if (verbose) printf("\tProfile of two call stacks.\n");
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            void *a[3];
+            void *b[5];
+            for (int i = 0; i < 3; ++i) {
+                a[i] = allocateAtSiteA(&mX, 100);
+            }
+            for (int i = 0; i < 5; ++i) {
+                b[i] = allocateAtSiteB(&mX, 10 + i);
+            }
+            mX.deallocate(a[0]);
+            mX.deallocate(b[0]);
+            mX.deallocate(b[1]);
+
+            FILE *file = tmpfile();
+            ASSERT(file);
+            ASSERT(0 == X.writeProfile(file));
+            ASSERT(0 == ta.numMismatches());
+
+            if (veryVerbose) {
+                char line[256];
+                rewind(file);
+                while (fgets(line, sizeof line, file)
+                    && 0 != strcmp(line, "\n")) {
+                    printf("\t%s", line);
+                }
+            }
+
+            const int NUM_ENTRIES = parseProfile(&header,
+                                                 entries,
+                                                 MAX_ENTRIES,
+                                                 &interval,
+                                                 &hasMaps,
+                                                 file);
+            fclose(file);
+
+            ASSERT(1        == interval);
+            ASSERT(2 + 3    == header.d_numLive);
+            ASSERT(200 + 39 == header.d_numLiveBytes);
+            ASSERT(3 + 5    == header.d_numTotal);
+            ASSERT(300 + 60 == header.d_numTotalBytes);
+
+#ifdef U_CAPTURES_STACKS
+            ASSERT(2 == NUM_ENTRIES);
+#else
+            ASSERT(1 == NUM_ENTRIES);
+#endif
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+            ASSERT(hasMaps);
+#else
+            ASSERT(!hasMaps);
+#endif
+
+            for (int i = 0; i < NUM_ENTRIES; ++i) {
+                const ProfileEntry& ENTRY = entries[i];
+
+                if (veryVerbose) {
+                    T_ P_(ENTRY.d_numLive) P_(ENTRY.d_numTotal)
+                    P(ENTRY.d_numFrames)
+                }
+
+                LOOP_ASSERT(i, ENTRY.d_numFrames <= Obj::k_MAX_NUM_FRAMES);
+
+#ifdef U_CAPTURES_STACKS
+                LOOP_ASSERT(i, 0 < ENTRY.d_numFrames);
+
+                // Identify the call site by its counts, and verify that the
+                // first return address lies within the function of that
+                // call site.
+
+                const bsls::Types::Uint64 SITE = 3 == ENTRY.d_numTotal
+                    ? reinterpret_cast<bsls::Types::UintPtr>(&allocateAtSiteA)
+                    : reinterpret_cast<bsls::Types::UintPtr>(&allocateAtSiteB);
+
+                LOOP_ASSERT(i, SITE <  ENTRY.d_firstFrame);
+                LOOP_ASSERT(i, ENTRY.d_firstFrame < SITE + 256);
+
+                if (3 == ENTRY.d_numTotal) {
+                    LOOP_ASSERT(i, 2   == ENTRY.d_numLive);
+                    LOOP_ASSERT(i, 200 == ENTRY.d_numLiveBytes);
+                    LOOP_ASSERT(i, 300 == ENTRY.d_numTotalBytes);
+                }
+                else {
+                    LOOP_ASSERT(i, 5   == ENTRY.d_numTotal);
+                    LOOP_ASSERT(i, 3   == ENTRY.d_numLive);
+                    LOOP_ASSERT(i, 39  == ENTRY.d_numLiveBytes);
+                    LOOP_ASSERT(i, 60  == ENTRY.d_numTotalBytes);
+                }
+#endif
+            }
+
+            for (int i = 1; i < 3; ++i) {
+                mX.deallocate(a[i]);
+            }
+            for (int i = 2; i < 5; ++i) {
+                mX.deallocate(b[i]);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) printf("\tException while copying the records.\n");
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            void *block = allocateAtSiteA(&mX, 100);
+
+            const Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            FILE *file = tmpfile();
+            ASSERT(file);
+
+            bool caught = false;
+            ta.setAllocationLimit(0);
+            try {
+                X.writeProfile(file);
+            }
+            catch (const bslma::TestAllocatorException&) {
+                caught = true;
+            }
+            ta.setAllocationLimit(-1);
+
+            ASSERT(caught);
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+            ASSERT(1          == X.numSamples());
+
+            ASSERT(0 == X.writeProfile(file));
+            ASSERT(0 == ta.numMismatches());
+            fclose(file);
+
+            mX.deallocate(block);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+#endif
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                          bsls::AssertTest::failTestDriver);
+
+            const Obj X(&ta);
+
+            ASSERT_FAIL(X.writeProfile(0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE, DEALLOCATE, AND SAMPLE STATISTICS
+        //
+        // Concerns:
+        //: 1 'allocate' returns a maximally-aligned block obtained from the
+        //:   upstream allocator, which is larger than the request by the
+        //:   size of a header.
+        //:
+        //: 2 'deallocate' returns the whole block to the upstream allocator.
+        //:
+        //: 3 Allocating 0 bytes returns 0, and deallocating 0 has no effect;
+        //:   neither is sampled.
+        //:
+        //: 4 With a sampling interval of 1, every allocation is sampled.
+        //:
+        //: 5 Samples taken at the same call stack are aggregated, and samples
+        //:   taken at distinct call stacks are not.
+        //:
+        //: 6 Deallocating a sampled block removes it from the live samples.
+        //:
+        //: 7 If the upstream allocator throws while the record of a new call
+        //:   stack is allocated, the block is returned to the upstream
+        //:   allocator, no sample is recorded, and the allocator remains
+        //:   usable.
+        //
+        // Plan:
+        //: 1 Using a sampling interval of 1, allocate and deallocate blocks
+        //:   at two call sites, verifying the requests received by a
+        //:   'bslma::TestAllocator' and the sample statistics after each
+        //:   request.  (C-1..6)
+        //:
+        //: 2 Using a sampling interval of 1, make the upstream allocator throw
+        //:   on the allocation following that of the first block, and verify
+        //:   that no memory is in use and no sample is recorded.  Then
+        //:   allocate and deallocate a block, and verify that it is sampled.
+        //:   (C-7)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   bsls::Types::Int64 numSamples() const;
+        //   bsls::Types::Int64 numLiveSamples() const;
+        //   int numStacks() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nALLOCATE, DEALLOCATE, AND SAMPLE STATISTICS"
+                            "\n===========================================\n");
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            const Int64 BOOKKEEPING = ta.numBlocksInUse();
+
+            if (verbose) printf("\tZero-sized requests.\n");
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+            ASSERT(0           == X.numSamples());
+            ASSERT(BOOKKEEPING == ta.numBlocksInUse());
+
+            if (verbose) printf("\tAllocations at one call site.\n");
+
+            enum { NUM_BLOCKS = 10 };
+
+            void *blocks[NUM_BLOCKS];
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                const size_type SIZE = 1 + i * 50;
+
+                blocks[i] = allocateAtSiteA(&mX, SIZE);
+
+                LOOP_ASSERT(i, blocks[i]);
+                LOOP_ASSERT(i, isMaximallyAligned(blocks[i]));
+                if (0 < i) {
+                    // The first sample also allocates the record of its call
+                    // stack, after the block.
+
+                    const char *BLOCK = static_cast<char *>(blocks[i]);
+
+                    LOOP_ASSERT(i,
+                            SIZE + HEADER_SIZE == ta.lastAllocatedNumBytes());
+                    LOOP_ASSERT(i,
+                          BLOCK - HEADER_SIZE == ta.lastAllocatedAddress());
+                }
+                memset(blocks[i], 0xa5, SIZE);
+
+                LOOP_ASSERT(i, i + 1 == X.numSamples());
+                LOOP_ASSERT(i, i + 1 == X.numLiveSamples());
+                LOOP_ASSERT(i, 1     == X.numStacks());
+            }
+
+            if (verbose) printf("\tAllocations at another call site.\n");
+
+            void *other = allocateAtSiteB(&mX, 8);
+            ASSERT(NUM_BLOCKS + 1 == X.numSamples());
+            ASSERT(NUM_BLOCKS + 1 == X.numLiveSamples());
+#ifdef U_CAPTURES_STACKS
+            ASSERT(2              == X.numStacks());
+#else
+            ASSERT(1              == X.numStacks());
+#endif
+
+            if (verbose) printf("\tDeallocations.\n");
+
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                const size_type SIZE = 1 + i * 50;
+
+                mX.deallocate(blocks[i]);
+
+                LOOP_ASSERT(i,
+                          SIZE + HEADER_SIZE == ta.lastDeallocatedNumBytes());
+                LOOP_ASSERT(i,
+                            static_cast<char *>(blocks[i]) - HEADER_SIZE
+                                             == ta.lastDeallocatedAddress());
+                LOOP_ASSERT(i, NUM_BLOCKS + 1     == X.numSamples());
+                LOOP_ASSERT(i, NUM_BLOCKS - i     == X.numLiveSamples());
+            }
+            mX.deallocate(other);
+            ASSERT(0 == X.numLiveSamples());
+
+            // The statistics of the call stacks are retained.
+
+            ASSERT(BOOKKEEPING + X.numStacks() == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) printf("\tException while recording a call stack.\n");
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            const Int64 BOOKKEEPING = ta.numBlocksInUse();
+
+            // The block is allocated, but the allocation of the record of its
+            // call stack throws.
+
+            bool caught = false;
+            ta.setAllocationLimit(1);
+            try {
+                allocateAtSiteA(&mX, 100);
+            }
+            catch (const bslma::TestAllocatorException&) {
+                caught = true;
+            }
+            ta.setAllocationLimit(-1);
+
+            ASSERT(caught);
+            ASSERT(BOOKKEEPING == ta.numBlocksInUse());
+            ASSERT(0           == X.numSamples());
+            ASSERT(0           == X.numStacks());
+
+            void *block = allocateAtSiteA(&mX, 100);
+            ASSERT(1 == X.numSamples());
+            ASSERT(1 == X.numStacks());
+
+            mX.deallocate(block);
+            ASSERT(0 == X.numLiveSamples());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+#endif
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The upstream allocator is the one supplied at construction, or
+        //:   the default allocator.
+        //:
+        //: 2 The sampling interval is the one supplied at construction, or
+        //:   512 kilobytes.
+        //:
+        //: 3 A newly created allocator has no samples.
+        //:
+        //: 4 All of the memory obtained from the upstream allocator is
+        //:   returned at destruction.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 Construct allocators using each constructor, and verify the
+        //:   basic accessors and the memory obtained from the upstream
+        //:   allocator.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   explicit SamplingAllocator(Allocator *basicAllocator = 0);
+        //   explicit SamplingAllocator(Int64 interval, Allocator *ba = 0);
+        //   ~SamplingAllocator();
+        //   bsls::Types::Int64 samplingInterval() const;
+        //   Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS AND BASIC ACCESSORS"
+                            "\n============================\n");
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator         ta("upstream", veryVeryVerbose);
+
+        {
+            const Obj X;
+            ASSERT(&da       == X.allocator());
+            ASSERT(512 * 1024 == X.samplingInterval());
+            ASSERT(0          == X.numSamples());
+            ASSERT(0          == X.numLiveSamples());
+            ASSERT(0          == X.numStacks());
+            ASSERT(0          <  da.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        {
+            const Obj X(&ta);
+            ASSERT(&ta        == X.allocator());
+            ASSERT(512 * 1024 == X.samplingInterval());
+            ASSERT(0          == da.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        const Int64 INTERVALS[] = { 1, 2, 1000, 1LL << 40 };
+        const int   NUM_INTERVALS = sizeof INTERVALS / sizeof *INTERVALS;
+
+        for (int ti = 0; ti < NUM_INTERVALS; ++ti) {
+            const Int64 INTERVAL = INTERVALS[ti];
+            {
+                const Obj X(INTERVAL);
+                LOOP_ASSERT(ti, &da      == X.allocator());
+                LOOP_ASSERT(ti, INTERVAL == X.samplingInterval());
+            }
+            {
+                const Obj X(INTERVAL, &ta);
+                LOOP_ASSERT(ti, &ta      == X.allocator());
+                LOOP_ASSERT(ti, INTERVAL == X.samplingInterval());
+                LOOP_ASSERT(ti, 0        == X.numSamples());
+            }
+            LOOP_ASSERT(ti, 0 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                          bsls::AssertTest::failTestDriver);
+
+            ASSERT_FAIL(Obj(Int64(0), &ta));
+            ASSERT_FAIL(Obj(Int64(-1), &ta));
+            ASSERT_PASS(Obj(Int64(1), &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate a few blocks at the same call site,
+        //:   sampling every allocation, and verify the sample statistics.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            void *blocks[2];
+            allocateBlocks(blocks, 2, &mX);
+            void *p = blocks[0];
+            void *q = blocks[1];
+            ASSERT(2 == X.numSamples());
+            ASSERT(2 == X.numLiveSamples());
+            ASSERT(1 == X.numStacks());
+
+            mX.deallocate(p);
+            ASSERT(2 == X.numSamples());
+            ASSERT(1 == X.numLiveSamples());
+
+            mX.deallocate(q);
+            ASSERT(0 == X.numLiveSamples());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: OVERHEAD OVER THE UPSTREAM ALLOCATOR
+        //
+        // Concerns:
+        //: 1 Sampling at the default interval adds little to the cost of
+        //:   allocating from 'bslma::NewDeleteAllocator'.
+        //
+        // Plan:
+        //: 1 Time threads, the number of which is optionally specified on
+        //:   the command line, that allocate and deallocate blocks from the
+        //:   new/delete allocator directly, and through a sampling allocator
+        //:   with the default interval, and report the rates and the
+        //:   overhead.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: OVERHEAD OVER THE UPSTREAM ALLOCATOR
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: OVERHEAD OVER THE UPSTREAM"
+                            " ALLOCATOR"
+                            "\n======================================="
+                            "==========\n");
+
+        enum { MAX_THREADS = 64, NUM_ITERATIONS = 2000000 };
+
+        const int NUM_THREADS = argc > 2 && 0 < atoi(argv[2])
+                                && atoi(argv[2]) <= MAX_THREADS
+                              ? atoi(argv[2])
+                              : 1;
+
+        printf("%d thread(s)\n", NUM_THREADS);
+
+        bslma::NewDeleteAllocator& newDelete =
+                                        bslma::NewDeleteAllocator::singleton();
+
+        Obj sampling(&newDelete);
+
+        bslma::Allocator *const ALLOCATORS[] = { &newDelete, &sampling };
+
+        static const char *const NAMES[] = {
+            "NewDeleteAllocator:",
+            "SamplingAllocator:"
+        };
+
+        double baseline = 0;
+        for (int mode = 0; mode < 2; ++mode) {
+            ThreadParam params[MAX_THREADS];
+            thread_t    threads[MAX_THREADS];
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                const ThreadParam PARAM = {
+                    ALLOCATORS[mode], i, NUM_ITERATIONS
+                };
+                params[i]  = PARAM;
+                threads[i] = createThread(&allocatingThread, &params[i]);
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                joinThread(threads[i]);
+            }
+            timer.stop();
+
+            const double elapsed = timer.elapsedTime();
+            if (0 == mode) {
+                baseline = elapsed;
+            }
+
+            const double NUM_TOTAL = double(NUM_ITERATIONS) * NUM_THREADS;
+            printf("%-30s %g allocations/s (%+.1f%%)\n",
+                   NAMES[mode],
+                   NUM_TOTAL / elapsed,
+                   100.0 * (elapsed - baseline) / baseline);
+        }
+        printf("%lld samples\n", sampling.numSamples());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
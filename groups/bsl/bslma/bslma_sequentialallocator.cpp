@@ -0,0 +1,263 @@
+// bslma_sequentialallocator.cpp                                      -*-C++-*-
+#include <bslma_sequentialallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <cstddef>  // 'offsetof'
+
+namespace BloombergLP {
+
+namespace bslma {
+
+                        // -------------------------
+                        // class SequentialAllocator
+                        // -------------------------
+
+// PRIVATE CLASS METHODS
+void SequentialAllocator::deallocateList(Block *list, Allocator *allocator)
+{
+    while (list) {
+        Block *next = list->d_next_p;
+        allocator->deallocate(list);
+        list = next;
+    }
+}
+
+// PRIVATE MANIPULATORS
+void *SequentialAllocator::allocateSlow(size_type size)
+{
+    BSLS_ASSERT_SAFE(0 < size);
+
+    // First, look for the first block retained by 'rewind' that is large
+    // enough.  The memory of a block is maximally aligned, so no alignment
+    // offset is needed for the first allocation from it.
+
+    Block **prevNext = &d_freeList_p;
+    while (*prevNext && (*prevNext)->d_size < size) {
+        prevNext = &(*prevNext)->d_next_p;
+    }
+
+    Block *block = *prevNext;
+    if (block) {
+        *prevNext = block->d_next_p;
+    }
+    else {
+        const bool      oversized = size > d_nextSize;
+        const size_type blockSize = oversized ? size : d_nextSize;
+
+        block = static_cast<Block *>(d_allocator_p->allocate(
+                                       offsetof(Block, d_memory) + blockSize));
+        block->d_size = blockSize;
+
+        if (oversized) {
+            // Dispense the whole of an oversized block at once, and keep
+            // dispensing from the current region.
+
+            block->d_next_p = d_usedList_p;
+            d_usedList_p    = block;
+            return &block->d_memory;                                  // RETURN
+        }
+
+        if (bsls::BlockGrowth::BSLS_GEOMETRIC == d_growthStrategy) {
+            d_nextSize = d_nextSize <= d_maxBlockSize / 2
+                       ? d_nextSize * 2
+                       : d_maxBlockSize;
+        }
+    }
+
+    block->d_next_p = d_usedList_p;
+    d_usedList_p    = block;
+
+    char *result = reinterpret_cast<char *>(&block->d_memory);
+    d_cursor_p   = result + size;
+    d_end_p      = result + block->d_size;
+    return result;
+}
+
+void SequentialAllocator::resetCursor()
+{
+    d_cursor_p = d_buffer_p;
+    d_end_p    = d_buffer_p + d_bufferSize;
+}
+
+// CREATORS
+SequentialAllocator::SequentialAllocator(Allocator *basicAllocator)
+: d_cursor_p(0)
+, d_end_p(0)
+, d_usedList_p(0)
+, d_freeList_p(0)
+, d_buffer_p(0)
+, d_bufferSize(0)
+, d_initialSize(k_DEFAULT_INITIAL_SIZE)
+, d_nextSize(k_DEFAULT_INITIAL_SIZE)
+, d_maxBlockSize(k_DEFAULT_MAX_BLOCK_SIZE)
+, d_growthStrategy(bsls::BlockGrowth::BSLS_GEOMETRIC)
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+}
+
+SequentialAllocator::SequentialAllocator(
+                                   bsls::BlockGrowth::Strategy  growthStrategy,
+                                   Allocator                   *basicAllocator)
+: d_cursor_p(0)
+, d_end_p(0)
+, d_usedList_p(0)
+, d_freeList_p(0)
+, d_buffer_p(0)
+, d_bufferSize(0)
+, d_initialSize(k_DEFAULT_INITIAL_SIZE)
+, d_nextSize(k_DEFAULT_INITIAL_SIZE)
+, d_maxBlockSize(k_DEFAULT_MAX_BLOCK_SIZE)
+, d_growthStrategy(growthStrategy)
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+}
+
+SequentialAllocator::SequentialAllocator(
+                                   size_type                    initialSize,
+                                   bsls::BlockGrowth::Strategy  growthStrategy,
+                                   Allocator                   *basicAllocator)
+: d_cursor_p(0)
+, d_end_p(0)
+, d_usedList_p(0)
+, d_freeList_p(0)
+, d_buffer_p(0)
+, d_bufferSize(0)
+, d_initialSize(initialSize)
+, d_nextSize(initialSize)
+, d_maxBlockSize(initialSize < k_DEFAULT_MAX_BLOCK_SIZE
+                 ? static_cast<size_type>(k_DEFAULT_MAX_BLOCK_SIZE)
+                 : initialSize)
+, d_growthStrategy(growthStrategy)
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < initialSize);
+}
+
+SequentialAllocator::SequentialAllocator(
+                                   size_type                    initialSize,
+                                   size_type                    maxBlockSize,
+                                   bsls::BlockGrowth::Strategy  growthStrategy,
+                                   Allocator                   *basicAllocator)
+: d_cursor_p(0)
+, d_end_p(0)
+, d_usedList_p(0)
+, d_freeList_p(0)
+, d_buffer_p(0)
+, d_bufferSize(0)
+, d_initialSize(initialSize)
+, d_nextSize(initialSize)
+, d_maxBlockSize(maxBlockSize)
+, d_growthStrategy(growthStrategy)
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < initialSize);
+    BSLS_ASSERT(initialSize <= maxBlockSize);
+}
+
+SequentialAllocator::SequentialAllocator(char      *buffer,
+                                         size_type  bufferSize,
+                                         Allocator *basicAllocator)
+: d_cursor_p(buffer)
+, d_end_p(buffer + bufferSize)
+, d_usedList_p(0)
+, d_freeList_p(0)
+, d_buffer_p(buffer)
+, d_bufferSize(bufferSize)
+, d_initialSize(bufferSize * 2)
+, d_nextSize(bufferSize * 2)
+, d_maxBlockSize(bufferSize * 2 < k_DEFAULT_MAX_BLOCK_SIZE
+                 ? static_cast<size_type>(k_DEFAULT_MAX_BLOCK_SIZE)
+                 : bufferSize * 2)
+, d_growthStrategy(bsls::BlockGrowth::BSLS_GEOMETRIC)
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 < bufferSize);
+}
+
+SequentialAllocator::SequentialAllocator(
+                                   char                        *buffer,
+                                   size_type                    bufferSize,
+                                   bsls::BlockGrowth::Strategy  growthStrategy,
+                                   Allocator                   *basicAllocator)
+: d_cursor_p(buffer)
+, d_end_p(buffer + bufferSize)
+, d_usedList_p(0)
+, d_freeList_p(0)
+, d_buffer_p(buffer)
+, d_bufferSize(bufferSize)
+, d_initialSize(bsls::BlockGrowth::BSLS_GEOMETRIC == growthStrategy
+                ? bufferSize * 2
+                : bufferSize)
+, d_nextSize(d_initialSize)
+, d_maxBlockSize(d_initialSize < k_DEFAULT_MAX_BLOCK_SIZE
+                 ? static_cast<size_type>(k_DEFAULT_MAX_BLOCK_SIZE)
+                 : d_initialSize)
+, d_growthStrategy(growthStrategy)
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 < bufferSize);
+}
+
+SequentialAllocator::~SequentialAllocator()
+{
+    deallocateList(d_usedList_p, d_allocator_p);
+    deallocateList(d_freeList_p, d_allocator_p);
+}
+
+// MANIPULATORS
+void SequentialAllocator::release()
+{
+    deallocateList(d_usedList_p, d_allocator_p);
+    deallocateList(d_freeList_p, d_allocator_p);
+
+    d_usedList_p = 0;
+    d_freeList_p = 0;
+    d_nextSize   = d_initialSize;
+    resetCursor();
+}
+
+void SequentialAllocator::rewind()
+{
+    // The used list is in reverse order of use: reverse it onto the front of
+    // the free list, so that the blocks are reused in their original order.
+
+    while (d_usedList_p) {
+        Block *block    = d_usedList_p;
+        d_usedList_p    = block->d_next_p;
+        block->d_next_p = d_freeList_p;
+        d_freeList_p    = block;
+    }
+    resetCursor();
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
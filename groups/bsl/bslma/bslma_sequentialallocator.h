@@ -0,0 +1,516 @@
+// bslma_sequentialallocator.h                                        -*-C++-*-
+#ifndef INCLUDED_BSLMA_SEQUENTIALALLOCATOR
+#define INCLUDED_BSLMA_SEQUENTIALALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fast sequential (monotonic) arena allocator.
+//
+//@CLASSES:
+//  bslma::SequentialAllocator: bump-pointer allocator over a list of blocks
+//
+//@SEE_ALSO: bslma_localarena, bslma_managedallocator, bsls_blockgrowth
+//
+//@DESCRIPTION: This component provides a concrete allocator,
+// 'bslma::SequentialAllocator', that implements the
+// 'bslma::ManagedAllocator' protocol and dispenses memory by advancing a
+// cursor (a "bump pointer") through large blocks obtained from an upstream
+// allocator:
+//..
+//   ,--------------------------.
+//  ( bslma::SequentialAllocator )
+//   `--------------------------'
+//                |         ctor/dtor
+//                |         rewind
+//                V
+//    ,-----------------------.
+//   ( bslma::ManagedAllocator )
+//    `-----------------------'
+//                |         release
+//                V
+//        ,----------------.
+//       ( bslma::Allocator )
+//        `----------------'
+//                        allocate
+//                        deallocate
+//..
+// Allocation is a pointer increment in the common case, and a call to the
+// upstream allocator only when the current block is exhausted.  'deallocate'
+// has no effect: the memory dispensed by a sequential allocator is reclaimed
+// all at once, by calling 'release' (which returns every block to the
+// upstream allocator), 'rewind' (which retains the blocks for reuse), or by
+// destroying the allocator.  A sequential allocator is therefore well suited
+// to data structures having a well-defined, short lifetime, such as the
+// containers used while processing a single request.
+//
+///Block Growth
+///------------
+// The size of the blocks obtained from the upstream allocator is governed by
+// a 'bsls::BlockGrowth::Strategy' supplied at construction.  With geometric
+// growth ('bsls::BlockGrowth::BSLS_GEOMETRIC', the default), each new block
+// is twice the size of the previous one, until a maximum block size is
+// reached; with constant growth ('bsls::BlockGrowth::BSLS_CONSTANT'), every
+// block has the initial size.  A request larger than the next block size is
+// satisfied from a block of (exactly) the requested size, which does not
+// affect the size of subsequent blocks.
+//
+///Rewinding
+///---------
+// The 'rewind' method makes all of the memory previously dispensed by a
+// sequential allocator available again, but, unlike 'release', retains the
+// blocks already obtained from the upstream allocator, which are reused (in
+// order) by subsequent allocations.  An allocator that is rewound after each
+// unit of work therefore stops calling the upstream allocator altogether once
+// it has grown to accommodate the largest unit of work.
+//
+///Initial Buffer
+///--------------
+// A sequential allocator may be supplied, at construction, with an external
+// buffer from which memory is dispensed before any block is obtained from the
+// upstream allocator.  The buffer plays the role of the first block: under
+// geometric growth, the first block obtained from the upstream allocator is
+// twice the size of the buffer, and 'release' and 'rewind' make the whole
+// buffer available again.  A buffer on the program stack thus allows small,
+// short-lived data structures to be built without any use of the heap (see
+// 'bslma_localarena').
+//
+///Alignment Strategy
+///------------------
+// The memory returned by 'allocate' is *naturally* *aligned* for the
+// requested size: its alignment is the largest power of 2 dividing the
+// requested size, up to the maximal alignment for the platform (see
+// 'bsls_alignmentutil').  Natural alignment is sufficient for any object of
+// the requested size, and wastes less memory than always aligning maximally.
+//
+///Thread Safety
+///-------------
+// 'bslma::SequentialAllocator' is *not* thread-safe: an allocator object may
+// not be accessed concurrently from multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Request-Scoped Data
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server processes a stream of requests, and that the data
+// structures built while processing each request are discarded once the
+// response is sent.  We can obtain the memory for those data structures from
+// a sequential allocator, paying one pointer increment per allocation, and
+// then reclaim all of that memory at once.
+//
+// First, we define a simple singly-linked list of words, 'my_WordList', that
+// obtains its memory from a supplied allocator:
+//..
+//  class my_WordList {
+//      // This class implements a minimal list of words.
+//
+//      // PRIVATE TYPES
+//      struct Node {
+//          Node *d_next_p;  // next node in the list
+//          char *d_word_p;  // null-terminated word
+//      };
+//
+//      // DATA
+//      Node             *d_head_p;       // most recently added word
+//      int               d_length;       // number of words
+//      bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+//
+//    public:
+//      // CREATORS
+//      explicit my_WordList(bslma::Allocator *basicAllocator)
+//      : d_head_p(0)
+//      , d_length(0)
+//      , d_allocator_p(basicAllocator)
+//      {
+//      }
+//
+//      // MANIPULATORS
+//      void add(const char *word)
+//      {
+//          const std::size_t size = std::strlen(word) + 1;
+//
+//          Node *node = static_cast<Node *>(
+//                                    d_allocator_p->allocate(sizeof(Node)));
+//          node->d_word_p = static_cast<char *>(
+//                                    d_allocator_p->allocate(size));
+//          std::memcpy(node->d_word_p, word, size);
+//          node->d_next_p = d_head_p;
+//          d_head_p       = node;
+//          ++d_length;
+//      }
+//
+//      // ACCESSORS
+//      int length() const
+//      {
+//          return d_length;
+//      }
+//  };
+//..
+// Notice that 'my_WordList' has no destructor: it never returns its memory to
+// its allocator, and so can be used only with an allocator, such as a
+// sequential allocator, that reclaims its memory in bulk.  Also notice that
+// the characters of each word are allocated separately from its node, so that
+// the natural alignment of each allocation is appropriate for its contents
+// (see {Alignment Strategy}).
+//
+// Then, we create a sequential allocator that obtains its blocks from a
+// 'bslma::TestAllocator', so that we can observe its use of memory:
+//..
+//  bslma::TestAllocator       upstream;
+//  bslma::SequentialAllocator arena(&upstream);
+//..
+// Next, we process a first request, building a list of words:
+//..
+//  {
+//      my_WordList words(&arena);
+//      for (int i = 0; i < 1000; ++i) {
+//          words.add("hello");
+//      }
+//      assert(1000 == words.length());
+//  }
+//  const bsls::Types::Int64 numBlocks = upstream.numBlocksTotal();
+//  assert(0 < numBlocks);
+//..
+// Then, we 'rewind' the allocator, reclaiming all of the memory used by the
+// first request while retaining the blocks obtained from 'upstream':
+//..
+//  arena.rewind();
+//  assert(numBlocks == upstream.numBlocksInUse());
+//..
+// Next, we process a second request of the same size, and observe that it is
+// served entirely from the retained blocks:
+//..
+//  {
+//      my_WordList words(&arena);
+//      for (int i = 0; i < 1000; ++i) {
+//          words.add("world");
+//      }
+//  }
+//  assert(numBlocks == upstream.numBlocksTotal());
+//..
+// Finally, we 'release' all of the memory back to 'upstream':
+//..
+//  arena.release();
+//  assert(0 == upstream.numBlocksInUse());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_MANAGEDALLOCATOR
+#include <bslma_managedallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BLOCKGROWTH
+#include <bsls_blockgrowth.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslma {
+
+                        // =========================
+                        // class SequentialAllocator
+                        // =========================
+
+class SequentialAllocator : public ManagedAllocator {
+    // This class provides a concrete allocator that dispenses memory by
+    // advancing a cursor through blocks obtained from an upstream allocator,
+    // and that reclaims the memory all at once.  'deallocate' has no effect.
+
+    // PRIVATE TYPES
+    struct Block {
+        // This 'struct' describes the header of a block obtained from the
+        // upstream allocator.  The memory dispensed from the block begins at
+        // (the maximally-aligned) 'd_memory'.
+
+        Block                               *d_next_p;  // next block in list
+        size_type                            d_size;    // bytes usable in
+                                                        // this block
+        bsls::AlignmentUtil::MaxAlignedType  d_memory;  // first usable byte
+    };
+
+    // DATA
+    char                        *d_cursor_p;       // next free byte of the
+                                                   // current region
+
+    char                        *d_end_p;          // one past the last byte
+                                                   // of the current region
+
+    Block                       *d_usedList_p;     // blocks dispensed from
+                                                   // since the last 'rewind'
+
+    Block                       *d_freeList_p;     // blocks retained by
+                                                   // 'rewind', in order
+
+    char                        *d_buffer_p;       // external buffer used
+                                                   // before any block, or 0
+
+    size_type                    d_bufferSize;     // size of 'd_buffer_p'
+
+    size_type                    d_initialSize;    // size of the first block
+
+    size_type                    d_nextSize;       // size of the next block
+
+    size_type                    d_maxBlockSize;   // maximum block size under
+                                                   // geometric growth
+
+    bsls::BlockGrowth::Strategy  d_growthStrategy; // growth of block sizes
+
+    Allocator                   *d_allocator_p;    // upstream allocator (held,
+                                                   // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    SequentialAllocator(const SequentialAllocator&);
+    SequentialAllocator& operator=(const SequentialAllocator&);
+
+    // PRIVATE CLASS METHODS
+    static void deallocateList(Block *list, Allocator *allocator);
+        // Return each block in the specified 'list' to the specified
+        // 'allocator'.
+
+    // PRIVATE MANIPULATORS
+    void *allocateSlow(size_type size);
+        // Return the address of a naturally-aligned block of memory of the
+        // specified 'size' (in bytes), taken from a block retained by
+        // 'rewind' if one is large enough, and from a new block obtained from
+        // the upstream allocator otherwise.  The behavior is undefined unless
+        // '0 < size' and the current region cannot satisfy the request.
+
+    void resetCursor();
+        // Make the external buffer, if any, the current region, with all of
+        // its memory available, and make the current region empty otherwise.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_INITIAL_SIZE   = 256,      // default size of the first block
+
+        k_DEFAULT_MAX_BLOCK_SIZE = 1 << 20   // default maximum block size
+    };
+
+    // CREATORS
+    explicit SequentialAllocator(Allocator *basicAllocator = 0);
+    explicit SequentialAllocator(
+                              bsls::BlockGrowth::Strategy  growthStrategy,
+                              Allocator                   *basicAllocator = 0);
+    SequentialAllocator(size_type                    initialSize,
+                        bsls::BlockGrowth::Strategy  growthStrategy,
+                        Allocator                   *basicAllocator = 0);
+    SequentialAllocator(size_type                    initialSize,
+                        size_type                    maxBlockSize,
+                        bsls::BlockGrowth::Strategy  growthStrategy,
+                        Allocator                   *basicAllocator = 0);
+        // Create a sequential allocator.  Optionally specify an
+        // 'initialSize' (in bytes) of the first block obtained from the
+        // upstream allocator; if 'initialSize' is not specified,
+        // 'k_DEFAULT_INITIAL_SIZE' is used.  Optionally specify a
+        // 'maxBlockSize' (in bytes) beyond which block sizes do not grow; if
+        // 'maxBlockSize' is not specified, the larger of
+        // 'k_DEFAULT_MAX_BLOCK_SIZE' and 'initialSize' is used.  Optionally
+        // specify a 'growthStrategy' of the block sizes; if 'growthStrategy'
+        // is not specified, geometric growth is used.  Optionally specify a
+        // 'basicAllocator' used to supply the blocks.  If 'basicAllocator' is
+        // 0, the currently installed default allocator is used.  The behavior
+        // is undefined unless '0 < initialSize' and
+        // 'initialSize <= maxBlockSize'.  Note that no memory is obtained
+        // from the upstream allocator until the first call to 'allocate'.
+
+    SequentialAllocator(char                        *buffer,
+                        size_type                    bufferSize,
+                        Allocator                   *basicAllocator = 0);
+    SequentialAllocator(char                        *buffer,
+                        size_type                    bufferSize,
+                        bsls::BlockGrowth::Strategy  growthStrategy,
+                        Allocator                   *basicAllocator = 0);
+        // Create a sequential allocator that dispenses memory from the
+        // specified 'buffer' of the specified 'bufferSize' (in bytes) before
+        // obtaining any block from the upstream allocator.  Optionally
+        // specify a 'growthStrategy' of the sizes of the blocks subsequently
+        // obtained; if 'growthStrategy' is not specified, geometric growth is
+        // used.  Optionally specify a 'basicAllocator' used to supply the
+        // blocks.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '0 < bufferSize', and 'buffer' has at least 'bufferSize' bytes and
+        // outlives this object.  Note that the first block obtained from the
+        // upstream allocator has the size of 'buffer' under constant growth,
+        // and twice that size under geometric growth (see {Initial Buffer}).
+
+    virtual ~SequentialAllocator();
+        // Destroy this allocator, returning all of the blocks obtained from
+        // the upstream allocator, and thereby all of the memory dispensed by
+        // this allocator, to the upstream allocator.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return the address of a contiguous block of naturally-aligned
+        // memory of the specified 'size' (in bytes).  If 'size' is 0, no
+        // memory is allocated and 0 is returned.  The behavior is undefined
+        // unless '0 <= size'.
+
+    virtual void deallocate(void *address);
+        // This method has no effect.  The memory dispensed by this allocator
+        // is reclaimed by 'release', 'rewind', or the destructor.
+
+    virtual void *allocateAligned(size_type size, size_type alignment);
+        // Return the address of a contiguous block of memory of the specified
+        // 'size' (in bytes), aligned to the specified 'alignment'.  If 'size'
+        // is 0, no memory is allocated and 0 is returned.  The behavior is
+        // undefined unless '0 <= size' and 'alignment' is a positive,
+        // integral power of 2.  Note that the alignment is obtained by
+        // advancing the cursor, without storing any additional data.
+
+    virtual void deallocateAligned(void      *address,
+                                   size_type  size,
+                                   size_type  alignment);
+        // This method has no effect.  The memory dispensed by this allocator
+        // is reclaimed by 'release', 'rewind', or the destructor.
+
+    virtual void release();
+        // Return all of the blocks obtained from the upstream allocator, and
+        // thereby all of the memory dispensed by this allocator, to the
+        // upstream allocator, make all of the external buffer (if any)
+        // available again, and reset the size of the next block to the
+        // initial size.  The behavior is undefined if any memory dispensed by
+        // this allocator is used after this call.
+
+    void rewind();
+        // Make all of the memory dispensed by this allocator, including that
+        // of the external buffer (if any), available for subsequent
+        // allocations, retaining the blocks obtained from the upstream
+        // allocator for reuse.  The behavior is undefined if any memory
+        // dispensed by this allocator before this call is used after it.
+
+    // ACCESSORS
+    Allocator *allocator() const;
+        // Return the address of the upstream allocator used by this
+        // allocator to supply its blocks.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // -------------------------
+                        // class SequentialAllocator
+                        // -------------------------
+
+// MANIPULATORS
+inline
+void *SequentialAllocator::allocate(size_type size)
+{
+    BSLS_ASSERT_SAFE(0 <= size);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        return 0;                                                     // RETURN
+    }
+
+    const int offset = bsls::AlignmentUtil::calculateAlignmentOffset(
+                   d_cursor_p,
+                   bsls::AlignmentUtil::calculateAlignmentFromSize(size));
+
+    const size_type available = static_cast<size_type>(d_end_p - d_cursor_p);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(offset + size <= available)) {
+        void *result  = d_cursor_p + offset;
+        d_cursor_p   += offset + size;
+        return result;                                                // RETURN
+    }
+
+    return allocateSlow(size);
+}
+
+inline
+void SequentialAllocator::deallocate(void *)
+{
+}
+
+inline
+void *SequentialAllocator::allocateAligned(size_type size,
+                                           size_type alignment)
+{
+    BSLS_ASSERT_SAFE(0 <= size);
+    BSLS_ASSERT_SAFE(0 < alignment && 0 == (alignment & (alignment - 1)));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        return 0;                                                     // RETURN
+    }
+
+    const int align  = static_cast<int>(alignment);
+    int       offset = bsls::AlignmentUtil::calculateAlignmentOffset(
+                                                                   d_cursor_p,
+                                                                   align);
+
+    const size_type available = static_cast<size_type>(d_end_p - d_cursor_p);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(offset + size <= available)) {
+        void *result  = d_cursor_p + offset;
+        d_cursor_p   += offset + size;
+        return result;                                                // RETURN
+    }
+
+    // Obtain enough memory to align the result at any address.
+
+    char *result = static_cast<char *>(allocateSlow(size + alignment - 1));
+    offset = bsls::AlignmentUtil::calculateAlignmentOffset(result, align);
+    return result + offset;
+}
+
+inline
+void SequentialAllocator::deallocateAligned(void *, size_type, size_type)
+{
+}
+
+// ACCESSORS
+inline
+Allocator *SequentialAllocator::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1057 @@
+// bslma_sequentialallocator.t.cpp                                    -*-C++-*-
+
+#include <bslma_sequentialallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a concrete implementation of the
+// 'bslma::Allocator' protocol that dispenses memory sequentially from blocks
+// obtained from an upstream allocator.  We use a 'bslma::TestAllocator' as the
+// upstream allocator to observe the number and size of the blocks obtained,
+// and verify that the memory dispensed is distinct, naturally aligned, and
+// taken from those blocks.  We then verify the block growth strategies, and
+// the reclamation of memory by 'release', 'rewind', and the destructor.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit SequentialAllocator(Allocator *basicAllocator = 0);
+// [ 2] SequentialAllocator(Strategy, Allocator * = 0);
+// [ 2] SequentialAllocator(size_type, Strategy, Allocator * = 0);
+// [ 2] SequentialAllocator(size_type, size_type, Strategy, Allocator * = 0);
+// [ 5] SequentialAllocator(char *, size_type, Allocator * = 0);
+// [ 5] SequentialAllocator(char *, size_type, Strategy, Allocator * = 0);
+// [ 2] ~SequentialAllocator();
+//
+// MANIPULATORS
+// [ 2] void *allocate(size_type size);
+// [ 2] void deallocate(void *address);
+// [ 6] void *allocateAligned(size_type size, size_type alignment);
+// [ 6] void deallocateAligned(void *, size_type, size_type);
+// [ 4] void release();
+// [ 4] void rewind();
+//
+// ACCESSORS
+// [ 2] Allocator *allocator() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] BLOCK GROWTH
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH 'NewDeleteAllocator'
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslma::SequentialAllocator Obj;
+typedef bslma::Allocator::size_type size_type;
+
+static const bsls::BlockGrowth::Strategy GEO =
+                                          bsls::BlockGrowth::BSLS_GEOMETRIC;
+static const bsls::BlockGrowth::Strategy CON =
+                                          bsls::BlockGrowth::BSLS_CONSTANT;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static size_type headerSize(Obj *object, bslma::TestAllocator *upstream)
+    // Return the number of bytes of overhead in each block that the specified
+    // 'object' obtains from the specified 'upstream' allocator, as determined
+    // by allocating a single byte from 'object', and then 'release' the
+    // memory of 'object'.  The behavior is undefined unless 'object' has not
+    // obtained any memory from 'upstream'.
+{
+    object->allocate(1);
+    const size_type result = upstream->lastAllocatedNumBytes()
+                           - Obj::k_DEFAULT_INITIAL_SIZE;
+    object->release();
+    return result;
+}
+
+static bool isNaturallyAligned(const void *address, size_type size)
+    // Return 'true' if the specified 'address' is aligned appropriately for
+    // an object of the specified 'size', and 'false' otherwise.
+{
+    const int alignment =
+                    bsls::AlignmentUtil::calculateAlignmentFromSize(size);
+    return 0 == bsls::AlignmentUtil::calculateAlignmentOffset(address,
+                                                              alignment);
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Example 1: Allocating Request-Scoped Data
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server processes a stream of requests, and that the data
+// structures built while processing each request are discarded once the
+// response is sent.  We can obtain the memory for those data structures from
+// a sequential allocator, paying one pointer increment per allocation, and
+// then reclaim all of that memory at once.
+//
+// First, we define a simple singly-linked list of words, 'my_WordList', that
+// obtains its memory from a supplied allocator:
+//..
+    class my_WordList {
+        // This class implements a minimal list of words.
+
+        // PRIVATE TYPES
+        struct Node {
+            Node *d_next_p;  // next node in the list
+            char *d_word_p;  // null-terminated word
+        };
+
+        // DATA
+        Node             *d_head_p;       // most recently added word
+        int               d_length;       // number of words
+        bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+      public:
+        // CREATORS
+        explicit my_WordList(bslma::Allocator *basicAllocator)
+        : d_head_p(0)
+        , d_length(0)
+        , d_allocator_p(basicAllocator)
+        {
+        }
+
+        // MANIPULATORS
+        void add(const char *word)
+        {
+            const std::size_t size = strlen(word) + 1;
+
+            Node *node = static_cast<Node *>(
+                                      d_allocator_p->allocate(sizeof(Node)));
+            node->d_word_p = static_cast<char *>(
+                                      d_allocator_p->allocate(size));
+            memcpy(node->d_word_p, word, size);
+            node->d_next_p = d_head_p;
+            d_head_p       = node;
+            ++d_length;
+        }
+
+        // ACCESSORS
+        int length() const
+        {
+            return d_length;
+        }
+    };
+//..
+// Notice that 'my_WordList' has no destructor: it never returns its memory to
+// its allocator, and so can be used only with an allocator, such as a
+// sequential allocator, that reclaims its memory in bulk.  Also notice that
+// the characters of each word are allocated separately from its node, so that
+// the natural alignment of each allocation is appropriate for its contents
+// (see {Alignment Strategy}).
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create a sequential allocator that obtains its blocks from a
+// 'bslma::TestAllocator', so that we can observe its use of memory:
+//..
+    bslma::TestAllocator       upstream;
+    bslma::SequentialAllocator arena(&upstream);
+//..
+// Next, we process a first request, building a list of words:
+//..
+    {
+        my_WordList words(&arena);
+        for (int i = 0; i < 1000; ++i) {
+            words.add("hello");
+        }
+        ASSERT(1000 == words.length());
+    }
+    const bsls::Types::Int64 numBlocks = upstream.numBlocksTotal();
+    ASSERT(0 < numBlocks);
+//..
+// Then, we 'rewind' the allocator, reclaiming all of the memory used by the
+// first request while retaining the blocks obtained from 'upstream':
+//..
+    arena.rewind();
+    ASSERT(numBlocks == upstream.numBlocksInUse());
+//..
+// Next, we process a second request of the same size, and observe that it is
+// served entirely from the retained blocks:
+//..
+    {
+        my_WordList words(&arena);
+        for (int i = 0; i < 1000; ++i) {
+            words.add("world");
+        }
+    }
+    ASSERT(numBlocks == upstream.numBlocksTotal());
+//..
+// Finally, we 'release' all of the memory back to 'upstream':
+//..
+    arena.release();
+    ASSERT(0 == upstream.numBlocksInUse());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // OVER-ALIGNED ALLOCATION
+        //
+        // Concerns:
+        //: 1 'allocateAligned' returns memory having the requested alignment,
+        //:   for any alignment, whether the memory is dispensed from the
+        //:   current block or from a new block.
+        //:
+        //: 2 Memory dispensed from the current block is obtained by advancing
+        //:   the cursor to the next aligned address, without storing any
+        //:   additional data.
+        //:
+        //: 3 'deallocateAligned' has no effect.
+        //:
+        //: 4 A 'size' of 0 results in a null pointer.
+        //:
+        //: 5 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each alignment from 1 to 256, allocate a single byte from an
+        //:   external buffer, and then an aligned block; verify that the
+        //:   block is aligned, and that it is at the first aligned address
+        //:   following the byte.  (C-1..2)
+        //:
+        //: 2 Exhaust the current block using aligned allocations, verifying
+        //:   the alignment of the blocks and that the whole of each block is
+        //:   writable.  (C-1)
+        //:
+        //: 3 Deallocate each block using 'deallocateAligned', and verify that
+        //:   no memory is returned to the upstream allocator.  (C-3)
+        //:
+        //: 4 Allocate 0 bytes and verify the result.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   void *allocateAligned(size_type size, size_type alignment);
+        //   void deallocateAligned(void *, size_type, size_type);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nOVER-ALIGNED ALLOCATION"
+                            "\n=======================\n");
+
+        enum { BUFFER_SIZE = 1024 };
+
+        bsls::AlignedBuffer<BUFFER_SIZE> buffer;
+        char *const                      BUFFER = buffer.buffer();
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        for (size_type ALIGN = 1; ALIGN <= 256; ALIGN *= 2) {
+            if (veryVerbose) { T_ P(ALIGN) }
+
+            Obj mX(BUFFER, BUFFER_SIZE, &ta);
+
+            char *p = static_cast<char *>(mX.allocate(1));
+            LOOP_ASSERT(ALIGN, BUFFER == p);
+
+            char *q = static_cast<char *>(mX.allocateAligned(8, ALIGN));
+            LOOP_ASSERT(ALIGN, 0 == bsls::Types::UintPtr(q) % ALIGN);
+            LOOP_ASSERT(ALIGN, p < q && q - ALIGN <= p);
+            LOOP_ASSERT(ALIGN, 0 == ta.numBlocksInUse());
+
+            mX.deallocateAligned(q, 8, ALIGN);
+            LOOP_ASSERT(ALIGN, 0 == ta.numBlocksInUse());
+
+            // Exhaust the buffer, and then the first upstream block.
+
+            for (int i = 0; i < 32; ++i) {
+                const size_type SIZE = (i % 5 + 1) * 24;
+
+                char *r = static_cast<char *>(mX.allocateAligned(SIZE,
+                                                                 ALIGN));
+                LOOP2_ASSERT(ALIGN, i, 0 == bsls::Types::UintPtr(r) % ALIGN);
+                memset(r, 0xa5, SIZE);
+
+                mX.deallocateAligned(r, SIZE, ALIGN);
+            }
+            LOOP_ASSERT(ALIGN, 0 < ta.numBlocksInUse());
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            // An oversized request is also aligned.
+
+            char *r = static_cast<char *>(mX.allocateAligned(100000, ALIGN));
+            LOOP_ASSERT(ALIGN, 0 == bsls::Types::UintPtr(r) % ALIGN);
+            LOOP_ASSERT(ALIGN, NUM_BLOCKS + 1 == ta.numBlocksInUse());
+            memset(r, 0xa5, 100000);
+
+            mX.deallocateAligned(r, 100000, ALIGN);
+            LOOP_ASSERT(ALIGN, NUM_BLOCKS + 1 == ta.numBlocksInUse());
+
+            LOOP_ASSERT(ALIGN, 0 == mX.allocateAligned(0, ALIGN));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(&ta);
+
+            ASSERT_SAFE_PASS(mX.allocateAligned(1, 64));
+            ASSERT_SAFE_FAIL(mX.allocateAligned(1, 0));
+            ASSERT_SAFE_FAIL(mX.allocateAligned(1, 48));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // EXTERNAL BUFFER
+        //
+        // Concerns:
+        //: 1 Memory is dispensed from the external buffer, naturally aligned,
+        //:   until the buffer is exhausted, without using the upstream
+        //:   allocator.
+        //:
+        //: 2 Once the buffer is exhausted, blocks are obtained from the
+        //:   upstream allocator, the first having twice the size of the
+        //:   buffer under geometric growth, and the size of the buffer under
+        //:   constant growth.
+        //:
+        //: 3 'rewind' and 'release' make the whole buffer available again.
+        //:
+        //: 4 A request larger than the next block size does not abandon the
+        //:   remaining space of the buffer.
+        //:
+        //: 5 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each growth strategy, exhaust a buffer using single-byte
+        //:   allocations, verifying the addresses and that no memory is
+        //:   obtained from the upstream allocator; then allocate once more
+        //:   and verify the size of the block obtained.  (C-1..2)
+        //:
+        //: 2 'rewind' and 'release', and verify that the next allocation is
+        //:   at the start of the buffer.  (C-3)
+        //:
+        //: 3 Allocate an oversized block from a partially used buffer, and
+        //:   verify that the next small allocation comes from the buffer.
+        //:   (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid constructor arguments.  (C-5)
+        //
+        // Testing:
+        //   SequentialAllocator(char *, size_type, Allocator * = 0);
+        //   SequentialAllocator(char *, size_type, Strategy, Allocator * = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXTERNAL BUFFER"
+                            "\n===============\n");
+
+        enum { BUFFER_SIZE = 64 };
+
+        bsls::AlignedBuffer<BUFFER_SIZE> buffer;
+        char *const                      BUFFER = buffer.buffer();
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        size_type HEADER;
+        {
+            Obj mX(&ta);
+            HEADER = headerSize(&mX, &ta);
+        }
+
+        for (int si = 0; si < 3; ++si) {
+            const bsls::BlockGrowth::Strategy STRATEGY = 1 == si ? CON : GEO;
+            const size_type                   EXP_SIZE =
+                                            CON == STRATEGY ? BUFFER_SIZE
+                                                            : 2 * BUFFER_SIZE;
+
+            if (veryVerbose) { T_ P(si) }
+
+            Obj *objPtr = 2 == si
+                          ? new (ta) Obj(BUFFER, BUFFER_SIZE, &ta)
+                          : new (ta) Obj(BUFFER, BUFFER_SIZE, STRATEGY, &ta);
+            Obj& mX = *objPtr;
+
+            ASSERT(1 == ta.numBlocksInUse());
+
+            for (int i = 0; i < BUFFER_SIZE; ++i) {
+                LOOP2_ASSERT(si, i, BUFFER + i == mX.allocate(1));
+            }
+            LOOP_ASSERT(si, 1 == ta.numBlocksInUse());
+
+            char *p = static_cast<char *>(mX.allocate(1));
+            LOOP_ASSERT(si, p < BUFFER || BUFFER + BUFFER_SIZE <= p);
+            LOOP_ASSERT(si, 2 == ta.numBlocksInUse());
+            LOOP_ASSERT(si, HEADER + EXP_SIZE == ta.lastAllocatedNumBytes());
+
+            mX.rewind();
+            LOOP_ASSERT(si, BUFFER == mX.allocate(8));
+            LOOP_ASSERT(si, 2 == ta.numBlocksInUse());
+
+            // The buffer is not abandoned for an oversized request.
+
+            mX.allocate(1000);
+            LOOP_ASSERT(si, 3 == ta.numBlocksInUse());
+            LOOP_ASSERT(si, BUFFER + 8 == mX.allocate(8));
+
+            mX.release();
+            LOOP_ASSERT(si, 1 == ta.numBlocksInUse());
+            LOOP_ASSERT(si, BUFFER == mX.allocate(8));
+
+            // Naturally aligned allocations from the buffer.
+
+            for (int i = 0; i < 10; ++i) {
+                const size_type SIZE = i % 4 + 1;
+                void *q = mX.allocate(SIZE);
+                LOOP2_ASSERT(si, i, isNaturallyAligned(q, SIZE));
+            }
+
+            ta.deleteObject(objPtr);
+            LOOP_ASSERT(si, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_PASS(Obj(BUFFER, 1, &ta));
+            ASSERT_FAIL(Obj(BUFFER, 0, &ta));
+            ASSERT_FAIL(Obj((char *)0, 1, &ta));
+
+            ASSERT_PASS(Obj(BUFFER, 1, CON, &ta));
+            ASSERT_FAIL(Obj(BUFFER, 0, CON, &ta));
+            ASSERT_FAIL(Obj((char *)0, 1, CON, &ta));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'release' AND 'rewind'
+        //
+        // Concerns:
+        //: 1 'release' returns every block to the upstream allocator, and
+        //:   resets the size of the next block to the initial size.
+        //:
+        //: 2 After 'rewind', the memory of the retained blocks is dispensed
+        //:   again, in order, without obtaining new blocks, provided the
+        //:   sequence of requests fits in the retained blocks.
+        //:
+        //: 3 After 'rewind', a request that does not fit in the retained
+        //:   blocks obtains a new block, and the blocks that are skipped are
+        //:   reused after the next 'rewind'.
+        //:
+        //: 4 'release' and 'rewind' have no effect on an allocator that has
+        //:   not obtained any memory, and the allocator remains usable after
+        //:   either.
+        //
+        // Plan:
+        //: 1 Allocate a sequence of blocks of varying sizes, 'rewind', and
+        //:   verify that repeating the same sequence yields the same
+        //:   addresses and obtains no new blocks.  (C-2)
+        //:
+        //: 2 After 'rewind', request more memory than any retained block
+        //:   holds, and verify that a new block is obtained; then 'rewind'
+        //:   again and verify that the original sequence still obtains no new
+        //:   blocks.  (C-3)
+        //:
+        //: 3 'release', and verify that no blocks remain in use and that the
+        //:   next block obtained has the initial size.  (C-1)
+        //:
+        //: 4 Call 'release' and 'rewind' on a newly created allocator, and
+        //:   after 'release', and verify that subsequent allocations
+        //:   succeed.  (C-4)
+        //
+        // Testing:
+        //   void release();
+        //   void rewind();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'release' AND 'rewind'"
+                            "\n======================\n");
+
+        enum { NUM_ALLOCS = 200 };
+
+        static const size_type SIZES[] = { 1, 8, 3, 24, 100, 16, 5, 64 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        if (verbose) printf("\tRelease and rewind of an empty allocator.\n");
+        {
+            Obj mX(&ta);
+            mX.release();
+            mX.rewind();
+            ASSERT(0 == ta.numBlocksTotal());
+            ASSERT(0 != mX.allocate(10));
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tRewind reuses the retained blocks.\n");
+        {
+            Obj mX(&ta);
+
+            void *addresses[NUM_ALLOCS];
+            for (int i = 0; i < NUM_ALLOCS; ++i) {
+                addresses[i] = mX.allocate(SIZES[i % NUM_SIZES]);
+            }
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksTotal();
+            const bsls::Types::Int64 NUM_IN_USE = ta.numBlocksInUse();
+            ASSERT(1 < NUM_IN_USE);
+
+            for (int round = 0; round < 3; ++round) {
+                mX.rewind();
+                for (int i = 0; i < NUM_ALLOCS; ++i) {
+                    void *p = mX.allocate(SIZES[i % NUM_SIZES]);
+                    LOOP2_ASSERT(round, i, addresses[i] == p);
+                }
+                LOOP_ASSERT(round, NUM_BLOCKS == ta.numBlocksTotal());
+                LOOP_ASSERT(round, NUM_IN_USE == ta.numBlocksInUse());
+            }
+
+            if (verbose) printf("\tRewind with an oversized request.\n");
+
+            mX.rewind();
+            mX.allocate(Obj::k_DEFAULT_MAX_BLOCK_SIZE);
+            ASSERT(NUM_BLOCKS + 1 == ta.numBlocksTotal());
+
+            mX.rewind();
+            for (int i = 0; i < NUM_ALLOCS; ++i) {
+                mX.allocate(SIZES[i % NUM_SIZES]);
+            }
+            ASSERT(NUM_BLOCKS + 1 == ta.numBlocksTotal());
+
+            if (verbose) printf("\tRelease returns every block.\n");
+
+            const size_type HEADER = ta.lastAllocatedNumBytes()
+                                               - Obj::k_DEFAULT_MAX_BLOCK_SIZE;
+
+            mX.release();
+            ASSERT(0 == ta.numBlocksInUse());
+
+            mX.allocate(1);
+            ASSERT(NUM_BLOCKS + 2 == ta.numBlocksTotal());
+            ASSERT(HEADER + Obj::k_DEFAULT_INITIAL_SIZE ==
+                                                   ta.lastAllocatedNumBytes());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // BLOCK GROWTH
+        //
+        // Concerns:
+        //: 1 Under geometric growth, each new block is twice the size of the
+        //:   previous one, until the maximum block size is reached.
+        //:
+        //: 2 Under constant growth, every block has the initial size.
+        //:
+        //: 3 A request larger than the next block size is satisfied from a
+        //:   block of exactly the requested size, which does not affect the
+        //:   size of subsequent blocks, nor discard the remaining memory of
+        //:   the current block.
+        //
+        // Plan:
+        //: 1 For each growth strategy, and for several initial and maximum
+        //:   sizes, repeatedly exhaust the current block, and verify the size
+        //:   of each block obtained from the upstream test allocator.
+        //:   (C-1..2)
+        //:
+        //: 2 Request a block larger than the next block size, verify the size
+        //:   of the block obtained, and that the subsequent small request is
+        //:   satisfied from the previous block.  (C-3)
+        //
+        // Testing:
+        //   BLOCK GROWTH
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBLOCK GROWTH"
+                            "\n============\n");
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        size_type HEADER;
+        {
+            Obj mX(&ta);
+            HEADER = headerSize(&mX, &ta);
+        }
+        ASSERT(0 < HEADER);
+        ASSERT(HEADER <= 4 * sizeof(bsls::AlignmentUtil::MaxAlignedType));
+
+        static const struct {
+            int                         d_line;
+            size_type                   d_initialSize;
+            size_type                   d_maxBlockSize;
+            bsls::BlockGrowth::Strategy d_strategy;
+            size_type                   d_expSizes[6];
+        } DATA[] = {
+            //LINE  INIT  MAX   STRATEGY  EXPECTED BLOCK SIZES
+            //----  ----  ----  --------  ------------------------------
+            { L_,      1,    1,   GEO,    {   1,   1,   1,   1,   1,   1 } },
+            { L_,      1,    4,   GEO,    {   1,   2,   4,   4,   4,   4 } },
+            { L_,     16,  256,   GEO,    {  16,  32,  64, 128, 256, 256 } },
+            { L_,     16,  100,   GEO,    {  16,  32,  64, 100, 100, 100 } },
+            { L_,    100, 1000,   GEO,    { 100, 200, 400, 800,1000,1000 } },
+            { L_,     16,  256,   CON,    {  16,  16,  16,  16,  16,  16 } },
+            { L_,    100,  100,   CON,    { 100, 100, 100, 100, 100, 100 } },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int                         LINE = DATA[ti].d_line;
+            const size_type                   INIT = DATA[ti].d_initialSize;
+            const size_type                   MAX  = DATA[ti].d_maxBlockSize;
+            const bsls::BlockGrowth::Strategy STRATEGY = DATA[ti].d_strategy;
+            const size_type                  *EXP  = DATA[ti].d_expSizes;
+
+            if (veryVerbose) { T_ P_(LINE) P_(INIT) P(MAX) }
+
+            Obj mX(INIT, MAX, STRATEGY, &ta);
+
+            for (int i = 0; i < 6; ++i) {
+                const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksTotal();
+
+                // Exhaust the block with single bytes, which are not subject
+                // to alignment padding.
+
+                char *first = static_cast<char *>(mX.allocate(1));
+                LOOP2_ASSERT(LINE, i, NUM_BLOCKS + 1 == ta.numBlocksTotal());
+                LOOP2_ASSERT(LINE, i,
+                             HEADER + EXP[i] == ta.lastAllocatedNumBytes());
+
+                for (size_type j = 1; j < EXP[i]; ++j) {
+                    char *p = static_cast<char *>(mX.allocate(1));
+                    LOOP3_ASSERT(LINE, i, j, first + j == p);
+                }
+                LOOP2_ASSERT(LINE, i, NUM_BLOCKS + 1 == ta.numBlocksTotal());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tOversized requests.\n");
+
+        for (int si = 0; si < 2; ++si) {
+            const bsls::BlockGrowth::Strategy STRATEGY = si ? CON : GEO;
+
+            Obj mX(64, STRATEGY, &ta);
+
+            char *p = static_cast<char *>(mX.allocate(8));
+            ASSERT(HEADER + 64 == ta.lastAllocatedNumBytes());
+
+            mX.allocate(1000);
+            ASSERT(HEADER + 1000 == ta.lastAllocatedNumBytes());
+            ASSERT(2 == ta.numBlocksInUse());
+
+            // The next request is served from the first block.
+
+            ASSERT(p + 8 == mX.allocate(8));
+            ASSERT(2 == ta.numBlocksInUse());
+
+            // The oversized block did not affect the growth.
+
+            for (int i = 0; i < 7; ++i) {
+                mX.allocate(8);
+            }
+            ASSERT(3 == ta.numBlocksInUse());
+            ASSERT(HEADER + (CON == STRATEGY ? 64 : 128) ==
+                                                   ta.lastAllocatedNumBytes());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, 'allocate', AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 Each constructor uses the specified allocator as the upstream
+        //:   allocator, and the default allocator if none is specified.
+        //:
+        //: 2 No memory is obtained from the upstream allocator until the
+        //:   first call to 'allocate'.
+        //:
+        //: 3 'allocate' returns distinct, naturally aligned, non-overlapping
+        //:   memory, and 0 when the requested size is 0.
+        //:
+        //: 4 'deallocate' has no effect.
+        //:
+        //: 5 The destructor returns all memory to the upstream allocator.
+        //:
+        //: 6 Precondition violations of the constructors are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 Install a test allocator as the default, and construct an object
+        //:   with each constructor, with and without an upstream allocator;
+        //:   verify the value of 'allocator()', and that no memory is
+        //:   allocated.  (C-1..2)
+        //:
+        //: 2 Allocate memory of many sizes, write a distinct value to each
+        //:   byte, and verify alignment and that earlier values are
+        //:   undisturbed.  Deallocate each address, and verify no memory is
+        //:   returned to the upstream allocator until the object is
+        //:   destroyed.  (C-3..5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid constructor arguments.  (C-6)
+        //
+        // Testing:
+        //   explicit SequentialAllocator(Allocator *basicAllocator = 0);
+        //   SequentialAllocator(Strategy, Allocator * = 0);
+        //   SequentialAllocator(size_type, Strategy, Allocator * = 0);
+        //   SequentialAllocator(size_type, size_type, Strategy, Allocator *);
+        //   ~SequentialAllocator();
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS, 'allocate', AND 'deallocate'"
+                            "\n======================================\n");
+
+        bslma::TestAllocator         da("default",  veryVeryVerbose);
+        bslma::TestAllocator         ta("upstream", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        for (char cfg = 'a'; cfg <= 'h'; ++cfg) {
+            const char CONFIG = cfg;
+
+            if (veryVerbose) { T_ P(CONFIG) }
+
+            Obj *objPtr;
+            bslma::TestAllocator *upstream = &ta;
+            switch (CONFIG) {
+              case 'a': {
+                objPtr = new (ta) Obj();
+                upstream = &da;
+              } break;
+              case 'b': {
+                objPtr = new (ta) Obj(&ta);
+              } break;
+              case 'c': {
+                objPtr = new (ta) Obj(CON);
+                upstream = &da;
+              } break;
+              case 'd': {
+                objPtr = new (ta) Obj(GEO, &ta);
+              } break;
+              case 'e': {
+                objPtr = new (ta) Obj(32, CON);
+                upstream = &da;
+              } break;
+              case 'f': {
+                objPtr = new (ta) Obj(32, GEO, &ta);
+              } break;
+              case 'g': {
+                objPtr = new (ta) Obj(32, 4096, GEO);
+                upstream = &da;
+              } break;
+              case 'h': {
+                objPtr = new (ta) Obj(1, 1, CON, &ta);
+              } break;
+              default: {
+                ASSERTV(CONFIG, !"Bad allocator config.");
+                return testStatus;                                    // RETURN
+              } break;
+            }
+            Obj& mX = *objPtr;  const Obj& X = mX;
+
+            LOOP_ASSERT(CONFIG, upstream == X.allocator());
+            LOOP_ASSERT(CONFIG, 0 == da.numBlocksInUse());
+            LOOP_ASSERT(CONFIG, 1 == ta.numBlocksInUse());
+
+            LOOP_ASSERT(CONFIG, 0 == mX.allocate(0));
+            LOOP_ASSERT(CONFIG, 0 == da.numBlocksInUse());
+            LOOP_ASSERT(CONFIG, 1 == ta.numBlocksInUse());
+
+            enum { NUM_ALLOCS = 300 };
+
+            char      *blocks[NUM_ALLOCS];
+            size_type  sizes[NUM_ALLOCS];
+            for (int i = 0; i < NUM_ALLOCS; ++i) {
+                sizes[i]  = (i * 7) % 70 + 1;
+                blocks[i] = static_cast<char *>(mX.allocate(sizes[i]));
+                LOOP2_ASSERT(CONFIG, i, blocks[i]);
+                LOOP2_ASSERT(CONFIG, i,
+                             isNaturallyAligned(blocks[i], sizes[i]));
+                memset(blocks[i], i & 0xff, sizes[i]);
+            }
+            for (int i = 0; i < NUM_ALLOCS; ++i) {
+                for (size_type j = 0; j < sizes[i]; ++j) {
+                    LOOP3_ASSERT(CONFIG, i, j, (i & 0xff) ==
+                                 static_cast<unsigned char>(blocks[i][j]));
+                }
+            }
+            LOOP_ASSERT(CONFIG, 0 < upstream->numBlocksInUse());
+
+            const bsls::Types::Int64 NUM_BYTES = da.numBytesInUse()
+                                               + ta.numBytesInUse();
+            for (int i = 0; i < NUM_ALLOCS; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            mX.deallocate(0);
+            LOOP_ASSERT(CONFIG,
+                        NUM_BYTES == da.numBytesInUse() + ta.numBytesInUse());
+
+            ta.deleteObject(objPtr);
+            LOOP_ASSERT(CONFIG, 0 == da.numBlocksInUse());
+            LOOP_ASSERT(CONFIG, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_PASS(Obj(1, GEO, &ta));
+            ASSERT_FAIL(Obj(0, GEO, &ta));
+
+            ASSERT_PASS(Obj(1, 1, GEO, &ta));
+            ASSERT_FAIL(Obj(size_type(0), 1, GEO, &ta));
+            ASSERT_FAIL(Obj(2, 1, GEO, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an allocator using a test allocator as upstream, allocate
+        //:   memory, and verify that blocks are obtained and returned as
+        //:   expected.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+        {
+            Obj mX(&ta);
+            ASSERT(0 == ta.numBlocksTotal());
+
+            void *p = mX.allocate(4);
+            void *q = mX.allocate(4);
+            ASSERT(p);
+            ASSERT(q);
+            ASSERT(p != q);
+            ASSERT(1 == ta.numBlocksInUse());
+
+            mX.deallocate(p);
+            ASSERT(1 == ta.numBlocksInUse());
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.allocate(8);
+            }
+            ASSERT(1 < ta.numBlocksInUse());
+
+            mX.rewind();
+            ASSERT(1 < ta.numBlocksInUse());
+
+            mX.release();
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'NewDeleteAllocator'
+        //
+        // Concerns:
+        //: 1 Allocating from a sequential allocator, and reclaiming all of the
+        //:   memory with 'rewind', is substantially faster than allocating
+        //:   and deallocating each block with 'bslma::NewDeleteAllocator'.
+        //
+        // Plan:
+        //: 1 Time the allocation (and, for 'NewDeleteAllocator', the
+        //:   deallocation) of many small blocks with each allocator, and
+        //:   report the allocation rates.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'NewDeleteAllocator'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                  "\nPERFORMANCE: COMPARISON WITH 'NewDeleteAllocator'"
+                  "\n=================================================\n");
+
+        enum { NUM_ALLOCS = 1000, NUM_ROUNDS = 1000 };
+
+        static void *blocks[NUM_ALLOCS];
+
+        bslma::NewDeleteAllocator& nda =
+                                       bslma::NewDeleteAllocator::singleton();
+        Obj                        mX;
+
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int r = 0; r < NUM_ROUNDS; ++r) {
+            for (int i = 0; i < NUM_ALLOCS; ++i) {
+                blocks[i] = nda.allocate(i % 64 + 1);
+            }
+            for (int i = 0; i < NUM_ALLOCS; ++i) {
+                nda.deallocate(blocks[i]);
+            }
+        }
+        timer.stop();
+        const double newDeleteTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int r = 0; r < NUM_ROUNDS; ++r) {
+            for (int i = 0; i < NUM_ALLOCS; ++i) {
+                blocks[i] = mX.allocate(i % 64 + 1);
+            }
+            mX.rewind();
+        }
+        timer.stop();
+        const double sequentialTime = timer.elapsedTime();
+
+        const double NUM_TOTAL = static_cast<double>(NUM_ALLOCS) * NUM_ROUNDS;
+
+        printf("NewDeleteAllocator:  %g allocations/s\n",
+               NUM_TOTAL / newDeleteTime);
+        printf("SequentialAllocator: %g allocations/s\n",
+               NUM_TOTAL / sequentialTime);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
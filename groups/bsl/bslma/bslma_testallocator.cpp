@@ -759,6 +759,46 @@ void TestAllocator::deallocate(void *address)
     d_allocator_p->deallocate(align);
 }
 
+void TestAllocator::deallocateSized(void *address, size_type size)
+{
+    if (0 != address) {
+        Align *align = ((Align *) address) - 1;
+
+        // The size is checked only if the header is that of a block currently
+        // allocated from this object; otherwise 'deallocate' reports the
+        // error.
+
+        if (ALLOCATED_MEMORY == align->d_object.d_magicNumber
+         && this             == align->d_object.d_id_p
+         && size             != align->d_object.d_bytes) {
+            ++d_numDeallocations;
+            d_lastDeallocatedAddress_p = address;
+            d_lastDeallocatedNumBytes  = 0;
+
+            ++d_numMismatches;
+
+            if (d_quietFlag) {
+                return;                                               // RETURN
+            }
+
+            std::printf("*** Deallocating %lld byte segment at %p with"
+                        " size %lld. ***\n",
+                        static_cast<bsls::Types::Int64>(
+                                                     align->d_object.d_bytes),
+                        address,
+                        static_cast<bsls::Types::Int64>(size));
+            std::fflush(stdout);
+
+            if (d_noAbortFlag) {
+                return;                                               // RETURN
+            }
+            std::abort();                                             // ABORT
+        }
+    }
+
+    deallocate(address);
+}
+
 // ACCESSORS
 int TestAllocator::status() const
 {
@@ -73,6 +73,11 @@ BSLS_IDENT("$Id: $")
 // deallocation to see if they have been modified.  If they have, a message is
 // printed and the allocator aborts, unless it is in quiet mode.
 //
+// Similarly, a block returned through 'deallocateSized' with a size other than
+// the size originally requested for it is flagged as a mismatch, so that
+// clients of sized deallocation (e.g., containers) are checked to supply the
+// correct size.
+//
 ///Modes
 ///-----
 // The test allocator's behavior is controlled by three basic *mode* flags:
@@ -467,6 +472,16 @@ class TestAllocator : public Allocator {
         // details of the mismatch to 'stdout' (e.g., as an 'std::hex' memory
         // dump) and abort.
 
+    void deallocateSized(void *address, size_type size);
+        // Return the memory block at the specified 'address', having the
+        // specified 'size' (in bytes), back to this allocator.  If 'address'
+        // is 0, this function has no effect.  If the memory at 'address' is
+        // consistent with being allocated from this test allocator, but
+        // 'size' differs from the size (in bytes) originally requested for
+        // this block, increment the number of mismatches, and -- unless in
+        // quiet mode -- immediately report the details of the mismatch to
+        // 'stdout' and abort.  Otherwise, behave as 'deallocate(address)'.
+
     void setAllocationLimit(bsls::Types::Int64 limit);
         // Set the number of valid allocation requests before an exception is
         // to be thrown for this allocator to the specified 'limit'.  If
@@ -51,6 +51,7 @@ using namespace std;
 // [ 2] ~bslma::TestAllocator();
 // [ 3] void *allocate(int size);
 // [ 3] void deallocate(void *address);
+// [13] void deallocateSized(void *address, size_type size);
 // [ 2] void setNoAbort(int noAbortFlag);
 // [ 2] void setQuiet(int quietFlag);
 // [ 2] void setVerbose(int verboseFlag);
@@ -77,7 +78,7 @@ using namespace std;
 //
 // [ 4] ostream& operator<<(ostream& lhs, const bslma::TestAllocator& rhs);
 //-----------------------------------------------------------------------------
-// [ 9] USAGE TEST - Make sure usage example for exception neutrality works.
+// [14] USAGE TEST - Make sure usage example for exception neutrality works.
 // [ 5] Ensure that exception is thrown after allocation limit is exceeded.
 // [ 1] Make sure that all counts are initialized to zero (placement new).
 // [ 1] Make sure that global operators new and delete are *not* called.
@@ -92,6 +93,7 @@ using namespace std;
 // [ 8] Ensure that cross allocation/deallocation is detected immediately.
 // [10] Test 'numBlocksInUse', 'numBlocksTotal'
 // [11] Ensure that over and underruns are properly caught.
+// [13] Ensure that sized deallocations of the wrong size are detected.
 //=============================================================================
 //                    STANDARD BDE ASSERT TEST MACRO
 //-----------------------------------------------------------------------------
@@ -439,7 +441,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator testAllocator(veryVeryVerbose);
 
     switch (test) { case 0:
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // TEST USAGE
         //   Verify that the usage example for testing exception neutrality is
@@ -556,6 +558,83 @@ int main(int argc, char *argv[])
 // indicate whether or not exceptions are enabled.
 
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TEST SIZED DEALLOCATION
+        //   Ensure that a block returned by 'deallocateSized' with the size
+        //   originally requested for it is deallocated exactly as by
+        //   'deallocate', and that a block returned with any other size is
+        //   detected and logged in the 'numMismatches' counter without being
+        //   deallocated.
+        //
+        // Testing:
+        //   void deallocateSized(void *address, size_type size);
+        //   Ensure that sized deallocations of the wrong size are detected.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TEST SIZED DEALLOCATION" << endl
+                                  << "=======================" << endl;
+
+        bslma::TestAllocator a(veryVeryVerbose);
+        a.setNoAbort(verbose); a.setQuiet(!veryVerbose);
+
+        if (verbose) cout << "\nDeallocating a null pointer." << endl;
+        {
+            a.deallocateSized(0, 0);
+            ASSERT(1 == a.numDeallocations());
+            ASSERT(0 == a.numMismatches());
+        }
+
+        if (verbose) cout << "\nDeallocating with the correct size." << endl;
+        {
+            void *p = a.allocate(7);
+            ASSERT(1 == a.numBlocksInUse());
+
+            a.deallocateSized(p, 7);
+            ASSERT(0 == a.numBlocksInUse());
+            ASSERT(0 == a.numBytesInUse());
+            ASSERT(2 == a.numDeallocations());
+            ASSERT(p == a.lastDeallocatedAddress());
+            ASSERT(7 == a.lastDeallocatedNumBytes());
+            ASSERT(0 == a.numMismatches());
+            ASSERT(0 == a.status());
+        }
+
+        if (verbose) cout << "\nDeallocating with a wrong size." << endl;
+        {
+            void *p = a.allocate(7);
+            ASSERT(1 == a.numBlocksInUse());
+
+            a.deallocateSized(p, 8);
+            ASSERT(1 == a.numBlocksInUse());
+            ASSERT(7 == a.numBytesInUse());
+            ASSERT(3 == a.numDeallocations());
+            ASSERT(p == a.lastDeallocatedAddress());
+            ASSERT(0 == a.lastDeallocatedNumBytes());
+            ASSERT(1 == a.numMismatches());
+
+            a.deallocateSized(p, 6);
+            ASSERT(1 == a.numBlocksInUse());
+            ASSERT(2 == a.numMismatches());
+
+            a.deallocateSized(p, 7);
+            ASSERT(0 == a.numBlocksInUse());
+            ASSERT(2 == a.numMismatches());
+            ASSERT(2 == a.status());
+        }
+
+        if (verbose) cout << "\nDeallocating a deallocated block." << endl;
+        {
+            void *p = a.allocate(5);
+            a.deallocate(p);
+            ASSERT(2 == a.numMismatches());
+
+            // The mismatch is detected, and counted once, by 'deallocate'.
+
+            a.deallocateSized(p, 3);
+            ASSERT(3 == a.numMismatches());
+        }
+      } break;
      case 12: {
         // --------------------------------------------------------------------
         // TEST 'print' METHOD
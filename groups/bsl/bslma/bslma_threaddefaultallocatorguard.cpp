@@ -0,0 +1,59 @@
+// bslma_threaddefaultallocatorguard.cpp                              -*-C++-*-
+#include <bslma_threaddefaultallocatorguard.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_default.h>
+#include <bslma_sequentialallocator.h>     // for testing only
+#include <bslma_testallocator.h>           // for testing only
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+
+namespace bslma {
+
+                     // ---------------------------------
+                     // class ThreadDefaultAllocatorGuard
+                     // ---------------------------------
+
+// CREATORS
+ThreadDefaultAllocatorGuard::ThreadDefaultAllocatorGuard(Allocator *temporary)
+: d_original_p(Default::setThreadDefaultAllocator(temporary))
+, d_temporary_p(temporary)
+{
+    BSLS_ASSERT(temporary);
+}
+
+ThreadDefaultAllocatorGuard::~ThreadDefaultAllocatorGuard()
+{
+    BSLS_ASSERT(d_temporary_p == Default::threadDefaultAllocator());
+
+    Default::setThreadDefaultAllocator(d_original_p);
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
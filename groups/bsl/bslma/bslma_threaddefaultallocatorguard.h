@@ -0,0 +1,176 @@
+// bslma_threaddefaultallocatorguard.h                                -*-C++-*-
+#ifndef INCLUDED_BSLMA_THREADDEFAULTALLOCATORGUARD
+#define INCLUDED_BSLMA_THREADDEFAULTALLOCATORGUARD
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a scoped guard to install a thread default allocator.
+//
+//@CLASSES:
+//  bslma::ThreadDefaultAllocatorGuard: thread-default-allocator scoped guard
+//
+//@SEE_ALSO: bslma_default, bslma_defaultallocatorguard
+//
+//@DESCRIPTION: This component provides an object,
+// 'bslma::ThreadDefaultAllocatorGuard', that serves as a "scoped guard" to
+// install an allocator as the *thread* *default* *allocator* of the calling
+// thread (see the "Thread Default Allocator" section of 'bslma_default') for
+// the lifetime of the guard.  While the guard is in scope,
+// 'bslma::Default::defaultAllocator', and 'bslma::Default::allocator' with no
+// argument or an explicit 0, return the guarded allocator when called from
+// the thread that created the guard, so that all of the objects created on
+// that thread without an explicit allocator (including temporaries created
+// deep within libraries) obtain their memory from it.  Upon destruction of
+// the guard, the thread default allocator that was in effect when the guard
+// was created (if any) is reinstated.  Other threads are unaffected.
+//
+// Unlike 'bslma::DefaultAllocatorGuard', which replaces the process-wide
+// default allocator and is intended for testing only, this guard is suitable
+// for use in production code, e.g., to direct the allocations made while
+// processing a request on a worker thread to an arena dedicated to that
+// request.  Guards may be nested, and must be destroyed in the reverse order
+// of their creation, on the thread that created them (as is naturally the
+// case for objects of automatic storage duration).
+//
+// Note that an object that is created on a thread while a guard is in scope,
+// and that uses the default allocator, must not outlive the guarded
+// allocator; in particular, such objects must not be passed to other threads
+// that may outlive it.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Directing the Temporaries of a Worker Thread to an Arena
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the worker threads of a server process requests by calling a
+// library function that creates temporary objects using the default
+// allocator, and that we want these temporaries to be allocated from a
+// sequential (monotonic) arena that is discarded after each request.
+//
+// First, we define a function, 'processRequest', standing in for the library
+// function, that allocates temporary memory from the default allocator:
+//..
+//  int processRequest(int request)
+//      // Process the specified 'request', and return the result.
+//  {
+//      bslma::Allocator *allocator = bslma::Default::allocator();
+//
+//      int *buffer = static_cast<int *>(
+//                                    allocator->allocate(100 * sizeof(int)));
+//      for (int i = 0; i < 100; ++i) {
+//          buffer[i] = request + i;
+//      }
+//      const int result = buffer[99];
+//      allocator->deallocate(buffer);
+//
+//      return result;
+//  }
+//..
+// Then, on the worker thread, we create an arena for the request, and a guard
+// that installs the arena as the default allocator of the thread while the
+// request is processed:
+//..
+//  bslma::TestAllocator       upstream;
+//  bslma::SequentialAllocator arena(&upstream);
+//  {
+//      bslma::ThreadDefaultAllocatorGuard guard(&arena);
+//      assert(&arena == bslma::Default::defaultAllocator());
+//
+//      const int result = processRequest(1);
+//      assert(100 == result);
+//  }
+//..
+// Next, we observe that the temporary memory was obtained from the arena,
+// and that the default allocator of the thread has been restored:
+//..
+//  assert(0 < upstream.numBlocksInUse());
+//  assert(&arena != bslma::Default::defaultAllocator());
+//..
+// Finally, we discard the memory of the request all at once:
+//..
+//  arena.release();
+//  assert(0 == upstream.numBlocksInUse());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslma {
+
+class Allocator;
+
+                     // =================================
+                     // class ThreadDefaultAllocatorGuard
+                     // =================================
+
+class ThreadDefaultAllocatorGuard {
+    // Upon construction, an object of this class saves the thread default
+    // allocator of the calling thread (if any) and installs the user-specified
+    // allocator as the thread default allocator of the calling thread.  On
+    // destruction, the original thread default allocator is reinstated.
+
+    // DATA
+    Allocator *d_original_p;   // original thread default allocator, or 0 if
+                               // none (to be restored at destruction)
+
+    Allocator *d_temporary_p;  // thread default allocator installed by this
+                               // guard
+
+    // NOT IMPLEMENTED
+    ThreadDefaultAllocatorGuard(const ThreadDefaultAllocatorGuard&);
+    ThreadDefaultAllocatorGuard& operator=(
+                                           const ThreadDefaultAllocatorGuard&);
+
+  public:
+    // CREATORS
+    explicit ThreadDefaultAllocatorGuard(Allocator *temporary);
+        // Create a scoped guard that installs the specified 'temporary'
+        // allocator as the thread default allocator of the calling thread.
+        // The behavior is undefined unless 'temporary' outlives all of the
+        // objects that obtain it from 'bslma::Default' on the calling thread
+        // while this guard is in scope.  Note that the original thread
+        // default allocator of the calling thread is automatically reinstated
+        // on destruction.
+
+    ~ThreadDefaultAllocatorGuard();
+        // Reinstate the thread default allocator of the calling thread that
+        // was in effect when this scoped guard was created, and destroy this
+        // guard.  The behavior is undefined unless this guard is destroyed on
+        // the thread that created it, and unless every guard created on that
+        // thread after this one has already been destroyed.
+};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,460 @@
+// bslma_threaddefaultallocatorguard.t.cpp                            -*-C++-*-
+
+#include <bslma_threaddefaultallocatorguard.h>
+
+#include <bslma_allocator.h>               // for testing only
+#include <bslma_default.h>                 // for testing only
+#include <bslma_defaultallocatorguard.h>   // for testing only
+#include <bslma_newdeleteallocator.h>      // for testing only
+#include <bslma_sequentialallocator.h>     // for testing only
+#include <bslma_testallocator.h>           // for testing only
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// For thread support
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE thread_t;
+#else
+#include <pthread.h>
+typedef pthread_t thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test "guards" the thread default allocator of the
+// calling thread, which is to say that an instance of this object saves the
+// thread default allocator (if any) of the calling thread and installs a new
+// one (from the constructor argument) on construction, and reinstates the
+// original one on destruction.  We verify this behavior for single and nested
+// guards, that the process-wide default allocator and the default allocators
+// of other threads are unaffected, and that 'bslma::DefaultAllocatorGuard'
+// saves and restores the process-wide default allocator even when used within
+// the scope of a thread default allocator guard.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit ThreadDefaultAllocatorGuard(Allocator *temporary);
+// [ 2] ~ThreadDefaultAllocatorGuard();
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: OTHER THREADS ARE UNAFFECTED
+// [ 4] CONCERN: INTERACTION WITH 'bslma::DefaultAllocatorGuard'
+// [ 5] USAGE EXAMPLE
+//=============================================================================
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslma::ThreadDefaultAllocatorGuard Obj;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef void *(*thread_func)(void *arg);
+
+static thread_t createThread(thread_func func, void *arg)
+    // Create a thread running the specified 'func' with the specified 'arg',
+    // and return its handle.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE) func, arg, 0, 0);
+#else
+    thread_t thr;
+    pthread_create(&thr, 0, func, arg);
+    return thr;
+#endif
+}
+
+static void joinThread(thread_t thr)
+    // Wait for the thread having the specified handle 'thr' to complete.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(thr, INFINITE);
+    CloseHandle(thr);
+#else
+    pthread_join(thr, 0);
+#endif
+}
+
+struct ThreadParam {
+    // This 'struct' holds the arguments and results of 'guardingThread'.
+
+    bslma::Allocator *d_allocator_p;  // allocator to guard
+    bslma::Allocator *d_before_p;     // default before the guard
+    bslma::Allocator *d_during_p;     // default within the guard
+    bslma::Allocator *d_after_p;      // default after the guard
+};
+
+extern "C" void *guardingThread(void *arg)
+    // Load into the 'ThreadParam' at the specified 'arg' the default
+    // allocator of the calling thread before, within, and after the scope of
+    // a guard of the allocator specified by that object.
+{
+    ThreadParam& param = *static_cast<ThreadParam *>(arg);
+
+    param.d_before_p = bslma::Default::defaultAllocator();
+    {
+        Obj guard(param.d_allocator_p);
+        param.d_during_p = bslma::Default::defaultAllocator();
+    }
+    param.d_after_p = bslma::Default::defaultAllocator();
+    return 0;
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+int processRequest(int request)
+    // Process the specified 'request', and return the result.
+{
+    bslma::Allocator *allocator = bslma::Default::allocator();
+
+    int *buffer = static_cast<int *>(allocator->allocate(100 * sizeof(int)));
+    for (int i = 0; i < 100; ++i) {
+        buffer[i] = request + i;
+    }
+    const int result = buffer[99];
+    allocator->deallocate(buffer);
+
+    return result;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::Allocator *NDA = &bslma::NewDeleteAllocator::singleton();
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove
+        //   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, on the worker thread, we create an arena for the request, and a guard
+// that installs the arena as the default allocator of the thread while the
+// request is processed:
+//..
+    bslma::TestAllocator       upstream;
+    bslma::SequentialAllocator arena(&upstream);
+    {
+        bslma::ThreadDefaultAllocatorGuard guard(&arena);
+        ASSERT(&arena == bslma::Default::defaultAllocator());
+
+        const int result = processRequest(1);
+        ASSERT(100 == result);
+    }
+//..
+// Next, we observe that the temporary memory was obtained from the arena,
+// and that the default allocator of the thread has been restored:
+//..
+    ASSERT(0 < upstream.numBlocksInUse());
+    ASSERT(&arena != bslma::Default::defaultAllocator());
+//..
+// Finally, we discard the memory of the request all at once:
+//..
+    arena.release();
+    ASSERT(0 == upstream.numBlocksInUse());
+//..
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: INTERACTION WITH 'bslma::DefaultAllocatorGuard'
+        //
+        // Concerns:
+        //   1) Within the scope of a thread default allocator guard, a
+        //      'bslma::DefaultAllocatorGuard' replaces, and then restores,
+        //      the process-wide default allocator, and not the thread default
+        //      allocator.
+        //
+        // Plan:
+        //   Create a 'bslma::DefaultAllocatorGuard' within the scope of a
+        //   thread default allocator guard, and verify the default allocator
+        //   and the thread default allocator within and after its scope.
+        //
+        // Testing:
+        //   CONCERN: INTERACTION WITH 'bslma::DefaultAllocatorGuard'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCERN: INTERACTION WITH"
+                            " 'bslma::DefaultAllocatorGuard'"
+                            "\n========================="
+                            "===============================\n");
+
+        bslma::TestAllocator ta("thread", veryVerbose);
+        bslma::TestAllocator da("default", veryVerbose);
+
+        ASSERT(NDA == bslma::Default::defaultAllocator());
+        {
+            Obj mX(&ta);
+            ASSERT(&ta == bslma::Default::defaultAllocator());
+            {
+                bslma::DefaultAllocatorGuard guard(&da);
+                ASSERT(&ta == bslma::Default::defaultAllocator());
+                ASSERT(&ta == bslma::Default::threadDefaultAllocator());
+            }
+            ASSERT(&ta == bslma::Default::defaultAllocator());
+            ASSERT(&ta == bslma::Default::threadDefaultAllocator());
+        }
+        ASSERT(NDA == bslma::Default::defaultAllocator());
+        ASSERT(0   == bslma::Default::threadDefaultAllocator());
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCERN: OTHER THREADS ARE UNAFFECTED
+        //
+        // Concerns:
+        //   1) A guard affects only the thread that created it.
+        //
+        // Plan:
+        //   Within the scope of a guard created on the main thread, run a
+        //   thread that creates a guard of a distinct allocator, and verify
+        //   the default allocators observed by each thread.
+        //
+        // Testing:
+        //   CONCERN: OTHER THREADS ARE UNAFFECTED
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCERN: OTHER THREADS ARE UNAFFECTED"
+                            "\n=====================================\n");
+
+        bslma::TestAllocator ta("main", veryVerbose);
+        bslma::TestAllocator tb("other", veryVerbose);
+
+        {
+            Obj mX(&ta);
+
+            ThreadParam param = { &tb, 0, 0, 0 };
+            joinThread(createThread(&guardingThread, &param));
+
+            ASSERT(NDA == param.d_before_p);
+            ASSERT(&tb == param.d_during_p);
+            ASSERT(NDA == param.d_after_p);
+
+            ASSERT(&ta == bslma::Default::defaultAllocator());
+        }
+        ASSERT(NDA == bslma::Default::defaultAllocator());
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS
+        //
+        // Concerns:
+        //   1) The guard installs its allocator as the thread default
+        //      allocator of the calling thread, and reinstates the original
+        //      one (or none) on destruction.
+        //   2) Guards may be nested.
+        //   3) The process-wide default allocator is unaffected.
+        //   4) QoI: Asserted precondition violations are detected when
+        //      enabled.
+        //
+        // Plan:
+        //   Create nested guards, and verify the default allocator and the
+        //   thread default allocator within and after the scope of each.
+        //   Verify that, in appropriate build modes, defensive checks are
+        //   triggered for invalid arguments.
+        //
+        // Testing:
+        //   explicit ThreadDefaultAllocatorGuard(Allocator *temporary);
+        //   ~ThreadDefaultAllocatorGuard();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS"
+                            "\n========\n");
+
+        bslma::TestAllocator ta("a", veryVerbose);
+        bslma::TestAllocator tb("b", veryVerbose);
+        bslma::TestAllocator tc("c", veryVerbose);
+
+        ASSERT(0   == bslma::Default::threadDefaultAllocator());
+        ASSERT(NDA == bslma::Default::defaultAllocator());
+        {
+            Obj mX(&ta);
+            ASSERT(&ta == bslma::Default::threadDefaultAllocator());
+            ASSERT(&ta == bslma::Default::defaultAllocator());
+            ASSERT(&tb == bslma::Default::allocator(&tb));
+            {
+                Obj mY(&tb);
+                ASSERT(&tb == bslma::Default::threadDefaultAllocator());
+                ASSERT(&tb == bslma::Default::defaultAllocator());
+                {
+                    Obj mZ(&tc);
+                    ASSERT(&tc == bslma::Default::defaultAllocator());
+                }
+                ASSERT(&tb == bslma::Default::defaultAllocator());
+            }
+            ASSERT(&ta == bslma::Default::defaultAllocator());
+            {
+                Obj mY(&ta);
+                ASSERT(&ta == bslma::Default::defaultAllocator());
+            }
+            ASSERT(&ta == bslma::Default::threadDefaultAllocator());
+        }
+        ASSERT(0   == bslma::Default::threadDefaultAllocator());
+        ASSERT(NDA == bslma::Default::defaultAllocator());
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                          bsls::AssertTest::failTestDriver);
+
+            ASSERT_FAIL(Obj(static_cast<bslma::Allocator *>(0)));
+            ASSERT_PASS(Obj(static_cast<bslma::Allocator *>(&ta)));
+        }
+        ASSERT(0 == bslma::Default::threadDefaultAllocator());
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //   That the guard installs and reinstates the thread default
+        //   allocator of the calling thread.
+        //
+        // Plan:
+        //   Create a guard, allocate using the default allocator within its
+        //   scope, and verify that the memory is obtained from the guarded
+        //   allocator, and that the original default allocator is in effect
+        //   after the guard is destroyed.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta(veryVerbose);
+
+        ASSERT(NDA == bslma::Default::defaultAllocator());
+        {
+            Obj mX(&ta);
+            ASSERT(&ta == bslma::Default::defaultAllocator());
+
+            void *p = bslma::Default::allocator()->allocate(10);
+            ASSERT(1 == ta.numBlocksInUse());
+            bslma::Default::allocator()->deallocate(p);
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        ASSERT(NDA == bslma::Default::defaultAllocator());
+
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
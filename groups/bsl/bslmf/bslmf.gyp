@@ -42,6 +42,7 @@
       'bslmf_isreference.cpp',
       'bslmf_isrvaluereference.cpp',
       'bslmf_issame.cpp',
+      'bslmf_istransparent.cpp',
       'bslmf_istriviallycopyable.cpp',
       'bslmf_istriviallydefaultconstructible.cpp',
       'bslmf_isvoid.cpp',
@@ -105,6 +106,7 @@
       'bslmf_isreference.t',
       'bslmf_isrvaluereference.t',
       'bslmf_issame.t',
+      'bslmf_istransparent.t',
       'bslmf_istriviallycopyable.t',
       'bslmf_istriviallydefaultconstructible.t',
       'bslmf_isvoid.t',
@@ -168,6 +170,7 @@
       '<(PRODUCT_DIR)/bslmf_isreference.t',
       '<(PRODUCT_DIR)/bslmf_isrvaluereference.t',
       '<(PRODUCT_DIR)/bslmf_issame.t',
+      '<(PRODUCT_DIR)/bslmf_istransparent.t',
       '<(PRODUCT_DIR)/bslmf_istriviallycopyable.t',
       '<(PRODUCT_DIR)/bslmf_istriviallydefaultconstructible.t',
       '<(PRODUCT_DIR)/bslmf_isvoid.t',
@@ -570,6 +573,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslmf_issame.t.cpp' ],
     },
+    {
+      'target_name': 'bslmf_istransparent.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslmf_pkgdeps)', 'bslmf' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslmf_istransparent.t.cpp' ],
+    },
     {
       'target_name': 'bslmf_istriviallycopyable.t',
       'type': 'executable',
@@ -0,0 +1,227 @@
+// bslmf_istransparent.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLMF_ISTRANSPARENT
+#define INCLUDED_BSLMF_ISTRANSPARENT
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a compile-time check for transparent functor types.
+//
+//@CLASSES:
+//  bslmf::IsTransparent: meta-function detecting a nested 'is_transparent'
+//  bslmf::EnableIfTransparent: 'enable_if' conditioned on transparent functors
+//
+//@SEE_ALSO: bslmf_enableif, bslstl_map, bslstl_unorderedmap
+//
+//@DESCRIPTION: This component defines a meta-function,
+// 'bslmf::IsTransparent', that may be used to query whether a functor type
+// is *transparent*, i.e., whether it declares a nested type named
+// 'is_transparent'.  By the convention established by the C++14 standard
+// [associative.reqmts], a transparent comparator (or hasher) can be invoked
+// with arguments of types other than the key type of a container, and an
+// associative container whose functors are transparent accepts a key of any
+// such type in its lookup methods ('find', 'count', 'equal_range', etc.),
+// without first converting it to a (possibly temporary) object of the key
+// type.
+//
+// This component also defines a second meta-function,
+// 'bslmf::EnableIfTransparent', that behaves as 'bsl::enable_if' conditioned
+// on one (or two) functor types being transparent, and that additionally
+// takes the type of the lookup key as a template parameter.  Although the
+// lookup key type does not participate in the result, it makes the result
+// *dependent* on the template parameter of a member function template, so
+// that, for a container whose functors are not transparent, the member
+// function template is silently removed from the overload set (rather than
+// causing a compilation error when the container is instantiated).
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Detecting a Transparent Comparator
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a type, 'Employee', identified by an integer 'id', and
+// that we want to search an ordered container of 'Employee' objects by 'id'
+// alone, without creating an 'Employee' object to search for.
+//
+// First, we define 'Employee', and a comparator that can compare any
+// combination of 'Employee' objects and 'int' identifiers, and that
+// declares itself transparent:
+//..
+//  struct Employee {
+//      int         d_id;
+//      const char *d_name;
+//  };
+//
+//  struct EmployeeIdLess {
+//      typedef void is_transparent;
+//
+//      bool operator()(const Employee& lhs, const Employee& rhs) const
+//      {
+//          return lhs.d_id < rhs.d_id;
+//      }
+//      bool operator()(const Employee& lhs, int rhs) const
+//      {
+//          return lhs.d_id < rhs;
+//      }
+//      bool operator()(int lhs, const Employee& rhs) const
+//      {
+//          return lhs < rhs.d_id;
+//      }
+//  };
+//..
+// Then, we define a comparator that does not declare 'is_transparent':
+//..
+//  struct EmployeeLess {
+//      bool operator()(const Employee& lhs, const Employee& rhs) const
+//      {
+//          return lhs.d_id < rhs.d_id;
+//      }
+//  };
+//..
+// Now, we query whether each of the comparators, and a non-class type, is
+// transparent:
+//..
+//  assert(true  == bslmf::IsTransparent<EmployeeIdLess>::value);
+//  assert(false == bslmf::IsTransparent<EmployeeLess>::value);
+//  assert(false == bslmf::IsTransparent<int>::value);
+//..
+// Finally, we use 'bslmf::EnableIfTransparent' to declare a lookup function
+// template that accepts any key type only if the comparator is transparent:
+//..
+//  template <class COMPARATOR>
+//  struct EmployeeDirectory {
+//      template <class LOOKUP_KEY>
+//      typename bslmf::EnableIfTransparent<LOOKUP_KEY,
+//                                          bool,
+//                                          COMPARATOR>::type
+//      contains(const LOOKUP_KEY&) const
+//      {
+//          return true;
+//      }
+//
+//      bool contains(const Employee&) const
+//      {
+//          return false;
+//      }
+//  };
+//
+//  const Employee alice = { 17, "Alice" };
+//
+//  EmployeeDirectory<EmployeeIdLess> transparentDirectory;
+//  EmployeeDirectory<EmployeeLess>   directory;
+//
+//  assert(true  == transparentDirectory.contains(17));
+//  assert(false == transparentDirectory.contains(alice));
+//  assert(false == directory.contains(alice));
+//..
+// Notice that 'EmployeeDirectory<EmployeeLess>' can be instantiated even
+// though its 'COMPARATOR' is not transparent, and that, in that case, only
+// the non-template 'contains' is available.
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ENABLEIF
+#include <bslmf_enableif.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+namespace BloombergLP {
+namespace bslmf {
+
+                         // ========================
+                         // struct IsTransparent_Imp
+                         // ========================
+
+template <class TYPE>
+struct IsTransparent_Imp {
+    // This 'struct' template implements a meta-function to determine whether
+    // the (template parameter) 'TYPE' declares a nested type named
+    // 'is_transparent'.
+
+    template <class NESTED>
+    struct Tag {
+        // This empty 'struct' can be instantiated for any 'NESTED' type
+        // (including 'void' and reference types).
+    };
+
+    typedef char YesType;
+    struct NoType { char d_dummy[2]; };
+
+    template <class OTHER>
+    static YesType test(Tag<typename OTHER::is_transparent> *);
+    template <class OTHER>
+    static NoType  test(...);
+        // Declared but not defined.  Only the return types are used.
+
+    enum { VALUE = sizeof(test<TYPE>(0)) == sizeof(YesType) };
+};
+
+                           // ====================
+                           // struct IsTransparent
+                           // ====================
+
+template <class TYPE>
+struct IsTransparent
+    : bsl::integral_constant<bool, IsTransparent_Imp<TYPE>::VALUE> {
+    // This 'struct' template implements a meta-function to determine whether
+    // the (template parameter) 'TYPE' is a transparent functor type, i.e.,
+    // declares a nested type named 'is_transparent'.  This 'struct' derives
+    // from 'bsl::true_type' if 'TYPE' is transparent, and 'bsl::false_type'
+    // otherwise (including when 'TYPE' is not a class type).
+};
+
+                        // ==========================
+                        // struct EnableIfTransparent
+                        // ==========================
+
+template <class LOOKUP_KEY,
+          class RESULT_TYPE,
+          class FUNCTOR,
+          class OTHER_FUNCTOR = FUNCTOR>
+struct EnableIfTransparent
+    : bsl::enable_if<IsTransparent<FUNCTOR>::value
+                  && IsTransparent<OTHER_FUNCTOR>::value,
+                     RESULT_TYPE> {
+    // This 'struct' template provides a 'typedef' 'type' that is an alias to
+    // the (template parameter) 'RESULT_TYPE' if both the (template parameter)
+    // types 'FUNCTOR' and 'OTHER_FUNCTOR' are transparent; otherwise, 'type'
+    // is not provided.  The (template parameter) 'LOOKUP_KEY' does not affect
+    // the result; it should be the type deduced for the key argument of the
+    // member function template whose return type is 'type', so that the
+    // return type depends on that deduction (see {Description}).
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,435 @@
+// bslmf_istransparent.t.cpp                                          -*-C++-*-
+#include <bslmf_istransparent.h>
+
+#include <bslmf_issame.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>   // 'printf'
+#include <stdlib.h>  // 'atoi'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                TEST PLAN
+//-----------------------------------------------------------------------------
+//                                Overview
+//                                --------
+// The component under test defines two meta-functions: 'bslmf::IsTransparent',
+// which determines whether a type declares a nested 'is_transparent' type,
+// and 'bslmf::EnableIfTransparent', which provides a 'type' only if one or two
+// functor types are transparent.  We need to ensure that 'IsTransparent' is
+// correct for each category of types (including non-class types, and
+// 'is_transparent' declared as 'void', as a class, and as a reference type),
+// and that 'EnableIfTransparent' can be used to remove a member function
+// template from an overload set without preventing the instantiation of its
+// enclosing class template.
+//
+//-----------------------------------------------------------------------------
+// [ 2] bslmf::IsTransparent::value
+// [ 2] bslmf::IsTransparent::type
+// [ 3] bslmf::EnableIfTransparent::type
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct Empty {
+    // This 'struct' does not declare 'is_transparent'.
+};
+
+struct Incomplete;
+    // A forward declaration for the type that shall remain incomplete for this
+    // whole translation unit.
+
+struct TransparentVoid {
+    // This 'struct' declares 'is_transparent' as 'void'.
+
+    typedef void is_transparent;
+};
+
+struct TransparentClass {
+    // This 'struct' declares 'is_transparent' as a class type.
+
+    struct is_transparent {};
+};
+
+struct TransparentReference {
+    // This 'struct' declares 'is_transparent' as a reference type.
+
+    typedef int& is_transparent;
+};
+
+struct TransparentDerived : TransparentVoid {
+    // This 'struct' inherits 'is_transparent' from its base class.
+};
+
+struct NotTransparentMember {
+    // This 'struct' has a data member (rather than a type) named
+    // 'is_transparent'.
+
+    int is_transparent;
+};
+
+template <class FUNCTOR>
+struct Lookup {
+    // This 'struct' provides a 'find' function template accepting any key
+    // type only if the (template parameter) 'FUNCTOR' is transparent, and a
+    // 'find' function accepting only 'long'.
+
+    template <class LOOKUP_KEY>
+    typename bslmf::EnableIfTransparent<LOOKUP_KEY, int, FUNCTOR>::type
+    find(const LOOKUP_KEY&) const
+        // Return 1.
+    {
+        return 1;
+    }
+
+    int find(const long&) const
+        // Return 0.
+    {
+        return 0;
+    }
+};
+
+template <class HASHER, class EQUAL>
+struct HashLookup {
+    // This 'struct' provides a 'find' function template accepting any key
+    // type only if both the (template parameter) 'HASHER' and 'EQUAL' are
+    // transparent, and a 'find' function accepting only 'long'.
+
+    template <class LOOKUP_KEY>
+    typename bslmf::EnableIfTransparent<LOOKUP_KEY, int, HASHER, EQUAL>::type
+    find(const LOOKUP_KEY&) const
+        // Return 1.
+    {
+        return 1;
+    }
+
+    int find(const long&) const
+        // Return 0.
+    {
+        return 0;
+    }
+};
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace UsageExample {
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Detecting a Transparent Comparator
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a type, 'Employee', identified by an integer 'id', and
+// that we want to search an ordered container of 'Employee' objects by 'id'
+// alone, without creating an 'Employee' object to search for.
+//
+// First, we define 'Employee', and a comparator that can compare any
+// combination of 'Employee' objects and 'int' identifiers, and that
+// declares itself transparent:
+//..
+    struct Employee {
+        int         d_id;
+        const char *d_name;
+    };
+
+    struct EmployeeIdLess {
+        typedef void is_transparent;
+
+        bool operator()(const Employee& lhs, const Employee& rhs) const
+        {
+            return lhs.d_id < rhs.d_id;
+        }
+        bool operator()(const Employee& lhs, int rhs) const
+        {
+            return lhs.d_id < rhs;
+        }
+        bool operator()(int lhs, const Employee& rhs) const
+        {
+            return lhs < rhs.d_id;
+        }
+    };
+//..
+// Then, we define a comparator that does not declare 'is_transparent':
+//..
+    struct EmployeeLess {
+        bool operator()(const Employee& lhs, const Employee& rhs) const
+        {
+            return lhs.d_id < rhs.d_id;
+        }
+    };
+//..
+
+    template <class COMPARATOR>
+    struct EmployeeDirectory {
+        template <class LOOKUP_KEY>
+        typename bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                            bool,
+                                            COMPARATOR>::type
+        contains(const LOOKUP_KEY&) const
+        {
+            return true;
+        }
+
+        bool contains(const Employee&) const
+        {
+            return false;
+        }
+    };
+
+}  // close namespace UsageExample
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+
+    setbuf(stdout, 0);  // Use unbuffered output.
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        using namespace UsageExample;
+
+// Now, we query whether each of the comparators, and a non-class type, is
+// transparent:
+//..
+    ASSERT(true  == bslmf::IsTransparent<EmployeeIdLess>::value);
+    ASSERT(false == bslmf::IsTransparent<EmployeeLess>::value);
+    ASSERT(false == bslmf::IsTransparent<int>::value);
+//..
+// Finally, we use 'bslmf::EnableIfTransparent' to declare a lookup function
+// template that accepts any key type only if the comparator is transparent
+// (see 'EmployeeDirectory' above), and verify the overload selected:
+//..
+    const Employee alice = { 17, "Alice" };
+
+    EmployeeDirectory<EmployeeIdLess> transparentDirectory;
+    EmployeeDirectory<EmployeeLess>   directory;
+
+    ASSERT(true  == transparentDirectory.contains(17));
+    ASSERT(false == transparentDirectory.contains(alice));
+    ASSERT(false == directory.contains(alice));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'bslmf::EnableIfTransparent'
+        //
+        // Concerns:
+        //: 1 A class template declaring a member function template whose
+        //:   return type is 'EnableIfTransparent<...>::type' can be
+        //:   instantiated whether or not its functors are transparent.
+        //:
+        //: 2 The member function template participates in overload resolution
+        //:   only if all of its functors are transparent.
+        //:
+        //: 3 'type' is an alias for 'RESULT_TYPE'.
+        //
+        // Plan:
+        //: 1 Instantiate class templates having one and two functor
+        //:   parameters with transparent and non-transparent functors, and
+        //:   verify which 'find' overload is selected for an 'int' argument
+        //:   (which would otherwise convert to 'long').  (C-1..2)
+        //:
+        //: 2 Use 'bsl::is_same' to verify the 'type'.  (C-3)
+        //
+        // Testing:
+        //   bslmf::EnableIfTransparent::type
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'bslmf::EnableIfTransparent'"
+                            "\n====================================\n");
+
+        ASSERT(1 == Lookup<TransparentVoid>().find(3));
+        ASSERT(1 == Lookup<TransparentClass>().find(3));
+        ASSERT(0 == Lookup<TransparentVoid>().find(3L));
+        ASSERT(0 == Lookup<Empty>().find(3));
+        ASSERT(0 == Lookup<int>().find(3));
+
+        ASSERT(1 == (HashLookup<TransparentVoid, TransparentClass>().find(3)));
+        ASSERT(0 == (HashLookup<TransparentVoid, Empty>().find(3)));
+        ASSERT(0 == (HashLookup<Empty, TransparentVoid>().find(3)));
+        ASSERT(0 == (HashLookup<Empty, Empty>().find(3)));
+
+        ASSERT((bsl::is_same<
+                     bslmf::EnableIfTransparent<int,
+                                                double,
+                                                TransparentVoid>::type,
+                     double>::value));
+        ASSERT((bsl::is_same<
+                     bslmf::EnableIfTransparent<int,
+                                                const char *,
+                                                TransparentVoid,
+                                                TransparentClass>::type,
+                     const char *>::value));
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'bslmf::IsTransparent'
+        //
+        // Concerns:
+        //: 1 'IsTransparent<TYPE>::value' is 'true' if 'TYPE' declares (or
+        //:   inherits) a nested type named 'is_transparent', whatever that
+        //:   type is, and 'false' otherwise.
+        //:
+        //: 2 'IsTransparent' can be instantiated for non-class types,
+        //:   including 'void', reference, function, and incomplete types.
+        //:
+        //: 3 'IsTransparent<TYPE>' derives from 'bsl::true_type' or
+        //:   'bsl::false_type'.
+        //
+        // Plan:
+        //: 1 Verify 'value' for types of each category.  (C-1..2)
+        //:
+        //: 2 Use 'bsl::is_same' to verify the nested 'type'.  (C-3)
+        //
+        // Testing:
+        //   bslmf::IsTransparent::value
+        //   bslmf::IsTransparent::type
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'bslmf::IsTransparent'"
+                            "\n==============================\n");
+
+        ASSERT( bslmf::IsTransparent<TransparentVoid>::value);
+        ASSERT( bslmf::IsTransparent<TransparentClass>::value);
+        ASSERT( bslmf::IsTransparent<TransparentReference>::value);
+        ASSERT( bslmf::IsTransparent<TransparentDerived>::value);
+
+        ASSERT(!bslmf::IsTransparent<Empty>::value);
+        ASSERT(!bslmf::IsTransparent<NotTransparentMember>::value);
+        ASSERT(!bslmf::IsTransparent<Incomplete>::value);
+        ASSERT(!bslmf::IsTransparent<void>::value);
+        ASSERT(!bslmf::IsTransparent<int>::value);
+        ASSERT(!bslmf::IsTransparent<int *>::value);
+        ASSERT(!bslmf::IsTransparent<TransparentVoid *>::value);
+        ASSERT(!bslmf::IsTransparent<TransparentVoid&>::value);
+        ASSERT(!bslmf::IsTransparent<bool(int, int)>::value);
+        ASSERT(!bslmf::IsTransparent<bool(*)(int, int)>::value);
+
+        ASSERT((bsl::is_same<bslmf::IsTransparent<TransparentVoid>::type,
+                             bsl::true_type>::value));
+        ASSERT((bsl::is_same<bslmf::IsTransparent<Empty>::type,
+                             bsl::false_type>::value));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   Developers' Sandbox.
+        //
+        // Plan:
+        //   Perform an ad-hoc test of the two meta-functions.
+        //
+        // Testing:
+        //   This "test" *exercises* basic functionality, but *tests* nothing.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        ASSERT( bslmf::IsTransparent<TransparentVoid>::value);
+        ASSERT(!bslmf::IsTransparent<Empty>::value);
+
+        ASSERT(1 == Lookup<TransparentVoid>().find(3));
+        ASSERT(0 == Lookup<Empty>().find(3));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
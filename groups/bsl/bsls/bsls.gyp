@@ -12,6 +12,7 @@
       'bsls_asserttest.cpp',
       'bsls_asserttestexception.cpp',
       'bsls_atomic.cpp',
+      'bsls_atomicdoubleword.cpp',
       'bsls_atomicoperations.cpp',
       'bsls_atomicoperations_default.cpp',
       'bsls_atomicoperations_ia64_hp_acc.cpp',
@@ -33,10 +34,12 @@
       'bsls_compilerfeatures.cpp',
       'bsls_exceptionutil.cpp',
       'bsls_ident.cpp',
+      'bsls_latencyhistogram.cpp',
       'bsls_macroincrement.cpp',
       'bsls_nativestd.cpp',
       'bsls_nullptr.cpp',
       'bsls_objectbuffer.cpp',
+      'bsls_performancecounters.cpp',
       'bsls_performancehint.cpp',
       'bsls_platform.cpp',
       'bsls_protocoltest.cpp',
@@ -58,6 +61,7 @@
       'bsls_asserttest.t',
       'bsls_asserttestexception.t',
       'bsls_atomic.t',
+      'bsls_atomicdoubleword.t',
       'bsls_atomicoperations.t',
       'bsls_atomicoperations_default.t',
       'bsls_atomicoperations_ia64_hp_acc.t',
@@ -79,10 +83,12 @@
       'bsls_compilerfeatures.t',
       'bsls_exceptionutil.t',
       'bsls_ident.t',
+      'bsls_latencyhistogram.t',
       'bsls_macroincrement.t',
       'bsls_nativestd.t',
       'bsls_nullptr.t',
       'bsls_objectbuffer.t',
+      'bsls_performancecounters.t',
       'bsls_performancehint.t',
       'bsls_platform.t',
       'bsls_protocoltest.t',
@@ -104,6 +110,7 @@
       '<(PRODUCT_DIR)/bsls_asserttest.t',
       '<(PRODUCT_DIR)/bsls_asserttestexception.t',
       '<(PRODUCT_DIR)/bsls_atomic.t',
+      '<(PRODUCT_DIR)/bsls_atomicdoubleword.t',
       '<(PRODUCT_DIR)/bsls_atomicoperations.t',
       '<(PRODUCT_DIR)/bsls_atomicoperations_default.t',
       '<(PRODUCT_DIR)/bsls_atomicoperations_ia64_hp_acc.t',
@@ -125,10 +132,12 @@
       '<(PRODUCT_DIR)/bsls_compilerfeatures.t',
       '<(PRODUCT_DIR)/bsls_exceptionutil.t',
       '<(PRODUCT_DIR)/bsls_ident.t',
+      '<(PRODUCT_DIR)/bsls_latencyhistogram.t',
       '<(PRODUCT_DIR)/bsls_macroincrement.t',
       '<(PRODUCT_DIR)/bsls_nativestd.t',
       '<(PRODUCT_DIR)/bsls_nullptr.t',
       '<(PRODUCT_DIR)/bsls_objectbuffer.t',
+      '<(PRODUCT_DIR)/bsls_performancecounters.t',
       '<(PRODUCT_DIR)/bsls_performancehint.t',
       '<(PRODUCT_DIR)/bsls_platform.t',
       '<(PRODUCT_DIR)/bsls_protocoltest.t',
@@ -283,6 +292,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bsls_atomic.t.cpp' ],
     },
+    {
+      'target_name': 'bsls_atomicdoubleword.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bsls_pkgdeps)', 'bsls' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bsls_atomicdoubleword.t.cpp' ],
+    },
     {
       'target_name': 'bsls_atomicoperations.t',
       'type': 'executable',
@@ -456,6 +473,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bsls_ident.t.cpp' ],
     },
+    {
+      'target_name': 'bsls_latencyhistogram.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bsls_pkgdeps)', 'bsls' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bsls_latencyhistogram.t.cpp' ],
+    },
     {
       'target_name': 'bsls_macroincrement.t',
       'type': 'executable',
@@ -488,6 +513,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bsls_objectbuffer.t.cpp' ],
     },
+    {
+      'target_name': 'bsls_performancecounters.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bsls_pkgdeps)', 'bsls' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bsls_performancecounters.t.cpp' ],
+    },
     {
       'target_name': 'bsls_performancehint.t',
       'type': 'executable',
@@ -19,6 +19,26 @@ BSLS_IDENT("$Id: $")
 // declares a 'typedef' ('Type'), which is an alias for a primitive type having
 // the indicated 'ALIGNMENT' requirement.
 //
+///Over-Aligned Types
+///------------------
+// No primitive type has an alignment requirement greater than the maximal
+// alignment of the platform (e.g., 16 bytes on x86-64), but a user-defined
+// type may be declared with a greater alignment requirement using a compiler
+// extension (e.g., to align it to a 64-byte cache line, or to the 32- or
+// 64-byte boundary required by SIMD instructions):
+//..
+//  struct __attribute__((aligned(64))) CacheLine {  // GCC and Clang
+//      char d_data[64];
+//  };
+//..
+// If 'ALIGNMENT' is such an *extended* alignment, 'bsls::AlignmentToType'
+// instead provides an empty 'struct' having the 'ALIGNMENT' requirement (and,
+// therefore, a size of 'ALIGNMENT').  Extended alignments that are powers of
+// 2, up to 4096, are supported on compilers providing an alignment extension
+// (GCC, Clang, and MSVC).  Consequently, 'bsls::AlignmentFromType', and the
+// buffer types based upon it (such as 'bsls::ObjectBuffer'), may be
+// instantiated for an over-aligned type on those compilers.
+//
 ///Usage
 ///-----
 // Consider a parameterized type, 'my_AlignedBuffer', that provides aligned
@@ -272,6 +292,85 @@ namespace BloombergLP {
 
 namespace bsls {
 
+                       // ==================================
+                       // struct AlignmentToType_OverAligned
+                       // ==================================
+
+template <int ALIGNMENT>
+struct AlignmentToType_OverAligned;
+    // This 'struct' template is specialized (below) for each supported
+    // extended 'ALIGNMENT' to provide an empty 'struct' having the 'ALIGNMENT'
+    // requirement.  It is declared but not defined for any other 'ALIGNMENT'.
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BSLS_ALIGNMENTTOTYPE_OVERALIGNED(ALIGNMENT)                           \
+    template <>                                                               \
+    struct __attribute__((aligned(ALIGNMENT)))                                \
+    AlignmentToType_OverAligned<ALIGNMENT> {                                  \
+    }
+#elif defined(BSLS_PLATFORM_CMP_MSVC)
+#define BSLS_ALIGNMENTTOTYPE_OVERALIGNED(ALIGNMENT)                           \
+    template <>                                                               \
+    struct __declspec(align(ALIGNMENT))                                       \
+    AlignmentToType_OverAligned<ALIGNMENT> {                                  \
+    }
+#endif
+
+#ifdef BSLS_ALIGNMENTTOTYPE_OVERALIGNED
+BSLS_ALIGNMENTTOTYPE_OVERALIGNED(32);
+BSLS_ALIGNMENTTOTYPE_OVERALIGNED(64);
+BSLS_ALIGNMENTTOTYPE_OVERALIGNED(128);
+BSLS_ALIGNMENTTOTYPE_OVERALIGNED(256);
+BSLS_ALIGNMENTTOTYPE_OVERALIGNED(512);
+BSLS_ALIGNMENTTOTYPE_OVERALIGNED(1024);
+BSLS_ALIGNMENTTOTYPE_OVERALIGNED(2048);
+BSLS_ALIGNMENTTOTYPE_OVERALIGNED(4096);
+#undef BSLS_ALIGNMENTTOTYPE_OVERALIGNED
+#endif
+
+                        // ============================
+                        // struct AlignmentToType_Match
+                        // ============================
+
+struct AlignmentToType_Match : AlignmentImpMatch {
+    // This 'struct' extends the overload set of 'AlignmentImpMatch::match'
+    // with an overload that is selected only if no primitive type has the
+    // requested alignment, and that returns a tag of the distinguished size
+    // 'k_OVER_ALIGNED'.
+
+    // TYPES
+    enum { k_OVER_ALIGNED = 128 };  // exceeds the priority of any primitive
+
+    // CLASS METHODS
+    using AlignmentImpMatch::match;
+
+    static AlignmentImpTag<k_OVER_ALIGNED> match(...);
+        // Match any alignment for which no primitive type matches.
+};
+
+                        // ==========================
+                        // struct AlignmentToType_Imp
+                        // ==========================
+
+template <int ALIGNMENT, int PRIORITY>
+struct AlignmentToType_Imp {
+    // This 'struct' provides a 'typedef', 'Type', that aliases the primitive
+    // type having the specified 'PRIORITY'.
+
+    // TYPES
+    typedef typename AlignmentImpPriorityToType<PRIORITY>::Type Type;
+};
+
+template <int ALIGNMENT>
+struct AlignmentToType_Imp<ALIGNMENT, AlignmentToType_Match::k_OVER_ALIGNED> {
+    // This partial specialization of 'AlignmentToType_Imp' provides a
+    // 'typedef', 'Type', that aliases an empty 'struct' having the specified
+    // extended 'ALIGNMENT' requirement.
+
+    // TYPES
+    typedef AlignmentToType_OverAligned<ALIGNMENT> Type;
+};
+
                          // ======================
                          // struct AlignmentToType
                          // ======================
@@ -279,7 +378,8 @@ namespace bsls {
 template <int ALIGNMENT>
 struct AlignmentToType {
     // This 'struct' provides a 'typedef', 'Type', that aliases a primitive
-    // type having the specified 'ALIGNMENT' requirement.
+    // type having the specified 'ALIGNMENT' requirement (or, for an extended
+    // 'ALIGNMENT', an empty 'struct' having that requirement).
 
   private:
     // PRIVATE TYPES
@@ -290,16 +390,17 @@ struct AlignmentToType {
         // Compute the priority of the primitive type corresponding to the
         // specified 'ALIGNMENT'.
 
-        PRIORITY = sizeof(AlignmentImpMatch::match(Tag(),
-                                                   Tag(),
-                                                   MaxPriority()))
+        PRIORITY = sizeof(AlignmentToType_Match::match(Tag(),
+                                                       Tag(),
+                                                       MaxPriority()))
     };
 
   public:
     // TYPES
-    typedef typename AlignmentImpPriorityToType<PRIORITY>::Type Type;
+    typedef typename AlignmentToType_Imp<ALIGNMENT, PRIORITY>::Type Type;
         // Alias for a primitive type that has the specified 'ALIGNMENT'
-        // requirement.
+        // requirement, or, if 'ALIGNMENT' is an extended alignment, for an
+        // empty 'struct' having the 'ALIGNMENT' requirement.
 };
 
 }  // close package namespace
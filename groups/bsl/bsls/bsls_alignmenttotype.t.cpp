@@ -30,8 +30,9 @@ using namespace std;
 // range of inputs.
 //-----------------------------------------------------------------------------
 // [ 1] bsls::AlignmentToType<N>::Type
+// [ 2] bsls::AlignmentToType<N>::Type (extended alignment)
 //-----------------------------------------------------------------------------
-// [ 2] USAGE EXAMPLE -- Ensure the usage example compiles and works.
+// [ 3] USAGE EXAMPLE -- Ensure the usage example compiles and works.
 //=============================================================================
 
 //-----------------------------------------------------------------------------
@@ -453,6 +454,20 @@ bool sameType(T1 t1, T2 t2)
     return samePtrType(&t1, &t2);
 }
 
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+struct __attribute__((aligned(64))) OverAligned {
+    // A type requiring an extended alignment of 64 bytes.
+
+    char d_c;
+};
+#elif defined(BSLS_PLATFORM_CMP_MSVC)
+struct __declspec(align(64)) OverAligned {
+    // A type requiring an extended alignment of 64 bytes.
+
+    char d_c;
+};
+#endif
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -466,7 +481,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 2: {
+      case 3: {
         // --------------------------------------------------------------------
         // USAGE TEST
         //   Make sure main usage examples compile and work as advertized.
@@ -501,6 +516,65 @@ int main(int argc, char *argv[])
     }
 //..
 
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING EXTENDED ALIGNMENTS
+        //
+        // Concerns:
+        //   1. For an alignment greater than that of any primitive type,
+        //      'bsls::AlignmentToType<N>::Type' has alignment 'N'.
+        //   2. The alignment of an over-aligned type is reversible: the
+        //      type computed from it has the same alignment.
+        //
+        // Plan:
+        //   1. For each extended alignment from 32 to 4096, compute the
+        //      alignment and size of 'bsls::AlignmentToType<N>::Type' using
+        //      'bsls::AlignmentImpCalc', and verify that both are 'N'.
+        //   2. Compute the type for the alignment of an over-aligned
+        //      user-defined type, and verify that it has that alignment.
+        //
+        // Testing:
+        //   bsls::AlignmentToType<N>::Type (extended alignment)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING EXTENDED ALIGNMENTS" << endl
+                          << "\n===========================" << endl;
+
+#if defined(BSLS_PLATFORM_CMP_GNU)                                            \
+ || defined(BSLS_PLATFORM_CMP_CLANG)                                          \
+ || defined(BSLS_PLATFORM_CMP_MSVC)
+
+#define U_CHECK_EXTENDED(N) {                                                 \
+            typedef bsls::AlignmentToType<N>::Type T;                         \
+            LOOP_ASSERT(N, N == bsls::AlignmentImpCalc<T>::VALUE);            \
+            LOOP_ASSERT(N, N == sizeof(T));                                   \
+        }
+
+        U_CHECK_EXTENDED(32);
+        U_CHECK_EXTENDED(64);
+        U_CHECK_EXTENDED(128);
+        U_CHECK_EXTENDED(256);
+        U_CHECK_EXTENDED(512);
+        U_CHECK_EXTENDED(1024);
+        U_CHECK_EXTENDED(2048);
+        U_CHECK_EXTENDED(4096);
+
+#undef U_CHECK_EXTENDED
+
+        {
+            enum { ALIGNMENT = bsls::AlignmentImpCalc<OverAligned>::VALUE };
+
+            typedef bsls::AlignmentToType<ALIGNMENT>::Type T;
+
+            ASSERT(64 == ALIGNMENT);
+            ASSERT(64 == bsls::AlignmentImpCalc<T>::VALUE);
+        }
+#else
+        if (verbose) cout << "\tExtended alignments are not supported."
+                          << endl;
+#endif
+
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -749,6 +749,134 @@ class AtomicInt {
         // resulting value, providing the acquire/release memory ordering
         // guarantee.
 
+    int fetchOr(int value);
+        // Atomically set the value of this object to the bitwise OR of that
+        // value and the specified 'value', and return the previous value.
+
+    int fetchOrRelaxed(int value);
+        // Atomically set the value of this object to the bitwise OR of that
+        // value and the specified 'value', and return the previous value,
+        // providing the relaxed memory ordering guarantee.
+
+    int fetchOrAcqRel(int value);
+        // Atomically set the value of this object to the bitwise OR of that
+        // value and the specified 'value', and return the previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    void bitwiseOr(int value);
+        // Atomically set the value of this object to the bitwise OR of that
+        // value and the specified 'value'.  Note that this method may be more
+        // efficient than 'fetchOr' on some platforms.
+
+    void bitwiseOrRelaxed(int value);
+        // Atomically set the value of this object to the bitwise OR of that
+        // value and the specified 'value', providing the relaxed memory
+        // ordering guarantee.
+
+    void bitwiseOrAcqRel(int value);
+        // Atomically set the value of this object to the bitwise OR of that
+        // value and the specified 'value', providing the acquire/release
+        // memory ordering guarantee.
+
+    int fetchAnd(int value);
+        // Atomically set the value of this object to the bitwise AND of that
+        // value and the specified 'value', and return the previous value.
+
+    int fetchAndRelaxed(int value);
+        // Atomically set the value of this object to the bitwise AND of that
+        // value and the specified 'value', and return the previous value,
+        // providing the relaxed memory ordering guarantee.
+
+    int fetchAndAcqRel(int value);
+        // Atomically set the value of this object to the bitwise AND of that
+        // value and the specified 'value', and return the previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    void bitwiseAnd(int value);
+        // Atomically set the value of this object to the bitwise AND of that
+        // value and the specified 'value'.  Note that this method may be more
+        // efficient than 'fetchAnd' on some platforms.
+
+    void bitwiseAndRelaxed(int value);
+        // Atomically set the value of this object to the bitwise AND of that
+        // value and the specified 'value', providing the relaxed memory
+        // ordering guarantee.
+
+    void bitwiseAndAcqRel(int value);
+        // Atomically set the value of this object to the bitwise AND of that
+        // value and the specified 'value', providing the acquire/release
+        // memory ordering guarantee.
+
+    int fetchXor(int value);
+        // Atomically set the value of this object to the bitwise exclusive OR
+        // of that value and the specified 'value', and return the previous
+        // value.
+
+    int fetchXorRelaxed(int value);
+        // Atomically set the value of this object to the bitwise exclusive OR
+        // of that value and the specified 'value', and return the previous
+        // value, providing the relaxed memory ordering guarantee.
+
+    int fetchXorAcqRel(int value);
+        // Atomically set the value of this object to the bitwise exclusive OR
+        // of that value and the specified 'value', and return the previous
+        // value, providing the acquire/release memory ordering guarantee.
+
+    void bitwiseXor(int value);
+        // Atomically set the value of this object to the bitwise exclusive OR
+        // of that value and the specified 'value'.  Note that this method may
+        // be more efficient than 'fetchXor' on some platforms.
+
+    void bitwiseXorRelaxed(int value);
+        // Atomically set the value of this object to the bitwise exclusive OR
+        // of that value and the specified 'value', providing the relaxed
+        // memory ordering guarantee.
+
+    void bitwiseXorAcqRel(int value);
+        // Atomically set the value of this object to the bitwise exclusive OR
+        // of that value and the specified 'value', providing the
+        // acquire/release memory ordering guarantee.
+
+    bool testAndSetBit(int index);
+        // Atomically set the bit at the specified 'index' (where bit 0 is the
+        // least significant bit) of the value of this object, and return
+        // 'true' if that bit was set before the operation, and 'false'
+        // otherwise.  The behavior is undefined unless '0 <= index < 32'.
+
+    bool testAndSetBitRelaxed(int index);
+        // Atomically set the bit at the specified 'index' (where bit 0 is the
+        // least significant bit) of the value of this object, and return
+        // 'true' if that bit was set before the operation, and 'false'
+        // otherwise, providing the relaxed memory ordering guarantee.  The
+        // behavior is undefined unless '0 <= index < 32'.
+
+    bool testAndSetBitAcqRel(int index);
+        // Atomically set the bit at the specified 'index' (where bit 0 is the
+        // least significant bit) of the value of this object, and return
+        // 'true' if that bit was set before the operation, and 'false'
+        // otherwise, providing the acquire/release memory ordering guarantee.
+        // The behavior is undefined unless '0 <= index < 32'.
+
+    bool testAndClearBit(int index);
+        // Atomically clear the bit at the specified 'index' (where bit 0 is
+        // the least significant bit) of the value of this object, and return
+        // 'true' if that bit was set before the operation, and 'false'
+        // otherwise.  The behavior is undefined unless '0 <= index < 32'.
+
+    bool testAndClearBitRelaxed(int index);
+        // Atomically clear the bit at the specified 'index' (where bit 0 is
+        // the least significant bit) of the value of this object, and return
+        // 'true' if that bit was set before the operation, and 'false'
+        // otherwise, providing the relaxed memory ordering guarantee.  The
+        // behavior is undefined unless '0 <= index < 32'.
+
+    bool testAndClearBitAcqRel(int index);
+        // Atomically clear the bit at the specified 'index' (where bit 0 is
+        // the least significant bit) of the value of this object, and return
+        // 'true' if that bit was set before the operation, and 'false'
+        // otherwise, providing the acquire/release memory ordering guarantee.
+        // The behavior is undefined unless '0 <= index < 32'.
+
     void storeRelaxed(int value);
         // Atomically assign the specified 'value' to this object, providing
         // the relaxed memory ordering guarantee.
@@ -874,6 +1002,134 @@ class AtomicInt64 {
         // resulting value, providing the acquire/release memory ordering
         // guarantee.
 
+    Types::Int64 fetchOr(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise OR of that
+        // value and the specified 'value', and return the previous value.
+
+    Types::Int64 fetchOrRelaxed(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise OR of that
+        // value and the specified 'value', and return the previous value,
+        // providing the relaxed memory ordering guarantee.
+
+    Types::Int64 fetchOrAcqRel(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise OR of that
+        // value and the specified 'value', and return the previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    void bitwiseOr(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise OR of that
+        // value and the specified 'value'.  Note that this method may be more
+        // efficient than 'fetchOr' on some platforms.
+
+    void bitwiseOrRelaxed(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise OR of that
+        // value and the specified 'value', providing the relaxed memory
+        // ordering guarantee.
+
+    void bitwiseOrAcqRel(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise OR of that
+        // value and the specified 'value', providing the acquire/release
+        // memory ordering guarantee.
+
+    Types::Int64 fetchAnd(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise AND of that
+        // value and the specified 'value', and return the previous value.
+
+    Types::Int64 fetchAndRelaxed(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise AND of that
+        // value and the specified 'value', and return the previous value,
+        // providing the relaxed memory ordering guarantee.
+
+    Types::Int64 fetchAndAcqRel(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise AND of that
+        // value and the specified 'value', and return the previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    void bitwiseAnd(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise AND of that
+        // value and the specified 'value'.  Note that this method may be more
+        // efficient than 'fetchAnd' on some platforms.
+
+    void bitwiseAndRelaxed(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise AND of that
+        // value and the specified 'value', providing the relaxed memory
+        // ordering guarantee.
+
+    void bitwiseAndAcqRel(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise AND of that
+        // value and the specified 'value', providing the acquire/release
+        // memory ordering guarantee.
+
+    Types::Int64 fetchXor(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise exclusive OR
+        // of that value and the specified 'value', and return the previous
+        // value.
+
+    Types::Int64 fetchXorRelaxed(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise exclusive OR
+        // of that value and the specified 'value', and return the previous
+        // value, providing the relaxed memory ordering guarantee.
+
+    Types::Int64 fetchXorAcqRel(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise exclusive OR
+        // of that value and the specified 'value', and return the previous
+        // value, providing the acquire/release memory ordering guarantee.
+
+    void bitwiseXor(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise exclusive OR
+        // of that value and the specified 'value'.  Note that this method may
+        // be more efficient than 'fetchXor' on some platforms.
+
+    void bitwiseXorRelaxed(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise exclusive OR
+        // of that value and the specified 'value', providing the relaxed
+        // memory ordering guarantee.
+
+    void bitwiseXorAcqRel(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise exclusive OR
+        // of that value and the specified 'value', providing the
+        // acquire/release memory ordering guarantee.
+
+    bool testAndSetBit(int index);
+        // Atomically set the bit at the specified 'index' (where bit 0 is the
+        // least significant bit) of the value of this object, and return
+        // 'true' if that bit was set before the operation, and 'false'
+        // otherwise.  The behavior is undefined unless '0 <= index < 64'.
+
+    bool testAndSetBitRelaxed(int index);
+        // Atomically set the bit at the specified 'index' (where bit 0 is the
+        // least significant bit) of the value of this object, and return
+        // 'true' if that bit was set before the operation, and 'false'
+        // otherwise, providing the relaxed memory ordering guarantee.  The
+        // behavior is undefined unless '0 <= index < 64'.
+
+    bool testAndSetBitAcqRel(int index);
+        // Atomically set the bit at the specified 'index' (where bit 0 is the
+        // least significant bit) of the value of this object, and return
+        // 'true' if that bit was set before the operation, and 'false'
+        // otherwise, providing the acquire/release memory ordering guarantee.
+        // The behavior is undefined unless '0 <= index < 64'.
+
+    bool testAndClearBit(int index);
+        // Atomically clear the bit at the specified 'index' (where bit 0 is
+        // the least significant bit) of the value of this object, and return
+        // 'true' if that bit was set before the operation, and 'false'
+        // otherwise.  The behavior is undefined unless '0 <= index < 64'.
+
+    bool testAndClearBitRelaxed(int index);
+        // Atomically clear the bit at the specified 'index' (where bit 0 is
+        // the least significant bit) of the value of this object, and return
+        // 'true' if that bit was set before the operation, and 'false'
+        // otherwise, providing the relaxed memory ordering guarantee.  The
+        // behavior is undefined unless '0 <= index < 64'.
+
+    bool testAndClearBitAcqRel(int index);
+        // Atomically clear the bit at the specified 'index' (where bit 0 is
+        // the least significant bit) of the value of this object, and return
+        // 'true' if that bit was set before the operation, and 'false'
+        // otherwise, providing the acquire/release memory ordering guarantee.
+        // The behavior is undefined unless '0 <= index < 64'.
+
     void storeRelaxed(Types::Int64 value);
         // Atomically assign the specified 'value' to this object, providing
         // the relaxed memory ordering guarantee.
@@ -1119,6 +1375,150 @@ int AtomicInt::addAcqRel(int value)
     return AtomicOperations_Imp::addIntNvAcqRel(&d_value, value);
 }
 
+inline
+int AtomicInt::fetchOr(int value)
+{
+    return AtomicOperations_Imp::fetchOrInt(&d_value, value);
+}
+
+inline
+int AtomicInt::fetchOrRelaxed(int value)
+{
+    return AtomicOperations_Imp::fetchOrIntRelaxed(&d_value, value);
+}
+
+inline
+int AtomicInt::fetchOrAcqRel(int value)
+{
+    return AtomicOperations_Imp::fetchOrIntAcqRel(&d_value, value);
+}
+
+inline
+void AtomicInt::bitwiseOr(int value)
+{
+    AtomicOperations_Imp::orInt(&d_value, value);
+}
+
+inline
+void AtomicInt::bitwiseOrRelaxed(int value)
+{
+    AtomicOperations_Imp::orIntRelaxed(&d_value, value);
+}
+
+inline
+void AtomicInt::bitwiseOrAcqRel(int value)
+{
+    AtomicOperations_Imp::orIntAcqRel(&d_value, value);
+}
+
+inline
+int AtomicInt::fetchAnd(int value)
+{
+    return AtomicOperations_Imp::fetchAndInt(&d_value, value);
+}
+
+inline
+int AtomicInt::fetchAndRelaxed(int value)
+{
+    return AtomicOperations_Imp::fetchAndIntRelaxed(&d_value, value);
+}
+
+inline
+int AtomicInt::fetchAndAcqRel(int value)
+{
+    return AtomicOperations_Imp::fetchAndIntAcqRel(&d_value, value);
+}
+
+inline
+void AtomicInt::bitwiseAnd(int value)
+{
+    AtomicOperations_Imp::andInt(&d_value, value);
+}
+
+inline
+void AtomicInt::bitwiseAndRelaxed(int value)
+{
+    AtomicOperations_Imp::andIntRelaxed(&d_value, value);
+}
+
+inline
+void AtomicInt::bitwiseAndAcqRel(int value)
+{
+    AtomicOperations_Imp::andIntAcqRel(&d_value, value);
+}
+
+inline
+int AtomicInt::fetchXor(int value)
+{
+    return AtomicOperations_Imp::fetchXorInt(&d_value, value);
+}
+
+inline
+int AtomicInt::fetchXorRelaxed(int value)
+{
+    return AtomicOperations_Imp::fetchXorIntRelaxed(&d_value, value);
+}
+
+inline
+int AtomicInt::fetchXorAcqRel(int value)
+{
+    return AtomicOperations_Imp::fetchXorIntAcqRel(&d_value, value);
+}
+
+inline
+void AtomicInt::bitwiseXor(int value)
+{
+    AtomicOperations_Imp::xorInt(&d_value, value);
+}
+
+inline
+void AtomicInt::bitwiseXorRelaxed(int value)
+{
+    AtomicOperations_Imp::xorIntRelaxed(&d_value, value);
+}
+
+inline
+void AtomicInt::bitwiseXorAcqRel(int value)
+{
+    AtomicOperations_Imp::xorIntAcqRel(&d_value, value);
+}
+
+inline
+bool AtomicInt::testAndSetBit(int index)
+{
+    return AtomicOperations_Imp::testAndSetBitInt(&d_value, index);
+}
+
+inline
+bool AtomicInt::testAndSetBitRelaxed(int index)
+{
+    return AtomicOperations_Imp::testAndSetBitIntRelaxed(&d_value, index);
+}
+
+inline
+bool AtomicInt::testAndSetBitAcqRel(int index)
+{
+    return AtomicOperations_Imp::testAndSetBitIntAcqRel(&d_value, index);
+}
+
+inline
+bool AtomicInt::testAndClearBit(int index)
+{
+    return AtomicOperations_Imp::testAndClearBitInt(&d_value, index);
+}
+
+inline
+bool AtomicInt::testAndClearBitRelaxed(int index)
+{
+    return AtomicOperations_Imp::testAndClearBitIntRelaxed(&d_value, index);
+}
+
+inline
+bool AtomicInt::testAndClearBitAcqRel(int index)
+{
+    return AtomicOperations_Imp::testAndClearBitIntAcqRel(&d_value, index);
+}
+
 inline
 void AtomicInt::storeRelaxed(int value)
 {
@@ -1264,6 +1664,150 @@ Types::Int64 AtomicInt64::addAcqRel(Types::Int64 value)
     return AtomicOperations_Imp::addInt64NvAcqRel(&d_value, value);
 }
 
+inline
+Types::Int64 AtomicInt64::fetchOr(Types::Int64 value)
+{
+    return AtomicOperations_Imp::fetchOrInt64(&d_value, value);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchOrRelaxed(Types::Int64 value)
+{
+    return AtomicOperations_Imp::fetchOrInt64Relaxed(&d_value, value);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchOrAcqRel(Types::Int64 value)
+{
+    return AtomicOperations_Imp::fetchOrInt64AcqRel(&d_value, value);
+}
+
+inline
+void AtomicInt64::bitwiseOr(Types::Int64 value)
+{
+    AtomicOperations_Imp::orInt64(&d_value, value);
+}
+
+inline
+void AtomicInt64::bitwiseOrRelaxed(Types::Int64 value)
+{
+    AtomicOperations_Imp::orInt64Relaxed(&d_value, value);
+}
+
+inline
+void AtomicInt64::bitwiseOrAcqRel(Types::Int64 value)
+{
+    AtomicOperations_Imp::orInt64AcqRel(&d_value, value);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchAnd(Types::Int64 value)
+{
+    return AtomicOperations_Imp::fetchAndInt64(&d_value, value);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchAndRelaxed(Types::Int64 value)
+{
+    return AtomicOperations_Imp::fetchAndInt64Relaxed(&d_value, value);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchAndAcqRel(Types::Int64 value)
+{
+    return AtomicOperations_Imp::fetchAndInt64AcqRel(&d_value, value);
+}
+
+inline
+void AtomicInt64::bitwiseAnd(Types::Int64 value)
+{
+    AtomicOperations_Imp::andInt64(&d_value, value);
+}
+
+inline
+void AtomicInt64::bitwiseAndRelaxed(Types::Int64 value)
+{
+    AtomicOperations_Imp::andInt64Relaxed(&d_value, value);
+}
+
+inline
+void AtomicInt64::bitwiseAndAcqRel(Types::Int64 value)
+{
+    AtomicOperations_Imp::andInt64AcqRel(&d_value, value);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchXor(Types::Int64 value)
+{
+    return AtomicOperations_Imp::fetchXorInt64(&d_value, value);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchXorRelaxed(Types::Int64 value)
+{
+    return AtomicOperations_Imp::fetchXorInt64Relaxed(&d_value, value);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchXorAcqRel(Types::Int64 value)
+{
+    return AtomicOperations_Imp::fetchXorInt64AcqRel(&d_value, value);
+}
+
+inline
+void AtomicInt64::bitwiseXor(Types::Int64 value)
+{
+    AtomicOperations_Imp::xorInt64(&d_value, value);
+}
+
+inline
+void AtomicInt64::bitwiseXorRelaxed(Types::Int64 value)
+{
+    AtomicOperations_Imp::xorInt64Relaxed(&d_value, value);
+}
+
+inline
+void AtomicInt64::bitwiseXorAcqRel(Types::Int64 value)
+{
+    AtomicOperations_Imp::xorInt64AcqRel(&d_value, value);
+}
+
+inline
+bool AtomicInt64::testAndSetBit(int index)
+{
+    return AtomicOperations_Imp::testAndSetBitInt64(&d_value, index);
+}
+
+inline
+bool AtomicInt64::testAndSetBitRelaxed(int index)
+{
+    return AtomicOperations_Imp::testAndSetBitInt64Relaxed(&d_value, index);
+}
+
+inline
+bool AtomicInt64::testAndSetBitAcqRel(int index)
+{
+    return AtomicOperations_Imp::testAndSetBitInt64AcqRel(&d_value, index);
+}
+
+inline
+bool AtomicInt64::testAndClearBit(int index)
+{
+    return AtomicOperations_Imp::testAndClearBitInt64(&d_value, index);
+}
+
+inline
+bool AtomicInt64::testAndClearBitRelaxed(int index)
+{
+    return AtomicOperations_Imp::testAndClearBitInt64Relaxed(&d_value, index);
+}
+
+inline
+bool AtomicInt64::testAndClearBitAcqRel(int index)
+{
+    return AtomicOperations_Imp::testAndClearBitInt64AcqRel(&d_value, index);
+}
+
 inline
 void AtomicInt64::storeRelaxed(Types::Int64 value)
 {
@@ -49,6 +49,14 @@ using namespace std;
 // [ 4] void operator +=(int value);
 // [ 4] void operator -=(int value);
 // [ 2] operator int() const;
+// [ 9] int fetchOr(int value);
+// [ 9] int fetchAnd(int value);
+// [ 9] int fetchXor(int value);
+// [ 9] void bitwiseOr(int value);
+// [ 9] void bitwiseAnd(int value);
+// [ 9] void bitwiseXor(int value);
+// [ 9] bool testAndSetBit(int index);
+// [ 9] bool testAndClearBit(int index);
 //
 // bsls::AtomicInt64
 // -----------------
@@ -68,6 +76,14 @@ using namespace std;
 // [ 4] void operator +=(bsls::Types::Int64 value);
 // [ 4] void operator -=(bsls::Types::Int64 value);
 // [ 2] operator bsls::Types::Int64() const;
+// [ 9] bsls::Types::Int64 fetchOr(bsls::Types::Int64 value);
+// [ 9] bsls::Types::Int64 fetchAnd(bsls::Types::Int64 value);
+// [ 9] bsls::Types::Int64 fetchXor(bsls::Types::Int64 value);
+// [ 9] void bitwiseOr(bsls::Types::Int64 value);
+// [ 9] void bitwiseAnd(bsls::Types::Int64 value);
+// [ 9] void bitwiseXor(bsls::Types::Int64 value);
+// [ 9] bool testAndSetBit(int index);
+// [ 9] bool testAndClearBit(int index);
 //
 // bsls::AtomicPointer
 // -------------------
@@ -85,7 +101,7 @@ using namespace std;
 //
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 //=============================================================================
@@ -551,6 +567,123 @@ void testCaseSharedPtr(int iterations)
     joinThread(thrWriter);
 }
 
+template <class ATOMIC, class INT>
+void testBitwiseManipulators(int line, INT base, INT operand)
+    // Verify that each bitwise manipulator of an object of the (template
+    // parameter) 'ATOMIC' type having the specified 'base' value, applied to
+    // the specified 'operand', returns the expected value (if any) and sets
+    // the object to the expected value.  Report failures using the specified
+    // 'line'.
+{
+    typedef INT  (ATOMIC::*FetchFunc)(INT);
+    typedef void (ATOMIC::*Func)(INT);
+
+    const struct {
+        char      d_op;         // operation
+        FetchFunc d_fetchFunc;  // "fetch" manipulator
+        Func      d_func;       // manipulator returning no value
+    } FUNCS[] = {
+        { '|', &ATOMIC::fetchOr,          &ATOMIC::bitwiseOr          },
+        { '|', &ATOMIC::fetchOrRelaxed,   &ATOMIC::bitwiseOrRelaxed   },
+        { '|', &ATOMIC::fetchOrAcqRel,    &ATOMIC::bitwiseOrAcqRel    },
+        { '&', &ATOMIC::fetchAnd,         &ATOMIC::bitwiseAnd         },
+        { '&', &ATOMIC::fetchAndRelaxed,  &ATOMIC::bitwiseAndRelaxed  },
+        { '&', &ATOMIC::fetchAndAcqRel,   &ATOMIC::bitwiseAndAcqRel   },
+        { '^', &ATOMIC::fetchXor,         &ATOMIC::bitwiseXor         },
+        { '^', &ATOMIC::fetchXorRelaxed,  &ATOMIC::bitwiseXorRelaxed  },
+        { '^', &ATOMIC::fetchXorAcqRel,   &ATOMIC::bitwiseXorAcqRel   }
+    };
+    const int NUM_FUNCS = sizeof FUNCS / sizeof *FUNCS;
+
+    for (int j = 0; j < NUM_FUNCS; ++j) {
+        const char OP  = FUNCS[j].d_op;
+        const INT  EXP = '|' == OP ? base | operand
+                       : '&' == OP ? base & operand
+                       :             base ^ operand;
+
+        ATOMIC x(base);  const ATOMIC& X = x;
+
+        LOOP2_ASSERT(line, j, base == (x.*FUNCS[j].d_fetchFunc)(operand));
+        LOOP2_ASSERT(line, j, EXP  == X);
+
+        x = base;
+        (x.*FUNCS[j].d_func)(operand);
+        LOOP2_ASSERT(line, j, EXP  == X);
+    }
+}
+
+template <class ATOMIC, class INT>
+void testBitManipulators(int numBits)
+    // Verify that each variant of 'testAndSetBit' and 'testAndClearBit' of
+    // the (template parameter) 'ATOMIC' type, having the specified 'numBits'
+    // bits, changes only the specified bit and returns its previous state.
+{
+    typedef bool (ATOMIC::*BitFunc)(int);
+
+    const struct {
+        BitFunc d_setFunc;    // 'testAndSetBit' variant
+        BitFunc d_clearFunc;  // 'testAndClearBit' variant
+    } FUNCS[] = {
+        { &ATOMIC::testAndSetBit,        &ATOMIC::testAndClearBit        },
+        { &ATOMIC::testAndSetBitRelaxed, &ATOMIC::testAndClearBitRelaxed },
+        { &ATOMIC::testAndSetBitAcqRel,  &ATOMIC::testAndClearBitAcqRel  }
+    };
+    const int NUM_FUNCS = sizeof FUNCS / sizeof *FUNCS;
+
+    for (int j = 0; j < NUM_FUNCS; ++j) {
+        for (int index = 0; index < numBits; ++index) {
+            const INT MASK = static_cast<INT>(
+                                          static_cast<Int64>(1ULL << index));
+            const INT BASE = index % 2 ? ~MASK : 0;
+
+            ATOMIC x(BASE);  const ATOMIC& X = x;
+
+            LOOP2_ASSERT(j, index, !(x.*FUNCS[j].d_setFunc)(index));
+            LOOP2_ASSERT(j, index, (BASE | MASK) == X);
+            LOOP2_ASSERT(j, index, (x.*FUNCS[j].d_setFunc)(index));
+            LOOP2_ASSERT(j, index, (BASE | MASK) == X);
+            LOOP2_ASSERT(j, index, (x.*FUNCS[j].d_clearFunc)(index));
+            LOOP2_ASSERT(j, index, BASE == X);
+            LOOP2_ASSERT(j, index, !(x.*FUNCS[j].d_clearFunc)(index));
+            LOOP2_ASSERT(j, index, BASE == X);
+        }
+    }
+}
+
+struct BitmapThreadParam {
+    bsls::AtomicInt *d_bitmap_p;    // bitmap of claimed slots
+    int             *d_counts_p;    // per-slot counts, protected by the bits
+                                    // of '*d_bitmap_p'
+    int              d_numSlots;    // number of slots
+    int              d_offset;      // first slot to claim
+    int              d_iterations;  // number of claim attempts
+    int              d_numClaims;   // number of successful claims (output)
+};
+
+void *testBitmapThreadFunc(void *arg)
+    // Repeatedly claim a slot of the bitmap described by the specified 'arg'
+    // (the address of a 'BitmapThreadParam' object) using
+    // 'testAndSetBitAcqRel', increment the count of the slot if the claim
+    // succeeded, and release the slot using 'testAndClearBitAcqRel'.
+{
+    BitmapThreadParam *param = reinterpret_cast<BitmapThreadParam *>(arg);
+
+    int numClaims = 0;
+    for (int i = 0; i < param->d_iterations; ++i) {
+        const int slot = (param->d_offset + i) % param->d_numSlots;
+
+        if (!param->d_bitmap_p->testAndSetBitAcqRel(slot)) {
+            ++param->d_counts_p[slot];
+            ++numClaims;
+            ASSERT(param->d_bitmap_p->testAndClearBitAcqRel(slot));
+        }
+    }
+    param->d_numClaims = numClaims;
+
+    return 0;
+}
+
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -1084,7 +1217,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 9: {
+      case 10: {
         // TESTING USAGE Examples
         //
         // Plan:
@@ -1097,6 +1230,170 @@ int main(int argc, char *argv[])
             my_CountedHandle<double> handle(NULL);
         }
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING BITWISE MANIPULATORS
+        //   Test that the 32/64 bit integer bitwise functions work as
+        //   expected.
+        //
+        // Concerns:
+        //: 1 Each "fetch" manipulator sets the value to the bitwise OR, AND,
+        //:   or exclusive OR of the previous value and the operand, and
+        //:   returns the previous value.
+        //:
+        //: 2 Each "bitwise" manipulator sets the value as its "fetch"
+        //:   counterpart does.
+        //:
+        //: 3 'testAndSetBit' and 'testAndClearBit' change only the specified
+        //:   bit, and return its previous state.
+        //:
+        //: 4 A bit claimed by 'testAndSetBitAcqRel' and released by
+        //:   'testAndClearBitAcqRel' protects data shared among threads.
+        //
+        // Plan:
+        //: 1 For each atomic type ('AtomicInt' and 'AtomicInt64'), using a
+        //:   sequence of independent base values and operands, apply each
+        //:   variant of each bitwise manipulator to an object having the base
+        //:   value, and verify the returned value (if any) and the resulting
+        //:   value of the object.  (C-1..2)
+        //:
+        //: 2 For each atomic type and each bit index, set and clear the bit
+        //:   twice with each variant of 'testAndSetBit' and 'testAndClearBit',
+        //:   and verify the returned values and the resulting value of the
+        //:   object.  (C-3)
+        //:
+        //: 3 Create a series of threads that repeatedly claim a slot of a
+        //:   common bitmap, increment a non-atomic count associated with the
+        //:   slot, and release the slot.  Verify that the total of the counts
+        //:   equals the total number of successful claims.  (C-4)
+        //
+        // Testing:
+        //   int fetchOr(int value);
+        //   int fetchAnd(int value);
+        //   int fetchXor(int value);
+        //   void bitwiseOr(int value);
+        //   void bitwiseAnd(int value);
+        //   void bitwiseXor(int value);
+        //   bool testAndSetBit(int index);
+        //   bool testAndClearBit(int index);
+        //   bsls::Types::Int64 fetchOr(bsls::Types::Int64 value);
+        //   bsls::Types::Int64 fetchAnd(bsls::Types::Int64 value);
+        //   bsls::Types::Int64 fetchXor(bsls::Types::Int64 value);
+        //   void bitwiseOr(bsls::Types::Int64 value);
+        //   void bitwiseAnd(bsls::Types::Int64 value);
+        //   void bitwiseXor(bsls::Types::Int64 value);
+        //   bool testAndSetBit(int index);
+        //   bool testAndClearBit(int index);
+        //   (and the 'Relaxed' and 'AcqRel' variants of each of the above)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "Testing Bitwise Manipulators" << endl
+                          << "============================" << endl;
+
+        if (verbose) cout << endl
+                          << "Testing 'AtomicInt' Bitwise Manipulators"
+                          << endl;
+        {
+            static const struct {
+                int d_lineNum;  // source line number
+                int d_base;     // initial value
+                int d_operand;  // operand
+            } VALUES[] = {
+                //line d_base            d_operand
+                //---- ----------------  ----------------
+                { L_,  0               , 0                },
+                { L_,  0               , -1               },
+                { L_,  -1              , 0                },
+                { L_,  -1              , -1               },
+                { L_,  0x0f0f0f0f      , 0x00ff00ff       },
+                { L_,  (int) 0x80000000, 1                },
+                { L_,  1               , (int) 0x80000001 }
+            };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                testBitwiseManipulators<AI>(VALUES[i].d_lineNum,
+                                            VALUES[i].d_base,
+                                            VALUES[i].d_operand);
+            }
+
+            testBitManipulators<AI, int>(32);
+        }
+
+        if (verbose) cout << endl
+                          << "Testing 'AtomicInt64' Bitwise Manipulators"
+                          << endl;
+        {
+            static const struct {
+                int   d_lineNum;  // source line number
+                Int64 d_base;     // initial value
+                Int64 d_operand;  // operand
+            } VALUES[] = {
+                //line d_base                 d_operand
+                //---- ---------------------  ---------------------
+                { L_,  0                    , 0                     },
+                { L_,  0                    , -1                    },
+                { L_,  -1                   , 0                     },
+                { L_,  -1                   , -1                    },
+                { L_,  0xFFFFFFFFLL         , 0x100000000LL         },
+                { L_,  0x0f0f0f0f0f0f0f0fLL , 0x00ff00ff00ff00ffLL  },
+                { L_,  -0x7FFFFFFFFFFFFFFFLL, 0x7FFFFFFF00000001LL  }
+            };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                testBitwiseManipulators<AI64>(VALUES[i].d_lineNum,
+                                              VALUES[i].d_base,
+                                              VALUES[i].d_operand);
+            }
+
+            testBitManipulators<AI64, Int64>(64);
+        }
+
+        if (verbose) cout << endl
+                          << "Testing 'AtomicInt' bitmap claims" << endl;
+        {
+            enum { k_NUM_THREADS = 4, k_NUM_SLOTS = 8 };
+
+            const int ITERATIONS = 1000000;
+
+            AI  bitmap(0);
+            int counts[k_NUM_SLOTS] = { 0 };
+
+            BitmapThreadParam params[k_NUM_THREADS];
+            thread_t          threads[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                params[i].d_bitmap_p   = &bitmap;
+                params[i].d_counts_p   = counts;
+                params[i].d_numSlots   = k_NUM_SLOTS;
+                params[i].d_offset     = i;
+                params[i].d_iterations = ITERATIONS;
+                params[i].d_numClaims  = 0;
+
+                threads[i] = createThread(&testBitmapThreadFunc, &params[i]);
+            }
+
+            int numClaims = 0;
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                joinThread(threads[i]);
+                numClaims += params[i].d_numClaims;
+            }
+
+            int total = 0;
+            for (int i = 0; i < k_NUM_SLOTS; ++i) {
+                total += counts[i];
+            }
+
+            if (veryVerbose) {
+                T_(); P_(numClaims); P(total);
+            }
+            ASSERT(0         == bitmap);
+            ASSERT(0         <  numClaims);
+            ASSERT(numClaims == total);
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // TESTING MEMORY ORDERING OF ATOMIC OPERATIONS USED IN SHARED POINTER
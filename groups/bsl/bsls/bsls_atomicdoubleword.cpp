@@ -0,0 +1,185 @@
+// bsls_atomicdoubleword.cpp                                          -*-C++-*-
+#include <bsls_atomicdoubleword.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+    #include <windows.h>   // Sleep()
+#else
+    #include <sched.h>     // sched_yield()
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+enum {
+    k_NUM_LOCKS  = 64,   // number of spin locks in the table (a power of 2)
+
+    k_LOCK_SIZE  = 64,   // size of a spin lock, padded to a cache line so
+                         // that distinct locks do not share cache lines
+
+    k_SPIN_COUNT = 100   // number of times the state of a held lock is read
+                         // before yielding the processor
+};
+
+typedef bsls::AtomicOperations::AtomicTypes::Int AtomicInt;
+
+struct SpinLock {
+    // This 'struct' holds the state of a spin lock, padded to a cache line.
+
+    AtomicInt d_state;  // 0 if unlocked, and 1 if locked
+
+    char      d_padding[k_LOCK_SIZE - sizeof(AtomicInt)];  // unused
+};
+
+SpinLock s_locks[k_NUM_LOCKS];  // table of spin locks, initially unlocked
+                                // (zero-initialized)
+
+inline
+void yield()
+    // Yield the processor to another thread.
+{
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+    ::Sleep(0);
+#else
+    sched_yield();
+#endif
+}
+
+inline
+SpinLock *lockFor(const void *address)
+    // Return the address of the spin lock that serializes the operations on
+    // the object at the specified 'address'.
+{
+    // Objects are 16 bytes long: discard the 4 low-order bits of the address,
+    // and fold higher bits in, so that the objects of an array, and objects
+    // far apart, are spread over the table.
+
+    const bsls::Types::Uint64 bits = static_cast<bsls::Types::Uint64>(
+                            reinterpret_cast<bsls::Types::UintPtr>(address))
+                                                                         >> 4;
+
+    return &s_locks[(bits ^ (bits >> 6) ^ (bits >> 12)) & (k_NUM_LOCKS - 1)];
+}
+
+void lock(SpinLock *spinLock)
+    // Acquire the specified 'spinLock', spinning (and yielding the processor)
+    // while it is held by another thread.
+{
+    for (;;) {
+        if (0 == bsls::AtomicOperations::testAndSwapIntAcqRel(
+                                                 &spinLock->d_state, 0, 1)) {
+            return;                                                   // RETURN
+        }
+
+        // Wait for the lock to be released without writing to it, so that
+        // waiting threads do not steal the cache line from the holder.
+
+        int spin = 0;
+        while (0 != bsls::AtomicOperations::getIntRelaxed(
+                                                       &spinLock->d_state)) {
+            if (++spin == k_SPIN_COUNT) {
+                yield();
+                spin = 0;
+            }
+        }
+    }
+}
+
+inline
+void unlock(SpinLock *spinLock)
+    // Release the specified 'spinLock'.
+{
+    bsls::AtomicOperations::setIntRelease(&spinLock->d_state, 0);
+}
+
+}  // close unnamed namespace
+
+namespace bsls {
+
+                     // --------------------------------
+                     // struct AtomicDoubleWord_LockUtil
+                     // --------------------------------
+
+// CLASS METHODS
+AtomicDoubleWord_LockUtil::Value
+AtomicDoubleWord_LockUtil::load(const Value *object)
+{
+    SpinLock *spinLock = lockFor(object);
+
+    lock(spinLock);
+    const Value result = *object;
+    unlock(spinLock);
+
+    return result;
+}
+
+void AtomicDoubleWord_LockUtil::store(Value *object, const Value& value)
+{
+    SpinLock *spinLock = lockFor(object);
+
+    lock(spinLock);
+    *object = value;
+    unlock(spinLock);
+}
+
+AtomicDoubleWord_LockUtil::Value
+AtomicDoubleWord_LockUtil::swap(Value *object, const Value& swapValue)
+{
+    SpinLock *spinLock = lockFor(object);
+
+    lock(spinLock);
+    const Value result = *object;
+    *object = swapValue;
+    unlock(spinLock);
+
+    return result;
+}
+
+AtomicDoubleWord_LockUtil::Value
+AtomicDoubleWord_LockUtil::testAndSwap(Value        *object,
+                                       const Value&  compareValue,
+                                       const Value&  swapValue)
+{
+    SpinLock *spinLock = lockFor(object);
+
+    lock(spinLock);
+    const Value result = *object;
+    if (result == compareValue) {
+        *object = swapValue;
+    }
+    unlock(spinLock);
+
+    return result;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,586 @@
+// bsls_atomicdoubleword.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLS_ATOMICDOUBLEWORD
+#define INCLUDED_BSLS_ATOMICDOUBLEWORD
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an atomic pair of 64-bit words with compare-and-swap.
+//
+//@CLASSES:
+//  bsls::AtomicDoubleWord: 16-byte atomic type supporting compare-and-swap
+//  bsls::AtomicDoubleWord_LockUtil: [!PRIVATE!] lock-based implementation
+//
+//@SEE_ALSO: bsls_atomic, bsls_atomicoperations
+//
+//@DESCRIPTION: This component provides a class, 'bsls::AtomicDoubleWord',
+// holding a pair of 64-bit words, 'd_low' and 'd_high', that are loaded,
+// stored, swapped, and compared-and-swapped together, as a single 16-byte
+// atomic value.  The types of 'bsls_atomic' provide atomic operations on
+// values of at most one machine word; a double-word compare-and-swap is the
+// building block of the lock-free algorithms that must update a pointer and
+// a second word at once: typically, a pointer and a modification count
+// (a "tagged pointer"), which protects lock-free stacks and free lists from
+// the ABA problem (see {Example 1}).
+//
+///Implementation
+///--------------
+// On x86-64, the operations of 'bsls::AtomicDoubleWord' are implemented with
+// the 'lock cmpxchg16b' instruction (with inline assembly for GCC and Clang,
+// and with the '_InterlockedCompareExchange128' intrinsic for MSVC), and are
+// lock-free.  Note that a processor lacking 'cmpxchg16b' (i.e., some of the
+// earliest x86-64 processors) is not supported.  Also note that
+// 'cmpxchg16b' requires its operand to be 16-byte aligned: the class is
+// declared with that alignment, which the compiler honors for objects with
+// static and automatic storage duration, but dynamically allocated objects
+// must be obtained from an allocator returning memory that is (at least)
+// 16-byte aligned.
+//
+// On other platforms, the operations are implemented by
+// 'bsls::AtomicDoubleWord_LockUtil', which serializes them with a spin lock
+// chosen, by the address of the object, from a fixed table of spin locks;
+// these operations are atomic with respect to each other, but are not
+// lock-free.  The class method 'isLockFree' reports which implementation is
+// in use.
+//
+// Note that, since 'cmpxchg16b' is the only instruction that accesses 16
+// bytes atomically on x86-64, the load operations are implemented as a
+// compare-and-swap too: loads obtain exclusive access to the cache line
+// holding the object (hence, concurrent loads of the same object contend with
+// each other), and an object must not reside in read-only memory.
+//
+///Memory Order
+///------------
+// The operations of 'bsls::AtomicDoubleWord' follow the naming conventions of
+// 'bsls::AtomicInt' (see 'bsls_atomic'): operations without a suffix
+// guarantee sequential consistency, and the 'Acquire', 'Release', 'AcqRel',
+// and 'Relaxed' variants provide the corresponding weaker guarantees.  Both
+// implementations currently provide sequential consistency for every
+// operation (a 'lock'-prefixed instruction is a full memory barrier on
+// x86-64), but the weaker variants document the ordering that the caller
+// relies on, and allow a cheaper implementation on other platforms.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: An ABA-Safe Lock-Free Stack
+/// - - - - - - - - - - - - - - - - - - -
+// A lock-free stack of nodes ("Treiber stack") is commonly implemented with a
+// single atomic pointer to the top node: 'pop' reads the top node and its
+// successor, and then swaps the successor in, if the top node is unchanged.
+// However, the top node may have been popped, and then pushed again, by other
+// threads in between, with a different successor (the "ABA problem"); a
+// single-word compare-and-swap does not detect that change, and corrupts the
+// stack.  Pairing the pointer with a count that is incremented by every
+// modification of the stack solves the problem.
+//
+// First, we define the type of the nodes of the stack:
+//..
+//  struct Node {
+//      Node *d_next_p;  // next node on the stack
+//      int   d_value;   // value held by this node
+//  };
+//..
+// Then, we define a stack of nodes whose top is a pair of words: the address
+// of the top node in 'd_low', and the modification count in 'd_high':
+//..
+//  class NodeStack {
+//      // This class provides a thread-safe, lock-free stack of nodes.
+//
+//      // DATA
+//      bsls::AtomicDoubleWord d_top;  // address of the top node, and
+//                                     // modification count
+//
+//    public:
+//      // MANIPULATORS
+//      void push(Node *node);
+//          // Push the specified 'node' on this stack.
+//
+//      Node *pop();
+//          // Remove the top node from this stack and return its address, or
+//          // return 0 if this stack is empty.
+//  };
+//..
+// Next, we implement 'push': the modification count is incremented whenever
+// the top changes, so that 'testAndSwap' fails if any other thread has
+// modified the stack since 'top' was loaded:
+//..
+//  void NodeStack::push(Node *node)
+//  {
+//      typedef bsls::AtomicDoubleWord::Value Value;
+//
+//      Value top = d_top.loadRelaxed();
+//      for (;;) {
+//          node->d_next_p = reinterpret_cast<Node *>(top.d_low);
+//
+//          const Value newTop = {
+//                               reinterpret_cast<bsls::Types::Uint64>(node),
+//                               top.d_high + 1 };
+//
+//          const Value oldTop = d_top.testAndSwapAcqRel(top, newTop);
+//          if (oldTop == top) {
+//              return;                                               // RETURN
+//          }
+//          top = oldTop;
+//      }
+//  }
+//..
+// Then, we implement 'pop'.  Note that the nodes are assumed to never be
+// deallocated while the stack is in use (e.g., they are held by a free list),
+// so that reading 'd_next_p' from a node that was popped concurrently is
+// harmless: the subsequent 'testAndSwap' fails:
+//..
+//  Node *NodeStack::pop()
+//  {
+//      typedef bsls::AtomicDoubleWord::Value Value;
+//
+//      Value top = d_top.loadAcquire();
+//      for (;;) {
+//          Node *node = reinterpret_cast<Node *>(top.d_low);
+//          if (!node) {
+//              return 0;                                             // RETURN
+//          }
+//
+//          const Value newTop = {
+//                   reinterpret_cast<bsls::Types::Uint64>(node->d_next_p),
+//                   top.d_high + 1 };
+//
+//          const Value oldTop = d_top.testAndSwapAcqRel(top, newTop);
+//          if (oldTop == top) {
+//              return node;                                          // RETURN
+//          }
+//          top = oldTop;
+//      }
+//  }
+//..
+// Finally, we push a few nodes on a stack, and pop them back in reverse
+// order:
+//..
+//  Node nodes[3];
+//  NodeStack stack;
+//
+//  for (int i = 0; i < 3; ++i) {
+//      nodes[i].d_value = i;
+//      stack.push(&nodes[i]);
+//  }
+//
+//  assert(&nodes[2] == stack.pop());
+//  assert(&nodes[1] == stack.pop());
+//  assert(&nodes[0] == stack.pop());
+//  assert(0         == stack.pop());
+//..
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) \
+    && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+    #define BSLS_ATOMICDOUBLEWORD_CMPXCHG16B 1
+    #define BSLS_ATOMICDOUBLEWORD_ALIGNED __attribute__((__aligned__(16)))
+#elif defined(BSLS_PLATFORM_CPU_X86_64) && defined(BSLS_PLATFORM_CMP_MSVC)
+    #define BSLS_ATOMICDOUBLEWORD_INTERLOCKED 1
+    #define BSLS_ATOMICDOUBLEWORD_ALIGNED __declspec(align(16))
+
+    #ifndef INCLUDED_INTRIN
+    #include <intrin.h>
+    #define INCLUDED_INTRIN
+    #endif
+
+    #pragma intrinsic(_InterlockedCompareExchange128)
+#else
+    #define BSLS_ATOMICDOUBLEWORD_ALIGNED
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                          // ======================
+                          // class AtomicDoubleWord
+                          // ======================
+
+class BSLS_ATOMICDOUBLEWORD_ALIGNED AtomicDoubleWord {
+    // This class provides an atomic pair of 64-bit words that supports
+    // load, store, swap, and compare-and-swap operations on both words at
+    // once.  The operations are lock-free where the platform provides a
+    // 16-byte compare-and-swap instruction (see 'isLockFree'), and are
+    // serialized by spin locks otherwise.  Objects of this class are
+    // 16-byte aligned.
+
+  public:
+    // TYPES
+    struct Value {
+        // This 'struct' holds the two words of the value of an
+        // 'AtomicDoubleWord'.  It is an aggregate, which may be initialized
+        // with braces, e.g., 'Value value = { low, high };'.
+
+        Types::Uint64 d_low;   // low-order word (e.g., a pointer)
+        Types::Uint64 d_high;  // high-order word (e.g., a modification count)
+    };
+
+  private:
+    // DATA
+    mutable Value d_value;  // current value; modified by the load operations
+                            // on platforms that implement them with a
+                            // compare-and-swap
+
+    // PRIVATE CLASS METHODS
+    static Value compareAndSwap(Value        *object,
+                                const Value&  compareValue,
+                                const Value&  swapValue);
+        // Compare the value of the specified 'object' to the specified
+        // 'compareValue', and if they are equal set the value of 'object' to
+        // the specified 'swapValue'.  Return the value of 'object' before the
+        // operation.  This operation guarantees sequential consistency.
+
+    // NOT IMPLEMENTED
+    AtomicDoubleWord(const AtomicDoubleWord&);             // = delete
+    AtomicDoubleWord& operator=(const AtomicDoubleWord&);  // = delete
+
+  public:
+    // CLASS METHODS
+    static bool isLockFree();
+        // Return 'true' if the operations of this class are implemented with
+        // a lock-free 16-byte compare-and-swap instruction on this platform,
+        // and 'false' if they are serialized by spin locks.
+
+    // CREATORS
+    AtomicDoubleWord();
+        // Create an atomic double word having the value '{ 0, 0 }'.
+
+    explicit AtomicDoubleWord(const Value& value);
+        // Create an atomic double word having the specified 'value'.
+
+    //! ~AtomicDoubleWord() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void store(const Value& value);
+        // Atomically set the value of this object to the specified 'value'.
+        // This operation guarantees sequential consistency.
+
+    void storeRelaxed(const Value& value);
+        // Atomically set the value of this object to the specified 'value'.
+        // This operation guarantees relaxed memory ordering.
+
+    void storeRelease(const Value& value);
+        // Atomically set the value of this object to the specified 'value'.
+        // This operation guarantees release memory ordering.
+
+    Value swap(const Value& swapValue);
+        // Atomically set the value of this object to the specified
+        // 'swapValue', and return its previous value.  This operation
+        // guarantees sequential consistency.
+
+    Value swapAcqRel(const Value& swapValue);
+        // Atomically set the value of this object to the specified
+        // 'swapValue', and return its previous value.  This operation
+        // guarantees acquire/release memory ordering.
+
+    Value testAndSwap(const Value& compareValue, const Value& swapValue);
+        // Compare the value of this object to the specified 'compareValue'.
+        // If they are equal, set the value of this object to the specified
+        // 'swapValue', otherwise leave this value unchanged.  Return the
+        // previous value of this object, whether or not the swap occurred.
+        // The whole operation is performed atomically, and guarantees
+        // sequential consistency.  Note that the swap occurred if and only if
+        // the returned value is equal to 'compareValue'.
+
+    Value testAndSwapAcqRel(const Value& compareValue,
+                            const Value& swapValue);
+        // Compare the value of this object to the specified 'compareValue'.
+        // If they are equal, set the value of this object to the specified
+        // 'swapValue', otherwise leave this value unchanged.  Return the
+        // previous value of this object, whether or not the swap occurred.
+        // The whole operation is performed atomically, and guarantees
+        // acquire/release memory ordering.  Note that the swap occurred if
+        // and only if the returned value is equal to 'compareValue'.
+
+    // ACCESSORS
+    Value load() const;
+        // Atomically load and return the value of this object.  This
+        // operation guarantees sequential consistency.
+
+    Value loadAcquire() const;
+        // Atomically load and return the value of this object.  This
+        // operation guarantees acquire memory ordering.
+
+    Value loadRelaxed() const;
+        // Atomically load and return the value of this object.  This
+        // operation guarantees relaxed memory ordering.
+};
+
+// FREE OPERATORS
+bool operator==(const AtomicDoubleWord::Value& lhs,
+                const AtomicDoubleWord::Value& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' values have the same
+    // value, and 'false' otherwise.  Two 'AtomicDoubleWord::Value' objects
+    // have the same value if their respective 'd_low' and 'd_high' words are
+    // equal.
+
+bool operator!=(const AtomicDoubleWord::Value& lhs,
+                const AtomicDoubleWord::Value& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' values do not have the
+    // same value, and 'false' otherwise.  Two 'AtomicDoubleWord::Value'
+    // objects do not have the same value if their respective 'd_low' or
+    // 'd_high' words are not equal.
+
+                     // ================================
+                     // struct AtomicDoubleWord_LockUtil
+                     // ================================
+
+struct AtomicDoubleWord_LockUtil {
+    // [!PRIVATE!] This 'struct' provides a namespace for the lock-based
+    // implementation of the operations of 'AtomicDoubleWord', used on
+    // platforms lacking a 16-byte compare-and-swap instruction.  Every
+    // operation on an object locks the spin lock that is selected by the
+    // address of that object in a fixed table of spin locks; hence the
+    // operations are atomic with respect to each other, and guarantee
+    // sequential consistency.  Note that this implementation is available on
+    // every platform (for testing).
+
+    // TYPES
+    typedef AtomicDoubleWord::Value Value;
+
+    // CLASS METHODS
+    static Value load(const Value *object);
+        // Return the value of the specified 'object'.
+
+    static void store(Value *object, const Value& value);
+        // Set the value of the specified 'object' to the specified 'value'.
+
+    static Value swap(Value *object, const Value& swapValue);
+        // Set the value of the specified 'object' to the specified
+        // 'swapValue', and return its previous value.
+
+    static Value testAndSwap(Value        *object,
+                             const Value&  compareValue,
+                             const Value&  swapValue);
+        // Compare the value of the specified 'object' to the specified
+        // 'compareValue', and if they are equal set the value of 'object' to
+        // the specified 'swapValue'.  Return the value of 'object' before the
+        // operation.
+};
+
+// ============================================================================
+//                          INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // ----------------------
+                          // class AtomicDoubleWord
+                          // ----------------------
+
+// PRIVATE CLASS METHODS
+inline
+AtomicDoubleWord::Value
+AtomicDoubleWord::compareAndSwap(Value        *object,
+                                 const Value&  compareValue,
+                                 const Value&  swapValue)
+{
+#if defined(BSLS_ATOMICDOUBLEWORD_CMPXCHG16B)
+    Types::Uint64 low  = compareValue.d_low;
+    Types::Uint64 high = compareValue.d_high;
+
+    asm volatile (
+        "       lock cmpxchg16b %[obj]  \n\t"
+
+                : [obj] "+m" (*object),
+                  "+a" (low),
+                  "+d" (high)
+                : "b" (swapValue.d_low),
+                  "c" (swapValue.d_high)
+                : "memory", "cc");
+
+    const Value result = { low, high };
+    return result;
+#elif defined(BSLS_ATOMICDOUBLEWORD_INTERLOCKED)
+    // '_InterlockedCompareExchange128' loads the previous value of 'object'
+    // into the array of two words at its last argument.
+
+    __int64 previous[2] = {
+        static_cast<__int64>(compareValue.d_low),
+        static_cast<__int64>(compareValue.d_high)
+    };
+
+    _InterlockedCompareExchange128(
+                          reinterpret_cast<volatile __int64 *>(object),
+                          static_cast<__int64>(swapValue.d_high),
+                          static_cast<__int64>(swapValue.d_low),
+                          previous);
+
+    const Value result = { static_cast<Types::Uint64>(previous[0]),
+                           static_cast<Types::Uint64>(previous[1]) };
+    return result;
+#else
+    return AtomicDoubleWord_LockUtil::testAndSwap(object,
+                                                  compareValue,
+                                                  swapValue);
+#endif
+}
+
+// CLASS METHODS
+inline
+bool AtomicDoubleWord::isLockFree()
+{
+#if defined(BSLS_ATOMICDOUBLEWORD_CMPXCHG16B)                                 \
+ || defined(BSLS_ATOMICDOUBLEWORD_INTERLOCKED)
+    return true;
+#else
+    return false;
+#endif
+}
+
+// CREATORS
+inline
+AtomicDoubleWord::AtomicDoubleWord()
+{
+    d_value.d_low  = 0;
+    d_value.d_high = 0;
+}
+
+inline
+AtomicDoubleWord::AtomicDoubleWord(const Value& value)
+{
+    d_value = value;
+}
+
+// MANIPULATORS
+inline
+void AtomicDoubleWord::store(const Value& value)
+{
+    swap(value);
+}
+
+inline
+void AtomicDoubleWord::storeRelaxed(const Value& value)
+{
+    swap(value);
+}
+
+inline
+void AtomicDoubleWord::storeRelease(const Value& value)
+{
+    swap(value);
+}
+
+inline
+AtomicDoubleWord::Value AtomicDoubleWord::swap(const Value& swapValue)
+{
+#if defined(BSLS_ATOMICDOUBLEWORD_CMPXCHG16B)                                 \
+ || defined(BSLS_ATOMICDOUBLEWORD_INTERLOCKED)
+    // The initial guess need not be read atomically: a torn value merely
+    // fails the first compare-and-swap, which loads the actual value.
+
+    Value expected = d_value;
+    for (;;) {
+        const Value previous = compareAndSwap(&d_value, expected, swapValue);
+        if (previous == expected) {
+            return previous;                                          // RETURN
+        }
+        expected = previous;
+    }
+#else
+    return AtomicDoubleWord_LockUtil::swap(&d_value, swapValue);
+#endif
+}
+
+inline
+AtomicDoubleWord::Value AtomicDoubleWord::swapAcqRel(const Value& swapValue)
+{
+    return swap(swapValue);
+}
+
+inline
+AtomicDoubleWord::Value
+AtomicDoubleWord::testAndSwap(const Value& compareValue,
+                              const Value& swapValue)
+{
+    return compareAndSwap(&d_value, compareValue, swapValue);
+}
+
+inline
+AtomicDoubleWord::Value
+AtomicDoubleWord::testAndSwapAcqRel(const Value& compareValue,
+                                    const Value& swapValue)
+{
+    return compareAndSwap(&d_value, compareValue, swapValue);
+}
+
+// ACCESSORS
+inline
+AtomicDoubleWord::Value AtomicDoubleWord::load() const
+{
+#if defined(BSLS_ATOMICDOUBLEWORD_CMPXCHG16B)                                 \
+ || defined(BSLS_ATOMICDOUBLEWORD_INTERLOCKED)
+    // Swapping '{ 0, 0 }' for '{ 0, 0 }' leaves the value unchanged, and
+    // returns it.
+
+    const Value zero = { 0, 0 };
+    return compareAndSwap(&d_value, zero, zero);
+#else
+    return AtomicDoubleWord_LockUtil::load(&d_value);
+#endif
+}
+
+inline
+AtomicDoubleWord::Value AtomicDoubleWord::loadAcquire() const
+{
+    return load();
+}
+
+inline
+AtomicDoubleWord::Value AtomicDoubleWord::loadRelaxed() const
+{
+    return load();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bsls::operator==(const AtomicDoubleWord::Value& lhs,
+                      const AtomicDoubleWord::Value& rhs)
+{
+    return lhs.d_low == rhs.d_low && lhs.d_high == rhs.d_high;
+}
+
+inline
+bool bsls::operator!=(const AtomicDoubleWord::Value& lhs,
+                      const AtomicDoubleWord::Value& rhs)
+{
+    return lhs.d_low != rhs.d_low || lhs.d_high != rhs.d_high;
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
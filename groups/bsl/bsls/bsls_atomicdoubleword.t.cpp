@@ -0,0 +1,1118 @@
+// bsls_atomicdoubleword.t.cpp                                        -*-C++-*-
+#include <bsls_atomicdoubleword.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+
+// For thread support
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE thread_t;
+#else
+#include <pthread.h>
+typedef pthread_t thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides a 16-byte atomic type, and a lock-based
+// implementation of its operations that is used on platforms lacking a
+// 16-byte compare-and-swap instruction.  The single-threaded semantics of
+// every operation are verified first, for both implementations.  Then, the
+// atomicity of the operations is verified by stress tests, in which several
+// threads concurrently update objects with compare-and-swap loops while
+// verifying that no torn (partially updated) value is ever observed, and in
+// which several threads concurrently pop and push the nodes of the lock-free
+// stack of the usage example, verifying that no node is ever popped by two
+// threads at once (i.e., that the modification count defeats the ABA
+// problem).
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static bool isLockFree();
+// [ 3] AtomicDoubleWord_LockUtil::load(const Value *object);
+// [ 3] AtomicDoubleWord_LockUtil::store(Value *, const Value&);
+// [ 3] AtomicDoubleWord_LockUtil::swap(Value *, const Value&);
+// [ 3] AtomicDoubleWord_LockUtil::testAndSwap(Value *, cV&, cV&);
+//
+// CREATORS
+// [ 2] AtomicDoubleWord();
+// [ 2] explicit AtomicDoubleWord(const Value& value);
+//
+// MANIPULATORS
+// [ 2] void store(const Value& value);
+// [ 2] void storeRelaxed(const Value& value);
+// [ 2] void storeRelease(const Value& value);
+// [ 3] Value swap(const Value& swapValue);
+// [ 3] Value swapAcqRel(const Value& swapValue);
+// [ 3] Value testAndSwap(const Value& cV, const Value& sV);
+// [ 3] Value testAndSwapAcqRel(const Value& cV, const Value& sV);
+//
+// ACCESSORS
+// [ 2] Value load() const;
+// [ 2] Value loadAcquire() const;
+// [ 2] Value loadRelaxed() const;
+//
+// FREE OPERATORS
+// [ 2] bool operator==(const Value& lhs, const Value& rhs);
+// [ 2] bool operator!=(const Value& lhs, const Value& rhs);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCURRENT COMPARE-AND-SWAP
+// [ 5] CONCURRENT LOCK-FREE STACK (ABA)
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'load' AND 'testAndSwap'
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                     GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::AtomicDoubleWord          Obj;
+typedef bsls::AtomicDoubleWord::Value   Value;
+typedef bsls::AtomicDoubleWord_LockUtil LockUtil;
+typedef bsls::TimeUtil                  TU;
+typedef bsls::Types::Int64              Int64;
+typedef bsls::Types::Uint64             Uint64;
+typedef bsls::Types::UintPtr            UintPtr;
+
+const Uint64 HIGH_BIT = static_cast<Uint64>(1) << 63;
+
+//=============================================================================
+//                              HELPER FUNCTIONS
+//-----------------------------------------------------------------------------
+
+namespace {
+
+Value makeValue(Uint64 low, Uint64 high)
+    // Return a 'Value' having the specified 'low' and 'high' words.
+{
+    const Value value = { low, high };
+    return value;
+}
+
+Value makeCheckedValue(Uint64 count)
+    // Return a 'Value' holding the specified 'count' in its low-order word,
+    // and the bitwise complement of 'count' in its high-order word.  A value
+    // is consistent if its words satisfy that relation; a value read while
+    // partially updated is (with high probability) not consistent.
+{
+    return makeValue(count, ~count);
+}
+
+bool isConsistent(const Value& value)
+    // Return 'true' if the specified 'value' was returned by
+    // 'makeCheckedValue', and 'false' otherwise.
+{
+    return value.d_high == ~value.d_low;
+}
+
+                       // ===========================
+                       // struct NativeImp / LockImp
+                       // ===========================
+
+struct NativeImp {
+    // This 'struct' provides a uniform interface to the operations of
+    // 'bsls::AtomicDoubleWord', for use by the generic tests.
+
+    typedef Obj Object;
+
+    static const char *name() { return "native"; }
+
+    static Value load(Object *object)
+    {
+        return object->load();
+    }
+
+    static void store(Object *object, const Value& value)
+    {
+        object->store(value);
+    }
+
+    static Value testAndSwap(Object       *object,
+                             const Value&  compareValue,
+                             const Value&  swapValue)
+    {
+        return object->testAndSwapAcqRel(compareValue, swapValue);
+    }
+};
+
+struct LockImp {
+    // This 'struct' provides a uniform interface to the operations of
+    // 'bsls::AtomicDoubleWord_LockUtil', for use by the generic tests.
+
+    typedef Value Object;
+
+    static const char *name() { return "lock"; }
+
+    static Value load(Object *object)
+    {
+        return LockUtil::load(object);
+    }
+
+    static void store(Object *object, const Value& value)
+    {
+        LockUtil::store(object, value);
+    }
+
+    static Value testAndSwap(Object       *object,
+                             const Value&  compareValue,
+                             const Value&  swapValue)
+    {
+        return LockUtil::testAndSwap(object, compareValue, swapValue);
+    }
+};
+
+                           // ===================
+                           // thread-support code
+                           // ===================
+
+typedef void *(*thread_func)(void *arg);
+
+thread_t createThread(thread_func func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE) func, arg, 0, 0);
+#else
+    thread_t thr;
+    pthread_create(&thr, 0, func, arg);
+    return thr;
+#endif
+}
+
+void joinThread(thread_t thr)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(thr, INFINITE);
+    CloseHandle(thr);
+#else
+    pthread_join(thr, 0);
+#endif
+}
+
+                      // ===============================
+                      // concurrent compare-and-swap test
+                      // ===============================
+
+enum {
+    k_NUM_OBJECTS = 4  // number of objects updated concurrently
+};
+
+template <class IMP>
+struct CasTestParam {
+    // This 'struct' holds the state shared by the threads of the concurrent
+    // compare-and-swap test.
+
+    typename IMP::Object *d_objects;      // objects updated by all threads
+    int                   d_iterations;   // increments per thread and object
+    bsls::AtomicInt       d_numErrors;    // inconsistent values observed
+    bsls::AtomicInt       d_numRunning;   // number of running updaters
+};
+
+template <class IMP>
+void *casUpdaterThread(void *arg)
+    // Increment, with a compare-and-swap loop, the count held by each of the
+    // objects of the 'CasTestParam<IMP>' at the specified 'arg' address the
+    // number of times indicated by that parameter, counting the inconsistent
+    // values that are observed.
+{
+    CasTestParam<IMP> *param = static_cast<CasTestParam<IMP> *>(arg);
+
+    for (int i = 0; i < param->d_iterations; ++i) {
+        for (int j = 0; j < k_NUM_OBJECTS; ++j) {
+            typename IMP::Object *object = &param->d_objects[j];
+
+            Value expected = IMP::load(object);
+            for (;;) {
+                if (!isConsistent(expected)) {
+                    ++param->d_numErrors;
+                }
+                const Value previous = IMP::testAndSwap(
+                                         object,
+                                         expected,
+                                         makeCheckedValue(expected.d_low + 1));
+                if (previous == expected) {
+                    break;
+                }
+                expected = previous;
+            }
+        }
+    }
+
+    --param->d_numRunning;
+    return 0;
+}
+
+template <class IMP>
+void *casReaderThread(void *arg)
+    // Load the values of the objects of the 'CasTestParam<IMP>' at the
+    // specified 'arg' address until all of the updaters are done, counting
+    // the inconsistent values that are observed, and the values that are
+    // smaller than a value loaded previously from the same object.
+{
+    CasTestParam<IMP> *param = static_cast<CasTestParam<IMP> *>(arg);
+
+    Uint64 last[k_NUM_OBJECTS] = { 0 };
+
+    while (0 < param->d_numRunning.loadAcquire()) {
+        for (int j = 0; j < k_NUM_OBJECTS; ++j) {
+            const Value value = IMP::load(&param->d_objects[j]);
+            if (!isConsistent(value) || value.d_low < last[j]) {
+                ++param->d_numErrors;
+            }
+            last[j] = value.d_low;
+        }
+    }
+
+    return 0;
+}
+
+template <class IMP>
+void testConcurrentCas(int numUpdaters, int numReaders, int iterations)
+    // Run the concurrent compare-and-swap test for the implementation 'IMP'
+    // with the specified 'numUpdaters' threads each incrementing each of
+    // 'k_NUM_OBJECTS' objects the specified 'iterations' times, and the
+    // specified 'numReaders' threads concurrently loading those objects.
+{
+    enum { k_MAX_THREADS = 16 };
+
+    BSLS_ASSERT_OPT(numUpdaters + numReaders <= k_MAX_THREADS);
+
+    // The objects start near a carry between the two words, where a torn
+    // value is the most likely to be detected.
+
+    const Uint64 START = ~static_cast<Uint64>(0) - 1000;
+
+    typename IMP::Object objects[k_NUM_OBJECTS];
+    for (int j = 0; j < k_NUM_OBJECTS; ++j) {
+        IMP::store(&objects[j], makeCheckedValue(START));
+    }
+
+    CasTestParam<IMP> param;
+    param.d_objects    = objects;
+    param.d_iterations = iterations;
+    param.d_numRunning = numUpdaters;
+
+    thread_t threads[k_MAX_THREADS];
+    for (int i = 0; i < numUpdaters; ++i) {
+        threads[i] = createThread(&casUpdaterThread<IMP>, &param);
+    }
+    for (int i = 0; i < numReaders; ++i) {
+        threads[numUpdaters + i] =
+                               createThread(&casReaderThread<IMP>, &param);
+    }
+    for (int i = 0; i < numUpdaters + numReaders; ++i) {
+        joinThread(threads[i]);
+    }
+
+    const Uint64 EXPECTED = START + static_cast<Uint64>(numUpdaters)
+                                                                 * iterations;
+
+    LOOP_ASSERT(IMP::name(), 0 == param.d_numErrors);
+    for (int j = 0; j < k_NUM_OBJECTS; ++j) {
+        const Value value = IMP::load(&objects[j]);
+        LOOP2_ASSERT(IMP::name(), j, makeCheckedValue(EXPECTED) == value);
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: An ABA-Safe Lock-Free Stack
+/// - - - - - - - - - - - - - - - - - - -
+// A lock-free stack of nodes ("Treiber stack") is commonly implemented with a
+// single atomic pointer to the top node: 'pop' reads the top node and its
+// successor, and then swaps the successor in, if the top node is unchanged.
+// However, the top node may have been popped, and then pushed again, by other
+// threads in between, with a different successor (the "ABA problem"); a
+// single-word compare-and-swap does not detect that change, and corrupts the
+// stack.  Pairing the pointer with a count that is incremented by every
+// modification of the stack solves the problem.
+//
+// First, we define the type of the nodes of the stack:
+//..
+    struct Node {
+        Node *d_next_p;  // next node on the stack
+        int   d_value;   // value held by this node
+    };
+//..
+// Then, we define a stack of nodes whose top is a pair of words: the address
+// of the top node in 'd_low', and the modification count in 'd_high':
+//..
+    class NodeStack {
+        // This class provides a thread-safe, lock-free stack of nodes.
+
+        // DATA
+        bsls::AtomicDoubleWord d_top;  // address of the top node, and
+                                       // modification count
+
+      public:
+        // MANIPULATORS
+        void push(Node *node);
+            // Push the specified 'node' on this stack.
+
+        Node *pop();
+            // Remove the top node from this stack and return its address, or
+            // return 0 if this stack is empty.
+    };
+//..
+// Next, we implement 'push': the modification count is incremented whenever
+// the top changes, so that 'testAndSwap' fails if any other thread has
+// modified the stack since 'top' was loaded:
+//..
+    void NodeStack::push(Node *node)
+    {
+        typedef bsls::AtomicDoubleWord::Value Value;
+
+        Value top = d_top.loadRelaxed();
+        for (;;) {
+            node->d_next_p = reinterpret_cast<Node *>(top.d_low);
+
+            const Value newTop = {
+                                 reinterpret_cast<bsls::Types::Uint64>(node),
+                                 top.d_high + 1 };
+
+            const Value oldTop = d_top.testAndSwapAcqRel(top, newTop);
+            if (oldTop == top) {
+                return;                                               // RETURN
+            }
+            top = oldTop;
+        }
+    }
+//..
+// Then, we implement 'pop'.  Note that the nodes are assumed to never be
+// deallocated while the stack is in use (e.g., they are held by a free list),
+// so that reading 'd_next_p' from a node that was popped concurrently is
+// harmless: the subsequent 'testAndSwap' fails:
+//..
+    Node *NodeStack::pop()
+    {
+        typedef bsls::AtomicDoubleWord::Value Value;
+
+        Value top = d_top.loadAcquire();
+        for (;;) {
+            Node *node = reinterpret_cast<Node *>(top.d_low);
+            if (!node) {
+                return 0;                                             // RETURN
+            }
+
+            const Value newTop = {
+                     reinterpret_cast<bsls::Types::Uint64>(node->d_next_p),
+                     top.d_high + 1 };
+
+            const Value oldTop = d_top.testAndSwapAcqRel(top, newTop);
+            if (oldTop == top) {
+                return node;                                          // RETURN
+            }
+            top = oldTop;
+        }
+    }
+//..
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                      CONCURRENT LOCK-FREE STACK TEST
+//-----------------------------------------------------------------------------
+
+namespace {
+
+enum {
+    k_NUM_NODES = 8  // number of nodes exchanged by the threads
+};
+
+struct StackTestParam {
+    // This 'struct' holds the state shared by the threads of the concurrent
+    // lock-free stack test.
+
+    NodeStack       *d_stack_p;               // stack of nodes
+    Node            *d_nodes;                 // all nodes
+    bsls::AtomicInt  d_owners[k_NUM_NODES];   // 1 if the node is popped
+    int              d_iterations;            // pops per thread
+    bsls::AtomicInt  d_numErrors;             // nodes owned twice, and
+                                              // empty pops
+};
+
+void *stackThread(void *arg)
+    // Repeatedly pop a node from the stack of the 'StackTestParam' at the
+    // specified 'arg' address, take ownership of it, modify it, release it,
+    // and push it back, the number of times indicated by that parameter,
+    // counting the nodes that are owned by another thread when popped, and
+    // the pops that find the stack empty.
+{
+    StackTestParam *param = static_cast<StackTestParam *>(arg);
+
+    for (int i = 0; i < param->d_iterations; ++i) {
+        Node *node = param->d_stack_p->pop();
+        if (!node) {
+            // There are more nodes than threads: the stack is never empty.
+
+            ++param->d_numErrors;
+            continue;
+        }
+
+        bsls::AtomicInt& owner = param->d_owners[node - param->d_nodes];
+        if (0 != owner.testAndSwap(0, 1)) {
+            ++param->d_numErrors;
+        }
+
+        ++node->d_value;
+
+        owner = 0;
+        param->d_stack_p->push(node);
+    }
+
+    return 0;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+//  bool     veryVeryVerbose = argc > 4;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Finally, we push a few nodes on a stack, and pop them back in reverse
+// order:
+//..
+    Node nodes[3];
+    NodeStack stack;
+
+    for (int i = 0; i < 3; ++i) {
+        nodes[i].d_value = i;
+        stack.push(&nodes[i]);
+    }
+
+    ASSERT(&nodes[2] == stack.pop());
+    ASSERT(&nodes[1] == stack.pop());
+    ASSERT(&nodes[0] == stack.pop());
+    ASSERT(0         == stack.pop());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENT LOCK-FREE STACK (ABA)
+        //
+        // Concerns:
+        //: 1 When several threads concurrently pop nodes from, and push them
+        //:   back on, the lock-free stack of the usage example, no node is
+        //:   ever popped by two threads at once, even though the same nodes
+        //:   (hence the same addresses) are pushed again and again (i.e.,
+        //:   the modification count defeats the ABA problem).
+        //:
+        //: 2 No node is lost or duplicated.
+        //
+        // Plan:
+        //: 1 Push a few nodes on a stack, then run several threads that
+        //:   repeatedly pop a node, mark it as owned (verifying that it was
+        //:   not owned), increment its value, release it, and push it back.
+        //:   (C-1)
+        //:
+        //: 2 Pop all of the nodes, verifying that each node is popped once,
+        //:   and that the total of their values is the total number of
+        //:   successful pops.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENT LOCK-FREE STACK (ABA)
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENT LOCK-FREE STACK (ABA)"
+                            "\n================================\n");
+
+        enum { k_NUM_THREADS = 4, k_ITERATIONS = 1000000 };
+
+        Node      nodes[k_NUM_NODES];
+        NodeStack stack;
+
+        for (int i = 0; i < k_NUM_NODES; ++i) {
+            nodes[i].d_value = 0;
+            stack.push(&nodes[i]);
+        }
+
+        StackTestParam param;
+        param.d_stack_p    = &stack;
+        param.d_nodes      = nodes;
+        param.d_iterations = k_ITERATIONS;
+
+        thread_t threads[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            threads[i] = createThread(&stackThread, &param);
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            joinThread(threads[i]);
+        }
+
+        ASSERT(0 == param.d_numErrors);
+
+        bool popped[k_NUM_NODES] = { false };
+        Int64 total = 0;
+        int   numPopped = 0;
+        while (Node *node = stack.pop()) {
+            const int INDEX = static_cast<int>(node - nodes);
+            LOOP_ASSERT(INDEX, 0 <= INDEX && INDEX < k_NUM_NODES);
+            if (INDEX < 0 || k_NUM_NODES <= INDEX) {
+                break;
+            }
+            LOOP_ASSERT(INDEX, !popped[INDEX]);
+            if (popped[INDEX]) {
+                break;
+            }
+            popped[INDEX] = true;
+            total += node->d_value;
+            ++numPopped;
+        }
+
+        if (veryVerbose) { T_ P_(numPopped) P(total) }
+
+        ASSERT(k_NUM_NODES == numPopped);
+
+        // Every thread pops a node on every iteration (there are more nodes
+        // than threads).
+
+        ASSERT(k_NUM_THREADS * k_ITERATIONS == total);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENT COMPARE-AND-SWAP
+        //
+        // Concerns:
+        //: 1 Concurrent compare-and-swap loops on the same objects lose no
+        //:   update.
+        //:
+        //: 2 Neither 'load' nor 'testAndSwap' ever returns a torn value
+        //:   (i.e., a value of which only one word was updated), even while
+        //:   the objects are updated concurrently.
+        //:
+        //: 3 The values loaded from an object by a thread never decrease.
+        //:
+        //: 4 The lock-based implementation provides the same guarantees.
+        //
+        // Plan:
+        //: 1 Run several threads that increment, with compare-and-swap loops,
+        //:   a count held by each of a few objects, whose high-order word is
+        //:   kept equal to the bitwise complement of the low-order word, and
+        //:   several threads that concurrently load the objects.  Start the
+        //:   counts near a carry into the highest bit of the low-order word.
+        //:   Verify the relation between the words of every value observed,
+        //:   and the final counts.  (C-1..3)
+        //:
+        //: 2 Repeat P-1 for the lock-based implementation.  (C-4)
+        //
+        // Testing:
+        //   CONCURRENT COMPARE-AND-SWAP
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENT COMPARE-AND-SWAP"
+                            "\n===========================\n");
+
+        enum { k_NUM_UPDATERS = 4, k_NUM_READERS = 2, k_ITERATIONS = 200000 };
+
+        if (verbose) printf("\nTesting the native implementation.\n");
+
+        testConcurrentCas<NativeImp>(k_NUM_UPDATERS,
+                                     k_NUM_READERS,
+                                     k_ITERATIONS);
+
+        if (verbose) printf("\nTesting the lock-based implementation.\n");
+
+        testConcurrentCas<LockImp>(k_NUM_UPDATERS,
+                                   k_NUM_READERS,
+                                   k_ITERATIONS);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SWAP AND TEST-AND-SWAP
+        //
+        // Concerns:
+        //: 1 'swap' sets the value, and returns the previous value.
+        //:
+        //: 2 'testAndSwap' sets the value if and only if the value is equal
+        //:   to the compare value, comparing both words, and returns the
+        //:   previous value in either case.
+        //:
+        //: 3 All of the memory-order variants have the same semantics.
+        //:
+        //: 4 The lock-based implementation has the same semantics.
+        //
+        // Plan:
+        //: 1 For a table of (initial, compare, swap) values, including values
+        //:   differing in one word only, apply each variant of 'testAndSwap'
+        //:   to an object, and to a value with 'LockUtil::testAndSwap', and
+        //:   verify the results and the resulting values.  (C-2..4)
+        //:
+        //: 2 Apply each variant of 'swap' to an object, and
+        //:   'LockUtil::swap' to a value, and verify the results.  (C-1, 3..4)
+        //
+        // Testing:
+        //   Value swap(const Value& swapValue);
+        //   Value swapAcqRel(const Value& swapValue);
+        //   Value testAndSwap(const Value& cV, const Value& sV);
+        //   Value testAndSwapAcqRel(const Value& cV, const Value& sV);
+        //   AtomicDoubleWord_LockUtil::load(const Value *object);
+        //   AtomicDoubleWord_LockUtil::store(Value *, const Value&);
+        //   AtomicDoubleWord_LockUtil::swap(Value *, const Value&);
+        //   AtomicDoubleWord_LockUtil::testAndSwap(Value *, cV&, cV&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSWAP AND TEST-AND-SWAP"
+                            "\n======================\n");
+
+        static const struct {
+            int    d_line;
+            Uint64 d_initialLow;
+            Uint64 d_initialHigh;
+            Uint64 d_compareLow;
+            Uint64 d_compareHigh;
+            bool   d_swapped;
+        } DATA[] = {
+            //LINE  INIT_LO   INIT_HI   CMP_LO    CMP_HI    SWAPPED
+            //----  --------  --------  --------  --------  -------
+            { L_,   0,        0,        0,        0,        true    },
+            { L_,   0,        0,        1,        0,        false   },
+            { L_,   0,        0,        0,        1,        false   },
+            { L_,   1,        2,        1,        2,        true    },
+            { L_,   1,        2,        2,        1,        false   },
+            { L_,   1,        2,        1,        3,        false   },
+            { L_,   1,        2,        3,        2,        false   },
+            { L_,   HIGH_BIT, 0,        HIGH_BIT, 0,        true    },
+            { L_,   HIGH_BIT, 0,        0,        HIGH_BIT, false   },
+            { L_,   ~0ULL,    ~0ULL,    ~0ULL,    ~0ULL,    true    },
+            { L_,   ~0ULL,    ~0ULL,    ~0ULL,    0,        false   },
+            { L_,   ~0ULL,    ~0ULL,    0,        ~0ULL,    false   },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const Value SWAP = makeValue(0x0123456789abcdefULL,
+                                     0xfedcba9876543210ULL);
+
+        if (verbose) printf("\nTesting 'testAndSwap'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE    = DATA[ti].d_line;
+            const Value INITIAL = makeValue(DATA[ti].d_initialLow,
+                                            DATA[ti].d_initialHigh);
+            const Value COMPARE = makeValue(DATA[ti].d_compareLow,
+                                            DATA[ti].d_compareHigh);
+            const bool  SWAPPED = DATA[ti].d_swapped;
+            const Value FINAL   = SWAPPED ? SWAP : INITIAL;
+
+            LOOP_ASSERT(LINE, SWAPPED == (INITIAL == COMPARE));
+
+            for (int variant = 0; variant < 2; ++variant) {
+                Obj mX(INITIAL);  const Obj& X = mX;
+
+                const Value RESULT = 0 == variant
+                                   ? mX.testAndSwap(COMPARE, SWAP)
+                                   : mX.testAndSwapAcqRel(COMPARE, SWAP);
+
+                LOOP2_ASSERT(LINE, variant, INITIAL == RESULT);
+                LOOP2_ASSERT(LINE, variant, FINAL   == X.load());
+            }
+
+            Value value = INITIAL;
+            const Value RESULT = LockUtil::testAndSwap(&value, COMPARE, SWAP);
+            LOOP_ASSERT(LINE, INITIAL == RESULT);
+            LOOP_ASSERT(LINE, FINAL   == value);
+            LOOP_ASSERT(LINE, FINAL   == LockUtil::load(&value));
+        }
+
+        if (verbose) printf("\nTesting 'swap'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE  = DATA[ti].d_line;
+            const Value FIRST = makeValue(DATA[ti].d_initialLow,
+                                          DATA[ti].d_initialHigh);
+            const Value NEXT  = makeValue(DATA[ti].d_compareLow,
+                                          DATA[ti].d_compareHigh);
+
+            Obj mX(FIRST);  const Obj& X = mX;
+
+            LOOP_ASSERT(LINE, FIRST == mX.swap(NEXT));
+            LOOP_ASSERT(LINE, NEXT  == X.load());
+            LOOP_ASSERT(LINE, NEXT  == mX.swapAcqRel(SWAP));
+            LOOP_ASSERT(LINE, SWAP  == X.load());
+
+            Value value = FIRST;
+            LOOP_ASSERT(LINE, FIRST == LockUtil::swap(&value, NEXT));
+            LOOP_ASSERT(LINE, NEXT  == value);
+
+            LockUtil::store(&value, SWAP);
+            LOOP_ASSERT(LINE, SWAP  == value);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // VALUE OPERATORS, CREATORS, LOAD, AND STORE
+        //
+        // Concerns:
+        //: 1 Two 'Value' objects compare equal if and only if both of their
+        //:   words are equal.
+        //:
+        //: 2 A default-constructed object has the value '{ 0, 0 }', and an
+        //:   object constructed with a value has that value.
+        //:
+        //: 3 Every variant of 'store' sets the value, and every variant of
+        //:   'load' returns it, including values with all bits set.
+        //:
+        //: 4 Where the implementation is lock-free, objects are 16-byte
+        //:   aligned, as 'cmpxchg16b' requires.
+        //:
+        //: 5 'isLockFree' is 'true' on x86-64 with GCC, Clang, and MSVC.
+        //
+        // Plan:
+        //: 1 Compare pairs of values from a table, with '==' and '!='.  (C-1)
+        //:
+        //: 2 Construct objects, and load their values.  (C-2)
+        //:
+        //: 3 Store each value of the table with each variant of 'store', and
+        //:   load it with each variant of 'load'.  (C-3)
+        //:
+        //: 4 Verify the addresses of automatic and static objects, and of
+        //:   the elements of arrays.  (C-4)
+        //:
+        //: 5 Verify 'isLockFree' according to the platform.  (C-5)
+        //
+        // Testing:
+        //   static bool isLockFree();
+        //   AtomicDoubleWord();
+        //   explicit AtomicDoubleWord(const Value& value);
+        //   void store(const Value& value);
+        //   void storeRelaxed(const Value& value);
+        //   void storeRelease(const Value& value);
+        //   Value load() const;
+        //   Value loadAcquire() const;
+        //   Value loadRelaxed() const;
+        //   bool operator==(const Value& lhs, const Value& rhs);
+        //   bool operator!=(const Value& lhs, const Value& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nVALUE OPERATORS, CREATORS, LOAD, AND STORE"
+                            "\n==========================================\n");
+
+        static const struct {
+            int    d_line;
+            Uint64 d_low;
+            Uint64 d_high;
+        } DATA[] = {
+            //LINE  LOW                    HIGH
+            //----  ---------------------  ---------------------
+            { L_,   0,                     0                     },
+            { L_,   1,                     0                     },
+            { L_,   0,                     1                     },
+            { L_,   1,                     1                     },
+            { L_,   HIGH_BIT,              0                     },
+            { L_,   0,                     HIGH_BIT              },
+            { L_,   0x0123456789abcdefULL, 0xfedcba9876543210ULL },
+            { L_,   ~0ULL,                 0                     },
+            { L_,   0,                     ~0ULL                 },
+            { L_,   ~0ULL,                 ~0ULL                 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) printf("\nTesting 'operator==' and 'operator!='.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const Value U = makeValue(DATA[ti].d_low, DATA[ti].d_high);
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const Value V = makeValue(DATA[tj].d_low, DATA[tj].d_high);
+                const bool  EXP = ti == tj;
+
+                LOOP2_ASSERT(ti, tj,  EXP == (U == V));
+                LOOP2_ASSERT(ti, tj, !EXP == (U != V));
+            }
+        }
+
+        if (verbose) printf("\nTesting creators.\n");
+        {
+            const Obj X;
+            ASSERT(makeValue(0, 0) == X.load());
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE  = DATA[ti].d_line;
+                const Value VALUE = makeValue(DATA[ti].d_low,
+                                              DATA[ti].d_high);
+
+                const Obj Y(VALUE);
+                LOOP_ASSERT(LINE, VALUE == Y.load());
+            }
+        }
+
+        if (verbose) printf("\nTesting 'store' and 'load'.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE  = DATA[ti].d_line;
+            const Value VALUE = makeValue(DATA[ti].d_low, DATA[ti].d_high);
+
+            for (int variant = 0; variant < 3; ++variant) {
+                Obj mX;  const Obj& X = mX;
+
+                switch (variant) {
+                  case 0: mX.store(VALUE);        break;
+                  case 1: mX.storeRelaxed(VALUE); break;
+                  case 2: mX.storeRelease(VALUE); break;
+                }
+
+                LOOP2_ASSERT(LINE, variant, VALUE == X.load());
+                LOOP2_ASSERT(LINE, variant, VALUE == X.loadAcquire());
+                LOOP2_ASSERT(LINE, variant, VALUE == X.loadRelaxed());
+            }
+        }
+
+        if (verbose) printf("\nTesting alignment.\n");
+
+        if (Obj::isLockFree()) {
+            static Obj staticObject;
+            Obj        automaticObject;
+            Obj        array[3];
+
+            ASSERT(0 == reinterpret_cast<UintPtr>(&staticObject)    % 16);
+            ASSERT(0 == reinterpret_cast<UintPtr>(&automaticObject) % 16);
+            for (int i = 0; i < 3; ++i) {
+                LOOP_ASSERT(i, 0 == reinterpret_cast<UintPtr>(&array[i]) % 16);
+            }
+        }
+
+        if (verbose) printf("\nTesting 'isLockFree'.\n");
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)       \
+  || defined(BSLS_PLATFORM_CMP_MSVC))
+        ASSERT(true == Obj::isLockFree());
+#else
+        ASSERT(false == Obj::isLockFree());
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, and exercise its operations.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        if (veryVerbose) { T_ P(Obj::isLockFree()) }
+
+        const Value A = makeValue(1, 2);
+        const Value B = makeValue(3, 4);
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(makeValue(0, 0) == X.load());
+
+        mX.store(A);
+        ASSERT(A == X.load());
+
+        ASSERT(A == mX.testAndSwap(B, B));  // fails
+        ASSERT(A == X.load());
+
+        ASSERT(A == mX.testAndSwap(A, B));  // succeeds
+        ASSERT(B == X.load());
+
+        ASSERT(B == mX.swap(A));
+        ASSERT(A == X.loadRelaxed());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'load' AND 'testAndSwap'
+        //
+        // Concerns:
+        //: 1 The uncontended operations cost about as much as a single-word
+        //:   locked instruction, and the lock-based implementation is not
+        //:   much slower in the absence of contention.
+        //
+        // Plan:
+        //: 1 Time loops of 'load' and successful 'testAndSwap' operations on
+        //:   an object, and with 'LockUtil' on a value.
+        //
+        // Testing:
+        //   PERFORMANCE: 'load' AND 'testAndSwap'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: 'load' AND 'testAndSwap'"
+                            "\n=====================================\n");
+
+        const int NUM_ITERATIONS = verbose ? atoi(argv[2]) : 10000000;
+
+        Obj   mX;  const Obj& X = mX;
+        Value value = makeValue(0, 0);
+        Value sum   = makeValue(0, 0);
+
+        {
+            const Int64 t0 = TU::getTimer();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                sum.d_low += X.load().d_low;
+            }
+            const Int64 t1 = TU::getTimer();
+            printf("native load:           %6.2f nsec per call\n",
+                   (double)(t1 - t0) / NUM_ITERATIONS);
+        }
+        {
+            const Int64 t0 = TU::getTimer();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                mX.testAndSwap(makeValue(i, i), makeValue(i + 1, i + 1));
+            }
+            const Int64 t1 = TU::getTimer();
+            printf("native testAndSwap:    %6.2f nsec per call\n",
+                   (double)(t1 - t0) / NUM_ITERATIONS);
+        }
+        {
+            const Int64 t0 = TU::getTimer();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                sum.d_low += LockUtil::load(&value).d_low;
+            }
+            const Int64 t1 = TU::getTimer();
+            printf("lock load:             %6.2f nsec per call\n",
+                   (double)(t1 - t0) / NUM_ITERATIONS);
+        }
+        {
+            const Int64 t0 = TU::getTimer();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                LockUtil::testAndSwap(&value,
+                                      makeValue(i, i),
+                                      makeValue(i + 1, i + 1));
+            }
+            const Int64 t1 = TU::getTimer();
+            printf("lock testAndSwap:      %6.2f nsec per call\n",
+                   (double)(t1 - t0) / NUM_ITERATIONS);
+        }
+
+        const Uint64 N = NUM_ITERATIONS;
+        ASSERT(makeValue(N, N) == X.load());
+        ASSERT(makeValue(N, N) == value);
+        if (veryVerbose) { T_ P(sum.d_low) }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
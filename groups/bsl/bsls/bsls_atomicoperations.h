@@ -191,6 +191,29 @@ BSLS_IDENT("$Id: $")
 // to determine the resulting value of an operation than to simply perform the
 // operation.
 //
+///Atomic Bitwise Operations
+///-------------------------
+// The atomic bitwise operations set the value of an atomic integer to the
+// bitwise OR, AND, or exclusive OR of that value and an operand, and are most
+// commonly used to manipulate flag words and bitmaps shared among threads.
+// Two sub-types of manipulators are provided: functions whose names begin
+// with "fetch" (e.g., 'fetchOrInt', 'fetchAndInt64') return the previous
+// value of the atomic integer; those without the prefix (e.g., 'orInt',
+// 'xorInt64') do not return a value.  As for the "Nv" manipulators, an
+// application that does not require the previous value should not use the
+// "fetch" manipulators: on x86 and x86-64 platforms, 'orInt', 'andInt', and
+// 'xorInt' (and their 'Int64' counterparts on x86-64) are each implemented by
+// a single locked instruction, whereas the "fetch" manipulators are
+// implemented by a compare-and-swap loop, which may have to be retried
+// repeatedly when the atomic integer is contended.
+//
+// 'testAndSetBitInt' and 'testAndClearBitInt' (and their 'Int64'
+// counterparts) respectively set and clear a single bit of an atomic integer,
+// and return whether that bit was set before the operation.  These functions
+// are the preferred way to claim and release an entry in a shared bitmap; on
+// x86 and x86-64 platforms, they are implemented by the locked 'bts' and
+// 'btr' instructions.
+//
 ///Atomic Pointer Operations
 ///-------------------------
 // The atomic pointer operations provide thread-safe access to pointer values
@@ -880,6 +903,154 @@ struct AtomicOperations {
         // Atomically decrement the value of the specified 'atomicInt' by 1,
         // providing the acquire/release memory ordering guarantee.
 
+    static int fetchOrInt(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of that value and the specified 'value', and return the previous
+        // value of 'atomicInt', providing the sequential consistency memory
+        // ordering guarantee.
+
+    static int fetchOrIntRelaxed(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of that value and the specified 'value', and return the previous
+        // value of 'atomicInt', without providing any memory ordering
+        // guarantees.
+
+    static int fetchOrIntAcqRel(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of that value and the specified 'value', and return the previous
+        // value of 'atomicInt', providing the acquire/release memory ordering
+        // guarantee.
+
+    static void orInt(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of that value and the specified 'value', providing the sequential
+        // consistency memory ordering guarantee.
+
+    static void orIntRelaxed(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of that value and the specified 'value', without providing any
+        // memory ordering guarantees.
+
+    static void orIntAcqRel(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of that value and the specified 'value', providing the
+        // acquire/release memory ordering guarantee.
+
+    static int fetchAndInt(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of that value and the specified 'value', and return the previous
+        // value of 'atomicInt', providing the sequential consistency memory
+        // ordering guarantee.
+
+    static int fetchAndIntRelaxed(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of that value and the specified 'value', and return the previous
+        // value of 'atomicInt', without providing any memory ordering
+        // guarantees.
+
+    static int fetchAndIntAcqRel(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of that value and the specified 'value', and return the previous
+        // value of 'atomicInt', providing the acquire/release memory ordering
+        // guarantee.
+
+    static void andInt(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of that value and the specified 'value', providing the
+        // sequential consistency memory ordering guarantee.
+
+    static void andIntRelaxed(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of that value and the specified 'value', without providing any
+        // memory ordering guarantees.
+
+    static void andIntAcqRel(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of that value and the specified 'value', providing the
+        // acquire/release memory ordering guarantee.
+
+    static int fetchXorInt(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // exclusive OR of that value and the specified 'value', and return the
+        // previous value of 'atomicInt', providing the sequential consistency
+        // memory ordering guarantee.
+
+    static int fetchXorIntRelaxed(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // exclusive OR of that value and the specified 'value', and return the
+        // previous value of 'atomicInt', without providing any memory ordering
+        // guarantees.
+
+    static int fetchXorIntAcqRel(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // exclusive OR of that value and the specified 'value', and return the
+        // previous value of 'atomicInt', providing the acquire/release memory
+        // ordering guarantee.
+
+    static void xorInt(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // exclusive OR of that value and the specified 'value', providing the
+        // sequential consistency memory ordering guarantee.
+
+    static void xorIntRelaxed(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // exclusive OR of that value and the specified 'value', without
+        // providing any memory ordering guarantees.
+
+    static void xorIntAcqRel(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // exclusive OR of that value and the specified 'value', providing the
+        // acquire/release memory ordering guarantee.
+
+    static bool testAndSetBitInt(AtomicTypes::Int *atomicInt, int index);
+        // Atomically set the bit at the specified 'index' (where bit 0 is the
+        // least significant bit) in the value of the specified 'atomicInt',
+        // and return 'true' if that bit was set before the operation, and
+        // 'false' otherwise, providing the sequential consistency memory
+        // ordering guarantee.  The behavior is undefined unless '0 <= index <
+        // 32'.
+
+    static bool testAndSetBitIntRelaxed(AtomicTypes::Int *atomicInt,
+                                        int               index);
+        // Atomically set the bit at the specified 'index' (where bit 0 is the
+        // least significant bit) in the value of the specified 'atomicInt',
+        // and return 'true' if that bit was set before the operation, and
+        // 'false' otherwise, without providing any memory ordering guarantees.
+        // The behavior is undefined unless '0 <= index < 32'.
+
+    static bool testAndSetBitIntAcqRel(AtomicTypes::Int *atomicInt, int index);
+        // Atomically set the bit at the specified 'index' (where bit 0 is the
+        // least significant bit) in the value of the specified 'atomicInt',
+        // and return 'true' if that bit was set before the operation, and
+        // 'false' otherwise, providing the acquire/release memory ordering
+        // guarantee.  The behavior is undefined unless '0 <= index < 32'.
+
+    static bool testAndClearBitInt(AtomicTypes::Int *atomicInt, int index);
+        // Atomically clear the bit at the specified 'index' (where bit 0 is
+        // the least significant bit) in the value of the specified
+        // 'atomicInt', and return 'true' if that bit was set before the
+        // operation, and 'false' otherwise, providing the sequential
+        // consistency memory ordering guarantee.  The behavior is undefined
+        // unless '0 <= index < 32'.
+
+    static bool testAndClearBitIntRelaxed(AtomicTypes::Int *atomicInt,
+                                          int               index);
+        // Atomically clear the bit at the specified 'index' (where bit 0 is
+        // the least significant bit) in the value of the specified
+        // 'atomicInt', and return 'true' if that bit was set before the
+        // operation, and 'false' otherwise, without providing any memory
+        // ordering guarantees.  The behavior is undefined unless '0 <= index <
+        // 32'.
+
+    static bool testAndClearBitIntAcqRel(AtomicTypes::Int *atomicInt,
+                                         int               index);
+        // Atomically clear the bit at the specified 'index' (where bit 0 is
+        // the least significant bit) in the value of the specified
+        // 'atomicInt', and return 'true' if that bit was set before the
+        // operation, and 'false' otherwise, providing the acquire/release
+        // memory ordering guarantee.  The behavior is undefined unless '0 <=
+        // index < 32'.
+
         // *** atomic functions for Int64 ***
 
     static void initInt64(AtomicTypes::Int64 *atomicInt,
@@ -1017,6 +1188,170 @@ struct AtomicOperations {
         // resulting value, providing the acquire/release memory ordering
         // guarantee.
 
+    static Types::Int64 fetchOrInt64(AtomicTypes::Int64 *atomicInt,
+                                     Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of that value and the specified 'value', and return the previous
+        // value of 'atomicInt', providing the sequential consistency memory
+        // ordering guarantee.
+
+    static Types::Int64 fetchOrInt64Relaxed(AtomicTypes::Int64 *atomicInt,
+                                            Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of that value and the specified 'value', and return the previous
+        // value of 'atomicInt', without providing any memory ordering
+        // guarantees.
+
+    static Types::Int64 fetchOrInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                           Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of that value and the specified 'value', and return the previous
+        // value of 'atomicInt', providing the acquire/release memory ordering
+        // guarantee.
+
+    static void orInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of that value and the specified 'value', providing the sequential
+        // consistency memory ordering guarantee.
+
+    static void orInt64Relaxed(AtomicTypes::Int64 *atomicInt,
+                               Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of that value and the specified 'value', without providing any
+        // memory ordering guarantees.
+
+    static void orInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                              Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of that value and the specified 'value', providing the
+        // acquire/release memory ordering guarantee.
+
+    static Types::Int64 fetchAndInt64(AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of that value and the specified 'value', and return the previous
+        // value of 'atomicInt', providing the sequential consistency memory
+        // ordering guarantee.
+
+    static Types::Int64 fetchAndInt64Relaxed(AtomicTypes::Int64 *atomicInt,
+                                             Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of that value and the specified 'value', and return the previous
+        // value of 'atomicInt', without providing any memory ordering
+        // guarantees.
+
+    static Types::Int64 fetchAndInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                            Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of that value and the specified 'value', and return the previous
+        // value of 'atomicInt', providing the acquire/release memory ordering
+        // guarantee.
+
+    static void andInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of that value and the specified 'value', providing the
+        // sequential consistency memory ordering guarantee.
+
+    static void andInt64Relaxed(AtomicTypes::Int64 *atomicInt,
+                                Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of that value and the specified 'value', without providing any
+        // memory ordering guarantees.
+
+    static void andInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                               Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of that value and the specified 'value', providing the
+        // acquire/release memory ordering guarantee.
+
+    static Types::Int64 fetchXorInt64(AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // exclusive OR of that value and the specified 'value', and return the
+        // previous value of 'atomicInt', providing the sequential consistency
+        // memory ordering guarantee.
+
+    static Types::Int64 fetchXorInt64Relaxed(AtomicTypes::Int64 *atomicInt,
+                                             Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // exclusive OR of that value and the specified 'value', and return the
+        // previous value of 'atomicInt', without providing any memory ordering
+        // guarantees.
+
+    static Types::Int64 fetchXorInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                            Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // exclusive OR of that value and the specified 'value', and return the
+        // previous value of 'atomicInt', providing the acquire/release memory
+        // ordering guarantee.
+
+    static void xorInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // exclusive OR of that value and the specified 'value', providing the
+        // sequential consistency memory ordering guarantee.
+
+    static void xorInt64Relaxed(AtomicTypes::Int64 *atomicInt,
+                                Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // exclusive OR of that value and the specified 'value', without
+        // providing any memory ordering guarantees.
+
+    static void xorInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                               Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // exclusive OR of that value and the specified 'value', providing the
+        // acquire/release memory ordering guarantee.
+
+    static bool testAndSetBitInt64(AtomicTypes::Int64 *atomicInt, int index);
+        // Atomically set the bit at the specified 'index' (where bit 0 is the
+        // least significant bit) in the value of the specified 'atomicInt',
+        // and return 'true' if that bit was set before the operation, and
+        // 'false' otherwise, providing the sequential consistency memory
+        // ordering guarantee.  The behavior is undefined unless '0 <= index <
+        // 64'.
+
+    static bool testAndSetBitInt64Relaxed(AtomicTypes::Int64 *atomicInt,
+                                          int                 index);
+        // Atomically set the bit at the specified 'index' (where bit 0 is the
+        // least significant bit) in the value of the specified 'atomicInt',
+        // and return 'true' if that bit was set before the operation, and
+        // 'false' otherwise, without providing any memory ordering guarantees.
+        // The behavior is undefined unless '0 <= index < 64'.
+
+    static bool testAndSetBitInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                         int                 index);
+        // Atomically set the bit at the specified 'index' (where bit 0 is the
+        // least significant bit) in the value of the specified 'atomicInt',
+        // and return 'true' if that bit was set before the operation, and
+        // 'false' otherwise, providing the acquire/release memory ordering
+        // guarantee.  The behavior is undefined unless '0 <= index < 64'.
+
+    static bool testAndClearBitInt64(AtomicTypes::Int64 *atomicInt, int index);
+        // Atomically clear the bit at the specified 'index' (where bit 0 is
+        // the least significant bit) in the value of the specified
+        // 'atomicInt', and return 'true' if that bit was set before the
+        // operation, and 'false' otherwise, providing the sequential
+        // consistency memory ordering guarantee.  The behavior is undefined
+        // unless '0 <= index < 64'.
+
+    static bool testAndClearBitInt64Relaxed(AtomicTypes::Int64 *atomicInt,
+                                            int                 index);
+        // Atomically clear the bit at the specified 'index' (where bit 0 is
+        // the least significant bit) in the value of the specified
+        // 'atomicInt', and return 'true' if that bit was set before the
+        // operation, and 'false' otherwise, without providing any memory
+        // ordering guarantees.  The behavior is undefined unless '0 <= index <
+        // 64'.
+
+    static bool testAndClearBitInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                           int                 index);
+        // Atomically clear the bit at the specified 'index' (where bit 0 is
+        // the least significant bit) in the value of the specified
+        // 'atomicInt', and return 'true' if that bit was set before the
+        // operation, and 'false' otherwise, providing the acquire/release
+        // memory ordering guarantee.  The behavior is undefined unless '0 <=
+        // index < 64'.
+
         // *** atomic functions for pointer ***
 
     static void initPointer(AtomicTypes::Pointer *atomicPtr,
@@ -1245,6 +1580,157 @@ void AtomicOperations::decrementIntAcqRel(AtomicTypes::Int *atomicInt)
     Imp::decrementIntAcqRel(atomicInt);
 }
 
+inline
+int AtomicOperations::fetchOrInt(AtomicTypes::Int *atomicInt, int value)
+{
+    return Imp::fetchOrInt(atomicInt, value);
+}
+
+inline
+int AtomicOperations::fetchOrIntRelaxed(AtomicTypes::Int *atomicInt, int value)
+{
+    return Imp::fetchOrIntRelaxed(atomicInt, value);
+}
+
+inline
+int AtomicOperations::fetchOrIntAcqRel(AtomicTypes::Int *atomicInt, int value)
+{
+    return Imp::fetchOrIntAcqRel(atomicInt, value);
+}
+
+inline
+void AtomicOperations::orInt(AtomicTypes::Int *atomicInt, int value)
+{
+    Imp::orInt(atomicInt, value);
+}
+
+inline
+void AtomicOperations::orIntRelaxed(AtomicTypes::Int *atomicInt, int value)
+{
+    Imp::orIntRelaxed(atomicInt, value);
+}
+
+inline
+void AtomicOperations::orIntAcqRel(AtomicTypes::Int *atomicInt, int value)
+{
+    Imp::orIntAcqRel(atomicInt, value);
+}
+
+inline
+int AtomicOperations::fetchAndInt(AtomicTypes::Int *atomicInt, int value)
+{
+    return Imp::fetchAndInt(atomicInt, value);
+}
+
+inline
+int AtomicOperations::fetchAndIntRelaxed(AtomicTypes::Int *atomicInt,
+                                         int               value)
+{
+    return Imp::fetchAndIntRelaxed(atomicInt, value);
+}
+
+inline
+int AtomicOperations::fetchAndIntAcqRel(AtomicTypes::Int *atomicInt, int value)
+{
+    return Imp::fetchAndIntAcqRel(atomicInt, value);
+}
+
+inline
+void AtomicOperations::andInt(AtomicTypes::Int *atomicInt, int value)
+{
+    Imp::andInt(atomicInt, value);
+}
+
+inline
+void AtomicOperations::andIntRelaxed(AtomicTypes::Int *atomicInt, int value)
+{
+    Imp::andIntRelaxed(atomicInt, value);
+}
+
+inline
+void AtomicOperations::andIntAcqRel(AtomicTypes::Int *atomicInt, int value)
+{
+    Imp::andIntAcqRel(atomicInt, value);
+}
+
+inline
+int AtomicOperations::fetchXorInt(AtomicTypes::Int *atomicInt, int value)
+{
+    return Imp::fetchXorInt(atomicInt, value);
+}
+
+inline
+int AtomicOperations::fetchXorIntRelaxed(AtomicTypes::Int *atomicInt,
+                                         int               value)
+{
+    return Imp::fetchXorIntRelaxed(atomicInt, value);
+}
+
+inline
+int AtomicOperations::fetchXorIntAcqRel(AtomicTypes::Int *atomicInt, int value)
+{
+    return Imp::fetchXorIntAcqRel(atomicInt, value);
+}
+
+inline
+void AtomicOperations::xorInt(AtomicTypes::Int *atomicInt, int value)
+{
+    Imp::xorInt(atomicInt, value);
+}
+
+inline
+void AtomicOperations::xorIntRelaxed(AtomicTypes::Int *atomicInt, int value)
+{
+    Imp::xorIntRelaxed(atomicInt, value);
+}
+
+inline
+void AtomicOperations::xorIntAcqRel(AtomicTypes::Int *atomicInt, int value)
+{
+    Imp::xorIntAcqRel(atomicInt, value);
+}
+
+inline
+bool AtomicOperations::testAndSetBitInt(AtomicTypes::Int *atomicInt, int index)
+{
+    return Imp::testAndSetBitInt(atomicInt, index);
+}
+
+inline
+bool AtomicOperations::testAndSetBitIntRelaxed(AtomicTypes::Int *atomicInt,
+                                               int               index)
+{
+    return Imp::testAndSetBitIntRelaxed(atomicInt, index);
+}
+
+inline
+bool AtomicOperations::testAndSetBitIntAcqRel(AtomicTypes::Int *atomicInt,
+                                              int               index)
+{
+    return Imp::testAndSetBitIntAcqRel(atomicInt, index);
+}
+
+inline
+bool AtomicOperations::testAndClearBitInt(AtomicTypes::Int *atomicInt,
+                                          int               index)
+{
+    return Imp::testAndClearBitInt(atomicInt, index);
+}
+
+inline
+bool AtomicOperations::testAndClearBitIntRelaxed(AtomicTypes::Int *atomicInt,
+                                                 int               index)
+{
+    return Imp::testAndClearBitIntRelaxed(atomicInt, index);
+}
+
+inline
+bool AtomicOperations::testAndClearBitIntAcqRel(AtomicTypes::Int *atomicInt,
+                                                int               index)
+{
+    return Imp::testAndClearBitIntAcqRel(atomicInt, index);
+}
+
 inline
 void AtomicOperations::initInt64(AtomicTypes::Int64 *atomicInt,
                                  Types::Int64        initialValue)
@@ -1420,6 +1906,182 @@ Types::Int64
     return Imp::decrementInt64NvAcqRel(atomicInt);
 }
 
+inline
+Types::Int64 AtomicOperations::fetchOrInt64(AtomicTypes::Int64 *atomicInt,
+                                            Types::Int64        value)
+{
+    return Imp::fetchOrInt64(atomicInt, value);
+}
+
+inline
+Types::Int64
+    AtomicOperations::fetchOrInt64Relaxed(AtomicTypes::Int64 *atomicInt,
+                                          Types::Int64        value)
+{
+    return Imp::fetchOrInt64Relaxed(atomicInt, value);
+}
+
+inline
+Types::Int64
+    AtomicOperations::fetchOrInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                         Types::Int64        value)
+{
+    return Imp::fetchOrInt64AcqRel(atomicInt, value);
+}
+
+inline
+void AtomicOperations::orInt64(AtomicTypes::Int64 *atomicInt,
+                               Types::Int64        value)
+{
+    Imp::orInt64(atomicInt, value);
+}
+
+inline
+void AtomicOperations::orInt64Relaxed(AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64        value)
+{
+    Imp::orInt64Relaxed(atomicInt, value);
+}
+
+inline
+void AtomicOperations::orInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                     Types::Int64        value)
+{
+    Imp::orInt64AcqRel(atomicInt, value);
+}
+
+inline
+Types::Int64 AtomicOperations::fetchAndInt64(AtomicTypes::Int64 *atomicInt,
+                                             Types::Int64        value)
+{
+    return Imp::fetchAndInt64(atomicInt, value);
+}
+
+inline
+Types::Int64
+    AtomicOperations::fetchAndInt64Relaxed(AtomicTypes::Int64 *atomicInt,
+                                           Types::Int64        value)
+{
+    return Imp::fetchAndInt64Relaxed(atomicInt, value);
+}
+
+inline
+Types::Int64
+    AtomicOperations::fetchAndInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                          Types::Int64        value)
+{
+    return Imp::fetchAndInt64AcqRel(atomicInt, value);
+}
+
+inline
+void AtomicOperations::andInt64(AtomicTypes::Int64 *atomicInt,
+                                Types::Int64        value)
+{
+    Imp::andInt64(atomicInt, value);
+}
+
+inline
+void AtomicOperations::andInt64Relaxed(AtomicTypes::Int64 *atomicInt,
+                                       Types::Int64        value)
+{
+    Imp::andInt64Relaxed(atomicInt, value);
+}
+
+inline
+void AtomicOperations::andInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64        value)
+{
+    Imp::andInt64AcqRel(atomicInt, value);
+}
+
+inline
+Types::Int64 AtomicOperations::fetchXorInt64(AtomicTypes::Int64 *atomicInt,
+                                             Types::Int64        value)
+{
+    return Imp::fetchXorInt64(atomicInt, value);
+}
+
+inline
+Types::Int64
+    AtomicOperations::fetchXorInt64Relaxed(AtomicTypes::Int64 *atomicInt,
+                                           Types::Int64        value)
+{
+    return Imp::fetchXorInt64Relaxed(atomicInt, value);
+}
+
+inline
+Types::Int64
+    AtomicOperations::fetchXorInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                          Types::Int64        value)
+{
+    return Imp::fetchXorInt64AcqRel(atomicInt, value);
+}
+
+inline
+void AtomicOperations::xorInt64(AtomicTypes::Int64 *atomicInt,
+                                Types::Int64        value)
+{
+    Imp::xorInt64(atomicInt, value);
+}
+
+inline
+void AtomicOperations::xorInt64Relaxed(AtomicTypes::Int64 *atomicInt,
+                                       Types::Int64        value)
+{
+    Imp::xorInt64Relaxed(atomicInt, value);
+}
+
+inline
+void AtomicOperations::xorInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64        value)
+{
+    Imp::xorInt64AcqRel(atomicInt, value);
+}
+
+inline
+bool AtomicOperations::testAndSetBitInt64(AtomicTypes::Int64 *atomicInt,
+                                          int                 index)
+{
+    return Imp::testAndSetBitInt64(atomicInt, index);
+}
+
+inline
+bool AtomicOperations::testAndSetBitInt64Relaxed(AtomicTypes::Int64 *atomicInt,
+                                                 int                 index)
+{
+    return Imp::testAndSetBitInt64Relaxed(atomicInt, index);
+}
+
+inline
+bool AtomicOperations::testAndSetBitInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                                int                 index)
+{
+    return Imp::testAndSetBitInt64AcqRel(atomicInt, index);
+}
+
+inline
+bool AtomicOperations::testAndClearBitInt64(AtomicTypes::Int64 *atomicInt,
+                                            int                 index)
+{
+    return Imp::testAndClearBitInt64(atomicInt, index);
+}
+
+inline
+bool AtomicOperations::testAndClearBitInt64Relaxed(
+                                                 AtomicTypes::Int64 *atomicInt,
+                                                 int                 index)
+{
+    return Imp::testAndClearBitInt64Relaxed(atomicInt, index);
+}
+
+inline
+bool
+    AtomicOperations::testAndClearBitInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                                 int                 index)
+{
+    return Imp::testAndClearBitInt64AcqRel(atomicInt, index);
+}
+
 inline
 void AtomicOperations::initPointer(AtomicTypes::Pointer *atomicPtr,
                                    const void           *initialValue)
@@ -58,6 +58,22 @@ using namespace std;
 // [2 ] setPtr(Pointer *aPointer, void *value);
 // [4 ] swapPtr(Pointer *aPointer, void *value);
 // [4 ] testAndSwapPtr(Pointer *, void *, void *);
+// [13] fetchOrInt(Int *aInt, int value);
+// [13] fetchAndInt(Int *aInt, int value);
+// [13] fetchXorInt(Int *aInt, int value);
+// [13] orInt(Int *aInt, int value);
+// [13] andInt(Int *aInt, int value);
+// [13] xorInt(Int *aInt, int value);
+// [13] testAndSetBitInt(Int *aInt, int index);
+// [13] testAndClearBitInt(Int *aInt, int index);
+// [13] fetchOrInt64(Int64 *, bsls::Types::Int64);
+// [13] fetchAndInt64(Int64 *, bsls::Types::Int64);
+// [13] fetchXorInt64(Int64 *, bsls::Types::Int64);
+// [13] orInt64(Int64 *, bsls::Types::Int64);
+// [13] andInt64(Int64 *, bsls::Types::Int64);
+// [13] xorInt64(Int64 *, bsls::Types::Int64);
+// [13] testAndSetBitInt64(Int64 *aInt, int index);
+// [13] testAndClearBitInt64(Int64 *aInt, int index);
 //-----------------------------------------------------------------------------
 // [1 ] Breathing test
 // [7 ] Usage examples
@@ -1150,6 +1166,72 @@ static void* testAndSwapPtrAcqRelTestThread(void *ptr)
     return ptr;
 }
 
+struct Case13
+{
+    Types::Int   *d_int_p;
+    Types::Int64 *d_int64_p;
+    int           d_bit;
+    int           d_iterations;
+};
+
+static void* case13Thread(void* ptr)
+    // This function is used to test the bitwise manipulators.  It repeatedly
+    // sets and clears the bit 'd_bit' of the specified 32 and 64 bit atomic
+    // integer objects with each bitwise manipulator, and verifies that the
+    // bit has the expected state after each operation.  Since each thread
+    // owns a distinct bit, a lost update would be detected by this thread or
+    // by its siblings.
+{
+    Case13 *args = (Case13*) ptr;
+
+    const int BIT       = args->d_bit;
+    const int MASK      = 1 << BIT;
+    const int BIT64     = BIT + 30;
+    const bsls::Types::Int64 MASK64 = 1LL << BIT64;
+
+    Types::Int   *pInt   = args->d_int_p;
+    Types::Int64 *pInt64 = args->d_int64_p;
+
+    for (int i = 0; i < args->d_iterations; ++i) {
+        LOOP2_ASSERT(BIT, i, !Obj::testAndSetBitInt(pInt, BIT));
+        LOOP2_ASSERT(BIT, i, Obj::testAndClearBitIntAcqRel(pInt, BIT));
+
+        Obj::orInt(pInt, MASK);
+        LOOP2_ASSERT(BIT, i, Obj::getIntRelaxed(pInt) & MASK);
+        Obj::xorIntRelaxed(pInt, MASK);
+        LOOP2_ASSERT(BIT, i, !(Obj::getIntRelaxed(pInt) & MASK));
+        LOOP2_ASSERT(BIT, i, !(Obj::fetchXorIntAcqRel(pInt, MASK) & MASK));
+        LOOP2_ASSERT(BIT, i, Obj::fetchAndInt(pInt, ~MASK) & MASK);
+
+        LOOP2_ASSERT(BIT64, i, !Obj::testAndSetBitInt64(pInt64, BIT64));
+        LOOP2_ASSERT(BIT64, i,
+                     Obj::testAndClearBitInt64Relaxed(pInt64, BIT64));
+
+        Obj::xorInt64(pInt64, MASK64);
+        LOOP2_ASSERT(BIT64, i, Obj::getInt64Relaxed(pInt64) & MASK64);
+        Obj::andInt64AcqRel(pInt64, ~MASK64);
+        LOOP2_ASSERT(BIT64, i, !(Obj::getInt64Relaxed(pInt64) & MASK64));
+        LOOP2_ASSERT(BIT64, i,
+                     !(Obj::fetchOrInt64Relaxed(pInt64, MASK64) & MASK64));
+        LOOP2_ASSERT(BIT64, i,
+                     Obj::fetchXorInt64(pInt64, MASK64) & MASK64);
+    }
+    return ptr;
+}
+
+}
+
+template <class INT>
+INT bitwiseOp(char op, INT lhs, INT rhs)
+    // Return the result of the bitwise operation identified by the specified
+    // 'op' character ('|', '&', or '^') applied to the specified 'lhs' and
+    // 'rhs'.
+{
+    switch (op) {
+      case '|': return lhs | rhs;                                     // RETURN
+      case '&': return lhs & rhs;                                     // RETURN
+      default:  return lhs ^ rhs;                                     // RETURN
+    }
 }
 
 //=============================================================================
@@ -1620,6 +1702,324 @@ int main(int argc, char *argv[]) {
 #endif
 
     switch (test) { case 0:
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING BITWISE MANIPULATORS
+        //   Test that the 32/64 bit integer bitwise functions work as
+        //   expected.
+        //
+        // Concerns:
+        //: 1 Each "fetch" manipulator sets the value to the bitwise OR, AND,
+        //:   or exclusive OR of the previous value and the operand, and
+        //:   returns the previous value.
+        //:
+        //: 2 Each manipulator without the "fetch" prefix sets the value as
+        //:   its "fetch" counterpart does.
+        //:
+        //: 3 'testAndSetBit*' and 'testAndClearBit*' change only the
+        //:   specified bit, for every valid bit index, and return the
+        //:   previous state of that bit.
+        //:
+        //: 4 The variants providing each memory ordering guarantee behave
+        //:   identically in a single thread.
+        //:
+        //: 5 No update is lost when several threads concurrently modify
+        //:   distinct bits of the same object.
+        //
+        // Plan:
+        //: 1 For each atomic type ('Int' and 'Int64'), using a table of
+        //:   independent base values and operands, initialize an object to
+        //:   the base value, apply each bitwise manipulator with the operand,
+        //:   and verify the returned value (if any) and the resulting value
+        //:   of the object.  (C-1,2,4)
+        //:
+        //: 2 For each atomic type and each bit index, starting from an
+        //:   object having all other bits set (and, separately, cleared), set
+        //:   and clear the bit twice with each variant of 'testAndSetBit*' and
+        //:   'testAndClearBit*', and verify the returned values and the
+        //:   resulting value of the object.  (C-3..4)
+        //:
+        //: 3 Create a series of threads, each of which repeatedly sets and
+        //:   clears a distinct bit of a common 'Int' and a common 'Int64'
+        //:   object with each bitwise manipulator, and verifies the state of
+        //:   its bit after each operation.  Verify that both objects are 0
+        //:   when the threads complete.  (C-5)
+        //
+        // Testing:
+        //   fetchOrInt(Obj::Int *aInt, int value);
+        //   fetchAndInt(Obj::Int *aInt, int value);
+        //   fetchXorInt(Obj::Int *aInt, int value);
+        //   orInt(Obj::Int *aInt, int value);
+        //   andInt(Obj::Int *aInt, int value);
+        //   xorInt(Obj::Int *aInt, int value);
+        //   testAndSetBitInt(Obj::Int *aInt, int index);
+        //   testAndClearBitInt(Obj::Int *aInt, int index);
+        //   fetchOrInt64(Obj::Int64 *, bsls::Types::Int64);
+        //   fetchAndInt64(Obj::Int64 *, bsls::Types::Int64);
+        //   fetchXorInt64(Obj::Int64 *, bsls::Types::Int64);
+        //   orInt64(Obj::Int64 *, bsls::Types::Int64);
+        //   andInt64(Obj::Int64 *, bsls::Types::Int64);
+        //   xorInt64(Obj::Int64 *, bsls::Types::Int64);
+        //   testAndSetBitInt64(Obj::Int64 *aInt, int index);
+        //   testAndClearBitInt64(Obj::Int64 *aInt, int index);
+        //   (and the 'Relaxed' and 'AcqRel' variants of each of the above)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Bitwise Manipulators"
+                          << "\n============================" << endl;
+
+        typedef int  (*IntFetchFunc)(Types::Int *, int);
+        typedef void (*IntFunc)(Types::Int *, int);
+        typedef bool (*IntBitFunc)(Types::Int *, int);
+
+        typedef bsls::Types::Int64 (*Int64FetchFunc)(Types::Int64 *,
+                                                     bsls::Types::Int64);
+        typedef void (*Int64Func)(Types::Int64 *, bsls::Types::Int64);
+        typedef bool (*Int64BitFunc)(Types::Int64 *, int);
+
+        if (verbose) cout << "\nTesting 'Int' Bitwise Manipulators" << endl;
+        {
+            static const struct {
+                int  d_lineNum;     // Source line number
+                int  d_base;        // Initial value
+                int  d_operand;     // Operand
+            } VALUES[] = {
+                //line d_base               d_operand
+                //---- -------------------  -------------------
+                { L_,  0                  , 0                   },
+                { L_,  0                  , -1                  },
+                { L_,  -1                 , 0                   },
+                { L_,  -1                 , -1                  },
+                { L_,  0x0f0f0f0f         , 0x00ff00ff          },
+                { L_,  INT_SWAPTEST_VALUE1, INT_SWAPTEST_VALUE2 },
+                { L_,  (int) 0x80000000   , 1                   },
+                { L_,  1                  , (int) 0x80000001    }
+            };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            static const struct {
+                char         d_op;          // operation
+                IntFetchFunc d_fetchFunc;   // "fetch" manipulator
+                IntFunc      d_func;        // manipulator
+            } FUNCS[] = {
+                { '|', &Obj::fetchOrInt,         &Obj::orInt          },
+                { '|', &Obj::fetchOrIntRelaxed,  &Obj::orIntRelaxed   },
+                { '|', &Obj::fetchOrIntAcqRel,   &Obj::orIntAcqRel    },
+                { '&', &Obj::fetchAndInt,        &Obj::andInt         },
+                { '&', &Obj::fetchAndIntRelaxed, &Obj::andIntRelaxed  },
+                { '&', &Obj::fetchAndIntAcqRel,  &Obj::andIntAcqRel   },
+                { '^', &Obj::fetchXorInt,        &Obj::xorInt         },
+                { '^', &Obj::fetchXorIntRelaxed, &Obj::xorIntRelaxed  },
+                { '^', &Obj::fetchXorIntAcqRel,  &Obj::xorIntAcqRel   }
+            };
+            const int NUM_FUNCS = sizeof FUNCS / sizeof *FUNCS;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const int LINE = VALUES[i].d_lineNum;
+                const int BASE = VALUES[i].d_base;
+                const int OPND = VALUES[i].d_operand;
+
+                for (int j = 0; j < NUM_FUNCS; ++j) {
+                    const char OP  = FUNCS[j].d_op;
+                    const int  EXP = bitwiseOp(OP, BASE, OPND);
+
+                    Types::Int x;  const Types::Int& X = x;
+                    Obj::initInt(&x, BASE);
+
+                    const int result = FUNCS[j].d_fetchFunc(&x, OPND);
+                    if (veryVerbose) {
+                        T_(); P_(OP); P_(BASE); P_(OPND); P(EXP);
+                    }
+                    LOOP2_ASSERT(LINE, j, BASE == result);
+                    LOOP2_ASSERT(LINE, j, EXP  == Obj::getInt(&X));
+
+                    Obj::setInt(&x, BASE);
+                    FUNCS[j].d_func(&x, OPND);
+                    LOOP2_ASSERT(LINE, j, EXP  == Obj::getInt(&X));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'Int' Bit Manipulators" << endl;
+        {
+            static const struct {
+                IntBitFunc d_setFunc;    // 'testAndSetBit*' variant
+                IntBitFunc d_clearFunc;  // 'testAndClearBit*' variant
+            } FUNCS[] = {
+                { &Obj::testAndSetBitInt,
+                                          &Obj::testAndClearBitInt           },
+                { &Obj::testAndSetBitIntRelaxed,
+                                          &Obj::testAndClearBitIntRelaxed    },
+                { &Obj::testAndSetBitIntAcqRel,
+                                          &Obj::testAndClearBitIntAcqRel     }
+            };
+            const int NUM_FUNCS = sizeof FUNCS / sizeof *FUNCS;
+
+            for (int j = 0; j < NUM_FUNCS; ++j) {
+                for (int index = 0; index < 32; ++index) {
+                    const int MASK = (int) (1u << index);
+
+                    for (int others = 0; others < 2; ++others) {
+                        const int BASE = others ? ~MASK : 0;
+
+                        Types::Int x;  const Types::Int& X = x;
+                        Obj::initInt(&x, BASE);
+
+                        LOOP2_ASSERT(j, index,
+                                     !FUNCS[j].d_setFunc(&x, index));
+                        LOOP2_ASSERT(j, index,
+                                     (BASE | MASK) == Obj::getInt(&X));
+                        LOOP2_ASSERT(j, index,
+                                     FUNCS[j].d_setFunc(&x, index));
+                        LOOP2_ASSERT(j, index,
+                                     (BASE | MASK) == Obj::getInt(&X));
+                        LOOP2_ASSERT(j, index,
+                                     FUNCS[j].d_clearFunc(&x, index));
+                        LOOP2_ASSERT(j, index, BASE == Obj::getInt(&X));
+                        LOOP2_ASSERT(j, index,
+                                     !FUNCS[j].d_clearFunc(&x, index));
+                        LOOP2_ASSERT(j, index, BASE == Obj::getInt(&X));
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'Int64' Bitwise Manipulators" << endl;
+        {
+            static const struct {
+                int                d_lineNum;  // Source line number
+                bsls::Types::Int64 d_base;     // Initial value
+                bsls::Types::Int64 d_operand;  // Operand
+            } VALUES[] = {
+                //line d_base                 d_operand
+                //---- ---------------------  ---------------------
+                { L_,  0                    , 0                     },
+                { L_,  0                    , -1                    },
+                { L_,  -1                   , 0                     },
+                { L_,  -1                   , -1                    },
+                { L_,  0xFFFFFFFFLL         , 0x100000000LL         },
+                { L_,  0x0f0f0f0f0f0f0f0fLL , 0x00ff00ff00ff00ffLL  },
+                { L_,  INT64_SWAPTEST_VALUE1, INT64_SWAPTEST_VALUE2 },
+                { L_,  OFFSET_64            , -0x7FFFFFFFFFFFFFFFLL }
+            };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            static const struct {
+                char           d_op;          // operation
+                Int64FetchFunc d_fetchFunc;   // "fetch" manipulator
+                Int64Func      d_func;        // manipulator
+            } FUNCS[] = {
+                { '|', &Obj::fetchOrInt64,         &Obj::orInt64          },
+                { '|', &Obj::fetchOrInt64Relaxed,  &Obj::orInt64Relaxed   },
+                { '|', &Obj::fetchOrInt64AcqRel,   &Obj::orInt64AcqRel    },
+                { '&', &Obj::fetchAndInt64,        &Obj::andInt64         },
+                { '&', &Obj::fetchAndInt64Relaxed, &Obj::andInt64Relaxed  },
+                { '&', &Obj::fetchAndInt64AcqRel,  &Obj::andInt64AcqRel   },
+                { '^', &Obj::fetchXorInt64,        &Obj::xorInt64         },
+                { '^', &Obj::fetchXorInt64Relaxed, &Obj::xorInt64Relaxed  },
+                { '^', &Obj::fetchXorInt64AcqRel,  &Obj::xorInt64AcqRel   }
+            };
+            const int NUM_FUNCS = sizeof FUNCS / sizeof *FUNCS;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const int                LINE = VALUES[i].d_lineNum;
+                const bsls::Types::Int64 BASE = VALUES[i].d_base;
+                const bsls::Types::Int64 OPND = VALUES[i].d_operand;
+
+                for (int j = 0; j < NUM_FUNCS; ++j) {
+                    const char               OP  = FUNCS[j].d_op;
+                    const bsls::Types::Int64 EXP = bitwiseOp(OP, BASE, OPND);
+
+                    Types::Int64 x;  const Types::Int64& X = x;
+                    Obj::initInt64(&x, BASE);
+
+                    const bsls::Types::Int64 result =
+                                              FUNCS[j].d_fetchFunc(&x, OPND);
+                    if (veryVerbose) {
+                        T_(); P_(OP); P_(BASE); P_(OPND); P(EXP);
+                    }
+                    LOOP2_ASSERT(LINE, j, BASE == result);
+                    LOOP2_ASSERT(LINE, j, EXP  == Obj::getInt64(&X));
+
+                    Obj::setInt64(&x, BASE);
+                    FUNCS[j].d_func(&x, OPND);
+                    LOOP2_ASSERT(LINE, j, EXP  == Obj::getInt64(&X));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'Int64' Bit Manipulators" << endl;
+        {
+            static const struct {
+                Int64BitFunc d_setFunc;    // 'testAndSetBit*' variant
+                Int64BitFunc d_clearFunc;  // 'testAndClearBit*' variant
+            } FUNCS[] = {
+                { &Obj::testAndSetBitInt64,
+                                          &Obj::testAndClearBitInt64         },
+                { &Obj::testAndSetBitInt64Relaxed,
+                                          &Obj::testAndClearBitInt64Relaxed  },
+                { &Obj::testAndSetBitInt64AcqRel,
+                                          &Obj::testAndClearBitInt64AcqRel   }
+            };
+            const int NUM_FUNCS = sizeof FUNCS / sizeof *FUNCS;
+
+            for (int j = 0; j < NUM_FUNCS; ++j) {
+                for (int index = 0; index < 64; ++index) {
+                    const bsls::Types::Int64 MASK = (bsls::Types::Int64)
+                                            ((bsls::Types::Uint64) 1 << index);
+
+                    for (int others = 0; others < 2; ++others) {
+                        const bsls::Types::Int64 BASE = others ? ~MASK : 0;
+
+                        Types::Int64 x;  const Types::Int64& X = x;
+                        Obj::initInt64(&x, BASE);
+
+                        LOOP2_ASSERT(j, index,
+                                     !FUNCS[j].d_setFunc(&x, index));
+                        LOOP2_ASSERT(j, index,
+                                     (BASE | MASK) == Obj::getInt64(&X));
+                        LOOP2_ASSERT(j, index,
+                                     FUNCS[j].d_setFunc(&x, index));
+                        LOOP2_ASSERT(j, index,
+                                     (BASE | MASK) == Obj::getInt64(&X));
+                        LOOP2_ASSERT(j, index,
+                                     FUNCS[j].d_clearFunc(&x, index));
+                        LOOP2_ASSERT(j, index, BASE == Obj::getInt64(&X));
+                        LOOP2_ASSERT(j, index,
+                                     !FUNCS[j].d_clearFunc(&x, index));
+                        LOOP2_ASSERT(j, index, BASE == Obj::getInt64(&X));
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting Bitwise Thread Safeness" << endl;
+        {
+            const int NTHREADS    = 4;
+            const int NITERATIONS = 100000;
+
+            Types::Int   mInt;
+            Types::Int64 mInt64;
+            Obj::initInt(&mInt, 0);
+            Obj::initInt64(&mInt64, 0);
+
+            Case13      args[NTHREADS];
+            my_thread_t threadHandles[NTHREADS];
+
+            for (int i = 0; i < NTHREADS; ++i) {
+                args[i].d_int_p      = &mInt;
+                args[i].d_int64_p    = &mInt64;
+                args[i].d_bit        = i;
+                args[i].d_iterations = NITERATIONS;
+                myCreateThread(&threadHandles[i], case13Thread, &args[i]);
+            }
+            for (int i = 0; i < NTHREADS; ++i) {
+                myJoinThread(threadHandles[i]);
+            }
+            ASSERT(0 == Obj::getInt(&mInt));
+            ASSERT(0 == Obj::getInt64(&mInt64));
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING GET/SET ACQUIRE/RELEASE MANIPULATORS:
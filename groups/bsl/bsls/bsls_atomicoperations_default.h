@@ -375,6 +375,66 @@ struct AtomicOperations_DefaultInt
     static void decrementInt(typename AtomicTypes::Int *atomicInt);
 
     static void decrementIntAcqRel(typename AtomicTypes::Int *atomicInt);
+
+    static int fetchOrInt(typename AtomicTypes::Int *atomicInt, int value);
+
+    static int fetchOrIntRelaxed(typename AtomicTypes::Int *atomicInt,
+                                 int value);
+
+    static int fetchOrIntAcqRel(typename AtomicTypes::Int *atomicInt,
+                                int value);
+
+    static void orInt(typename AtomicTypes::Int *atomicInt, int value);
+
+    static void orIntRelaxed(typename AtomicTypes::Int *atomicInt, int value);
+
+    static void orIntAcqRel(typename AtomicTypes::Int *atomicInt, int value);
+
+    static int fetchAndInt(typename AtomicTypes::Int *atomicInt, int value);
+
+    static int fetchAndIntRelaxed(typename AtomicTypes::Int *atomicInt,
+                                  int value);
+
+    static int fetchAndIntAcqRel(typename AtomicTypes::Int *atomicInt,
+                                 int value);
+
+    static void andInt(typename AtomicTypes::Int *atomicInt, int value);
+
+    static void andIntRelaxed(typename AtomicTypes::Int *atomicInt, int value);
+
+    static void andIntAcqRel(typename AtomicTypes::Int *atomicInt, int value);
+
+    static int fetchXorInt(typename AtomicTypes::Int *atomicInt, int value);
+
+    static int fetchXorIntRelaxed(typename AtomicTypes::Int *atomicInt,
+                                  int value);
+
+    static int fetchXorIntAcqRel(typename AtomicTypes::Int *atomicInt,
+                                 int value);
+
+    static void xorInt(typename AtomicTypes::Int *atomicInt, int value);
+
+    static void xorIntRelaxed(typename AtomicTypes::Int *atomicInt, int value);
+
+    static void xorIntAcqRel(typename AtomicTypes::Int *atomicInt, int value);
+
+    static bool testAndSetBitInt(typename AtomicTypes::Int *atomicInt,
+                                 int index);
+
+    static bool testAndSetBitIntRelaxed(typename AtomicTypes::Int *atomicInt,
+                                        int index);
+
+    static bool testAndSetBitIntAcqRel(typename AtomicTypes::Int *atomicInt,
+                                       int index);
+
+    static bool testAndClearBitInt(typename AtomicTypes::Int *atomicInt,
+                                   int index);
+
+    static bool testAndClearBitIntRelaxed(typename AtomicTypes::Int *atomicInt,
+                                          int index);
+
+    static bool testAndClearBitIntAcqRel(typename AtomicTypes::Int *atomicInt,
+                                         int index);
 };
 
                     // ====================================
@@ -478,6 +538,88 @@ struct AtomicOperations_DefaultInt64
 
     static Types::Int64 decrementInt64NvAcqRel(
                                        typename AtomicTypes::Int64 *atomicInt);
+
+    static Types::Int64 fetchOrInt64(typename AtomicTypes::Int64 *atomicInt,
+                                     Types::Int64 value);
+
+    static Types::Int64 fetchOrInt64Relaxed(
+                                       typename AtomicTypes::Int64 *atomicInt,
+                                       Types::Int64 value);
+
+    static Types::Int64 fetchOrInt64AcqRel(
+                                       typename AtomicTypes::Int64 *atomicInt,
+                                       Types::Int64 value);
+
+    static void orInt64(typename AtomicTypes::Int64 *atomicInt,
+                        Types::Int64 value);
+
+    static void orInt64Relaxed(typename AtomicTypes::Int64 *atomicInt,
+                               Types::Int64 value);
+
+    static void orInt64AcqRel(typename AtomicTypes::Int64 *atomicInt,
+                              Types::Int64 value);
+
+    static Types::Int64 fetchAndInt64(typename AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64 value);
+
+    static Types::Int64 fetchAndInt64Relaxed(
+                                       typename AtomicTypes::Int64 *atomicInt,
+                                       Types::Int64 value);
+
+    static Types::Int64 fetchAndInt64AcqRel(
+                                       typename AtomicTypes::Int64 *atomicInt,
+                                       Types::Int64 value);
+
+    static void andInt64(typename AtomicTypes::Int64 *atomicInt,
+                         Types::Int64 value);
+
+    static void andInt64Relaxed(typename AtomicTypes::Int64 *atomicInt,
+                                Types::Int64 value);
+
+    static void andInt64AcqRel(typename AtomicTypes::Int64 *atomicInt,
+                               Types::Int64 value);
+
+    static Types::Int64 fetchXorInt64(typename AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64 value);
+
+    static Types::Int64 fetchXorInt64Relaxed(
+                                       typename AtomicTypes::Int64 *atomicInt,
+                                       Types::Int64 value);
+
+    static Types::Int64 fetchXorInt64AcqRel(
+                                       typename AtomicTypes::Int64 *atomicInt,
+                                       Types::Int64 value);
+
+    static void xorInt64(typename AtomicTypes::Int64 *atomicInt,
+                         Types::Int64 value);
+
+    static void xorInt64Relaxed(typename AtomicTypes::Int64 *atomicInt,
+                                Types::Int64 value);
+
+    static void xorInt64AcqRel(typename AtomicTypes::Int64 *atomicInt,
+                               Types::Int64 value);
+
+    static bool testAndSetBitInt64(typename AtomicTypes::Int64 *atomicInt,
+                                   int index);
+
+    static bool testAndSetBitInt64Relaxed(
+                                       typename AtomicTypes::Int64 *atomicInt,
+                                       int index);
+
+    static bool testAndSetBitInt64AcqRel(
+                                       typename AtomicTypes::Int64 *atomicInt,
+                                       int index);
+
+    static bool testAndClearBitInt64(typename AtomicTypes::Int64 *atomicInt,
+                                     int index);
+
+    static bool testAndClearBitInt64Relaxed(
+                                       typename AtomicTypes::Int64 *atomicInt,
+                                       int index);
+
+    static bool testAndClearBitInt64AcqRel(
+                                       typename AtomicTypes::Int64 *atomicInt,
+                                       int index);
 };
 
                   // ========================================
@@ -842,6 +984,254 @@ void AtomicOperations_DefaultInt<IMP>::
     IMP::addIntAcqRel(atomicInt, -1);
 }
 
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchOrInt(typename AtomicTypes::Int *atomicInt, int value)
+{
+    int expected = IMP::getIntRelaxed(atomicInt);
+    for (;;) {
+        const int previous = IMP::testAndSwapInt(atomicInt,
+                                                 expected,
+                                                 expected | value);
+        if (previous == expected) {
+            return previous;                                          // RETURN
+        }
+        expected = previous;
+    }
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchOrIntRelaxed(typename AtomicTypes::Int *atomicInt, int value)
+{
+    return IMP::fetchOrIntAcqRel(atomicInt, value);
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchOrIntAcqRel(typename AtomicTypes::Int *atomicInt, int value)
+{
+    int expected = IMP::getIntRelaxed(atomicInt);
+    for (;;) {
+        const int previous = IMP::testAndSwapIntAcqRel(atomicInt,
+                                                       expected,
+                                                       expected | value);
+        if (previous == expected) {
+            return previous;                                          // RETURN
+        }
+        expected = previous;
+    }
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt<IMP>::
+    orInt(typename AtomicTypes::Int *atomicInt, int value)
+{
+    IMP::fetchOrInt(atomicInt, value);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt<IMP>::
+    orIntRelaxed(typename AtomicTypes::Int *atomicInt, int value)
+{
+    IMP::orIntAcqRel(atomicInt, value);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt<IMP>::
+    orIntAcqRel(typename AtomicTypes::Int *atomicInt, int value)
+{
+    IMP::orInt(atomicInt, value);
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchAndInt(typename AtomicTypes::Int *atomicInt, int value)
+{
+    int expected = IMP::getIntRelaxed(atomicInt);
+    for (;;) {
+        const int previous = IMP::testAndSwapInt(atomicInt,
+                                                 expected,
+                                                 expected & value);
+        if (previous == expected) {
+            return previous;                                          // RETURN
+        }
+        expected = previous;
+    }
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchAndIntRelaxed(typename AtomicTypes::Int *atomicInt, int value)
+{
+    return IMP::fetchAndIntAcqRel(atomicInt, value);
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchAndIntAcqRel(typename AtomicTypes::Int *atomicInt, int value)
+{
+    int expected = IMP::getIntRelaxed(atomicInt);
+    for (;;) {
+        const int previous = IMP::testAndSwapIntAcqRel(atomicInt,
+                                                       expected,
+                                                       expected & value);
+        if (previous == expected) {
+            return previous;                                          // RETURN
+        }
+        expected = previous;
+    }
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt<IMP>::
+    andInt(typename AtomicTypes::Int *atomicInt, int value)
+{
+    IMP::fetchAndInt(atomicInt, value);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt<IMP>::
+    andIntRelaxed(typename AtomicTypes::Int *atomicInt, int value)
+{
+    IMP::andIntAcqRel(atomicInt, value);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt<IMP>::
+    andIntAcqRel(typename AtomicTypes::Int *atomicInt, int value)
+{
+    IMP::andInt(atomicInt, value);
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchXorInt(typename AtomicTypes::Int *atomicInt, int value)
+{
+    int expected = IMP::getIntRelaxed(atomicInt);
+    for (;;) {
+        const int previous = IMP::testAndSwapInt(atomicInt,
+                                                 expected,
+                                                 expected ^ value);
+        if (previous == expected) {
+            return previous;                                          // RETURN
+        }
+        expected = previous;
+    }
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchXorIntRelaxed(typename AtomicTypes::Int *atomicInt, int value)
+{
+    return IMP::fetchXorIntAcqRel(atomicInt, value);
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchXorIntAcqRel(typename AtomicTypes::Int *atomicInt, int value)
+{
+    int expected = IMP::getIntRelaxed(atomicInt);
+    for (;;) {
+        const int previous = IMP::testAndSwapIntAcqRel(atomicInt,
+                                                       expected,
+                                                       expected ^ value);
+        if (previous == expected) {
+            return previous;                                          // RETURN
+        }
+        expected = previous;
+    }
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt<IMP>::
+    xorInt(typename AtomicTypes::Int *atomicInt, int value)
+{
+    IMP::fetchXorInt(atomicInt, value);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt<IMP>::
+    xorIntRelaxed(typename AtomicTypes::Int *atomicInt, int value)
+{
+    IMP::xorIntAcqRel(atomicInt, value);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt<IMP>::
+    xorIntAcqRel(typename AtomicTypes::Int *atomicInt, int value)
+{
+    IMP::xorInt(atomicInt, value);
+}
+
+template <class IMP>
+inline
+bool AtomicOperations_DefaultInt<IMP>::
+    testAndSetBitInt(typename AtomicTypes::Int *atomicInt, int index)
+{
+    const int mask = static_cast<int>(1u << index);
+    return 0 != (IMP::fetchOrInt(atomicInt, mask) & mask);
+}
+
+template <class IMP>
+inline
+bool AtomicOperations_DefaultInt<IMP>::
+    testAndSetBitIntRelaxed(typename AtomicTypes::Int *atomicInt, int index)
+{
+    return IMP::testAndSetBitIntAcqRel(atomicInt, index);
+}
+
+template <class IMP>
+inline
+bool AtomicOperations_DefaultInt<IMP>::
+    testAndSetBitIntAcqRel(typename AtomicTypes::Int *atomicInt, int index)
+{
+    return IMP::testAndSetBitInt(atomicInt, index);
+}
+
+template <class IMP>
+inline
+bool AtomicOperations_DefaultInt<IMP>::
+    testAndClearBitInt(typename AtomicTypes::Int *atomicInt, int index)
+{
+    const int mask = static_cast<int>(1u << index);
+    return 0 != (IMP::fetchAndInt(atomicInt, ~mask) & mask);
+}
+
+template <class IMP>
+inline
+bool AtomicOperations_DefaultInt<IMP>::
+    testAndClearBitIntRelaxed(typename AtomicTypes::Int *atomicInt, int index)
+{
+    return IMP::testAndClearBitIntAcqRel(atomicInt, index);
+}
+
+template <class IMP>
+inline
+bool AtomicOperations_DefaultInt<IMP>::
+    testAndClearBitIntAcqRel(typename AtomicTypes::Int *atomicInt, int index)
+{
+    return IMP::testAndClearBitInt(atomicInt, index);
+}
+
                     // ------------------------------------
                     // struct AtomicOperations_DefaultInt64
                     // ------------------------------------
@@ -1018,6 +1408,268 @@ Types::Int64 AtomicOperations_DefaultInt64<IMP>::
     return IMP::addInt64NvAcqRel(atomicInt, -1);
 }
 
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchOrInt64(typename AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    Types::Int64 expected = IMP::getInt64Relaxed(atomicInt);
+    for (;;) {
+        const Types::Int64 previous = IMP::testAndSwapInt64(atomicInt,
+                                                            expected,
+                                                            expected | value);
+        if (previous == expected) {
+            return previous;                                          // RETURN
+        }
+        expected = previous;
+    }
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchOrInt64Relaxed(typename AtomicTypes::Int64 *atomicInt,
+                        Types::Int64 value)
+{
+    return IMP::fetchOrInt64AcqRel(atomicInt, value);
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchOrInt64AcqRel(typename AtomicTypes::Int64 *atomicInt,
+                       Types::Int64 value)
+{
+    Types::Int64 expected = IMP::getInt64Relaxed(atomicInt);
+    for (;;) {
+        const Types::Int64 previous = IMP::testAndSwapInt64AcqRel(
+                                                             atomicInt,
+                                                             expected,
+                                                             expected | value);
+        if (previous == expected) {
+            return previous;                                          // RETURN
+        }
+        expected = previous;
+    }
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt64<IMP>::
+    orInt64(typename AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    IMP::fetchOrInt64(atomicInt, value);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt64<IMP>::
+    orInt64Relaxed(typename AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    IMP::orInt64AcqRel(atomicInt, value);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt64<IMP>::
+    orInt64AcqRel(typename AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    IMP::orInt64(atomicInt, value);
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchAndInt64(typename AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    Types::Int64 expected = IMP::getInt64Relaxed(atomicInt);
+    for (;;) {
+        const Types::Int64 previous = IMP::testAndSwapInt64(atomicInt,
+                                                            expected,
+                                                            expected & value);
+        if (previous == expected) {
+            return previous;                                          // RETURN
+        }
+        expected = previous;
+    }
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchAndInt64Relaxed(typename AtomicTypes::Int64 *atomicInt,
+                         Types::Int64 value)
+{
+    return IMP::fetchAndInt64AcqRel(atomicInt, value);
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchAndInt64AcqRel(typename AtomicTypes::Int64 *atomicInt,
+                        Types::Int64 value)
+{
+    Types::Int64 expected = IMP::getInt64Relaxed(atomicInt);
+    for (;;) {
+        const Types::Int64 previous = IMP::testAndSwapInt64AcqRel(
+                                                             atomicInt,
+                                                             expected,
+                                                             expected & value);
+        if (previous == expected) {
+            return previous;                                          // RETURN
+        }
+        expected = previous;
+    }
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt64<IMP>::
+    andInt64(typename AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    IMP::fetchAndInt64(atomicInt, value);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt64<IMP>::
+    andInt64Relaxed(typename AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    IMP::andInt64AcqRel(atomicInt, value);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt64<IMP>::
+    andInt64AcqRel(typename AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    IMP::andInt64(atomicInt, value);
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchXorInt64(typename AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    Types::Int64 expected = IMP::getInt64Relaxed(atomicInt);
+    for (;;) {
+        const Types::Int64 previous = IMP::testAndSwapInt64(atomicInt,
+                                                            expected,
+                                                            expected ^ value);
+        if (previous == expected) {
+            return previous;                                          // RETURN
+        }
+        expected = previous;
+    }
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchXorInt64Relaxed(typename AtomicTypes::Int64 *atomicInt,
+                         Types::Int64 value)
+{
+    return IMP::fetchXorInt64AcqRel(atomicInt, value);
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchXorInt64AcqRel(typename AtomicTypes::Int64 *atomicInt,
+                        Types::Int64 value)
+{
+    Types::Int64 expected = IMP::getInt64Relaxed(atomicInt);
+    for (;;) {
+        const Types::Int64 previous = IMP::testAndSwapInt64AcqRel(
+                                                             atomicInt,
+                                                             expected,
+                                                             expected ^ value);
+        if (previous == expected) {
+            return previous;                                          // RETURN
+        }
+        expected = previous;
+    }
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt64<IMP>::
+    xorInt64(typename AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    IMP::fetchXorInt64(atomicInt, value);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt64<IMP>::
+    xorInt64Relaxed(typename AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    IMP::xorInt64AcqRel(atomicInt, value);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt64<IMP>::
+    xorInt64AcqRel(typename AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    IMP::xorInt64(atomicInt, value);
+}
+
+template <class IMP>
+inline
+bool AtomicOperations_DefaultInt64<IMP>::
+    testAndSetBitInt64(typename AtomicTypes::Int64 *atomicInt, int index)
+{
+    const Types::Int64 mask =
+             static_cast<Types::Int64>(static_cast<Types::Uint64>(1) << index);
+    return 0 != (IMP::fetchOrInt64(atomicInt, mask) & mask);
+}
+
+template <class IMP>
+inline
+bool AtomicOperations_DefaultInt64<IMP>::
+    testAndSetBitInt64Relaxed(typename AtomicTypes::Int64 *atomicInt,
+                              int index)
+{
+    return IMP::testAndSetBitInt64AcqRel(atomicInt, index);
+}
+
+template <class IMP>
+inline
+bool AtomicOperations_DefaultInt64<IMP>::
+    testAndSetBitInt64AcqRel(typename AtomicTypes::Int64 *atomicInt, int index)
+{
+    return IMP::testAndSetBitInt64(atomicInt, index);
+}
+
+template <class IMP>
+inline
+bool AtomicOperations_DefaultInt64<IMP>::
+    testAndClearBitInt64(typename AtomicTypes::Int64 *atomicInt, int index)
+{
+    const Types::Int64 mask =
+             static_cast<Types::Int64>(static_cast<Types::Uint64>(1) << index);
+    return 0 != (IMP::fetchAndInt64(atomicInt, ~mask) & mask);
+}
+
+template <class IMP>
+inline
+bool AtomicOperations_DefaultInt64<IMP>::
+    testAndClearBitInt64Relaxed(typename AtomicTypes::Int64 *atomicInt,
+                                int index)
+{
+    return IMP::testAndClearBitInt64AcqRel(atomicInt, index);
+}
+
+template <class IMP>
+inline
+bool AtomicOperations_DefaultInt64<IMP>::
+    testAndClearBitInt64AcqRel(typename AtomicTypes::Int64 *atomicInt,
+                               int index)
+{
+    return IMP::testAndClearBitInt64(atomicInt, index);
+}
+
                   // ----------------------------------------
                   // struct AtomicOperations_DefaultPointer32
                   // ----------------------------------------
@@ -99,6 +99,16 @@ struct AtomicOperations_X64_ALL_GCC
 
     static int addIntNv(AtomicTypes::Int *atomicInt, int value);
 
+    static void orInt(AtomicTypes::Int *atomicInt, int value);
+
+    static void andInt(AtomicTypes::Int *atomicInt, int value);
+
+    static void xorInt(AtomicTypes::Int *atomicInt, int value);
+
+    static bool testAndSetBitInt(AtomicTypes::Int *atomicInt, int index);
+
+    static bool testAndClearBitInt(AtomicTypes::Int *atomicInt, int index);
+
         // *** atomic functions for Int64 ***
 
     static Types::Int64 getInt64(const AtomicTypes::Int64 *atomicInt);
@@ -119,6 +129,16 @@ struct AtomicOperations_X64_ALL_GCC
 
     static Types::Int64 addInt64Nv(AtomicTypes::Int64 *atomicInt,
                                    Types::Int64 value);
+
+    static void orInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 value);
+
+    static void andInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 value);
+
+    static void xorInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 value);
+
+    static bool testAndSetBitInt64(AtomicTypes::Int64 *atomicInt, int index);
+
+    static bool testAndClearBitInt64(AtomicTypes::Int64 *atomicInt, int index);
 };
 
 // ===========================================================================
@@ -220,6 +240,80 @@ int AtomicOperations_X64_ALL_GCC::
     return __sync_add_and_fetch(&atomicInt->d_value, value);
 }
 
+inline
+void AtomicOperations_X64_ALL_GCC::
+    orInt(AtomicTypes::Int *atomicInt, int value)
+{
+    asm volatile (
+        "       lock orl %[val], %[obj]     \n\t"
+
+                : [obj] "=m" (*atomicInt)
+                : [val] "ir" (value), "m" (*atomicInt)
+                : "memory", "cc");
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    andInt(AtomicTypes::Int *atomicInt, int value)
+{
+    asm volatile (
+        "       lock andl %[val], %[obj]    \n\t"
+
+                : [obj] "=m" (*atomicInt)
+                : [val] "ir" (value), "m" (*atomicInt)
+                : "memory", "cc");
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    xorInt(AtomicTypes::Int *atomicInt, int value)
+{
+    asm volatile (
+        "       lock xorl %[val], %[obj]    \n\t"
+
+                : [obj] "=m" (*atomicInt)
+                : [val] "ir" (value), "m" (*atomicInt)
+                : "memory", "cc");
+}
+
+inline
+bool AtomicOperations_X64_ALL_GCC::
+    testAndSetBitInt(AtomicTypes::Int *atomicInt, int index)
+{
+    unsigned char result;
+
+    asm volatile (
+        "       lock btsl %[idx], %[obj]    \n\t"
+        "       setc %[res]                 \n\t"
+
+                : [obj] "=m" (*atomicInt),
+                  [res] "=q" (result)
+                : [idx] "Ir" (index),
+                  "m" (*atomicInt)
+                : "memory", "cc");
+
+    return result;
+}
+
+inline
+bool AtomicOperations_X64_ALL_GCC::
+    testAndClearBitInt(AtomicTypes::Int *atomicInt, int index)
+{
+    unsigned char result;
+
+    asm volatile (
+        "       lock btrl %[idx], %[obj]    \n\t"
+        "       setc %[res]                 \n\t"
+
+                : [obj] "=m" (*atomicInt),
+                  [res] "=q" (result)
+                : [idx] "Ir" (index),
+                  "m" (*atomicInt)
+                : "memory", "cc");
+
+    return result;
+}
+
 inline
 Types::Int64 AtomicOperations_X64_ALL_GCC::
     getInt64(const AtomicTypes::Int64 *atomicInt)
@@ -314,6 +408,80 @@ Types::Int64 AtomicOperations_X64_ALL_GCC::
     return __sync_add_and_fetch(&atomicInt->d_value, value);
 }
 
+inline
+void AtomicOperations_X64_ALL_GCC::
+    orInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    asm volatile (
+        "       lock orq %[val], %[obj]     \n\t"
+
+                : [obj] "=m" (*atomicInt)
+                : [val] "er" (value), "m" (*atomicInt)
+                : "memory", "cc");
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    andInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    asm volatile (
+        "       lock andq %[val], %[obj]    \n\t"
+
+                : [obj] "=m" (*atomicInt)
+                : [val] "er" (value), "m" (*atomicInt)
+                : "memory", "cc");
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    xorInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    asm volatile (
+        "       lock xorq %[val], %[obj]    \n\t"
+
+                : [obj] "=m" (*atomicInt)
+                : [val] "er" (value), "m" (*atomicInt)
+                : "memory", "cc");
+}
+
+inline
+bool AtomicOperations_X64_ALL_GCC::
+    testAndSetBitInt64(AtomicTypes::Int64 *atomicInt, int index)
+{
+    unsigned char result;
+
+    asm volatile (
+        "       lock btsq %[idx], %[obj]    \n\t"
+        "       setc %[res]                 \n\t"
+
+                : [obj] "=m" (*atomicInt),
+                  [res] "=q" (result)
+                : [idx] "Jr" (static_cast<Types::Int64>(index)),
+                  "m" (*atomicInt)
+                : "memory", "cc");
+
+    return result;
+}
+
+inline
+bool AtomicOperations_X64_ALL_GCC::
+    testAndClearBitInt64(AtomicTypes::Int64 *atomicInt, int index)
+{
+    unsigned char result;
+
+    asm volatile (
+        "       lock btrq %[idx], %[obj]    \n\t"
+        "       setc %[res]                 \n\t"
+
+                : [obj] "=m" (*atomicInt),
+                  [res] "=q" (result)
+                : [idx] "Jr" (static_cast<Types::Int64>(index)),
+                  "m" (*atomicInt)
+                : "memory", "cc");
+
+    return result;
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -91,6 +91,16 @@ struct AtomicOperations_X86_ALL_GCC
 
     static int addIntNv(AtomicTypes::Int *atomicInt, int value);
 
+    static void orInt(AtomicTypes::Int *atomicInt, int value);
+
+    static void andInt(AtomicTypes::Int *atomicInt, int value);
+
+    static void xorInt(AtomicTypes::Int *atomicInt, int value);
+
+    static bool testAndSetBitInt(AtomicTypes::Int *atomicInt, int index);
+
+    static bool testAndClearBitInt(AtomicTypes::Int *atomicInt, int index);
+
         // *** atomic functions for Int64 ***
 
     static Types::Int64 getInt64(const AtomicTypes::Int64 *atomicInt);
@@ -227,6 +237,80 @@ int AtomicOperations_X86_ALL_GCC::
     return __sync_add_and_fetch(&atomicInt->d_value, value);
 }
 
+inline
+void AtomicOperations_X86_ALL_GCC::
+    orInt(AtomicTypes::Int *atomicInt, int value)
+{
+    asm volatile (
+        "       lock orl %[val], %[obj]     \n\t"
+
+                : [obj] "=m" (*atomicInt)
+                : [val] "ir" (value), "m" (*atomicInt)
+                : "memory", "cc");
+}
+
+inline
+void AtomicOperations_X86_ALL_GCC::
+    andInt(AtomicTypes::Int *atomicInt, int value)
+{
+    asm volatile (
+        "       lock andl %[val], %[obj]    \n\t"
+
+                : [obj] "=m" (*atomicInt)
+                : [val] "ir" (value), "m" (*atomicInt)
+                : "memory", "cc");
+}
+
+inline
+void AtomicOperations_X86_ALL_GCC::
+    xorInt(AtomicTypes::Int *atomicInt, int value)
+{
+    asm volatile (
+        "       lock xorl %[val], %[obj]    \n\t"
+
+                : [obj] "=m" (*atomicInt)
+                : [val] "ir" (value), "m" (*atomicInt)
+                : "memory", "cc");
+}
+
+inline
+bool AtomicOperations_X86_ALL_GCC::
+    testAndSetBitInt(AtomicTypes::Int *atomicInt, int index)
+{
+    unsigned char result;
+
+    asm volatile (
+        "       lock btsl %[idx], %[obj]    \n\t"
+        "       setc %[res]                 \n\t"
+
+                : [obj] "=m" (*atomicInt),
+                  [res] "=q" (result)
+                : [idx] "Ir" (index),
+                  "m" (*atomicInt)
+                : "memory", "cc");
+
+    return result;
+}
+
+inline
+bool AtomicOperations_X86_ALL_GCC::
+    testAndClearBitInt(AtomicTypes::Int *atomicInt, int index)
+{
+    unsigned char result;
+
+    asm volatile (
+        "       lock btrl %[idx], %[obj]    \n\t"
+        "       setc %[res]                 \n\t"
+
+                : [obj] "=m" (*atomicInt),
+                  [res] "=q" (result)
+                : [idx] "Ir" (index),
+                  "m" (*atomicInt)
+                : "memory", "cc");
+
+    return result;
+}
+
 inline
 Types::Int64 AtomicOperations_X86_ALL_GCC::
     getInt64(const AtomicTypes::Int64 *atomicInt)
@@ -0,0 +1,161 @@
+// bsls_latencyhistogram.cpp                                          -*-C++-*-
+#include <bsls_latencyhistogram.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+namespace BloombergLP {
+
+namespace bsls {
+
+namespace {
+
+const Types::Int64 k_INT64_MAX = static_cast<Types::Int64>(
+                                        ~static_cast<Types::Uint64>(0) >> 1);
+    // largest 'Types::Int64' value
+
+}  // close unnamed namespace
+
+                           // ----------------------
+                           // class LatencyHistogram
+                           // ----------------------
+
+// CLASS METHODS
+Types::Int64 LatencyHistogram::bucketLowestValue(int index)
+{
+    const int k_HALF = 1 << (k_SUB_BUCKET_BITS - 1);
+
+    if (index < (1 << k_SUB_BUCKET_BITS)) {
+        return index;                                                 // RETURN
+    }
+
+    const int offset = index - (1 << k_SUB_BUCKET_BITS);
+    const int shift  = offset / k_HALF + 1;
+
+    return static_cast<Types::Int64>(k_HALF + offset % k_HALF) << shift;
+}
+
+Types::Int64 LatencyHistogram::bucketHighestValue(int index)
+{
+    if (index < (1 << k_SUB_BUCKET_BITS)) {
+        return index;                                                 // RETURN
+    }
+
+    const int shift = (index - (1 << k_SUB_BUCKET_BITS))
+                                          / (1 << (k_SUB_BUCKET_BITS - 1)) + 1;
+
+    return bucketLowestValue(index)
+         + ((static_cast<Types::Int64>(1) << shift) - 1);
+}
+
+// CREATORS
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+// MANIPULATORS
+void LatencyHistogram::add(const LatencyHistogram& other)
+{
+    if (0 == other.d_count) {
+        return;                                                       // RETURN
+    }
+
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_buckets[i] += other.d_buckets[i];
+    }
+
+    d_count += other.d_count;
+    d_sum   += other.d_sum;
+    if (other.d_min < d_min) {
+        d_min = other.d_min;
+    }
+    if (other.d_max > d_max) {
+        d_max = other.d_max;
+    }
+}
+
+void LatencyHistogram::reset()
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_buckets[i] = 0;
+    }
+
+    d_count = 0;
+    d_sum   = 0;
+    d_min   = k_INT64_MAX;
+    d_max   = 0;
+}
+
+// ACCESSORS
+double LatencyHistogram::mean() const
+{
+    return 0 == d_count
+           ? 0.0
+           : static_cast<double>(d_sum) / static_cast<double>(d_count);
+}
+
+Types::Int64 LatencyHistogram::percentile(double percent) const
+{
+    if (0 == d_count) {
+        return 0;                                                     // RETURN
+    }
+
+    if (percent >= 100.0) {
+        return d_max;                                                 // RETURN
+    }
+
+    // Find the smallest rank 'r' (1-based) such that 'r >= percent% * count',
+    // and the bucket holding the value of that rank.
+
+    Types::Int64 rank = 1;
+    if (percent > 0.0) {
+        const double exact = percent * static_cast<double>(d_count) / 100.0;
+        rank = static_cast<Types::Int64>(exact);
+        if (static_cast<double>(rank) < exact) {
+            ++rank;
+        }
+        if (rank < 1) {
+            rank = 1;
+        }
+    }
+
+    Types::Int64 cumulative = 0;
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        cumulative += d_buckets[i];
+        if (cumulative >= rank) {
+            const Types::Int64 value = bucketHighestValue(i);
+            return value < d_min ? d_min
+                 : value > d_max ? d_max
+                 : value;                                             // RETURN
+        }
+    }
+
+    return d_max;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
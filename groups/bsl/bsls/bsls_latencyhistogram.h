@@ -0,0 +1,479 @@
+// bsls_latencyhistogram.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLS_LATENCYHISTOGRAM
+#define INCLUDED_BSLS_LATENCYHISTOGRAM
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size log-linear histogram of latencies.
+//
+//@CLASSES:
+//  bsls::LatencyHistogram: fixed-size log-linear histogram of latencies
+//  bsls::LatencyHistogramGuard: scoped guard timing a block into a histogram
+//
+//@SEE_ALSO: bsls_stopwatch, bsls_timeutil
+//
+//@DESCRIPTION: This component provides a class, 'bsls::LatencyHistogram',
+// that records a distribution of non-negative integral values -- typically
+// latencies in nanoseconds -- and reports its percentiles (e.g., the median,
+// the 99th and the 99.9th percentiles), together with the exact count,
+// minimum, maximum, and mean of the recorded values.  Whereas
+// 'bsls::Stopwatch' accumulates only the total of the intervals it measures, a
+// latency histogram retains enough of their distribution to expose the tail
+// latencies that totals and averages hide.
+//
+// The component also provides a scoped guard, 'bsls::LatencyHistogramGuard',
+// that records in a histogram the wall time elapsed between its construction
+// and its destruction, as measured by the cycle timer of 'bsls::TimeUtil'
+// (see the "Cycle Timer" section of 'bsls_timeutil').
+//
+///Bucketing
+///---------
+// A 'bsls::LatencyHistogram' holds a fixed array of 'k_NUM_BUCKETS' counters,
+// embedded in the object, and never allocates memory.  Recording a value
+// increments exactly one counter, whose index is computed in constant time
+// from the position of the most significant bit of the value:
+//
+//: o Each value less than '2^k_SUB_BUCKET_BITS' (i.e., 128) has a bucket of
+//:   its own, so small values are recorded exactly.
+//:
+//: o Each subsequent range of values '[2^n, 2^(n+1))' is divided into
+//:   '2^(k_SUB_BUCKET_BITS - 1)' (i.e., 64) buckets of equal width.
+//
+// This "log-linear" (or "HDR") layout covers the entire range of
+// non-negative 'bsls::Types::Int64' values with a relative error of at most
+// '2^-(k_SUB_BUCKET_BITS - 1)' (i.e., 1/64, or about 1.6%) for any value
+// reported by 'percentile', in about 30 KB per histogram.  The minimum and
+// maximum values, the count, and the mean are tracked exactly.
+//
+///Thread Safety
+///-------------
+// 'bsls::LatencyHistogram' is *const* *thread-safe*, but not *thread-safe*:
+// concurrent calls to 'record' on the same histogram are not supported.  To
+// collect latencies from several threads without contention, each thread
+// records into its own histogram, and the histograms are then combined, using
+// 'add', into a single histogram from which the percentiles over all threads
+// are obtained.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Measuring the Tail Latency of an Operation
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know not only the average cost of an operation but
+// also how much its slowest invocations cost, e.g., to verify that a
+// container never takes much longer than usual to insert an element.
+//
+// First, we define the operation being measured:
+//..
+//  int operation(int value)
+//      // Return a value computed from the specified 'value'.
+//  {
+//      int result = value;
+//      for (int i = 0; i < 100; ++i) {
+//          result = result * 31 + i;
+//      }
+//      return result;
+//  }
+//..
+// Then, we create a histogram, and use a guard to record the latency of each
+// invocation of the operation:
+//..
+//  bsls::LatencyHistogram histogram;
+//
+//  int sum = 0;
+//  for (int i = 0; i < 10000; ++i) {
+//      bsls::LatencyHistogramGuard guard(&histogram);
+//
+//      sum += operation(i);
+//  }
+//  assert(10000 == histogram.count());
+//..
+// Next, we obtain the median, the 99th and the 99.9th percentiles, and the
+// maximum of the latencies, in nanoseconds:
+//..
+//  const bsls::Types::Int64 p50  = histogram.percentile(50.0);
+//  const bsls::Types::Int64 p99  = histogram.percentile(99.0);
+//  const bsls::Types::Int64 p999 = histogram.percentile(99.9);
+//  const bsls::Types::Int64 max  = histogram.max();
+//
+//  assert(histogram.min() <= p50);
+//  assert(p50  <= p99);
+//  assert(p99  <= p999);
+//  assert(p999 <= max);
+//..
+// Finally, we note that the values to be recorded need not come from a guard:
+// values measured by other means (e.g., by a benchmark that times batches of
+// operations) can be recorded directly:
+//..
+//  bsls::LatencyHistogram batches;
+//  batches.record(1500);
+//  batches.record(2500);
+//  assert(2    == batches.count());
+//  assert(1500 == batches.min());
+//  assert(2500 == batches.max());
+//..
+//
+///Example 2: Combining the Latencies Measured by Several Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several threads perform the operation of Example 1, and that
+// we want the distribution of its latency over all of them.  Since recording
+// is not thread-safe, each thread records into its own histogram (shown here
+// as an array of histograms indexed by thread):
+//..
+//  enum { k_NUM_THREADS = 4 };
+//  static bsls::LatencyHistogram perThread[k_NUM_THREADS];
+//
+//  for (int t = 0; t < k_NUM_THREADS; ++t) {
+//      // ... on thread 't':
+//      for (int i = 0; i < 1000; ++i) {
+//          perThread[t].record(100 * (t + 1));
+//      }
+//  }
+//..
+// Then, once the threads are done, we combine their histograms:
+//..
+//  bsls::LatencyHistogram total;
+//  for (int t = 0; t < k_NUM_THREADS; ++t) {
+//      total.add(perThread[t]);
+//  }
+//  assert(4000 == total.count());
+//  assert(100  == total.min());
+//  assert(400  == total.max());
+//..
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEUTIL
+#include <bsls_timeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                           // ======================
+                           // class LatencyHistogram
+                           // ======================
+
+class LatencyHistogram {
+    // This class implements a fixed-size log-linear histogram of non-negative
+    // 64-bit integral values (typically latencies in nanoseconds), providing
+    // constant-time recording, combination of histograms, and approximate
+    // percentiles having a bounded relative error (see the "Bucketing" section
+    // of the component-level documentation).  The count, minimum, maximum, and
+    // mean of the recorded values are tracked exactly.
+
+  public:
+    // TYPES
+    enum {
+        k_SUB_BUCKET_BITS = 7,  // number of significant bits of a value that
+                                // are retained by its bucket
+
+        k_NUM_BUCKETS     = (1 << k_SUB_BUCKET_BITS)
+                          + (63 - k_SUB_BUCKET_BITS)
+                                               * (1 << (k_SUB_BUCKET_BITS - 1))
+                                // number of buckets needed to cover all
+                                // non-negative 'Types::Int64' values
+    };
+
+  private:
+    // DATA
+    Types::Int64 d_count;                   // number of recorded values
+
+    Types::Int64 d_sum;                     // sum of recorded values
+
+    Types::Int64 d_min;                     // smallest recorded value, or
+                                            // the largest 'Int64' if none
+
+    Types::Int64 d_max;                     // largest recorded value, or 0
+
+    Types::Int64 d_buckets[k_NUM_BUCKETS];  // number of recorded values per
+                                            // bucket
+
+    // PRIVATE CLASS METHODS
+    static int mostSignificantBit(Types::Uint64 value);
+        // Return the zero-based position of the most significant set bit of
+        // the specified 'value'.  The behavior is undefined unless
+        // '0 != value'.
+
+  public:
+    // CLASS METHODS
+    static int bucketIndex(Types::Int64 value);
+        // Return the index of the bucket to which the specified 'value' is
+        // recorded.  The behavior is undefined unless '0 <= value'.
+
+    static Types::Int64 bucketLowestValue(int index);
+        // Return the smallest value recorded to the bucket having the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    static Types::Int64 bucketHighestValue(int index);
+        // Return the largest value recorded to the bucket having the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    // CREATORS
+    LatencyHistogram();
+        // Create an empty histogram.
+
+    //! LatencyHistogram(const LatencyHistogram& original) = default;
+        // Create a histogram having the same recorded values as the specified
+        // 'original' histogram.
+
+    //! ~LatencyHistogram() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! LatencyHistogram& operator=(const LatencyHistogram& rhs) = default;
+        // Make this histogram have the same recorded values as the specified
+        // 'rhs' histogram, and return a reference providing modifiable access
+        // to this object.
+
+    void add(const LatencyHistogram& other);
+        // Record in this histogram all of the values recorded in the
+        // specified 'other' histogram.  Note that the resulting histogram is
+        // identical to one in which the values recorded in both histograms
+        // had been recorded.
+
+    void record(Types::Int64 value);
+        // Record the specified 'value' in this histogram.  A negative 'value'
+        // is recorded as 0.
+
+    void reset();
+        // Remove all of the recorded values from this histogram.
+
+    // ACCESSORS
+    Types::Int64 bucketCount(int index) const;
+        // Return the number of values recorded to the bucket having the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    Types::Int64 count() const;
+        // Return the number of values recorded in this histogram.
+
+    Types::Int64 max() const;
+        // Return the largest value recorded in this histogram, or 0 if no
+        // values have been recorded.
+
+    double mean() const;
+        // Return the arithmetic mean of the values recorded in this
+        // histogram, or 0.0 if no values have been recorded.
+
+    Types::Int64 min() const;
+        // Return the smallest value recorded in this histogram, or 0 if no
+        // values have been recorded.
+
+    Types::Int64 percentile(double percent) const;
+        // Return an approximation of the smallest value that is greater than
+        // or equal to the specified 'percent' percent of the values recorded
+        // in this histogram, or 0 if no values have been recorded.  The
+        // result is the largest value of the bucket holding the exact
+        // percentile, limited to the range '[min(), max()]'; hence it is
+        // never less than the exact percentile, and exceeds it by at most
+        // '2^-(k_SUB_BUCKET_BITS - 1)' of its value.  A 'percent' less than 0
+        // is treated as 0, and one greater than 100 as 100.  Note that
+        // 'percentile(100.0)' returns 'max()'.
+};
+
+                        // ===========================
+                        // class LatencyHistogramGuard
+                        // ===========================
+
+class LatencyHistogramGuard {
+    // This class implements a scoped guard that, unless released, records in
+    // a 'LatencyHistogram', on destruction, the wall time (in nanoseconds)
+    // elapsed since its construction, as measured by the cycle timer of
+    // 'TimeUtil'.
+
+    // DATA
+    LatencyHistogram          *d_histogram_p;  // histogram to which the
+                                               // elapsed time is recorded
+                                               // (held, not owned), or 0 if
+                                               // released
+
+    TimeUtil::OpaqueCycleTime  d_startTime;    // raw cycle time at
+                                               // construction
+
+  private:
+    // NOT IMPLEMENTED
+    LatencyHistogramGuard(const LatencyHistogramGuard&);
+    LatencyHistogramGuard& operator=(const LatencyHistogramGuard&);
+
+  public:
+    // CREATORS
+    explicit LatencyHistogramGuard(LatencyHistogram *histogram);
+        // Create a guard that records in the specified 'histogram', on
+        // destruction, the time elapsed since its construction.  If
+        // 'histogram' is 0, this guard has no effect.
+
+    ~LatencyHistogramGuard();
+        // Destroy this guard, recording the time elapsed since its
+        // construction in the histogram it guards, if any.
+
+    // MANIPULATORS
+    LatencyHistogram *release();
+        // Release from management the histogram guarded by this object, so
+        // that no time is recorded when this guard is destroyed, and return
+        // the address of that histogram, or 0 if there is none.
+};
+
+// ============================================================================
+//                          INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                           // ----------------------
+                           // class LatencyHistogram
+                           // ----------------------
+
+// PRIVATE CLASS METHODS
+inline
+int LatencyHistogram::mostSignificantBit(Types::Uint64 value)
+{
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return 63 - __builtin_clzll(value);
+#else
+    int result = 0;
+    for (int shift = 32; 0 != shift; shift /= 2) {
+        if (value >> shift) {
+            value  >>= shift;
+            result  += shift;
+        }
+    }
+    return result;
+#endif
+}
+
+// CLASS METHODS
+inline
+int LatencyHistogram::bucketIndex(Types::Int64 value)
+{
+    const int k_HALF = 1 << (k_SUB_BUCKET_BITS - 1);
+
+    if (value < (1 << k_SUB_BUCKET_BITS)) {
+        return static_cast<int>(value);                               // RETURN
+    }
+
+    // 'value' lies in '[2^msb, 2^(msb + 1))', where 'msb >= k_SUB_BUCKET_BITS'
+    // and that range has 'k_HALF' buckets, each '2^shift' wide.
+
+    const int shift = mostSignificantBit(static_cast<Types::Uint64>(value))
+                    - (k_SUB_BUCKET_BITS - 1);
+
+    return (1 << k_SUB_BUCKET_BITS)
+         + (shift - 1) * k_HALF
+         + static_cast<int>(value >> shift) - k_HALF;
+}
+
+// MANIPULATORS
+inline
+void LatencyHistogram::record(Types::Int64 value)
+{
+    if (value < 0) {
+        value = 0;
+    }
+
+    ++d_buckets[bucketIndex(value)];
+    ++d_count;
+    d_sum += value;
+    if (value < d_min) {
+        d_min = value;
+    }
+    if (value > d_max) {
+        d_max = value;
+    }
+}
+
+// ACCESSORS
+inline
+Types::Int64 LatencyHistogram::bucketCount(int index) const
+{
+    return d_buckets[index];
+}
+
+inline
+Types::Int64 LatencyHistogram::count() const
+{
+    return d_count;
+}
+
+inline
+Types::Int64 LatencyHistogram::max() const
+{
+    return d_max;
+}
+
+inline
+Types::Int64 LatencyHistogram::min() const
+{
+    return 0 == d_count ? 0 : d_min;
+}
+
+                        // ---------------------------
+                        // class LatencyHistogramGuard
+                        // ---------------------------
+
+// CREATORS
+inline
+LatencyHistogramGuard::LatencyHistogramGuard(LatencyHistogram *histogram)
+: d_histogram_p(histogram)
+{
+    TimeUtil::getCycleTimerRaw(&d_startTime);
+}
+
+inline
+LatencyHistogramGuard::~LatencyHistogramGuard()
+{
+    if (d_histogram_p) {
+        TimeUtil::OpaqueCycleTime now;
+        TimeUtil::getCycleTimerRaw(&now);
+        d_histogram_p->record(TimeUtil::convertRawTime(now)
+                            - TimeUtil::convertRawTime(d_startTime));
+    }
+}
+
+// MANIPULATORS
+inline
+LatencyHistogram *LatencyHistogramGuard::release()
+{
+    LatencyHistogram *histogram = d_histogram_p;
+    d_histogram_p = 0;
+    return histogram;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
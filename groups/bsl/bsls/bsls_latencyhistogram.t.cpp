@@ -0,0 +1,953 @@
+// bsls_latencyhistogram.t.cpp                                        -*-C++-*-
+#include <bsls_latencyhistogram.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi', 'qsort'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides a value-semantic-like histogram having
+// fixed storage, and a scoped guard.  The mapping of values to buckets is
+// verified exhaustively over the bucket indices, and the approximate
+// percentiles are verified against exact percentiles computed by sorting the
+// recorded values.  The guard is verified against delays measured with
+// 'bsls::TimeUtil::getTimer'.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int bucketIndex(Types::Int64 value);
+// [ 2] Types::Int64 bucketLowestValue(int index);
+// [ 2] Types::Int64 bucketHighestValue(int index);
+//
+// CREATORS
+// [ 3] LatencyHistogram();
+// [ 3] LatencyHistogram(const LatencyHistogram& original);
+// [ 6] explicit LatencyHistogramGuard(LatencyHistogram *histogram);
+// [ 6] ~LatencyHistogramGuard();
+//
+// MANIPULATORS
+// [ 3] LatencyHistogram& operator=(const LatencyHistogram& rhs);
+// [ 5] void add(const LatencyHistogram& other);
+// [ 3] void record(Types::Int64 value);
+// [ 3] void reset();
+// [ 6] LatencyHistogram *release();
+//
+// ACCESSORS
+// [ 3] Types::Int64 bucketCount(int index) const;
+// [ 3] Types::Int64 count() const;
+// [ 3] Types::Int64 max() const;
+// [ 3] double mean() const;
+// [ 3] Types::Int64 min() const;
+// [ 4] Types::Int64 percentile(double percent) const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'record' and 'LatencyHistogramGuard'
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                     GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::LatencyHistogram      Obj;
+typedef bsls::LatencyHistogramGuard Guard;
+typedef bsls::TimeUtil              TU;
+typedef bsls::Types::Int64          Int64;
+typedef bsls::Types::Uint64         Uint64;
+
+const Int64 INT64_MAX_VALUE = static_cast<Int64>(~static_cast<Uint64>(0) >> 1);
+
+//=============================================================================
+//                              HELPER FUNCTIONS
+//-----------------------------------------------------------------------------
+
+namespace {
+
+Uint64 nextRandom(Uint64 *state)
+    // Advance the specified 'state' of a 64-bit linear congruential
+    // generator, and return a pseudo-random value derived from it.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state ^ (*state >> 29);
+}
+
+Int64 randomLatency(Uint64 *state)
+    // Return a pseudo-random non-negative value, obtained using the specified
+    // 'state', whose logarithm is approximately uniformly distributed over
+    // the range of typical latencies (from 1 nanosecond to about 1 second).
+{
+    const Uint64 bits   = nextRandom(state);
+    const int    length = static_cast<int>(bits % 30) + 1;
+    return static_cast<Int64>((bits >> 8) & ((1ULL << length) - 1));
+}
+
+extern "C" int compareInt64(const void *lhs, const void *rhs)
+    // Return a negative value, 0, or a positive value if the 'Int64' at the
+    // specified 'lhs' address is less than, equal to, or greater than the
+    // one at the specified 'rhs' address, respectively.
+{
+    const Int64 a = *static_cast<const Int64 *>(lhs);
+    const Int64 b = *static_cast<const Int64 *>(rhs);
+    return a < b ? -1 : b < a ? 1 : 0;
+}
+
+Int64 exactPercentile(const Int64 *sorted, int numValues, double percent)
+    // Return the smallest of the specified 'numValues' values in the
+    // specified 'sorted' array that is greater than or equal to the specified
+    // 'percent' percent of them.  The behavior is undefined unless
+    // '0 < numValues' and '0 <= percent <= 100'.
+{
+    const double exact = percent * numValues / 100.0;
+    int          rank  = static_cast<int>(exact);
+    if (rank < exact) {
+        ++rank;
+    }
+    if (rank < 1) {
+        rank = 1;
+    }
+    return sorted[rank - 1];
+}
+
+bool isEqual(const Obj& lhs, const Obj& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' histograms have the same
+    // recorded values, and 'false' otherwise.
+{
+    if (lhs.count() != rhs.count()
+     || lhs.min()   != rhs.min()
+     || lhs.max()   != rhs.max()
+     || lhs.mean()  != rhs.mean()) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+        if (lhs.bucketCount(i) != rhs.bucketCount(i)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+void delay(Int64 nanoseconds)
+    // Busy-wait for at least the specified 'nanoseconds', as measured by
+    // 'bsls::TimeUtil::getTimer'.
+{
+    const Int64 start = TU::getTimer();
+    while (TU::getTimer() - start < nanoseconds) {
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Measuring the Tail Latency of an Operation
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know not only the average cost of an operation but
+// also how much its slowest invocations cost, e.g., to verify that a
+// container never takes much longer than usual to insert an element.
+//
+// First, we define the operation being measured:
+//..
+    int operation(int value)
+        // Return a value computed from the specified 'value'.
+    {
+        int result = value;
+        for (int i = 0; i < 100; ++i) {
+            result = result * 31 + i;
+        }
+        return result;
+    }
+//..
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+//  bool     veryVeryVerbose = argc > 4;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create a histogram, and use a guard to record the latency of each
+// invocation of the operation:
+//..
+    bsls::LatencyHistogram histogram;
+
+    int sum = 0;
+    for (int i = 0; i < 10000; ++i) {
+        bsls::LatencyHistogramGuard guard(&histogram);
+
+        sum += operation(i);
+    }
+    ASSERT(10000 == histogram.count());
+//..
+// Next, we obtain the median, the 99th and the 99.9th percentiles, and the
+// maximum of the latencies, in nanoseconds:
+//..
+    const bsls::Types::Int64 p50  = histogram.percentile(50.0);
+    const bsls::Types::Int64 p99  = histogram.percentile(99.0);
+    const bsls::Types::Int64 p999 = histogram.percentile(99.9);
+    const bsls::Types::Int64 max  = histogram.max();
+
+    ASSERT(histogram.min() <= p50);
+    ASSERT(p50  <= p99);
+    ASSERT(p99  <= p999);
+    ASSERT(p999 <= max);
+//..
+// Finally, we note that the values to be recorded need not come from a guard:
+// values measured by other means (e.g., by a benchmark that times batches of
+// operations) can be recorded directly:
+//..
+    bsls::LatencyHistogram batches;
+    batches.record(1500);
+    batches.record(2500);
+    ASSERT(2    == batches.count());
+    ASSERT(1500 == batches.min());
+    ASSERT(2500 == batches.max());
+//..
+//
+///Example 2: Combining the Latencies Measured by Several Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several threads perform the operation of Example 1, and that
+// we want the distribution of its latency over all of them.  Since recording
+// is not thread-safe, each thread records into its own histogram (shown here
+// as an array of histograms indexed by thread):
+//..
+    enum { k_NUM_THREADS = 4 };
+    static bsls::LatencyHistogram perThread[k_NUM_THREADS];
+
+    for (int t = 0; t < k_NUM_THREADS; ++t) {
+        // ... on thread 't':
+        for (int i = 0; i < 1000; ++i) {
+            perThread[t].record(100 * (t + 1));
+        }
+    }
+//..
+// Then, once the threads are done, we combine their histograms:
+//..
+    bsls::LatencyHistogram total;
+    for (int t = 0; t < k_NUM_THREADS; ++t) {
+        total.add(perThread[t]);
+    }
+    ASSERT(4000 == total.count());
+    ASSERT(100  == total.min());
+    ASSERT(400  == total.max());
+//..
+
+        if (veryVerbose) { P_(sum) P_(p50) P_(p99) P_(p999) P(max) }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'LatencyHistogramGuard'
+        //
+        // Concerns:
+        //: 1 A guard records exactly one value, on destruction, in the
+        //:   histogram it guards.
+        //:
+        //: 2 The recorded value is the time elapsed between the construction
+        //:   and the destruction of the guard.
+        //:
+        //: 3 A released guard, or a guard of a null histogram, records
+        //:   nothing, and 'release' returns the guarded histogram.
+        //
+        // Plan:
+        //: 1 Create guards around busy-wait delays of increasing length,
+        //:   measured with 'TimeUtil::getTimer', and verify that one value
+        //:   is recorded per guard, and that it agrees with the delay.
+        //:   (C-1..2)
+        //:
+        //: 2 Release a guard, and create a guard of a null histogram, and
+        //:   verify that nothing is recorded.  (C-3)
+        //
+        // Testing:
+        //   explicit LatencyHistogramGuard(LatencyHistogram *histogram);
+        //   ~LatencyHistogramGuard();
+        //   LatencyHistogram *release();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'LatencyHistogramGuard'"
+                            "\n===============================\n");
+
+        TU::initializeCycleTimer();
+
+        const Int64 TOLERANCE = 1000 * 1000;  // 1 msec
+
+        if (verbose) printf("\nTesting recording of elapsed times.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            int numGuards = 0;
+            for (Int64 duration = 1000;                   // 1 usec
+                 duration <= 100 * 1000 * 1000;           // 100 msec
+                 duration *= 10) {
+                const Int64 t0 = TU::getTimer();
+                {
+                    Guard guard(&mX);
+                    delay(duration);
+                }
+                const Int64 t1 = TU::getTimer();
+                ++numGuards;
+
+                Obj mY;  const Obj& Y = mY;
+                {
+                    Guard guard(&mY);
+                    delay(duration);
+                }
+
+                if (veryVerbose) { T_ P_(duration) P_(t1 - t0) P(Y.max()) }
+
+                LOOP2_ASSERT(numGuards, X.count(), numGuards == X.count());
+                LOOP_ASSERT(duration, 1 == Y.count());
+                LOOP2_ASSERT(duration, Y.max(),
+                             duration - TOLERANCE <= Y.max());
+                LOOP3_ASSERT(duration, Y.max(), t1 - t0,
+                             Y.max() <= (t1 - t0) + TOLERANCE);
+            }
+        }
+
+        if (verbose) printf("\nTesting 'release' and null histograms.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+            {
+                Guard guard(&mX);
+                ASSERT(&mX == guard.release());
+                ASSERT(0   == guard.release());
+            }
+            ASSERT(0 == X.count());
+
+            {
+                Guard guard(0);
+                ASSERT(0 == guard.release());
+            }
+            {
+                Guard guard(0);
+            }
+            ASSERT(0 == X.count());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'add'
+        //
+        // Concerns:
+        //: 1 Adding histograms produces the histogram that would have been
+        //:   obtained by recording all of their values in one histogram.
+        //:
+        //: 2 Adding an empty histogram has no effect, and adding to an empty
+        //:   histogram copies the added histogram.
+        //:
+        //: 3 A histogram can be added to itself.
+        //
+        // Plan:
+        //: 1 Record pseudo-random values, distributing them among several
+        //:   histograms and recording them all into a reference histogram.
+        //:   Add the several histograms, and compare the result with the
+        //:   reference histogram.  (C-1)
+        //:
+        //: 2 Add empty histograms to and from non-empty ones.  (C-2)
+        //:
+        //: 3 Add a histogram to itself, and compare the result with a
+        //:   histogram in which each value was recorded twice.  (C-3)
+        //
+        // Testing:
+        //   void add(const LatencyHistogram& other);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'add'"
+                            "\n=============\n");
+
+        enum { k_NUM_PARTS = 4, k_NUM_VALUES = 10000 };
+
+        static Obj parts[k_NUM_PARTS];
+        static Obj reference;
+        static Obj twice;
+
+        Uint64 state = 12345;
+        for (int i = 0; i < k_NUM_VALUES; ++i) {
+            const Int64 value = randomLatency(&state);
+            parts[i % k_NUM_PARTS].record(value);
+            reference.record(value);
+            twice.record(value);
+            twice.record(value);
+        }
+
+        if (verbose) printf("\nTesting combination of histograms.\n");
+        {
+            static Obj mX;  const Obj& X = mX;
+            for (int p = 0; p < k_NUM_PARTS; ++p) {
+                mX.add(parts[p]);
+            }
+            ASSERT(isEqual(reference, X));
+            ASSERT(k_NUM_VALUES == X.count());
+        }
+
+        if (verbose) printf("\nTesting empty histograms.\n");
+        {
+            static Obj mX;  const Obj& X = mX;
+            static Obj empty;
+
+            mX.add(empty);
+            ASSERT(0 == X.count());
+            ASSERT(0 == X.min());
+            ASSERT(0 == X.max());
+
+            mX.add(reference);
+            ASSERT(isEqual(reference, X));
+
+            mX.add(empty);
+            ASSERT(isEqual(reference, X));
+        }
+
+        if (verbose) printf("\nTesting aliasing.\n");
+        {
+            static Obj mX;  const Obj& X = mX;
+            mX = reference;
+            mX.add(X);
+            ASSERT(isEqual(twice, X));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'percentile'
+        //
+        // Concerns:
+        //: 1 The result is never less than the exact percentile, and exceeds
+        //:   it by at most 1/64 of its value.
+        //:
+        //: 2 The result lies within '[min(), max()]', and 'percentile(100)'
+        //:   is 'max()'.
+        //:
+        //: 3 Percents outside of '[0, 100]' are clamped.
+        //:
+        //: 4 An empty histogram reports 0.
+        //:
+        //: 5 Values below 128 are reported exactly.
+        //
+        // Plan:
+        //: 1 Record pseudo-random values having logarithmically distributed
+        //:   magnitudes, and compare 'percentile' for a range of percents with
+        //:   the exact percentiles of the sorted values.  (C-1..2)
+        //:
+        //: 2 Query percents below 0 and above 100.  (C-3)
+        //:
+        //: 3 Query an empty histogram.  (C-4)
+        //:
+        //: 4 Record the values 0..99 and verify every percentile.  (C-5)
+        //
+        // Testing:
+        //   Types::Int64 percentile(double percent) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'percentile'"
+                            "\n====================\n");
+
+        if (verbose) printf("\nTesting against exact percentiles.\n");
+        {
+            enum { k_NUM_VALUES = 100000 };
+
+            static Int64 values[k_NUM_VALUES];
+            static Obj   mX;  const Obj& X = mX;
+
+            Uint64 state = 987654321;
+            for (int i = 0; i < k_NUM_VALUES; ++i) {
+                values[i] = randomLatency(&state);
+                mX.record(values[i]);
+            }
+            qsort(values, k_NUM_VALUES, sizeof *values, &compareInt64);
+
+            ASSERT(values[0]                == X.min());
+            ASSERT(values[k_NUM_VALUES - 1] == X.max());
+            ASSERT(X.max() == X.percentile(100.0));
+
+            static const double PERCENTS[] = {
+                0.0, 0.001, 1.0, 10.0, 25.0, 50.0, 75.0, 90.0, 99.0, 99.9,
+                99.99, 99.999, 100.0
+            };
+            const int NUM_PERCENTS = sizeof PERCENTS / sizeof *PERCENTS;
+
+            for (int i = 0; i < NUM_PERCENTS; ++i) {
+                const double PERCENT = PERCENTS[i];
+                const Int64  EXACT   = exactPercentile(values,
+                                                       k_NUM_VALUES,
+                                                       PERCENT);
+                const Int64  RESULT  = X.percentile(PERCENT);
+
+                if (veryVerbose) { T_ P_(PERCENT) P_(EXACT) P(RESULT) }
+
+                LOOP3_ASSERT(PERCENT, EXACT, RESULT, EXACT <= RESULT);
+                LOOP3_ASSERT(PERCENT, EXACT, RESULT,
+                             RESULT - EXACT <= EXACT / 64);
+                LOOP2_ASSERT(PERCENT, RESULT, X.min() <= RESULT);
+                LOOP2_ASSERT(PERCENT, RESULT, RESULT <= X.max());
+            }
+
+            ASSERT(X.percentile(0.0)   == X.percentile(-1.0));
+            ASSERT(X.percentile(100.0) == X.percentile(101.0));
+            ASSERT(X.min()             == X.percentile(0.0));
+        }
+
+        if (verbose) printf("\nTesting an empty histogram.\n");
+        {
+            const Obj X;
+            ASSERT(0 == X.percentile(0.0));
+            ASSERT(0 == X.percentile(50.0));
+            ASSERT(0 == X.percentile(100.0));
+        }
+
+        if (verbose) printf("\nTesting exact small values.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+            for (int i = 99; 0 <= i; --i) {
+                mX.record(i);
+            }
+            for (int p = 1; p <= 100; ++p) {
+                LOOP_ASSERT(p, p - 1 == X.percentile(p));
+            }
+            ASSERT(0 == X.percentile(0.0));
+            ASSERT(49 == X.percentile(49.5));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed histogram is empty.
+        //:
+        //: 2 'record' increments the count of the bucket of the value, and
+        //:   updates the count, minimum, maximum, and mean exactly.
+        //:
+        //: 3 Negative values are recorded as 0.
+        //:
+        //: 4 'reset' returns the histogram to its default-constructed state.
+        //:
+        //: 5 Copies have the same recorded values as the original.
+        //
+        // Plan:
+        //: 1 Verify the state of a default-constructed histogram.  (C-1)
+        //:
+        //: 2 Record a table of values, verifying the state of the histogram
+        //:   after each one.  (C-2..3)
+        //:
+        //: 3 Copy-construct and assign the histogram, then reset it.  (C-4..5)
+        //
+        // Testing:
+        //   LatencyHistogram();
+        //   LatencyHistogram(const LatencyHistogram& original);
+        //   LatencyHistogram& operator=(const LatencyHistogram& rhs);
+        //   void record(Types::Int64 value);
+        //   void reset();
+        //   Types::Int64 bucketCount(int index) const;
+        //   Types::Int64 count() const;
+        //   Types::Int64 max() const;
+        //   double mean() const;
+        //   Types::Int64 min() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING PRIMARY MANIPULATORS AND ACCESSORS"
+                            "\n==========================================\n");
+
+        if (verbose) printf("\nTesting default construction.\n");
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0   == X.count());
+        ASSERT(0   == X.min());
+        ASSERT(0   == X.max());
+        ASSERT(0.0 == X.mean());
+        for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+            LOOP_ASSERT(i, 0 == X.bucketCount(i));
+        }
+
+        if (verbose) printf("\nTesting 'record'.\n");
+
+        static const struct {
+            int   d_line;
+            Int64 d_value;
+            Int64 d_recorded;  // value as recorded
+            Int64 d_min;
+            Int64 d_max;
+        } DATA[] = {
+            //LINE  VALUE              RECORDED           MIN   MAX
+            //----  -----------------  -----------------  ----  -------------
+            { L_,   1000,              1000,              1000, 1000        },
+            { L_,   5,                 5,                 5,    1000        },
+            { L_,   1000,              1000,              5,    1000        },
+            { L_,   127,               127,               5,    1000        },
+            { L_,   128,               128,               5,    1000        },
+            { L_,   1000000007,        1000000007,        5,    1000000007  },
+            { L_,   -3,                0,                 0,    1000000007  },
+            { L_,   INT64_MAX_VALUE,   INT64_MAX_VALUE,   0,    INT64_MAX_VALUE
+                                                                            },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        Int64 sum = 0;
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const Int64 VALUE    = DATA[ti].d_value;
+            const Int64 RECORDED = DATA[ti].d_recorded;
+            const Int64 MIN      = DATA[ti].d_min;
+            const Int64 MAX      = DATA[ti].d_max;
+
+            const int   INDEX    = Obj::bucketIndex(RECORDED);
+            const Int64 BEFORE   = X.bucketCount(INDEX);
+
+            mX.record(VALUE);
+
+            LOOP_ASSERT(LINE, ti + 1     == X.count());
+            LOOP_ASSERT(LINE, MIN        == X.min());
+            LOOP_ASSERT(LINE, MAX        == X.max());
+            LOOP_ASSERT(LINE, BEFORE + 1 == X.bucketCount(INDEX));
+
+            if (ti + 1 < NUM_DATA) {  // the last value overflows 'sum'
+                sum += RECORDED;
+                const double MEAN = (double)sum / (ti + 1);
+                LOOP3_ASSERT(LINE, MEAN, X.mean(), MEAN == X.mean());
+            }
+        }
+
+        Int64 total = 0;
+        for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+            total += X.bucketCount(i);
+        }
+        ASSERT(NUM_DATA == total);
+
+        if (verbose) printf("\nTesting copy construction and assignment.\n");
+        {
+            const Obj Y(X);
+            ASSERT(isEqual(X, Y));
+
+            Obj mZ;  const Obj& Z = mZ;
+            mZ.record(42);
+            mZ = X;
+            ASSERT(isEqual(X, Z));
+        }
+
+        if (verbose) printf("\nTesting 'reset'.\n");
+        {
+            mX.reset();
+            ASSERT(isEqual(Obj(), X));
+            ASSERT(0 == X.count());
+            ASSERT(0 == X.min());
+            ASSERT(0 == X.max());
+
+            mX.record(7);
+            ASSERT(1 == X.count());
+            ASSERT(7 == X.min());
+            ASSERT(7 == X.max());
+            ASSERT(7.0 == X.mean());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING BUCKET LAYOUT
+        //
+        // Concerns:
+        //: 1 The buckets partition the non-negative 'Int64' values into
+        //:   contiguous ranges, in increasing order, the first starting at 0
+        //:   and the last ending at the largest 'Int64' value.
+        //:
+        //: 2 'bucketIndex' maps each value to the bucket whose range holds it.
+        //:
+        //: 3 Each of the values 0..127 has a bucket of its own, and the width
+        //:   of every other bucket is at most 1/64 of its lowest value.
+        //
+        // Plan:
+        //: 1 For each bucket index, verify the relations between its lowest
+        //:   and highest values and those of the previous bucket, and map its
+        //:   lowest and highest values, and its midpoint, back to the index.
+        //:   (C-1..3)
+        //:
+        //: 2 Map pseudo-random values to their buckets, and verify that they
+        //:   lie within the range of the bucket.  (C-2)
+        //
+        // Testing:
+        //   int bucketIndex(Types::Int64 value);
+        //   Types::Int64 bucketLowestValue(int index);
+        //   Types::Int64 bucketHighestValue(int index);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BUCKET LAYOUT"
+                            "\n=====================\n");
+
+        if (verbose) printf("\nTesting every bucket.\n");
+        {
+            ASSERT(0 == Obj::bucketLowestValue(0));
+            ASSERT(INT64_MAX_VALUE ==
+                             Obj::bucketHighestValue(Obj::k_NUM_BUCKETS - 1));
+
+            for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+                const Int64 LO  = Obj::bucketLowestValue(i);
+                const Int64 HI  = Obj::bucketHighestValue(i);
+                const Int64 MID = LO + (HI - LO) / 2;
+
+                if (veryVerbose && (i < 130 || i % 64 == 0)) {
+                    T_ P_(i) P_(LO) P(HI)
+                }
+
+                LOOP3_ASSERT(i, LO, HI, LO <= HI);
+                if (0 < i) {
+                    LOOP_ASSERT(i, Obj::bucketHighestValue(i - 1) + 1 == LO);
+                }
+                if (i < 128) {
+                    LOOP3_ASSERT(i, LO, HI, i == LO && i == HI);
+                }
+                else {
+                    LOOP3_ASSERT(i, LO, HI, HI - LO < LO / 64);
+                }
+
+                LOOP2_ASSERT(i, LO,  i == Obj::bucketIndex(LO));
+                LOOP2_ASSERT(i, HI,  i == Obj::bucketIndex(HI));
+                LOOP2_ASSERT(i, MID, i == Obj::bucketIndex(MID));
+            }
+        }
+
+        if (verbose) printf("\nTesting pseudo-random values.\n");
+        {
+            Uint64 state = 42;
+            for (int i = 0; i < 100000; ++i) {
+                const Uint64 bits  = nextRandom(&state);
+                const Int64  VALUE = static_cast<Int64>(
+                                             (bits >> 1) >> (bits % 63));
+                const int    INDEX = Obj::bucketIndex(VALUE);
+
+                LOOP2_ASSERT(VALUE, INDEX, 0 <= INDEX);
+                LOOP2_ASSERT(VALUE, INDEX, INDEX < Obj::k_NUM_BUCKETS);
+                LOOP2_ASSERT(VALUE, INDEX,
+                             Obj::bucketLowestValue(INDEX)  <= VALUE);
+                LOOP2_ASSERT(VALUE, INDEX,
+                             Obj::bucketHighestValue(INDEX) >= VALUE);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Record a few values, and query the histogram.  Time a block with
+        //:   a guard.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == X.count());
+
+        for (int i = 1; i <= 100; ++i) {
+            mX.record(i * 1000);
+        }
+        ASSERT(100    == X.count());
+        ASSERT(1000   == X.min());
+        ASSERT(100000 == X.max());
+        ASSERT(50500.0 == X.mean());
+
+        const Int64 p50 = X.percentile(50.0);
+        if (veryVerbose) { T_ P(p50) }
+        ASSERT(50000 <= p50);
+        ASSERT(p50 <= 50000 + 50000 / 64);
+
+        ASSERT(100000 == X.percentile(100.0));
+
+        {
+            Guard guard(&mX);
+        }
+        ASSERT(101 == X.count());
+
+        Obj mY;  const Obj& Y = mY;
+        mY.add(X);
+        ASSERT(101 == Y.count());
+
+        mX.reset();
+        ASSERT(0 == X.count());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'record' AND 'LatencyHistogramGuard'
+        //
+        // Concerns:
+        //: 1 Recording a value takes a few nanoseconds, and a guard adds only
+        //:   the cost of two reads of the cycle timer.
+        //
+        // Plan:
+        //: 1 Record pseudo-random values in a loop, and time the loop.
+        //:
+        //: 2 Create and destroy guards in a loop, and time the loop.
+        //:
+        //: 3 Report the percentiles of the cost of an empty guarded block.
+        //
+        // Testing:
+        //   PERFORMANCE: 'record' and 'LatencyHistogramGuard'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: 'record' AND GUARD"
+                            "\n===============================\n");
+
+        const int NUM_ITERATIONS = verbose ? atoi(argv[2]) : 10000000;
+
+        TU::initializeCycleTimer();
+
+        static Obj mX;  const Obj& X = mX;
+
+        enum { k_NUM_VALUES = 1024 };
+        static Int64 values[k_NUM_VALUES];
+        Uint64 state = 1;
+        for (int i = 0; i < k_NUM_VALUES; ++i) {
+            values[i] = randomLatency(&state);
+        }
+
+        {
+            const Int64 t0 = TU::getTimer();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                mX.record(values[i % k_NUM_VALUES]);
+            }
+            const Int64 t1 = TU::getTimer();
+            printf("record:                %6.2f nsec per call\n",
+                   (double)(t1 - t0) / NUM_ITERATIONS);
+        }
+
+        mX.reset();
+        {
+            const Int64 t0 = TU::getTimer();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                Guard guard(&mX);
+            }
+            const Int64 t1 = TU::getTimer();
+            printf("guard:                 %6.2f nsec per block\n",
+                   (double)(t1 - t0) / NUM_ITERATIONS);
+        }
+
+        printf("empty guarded block:   p50 %lld, p99 %lld, p99.9 %lld, "
+               "max %lld nsec\n",
+               X.percentile(50.0),
+               X.percentile(99.0),
+               X.percentile(99.9),
+               X.max());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,241 @@
+// bsls_performancecounters.cpp                                       -*-C++-*-
+#include <bsls_performancecounters.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    #include <linux/perf_event.h>  // struct perf_event_attr
+    #include <sys/syscall.h>       // __NR_perf_event_open
+    #include <string.h>            // memset()
+    #include <unistd.h>            // syscall(), read(), close()
+
+    #if defined(__NR_perf_event_open)
+        #define BSLS_PERFORMANCECOUNTERS_PERF_EVENT 1
+    #endif
+#endif
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    #include <sys/resource.h>      // getrusage()
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+#if defined(BSLS_PERFORMANCECOUNTERS_PERF_EVENT)
+int openPerfEvent(__u32 type, __u64 config)
+    // Return a file descriptor for a 'perf' counter of the event having the
+    // specified 'type' and 'config', counting the events of the calling
+    // thread in user mode only, or -1 if the counter cannot be opened.
+{
+    struct perf_event_attr attributes;
+    memset(&attributes, 0, sizeof attributes);
+
+    attributes.type           = type;
+    attributes.size           = sizeof attributes;
+    attributes.config         = config;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv     = 1;
+
+    unsigned long flags = 0;
+#if defined(PERF_FLAG_FD_CLOEXEC)
+    flags = PERF_FLAG_FD_CLOEXEC;
+#endif
+
+    return static_cast<int>(::syscall(__NR_perf_event_open,
+                                      &attributes,
+                                      0,     // calling thread
+                                      -1,    // on any processor
+                                      -1,    // not in a group
+                                      flags));
+}
+
+bsls::Types::Int64 readPerfEvent(int descriptor)
+    // Return the value of the 'perf' counter having the specified
+    // 'descriptor', or 0 if it cannot be read.
+{
+    bsls::Types::Uint64 value;
+    if (static_cast<ssize_t>(sizeof value)
+                                 != ::read(descriptor, &value, sizeof value)) {
+        return 0;                                                     // RETURN
+    }
+    return static_cast<bsls::Types::Int64>(value);
+}
+#endif
+
+bsls::Types::Int64 readPageFaults()
+    // Return the number of page faults incurred by the calling thread (or by
+    // the process, on platforms that do not report them per thread), or 0 if
+    // they cannot be obtained.
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#if defined(RUSAGE_THREAD)
+    const int who = RUSAGE_THREAD;
+#else
+    const int who = RUSAGE_SELF;
+#endif
+
+    struct rusage usage;
+    if (0 != ::getrusage(who, &usage)) {
+        return 0;                                                     // RETURN
+    }
+    return static_cast<bsls::Types::Int64>(usage.ru_minflt)
+         + static_cast<bsls::Types::Int64>(usage.ru_majflt);
+#else
+    return 0;
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bsls {
+
+                         // -------------------------
+                         // class PerformanceCounters
+                         // -------------------------
+
+// CLASS METHODS
+const char *PerformanceCounters::toAscii(Event event)
+{
+#define CASE(X) case(BSLS_ ## X): return #X;
+
+    switch (event) {
+      CASE(INSTRUCTIONS)
+      CASE(CYCLES)
+      CASE(CACHE_MISSES)
+      CASE(PAGE_FAULTS)
+      default: return "(* UNKNOWN *)";
+    }
+
+#undef CASE
+}
+
+const char *PerformanceCounters::toAscii(Source source)
+{
+#define CASE(X) case(BSLS_ ## X): return #X;
+
+    switch (source) {
+      CASE(UNAVAILABLE)
+      CASE(HARDWARE)
+      CASE(SOFTWARE)
+      default: return "(* UNKNOWN *)";
+    }
+
+#undef CASE
+}
+
+// CREATORS
+PerformanceCounters::PerformanceCounters()
+{
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        d_descriptors[i] = -1;
+        d_sources[i]     = BSLS_UNAVAILABLE;
+    }
+
+#if defined(BSLS_PERFORMANCECOUNTERS_PERF_EVENT)
+    d_descriptors[BSLS_INSTRUCTIONS] =
+                openPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    d_descriptors[BSLS_CYCLES] =
+                  openPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    d_descriptors[BSLS_CACHE_MISSES] =
+                openPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        if (0 <= d_descriptors[i]) {
+            d_sources[i] = BSLS_HARDWARE;
+        }
+    }
+
+    d_descriptors[BSLS_PAGE_FAULTS] =
+                  openPerfEvent(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS);
+    if (0 <= d_descriptors[BSLS_PAGE_FAULTS]) {
+        d_sources[BSLS_PAGE_FAULTS] = BSLS_SOFTWARE;
+    }
+#endif
+
+    // Substitute the counters that could not be opened by values read
+    // directly from the operating system, where possible.
+
+    if (BSLS_UNAVAILABLE == d_sources[BSLS_CYCLES]) {
+        d_sources[BSLS_CYCLES] = BSLS_SOFTWARE;
+    }
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    if (BSLS_UNAVAILABLE == d_sources[BSLS_PAGE_FAULTS]) {
+        d_sources[BSLS_PAGE_FAULTS] = BSLS_SOFTWARE;
+    }
+#endif
+}
+
+PerformanceCounters::~PerformanceCounters()
+{
+#if defined(BSLS_PERFORMANCECOUNTERS_PERF_EVENT)
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        if (0 <= d_descriptors[i]) {
+            ::close(d_descriptors[i]);
+        }
+    }
+#endif
+}
+
+// ACCESSORS
+void PerformanceCounters::read(Types::Int64 *values) const
+{
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        values[i] = read(static_cast<Event>(i));
+    }
+}
+
+Types::Int64 PerformanceCounters::read(Event event) const
+{
+#if defined(BSLS_PERFORMANCECOUNTERS_PERF_EVENT)
+    if (0 <= d_descriptors[event]) {
+        return readPerfEvent(d_descriptors[event]);                   // RETURN
+    }
+#endif
+
+    if (BSLS_UNAVAILABLE == d_sources[event]) {
+        return 0;                                                     // RETURN
+    }
+
+    switch (event) {
+      case BSLS_CYCLES: {
+        return TimeUtil::getThreadCpuTimer();                         // RETURN
+      }
+      case BSLS_PAGE_FAULTS: {
+        return readPageFaults();                                      // RETURN
+      }
+      default: {
+        return 0;                                                     // RETURN
+      }
+    }
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
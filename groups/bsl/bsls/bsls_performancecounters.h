@@ -0,0 +1,279 @@
+// bsls_performancecounters.h                                         -*-C++-*-
+#ifndef INCLUDED_BSLS_PERFORMANCECOUNTERS
+#define INCLUDED_BSLS_PERFORMANCECOUNTERS
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide access to per-thread processor and OS event counters.
+//
+//@CLASSES:
+//  bsls::PerformanceCounters: set of event counters of the calling thread
+//
+//@SEE_ALSO: bsls_stopwatch, bsls_timeutil
+//
+//@DESCRIPTION: This component provides a class, 'bsls::PerformanceCounters',
+// that counts, for the thread that creates it, a fixed set of events: the
+// instructions executed, the processor cycles elapsed, the cache misses, and
+// the page faults incurred by that thread.  The difference between two
+// readings of a counter is the number of events that occurred in between;
+// hence, e.g., a micro-benchmark can report the number of instructions
+// executed per operation, a figure that is much more stable from run to run
+// than wall time, which depends on frequency scaling, interrupts, and the
+// activity of other processes.
+//
+///Sources of Counts
+///-----------------
+// Each event is counted from the best source available on the platform, which
+// is reported by the 'source' accessor:
+//
+//: 'BSLS_HARDWARE':
+//:   The event is counted by the performance-monitoring unit of the
+//:   processor.  On Linux, hardware counters are opened with the
+//:   'perf_event_open' system call, and count events occurring in user mode
+//:   only.
+//:
+//: 'BSLS_SOFTWARE':
+//:   The event is counted by the operating system, either because it is a
+//:   software event (page faults), or because no hardware counter is
+//:   available (e.g., in a virtual machine, in a container whose security
+//:   policy forbids 'perf_event_open', or if
+//:   '/proc/sys/kernel/perf_event_paranoid' is too restrictive).  In the
+//:   latter case, 'BSLS_CYCLES' is substituted by the CPU time of the thread
+//:   in *nanoseconds*, as reported by 'bsls::TimeUtil::getThreadCpuTimer'.
+//:   On Linux, page faults are counted by a 'perf_event_open' software
+//:   counter (in user mode only) if possible, and are otherwise obtained from
+//:   'getrusage' on UNIX platforms (for the whole process on platforms that
+//:   do not report them per thread).
+//:
+//: 'BSLS_UNAVAILABLE':
+//:   The event cannot be counted on this platform, and its counter always
+//:   reads 0.  'BSLS_INSTRUCTIONS' and 'BSLS_CACHE_MISSES' have no software
+//:   equivalent.
+//
+// Note that hardware counters are a limited resource: if more events are
+// requested (by all of the processes of the system) than the processor can
+// count simultaneously, the operating system multiplexes the counters, and
+// the counts of events are then underestimated.
+//
+///Thread Safety
+///-------------
+// A 'bsls::PerformanceCounters' object counts the events of the thread that
+// created it, and must be read only by that thread: hardware counters (if
+// any) would count the events of the creating thread, but the software
+// substitutes are read from the thread calling 'read'.  Distinct objects may
+// be used concurrently by distinct threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting the Instructions Executed by an Operation
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know how many instructions, on average, a function
+// executes per call, and how many page faults it causes.
+//
+// First, we define the function being measured:
+//..
+//  int operation(int value)
+//      // Return a value computed from the specified 'value'.
+//  {
+//      int result = value;
+//      for (int i = 0; i < 100; ++i) {
+//          result = result * 31 + i;
+//      }
+//      return result;
+//  }
+//..
+// Then, we create the counters of the current thread, and read them before
+// and after calling the function a number of times:
+//..
+//  typedef bsls::PerformanceCounters Counters;
+//
+//  Counters counters;
+//
+//  bsls::Types::Int64 before[Counters::k_NUM_EVENTS];
+//  bsls::Types::Int64 after[Counters::k_NUM_EVENTS];
+//
+//  enum { k_NUM_CALLS = 10000 };
+//
+//  counters.read(before);
+//  int sum = 0;
+//  for (int i = 0; i < k_NUM_CALLS; ++i) {
+//      sum += operation(i);
+//  }
+//  counters.read(after);
+//..
+// Finally, we report the number of instructions per call, if the processor
+// can count them, and the number of page faults otherwise:
+//..
+//  if (counters.isAvailable(Counters::BSLS_INSTRUCTIONS)) {
+//      const bsls::Types::Int64 instructions =
+//                                   after[Counters::BSLS_INSTRUCTIONS]
+//                                 - before[Counters::BSLS_INSTRUCTIONS];
+//      const double instructionsPerCall =
+//                         static_cast<double>(instructions) / k_NUM_CALLS;
+//      assert(0 < instructionsPerCall);
+//  }
+//
+//  const bsls::Types::Int64 pageFaults = after[Counters::BSLS_PAGE_FAULTS]
+//                                     - before[Counters::BSLS_PAGE_FAULTS];
+//  assert(0 <= pageFaults);
+//..
+// See 'bsls_stopwatch' for how to accumulate counts over several intervals
+// together with elapsed times.
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                         // =========================
+                         // class PerformanceCounters
+                         // =========================
+
+class PerformanceCounters {
+    // This class provides counters of the instructions, processor cycles,
+    // cache misses, and page faults of the thread that creates an object,
+    // read from hardware counters where available, and from software
+    // substitutes otherwise (see the "Sources of Counts" section of the
+    // component-level documentation).  The counters start counting when the
+    // object is created, and are released when it is destroyed.
+
+  public:
+    // TYPES
+    enum Event {
+        // Enumerate the events counted by a 'PerformanceCounters' object.
+
+        BSLS_INSTRUCTIONS = 0,  // instructions retired
+        BSLS_CYCLES       = 1,  // processor cycles, or CPU time in
+                                // nanoseconds if counted by software
+        BSLS_CACHE_MISSES = 2,  // last-level cache misses
+        BSLS_PAGE_FAULTS  = 3   // page faults (minor and major)
+    };
+
+    enum {
+        k_NUM_EVENTS = 4  // number of enumerators in 'Event'
+    };
+
+    enum Source {
+        // Enumerate the sources from which an event can be counted.
+
+        BSLS_UNAVAILABLE = 0,  // not counted; the counter reads 0
+        BSLS_HARDWARE    = 1,  // counted by the processor
+        BSLS_SOFTWARE    = 2   // counted by the operating system
+    };
+
+  private:
+    // DATA
+    int    d_descriptors[k_NUM_EVENTS];  // 'perf_event_open' file
+                                         // descriptor of each event, or -1
+                                         // if not counted by 'perf'
+
+    Source d_sources[k_NUM_EVENTS];      // source of each event
+
+  private:
+    // NOT IMPLEMENTED
+    PerformanceCounters(const PerformanceCounters&);
+    PerformanceCounters& operator=(const PerformanceCounters&);
+
+  public:
+    // CLASS METHODS
+    static const char *toAscii(Event event);
+        // Return the non-modifiable string representation corresponding to
+        // the specified 'event', if it exists, and a unique (error) string
+        // otherwise.  The string representation of 'event' matches its
+        // corresponding enumerator name with the "BSLS_" prefix elided.
+
+    static const char *toAscii(Source source);
+        // Return the non-modifiable string representation corresponding to
+        // the specified 'source', if it exists, and a unique (error) string
+        // otherwise.  The string representation of 'source' matches its
+        // corresponding enumerator name with the "BSLS_" prefix elided.
+
+    // CREATORS
+    PerformanceCounters();
+        // Create counters of the events of the calling thread, each counted
+        // from the best source available (see 'source').  Note that, on
+        // Linux, this constructor makes a 'perf_event_open' system call per
+        // event.
+
+    ~PerformanceCounters();
+        // Destroy this object, releasing the counters it holds.
+
+    // ACCESSORS
+    bool isAvailable(Event event) const;
+        // Return 'true' if the specified 'event' is counted by this object,
+        // and 'false' otherwise.  Note that this method is equivalent to
+        // 'BSLS_UNAVAILABLE != source(event)'.
+
+    void read(Types::Int64 *values) const;
+        // Load into the array of 'k_NUM_EVENTS' elements at the specified
+        // 'values' the current value of the counter of each event, indexed by
+        // 'Event'.  The counter of an event that is not available reads 0.
+        // The behavior is undefined unless this method is called by the
+        // thread that created this object.
+
+    Types::Int64 read(Event event) const;
+        // Return the current value of the counter of the specified 'event',
+        // or 0 if that event is not available.  The behavior is undefined
+        // unless this method is called by the thread that created this
+        // object.
+
+    Source source(Event event) const;
+        // Return the source from which the specified 'event' is counted.
+};
+
+// ============================================================================
+//                          INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // class PerformanceCounters
+                         // -------------------------
+
+// ACCESSORS
+inline
+bool PerformanceCounters::isAvailable(Event event) const
+{
+    return BSLS_UNAVAILABLE != d_sources[event];
+}
+
+inline
+PerformanceCounters::Source PerformanceCounters::source(Event event) const
+{
+    return d_sources[event];
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,621 @@
+// bsls_performancecounters.t.cpp                                     -*-C++-*-
+#include <bsls_performancecounters.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi', 'malloc', 'free'
+#include <string.h>     // 'strcmp'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test reads counters whose sources depend on the
+// platform, the processor, and the permissions of the process.  We verify
+// that the reported sources are consistent with the values read, that the
+// counters that are available on every platform (e.g., 'BSLS_CYCLES') advance
+// when the corresponding events occur, and that counters that are not
+// available read 0.  Hardware counters are tested only if the machine running
+// the test driver provides them.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] const char *toAscii(Event event);
+// [ 2] const char *toAscii(Source source);
+//
+// CREATORS
+// [ 3] PerformanceCounters();
+// [ 3] ~PerformanceCounters();
+//
+// ACCESSORS
+// [ 3] bool isAvailable(Event event) const;
+// [ 4] void read(Types::Int64 *values) const;
+// [ 4] Types::Int64 read(Event event) const;
+// [ 3] Source source(Event event) const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'read'
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                     GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::PerformanceCounters Obj;
+typedef bsls::TimeUtil            TU;
+typedef bsls::Types::Int64        Int64;
+
+//=============================================================================
+//                              HELPER FUNCTIONS
+//-----------------------------------------------------------------------------
+
+namespace {
+
+volatile int sink;  // defeats the optimization of busy loops
+
+void spin(int numIterations)
+    // Execute a loop of the specified 'numIterations' iterations, each
+    // executing at least one instruction.
+{
+    for (int i = 0; i < numIterations; ++i) {
+        sink = i;
+    }
+}
+
+void delay(Int64 nanoseconds)
+    // Busy-wait for at least the specified 'nanoseconds', as measured by
+    // 'bsls::TimeUtil::getTimer'.
+{
+    const Int64 start = TU::getTimer();
+    while (TU::getTimer() - start < nanoseconds) {
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting the Instructions Executed by an Operation
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know how many instructions, on average, a function
+// executes per call, and how many page faults it causes.
+//
+// First, we define the function being measured:
+//..
+    int operation(int value)
+        // Return a value computed from the specified 'value'.
+    {
+        int result = value;
+        for (int i = 0; i < 100; ++i) {
+            result = result * 31 + i;
+        }
+        return result;
+    }
+//..
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+//  bool     veryVeryVerbose = argc > 4;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create the counters of the current thread, and read them before
+// and after calling the function a number of times:
+//..
+    typedef bsls::PerformanceCounters Counters;
+
+    Counters counters;
+
+    bsls::Types::Int64 before[Counters::k_NUM_EVENTS];
+    bsls::Types::Int64 after[Counters::k_NUM_EVENTS];
+
+    enum { k_NUM_CALLS = 10000 };
+
+    counters.read(before);
+    int sum = 0;
+    for (int i = 0; i < k_NUM_CALLS; ++i) {
+        sum += operation(i);
+    }
+    counters.read(after);
+//..
+// Finally, we report the number of instructions per call, if the processor
+// can count them, and the number of page faults otherwise:
+//..
+    if (counters.isAvailable(Counters::BSLS_INSTRUCTIONS)) {
+        const bsls::Types::Int64 instructions =
+                                     after[Counters::BSLS_INSTRUCTIONS]
+                                   - before[Counters::BSLS_INSTRUCTIONS];
+        const double instructionsPerCall =
+                           static_cast<double>(instructions) / k_NUM_CALLS;
+        ASSERT(0 < instructionsPerCall);
+    }
+
+    const bsls::Types::Int64 pageFaults = after[Counters::BSLS_PAGE_FAULTS]
+                                       - before[Counters::BSLS_PAGE_FAULTS];
+    ASSERT(0 <= pageFaults);
+//..
+
+        if (veryVerbose) { P_(sum) P(pageFaults) }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'read'
+        //
+        // Concerns:
+        //: 1 Counters do not decrease over successive reads.
+        //:
+        //: 2 Both overloads of 'read' report the same counters.
+        //:
+        //: 3 'BSLS_CYCLES' advances while the thread is busy.
+        //:
+        //: 4 'BSLS_PAGE_FAULTS', if available, advances when the thread
+        //:   touches memory that has not been touched before.
+        //:
+        //: 5 'BSLS_INSTRUCTIONS', if available, counts at least one
+        //:   instruction per iteration of a loop.
+        //:
+        //: 6 Counters that are not available read 0.
+        //
+        // Plan:
+        //: 1 Read all of the counters in a loop, bracketing each read of all
+        //:   counters by reads of each individual counter, and verify that
+        //:   the values do not decrease.  (C-1..2)
+        //:
+        //: 2 Busy-wait for 50 msec, and verify that 'BSLS_CYCLES' advanced.
+        //:   (C-3)
+        //:
+        //: 3 Allocate a large block of memory, write to each of its pages, and
+        //:   verify that 'BSLS_PAGE_FAULTS', if available, advanced.  (C-4)
+        //:
+        //: 4 Execute a loop of a known number of iterations, and verify that
+        //:   'BSLS_INSTRUCTIONS', if available, advanced by at least that
+        //:   number.  (C-5)
+        //:
+        //: 5 Verify that all of the unavailable counters read 0.  (C-6)
+        //
+        // Testing:
+        //   void read(Types::Int64 *values) const;
+        //   Types::Int64 read(Event event) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'read'"
+                            "\n==============\n");
+
+        Obj mX;  const Obj& X = mX;
+
+        if (verbose) printf("\nTesting monotonicity.\n");
+        {
+            Int64 previous[Obj::k_NUM_EVENTS];
+            X.read(previous);
+
+            for (int i = 0; i < 1000; ++i) {
+                for (int e = 0; e < Obj::k_NUM_EVENTS; ++e) {
+                    const Obj::Event EVENT = static_cast<Obj::Event>(e);
+
+                    const Int64 v1 = X.read(EVENT);
+                    Int64 values[Obj::k_NUM_EVENTS];
+                    X.read(values);
+                    const Int64 v2 = X.read(EVENT);
+
+                    LOOP3_ASSERT(i, e, previous[e], previous[e] <= v1);
+                    LOOP3_ASSERT(i, e, v1, v1 <= values[e]);
+                    LOOP3_ASSERT(i, e, v2, values[e] <= v2);
+
+                    previous[e] = v2;
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting 'BSLS_CYCLES'.\n");
+        {
+            ASSERT(X.isAvailable(Obj::BSLS_CYCLES));
+
+            const Int64 c0 = X.read(Obj::BSLS_CYCLES);
+            delay(50 * 1000 * 1000);
+            const Int64 c1 = X.read(Obj::BSLS_CYCLES);
+
+            if (verbose) { T_ P(c1 - c0) }
+            LOOP2_ASSERT(c0, c1, c0 < c1);
+        }
+
+        if (verbose) printf("\nTesting 'BSLS_PAGE_FAULTS'.\n");
+        if (X.isAvailable(Obj::BSLS_PAGE_FAULTS)) {
+            const int SIZE      = 16 * 1024 * 1024;
+            const int PAGE_SIZE = 4096;
+
+            const Int64 f0 = X.read(Obj::BSLS_PAGE_FAULTS);
+            char *block = static_cast<char *>(malloc(SIZE));
+            ASSERT(block);
+            for (int i = 0; i < SIZE; i += PAGE_SIZE) {
+                block[i] = static_cast<char>(i);
+            }
+            const Int64 f1 = X.read(Obj::BSLS_PAGE_FAULTS);
+            free(block);
+
+            if (verbose) { T_ P(f1 - f0) }
+            LOOP2_ASSERT(f0, f1, f0 < f1);
+        }
+
+        if (verbose) printf("\nTesting 'BSLS_INSTRUCTIONS'.\n");
+        if (X.isAvailable(Obj::BSLS_INSTRUCTIONS)) {
+            const int NUM_ITERATIONS = 1000000;
+
+            const Int64 i0 = X.read(Obj::BSLS_INSTRUCTIONS);
+            spin(NUM_ITERATIONS);
+            const Int64 i1 = X.read(Obj::BSLS_INSTRUCTIONS);
+
+            if (verbose) { T_ P(i1 - i0) }
+            LOOP2_ASSERT(i0, i1, NUM_ITERATIONS <= i1 - i0);
+        }
+
+        if (verbose) printf("\nTesting unavailable counters.\n");
+        {
+            Int64 values[Obj::k_NUM_EVENTS];
+            X.read(values);
+
+            for (int e = 0; e < Obj::k_NUM_EVENTS; ++e) {
+                const Obj::Event EVENT = static_cast<Obj::Event>(e);
+
+                if (!X.isAvailable(EVENT)) {
+                    LOOP2_ASSERT(e, values[e], 0 == values[e]);
+                    LOOP_ASSERT(e, 0 == X.read(EVENT));
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND 'source'
+        //
+        // Concerns:
+        //: 1 Each event has a valid source, and 'isAvailable' is consistent
+        //:   with it.
+        //:
+        //: 2 'BSLS_CYCLES' is available on every platform, and
+        //:   'BSLS_PAGE_FAULTS' on every UNIX platform.
+        //:
+        //: 3 'BSLS_INSTRUCTIONS' and 'BSLS_CACHE_MISSES' are counted only by
+        //:   hardware, and 'BSLS_PAGE_FAULTS' only by software.
+        //:
+        //: 4 The destructor releases the resources held by the counters, so
+        //:   that the sources of the counters of an object do not depend on
+        //:   the number of objects that were created and destroyed before it.
+        //
+        // Plan:
+        //: 1 Create an object, and verify the source of each event, and the
+        //:   value of 'isAvailable' for it.  (C-1..3)
+        //:
+        //: 2 Create and destroy 5000 objects (more than the default limit on
+        //:   open file descriptors), and verify that the sources of the
+        //:   counters of the last object are those of the first.  (C-4)
+        //
+        // Testing:
+        //   PerformanceCounters();
+        //   ~PerformanceCounters();
+        //   bool isAvailable(Event event) const;
+        //   Source source(Event event) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CREATORS AND 'source'"
+                            "\n=============================\n");
+
+        Obj::Source sources[Obj::k_NUM_EVENTS];
+
+        if (verbose) printf("\nTesting sources.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            for (int e = 0; e < Obj::k_NUM_EVENTS; ++e) {
+                const Obj::Event  EVENT  = static_cast<Obj::Event>(e);
+                const Obj::Source SOURCE = X.source(EVENT);
+
+                if (verbose) {
+                    printf("\t%-14s %s\n",
+                           Obj::toAscii(EVENT),
+                           Obj::toAscii(SOURCE));
+                }
+
+                LOOP2_ASSERT(e, SOURCE, Obj::BSLS_UNAVAILABLE == SOURCE
+                                     || Obj::BSLS_HARDWARE    == SOURCE
+                                     || Obj::BSLS_SOFTWARE    == SOURCE);
+                LOOP_ASSERT(e, (Obj::BSLS_UNAVAILABLE != SOURCE)
+                                                     == X.isAvailable(EVENT));
+
+                sources[e] = SOURCE;
+            }
+
+            ASSERT(X.isAvailable(Obj::BSLS_CYCLES));
+#if defined(BSLS_PLATFORM_OS_UNIX)
+            ASSERT(X.isAvailable(Obj::BSLS_PAGE_FAULTS));
+#endif
+
+            ASSERT(Obj::BSLS_SOFTWARE != X.source(Obj::BSLS_INSTRUCTIONS));
+            ASSERT(Obj::BSLS_SOFTWARE != X.source(Obj::BSLS_CACHE_MISSES));
+            ASSERT(Obj::BSLS_HARDWARE != X.source(Obj::BSLS_PAGE_FAULTS));
+        }
+
+        if (verbose) printf("\nTesting the release of resources.\n");
+        {
+            for (int i = 0; i < 5000; ++i) {
+                Obj mX;
+            }
+
+            Obj mX;  const Obj& X = mX;
+
+            for (int e = 0; e < Obj::k_NUM_EVENTS; ++e) {
+                const Obj::Event EVENT = static_cast<Obj::Event>(e);
+
+                LOOP_ASSERT(e, sources[e] == X.source(EVENT));
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'toAscii'
+        //
+        // Concerns:
+        //: 1 Each enumerator of 'Event' and 'Source' has the expected string
+        //:   representation.
+        //:
+        //: 2 An out-of-range value has the representation "(* UNKNOWN *)".
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the representation of
+        //:   each enumerator, and of an out-of-range value, of each
+        //:   enumeration.  (C-1..2)
+        //
+        // Testing:
+        //   const char *toAscii(Event event);
+        //   const char *toAscii(Source source);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'toAscii'"
+                            "\n=================\n");
+
+        static const struct {
+            int         d_line;      // source line number
+            int         d_value;     // enumerator value
+            const char *d_expected;  // expected representation
+        } EVENTS[] = {
+            //LINE  VALUE                     EXPECTED
+            //----  ------------------------  ---------------
+            { L_,   Obj::BSLS_INSTRUCTIONS,   "INSTRUCTIONS"  },
+            { L_,   Obj::BSLS_CYCLES,         "CYCLES"        },
+            { L_,   Obj::BSLS_CACHE_MISSES,   "CACHE_MISSES"  },
+            { L_,   Obj::BSLS_PAGE_FAULTS,    "PAGE_FAULTS"   },
+            { L_,   Obj::k_NUM_EVENTS,        "(* UNKNOWN *)" },
+        }, SOURCES[] = {
+            //LINE  VALUE                     EXPECTED
+            //----  ------------------------  ---------------
+            { L_,   Obj::BSLS_UNAVAILABLE,    "UNAVAILABLE"   },
+            { L_,   Obj::BSLS_HARDWARE,       "HARDWARE"      },
+            { L_,   Obj::BSLS_SOFTWARE,       "SOFTWARE"      },
+            { L_,   3,                        "(* UNKNOWN *)" },
+        };
+        const int NUM_EVENTS  = sizeof EVENTS  / sizeof *EVENTS;
+        const int NUM_SOURCES = sizeof SOURCES / sizeof *SOURCES;
+
+        for (int ti = 0; ti < NUM_EVENTS; ++ti) {
+            const int         LINE     = EVENTS[ti].d_line;
+            const char       *EXPECTED = EVENTS[ti].d_expected;
+            const Obj::Event  VALUE    =
+                                  static_cast<Obj::Event>(EVENTS[ti].d_value);
+            const char       *RESULT   = Obj::toAscii(VALUE);
+
+            if (veryVerbose) { T_ P_(LINE) P(RESULT) }
+            LOOP2_ASSERT(LINE, RESULT, 0 == strcmp(EXPECTED, RESULT));
+        }
+
+        for (int ti = 0; ti < NUM_SOURCES; ++ti) {
+            const int         LINE     = SOURCES[ti].d_line;
+            const char       *EXPECTED = SOURCES[ti].d_expected;
+            const Obj::Source VALUE    =
+                                static_cast<Obj::Source>(SOURCES[ti].d_value);
+            const char       *RESULT   = Obj::toAscii(VALUE);
+
+            if (veryVerbose) { T_ P_(LINE) P(RESULT) }
+            LOOP2_ASSERT(LINE, RESULT, 0 == strcmp(EXPECTED, RESULT));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create counters, report their sources, and read them before and
+        //:   after some work.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Obj mX;  const Obj& X = mX;
+
+        Int64 before[Obj::k_NUM_EVENTS];
+        Int64 after[Obj::k_NUM_EVENTS];
+
+        X.read(before);
+        delay(10 * 1000 * 1000);
+        X.read(after);
+
+        for (int e = 0; e < Obj::k_NUM_EVENTS; ++e) {
+            const Obj::Event EVENT = static_cast<Obj::Event>(e);
+
+            if (verbose) {
+                printf("\t%-14s %-12s %lld\n",
+                       Obj::toAscii(EVENT),
+                       Obj::toAscii(X.source(EVENT)),
+                       after[e] - before[e]);
+            }
+            LOOP_ASSERT(e, before[e] <= after[e]);
+        }
+        ASSERT(before[Obj::BSLS_CYCLES] < after[Obj::BSLS_CYCLES]);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'read'
+        //
+        // Concerns:
+        //: 1 Reading the counters is cheap enough to bracket operations of a
+        //:   few microseconds.
+        //
+        // Plan:
+        //: 1 Read all of the counters in a loop, and time the loop.
+        //
+        // Testing:
+        //   PERFORMANCE: 'read'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: 'read'"
+                            "\n===================\n");
+
+        const int NUM_ITERATIONS = verbose ? atoi(argv[2]) : 100000;
+
+        Obj mX;  const Obj& X = mX;
+
+        for (int e = 0; e < Obj::k_NUM_EVENTS; ++e) {
+            const Obj::Event EVENT = static_cast<Obj::Event>(e);
+            printf("%-14s %s\n",
+                   Obj::toAscii(EVENT),
+                   Obj::toAscii(X.source(EVENT)));
+        }
+
+        Int64 values[Obj::k_NUM_EVENTS];
+        const Int64 t0 = TU::getTimer();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            X.read(values);
+        }
+        const Int64 t1 = TU::getTimer();
+        printf("read:          %8.2f nsec per call\n",
+               (double)(t1 - t0) / NUM_ITERATIONS);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
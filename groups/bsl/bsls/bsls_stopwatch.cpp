@@ -19,16 +19,55 @@ namespace bsls {
 const double Stopwatch::s_nanosecondsPerSecond = 1.0E9;
 
 // PRIVATE MANIPULATORS
+void Stopwatch::updateCounts()
+{
+    Types::Int64 counts[PerformanceCounters::k_NUM_EVENTS];
+    d_counters_p->read(counts);
+
+    for (int i = 0; i < PerformanceCounters::k_NUM_EVENTS; ++i) {
+        d_accumulatedCounts[i] += counts[i] - d_startCounts[i];
+    }
+}
+
 void Stopwatch::updateTimes()
 {
     Types::Int64 systemTime;
     Types::Int64 userTime;
-    TimeUtil::OpaqueNativeTime wallTime;
+    Types::Int64 wallTime;
     accumulatedTimesRaw(&systemTime, &userTime, &wallTime);
 
     d_accumulatedSystemTime += systemTime - d_startSystemTime;
     d_accumulatedUserTime   += userTime   - d_startUserTime;
-    d_accumulatedWallTime   += elapsedWallTime(wallTime);
+    d_accumulatedWallTime   += wallTime;
+}
+
+// MANIPULATORS
+void Stopwatch::startCollecting(int                        flags,
+                                const PerformanceCounters *counters)
+{
+    if (d_isRunning) {
+        return;                                                       // RETURN
+    }
+
+    d_collectCpuTimesFlag      = 0 != (flags & BSLS_COLLECT_CPU_TIMES);
+    d_collectThreadCpuTimeFlag = 0 != (flags & BSLS_COLLECT_THREAD_CPU_TIME);
+    d_counters_p               = counters;
+
+    if (d_collectCpuTimesFlag) {
+        TimeUtil::getProcessTimers(&d_startSystemTime, &d_startUserTime);
+    }
+    if (d_collectThreadCpuTimeFlag) {
+        d_startThreadCpuTime = TimeUtil::getThreadCpuTimer();
+    }
+    startWallTimer();
+
+    // Read the counters last (and, in 'stop', first), so that the other
+    // measurements contribute as few events as possible to the counts.
+
+    if (d_counters_p) {
+        d_counters_p->read(d_startCounts);
+    }
+    d_isRunning = true;
 }
 
 // ACCESSORS
@@ -39,8 +78,8 @@ void Stopwatch::accumulatedTimes(double *systemTime,
     if (d_isRunning) {
         Types::Int64 rawSystemTime;
         Types::Int64 rawUserTime;
-        TimeUtil::OpaqueNativeTime rawWallTime;
-        accumulatedTimesRaw(&rawSystemTime, &rawUserTime, &rawWallTime);
+        Types::Int64 rawElapsedTime;
+        accumulatedTimesRaw(&rawSystemTime, &rawUserTime, &rawElapsedTime);
 
         *systemTime = static_cast<double>(
                    d_accumulatedSystemTime + rawSystemTime - d_startSystemTime)
@@ -49,7 +88,7 @@ void Stopwatch::accumulatedTimes(double *systemTime,
                      d_accumulatedUserTime + rawUserTime   - d_startUserTime)
                                                       / s_nanosecondsPerSecond;
         *wallTime   = static_cast<double>(
-                     d_accumulatedWallTime + elapsedWallTime(rawWallTime))
+                     d_accumulatedWallTime + rawElapsedTime)
                                                       / s_nanosecondsPerSecond;
     }
     else {
@@ -35,6 +35,39 @@ BSLS_IDENT("$Id: $")
 // 'bsls::Stopwatch' may be slow or inconsistent on some Windows machines.  See
 // the 'Accuracy and Precision' section of 'bsls_timeutil.h'.
 //
+///Wall Timer
+///----------
+// By default, a stopwatch measures wall time with the system timer of
+// 'bsls::TimeUtil' ('getTimerRaw').  A stopwatch may instead be created to
+// measure wall time with the cycle timer of 'bsls::TimeUtil'
+// ('getCycleTimerRaw'), by passing 'bsls::Stopwatch::BSLS_CYCLE_TIMER' to its
+// constructor.  Where the processor provides an invariant time-stamp counter,
+// starting and stopping such a stopwatch is considerably cheaper, which
+// matters when many short intervals are timed; elsewhere, the cycle timer
+// falls back to the system timer.  See the "Cycle Timer" section of
+// 'bsls_timeutil.h'.  Note that the choice of wall timer does not affect the
+// measurement of system and user times.
+//
+///Thread CPU Time and Performance Counters
+///----------------------------------------
+// The system and user times collected by 'start(true)' are those of the whole
+// process, and, on UNIX platforms, have the resolution of a clock tick, which
+// makes them of little use for timing a section of code executed by one
+// thread of a multi-threaded program.  A stopwatch started by
+// 'startCollecting' may instead (or in addition) accumulate the CPU time of
+// the thread that started it ('BSLS_COLLECT_THREAD_CPU_TIME'), as reported by
+// 'bsls::TimeUtil::getThreadCpuTimer', and the counts of the events of a
+// 'bsls::PerformanceCounters' object (e.g., the instructions executed and the
+// page faults incurred by the thread).  Event counts, and instructions in
+// particular, are much more stable from run to run than elapsed times, and
+// make micro-benchmarks that report them per operation more reproducible.
+// See 'bsls_performancecounters' for the events that are counted, and how
+// they are counted on each platform.
+//
+// Note that, since both the thread CPU time and the performance counters are
+// those of the calling thread, a stopwatch collecting either of them must be
+// stopped, and accessed while RUNNING, only by the thread that started it.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate basic use of a 'bsls::Stopwatch'
@@ -68,7 +101,7 @@ BSLS_IDENT("$Id: $")
 //  const double t3u = s.accumulatedUserTime();    assert(t2u <= t3u);
 //  const double t3w = s.accumulatedWallTime();    assert(t2w <= t3w);
 //..
-// Finally, we reset the stopwatch, which both puts it into the STOPPED state
+// Next, we reset the stopwatch, which both puts it into the STOPPED state
 // and resets all accumulated times back to their initial state (i.e., 0.0):
 //..
 //  s.reset();
@@ -79,6 +112,34 @@ BSLS_IDENT("$Id: $")
 //  const double t5u = s.accumulatedUserTime();    assert(0.0 == t5u);
 //  const double t5w = s.accumulatedWallTime();    assert(0.0 == t5w);
 //..
+// Then, we create performance counters for the current thread, and restart
+// the stopwatch so as to accumulate the CPU time of this thread and the counts
+// of events:
+//..
+//  typedef bsls::PerformanceCounters Counters;
+//
+//  Counters counters;
+//
+//  s.startCollecting(bsls::Stopwatch::BSLS_COLLECT_THREAD_CPU_TIME,
+//                    &counters);
+//  // ... code to be measured
+//  s.stop();
+//..
+// Finally, we obtain the accumulated thread CPU time, and the number of
+// instructions executed, if the processor can count them:
+//..
+//  const double t6c = s.accumulatedThreadCpuTime();  assert(0.0 <= t6c);
+//
+//  if (counters.isAvailable(Counters::BSLS_INSTRUCTIONS)) {
+//      const bsls::Types::Int64 instructions =
+//                             s.accumulatedCount(Counters::BSLS_INSTRUCTIONS);
+//      assert(0 < instructions);
+//  }
+//..
+
+#ifndef INCLUDED_BSLS_PERFORMANCECOUNTERS
+#include <bsls_performancecounters.h>
+#endif
 
 #ifndef INCLUDED_BSLS_TIMEUTIL
 #include <bsls_timeutil.h>
@@ -107,8 +168,34 @@ class Stopwatch {
     // RUNNING state, a stopwatch accumulates the above values and it retains
     // the values if put into the STOPPED state (unless 'reset' is called).
     // The accumulated times can be accessed at any time and in either state
-    // (RUNNING or STOPPED).
+    // (RUNNING or STOPPED).  The source of the wall time (the system timer or
+    // the cycle timer of 'TimeUtil') is selected at construction.  A
+    // stopwatch started by 'startCollecting' may also accumulate the CPU time
+    // of the thread that started it, and the counts of the events of a
+    // 'PerformanceCounters' object.
+
+  public:
+    // TYPES
+    enum WallTimer {
+        // Enumerate the timers from which a stopwatch can measure wall time.
+
+        BSLS_SYSTEM_TIMER,  // 'TimeUtil::getTimerRaw' (default)
+        BSLS_CYCLE_TIMER    // 'TimeUtil::getCycleTimerRaw'
+    };
+
+    enum CollectFlags {
+        // Enumerate the measurements, in addition to wall time, that a
+        // stopwatch started by 'startCollecting' can accumulate.  Flags may
+        // be combined using bitwise OR.
+
+        BSLS_COLLECT_CPU_TIMES       = 1 << 0,  // process system and user
+                                                // times (as 'start(true)')
 
+        BSLS_COLLECT_THREAD_CPU_TIME = 1 << 1   // CPU time of the thread
+                                                // that starts the stopwatch
+    };
+
+  private:
     // DATA
     Types::Int64 d_startSystemTime;        // system time when
                                            // started (nanoseconds)
@@ -120,6 +207,10 @@ class Stopwatch {
                                            // wall time when
                                            // started (nanoseconds)
 
+    TimeUtil::OpaqueCycleTime d_startCycleTime;
+                                           // cycle time when started,
+                                           // if 'BSLS_CYCLE_TIMER'
+
     Types::Int64 d_accumulatedSystemTime;  // accumulated system
                                            // time (nanoseconds)
 
@@ -129,12 +220,37 @@ class Stopwatch {
     Types::Int64 d_accumulatedWallTime;    // accumulated wall time
                                            // (nanoseconds)
 
+    Types::Int64 d_startThreadCpuTime;     // thread CPU time when
+                                           // started (nanoseconds)
+
+    Types::Int64 d_accumulatedThreadCpuTime;
+                                           // accumulated thread CPU
+                                           // time (nanoseconds)
+
+    Types::Int64 d_startCounts[PerformanceCounters::k_NUM_EVENTS];
+                                           // event counts when started
+
+    Types::Int64 d_accumulatedCounts[PerformanceCounters::k_NUM_EVENTS];
+                                           // accumulated event counts
+
+    const PerformanceCounters *d_counters_p;
+                                           // counters of events being
+                                           // collected (held, not
+                                           // owned), or 0 if none
+
     bool         d_isRunning;              // state flag ('true' if
                                            // RUNNING, 'false' if STOPPED)
 
     bool         d_collectCpuTimesFlag;    // 'true' if cpu times
                                            // are being collected
 
+    bool         d_collectThreadCpuTimeFlag;
+                                           // 'true' if thread CPU
+                                           // time is being collected
+
+    WallTimer    d_wallTimer;              // timer measuring wall
+                                           // time
+
     // CLASS DATA
     static const double      s_nanosecondsPerSecond;   // conversion factor
                                                        // (for nanoseconds to
@@ -147,26 +263,44 @@ class Stopwatch {
 
   private:
     // PRIVATE MANIPULATORS
+    void startWallTimer();
+        // Record the current value of the wall timer of this stopwatch as the
+        // start of the wall-time interval being measured.
+
+    void updateCounts();
+        // Update the event counts accumulated by this stopwatch.
+
     void updateTimes();
         // Update the CPU times accumulated but this stopwatch.
 
     // PRIVATE ACCESSORS
-    void accumulatedTimesRaw(Types::Int64               *systemTime,
-                             Types::Int64               *userTime,
-                             TimeUtil::OpaqueNativeTime *wallTime) const;
-        // Load into the specified 'systemTime', 'userTime', and 'wallTime' the
-        // values of the system time, user time, and wall time (in
-        // nanoseconds), respectively, as provided by 'TimeUtil'.
-
-    Types::Int64 elapsedWallTime(TimeUtil::OpaqueNativeTime rawWallTime) const;
-        // Return the elapsed time, in nanoseconds, between the current
-        // 'd_startWallTime' and the specified 'rawWallTime'.
+    void accumulatedTimesRaw(Types::Int64 *systemTime,
+                             Types::Int64 *userTime,
+                             Types::Int64 *wallTime) const;
+        // Load into the specified 'systemTime' and 'userTime' the values of
+        // the system time and user time (in nanoseconds), respectively, as
+        // provided by 'TimeUtil', and load into the specified 'wallTime' the
+        // wall time elapsed (in nanoseconds) since the wall timer of this
+        // stopwatch was last started.
+
+    Types::Int64 elapsedWallTime() const;
+        // Return the elapsed time, in nanoseconds, between the last start of
+        // the wall timer of this stopwatch and the current time.
 
   public:
     // CREATORS
     Stopwatch();
         // Create a stopwatch in the STOPPED state having total accumulated
-        // system, user, and wall times all equal to 0.0.
+        // system, user, and wall times all equal to 0.0, and measuring wall
+        // time with the system timer of 'TimeUtil'.
+
+    explicit Stopwatch(WallTimer wallTimer);
+        // Create a stopwatch in the STOPPED state having total accumulated
+        // system, user, and wall times all equal to 0.0, and measuring wall
+        // time with the specified 'wallTimer'.  Note that if 'wallTimer' is
+        // 'BSLS_CYCLE_TIMER', the cycle timer of 'TimeUtil' is calibrated (if
+        // it has not been already) by this constructor, so that the
+        // calibration does not contribute to any measurement.
 
     //! ~Stopwatch();
         // Destroy this stopwatch.  Note that this method's definition is
@@ -186,7 +320,22 @@ class Stopwatch {
         // are *not* collected.  Note that the instantaneous total elapsed
         // times are available from the RUNNING state.  Also note that
         // disabling collection of CPU times will result in fewer systems calls
-        // and faster measurements.
+        // and faster measurements.  Also note that neither the thread CPU time
+        // nor event counts are collected while a stopwatch started by this
+        // method is RUNNING.
+
+    void startCollecting(int                        flags,
+                         const PerformanceCounters *counters = 0);
+        // Place this stopwatch in the RUNNING state and begin accumulating
+        // wall time, and the measurements selected by the specified 'flags',
+        // if this object was in the STOPPED state.  'flags' is a bitwise OR of
+        // 'CollectFlags' values, or 0.  Optionally specify 'counters' whose
+        // event counts are to be accumulated.  If 'counters' is not specified,
+        // event counts are *not* collected.  The behavior is undefined unless
+        // 'counters', if specified, was created by the calling thread and
+        // remains valid while this stopwatch is RUNNING.  Note that
+        // 'startCollecting(BSLS_COLLECT_CPU_TIMES)' is equivalent to
+        // 'start(true)', and 'startCollecting(0)' to 'start()'.
 
     void stop();
         // Place this stopwatch in the STOPPED state, unconditionally stopping
@@ -194,6 +343,13 @@ class Stopwatch {
         // accumulated elapsed times are available while in the STOPPED state.
 
     // ACCESSORS
+    Types::Int64 accumulatedCount(PerformanceCounters::Event event) const;
+        // Return the total (instantaneous and quiescent) count of the
+        // specified 'event' accumulated by this stopwatch, or 0 if the
+        // collection of event counts is disabled.  Note that 0 is also
+        // returned if 'event' is not available from the counters being
+        // collected.
+
     double accumulatedSystemTime() const;
         // Return the total (instantaneous and quiescent) elapsed system time
         // (in seconds) accumulated by this stopwatch, or 0 if the collection
@@ -208,6 +364,12 @@ class Stopwatch {
         // this method attempts to retrieve all of the values at the same time
         // (atomically), if the underlying platform supports it.
 
+    double accumulatedThreadCpuTime() const;
+        // Return the total (instantaneous and quiescent) elapsed CPU time (in
+        // seconds) of the thread that started this stopwatch accumulated by
+        // this stopwatch, or 0 if the collection of thread CPU time is
+        // disabled.
+
     double accumulatedUserTime() const;
         // Return the total (instantaneous and quiescent) elapsed user time (in
         // seconds) accumulated by this stopwatch, or 0 if the collection of
@@ -225,6 +387,9 @@ class Stopwatch {
     bool isRunning() const;
         // Return 'true' if this stopwatch is in the RUNNING state, and 'false'
         // otherwise.
+
+    WallTimer wallTimer() const;
+        // Return the timer with which this stopwatch measures wall time.
 };
 
 // ============================================================================
@@ -235,37 +400,84 @@ class Stopwatch {
                             // class Stopwatch
                             // ---------------
 
+// PRIVATE MANIPULATORS
+inline
+void Stopwatch::startWallTimer()
+{
+    if (BSLS_CYCLE_TIMER == d_wallTimer) {
+        TimeUtil::getCycleTimerRaw(&d_startCycleTime);
+    }
+    else {
+        TimeUtil::getTimerRaw(&d_startWallTime);
+    }
+}
+
 // PRIVATE ACCESSORS
 inline
-void Stopwatch::accumulatedTimesRaw(Types::Int64               *systemTime,
-                                    Types::Int64               *userTime,
-                                    TimeUtil::OpaqueNativeTime *wallTime) const
+void Stopwatch::accumulatedTimesRaw(Types::Int64 *systemTime,
+                                    Types::Int64 *userTime,
+                                    Types::Int64 *wallTime) const
 {
     TimeUtil::getProcessTimers(systemTime, userTime);
-    TimeUtil::getTimerRaw(wallTime);
+    *wallTime = elapsedWallTime();
 }
 
 inline
-Types::Int64 Stopwatch::elapsedWallTime(
-                                  TimeUtil::OpaqueNativeTime rawWallTime) const
+Types::Int64 Stopwatch::elapsedWallTime() const
 {
-    return TimeUtil::convertRawTime(rawWallTime)
+    if (BSLS_CYCLE_TIMER == d_wallTimer) {
+        TimeUtil::OpaqueCycleTime now;
+        TimeUtil::getCycleTimerRaw(&now);
+        return TimeUtil::convertRawTime(now)
+             - TimeUtil::convertRawTime(d_startCycleTime);            // RETURN
+    }
+
+    TimeUtil::OpaqueNativeTime now;
+    TimeUtil::getTimerRaw(&now);
+    return TimeUtil::convertRawTime(now)
          - TimeUtil::convertRawTime(d_startWallTime);
 }
 
-
 // CREATORS
 inline
 Stopwatch::Stopwatch()
 : d_accumulatedSystemTime(0)
 , d_accumulatedUserTime(0)
 , d_accumulatedWallTime(0)
+, d_accumulatedThreadCpuTime(0)
+, d_counters_p(0)
 , d_isRunning(false)
 , d_collectCpuTimesFlag(false)
+, d_collectThreadCpuTimeFlag(false)
+, d_wallTimer(BSLS_SYSTEM_TIMER)
 {
+    for (int i = 0; i < PerformanceCounters::k_NUM_EVENTS; ++i) {
+        d_accumulatedCounts[i] = 0;
+    }
     TimeUtil::initialize();
 }
 
+inline
+Stopwatch::Stopwatch(WallTimer wallTimer)
+: d_accumulatedSystemTime(0)
+, d_accumulatedUserTime(0)
+, d_accumulatedWallTime(0)
+, d_accumulatedThreadCpuTime(0)
+, d_counters_p(0)
+, d_isRunning(false)
+, d_collectCpuTimesFlag(false)
+, d_collectThreadCpuTimeFlag(false)
+, d_wallTimer(wallTimer)
+{
+    for (int i = 0; i < PerformanceCounters::k_NUM_EVENTS; ++i) {
+        d_accumulatedCounts[i] = 0;
+    }
+    TimeUtil::initialize();
+    if (BSLS_CYCLE_TIMER == d_wallTimer) {
+        TimeUtil::initializeCycleTimer();
+    }
+}
+
 // MANIPULATORS
 inline
 void Stopwatch::reset()
@@ -274,21 +486,24 @@ void Stopwatch::reset()
     d_accumulatedSystemTime = 0;
     d_accumulatedUserTime   = 0;
     d_accumulatedWallTime   = 0;
+
+    d_accumulatedThreadCpuTime = 0;
+    for (int i = 0; i < PerformanceCounters::k_NUM_EVENTS; ++i) {
+        d_accumulatedCounts[i] = 0;
+    }
 }
 
 inline
 void Stopwatch::start(bool collectCpuTimes)
 {
     if (!d_isRunning) {
-        d_collectCpuTimesFlag = collectCpuTimes;
+        d_collectCpuTimesFlag      = collectCpuTimes;
+        d_collectThreadCpuTimeFlag = false;
+        d_counters_p               = 0;
         if (d_collectCpuTimesFlag) {
-            accumulatedTimesRaw(&d_startSystemTime,
-                                &d_startUserTime,
-                                &d_startWallTime);
-        }
-        else {
-            TimeUtil::getTimerRaw(&d_startWallTime);
+            TimeUtil::getProcessTimers(&d_startSystemTime, &d_startUserTime);
         }
+        startWallTimer();
         d_isRunning = true;
     }
 }
@@ -297,18 +512,38 @@ inline
 void Stopwatch::stop()
 {
     if (d_isRunning) {
+        if (d_counters_p) {
+            updateCounts();
+        }
         if (d_collectCpuTimesFlag) {
             updateTimes();
         }
         else {
-            TimeUtil::OpaqueNativeTime now;
-            TimeUtil::getTimerRaw(&now);
-            d_accumulatedWallTime += elapsedWallTime(now);
+            d_accumulatedWallTime += elapsedWallTime();
+        }
+        if (d_collectThreadCpuTimeFlag) {
+            d_accumulatedThreadCpuTime += TimeUtil::getThreadCpuTimer()
+                                        - d_startThreadCpuTime;
         }
         d_isRunning = false;
     }
 }
 
+inline
+Types::Int64
+Stopwatch::accumulatedCount(PerformanceCounters::Event event) const
+{
+    if (!d_counters_p) {
+        return 0;                                                     // RETURN
+    }
+
+    if (d_isRunning) {
+        return d_accumulatedCounts[event]
+             + d_counters_p->read(event) - d_startCounts[event];      // RETURN
+    }
+    return d_accumulatedCounts[event];
+}
+
 // ACCESSORS
 inline
 double Stopwatch::accumulatedSystemTime() const
@@ -326,6 +561,22 @@ double Stopwatch::accumulatedSystemTime() const
     return (double)d_accumulatedSystemTime / s_nanosecondsPerSecond;
 }
 
+inline
+double Stopwatch::accumulatedThreadCpuTime() const
+{
+    if (!d_collectThreadCpuTimeFlag) {
+        return 0.0;                                                   // RETURN
+    }
+
+    if (d_isRunning) {
+        return (double)(d_accumulatedThreadCpuTime
+                      + TimeUtil::getThreadCpuTimer() - d_startThreadCpuTime)
+                                                      / s_nanosecondsPerSecond;
+                                                                      // RETURN
+    }
+    return (double)d_accumulatedThreadCpuTime / s_nanosecondsPerSecond;
+}
+
 inline
 double Stopwatch::accumulatedUserTime() const
 {
@@ -346,9 +597,7 @@ inline
 double Stopwatch::accumulatedWallTime() const
 {
     if (d_isRunning) {
-        TimeUtil::OpaqueNativeTime now;
-        TimeUtil::getTimerRaw(&now);
-        return (double)(d_accumulatedWallTime + elapsedWallTime(now))
+        return (double)(d_accumulatedWallTime + elapsedWallTime())
                                                       / s_nanosecondsPerSecond;
                                                                       // RETURN
     }
@@ -367,6 +616,12 @@ bool Stopwatch::isRunning() const
     return d_isRunning;
 }
 
+inline
+Stopwatch::WallTimer Stopwatch::wallTimer() const
+{
+    return d_wallTimer;
+}
+
 }  // close package namespace
 
 
@@ -2,6 +2,7 @@
 #include <bsls_stopwatch.h>
 
 #include <bsls_bsltestutil.h>
+#include <bsls_performancecounters.h>
 #include <bsls_platform.h>
 #include <bsls_timeutil.h>   // getTimer() (used in delay generation)
 
@@ -33,20 +34,25 @@ using namespace BloombergLP;
 // behavior.
 //-----------------------------------------------------------------------------
 // [ 2] bsls::Stopwatch();
+// [ 7] explicit bsls::Stopwatch(WallTimer wallTimer);
 // [ 2] ~bsls::Stopwatch();
 // [ 3] void start();
+// [ 8] void startCollecting(int flags, const PerformanceCounters *counters);
 // [ 3] void stop();
 // [ 3] void reset();
 // [ 2] bool isRunning() const;
+// [ 8] Types::Int64 accumulatedCount(PerformanceCounters::Event) const;
 // [ 4] double accumulatedSystemTime() const;
 // [ 4] double accumulatedUserTime() const;
 // [ 4] double accumulatedWallTime() const;
 // [ 5] void accumulatedTimes(double*, double*, double*) const;
+// [ 8] double accumulatedThreadCpuTime() const;
 // [ 4] double elapsedTime() const;
+// [ 7] WallTimer wallTimer() const;
 //-----------------------------------------------------------------------------
 // [ 1] Breathing Test
 // [ 2] State Transitions
-// [ 7] USAGE Example
+// [ 9] USAGE Example
 // [ 6] Reproduce bug from test case 
 //-----------------------------------------------------------------------------
 
@@ -211,6 +217,16 @@ static inline Int64 delaySystem(double delayTime)
     return delay(delayTime, &TU::getProcessSystemTimer, &osSystemCall);
 }
 
+static void sleepOneSecond()
+    // Suspend the calling thread for one second.
+{
+#if defined BSLS_PLATFORM_OS_UNIX
+    sleep(1);
+#elif defined BSLS_PLATFORM_OS_WINDOWS
+    ::Sleep(1000);
+#endif
+}
+
 // ============================================================================
 //                            MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -249,7 +265,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 9: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -294,6 +310,378 @@ int main(int argc, char *argv[])
         const double t5s = s.accumulatedSystemTime();  ASSERT(0.0 == t5s);
         const double t5u = s.accumulatedUserTime();    ASSERT(0.0 == t5u);
         const double t5w = s.accumulatedWallTime();    ASSERT(0.0 == t5w);
+
+        typedef bsls::PerformanceCounters Counters;
+
+        Counters counters;
+
+        s.startCollecting(bsls::Stopwatch::BSLS_COLLECT_THREAD_CPU_TIME,
+                          &counters);
+        // ... code to be measured
+        s.stop();
+
+        const double t6c = s.accumulatedThreadCpuTime();  ASSERT(0.0 <= t6c);
+
+        if (counters.isAvailable(Counters::BSLS_INSTRUCTIONS)) {
+            const bsls::Types::Int64 instructions =
+                               s.accumulatedCount(Counters::BSLS_INSTRUCTIONS);
+            ASSERT(0 < instructions);
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD CPU TIME AND PERFORMANCE COUNTERS
+        //
+        // Concerns:
+        //: 1 A stopwatch reports a thread CPU time and event counts of 0
+        //:   unless, and until, it is started by 'startCollecting' with the
+        //:   corresponding flag or counters.
+        //:
+        //: 2 The thread CPU time accumulates while the thread is busy, no
+        //:   faster than the wall time, and (almost) not while the thread
+        //:   sleeps.
+        //:
+        //: 3 Event counts accumulate over several runs, are available while
+        //:   RUNNING, do not change while STOPPED, and are 0 for events that
+        //:   are not available.
+        //:
+        //: 4 'BSLS_COLLECT_CPU_TIMES' collects process CPU times as
+        //:   'start(true)' does, and 'start' disables the collection of the
+        //:   thread CPU time and of event counts.
+        //:
+        //: 5 'startCollecting' has no effect on a RUNNING stopwatch.
+        //:
+        //: 6 'reset' sets the thread CPU time and the event counts to 0.
+        //
+        // Plan:
+        //: 1 Verify the thread CPU time and the event counts of a stopwatch
+        //:   after creation, and after runs started by 'start' and by
+        //:   'startCollecting' without flags or counters.  (C-1)
+        //:
+        //: 2 Collect the thread CPU time around a busy wait, and around a
+        //:   one-second sleep, and compare it with the wall time.  (C-2)
+        //:
+        //: 3 Collect the counts of 'bsls::PerformanceCounters' over several
+        //:   runs each consuming CPU time, and verify 'BSLS_CYCLES' (which is
+        //:   available on every platform) while RUNNING and STOPPED, and that
+        //:   unavailable events report 0.  (C-3)
+        //:
+        //: 4 Start a stopwatch with 'BSLS_COLLECT_CPU_TIMES' around a
+        //:   user-time delay and verify the user time; then restart it with
+        //:   'start' and verify that the thread CPU time and the counts are
+        //:   reported as 0.  (C-4)
+        //:
+        //: 5 Call 'startCollecting' on a RUNNING stopwatch, and verify that
+        //:   the measurements collected are unchanged.  (C-5)
+        //:
+        //: 6 Reset a stopwatch that collected all measurements, and verify
+        //:   that they are reported as 0.  (C-6)
+        //
+        // Testing:
+        //   void startCollecting(int flags, const PerformanceCounters *);
+        //   Types::Int64 accumulatedCount(PerformanceCounters::Event) const;
+        //   double accumulatedThreadCpuTime() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\nTESTING THREAD CPU TIME AND PERFORMANCE COUNTERS"
+                          "\n================================================"
+                          "\n");
+
+        typedef bsls::PerformanceCounters Counters;
+
+        const double delayTime = 0.1;   // seconds
+        const double precision = 0.01;  // seconds
+
+        Counters counters;
+
+        if (verbose) printf("\nTesting default collection.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0.0 == X.accumulatedThreadCpuTime());
+
+            mX.start(true);
+            delayWall(precision);
+            ASSERT(0.0 == X.accumulatedThreadCpuTime());
+            mX.stop();
+
+            mX.startCollecting(0);
+            delayWall(precision);
+            ASSERT(0.0 == X.accumulatedThreadCpuTime());
+            ASSERT(0.0 == X.accumulatedSystemTime());
+            ASSERT(0.0 == X.accumulatedUserTime());
+            mX.stop();
+
+            ASSERT(0.0 == X.accumulatedThreadCpuTime());
+            ASSERT(0.0 <  X.accumulatedWallTime());
+            for (int e = 0; e < Counters::k_NUM_EVENTS; ++e) {
+                const Counters::Event EVENT = static_cast<Counters::Event>(e);
+                LOOP_ASSERT(e, 0 == X.accumulatedCount(EVENT));
+            }
+        }
+
+        if (verbose) printf("\nTesting thread CPU time.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            mX.startCollecting(Obj::BSLS_COLLECT_THREAD_CPU_TIME);
+            delayWall(delayTime);
+
+            const double ct1 = X.accumulatedThreadCpuTime();
+            ASSERT(0.0 < ct1);
+
+            mX.stop();
+
+            const double ct2 = X.accumulatedThreadCpuTime();
+            const double wt2 = X.accumulatedWallTime();
+
+            if (veryVerbose) { T_ P_(ct1) P_(ct2) P(wt2) }
+
+            ASSERT(ct1 <= ct2);
+            ASSERT(ct2 <= wt2 + precision);
+            ASSERT(0.0 == X.accumulatedSystemTime());
+            ASSERT(0.0 == X.accumulatedUserTime());
+
+            mX.startCollecting(Obj::BSLS_COLLECT_THREAD_CPU_TIME);
+            sleepOneSecond();
+            mX.stop();
+
+            const double ct3 = X.accumulatedThreadCpuTime();
+            const double wt3 = X.accumulatedWallTime();
+
+            if (veryVerbose) { T_ P_(ct3) P(wt3) }
+
+            ASSERT(ct2 <= ct3);
+            ASSERT(ct3 - ct2 < 5 * precision);
+            ASSERT(wt2 + 1.0 - precision <= wt3);
+        }
+
+        if (verbose) printf("\nTesting performance counters.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            Int64 previous = 0;
+            for (int i = 0; i < 3; ++i) {
+                mX.startCollecting(0, &counters);
+                delayWall(precision);
+
+                const Int64 running =
+                                     X.accumulatedCount(Counters::BSLS_CYCLES);
+                LOOP3_ASSERT(i, previous, running, previous < running);
+
+                mX.stop();
+
+                const Int64 stopped =
+                                     X.accumulatedCount(Counters::BSLS_CYCLES);
+                LOOP3_ASSERT(i, running, stopped, running <= stopped);
+
+                delayWall(precision);
+                LOOP_ASSERT(i,
+                         stopped == X.accumulatedCount(Counters::BSLS_CYCLES));
+
+                if (veryVerbose) { T_ P_(i) P(stopped) }
+
+                previous = stopped;
+            }
+
+            for (int e = 0; e < Counters::k_NUM_EVENTS; ++e) {
+                const Counters::Event EVENT = static_cast<Counters::Event>(e);
+
+                if (veryVerbose) {
+                    printf("\t%-14s %-12s %lld\n",
+                           Counters::toAscii(EVENT),
+                           Counters::toAscii(counters.source(EVENT)),
+                           X.accumulatedCount(EVENT));
+                }
+
+                if (!counters.isAvailable(EVENT)) {
+                    LOOP_ASSERT(e, 0 == X.accumulatedCount(EVENT));
+                }
+                else {
+                    LOOP_ASSERT(e, 0 <= X.accumulatedCount(EVENT));
+                }
+            }
+            ASSERT(0.0 == X.accumulatedThreadCpuTime());
+        }
+
+        if (verbose) printf("\nTesting 'BSLS_COLLECT_CPU_TIMES'.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            mX.startCollecting(Obj::BSLS_COLLECT_CPU_TIMES
+                             | Obj::BSLS_COLLECT_THREAD_CPU_TIME,
+                               &counters);
+            delayUser(delayTime);
+            mX.stop();
+
+            const double ut = X.accumulatedUserTime();
+            const double ct = X.accumulatedThreadCpuTime();
+
+            if (veryVerbose) { T_ P_(ut) P(ct) }
+
+            ASSERT(delayTime <= ut);
+            ASSERT(0.0 <= X.accumulatedSystemTime());
+            ASSERT(0.0 <  ct);
+            ASSERT(0   <  X.accumulatedCount(Counters::BSLS_CYCLES));
+
+            mX.start();
+            ASSERT(0.0 == X.accumulatedThreadCpuTime());
+            ASSERT(0   == X.accumulatedCount(Counters::BSLS_CYCLES));
+            mX.stop();
+        }
+
+        if (verbose) printf("\nTesting 'startCollecting' while running.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            mX.start();
+            mX.startCollecting(Obj::BSLS_COLLECT_THREAD_CPU_TIME, &counters);
+            delayWall(precision);
+            ASSERT(true == X.isRunning());
+            ASSERT(0.0  == X.accumulatedThreadCpuTime());
+            ASSERT(0    == X.accumulatedCount(Counters::BSLS_CYCLES));
+            mX.stop();
+        }
+
+        if (verbose) printf("\nTesting 'reset'.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            mX.startCollecting(Obj::BSLS_COLLECT_THREAD_CPU_TIME, &counters);
+            delayWall(precision);
+            mX.stop();
+            ASSERT(0.0 < X.accumulatedThreadCpuTime());
+            ASSERT(0   < X.accumulatedCount(Counters::BSLS_CYCLES));
+
+            mX.reset();
+            ASSERT(false == X.isRunning());
+            ASSERT(0.0   == X.accumulatedThreadCpuTime());
+            ASSERT(0.0   == X.accumulatedWallTime());
+            for (int e = 0; e < Counters::k_NUM_EVENTS; ++e) {
+                const Counters::Event EVENT = static_cast<Counters::Event>(e);
+                LOOP_ASSERT(e, 0 == X.accumulatedCount(EVENT));
+            }
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING WALL TIMER SELECTION
+        //
+        // Concerns:
+        //: 1 A default-constructed stopwatch measures wall time with the
+        //:   system timer.
+        //:
+        //: 2 A stopwatch created with 'BSLS_CYCLE_TIMER' reports that timer,
+        //:   and is created in the STOPPED state with all times equal to 0.
+        //:
+        //: 3 Wall time accumulated with the cycle timer over several runs
+        //:   agrees with the elapsed time measured with 'TimeUtil::getTimer'.
+        //:
+        //: 4 The collection of CPU times, 'accumulatedTimes', and 'reset'
+        //:   are unaffected by the choice of wall timer.
+        //
+        // Plan:
+        //: 1 Create stopwatches with the default constructor and with each
+        //:   enumerator, and verify 'wallTimer' and the initial state.
+        //:   (C-1..2)
+        //:
+        //: 2 Start and stop a cycle-timer stopwatch around several delays
+        //:   measured with 'TimeUtil::getTimer', and compare the accumulated
+        //:   wall time with the sum of the delays.  (C-3)
+        //:
+        //: 3 Start a cycle-timer stopwatch collecting CPU times around a
+        //:   user-time delay, and verify the values loaded by
+        //:   'accumulatedTimes' while running, after 'stop', and after
+        //:   'reset'.  (C-4)
+        //
+        // Testing:
+        //   explicit bsls::Stopwatch(WallTimer wallTimer);
+        //   WallTimer wallTimer() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING WALL TIMER SELECTION"
+                            "\n============================\n");
+
+        if (verbose) printf("\nTesting 'wallTimer' and initial state.\n");
+        {
+            const Obj X;
+            ASSERT(Obj::BSLS_SYSTEM_TIMER == X.wallTimer());
+
+            const Obj Y(Obj::BSLS_SYSTEM_TIMER);
+            ASSERT(Obj::BSLS_SYSTEM_TIMER == Y.wallTimer());
+
+            const Obj Z(Obj::BSLS_CYCLE_TIMER);
+            ASSERT(Obj::BSLS_CYCLE_TIMER == Z.wallTimer());
+            ASSERT(false == Z.isRunning());
+            ASSERT(0.0   == Z.accumulatedSystemTime());
+            ASSERT(0.0   == Z.accumulatedUserTime());
+            ASSERT(0.0   == Z.accumulatedWallTime());
+
+            if (verbose) {
+                const bool usesCounter = TU::cycleTimerUsesCounter();
+                P(usesCounter);
+            }
+        }
+
+        const double delayTime = 0.1;   // seconds
+        const double precision = 0.01;  // seconds
+
+        if (verbose) printf("\nTesting accumulation of wall time.\n");
+        {
+            Obj mX(Obj::BSLS_CYCLE_TIMER);  const Obj& X = mX;
+
+            Int64 expected = 0;
+            for (int i = 0; i < 3; ++i) {
+                mX.start();
+                ASSERT(true == X.isRunning());
+                expected += delayWall(delayTime);
+                mX.stop();
+                ASSERT(false == X.isRunning());
+
+                const double wt       = X.accumulatedWallTime();
+                const double expectWt = (double)expected * 1.0e-9;
+
+                if (veryVerbose) { T_ P_(i) P_(wt) P(expectWt) }
+
+                LOOP3_ASSERT(i, wt, expectWt, wt >= expectWt - precision);
+                LOOP3_ASSERT(i, wt, expectWt, wt <= expectWt + precision);
+                LOOP2_ASSERT(i, wt, 0.0 == X.accumulatedSystemTime());
+                LOOP2_ASSERT(i, wt, 0.0 == X.accumulatedUserTime());
+            }
+        }
+
+        if (verbose) printf("\nTesting CPU times with the cycle timer.\n");
+        {
+            Obj mX(Obj::BSLS_CYCLE_TIMER);  const Obj& X = mX;
+
+            mX.start(true);
+            delayUser(delayTime);
+
+            double st1, ut1, wt1;
+            X.accumulatedTimes(&st1, &ut1, &wt1);
+
+            if (veryVerbose) { T_ P_(st1) P_(ut1) P(wt1) }
+
+            ASSERT(0.0 <= st1);
+            ASSERT(delayTime <= ut1);
+            ASSERT(ut1 + st1 <= wt1 + precision);
+
+            mX.stop();
+
+            double st2, ut2, wt2;
+            X.accumulatedTimes(&st2, &ut2, &wt2);
+            ASSERT(st1 <= st2);
+            ASSERT(ut1 <= ut2);
+            ASSERT(wt1 <= wt2);
+            ASSERT(wt2 == X.accumulatedWallTime());
+
+            mX.reset();
+            X.accumulatedTimes(&st2, &ut2, &wt2);
+            ASSERT(0.0 == st2);
+            ASSERT(0.0 == ut2);
+            ASSERT(0.0 == wt2);
+            ASSERT(Obj::BSLS_CYCLE_TIMER == X.wallTimer());
+        }
       } break;
       case 6: {
         // --------------------------------------------------------------------
@@ -777,9 +1165,12 @@ int main(int argc, char *argv[])
         //       started with the (more expensive) 'start(true)' method and
         //       calling 'accumulatedTimes(double *, double *, double *)'.
         //
+        //   2c) As (2a), but with the instrumenting stopwatch measuring wall
+        //       time with the cycle timer ('BSLS_CYCLE_TIMER').
+        //
         //   3)  Subtract the result obtained in (1) from each of the results
-        //       obtained in (2a) and (2b), and normalize by the number of
-        //       loop iterations to obtain the per-loop cost of the
+        //       obtained in (2a), (2b), and (2c), and normalize by the number
+        //       of loop iterations to obtain the per-loop cost of the
         //       instrumentation.
         //
         //   NOTE: Because the OS can suspend the loops at any point, the above
@@ -847,6 +1238,25 @@ int main(int argc, char *argv[])
                                      "\t  + Net cost per loop iteration is ",
                                      " nsec\n");
         }
+        {
+            if (verbose) printf("\tProfiling use of start()/stop()/"
+                                "elapsedTime() with the cycle timer:\n");
+            bsls::Stopwatch watch;
+            watch.start();
+            for (int i = 0; i < numTrials; ++i) {
+                bsls::Stopwatch w(bsls::Stopwatch::BSLS_CYCLE_TIMER);
+                w.start();
+                busyFunction();
+                w.stop();
+                double d = w.elapsedTime();
+            }
+            watch.stop();
+            const double testTime = watch.elapsedTime();
+            if (verbose) bsls::BslTestUtil::callDebugprint(
+                                     (testTime - baselineTime) * toNanoseconds,
+                                     "\t  + Net cost per loop iteration is ",
+                                     " nsec\n");
+        }
       } break;
       case -2: {
         // --------------------------------------------------------------------
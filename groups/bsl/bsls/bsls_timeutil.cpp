@@ -16,6 +16,7 @@ BSLS_IDENT("$Id$ $CSID$")
 #elif defined BSLS_PLATFORM_OS_WINDOWS
     #include <windows.h>
     #include <winbase.h>   // QueryPerformanceCounter(), GetProcessTimes()
+                           // GetThreadTimes()
     #include <sys/timeb.h> // ftime(struct timeb *)
 #else
     #error "Don't know how to get nanosecond time for this platform"
@@ -27,6 +28,18 @@ BSLS_IDENT("$Id$ $CSID$")
     #include <sys/time.h>  // gettimeofday()
 #endif
 
+#if defined BSLS_PLATFORM_OS_UNIX
+    #include <sched.h>     // sched_yield()
+#endif
+
+#if defined(BSLS_TIMEUTIL_CYCLE_TIMER_TSC)
+    #if defined(BSLS_PLATFORM_CMP_MSVC)
+        #include <intrin.h>    // __cpuid()
+    #else
+        #include <cpuid.h>     // __get_cpuid()
+    #endif
+#endif
+
 namespace BloombergLP {
 
 namespace {
@@ -65,6 +78,12 @@ struct UnixTimerUtil {
         // Return converted to nanoseconds current values of system and user
         // times as returned by times() if the call succeeds, and zero values
         // otherwise
+
+    static bsls::Types::Int64 threadTimer();
+        // Return converted to nanoseconds current value of the CPU time
+        // consumed by the calling thread as returned by
+        // clock_gettime(CLOCK_THREAD_CPUTIME_ID) if the call succeeds, and
+        // the sum of the process system and user times otherwise.
 };
 
 bsls::AtomicOperations::AtomicTypes::Int64
@@ -138,6 +157,24 @@ void UnixTimerUtil::processTimers(bsls::Types::Int64 *systemTimer,
     *userTimer   = static_cast<bsls::Types::Int64>(uTimer)
                    * s_nsecsPerSecond / ticksPerSecond;
 }
+
+inline
+bsls::Types::Int64 UnixTimerUtil::threadTimer()
+{
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+    timespec threadTime;
+    if (0 == ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &threadTime)) {
+        return static_cast<bsls::Types::Int64>(threadTime.tv_sec)
+                                                            * s_nsecsPerSecond
+             + threadTime.tv_nsec;                                    // RETURN
+    }
+#endif
+
+    bsls::Types::Int64 sTimer, uTimer;
+    processTimers(&sTimer, &uTimer);
+
+    return sTimer + uTimer;
+}
 #endif
 
 #ifdef BSLS_PLATFORM_OS_WINDOWS
@@ -206,6 +243,11 @@ struct WindowsTimerUtil {
         // user times as returned by GetProcessTimes() if the call succeeds,
         // and zero otherwise.
 
+    static bsls::Types::Int64 threadTimer();
+        // Return converted to nanoseconds current value of the sum of kernel
+        // (system) and user times of the calling thread as returned by
+        // GetThreadTimes() if the call succeeds, and zero otherwise.
+
     static bsls::Types::Int64 wallTimer();
         // Return converted to nanoseconds current value of wall time as per
         // Windows hardware timer, if available, uses ::ftime otherwise.
@@ -329,6 +371,29 @@ void WindowsTimerUtil::processTimers(bsls::Types::Int64 *systemTimer,
                                                               * s_nsecsPerUnit;
 }
 
+inline
+bsls::Types::Int64 WindowsTimerUtil::threadTimer()
+{
+    FILETIME crtnTm, exitTm, krnlTm, userTm;
+
+    if (!::GetThreadTimes(::GetCurrentThread(),
+                          &crtnTm,
+                          &exitTm,
+                          &krnlTm,
+                          &userTm)) {
+        return 0;                                                     // RETURN
+    }
+
+    ULARGE_INTEGER sTimer, uTimer;
+    sTimer.LowPart  = krnlTm.dwLowDateTime;
+    sTimer.HighPart = krnlTm.dwHighDateTime;
+    uTimer.LowPart  = userTm.dwLowDateTime;
+    uTimer.HighPart = userTm.dwHighDateTime;
+
+    return static_cast<bsls::Types::Int64>(sTimer.QuadPart + uTimer.QuadPart)
+                                                              * s_nsecsPerUnit;
+}
+
 inline
 bsls::Types::Int64 WindowsTimerUtil::wallTimer()
 {
@@ -449,15 +514,329 @@ bsls::Types::Int64 WindowsTimerUtil::getTimerRaw()
 
 #endif
 
+struct CycleTimerUtil {
+    // Provides the calibration of the time-stamp counter against
+    // 'bsls::TimeUtil::getTimer', and the conversion of counter values to
+    // nanoseconds, underlying the cycle timer of 'bsls::TimeUtil'.
+
+  private:
+    // CLASS DATA
+    static bsls::AtomicOperations::AtomicTypes::Int64 s_counterOrigin;
+        // counter value at the end of calibration
+
+    static bsls::AtomicOperations::AtomicTypes::Int64 s_clockOrigin;
+        // 'getTimer' value corresponding to 's_counterOrigin'
+
+    static bsls::AtomicOperations::AtomicTypes::Int64 s_multiplier;
+        // nanoseconds per counter tick, scaled by '2^s_shift'
+
+    static bsls::AtomicOperations::AtomicTypes::Int   s_shift;
+        // number of fractional bits of 's_multiplier'
+
+    static const bsls::Types::Int64                   s_calibrationPeriod;
+        // minimum duration of the calibration (nanoseconds)
+
+  private:
+    // PRIVATE CLASS METHODS
+#ifdef BSLS_TIMEUTIL_CYCLE_TIMER_TSC
+    static bool calibrate();
+        // Determine whether the processor provides an invariant time-stamp
+        // counter and, if so, measure its rate against
+        // 'bsls::TimeUtil::getTimer' and store the result in the class data
+        // above.  Return 'true' on success, and 'false' (leaving the class
+        // data unchanged) if the counter is not invariant or its measured
+        // rate is not plausible.
+
+    static bool hasInvariantCounter();
+        // Return 'true' if 'cpuid' reports that the time-stamp counter of the
+        // processor is invariant, and 'false' otherwise.
+
+    static void readPair(bsls::Types::Int64 *counter,
+                         bsls::Types::Int64 *clock);
+        // Load into the specified 'counter' and 'clock' a pair of
+        // approximately simultaneous values of the time-stamp counter and of
+        // 'bsls::TimeUtil::getTimer', respectively.  The counter is read
+        // before and after the clock several times, and the midpoint of the
+        // narrowest bracket is reported, to reject readings disturbed by
+        // preemption.
+#endif
+
+    static void yield();
+        // Yield the processor to another thread.
+
+  public:
+    // CLASS METHODS
+    static bsls::Types::Int64 convertCounter(bsls::Types::Int64 counter);
+        // Return the value in nanoseconds, on the time line of
+        // 'bsls::TimeUtil::getTimer', of the specified time-stamp 'counter'
+        // value.  The behavior is undefined unless the counter has been
+        // successfully calibrated.
+
+    static int initialize();
+        // Calibrate the cycle timer, unless this has already been done (or
+        // is in progress in another thread, in which case wait for it to
+        // complete), and return the resulting (final) mode of the cycle
+        // timer, which is either 'k_COUNTER' or 'k_CLOCK'.
+};
+
+bsls::AtomicOperations::AtomicTypes::Int64
+                                      CycleTimerUtil::s_counterOrigin = { 0 };
+bsls::AtomicOperations::AtomicTypes::Int64
+                                      CycleTimerUtil::s_clockOrigin   = { 0 };
+bsls::AtomicOperations::AtomicTypes::Int64
+                                      CycleTimerUtil::s_multiplier    = { 0 };
+bsls::AtomicOperations::AtomicTypes::Int
+                                      CycleTimerUtil::s_shift         = { 0 };
+const bsls::Types::Int64
+                   CycleTimerUtil::s_calibrationPeriod = 10 * 1000 * 1000;
+
+#ifdef BSLS_TIMEUTIL_CYCLE_TIMER_TSC
+bool CycleTimerUtil::calibrate()
+{
+    if (!hasInvariantCounter()) {
+        return false;                                                 // RETURN
+    }
+
+    bsls::Types::Int64 counter0, clock0;
+    readPair(&counter0, &clock0);
+
+    while (bsls::TimeUtil::getTimer() - clock0 < s_calibrationPeriod) {
+        // busy-wait, so that the counter keeps its full rate
+    }
+
+    bsls::Types::Int64 counter1, clock1;
+    readPair(&counter1, &clock1);
+
+    const bsls::Types::Int64 ticks       = counter1 - counter0;
+    const bsls::Types::Int64 nanoseconds = clock1   - clock0;
+
+    if (ticks <= 0 || nanoseconds <= 0) {
+        return false;                                                 // RETURN
+    }
+
+    // Reject rates outside of [10 MHz, 1 THz]; such a rate indicates that the
+    // counter is not usable (e.g., it is emulated by a hypervisor), or that
+    // the measurement went wrong.
+
+    const double nanosecondsPerTick = static_cast<double>(nanoseconds)
+                                                 / static_cast<double>(ticks);
+    if (nanosecondsPerTick > 100.0 || nanosecondsPerTick < 0.001) {
+        return false;                                                 // RETURN
+    }
+
+    // Represent 'nanosecondsPerTick' as a fixed-point number having as many
+    // fractional bits (at most 32) as possible while keeping the multiplier
+    // below 2^32, so that 'convertCounter' can scale 32-bit halves of a
+    // counter difference without overflow.
+
+    const double TWO_TO_32 = 4294967296.0;
+
+    int    shift      = 32;
+    double multiplier = nanosecondsPerTick * TWO_TO_32;
+    while (multiplier >= TWO_TO_32) {
+        --shift;
+        multiplier /= 2.0;
+    }
+
+    bsls::AtomicOperations::setInt64Relaxed(&s_counterOrigin, counter1);
+    bsls::AtomicOperations::setInt64Relaxed(&s_clockOrigin,   clock1);
+    bsls::AtomicOperations::setInt64Relaxed(
+                                 &s_multiplier,
+                                 static_cast<bsls::Types::Int64>(multiplier));
+    bsls::AtomicOperations::setIntRelaxed(&s_shift, shift);
+
+    return true;
+}
+
+bool CycleTimerUtil::hasInvariantCounter()
+{
+    // The "invariant TSC" flag is bit 8 of EDX of the extended 'cpuid' leaf
+    // 0x80000007 ("Advanced Power Management Information"), on both Intel
+    // and AMD processors.
+
+    const unsigned int k_LEAF = 0x80000007;
+    const unsigned int k_FLAG = 1 << 8;
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    int registers[4];
+    __cpuid(registers, 0x80000000);
+    if (static_cast<unsigned int>(registers[0]) < k_LEAF) {
+        return false;                                                 // RETURN
+    }
+    __cpuid(registers, k_LEAF);
+    return 0 != (static_cast<unsigned int>(registers[3]) & k_FLAG);
+#else
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(k_LEAF, &eax, &ebx, &ecx, &edx)) {
+        return false;                                                 // RETURN
+    }
+    return 0 != (edx & k_FLAG);
+#endif
+}
+
+void CycleTimerUtil::readPair(bsls::Types::Int64 *counter,
+                              bsls::Types::Int64 *clock)
+{
+    enum { k_NUM_ATTEMPTS = 5 };
+
+    bsls::Types::Int64 bestWidth = -1;
+    for (int i = 0; i < k_NUM_ATTEMPTS; ++i) {
+        const bsls::Types::Int64 before =
+                                      bsls::TimeUtil_CycleTimer::readCounter();
+        const bsls::Types::Int64 now    = bsls::TimeUtil::getTimer();
+        const bsls::Types::Int64 after  =
+                                      bsls::TimeUtil_CycleTimer::readCounter();
+
+        const bsls::Types::Int64 width = after - before;
+        if (0 <= width && (bestWidth < 0 || width < bestWidth)) {
+            bestWidth = width;
+            *counter  = before + width / 2;
+            *clock    = now;
+        }
+    }
+
+    if (bestWidth < 0) {
+        // The counter went backwards on every attempt; report the last
+        // reading, and let 'calibrate' reject the result.
+
+        *counter = bsls::TimeUtil_CycleTimer::readCounter();
+        *clock   = bsls::TimeUtil::getTimer();
+    }
+}
+#endif
+
+inline
+void CycleTimerUtil::yield()
+{
+#if defined BSLS_PLATFORM_OS_WINDOWS
+    ::Sleep(0);
+#else
+    sched_yield();
+#endif
+}
+
+bsls::Types::Int64 CycleTimerUtil::convertCounter(bsls::Types::Int64 counter)
+{
+    typedef bsls::Types::Uint64 Uint64;
+
+    const bsls::Types::Int64 delta = counter
+                  - bsls::AtomicOperations::getInt64Relaxed(&s_counterOrigin);
+    const Uint64 multiplier = bsls::AtomicOperations::getInt64Relaxed(
+                                                               &s_multiplier);
+    const int    shift      = bsls::AtomicOperations::getIntRelaxed(&s_shift);
+
+    // Scale the magnitude of 'delta' in two parts, so that neither product
+    // overflows: the high part has at most '64 - shift' significant bits, and
+    // the low part has at most 'shift' bits, while 'multiplier < 2^32'.
+
+    const Uint64 ticks = delta < 0 ? -static_cast<Uint64>(delta)
+                                   :  static_cast<Uint64>(delta);
+    const Uint64 mask  = (static_cast<Uint64>(1) << shift) - 1;
+    const Uint64 nanoseconds = (ticks >> shift) * multiplier
+                             + (((ticks & mask) * multiplier) >> shift);
+
+    const bsls::Types::Int64 origin =
+                       bsls::AtomicOperations::getInt64Relaxed(&s_clockOrigin);
+
+    return delta < 0 ? origin - static_cast<bsls::Types::Int64>(nanoseconds)
+                     : origin + static_cast<bsls::Types::Int64>(nanoseconds);
+}
+
+int CycleTimerUtil::initialize()
+{
+    typedef bsls::TimeUtil_CycleTimer CycleTimer;
+
+    int mode = bsls::AtomicOperations::getIntAcquire(&CycleTimer::s_mode);
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(mode >= CycleTimer::k_COUNTER)) {
+        return mode;                                                  // RETURN
+    }
+
+    if (CycleTimer::k_UNINITIALIZED == mode
+     && CycleTimer::k_UNINITIALIZED == bsls::AtomicOperations::testAndSwapInt(
+                                                  &CycleTimer::s_mode,
+                                                  CycleTimer::k_UNINITIALIZED,
+                                                  CycleTimer::k_CALIBRATING)) {
+        bsls::TimeUtil::initialize();
+
+#ifdef BSLS_TIMEUTIL_CYCLE_TIMER_TSC
+        mode = calibrate() ? CycleTimer::k_COUNTER : CycleTimer::k_CLOCK;
+#else
+        mode = CycleTimer::k_CLOCK;
+#endif
+
+        // Publish the calibration (stored with relaxed ordering by
+        // 'calibrate') along with the mode.
+
+        bsls::AtomicOperations::setIntRelease(&CycleTimer::s_mode, mode);
+        return mode;                                                  // RETURN
+    }
+
+    // Another thread is calibrating: wait for it to finish.
+
+    while ((mode = bsls::AtomicOperations::getIntAcquire(&CycleTimer::s_mode))
+                                                   < CycleTimer::k_COUNTER) {
+        yield();
+    }
+    return mode;
+}
+
 }  // close unnamed namespace
 
 namespace bsls {
 
+                         // --------------------------
+                         // struct TimeUtil_CycleTimer
+                         // --------------------------
+
+// CLASS DATA
+AtomicOperations::AtomicTypes::Int TimeUtil_CycleTimer::s_mode = {
+                                                             k_UNINITIALIZED };
+
+// CLASS METHODS
+Types::Int64 TimeUtil_CycleTimer::readRaw()
+{
+#ifdef BSLS_TIMEUTIL_CYCLE_TIMER_TSC
+    if (k_COUNTER == CycleTimerUtil::initialize()) {
+        return readCounter();                                         // RETURN
+    }
+#else
+    CycleTimerUtil::initialize();
+#endif
+
+    return TimeUtil::getTimer();
+}
+
                             // ---------------
                             // struct TimeUtil
                             // ---------------
 
 // CLASS METHODS
+Types::Int64 TimeUtil::convertRawTime(TimeUtil::OpaqueCycleTime rawTime)
+{
+    if (TimeUtil_CycleTimer::k_COUNTER == CycleTimerUtil::initialize()) {
+        return CycleTimerUtil::convertCounter(rawTime.d_opaque);      // RETURN
+    }
+
+    return rawTime.d_opaque;
+}
+
+bool TimeUtil::cycleTimerUsesCounter()
+{
+    return TimeUtil_CycleTimer::k_COUNTER == CycleTimerUtil::initialize();
+}
+
+Types::Int64 TimeUtil::getCycleTimer()
+{
+    OpaqueCycleTime rawTime;
+    getCycleTimerRaw(&rawTime);
+    return convertRawTime(rawTime);
+}
+
+void TimeUtil::initializeCycleTimer()
+{
+    CycleTimerUtil::initialize();
+}
+
 void TimeUtil::initialize()
 {
 #if defined BSLS_PLATFORM_OS_UNIX
@@ -665,6 +1044,17 @@ void TimeUtil::getProcessTimers(Types::Int64 *systemTimer,
 #endif
 }
 
+Types::Int64 TimeUtil::getThreadCpuTimer()
+{
+#if defined BSLS_PLATFORM_OS_UNIX
+    return UnixTimerUtil::threadTimer();
+#elif defined BSLS_PLATFORM_OS_WINDOWS
+    return WindowsTimerUtil::threadTimer();
+#else
+    #error "Don't know how to get nanosecond time for this platform"
+#endif
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -19,6 +19,51 @@ BSLS_IDENT("$Id: $")
 // time functions intended for interval-timing return a time interval in
 // nanoseconds (1 nsec = 1E-9 sec) as a 64-bit integer.
 //
+///Cycle Timer
+///-----------
+// In addition to the system timer, 'bsls::TimeUtil' provides an opt-in
+// *cycle* *timer*, accessed through 'getCycleTimerRaw' and 'getCycleTimer',
+// that is intended for stamping events at very high rates (e.g., millions of
+// messages per second), where the cost of a call to the system clock would
+// dominate.  On x86 and x86-64 processors that provide an *invariant*
+// time-stamp counter (TSC) -- i.e., a counter that ticks at a constant rate
+// regardless of frequency scaling and power states, as reported by 'cpuid' --
+// a raw cycle-timer value is simply the value of the TSC, which can be read in
+// a handful of nanoseconds without entering the kernel.  On all other
+// platforms, and on processors lacking an invariant TSC, the cycle timer falls
+// back to 'getTimer', and is then no faster than the system timer.
+// 'cycleTimerUsesCounter' reports which of the two sources is in use.
+//
+// The rate of the TSC is calibrated once per process, against 'getTimer', the
+// first time the cycle timer is used (or when 'initializeCycleTimer' is
+// called).  Calibration busy-waits for about 10 milliseconds; applications
+// that are sensitive to this latency should call 'initializeCycleTimer' at
+// start-up.  The 'convertRawTime' overload for 'OpaqueCycleTime' converts a
+// raw value to nanoseconds on the same time line as 'getTimer' (to within the
+// precision of the calibration), so that cycle-timer and system-timer values
+// may be compared, and differences of converted values are elapsed times.
+//
+// Note that reading the TSC is not a serializing operation: the processor may
+// execute the read before preceding instructions have completed, or after
+// subsequent ones have started.  The cycle timer is therefore suitable for
+// time-stamping events and timing sections of code that are long compared to
+// the out-of-order execution window of the processor (tens of nanoseconds),
+// but not for measuring individual instructions.  Also note that raw values
+// read on different processors are comparable only if the operating system
+// keeps the counters of all processors synchronized, which is the case on
+// virtually all modern multi-processor x86 systems.
+//
+///Thread CPU Time
+///---------------
+// The process timers ('getProcessSystemTimer', 'getProcessUserTimer', and
+// 'getProcessTimers') report the CPU time consumed by *all* threads of the
+// process, and, on UNIX platforms, are obtained from 'times', whose
+// resolution is a clock tick (typically 10 milliseconds).  In a multi-threaded
+// program, the CPU time spent by one thread on a section of code is better
+// measured with 'getThreadCpuTimer', which reports the CPU time of the calling
+// thread only, at nanosecond resolution on platforms providing
+// 'CLOCK_THREAD_CPUTIME_ID' (and at 100 nanosecond resolution on Windows).
+//
 ///Accuracy and Precision
 ///----------------------
 // 'bsls::TimeUtil' high-resolution functions return time values as absolute
@@ -182,6 +227,14 @@ BSLS_IDENT("$Id: $")
 //  }
 //..
 
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
 #ifndef INCLUDED_BSLS_PLATFORM
 #include <bsls_platform.h>
 #endif
@@ -204,6 +257,21 @@ BSLS_IDENT("$Id: $")
     #endif
 #endif
 
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+    #if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+        #define BSLS_TIMEUTIL_CYCLE_TIMER_TSC 1
+    #elif defined(BSLS_PLATFORM_CMP_MSVC)
+        #define BSLS_TIMEUTIL_CYCLE_TIMER_TSC 1
+
+        #ifndef INCLUDED_INTRIN
+        #include <intrin.h>
+        #define INCLUDED_INTRIN
+        #endif
+
+        #pragma intrinsic(__rdtsc)
+    #endif
+#endif
+
 namespace BloombergLP {
 
 namespace bsls {
@@ -225,6 +293,13 @@ struct TimeUtil {
     // native time value and a conversion method returning a value in
     // nanoseconds.
 
+    //
+    // In addition, this class provides a *cycle* *timer*, having a raw type,
+    // 'OpaqueCycleTime', that is distinct from 'OpaqueNativeTime', and that is
+    // read from the invariant time-stamp counter of the processor where one
+    // is available (see the "Cycle Timer" section of the component-level
+    // documentation).
+
     // TYPES
 #if   defined BSLS_PLATFORM_OS_SOLARIS
     typedef struct { Types::Int64 d_opaque; } OpaqueNativeTime;
@@ -240,6 +315,10 @@ struct TimeUtil {
     typedef struct { Types::Int64 d_opaque; } OpaqueNativeTime;
 #endif
 
+    typedef struct { Types::Int64 d_opaque; } OpaqueCycleTime;
+        // Raw value of the cycle timer: either a time-stamp counter value, or
+        // a 'getTimer' value if the time-stamp counter is not used.
+
     // CLASS METHODS
     static Types::Int64 convertRawTime(OpaqueNativeTime rawTime);
         // Convert the specified 'rawTime' to a value in nanoseconds,
@@ -247,6 +326,25 @@ struct TimeUtil {
         // of the conversion.  Note that this method is thread-safe only if
         // 'initialize' has been called before.
 
+    static Types::Int64 convertRawTime(OpaqueCycleTime rawTime);
+        // Convert the specified 'rawTime', obtained from 'getCycleTimerRaw',
+        // to a value in nanoseconds, referenced to the same origin as
+        // 'getTimer', and return the result of the conversion.  This method is
+        // thread-safe.
+
+    static bool cycleTimerUsesCounter();
+        // Return 'true' if the cycle timer reads the invariant time-stamp
+        // counter of the processor, and 'false' if it falls back to
+        // 'getTimer'.  Calibrate the cycle timer if it has not already been
+        // calibrated.  This method is thread-safe.
+
+    static Types::Int64 getCycleTimer();
+        // Return the instantaneous value of the cycle timer in absolute
+        // nanoseconds referenced to the same origin as 'getTimer'.  Calibrate
+        // the cycle timer if it has not already been calibrated.  This method
+        // is thread-safe.  Note that 'getCycleTimerRaw' should be preferred
+        // if values are read much more often than they are converted.
+
     static Types::Int64 getProcessSystemTimer();
         // Return the instantaneous values of a platform-dependent timer for
         // the current process system time in absolute nanoseconds referenced
@@ -267,6 +365,27 @@ struct TimeUtil {
         // an arbitrary but fixed origin.  Note that this method is thread-safe
         // only if 'initialize' has been called before.
 
+    static Types::Int64 getThreadCpuTimer();
+        // Return the instantaneous value of a platform-dependent timer for
+        // the CPU time (user and system time combined) consumed by the
+        // calling thread in absolute nanoseconds referenced to an arbitrary
+        // but fixed origin.  This method is thread-safe.  Note that, unlike
+        // the process timers, this timer is not affected by other threads of
+        // the process and, on Linux and Windows, its resolution is much finer
+        // than a clock tick; on platforms that do not provide a per-thread
+        // CPU clock, the sum of the process system and user times is returned
+        // instead.
+
+    static void getCycleTimerRaw(OpaqueCycleTime *timeValue);
+        // Load into the specified 'timeValue' the value of an opaque type
+        // representing the current value of the cycle timer.  'timeValue'
+        // must be converted by the 'convertRawTime' method to conventional
+        // units (nanoseconds).  Calibrate the cycle timer if it has not
+        // already been calibrated.  This method is thread-safe.  Note that,
+        // once the cycle timer is calibrated, this method reads the
+        // time-stamp counter inline, if it is used, and does not call into
+        // the operating system.
+
     static Types::Int64 getTimer();
         // Return the instantaneous value of a platform-dependent system timer
         // in absolute nanoseconds referenced to an arbitrary but fixed origin.
@@ -286,8 +405,99 @@ struct TimeUtil {
         // Do a platform-dependent initialization for the utilities.  Note that
         // only after a call to this method all the following methods are
         // guaranteed to be thread-safe.
+
+    static void initializeCycleTimer();
+        // Determine whether the processor provides an invariant time-stamp
+        // counter and, if so, calibrate its rate against 'getTimer', unless
+        // this has already been done.  This method is thread-safe, and
+        // blocks for about 10 milliseconds the first time it is called.  Note
+        // that the cycle timer is calibrated automatically when first used;
+        // calling this method at start-up avoids paying the calibration cost
+        // on first use.
+};
+
+                         // ==========================
+                         // struct TimeUtil_CycleTimer
+                         // ==========================
+
+struct TimeUtil_CycleTimer {
+    // [!PRIVATE!] This component-private 'struct' provides the state and the
+    // primitive operations underlying the cycle timer of 'TimeUtil'.  Do not
+    // use outside of this component.
+
+    // TYPES
+    enum Mode {
+        k_UNINITIALIZED = 0,  // not yet calibrated
+        k_CALIBRATING   = 1,  // calibration in progress in some thread
+        k_COUNTER       = 2,  // raw values are time-stamp counter values
+        k_CLOCK         = 3   // raw values are 'TimeUtil::getTimer' values
+    };
+
+    // CLASS DATA
+    static AtomicOperations::AtomicTypes::Int s_mode;  // a 'Mode' value
+
+    // CLASS METHODS
+#ifdef BSLS_TIMEUTIL_CYCLE_TIMER_TSC
+    static Types::Int64 readCounter();
+        // Return the current value of the time-stamp counter of the processor
+        // executing the calling thread.
+#endif
+
+    static Types::Int64 readRaw();
+        // Calibrate the cycle timer if it has not already been calibrated,
+        // and return the current raw value of the cycle timer.  Note that
+        // this method is the out-of-line path of 'TimeUtil::getCycleTimerRaw'.
 };
 
+// ============================================================================
+//                          INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // --------------------------
+                         // struct TimeUtil_CycleTimer
+                         // --------------------------
+
+// CLASS METHODS
+#ifdef BSLS_TIMEUTIL_CYCLE_TIMER_TSC
+inline
+Types::Int64 TimeUtil_CycleTimer::readCounter()
+{
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    return static_cast<Types::Int64>(__rdtsc());
+#else
+    unsigned int low;
+    unsigned int high;
+    __asm__ __volatile__ ("rdtsc" : "=a" (low), "=d" (high));
+    return static_cast<Types::Int64>(
+                              (static_cast<Types::Uint64>(high) << 32) | low);
+#endif
+}
+#endif
+
+                              // ---------------
+                              // struct TimeUtil
+                              // ---------------
+
+// CLASS METHODS
+inline
+void TimeUtil::getCycleTimerRaw(OpaqueCycleTime *timeValue)
+{
+#ifdef BSLS_TIMEUTIL_CYCLE_TIMER_TSC
+    const int mode = AtomicOperations::getIntRelaxed(
+                                                 &TimeUtil_CycleTimer::s_mode);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                     TimeUtil_CycleTimer::k_COUNTER == mode)) {
+        timeValue->d_opaque = TimeUtil_CycleTimer::readCounter();
+        return;                                                       // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+#endif
+
+    timeValue->d_opaque = TimeUtil_CycleTimer::readRaw();
+}
+
 }  // close package namespace
 
 
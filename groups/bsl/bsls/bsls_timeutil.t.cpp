@@ -47,14 +47,20 @@ using namespace BloombergLP;
 // and the system results for plausible correct behavior.
 //-----------------------------------------------------------------------------
 // [11] bsls::Types::Int64 convertRawTime(OpaqueNativeTime rawTime);
+// [12] bsls::Types::Int64 convertRawTime(OpaqueCycleTime rawTime);
+// [12] bool cycleTimerUsesCounter();
+// [12] bsls::Types::Int64 getCycleTimer();
+// [12] void getCycleTimerRaw(OpaqueCycleTime *timeValue);
 // [ 1] bsls::Types::Int64 bsls::TimeUtil::getProcessSystemTimer();
 // [ 1] void bsls::TimeUtil::getProcessTimers(bsls::Types::Int64);
 // [ 1] bsls::Types::Int64 bsls::TimeUtil::getTimer();
 // [ 1] bsls::Types::Int64 bsls::TimeUtil::getProcessUserTimer();
+// [13] bsls::Types::Int64 getThreadCpuTimer();
 // [11] OpaqueNativeTime getTimerRaw();
+// [12] void initializeCycleTimer();
 //-----------------------------------------------------------------------------
 // [XX] Breathing Test -- NOT IMPLEMENTED
-// [ 2] USAGE
+// [14] USAGE
 // [ 3] Performance Test
 // [ 4] Test for unique, monotonically increasing return values (statistical)
 // [ 5] Test correct hooking of methods to underlying OS APIs (approximately)
@@ -63,6 +69,7 @@ using namespace BloombergLP;
 // [ 8] Initialization test: getProcessUserTimer (UNIX only)
 // [ 9] Initialization test: getProcessTimers (UNIX only)
 // [10] Initialization test: getTimer (Windows only)
+// [-1] Performance Test: 'getTimerRaw' vs. 'getCycleTimerRaw'
 //-----------------------------------------------------------------------------
 
 //=============================================================================
@@ -497,7 +504,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 14: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header must build and
@@ -539,6 +546,250 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD CPU TIMER
+        //
+        // Concerns:
+        //: 1 Thread CPU timer values are not negative and do not decrease
+        //:   over successive calls.
+        //:
+        //: 2 The thread CPU timer advances while the calling thread is busy,
+        //:   and no faster than the wall clock.
+        //:
+        //: 3 The thread CPU timer does not advance (significantly) while the
+        //:   calling thread sleeps.
+        //
+        // Plan:
+        //: 1 Call 'getThreadCpuTimer' in a large loop, and verify that the
+        //:   values are not negative and never decrease.  (C-1)
+        //:
+        //: 2 Busy-wait for 100 msec, as measured by 'getTimer', and verify
+        //:   that the thread CPU time consumed is positive and does not
+        //:   exceed the wall time, plus a tolerance of one clock tick.  (C-2)
+        //:
+        //: 3 Sleep for one second, and verify that the thread CPU time
+        //:   consumed is less than 50 msec.  (C-3)
+        //
+        // Testing:
+        //   bsls::Types::Int64 getThreadCpuTimer();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING THREAD CPU TIMER"
+                            "\n========================\n");
+
+        const Int64 TOLERANCE = 10 * 1000 * 1000;  // one tick, in nanoseconds
+
+        if (verbose) printf("\nTesting monotonicity.\n");
+        {
+            const int NUM_TESTS = 100000;
+            int       numWrong  = 0;
+
+            Int64 previous = TU::getThreadCpuTimer();
+            ASSERT(0 <= previous);
+
+            for (int i = 0; i < NUM_TESTS; ++i) {
+                const Int64 current = TU::getThreadCpuTimer();
+                if (current < previous) {
+                    ++numWrong;
+                    if (veryVerbose) { T_ P_(i) P_(previous) P(current) }
+                }
+                previous = current;
+            }
+            LOOP_ASSERT(numWrong, 0 == numWrong);
+        }
+
+        if (verbose) printf("\nTesting a busy thread.\n");
+        {
+            const Int64 DURATION = 100 * 1000 * 1000;  // 100 msec
+
+            const Int64 c0 = TU::getThreadCpuTimer();
+            const Int64 t0 = TU::getTimer();
+            while (TU::getTimer() - t0 < DURATION) {
+            }
+            const Int64 t1 = TU::getTimer();
+            const Int64 c1 = TU::getThreadCpuTimer();
+
+            if (verbose) { T_ P_(t1 - t0) P(c1 - c0) }
+
+            LOOP2_ASSERT(c0, c1, c0 < c1);
+            LOOP2_ASSERT(t1 - t0, c1 - c0, c1 - c0 <= t1 - t0 + TOLERANCE);
+        }
+
+        if (verbose) printf("\nTesting a sleeping thread.\n");
+        {
+            const Int64 c0 = TU::getThreadCpuTimer();
+            osSleep(1);
+            const Int64 c1 = TU::getThreadCpuTimer();
+
+            if (verbose) { T_ P(c1 - c0) }
+
+            LOOP2_ASSERT(c0, c1, c0 <= c1);
+            LOOP_ASSERT(c1 - c0, c1 - c0 < 5 * TOLERANCE);
+        }
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING CYCLE TIMER
+        //
+        // Concerns:
+        //: 1 The cycle timer is calibrated on first use, without an explicit
+        //:   call to 'initializeCycleTimer', and 'initializeCycleTimer' is
+        //:   idempotent.
+        //:
+        //: 2 Raw cycle-timer values, and their conversions to nanoseconds, do
+        //:   not decrease over successive calls.
+        //:
+        //: 3 Converted cycle-timer values are on the time line of 'getTimer'.
+        //:
+        //: 4 Intervals measured with the cycle timer agree with intervals
+        //:   measured with 'getTimer'.
+        //:
+        //: 5 'getCycleTimer' is equivalent to converting the value loaded by
+        //:   'getCycleTimerRaw'.
+        //:
+        //: 6 If the time-stamp counter is not used, raw values are 'getTimer'
+        //:   values, and conversion is the identity.
+        //
+        // Plan:
+        //: 1 Call 'getCycleTimer' before any other method of the cycle timer,
+        //:   then call 'initializeCycleTimer' twice, and verify that
+        //:   'cycleTimerUsesCounter' is unchanged.  (C-1)
+        //:
+        //: 2 Read the cycle timer twice in a large loop, and verify that
+        //:   neither the raw nor the converted values decrease.  (C-2)
+        //:
+        //: 3 Bracket calls to 'getCycleTimer' between calls to 'getTimer', and
+        //:   verify that the result lies within the bracket, to within a
+        //:   tolerance of 100 usec.  (C-3,5)
+        //:
+        //: 4 Measure busy-wait intervals of increasing length with both
+        //:   timers, and verify that the results agree to within 0.1%, plus
+        //:   a tolerance of 100 usec.  (C-4)
+        //:
+        //: 5 If 'cycleTimerUsesCounter' is 'false', verify that a raw value is
+        //:   bracketed by calls to 'getTimer' and is unchanged by
+        //:   'convertRawTime'.  (C-6)
+        //
+        // Testing:
+        //   bsls::Types::Int64 convertRawTime(OpaqueCycleTime rawTime);
+        //   bool cycleTimerUsesCounter();
+        //   bsls::Types::Int64 getCycleTimer();
+        //   void getCycleTimerRaw(OpaqueCycleTime *timeValue);
+        //   void initializeCycleTimer();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CYCLE TIMER"
+                            "\n===================\n");
+
+        const Int64 TOLERANCE = 100 * 1000;  // nanoseconds
+
+        if (verbose) printf("\nTesting calibration on first use.\n");
+        {
+            const Int64 t0 = TU::getTimer();
+            const Int64 c0 = TU::getCycleTimer();
+            const Int64 t1 = TU::getTimer();
+
+            const bool usesCounter = TU::cycleTimerUsesCounter();
+            if (verbose) { T_ P_(usesCounter) P(t1 - t0) }
+
+            // The first call includes the calibration, so only the lower
+            // bound is checked here.
+
+            LOOP2_ASSERT(t0, c0, t0 - TOLERANCE <= c0);
+            LOOP2_ASSERT(c0, t1, c0 <= t1 + TOLERANCE);
+
+            TU::initializeCycleTimer();
+            ASSERT(usesCounter == TU::cycleTimerUsesCounter());
+            TU::initializeCycleTimer();
+            ASSERT(usesCounter == TU::cycleTimerUsesCounter());
+
+#if defined(BSLS_TIMEUTIL_CYCLE_TIMER_TSC)
+            if (verbose) printf("\tTSC supported by this build.\n");
+#else
+            ASSERT(false == usesCounter);
+#endif
+        }
+
+        if (verbose) printf("\nTesting monotonicity.\n");
+        {
+            const int NUM_TESTS = 1000000;
+            int       numWrong  = 0;
+
+            for (int i = 0; i < NUM_TESTS; ++i) {
+                TU::OpaqueCycleTime r1, r2;
+                TU::getCycleTimerRaw(&r1);
+                TU::getCycleTimerRaw(&r2);
+
+                if (r2.d_opaque < r1.d_opaque
+                 || TU::convertRawTime(r2) < TU::convertRawTime(r1)) {
+                    ++numWrong;
+                    if (veryVerbose) {
+                        T_ P_(i) P_(r1.d_opaque) P(r2.d_opaque)
+                    }
+                }
+            }
+            LOOP_ASSERT(numWrong, 0 == numWrong);
+        }
+
+        if (verbose) printf("\nTesting the origin of converted values.\n");
+        {
+            for (int i = 0; i < 100; ++i) {
+                const Int64 t0 = TU::getTimer();
+                TU::OpaqueCycleTime raw;
+                TU::getCycleTimerRaw(&raw);
+                const Int64 c0 = TU::getCycleTimer();
+                const Int64 t1 = TU::getTimer();
+
+                const Int64 c1 = TU::convertRawTime(raw);
+
+                if (veryVerbose) { T_ P_(t0) P_(c1) P_(c0) P(t1) }
+
+                LOOP3_ASSERT(i, t0, c1, t0 - TOLERANCE <= c1);
+                LOOP3_ASSERT(i, c1, c0, c1 <= c0);
+                LOOP3_ASSERT(i, c0, t1, c0 <= t1 + TOLERANCE);
+            }
+        }
+
+        if (verbose) printf("\nTesting measured intervals.\n");
+        {
+            for (Int64 duration = 1000 * 1000;            // 1 msec
+                 duration <= 200 * 1000 * 1000;           // 200 msec
+                 duration *= 10) {
+                const Int64 t0 = TU::getTimer();
+                const Int64 c0 = TU::getCycleTimer();
+                while (TU::getTimer() - t0 < duration) {
+                }
+                const Int64 c1 = TU::getCycleTimer();
+                const Int64 t1 = TU::getTimer();
+
+                const Int64 clockInterval = t1 - t0;
+                const Int64 cycleInterval = c1 - c0;
+                const Int64 difference    = clockInterval - cycleInterval;
+                const Int64 limit = clockInterval / 1000 + TOLERANCE;
+
+                if (veryVerbose) {
+                    T_ P_(clockInterval) P_(cycleInterval) P(difference)
+                }
+
+                LOOP3_ASSERT(duration, clockInterval, cycleInterval,
+                             -limit <= difference && difference <= limit);
+            }
+        }
+
+        if (!TU::cycleTimerUsesCounter()) {
+            if (verbose) printf("\nTesting the fall-back to 'getTimer'.\n");
+
+            const Int64 t0 = TU::getTimer();
+            TU::OpaqueCycleTime raw;
+            TU::getCycleTimerRaw(&raw);
+            const Int64 t1 = TU::getTimer();
+
+            ASSERT(t0 <= raw.d_opaque);
+            ASSERT(raw.d_opaque <= t1);
+            ASSERT(raw.d_opaque == TU::convertRawTime(raw));
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING convertRawTime() arithmetic *** Windows Only ***
@@ -1817,6 +2068,79 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: 'getTimerRaw' VS. 'getCycleTimerRaw'
+        //   Compare the cost of reading the system timer with that of reading
+        //   the cycle timer.
+        //
+        // Plan:
+        //   Read each raw timer, and convert each value read, in a large loop,
+        //   and report the average time per call, measured with 'getTimer'.
+        //   The number of iterations may be specified on the command line.
+        //
+        // Testing:
+        //   PERFORMANCE: 'getTimerRaw' vs. 'getCycleTimerRaw'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: 'getTimerRaw' vs."
+                            " 'getCycleTimerRaw'"
+                            "\n=============================="
+                            "==================\n");
+
+        const int NUM_ITERATIONS = verbose ? atoi(argv[2]) : 10000000;
+
+        TU::initialize();
+        TU::initializeCycleTimer();
+
+        const bool usesCounter = TU::cycleTimerUsesCounter();
+        P(usesCounter);
+
+        Int64 sum = 0;  // prevent the loops from being optimized away
+
+        {
+            const Int64 t0 = TU::getTimer();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                TU::OpaqueNativeTime raw;
+                TU::getTimerRaw(&raw);
+                sum += sizeof raw;  // the value is opaque
+            }
+            const Int64 t1 = TU::getTimer();
+            printf("getTimerRaw:                   %6.2f nsec per call\n",
+                   (double)(t1 - t0) / NUM_ITERATIONS);
+        }
+        {
+            const Int64 t0 = TU::getTimer();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                TU::OpaqueCycleTime raw;
+                TU::getCycleTimerRaw(&raw);
+                sum += raw.d_opaque;
+            }
+            const Int64 t1 = TU::getTimer();
+            printf("getCycleTimerRaw:              %6.2f nsec per call\n",
+                   (double)(t1 - t0) / NUM_ITERATIONS);
+        }
+        {
+            const Int64 t0 = TU::getTimer();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                sum += TU::getTimer();
+            }
+            const Int64 t1 = TU::getTimer();
+            printf("getTimer:                      %6.2f nsec per call\n",
+                   (double)(t1 - t0) / NUM_ITERATIONS);
+        }
+        {
+            const Int64 t0 = TU::getTimer();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                sum += TU::getCycleTimer();
+            }
+            const Int64 t1 = TU::getTimer();
+            printf("getCycleTimer:                 %6.2f nsec per call\n",
+                   (double)(t1 - t0) / NUM_ITERATIONS);
+        }
+
+        if (veryVerbose) P(sum);
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
@@ -8,6 +8,9 @@
       'bslstl_bitset.cpp',
       'bslstl_deque.cpp',
       'bslstl_equalto.cpp',
+      'bslstl_flathashmap.cpp',
+      'bslstl_flathashset.cpp',
+      'bslstl_flathashtable.cpp',
       'bslstl_forwarditerator.cpp',
       'bslstl_hash.cpp',
       'bslstl_hashtable.cpp',
@@ -57,6 +60,9 @@
       'bslstl_bitset.t',
       'bslstl_deque.t',
       'bslstl_equalto.t',
+      'bslstl_flathashmap.t',
+      'bslstl_flathashset.t',
+      'bslstl_flathashtable.t',
       'bslstl_forwarditerator.t',
       'bslstl_hash.t',
       'bslstl_hashtable.t',
@@ -106,6 +112,9 @@
       '<(PRODUCT_DIR)/bslstl_bitset.t',
       '<(PRODUCT_DIR)/bslstl_deque.t',
       '<(PRODUCT_DIR)/bslstl_equalto.t',
+      '<(PRODUCT_DIR)/bslstl_flathashmap.t',
+      '<(PRODUCT_DIR)/bslstl_flathashset.t',
+      '<(PRODUCT_DIR)/bslstl_flathashtable.t',
       '<(PRODUCT_DIR)/bslstl_forwarditerator.t',
       '<(PRODUCT_DIR)/bslstl_hash.t',
       '<(PRODUCT_DIR)/bslstl_hashtable.t',
@@ -260,6 +269,30 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslstl_equalto.t.cpp' ],
     },
+    {
+      'target_name': 'bslstl_flathashmap.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_flathashmap.t.cpp' ],
+    },
+    {
+      'target_name': 'bslstl_flathashset.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_flathashset.t.cpp' ],
+    },
+    {
+      'target_name': 'bslstl_flathashtable.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_flathashtable.t.cpp' ],
+    },
     {
       'target_name': 'bslstl_forwarditerator.t',
       'type': 'executable',
@@ -383,6 +383,14 @@ BSL_OVERRIDES_STD mode"
 #include <bslmf_nestedtraitdeclaration.h>
 #endif
 
+#ifndef INCLUDED_BSLS_ALIGNMENTFROMTYPE
+#include <bsls_alignmentfromtype.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ASSERT
 #include <bsls_assert.h>
 #endif
@@ -501,14 +509,22 @@ class allocator {
     // MANIPULATORS
     pointer allocate(size_type n, const void *hint = 0);
         // Allocate enough (properly aligned) space for 'n' objects of type 'T'
-        // by calling 'allocate' on the mechanism object.  The 'hint' argument
-        // is ignored by this allocator type.  The behavior is undefined unless
-        // 'n <= max_size()'.
+        // by calling 'allocate' on the mechanism object, or, if 'T' requires
+        // an alignment greater than the maximal alignment of the platform, by
+        // calling 'allocateAligned' on the mechanism object, supplying the
+        // alignment of 'T'.  The 'hint' argument is ignored by this allocator
+        // type.  The behavior is undefined unless 'n <= max_size()'.
 
     void deallocate(pointer p, size_type n = 1);
         // Return memory previously allocated with 'allocate' to the underlying
-        // mechanism object by calling 'deallocate' on the the mechanism
-        // object.  The 'n' argument is ignored by this allocator type.
+        // mechanism object by calling 'deallocateSized' on the mechanism
+        // object (or 'deallocateAligned', if 'T' requires an alignment
+        // greater than the maximal alignment of the platform), supplying the
+        // size (in bytes) of 'n' objects of type 'T'.
+        // The behavior is undefined unless 'p' was returned by a call to
+        // 'allocate' for 'n' objects.  Note that the mechanism may use the
+        // size to return the memory more efficiently, and that the default
+        // implementation of 'bslma::Allocator::deallocateSized' ignores it.
 
     void construct(pointer p, const T& val);
         // Copy-construct a 'T' object at the memory address specified by 'p'.
@@ -710,10 +726,24 @@ allocator<T>::allocate(typename allocator::size_type  n,
     // Both 'bslma::Allocator::size_type' and 'allocator<T>::size_type' have
     // the same width; however, the former is signed, but the latter is not.
     // Hence the cast in the argument of 'allocate' below.
+    //
+    // The alignment of 'T' is computed here, rather than in the class
+    // definition, because 'T' may be incomplete when 'allocator<T>' is
+    // instantiated.
+
+    typedef BloombergLP::bslma::Allocator::size_type MechanismSize;
+
+    static const int k_ALIGNMENT =
+                              BloombergLP::bsls::AlignmentFromType<T>::VALUE;
 
     (void) hint;  // suppress warning
+    if (k_ALIGNMENT > BloombergLP::bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT) {
+        return static_cast<pointer>(d_mechanism->allocateAligned(
+                                                  MechanismSize(n * sizeof(T)),
+                                                  k_ALIGNMENT));      // RETURN
+    }
     return static_cast<pointer>(d_mechanism->allocate(
-                     BloombergLP::bslma::Allocator::size_type(n * sizeof(T))));
+                                                MechanismSize(n * sizeof(T))));
 }
 
 template <class T>
@@ -721,8 +751,18 @@ inline
 void allocator<T>::deallocate(typename allocator::pointer   p,
                               typename allocator::size_type n)
 {
-    (void) n;  // suppress warning
-    d_mechanism->deallocate(p);
+    typedef BloombergLP::bslma::Allocator::size_type MechanismSize;
+
+    static const int k_ALIGNMENT =
+                              BloombergLP::bsls::AlignmentFromType<T>::VALUE;
+
+    if (k_ALIGNMENT > BloombergLP::bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT) {
+        d_mechanism->deallocateAligned(p,
+                                       MechanismSize(n * sizeof(T)),
+                                       k_ALIGNMENT);
+        return;                                                       // RETURN
+    }
+    d_mechanism->deallocateSized(p, MechanismSize(n * sizeof(T)));
 }
 
 template <class T>
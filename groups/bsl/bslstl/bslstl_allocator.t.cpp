@@ -7,10 +7,13 @@
 #include <bslma_defaultallocatorguard.h>  // testing only
 #include <bslma_testallocator.h>          // testing only
 #include <bslmf_issame.h>                 // testing only
+#include <bsls_alignmentfromtype.h>       // testing only
 #include <bsls_platform.h>                // testing only
+#include <bsls_types.h>                   // testing only
 
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 #include <new>
 #include <limits>
@@ -61,9 +64,11 @@ using namespace std;
 // [ 5] bsl::allocator::const_reference;
 // [ 5] bsl::allocator::value_type;
 // [ 5] template rebind<U>::other
+// [ 6] pointer allocate(size_type n, const void *hint = 0);
+// [ 6] void deallocate(pointer p, size_type n = 1);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 6] USAGE EXAMPLE
+// [ 7] USAGE EXAMPLE
 
 //==========================================================================
 //                  STANDARD BDE ASSERT TEST MACRO
@@ -393,6 +398,28 @@ struct MyObject
     char d_s[10];
 };
 
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define U_OVER_ALIGNED __attribute__((aligned(64)))
+#elif defined(BSLS_PLATFORM_CMP_MSVC)
+#define U_OVER_ALIGNED __declspec(align(64))
+#endif
+
+#ifdef U_OVER_ALIGNED
+                          // ==========================
+                          // struct MyOverAlignedObject
+                          // ==========================
+
+struct U_OVER_ALIGNED MyOverAlignedObject
+{
+    // An object requiring an alignment of 64 bytes, greater than the maximal
+    // alignment of any fundamental type (e.g., a cache line, or a vector of
+    // 16 'float' values for SIMD instructions).
+
+    // DATA
+    float d_values[16];
+};
+#endif
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -409,7 +436,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -428,6 +455,77 @@ int main(int argc, char *argv[])
 
         usageExample();
 
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING OVER-ALIGNED TYPES
+        //
+        // Concerns:
+        //: 1 The memory allocated for a type whose alignment is greater than
+        //:   the maximal alignment of the platform is aligned for that type.
+        //:
+        //: 2 The memory is obtained from, and returned to, the mechanism, with
+        //:   the sizes that the mechanism expects.
+        //:
+        //: 3 The memory allocated for other types is obtained by 'allocate'
+        //:   on the mechanism, with no overhead.
+        //
+        // Plan:
+        //: 1 Using a 'bsl::allocator' for a 64-byte-aligned type having a test
+        //:   allocator as its mechanism, allocate arrays of various lengths,
+        //:   verify that each is aligned and writable, and deallocate them.
+        //:   (C-1)
+        //:
+        //: 2 Verify that the test allocator reports no mismatched
+        //:   deallocations, and that all of the memory is returned.  (C-2)
+        //:
+        //: 3 Allocate an array of a non-over-aligned type, and verify the
+        //:   number of bytes obtained from the test allocator.  (C-3)
+        //
+        // Testing:
+        //   pointer allocate(size_type n, const void *hint = 0);
+        //   void deallocate(pointer p, size_type n = 1);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING OVER-ALIGNED TYPES"
+                            "\n==========================\n");
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+#ifdef U_OVER_ALIGNED
+        typedef MyOverAlignedObject Obj;
+
+        ASSERT(64 == bsls::AlignmentFromType<Obj>::VALUE);
+
+        bsl::allocator<Obj> a(&ta);
+
+        for (int n = 1; n <= 17; ++n) {
+            Obj *p[3];
+            for (int i = 0; i < 3; ++i) {
+                p[i] = a.allocate(n);
+                LOOP_ASSERT(n, 0 == bsls::Types::UintPtr(p[i]) % 64);
+                memset(p[i], 0xa5, n * sizeof(Obj));
+            }
+            LOOP_ASSERT(n, 3 == ta.numBlocksInUse());
+
+            for (int i = 0; i < 3; ++i) {
+                a.deallocate(p[i], n);
+            }
+            LOOP_ASSERT(n, 0 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numMismatches());
+#else
+        if (verbose) printf("\tOver-aligned types are not supported.\n");
+#endif
+
+        bsl::allocator<MyObject> b(&ta);
+
+        MyObject *q = b.allocate(3);
+        ASSERT(3 * sizeof(MyObject) == ta.lastAllocatedNumBytes());
+        b.deallocate(q, 3);
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == ta.numMismatches());
+
       } break;
       case 5: {
         // --------------------------------------------------------------------
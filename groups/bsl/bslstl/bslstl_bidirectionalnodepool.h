@@ -23,6 +23,25 @@ BSLS_IDENT("$Id: $")
 // 'bslstl_simplepool' component in its implementation to provide memory for
 // the nodes (see 'bslstl_simplepool').
 //
+// By default, the nodes created by a 'BidirectionalNodePool' are of type
+// 'bslalg::BidirectionalNode<VALUE>'.  An optional third template parameter,
+// 'NODE', allows a client to create nodes of a POD-like type derived from
+// 'bslalg::BidirectionalNode<VALUE>' that carries additional (trivial) data,
+// such as 'bslalg::HashedBidirectionalNode<VALUE>'.  The pool constructs and
+// destroys only the 'value' attribute of such a node; any additional data
+// members must be initialized by the client.
+//
+///Winking Out
+///-----------
+// A hash-table-based container being destroyed may call 'winkOut' instead of
+// destroying each of its nodes.  If the (template parameter) type 'VALUE' is
+// trivially destructible and the allocator of the pool is a
+// 'bslma::ManagedAllocator' (see 'bslma_managedallocator'), 'winkOut'
+// relinquishes all of the nodes of the pool in constant time, leaving their
+// memory to be reclaimed when the managed allocator is released, and returns
+// 'true'; otherwise 'winkOut' has no effect and returns 'false', and the
+// container must destroy its nodes.
+//
 ///Memory Allocation
 ///-----------------
 // 'BidirectionalNodePool' uses an allocator of the (template parameter) type
@@ -202,10 +221,18 @@ BSLS_IDENT("$Id: $")
 #include <bslma_deallocatorproctor.h>
 #endif
 
+#ifndef INCLUDED_BSLMA_MANAGEDALLOCATOR
+#include <bslma_managedallocator.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
 #include <bslmf_isbitwisemoveable.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
 #ifndef INCLUDED_BSLS_NATIVESTD
 #include <bsls_nativestd.h>
 #endif
@@ -221,13 +248,17 @@ namespace bslstl {
                        // class BidirectionalNodePool
                        // ===========================
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE,
+          class ALLOCATOR,
+          class NODE = bslalg::BidirectionalNode<VALUE> >
 class BidirectionalNodePool {
-    // This class provides methods for creating and destroying nodes using the
-    // appropriate allocator-traits of the (template parameter) type
-    // 'ALLOCATOR'.
+    // This class provides methods for creating and destroying nodes of the
+    // (template parameter) type 'NODE' using the appropriate allocator-traits
+    // of the (template parameter) type 'ALLOCATOR'.  The behavior is undefined
+    // unless 'NODE' is 'bslalg::BidirectionalNode<VALUE>', or a POD-like
+    // class publicly derived from it that adds only trivial data members.
 
-    typedef SimplePool<bslalg::BidirectionalNode<VALUE>, ALLOCATOR>       Pool;
+    typedef SimplePool<NODE, ALLOCATOR>                                   Pool;
         // This 'typedef' is an alias for the memory pool allocator.
 
     typedef typename Pool::AllocatorTraits AllocatorTraits;
@@ -260,7 +291,7 @@ class BidirectionalNodePool {
 
     // ~BidirectionalNodePool() = default;
         // Destroy the memory pool maintained by this object, releasing all
-        // memory used by the nodes of the type 'BidirectionalNode<VALUE>' in
+        // memory used by the nodes of the (template parameter) type 'NODE' in
         // the pool.  Any memory allocated for the nodes' 'value' attribute of
         // the (template parameter) type 'VALUE' will be leaked unless the
         // nodes are explictly destroyed via the 'destroyNode' method.
@@ -275,15 +306,15 @@ class BidirectionalNodePool {
         // allocator.
 
     bslalg::BidirectionalLink *createNode();
-        // Allocate a node of the type 'BidirectionalNode<VALUE>', and default
-        // construct an object of the (template parameter) type 'VALUE' at the
-        // 'value' attribute of the node.  Return the address of the Node.
-        // Note that the 'next' and 'prev' attributes of the returned node will
-        // be uninitialized.
+        // Allocate a node of the (template parameter) type 'NODE', and
+        // default construct an object of the (template parameter) type
+        // 'VALUE' at the 'value' attribute of the node.  Return the address of
+        // the Node.  Note that the 'next' and 'prev' attributes of the
+        // returned node will be uninitialized.
 
     template <class SOURCE>
     bslalg::BidirectionalLink *createNode(const SOURCE& value);
-        // Allocate a node of the type 'BidirectionalNode<VALUE>', and
+        // Allocate a node of the (template parameter) type 'NODE', and
         // construct an object of the (template parameter) type 'VALUE', using
         // its single-argument constructor passing the specified 'value' as the
         // argument, at the 'value' attribute of the node.  Return the address
@@ -293,7 +324,7 @@ class BidirectionalNodePool {
     template <class FIRST_ARG, class SECOND_ARG>
     bslalg::BidirectionalLink *createNode(const FIRST_ARG&  first,
                                           const SECOND_ARG& second);
-        // Allocate a node of the type 'BidirectionalNode<VALUE>', and
+        // Allocate a node of the (template parameter) type 'NODE', and
         // construct an object of the (template parameter) type 'VALUE', using
         // its two-arguments constructor passing the specified 'first' as the
         // first argument and the specified 'second' as the second argument, at
@@ -303,7 +334,7 @@ class BidirectionalNodePool {
 
     bslalg::BidirectionalLink *cloneNode(
                                     const bslalg::BidirectionalLink& original);
-        // Allocate a node of the type 'BidirectionalNode<VALUE>', and
+        // Allocate a node of the (template parameter) type 'NODE', and
         // copy-construct an object of the (template parameter) type 'VALUE'
         // having the same value as the specified 'original' at the 'value'
         // attribute of the node.  Return the address of the node.  Note that
@@ -313,8 +344,8 @@ class BidirectionalNodePool {
     void deleteNode(bslalg::BidirectionalLink *linkNode);
         // Destroy the 'VALUE' attribute of the specified 'linkNode' and return
         // the memory footprint of 'linkNode' to this pool for potential reuse.
-        // The behavior is undefined unless 'node' refers to a
-        // 'bslalg::BidirectionalNode<VALUE>' that was allocated by this pool.
+        // The behavior is undefined unless 'node' refers to a 'NODE' that was
+        // allocated by this pool.
 
     void reserveNodes(size_type numNodes);
         // Reserve memory from this pool to satisfy memory requests for at
@@ -332,6 +363,17 @@ class BidirectionalNodePool {
         // those of the specified 'other' object.  This method provides the
         // no-throw exception-safety guarantee.
 
+    bool winkOut();
+        // If 'VALUE' is trivially destructible and the mechanism of
+        // 'allocator()' is a 'bslma::ManagedAllocator', relinquish all of the
+        // nodes of this pool, without destroying their values or returning
+        // their memory to the allocator, and return 'true'; otherwise return
+        // 'false' with no effect.  The behavior is undefined if a node
+        // allocated from this pool is used after this method returns 'true'.
+        // Note that the relinquished memory is reclaimed when the managed
+        // allocator is released, and that a container may call this method
+        // from its destructor instead of destroying each of its nodes.
+
     void release() { d_pool.release(); }
 
     // ACCESSORS
@@ -341,9 +383,9 @@ class BidirectionalNodePool {
 };
 
 // FREE FUNCTIONS
-template <class VALUE, class ALLOCATOR>
-void swap(BidirectionalNodePool<VALUE, ALLOCATOR>& a,
-          BidirectionalNodePool<VALUE, ALLOCATOR>& b);
+template <class VALUE, class ALLOCATOR, class NODE>
+void swap(BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& a,
+          BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& b);
         // Efficiently exchange the nodes of the specified 'a' object with
         // those of the specified 'b' object.  This method provides the
         // no-throw exception-safety guarantee.  The behavior is undefined
@@ -361,8 +403,9 @@ void swap(BidirectionalNodePool<VALUE, ALLOCATOR>& a,
 
 namespace bslmf {
 
-template <class VALUE, class ALLOCATOR>
-struct IsBitwiseMoveable<bslstl::BidirectionalNodePool<VALUE, ALLOCATOR> >
+template <class VALUE, class ALLOCATOR, class NODE>
+struct IsBitwiseMoveable<
+                       bslstl::BidirectionalNodePool<VALUE, ALLOCATOR, NODE> >
 : bsl::integral_constant<bool, bslmf::IsBitwiseMoveable<ALLOCATOR>::value>
 {};
 
@@ -375,30 +418,29 @@ struct IsBitwiseMoveable<bslstl::BidirectionalNodePool<VALUE, ALLOCATOR> >
 namespace bslstl {
 
 // CREATORS
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-BidirectionalNodePool<VALUE, ALLOCATOR>::BidirectionalNodePool(
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::BidirectionalNodePool(
                                                     const ALLOCATOR& allocator)
 : d_pool(allocator)
 {
 }
 
 // MANIPULATORS
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-typename SimplePool<bslalg::BidirectionalNode<VALUE>, ALLOCATOR>::
-                                                                 AllocatorType&
-BidirectionalNodePool<VALUE, ALLOCATOR>::allocator()
+typename SimplePool<NODE, ALLOCATOR>::AllocatorType&
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::allocator()
 {
     return d_pool.allocator();
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
 bslalg::BidirectionalLink *
-BidirectionalNodePool<VALUE, ALLOCATOR>::createNode()
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::createNode()
 {
-    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    NODE *node = d_pool.allocate();
     bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
 
     AllocatorTraits::construct(allocator(),
@@ -408,13 +450,13 @@ BidirectionalNodePool<VALUE, ALLOCATOR>::createNode()
     return node;
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 template <class SOURCE>
 inline
 bslalg::BidirectionalLink *
-BidirectionalNodePool<VALUE, ALLOCATOR>::createNode(const SOURCE& value)
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::createNode(const SOURCE& value)
 {
-    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    NODE *node = d_pool.allocate();
     bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
 
     AllocatorTraits::construct(allocator(),
@@ -424,14 +466,15 @@ BidirectionalNodePool<VALUE, ALLOCATOR>::createNode(const SOURCE& value)
     return node;
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 template <class FIRST_ARG, class SECOND_ARG>
 inline
 bslalg::BidirectionalLink *
-BidirectionalNodePool<VALUE, ALLOCATOR>::createNode(const FIRST_ARG&  first,
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::createNode(
+                                                    const FIRST_ARG&  first,
                                                     const SECOND_ARG& second)
 {
-    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    NODE *node = d_pool.allocate();
     bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
 
     AllocatorTraits::construct(allocator(),
@@ -442,74 +485,89 @@ BidirectionalNodePool<VALUE, ALLOCATOR>::createNode(const FIRST_ARG&  first,
     return node;
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
 bslalg::BidirectionalLink *
-BidirectionalNodePool<VALUE, ALLOCATOR>::cloneNode(
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::cloneNode(
                                      const bslalg::BidirectionalLink& original)
 {
     return createNode(static_cast<const bslalg::BidirectionalNode<VALUE>&>
                                                            (original).value());
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void BidirectionalNodePool<VALUE, ALLOCATOR>::deleteNode(
+void BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::deleteNode(
                                            bslalg::BidirectionalLink *linkNode)
 {
     BSLS_ASSERT(linkNode);
 
-    bslalg::BidirectionalNode<VALUE> *node =
-                     static_cast<bslalg::BidirectionalNode<VALUE> *>(linkNode);
+    NODE *node = static_cast<NODE *>(linkNode);
     AllocatorTraits::destroy(allocator(),
                              bsls::Util::addressOf(node->value()));
     d_pool.deallocate(node);
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void BidirectionalNodePool<VALUE, ALLOCATOR>::reserveNodes(size_type numNodes)
+void BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::reserveNodes(
+                                                           size_type numNodes)
 {
     BSLS_ASSERT_SAFE(0 < numNodes);
 
     d_pool.reserve(numNodes);
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void BidirectionalNodePool<VALUE, ALLOCATOR>::swapRetainAllocators(
-                                BidirectionalNodePool<VALUE, ALLOCATOR>& other)
+void BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::swapRetainAllocators(
+                          BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& other)
 {
     BSLS_ASSERT_SAFE(allocator() == other.allocator());
 
     d_pool.quickSwapRetainAllocators(other.d_pool);
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void BidirectionalNodePool<VALUE, ALLOCATOR>::swapExchangeAllocators(
-                                BidirectionalNodePool<VALUE, ALLOCATOR>& other)
+void BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::swapExchangeAllocators(
+                          BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& other)
 {
     d_pool.quickSwapExchangeAllocators(other.d_pool);
 }
 
+template <class VALUE, class ALLOCATOR, class NODE>
+inline
+bool BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::winkOut()
+{
+    // 'BitwiseCopyable' is a valid surrogate for 'HasTrivialDestructor'.  The
+    // run-time check is made only if the pool has memory to relinquish.
+
+    if (!bsl::is_trivially_copyable<VALUE>::value
+     || !d_pool.hasMemory()
+     || !bslma::ManagedAllocatorUtil::hasManagedMechanism(allocator())) {
+        return false;                                                 // RETURN
+    }
+
+    d_pool.winkOut();
+    return true;
+}
+
 // ACCESSORS
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-const typename
-              SimplePool<bslalg::BidirectionalNode<VALUE>, ALLOCATOR>::
-                                                                 AllocatorType&
-BidirectionalNodePool<VALUE, ALLOCATOR>::allocator() const
+const typename SimplePool<NODE, ALLOCATOR>::AllocatorType&
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::allocator() const
 {
     return d_pool.allocator();
 }
 
 }  // close namespace bslstl
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void bslstl::swap(bslstl::BidirectionalNodePool<VALUE, ALLOCATOR>& a,
-                  bslstl::BidirectionalNodePool<VALUE, ALLOCATOR>& b)
+void bslstl::swap(bslstl::BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& a,
+                  bslstl::BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& b)
 {
     a.swapRetainAllocators(b);
 }
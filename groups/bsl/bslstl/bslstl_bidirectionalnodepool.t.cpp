@@ -6,6 +6,7 @@
 #include <bslalg_bidirectionallink.h>
 #include <bslalg_bidirectionallinklistutil.h>
 #include <bslalg_bidirectionalnode.h>
+#include <bslalg_hashedbidirectionalnode.h>
 
 #include <bslma_allocator.h>
 #include <bslma_default.h>
@@ -14,10 +15,13 @@
 #include <bslma_testallocatormonitor.h>
 #include <bslma_usesbslmaallocator.h>
 
+#include <bslmf_istriviallycopyable.h>
+
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
 
+#include <bsltf_managedtestallocator.h>
 #include <bsltf_stdtestallocator.h>
 #include <bsltf_templatetestfacility.h>
 #include <bsltf_testvaluesarray.h>
@@ -87,6 +91,7 @@ using namespace bslstl;
 // [ 6] void reserveNodes(std::size_t numNodes);
 // [10] void swapRetainAllocators(other);
 // [10] void swapExchangeAllocators(other);
+// [13] bool winkOut();
 //
 // ACCESSORS
 // [ 4] const AllocatorType& allocator() const;
@@ -95,6 +100,8 @@ using namespace bslstl;
 // [10] void swap(BidirectionalNodePool& a, b);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
+// [14] USAGE EXAMPLE
+// [12] CONCERN: 'NODE' may be a type derived from 'BidirectionalNode'.
 // [ *] CONCERN: No memory is ever allocated from the global allocator.
 //-----------------------------------------------------------------------------
 //=============================================================================
@@ -472,6 +479,9 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase13();
+        // Test 'winkOut'.
+
     static void testCase11();
         // Test type traits.
 
@@ -556,6 +566,126 @@ void TestDriver<VALUE>::createFreeBlocks(Obj   *result,
     }
 }
 
+template<class VALUE>
+void TestDriver<VALUE>::testCase13()
+{
+    // ------------------------------------------------------------------------
+    // MANIPULATOR 'winkOut'
+    //
+    // Concerns:
+    //: 1 'winkOut' returns 'true' if, and only if, 'VALUE' is trivially
+    //:   destructible, the pool holds memory, and the allocator of the pool
+    //:   is a managed allocator.
+    //:
+    //: 2 If 'winkOut' returns 'true', no destructor is invoked and no memory
+    //:   is deallocated, and subsequent 'createNode' allocates memory from
+    //:   the allocator.
+    //:
+    //: 3 If 'winkOut' returns 'false', it has no effect: the nodes created
+    //:   from the pool remain valid, and may be deleted.
+    //:
+    //: 4 'winkOut' allocates no memory.
+    //
+    // Plan:
+    //: 1 Using a managed allocator that counts deallocations, and obtains
+    //:   its memory from a test allocator, and (separately) using a test
+    //:   allocator, create and delete various numbers of nodes, and call
+    //:   'winkOut'.  Verify the result, and that no memory was allocated or
+    //:   deallocated.  (C-1..2, 4)
+    //:
+    //: 2 If 'winkOut' returned 'true', verify that 'createNode' allocates
+    //:   memory; otherwise, delete the nodes still in use.  Verify that all
+    //:   memory is returned once the managed allocator is released.  (C-3)
+    //
+    // Testing:
+    //   bool winkOut();
+    // ------------------------------------------------------------------------
+
+    const bool TRIVIAL = bsl::is_trivially_copyable<VALUE>::value;
+
+    if (veryVerbose) P(TRIVIAL);
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    struct {
+        int d_line;
+        int d_numAlloc;
+        int d_numDealloc;
+    } DATA[] = {
+
+    //LINE  ALLOC  DEALLOC
+    //----  -----  -------
+
+    { L_,       0,       0 },
+    { L_,       1,       0 },
+    { L_,       1,       1 },
+    { L_,       2,       1 },
+    { L_,       3,       0 },
+    { L_,       4,       4 },
+    { L_,      33,      17 }
+
+    };
+    int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int LINE     = DATA[ti].d_line;
+        const int ALLOCS   = DATA[ti].d_numAlloc;
+        const int DEALLOCS = DATA[ti].d_numDealloc;
+
+        for (int managed = 0; managed < 2; ++managed) {
+            bslma::TestAllocator        oa("object", veryVeryVeryVerbose);
+            bsltf::ManagedTestAllocator ma(&oa);
+
+            bslma::Allocator *const ALLOC = managed
+                                          ? static_cast<bslma::Allocator *>(
+                                                                          &ma)
+                                          : &oa;
+
+            const bool EXP = TRIVIAL && managed && 0 < ALLOCS;
+
+            {
+                Stack usedX;
+                Stack freeX;
+
+                Obj mX(ALLOC);
+                init(&mX, &usedX, &freeX, ALLOCS, DEALLOCS);
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                const int NUM_DEALLOCS = ma.numDeallocations();
+
+                ASSERTV(LINE, managed, EXP == mX.winkOut());
+
+                ASSERTV(LINE, managed, oam.isTotalSame());
+                ASSERTV(LINE, managed, oam.isInUseSame());
+                ASSERTV(LINE, managed,
+                        NUM_DEALLOCS == ma.numDeallocations());
+
+                if (EXP) {
+                    mX.createNode();
+
+                    ASSERTV(LINE, managed, oam.isTotalUp());
+                }
+                else {
+                    while (!usedX.empty()) {
+                        mX.deleteNode(usedX.back());
+                        usedX.pop();
+                    }
+                }
+            }
+
+            ma.release();
+
+            ASSERTV(LINE, managed, 0 == oa.numBlocksInUse());
+        }
+    }
+
+    // Verify no memory is allocated from the default allocator.
+
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+}
+
 template<class VALUE>
 void TestDriver<VALUE>::testCase11()
 {
@@ -2026,7 +2156,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocatorMonitor gam(&ga);
 
     switch (test) { case 0:
-      case 12: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -2076,6 +2206,92 @@ int main(int argc, char *argv[])
         ASSERT(NUM_DATA == ti);
 
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // MANIPULATOR 'winkOut'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMANIPULATOR 'winkOut'"
+                            "\n=====================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase13,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // CUSTOM NODE TYPE
+        //
+        // Concerns:
+        //: 1 A pool instantiated with a 'NODE' type derived from
+        //:   'bslalg::BidirectionalNode<VALUE>' allocates a footprint large
+        //:   enough for the derived type, so the additional data members of
+        //:   distinct nodes do not overlap.
+        //:
+        //: 2 The 'value' attribute of such a node is constructed by
+        //:   'createNode' and 'cloneNode', and destroyed by 'deleteNode',
+        //:   using the allocator of the pool.
+        //:
+        //: 3 The additional data members of a node are not modified by the
+        //:   pool once the node has been created.
+        //
+        // Plan:
+        //: 1 Using a pool of 'bslalg::HashedBidirectionalNode' holding an
+        //:   allocating type, create a number of nodes, setting the hash code
+        //:   of each node to a distinct value.  Verify the value and hash code
+        //:   of every node after all nodes have been created.  (C-1..3)
+        //:
+        //: 2 Clone a node, and verify the value of the clone.  (C-2)
+        //:
+        //: 3 Delete all nodes, and verify that all memory allocated by the
+        //:   values has been returned to the object allocator.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: 'NODE' may be a type derived from 'BidirectionalNode'.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCUSTOM NODE TYPE"
+                            "\n================\n");
+
+        typedef bsltf::AllocTestType                              VALUE;
+        typedef bsl::allocator<VALUE>                             ALLOC;
+        typedef bslalg::HashedBidirectionalNode<VALUE>            Node;
+        typedef bslstl::BidirectionalNodePool<VALUE, ALLOC, Node> Obj;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        enum { NUM_NODES = 40 };
+        Node *nodes[NUM_NODES];
+
+        {
+            Obj mX(&oa);
+
+            for (int i = 0; i < NUM_NODES; ++i) {
+                nodes[i] = static_cast<Node *>(mX.createNode(VALUE(i, &sa)));
+                nodes[i]->setHashCode(~static_cast<size_t>(i));
+            }
+
+            for (int i = 0; i < NUM_NODES; ++i) {
+                ASSERTV(i, i == nodes[i]->value().data());
+                ASSERTV(i,
+                   ~static_cast<size_t>(i) == nodes[i]->hashCode());
+            }
+
+            Node *clone = static_cast<Node *>(mX.cloneNode(*nodes[7]));
+            ASSERTV(clone->value().data(), 7 == clone->value().data());
+            mX.deleteNode(clone);
+
+            for (int i = 0; i < NUM_NODES; ++i) {
+                mX.deleteNode(nodes[i]);
+            }
+        }
+
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TYPE TRAITS
@@ -19,6 +19,13 @@ BSLS_IDENT("$Id: $")
 // implements a static bitset class that is suitable for use as an
 // implementation of the 'std::bitset' class template.
 //
+// The bits of a 'bsl::bitset' are stored in an array of 64-bit words, and the
+// bulk operations ('count', 'any', 'operator&=', etc.) operate on a whole
+// word at a time.  In addition to the standard interface, 'bsl::bitset'
+// provides the '_Find_first' and '_Find_next' methods offered as an extension
+// by the GNU implementation of 'std::bitset', that efficiently iterate over
+// the bits having the value of 1.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -175,6 +182,10 @@ BSL_OVERRIDES_STD mode"
 #include <bsls_platform.h>
 #endif
 
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
 #ifndef INCLUDED_ALGORITHM
 #include <algorithm>    // 'min'
 #define INCLUDED_ALGORITHM
@@ -225,15 +236,20 @@ class bitset {
     // 'bsl::basic_string', in addition to a 'std::basic_string'.
 
     // PRIVATE TYPES
+    typedef BloombergLP::bsls::Types::Uint64 WordType;
+        // Type of each storage word.  Using a 64-bit word (rather than an
+        // 'int') halves the number of iterations of the word-wise loops
+        // (e.g., 'count', 'operator&=') on all platforms.
+
     enum {
-        BYTESPERINT = sizeof(int),
-        BITSPERINT  = 8 * sizeof(int),
-        BITSETSIZE  = N ? (N - 1) / BITSPERINT + 1 : 1
+        BYTESPERWORD = sizeof(WordType),
+        BITSPERWORD  = 8 * sizeof(WordType),
+        BITSETSIZE   = N ? (N - 1) / BITSPERWORD + 1 : 1
     };
 
     // DATA
-    unsigned int d_data[BITSETSIZE];  // storage for bitset, d_data[0] holds
-                                      // the least significant bit.
+    WordType d_data[BITSETSIZE];  // storage for bitset, d_data[0] holds the
+                                  // least significant bit.
 
     // FRIENDS
     friend class reference;
@@ -248,11 +264,11 @@ class bitset {
         friend class bitset;
 
         // DATA
-        unsigned int *d_int_p;   // pointer to the int inside the bitset.
+        WordType     *d_int_p;   // pointer to the word inside the bitset.
         unsigned int  d_offset;  // bit offset to 'd_int'.
 
         // PRIVATE CREATORS
-        reference(unsigned int *i, unsigned int offset);
+        reference(WordType *i, unsigned int offset);
 
       public:
         // MANIPULATORS
@@ -294,7 +310,7 @@ class bitset {
 
     void clearUnusedBits();
         // Clear the bits unused by the bitset in 'd_data', namely, bits
-        // 'BITSETSIZE * BITSPERINT - 1' to N (where bit count starts at 0).
+        // 'BITSETSIZE * BITSPERWORD - 1' to N (where bit count starts at 0).
 
     void clearUnusedBits(bsl::false_type);
     void clearUnusedBits(bsl::true_type);
@@ -302,7 +318,17 @@ class bitset {
         // are any unused bits.
 
     // PRIVATE ACCESSORS
-    std::size_t numOneSet(unsigned int src) const;
+    std::size_t findFirstFromWord(std::size_t index) const;
+        // Return the position of the least significant bit having the value
+        // of 1 in the words of this bitset at or above the specified 'index',
+        // and 'N' if there is no such bit.
+
+    static std::size_t lowestOneBit(WordType src);
+        // Return the index of the least significant bit having the value of 1
+        // in the specified 'src'.  The behavior is undefined unless
+        // '0 != src'.
+
+    static std::size_t numOneSet(WordType src);
         // Return the number of 1 bits in the specified 'src'.
 
   public:
@@ -471,6 +497,27 @@ class bitset {
         // Return an 'unsigned' 'long' value that has the same bit value as the
         // bitset.  Note that the behavior is undefined if the bitset cannot be
         // represented as an 'unsigned' 'long'.
+
+    std::size_t _Find_first() const;
+        // Return the position of the least significant bit in this bitset
+        // having the value of 1, and 'N' if no bit has the value of 1.  Note
+        // that this method, and '_Find_next', are provided for compatibility
+        // with the extension of the same name offered by the GNU 'std::bitset'
+        // implementation, and skip over a whole word of 0 bits at a time.
+
+    std::size_t _Find_next(std::size_t pos) const;
+        // Return the position of the least significant bit in this bitset
+        // having the value of 1 that is strictly more significant than the
+        // bit at the specified 'pos', and 'N' if there is no such bit.  Note
+        // that the bits having the value of 1 in a bitset 'b' can be visited
+        // in order as follows:
+        //..
+        //  for (std::size_t i = b._Find_first();
+        //       i < b.size();
+        //       i = b._Find_next(i)) {
+        //      // ...
+        //  }
+        //..
 };
 
 // FREE OPERATORS
@@ -508,7 +555,7 @@ operator<<(std::basic_ostream<CHAR_TYPE, TRAITS>& os, const bitset<N>& x);
 // PRIVATE CREATORS
 template <std::size_t N>
 inline
-bitset<N>::reference::reference(unsigned int *i, unsigned int offset)
+bitset<N>::reference::reference(WordType *i, unsigned int offset)
 : d_int_p(i)
 , d_offset(offset)
 {
@@ -522,10 +569,10 @@ typename bitset<N>::reference&
 bitset<N>::reference::operator=(bool x)
 {
     if (x) {
-        *d_int_p |= (1 << d_offset);
+        *d_int_p |= (static_cast<WordType>(1) << d_offset);
     }
     else {
-        *d_int_p &= ~(1 << d_offset);
+        *d_int_p &= ~(static_cast<WordType>(1) << d_offset);
     }
     return *this;
 }
@@ -536,10 +583,10 @@ typename bitset<N>::reference&
 bitset<N>::reference::operator=(const reference& x)
 {
     if (x) {
-        *d_int_p |= (1 << d_offset);
+        *d_int_p |= (static_cast<WordType>(1) << d_offset);
     }
     else {
-        *d_int_p &= ~(1 << d_offset);
+        *d_int_p &= ~(static_cast<WordType>(1) << d_offset);
     }
     return *this;
 }
@@ -549,7 +596,7 @@ inline
 typename bitset<N>::reference&
 bitset<N>::reference::flip()
 {
-    *d_int_p ^= (1 << d_offset);
+    *d_int_p ^= (static_cast<WordType>(1) << d_offset);
     return *this;
 }
 
@@ -558,14 +605,14 @@ template <std::size_t N>
 inline
 bitset<N>::reference::operator bool() const
 {
-    return ((*d_int_p & (1 << d_offset)) != 0);
+    return ((*d_int_p & (static_cast<WordType>(1) << d_offset)) != 0);
 }
 
 template <std::size_t N>
 inline
 bool bitset<N>::reference::operator~() const
 {
-    return ((*d_int_p & (1 << d_offset)) == 0);
+    return ((*d_int_p & (static_cast<WordType>(1) << d_offset)) == 0);
 }
 
                         // ------------
@@ -641,7 +688,7 @@ template <std::size_t N>
 inline
 void bitset<N>::clearUnusedBits()
 {
-    enum { VALUE = N % BITSPERINT ? 1 : 0 };
+    enum { VALUE = N % BITSPERWORD ? 1 : 0 };
 
     clearUnusedBits(bsl::integral_constant<bool, VALUE>());
 }
@@ -656,26 +703,67 @@ template <std::size_t N>
 inline
 void bitset<N>::clearUnusedBits(bsl::true_type)
 {
-    const unsigned int offset = N % BITSPERINT;  // never 0
+    const unsigned int offset = N % BITSPERWORD;  // never 0
 
-    d_data[BITSETSIZE - 1] &= ~(~((unsigned int)0) << offset);
+    d_data[BITSETSIZE - 1] &= ~(~static_cast<WordType>(0) << offset);
 }
 
+// PRIVATE ACCESSORS
 template <std::size_t N>
-std::size_t bitset<N>::numOneSet(unsigned int src) const
+std::size_t bitset<N>::findFirstFromWord(std::size_t index) const
 {
-    // The following code was taken from 'bdes_bitutil'.
-    unsigned input = src;
+    while (index < BITSETSIZE && 0 == d_data[index]) {
+        ++index;
+    }
+    return index < BITSETSIZE
+           ? index * BITSPERWORD + lowestOneBit(d_data[index])
+           : N;
+}
+
+template <std::size_t N>
+inline
+std::size_t bitset<N>::lowestOneBit(WordType src)
+{
+    BSLS_ASSERT_SAFE(0 != src);
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return __builtin_ctzll(src);
+#else
+    std::size_t index = 0;
+    while (!(src & 0xFFFFFFFF)) {
+        src >>= 32;
+        index += 32;
+    }
+    while (!(src & 1)) {
+        src >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+template <std::size_t N>
+inline
+std::size_t bitset<N>::numOneSet(WordType src)
+{
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    // The builtin compiles to a single 'popcnt' instruction when the target
+    // supports it, and to an equivalent of the code below otherwise.
+
+    return __builtin_popcountll(src);
+#else
+    // The following code was adapted from 'bdes_bitutil'.
+    WordType input = src;
 
     // First we use a tricky way of getting every 2-bit half-nibble to
     // represent the number of bits that were set in those two bits.
 
-    input -= (input >> 1) & 0x55555555;
+    input -= (input >> 1) & 0x5555555555555555ULL;
 
     // Henceforth, we just accumulate the sum down into lower and lower bits.
 
     {
-        const int mask = 0x33333333;
+        const WordType mask = 0x3333333333333333ULL;
         input = ((input >> 2) & mask) + (input & mask);
     }
 
@@ -683,7 +771,7 @@ std::size_t bitset<N>::numOneSet(unsigned int src) const
     // do not have to mask both sides of the addition.  We must mask after the
     // addition, so 8-bit bytes are the sum of bits in those 8 bits.
 
-    input = ((input >> 4) + input) & 0x0f0f0f0f;
+    input = ((input >> 4) + input) & 0x0f0f0f0f0f0f0f0fULL;
 
     // It is no longer necessary to mask the additions, because it is
     // impossible for any bit groups to add up to more than 256 and carry, thus
@@ -692,8 +780,10 @@ std::size_t bitset<N>::numOneSet(unsigned int src) const
 
     input = (input >>  8) + input;
     input = (input >> 16) + input;
+    input = (input >> 32) + input;
 
-    return input & 0x000000ff;
+    return static_cast<std::size_t>(input & 0x000000ff);
+#endif
 }
 
 // CREATORS
@@ -701,31 +791,18 @@ template <std::size_t N>
 inline
 bitset<N>::bitset()
 {
-    std::memset(d_data, 0, BITSETSIZE * BYTESPERINT);
+    std::memset(d_data, 0, BITSETSIZE * BYTESPERWORD);
 }
 
 template <std::size_t N>
+inline
 bitset<N>::bitset(unsigned long val)
 {
-    enum {
-        BSLSTL_INTS_IN_LONG = sizeof(unsigned long) / sizeof(int)
-    };
-
-    std::memset(d_data, 0, BITSETSIZE * BYTESPERINT);
-
-    if (1 == BSLSTL_INTS_IN_LONG) {
-        d_data[0] = static_cast<unsigned int>(val);
-    }
-    else {
-        const unsigned int numInts = (unsigned int) BSLSTL_INTS_IN_LONG
-                                                    < (unsigned int) BITSETSIZE
-                                     ? (unsigned int) BSLSTL_INTS_IN_LONG
-                                     : (unsigned int) BITSETSIZE;
+    // An 'unsigned long' is never wider than a 64-bit storage word.
 
-        for (unsigned int i = 0; i < numInts; ++i) {
-            d_data[i] = static_cast<unsigned int>(val >> (BITSPERINT * i));
-        }
-    }
+    std::memset(d_data, 0, BITSETSIZE * BYTESPERWORD);
+    d_data[0] = val;
+    clearUnusedBits();
 }
 
 template <std::size_t N>
@@ -744,7 +821,7 @@ bitset(const    native_std::basic_string<CHAR_TYPE, TRAITS, ALLOCATOR>& str,
                                                "'pos > str.size()' for bitset "
                                                "constructor");
     }
-    std::memset(d_data, 0, BITSETSIZE * BYTESPERINT);
+    std::memset(d_data, 0, BITSETSIZE * BYTESPERWORD);
     copyString(str, pos, StringType::npos);
 }
 
@@ -764,7 +841,7 @@ bitset(const    native_std::basic_string<CHAR_TYPE, TRAITS, ALLOCATOR>& str,
                                                "'pos > str.size()' for bitset "
                                                "constructor");
     }
-    std::memset(d_data, 0, BITSETSIZE * BYTESPERINT);
+    std::memset(d_data, 0, BITSETSIZE * BYTESPERWORD);
     copyString(str, pos, n);
 }
 
@@ -784,7 +861,7 @@ bitset(const    bsl::basic_string<CHAR_TYPE, TRAITS, ALLOCATOR>& str,
                                                "'pos > str.size()' for bitset "
                                                "constructor");
     }
-    std::memset(d_data, 0, BITSETSIZE * BYTESPERINT);
+    std::memset(d_data, 0, BITSETSIZE * BYTESPERWORD);
     copyString(str, pos, StringType::npos);
 }
 
@@ -805,7 +882,7 @@ bitset(const    bsl::basic_string<CHAR_TYPE, TRAITS, ALLOCATOR>& str,
                                                "'pos > str.size()' for bitset "
                                                "constructor");
     }
-    std::memset(d_data, 0, BITSETSIZE * BYTESPERINT);
+    std::memset(d_data, 0, BITSETSIZE * BYTESPERWORD);
     copyString(str, pos, n);
 }
 
@@ -843,20 +920,20 @@ bitset<N>& bitset<N>::operator<<=(std::size_t pos)
     BSLS_ASSERT_SAFE(pos <= N);
 
     if (pos) {
-        const std::size_t shift  = pos / BITSPERINT;
-        const std::size_t offset = pos % BITSPERINT;
+        const std::size_t shift  = pos / BITSPERWORD;
+        const std::size_t offset = pos % BITSPERWORD;
 
         if (shift) {
             std::memmove(d_data + shift,
                          d_data,
-                         (BITSETSIZE - shift) * BYTESPERINT);
-            std::memset(d_data, 0, shift * BYTESPERINT);
+                         (BITSETSIZE - shift) * BYTESPERWORD);
+            std::memset(d_data, 0, shift * BYTESPERWORD);
         }
 
         if (offset) {
             for (std::size_t i = BITSETSIZE - 1; i > shift; --i) {
                 d_data[i] = (d_data[i] << offset) |
-                                        (d_data[i-1] >> (BITSPERINT - offset));
+                                       (d_data[i-1] >> (BITSPERWORD - offset));
             }
             d_data[shift] <<= offset;
         }
@@ -872,20 +949,20 @@ bitset<N>& bitset<N>::operator>>=(std::size_t pos)
     BSLS_ASSERT_SAFE(pos <= N);
 
     if (pos) {
-        const std::size_t shift  = pos / BITSPERINT;
-        const std::size_t offset = pos % BITSPERINT;
+        const std::size_t shift  = pos / BITSPERWORD;
+        const std::size_t offset = pos % BITSPERWORD;
 
         if (shift) {
             std::memmove(d_data,
                          d_data + shift,
-                         (BITSETSIZE - shift) * BYTESPERINT);
-            std::memset(d_data + BITSETSIZE - shift, 0, shift * BYTESPERINT);
+                         (BITSETSIZE - shift) * BYTESPERWORD);
+            std::memset(d_data + BITSETSIZE - shift, 0, shift * BYTESPERWORD);
         }
 
         if (offset) {
             for (std::size_t i = 0; i < BITSETSIZE - shift - 1; ++i) {
                 d_data[i] = (d_data[i] >> offset) |
-                                        (d_data[i+1] << (BITSPERINT - offset));
+                                       (d_data[i+1] << (BITSPERWORD - offset));
             }
             d_data[BITSETSIZE - shift - 1] >>= offset;
         }
@@ -911,9 +988,9 @@ bitset<N>& bitset<N>::flip(std::size_t pos)
 {
     BSLS_ASSERT_SAFE(pos < N);
 
-    const std::size_t shift  = pos / BITSPERINT;
-    const std::size_t offset = pos % BITSPERINT;
-    d_data[shift] ^= (1 << offset);
+    const std::size_t shift  = pos / BITSPERWORD;
+    const std::size_t offset = pos % BITSPERWORD;
+    d_data[shift] ^= (static_cast<WordType>(1) << offset);
     return *this;
 }
 
@@ -921,7 +998,7 @@ template <std::size_t N>
 inline
 bitset<N>& bitset<N>::reset()
 {
-    std::memset(d_data, 0, BITSETSIZE * BYTESPERINT);
+    std::memset(d_data, 0, BITSETSIZE * BYTESPERWORD);
     return *this;
 }
 
@@ -931,9 +1008,9 @@ bitset<N>& bitset<N>::reset(std::size_t pos)
 {
     BSLS_ASSERT_SAFE(pos < N);
 
-    const std::size_t shift  = pos / BITSPERINT;
-    const std::size_t offset = pos % BITSPERINT;
-    d_data[shift] &= ~(1 << offset);
+    const std::size_t shift  = pos / BITSPERWORD;
+    const std::size_t offset = pos % BITSPERWORD;
+    d_data[shift] &= ~(static_cast<WordType>(1) << offset);
     return *this;
 }
 
@@ -941,7 +1018,7 @@ template <std::size_t N>
 inline
 bitset<N>& bitset<N>::set()
 {
-    std::memset(d_data, 0xFF, BITSETSIZE * BYTESPERINT);
+    std::memset(d_data, 0xFF, BITSETSIZE * BYTESPERWORD);
     clearUnusedBits();
     return *this;
 }
@@ -951,13 +1028,13 @@ bitset<N>& bitset<N>::set(std::size_t pos, int val)
 {
     BSLS_ASSERT_SAFE(pos < N);
 
-    const std::size_t shift  = pos / BITSPERINT;
-    const std::size_t offset = pos % BITSPERINT;
+    const std::size_t shift  = pos / BITSPERWORD;
+    const std::size_t offset = pos % BITSPERWORD;
     if (val) {
-        d_data[shift] |= (1 << offset);
+        d_data[shift] |= (static_cast<WordType>(1) << offset);
     }
     else {
-        d_data[shift] &= ~(1 << offset);
+        d_data[shift] &= ~(static_cast<WordType>(1) << offset);
     }
     return *this;
 }
@@ -968,8 +1045,8 @@ typename bitset<N>::reference bitset<N>::operator[](std::size_t pos)
 {
     BSLS_ASSERT_SAFE(pos < N);
 
-    const std::size_t shift  = pos / BITSPERINT;
-    const std::size_t offset = pos % BITSPERINT;
+    const std::size_t shift  = pos / BITSPERWORD;
+    const std::size_t offset = pos % BITSPERWORD;
     return typename bitset<N>::reference(&d_data[shift],
                                          static_cast<unsigned int>(offset));
 }
@@ -1009,16 +1086,16 @@ bool bitset<N>::operator[](std::size_t pos) const
 {
     BSLS_ASSERT_SAFE(pos < N);
 
-    const std::size_t shift  = pos / BITSPERINT;
-    const std::size_t offset = pos % BITSPERINT;
-    return ((d_data[shift] & (1 << offset)) != 0);
+    const std::size_t shift  = pos / BITSPERWORD;
+    const std::size_t offset = pos % BITSPERWORD;
+    return ((d_data[shift] & (static_cast<WordType>(1) << offset)) != 0);
 }
 
 template <std::size_t N>
 inline
 bool bitset<N>::operator==(const bitset& rhs) const
 {
-    return std::memcmp(d_data, rhs.d_data, BITSETSIZE * BYTESPERINT) == 0;
+    return std::memcmp(d_data, rhs.d_data, BITSETSIZE * BYTESPERWORD) == 0;
 }
 
 template <std::size_t N>
@@ -1092,28 +1169,44 @@ bool bitset<N>::test(size_t pos) const
 template <std::size_t N>
 unsigned long bitset<N>::to_ulong() const
 {
-    enum {
-        BSLSTL_INTS_IN_LONG = sizeof(unsigned long) / sizeof(int)
-    };
+    const std::size_t bitsInLong = 8 * sizeof(unsigned long);
+
+    const WordType highBits = bitsInLong < BITSPERWORD
+                            ? d_data[0] >> (bitsInLong % BITSPERWORD)
+                            : 0;
+    bool overflow = 0 != highBits;
+    for (std::size_t i = 1; i < BITSETSIZE; ++i) {
+        overflow |= 0 != d_data[i];
+    }
 
-    for (std::size_t i = BSLSTL_INTS_IN_LONG; i < BITSETSIZE; ++i) {
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_data[i])) {
-            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-            BloombergLP::bslstl::StdExceptUtil::throwOverflowError(
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(overflow)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOverflowError(
                                         "overflow in bsl::bitset<>::to_ulong");
-        }
     }
 
-    unsigned long      value   = 0;
-    const unsigned int numInts = (unsigned int) BSLSTL_INTS_IN_LONG
-                                                    < (unsigned int) BITSETSIZE
-                               ? (unsigned int) BSLSTL_INTS_IN_LONG
-                               : (unsigned int) BITSETSIZE;
+    return static_cast<unsigned long>(d_data[0]);
+}
+
+template <std::size_t N>
+inline
+std::size_t bitset<N>::_Find_first() const
+{
+    return findFirstFromWord(0);
+}
 
-    for (unsigned int i = 0; i < numInts; ++i) {
-        value |= (unsigned long) d_data[i] << (BITSPERINT * i);
+template <std::size_t N>
+std::size_t bitset<N>::_Find_next(std::size_t pos) const
+{
+    ++pos;
+    if (pos >= N) {
+        return N;                                                     // RETURN
     }
-    return value;
+
+    const std::size_t shift = pos / BITSPERWORD;
+    const WordType    word  = d_data[shift] >> (pos % BITSPERWORD);
+
+    return word ? pos + lowestOneBit(word) : findFirstFromWord(shift + 1);
 }
 
 // FREE OPERATORS
@@ -5,10 +5,14 @@
 
 #include <bslmf_assert.h>
 
+#include <bsls_stopwatch.h>
+
 #include <bsls_nativestd.h>
 
+#include <climits>
 #include <cstdlib>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 
 #include <cmath>  // native_std::sqrt
@@ -63,9 +67,9 @@ using namespace std;
 //
 // MANIPULATORS:
 // [ 3] reference operator[](std::size_t pos)
-// [  ] bitset& operator&=(const bitset &lhs)
-// [  ] bitset& operator|=(const bitset &lhs)
-// [  ] bitset& operator^=(const bitset &lhs)
+// [12] bitset& operator&=(const bitset &lhs)
+// [12] bitset& operator|=(const bitset &lhs)
+// [12] bitset& operator^=(const bitset &lhs)
 // [11] bitset& operator<<=(std::size_t pos)
 // [11] bitset& operator>>=(std::size_t pos)
 // [  ] bitset& flip()
@@ -86,9 +90,11 @@ using namespace std;
 // [ 3] bool any() const
 // [ 3] bool none() const
 // [  ] std::size_t size() const
-// [  ] std::size_t count() const
+// [12] std::size_t count() const
 // [  ] bool test(std::size_t) const
-// [  ] unsigned long to_ulong() const
+// [12] unsigned long to_ulong() const
+// [12] std::size_t _Find_first() const
+// [12] std::size_t _Find_next(std::size_t pos) const
 //
 //
 // FREE OPERATORS:
@@ -99,7 +105,8 @@ using namespace std;
 // [  ] operator<<(std::ostream &os, const bitset<N>& x)
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
+// [-2] PERFORMANCE: 'count' AND '_Find_next'
 //-----------------------------------------------------------------------------
 
 //==========================================================================
@@ -285,6 +292,119 @@ void testCase3(int verbose, int veryVerbose, int veryVeryVerbose)
     }
 }
 
+class BitGenerator {
+    // This class provides a deterministic pseudo-random sequence of bits.
+
+    // DATA
+    unsigned long d_state;  // linear congruential generator state
+
+  public:
+    // CREATORS
+    explicit BitGenerator(unsigned long seed) : d_state(seed) {}
+        // Create a generator whose sequence is determined by the specified
+        // 'seed'.
+
+    // MANIPULATORS
+    bool operator()(int density)
+        // Return the next bit in the sequence of this generator, having the
+        // value 'true' with an approximate probability of the specified
+        // 'density' percent.
+    {
+        d_state = d_state * 1103515245 + 12345;
+        return static_cast<int>((d_state >> 16) % 100) < density;
+    }
+};
+
+template <int TESTSIZE>
+void testCase12(int verbose, int veryVerbose, int veryVeryVerbose)
+{
+    typedef bsl::bitset<TESTSIZE> Obj;
+
+    if (verbose) cout << "	Check bitset<" << TESTSIZE << ">" << endl;
+
+    static const int DENSITIES[] = { 0, 1, 10, 50, 90, 100 };
+    const int NUM_DENSITIES = sizeof DENSITIES / sizeof *DENSITIES;
+
+    BitGenerator generator(TESTSIZE);
+
+    for (int ti = 0; ti < NUM_DENSITIES; ++ti) {
+        const int DENSITY = DENSITIES[ti];
+
+        Obj mX;  const Obj& X = mX;
+        Obj mY;  const Obj& Y = mY;
+        for (std::size_t i = 0; i < TESTSIZE; ++i) {
+            mX[i] = generator(DENSITY);
+            mY[i] = generator(DENSITY);
+        }
+
+        if (veryVerbose) {
+            T_ P_(DENSITY) P_(X.count()) P(Y.count());
+        }
+
+        // 'count'
+
+        std::size_t expCount = 0;
+        for (std::size_t i = 0; i < TESTSIZE; ++i) {
+            expCount += X[i];
+        }
+        LOOP2_ASSERT(TESTSIZE, DENSITY, expCount == X.count());
+
+        // '_Find_first' and '_Find_next'
+
+        std::size_t expPos = 0;
+        while (expPos < TESTSIZE && !X[expPos]) {
+            ++expPos;
+        }
+        LOOP3_ASSERT(TESTSIZE, DENSITY, expPos, expPos == X._Find_first());
+
+        std::size_t numVisited = 0;
+        for (std::size_t pos = X._Find_first();
+             pos < TESTSIZE;
+             pos = X._Find_next(pos)) {
+            LOOP3_ASSERT(TESTSIZE, DENSITY, pos, X[pos]);
+            ++numVisited;
+        }
+        LOOP2_ASSERT(TESTSIZE, DENSITY, expCount == numVisited);
+
+        for (std::size_t pos = 0; pos < TESTSIZE; ++pos) {
+            std::size_t expNext = pos + 1;
+            while (expNext < TESTSIZE && !X[expNext]) {
+                ++expNext;
+            }
+            LOOP3_ASSERT(TESTSIZE, DENSITY, pos,
+                         expNext == X._Find_next(pos));
+        }
+
+        // 'operator&=', 'operator|=', and 'operator^='
+
+        Obj mA(X);  const Obj& A = mA;
+        Obj mO(X);  const Obj& O = mO;
+        Obj mE(X);  const Obj& E = mE;
+
+        mA &= Y;
+        mO |= Y;
+        mE ^= Y;
+
+        for (std::size_t i = 0; i < TESTSIZE; ++i) {
+            LOOP3_ASSERT(TESTSIZE, DENSITY, i, A[i] == (X[i] && Y[i]));
+            LOOP3_ASSERT(TESTSIZE, DENSITY, i, O[i] == (X[i] || Y[i]));
+            LOOP3_ASSERT(TESTSIZE, DENSITY, i, E[i] == (X[i] != Y[i]));
+        }
+        LOOP2_ASSERT(TESTSIZE, DENSITY, A.count() + E.count() == O.count());
+        LOOP2_ASSERT(TESTSIZE, DENSITY, (~X).count() == TESTSIZE - X.count());
+    }
+
+    // The value constructor discards the bits of 'val' beyond 'TESTSIZE'.
+
+    const Obj ALL(~0UL);
+    const std::size_t EXP = TESTSIZE < sizeof(unsigned long) * CHAR_BIT
+                          ? TESTSIZE
+                          : sizeof(unsigned long) * CHAR_BIT;
+    LOOP_ASSERT(TESTSIZE, EXP == ALL.count());
+    LOOP_ASSERT(TESTSIZE, 0 == ALL._Find_first());
+    LOOP_ASSERT(TESTSIZE, TESTSIZE == ALL._Find_next(EXP - 1));
+}
+
 } // close unnamed namespace
 
 //=============================================================================
@@ -397,7 +517,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // zero is always the leading case
-    case 12: {
+    case 13: {
       // --------------------------------------------------------------------
       // USAGE EXAMPLE TEST
       //
@@ -425,6 +545,101 @@ int main(int argc, char *argv[])
       //..
     } break;
 
+    case 12: {
+      // --------------------------------------------------------------------
+      // BIT COUNTING, SEARCH, AND BULK OPERATOR TEST
+      //
+      // Concerns:
+      //: 1 That 'count' returns the number of bits having the value 1,
+      //:   irrespective of where they fall relative to word boundaries.
+      //:
+      //: 2 That '_Find_first' and '_Find_next' visit exactly the bits having
+      //:   the value 1, in increasing order, and return 'N' when there is
+      //:   no such bit.
+      //:
+      //: 3 That 'operator&=', 'operator|=', and 'operator^=' combine every
+      //:   bit, including those in the last (partially used) word.
+      //:
+      //: 4 That 'to_ulong' returns the value of the bitset, and reports
+      //:   overflow if any bit beyond those of an 'unsigned long' is set.
+      //:
+      //: 5 That the value constructor discards the bits of its argument
+      //:   beyond 'N'.
+      //
+      // Plan:
+      //: 1 For bitsets of sizes straddling the word boundaries, and for a
+      //:   range of densities of set bits, generate pseudo-random values and
+      //:   compare the results of 'count', '_Find_first', '_Find_next', and
+      //:   the bulk operators against oracles computed one bit at a time
+      //:   using 'operator[]'.  (C-1..3, 5)
+      //:
+      //: 2 Convert values to 'unsigned long', and verify that a set bit
+      //:   beyond those representable raises 'std::overflow_error'.  (C-4)
+      //
+      // Testing:
+      //   bitset& operator&=(const bitset &lhs)
+      //   bitset& operator|=(const bitset &lhs)
+      //   bitset& operator^=(const bitset &lhs)
+      //   std::size_t count() const
+      //   unsigned long to_ulong() const
+      //   std::size_t _Find_first() const
+      //   std::size_t _Find_next(std::size_t pos) const
+      // --------------------------------------------------------------------
+
+      if (verbose) cout << endl
+                        << "BIT COUNTING, SEARCH, AND BULK OPERATOR TEST"
+                        << endl
+                        << "============================================"
+                        << endl;
+
+      testCase12<1>(verbose, veryVerbose, veryVeryVerbose);
+      testCase12<2>(verbose, veryVerbose, veryVeryVerbose);
+      testCase12<31>(verbose, veryVerbose, veryVeryVerbose);
+      testCase12<32>(verbose, veryVerbose, veryVeryVerbose);
+      testCase12<33>(verbose, veryVerbose, veryVeryVerbose);
+      testCase12<63>(verbose, veryVerbose, veryVeryVerbose);
+      testCase12<64>(verbose, veryVerbose, veryVeryVerbose);
+      testCase12<65>(verbose, veryVerbose, veryVeryVerbose);
+      testCase12<127>(verbose, veryVerbose, veryVeryVerbose);
+      testCase12<128>(verbose, veryVerbose, veryVeryVerbose);
+      testCase12<129>(verbose, veryVerbose, veryVeryVerbose);
+      testCase12<1000>(verbose, veryVerbose, veryVeryVerbose);
+
+      if (verbose) cout << "\tTesting 'to_ulong'." << endl;
+      {
+          const unsigned long BIG = ~0UL;
+
+          ASSERT(BIG == bsl::bitset<sizeof(unsigned long) * CHAR_BIT>(
+                                                            BIG).to_ulong());
+          ASSERT(BIG == bsl::bitset<200>(BIG).to_ulong());
+          ASSERT(0x5 == bsl::bitset<3>(0xD).to_ulong());
+
+#ifdef BDE_BUILD_TARGET_EXC
+          bsl::bitset<200> mX(BIG);
+          mX[sizeof(unsigned long) * CHAR_BIT] = 1;
+          bool caught = false;
+          try {
+              mX.to_ulong();
+          }
+          catch (const std::overflow_error&) {
+              caught = true;
+          }
+          ASSERT(caught);
+
+          mX.reset();
+          mX[199] = 1;
+          caught = false;
+          try {
+              mX.to_ulong();
+          }
+          catch (const std::overflow_error&) {
+              caught = true;
+          }
+          ASSERT(caught);
+#endif
+      }
+    } break;
+
     case 11: {
       // --------------------------------------------------------------------
       // SHIFT OPERATOR TEST
@@ -1002,6 +1217,74 @@ int main(int argc, char *argv[])
            << endl;
     } break;
 
+    case -2: {
+      // --------------------------------------------------------------------
+      // PERFORMANCE: 'count' AND '_Find_next'
+      //
+      // Concerns:
+      //: 1 That 'count', and iteration over the set bits using '_Find_next',
+      //:   are substantially faster than the equivalent loops testing each
+      //:   bit with 'operator[]'.
+      //
+      // Plan:
+      //: 1 Time each of the loops over a large, sparsely populated bitset,
+      //:   and report the elapsed times.  (C-1)
+      //
+      // Testing:
+      //   PERFORMANCE: 'count' AND '_Find_next'
+      // --------------------------------------------------------------------
+
+      if (verbose) cout << endl
+                        << "PERFORMANCE: 'count' AND '_Find_next'" << endl
+                        << "=====================================" << endl;
+
+      enum { SIZE = 1 << 16, ITERATIONS = 200 };
+
+      static bsl::bitset<SIZE> mX;  const bsl::bitset<SIZE>& X = mX;
+      BitGenerator generator(SIZE);
+      for (std::size_t i = 0; i < SIZE; ++i) {
+          mX[i] = generator(1);
+      }
+
+      std::size_t total = 0;
+
+      bsls::Stopwatch timer;
+      timer.start();
+      for (int i = 0; i < ITERATIONS; ++i) {
+          for (std::size_t pos = 0; pos < SIZE; ++pos) {
+              total += X[pos];
+          }
+      }
+      timer.stop();
+      const double bitTime = timer.elapsedTime();
+
+      timer.reset();
+      timer.start();
+      for (int i = 0; i < ITERATIONS; ++i) {
+          total += X.count();
+      }
+      timer.stop();
+      const double countTime = timer.elapsedTime();
+
+      timer.reset();
+      timer.start();
+      for (int i = 0; i < ITERATIONS; ++i) {
+          for (std::size_t pos = X._Find_first();
+               pos < SIZE;
+               pos = X._Find_next(pos)) {
+              ++total;
+          }
+      }
+      timer.stop();
+      const double findTime = timer.elapsedTime();
+
+      ASSERT(3 * ITERATIONS * X.count() == total);
+
+      cout << "operator[] loop: " << bitTime   << "s" << endl
+           << "count:           " << countTime << "s" << endl
+           << "_Find_next loop: " << findTime  << "s" << endl;
+    } break;
+
     default: {
       cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
       testStatus = -1;
@@ -210,6 +210,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLMA_MANAGEDALLOCATOR
+#include <bslma_managedallocator.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ASSERT
 #include <bslmf_assert.h>
 #endif
@@ -218,6 +222,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslmf_issame.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_MATCHANYTYPE
 #include <bslmf_matchanytype.h>
 #endif
@@ -742,7 +750,11 @@ class deque : public  Deque_Base<VALUE_TYPE>
         // the ISO standard).
 
     ~deque();
-        // Destroy this deque object.
+        // Destroy this deque object.  If 'VALUE_TYPE' is trivially
+        // destructible and the mechanism of the allocator of this deque is a
+        // 'bslma::ManagedAllocator', the blocks of this deque are not
+        // deallocated, their memory being reclaimed when the managed
+        // allocator is released (see 'bslma_managedallocator').
 
     // MANIPULATORS
     deque& operator=(const deque& rhs);
@@ -2080,6 +2092,17 @@ deque<VALUE_TYPE,ALLOCATOR>::~deque()
         return;                                                       // RETURN
     }
 
+    // 'BitwiseCopyable' is a valid surrogate for 'HasTrivialDestructor'.
+
+    if (bsl::is_trivially_copyable<VALUE_TYPE>::value
+     && BloombergLP::bslma::ManagedAllocatorUtil::hasManagedMechanism(
+                                                         this->allocator())) {
+        // Wink out: the memory of the blocks, and of the array of block
+        // pointers, is reclaimed when the managed allocator is released.
+
+        return;                                                       // RETURN
+    }
+
     if (0 != this->d_start.blockPtr()) {
         // Destroy all elements and deallocate all but one block.
 
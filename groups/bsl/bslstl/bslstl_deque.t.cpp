@@ -10,6 +10,7 @@
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>   // for testing only
+#include <bslma_multipoolallocator.h>      // for testing only
 #include <bslma_testallocator.h>           // for testing only
 #include <bslma_testallocatorexception.h>  // for testing only
 #include <bslmf_ispointer.h>               // for testing only
@@ -19,6 +20,7 @@
 #include <bsls_types.h>                    // for testing only
 #include <bsls_stopwatch.h>                // for testing only
 #include <bsls_util.h>
+#include <bsltf_managedtestallocator.h>    // for testing only
 
 #include <iterator>
 
@@ -147,6 +149,7 @@ using namespace bsl;
 // [11] ALLOCATOR-RELATED CONCERNS
 // [18] USAGE EXAMPLE
 // [22] CONCERN: 'std::length_error' is used properly
+// [25] CONCERN: Destruction winks out with a managed allocator.
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(deque<T,A> *object, const char *spec, int vF = 1);
@@ -7867,6 +7870,7 @@ void TestDriver<TYPE,ALLOC>::testCase1()
     ASSERT(  X4 == X4 );          ASSERT(!(X4 != X4));
 }
 
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -7906,7 +7910,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         //
@@ -8112,7 +8116,7 @@ int main(int argc, char *argv[])
         }
 //..
       } break;
-      case 25: {
+      case 26: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         //
@@ -8179,6 +8183,153 @@ int main(int argc, char *argv[])
         // Next: Wally Walters
         // Next: Fred Flintstone
       } break;
+      case 25: {
+        // --------------------------------------------------------------------
+        // TESTING WINK-OUT ON DESTRUCTION
+        //
+        // Concerns:
+        //: 1 A deque whose elements are trivially destructible, and whose
+        //:   allocator is a 'bslma::ManagedAllocator', does not return its
+        //:   blocks or its block array to the allocator on destruction.
+        //:
+        //: 2 The memory of such a deque is reclaimed by releasing the
+        //:   allocator.
+        //:
+        //: 3 A deque whose elements are not trivially destructible destroys
+        //:   each of its elements on destruction, even if its allocator is a
+        //:   'bslma::ManagedAllocator'.
+        //:
+        //: 4 A deque whose allocator is not a 'bslma::ManagedAllocator'
+        //:   returns all of its memory on destruction.
+        //:
+        //: 5 Repeatedly creating and destroying a deque of 'int' values whose
+        //:   allocator is a 'bslma::MultipoolAllocator', which recycles the
+        //:   memory returned to it and is not a managed allocator, does not
+        //:   increase the memory that the multipool obtains from its upstream
+        //:   allocator.
+        //
+        // Plan:
+        //: 1 Create a deque of 'int' values with a 'ManagedTestAllocator',
+        //:   add and remove some elements, destroy the deque, and verify that
+        //:   the allocator was not called to deallocate.  Release the
+        //:   allocator and verify that all memory is returned upstream.
+        //:   (C-1..2)
+        //:
+        //: 2 Repeat P-1 with a deque of 'bsl::string' values, each too long
+        //:   for the short-string buffer, and verify that each remaining
+        //:   element deallocates its memory on destruction of the deque.
+        //:   (C-3)
+        //:
+        //: 3 Repeat P-1 with a deque whose allocator is a test allocator, and
+        //:   verify that all memory is returned on destruction.  (C-4)
+        //:
+        //: 4 Create and destroy a deque of 'int' values using a
+        //:   'bslma::MultipoolAllocator' many times, and verify that the
+        //:   memory in use from the upstream test allocator after the first
+        //:   iteration does not change.  (C-5)
+        //
+        // Testing:
+        //   CONCERN: Destruction winks out with a managed allocator.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING WINK-OUT ON DESTRUCTION"
+                            "\n===============================\n");
+
+        const int  NUM_VALUES    = 100;
+        const char LONG_STRING[] = "a string too long for the short buffer";
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tTrivially destructible elements.\n");
+        {
+            typedef bsl::deque<int> Obj;
+
+            bslma::TestAllocator        oa("object", veryVeryVeryVerbose);
+            bsltf::ManagedTestAllocator ma(&oa);
+
+            int numDeallocations;
+            {
+                Obj mX(&ma);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX.push_back(i);
+                }
+                for (int i = 0; i < NUM_VALUES / 2; ++i) {
+                    mX.pop_front();
+                }
+                numDeallocations = ma.numDeallocations();
+            }
+            LOOP2_ASSERT(numDeallocations,   ma.numDeallocations(),
+                         numDeallocations == ma.numDeallocations());
+            LOOP_ASSERT(oa.numBlocksInUse(), 0 < oa.numBlocksInUse());
+
+            ma.release();
+            LOOP_ASSERT(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tElements that allocate memory.\n");
+        {
+            typedef bsl::deque<bsl::string> Obj;
+
+            bslma::TestAllocator        oa("object", veryVeryVeryVerbose);
+            bsltf::ManagedTestAllocator ma(&oa);
+
+            int numDeallocations;
+            {
+                Obj mX(&ma);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX.push_back(LONG_STRING);
+                }
+                for (int i = 0; i < NUM_VALUES / 2; ++i) {
+                    mX.pop_front();
+                }
+                numDeallocations = ma.numDeallocations();
+            }
+            LOOP2_ASSERT(numDeallocations,   ma.numDeallocations(),
+                         numDeallocations + NUM_VALUES / 2
+                                                  <= ma.numDeallocations());
+        }
+
+        if (verbose) printf("\tAllocator that is not managed.\n");
+        {
+            typedef bsl::deque<int> Obj;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                Obj mX(&oa);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX.push_back(i);
+                }
+                LOOP_ASSERT(oa.numBlocksInUse(), 0 < oa.numBlocksInUse());
+            }
+            LOOP_ASSERT(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tMultipool allocator.\n");
+        {
+            typedef bsl::deque<int> Obj;
+
+            const int NUM_ITERATIONS = 100;
+
+            bslma::TestAllocator      oa("object", veryVeryVeryVerbose);
+            bslma::MultipoolAllocator mpa(&oa);
+
+            bsls::Types::Int64 numBytes = 0;
+            for (int ti = 0; ti < NUM_ITERATIONS; ++ti) {
+                {
+                    Obj mX(&mpa);
+                    for (int i = 0; i < NUM_VALUES; ++i) {
+                        mX.push_back(i);
+                    }
+                }
+                if (0 == ti) {
+                    numBytes = oa.numBytesInUse();
+                }
+                LOOP2_ASSERT(ti, oa.numBytesInUse(),
+                             numBytes == oa.numBytesInUse());
+            }
+        }
+      } break;
       case 24: {
         // --------------------------------------------------------------------
         // TESTING EXCEPTIONS
@@ -0,0 +1,606 @@
+// bslstl_flathashmap.t.cpp                                           -*-C++-*-
+#include <bslstl_flathashmap.h>
+
+#include <bslstl_string.h>
+
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <stdexcept>  // for 'std::out_of_range'
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test defines a container, 'bsl::flat_hash_map', whose
+// methods forward to an underlying 'bslstl::FlatHashTable', which is tested
+// thoroughly by its own test driver.  This test driver therefore verifies
+// that each method of the container is correctly forwarded, that the
+// map-specific methods 'operator[]' and 'at' behave as specified, and that
+// the container has the expected type traits.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 3] explicit flat_hash_map(size_type, hasher, key_equal, allocator);
+// [ 2] explicit flat_hash_map(const allocator_type& allocator);
+// [ 3] flat_hash_map(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+// [ 4] flat_hash_map(const flat_hash_map& original);
+// [ 4] flat_hash_map(const flat_hash_map& original, const allocator_type&);
+//
+// MANIPULATORS
+// [ 4] flat_hash_map& operator=(const flat_hash_map& rhs);
+// [ 2] mapped_type& operator[](const key_type& key);
+// [ 2] mapped_type& at(const key_type& key);
+// [ 3] iterator begin();
+// [ 3] iterator end();
+// [ 3] void clear();
+// [ 3] iterator erase(const_iterator position);
+// [ 3] size_type erase(const key_type& key);
+// [ 3] iterator erase(const_iterator first, const_iterator last);
+// [ 3] iterator find(const key_type& key);
+// [ 3] pair<iterator, bool> insert(const value_type& value);
+// [ 3] iterator insert(const_iterator hint, const value_type& value);
+// [ 3] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 3] void rehash(size_type numSlots);
+// [ 3] void reserve(size_type numElements);
+// [ 4] void swap(flat_hash_map& other);
+//
+// ACCESSORS
+// [ 3] allocator_type get_allocator() const;
+// [ 2] const mapped_type& at(const key_type& key) const;
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator cend() const;
+// [ 3] size_type capacity() const;
+// [ 3] size_type count(const key_type& key) const;
+// [ 3] bool empty() const;
+// [ 3] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 3] const_iterator find(const key_type& key) const;
+// [ 3] hasher hash_function() const;
+// [ 3] key_equal key_eq() const;
+// [ 3] float load_factor() const;
+// [ 3] float max_load_factor() const;
+// [ 3] size_type max_size() const;
+// [ 3] size_type size() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const flat_hash_map& lhs, const flat_hash_map& rhs);
+// [ 4] bool operator!=(const flat_hash_map& lhs, const flat_hash_map& rhs);
+// [ 4] void swap(flat_hash_map& x, flat_hash_map& y);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 5] TYPE TRAITS
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_hash_map<int, int>         Obj;
+typedef bsl::flat_hash_map<bsl::string, int> StringObj;
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+static void usageExample()
+{
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Word Frequencies
+///- - - - - - - - - - - - - - - - - -
+// Suppose we want to count the number of occurrences of each word in a
+// document.  The set of distinct words is small compared to the document, so
+// the counts are looked up far more often than they are inserted, which makes
+// a 'flat_hash_map' a good fit.
+//
+// First, we define the words of a (short) document:
+//..
+    const char *WORDS[] = { "the", "quick", "brown", "fox", "jumps",
+                            "over", "the", "lazy", "dog", "the", "end" };
+    const int   NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+//..
+// Then, we count the occurrences of each word, relying on 'operator[]' to
+// insert a count of 0 for each word not yet seen:
+//..
+    bslma::TestAllocator                 oa;
+    bsl::flat_hash_map<bsl::string, int> counts(&oa);
+
+    for (int i = 0; i < NUM_WORDS; ++i) {
+        ++counts[WORDS[i]];
+    }
+//..
+// Finally, we verify the counts:
+//..
+    ASSERT(9 == counts.size());
+    ASSERT(3 == counts["the"]);
+    ASSERT(1 == counts.at("fox"));
+    ASSERT(counts.end() == counts.find("cat"));
+//..
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: No memory is ever allocated from the global allocator.
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        usageExample();
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TYPE TRAITS
+        //
+        // Concerns:
+        //: 1 'flat_hash_map' defines STL iterators.
+        //:
+        //: 2 'flat_hash_map' uses 'bslma' allocators if and only if its
+        //:   allocator type is convertible from 'bslma::Allocator *'.
+        //
+        // Plan:
+        //: 1 Verify the values of the traits.  (C-1..2)
+        //
+        // Testing:
+        //   TYPE TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTYPE TRAITS"
+                            "\n===========\n");
+
+        ASSERT(bslalg::HasStlIterators<Obj>::value);
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Copy construction, assignment, swap and the equality operators
+        //:   are forwarded to the underlying table.
+        //:
+        //: 2 Maps having the same keys compare equal only if their mapped
+        //:   values are also equal.
+        //
+        // Plan:
+        //: 1 Copy, assign and swap maps of 'bsl::string' keys, and compare the
+        //:   results using the equality operators.  (C-1..2)
+        //
+        // Testing:
+        //   flat_hash_map(const flat_hash_map& original);
+        //   flat_hash_map(const flat_hash_map&, const allocator_type&);
+        //   flat_hash_map& operator=(const flat_hash_map& rhs);
+        //   void swap(flat_hash_map& other);
+        //   bool operator==(const flat_hash_map&, const flat_hash_map&);
+        //   bool operator!=(const flat_hash_map&, const flat_hash_map&);
+        //   void swap(flat_hash_map& x, flat_hash_map& y);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP AND EQUALITY"
+                            "\n===================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+            mX["alpha"] = 1;
+            mX["beta"]  = 2;
+            mX["a string too long for the short string buffer"] = 3;
+
+            StringObj mY(X, &oa);  const StringObj& Y = mY;
+            ASSERT(X == Y);
+            ASSERT(&oa == Y.get_allocator());
+
+            StringObj mZ(X);  const StringObj& Z = mZ;
+            ASSERT(X == Z);
+            ASSERT(&defaultAllocator == Z.get_allocator());
+
+            mY["beta"] = 20;
+            ASSERT(X != Y);
+            ASSERT(X.size() == Y.size());
+
+            mZ = Y;
+            ASSERT(Y == Z);
+            ASSERT(&defaultAllocator == Z.get_allocator());
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            mX.swap(mY);
+            ASSERT(20 == X.at("beta"));
+            ASSERT( 2 == Y.at("beta"));
+            swap(mX, mY);
+            ASSERT( 2 == X.at("beta"));
+            ASSERT(oam.isTotalSame());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONTAINER INTERFACE
+        //
+        // Concerns:
+        //: 1 Each manipulator and accessor is forwarded to the corresponding
+        //:   method of the underlying table, and returns the expected result.
+        //:
+        //: 2 Iterators provide modifiable access to the mapped value.
+        //:
+        //: 3 All memory is supplied by the map's allocator.
+        //
+        // Plan:
+        //: 1 Exercise each method on a map of 'int' to 'int', and verify the
+        //:   results against the values inserted.  (C-1..3)
+        //
+        // Testing:
+        //   explicit flat_hash_map(size_type, hasher, key_equal, allocator);
+        //   flat_hash_map(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+        //   iterator begin();
+        //   iterator end();
+        //   void clear();
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator find(const key_type& key);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(size_type numSlots);
+        //   void reserve(size_type numElements);
+        //   allocator_type get_allocator() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   size_type capacity() const;
+        //   size_type count(const key_type& key) const;
+        //   bool empty() const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   const_iterator find(const key_type& key) const;
+        //   hasher hash_function() const;
+        //   key_equal key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_type max_size() const;
+        //   size_type size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONTAINER INTERFACE"
+                            "\n===================\n");
+
+        typedef Obj::value_type Pair;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            const Pair VALUES[] = { Pair(1, 10), Pair(2, 20), Pair(3, 30),
+                                    Pair(1, 99), Pair(4, 40) };
+            const int  NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            Obj mX(VALUES, VALUES + NUM_VALUES, 0,
+                   Obj::hasher(), Obj::key_equal(), &oa);
+            const Obj& X = mX;
+
+            ASSERT(4 == X.size());
+            ASSERT(!X.empty());
+            ASSERT(10 == X.at(1));
+            ASSERT(&oa == X.get_allocator());
+            ASSERT(0 < X.max_size());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(X.load_factor() <= X.max_load_factor());
+            ASSERT(X.key_eq()(3, 3));
+            ASSERT(X.hash_function()(3) == bsl::hash<int>()(3));
+
+            bsl::pair<Obj::iterator, bool> result = mX.insert(Pair(5, 50));
+            ASSERT(result.second);
+            ASSERT(50 == result.first->second);
+            result = mX.insert(Pair(5, 55));
+            ASSERT(!result.second);
+            ASSERT(50 == result.first->second);
+            ASSERT(60 == mX.insert(X.begin(), Pair(6, 60))->second);
+
+            const Pair MORE[] = { Pair(7, 70), Pair(8, 80) };
+            mX.insert(MORE, MORE + 2);
+            ASSERT(8 == X.size());
+
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                it->second += 1;
+            }
+
+            for (int i = 0; i < 10; ++i) {
+                const bool EXP = 0 < i && i < 9;
+                ASSERTV(i, EXP == (1 == X.count(i)));
+                ASSERTV(i, EXP == (X.end() != X.find(i)));
+                ASSERTV(i, EXP == (mX.end() != mX.find(i)));
+
+                bsl::pair<Obj::const_iterator, Obj::const_iterator> range =
+                                                              X.equal_range(i);
+                ASSERTV(i, EXP == (range.first != range.second));
+                if (EXP) {
+                    ASSERTV(i, i * 10 + 1 == range.first->second);
+                    ASSERTV(i, range.second == ++range.first);
+                }
+            }
+
+            int sum = 0;
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                sum += it->first;
+            }
+            ASSERT(36 == sum);
+
+            ASSERT(1 == mX.erase(8));
+            ASSERT(0 == mX.erase(8));
+            mX.erase(mX.find(7));
+            ASSERT(6 == X.size());
+
+            mX.reserve(1000);
+            ASSERT(1024 <= X.capacity());
+            mX.rehash(4096);
+            ASSERT(4096 == X.capacity());
+            ASSERT(6 == X.size());
+
+            ASSERT(X.end() == mX.erase(X.begin(), X.end()));
+            ASSERT(X.empty());
+
+            mX[1] = 1;
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(4096 == X.capacity());
+        }
+        {
+            Obj mX(100, Obj::hasher(), Obj::key_equal(), &oa);
+            const Obj& X = mX;
+            ASSERT(128 == X.capacity());
+            ASSERT(2 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'operator[]' AND 'at'
+        //
+        // Concerns:
+        //: 1 'operator[]' inserts a default-constructed mapped value for a
+        //:   missing key, and returns a reference to the mapped value.
+        //:
+        //: 2 'at' returns a reference to the mapped value of an existing key,
+        //:   and throws 'std::out_of_range' for a missing key, leaving the map
+        //:   unchanged.
+        //
+        // Plan:
+        //: 1 Use 'operator[]' to insert and update values, and verify the
+        //:   results using 'at'.  (C-1..2)
+        //:
+        //: 2 Call 'at' (both overloads) with a missing key, and verify that
+        //:   'std::out_of_range' is thrown.  (C-2)
+        //
+        // Testing:
+        //   explicit flat_hash_map(const allocator_type& allocator);
+        //   mapped_type& operator[](const key_type& key);
+        //   mapped_type& at(const key_type& key);
+        //   const mapped_type& at(const key_type& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'operator[]' AND 'at'"
+                            "\n=====================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 500; ++i) {
+                ASSERTV(i, 0 == mX[i]);
+                mX[i] = i * i;
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+            }
+            for (int i = 0; i < 500; ++i) {
+                ASSERTV(i, i * i == X.at(i));
+                ++mX.at(i);
+                ASSERTV(i, i * i + 1 == mX[i]);
+            }
+            ASSERT(500 == X.size());
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool caught = false;
+            try {
+                mX.at(500);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                X.at(-1);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(500 == X.size());
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find and erase a few values.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+            mX["one"] = 1;
+            mX["two"] = 2;
+            ASSERT(mX.insert(StringObj::value_type("three", 3)).second);
+            ASSERT(3 == X.size());
+            ASSERT(2 == X.at("two"));
+            ASSERT(1 == mX.erase("one"));
+            ASSERT(X.end() == X.find("one"));
+            ASSERT(2 == X.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,830 @@
+// bslstl_flathashset.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATHASHSET
+#define INCLUDED_BSLSTL_FLATHASHSET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a cache-friendly hashed set with elements stored inline.
+//
+//@CLASSES:
+//   bsl::flat_hash_set: open-addressing hashed set container
+//
+//@SEE_ALSO: bslstl_flathashtable, bslstl_flathashmap, bslstl_unorderedset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'flat_hash_set', implementing a hashed set of unique keys whose interface
+// follows that of 'bsl::unordered_set', but whose elements are stored inline
+// in a single open-addressing array (see 'bslstl_flathashtable') rather than
+// in separately allocated nodes.
+//
+// A 'flat_hash_set' performs far fewer allocations than an 'unordered_set'
+// (a populated 'flat_hash_set' holds exactly two blocks of memory), and a
+// lookup typically touches only one cache line of metadata, which is searched
+// 16 slots at a time using SSE2 instructions where available.  In exchange:
+//: o Inserting an element may invalidate *all* iterators, references and
+//:   pointers to the elements of the set (erasing an element invalidates only
+//:   those referring to the erased element).
+//: o There is no bucket interface, and the maximum load factor is fixed (at
+//:   0.875).
+//: o Elements are copied when the set grows, so elements that are expensive
+//:   to copy (and not bitwise moveable) are better held by an
+//:   'unordered_set'.
+//
+// A 'flat_hash_set' meets the requirements of an unordered associative
+// container with forward iterators in the C++11 standard [unord], except for
+// the bucket interface and the iterator-invalidation guarantees of 'insert'.
+//
+///Requirements on 'KEY', 'HASH', 'EQUAL', and 'ALLOCATOR'
+///--------------------------------------------------------
+// The requirements on the (template parameter) types are those of
+// 'bsl::unordered_set', and in addition 'KEY' must be copy-constructible
+// using the allocator of the set.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicates from a Sequence
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive a stream of integer identifiers, and want to process
+// each distinct identifier only once.  A 'flat_hash_set' is a compact and
+// fast way of remembering which identifiers have been seen.
+//
+// First, we create a set, reserving room for the expected number of distinct
+// identifiers, so that no rehash is needed while we process the stream:
+//..
+//  bslma::TestAllocator     oa;
+//  bsl::flat_hash_set<int>  seen(&oa);
+//  seen.reserve(100);
+//  const int numBlocks = oa.numBlocksInUse();
+//..
+// Then, we process the stream, skipping the identifiers we have seen before:
+//..
+//  const int STREAM[]    = { 7, 3, 7, 12, 3, 42, 12, 7 };
+//  const int STREAM_SIZE = sizeof STREAM / sizeof *STREAM;
+//
+//  int numProcessed = 0;
+//  for (int i = 0; i < STREAM_SIZE; ++i) {
+//      if (seen.insert(STREAM[i]).second) {
+//          ++numProcessed;
+//      }
+//  }
+//..
+// Finally, we verify that each distinct identifier was processed once, and
+// that no memory was allocated after the initial 'reserve':
+//..
+//  assert(4 == numProcessed);
+//  assert(4 == seen.size());
+//  assert(1 == seen.count(42));
+//  assert(0 == seen.count(5));
+//  assert(numBlocks == oa.numBlocksInUse());
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "<bslstl_flathashset.h> header can't be included directly in \
+        BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_EQUALTO
+#include <bslstl_equalto.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_FLATHASHTABLE
+#include <bslstl_flathashtable.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_HASH
+#include <bslstl_hash.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDSETKEYCONFIGURATION
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // for 'std::size_t'
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace bsl {
+
+                        // ===================
+                        // class flat_hash_set
+                        // ===================
+
+template <class KEY,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY>,
+          class ALLOCATOR = bsl::allocator<KEY> >
+class flat_hash_set
+{
+    // This class template implements a value-semantic container type holding
+    // an unordered set of unique values (of template parameter type 'KEY'),
+    // stored inline in an open-addressing hash table.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+        // This typedef is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef ::BloombergLP::bslstl::UnorderedSetKeyConfiguration<KEY>
+                                                             KeyConfiguration;
+        // This typedef is an alias for the policy used internally by this
+        // container to extract the 'KEY' value from the values maintained by
+        // this set.
+
+    typedef ::BloombergLP::bslstl::FlatHashTable<KeyConfiguration,
+                                                 HASH,
+                                                 EQUAL,
+                                                 ALLOCATOR> Table;
+        // This typedef is an alias for the template instantiation of the
+        // underlying 'bslstl::FlatHashTable' used to implement this set.
+
+    // FRIEND
+    template <class KEY2, class HASH2, class EQUAL2, class ALLOCATOR2>
+    friend bool operator==(
+                        const flat_hash_set<KEY2, HASH2, EQUAL2, ALLOCATOR2>&,
+                        const flat_hash_set<KEY2, HASH2, EQUAL2, ALLOCATOR2>&);
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef HASH                                       hasher;
+    typedef EQUAL                                      key_equal;
+    typedef ALLOCATOR                                  allocator_type;
+
+    typedef typename allocator_type::reference         reference;
+    typedef typename allocator_type::const_reference   const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Table::ConstIterator              iterator;
+    typedef iterator                                   const_iterator;
+
+  private:
+    // DATA
+    Table d_impl;
+
+  public:
+    // CREATORS
+    explicit flat_hash_set(
+                          size_type             initialNumElements = 0,
+                          const hasher&         hash = hasher(),
+                          const key_equal&      keyEqual = key_equal(),
+                          const allocator_type& allocator = allocator_type());
+        // Create an empty set, able to hold at least the optionally specified
+        // 'initialNumElements' without allocating memory.  Optionally specify
+        // a 'hash' functor used to hash keys, and a 'keyEqual' functor used to
+        // compare keys; if not specified, default-constructed objects of type
+        // 'hasher' and 'key_equal' are used.  Optionally specify an
+        // 'allocator' used to supply memory.  If 'allocator' is not
+        // specified, a default-constructed object of the (template parameter)
+        // type 'allocator_type' is used.  If the 'allocator_type' is
+        // 'bsl::allocator' (the default), then 'allocator' shall be
+        // convertible to 'bslma::Allocator *'.  Note that no memory is
+        // allocated unless '0 < initialNumElements'.
+
+    explicit flat_hash_set(const allocator_type& allocator);
+        // Create an empty set that uses the specified 'allocator' to supply
+        // memory, and default-constructed objects of type 'hasher' and
+        // 'key_equal' to hash and compare keys.
+
+    template <class INPUT_ITERATOR>
+    flat_hash_set(INPUT_ITERATOR        first,
+                  INPUT_ITERATOR        last,
+                  size_type             initialNumElements = 0,
+                  const hasher&         hash = hasher(),
+                  const key_equal&      keyEqual = key_equal(),
+                  const allocator_type& allocator = allocator_type());
+        // Create a set, having the optionally specified 'hash', 'keyEqual'
+        // and 'allocator' (see above), and insert each value in the range
+        // starting at the specified 'first' position, and ending immediately
+        // before the specified 'last' position, whose key is not already in
+        // the set.  Optionally specify 'initialNumElements' as for the first
+        // constructor.  The behavior is undefined unless '[first, last)' is a
+        // valid range.
+
+    flat_hash_set(const flat_hash_set& original);
+        // Create a set having the same value, hasher and key-equality functor
+        // as the specified 'original'.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // supply memory.
+
+    flat_hash_set(const flat_hash_set&  original,
+                  const allocator_type& allocator);
+        // Create a set having the same value, hasher and key-equality functor
+        // as the specified 'original', that uses the specified 'allocator' to
+        // supply memory.
+
+    //! ~flat_hash_set() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_hash_set& operator=(const flat_hash_set& rhs);
+        // Assign to this object the value, hasher and key-equality functor of
+        // the specified 'rhs' object, propagate to this object the allocator
+        // of 'rhs' if the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_copy_assignment', and return a reference
+        // providing modifiable access to this object.
+
+    iterator begin();
+        // Return an iterator referring to the first element of this set, or
+        // the 'end' iterator if this set is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this set.
+
+    void clear();
+        // Remove all elements from this set, retaining its capacity.
+
+    iterator erase(const_iterator position);
+        // Remove the element at the specified 'position' from this set, and
+        // return an iterator referring to the element following it, or the
+        // 'end' iterator if there is no such element.  The behavior is
+        // undefined unless 'position' refers to an element of this set.
+
+    size_type erase(const key_type& key);
+        // Remove the element having the specified 'key' from this set, if it
+        // exists, and return the number of elements removed (0 or 1).
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the elements in the range starting at the specified 'first'
+        // position and ending immediately before the specified 'last'
+        // position from this set, and return 'last'.  The behavior is
+        // undefined unless '[first, last)' is a valid range of this set.
+
+    iterator find(const key_type& key);
+        // Return an iterator referring to the element of this set equal to
+        // the specified 'key', or the 'end' iterator if there is no such
+        // element.
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this set if an equal value is not
+        // already in the set.  Return a pair whose 'first' member refers to
+        // the element equal to 'value', and whose 'second' member is 'true' if
+        // 'value' was inserted, and 'false' otherwise.  Note that this method
+        // may invalidate all iterators, references and pointers into this
+        // set.
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this set if an equal value is not
+        // already in the set, and return an iterator referring to the element
+        // equal to 'value'.  The specified 'hint' is ignored.  Note that this
+        // method may invalidate all iterators, references and pointers into
+        // this set.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set each value in the range starting at the
+        // specified 'first' position, and ending immediately before the
+        // specified 'last' position, that is not already in the set.  The
+        // behavior is undefined unless '[first, last)' is a valid range that
+        // does not refer to elements of this set.
+
+    void rehash(size_type numSlots);
+        // Ensure that this set has at least the specified 'numSlots' slots,
+        // rehashing the elements into a new array if necessary.
+
+    void reserve(size_type numElements);
+        // Ensure that this set can hold at least the specified 'numElements'
+        // without allocating memory.
+
+    void swap(flat_hash_set& other);
+        // Exchange the value, hasher and key-equality functor of this object
+        // with those of the specified 'other' object.  Also exchange the
+        // allocators if the 'ALLOCATOR' type has the trait
+        // 'propagate_on_container_swap'.  The behavior is undefined unless
+        // that trait is 'true', or this object and 'other' use the same
+        // allocator.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return a copy of the allocator used to supply memory.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first element of this set, or
+        // the 'end' iterator if this set is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this set.
+
+    size_type capacity() const;
+        // Return the number of slots of this set.
+
+    size_type count(const key_type& key) const;
+        // Return the number of elements of this set equal to the specified
+        // 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this set has no elements, and 'false' otherwise.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                   const key_type& key) const;
+        // Return a pair of iterators delimiting the range of elements of this
+        // set equal to the specified 'key'.  If there is no such element,
+        // both iterators are 'end()'.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator referring to the element of this set equal to
+        // the specified 'key', or the 'end' iterator if there is no such
+        // element.
+
+    hasher hash_function() const;
+        // Return (a copy of) the hash functor of this set.
+
+    key_equal key_eq() const;
+        // Return (a copy of) the key-equality functor of this set.
+
+    float load_factor() const;
+        // Return the ratio of the number of elements of this set to its
+        // number of slots.
+
+    float max_load_factor() const;
+        // Return the (fixed) maximum load factor of this set.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this set could possibly hold.
+
+    size_type size() const;
+        // Return the number of elements in this set.
+};
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+bool operator==(const flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& lhs,
+                const flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_hash_set' objects have the
+    // same value if they have the same number of elements, and each element
+    // of one is equal to an element of the other.
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+bool operator!=(const flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& lhs,
+                const flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+void swap(flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& x,
+          flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& y);
+    // Exchange the value, hasher and key-equality functor of the specified
+    // 'x' and 'y' objects.  The behavior is undefined unless the allocators
+    // of 'x' and 'y' compare equal, or 'propagate_on_container_swap' is
+    // 'true' for 'ALLOCATOR'.
+
+}  // close namespace bsl
+
+// ============================================================================
+//                      TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace bsl {
+
+                        // -------------------
+                        // class flat_hash_set
+                        // -------------------
+
+// CREATORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_hash_set(
+                                      size_type             initialNumElements,
+                                      const hasher&         hash,
+                                      const key_equal&      keyEqual,
+                                      const allocator_type& allocator)
+: d_impl(hash, keyEqual, initialNumElements, allocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_hash_set(
+                                               const allocator_type& allocator)
+: d_impl(allocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_hash_set(
+                                      INPUT_ITERATOR        first,
+                                      INPUT_ITERATOR        last,
+                                      size_type             initialNumElements,
+                                      const hasher&         hash,
+                                      const key_equal&      keyEqual,
+                                      const allocator_type& allocator)
+: d_impl(hash, keyEqual, initialNumElements, allocator)
+{
+    this->insert(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_hash_set(
+                                                 const flat_hash_set& original)
+: d_impl(original.d_impl)
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_hash_set(
+                                               const flat_hash_set&  original,
+                                               const allocator_type& allocator)
+: d_impl(original.d_impl, allocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>&
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::operator=(const flat_hash_set& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::end()
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::clear()
+{
+    d_impl.removeAll();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != this->end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::erase(const key_type& key)
+{
+    const_iterator position = d_impl.find(key);
+    if (position == this->end()) {
+        return 0;                                                     // RETURN
+    }
+
+    d_impl.erase(position);
+    return 1;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::erase(const_iterator first,
+                                                  const_iterator last)
+{
+    while (first != last) {
+        first = d_impl.erase(first);
+    }
+    return last;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+pair<typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator, bool>
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(const value_type& value)
+{
+    typedef pair<typename Table::Iterator, bool> ResultType;
+
+    ResultType result = d_impl.insert(value);
+    return pair<iterator, bool>(result.first, result.second);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(const_iterator,
+                                                   const value_type& value)
+{
+    return d_impl.insert(value).first;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                        INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_impl.insert(*first);
+    }
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::rehash(size_type numSlots)
+{
+    d_impl.rehashForNumSlots(numSlots);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::reserve(size_type numElements)
+{
+    d_impl.reserveForNumElements(numElements);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::swap(flat_hash_set& other)
+{
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+ALLOCATOR flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::get_allocator() const
+{
+    return d_impl.allocator();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::count(const key_type& key) const
+{
+    return d_impl.find(key) != d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::empty() const
+{
+    return 0 == d_impl.size();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+pair<typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator,
+     typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator>
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::equal_range(
+                                                    const key_type& key) const
+{
+    typedef pair<const_iterator, const_iterator> ResultType;
+
+    const_iterator first = d_impl.find(key);
+    if (first == this->end()) {
+        return ResultType(first, first);                              // RETURN
+    }
+
+    const_iterator last = first;
+    return ResultType(first, ++last);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+HASH flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::hash_function() const
+{
+    return d_impl.hasher();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+EQUAL flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::key_eq() const
+{
+    return d_impl.comparator();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+float flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::load_factor() const
+{
+    return d_impl.loadFactor();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+float flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::max_load_factor() const
+{
+    return d_impl.maxLoadFactor();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::max_size() const
+{
+    return d_impl.maxSize();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size() const
+{
+    return d_impl.size();
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                    const bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& lhs,
+                    const bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                    const bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& lhs,
+                    const bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& x,
+               bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& y)
+{
+    x.swap(y);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for 'flat_hash_set':
+//: o A 'flat_hash_set' defines STL iterators.
+//: o A 'flat_hash_set' uses 'bslma' allocators if the parameterized
+//:      'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR> >
+     : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR> >
+     : bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
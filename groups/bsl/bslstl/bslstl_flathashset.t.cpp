@@ -0,0 +1,532 @@
+// bslstl_flathashset.t.cpp                                           -*-C++-*-
+#include <bslstl_flathashset.h>
+
+#include <bslstl_string.h>
+
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test defines a container, 'bsl::flat_hash_set', whose
+// methods forward to an underlying 'bslstl::FlatHashTable', which is tested
+// thoroughly by its own test driver.  This test driver therefore verifies
+// that each method of the container is correctly forwarded, and that the
+// container has the expected type traits.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit flat_hash_set(size_type, hasher, key_equal, allocator);
+// [ 2] explicit flat_hash_set(const allocator_type& allocator);
+// [ 2] flat_hash_set(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+// [ 3] flat_hash_set(const flat_hash_set& original);
+// [ 3] flat_hash_set(const flat_hash_set& original, const allocator_type&);
+//
+// MANIPULATORS
+// [ 3] flat_hash_set& operator=(const flat_hash_set& rhs);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] void clear();
+// [ 2] iterator erase(const_iterator position);
+// [ 2] size_type erase(const key_type& key);
+// [ 2] iterator erase(const_iterator first, const_iterator last);
+// [ 2] iterator find(const key_type& key);
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 2] iterator insert(const_iterator hint, const value_type& value);
+// [ 2] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 2] void rehash(size_type numSlots);
+// [ 2] void reserve(size_type numElements);
+// [ 3] void swap(flat_hash_set& other);
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 2] size_type capacity() const;
+// [ 2] size_type count(const key_type& key) const;
+// [ 2] bool empty() const;
+// [ 2] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 2] const_iterator find(const key_type& key) const;
+// [ 2] hasher hash_function() const;
+// [ 2] key_equal key_eq() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_type max_size() const;
+// [ 2] size_type size() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const flat_hash_set& lhs, const flat_hash_set& rhs);
+// [ 3] bool operator!=(const flat_hash_set& lhs, const flat_hash_set& rhs);
+// [ 3] void swap(flat_hash_set& x, flat_hash_set& y);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [ 4] TYPE TRAITS
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_hash_set<int> Obj;
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+static void usageExample()
+{
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicates from a Sequence
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive a stream of integer identifiers, and want to process
+// each distinct identifier only once.  A 'flat_hash_set' is a compact and
+// fast way of remembering which identifiers have been seen.
+//
+// First, we create a set, reserving room for the expected number of distinct
+// identifiers, so that no rehash is needed while we process the stream:
+//..
+    bslma::TestAllocator     oa;
+    bsl::flat_hash_set<int>  seen(&oa);
+    seen.reserve(100);
+    const int numBlocks = oa.numBlocksInUse();
+//..
+// Then, we process the stream, skipping the identifiers we have seen before:
+//..
+    const int STREAM[]    = { 7, 3, 7, 12, 3, 42, 12, 7 };
+    const int STREAM_SIZE = sizeof STREAM / sizeof *STREAM;
+
+    int numProcessed = 0;
+    for (int i = 0; i < STREAM_SIZE; ++i) {
+        if (seen.insert(STREAM[i]).second) {
+            ++numProcessed;
+        }
+    }
+//..
+// Finally, we verify that each distinct identifier was processed once, and
+// that no memory was allocated after the initial 'reserve':
+//..
+    ASSERT(4 == numProcessed);
+    ASSERT(4 == seen.size());
+    ASSERT(1 == seen.count(42));
+    ASSERT(0 == seen.count(5));
+    ASSERT(numBlocks == oa.numBlocksInUse());
+//..
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: No memory is ever allocated from the global allocator.
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        usageExample();
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TYPE TRAITS
+        //
+        // Concerns:
+        //: 1 'flat_hash_set' defines STL iterators.
+        //:
+        //: 2 'flat_hash_set' uses 'bslma' allocators if and only if its
+        //:   allocator type is convertible from 'bslma::Allocator *'.
+        //
+        // Plan:
+        //: 1 Verify the values of the traits.  (C-1..2)
+        //
+        // Testing:
+        //   TYPE TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTYPE TRAITS"
+                            "\n===========\n");
+
+        ASSERT(bslalg::HasStlIterators<Obj>::value);
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Copy construction, assignment, swap and the equality operators
+        //:   are forwarded to the underlying table.
+        //
+        // Plan:
+        //: 1 Copy, assign and swap sets of 'bsl::string' values, and compare
+        //:   the results using the equality operators.  (C-1)
+        //
+        // Testing:
+        //   flat_hash_set(const flat_hash_set& original);
+        //   flat_hash_set(const flat_hash_set&, const allocator_type&);
+        //   flat_hash_set& operator=(const flat_hash_set& rhs);
+        //   void swap(flat_hash_set& other);
+        //   bool operator==(const flat_hash_set&, const flat_hash_set&);
+        //   bool operator!=(const flat_hash_set&, const flat_hash_set&);
+        //   void swap(flat_hash_set& x, flat_hash_set& y);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP AND EQUALITY"
+                            "\n===================================\n");
+
+        typedef bsl::flat_hash_set<bsl::string> StringSet;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            const char *WORDS[] = { "alpha", "beta", "gamma", "delta",
+                                    "a string too long for the short buffer" };
+            const int   NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+
+            StringSet mX(WORDS, WORDS + NUM_WORDS, 0,
+                         StringSet::hasher(), StringSet::key_equal(), &oa);
+            const StringSet& X = mX;
+
+            StringSet mY(X, &oa);  const StringSet& Y = mY;
+            ASSERT(X == Y);
+            ASSERT(&oa == Y.get_allocator());
+
+            StringSet mZ(X);  const StringSet& Z = mZ;
+            ASSERT(X == Z);
+            ASSERT(&defaultAllocator == Z.get_allocator());
+
+            mY.erase("beta");
+            ASSERT(X != Y);
+
+            mZ = Y;
+            ASSERT(Y == Z);
+            ASSERT(&defaultAllocator == Z.get_allocator());
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            mX.swap(mY);
+            ASSERT(4 == X.size());
+            ASSERT(5 == Y.size());
+            swap(mX, mY);
+            ASSERT(5 == X.size());
+            ASSERT(oam.isTotalSame());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONTAINER INTERFACE
+        //
+        // Concerns:
+        //: 1 Each manipulator and accessor is forwarded to the corresponding
+        //:   method of the underlying table, and returns the expected result.
+        //:
+        //: 2 All memory is supplied by the set's allocator.
+        //
+        // Plan:
+        //: 1 Exercise each method on a set of 'int' values, and verify the
+        //:   results against the values inserted.  (C-1..2)
+        //
+        // Testing:
+        //   explicit flat_hash_set(size_type, hasher, key_equal, allocator);
+        //   explicit flat_hash_set(const allocator_type& allocator);
+        //   flat_hash_set(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+        //   iterator begin();
+        //   iterator end();
+        //   void clear();
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator find(const key_type& key);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(size_type numSlots);
+        //   void reserve(size_type numElements);
+        //   allocator_type get_allocator() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   size_type capacity() const;
+        //   size_type count(const key_type& key) const;
+        //   bool empty() const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   const_iterator find(const key_type& key) const;
+        //   hasher hash_function() const;
+        //   key_equal key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_type max_size() const;
+        //   size_type size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONTAINER INTERFACE"
+                            "\n===================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(0 == X.capacity());
+            ASSERT(&oa == X.get_allocator());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.cbegin() == X.cend());
+            ASSERT(0 < X.max_size());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(X.key_eq()(3, 3));
+            ASSERT(X.hash_function()(3) == bsl::hash<int>()(3));
+
+            const int VALUES[] = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            mX.insert(VALUES, VALUES + NUM_VALUES);
+            ASSERT(7 == X.size());
+            ASSERT(!X.empty());
+            ASSERT(0 < X.load_factor());
+            ASSERT(X.load_factor() <= X.max_load_factor());
+
+            bsl::pair<Obj::iterator, bool> result = mX.insert(7);
+            ASSERT(result.second);
+            ASSERT(7 == *result.first);
+            result = mX.insert(7);
+            ASSERT(!result.second);
+            ASSERT(7 == *result.first);
+            ASSERT(8 == *mX.insert(X.begin(), 8));
+            ASSERT(9 == X.size());
+
+            for (int i = 0; i < 10; ++i) {
+                const bool EXP = 0 != i;
+                ASSERTV(i, EXP == (1 == X.count(i)));
+                ASSERTV(i, EXP == (X.end() != X.find(i)));
+                ASSERTV(i, EXP == (mX.end() != mX.find(i)));
+
+                bsl::pair<Obj::const_iterator, Obj::const_iterator> range =
+                                                              X.equal_range(i);
+                ASSERTV(i, EXP == (range.first != range.second));
+                if (EXP) {
+                    ASSERTV(i, i == *range.first);
+                    ASSERTV(i, range.second == ++range.first);
+                }
+            }
+
+            int sum = 0;
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                sum += *it;
+            }
+            ASSERT(45 == sum);
+
+            ASSERT(1 == mX.erase(9));
+            ASSERT(0 == mX.erase(9));
+            mX.erase(mX.find(8));
+            ASSERT(7 == X.size());
+
+            mX.reserve(1000);
+            ASSERT(1024 <= X.capacity());
+            mX.rehash(4096);
+            ASSERT(4096 == X.capacity());
+            ASSERT(7 == X.size());
+
+            ASSERT(X.end() == mX.erase(X.begin(), X.end()));
+            ASSERT(X.empty());
+
+            mX.insert(1);
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(4096 == X.capacity());
+        }
+        {
+            Obj mX(100, Obj::hasher(), Obj::key_equal(), &oa);
+            const Obj& X = mX;
+            ASSERT(128 == X.capacity());
+            ASSERT(2 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find and erase a few values.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i, mX.insert(i).second);
+            }
+            ASSERT(1000 == X.size());
+            for (int i = 0; i < 1000; i += 2) {
+                ASSERTV(i, 1 == mX.erase(i));
+            }
+            ASSERT(500 == X.size());
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i, (i % 2) == static_cast<int>(X.count(i)));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
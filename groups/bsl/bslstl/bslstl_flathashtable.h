@@ -0,0 +1,1726 @@
+// bslstl_flathashtable.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATHASHTABLE
+#define INCLUDED_BSLSTL_FLATHASHTABLE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressing hash table storing elements inline.
+//
+//@CLASSES:
+//   bslstl::FlatHashTable: open-addressing hash table with inline elements
+//   bslstl::FlatHashTableIterator: forward iterator over a 'FlatHashTable'
+//
+//@SEE_ALSO: bslstl_hashtable, bslstl_flathashmap, bslstl_flathashset
+//
+//@DESCRIPTION: This component defines a class template, 'FlatHashTable',
+// implementing an open-addressing hash table of unique keys, that can be used
+// to implement the 'bsl::flat_hash_map' and 'bsl::flat_hash_set' containers.
+// Unlike 'bslstl::HashTable', which allocates each element in a separate node
+// threaded on a linked list, a 'FlatHashTable' stores its elements inline in a
+// single contiguous array of *slots*, so that a successful lookup typically
+// touches a single cache line of metadata, and a single cache line of element
+// data.  In exchange, inserting an element may move (copy) every element to a
+// new array, so that references, pointers, and iterators into a
+// 'FlatHashTable' are invalidated by any operation that inserts an element.
+//
+// 'FlatHashTable' is configured in the same way as 'bslstl::HashTable': the
+// (template parameter) type 'KEY_CONFIG' provides the 'ValueType' and
+// 'KeyType' of the table and a function to extract the key from a value (see
+// {'bslstl_hashtable'|Requirements on 'KEY_CONFIG'}), and the 'HASHER',
+// 'COMPARATOR', and 'ALLOCATOR' parameters have the same requirements as those
+// of 'bslstl::HashTable'.
+//
+///Internal Data Structure
+///-----------------------
+// The slot array of a 'FlatHashTable' holds a power-of-two number of slots
+// (its *capacity*), and is partitioned into *groups* of 16 consecutive slots.
+// The table maintains a parallel array of one-byte *control* values, one for
+// each slot.  A control value indicates whether its slot is empty, deleted
+// (i.e., the slot held an element that has since been erased), or full; the
+// control value of a full slot holds the low-order 7 bits of the (post-mixed)
+// hash code of the element's key.
+//
+// The remaining high-order bits of a hash code select the group at which a
+// lookup begins.  The control values of the 16 slots of the group are matched
+// against the 7 bits of the sought key's hash code in parallel, using SSE2
+// instructions on platforms that support them, and the key comparator is
+// called only for the (typically zero or one) slots whose control values
+// match.  If no element in the group has the sought key, and the group has an
+// empty slot, the key is not in the table; otherwise, the lookup continues at
+// another group, chosen by quadratic (triangular) probing.
+//
+// The table is grown (doubling its capacity) before the number of slots that
+// are full or deleted would exceed 7/8 of the capacity, so that every probe
+// sequence terminates.
+//
+///Exception Safety
+///----------------
+// 'FlatHashTable' provides the strong exception guarantee for insertions,
+// except in the presence of a hash functor or comparator that throws, in
+// which case only the basic guarantee is provided.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Implementing a Flat Hashed Set Container
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we wish to implement a set of unique 'int' values, that minimizes
+// the number of allocations and cache misses incurred by a lookup.
+//
+// First, we define the key configuration for the table, which is simply the
+// one used by 'bsl::unordered_set':
+//..
+//  typedef bslstl::UnorderedSetKeyConfiguration<int> SetConfig;
+//..
+// Then, we define our table type:
+//..
+//  typedef bslstl::FlatHashTable<SetConfig,
+//                                bsl::hash<int>,
+//                                bsl::equal_to<int> > IntTable;
+//..
+// Next, we create a table and insert some values:
+//..
+//  bslma::TestAllocator oa;
+//  IntTable             table(&oa);
+//
+//  for (int i = 0; i < 100; ++i) {
+//      table.insert(i * i);
+//  }
+//  assert(100 == table.size());
+//  assert(  2 == oa.numBlocksInUse());
+//..
+// Notice that the table uses only two blocks of memory (one array of slots,
+// and one array of control values), however many elements it holds.
+//
+// Finally, we look up some values:
+//..
+//  assert(table.end() != table.find(49));
+//  assert(table.end() == table.find(50));
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "<bslstl_flathashtable.h> header can't be included directly in \
+        BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_HASHTABLE
+#include <bslstl_hashtable.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_REMOVECVQ
+#include <bslmf_removecvq.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_EXCEPTIONUTIL
+#include <bsls_exceptionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // for 'size_t'
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>  // for 'memcpy', 'memset'
+#define INCLUDED_CSTRING
+#endif
+
+#ifndef INCLUDED_LIMITS
+#include <limits>   // for 'numeric_limits'
+#define INCLUDED_LIMITS
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64)                                      \
+                      || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BSLSTL_FLATHASHTABLE_SSE2 1
+
+#ifndef INCLUDED_EMMINTRIN
+#include <emmintrin.h>
+#define INCLUDED_EMMINTRIN
+#endif
+#endif
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#ifndef INCLUDED_INTRIN
+#include <intrin.h>
+#define INCLUDED_INTRIN
+#endif
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ==============================
+                        // struct FlatHashTable_GroupUtil
+                        // ==============================
+
+struct FlatHashTable_GroupUtil {
+    // This component-private utility 'struct' provides a namespace for
+    // functions that match the control values of a group of 'GROUP_SIZE'
+    // consecutive slots of a 'FlatHashTable' in parallel, using SSE2
+    // instructions on platforms that support them.  The result of a match is
+    // a bit mask in which bit 'i' is set if the control value of slot 'i' of
+    // the group matches.
+
+    // TYPES
+    typedef unsigned int BitMask;
+
+    enum {
+        GROUP_SIZE = 16     // number of slots in a group
+
+    };
+
+    enum {
+        EMPTY    = 0x80,    // control value of a slot that was never used
+        DELETED  = 0xFE,    // control value of a slot whose element was erased
+        SENTINEL = 0xFF,    // control value following the last slot
+        HASH_BITS_MASK = 0x7F
+                            // mask of the hash bits in a full control value
+    };
+
+    // CLASS METHODS
+    static BitMask match(const unsigned char *group, unsigned char h2);
+        // Return the mask of the slots in the specified 'group' of control
+        // values that are full, and whose control value is the specified
+        // 'h2'.  The behavior is undefined unless 'group' refers to
+        // 'GROUP_SIZE' contiguous control values, and 'h2 <= HASH_BITS_MASK'.
+
+    static BitMask matchEmpty(const unsigned char *group);
+        // Return the mask of the empty slots in the specified 'group' of
+        // control values.  The behavior is undefined unless 'group' refers to
+        // 'GROUP_SIZE' contiguous control values.
+
+    static BitMask matchEmptyOrDeleted(const unsigned char *group);
+        // Return the mask of the slots in the specified 'group' of control
+        // values that are either empty or deleted.  The behavior is undefined
+        // unless 'group' refers to 'GROUP_SIZE' contiguous control values.
+
+    static int lowestBitIndex(BitMask mask);
+        // Return the index of the lowest-order bit set in the specified
+        // 'mask'.  The behavior is undefined unless '0 != mask'.
+
+    static unsigned char *sharedEmptyControls();
+        // Return the address of a statically initialized control value, equal
+        // to 'SENTINEL', that can be shared (but not modified) by all
+        // 'FlatHashTable' objects that have no slots.
+};
+
+                        // ===========================
+                        // class FlatHashTableIterator
+                        // ===========================
+
+#ifdef BSLS_PLATFORM_OS_SOLARIS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+class FlatHashTableIterator
+: public native_std::iterator<native_std::forward_iterator_tag, VALUE_TYPE> {
+#else
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+class FlatHashTableIterator {
+#endif
+    // This class template implements an in-core value semantic type that is a
+    // standard-conforming forward iterator (see section 24.2.5
+    // [forward.iterators] of the C++11 standard) over the full slots of a
+    // 'FlatHashTable'.  A 'FlatHashTableIterator' object provides access to
+    // values of the (template parameter) 'VALUE_TYPE'.  The (template
+    // parameter) 'DIFFERENCE_TYPE' determines the standard mandated
+    // 'difference_type' of the iterator.
+
+    // PRIVATE TYPES
+    typedef typename bslmf::RemoveCvq<VALUE_TYPE>::Type    NcType;
+    typedef FlatHashTableIterator<NcType, DIFFERENCE_TYPE> NcIter;
+
+  public:
+    // PUBLIC TYPES
+    typedef NcType                      value_type;
+    typedef DIFFERENCE_TYPE             difference_type;
+    typedef VALUE_TYPE                 *pointer;
+    typedef VALUE_TYPE&                 reference;
+    typedef bsl::forward_iterator_tag   iterator_category;
+        // Standard iterator defined types [24.4.2].
+
+  private:
+    // DATA
+    const unsigned char *d_control_p;  // control value of the current slot
+    NcType              *d_slot_p;     // current slot
+
+  private:
+    // PRIVATE MANIPULATORS
+    void skipEmptyOrDeleted();
+        // Move this iterator forward, if necessary, until it refers to a full
+        // slot or to the sentinel following the last slot.
+
+  public:
+    // CREATORS
+    FlatHashTableIterator();
+        // Create a default-constructed iterator referring to no slot.  All
+        // default-constructed iterators are non-dereferenceable and have the
+        // same value.
+
+    FlatHashTableIterator(const unsigned char *control, NcType *slot);
+        // Create an iterator referring to the first full slot at or after the
+        // specified 'slot', whose control value is at the specified 'control'
+        // address, or to the sentinel following the last slot if there is no
+        // such full slot.  The behavior is undefined unless 'control' refers
+        // to the control value of 'slot' in a 'FlatHashTable', or to the
+        // sentinel following its last slot.  Note that this constructor is an
+        // implementation detail and is not part of the C++ standard.
+
+    FlatHashTableIterator(const NcIter& original);                  // IMPLICIT
+        // Create an iterator at the same position as the specified 'original'
+        // iterator.  Note that this constructor enables converting from
+        // modifiable to 'const' iterator types.
+
+    //! FlatHashTableIterator(const FlatHashTableIterator& original) = default;
+    //! ~FlatHashTableIterator() = default;
+
+    // MANIPULATORS
+    //! FlatHashTableIterator& operator=(const FlatHashTableIterator&) =
+    //!                                                                default;
+
+    FlatHashTableIterator& operator++();
+        // Move this iterator to the next full slot in the table, or to the
+        // past-the-end position if there is no such slot, and return a
+        // reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless this iterator refers to a full slot.
+
+    // ACCESSORS
+    reference operator*() const;
+        // Return a reference to the value of the element at which this
+        // iterator is positioned.  The behavior is undefined unless this
+        // iterator refers to a full slot.
+
+    pointer operator->() const;
+        // Return the address of the value of the element at which this
+        // iterator is positioned.  The behavior is undefined unless this
+        // iterator refers to a full slot.
+
+    const unsigned char *control() const;
+        // Return the address of the control value of the slot at which this
+        // iterator is positioned.  Note that this method is an implementation
+        // detail and is not part of the C++ standard.
+
+    NcType *slot() const;
+        // Return the address of the slot at which this iterator is
+        // positioned.  Note that this method is an implementation detail and
+        // is not part of the C++ standard.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE1, class VALUE_TYPE2, class DIFFERENCE_TYPE>
+bool operator==(
+              const FlatHashTableIterator<VALUE_TYPE1, DIFFERENCE_TYPE>& lhs,
+              const FlatHashTableIterator<VALUE_TYPE2, DIFFERENCE_TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' and the specified 'rhs' iterators
+    // have the same value and 'false' otherwise.  Two iterators have the same
+    // value if they refer to the same slot of the same table, or if both
+    // iterators are default constructed.
+
+template <class VALUE_TYPE1, class VALUE_TYPE2, class DIFFERENCE_TYPE>
+bool operator!=(
+              const FlatHashTableIterator<VALUE_TYPE1, DIFFERENCE_TYPE>& lhs,
+              const FlatHashTableIterator<VALUE_TYPE2, DIFFERENCE_TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' and the specified 'rhs' iterators
+    // do not have the same value and 'false' otherwise.  Two iterators do not
+    // have the same value if they refer to different slots.
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>
+operator++(FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>& iter, int);
+    // Move the specified 'iter' to the next full slot in the table and return
+    // the value of 'iter' prior to this call.  The behavior is undefined
+    // unless 'iter' refers to a full slot.
+
+                           // ===================
+                           // class FlatHashTable
+                           // ===================
+
+template <class KEY_CONFIG,
+          class HASHER,
+          class COMPARATOR,
+          class ALLOCATOR = ::bsl::allocator<typename KEY_CONFIG::ValueType> >
+class FlatHashTable {
+    // This class template implements a value-semantic container type holding
+    // an unordered set of elements having unique keys, stored inline in a
+    // contiguous array of slots that is indexed by open addressing (see
+    // {Internal Data Structure}).  The value type and key type of the
+    // elements are determined by aliases provided through the (template
+    // parameter) type 'KEY_CONFIG', and the (template parameter) types
+    // 'HASHER', 'COMPARATOR' and 'ALLOCATOR' have the same requirements as
+    // those of 'bslstl::HashTable'.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+  public:
+    // TYPES
+    typedef ALLOCATOR                              AllocatorType;
+    typedef ::bsl::allocator_traits<AllocatorType> AllocatorTraits;
+    typedef typename KEY_CONFIG::KeyType           KeyType;
+    typedef typename KEY_CONFIG::ValueType         ValueType;
+    typedef typename AllocatorTraits::size_type    SizeType;
+    typedef typename AllocatorTraits::difference_type
+                                                   DifferenceType;
+
+    typedef FlatHashTableIterator<ValueType, DifferenceType>
+                                                   Iterator;
+    typedef FlatHashTableIterator<const ValueType, DifferenceType>
+                                                   ConstIterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef FlatHashTable_GroupUtil                GroupUtil;
+    typedef GroupUtil::BitMask                     BitMask;
+
+    typedef typename AllocatorTraits::template
+                               rebind_traits<unsigned char> ControlTraits;
+    typedef typename ControlTraits::allocator_type          ControlAllocator;
+
+    typedef HashTable_HashWrapper<
+                               typename CallableVariable<HASHER>::type>
+                                                                    BaseHasher;
+    typedef HashTable_ComparatorWrapper<
+                           typename CallableVariable<COMPARATOR>::type>
+                                                                BaseComparator;
+
+    // DATA
+    BaseHasher      d_hasher;      // hash functor
+
+    BaseComparator  d_comparator;  // key-equality functor
+
+    ALLOCATOR       d_allocator;   // allocator of the slot and control arrays
+
+    unsigned char  *d_controls_p;  // 'd_capacity' control values, followed by
+                                   // a 'SENTINEL' (owned, unless
+                                   // 'd_capacity' is 0)
+
+    ValueType      *d_slots_p;     // 'd_capacity' slots (owned), or 0
+
+    SizeType        d_capacity;    // number of slots (0, or a power of two
+                                   // not less than 'GroupUtil::GROUP_SIZE')
+
+    SizeType        d_size;        // number of full slots
+
+    SizeType        d_growthLeft;  // number of empty slots that may be filled
+                                   // before the table must be rehashed
+
+  private:
+    // PRIVATE CLASS METHODS
+    static SizeType maxLoadForCapacity(SizeType capacity);
+        // Return the maximum number of slots that may be full or deleted in a
+        // table having the specified 'capacity'.
+
+    static SizeType capacityForNumElements(SizeType numElements);
+        // Return the smallest valid capacity (0, or a power of two not less
+        // than 'GroupUtil::GROUP_SIZE') of a table that can hold the specified
+        // 'numElements' without being rehashed.  Throw a 'std::length_error'
+        // exception if there is no such capacity.
+
+    // PRIVATE MANIPULATORS
+    void allocateArrays(SizeType capacity);
+        // Allocate and initialize arrays of control values and slots for the
+        // specified 'capacity' number of empty slots.  The behavior is
+        // undefined unless this table has no slots, and 'capacity' is a power
+        // of two not less than 'GroupUtil::GROUP_SIZE'.
+
+    void deallocateArrays();
+        // Deallocate the arrays of control values and slots of this table,
+        // without destroying any elements, and leave this table with no
+        // slots.
+
+    void destroyElements();
+        // Destroy each element of this table, and mark its slot empty.
+
+    SizeType prepareInsert(native_std::size_t hashCode);
+        // Return the index of an empty or deleted slot in which an element,
+        // whose key has the specified 'hashCode', can be inserted, rehashing
+        // this table to a larger capacity if necessary.  The behavior is
+        // undefined unless no element of this table has a key equal to that
+        // element's key.
+
+    void quickSwapRetainAllocators(FlatHashTable *other);
+        // Exchange the value, hasher and comparator of this object with those
+        // of the specified 'other' object, without exchanging their
+        // allocators.  This method provides the no-throw exception-safety
+        // guarantee.  Note that, unless this object and 'other' use the same
+        // allocator, the allocator of each object must subsequently be
+        // exchanged as well, so that each object deallocates its arrays with
+        // the allocator that supplied them.
+
+    void rehashIntoCapacity(SizeType newCapacity);
+        // Move the elements of this table into new arrays of the specified
+        // 'newCapacity' number of slots.  The behavior is undefined unless
+        // 'newCapacity' is a power of two not less than
+        // 'GroupUtil::GROUP_SIZE' and 'size() <= maxLoadForCapacity(
+        // newCapacity)'.
+
+    void setControl(SizeType index, unsigned char control);
+        // Set the control value of the slot at the specified 'index' to the
+        // specified 'control'.
+
+    // PRIVATE ACCESSORS
+    SizeType findFirstNonFull(native_std::size_t hashCode) const;
+        // Return the index of the first slot that is either empty or deleted
+        // in the probe sequence of the specified 'hashCode'.  The behavior is
+        // undefined unless this table has at least one slot.
+
+    SizeType findIndex(const KeyType&     key,
+                       native_std::size_t hashCode) const;
+        // Return the index of the slot holding the element whose key is equal
+        // to the specified 'key' having the specified 'hashCode', or
+        // 'd_capacity' if there is no such element.
+
+    native_std::size_t hashCodeForKey(const KeyType& key) const;
+        // Return the (post-mixed) hash code of the specified 'key'.
+
+    Iterator iteratorAt(SizeType index) const;
+        // Return an iterator referring to the first full slot at or after the
+        // specified 'index', or to the past-the-end position if there is no
+        // such slot.
+
+  public:
+    // CREATORS
+    explicit FlatHashTable(const ALLOCATOR& allocator = ALLOCATOR());
+        // Create an empty table having no slots.  Optionally specify an
+        // 'allocator' used to supply memory.  If 'allocator' is not
+        // specified, a default-constructed object of the (template parameter)
+        // type 'ALLOCATOR' is used.  Use default-constructed objects of the
+        // (template parameter) types 'HASHER' and 'COMPARATOR' to hash and
+        // compare keys.  Note that no memory is allocated.
+
+    FlatHashTable(const HASHER&     hash,
+                  const COMPARATOR& compare,
+                  SizeType          initialNumElements,
+                  const ALLOCATOR&  allocator = ALLOCATOR());
+        // Create an empty table, able to hold at least the specified
+        // 'initialNumElements' without being rehashed, that uses the
+        // specified 'hash' and 'compare' functors to hash and compare keys.
+        // Optionally specify an 'allocator' used to supply memory.  If
+        // 'allocator' is not specified, a default-constructed object of the
+        // (template parameter) type 'ALLOCATOR' is used.  Throw a
+        // 'std::length_error' exception if 'initialNumElements' is too large
+        // for any table.
+
+    FlatHashTable(const FlatHashTable& original);
+        // Create a table having the same value, hasher and comparator as the
+        // specified 'original'.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.allocator())' to
+        // supply memory.
+
+    FlatHashTable(const FlatHashTable& original, const ALLOCATOR& allocator);
+        // Create a table having the same value, hasher and comparator as the
+        // specified 'original', and using the specified 'allocator' to supply
+        // memory.
+
+    ~FlatHashTable();
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+        // Assign to this object the value, hasher and comparator of the
+        // specified 'rhs' object, replace the allocator of this object with
+        // the allocator of 'rhs' if the 'ALLOCATOR' type has the trait
+        // 'propagate_on_container_copy_assignment', and return a reference
+        // providing modifiable access to this object.
+
+    Iterator begin();
+        // Return an iterator referring to the first element of this table, or
+        // the past-the-end iterator if this table is empty.
+
+    Iterator end();
+        // Return the past-the-end iterator of this table.
+
+    Iterator erase(ConstIterator position);
+        // Remove the element at the specified 'position' from this table, and
+        // return an iterator referring to the element following it, or the
+        // past-the-end iterator if there is no such element.  Note that no
+        // other iterator, reference, or pointer into this table is
+        // invalidated.  The behavior is undefined unless 'position' refers to
+        // an element of this table.
+
+    Iterator find(const KeyType& key);
+        // Return an iterator referring to the element of this table whose key
+        // is equal to the specified 'key', or the past-the-end iterator if
+        // there is no such element.
+
+    bsl::pair<Iterator, bool> insert(const ValueType& value);
+        // Insert a copy of the specified 'value' into this table if the key of
+        // 'value' is not equal to the key of an element of this table.
+        // Return a pair whose 'first' member refers to the element of this
+        // table having that key, and whose 'second' member is 'true' if
+        // 'value' was inserted, and 'false' otherwise.  Note that inserting
+        // an element may invalidate all iterators, references, and pointers
+        // into this table.
+
+    Iterator insertIfMissing(bool *isInsertedFlag, const KeyType& key);
+        // Return an iterator referring to the element of this table whose key
+        // is equal to the specified 'key', inserting an element having 'key'
+        // and a default-constructed mapped value (of type
+        // 'ValueType::second_type') if there is no such element.  Load into
+        // the specified 'isInsertedFlag' 'true' if an element was inserted,
+        // and 'false' otherwise.  Note that this method requires 'ValueType'
+        // to be a 'bsl::pair', and that inserting an element may invalidate
+        // all iterators, references, and pointers into this table.
+
+    void removeAll();
+        // Destroy each element of this table, retaining its slots.
+
+    void rehashForNumSlots(SizeType numSlots);
+        // Ensure that this table has at least the specified 'numSlots' slots,
+        // rehashing its elements into a new array of slots if necessary.
+        // Throw a 'std::length_error' exception if 'numSlots' is too large
+        // for any table.
+
+    void reserveForNumElements(SizeType numElements);
+        // Ensure that this table can hold at least the specified
+        // 'numElements' without being rehashed.  Throw a 'std::length_error'
+        // exception if 'numElements' is too large for any table.
+
+    void swap(FlatHashTable& other);
+        // Exchange the value, hasher and comparator of this object with those
+        // of the specified 'other' object.  Additionally, if
+        // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+        // 'true', then exchange the allocator of this object with that of the
+        // 'other' object.  The behavior is undefined unless either
+        // 'propagate_on_container_swap' is 'true', or this object and 'other'
+        // use the same allocator.
+
+    // ACCESSORS
+    ALLOCATOR allocator() const;
+        // Return a copy of the allocator used to supply memory.
+
+    ConstIterator begin() const;
+        // Return an iterator referring to the first element of this table, or
+        // the past-the-end iterator if this table is empty.
+
+    SizeType capacity() const;
+        // Return the number of slots of this table.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the
+        // key-equality functor of this table.
+
+    ConstIterator end() const;
+        // Return the past-the-end iterator of this table.
+
+    ConstIterator find(const KeyType& key) const;
+        // Return an iterator referring to the element of this table whose key
+        // is equal to the specified 'key', or the past-the-end iterator if
+        // there is no such element.
+
+    const HASHER& hasher() const;
+        // Return a reference providing non-modifiable access to the hash
+        // functor of this table.
+
+    float loadFactor() const;
+        // Return the ratio of the number of elements of this table to its
+        // number of slots, or 0 if this table has no slots.
+
+    float maxLoadFactor() const;
+        // Return the maximum load factor of this table.  Note that the
+        // maximum load factor of a 'FlatHashTable' is fixed.
+
+    SizeType maxSize() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this table could possibly hold.
+
+    SizeType size() const;
+        // Return the number of elements in this table.
+};
+
+// FREE OPERATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bool operator==(
+          const FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& lhs,
+          const FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'FlatHashTable' objects have the same
+    // value if they have the same number of elements, and for each element of
+    // 'lhs' there is an element of 'rhs' having the same key and comparing
+    // equal using 'ValueType::operator=='.
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bool operator!=(
+          const FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& lhs,
+          const FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void swap(FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& a,
+          FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the value, hasher and comparator of the specified 'a' and 'b'
+    // objects.  The behavior is undefined unless either
+    // 'propagate_on_container_swap' is 'true' for 'ALLOCATOR', or 'a' and 'b'
+    // use the same allocator.
+
+// ============================================================================
+//                      TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ------------------------------
+                        // struct FlatHashTable_GroupUtil
+                        // ------------------------------
+
+// CLASS METHODS
+inline
+FlatHashTable_GroupUtil::BitMask
+FlatHashTable_GroupUtil::match(const unsigned char *group, unsigned char h2)
+{
+    BSLS_ASSERT_SAFE(group);
+    BSLS_ASSERT_SAFE(h2 <= HASH_BITS_MASK);
+
+#if defined(BSLSTL_FLATHASHTABLE_SSE2)
+    const __m128i controls = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(group));
+    return static_cast<BitMask>(_mm_movemask_epi8(
+                 _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)),
+                                controls)));
+#else
+    BitMask result = 0;
+    for (int i = 0; i < GROUP_SIZE; ++i) {
+        if (group[i] == h2) {
+            result |= 1u << i;
+        }
+    }
+    return result;
+#endif
+}
+
+inline
+FlatHashTable_GroupUtil::BitMask
+FlatHashTable_GroupUtil::matchEmpty(const unsigned char *group)
+{
+    BSLS_ASSERT_SAFE(group);
+
+#if defined(BSLSTL_FLATHASHTABLE_SSE2)
+    const __m128i controls = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(group));
+    return static_cast<BitMask>(_mm_movemask_epi8(
+                 _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(EMPTY)),
+                                controls)));
+#else
+    BitMask result = 0;
+    for (int i = 0; i < GROUP_SIZE; ++i) {
+        if (EMPTY == group[i]) {
+            result |= 1u << i;
+        }
+    }
+    return result;
+#endif
+}
+
+inline
+FlatHashTable_GroupUtil::BitMask
+FlatHashTable_GroupUtil::matchEmptyOrDeleted(const unsigned char *group)
+{
+    BSLS_ASSERT_SAFE(group);
+
+    // Empty and deleted control values are exactly those having the
+    // high-order bit set (within a group, there is no sentinel).
+
+#if defined(BSLSTL_FLATHASHTABLE_SSE2)
+    return static_cast<BitMask>(_mm_movemask_epi8(
+              _mm_loadu_si128(reinterpret_cast<const __m128i *>(group))));
+#else
+    BitMask result = 0;
+    for (int i = 0; i < GROUP_SIZE; ++i) {
+        if (group[i] & EMPTY) {
+            result |= 1u << i;
+        }
+    }
+    return result;
+#endif
+}
+
+inline
+int FlatHashTable_GroupUtil::lowestBitIndex(BitMask mask)
+{
+    BSLS_ASSERT_SAFE(0 != mask);
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return __builtin_ctz(mask);
+#elif defined(BSLS_PLATFORM_CMP_MSVC)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    int index = 0;
+    while (!(mask & 1u)) {
+        mask >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+                        // ---------------------------
+                        // class FlatHashTableIterator
+                        // ---------------------------
+
+// PRIVATE MANIPULATORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+void FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::skipEmptyOrDeleted()
+{
+    BSLS_ASSERT_SAFE(d_control_p);
+
+    // Full control values are less than 'EMPTY'; the sentinel is greater.
+
+    while (*d_control_p >= FlatHashTable_GroupUtil::EMPTY
+        && *d_control_p != FlatHashTable_GroupUtil::SENTINEL) {
+        ++d_control_p;
+        ++d_slot_p;
+    }
+}
+
+// CREATORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::FlatHashTableIterator()
+: d_control_p(0)
+, d_slot_p(0)
+{
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::FlatHashTableIterator(
+                                                 const unsigned char *control,
+                                                 NcType              *slot)
+: d_control_p(control)
+, d_slot_p(slot)
+{
+    BSLS_ASSERT_SAFE(control);
+
+    skipEmptyOrDeleted();
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::FlatHashTableIterator(
+                                                        const NcIter& original)
+: d_control_p(original.control())
+, d_slot_p(original.slot())
+{
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>&
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_control_p);
+    BSLS_ASSERT_SAFE(*d_control_p < FlatHashTable_GroupUtil::EMPTY);
+
+    ++d_control_p;
+    ++d_slot_p;
+    skipEmptyOrDeleted();
+    return *this;
+}
+
+// ACCESSORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+typename FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::reference
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_slot_p);
+
+    return *d_slot_p;
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+typename FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::pointer
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_slot_p);
+
+    return d_slot_p;
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+const unsigned char *
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::control() const
+{
+    return d_control_p;
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+typename FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::NcType *
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::slot() const
+{
+    return d_slot_p;
+}
+
+// FREE OPERATORS
+template <class VALUE_TYPE1, class VALUE_TYPE2, class DIFFERENCE_TYPE>
+inline
+bool operator==(
+               const FlatHashTableIterator<VALUE_TYPE1, DIFFERENCE_TYPE>& lhs,
+               const FlatHashTableIterator<VALUE_TYPE2, DIFFERENCE_TYPE>& rhs)
+{
+    return lhs.control() == rhs.control();
+}
+
+template <class VALUE_TYPE1, class VALUE_TYPE2, class DIFFERENCE_TYPE>
+inline
+bool operator!=(
+               const FlatHashTableIterator<VALUE_TYPE1, DIFFERENCE_TYPE>& lhs,
+               const FlatHashTableIterator<VALUE_TYPE2, DIFFERENCE_TYPE>& rhs)
+{
+    return lhs.control() != rhs.control();
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>
+operator++(FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>& iter, int)
+{
+    FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE> temp(iter);
+    ++iter;
+    return temp;
+}
+
+                           // -------------------
+                           // class FlatHashTable
+                           // -------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::maxLoadForCapacity(
+                                                             SizeType capacity)
+{
+    return capacity - capacity / 8;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+                                 capacityForNumElements(SizeType numElements)
+{
+    if (0 == numElements) {
+        return 0;                                                     // RETURN
+    }
+
+    static const SizeType MAX_CAPACITY =
+                        (native_std::numeric_limits<SizeType>::max() >> 1) + 1;
+
+    SizeType capacity = GroupUtil::GROUP_SIZE;
+    while (maxLoadForCapacity(capacity) < numElements) {
+        if (capacity >= MAX_CAPACITY / 2) {
+            StdExceptUtil::throwLengthError(
+                                    "FlatHashTable ran out of powers of two.");
+        }
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::allocateArrays(
+                                                             SizeType capacity)
+{
+    BSLS_ASSERT_SAFE(0 == d_capacity);
+    BSLS_ASSERT_SAFE(0 == (capacity & (capacity - 1)));
+    BSLS_ASSERT_SAFE(GroupUtil::GROUP_SIZE <= capacity);
+
+    if (capacity > AllocatorTraits::max_size(d_allocator)) {
+        StdExceptUtil::throwLengthError(
+                                       "FlatHashTable capacity is too large.");
+    }
+
+    ControlAllocator controlAllocator(d_allocator);
+
+    unsigned char *controls = ControlTraits::allocate(controlAllocator,
+                                                      capacity + 1);
+    BSLS_TRY {
+        d_slots_p = AllocatorTraits::allocate(d_allocator, capacity);
+    }
+    BSLS_CATCH(...) {
+        ControlTraits::deallocate(controlAllocator, controls, capacity + 1);
+        BSLS_RETHROW;
+    }
+
+    native_std::memset(controls, GroupUtil::EMPTY, capacity);
+    controls[capacity] = GroupUtil::SENTINEL;
+
+    d_controls_p = controls;
+    d_capacity   = capacity;
+    d_growthLeft = maxLoadForCapacity(capacity) - d_size;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::deallocateArrays()
+{
+    if (d_capacity) {
+        ControlAllocator controlAllocator(d_allocator);
+
+        ControlTraits::deallocate(controlAllocator,
+                                  d_controls_p,
+                                  d_capacity + 1);
+        AllocatorTraits::deallocate(d_allocator, d_slots_p, d_capacity);
+    }
+
+    d_controls_p = GroupUtil::sharedEmptyControls();
+    d_slots_p    = 0;
+    d_capacity   = 0;
+    d_growthLeft = 0;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::destroyElements()
+{
+    for (SizeType i = 0; d_size; ++i) {
+        BSLS_ASSERT_SAFE(i < d_capacity);
+
+        if (d_controls_p[i] < GroupUtil::EMPTY) {
+            AllocatorTraits::destroy(d_allocator, d_slots_p + i);
+            --d_size;
+        }
+    }
+
+    if (d_capacity) {
+        native_std::memset(d_controls_p, GroupUtil::EMPTY, d_capacity);
+        d_growthLeft = maxLoadForCapacity(d_capacity);
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::prepareInsert(
+                                                   native_std::size_t hashCode)
+{
+    if (0 == d_capacity) {
+        rehashIntoCapacity(GroupUtil::GROUP_SIZE);
+    }
+
+    SizeType index = findFirstNonFull(hashCode);
+
+    if (0 == d_growthLeft && GroupUtil::EMPTY == d_controls_p[index]) {
+        // Reclaim the deleted slots by rehashing at the same capacity if the
+        // table would remain at most 25/32 full (so that at least 3/32 of the
+        // capacity can be inserted before the next rehash), and double the
+        // capacity otherwise.
+
+        rehashIntoCapacity(d_size * 32 <= d_capacity * 25
+                           ? d_capacity
+                           : d_capacity * 2);
+        index = findFirstNonFull(hashCode);
+    }
+
+    return index;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+                                quickSwapRetainAllocators(FlatHashTable *other)
+{
+    bslalg::SwapUtil::swap(&d_hasher,     &other->d_hasher);
+    bslalg::SwapUtil::swap(&d_comparator, &other->d_comparator);
+    bslalg::SwapUtil::swap(&d_controls_p, &other->d_controls_p);
+    bslalg::SwapUtil::swap(&d_slots_p,    &other->d_slots_p);
+    bslalg::SwapUtil::swap(&d_capacity,   &other->d_capacity);
+    bslalg::SwapUtil::swap(&d_size,       &other->d_size);
+    bslalg::SwapUtil::swap(&d_growthLeft, &other->d_growthLeft);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::rehashIntoCapacity(
+                                                          SizeType newCapacity)
+{
+    BSLS_ASSERT_SAFE(d_size <= maxLoadForCapacity(newCapacity));
+
+    // Build the new arrays in a temporary table, so that its destructor
+    // reclaims them if an exception is thrown.
+
+    FlatHashTable newTable(hasher(), comparator(), 0, d_allocator);
+    newTable.allocateArrays(newCapacity);
+
+    for (SizeType i = 0; i < d_capacity; ++i) {
+        if (d_controls_p[i] >= GroupUtil::EMPTY) {
+            continue;
+        }
+
+        const native_std::size_t hashCode = hashCodeForKey(
+                                       KEY_CONFIG::extractKey(d_slots_p[i]));
+        const SizeType index = newTable.findFirstNonFull(hashCode);
+
+        if (bslmf::IsBitwiseMoveable<ValueType>::value) {
+            // Transfer ownership of the element to 'newTable' immediately, so
+            // that each element is owned by exactly one table if the hasher
+            // throws.
+
+            native_std::memcpy(static_cast<void *>(newTable.d_slots_p + index),
+                               static_cast<void *>(d_slots_p + i),
+                               sizeof(ValueType));
+            setControl(i, GroupUtil::DELETED);
+            --d_size;
+        }
+        else {
+            AllocatorTraits::construct(newTable.d_allocator,
+                                       newTable.d_slots_p + index,
+                                       d_slots_p[i]);
+        }
+        newTable.setControl(index,
+                            static_cast<unsigned char>(
+                                        hashCode & GroupUtil::HASH_BITS_MASK));
+        ++newTable.d_size;
+        --newTable.d_growthLeft;
+    }
+
+    // Exchange arrays with 'newTable', which destroys the original elements
+    // (if they were copied) and deallocates the original arrays.
+
+    bslalg::SwapUtil::swap(&d_controls_p, &newTable.d_controls_p);
+    bslalg::SwapUtil::swap(&d_slots_p,    &newTable.d_slots_p);
+    bslalg::SwapUtil::swap(&d_capacity,   &newTable.d_capacity);
+    bslalg::SwapUtil::swap(&d_size,       &newTable.d_size);
+    bslalg::SwapUtil::swap(&d_growthLeft, &newTable.d_growthLeft);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::setControl(
+                                                        SizeType      index,
+                                                        unsigned char control)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+
+    d_controls_p[index] = control;
+}
+
+// PRIVATE ACCESSORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findFirstNonFull(
+                                             native_std::size_t hashCode) const
+{
+    BSLS_ASSERT_SAFE(0 != d_capacity);
+
+    const SizeType groupMask = d_capacity / GroupUtil::GROUP_SIZE - 1;
+    SizeType       group     = static_cast<SizeType>(hashCode >> 7)
+                             & groupMask;
+
+    for (SizeType probe = 1; ; ++probe) {
+        const SizeType offset = group * GroupUtil::GROUP_SIZE;
+        const BitMask  mask   = GroupUtil::matchEmptyOrDeleted(
+                                                        d_controls_p + offset);
+        if (mask) {
+            return offset + GroupUtil::lowestBitIndex(mask);          // RETURN
+        }
+
+        BSLS_ASSERT_SAFE(probe <= groupMask);
+
+        group = (group + probe) & groupMask;
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findIndex(
+                                           const KeyType&     key,
+                                           native_std::size_t hashCode) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_capacity)) {
+        return 0;                                                     // RETURN
+    }
+
+    const unsigned char h2 = static_cast<unsigned char>(
+                                         hashCode & GroupUtil::HASH_BITS_MASK);
+    const SizeType groupMask = d_capacity / GroupUtil::GROUP_SIZE - 1;
+    SizeType       group     = static_cast<SizeType>(hashCode >> 7)
+                             & groupMask;
+
+    for (SizeType probe = 1; ; ++probe) {
+        const SizeType       offset   = group * GroupUtil::GROUP_SIZE;
+        const unsigned char *controls = d_controls_p + offset;
+
+        for (BitMask mask = GroupUtil::match(controls, h2);
+             mask;
+             mask &= mask - 1) {
+            const SizeType index = offset + GroupUtil::lowestBitIndex(mask);
+
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_comparator(
+                                key,
+                                KEY_CONFIG::extractKey(d_slots_p[index])))) {
+                return index;                                         // RETURN
+            }
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                            GroupUtil::matchEmpty(controls))) {
+            return d_capacity;                                        // RETURN
+        }
+
+        BSLS_ASSERT_SAFE(probe <= groupMask);
+
+        group = (group + probe) & groupMask;
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+native_std::size_t
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hashCodeForKey(
+                                                      const KeyType& key) const
+{
+    // The low-order 7 bits of the hash code are stored in the control value,
+    // and the remaining bits select a group by masking, so a user-supplied
+    // hash code is post-mixed as for a power-of-two 'HashTable'.
+
+    return HashTable_ImpDetails::postMixHashCode(d_hasher(key));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::Iterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::iteratorAt(
+                                                          SizeType index) const
+{
+    BSLS_ASSERT_SAFE(index <= d_capacity);
+
+    return Iterator(d_controls_p + index, d_slots_p + index);
+}
+
+// CREATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::FlatHashTable(
+                                                    const ALLOCATOR& allocator)
+: d_hasher()
+, d_comparator()
+, d_allocator(allocator)
+, d_controls_p(GroupUtil::sharedEmptyControls())
+, d_slots_p(0)
+, d_capacity(0)
+, d_size(0)
+, d_growthLeft(0)
+{
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::FlatHashTable(
+                                          const HASHER&     hash,
+                                          const COMPARATOR& compare,
+                                          SizeType          initialNumElements,
+                                          const ALLOCATOR&  allocator)
+: d_hasher(hash)
+, d_comparator(compare)
+, d_allocator(allocator)
+, d_controls_p(GroupUtil::sharedEmptyControls())
+, d_slots_p(0)
+, d_capacity(0)
+, d_size(0)
+, d_growthLeft(0)
+{
+    if (initialNumElements) {
+        allocateArrays(capacityForNumElements(initialNumElements));
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::FlatHashTable(
+                                                 const FlatHashTable& original)
+: d_hasher(original.d_hasher)
+, d_comparator(original.d_comparator)
+, d_allocator(AllocatorTraits::select_on_container_copy_construction(
+                                                     original.allocator()))
+, d_controls_p(GroupUtil::sharedEmptyControls())
+, d_slots_p(0)
+, d_capacity(0)
+, d_size(0)
+, d_growthLeft(0)
+{
+    if (original.d_size) {
+        // Copying the original arrays preserves the position of each element,
+        // and does not call the hasher.
+
+        allocateArrays(original.d_capacity);
+        for (SizeType i = 0; i < d_capacity; ++i) {
+            if (original.d_controls_p[i] < GroupUtil::EMPTY) {
+                AllocatorTraits::construct(d_allocator,
+                                           d_slots_p + i,
+                                           original.d_slots_p[i]);
+                d_controls_p[i] = original.d_controls_p[i];
+                ++d_size;
+            }
+        }
+        d_growthLeft = maxLoadForCapacity(d_capacity) - d_size;
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::FlatHashTable(
+                                            const FlatHashTable& original,
+                                            const ALLOCATOR&     allocator)
+: d_hasher(original.d_hasher)
+, d_comparator(original.d_comparator)
+, d_allocator(allocator)
+, d_controls_p(GroupUtil::sharedEmptyControls())
+, d_slots_p(0)
+, d_capacity(0)
+, d_size(0)
+, d_growthLeft(0)
+{
+    if (original.d_size) {
+        allocateArrays(original.d_capacity);
+        for (SizeType i = 0; i < d_capacity; ++i) {
+            if (original.d_controls_p[i] < GroupUtil::EMPTY) {
+                AllocatorTraits::construct(d_allocator,
+                                           d_slots_p + i,
+                                           original.d_slots_p[i]);
+                d_controls_p[i] = original.d_controls_p[i];
+                ++d_size;
+            }
+        }
+        d_growthLeft = maxLoadForCapacity(d_capacity) - d_size;
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::~FlatHashTable()
+{
+    destroyElements();
+    deallocateArrays();
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>&
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::operator=(
+                                                      const FlatHashTable& rhs)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(this != &rhs)) {
+        if (AllocatorTraits::propagate_on_container_copy_assignment::VALUE) {
+            // Exchange the allocators after the data members, so that
+            // 'other' releases the arrays of this object with the allocator
+            // that supplied them.
+
+            FlatHashTable other(rhs, rhs.allocator());
+            quickSwapRetainAllocators(&other);
+            bslalg::SwapUtil::swap(&d_allocator, &other.d_allocator);
+        }
+        else {
+            FlatHashTable other(rhs, this->allocator());
+            quickSwapRetainAllocators(&other);
+        }
+    }
+    return *this;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::Iterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::begin()
+{
+    return iteratorAt(0);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::Iterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::end()
+{
+    return iteratorAt(d_capacity);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::Iterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::erase(
+                                                    ConstIterator position)
+{
+    BSLS_ASSERT_SAFE(position.control() >= d_controls_p);
+    BSLS_ASSERT_SAFE(position.control() <  d_controls_p + d_capacity);
+    BSLS_ASSERT_SAFE(*position.control() < GroupUtil::EMPTY);
+
+    const SizeType index = static_cast<SizeType>(
+                                            position.control() - d_controls_p);
+
+    AllocatorTraits::destroy(d_allocator, d_slots_p + index);
+    --d_size;
+
+    // A probe sequence ends at the first group having an empty slot, so if the
+    // group of the erased slot has an empty slot, no probe sequence continues
+    // past that group, and the erased slot can be marked empty (and reused)
+    // rather than deleted.
+
+    const SizeType offset = index & ~static_cast<SizeType>(
+                                                  GroupUtil::GROUP_SIZE - 1);
+    if (GroupUtil::matchEmpty(d_controls_p + offset)) {
+        setControl(index, GroupUtil::EMPTY);
+        ++d_growthLeft;
+    }
+    else {
+        setControl(index, GroupUtil::DELETED);
+    }
+
+    return iteratorAt(index + 1);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::Iterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
+                                                            const KeyType& key)
+{
+    return iteratorAt(findIndex(key, hashCodeForKey(key)));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename FlatHashTable<KEY_CONFIG,
+                                 HASHER,
+                                 COMPARATOR,
+                                 ALLOCATOR>::Iterator,
+          bool>
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
+                                                        const ValueType& value)
+{
+    const KeyType&           key      = KEY_CONFIG::extractKey(value);
+    const native_std::size_t hashCode = hashCodeForKey(key);
+
+    SizeType index = findIndex(key, hashCode);
+    if (index < d_capacity) {
+        return bsl::pair<Iterator, bool>(iteratorAt(index), false);   // RETURN
+    }
+
+    // Note that 'value' cannot be an element of this table, so the following
+    // rehash does not invalidate it.
+
+    index = prepareInsert(hashCode);
+
+    AllocatorTraits::construct(d_allocator, d_slots_p + index, value);
+
+    if (GroupUtil::EMPTY == d_controls_p[index]) {
+        --d_growthLeft;
+    }
+    setControl(index,
+               static_cast<unsigned char>(
+                                        hashCode & GroupUtil::HASH_BITS_MASK));
+    ++d_size;
+
+    return bsl::pair<Iterator, bool>(iteratorAt(index), true);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::Iterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
+                                                 bool          *isInsertedFlag,
+                                                 const KeyType& key)
+{
+    BSLS_ASSERT(isInsertedFlag);
+
+    typedef typename ValueType::second_type MappedType;
+
+    const native_std::size_t hashCode = hashCodeForKey(key);
+
+    SizeType index = findIndex(key, hashCode);
+    *isInsertedFlag = index >= d_capacity;
+
+    if (*isInsertedFlag) {
+        index = prepareInsert(hashCode);
+
+        AllocatorTraits::construct(d_allocator,
+                                   d_slots_p + index,
+                                   key,
+                                   MappedType());
+
+        if (GroupUtil::EMPTY == d_controls_p[index]) {
+            --d_growthLeft;
+        }
+        setControl(index,
+                   static_cast<unsigned char>(
+                                        hashCode & GroupUtil::HASH_BITS_MASK));
+        ++d_size;
+    }
+
+    return iteratorAt(index);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAll()
+{
+    destroyElements();
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::rehashForNumSlots(
+                                                             SizeType numSlots)
+{
+    SizeType newCapacity = capacityForNumElements(d_size);
+    if (newCapacity < numSlots) {
+        newCapacity = numSlots < GroupUtil::GROUP_SIZE
+                    ? static_cast<SizeType>(GroupUtil::GROUP_SIZE)
+                    : HashTable_ImpDetails::nextPowerOfTwo(numSlots);
+    }
+
+    if (newCapacity > d_capacity) {
+        rehashIntoCapacity(newCapacity);
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+                                    reserveForNumElements(SizeType numElements)
+{
+    const SizeType newCapacity = capacityForNumElements(numElements);
+
+    if (newCapacity > d_capacity) {
+        rehashIntoCapacity(newCapacity);
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::swap(
+                                                          FlatHashTable& other)
+{
+    if (AllocatorTraits::propagate_on_container_swap::VALUE) {
+        bslalg::SwapUtil::swap(&d_allocator, &other.d_allocator);
+    }
+    else {
+        BSLS_ASSERT(d_allocator == other.d_allocator);
+    }
+
+    quickSwapRetainAllocators(&other);
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+ALLOCATOR
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::allocator() const
+{
+    return d_allocator;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+                                                                 ConstIterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return iteratorAt(0);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+const COMPARATOR&
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_comparator.functor();
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+                                                                 ConstIterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::end() const
+{
+    return iteratorAt(d_capacity);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+                                                                 ConstIterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
+                                                      const KeyType& key) const
+{
+    return iteratorAt(findIndex(key, hashCodeForKey(key)));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+const HASHER&
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hasher() const
+{
+    return d_hasher.functor();
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+float
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::loadFactor() const
+{
+    return d_capacity
+         ? static_cast<float>(static_cast<double>(d_size) /
+                              static_cast<double>(d_capacity))
+         : 0.0f;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+float
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::maxLoadFactor() const
+{
+    return 0.875f;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::maxSize() const
+{
+    return maxLoadForCapacity(
+                  (native_std::numeric_limits<SizeType>::max() >> 1) /
+                  (sizeof(ValueType) + 1) + 1);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_size;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bool bslstl::operator==(
+   const bslstl::FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& lhs,
+   const bslstl::FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& rhs)
+{
+    typedef typename bslstl::FlatHashTable<KEY_CONFIG,
+                                           HASHER,
+                                           COMPARATOR,
+                                           ALLOCATOR>::ConstIterator Iterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (Iterator it = lhs.begin(); it != lhs.end(); ++it) {
+        Iterator match = rhs.find(KEY_CONFIG::extractKey(*it));
+        if (rhs.end() == match || !(*match == *it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bool bslstl::operator!=(
+   const bslstl::FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& lhs,
+   const bslstl::FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void bslstl::swap(
+           bslstl::FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& a,
+           bslstl::FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
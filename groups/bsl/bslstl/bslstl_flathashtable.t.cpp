@@ -0,0 +1,1316 @@
+// bslstl_flathashtable.t.cpp                                         -*-C++-*-
+#include <bslstl_flathashtable.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_equalto.h>
+#include <bslstl_hash.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_unorderedset.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+
+#include <bsltf_allocbitwisemoveabletesttype.h>
+#include <bsltf_alloctesttype.h>
+#include <bsltf_stdstatefulallocator.h>
+
+#include <stdexcept>  // for 'std::length_error'
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test defines a class template, 'bslstl::FlatHashTable',
+// implementing an open-addressing hash table, together with its iterator,
+// 'bslstl::FlatHashTableIterator', and a component-private utility,
+// 'bslstl::FlatHashTable_GroupUtil', that matches a group of control values
+// in parallel.
+//
+// We first test the group utility in isolation, using hand-built groups of
+// control values.  We then test the table using hash functors that either
+// spread keys evenly, or map every key to the same hash code, to exercise
+// probe sequences that cross many groups.  Deleted slots (tombstones) are
+// exercised by erasing elements from full groups, and then inserting further
+// elements.  Finally we test the value-semantic operations, and the exception
+// safety of insertion for element types that are, and are not, bitwise
+// moveable.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o All memory is allocated from the allocator supplied to the table.
+// ----------------------------------------------------------------------------
+// FlatHashTable_GroupUtil
+// [ 2] BitMask match(const unsigned char *group, unsigned char h2);
+// [ 2] BitMask matchEmpty(const unsigned char *group);
+// [ 2] BitMask matchEmptyOrDeleted(const unsigned char *group);
+// [ 2] int lowestBitIndex(BitMask mask);
+// [ 2] unsigned char *sharedEmptyControls();
+//
+// FlatHashTable
+// [ 3] FlatHashTable(const ALLOCATOR& allocator);
+// [ 5] FlatHashTable(hash, compare, initialNumElements, allocator);
+// [ 6] FlatHashTable(const FlatHashTable& original);
+// [ 6] FlatHashTable(const FlatHashTable& original, const ALLOCATOR& a);
+// [ 3] ~FlatHashTable();
+// [ 6] FlatHashTable& operator=(const FlatHashTable& rhs);
+// [ 3] Iterator begin();
+// [ 3] Iterator end();
+// [ 4] Iterator erase(ConstIterator position);
+// [ 3] Iterator find(const KeyType& key);
+// [ 3] pair<Iterator, bool> insert(const ValueType& value);
+// [ 3] Iterator insertIfMissing(bool *isInsertedFlag, const KeyType& key);
+// [ 4] void removeAll();
+// [ 5] void rehashForNumSlots(SizeType numSlots);
+// [ 5] void reserveForNumElements(SizeType numElements);
+// [ 6] void swap(FlatHashTable& other);
+// [ 3] ALLOCATOR allocator() const;
+// [ 3] SizeType capacity() const;
+// [ 3] ConstIterator find(const KeyType& key) const;
+// [ 5] float loadFactor() const;
+// [ 5] float maxLoadFactor() const;
+// [ 5] SizeType maxSize() const;
+// [ 3] SizeType size() const;
+// [ 6] bool operator==(const FlatHashTable& lhs, const FlatHashTable& rhs);
+// [ 6] bool operator!=(const FlatHashTable& lhs, const FlatHashTable& rhs);
+// [ 6] void swap(FlatHashTable& a, FlatHashTable& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [ 7] CONCERN: 'insert' is exception neutral and does not leak
+// [-1] PERFORMANCE TEST: lookup compared to 'bsl::unordered_set'
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::FlatHashTable_GroupUtil GroupUtil;
+
+typedef bslstl::UnorderedSetKeyConfiguration<int> IntConfig;
+
+typedef bslstl::FlatHashTable<IntConfig,
+                              bsl::hash<int>,
+                              bsl::equal_to<int> > Obj;
+
+namespace {
+
+struct ConstantHash {
+    // This hash functor maps every key to the same hash code, so that every
+    // key has the same probe sequence.
+
+    size_t operator()(int) const
+    {
+        return 0x5A5A;
+    }
+};
+
+typedef bslstl::FlatHashTable<IntConfig,
+                              ConstantHash,
+                              bsl::equal_to<int> > CollidingObj;
+
+template <class TYPE>
+struct DataHash {
+    // This hash functor hashes a 'bsltf' test type by its 'data' attribute.
+
+    size_t operator()(const TYPE& value) const
+    {
+        return static_cast<size_t>(value.data()) * 2654435761u;
+    }
+};
+
+template <class TABLE>
+class ExceptionGuard {
+    // This class verifies, on destruction, that the size of a table is
+    // unchanged, unless 'release' has been called.
+
+    // DATA
+    const TABLE *d_table_p;  // table to check, or 0 if released
+    size_t       d_size;     // expected size of the table
+
+  public:
+    // CREATORS
+    ExceptionGuard(const TABLE *table, size_t size)
+    : d_table_p(table)
+    , d_size(size)
+    {
+    }
+
+    ~ExceptionGuard()
+    {
+        if (d_table_p) {
+            ASSERTV(d_size, d_table_p->size(), d_size == d_table_p->size());
+        }
+    }
+
+    // MANIPULATORS
+    void release()
+    {
+        d_table_p = 0;
+    }
+};
+
+template <class TABLE>
+int countByIteration(const TABLE& table)
+    // Return the number of elements of the specified 'table', counted by
+    // iterating over it.
+{
+    int result = 0;
+    for (typename TABLE::ConstIterator it = table.begin();
+         it != table.end();
+         ++it) {
+        ++result;
+    }
+    return result;
+}
+
+bool isPowerOfTwo(size_t n)
+    // Return 'true' if the specified 'n' is a power of two, and 'false'
+    // otherwise.
+{
+    return 0 != n && 0 == (n & (n - 1));
+}
+
+template <class ELEMENT>
+void testInsertExceptionSafety(const char *typeName)
+    // Insert enough elements of the (template parameter) type 'ELEMENT' into
+    // a table to rehash it several times, injecting an allocation failure at
+    // every allocation, and verify that the table is unchanged by each failed
+    // insertion, and that no memory is leaked.  Use the specified 'typeName'
+    // in diagnostics.
+{
+    typedef bslstl::UnorderedSetKeyConfiguration<ELEMENT>         Config;
+    typedef bslstl::FlatHashTable<Config,
+                                  DataHash<ELEMENT>,
+                                  bsl::equal_to<ELEMENT> >        Table;
+
+    if (verbose) printf("\tElement type: %s\n", typeName);
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    {
+        Table mX(&oa);  const Table& X = mX;
+
+        for (int i = 0; i < 100; ++i) {
+            const ELEMENT VALUE(i, &sa);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const size_t SIZE = X.size();
+
+                ExceptionGuard<Table> guard(&X, SIZE);
+
+                ASSERTV(i, mX.insert(VALUE).second);
+                ASSERTV(i, SIZE + 1 == X.size());
+
+                guard.release();
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(i, X.end() != X.find(VALUE));
+            ASSERTV(i, i + 1 == countByIteration(X));
+        }
+    }
+    ASSERTV(typeName, 0 == oa.numBlocksInUse());
+}
+
+template <class ALLOCATOR>
+void testPropagatingAssignment(const char *allocatorName)
+    // Assign a table using the (template parameter) type 'ALLOCATOR', which
+    // is configured to propagate on copy assignment, and verify that the
+    // target acquires the value of the source, that the target acquires the
+    // allocator of the source if and only if 'bsl::allocator_traits' reports
+    // that 'ALLOCATOR' propagates on copy assignment, and that the memory of
+    // each table is released to the allocator that supplied it.  Use the
+    // specified 'allocatorName' in diagnostics.
+{
+    typedef bslstl::FlatHashTable<IntConfig,
+                                  bsl::hash<int>,
+                                  bsl::equal_to<int>,
+                                  ALLOCATOR>             Table;
+
+    typedef bsl::allocator_traits<ALLOCATOR>                  Traits;
+
+    const bool PROPAGATE =
+                         Traits::propagate_on_container_copy_assignment::VALUE;
+
+    if (verbose) printf("	Allocator type: %s\n", allocatorName);
+
+    bslma::TestAllocator sa("source", veryVeryVeryVerbose);
+    bslma::TestAllocator ta("target", veryVeryVeryVerbose);
+
+    {
+        Table mS((ALLOCATOR(&sa)));  const Table& S = mS;
+        Table mT((ALLOCATOR(&ta)));  const Table& T = mT;
+
+        for (int i = 0; i < 100; ++i) {
+            mS.insert(i);
+        }
+        for (int i = 0; i < 20; ++i) {
+            mT.insert(-1 - i);
+        }
+        ASSERTV(allocatorName, 2 == sa.numBlocksInUse());
+        ASSERTV(allocatorName, 2 == ta.numBlocksInUse());
+
+        mT = S;
+
+        ASSERTV(allocatorName, S == T);
+        if (PROPAGATE) {
+            ASSERTV(allocatorName, ALLOCATOR(&sa) == T.allocator());
+            ASSERTV(allocatorName, 4 == sa.numBlocksInUse());
+            ASSERTV(allocatorName, 0 == ta.numBlocksInUse());
+        }
+        else {
+            ASSERTV(allocatorName, ALLOCATOR(&ta) == T.allocator());
+            ASSERTV(allocatorName, 2 == sa.numBlocksInUse());
+            ASSERTV(allocatorName, 2 == ta.numBlocksInUse());
+        }
+
+        mT.insert(1000);
+        ASSERTV(allocatorName, S.end() == S.find(1000));
+        ASSERTV(allocatorName, T.end() != T.find(1000));
+    }
+    ASSERTV(allocatorName, 0 == sa.numBlocksInUse());
+    ASSERTV(allocatorName, 0 == ta.numBlocksInUse());
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+static void usageExample()
+{
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Implementing a Flat Hashed Set Container
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we wish to implement a set of unique 'int' values, that minimizes
+// the number of allocations and cache misses incurred by a lookup.
+//
+// First, we define the key configuration for the table, which is simply the
+// one used by 'bsl::unordered_set':
+//..
+    typedef bslstl::UnorderedSetKeyConfiguration<int> SetConfig;
+//..
+// Then, we define our table type:
+//..
+    typedef bslstl::FlatHashTable<SetConfig,
+                                  bsl::hash<int>,
+                                  bsl::equal_to<int> > IntTable;
+//..
+// Next, we create a table and insert some values:
+//..
+    bslma::TestAllocator oa;
+    IntTable             table(&oa);
+
+    for (int i = 0; i < 100; ++i) {
+        table.insert(i * i);
+    }
+    ASSERT(100 == table.size());
+    ASSERT(  2 == oa.numBlocksInUse());
+//..
+// Notice that the table uses only two blocks of memory (one array of slots,
+// and one array of control values), however many elements it holds.
+//
+// Finally, we look up some values:
+//..
+    ASSERT(table.end() != table.find(49));
+    ASSERT(table.end() == table.find(50));
+//..
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: No memory is ever allocated from the global allocator.
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        usageExample();
+
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY OF 'insert'
+        //
+        // Concerns:
+        //: 1 If an allocation fails while inserting an element, the table is
+        //:   left unchanged (strong guarantee), including when the failure
+        //:   occurs while rehashing.
+        //:
+        //: 2 No memory is leaked, whether elements are rehashed by copying or
+        //:   by bitwise moving.
+        //
+        // Plan:
+        //: 1 For a type that allocates memory and is not bitwise moveable,
+        //:   and for one that allocates memory and is bitwise moveable,
+        //:   insert 100 elements into a table (causing several rehashes) in
+        //:   the scope of the 'bslma::TestAllocator' exception test macros,
+        //:   and verify after each failed insertion that the size of the table
+        //:   is unchanged.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: 'insert' is exception neutral and does not leak
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY OF 'insert'"
+                            "\n============================\n");
+
+        testInsertExceptionSafety<bsltf::AllocTestType>("AllocTestType");
+        testInsertExceptionSafety<bsltf::AllocBitwiseMoveableTestType>(
+                                               "AllocBitwiseMoveableTestType");
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original, and uses the supplied
+        //:   allocator (or the default allocator if none is supplied).
+        //:
+        //: 2 Tables compare equal if and only if they have the same elements,
+        //:   regardless of their capacities or of the order in which their
+        //:   elements were inserted.
+        //:
+        //: 3 Assignment gives the target the value of the source, retains the
+        //:   allocator of the target, and is alias-safe.
+        //:
+        //: 4 'swap' exchanges values without allocating memory.
+        //:
+        //: 5 If 'bsl::allocator_traits' reports that the allocator propagates
+        //:   on copy assignment, assignment gives the target the allocator of
+        //:   the source, whether or not the allocator propagates on swap;
+        //:   in either case the memory of each table is released to the
+        //:   allocator that supplied it.
+        //
+        // Plan:
+        //: 1 Create tables with the same elements, inserted in different
+        //:   orders and with different capacities, and tables differing by
+        //:   one element, and verify the results of the equality operators.
+        //:   (C-2)
+        //:
+        //: 2 Copy, assign and swap those tables, verifying their values and
+        //:   the allocators from which memory was allocated.  (C-1, 3..4)
+        //:
+        //: 3 Using 'bsltf::StdStatefulAllocator' configured to propagate on
+        //:   copy assignment, and to propagate or not on swap, assign a table
+        //:   to a table using a different allocator, and verify the value and
+        //:   allocator of the target, and the memory in use from each
+        //:   allocator.  (C-5)
+        //
+        // Testing:
+        //   FlatHashTable(const FlatHashTable& original);
+        //   FlatHashTable(const FlatHashTable& original, const ALLOCATOR& a);
+        //   FlatHashTable& operator=(const FlatHashTable& rhs);
+        //   void swap(FlatHashTable& other);
+        //   bool operator==(const FlatHashTable&, const FlatHashTable&);
+        //   bool operator!=(const FlatHashTable&, const FlatHashTable&);
+        //   void swap(FlatHashTable& a, FlatHashTable& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP AND EQUALITY"
+                            "\n===================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other", veryVeryVeryVerbose);
+
+        {
+            Obj mA(&oa);  const Obj& A = mA;
+            Obj mB(bsl::hash<int>(), bsl::equal_to<int>(), 1000, &oa);
+            const Obj& B = mB;
+            Obj mC(&oa);  const Obj& C = mC;
+            Obj mE(&oa);  const Obj& E = mE;
+
+            for (int i = 0; i < 200; ++i) {
+                mA.insert(i);
+                mB.insert(199 - i);
+                mC.insert(i == 100 ? 1000 : i);
+            }
+            ASSERT(A.capacity() != B.capacity());
+
+            ASSERT(  A == A );    ASSERT(!(A != A));
+            ASSERT(  A == B );    ASSERT(!(A != B));
+            ASSERT(!(A == C));    ASSERT(  A != C );
+            ASSERT(!(A == E));    ASSERT(  A != E );
+            ASSERT(  E == E );
+
+            if (verbose) printf("\tCopy construction.\n");
+            {
+                Obj mX(A);  const Obj& X = mX;
+                ASSERT(A == X);
+                ASSERT(&defaultAllocator == X.allocator());
+
+                Obj mY(C, &za);  const Obj& Y = mY;
+                ASSERT(C == Y);
+                ASSERT(&za == Y.allocator());
+                ASSERT(2 == za.numBlocksInUse());
+
+                Obj mZ(E, &za);  const Obj& Z = mZ;
+                ASSERT(E == Z);
+                ASSERT(0 == Z.capacity());
+                ASSERT(2 == za.numBlocksInUse());
+            }
+            ASSERT(0 == za.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+            if (verbose) printf("\tAssignment.\n");
+            {
+                Obj mX(&za);  const Obj& X = mX;
+                mX.insert(-1);
+
+                mX = C;
+                ASSERT(C == X);
+                ASSERT(&za == X.allocator());
+                ASSERT(2 == za.numBlocksInUse());
+
+                mX = X;
+                ASSERT(C == X);
+
+                mX = E;
+                ASSERT(E == X);
+                ASSERT(0 == za.numBlocksInUse());
+            }
+
+            if (verbose) printf("\tSwap.\n");
+            {
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                mA.swap(mC);
+                ASSERT(!(A == B));
+                ASSERT(  C == B );
+
+                swap(mA, mC);
+                ASSERT(  A == B );
+                ASSERT(!(C == B));
+
+                mE.swap(mA);
+                ASSERT(0 == A.size());
+                ASSERT(B == E);
+
+                ASSERT(oam.isTotalSame());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tAssignment with propagating allocators.\n");
+        {
+            typedef bsltf::StdStatefulAllocator<int, true, true, false, true>
+                                                       PropagateOnAssignment;
+            typedef bsltf::StdStatefulAllocator<int, true, true, true, true>
+                                                       PropagateAlways;
+
+            testPropagatingAssignment<PropagateOnAssignment>(
+                                                     "PropagateOnAssignment");
+            testPropagatingAssignment<PropagateAlways>("PropagateAlways");
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CAPACITY MANAGEMENT
+        //
+        // Concerns:
+        //: 1 The capacity of a table is always 0, or a power of two not less
+        //:   than the group size.
+        //:
+        //: 2 A table constructed (or reserved) for 'N' elements can hold 'N'
+        //:   elements without allocating memory.
+        //:
+        //: 3 'rehashForNumSlots' never shrinks the table.
+        //:
+        //: 4 The load factor never exceeds the maximum load factor.
+        //:
+        //: 5 Requests for impossibly large tables throw 'std::length_error'.
+        //
+        // Plan:
+        //: 1 For a series of requested sizes, construct tables, reserve and
+        //:   rehash, and verify the capacities and the number of allocations
+        //:   made while inserting the requested number of elements.  (C-1..4)
+        //:
+        //: 2 Verify that reserving and rehashing for 'maxSize() + 1' and for
+        //:   the maximum 'size_t' value throws 'std::length_error'.  (C-5)
+        //
+        // Testing:
+        //   FlatHashTable(hash, compare, initialNumElements, allocator);
+        //   void rehashForNumSlots(SizeType numSlots);
+        //   void reserveForNumElements(SizeType numElements);
+        //   float loadFactor() const;
+        //   float maxLoadFactor() const;
+        //   SizeType maxSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCAPACITY MANAGEMENT"
+                            "\n===================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        static const struct {
+            int    d_line;
+            size_t d_numElements;
+            size_t d_expCapacity;
+        } DATA[] = {
+            //LINE  NUM ELEMENTS  EXP CAPACITY
+            //----  ------------  ------------
+            { L_,             0,            0 },
+            { L_,             1,           16 },
+            { L_,            14,           16 },
+            { L_,            15,           32 },
+            { L_,            28,           32 },
+            { L_,            29,           64 },
+            { L_,           896,         1024 },
+            { L_,           897,         2048 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE = DATA[ti].d_line;
+            const size_t N    = DATA[ti].d_numElements;
+            const size_t EXP  = DATA[ti].d_expCapacity;
+
+            {
+                Obj mX(bsl::hash<int>(), bsl::equal_to<int>(), N, &oa);
+                const Obj& X = mX;
+                ASSERTV(LINE, X.capacity(), EXP == X.capacity());
+
+                bslma::TestAllocatorMonitor oam(&oa);
+                for (int i = 0; i < static_cast<int>(N); ++i) {
+                    mX.insert(i);
+                    ASSERTV(LINE, X.loadFactor() <= X.maxLoadFactor());
+                }
+                ASSERTV(LINE, oam.isTotalSame());
+            }
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                mX.reserveForNumElements(N);
+                ASSERTV(LINE, X.capacity(), EXP == X.capacity());
+
+                mX.rehashForNumSlots(0);
+                ASSERTV(LINE, X.capacity(), EXP == X.capacity());
+
+                const size_t SLOTS = (EXP ? EXP : 16) * 4;
+
+                mX.rehashForNumSlots(SLOTS - 1);
+                ASSERTV(LINE, X.capacity(), SLOTS == X.capacity());
+                ASSERTV(LINE, isPowerOfTwo(X.capacity()));
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tGrowth is by doubling.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            size_t lastCapacity = 0;
+            for (int i = 0; i < 5000; ++i) {
+                mX.insert(i);
+                if (X.capacity() != lastCapacity) {
+                    ASSERTV(i, X.capacity(), isPowerOfTwo(X.capacity()));
+                    ASSERTV(i, 0 == lastCapacity
+                            || 2 * lastCapacity == X.capacity());
+                    lastCapacity = X.capacity();
+                }
+                ASSERTV(i, X.loadFactor() <= X.maxLoadFactor());
+            }
+            ASSERT(2 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tImpossible sizes.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0 < X.maxSize());
+            ASSERT(0.875f == X.maxLoadFactor());
+            ASSERT(0.0f == X.loadFactor());
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool caught = false;
+            try {
+                mX.reserveForNumElements(~static_cast<size_t>(0));
+            }
+            catch (const std::length_error&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                mX.rehashForNumSlots(~static_cast<size_t>(0));
+            }
+            catch (const std::length_error&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(0 == X.capacity());
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ERASE AND DELETED SLOTS
+        //
+        // Concerns:
+        //: 1 'erase' removes exactly the element at the specified position,
+        //:   destroys it, and returns an iterator to the next element.
+        //:
+        //: 2 Elements whose probe sequence passes through an erased slot can
+        //:   still be found.
+        //:
+        //: 3 Repeatedly inserting and erasing elements (leaving deleted slots)
+        //:   does not grow the table without bound.
+        //:
+        //: 4 'removeAll' destroys all elements and retains the capacity.
+        //
+        // Plan:
+        //: 1 Using a hash functor that maps every key to the same hash code,
+        //:   insert enough elements to fill several groups, erase every other
+        //:   one, and verify that the remaining elements are found, and that
+        //:   the erased ones are not.  (C-1..2)
+        //:
+        //: 2 Erase all elements by iterating with the result of 'erase'.
+        //:   (C-1)
+        //:
+        //: 3 Repeatedly insert and erase a rolling window of keys, and verify
+        //:   that the capacity remains bounded.  (C-3)
+        //:
+        //: 4 Call 'removeAll' on a table of 'bsltf::AllocTestType' elements,
+        //:   and verify the memory in use by the elements is released.  (C-4)
+        //
+        // Testing:
+        //   Iterator erase(ConstIterator position);
+        //   void removeAll();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nERASE AND DELETED SLOTS"
+                            "\n=======================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tErase from colliding probe sequences.\n");
+        {
+            CollidingObj mX(&oa);  const CollidingObj& X = mX;
+
+            const int N = 100;
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(i, mX.insert(i).second);
+            }
+            for (int i = 0; i < N; i += 2) {
+                CollidingObj::Iterator it = mX.find(i);
+                ASSERTV(i, X.end() != it);
+                mX.erase(it);
+                ASSERTV(i, X.end() == X.find(i));
+            }
+            ASSERT(N / 2 == X.size());
+            ASSERT(N / 2 == countByIteration(X));
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(i, (X.end() == X.find(i)) == (0 == i % 2));
+            }
+
+            // Reinsert the erased keys, reusing the deleted slots.
+
+            const size_t CAPACITY = X.capacity();
+            for (int i = 0; i < N; i += 2) {
+                ASSERTV(i, mX.insert(i).second);
+            }
+            ASSERT(CAPACITY == X.capacity());
+            ASSERT(N == X.size());
+
+            int numErased = 0;
+            for (CollidingObj::Iterator it = mX.begin(); it != mX.end(); ) {
+                it = mX.erase(it);
+                ++numErased;
+            }
+            ASSERT(N == numErased);
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+        }
+
+        if (verbose) printf("\tChurn does not grow the table.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            const int WINDOW = 1000;
+            for (int i = 0; i < WINDOW; ++i) {
+                mX.insert(i);
+            }
+            const size_t CAPACITY = X.capacity();
+
+            for (int i = WINDOW; i < 100 * WINDOW; ++i) {
+                mX.insert(i);
+                mX.erase(mX.find(i - WINDOW));
+                ASSERTV(i, WINDOW == X.size());
+            }
+            ASSERTV(CAPACITY, X.capacity(), CAPACITY == X.capacity());
+            ASSERT(WINDOW == countByIteration(X));
+            for (int i = 99 * WINDOW; i < 100 * WINDOW; ++i) {
+                ASSERTV(i, X.end() != X.find(i));
+            }
+        }
+
+        if (verbose) printf("\t'removeAll'.\n");
+        {
+            typedef bslstl::UnorderedSetKeyConfiguration<bsltf::AllocTestType>
+                                                                   AllocConfig;
+            typedef bslstl::FlatHashTable<
+                                     AllocConfig,
+                                     DataHash<bsltf::AllocTestType>,
+                                     bsl::equal_to<bsltf::AllocTestType> >
+                                                                   AllocTable;
+
+            AllocTable mX(&oa);  const AllocTable& X = mX;
+            for (int i = 0; i < 50; ++i) {
+                mX.insert(bsltf::AllocTestType(i, &oa));
+            }
+            ASSERT(52 == oa.numBlocksInUse());
+
+            const size_t CAPACITY = X.capacity();
+            mX.removeAll();
+            ASSERT(0 == X.size());
+            ASSERT(CAPACITY == X.capacity());
+            ASSERT(2 == oa.numBlocksInUse());
+            ASSERT(X.begin() == X.end());
+
+            mX.insert(bsltf::AllocTestType(7, &oa));
+            ASSERT(1 == X.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERT, FIND AND ITERATION
+        //
+        // Concerns:
+        //: 1 A default-constructed table has no elements and allocates no
+        //:   memory.
+        //:
+        //: 2 'insert' adds an element if and only if no element has the same
+        //:   key, and returns an iterator referring to the element having the
+        //:   key.
+        //:
+        //: 3 'find' locates every inserted key, and no other key, including
+        //:   when every key has the same hash code.
+        //:
+        //: 4 Iteration visits every element exactly once.
+        //:
+        //: 5 'insertIfMissing' inserts a default-constructed mapped value only
+        //:   for a missing key.
+        //:
+        //: 6 All memory comes from the supplied allocator.
+        //
+        // Plan:
+        //: 1 Insert a series of keys into tables having an ordinary hash
+        //:   functor, and one mapping all keys to the same hash code, and
+        //:   verify the result of each insertion and the results of 'find' and
+        //:   iteration after each insertion.  (C-1..4, 6)
+        //:
+        //: 2 Use 'insertIfMissing' on a table of pairs.  (C-5)
+        //
+        // Testing:
+        //   FlatHashTable(const ALLOCATOR& allocator);
+        //   ~FlatHashTable();
+        //   Iterator begin();
+        //   Iterator end();
+        //   Iterator find(const KeyType& key);
+        //   pair<Iterator, bool> insert(const ValueType& value);
+        //   Iterator insertIfMissing(bool *isInsertedFlag, const KeyType&);
+        //   ALLOCATOR allocator() const;
+        //   SizeType capacity() const;
+        //   ConstIterator find(const KeyType& key) const;
+        //   SizeType size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERT, FIND AND ITERATION"
+                            "\n==========================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tDefault construction.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.end() == X.find(0));
+            ASSERT(&oa == X.allocator());
+            ASSERT(0 == oa.numBlocksTotal());
+        }
+
+        if (verbose) printf("\tInsert and find.\n");
+        {
+            Obj          mX(&oa);  const Obj&          X = mX;
+            CollidingObj mY(&oa);  const CollidingObj& Y = mY;
+
+            const int N = 300;
+            for (int i = 0; i < N; ++i) {
+                const int KEY = i * 37 - 1000;
+
+                bsl::pair<Obj::Iterator, bool> rx = mX.insert(KEY);
+                ASSERTV(i, rx.second);
+                ASSERTV(i, KEY == *rx.first);
+
+                bsl::pair<CollidingObj::Iterator, bool> ry = mY.insert(KEY);
+                ASSERTV(i, ry.second);
+                ASSERTV(i, KEY == *ry.first);
+
+                rx = mX.insert(KEY);
+                ASSERTV(i, !rx.second);
+                ASSERTV(i, KEY == *rx.first);
+
+                ry = mY.insert(KEY);
+                ASSERTV(i, !ry.second);
+                ASSERTV(i, KEY == *ry.first);
+
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+                ASSERTV(i, i + 1 == static_cast<int>(Y.size()));
+
+                if (veryVerbose || 0 == i % 50) {
+                    for (int j = 0; j <= i; ++j) {
+                        const int K = j * 37 - 1000;
+                        ASSERTV(i, j, X.end() != X.find(K));
+                        ASSERTV(i, j, Y.end() != Y.find(K));
+                        ASSERTV(i, j, X.end() == X.find(K + 1));
+                        ASSERTV(i, j, Y.end() == Y.find(K + 1));
+                    }
+                    ASSERTV(i, i + 1 == countByIteration(X));
+                    ASSERTV(i, i + 1 == countByIteration(Y));
+                }
+            }
+            ASSERT(isPowerOfTwo(X.capacity()));
+            ASSERT(isPowerOfTwo(Y.capacity()));
+            ASSERT(4 == oa.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\t'insertIfMissing'.\n");
+        {
+            typedef bsl::pair<const int, int>                   Pair;
+            typedef bslstl::UnorderedMapKeyConfiguration<Pair> PairConfig;
+            typedef bslstl::FlatHashTable<PairConfig,
+                                          bsl::hash<int>,
+                                          bsl::equal_to<int> > PairTable;
+
+            PairTable mX(&oa);  const PairTable& X = mX;
+
+            bool isInserted = false;
+            PairTable::Iterator it = mX.insertIfMissing(&isInserted, 5);
+            ASSERT(isInserted);
+            ASSERT(5 == it->first);
+            ASSERT(0 == it->second);
+            it->second = 42;
+
+            it = mX.insertIfMissing(&isInserted, 5);
+            ASSERT(!isInserted);
+            ASSERT(42 == it->second);
+            ASSERT(1 == X.size());
+            ASSERT(42 == X.find(5)->second);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // GROUP MATCHING
+        //
+        // Concerns:
+        //: 1 'match' returns exactly the full slots having the specified hash
+        //:   bits, and never matches empty or deleted slots.
+        //:
+        //: 2 'matchEmpty' returns exactly the empty slots.
+        //:
+        //: 3 'matchEmptyOrDeleted' returns exactly the empty and deleted
+        //:   slots.
+        //:
+        //: 4 'lowestBitIndex' returns the index of the lowest set bit.
+        //:
+        //: 5 The shared control value of a table without slots is the
+        //:   sentinel.
+        //
+        // Plan:
+        //: 1 Build groups of control values from a table of strings encoding
+        //:   each slot ('E' for empty, 'D' for deleted, and a digit for a full
+        //:   slot with that hash value), and compare the results of each match
+        //:   function with masks computed by a brute-force oracle.  Load the
+        //:   group at unaligned addresses.  (C-1..3)
+        //:
+        //: 2 Verify 'lowestBitIndex' for each single bit, and for each bit
+        //:   combined with higher bits.  (C-4)
+        //:
+        //: 3 Verify the value of 'sharedEmptyControls'.  (C-5)
+        //
+        // Testing:
+        //   BitMask match(const unsigned char *group, unsigned char h2);
+        //   BitMask matchEmpty(const unsigned char *group);
+        //   BitMask matchEmptyOrDeleted(const unsigned char *group);
+        //   int lowestBitIndex(BitMask mask);
+        //   unsigned char *sharedEmptyControls();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nGROUP MATCHING"
+                            "\n==============\n");
+
+        static const struct {
+            int         d_line;
+            const char *d_spec_p;  // 16 slots: 'E'mpty, 'D'eleted, or digit
+        } DATA[] = {
+            //LINE  SPEC
+            //----  ----------------
+            { L_,   "EEEEEEEEEEEEEEEE" },
+            { L_,   "DDDDDDDDDDDDDDDD" },
+            { L_,   "0000000000000000" },
+            { L_,   "0123456789012345" },
+            { L_,   "E1D2E3D4E5D6E7D8" },
+            { L_,   "9999999999999990" },
+            { L_,   "0EEEEEEEEEEEEEED" },
+            { L_,   "D77777777777777E" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE = DATA[ti].d_line;
+            const char *SPEC = DATA[ti].d_spec_p;
+
+            for (int offset = 0; offset < 4; ++offset) {
+                unsigned char buffer[GroupUtil::GROUP_SIZE + 4];
+                unsigned char *group = buffer + offset;
+
+                GroupUtil::BitMask expEmpty = 0;
+                GroupUtil::BitMask expEmptyOrDeleted = 0;
+
+                for (int i = 0; i < GroupUtil::GROUP_SIZE; ++i) {
+                    switch (SPEC[i]) {
+                      case 'E': {
+                        group[i] = GroupUtil::EMPTY;
+                        expEmpty          |= 1u << i;
+                        expEmptyOrDeleted |= 1u << i;
+                      } break;
+                      case 'D': {
+                        group[i] = GroupUtil::DELETED;
+                        expEmptyOrDeleted |= 1u << i;
+                      } break;
+                      default: {
+                        // Spread the digits over the 7 hash bits.
+
+                        group[i] = static_cast<unsigned char>(
+                                                       (SPEC[i] - '0') * 14);
+                      }
+                    }
+                }
+
+                ASSERTV(LINE, offset,
+                        expEmpty == GroupUtil::matchEmpty(group));
+                ASSERTV(LINE, offset,
+                        expEmptyOrDeleted ==
+                                       GroupUtil::matchEmptyOrDeleted(group));
+
+                for (int h2 = 0; h2 <= GroupUtil::HASH_BITS_MASK; ++h2) {
+                    GroupUtil::BitMask exp = 0;
+                    for (int i = 0; i < GroupUtil::GROUP_SIZE; ++i) {
+                        if (group[i] == h2) {
+                            exp |= 1u << i;
+                        }
+                    }
+                    ASSERTV(LINE, offset, h2,
+                            exp == GroupUtil::match(
+                                        group,
+                                        static_cast<unsigned char>(h2)));
+                }
+            }
+        }
+
+        if (verbose) printf("\t'lowestBitIndex'.\n");
+        {
+            for (int i = 0; i < 32; ++i) {
+                const GroupUtil::BitMask BIT = 1u << i;
+                ASSERTV(i, i == GroupUtil::lowestBitIndex(BIT));
+                ASSERTV(i, i == GroupUtil::lowestBitIndex(BIT | (BIT << 1)));
+                ASSERTV(i, i == GroupUtil::lowestBitIndex(~(BIT - 1)));
+            }
+        }
+
+        if (verbose) printf("\t'sharedEmptyControls'.\n");
+        {
+            ASSERT(GroupUtil::sharedEmptyControls());
+            ASSERT(GroupUtil::SENTINEL == *GroupUtil::sharedEmptyControls());
+            ASSERT(GroupUtil::sharedEmptyControls() ==
+                                             GroupUtil::sharedEmptyControls());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, erase and iterate over a few elements.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(mX.insert(1).second);
+            ASSERT(mX.insert(2).second);
+            ASSERT(!mX.insert(1).second);
+            ASSERT(2 == X.size());
+            ASSERT(16 == X.capacity());
+
+            ASSERT(X.end() != X.find(1));
+            ASSERT(X.end() != X.find(2));
+            ASSERT(X.end() == X.find(3));
+
+            ASSERT(2 == countByIteration(X));
+
+            mX.erase(mX.find(1));
+            ASSERT(1 == X.size());
+            ASSERT(X.end() == X.find(1));
+            ASSERT(2 == *X.begin());
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            ASSERT(X == Y);
+            mY.insert(3);
+            ASSERT(X != Y);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Provide a benchmark comparing insertion, successful lookup and
+        //:   unsuccessful lookup of 'int' keys in a 'FlatHashTable' and in a
+        //:   'bsl::unordered_set'.
+        //
+        // Plan:
+        //: 1 Using 'bsls_stopwatch', time each operation on tables of
+        //:   increasing size (specified by the optional second argument, 1M
+        //:   by default), and report the results.  These values should only be
+        //:   used as a comparison across the two containers and versions.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: lookup compared to 'bsl::unordered_set'
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE TEST"
+               "\n================\n");
+
+        const int MAX_N = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        typedef bsl::unordered_set<int> NodeSet;
+
+        printf("%10s %14s %14s %14s %14s %14s %14s\n",
+               "N", "flat insert", "node insert",
+               "flat hit", "node hit", "flat miss", "node miss");
+
+        for (int n = 1000; n <= MAX_N; n *= 10) {
+            const int LOOKUPS = 10 * MAX_N;
+
+            bsls::Stopwatch timer;
+            double          times[6];
+            long            checksum = 0;
+
+            Obj     flat(&defaultAllocator);
+            NodeSet node(&defaultAllocator);
+
+            timer.start();
+            for (int i = 0; i < n; ++i) {
+                flat.insert(i * 2);
+            }
+            timer.stop();  times[0] = timer.elapsedTime();  timer.reset();
+
+            timer.start();
+            for (int i = 0; i < n; ++i) {
+                node.insert(i * 2);
+            }
+            timer.stop();  times[1] = timer.elapsedTime();  timer.reset();
+
+            // Look up keys in a scattered order, to defeat the prefetcher.
+
+            timer.start();
+            for (int i = 0, k = 0; i < LOOKUPS; ++i, k = (k + 7919) % n) {
+                checksum += flat.end() != flat.find(k * 2);
+            }
+            timer.stop();  times[2] = timer.elapsedTime();  timer.reset();
+
+            timer.start();
+            for (int i = 0, k = 0; i < LOOKUPS; ++i, k = (k + 7919) % n) {
+                checksum += node.end() != node.find(k * 2);
+            }
+            timer.stop();  times[3] = timer.elapsedTime();  timer.reset();
+
+            timer.start();
+            for (int i = 0, k = 0; i < LOOKUPS; ++i, k = (k + 7919) % n) {
+                checksum += flat.end() != flat.find(k * 2 + 1);
+            }
+            timer.stop();  times[4] = timer.elapsedTime();  timer.reset();
+
+            timer.start();
+            for (int i = 0, k = 0; i < LOOKUPS; ++i, k = (k + 7919) % n) {
+                checksum += node.end() != node.find(k * 2 + 1);
+            }
+            timer.stop();  times[5] = timer.elapsedTime();  timer.reset();
+
+            ASSERTV(n, checksum, 2L * LOOKUPS == checksum);
+
+            printf("%10d %14.4f %14.4f %14.4f %14.4f %14.4f %14.4f\n",
+                   n, times[0], times[1], times[2],
+                   times[3], times[4], times[5]);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
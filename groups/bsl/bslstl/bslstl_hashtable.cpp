@@ -42,6 +42,22 @@ bslalg::HashTableBucket *HashTable_ImpDetails::defaultBucketAddress()
     return &s_bucket;
 }
 
+size_t HashTable_ImpDetails::nextPowerOfTwo(size_t n)
+{
+    static const size_t MAX_POWER_OF_TWO =
+                         (native_std::numeric_limits<size_t>::max() >> 1) + 1;
+
+    if (n > MAX_POWER_OF_TWO) {
+        StdExceptUtil::throwLengthError("HashTable ran out of powers of two.");
+    }
+
+    size_t result = 1;
+    while (result < n) {
+        result <<= 1;
+    }
+    return result;
+}
+
 size_t HashTable_ImpDetails::nextPrime(size_t n)
 {   // An abbreviated list of prime numbers in the domain of 32-bit
     // unsigned integers.  Essentially, a subset where each successive
@@ -71,10 +87,12 @@ size_t HashTable_ImpDetails::nextPrime(size_t n)
     return *result;
 }
 
-size_t HashTable_ImpDetails::growBucketsForLoadFactor(size_t *capacity,
-                                                      size_t  minElements,
-                                                      size_t  requestedBuckets,
-                                                      double  maxLoadFactor)
+size_t HashTable_ImpDetails::growBucketsForLoadFactor(
+                                                 size_t *capacity,
+                                                 size_t  minElements,
+                                                 size_t  requestedBuckets,
+                                                 double  maxLoadFactor,
+                                                 bool    usePowerOfTwoBuckets)
 {
     BSLS_ASSERT_SAFE(  0 != capacity);
     BSLS_ASSERT_SAFE(  0  < minElements);
@@ -132,12 +150,22 @@ size_t HashTable_ImpDetails::growBucketsForLoadFactor(size_t *capacity,
                             requestedBuckets,
                             Impl::throwIfOverMax(minElements / maxLoadFactor));
 
-    result = nextPrime(result);  // throws if too large
+    if (usePowerOfTwoBuckets) {
+        result = nextPowerOfTwo(result);  // throws if too large
+    }
+    else {
+        result = nextPrime(result);  // throws if too large
+    }
 
     double newCapacity = static_cast<double>(result) * maxLoadFactor;
 
     while (minElements > newCapacity ) {
-        result  = nextPrime(2 * result);  // throws if too large
+        if (usePowerOfTwoBuckets) {
+            result = nextPowerOfTwo(result + 1);  // throws if too large
+        }
+        else {
+            result = nextPrime(2 * result);  // throws if too large
+        }
         newCapacity = static_cast<double>(result) * maxLoadFactor;
     }
 
@@ -11,6 +11,9 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //   bslstl::HashTable : hashed-table container for user-supplied object types
+//   bslstl::HashTableUsesPowerOfTwoBuckets: trait selecting power-of-2 buckets
+//   bslstl::HashTableCachesHashCodes: trait selecting nodes caching hash codes
+//   bslstl::HashTableRehashesIncrementally: trait selecting incremental rehash
 //
 //@SEE_ALSO: bsl+stdhdrs
 //
@@ -118,11 +121,179 @@ BSLS_IDENT("$Id: $")
 // the first and last element in the linked-list whose adjusted hash-values
 // are equal to that bucket's index.
 //
-// As we do not cache the hashed value, if any hash function throws we will
-// either do nothing and allow the exception to propagate, or, if some change
-// of state has already been made, clear the whole container to provide the
-// basic exception guarantee.  There are similar concerns for the 'COMPARATOR'
-// predicate.
+// By default, we do not cache the hashed value, so if any hash function throws
+// we will either do nothing and allow the exception to propagate, or, if some
+// change of state has already been made, clear the whole container to provide
+// the basic exception guarantee.  There are similar concerns for the
+// 'COMPARATOR' predicate.  (See {Caching Hash Codes} for an alternative.)
+//
+///Bucket Policies
+///---------------
+// By default, the number of buckets in a 'HashTable' is chosen from an
+// increasing sequence of prime numbers, and the bucket index of an element is
+// its hash code modulo the number of buckets.  A prime number of buckets
+// tolerates hash functions of poor quality (e.g., a hash function that
+// returns the value of an integer key, or a multiple of a pointer's
+// alignment), but computing the bucket index requires an integer division for
+// every lookup.
+//
+// Alternatively, a 'HashTable' may be configured to size its bucket array in
+// powers of two, so that a bucket index is computed by masking the low-order
+// bits of a hash code.  As those low-order bits are frequently the weakest
+// bits of a user-supplied hash code, in this mode the 'HashTable' post-mixes
+// each hash code returned by 'HASHER' with a multiplicative (Fibonacci) hash,
+// which folds the well-mixed high-order bits of the product into the low-order
+// bits used to select a bucket.  Note that the post-mix is a bijection, so it
+// cannot introduce collisions that were not already present in the hash codes
+// returned by 'HASHER'.
+//
+// The power-of-two policy is selected by associating the
+// 'bslstl::HashTableUsesPowerOfTwoBuckets' trait with the 'HASHER' type.  As
+// the 'HASHER' type is a template parameter of each of the standard unordered
+// containers, this trait allows any of those containers to opt-in to the
+// power-of-two policy, without changing their interface:
+//..
+//  struct MyFastHash {
+//      BSLMF_NESTED_TRAIT_DECLARATION(MyFastHash,
+//                                     bslstl::HashTableUsesPowerOfTwoBuckets);
+//
+//      native_std::size_t operator()(int key) const { return key; }
+//  };
+//
+//  bsl::unordered_map<int, double, MyFastHash> map;
+//..
+// The trait does not change the observable behavior of a container, other than
+// the values returned by 'bucket_count', 'bucket', and the iteration order of
+// its elements.
+//
+///Caching Hash Codes
+///------------------
+// By default, a 'HashTable' stores each element in a node of type
+// 'bslalg::BidirectionalNode', and invokes 'HASHER' to recompute the hash code
+// of an element whenever that hash code is needed: to redistribute the
+// element when the bucket array grows, to erase the element, and to copy the
+// element into another 'HashTable'.  Additionally, when searching for a key,
+// the 'COMPARATOR' is invoked for each element in the bucket selected by the
+// hash code of that key.  For keys that are expensive to hash or to compare
+// (e.g., long strings, or composite keys), that cost may dominate.
+//
+// Alternatively, a 'HashTable' may be configured to store each element in a
+// node of type 'bslalg::HashedBidirectionalNode', which caches the hash code
+// computed for the element when it was inserted.  In this mode, 'HASHER' is
+// invoked exactly once per inserted element (and once per key searched for),
+// never when the table is rehashed, copied, or an element is erased, and the
+// 'COMPARATOR' is invoked only for those elements in a bucket whose cached
+// hash code is equal to that of the key being searched for.  The cost is one
+// additional 'size_t' per node.  As the rehash operation of such a table
+// cannot throw, the strong exception guarantee is also provided when the
+// bucket array grows.
+//
+// The caching policy is selected by associating the
+// 'bslstl::HashTableCachesHashCodes' trait with the 'HASHER' type, and may be
+// combined with the power-of-two policy:
+//..
+//  struct MyStringHash {
+//      BSLMF_NESTED_TRAIT_DECLARATION(MyStringHash,
+//                                     bslstl::HashTableCachesHashCodes);
+//
+//      native_std::size_t operator()(const bsl::string& key) const;
+//  };
+//
+//  bsl::unordered_map<bsl::string, int, MyStringHash> map;
+//..
+// The trait does not change the observable behavior of a container.
+//
+///Incremental Rehashing
+///---------------------
+// By default, when an insertion would cause the load factor of a 'HashTable'
+// to exceed its 'maxLoadFactor', the 'HashTable' allocates a larger array of
+// buckets and redistributes every element into that array before the
+// insertion completes.  Although the amortized cost of this rehash is
+// constant per insertion, the insertion that triggers it takes time linear in
+// the size of the table, which may be unacceptable for a latency-sensitive
+// application holding millions of elements.
+//
+// Alternatively, a 'HashTable' may be configured to rehash incrementally.  In
+// this mode, the insertion that would exceed the 'maxLoadFactor' installs the
+// larger array of buckets, but leaves the existing elements indexed by the
+// original array.  Each subsequent insertion then migrates the elements of a
+// few buckets from the original array to the new one (along with the elements
+// of the original bucket holding the key being inserted), and the original
+// array is released once it is empty.  The number of buckets migrated by an
+// insertion is chosen so that the rehash completes well before the table next
+// needs to grow.  The insertions that follow then prepare the array of
+// buckets for that growth: once the table is close enough to its next growth,
+// an insertion allocates the larger array, and each insertion clears a slice
+// of it, so that no single insertion bears the cost, linear in the size of
+// the table, of allocating and clearing the whole array.  While a rehash is
+// in progress, a search consults whichever of the two arrays holds the
+// elements having the hash code of the key being searched for.  Note that
+// elements are migrated only by insertion: 'find' and 'remove' never relink
+// elements, so they neither invalidate iterators nor change the iteration
+// order of the remaining elements.  As for any rehash, an insertion into a
+// table whose rehash is in progress may change the iteration order of its
+// elements.  Any explicit rehash (i.e., any call to 'rehashForNumBuckets',
+// even one requesting no more buckets than the table already has) completes
+// immediately.
+//
+// The cost of this policy is a higher typical insertion time, as most
+// insertions migrate or clear some buckets, and, for the latter part of the
+// interval between two growths, the memory of the next array of buckets.
+//
+// While a rehash is in progress, the bucket interface describes the new array
+// of buckets: 'numBuckets' and 'bucketIndexForKey' refer to that array, and
+// 'countElementsInBucket' also counts the elements remaining to be migrated to
+// the indexed bucket, so that the sizes of the buckets always sum to the size
+// of the table.  The non-'const' overload of 'bucketAtIndex' (through which,
+// e.g., the non-'const' 'begin(n)' and 'end(n)' methods of the standard
+// unordered containers obtain a bucket) completes the rehash before returning
+// the bucket.  The 'const' overload of 'bucketAtIndex' does not modify the
+// table, so that it may be called concurrently with other 'const' methods,
+// and returns a bucket holding only the elements already migrated to it; a
+// 'bslstl::HashTableBucketIterator' constructed from that bucket and the
+// function returned by 'nextNodeInBucketFunction' (as by the 'const'
+// 'begin(n)' and 'cbegin(n)' methods of the standard unordered containers)
+// also visits, after those elements, the elements that are to be migrated to
+// the bucket, so that a local iteration over any bucket, 'const' or not,
+// visits every element that the bucket indexes.
+//
+// The incremental policy is selected by associating the
+// 'bslstl::HashTableRehashesIncrementally' trait with the 'HASHER' type, and
+// may be combined with the other policies:
+//..
+//  struct MyOrderIdHash {
+//      BSLMF_NESTED_TRAIT_DECLARATION(MyOrderIdHash,
+//                                     bslstl::HashTableRehashesIncrementally);
+//
+//      native_std::size_t operator()(bsls::Types::Uint64 key) const;
+//  };
+//
+//  bsl::unordered_map<bsls::Types::Uint64, Order, MyOrderIdHash> orders;
+//..
+//
+///Batched Lookup
+///--------------
+// A search of a large 'HashTable' typically incurs two cache misses: one to
+// load the bucket selected by the hash code of the key, and one to load the
+// first node of that bucket.  When a client needs to look up a number of keys
+// at once, 'findBatch' hides much of that latency: it computes the hash codes
+// of a group of keys and prefetches their buckets, then prefetches the first
+// node of each of those buckets, and only then searches for each key.  The
+// memory accesses of the lookups in a group therefore overlap, rather than
+// each lookup waiting for the previous one.  The result for each key is the
+// same as that returned by 'find'.
+//
+///Heterogeneous Lookup
+///--------------------
+// If both the 'HASHER' and the 'COMPARATOR' of a 'HashTable' are
+// *transparent* (i.e., each declares a nested type named 'is_transparent'; see
+// 'bslmf_istransparent'), 'find' and 'findRange' additionally accept a key of
+// any type that both functors can be invoked with, and search for it without
+// first converting it to a 'KeyType' object.  For example, a table of
+// 'bsl::string' keys having transparent functors can be searched for a
+// 'bslstl::StringRef' without copying its characters into a temporary string.
+// Note that such a key must hash to the same value as any 'KeyType' object
+// to which it compares equal.
 //
 ///Usage
 ///-----
@@ -1470,6 +1641,10 @@ BSLS_IDENT("$Id: $")
 #include <bslstl_bidirectionalnodepool.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_HASHTABLEBUCKETITERATOR
+#include <bslstl_hashtablebucketiterator.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_BIDIRECTIONALLINK
 #include <bslalg_bidirectionallink.h>
 #endif
@@ -1478,6 +1653,10 @@ BSLS_IDENT("$Id: $")
 #include <bslalg_bidirectionalnode.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_HASHEDBIDIRECTIONALNODE
+#include <bslalg_hashedbidirectionalnode.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_FUNCTORADAPTER
 #include <bslalg_functoradapter.h>
 #endif
@@ -1510,6 +1689,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_conditional.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_DETECTNESTEDTRAIT
+#include <bslmf_detectnestedtrait.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
 #include <bslmf_isbitwisemoveable.h>
 #endif
@@ -1518,10 +1701,18 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_isfunction.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRANSPARENT
+#include <bslmf_istransparent.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISPOINTER
 #include <bslmf_ispointer.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ASSERT
 #include <bsls_assert.h>
 #endif
@@ -1587,9 +1778,64 @@ class HashTable_HashWrapper<const FUNCTOR>;
 template <class FUNCTOR>
 class HashTable_HashWrapper<FUNCTOR &>;
 
+template <class PARAMETERS>
+class HashTable_HashCodeAdapter;
+
+template <bool REHASH_INCREMENTALLY>
+class HashTable_RehashState;
+
+template <>
+class HashTable_RehashState<false>;
+
 struct HashTable_ImpDetails;
 struct HashTable_Util;
 
+                    // =====================================
+                    // struct HashTableUsesPowerOfTwoBuckets
+                    // =====================================
+
+template <class HASHER>
+struct HashTableUsesPowerOfTwoBuckets
+    : bslmf::DetectNestedTrait<HASHER, HashTableUsesPowerOfTwoBuckets> {
+    // This metafunction is derived from 'true_type' if a 'HashTable' using the
+    // (template parameter) type 'HASHER' as its hash functor should size its
+    // bucket array in powers of two, and post-mix the hash codes returned by
+    // 'HASHER' (see {Bucket Policies}), and 'false_type' otherwise.  This
+    // trait may be associated with a hash functor using the
+    // 'BSLMF_NESTED_TRAIT_DECLARATION' macro, or by explicit specialization.
+};
+
+                       // ===============================
+                       // struct HashTableCachesHashCodes
+                       // ===============================
+
+template <class HASHER>
+struct HashTableCachesHashCodes
+    : bslmf::DetectNestedTrait<HASHER, HashTableCachesHashCodes> {
+    // This metafunction is derived from 'true_type' if a 'HashTable' using the
+    // (template parameter) type 'HASHER' as its hash functor should cache the
+    // hash code of each element in the node holding that element (see
+    // {Caching Hash Codes}), and 'false_type' otherwise.  This trait may be
+    // associated with a hash functor using the
+    // 'BSLMF_NESTED_TRAIT_DECLARATION' macro, or by explicit specialization.
+};
+
+                    // =====================================
+                    // struct HashTableRehashesIncrementally
+                    // =====================================
+
+template <class HASHER>
+struct HashTableRehashesIncrementally
+    : bslmf::DetectNestedTrait<HASHER, HashTableRehashesIncrementally> {
+    // This metafunction is derived from 'true_type' if a 'HashTable' using the
+    // (template parameter) type 'HASHER' as its hash functor should migrate
+    // its elements to a larger array of buckets incrementally, over a number
+    // of subsequent insertions (see {Incremental Rehashing}), and
+    // 'false_type' otherwise.  This trait may be associated with a hash
+    // functor using the 'BSLMF_NESTED_TRAIT_DECLARATION' macro, or by
+    // explicit specialization.
+};
+
                        // ======================
                        // class CallableVariable
                        // ======================
@@ -1847,12 +2093,211 @@ void swap(HashTable_ComparatorWrapper<FUNCTOR> &lhs,
     // Swap the functor wrapped by the specified 'a' object with the functor
     // wrapped by the specified 'b' object.
 
+                       // ===============================
+                       // class HashTable_HashCodeAdapter
+                       // ===============================
+
+template <class PARAMETERS>
+class HashTable_HashCodeAdapter {
+    // This class template provides a functor, supplied to the
+    // 'bslalg::HashTableImpUtil' algorithms, that returns the hash code that
+    // the 'hashCodeForKey' method of an object of the (template parameter)
+    // type 'PARAMETERS' computes for a key.  This ensures that those
+    // algorithms index nodes using the same (possibly post-mixed) hash codes
+    // as the 'HashTable' owning the 'PARAMETERS' object.
+
+  private:
+    // DATA
+    const PARAMETERS& d_parameters;  // parameters of the adapted table
+
+  private:
+    // NOT IMPLEMENTED
+    HashTable_HashCodeAdapter& operator=(const HashTable_HashCodeAdapter&);
+
+  public:
+    // CREATORS
+    explicit HashTable_HashCodeAdapter(const PARAMETERS& parameters);
+        // Create a 'HashTable_HashCodeAdapter' object that computes hash codes
+        // using the specified 'parameters'.
+
+    //! HashTable_HashCodeAdapter(const HashTable_HashCodeAdapter&) = default;
+    //! ~HashTable_HashCodeAdapter() = default;
+
+    // ACCESSORS
+    template <class ARG_TYPE>
+    native_std::size_t operator()(ARG_TYPE& arg) const;
+        // Return the hash code computed for the specified 'arg' by the
+        // 'hashCodeForKey' method of the parameters supplied at construction.
+};
+
+                       // ===========================
+                       // class HashTable_RehashState
+                       // ===========================
+
+template <bool REHASH_INCREMENTALLY>
+class HashTable_RehashState {
+    // This class template holds the state of an incremental rehash of a
+    // 'HashTable' (see {Incremental Rehashing}): the array of buckets whose
+    // elements are being migrated, and the index of the next bucket of that
+    // array to be migrated, and the "spare" array of buckets being prepared
+    // for the next growth of the table, and the number of buckets of that
+    // array already cleared.  This primary template is used by tables that
+    // rehash incrementally; the specialization for 'false', used by every
+    // other table, holds no state, so that a 'HashTable' (of which this class
+    // is an empty base) is no larger than it would be without the incremental
+    // policy.
+
+  private:
+    // DATA
+    bslalg::HashTableAnchor  d_oldAnchor;    // bucket array whose elements
+                                             // are being migrated (null if no
+                                             // rehash is in progress); the
+                                             // list root is unused, and always
+                                             // null
+
+    native_std::size_t       d_rehashCursor; // index of the next bucket in
+                                             // 'd_oldAnchor' to be migrated
+
+    bslalg::HashTableBucket *d_spareBucketArray_p;
+                                             // bucket array being prepared
+                                             // for the next growth (null
+                                             // until allocated)
+
+    native_std::size_t       d_spareBucketArraySize;
+                                             // planned size of
+                                             // 'd_spareBucketArray_p' (0 if no
+                                             // spare array is planned)
+
+    native_std::size_t       d_spareCursor;  // number of leading buckets of
+                                             // 'd_spareBucketArray_p' already
+                                             // cleared
+
+  private:
+    // NOT IMPLEMENTED
+    HashTable_RehashState(const HashTable_RehashState&);
+    HashTable_RehashState& operator=(const HashTable_RehashState&);
+
+  public:
+    // CREATORS
+    HashTable_RehashState();
+        // Create a 'HashTable_RehashState' object indicating that no rehash
+        // is in progress.
+
+    //! ~HashTable_RehashState() = default;
+
+    // MANIPULATORS
+    void advanceRehashCursor();
+        // Increment the index of the next bucket to be migrated.  The
+        // behavior is undefined unless a rehash is in progress and
+        // 'rehashCursor() < oldAnchor()->bucketArraySize()'.
+
+    void beginRehash(bslalg::HashTableBucket *oldBucketArrayAddress,
+                     native_std::size_t       oldBucketArraySize);
+        // Record that the elements indexed by the array of the specified
+        // 'oldBucketArraySize' buckets at the specified
+        // 'oldBucketArrayAddress' are being migrated, starting with the first
+        // bucket of that array.  The behavior is undefined unless no rehash
+        // is in progress, and 'oldBucketArrayAddress' is not null.
+
+    void endRehash();
+        // Record that no rehash is in progress.  Note that this method does
+        // not release the array of buckets being migrated.
+
+    void advanceSpareCursor(native_std::size_t numBuckets);
+        // Add the specified 'numBuckets' to the number of buckets of the
+        // spare array already cleared.  The behavior is undefined unless a
+        // spare array is allocated, and 'spareCursor() + numBuckets' is not
+        // greater than 'spareBucketArraySize()'.
+
+    void planSpareBucketArray(native_std::size_t numBuckets);
+        // Record that the next spare array of buckets is to have the
+        // specified 'numBuckets', or that no spare array is planned if
+        // 'numBuckets' is 0.  The behavior is undefined unless no spare array
+        // is allocated.
+
+    void setSpareBucketArrayAddress(bslalg::HashTableBucket *address);
+        // Record that the planned spare array of buckets has been allocated
+        // at the specified 'address' (or released, if 'address' is null), and
+        // that none of its buckets has been cleared.  The behavior is
+        // undefined unless a spare array is planned.
+
+    void swapRehashState(HashTable_RehashState *other);
+        // Exchange the state of this object with that of the specified
+        // 'other' object.
+
+    // ACCESSORS
+    const bslalg::HashTableAnchor *oldAnchor() const;
+        // Return the address of an anchor holding the array of buckets whose
+        // elements are being migrated, and a null list root, if a rehash is
+        // in progress, and 0 otherwise.
+
+    native_std::size_t rehashCursor() const;
+        // Return the index of the next bucket to be migrated, if a rehash is
+        // in progress, and 0 otherwise.
+
+    bslalg::HashTableBucket *spareBucketArrayAddress() const;
+        // Return the address of the spare array of buckets, if it is
+        // allocated, and 0 otherwise.
+
+    native_std::size_t spareBucketArraySize() const;
+        // Return the planned number of buckets of the spare array, if a spare
+        // array is planned, and 0 otherwise.
+
+    native_std::size_t spareCursor() const;
+        // Return the number of leading buckets of the spare array already
+        // cleared, if a spare array is allocated, and 0 otherwise.
+};
+
+template <>
+class HashTable_RehashState<false> {
+    // This specialization of 'HashTable_RehashState' is used by tables that
+    // do not rehash incrementally, and so never have a rehash in progress.
+    // It has no data members, and its methods have no effect.
+
+  private:
+    // NOT IMPLEMENTED
+    HashTable_RehashState(const HashTable_RehashState&);
+    HashTable_RehashState& operator=(const HashTable_RehashState&);
+
+  public:
+    // CREATORS
+    HashTable_RehashState();
+        // Create a 'HashTable_RehashState' object indicating that no rehash
+        // is in progress.
+
+    //! ~HashTable_RehashState() = default;
+
+    // MANIPULATORS
+    void advanceRehashCursor();
+    void beginRehash(bslalg::HashTableBucket *oldBucketArrayAddress,
+                     native_std::size_t       oldBucketArraySize);
+    void endRehash();
+    void advanceSpareCursor(native_std::size_t numBuckets);
+    void planSpareBucketArray(native_std::size_t numBuckets);
+    void setSpareBucketArrayAddress(bslalg::HashTableBucket *address);
+    void swapRehashState(HashTable_RehashState *other);
+        // Have no effect.  Note that these methods are provided so that
+        // 'HashTable' compiles for any 'HASHER', and are never called for a
+        // table that does not rehash incrementally.
+
+    // ACCESSORS
+    const bslalg::HashTableAnchor *oldAnchor() const;
+    bslalg::HashTableBucket *spareBucketArrayAddress() const;
+    native_std::size_t rehashCursor() const;
+    native_std::size_t spareBucketArraySize() const;
+    native_std::size_t spareCursor() const;
+        // Return 0, as no rehash is in progress, and no spare array of
+        // buckets is planned.
+};
+
                            // ===============
                            // class HashTable
                            // ===============
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
-class HashTable {
+class HashTable
+    : private HashTable_RehashState<
+                               HashTableRehashesIncrementally<HASHER>::value> {
     // This class template implements a value-semantic container type holding
     // an unordered sequence of (possibly duplicate) elements, that can be
     // rapidly accessed using their key, with the constraint on the container
@@ -1903,10 +2348,50 @@ class HashTable {
     typedef ::bsl::allocator_traits<AllocatorType> AllocatorTraits;
     typedef typename KEY_CONFIG::KeyType           KeyType;
     typedef typename KEY_CONFIG::ValueType         ValueType;
-    typedef bslalg::BidirectionalNode<ValueType>   NodeType;
+    typedef typename bsl::conditional<
+                            HashTableCachesHashCodes<HASHER>::value,
+                            bslalg::HashedBidirectionalNode<ValueType>,
+                            bslalg::BidirectionalNode<ValueType> >::type
+                                                   NodeType;
     typedef typename AllocatorTraits::size_type    SizeType;
 
   private:
+    // PRIVATE CONSTANTS
+    enum {
+        USE_POWER_OF_TWO_BUCKETS =
+                                 HashTableUsesPowerOfTwoBuckets<HASHER>::value,
+            // 'true' if this table sizes its bucket array in powers of two,
+            // and post-mixes the hash codes returned by 'HASHER'.
+
+        CACHE_HASH_CODES = HashTableCachesHashCodes<HASHER>::value,
+            // 'true' if this table stores its elements in nodes of type
+            // 'bslalg::HashedBidirectionalNode', caching the hash code of each
+            // element.
+
+        REHASH_INCREMENTALLY = HashTableRehashesIncrementally<HASHER>::value,
+            // 'true' if this table migrates its elements to a larger array of
+            // buckets over a number of insertions, rather than all at once.
+
+        MIN_BUCKETS_MIGRATED_PER_INSERT = 2,
+            // Minimum number of buckets (in addition to the bucket holding the
+            // key being inserted) whose elements are migrated by each
+            // insertion into a table whose incremental rehash is in progress.
+
+        MIN_BUCKETS_CLEARED_PER_INSERT = 16,
+            // Minimum number of buckets of the spare array cleared by each
+            // insertion into a table that rehashes incrementally and is
+            // preparing its next bucket array.
+
+        FIND_BATCH_SIZE = 16
+            // Maximum number of keys whose buckets and nodes are prefetched
+            // together by 'findBatch'.
+    };
+
+    // PRIVATE TYPES
+    typedef bslalg::HashedBidirectionalNode<ValueType> HashedNodeType;
+        // Alias for the type of node used by this table if, and only if,
+        // 'CACHE_HASH_CODES' is 'true'.
+
 #if 0
     typedef typename
                   bslalg::FunctorAdapter<HashTable_HashWrapper<HASHER> >::Type
@@ -1955,7 +2440,9 @@ class HashTable {
         typedef typename ReboundTraits::allocator_type           NodeAllocator;
 
         typedef BidirectionalNodePool<typename HashTableType::ValueType,
-                                      NodeAllocator>               NodeFactory;
+                                      NodeAllocator,
+                                      typename HashTableType::NodeType>
+                                                                   NodeFactory;
 
         // Assert consistency checks against Machiavellian users, specializing
         // an allocator for a specific type to have different propagation
@@ -2041,10 +2528,11 @@ class HashTable {
         template <class DEDUCED_KEY>
         native_std::size_t    hashCodeForKey(DEDUCED_KEY& key) const;
             // Return the hash code for the specified 'key' using a copy of the
-            // hash functor supplied at construction.  Note that this function
-            // is provided as common way to resolve const_cast issues in the
-            // case that the stored hash functor has a function call operator
-            // that is not declared as 'const'.
+            // hash functor supplied at construction, post-mixed if the table
+            // uses power-of-two bucket arrays (see {Bucket Policies}).  Note
+            // that this function is provided as common way to resolve
+            // const_cast issues in the case that the stored hash functor has a
+            // function call operator that is not declared as 'const'.
     };
 
   private:
@@ -2062,7 +2550,44 @@ class HashTable {
     float               d_maxLoadFactor; // maximum permitted load factor
 
   private:
+    // PRIVATE CLASS METHODS
+    static bslalg::BidirectionalLink *nextNodeInBucket(
+                                     const void                    *table,
+                                     const bslalg::HashTableBucket *bucket,
+                                     bslalg::BidirectionalLink     *node);
+        // Return the address of the node following the specified 'node' in
+        // the specified 'bucket' of the current bucket array of the
+        // 'HashTable' at the specified 'table' address, or the address of the
+        // first node of 'bucket' if 'node' is 0, or 0 if 'node' is the last
+        // node of 'bucket', where the nodes of 'bucket' are the nodes that it
+        // indexes, followed by the nodes, held in the array of buckets being
+        // incrementally rehashed, that are to be migrated to 'bucket'.  The
+        // behavior is undefined unless an incremental rehash of 'table' is in
+        // progress, and 'node' is 0 or a node of 'bucket'.  Note that this
+        // function has the signature of a
+        // 'HashTableBucketIterator_NextNodeFunction'.
+
     // PRIVATE MANIPULATORS
+    void advanceIncrementalRehash(native_std::size_t hashCode);
+        // If an incremental rehash of this table is in progress, migrate to
+        // the current bucket array all the elements of the bucket in the
+        // array being rehashed that would hold an element having the
+        // specified 'hashCode', followed by the elements of the next few
+        // buckets of that array (at least 'MIN_BUCKETS_MIGRATED_PER_INSERT',
+        // and enough to complete the rehash before this table next grows),
+        // and release that array if it no longer holds any elements;
+        // otherwise, prepare the spare bucket array for the next growth (see
+        // 'prepareSpareBucketArray').  If the 'hasher' throws, the elements
+        // migrated so far remain in the current bucket array, and this table
+        // remains in a valid state; if an allocation fails, this table is
+        // unchanged.  Note that this method must be called before an element
+        // having 'hashCode' is inserted into this table.
+
+    void completeIncrementalRehash();
+        // If an incremental rehash of this table is in progress, migrate all
+        // the remaining elements to the current bucket array, and release the
+        // array being rehashed; otherwise, this method has no effect.
+
     void copyDataStructure(bslalg::BidirectionalLink *cursor);
         // Copy the sequence of elements from the list starting at the
         // specified 'cursor' and having 'size' elements.  Allocate a bucket
@@ -2075,6 +2600,35 @@ class HashTable {
         // consistent with the class invariants until after this method is
         // called.
 
+    void growBucketArray();
+        // Increase the number of buckets in this table so that at least one
+        // more element can be inserted without exceeding the 'maxLoadFactor'.
+        // If 'REHASH_INCREMENTALLY' is 'true' and this table is not empty,
+        // complete any incremental rehash in progress, then adopt the spare
+        // bucket array (or allocate a new bucket array, if no spare array of
+        // the required size has been prepared) and begin an incremental
+        // rehash of the existing elements into it (see {Incremental
+        // Rehashing}); otherwise, rehash all the elements into the new bucket
+        // array immediately.
+
+    void migrateBucket(bslalg::HashTableBucket *bucket);
+        // Move each element of the specified 'bucket', in the array of
+        // buckets being incrementally rehashed, into the current bucket array
+        // of this table.  The behavior is undefined unless an incremental
+        // rehash is in progress and 'bucket' is in the array being rehashed.
+
+    void prepareSpareBucketArray();
+        // If 'REHASH_INCREMENTALLY' is 'true', prepare the spare bucket array
+        // to be adopted by the next growth of this table: plan its size, if
+        // it is not planned, allocate it, once this table is close enough to
+        // that growth, and clear the next few of its buckets (at least
+        // 'MIN_BUCKETS_CLEARED_PER_INSERT', and enough to clear every bucket
+        // before that growth); otherwise, this method has no effect.  The
+        // behavior is undefined unless no incremental rehash is in progress.
+        // Note that this method is called once per insertion, so that no
+        // single insertion bears the cost of allocating and clearing the
+        // whole of a large bucket array.
+
     void quickSwapRetainAllocators(HashTable *other);
         // Efficiently exchange the value and functors this object with those
         // of the specified 'other' object.  This method provides the no-throw
@@ -2094,7 +2648,18 @@ class HashTable {
         // which case this operation provides the basic exception guarantee,
         // leaving the hash-table in a valid, but otherwise unspecified (and
         // potentially empty), state.  The behavior is undefined unless
-        // 'size / newNumBuckets <= maxLoadFactor'.
+        // 'size / newNumBuckets <= maxLoadFactor'.  Note that the 'hasher' is
+        // not invoked if 'CACHE_HASH_CODES' is 'true'.
+
+    void releaseOldBucketArray();
+        // Deallocate the array of buckets being incrementally rehashed, if
+        // any, so that no rehash is in progress.  The behavior is undefined
+        // unless every element of this table (if any) is indexed by the
+        // current bucket array.
+
+    void releaseSpareBucketArray();
+        // Deallocate the spare bucket array, if any, and record that no spare
+        // array is planned.
 
     void removeAllImp();
         // Erase all the nodes in this table and deallocate their memory via
@@ -2107,18 +2672,35 @@ class HashTable {
 
     void removeAllAndDeallocate();
         // Erase all the nodes in this table, and deallocate their memory via
-        // the supplied node factory.  Destroy the array of buckets owned by
+        // the supplied node factory.  Destroy the arrays of buckets owned by
         // this table.  If 'd_anchor.bucketAddress()' is the default (static)
         // bucket address ('HashTable_ImpDetails::defaultBucketAddress'), as
         // it is for a default constructed hashtable, then the bucket array is
         // not destroyed.
 
+    void removeFromOldBucketArray(bslalg::BidirectionalLink *node,
+                                  native_std::size_t         hashCode);
+        // Remove the specified 'node', having the specified 'hashCode', from
+        // the list of elements of this table and from its bucket in the array
+        // being incrementally rehashed.  The behavior is undefined unless
+        // 'node' is indexed by that array.
+
+    void setHashCodeForNode(bslalg::BidirectionalLink *node,
+                            native_std::size_t         hashCode);
+        // Cache the specified 'hashCode' in the specified 'node' if
+        // 'CACHE_HASH_CODES' is 'true', and have no effect otherwise.  The
+        // behavior is undefined unless 'node' points to a list node of type
+        // 'NodeType'.  Note that this method must be called for each node
+        // before it is inserted into this table.
+
     // PRIVATE ACCESSORS
     native_std::size_t hashCodeForNode(bslalg::BidirectionalLink *node) const;
-        // Return the hash code for the element stored in the specified 'node'
-        // using a copy of the hash functor supplied at construction.  The
-        // behavior is undefined unless 'node' points to a list node of type
-        // 'bslalg::BidirectionalNode<KEY_CONFIG::ValueType>'.
+        // Return the hash code for the element stored in the specified 'node',
+        // either as cached in 'node', if 'CACHE_HASH_CODES' is 'true', or as
+        // computed using a copy of the hash functor supplied at construction
+        // otherwise.  The behavior is undefined unless 'node' points to a list
+        // node of type 'NodeType' (whose hash code has been set, if
+        // 'CACHE_HASH_CODES' is 'true').
 
     template <class DEDUCED_KEY>
     bslalg::BidirectionalLink *find(DEDUCED_KEY&     key,
@@ -2132,6 +2714,24 @@ class HashTable {
         // recomputing it, eliminating some redundant computation for the
         // public methods.
 
+    void findOldBucketRange(native_std::size_t *begin,
+                            native_std::size_t *end,
+                            SizeType            index) const;
+        // Load into the specified 'begin' and 'end' the bounds of the range
+        // of indices of the buckets, in the array of buckets being
+        // incrementally rehashed, that may hold elements to be migrated to
+        // the bucket at the specified 'index' in the current bucket array.
+        // The behavior is undefined unless an incremental rehash is in
+        // progress and 'index < numBuckets()'.
+
+    bslalg::HashTableBucket *findOldBucket(native_std::size_t hashCode) const;
+        // Return the address of the bucket, in the array of buckets being
+        // incrementally rehashed, that holds the elements having the specified
+        // 'hashCode', if an incremental rehash is in progress and that bucket
+        // is not empty, and 0 otherwise.  Note that an element resides in the
+        // array being rehashed if, and only if, this method returns a non-null
+        // address for its hash code.
+
     bslalg::HashTableBucket *getBucketAddress(SizeType bucketIndex) const;
         // Return the address of the bucket at the specified 'bucketIndex' in
         // bucket array of this hash table.  The behavior is undefined unless
@@ -2203,7 +2803,12 @@ class HashTable {
         // 'maxLoadFactor' is not exceeded.
 
     ~HashTable();
-        // Destroy this object.
+        // Destroy this object.  If 'ValueType' is trivially destructible and
+        // the mechanism of the allocator of this object is a
+        // 'bslma::ManagedAllocator', the nodes and bucket array of this
+        // object are neither visited nor deallocated, their memory being
+        // reclaimed when the managed allocator is released (see
+        // 'bslma_managedallocator').
 
     // MANIPULATORS
     HashTable& operator=(const HashTable& rhs);
@@ -2220,6 +2825,15 @@ class HashTable {
         // requirements might simplify in the future, if the standard is
         // updated.
 
+    const bslalg::HashTableBucket& bucketAtIndex(SizeType index);
+        // Complete any incremental rehash in progress (see
+        // {Incremental Rehashing}), and return a non-modifiable reference to
+        // the 'HashTableBucket' at the specified 'index' position in the
+        // array of buckets of this table.  The behavior is undefined unless
+        // 'index < numBuckets()'.  Note that completing a rehash may change
+        // the iteration order of the elements of this table, but does not
+        // invalidate any iterators.
+
     template <class SOURCE_TYPE>
     bslalg::BidirectionalLink *insert(const SOURCE_TYPE& value);
         // Insert the specified 'value' into this hash-table, and return the
@@ -2308,7 +2922,9 @@ class HashTable {
         // {'bsldoc_glossary'}) unless the 'hasher' throws, in which case this
         // operation provides the basic exception guarantee, leaving the
         // hash-table in a valid, but otherwise unspecified (and potentially
-        // empty), state.  Note that more buckets than requested may be
+        // empty), state.  If an incremental rehash is in progress (see
+        // {Incremental Rehashing}), it is completed, even if no more buckets
+        // are allocated.  Note that more buckets than requested may be
         // allocated in order to preserve the bucket allocation strategy of the
         // hash table (but never fewer).
 
@@ -2377,7 +2993,9 @@ class HashTable {
         // size, or even close to that size without running out of resources.
 
     SizeType numBuckets() const;
-        // Return the number of buckets contained in this hash table.
+        // Return the number of buckets contained in this hash table.  Note
+        // that, while an incremental rehash is in progress, this is the
+        // number of buckets of the new array (see {Incremental Rehashing}).
 
     SizeType maxNumBuckets() const;
         // Return a theoretical upper bound on the largest number of buckets
@@ -2417,6 +3035,42 @@ class HashTable {
         // first such element (from the contiguous sequence of elements having
         // the same key).
 
+    template <class LOOKUP_KEY>
+    typename bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                        bslalg::BidirectionalLink *,
+                                        HASHER,
+                                        COMPARATOR>::type
+    find(const LOOKUP_KEY& key) const
+        // Return the address of a link whose key has the same value as the
+        // specified 'key' (according to this hash-table's 'comparator'), and
+        // a null pointer value if no such link exists.  If this hash-table
+        // contains more than one element having the supplied 'key', return
+        // the first such element.  This method participates in overload
+        // resolution only if both 'HASHER' and 'COMPARATOR' are transparent
+        // (see {Heterogeneous Lookup}).  The behavior is undefined unless
+        // 'key' hashes to the same value as every 'KeyType' object to which it
+        // compares equal.  Note that this method is defined in the class body
+        // to work around a Visual Studio bug (see 'bslmf_enableif').
+    {
+        return this->find(key, d_parameters.hashCodeForKey(key));
+    }
+
+    template <class RESULT_TYPE>
+    void findBatch(RESULT_TYPE   *results,
+                   const KeyType *keys,
+                   SizeType       numKeys) const;
+        // Load into each of the first specified 'numKeys' elements of the
+        // specified 'results' array a 'RESULT_TYPE' object constructed from
+        // the address that 'find' returns for the corresponding element of
+        // the specified 'keys' array.  'RESULT_TYPE' shall be
+        // 'bslalg::BidirectionalLink *', or a type (such as the iterator of a
+        // container) explicitly constructible from that type.  The behavior
+        // is undefined unless 'results' and 'keys' each refer to an array of
+        // at least 'numKeys' elements.  Note that the keys are processed in
+        // groups, prefetching the buckets and then the first nodes of a group
+        // before searching for any of its keys, so that the cache misses
+        // incurred by the searches overlap (see {Batched Lookup}).
+
     void findRange(bslalg::BidirectionalLink **first,
                    bslalg::BidirectionalLink **last,
                    const KeyType&              key) const;
@@ -2432,6 +3086,34 @@ class HashTable {
         // hash-table ensures all elements having the same key form a
         // contiguous sequence.
 
+    template <class LOOKUP_KEY>
+    typename bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                        void,
+                                        HASHER,
+                                        COMPARATOR>::type
+    findRange(bslalg::BidirectionalLink **first,
+              bslalg::BidirectionalLink **last,
+              const LOOKUP_KEY&           key) const
+        // Load into the specified 'first' and 'last' pointers the respective
+        // addresses of the first and last link (in the list of elements owned
+        // by this hash table) where the contained elements have a key that
+        // compares equal to the specified 'key' using the 'comparator' of
+        // this hash-table, and null pointers values if there are no elements
+        // matching 'key'.  This method participates in overload resolution
+        // only if both 'HASHER' and 'COMPARATOR' are transparent (see
+        // {Heterogeneous Lookup}).  The behavior is undefined unless 'key'
+        // hashes to the same value as every 'KeyType' object to which it
+        // compares equal.
+    {
+        BSLS_ASSERT_SAFE(first);
+        BSLS_ASSERT_SAFE(last);
+
+        *first = this->find(key);
+        *last  = *first
+               ? this->findEndOfRange(*first)
+               : 0;
+    }
+
     bslalg::BidirectionalLink *findEndOfRange(
                                        bslalg::BidirectionalLink *first) const;
         // Return the address of the first node after any nodes holding a
@@ -2449,12 +3131,33 @@ class HashTable {
     const bslalg::HashTableBucket& bucketAtIndex(SizeType index) const;
         // Return a non-modifiable reference to the 'HashTableBucket' at the
         // specified 'index' position in the array of buckets of this table.
-        // The behavior is undefined unless 'index < numBuckets()'.
+        // The behavior is undefined unless 'index < numBuckets()'.  Note
+        // that, while an incremental rehash is in progress, the returned
+        // bucket does not yet hold the elements that are to be migrated to
+        // it, which an iterator over the bucket visits only if constructed
+        // with the function returned by 'nextNodeInBucketFunction' (see
+        // {Incremental Rehashing}).
+
+    HashTableBucketIterator_NextNodeFunction nextNodeInBucketFunction() const;
+        // Return the address of a function that, supplied the address of this
+        // table, a bucket returned by 'bucketAtIndex', and a node of that
+        // bucket, returns the next node of the bucket, including the elements
+        // that are to be migrated to the bucket, if an incremental rehash of
+        // this table is in progress, and 0 otherwise.  Note that a
+        // 'HashTableBucketIterator' constructed with the returned function
+        // (see 'bslstl_hashtablebucketiterator') visits every element of its
+        // bucket, and is invalidated, like any other iterator over a bucket,
+        // by any rehash of this table.
 
     SizeType countElementsInBucket(SizeType index) const;
         // Return the number elements contained in the bucket at the specified
-        // 'index'.  Note that this operation has linear run-time complexity
-        // with respect to the number of elements in the indexed bucket.
+        // 'index', including, while an incremental rehash is in progress, the
+        // elements that are to be migrated to that bucket (see
+        // {Incremental Rehashing}).  Note that this operation has linear
+        // run-time complexity with respect to the number of elements in the
+        // indexed bucket, plus, while an incremental rehash is in progress,
+        // the number of elements in the buckets of the array being rehashed
+        // that may hold elements to be migrated to the indexed bucket.
 
     bool hasSameValue(const HashTable& other) const;
         // Imp detail for 'operator==' to be documented shortly
@@ -2604,6 +3307,19 @@ struct HashTable_ImpDetails {
     // when implementing a hash table.
 
     // CLASS METHODS
+    static size_t nextPowerOfTwo(size_t n);
+        // Return the smallest power of two greater-than or equal to the
+        // specified 'n'.  Throw a 'std::length_error' exception if that
+        // power of two is not representable by 'size_t'.
+
+    static size_t postMixHashCode(size_t hashCode);
+        // Return the result of applying a multiplicative (Fibonacci) hash to
+        // the specified 'hashCode', folding the high-order bits of the
+        // product into its low-order bits.  Note that the returned value is a
+        // bijective function of 'hashCode' whose low-order bits depend on
+        // all of the bits of 'hashCode', and so is suitable for computing a
+        // bucket index by masking.
+
     static size_t nextPrime(size_t n);
         // Return the next prime number greater-than or equal to the specified
         // 'n' in the increasing sequence of primes chosen to disperse hash
@@ -2622,15 +3338,29 @@ struct HashTable_ImpDetails {
     static size_t growBucketsForLoadFactor(size_t *capacity,
                                            size_t  minElements,
                                            size_t  requestedBuckets,
-                                           double  maxLoadFactor);
+                                           double  maxLoadFactor,
+                                           bool    usePowerOfTwoBuckets);
         // Return the suggested number of buckets to index a linked list that
         // can hold as many as the specified 'minElements' without exceeding
         // the specified 'maxLoadFactor', and supporting at lead the specified
-        // number of 'requestedBuckets'.  Set the specified '*capacity' to the
-        // maximum length of linked list that the returned number of buckets
-        // could index without exceeding the maxLoadFactor.  The behavior is
-        // undefined unless '0 < maxLoadFactor', '0 < minElements' and
-        // '0 < requestedBuckets'.
+        // number of 'requestedBuckets'.  The returned number is a power of
+        // two if the specified 'usePowerOfTwoBuckets' is 'true', and a prime
+        // number chosen by 'nextPrime' otherwise.  Set the specified
+        // '*capacity' to the maximum length of linked list that the returned
+        // number of buckets could index without exceeding the maxLoadFactor.
+        // The behavior is undefined unless '0 < maxLoadFactor',
+        // '0 < minElements' and '0 < requestedBuckets'.
+
+    static size_t incrementalWorkPerInsertion(size_t numRemaining,
+                                              size_t numInsertions,
+                                              size_t minWork);
+        // Return the number of units of the specified 'numRemaining' units of
+        // incremental work (e.g., buckets to migrate) to be performed by the
+        // next insertion into a hash table that can accept the specified
+        // 'numInsertions' before it next grows: twice the share of that
+        // insertion, but at least the specified 'minWork', and at most
+        // 'numRemaining'.  Note that, if each insertion performs the returned
+        // number of units, all the work is complete before the table grows.
 
     static bslma::Allocator *incidentalAllocator();
         // Return that address of an allocator that can be used to allocate
@@ -2666,6 +3396,15 @@ struct HashTable_Util {
         // that the value of a generic type passed to a function is a null
         // pointer value.
 
+    template<class ALLOCATOR>
+    static bslalg::HashTableBucket *allocateBucketArray(
+                                          native_std::size_t bucketArraySize,
+                                          const ALLOCATOR&   allocator);
+        // Return the address of a (contiguous) array of buckets of the
+        // specified 'bucketArraySize', allocated using memory supplied by the
+        // specified 'allocator'.  The buckets are not initialized.  The
+        // behavior is undefined unless '0 < bucketArraySize'.
+
     template<class ALLOCATOR>
     static void initAnchor(bslalg::HashTableAnchor *anchor,
                            native_std::size_t       bucketArraySize,
@@ -2970,6 +3709,283 @@ void HashTable_ArrayProctor<FACTORY>::release()
     d_anchor = 0;
 }
 
+                       // -------------------------------
+                       // class HashTable_HashCodeAdapter
+                       // -------------------------------
+
+// CREATORS
+template <class PARAMETERS>
+inline
+HashTable_HashCodeAdapter<PARAMETERS>::HashTable_HashCodeAdapter(
+                                                 const PARAMETERS& parameters)
+: d_parameters(parameters)
+{
+}
+
+// ACCESSORS
+template <class PARAMETERS>
+template <class ARG_TYPE>
+inline
+native_std::size_t
+HashTable_HashCodeAdapter<PARAMETERS>::operator()(ARG_TYPE& arg) const
+{
+    return d_parameters.hashCodeForKey(arg);
+}
+
+                       // ---------------------------
+                       // class HashTable_RehashState
+                       // ---------------------------
+
+// CREATORS
+template <bool REHASH_INCREMENTALLY>
+inline
+HashTable_RehashState<REHASH_INCREMENTALLY>::HashTable_RehashState()
+: d_oldAnchor(0, 0, 0)
+, d_rehashCursor(0)
+, d_spareBucketArray_p(0)
+, d_spareBucketArraySize(0)
+, d_spareCursor(0)
+{
+}
+
+// MANIPULATORS
+template <bool REHASH_INCREMENTALLY>
+inline
+void HashTable_RehashState<REHASH_INCREMENTALLY>::advanceRehashCursor()
+{
+    BSLS_ASSERT_SAFE(d_oldAnchor.bucketArrayAddress());
+    BSLS_ASSERT_SAFE(d_rehashCursor < d_oldAnchor.bucketArraySize());
+
+    ++d_rehashCursor;
+}
+
+template <bool REHASH_INCREMENTALLY>
+inline
+void HashTable_RehashState<REHASH_INCREMENTALLY>::beginRehash(
+                               bslalg::HashTableBucket *oldBucketArrayAddress,
+                               native_std::size_t       oldBucketArraySize)
+{
+    BSLS_ASSERT_SAFE(!d_oldAnchor.bucketArrayAddress());
+    BSLS_ASSERT_SAFE(oldBucketArrayAddress);
+
+    d_oldAnchor.setBucketArrayAddressAndSize(oldBucketArrayAddress,
+                                             oldBucketArraySize);
+    d_rehashCursor = 0;
+}
+
+template <bool REHASH_INCREMENTALLY>
+inline
+void HashTable_RehashState<REHASH_INCREMENTALLY>::endRehash()
+{
+    d_oldAnchor.setBucketArrayAddressAndSize(0, 0);
+    d_rehashCursor = 0;
+}
+
+template <bool REHASH_INCREMENTALLY>
+inline
+void HashTable_RehashState<REHASH_INCREMENTALLY>::advanceSpareCursor(
+                                                 native_std::size_t numBuckets)
+{
+    BSLS_ASSERT_SAFE(d_spareBucketArray_p);
+    BSLS_ASSERT_SAFE(numBuckets <= d_spareBucketArraySize - d_spareCursor);
+
+    d_spareCursor += numBuckets;
+}
+
+template <bool REHASH_INCREMENTALLY>
+inline
+void HashTable_RehashState<REHASH_INCREMENTALLY>::planSpareBucketArray(
+                                                 native_std::size_t numBuckets)
+{
+    BSLS_ASSERT_SAFE(!d_spareBucketArray_p);
+
+    d_spareBucketArraySize = numBuckets;
+    d_spareCursor          = 0;
+}
+
+template <bool REHASH_INCREMENTALLY>
+inline
+void HashTable_RehashState<REHASH_INCREMENTALLY>::setSpareBucketArrayAddress(
+                                              bslalg::HashTableBucket *address)
+{
+    BSLS_ASSERT_SAFE(d_spareBucketArraySize);
+
+    d_spareBucketArray_p = address;
+    d_spareCursor        = 0;
+}
+
+template <bool REHASH_INCREMENTALLY>
+inline
+void HashTable_RehashState<REHASH_INCREMENTALLY>::swapRehashState(
+                                                 HashTable_RehashState *other)
+{
+    BSLS_ASSERT_SAFE(other);
+
+    bslalg::SwapUtil::swap(&d_oldAnchor,    &other->d_oldAnchor);
+    bslalg::SwapUtil::swap(&d_rehashCursor, &other->d_rehashCursor);
+    bslalg::SwapUtil::swap(&d_spareBucketArray_p,
+                           &other->d_spareBucketArray_p);
+    bslalg::SwapUtil::swap(&d_spareBucketArraySize,
+                           &other->d_spareBucketArraySize);
+    bslalg::SwapUtil::swap(&d_spareCursor,  &other->d_spareCursor);
+}
+
+// ACCESSORS
+template <bool REHASH_INCREMENTALLY>
+inline
+const bslalg::HashTableAnchor *
+HashTable_RehashState<REHASH_INCREMENTALLY>::oldAnchor() const
+{
+    return d_oldAnchor.bucketArrayAddress() ? &d_oldAnchor : 0;
+}
+
+template <bool REHASH_INCREMENTALLY>
+inline
+native_std::size_t
+HashTable_RehashState<REHASH_INCREMENTALLY>::rehashCursor() const
+{
+    return d_rehashCursor;
+}
+
+template <bool REHASH_INCREMENTALLY>
+inline
+bslalg::HashTableBucket *
+HashTable_RehashState<REHASH_INCREMENTALLY>::spareBucketArrayAddress() const
+{
+    return d_spareBucketArray_p;
+}
+
+template <bool REHASH_INCREMENTALLY>
+inline
+native_std::size_t
+HashTable_RehashState<REHASH_INCREMENTALLY>::spareBucketArraySize() const
+{
+    return d_spareBucketArraySize;
+}
+
+template <bool REHASH_INCREMENTALLY>
+inline
+native_std::size_t
+HashTable_RehashState<REHASH_INCREMENTALLY>::spareCursor() const
+{
+    return d_spareCursor;
+}
+
+                     // ----------------------------------
+                     // class HashTable_RehashState<false>
+                     // ----------------------------------
+
+// CREATORS
+inline
+HashTable_RehashState<false>::HashTable_RehashState()
+{
+}
+
+// MANIPULATORS
+inline
+void HashTable_RehashState<false>::advanceRehashCursor()
+{
+}
+
+inline
+void HashTable_RehashState<false>::beginRehash(bslalg::HashTableBucket *,
+                                               native_std::size_t)
+{
+}
+
+inline
+void HashTable_RehashState<false>::endRehash()
+{
+}
+
+inline
+void HashTable_RehashState<false>::advanceSpareCursor(native_std::size_t)
+{
+}
+
+inline
+void HashTable_RehashState<false>::planSpareBucketArray(native_std::size_t)
+{
+}
+
+inline
+void HashTable_RehashState<false>::setSpareBucketArrayAddress(
+                                                    bslalg::HashTableBucket *)
+{
+}
+
+inline
+void HashTable_RehashState<false>::swapRehashState(HashTable_RehashState *)
+{
+}
+
+// ACCESSORS
+inline
+const bslalg::HashTableAnchor *HashTable_RehashState<false>::oldAnchor() const
+{
+    return 0;
+}
+
+inline
+bslalg::HashTableBucket *
+HashTable_RehashState<false>::spareBucketArrayAddress() const
+{
+    return 0;
+}
+
+inline
+native_std::size_t HashTable_RehashState<false>::rehashCursor() const
+{
+    return 0;
+}
+
+inline
+native_std::size_t HashTable_RehashState<false>::spareBucketArraySize() const
+{
+    return 0;
+}
+
+inline
+native_std::size_t HashTable_RehashState<false>::spareCursor() const
+{
+    return 0;
+}
+
+                    // --------------------------
+                    // class HashTable_ImpDetails
+                    // --------------------------
+
+// CLASS METHODS
+inline
+size_t HashTable_ImpDetails::postMixHashCode(size_t hashCode)
+{
+    // The multiplier is 2^N divided by the golden ratio, rounded to an odd
+    // number, for an 'N'-bit 'size_t'.  The high-order half of the product is
+    // folded into the low-order half, as the low-order bits of a product
+    // depend only on the low-order bits of its operands.
+
+#if defined(BSLS_PLATFORM_CPU_64_BIT)
+    const size_t product = hashCode * 0x9E3779B97F4A7C15ULL;
+    return product ^ (product >> 32);
+#else
+    const size_t product = hashCode * 0x9E3779B9U;
+    return product ^ (product >> 16);
+#endif
+}
+
+inline
+size_t HashTable_ImpDetails::incrementalWorkPerInsertion(size_t numRemaining,
+                                                         size_t numInsertions,
+                                                         size_t minWork)
+{
+    const size_t share = numInsertions
+                       ? (2 * numRemaining + numInsertions - 1) / numInsertions
+                       : numRemaining;
+    const size_t result = native_std::max(share, minWork);
+
+    return result < numRemaining ? result : numRemaining;
+}
+
                     // -------------------------------
                     // class HashTable::ImplParameters
                     // -------------------------------
@@ -3099,7 +4115,12 @@ native_std::size_t
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::ImplParameters::
 hashCodeForKey(DEDUCED_KEY& key) const
 {
-    return static_cast<const BaseHasher &>(*this)(key);
+    const native_std::size_t hashCode =
+                                   static_cast<const BaseHasher &>(*this)(key);
+
+    return USE_POWER_OF_TWO_BUCKETS
+         ? HashTable_ImpDetails::postMixHashCode(hashCode)
+         : hashCode;
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3139,11 +4160,10 @@ void HashTable_Util::assertNotNullPointer(TYPE * & ptr)
 
 template <class ALLOCATOR>
 inline
-void HashTable_Util::initAnchor(bslalg::HashTableAnchor *anchor,
-                                native_std::size_t       bucketArraySize,
-                                const ALLOCATOR&         allocator)
+bslalg::HashTableBucket *
+HashTable_Util::allocateBucketArray(native_std::size_t bucketArraySize,
+                                    const ALLOCATOR&   allocator)
 {
-    BSLS_ASSERT_SAFE(anchor);
     BSLS_ASSERT_SAFE(0 != bucketArraySize);
 
     typedef ::bsl::allocator_traits<ALLOCATOR>               ParamAllocTraits;
@@ -3173,15 +4193,26 @@ void HashTable_Util::initAnchor(bslalg::HashTableAnchor *anchor,
     // standard conforming allocator must use a 'size_type' that is a built-in
     // unsigned integer type.
 
-    const SizeType newArraySize = static_cast<SizeType>(bucketArraySize);
+    return ArrayAllocatorTraits::allocate(
+                                      reboundAllocator,
+                                      static_cast<SizeType>(bucketArraySize));
+}
 
-    bslalg::HashTableBucket *data = ArrayAllocatorTraits::allocate(
-                                       reboundAllocator,
-                                       newArraySize);
+template <class ALLOCATOR>
+inline
+void HashTable_Util::initAnchor(bslalg::HashTableAnchor *anchor,
+                                native_std::size_t       bucketArraySize,
+                                const ALLOCATOR&         allocator)
+{
+    BSLS_ASSERT_SAFE(anchor);
+    BSLS_ASSERT_SAFE(0 != bucketArraySize);
+
+    bslalg::HashTableBucket *data = allocateBucketArray(bucketArraySize,
+                                                        allocator);
 
     native_std::fill_n(data, bucketArraySize, bslalg::HashTableBucket());
 
-    anchor->setBucketArrayAddressAndSize(data, newArraySize);
+    anchor->setBucketArrayAddressAndSize(data, bucketArraySize);
 }
 
 template <class ALLOCATOR>
@@ -3265,7 +4296,8 @@ HashTable(const HASHER&     hash,
                                         &capacity,
                                         1,
                                         static_cast<size_t>(initialNumBuckets),
-                                        d_maxLoadFactor);
+                                        d_maxLoadFactor,
+                                        USE_POWER_OF_TWO_BUCKETS);
         HashTable_Util::initAnchor(&d_anchor, numBuckets, allocator);
         d_capacity = static_cast<SizeType>(capacity);
     }
@@ -3320,16 +4352,160 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::~HashTable()
     // kind of catastrophic failure we are concerned with handling in an
     // invariant check that runs only in SAFE_2 builds from a destructor.
 
-    BSLS_ASSERT_SAFE(bslalg::HashTableImpUtil::isWellFormed<KEY_CONFIG>(
+    // Note that the list of a table whose incremental rehash is in progress
+    // is not indexed by a single bucket array, so cannot be checked.
+
+    BSLS_ASSERT_SAFE(this->oldAnchor()
+                  || bslalg::HashTableImpUtil::isWellFormed<KEY_CONFIG>(
                                  this->d_anchor,
-                                 this->d_parameters.hasher(),
+                                 HashTable_HashCodeAdapter<ImplParameters>(
+                                                         this->d_parameters),
                                  HashTable_ImpDetails::incidentalAllocator()));
 #endif
 
-    this->removeAllAndDeallocate();
+    if (!d_parameters.nodeFactory().winkOut()) {
+        this->removeAllAndDeallocate();
+    }
+}
+
+// PRIVATE CLASS METHODS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::nextNodeInBucket(
+                                     const void                    *table,
+                                     const bslalg::HashTableBucket *bucket,
+                                     bslalg::BidirectionalLink     *node)
+{
+    BSLS_ASSERT_SAFE(table);
+    BSLS_ASSERT_SAFE(bucket);
+
+    const HashTable& self = *static_cast<const HashTable *>(table);
+
+    const bslalg::HashTableAnchor *oldAnchor = self.oldAnchor();
+    BSLS_ASSERT_SAFE(oldAnchor);
+
+    const SizeType index = static_cast<SizeType>(
+                                  bucket - self.d_anchor.bucketArrayAddress());
+
+    // The nodes that 'bucket' indexes are visited first, followed by the
+    // nodes, in the buckets of the array being rehashed, that are to be
+    // migrated to 'bucket'.  Note that a node is held by the array being
+    // rehashed if, and only if, 'findOldBucket' returns a non-null address
+    // for its hash code.
+
+    native_std::size_t begin;
+    native_std::size_t end;
+    self.findOldBucketRange(&begin, &end, index);
+
+    bslalg::BidirectionalLink *cursor = 0;  // next node of the bucket at
+                                            // 'begin' to consider, or 0 for
+                                            // its first node
+
+    if (!node) {
+        if (bucket->first()) {
+            return bucket->first();                                   // RETURN
+        }
+    }
+    else {
+        const native_std::size_t hashCode = self.hashCodeForNode(node);
+        if (!self.findOldBucket(hashCode)) {
+            if (bucket->last() != node) {
+                return node->nextLink();                              // RETURN
+            }
+        }
+        else {
+            begin = bslalg::HashTableImpUtil::computeBucketIndex(
+                                                 hashCode,
+                                                 oldAnchor->bucketArraySize());
+            if (oldAnchor->bucketArrayAddress()[begin].last() != node) {
+                cursor = node->nextLink();
+            }
+            else {
+                ++begin;
+            }
+        }
+    }
+
+    for (; begin < end; ++begin, cursor = 0) {
+        const bslalg::HashTableBucket& oldBucket =
+                                        oldAnchor->bucketArrayAddress()[begin];
+        if (!cursor) {
+            cursor = oldBucket.first();
+        }
+        for (bslalg::BidirectionalLink *endBucket = oldBucket.end();
+             endBucket != cursor;
+             cursor = cursor->nextLink()) {
+            if (index == bslalg::HashTableImpUtil::computeBucketIndex(
+                                            self.hashCodeForNode(cursor),
+                                            self.d_anchor.bucketArraySize())) {
+                return cursor;                                        // RETURN
+            }
+        }
+    }
+
+    return 0;
 }
 
 // PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::advanceIncrementalRehash(
+                                                   native_std::size_t hashCode)
+{
+    const bslalg::HashTableAnchor *oldAnchor = this->oldAnchor();
+    if (!oldAnchor) {
+        this->prepareSpareBucketArray();
+        return;                                                       // RETURN
+    }
+
+    // First migrate the bucket that an element having 'hashCode' would
+    // occupy, so that all the elements having an equivalent key are indexed
+    // by the current bucket array before the new element is inserted.
+
+    if (bslalg::HashTableBucket *bucket = this->findOldBucket(hashCode)) {
+        this->migrateBucket(bucket);
+    }
+
+    // Then migrate enough of the remaining buckets that the rehash completes
+    // well before this table next grows, leaving the insertions that follow
+    // to prepare the next bucket array.
+
+    const native_std::size_t numOldBuckets = oldAnchor->bucketArraySize();
+    native_std::size_t numToMigrate =
+                     HashTable_ImpDetails::incrementalWorkPerInsertion(
+                                         numOldBuckets - this->rehashCursor(),
+                                         d_capacity - d_size,
+                                         MIN_BUCKETS_MIGRATED_PER_INSERT);
+    for (; 0 < numToMigrate; --numToMigrate) {
+        this->migrateBucket(oldAnchor->bucketArrayAddress()
+                                                      + this->rehashCursor());
+        this->advanceRehashCursor();
+    }
+
+    if (this->rehashCursor() == numOldBuckets) {
+        this->releaseOldBucketArray();
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+completeIncrementalRehash()
+{
+    const bslalg::HashTableAnchor *oldAnchor = this->oldAnchor();
+    if (!oldAnchor) {
+        return;                                                       // RETURN
+    }
+
+    const native_std::size_t numOldBuckets = oldAnchor->bucketArraySize();
+    for (; this->rehashCursor() < numOldBuckets; this->advanceRehashCursor()) {
+        this->migrateBucket(oldAnchor->bucketArrayAddress()
+                                                      + this->rehashCursor());
+    }
+
+    this->releaseOldBucketArray();
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
@@ -3349,7 +4525,8 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
                                                    &capacity,
                                                    static_cast<size_t>(d_size),
                                                    2,
-                                                   d_maxLoadFactor);
+                                                   d_maxLoadFactor,
+                                                   USE_POWER_OF_TWO_BUCKETS);
 
     d_anchor.setListRootAddress(0);
     HashTable_Util::initAnchor(&d_anchor, numBuckets, this->allocator());
@@ -3371,6 +4548,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
         bslalg::BidirectionalLink *newNode =
                                  d_parameters.nodeFactory().cloneNode(*cursor);
 
+        this->setHashCodeForNode(newNode, hashCode);
         bslalg::HashTableImpUtil::insertAtBackOfBucket(&d_anchor,
                                                        newNode,
                                                        hashCode);
@@ -3382,6 +4560,144 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
     arrayProctor.release();
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::growBucketArray()
+{
+    if (!REHASH_INCREMENTALLY || !d_anchor.listRootAddress()) {
+        this->rehashForNumBuckets(numBuckets() * 2);
+        return;                                                       // RETURN
+    }
+
+    // The previous rehash is normally complete long before this table grows
+    // (see 'advanceIncrementalRehash').
+
+    this->completeIncrementalRehash();
+
+    size_t capacity;
+    size_t numBuckets = HashTable_ImpDetails::growBucketsForLoadFactor(
+                                   &capacity,
+                                   d_size + 1u,
+                                   static_cast<size_t>(this->numBuckets() * 2),
+                                   d_maxLoadFactor,
+                                   USE_POWER_OF_TWO_BUCKETS);
+
+    // Adopt the spare bucket array, which is normally allocated and cleared
+    // by now (see 'prepareSpareBucketArray'), so that this insertion does not
+    // bear the cost of allocating and clearing a large array.
+
+    bslalg::HashTableBucket *buckets = this->spareBucketArrayAddress();
+    if (buckets && numBuckets == this->spareBucketArraySize()) {
+        native_std::fill_n(buckets + this->spareCursor(),
+                           numBuckets - this->spareCursor(),
+                           bslalg::HashTableBucket());
+        this->setSpareBucketArrayAddress(0);
+        this->planSpareBucketArray(0);
+    }
+    else {
+        bslalg::HashTableAnchor newAnchor(0, 0, 0);
+        HashTable_Util::initAnchor(&newAnchor, numBuckets, this->allocator());
+        buckets = newAnchor.bucketArrayAddress();
+
+        this->releaseSpareBucketArray();
+    }
+
+    // No element is indexed by the new bucket array yet, but the new array
+    // becomes the current one, so its list root is that of the whole list.
+
+    this->beginRehash(d_anchor.bucketArrayAddress(),
+                      d_anchor.bucketArraySize());
+    d_anchor.setBucketArrayAddressAndSize(buckets, numBuckets);
+    d_capacity     = static_cast<SizeType>(capacity);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::migrateBucket(
+                                               bslalg::HashTableBucket *bucket)
+{
+    BSLS_ASSERT_SAFE(bucket);
+    BSLS_ASSERT_SAFE(this->oldAnchor());
+    BSLS_ASSERT_SAFE(this->oldAnchor()->bucketArrayAddress() <= bucket);
+    BSLS_ASSERT_SAFE(bucket < this->oldAnchor()->bucketArrayAddress()
+                            + this->oldAnchor()->bucketArraySize());
+
+    // Elements having equivalent keys are contiguous in 'bucket', and are
+    // appended in order to the same bucket of the current array, so they
+    // remain contiguous.  The hash code of each element is computed before
+    // the element is unlinked, so that a throwing 'hasher' leaves this table
+    // in a valid state.
+
+    while (bslalg::BidirectionalLink *node = bucket->first()) {
+        size_t hashCode = this->hashCodeForNode(node);
+
+        this->removeFromOldBucketArray(node, hashCode);
+        bslalg::HashTableImpUtil::insertAtBackOfBucket(&d_anchor,
+                                                       node,
+                                                       hashCode);
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+prepareSpareBucketArray()
+{
+    BSLS_ASSERT_SAFE(!this->oldAnchor());
+
+    if (!REHASH_INCREMENTALLY || !d_anchor.listRootAddress()) {
+        // An empty table grows by an immediate rehash.
+
+        return;                                                       // RETURN
+    }
+
+    const size_t numInsertions = d_capacity - d_size;
+
+    size_t numSpareBuckets = this->spareBucketArraySize();
+    if (!numSpareBuckets) {
+        // The next growth is triggered by an insertion into a full table, so
+        // it computes the number of buckets for 'd_capacity + 1' elements.
+
+        size_t capacity;
+        numSpareBuckets = HashTable_ImpDetails::growBucketsForLoadFactor(
+                                   &capacity,
+                                   d_capacity + 1u,
+                                   static_cast<size_t>(this->numBuckets() * 2),
+                                   d_maxLoadFactor,
+                                   USE_POWER_OF_TWO_BUCKETS);
+        this->planSpareBucketArray(numSpareBuckets);
+    }
+
+    bslalg::HashTableBucket *spare = this->spareBucketArrayAddress();
+    if (!spare) {
+        // Defer the allocation until clearing the minimum number of buckets
+        // per insertion would take about half of the remaining insertions, so
+        // that the spare array is not held longer than necessary.
+
+        if (numInsertions >
+                     numSpareBuckets / (MIN_BUCKETS_CLEARED_PER_INSERT / 2)) {
+            return;                                                   // RETURN
+        }
+
+        spare = HashTable_Util::allocateBucketArray(numSpareBuckets,
+                                                    this->allocator());
+        this->setSpareBucketArrayAddress(spare);
+    }
+
+    const size_t numCleared = this->spareCursor();
+    const size_t numToClear =
+                     HashTable_ImpDetails::incrementalWorkPerInsertion(
+                                               numSpareBuckets - numCleared,
+                                               numInsertions,
+                                               MIN_BUCKETS_CLEARED_PER_INSERT);
+    if (numToClear) {
+        native_std::fill_n(spare + numCleared,
+                           numToClear,
+                           bslalg::HashTableBucket());
+        this->advanceSpareCursor(numToClear);
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
@@ -3393,6 +4709,7 @@ quickSwapRetainAllocators(HashTable *other)
     d_parameters.quickSwapRetainAllocators(&other->d_parameters);
 
     bslalg::SwapUtil::swap(&d_anchor,        &other->d_anchor);
+    this->swapRehashState(other);
     bslalg::SwapUtil::swap(&d_size,          &other->d_size);
     bslalg::SwapUtil::swap(&d_capacity,      &other->d_capacity);
     bslalg::SwapUtil::swap(&d_maxLoadFactor, &other->d_maxLoadFactor);
@@ -3408,6 +4725,7 @@ quickSwapExchangeAllocators(HashTable *other)
     d_parameters.quickSwapExchangeAllocators(&other->d_parameters);
 
     bslalg::SwapUtil::swap(&d_anchor,        &other->d_anchor);
+    this->swapRehashState(other);
     bslalg::SwapUtil::swap(&d_size,          &other->d_size);
     bslalg::SwapUtil::swap(&d_capacity,      &other->d_capacity);
     bslalg::SwapUtil::swap(&d_maxLoadFactor, &other->d_maxLoadFactor);
@@ -3497,16 +4815,58 @@ rehashIntoExactlyNumBuckets(SizeType newNumBuckets, SizeType capacity)
     Proctor cleanUpIfUserHashThrows(this, &d_anchor, &newAnchor);
 
     if (d_anchor.listRootAddress()) {
-        bslalg::HashTableImpUtil::rehash<KEY_CONFIG>(
-                                          &newAnchor,
-                                          this->d_anchor.listRootAddress(),
-                                          this->d_parameters.hasher());
+        if (CACHE_HASH_CODES) {
+            bslalg::HashTableImpUtil::rehashUsingCachedHashCodes<KEY_CONFIG>(
+                                             &newAnchor,
+                                             this->d_anchor.listRootAddress());
+        }
+        else {
+            bslalg::HashTableImpUtil::rehash<KEY_CONFIG>(
+                                  &newAnchor,
+                                  this->d_anchor.listRootAddress(),
+                                  HashTable_HashCodeAdapter<ImplParameters>(
+                                                         this->d_parameters));
+        }
     }
 
     cleanUpIfUserHashThrows.dismiss();
 
     d_anchor.swap(newAnchor);
     d_capacity = capacity;
+
+    // Every element is now indexed by the new bucket array, so any
+    // incremental rehash that was in progress is complete, and the spare
+    // bucket array, planned for the previous capacity, is of no further use.
+
+    this->releaseOldBucketArray();
+    this->releaseSpareBucketArray();
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::releaseOldBucketArray()
+{
+    if (const bslalg::HashTableAnchor *oldAnchor = this->oldAnchor()) {
+        HashTable_Util::destroyBucketArray(oldAnchor->bucketArrayAddress(),
+                                           oldAnchor->bucketArraySize(),
+                                           this->allocator());
+        this->endRehash();
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::releaseSpareBucketArray()
+{
+    if (bslalg::HashTableBucket *spare = this->spareBucketArrayAddress()) {
+        HashTable_Util::destroyBucketArray(spare,
+                                           this->spareBucketArraySize(),
+                                           this->allocator());
+        this->setSpareBucketArrayAddress(0);
+    }
+    this->planSpareBucketArray(0);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3515,6 +4875,8 @@ void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAllAndDeallocate()
 {
     this->removeAllImp();
+    this->releaseOldBucketArray();
+    this->releaseSpareBucketArray();
     HashTable_Util::destroyBucketArray(d_anchor.bucketArrayAddress(),
                                        d_anchor.bucketArraySize(),
                                        this->allocator());
@@ -3540,6 +4902,42 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAllImp()
     }
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeFromOldBucketArray(
+                                           bslalg::BidirectionalLink *node,
+                                           native_std::size_t         hashCode)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(this->oldAnchor());
+
+    // The array being rehashed does not track the root of the list, which is
+    // shared with the current bucket array, so we remove 'node' through a
+    // temporary anchor combining that list root with the old buckets.
+
+    bslalg::HashTableAnchor tempAnchor(
+                                      this->oldAnchor()->bucketArrayAddress(),
+                                      this->oldAnchor()->bucketArraySize(),
+                                      d_anchor.listRootAddress());
+    bslalg::HashTableImpUtil::remove(&tempAnchor, node, hashCode);
+    d_anchor.setListRootAddress(tempAnchor.listRootAddress());
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::setHashCodeForNode(
+                                           bslalg::BidirectionalLink *node,
+                                           native_std::size_t         hashCode)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    if (CACHE_HASH_CODES) {
+        static_cast<HashedNodeType *>(node)->setHashCode(hashCode);
+    }
+}
+
 // PRIVATE ACCESSORS
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
@@ -3549,10 +4947,63 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hashCodeForNode(
 {
     BSLS_ASSERT_SAFE(node);
 
+    if (CACHE_HASH_CODES) {
+        return static_cast<HashedNodeType *>(node)->hashCode();       // RETURN
+    }
+
     return d_parameters.hashCodeForKey(
                        bslalg::HashTableImpUtil::extractKey<KEY_CONFIG>(node));
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findOldBucketRange(
+                                               native_std::size_t *begin,
+                                               native_std::size_t *end,
+                                               SizeType            index) const
+{
+    BSLS_ASSERT_SAFE(begin);
+    BSLS_ASSERT_SAFE(end);
+    BSLS_ASSERT_SAFE(this->oldAnchor());
+    BSLS_ASSERT_SAFE(index < this->numBuckets());
+
+    // The buckets of the array being rehashed that are already migrated are
+    // empty.  If the number of buckets of that array divides the number of
+    // buckets of the current array, as it does when this table grows, only
+    // the bucket at 'index' modulo the size of that array can hold elements
+    // to be migrated to 'index'.
+
+    const native_std::size_t numOldBuckets =
+                                       this->oldAnchor()->bucketArraySize();
+    if (0 == d_anchor.bucketArraySize() % numOldBuckets) {
+        *begin = index % numOldBuckets;
+        *end   = *begin + 1;
+    }
+    else {
+        *begin = this->rehashCursor();
+        *end   = numOldBuckets;
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bslalg::HashTableBucket *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findOldBucket(
+                                             native_std::size_t hashCode) const
+{
+    const bslalg::HashTableAnchor *oldAnchor = this->oldAnchor();
+    if (!oldAnchor) {
+        return 0;                                                     // RETURN
+    }
+
+    bslalg::HashTableBucket *bucket = oldAnchor->bucketArrayAddress()
+                              + bslalg::HashTableImpUtil::computeBucketIndex(
+                                                hashCode,
+                                                oldAnchor->bucketArraySize());
+    return bucket->first() ? bucket : 0;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 bslalg::HashTableBucket *
@@ -3572,8 +5023,24 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                             DEDUCED_KEY&       key,
                                             native_std::size_t hashValue) const
 {
+    // While an incremental rehash is in progress, the elements having
+    // 'hashValue' are indexed either all by the array being rehashed, or all
+    // by the current array (see 'findOldBucket').
+
+    const bslalg::HashTableAnchor& anchor = this->findOldBucket(hashValue)
+                                          ? *this->oldAnchor()
+                                          : d_anchor;
+
+    if (CACHE_HASH_CODES) {
+        return bslalg::HashTableImpUtil::findUsingCachedHashCodes<KEY_CONFIG>(
+                                                     anchor,
+                                                     key,
+                                                     d_parameters.comparator(),
+                                                     hashValue);      // RETURN
+    }
+
     return bslalg::HashTableImpUtil::find<KEY_CONFIG>(
-                                                     d_anchor,
+                                                     anchor,
                                                      key,
                                                      d_parameters.comparator(),
                                                      hashValue);
@@ -3600,6 +5067,19 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::operator=(
     return *this;
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+const bslalg::HashTableBucket&
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::bucketAtIndex(
+                                                                SizeType index)
+{
+    BSLS_ASSERT_SAFE(index < this->numBuckets());
+
+    this->completeIncrementalRehash();
+
+    return d_anchor.bucketArrayAddress()[index];
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 template <class SOURCE_TYPE>
 bslalg::BidirectionalLink *
@@ -3612,7 +5092,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
     // potentially improve the 'find' time.
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
     // Create a node having the new 'value' we want to insert into the table.
@@ -3633,10 +5113,17 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+
+    // Any elements having the same key must be indexed by the current bucket
+    // array before we search for them, so that 'newNode' can be inserted
+    // alongside them.
+
+    this->advanceIncrementalRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
 
+    this->setHashCodeForNode(newNode, hashCode);
     if (!position) {
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
     }
@@ -3665,7 +5152,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
     // potentially improve the potential 'find' time later.
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
     // Next we must create the node, to avoid making a temporary of 'ValueType'
@@ -3684,11 +5171,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceIncrementalRehash(hashCode);
     if (!d_parameters.comparator()(ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                    ImpUtil::extractKey<KEY_CONFIG>(hint))) {
         hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
     }
 
+    this->setHashCodeForNode(newNode, hashCode);
     if (!hint) {
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
     }
@@ -3720,10 +5209,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
 
+        this->advanceIncrementalRehash(hashCode);
+
         position = d_parameters.nodeFactory().createNode(value);
+        this->setHashCodeForNode(position, hashCode);
         bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
                                                         position,
                                                         hashCode);
@@ -3748,7 +5240,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
     // potentially improve the potential 'find' time later.
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
     // Next we must create the node, to avoid making a temporary of 'ValueType'
@@ -3775,9 +5267,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
 
+        this->advanceIncrementalRehash(hashCode);
+
+        this->setHashCodeForNode(newNode, hashCode);
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
         nodeProctor.release();
 
@@ -3797,13 +5292,16 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
     bslalg::BidirectionalLink *position = this->find(key, hashCode);
     if (!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
 
+        this->advanceIncrementalRehash(hashCode);
+
         position = d_parameters.nodeFactory().createNode(
                                             key,
                                             typename ValueType::second_type());
 
+        this->setHashCodeForNode(position, hashCode);
         bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
                                                         position,
                                                         hashCode);
@@ -3827,11 +5325,18 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::rehashForNumBuckets(
                                             &capacity,
                                             d_size + 1u,
                                             static_cast<size_t>(newNumBuckets),
-                                            d_maxLoadFactor));
+                                            d_maxLoadFactor,
+                                            USE_POWER_OF_TWO_BUCKETS));
 
         this->rehashIntoExactlyNumBuckets(numBuckets,
                                           static_cast<SizeType>(capacity));
     }
+    else {
+        // Completing the rehash lets a client of the bucket interface obtain
+        // a complete view of the buckets without growing the table.
+
+        this->completeIncrementalRehash();
+    }
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3855,7 +5360,8 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::reserveForNumElements(
                                        &capacity,
                                        numElements,
                                        static_cast<size_t>(this->numBuckets()),
-                                       d_maxLoadFactor));
+                                       d_maxLoadFactor,
+                                       USE_POWER_OF_TWO_BUCKETS));
 
         this->rehashIntoExactlyNumBuckets(numBuckets,
                                           static_cast<SizeType>(capacity));
@@ -3873,9 +5379,16 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::remove(
 
     bslalg::BidirectionalLink *result = node->nextLink();
 
-    bslalg::HashTableImpUtil::remove(&d_anchor,
-                                     node,
-                                     hashCodeForNode(node));
+    // Note that, to preserve the iteration order of the remaining elements, no
+    // elements are migrated by an incremental rehash when removing a node.
+
+    size_t hashCode = hashCodeForNode(node);
+    if (this->findOldBucket(hashCode)) {
+        this->removeFromOldBucketArray(node, hashCode);
+    }
+    else {
+        bslalg::HashTableImpUtil::remove(&d_anchor, node, hashCode);
+    }
     --d_size;
 
     d_parameters.nodeFactory().deleteNode((NodeType *)node);
@@ -3895,6 +5408,8 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAll()
 
     d_anchor.setListRootAddress(0);
     d_size = 0;
+
+    this->releaseOldBucketArray();
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3910,7 +5425,8 @@ void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::setMaxLoadFactor(
                                        &capacity,
                                        native_std::max<SizeType>(d_size, 1u),
                                        static_cast<size_t>(this->numBuckets()),
-                                       newMaxLoadFactor));
+                                       newMaxLoadFactor,
+                                       USE_POWER_OF_TWO_BUCKETS));
 
     this->rehashIntoExactlyNumBuckets(numBuckets,
                                       static_cast<SizeType>(capacity));
@@ -4001,11 +5517,77 @@ bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                                       const KeyType& key) const
 {
-    return bslalg::HashTableImpUtil::find<KEY_CONFIG>(
-                                             d_anchor,
-                                             key,
-                                             d_parameters.comparator(),
-                                             d_parameters.hashCodeForKey(key));
+    return this->find(key, d_parameters.hashCodeForKey(key));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class RESULT_TYPE>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findBatch(
+                                                RESULT_TYPE   *results,
+                                                const KeyType *keys,
+                                                SizeType       numKeys) const
+{
+    BSLS_ASSERT_SAFE(results || !numKeys);
+    BSLS_ASSERT_SAFE(keys    || !numKeys);
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+    typedef bsls::PerformanceHint    Hint;
+
+    native_std::size_t       hashCodes[FIND_BATCH_SIZE];
+    bslalg::HashTableBucket *buckets[FIND_BATCH_SIZE];
+
+    while (numKeys) {
+        const SizeType batchSize = numKeys < SizeType(FIND_BATCH_SIZE)
+                                 ? numKeys
+                                 : SizeType(FIND_BATCH_SIZE);
+
+        // First, hash each key of the batch and prefetch its bucket (in both
+        // arrays, if an incremental rehash is in progress).
+
+        for (SizeType i = 0; i != batchSize; ++i) {
+            hashCodes[i] = d_parameters.hashCodeForKey(keys[i]);
+            buckets[i]   = d_anchor.bucketArrayAddress()
+                         + ImpUtil::computeBucketIndex(
+                                               hashCodes[i],
+                                               d_anchor.bucketArraySize());
+            Hint::prefetchForReading(buckets[i]);
+
+            if (const bslalg::HashTableAnchor *oldAnchor = this->oldAnchor()) {
+                Hint::prefetchForReading(
+                               oldAnchor->bucketArrayAddress()
+                             + ImpUtil::computeBucketIndex(
+                                             hashCodes[i],
+                                             oldAnchor->bucketArraySize()));
+            }
+        }
+
+        // Then, prefetch the first node of each of those buckets.
+
+        for (SizeType i = 0; i != batchSize; ++i) {
+            const bslalg::HashTableBucket *bucket = buckets[i];
+            if (REHASH_INCREMENTALLY) {
+                if (bslalg::HashTableBucket *oldBucket =
+                                          this->findOldBucket(hashCodes[i])) {
+                    bucket = oldBucket;
+                }
+            }
+            if (bucket->first()) {
+                Hint::prefetchForReading(bucket->first());
+            }
+        }
+
+        // Finally, search for each key, its bucket and first node now being
+        // (ideally) in cache.
+
+        for (SizeType i = 0; i != batchSize; ++i) {
+            results[i] = RESULT_TYPE(this->find(keys[i], hashCodes[i]));
+        }
+
+        results += batchSize;
+        keys    += batchSize;
+        numKeys -= batchSize;
+    }
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -4085,7 +5667,37 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::countElementsInBucket(
 {
     BSLS_ASSERT_SAFE(index < this->numBuckets());
 
-    return static_cast<SizeType>(bucketAtIndex(index).countElements());
+    SizeType result = static_cast<SizeType>(
+                         d_anchor.bucketArrayAddress()[index].countElements());
+
+    const bslalg::HashTableAnchor *oldAnchor = this->oldAnchor();
+    if (!oldAnchor) {
+        return result;                                                // RETURN
+    }
+
+    // While an incremental rehash is in progress, also count the elements of
+    // the array being rehashed that are to be migrated to 'index'.
+
+    native_std::size_t begin;
+    native_std::size_t end;
+    this->findOldBucketRange(&begin, &end, index);
+
+    for (; begin < end; ++begin) {
+        const bslalg::HashTableBucket& bucket =
+                                        oldAnchor->bucketArrayAddress()[begin];
+        for (bslalg::BidirectionalLink *cursor    = bucket.first(),
+                                       *endBucket = bucket.end();
+             endBucket != cursor;
+             cursor = cursor->nextLink()) {
+            if (index == bslalg::HashTableImpUtil::computeBucketIndex(
+                                                 this->hashCodeForNode(cursor),
+                                                 d_anchor.bucketArraySize())) {
+                ++result;
+            }
+        }
+    }
+
+    return result;
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -4111,6 +5723,15 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::bucketAtIndex(
     return d_anchor.bucketArrayAddress()[index];
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+HashTableBucketIterator_NextNodeFunction
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+nextNodeInBucketFunction() const
+{
+    return this->oldAnchor() ? &HashTable::nextNodeInBucket : 0;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 float HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::loadFactor() const
@@ -4160,10 +5781,8 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hasSameValue(
 
     while (cursor) {
         bslalg::BidirectionalLink *rhsFirst =
-             ImpUtil::find<KEY_CONFIG>(other.d_anchor,
-                                       ImpUtil::extractKey<KEY_CONFIG>(cursor),
-                                       other.d_parameters.comparator(),
-                                       other.d_parameters.hashCodeForKey(
+                       other.find(ImpUtil::extractKey<KEY_CONFIG>(cursor),
+                                  other.d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(cursor)));
         if (!rhsFirst) {
             return false;  // no matching key                         // RETURN
@@ -27,6 +27,13 @@ BSLS_IDENT("$Id: $")
 // 'difference_type' for the iterator, and will typically be supplied by the
 // allocator used by the hash-table being iterated over.
 //
+// A hash table whose elements are being incrementally migrated to a new array
+// of buckets (see {'bslstl_hashtable'}) may hold some of the elements of a
+// bucket of that array in buckets of the old array.  An iterator over such a
+// bucket may be constructed with the address of a function that, given the
+// node last visited, returns the next node of the bucket, wherever that node
+// is held, so that the iterator visits every element of the bucket.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -155,6 +162,16 @@ namespace BloombergLP {
 namespace bslstl
 {
 
+typedef bslalg::BidirectionalLink *(*HashTableBucketIterator_NextNodeFunction)(
+                                     const void                    *table,
+                                     const bslalg::HashTableBucket *bucket,
+                                     bslalg::BidirectionalLink     *node);
+    // This 'typedef' is an alias for the type of a function that returns the
+    // address of the node, of the hash table at the specified 'table'
+    // address, following the specified 'node' in the specified 'bucket' (or
+    // the first node of 'bucket' if 'node' is 0), or 0 if 'node' is the last
+    // node of 'bucket'.
+
                           // =============================
                           // class HashTableBucketIterator
                           // =============================
@@ -196,8 +213,14 @@ class HashTableBucketIterator {
 
   private:
     // DATA
-    bslalg::BidirectionalLink     *d_node_p;
-    const bslalg::HashTableBucket *d_bucket_p;
+    bslalg::BidirectionalLink                *d_node_p;
+    const bslalg::HashTableBucket            *d_bucket_p;
+    HashTableBucketIterator_NextNodeFunction  d_nextNodeFunction;
+    const void                               *d_table_p;
+
+    // FRIENDS
+    template <class OTHER_VALUE_TYPE, class OTHER_DIFFERENCE_TYPE>
+    friend class HashTableBucketIterator;
 
   private:
     // PRIVATE MANIPULATORS
@@ -225,6 +248,20 @@ class HashTableBucketIterator {
         // that this constructor is an implementation detail and is not part of
         // the C++ standard.
 
+    HashTableBucketIterator(
+                       const bslalg::HashTableBucket            *bucket,
+                       HashTableBucketIterator_NextNodeFunction  nextNode,
+                       const void                               *table);
+        // Create an iterator referring to the specified 'bucket' of the hash
+        // table at the specified 'table' address, initially pointing to the
+        // first node of that bucket, or a past-the-end value if the bucket is
+        // empty, whose nodes are obtained in turn from the specified
+        // 'nextNode' function if 'nextNode' is not 0, and are the contiguous
+        // nodes of 'bucket' otherwise.  Note that this constructor allows
+        // iterating over a bucket of a hash table whose incremental rehash is
+        // in progress, and is an implementation detail that is not part of
+        // the C++ standard.
+
     HashTableBucketIterator(const NcIter& original);                // IMPLICIT
         // Create an iterator at the same position as the specified 'original'
         // iterator.  Note that this constructor enables converting from
@@ -346,6 +383,8 @@ HashTableBucketIterator<VALUE_TYPE, DIFFERENCE_TYPE>::
 HashTableBucketIterator()
 : d_node_p()
 , d_bucket_p()
+, d_nextNodeFunction()
+, d_table_p()
 {
 }
 
@@ -355,6 +394,8 @@ HashTableBucketIterator<VALUE_TYPE, DIFFERENCE_TYPE>::
 HashTableBucketIterator(const bslalg::HashTableBucket *bucket)
 : d_node_p(bucket ? bucket->first() : 0)
 , d_bucket_p(bucket)
+, d_nextNodeFunction()
+, d_table_p()
 {
 }
 
@@ -365,15 +406,34 @@ HashTableBucketIterator(bslalg::BidirectionalLink     *node,
                         const bslalg::HashTableBucket *bucket)
 : d_node_p(node)
 , d_bucket_p(bucket)
+, d_nextNodeFunction()
+, d_table_p()
 {
 }
 
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+HashTableBucketIterator<VALUE_TYPE, DIFFERENCE_TYPE>::
+HashTableBucketIterator(
+                      const bslalg::HashTableBucket            *bucket,
+                      HashTableBucketIterator_NextNodeFunction  nextNode,
+                      const void                               *table)
+: d_node_p(nextNode ? nextNode(table, bucket, 0) : bucket->first())
+, d_bucket_p(bucket)
+, d_nextNodeFunction(nextNode)
+, d_table_p(table)
+{
+    BSLS_ASSERT_SAFE(bucket);
+}
+
 template <class VALUE_TYPE, class DIFFERENCE_TYPE>
 inline
 HashTableBucketIterator<VALUE_TYPE, DIFFERENCE_TYPE>::
 HashTableBucketIterator(const NcIter& original)
-: d_node_p(original.node())
-, d_bucket_p(original.bucket())
+: d_node_p(original.d_node_p)
+, d_bucket_p(original.d_bucket_p)
+, d_nextNodeFunction(original.d_nextNodeFunction)
+, d_table_p(original.d_table_p)
 {
 }
 
@@ -387,7 +447,12 @@ advance()
     BSLS_ASSERT_SAFE(this->d_node_p);
     BSLS_ASSERT_SAFE(this->d_bucket_p);
 
-    if (this->d_bucket_p->last() == this->d_node_p) {
+    if (this->d_nextNodeFunction) {
+        this->d_node_p = this->d_nextNodeFunction(this->d_table_p,
+                                                  this->d_bucket_p,
+                                                  this->d_node_p);
+    }
+    else if (this->d_bucket_p->last() == this->d_node_p) {
         this->d_node_p = 0;
     }
     else {
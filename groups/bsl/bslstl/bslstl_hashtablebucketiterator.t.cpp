@@ -81,6 +81,7 @@ using namespace BloombergLP;
 // [ 2] HashTableBucketIterator();
 // [ 2] explicit HashTableBucketIterator(bucket);
 // [ 2] explicit HashTableBucketIterator(node, bucket);
+// [14] HashTableBucketIterator(bucket, nextNode, table);
 // [ 7] HashTableBucketIterator(const NcIter& original);
 // [ 7] HashTableBucketIterator(const HashTableBucketIterator& original)
 // [ 2] ~HashTableBucketIterator() = default;
@@ -102,7 +103,7 @@ using namespace BloombergLP;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [14] USAGE EXAMPLE
+// [15] USAGE EXAMPLE
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [13] TYPE TRAITS
 // [ 3] TEST APPARATUS
@@ -175,6 +176,23 @@ typedef bslalg::BidirectionalLinkListUtil Util;
 
 namespace {
 
+bslalg::BidirectionalLink *nextNodeInList(
+                                     const void                    *table,
+                                     const bslalg::HashTableBucket *bucket,
+                                     bslalg::BidirectionalLink     *node)
+    // Return the address of the node following the specified 'node' in the
+    // list of nodes of a hash table, or the address of the first node of the
+    // specified 'bucket' if 'node' is 0, or 0 if 'node' is the last node of
+    // the list.  The behavior is undefined unless the specified 'table' is
+    // not 0.  Note that this function has the signature of a
+    // 'bslstl::HashTableBucketIterator_NextNodeFunction', and presents, as the
+    // nodes of 'bucket', the nodes of every bucket from 'bucket' onward.
+{
+    BSLS_ASSERT_OPT(table);
+
+    return node ? node->nextLink() : bucket->first();
+}
+
 template <class VALUE>
 class NodePool {
     // This class implements a memory pool that can be used to create and
@@ -359,6 +377,9 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase14();
+        // Test iterating with a next-node function.
+
     static void testCase13();
         // Test type-traits.
 
@@ -387,6 +408,90 @@ class TestDriver {
         // Test primary manipulators.
 };
 
+template <class VALUE>
+void TestDriver<VALUE>::testCase14()
+{
+    // ------------------------------------------------------------------------
+    // ITERATING WITH A NEXT-NODE FUNCTION
+    //   Ensure that an iterator constructed with a next-node function visits
+    //   the nodes returned by that function.
+    //
+    // Concerns:
+    //: 1 An iterator constructed with a next-node function initially refers
+    //:   to the node that the function returns for a null node.
+    //:
+    //: 2 Incrementing the iterator moves it to the node that the function
+    //:   returns for the node to which it refers, which need not be part of
+    //:   the bucket of the iterator, and to the past-the-end value once the
+    //:   function returns 0.
+    //:
+    //: 3 Converting the iterator to a 'const' iterator preserves the
+    //:   next-node function.
+    //:
+    //: 4 An iterator constructed with a null next-node function behaves as
+    //:   one constructed from the bucket alone.
+    //
+    // Plan:
+    //: 1 Create M buckets each containing N nodes.  For each bucket 'M1',
+    //:   construct an iterator from 'M1' with a function visiting every node
+    //:   of the list from the first node of 'M1', and verify that it visits
+    //:   the nodes of 'M1' and of each subsequent bucket in turn before
+    //:   comparing equal to the past-the-end iterator of 'M1'.  (C-1..2)
+    //:
+    //: 2 Repeat P-1 with a 'const' iterator converted from a modifiable one.
+    //:   (C-3)
+    //:
+    //: 3 Construct an iterator from each bucket with a null next-node
+    //:   function, and verify that it visits only the nodes of that bucket.
+    //:   (C-4)
+    //
+    // Testing:
+    //   HashTableBucketIterator(bucket, nextNode, table);
+    // ------------------------------------------------------------------------
+
+    if (verbose) printf("\nITERATING WITH A NEXT-NODE FUNCTION"
+                        "\n===================================\n");
+
+    typedef bslstl::HashTableBucketIterator<const VALUE, ptrdiff_t> CObj;
+
+    bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+    const int M = 5, N = 6;
+    Buckets buckets(M, N, &scratch);
+
+    for (int b1 = 0; b1 < M; ++b1) {
+        Bucket *BUCKET1 = buckets.bucket(b1);
+
+        const Obj END(0, BUCKET1);
+
+        Obj mX(BUCKET1, &nextNodeInList, &buckets);
+        for (int b2 = b1; b2 < M; ++b2) {
+        for (int n2 = 0; n2 < N; ++n2) {
+            ASSERTV(b1, b2, n2, END != mX);
+            ASSERTV(b1, b2, n2, buckets.node(b2, n2) == mX.node());
+            ASSERTV(b1, b2, n2, BUCKET1 == mX.bucket());
+            ++mX;
+        }
+        }
+        ASSERTV(b1, END == mX);
+
+        CObj mY(Obj(BUCKET1, &nextNodeInList, &buckets));
+        for (int b2 = b1; b2 < M; ++b2) {
+        for (int n2 = 0; n2 < N; ++n2) {
+            ASSERTV(b1, b2, n2, buckets.node(b2, n2) == mY.node());
+            ++mY;
+        }
+        }
+        ASSERTV(b1, 0 == mY.node());
+
+        Obj mZ(BUCKET1, 0, &buckets);
+        for (int n2 = 0; n2 < N; ++n2) {
+            ASSERTV(b1, n2, buckets.node(b1, n2) == mZ.node());
+            ++mZ;
+        }
+        ASSERTV(b1, END == mZ);
+    }
+}
+
 template <class VALUE>
 void TestDriver<VALUE>::testCase13()
 {
@@ -1392,7 +1497,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1416,6 +1521,15 @@ int main(int argc, char *argv[])
         usageExample();
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // ITERATING WITH A NEXT-NODE FUNCTION
+        // --------------------------------------------------------------------
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase14,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TYPE TRAITS
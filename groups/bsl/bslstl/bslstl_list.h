@@ -69,6 +69,29 @@ BSLS_IDENT("$Id: $")
 // (template parameter) 'VALUE' type, if respectively, the parameterized types
 // define the 'bslma::UsesBslmaAllocator' trait.
 //
+///Node Reuse
+///----------
+// By default, a list allocates a node from its allocator for every element
+// that is inserted, and returns that node to the allocator as soon as the
+// element is erased.  A list that is used with a high rate of insertions and
+// erasures (e.g., as a FIFO queue) can avoid that per-element allocator round
+// trip by calling 'reserve'.  'reserve(n)' allocates enough nodes up front for
+// the list to hold 'n' elements, and establishes 'n' as a *retention limit*:
+// thereafter, a node freed by an erasure is kept on a free list private to
+// the list (rather than being deallocated) as long as the number of elements
+// plus the number of free nodes does not exceed that limit, and insertions
+// draw nodes from that free list before turning to the allocator.  The free
+// nodes are returned to the allocator when the list is destroyed.
+//
+// Each node on the free list is allocated individually from the list's
+// allocator, so that nodes remain independent of the list that allocated
+// them: 'splice' may freely move elements between lists that use the same
+// allocator, and a spliced element remains valid after the list that
+// originally allocated its node is destroyed.  A list that never calls
+// 'reserve' retains no nodes, and allocates exactly as it would otherwise.
+// The nodes retained by a list can be released by swapping it with an empty
+// list (that uses the same allocator) and destroying the latter.
+//
 ///Operations
 ///----------
 // This section describes the run-time complexity of operations on instances
@@ -160,6 +183,8 @@ BSLS_IDENT("$Id: $")
 //  +----------------------------------------------------+--------------------+
 //  | a.resize(n), a.resize(n, value_type(v))            | O(n)               |
 //  +----------------------------------------------------+--------------------+
+//  | a.reserve(n)                                       | O(n)               |
+//  +----------------------------------------------------+--------------------+
 //  | a.splice(p, b), a.splice(p, b, s1)                 | O(1)               |
 //  +----------------------------------------------------+--------------------+
 //  | a.splice(p, b, s1, s2)                             | O(distance(s1, s2))|
@@ -876,6 +901,16 @@ class list
     // DATA
     NodePtr             d_sentinel;        // node pointer of sentinel element
     AllocAndSizeWrapper d_alloc_and_size;  // node allocator
+    NodePtr             d_freeList;        // head of the list of free nodes,
+                                           // linked through 'd_next'
+
+    typename AllocTraits::size_type
+                        d_numFree;         // number of nodes in 'd_freeList'
+
+    typename AllocTraits::size_type
+                        d_retentionLimit;  // maximum of 'size() + d_numFree'
+                                           // up to which freed nodes are
+                                           // retained (see 'reserve')
 
     // PRIVATE MANIPULATORS
     NodeAlloc& allocator();
@@ -887,13 +922,20 @@ class list
         // holding the size of this list.
 
     NodePtr allocate_node();
-        // Return a node allocated from the container's allocated.  Before
-        // returning, the 'init' function is called to initialize the node's
-        // pointers, but the node's constructor is not called.
+        // Return a node taken from the free list of this list, if it is not
+        // empty, and allocated from the container's allocator otherwise.
+        // Before returning, the node's pointers are initialized, but the
+        // node's constructor is not called.
 
     void free_node(NodePtr np);
-        // Call 'np->destroy()' and deallocate the node pointed to by 'np'.
-        // Note that the node's destructor is not called.
+        // Retain the node pointed to by 'np' on the free list of this list if
+        // 'size_ref() + d_numFree' is less than the retention limit of this
+        // list, and otherwise call 'np->destroy()' and deallocate the node.
+        // Note that the node's destructor is not called.  The behavior is
+        // undefined unless 'np' is not counted by 'size_ref()'.
+
+    void release_free_nodes();
+        // Deallocate all of the nodes on the free list of this list.
 
     void link_nodes(NodePtr prev, NodePtr next);
         // Modify the forward pointer of 'prev' to point to 'next' and the
@@ -906,13 +948,13 @@ class list
         // This function also sets this list's size to zero.
 
     void destroy_all();
-        // Erase all elements, destroy and deallocate the 'd_sentinel' node,
-        // and this list in an invalid but destructible state (i.e., with size
-        // == -1).
+        // Erase all elements, destroy and deallocate the 'd_sentinel' node and
+        // the free nodes, and leave this list in an invalid but destructible
+        // state (i.e., with size == -1).
 
     void quick_swap(list& other);
-        // Quickly swaps 'd_sentinel' and 'size_ref()' of '*this' with 'other'
-        // without checking the allocator.
+        // Quickly swaps 'd_sentinel', 'size_ref()', and the free list of
+        // '*this' with 'other' without checking the allocator.
 
     // PRIVATE ACCESSORS
     const NodeAlloc& allocator() const;
@@ -1029,6 +1071,9 @@ class list
         // unavailable metafunction) instead of 'is_fundamental' in the
         // 'enable_if' expression.
     : d_alloc_and_size(allocator, size_type(-1))
+    , d_freeList()
+    , d_numFree(0)
+    , d_retentionLimit(0)
     {
         // MS Visual Studio 2008 compiler requires that a function using
         // enable_if be in-place inline.
@@ -1178,6 +1223,19 @@ class list
         // end using "copy-insertion" from 'c' until there are a total of 'sz'
         // elements.
 
+    void reserve(size_type numElements);
+        // Allocate nodes, if necessary, so that this list can hold at least
+        // the specified 'numElements' elements without allocating memory, and
+        // retain the nodes of erased elements for reuse by subsequent
+        // insertions as long as the number of elements plus the number of
+        // retained nodes does not exceed 'numElements' (or a larger value
+        // supplied to a previous call to 'reserve').  If an exception is
+        // thrown, the value of this list is unchanged, but some nodes may have
+        // been allocated and retained.  Note that this method does not
+        // invalidate iterators or references, and that retained nodes are
+        // returned to the allocator when this list is destroyed (see {Node
+        // Reuse}).
+
     // element access:
 
     reference front();
@@ -1793,6 +1851,16 @@ inline
 typename list<VALUE, ALLOCATOR>::NodePtr
 list<VALUE, ALLOCATOR>::allocate_node()
 {
+    if (d_freeList) {
+        // Free nodes are kept with initialized pointers.
+
+        NodePtr ret = d_freeList;
+        d_freeList = ret->d_next;
+        --d_numFree;
+        ret->d_next = NodePtr();
+        return ret;                                                   // RETURN
+    }
+
     NodePtr ret = AllocTraits::allocate(allocator(), 1);
     ret->init();
     return ret;
@@ -1802,10 +1870,30 @@ template <class VALUE, class ALLOCATOR>
 inline
 void list<VALUE, ALLOCATOR>::free_node(NodePtr np)
 {
+    if (size_ref() + d_numFree < d_retentionLimit) {
+        np->d_prev = NodePtr();
+        np->d_next = d_freeList;
+        d_freeList = np;
+        ++d_numFree;
+        return;                                                       // RETURN
+    }
+
     np->destroy();
     AllocTraits::deallocate(allocator(), np, 1);
 }
 
+template <class VALUE, class ALLOCATOR>
+void list<VALUE, ALLOCATOR>::release_free_nodes()
+{
+    while (d_freeList) {
+        NodePtr np = d_freeList;
+        d_freeList = np->d_next;
+        np->destroy();
+        AllocTraits::deallocate(allocator(), np, 1);
+    }
+    d_numFree = 0;
+}
+
 template <class VALUE, class ALLOCATOR>
 inline
 void list<VALUE, ALLOCATOR>::link_nodes(NodePtr prev, NodePtr next)
@@ -1827,8 +1915,10 @@ template <class VALUE, class ALLOCATOR>
 inline
 void list<VALUE, ALLOCATOR>::destroy_all()
 {
+    d_retentionLimit = 0;  // Deallocate, rather than retain, erased nodes.
     clear();
     free_node(d_sentinel);
+    release_free_nodes();
     size_ref() = size_type(-1);
 }
 
@@ -1843,6 +1933,18 @@ void list<VALUE, ALLOCATOR>::quick_swap(list& other)
     size_type tmpSize = size_ref();
     size_ref() = other.size_ref();
     other.size_ref() = tmpSize;
+
+    NodePtr tmpFreeList = d_freeList;
+    d_freeList = other.d_freeList;
+    other.d_freeList = tmpFreeList;
+
+    size_type tmpNumFree = d_numFree;
+    d_numFree = other.d_numFree;
+    other.d_numFree = tmpNumFree;
+
+    size_type tmpRetentionLimit = d_retentionLimit;
+    d_retentionLimit = other.d_retentionLimit;
+    other.d_retentionLimit = tmpRetentionLimit;
 }
 
 template <class VALUE, class ALLOCATOR>
@@ -1970,6 +2072,9 @@ list<VALUE, ALLOCATOR>::size_ref() const
 template <class VALUE, class ALLOCATOR>
 list<VALUE, ALLOCATOR>::list(const ALLOCATOR& allocator)
 : d_alloc_and_size(allocator, 0)
+, d_freeList()
+, d_numFree(0)
+, d_retentionLimit(0)
 {
     create_sentinel();
 }
@@ -1977,6 +2082,9 @@ list<VALUE, ALLOCATOR>::list(const ALLOCATOR& allocator)
 template <class VALUE, class ALLOCATOR>
 list<VALUE, ALLOCATOR>::list(size_type n)
 : d_alloc_and_size(ALLOCATOR(), size_type(-1))
+, d_freeList()
+, d_numFree(0)
+, d_retentionLimit(0)
 {
     // '*this' is in an invalid but destructible state (size == -1).
 
@@ -1998,6 +2106,9 @@ list<VALUE, ALLOCATOR>::list(size_type n,
                              const VALUE& value,
                              const ALLOCATOR& allocator)
 : d_alloc_and_size(allocator, size_type(-1))
+, d_freeList()
+, d_numFree(0)
+, d_retentionLimit(0)
 {
     // '*this' is in an invalid but destructible state (size == -1).
 
@@ -2012,6 +2123,9 @@ list<VALUE, ALLOCATOR>::list(const list& original)
 : d_alloc_and_size(
       AllocTraits::select_on_container_copy_construction(original.allocator()),
       size_type(-1))
+, d_freeList()
+, d_numFree(0)
+, d_retentionLimit(0)
 {
     // '*this' is in an invalid but destructible state (size == -1).
 
@@ -2027,6 +2141,9 @@ list<VALUE, ALLOCATOR>::list(const list& original)
 template <class VALUE, class ALLOCATOR>
 list<VALUE, ALLOCATOR>::list(const list& original, const ALLOCATOR& allocator)
 : d_alloc_and_size(allocator, size_type(-1))
+, d_freeList()
+, d_numFree(0)
+, d_retentionLimit(0)
 {
     // '*this' is in an invalid but destructible state (size == -1).
 
@@ -2043,6 +2160,9 @@ list<VALUE, ALLOCATOR>::list(const list& original, const ALLOCATOR& allocator)
 template <class VALUE, class ALLOCATOR>
 list<VALUE, ALLOCATOR>::list(list&& original)
 : d_alloc_and_size(original.allocator(), 0)
+, d_freeList()
+, d_numFree(0)
+, d_retentionLimit(0)
 {
     // Allocator should be copied, not moved, to ensure identical allocators
     // between this and 'original', otherwise 'swap' will be undefined.
@@ -2054,6 +2174,9 @@ list<VALUE, ALLOCATOR>::list(list&& original)
 template <class VALUE, class ALLOCATOR>
 list<VALUE, ALLOCATOR>::list(list&& original, const ALLOCATOR& allocator)
 : d_alloc_and_size(allocator, size_type(-1))
+, d_freeList()
+, d_numFree(0)
+, d_retentionLimit(0)
 {
     // '*this' is in an invalid but destructible state (size == -1).
 
@@ -2241,6 +2364,22 @@ void list<VALUE, ALLOCATOR>::resize(size_type sz, const VALUE& c)
     }
 }
 
+template <class VALUE, class ALLOCATOR>
+void list<VALUE, ALLOCATOR>::reserve(size_type numElements)
+{
+    while (size_ref() + d_numFree < numElements) {
+        NodePtr np = AllocTraits::allocate(allocator(), 1);
+        np->init();
+        np->d_next = d_freeList;
+        d_freeList = np;
+        ++d_numFree;
+    }
+
+    if (d_retentionLimit < numElements) {
+        d_retentionLimit = numElements;
+    }
+}
+
 // element access:
 template <class VALUE, class ALLOCATOR>
 inline
@@ -2614,8 +2753,8 @@ list<VALUE, ALLOCATOR>::erase(const_iterator position)
     link_nodes(p->d_prev, p->d_next);
     AllocTraits::destroy(allocator(),
                          BloombergLP::bsls::Util::addressOf(p->d_value));
-    free_node(p);
     --size_ref();
+    free_node(p);
     return ret;
 }
 
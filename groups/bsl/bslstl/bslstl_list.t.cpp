@@ -109,6 +109,7 @@ using namespace bsl;
 // [16] reverse_iterator rend();
 // [14] void resize(size_type n);
 // [14] void resize(size_type n, const T& val);
+// [29] void reserve(size_type n);
 // [15] reference front();
 // [15] reference back();
 // [17] void push_front(const T&);
@@ -159,7 +160,7 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
-// [29] USAGE EXAMPLE
+// [30] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(list<T,A> *object, const char *spec, int vF = 1);
@@ -1788,6 +1789,9 @@ struct TestDriver {
     static void testSplice();
         // Test 'splice'
 
+    static void testReserve();
+        // Test 'reserve' and the reuse of nodes
+
     static void testReverse();
         // Test 'reverse'
 
@@ -3475,6 +3479,241 @@ void TestDriver<TYPE,ALLOC>::testSplice()
     } // end for (op)
 }
 
+template <class TYPE, class ALLOC>
+void TestDriver<TYPE,ALLOC>::testReserve()
+{
+    // --------------------------------------------------------------------
+    // TESTING RESERVE
+    //
+    // Concerns:
+    //   1. 'reserve(n)' allocates exactly the nodes needed for the list to
+    //      hold 'n' elements, and does not change the value of the list.
+    //   2. After 'reserve(n)', inserting elements up to a total of 'n'
+    //      allocates no nodes, and erasing elements deallocates no nodes.
+    //   3. Nodes are retained only up to the largest value supplied to
+    //      'reserve'; nodes beyond that limit are deallocated on erasure.
+    //   4. Retained nodes are released when the list is destroyed.
+    //   5. A node spliced from a list having retained nodes into another
+    //      list using the same allocator remains valid after the source list
+    //      is destroyed, and is retained by the target list when erased.
+    //   6. Retained nodes are exchanged by 'swap'.
+    //   7. 'reserve' is exception neutral, and leaves the value of the list
+    //      unchanged if an exception is thrown.
+    //
+    // Test plan:
+    //   For lists of several initial lengths, call 'reserve' with a range of
+    //   values, and verify the number of blocks allocated and in use by the
+    //   test allocator, taking into account the blocks allocated by the
+    //   elements themselves (if they use the list's allocator).  Then
+    //   repeatedly fill and empty the list, verifying that no nodes are
+    //   allocated or deallocated.  Exceed the reserved capacity and verify
+    //   that the excess nodes are deallocated.  Splice elements between two
+    //   lists having reserved capacity, destroy the source list, and verify
+    //   the integrity of the target list.  Finally, exercise 'reserve' in
+    //   the presence of injected exceptions.
+    //
+    // Testing:
+    //   void reserve(size_type n);
+    // --------------------------------------------------------------------
+
+    const TYPE         *values     = 0;
+    const TYPE *const&  VALUES     = values;
+    const int           NUM_VALUES = getValues(&values);
+
+    bslma::TestAllocator testAllocator;
+    ALLOC Z(&testAllocator);
+
+    const char *const SPECS[] = { "", "A", "AB", "ABC", "ABCDE" };
+    const int NUM_SPECS = sizeof(SPECS) / sizeof(SPECS[0]);
+
+    if (verbose) printf("\nTesting 'reserve' and node reuse\n");
+
+    for (int i = 0; i < NUM_SPECS; ++i) {
+        const char *const SPEC   = SPECS[i];
+        const int         LENGTH = static_cast<int>(strlen(SPEC));
+
+        for (int n = 0; n < 8; ++n) {
+            const int RESERVE = LENGTH + n;
+
+            Obj mX(Z);  const Obj& X = gg(&mX, SPEC);
+            const Obj EXP(X);
+
+            const int BB = testAllocator.numBlocksTotal();
+            const int B  = testAllocator.numBlocksInUse();
+
+            mX.reserve(RESERVE);
+
+            LOOP2_ASSERT(SPEC, n, EXP == X);
+            LOOP2_ASSERT(SPEC, n, checkIntegrity(X, LENGTH));
+            LOOP2_ASSERT(SPEC, n, BB + n == testAllocator.numBlocksTotal());
+            LOOP2_ASSERT(SPEC, n, B + n == testAllocator.numBlocksInUse());
+
+            // Reserving less than has already been reserved has no effect.
+
+            mX.reserve(LENGTH);
+            mX.reserve(0);
+
+            LOOP2_ASSERT(SPEC, n, BB + n == testAllocator.numBlocksTotal());
+
+            // Fill and empty the list several times; only the elements
+            // themselves may allocate.
+
+            for (int cycle = 0; cycle < 3; ++cycle) {
+                const int CBB = testAllocator.numBlocksTotal();
+
+                for (int j = LENGTH; j < RESERVE; ++j) {
+                    mX.push_back(VALUES[j % NUM_VALUES]);
+                }
+                LOOP3_ASSERT(SPEC, n, cycle, checkIntegrity(X, RESERVE));
+                LOOP3_ASSERT(SPEC, n, cycle,
+                             CBB + n * SCOPED_ALLOC ==
+                                              testAllocator.numBlocksTotal());
+
+                while (X.size() > static_cast<size_t>(LENGTH)) {
+                    mX.pop_back();
+                }
+                LOOP3_ASSERT(SPEC, n, cycle, EXP == X);
+                LOOP3_ASSERT(SPEC, n, cycle,
+                             B + n == testAllocator.numBlocksInUse());
+            }
+
+            // Exceed the reserved capacity by two elements.
+
+            for (int j = LENGTH; j < RESERVE + 2; ++j) {
+                mX.push_front(VALUES[j % NUM_VALUES]);
+            }
+            LOOP2_ASSERT(SPEC, n, checkIntegrity(X, RESERVE + 2));
+            LOOP2_ASSERT(SPEC, n,
+                         B + n + deltaBlocks(RESERVE + 2 - LENGTH) -
+                                                      (RESERVE - LENGTH) ==
+                                              testAllocator.numBlocksInUse());
+
+            // Only 'RESERVE' nodes are retained when the list is cleared.
+
+            mX.clear();
+            LOOP2_ASSERT(SPEC, n, checkIntegrity(X, 0));
+            LOOP2_ASSERT(SPEC, n,
+                         B - deltaBlocks(LENGTH) + RESERVE ==
+                                              testAllocator.numBlocksInUse());
+        }
+
+        // Retained nodes are released on destruction.
+
+        LOOP_ASSERT(SPEC, 0 == testAllocator.numBlocksInUse());
+    }
+
+    if (verbose) printf("\nTesting 'splice' of reused nodes\n");
+
+    for (int i = 0; i < NUM_SPECS; ++i) {
+        const char *const SPEC   = SPECS[i];
+        const int         LENGTH = static_cast<int>(strlen(SPEC));
+
+        for (int destroySourceFirst = 0; destroySourceFirst < 2;
+                                                       ++destroySourceFirst) {
+            Obj *mX = new Obj(Z);
+            Obj *mY = new Obj(Z);
+
+            mX->reserve(LENGTH + 2);
+            mY->reserve(LENGTH + 2);
+            gg(mX, SPEC);
+            gg(mY, "DE");
+
+            // Move the elements of 'Y' into 'X', and move an element back and
+            // forth, so that 'X' holds nodes allocated by both lists.
+
+            mX->splice(mX->end(), *mY);
+            LOOP_ASSERT(SPEC, checkIntegrity(*mX, LENGTH + 2));
+            LOOP_ASSERT(SPEC, checkIntegrity(*mY, 0));
+
+            mY->splice(mY->begin(), *mX, mX->begin());
+            mX->splice(mX->begin(), *mY, mY->begin());
+            LOOP_ASSERT(SPEC, checkIntegrity(*mX, LENGTH + 2));
+            LOOP_ASSERT(SPEC, checkIntegrity(*mY, 0));
+
+            if (destroySourceFirst) {
+                Obj *mT = mX;
+                mX = mY;
+                mY = mT;
+            }
+
+            // Move all of the elements into 'Y', then destroy 'X'.
+
+            mY->splice(mY->end(), *mX);
+            delete mX;
+
+            LOOP_ASSERT(SPEC, checkIntegrity(*mY, LENGTH + 2));
+            LOOP_ASSERT(SPEC, VALUES[4] == mY->back());
+
+            // Empty and refill 'Y', reusing the nodes spliced into it.
+
+            mY->clear();
+            LOOP_ASSERT(SPEC, checkIntegrity(*mY, 0));
+
+            for (int j = 0; j < LENGTH + 2; ++j) {
+                mY->push_back(VALUES[j % NUM_VALUES]);
+            }
+            LOOP_ASSERT(SPEC, checkIntegrity(*mY, LENGTH + 2));
+
+            delete mY;
+
+            LOOP_ASSERT(SPEC, 0 == testAllocator.numBlocksInUse());
+        }
+    }
+
+    if (verbose) printf("\nTesting 'swap' of reused nodes\n");
+    {
+        Obj mX(Z);  const Obj& X = mX;
+        Obj mY(Z);  const Obj& Y = mY;
+
+        mX.reserve(4);
+
+        const int BB = testAllocator.numBlocksTotal();
+
+        mX.swap(mY);
+        for (int j = 0; j < 4; ++j) {
+            mY.push_back(VALUES[j % NUM_VALUES]);
+        }
+        ASSERT(checkIntegrity(X, 0));
+        ASSERT(checkIntegrity(Y, 4));
+        ASSERT(BB + deltaBlocks(4) - 4 == testAllocator.numBlocksTotal());
+
+        mX.push_back(VALUES[0]);
+        ASSERT(BB + deltaBlocks(5) - 4 == testAllocator.numBlocksTotal());
+    }
+    ASSERT(0 == testAllocator.numBlocksInUse());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (verbose) printf("\nTesting 'reserve' with injected exceptions\n");
+
+    for (int i = 0; i < NUM_SPECS; ++i) {
+        const char *const SPEC   = SPECS[i];
+        const int         LENGTH = static_cast<int>(strlen(SPEC));
+
+        Obj mX(Z);  const Obj& X = gg(&mX, SPEC);
+        const Obj EXP(X);
+
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(testAllocator) {
+            ExceptionGuard<Obj> guard(&mX, X, L_);
+
+            mX.reserve(LENGTH + 5);
+
+            guard.release();
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+        LOOP_ASSERT(SPEC, EXP == X);
+
+        const int BB = testAllocator.numBlocksTotal();
+        for (int j = 0; j < 5; ++j) {
+            mX.push_back(VALUES[j % NUM_VALUES]);
+        }
+        LOOP_ASSERT(SPEC, checkIntegrity(X, LENGTH + 5));
+        LOOP_ASSERT(SPEC, BB + deltaBlocks(5) - 5 ==
+                                              testAllocator.numBlocksTotal());
+    }
+    ASSERT(0 == testAllocator.numBlocksInUse());
+#endif // BDE_BUILD_TARGET_EXC
+}
+
 template <class TYPE, class ALLOC>
 void TestDriver<TYPE,ALLOC>::testReverse()
 {
@@ -8680,7 +8919,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 29: {
+      case 30: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -8720,6 +8959,31 @@ int main(int argc, char *argv[])
         remove("star_data1.txt");
         remove("star_data2.txt");
 
+      } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // TESTING RESERVE
+        //
+        // Concerns and plan:
+        //   See testReserve for a list of specific concerns and a test plan.
+        //
+        // Testing:
+        //   void reserve(size_type n);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTesting RESERVE"
+                            "\n===============\n");
+
+        if (verbose) printf("\n... with 'char'.\n");
+        TestDriver<char>::testReserve();
+
+        if (verbose) printf("\n... with 'TestType'.\n");
+        TestDriver<T>::testReserve();
+
+        if (verbose) printf("\n... with 'TestTypeOtherAlloc' and"
+                            " 'OtherAlloc'.\n");
+        TestDriver<TOA,OATOA>::testReserve();
+
       } break;
       case 28: {
         // --------------------------------------------------------------------
@@ -199,6 +199,17 @@ BSLS_IDENT("$Id: $")
 //  +----------------------------------------------------+--------------------+
 //..
 //
+///Heterogeneous Lookup
+///--------------------
+// If the 'COMPARATOR' of a 'map' is *transparent* (i.e., declares a nested
+// type named 'is_transparent'; see 'bslmf_istransparent'), then 'find',
+// 'count', 'lower_bound', 'upper_bound', and 'equal_range' also accept a key
+// of any type that 'COMPARATOR' can compare with 'KEY' (in either order), and
+// search for it without first converting it to a temporary 'KEY' object.  For
+// example, a 'map' of 'bsl::string' keys ordered by 'bslstl::StringRefLess'
+// can be searched for a string literal or a 'bslstl::StringRef' without
+// allocating memory.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -457,6 +468,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRANSPARENT
+#include <bslmf_istransparent.h>
+#endif
+
 #ifndef INCLUDED_FUNCTIONAL
 #include <functional>
 #define INCLUDED_FUNCTIONAL
@@ -724,7 +739,11 @@ class map {
         // 'VALUE'}).
 
     ~map();
-        // Destroy this object.
+        // Destroy this object.  If 'value_type' is trivially destructible
+        // and the mechanism of the allocator of this object is a
+        // 'bslma::ManagedAllocator', the nodes of this object are neither
+        // visited nor deallocated, their memory being reclaimed when the
+        // managed allocator is released (see 'bslma_managedallocator').
 
     // MANIPULATORS
     map& operator=(const map& rhs);
@@ -887,6 +906,79 @@ class map {
         // returned iterators will have the same value.  Note that since a map
         // maintains unique keys, the range will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                                     iterator,
+                                                     COMPARATOR>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this map having a key equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.  This method participates in overload resolution only if
+        // 'COMPARATOR' is transparent (see {Heterogeneous Lookup}).
+    {
+        return iterator(BloombergLP::bslalg::RbTreeUtil::find(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                                     iterator,
+                                                     COMPARATOR>::type
+    lower_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in this map whose key is not ordered before the
+        // specified 'key', and the past-the-end iterator if no such object
+        // exists.  This method participates in overload resolution only if
+        // 'COMPARATOR' is transparent (see {Heterogeneous Lookup}).
+    {
+        return iterator(BloombergLP::bslalg::RbTreeUtil::lowerBound(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                                     iterator,
+                                                     COMPARATOR>::type
+    upper_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in this map whose key is ordered after the
+        // specified 'key', and the past-the-end iterator if no such object
+        // exists.  This method participates in overload resolution only if
+        // 'COMPARATOR' is transparent (see {Heterogeneous Lookup}).
+    {
+        return iterator(BloombergLP::bslalg::RbTreeUtil::upperBound(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<
+                                                LOOKUP_KEY,
+                                                bsl::pair<iterator, iterator>,
+                                                COMPARATOR>::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this map having a key equivalent
+        // to the specified 'key', where the first iterator is positioned at
+        // the start of the sequence, and the second is positioned one past the
+        // end of the sequence.  This method participates in overload
+        // resolution only if 'COMPARATOR' is transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        iterator startIt = lower_bound(key);
+        iterator endIt   = startIt;
+        if (endIt != end() && !comparator()(key, *endIt.node())) {
+            ++endIt;
+        }
+        return bsl::pair<iterator, iterator>(startIt, endIt);
+    }
+
     // ACCESSORS
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
@@ -1008,6 +1100,93 @@ class map {
         // value.  Note that since a map maintains unique keys, the range will
         // contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                                     const_iterator,
+                                                     COMPARATOR>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this map having a key equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.  This method participates in overload
+        // resolution only if 'COMPARATOR' is transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        return const_iterator(BloombergLP::bslalg::RbTreeUtil::find(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                                     size_type,
+                                                     COMPARATOR>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects within this map having a
+        // key equivalent to the specified 'key'.  This method participates in
+        // overload resolution only if 'COMPARATOR' is transparent (see
+        // {Heterogeneous Lookup}).
+    {
+        return (find(key) != end()) ? 1 : 0;
+    }
+
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                                     const_iterator,
+                                                     COMPARATOR>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this map whose key is not ordered before the
+        // specified 'key', and the past-the-end iterator if no such object
+        // exists.  This method participates in overload resolution only if
+        // 'COMPARATOR' is transparent (see {Heterogeneous Lookup}).
+    {
+        return const_iterator(BloombergLP::bslalg::RbTreeUtil::lowerBound(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                                     const_iterator,
+                                                     COMPARATOR>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this map whose key is ordered after the
+        // specified 'key', and the past-the-end iterator if no such object
+        // exists.  This method participates in overload resolution only if
+        // 'COMPARATOR' is transparent (see {Heterogeneous Lookup}).
+    {
+        return const_iterator(BloombergLP::bslalg::RbTreeUtil::upperBound(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<
+                                    LOOKUP_KEY,
+                                    bsl::pair<const_iterator, const_iterator>,
+                                    COMPARATOR>::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this map having a key equivalent
+        // to the specified 'key', where the first iterator is positioned at
+        // the start of the sequence, and the second is positioned one past the
+        // end of the sequence.  This method participates in overload
+        // resolution only if 'COMPARATOR' is transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        const_iterator startIt = lower_bound(key);
+        const_iterator endIt   = startIt;
+        if (endIt != end() && !comparator()(key, *endIt.node())) {
+            ++endIt;
+        }
+        return bsl::pair<const_iterator, const_iterator>(startIt, endIt);
+    }
+
     // NOT IMPLEMENTED
         // The following methods are defined by the C++11 standard, but they
         // are not implemented as they require some level of C++11 compiler
@@ -1308,7 +1487,9 @@ template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 map<KEY, VALUE, COMPARATOR, ALLOCATOR>::~map()
 {
-    clear();
+    if (!nodeFactory().winkOut()) {
+        clear();
+    }
 }
 
 
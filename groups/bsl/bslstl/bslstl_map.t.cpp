@@ -9,6 +9,7 @@
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_mallocfreeallocator.h>
+#include <bslma_multipoolallocator.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
 #include <bslma_usesbslmaallocator.h>
@@ -21,7 +22,10 @@
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
 #include <bsls_objectbuffer.h>
+#include <bsls_types.h>
 
+#include <bsltf_countedkey.h>
+#include <bsltf_managedtestallocator.h>
 #include <bsltf_stdtestallocator.h>
 #include <bsltf_templatetestfacility.h>
 #include <bsltf_testvaluesarray.h>
@@ -151,6 +155,15 @@ using namespace bsl;
 // [13] const_iterator upper_bound(const key_type& key) const;
 // [13] bsl::pair<iterator, iterator> equal_range(const key_type& key);
 // [13] bsl::pair<const_iter, const_iter> equal_range(const key_type&) const;
+// [27] iterator find(const LOOKUP_KEY& key);
+// [27] const_iterator find(const LOOKUP_KEY& key) const;
+// [27] size_type count(const LOOKUP_KEY& key) const;
+// [27] iterator lower_bound(const LOOKUP_KEY& key);
+// [27] const_iterator lower_bound(const LOOKUP_KEY& key) const;
+// [27] iterator upper_bound(const LOOKUP_KEY& key);
+// [27] const_iterator upper_bound(const LOOKUP_KEY& key) const;
+// [27] bsl::pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+// [27] bsl::pair<const_iter, const_iter> equal_range(const LOOKUP_KEY&) c;
 //
 // [ 6] bool operator==(const map<K, C, A>& lhs, const map<K, C, A>& rhs);
 // [19] bool operator< (const map<K, C, A>& lhs, const map<K, C, A>& rhs);
@@ -164,7 +177,8 @@ using namespace bsl;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [28] CONCERN: Destruction winks out with a managed allocator.
+// [29] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(map<T,A> *object, const char *spec, int verbose = 1);
@@ -6561,7 +6575,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 27: {
+      case 29: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6604,6 +6618,253 @@ int main(int argc, char *argv[])
             ASSERT(0 < objectAllocator.numBytesInUse());
         }
       } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // TESTING WINK-OUT ON DESTRUCTION
+        //
+        // Concerns:
+        //: 1 A map whose elements are trivially destructible, and whose
+        //:   allocator is a 'bslma::ManagedAllocator', does not return its
+        //:   nodes to the allocator on destruction.
+        //:
+        //: 2 The memory of such a map is reclaimed by releasing the allocator.
+        //:
+        //: 3 A map whose elements are not trivially destructible destroys
+        //:   each of its elements on destruction, even if its allocator is a
+        //:   'bslma::ManagedAllocator'.
+        //:
+        //: 4 A map whose allocator is not a 'bslma::ManagedAllocator' returns
+        //:   all of its memory on destruction.
+        //:
+        //: 5 Repeatedly creating and destroying a map of 'int' values whose
+        //:   allocator is a 'bslma::MultipoolAllocator', which recycles the
+        //:   memory returned to it and is not a managed allocator, does not
+        //:   increase the memory that the multipool obtains from its upstream
+        //:   allocator.
+        //
+        // Plan:
+        //: 1 Create a map of 'int' values with a 'ManagedTestAllocator', add
+        //:   and erase some elements, destroy the map, and verify that the
+        //:   allocator was not called to deallocate.  Release the allocator
+        //:   and verify that all memory is returned upstream.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 with a map of 'bsltf::AllocTestType' values, and
+        //:   verify that each remaining element deallocates its memory on
+        //:   destruction of the map.  (C-3)
+        //:
+        //: 3 Repeat P-1 with a map whose allocator is a test allocator, and
+        //:   verify that all memory is returned on destruction.  (C-4)
+        //:
+        //: 4 Create and destroy a map of 'int' values using a
+        //:   'bslma::MultipoolAllocator' many times, and verify that the
+        //:   memory in use from the upstream test allocator after the first
+        //:   iteration does not change.  (C-5)
+        //
+        // Testing:
+        //   CONCERN: Destruction winks out with a managed allocator.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING WINK-OUT ON DESTRUCTION"
+                            "\n===============================\n");
+
+        const int NUM_VALUES = 100;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tTrivially destructible elements.\n");
+        {
+            typedef bsl::map<int, int> Obj;
+
+            bslma::TestAllocator        oa("object", veryVeryVeryVerbose);
+            bsltf::ManagedTestAllocator ma(&oa);
+
+            int numDeallocations;
+            {
+                Obj mX(&ma);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX[i] = i;
+                }
+                for (int i = 0; i < NUM_VALUES; i += 2) {
+                    mX.erase(i);
+                }
+                numDeallocations = ma.numDeallocations();
+            }
+            ASSERTV(numDeallocations,   ma.numDeallocations(),
+                    numDeallocations == ma.numDeallocations());
+            ASSERTV(oa.numBlocksInUse(), 0 < oa.numBlocksInUse());
+
+            ma.release();
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tElements that allocate memory.\n");
+        {
+            typedef bsl::map<int, bsltf::AllocTestType> Obj;
+
+            bslma::TestAllocator        oa("object", veryVeryVeryVerbose);
+            bsltf::ManagedTestAllocator ma(&oa);
+
+            int numDeallocations;
+            {
+                Obj mX(&ma);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX[i] = bsltf::AllocTestType(i);
+                }
+                for (int i = 0; i < NUM_VALUES; i += 2) {
+                    mX.erase(i);
+                }
+                numDeallocations = ma.numDeallocations();
+            }
+            ASSERTV(numDeallocations,   ma.numDeallocations(),
+                    numDeallocations + NUM_VALUES / 2
+                                                  <= ma.numDeallocations());
+        }
+
+        if (verbose) printf("\tAllocator that is not managed.\n");
+        {
+            typedef bsl::map<int, int> Obj;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                Obj mX(&oa);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX[i] = i;
+                }
+                ASSERTV(oa.numBlocksInUse(), 0 < oa.numBlocksInUse());
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tMultipool allocator.\n");
+        {
+            typedef bsl::map<int, int> Obj;
+
+            const int NUM_ITERATIONS = 100;
+
+            bslma::TestAllocator      oa("object", veryVeryVeryVerbose);
+            bslma::MultipoolAllocator mpa(&oa);
+
+            bsls::Types::Int64 numBytes = 0;
+            for (int ti = 0; ti < NUM_ITERATIONS; ++ti) {
+                {
+                    Obj mX(&mpa);
+                    for (int i = 0; i < NUM_VALUES; ++i) {
+                        mX[i] = i;
+                    }
+                }
+                if (0 == ti) {
+                    numBytes = oa.numBytesInUse();
+                }
+                ASSERTV(ti, oa.numBytesInUse(),
+                        numBytes == oa.numBytesInUse());
+            }
+        }
+      } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSPARENT LOOKUP
+        //
+        // Concerns:
+        //: 1 If 'COMPARATOR' is transparent, 'find', 'count', 'lower_bound',
+        //:   'upper_bound', and 'equal_range' accept a key of a type other
+        //:   than 'key_type', without converting it to 'key_type'.
+        //:
+        //: 2 Each such lookup returns the same result as the same method
+        //:   called with a 'key_type' object having an equivalent value,
+        //:   whether or not the key is present.
+        //:
+        //: 3 Both the modifiable and the non-modifiable overloads are
+        //:   available.
+        //:
+        //: 4 If 'COMPARATOR' is not transparent, a lookup using a key of
+        //:   another type still converts the key to 'key_type'.
+        //
+        // Plan:
+        //: 1 Create a map, using a transparent comparator, of keys of a
+        //:   type, 'CountedKey', that counts the objects of that type created
+        //:   and is implicitly convertible from 'int'.  Insert the even
+        //:   numbers in a range.
+        //:
+        //: 2 For each 'int' in a larger range, call each lookup method with
+        //:   the 'int', and with an equivalent 'CountedKey', and verify that
+        //:   the results are the same, and that no 'CountedKey' is created by
+        //:   the calls taking an 'int'.  (C-1..3)
+        //:
+        //: 3 Create a map using a comparator that is not transparent, and
+        //:   verify that a lookup using an 'int' creates a 'CountedKey'.
+        //:   (C-4)
+        //
+        // Testing:
+        //   iterator find(const LOOKUP_KEY& key);
+        //   iterator lower_bound(const LOOKUP_KEY& key);
+        //   iterator upper_bound(const LOOKUP_KEY& key);
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+        //   const_iterator find(const LOOKUP_KEY& key) const;
+        //   size_type count(const LOOKUP_KEY& key) const;
+        //   const_iterator lower_bound(const LOOKUP_KEY& key) const;
+        //   const_iterator upper_bound(const LOOKUP_KEY& key) const;
+        //   pair<c_iter, c_iter> equal_range(const LOOKUP_KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING TRANSPARENT LOOKUP"
+                            "\n==========================\n");
+
+        typedef bsltf::CountedKey           Key;
+        typedef bsltf::CountedKeyLess       Less;
+        typedef bsltf::CountedKeyOpaqueLess OpaqueLess;
+
+        typedef bsl::map<Key, int, Less>       Map;
+        typedef bsl::map<Key, int, OpaqueLess> OpaqueMap;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Map mX(&oa);  const Map& X = mX;
+        for (int i = 0; i < 20; i += 2) {
+            mX.insert(bsl::pair<const Key, int>(Key(i), i));
+        }
+
+        for (int ti = -1; ti <= 20; ++ti) {
+            const int KEY = ti;
+            const Key COUNTED_KEY(ti);
+
+            if (veryVerbose) { T_ P(KEY) }
+
+            const Map::iterator  EXP_FIND = mX.find(COUNTED_KEY);
+            const Map::iterator  EXP_LB   = mX.lower_bound(COUNTED_KEY);
+            const Map::iterator  EXP_UB   = mX.upper_bound(COUNTED_KEY);
+            const Map::size_type EXP_CNT  = X.count(COUNTED_KEY);
+
+            const int NUM_CREATED = Key::numCreated();
+
+            ASSERTV(KEY, EXP_FIND == mX.find(KEY));
+            ASSERTV(KEY, EXP_LB   == mX.lower_bound(KEY));
+            ASSERTV(KEY, EXP_UB   == mX.upper_bound(KEY));
+            ASSERTV(KEY, EXP_LB   == mX.equal_range(KEY).first);
+            ASSERTV(KEY, EXP_UB   == mX.equal_range(KEY).second);
+
+            ASSERTV(KEY, EXP_FIND == X.find(KEY));
+            ASSERTV(KEY, EXP_CNT  == X.count(KEY));
+            ASSERTV(KEY, EXP_LB   == X.lower_bound(KEY));
+            ASSERTV(KEY, EXP_UB   == X.upper_bound(KEY));
+            ASSERTV(KEY, EXP_LB   == X.equal_range(KEY).first);
+            ASSERTV(KEY, EXP_UB   == X.equal_range(KEY).second);
+
+            ASSERTV(KEY, (0 == KEY % 2 && 0 <= KEY && KEY < 20) == EXP_CNT);
+            ASSERTV(KEY, NUM_CREATED == Key::numCreated());
+        }
+
+        if (verbose) printf("Testing a comparator that is not transparent.\n");
+        {
+            OpaqueMap mY(&oa);  const OpaqueMap& Y = mY;
+            mY.insert(bsl::pair<const Key, int>(Key(2), 2));
+
+            const int NUM_CREATED = Key::numCreated();
+
+            ASSERT(Y.end() != Y.find(2));
+            ASSERT(NUM_CREATED < Key::numCreated());
+        }
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // TESTING STANDARD INTERFACE COVERAGE
@@ -208,6 +208,24 @@ class MapComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
         // otherwise.  The behavior is undefined unless 'rhs' can be safely
         // cast to 'NodeType'.
 
+    template <class LOOKUP_KEY>
+    bool operator()(const LOOKUP_KEY&         lhs,
+                    const bslalg::RbTreeNode& rhs);
+    template <class LOOKUP_KEY>
+    bool operator()(const bslalg::RbTreeNode& lhs,
+                    const LOOKUP_KEY&         rhs);
+        // Return 'true' if the specified 'lhs' is less than (ordered before,
+        // according to the comparator held by this object) the specified
+        // 'rhs', where the node argument is represented by 'value().first'
+        // after being cast to 'NodeType', and 'false' otherwise.  The
+        // behavior is undefined unless the node argument can be safely cast
+        // to 'NodeType', and the comparator held by this object can compare
+        // an object of the (template parameter) type 'LOOKUP_KEY' with a
+        // 'KEY' object (in either order) without converting it to 'KEY'.  Note
+        // that these overloads support the heterogeneous lookup of keys of
+        // types other than 'KEY' by containers whose 'COMPARATOR' is
+        // transparent (see 'bslmf_istransparent').
+
     void swap(MapComparator& other);
         // Efficiently exchange the value of this object with the value of the
         // specified 'other' object.  This method provides the no-throw
@@ -230,6 +248,21 @@ class MapComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
         // otherwise.  The behavior is undefined unless 'rhs' can be safely
         // cast to 'NodeType'.
 
+    template <class LOOKUP_KEY>
+    bool operator()(const LOOKUP_KEY&         lhs,
+                    const bslalg::RbTreeNode& rhs) const;
+    template <class LOOKUP_KEY>
+    bool operator()(const bslalg::RbTreeNode& lhs,
+                    const LOOKUP_KEY&         rhs) const;
+        // Return 'true' if the specified 'lhs' is less than (ordered before,
+        // according to the comparator held by this object) the specified
+        // 'rhs', where the node argument is represented by 'value().first'
+        // after being cast to 'NodeType', and 'false' otherwise.  The
+        // behavior is undefined unless the node argument can be safely cast
+        // to 'NodeType', and the comparator held by this object can compare
+        // an object of the (template parameter) type 'LOOKUP_KEY' with a
+        // 'KEY' object (in either order) without converting it to 'KEY'.
+
     COMPARATOR& keyComparator();
         // Return a reference providing modifiable access to the function
         // pointer or functor to which this comparator delegates comparison
@@ -274,6 +307,28 @@ MapComparator(const COMPARATOR& valueComparator)
 }
 
 // MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
+                                     const LOOKUP_KEY&         lhs,
+                                     const bslalg::RbTreeNode& rhs)
+{
+    return keyComparator()(lhs,
+                           static_cast<const NodeType&>(rhs).value().first);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
+                                     const bslalg::RbTreeNode& lhs,
+                                     const LOOKUP_KEY&         rhs)
+{
+    return keyComparator()(static_cast<const NodeType&>(lhs).value().first,
+                           rhs);
+}
+
 template <class KEY, class VALUE, class COMPARATOR>
 inline
 void MapComparator<KEY, VALUE, COMPARATOR>::swap(
@@ -326,6 +381,28 @@ bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
                            rhs);
 }
 
+template <class KEY, class VALUE, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
+                                     const LOOKUP_KEY&         lhs,
+                                     const bslalg::RbTreeNode& rhs) const
+{
+    return keyComparator()(lhs,
+                           static_cast<const NodeType&>(rhs).value().first);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
+                                     const bslalg::RbTreeNode& lhs,
+                                     const LOOKUP_KEY&         rhs) const
+{
+    return keyComparator()(static_cast<const NodeType&>(lhs).value().first,
+                           rhs);
+}
+
 template <class KEY, class VALUE, class COMPARATOR>
 inline
 COMPARATOR&
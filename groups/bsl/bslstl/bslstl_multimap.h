@@ -793,7 +793,11 @@ class multimap {
         // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
 
     ~multimap();
-        // Destroy this object;
+        // Destroy this object.  If 'value_type' is trivially destructible
+        // and the mechanism of the allocator of this object is a
+        // 'bslma::ManagedAllocator', the nodes of this object are neither
+        // visited nor deallocated, their memory being reclaimed when the
+        // managed allocator is released (see 'bslma_managedallocator').
 
     // MANIPULATORS
     multimap& operator=(const multimap& rhs);
@@ -1332,7 +1336,9 @@ template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::~multimap()
 {
-    clear();
+    if (!nodeFactory().winkOut()) {
+        clear();
+    }
 }
 
 // MANIPULATORS
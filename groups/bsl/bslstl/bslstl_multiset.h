@@ -674,7 +674,11 @@ class multiset {
         // (see {Requirements on 'KEY'}).
 
     ~multiset();
-        // Destroy this object.
+        // Destroy this object.  If 'value_type' is trivially destructible
+        // and the mechanism of the allocator of this object is a
+        // 'bslma::ManagedAllocator', the nodes of this object are neither
+        // visited nor deallocated, their memory being reclaimed when the
+        // managed allocator is released (see 'bslma_managedallocator').
 
     // MANIPULATORS
     multiset<KEY, COMPARATOR, ALLOCATOR>&
@@ -1194,7 +1198,9 @@ template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
 multiset<KEY, COMPARATOR, ALLOCATOR>::~multiset()
 {
-    clear();
+    if (!nodeFactory().winkOut()) {
+        clear();
+    }
 }
 
 
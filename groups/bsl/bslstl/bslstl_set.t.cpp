@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <functional>
 
+#include <bsltf_countedkey.h>
 #include <bsltf_templatetestfacility.h>
 #include <bsltf_testvaluesarray.h>
 #include <bsltf_stdtestallocator.h>
@@ -137,6 +138,15 @@ using namespace bsl;
 // [13] const_iterator upper_bound(const key_type& key) const;
 // [13] bsl::pair<iterator, iterator> equal_range(const key_type& key);
 // [13] bsl::pair<const_iter, const_iter> equal_range(const key_type&) const;
+// [26] iterator find(const LOOKUP_KEY& key);
+// [26] const_iterator find(const LOOKUP_KEY& key) const;
+// [26] size_type count(const LOOKUP_KEY& key) const;
+// [26] iterator lower_bound(const LOOKUP_KEY& key);
+// [26] const_iterator lower_bound(const LOOKUP_KEY& key) const;
+// [26] iterator upper_bound(const LOOKUP_KEY& key);
+// [26] const_iterator upper_bound(const LOOKUP_KEY& key) const;
+// [26] bsl::pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+// [26] bsl::pair<const_iter, const_iter> equal_range(const LOOKUP_KEY&) c;
 //
 // [ 6] bool operator==(const set<K, C, A>& lhs, const set<K, C, A>& rhs);
 // [17] bool operator< (const set<K, C, A>& lhs, const set<K, C, A>& rhs);
@@ -150,7 +160,7 @@ using namespace bsl;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [25] USAGE EXAMPLE
+// [27] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(set<T,A> *object, const char *spec, int verbose = 1);
@@ -6325,7 +6335,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&defaultAllocator);
 
     switch (test) { case 0:
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6376,6 +6386,110 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSPARENT LOOKUP
+        //
+        // Concerns:
+        //: 1 If 'COMPARATOR' is transparent, 'find', 'count', 'lower_bound',
+        //:   'upper_bound', and 'equal_range' accept a key of a type other
+        //:   than 'key_type', without converting it to 'key_type'.
+        //:
+        //: 2 Each such lookup returns the same result as the same method
+        //:   called with a 'key_type' object having an equivalent value,
+        //:   whether or not the key is present.
+        //:
+        //: 3 Both the modifiable and the non-modifiable overloads are
+        //:   available.
+        //:
+        //: 4 If 'COMPARATOR' is not transparent, a lookup using a key of
+        //:   another type still converts the key to 'key_type'.
+        //
+        // Plan:
+        //: 1 Create a set, using a transparent comparator, of keys of a
+        //:   type, 'CountedKey', that counts the objects of that type created
+        //:   and is implicitly convertible from 'int'.  Insert the even
+        //:   numbers in a range.
+        //:
+        //: 2 For each 'int' in a larger range, call each lookup method with
+        //:   the 'int', and with an equivalent 'CountedKey', and verify that
+        //:   the results are the same, and that no 'CountedKey' is created by
+        //:   the calls taking an 'int'.  (C-1..3)
+        //:
+        //: 3 Create a set using a comparator that is not transparent, and
+        //:   verify that a lookup using an 'int' creates a 'CountedKey'.
+        //:   (C-4)
+        //
+        // Testing:
+        //   iterator find(const LOOKUP_KEY& key);
+        //   iterator lower_bound(const LOOKUP_KEY& key);
+        //   iterator upper_bound(const LOOKUP_KEY& key);
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+        //   const_iterator find(const LOOKUP_KEY& key) const;
+        //   size_type count(const LOOKUP_KEY& key) const;
+        //   const_iterator lower_bound(const LOOKUP_KEY& key) const;
+        //   const_iterator upper_bound(const LOOKUP_KEY& key) const;
+        //   pair<c_iter, c_iter> equal_range(const LOOKUP_KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING TRANSPARENT LOOKUP"
+                            "\n==========================\n");
+
+        typedef bsltf::CountedKey           Key;
+        typedef bsltf::CountedKeyLess       Less;
+        typedef bsltf::CountedKeyOpaqueLess OpaqueLess;
+
+        typedef bsl::set<Key, Less>       Set;
+        typedef bsl::set<Key, OpaqueLess> OpaqueSet;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Set mX(&oa);  const Set& X = mX;
+        for (int i = 0; i < 20; i += 2) {
+            mX.insert(Key(i));
+        }
+
+        for (int ti = -1; ti <= 20; ++ti) {
+            const int KEY = ti;
+            const Key COUNTED_KEY(ti);
+
+            if (veryVerbose) { T_ P(KEY) }
+
+            const Set::iterator  EXP_FIND = mX.find(COUNTED_KEY);
+            const Set::iterator  EXP_LB   = mX.lower_bound(COUNTED_KEY);
+            const Set::iterator  EXP_UB   = mX.upper_bound(COUNTED_KEY);
+            const Set::size_type EXP_CNT  = X.count(COUNTED_KEY);
+
+            const int NUM_CREATED = Key::numCreated();
+
+            ASSERTV(KEY, EXP_FIND == mX.find(KEY));
+            ASSERTV(KEY, EXP_LB   == mX.lower_bound(KEY));
+            ASSERTV(KEY, EXP_UB   == mX.upper_bound(KEY));
+            ASSERTV(KEY, EXP_LB   == mX.equal_range(KEY).first);
+            ASSERTV(KEY, EXP_UB   == mX.equal_range(KEY).second);
+
+            ASSERTV(KEY, EXP_FIND == X.find(KEY));
+            ASSERTV(KEY, EXP_CNT  == X.count(KEY));
+            ASSERTV(KEY, EXP_LB   == X.lower_bound(KEY));
+            ASSERTV(KEY, EXP_UB   == X.upper_bound(KEY));
+            ASSERTV(KEY, EXP_LB   == X.equal_range(KEY).first);
+            ASSERTV(KEY, EXP_UB   == X.equal_range(KEY).second);
+
+            ASSERTV(KEY, (0 == KEY % 2 && 0 <= KEY && KEY < 20) == EXP_CNT);
+            ASSERTV(KEY, NUM_CREATED == Key::numCreated());
+        }
+
+        if (verbose) printf("Testing a comparator that is not transparent.\n");
+        {
+            OpaqueSet mY(&oa);  const OpaqueSet& Y = mY;
+            mY.insert(Key(2));
+
+            const int NUM_CREATED = Key::numCreated();
+
+            ASSERT(Y.end() != Y.find(2));
+            ASSERT(NUM_CREATED < Key::numCreated());
+        }
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // TESTING STANDARD INTERFACE COVERAGE
@@ -42,6 +42,15 @@ BSLS_IDENT("$Id: $")
 // each time a chunk is allocated up to an implementation defined maximum
 // number of blocks.
 //
+///Winking Out
+///-----------
+// The 'winkOut' method empties a pool *without* returning its chunks to the
+// underlying allocator.  A container that is being destroyed may wink out its
+// pool when the memory is reclaimed in some other way, i.e., when the
+// underlying allocator is a 'bslma::ManagedAllocator' (see
+// 'bslma_managedallocator'), whose 'release' method reclaims all of the
+// memory it has dispensed.
+//
 ///Comparison with 'bdema_Pool'
 ///----------------------------
 // There are a few differences between 'bslstl::SimplePool' and 'bdema_Pool':
@@ -286,16 +295,44 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
                                             // ensure proper alignment
     };
 
+    union Chunk;
+
+    struct ChunkHeader {
+        // This 'struct' describes the information held in the header of each
+        // chunk.
+
+        Chunk                                      *d_next_p;
+                                             // pointer to next Chunk
+
+        typename Types::AllocatorTraits::size_type  d_numUnits;
+                                             // size of this chunk, in units
+                                             // of 'MaxAlignedType' (or of
+                                             // 'Chunk', if 'Chunk' is
+                                             // over-aligned), supplied when
+                                             // the chunk is deallocated
+    };
+
     union Chunk {
         // This 'union' prepends to the beginning of each managed block of
         // allocated memory, implementing a singly-linked list of managed
         // chunks, and thereby enabling constant-time additions to the list of
         // chunks.
 
-        Chunk *d_next_p;  // pointer to next Chunk
+        ChunkHeader d_header;  // link to next chunk and size of this chunk
 
         typename bsls::AlignmentFromType<Block>::Type d_alignment;
-                          // ensure each block is correctly aligned
+                               // ensure each block is correctly aligned
+    };
+
+    typedef typename bsl::allocator_traits<ALLOCATOR>::template
+                                  rebind_traits<Chunk> ChunkAllocatorTraits;
+        // Alias for the allocator traits rebound to allocate 'Chunk' objects,
+        // used to obtain the chunks if 'Chunk' has an alignment requirement
+        // greater than that of 'MaxAlignedType'.
+
+    enum {
+        k_IS_OVER_ALIGNED = (int)bsls::AlignmentFromType<Chunk>::VALUE
+                          > (int)bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
     };
 
   public:
@@ -376,6 +413,13 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
     void release();
         // Relinquish all memory currently allocated via this pool object.
 
+    void winkOut();
+        // Relinquish all memory currently allocated via this pool object
+        // *without* returning it to the underlying allocator.  The behavior
+        // is undefined unless that memory is subsequently reclaimed by other
+        // means (e.g., by releasing a 'bslma::ManagedAllocator' that supplied
+        // it).
+
     void swap(SimplePool& other);
         // Efficiently exchange the memory blocks of this object with those of
         // the specified 'other' object.  This method provides the no-throw
@@ -399,7 +443,9 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
         // allocator traits for the node-type.  Note that this operation
         // returns a base-class ('AllocatorType') reference to this object.
 
-
+    bool hasMemory() const;
+        // Return 'true' if this pool holds any memory obtained from the
+        // underlying allocator, and 'false' otherwise.
 };
 
 // ============================================================================
@@ -415,18 +461,32 @@ SimplePool<VALUE, ALLOCATOR>::allocateChunk(size_type size)
     // of 'MaxAlignedType' needed to contain those bytes.
 
     size_type numBytes = static_cast<size_type>(sizeof(Chunk)) + size;
-    size_type numMaxAlignedType =
-                       (numBytes + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
-                     / bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+    size_type numUnits;
+    Chunk    *chunkPtr;
+
+    if (k_IS_OVER_ALIGNED) {
+        // Obtain the chunk in units of 'Chunk', so that the allocator supplies
+        // memory having the extended alignment of 'Chunk' (and 'VALUE').
 
-    Chunk *chunkPtr = reinterpret_cast<Chunk *>(
-                    AllocatorTraits::allocate(allocator(), numMaxAlignedType));
+        typename ChunkAllocatorTraits::allocator_type chunkAllocator(
+                                                                  allocator());
+
+        numUnits = (numBytes + sizeof(Chunk) - 1) / sizeof(Chunk);
+        chunkPtr = ChunkAllocatorTraits::allocate(chunkAllocator, numUnits);
+    }
+    else {
+        numUnits = (numBytes + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+                 / bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+        chunkPtr = reinterpret_cast<Chunk *>(
+                             AllocatorTraits::allocate(allocator(), numUnits));
+    }
 
     BSLS_ASSERT_SAFE(0 ==
              reinterpret_cast<bsls::Types::UintPtr>(chunkPtr) % sizeof(Chunk));
 
-    chunkPtr->d_next_p = d_chunkList_p;
-    d_chunkList_p      = chunkPtr;
+    chunkPtr->d_header.d_next_p   = d_chunkList_p;
+    chunkPtr->d_header.d_numUnits = numUnits;
+    d_chunkList_p                 = chunkPtr;
 
     return reinterpret_cast<Block *>(chunkPtr + 1);
 }
@@ -523,6 +583,14 @@ void SimplePool<VALUE, ALLOCATOR>::quickSwapExchangeAllocators(
     std::swap(d_chunkList_p, other.d_chunkList_p);
 }
 
+template <class VALUE, class ALLOCATOR>
+inline
+void SimplePool<VALUE, ALLOCATOR>::winkOut()
+{
+    d_chunkList_p = 0;
+    d_freeList_p  = 0;
+}
+
 template <class VALUE, class ALLOCATOR>
 void SimplePool<VALUE, ALLOCATOR>::reserve(size_type numBlocks)
 {
@@ -548,15 +616,37 @@ SimplePool<VALUE, ALLOCATOR>::allocator() const
     return *this;
 }
 
+template <class VALUE, class ALLOCATOR>
+inline
+bool SimplePool<VALUE, ALLOCATOR>::hasMemory() const
+{
+    return 0 != d_chunkList_p;
+}
+
 template <class VALUE, class ALLOCATOR>
 void SimplePool<VALUE, ALLOCATOR>::release()
 {
     while (d_chunkList_p) {
-        typename AllocatorTraits::value_type *lastChunk =
+        Chunk           *lastChunk = d_chunkList_p;
+        const size_type  numUnits  = lastChunk->d_header.d_numUnits;
+
+        d_chunkList_p = lastChunk->d_header.d_next_p;
+
+        if (k_IS_OVER_ALIGNED) {
+            typename ChunkAllocatorTraits::allocator_type chunkAllocator(
+                                                                  allocator());
+
+            ChunkAllocatorTraits::deallocate(chunkAllocator,
+                                             lastChunk,
+                                             numUnits);
+        }
+        else {
+            AllocatorTraits::deallocate(
+                      allocator(),
                       reinterpret_cast<typename AllocatorTraits::value_type *>(
-                                                                d_chunkList_p);
-        d_chunkList_p   = d_chunkList_p->d_next_p;
-        AllocatorTraits::deallocate(allocator(), lastChunk, 1);
+                                                                    lastChunk),
+                      numUnits);
+        }
     }
     d_freeList_p = 0;
 }
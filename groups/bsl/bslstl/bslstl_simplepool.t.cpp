@@ -13,7 +13,9 @@
 #include <bsls_asserttest.h>
 #include <bsls_alignmentutil.h>
 #include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
 
+#include <bsltf_managedtestallocator.h>
 #include <bsltf_templatetestfacility.h>
 #include <bsltf_stdtestallocator.h>
 
@@ -49,12 +51,14 @@ using namespace bslstl;
 // [ 6] void reserve(std::size_t numBlocks);
 // [ 7] void release();
 // [ 8] void swap(SimplePool<VALUE, ALLOCATOR>& other);
+// [10] void winkOut();
 //
 // ACCESSORS
 // [ 4] const AllocatorType& allocator() const;
+// [10] bool hasMemory() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [10] USAGE EXAMPLE
+// [11] USAGE EXAMPLE
 // [ 9] CONCERN: Standard allocator can be used
 // [ 3] TEST APPARATUS
 
@@ -139,6 +143,24 @@ struct TestType3 {
     char   x1[5];
 };
 
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+struct __attribute__((aligned(64))) TestType4 {
+    // An over-aligned type, requiring more than the maximal alignment.
+
+    char   x1[5];
+};
+#define U_OVER_ALIGNED_TYPE , TestType4
+#elif defined(BSLS_PLATFORM_CMP_MSVC)
+struct __declspec(align(64)) TestType4 {
+    // An over-aligned type, requiring more than the maximal alignment.
+
+    char   x1[5];
+};
+#define U_OVER_ALIGNED_TYPE , TestType4
+#else
+#define U_OVER_ALIGNED_TYPE
+#endif
+
 // Define all the types that is used for each test case.
 
 #define TEST_TYPES  int, \
@@ -146,7 +168,8 @@ struct TestType3 {
                     bsls::AlignmentUtil::MaxAlignedType, \
                     TestType1, \
                     TestType2, \
-                    TestType3
+                    TestType3 \
+                    U_OVER_ALIGNED_TYPE
 
 //=============================================================================
 //                               TEST FACILITIES
@@ -258,9 +281,12 @@ class TestDriver {
 
   public:
     // TEST CASES
-    static void testCase10();
+    static void testCase11();
         // Test usage example.
 
+    static void testCase10();
+        // Test 'winkOut' and 'hasMemory'.
+
     static void testCase9();
         // Test alignment concern.
 
@@ -575,6 +601,119 @@ void TestDriver<VALUE>::testCase8()
     }
 }
 
+template<class VALUE>
+void TestDriver<VALUE>::testCase10()
+{
+    // ------------------------------------------------------------------------
+    // MANIPULATOR 'winkOut' AND ACCESSOR 'hasMemory'
+    //
+    // Concerns:
+    //: 1 'hasMemory' returns 'true' if, and only if, the pool holds a chunk,
+    //:   whether its blocks are in use or free.
+    //:
+    //: 2 'winkOut' returns no memory to the underlying allocator, and
+    //:   allocates no memory.
+    //:
+    //: 3 No free memory blocks is available after a 'winkOut', i.e.,
+    //:   subsequent 'allocate' will need to allocate memory from the
+    //:   underlying allocator, and 'hasMemory' returns 'false'.
+    //:
+    //: 4 The destructor of a pool that has winked out returns only the
+    //:   chunks allocated after 'winkOut'.
+    //
+    // Plan:
+    //: 1 Using a managed allocator that counts deallocations, and obtains
+    //:   its memory from a test allocator, invoke 'allocate' and
+    //:   'deallocate' various number of times, and verify the result of
+    //:   'hasMemory'.  (C-1)
+    //:
+    //: 2 Call 'winkOut' and verify that no memory is allocated or
+    //:   deallocated, and that 'hasMemory' returns 'false'.  (C-2)
+    //:
+    //: 3 Call 'allocate' and verify that memory is allocated from the
+    //:   underlying allocator.  (C-3)
+    //:
+    //: 4 Destroy the pool and verify that exactly one chunk is deallocated,
+    //:   then release the managed allocator and verify that all memory is
+    //:   returned to the test allocator.  (C-4)
+    //
+    // Testing:
+    //   void winkOut();
+    //   bool hasMemory() const;
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    struct {
+        int d_line;
+        int d_numAlloc;
+        int d_numDealloc;
+    } DATA[] = {
+
+    //LINE  ALLOC  DEALLOC
+    //----  -----  -------
+
+    { L_,       0,       0 },
+    { L_,       1,       0 },
+    { L_,       1,       1 },
+    { L_,       2,       0 },
+    { L_,       2,       2 },
+    { L_,       3,       1 },
+    { L_,       4,       4 },
+    { L_,      33,       0 },
+    { L_,      33,      17 }
+
+    };
+    int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int LINE     = DATA[ti].d_line;
+        const int ALLOCS   = DATA[ti].d_numAlloc;
+        const int DEALLOCS = DATA[ti].d_numDealloc;
+
+        bslma::TestAllocator        oa("object", veryVeryVeryVerbose);
+        bsltf::ManagedTestAllocator ma(&oa);
+
+        {
+            Stack usedX;
+            Stack freeX;
+
+            Obj mX(&ma);  const Obj& X = mX;
+
+            ASSERTV(LINE, false == X.hasMemory());
+
+            init(&mX, &usedX, &freeX, ALLOCS, DEALLOCS);
+
+            ASSERTV(LINE, (0 < ALLOCS) == X.hasMemory());
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.winkOut();
+
+            ASSERTV(LINE, oam.isTotalSame());
+            ASSERTV(LINE, oam.isInUseSame());
+            ASSERTV(LINE, 0     == ma.numDeallocations());
+            ASSERTV(LINE, false == X.hasMemory());
+
+            mX.allocate();
+
+            ASSERTV(LINE, oam.isTotalUp());
+            ASSERTV(LINE, true == X.hasMemory());
+        }
+
+        ASSERTV(LINE, ma.numDeallocations(), 1 == ma.numDeallocations());
+
+        ma.release();
+
+        ASSERTV(LINE, 0 == oa.numBlocksInUse());
+    }
+
+    // Verify no memory is allocated from the default allocator.
+
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+}
+
 template<class VALUE>
 void TestDriver<VALUE>::testCase7()
 {
@@ -1266,7 +1405,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1312,6 +1451,9 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 10: {
+          RUN_EACH_TYPE(TestDriver, testCase10, TEST_TYPES);
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // ALIGNMENT TEST
@@ -593,6 +593,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_stringrefdata.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_HASHUTIL
+#include <bslalg_hashutil.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
 #include <bslalg_scalarprimitives.h>
 #endif
@@ -757,6 +761,71 @@ String_Traits<native_std::char_traits<char> >::find(const char  *s,
 
 #endif
 
+                        // ============================
+                        // class String_StreambufAccess
+                        // ============================
+
+template <class CHAR_TYPE, class CHAR_TRAITS>
+class String_StreambufAccess
+    : private native_std::basic_streambuf<CHAR_TYPE, CHAR_TRAITS> {
+    // This component-private 'class' provides a namespace for functions that
+    // give 'getline' direct access to the get area (i.e., the input buffer)
+    // of an arbitrary 'basic_streambuf', so that 'getline' can scan and
+    // extract whole runs of characters rather than one character at a time.
+    // The get-area functions of 'basic_streambuf' are 'protected'; they are
+    // reached here through pointers to members named via this derived class,
+    // which is the standard-conforming means for a derived class to access
+    // those members of a base-class object.  This class is never
+    // instantiated.
+
+    // PRIVATE TYPES
+    typedef native_std::basic_streambuf<CHAR_TYPE, CHAR_TRAITS> Streambuf;
+
+  public:
+    // CLASS METHODS
+    static CHAR_TYPE *getAreaBegin(Streambuf *streambuf);
+        // Return the address of the next character available in the get area
+        // of the specified 'streambuf' (i.e., 'streambuf->gptr()').
+
+    static CHAR_TYPE *getAreaEnd(Streambuf *streambuf);
+        // Return the address one past the last character available in the
+        // get area of the specified 'streambuf' (i.e., 'streambuf->egptr()').
+
+    static void advance(Streambuf *streambuf, int numChars);
+        // Extract the specified 'numChars' characters from the get area of
+        // the specified 'streambuf' (i.e., call 'streambuf->gbump(numChars)').
+        // The behavior is undefined unless
+        // '0 <= numChars <= getAreaEnd(streambuf) - getAreaBegin(streambuf)'.
+};
+
+// CLASS METHODS
+template <class CHAR_TYPE, class CHAR_TRAITS>
+inline
+CHAR_TYPE *
+String_StreambufAccess<CHAR_TYPE, CHAR_TRAITS>::getAreaBegin(
+                                                         Streambuf *streambuf)
+{
+    return (streambuf->*&String_StreambufAccess::gptr)();
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS>
+inline
+CHAR_TYPE *
+String_StreambufAccess<CHAR_TYPE, CHAR_TRAITS>::getAreaEnd(
+                                                         Streambuf *streambuf)
+{
+    return (streambuf->*&String_StreambufAccess::egptr)();
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS>
+inline
+void String_StreambufAccess<CHAR_TYPE, CHAR_TRAITS>::advance(
+                                                  Streambuf *streambuf,
+                                                  int        numChars)
+{
+    (streambuf->*&String_StreambufAccess::gbump)(numChars);
+}
+
                         // ================
                         // class String_Imp
                         // ================
@@ -2299,7 +2368,10 @@ getline(std::basic_istream<CHAR_TYPE, CHAR_TRAITS>&     is,
     // into 'str' and 'is.eof()' becomes true.  If 'is.good()' is false on
     // entry, then do nothing, otherwise if no characters are extracted (e.g.,
     // because because the stream is at eof), 'str' will become empty and
-    // 'is.fail()' will become true.
+    // 'is.fail()' will become true.  Note that the characters available in
+    // the get area of 'is.rdbuf()' are scanned for 'delim' and appended to
+    // 'str' in bulk, so that the cost per character is low for a buffered
+    // stream.
 
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 std::basic_istream<CHAR_TYPE, CHAR_TRAITS>&
@@ -2319,7 +2391,11 @@ getline(std::basic_istream<CHAR_TYPE, CHAR_TRAITS>&     is,
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 std::size_t
 hashBasicString(const basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>& str);
-    // Return a hash value for the specified 'str'.
+    // Return a hash value for the specified 'str'.  Note that the value is
+    // computed by 'bslalg::HashUtil::computeBytesHash' over the characters of
+    // 'str', and is therefore the same as the hash value of any other
+    // string-like object (e.g., 'bslstl::StringRef') having the same
+    // characters.
 
 std::size_t hashBasicString(const string& str);
     // Return a hash value for the specified 'str'.
@@ -5379,28 +5455,68 @@ getline(std::basic_istream<CHAR_TYPE, CHAR_TRAITS>&    is,
         basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>& str,
         CHAR_TYPE                                      delim)
 {
-    typedef std::basic_istream<CHAR_TYPE, CHAR_TRAITS> Istrm;
+    typedef std::basic_istream<CHAR_TYPE, CHAR_TRAITS>     Istrm;
+    typedef String_StreambufAccess<CHAR_TYPE, CHAR_TRAITS> Access;
+
+    enum { k_MAX_RUN = 0x40000000 };  // longest run extracted by one 'gbump'
+
     size_t nread = 0;
     typename Istrm::sentry sentry(is, true);
     if (sentry) {
         std::basic_streambuf<CHAR_TYPE, CHAR_TRAITS>* buf = is.rdbuf();
         str.clear();
 
-        while (nread < str.max_size()) {
-            int c1 = buf->sbumpc();
-            if (CHAR_TRAITS::eq_int_type(c1, CHAR_TRAITS::eof())) {
-                is.setstate(Istrm::eofbit);
-                break;
-            }
+        const size_t maxSize = str.max_size();
+
+        while (nread < maxSize) {
+            const CHAR_TYPE *first = Access::getAreaBegin(buf);
+            const CHAR_TYPE *last  = Access::getAreaEnd(buf);
+
+            if (first == last) {
+                // The get area is empty (or the stream buffer does not use
+                // one).  Extract a single character, which refills the get
+                // area of a buffered stream buffer.
+
+                typename CHAR_TRAITS::int_type c1 = buf->sbumpc();
+                if (CHAR_TRAITS::eq_int_type(c1, CHAR_TRAITS::eof())) {
+                    is.setstate(Istrm::eofbit);
+                    break;
+                }
 
-            ++nread;
-            CHAR_TYPE c = CHAR_TRAITS::to_char_type(c1);
-            if (!CHAR_TRAITS::eq(c, delim)) {
+                ++nread;
+                CHAR_TYPE c = CHAR_TRAITS::to_char_type(c1);
+                if (CHAR_TRAITS::eq(c, delim)) {
+                    break;  // character is extracted but not appended
+                }
                 str.push_back(c);
+                continue;
             }
-            else {
-                break;  // character is extracted but not appended
+
+            // Scan the characters available in the get area for 'delim', and
+            // append the run of characters preceding it in a single step.
+
+            size_t avail = last - first;
+            if (avail > maxSize - nread) {
+                avail = maxSize - nread;
+            }
+            if (avail > k_MAX_RUN) {
+                avail = k_MAX_RUN;
             }
+
+            const CHAR_TYPE *found = BSLSTL_CHAR_TRAITS::find(first,
+                                                              avail,
+                                                              delim);
+            if (found) {
+                const size_t runLength = found - first;
+                str.append(first, runLength);
+                Access::advance(buf, static_cast<int>(runLength + 1));
+                nread += runLength + 1;
+                break;  // delimiter is extracted but not appended
+            }
+
+            str.append(first, avail);
+            Access::advance(buf, static_cast<int>(avail));
+            nread += avail;
         }
     }
     if (nread == 0 || nread >= str.max_size()) {
@@ -5424,18 +5540,9 @@ template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 std::size_t
 hashBasicString(const basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>& str)
 {
-    unsigned long hashValue = 0;
-    typedef typename basic_string<CHAR_TYPE,
-                              CHAR_TRAITS, ALLOCATOR>::const_pointer const_ptr;
-
-    std::size_t  len  = str.size();
-    const_ptr    data = str.data();
-
-    for (std::size_t i = 0; i < len; ++i) {
-        hashValue = 5 * hashValue + data[i];
-    }
-
-    return std::size_t(hashValue);
+    return BloombergLP::bslalg::HashUtil::computeBytesHash(
+                                             str.data(),
+                                             str.size() * sizeof(CHAR_TYPE));
 }
 
 }  // close namespace bsl
@@ -245,6 +245,10 @@ using namespace std;
 //                                      const string& str);
 // [ 5] basic_istream<C,CT>& operator>>(basic_istream<C,CT>& stream,
 //                                      const string& str);
+// [29] basic_istream<C,CT>& getline(basic_istream<C,CT>& stream,
+//                                   string& str, C delim);
+// [29] basic_istream<C,CT>& getline(basic_istream<C,CT>& stream,
+//                                   string& str);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
@@ -778,6 +782,117 @@ inline
 bool isNativeString(const std::basic_string<TYPE,TRAITS,ALLOC>&)
     { return true; }
 
+                         // ======================
+                         // class ChunkedStreambuf
+                         // ======================
+
+class ChunkedStreambuf : public std::streambuf {
+    // This class provides a stream buffer that supplies the characters of a
+    // string through a get area holding at most a specified number of
+    // characters at a time or, if that number is 0, without using a get area
+    // at all (i.e., one character at a time through 'underflow' and 'uflow').
+    // It is used to test 'getline' across refills of the get area, and with
+    // unbuffered stream buffers.
+
+    // DATA
+    std::string d_data;       // characters to supply
+    std::size_t d_position;   // index of the next character to supply
+    std::size_t d_chunkSize;  // maximum size of the get area (0 for none)
+
+  private:
+    // NOT IMPLEMENTED
+    ChunkedStreambuf(const ChunkedStreambuf&);
+    ChunkedStreambuf& operator=(const ChunkedStreambuf&);
+
+  protected:
+    // PROTECTED MANIPULATORS
+    virtual int_type underflow()
+        // Return the next character without extracting it, making up to
+        // 'd_chunkSize' characters available in the get area if 'd_chunkSize'
+        // is not 0, and return 'eof' if no characters remain.
+    {
+        if (gptr() < egptr()) {
+            return traits_type::to_int_type(*gptr());                 // RETURN
+        }
+        if (d_position == d_data.size()) {
+            return traits_type::eof();                                // RETURN
+        }
+        if (0 == d_chunkSize) {
+            return traits_type::to_int_type(d_data[d_position]);      // RETURN
+        }
+
+        std::size_t length = d_data.size() - d_position;
+        if (length > d_chunkSize) {
+            length = d_chunkSize;
+        }
+        char *begin = &d_data[d_position];
+        setg(begin, begin, begin + length);
+        d_position += length;
+        return traits_type::to_int_type(*gptr());
+    }
+
+    virtual int_type uflow()
+        // Extract and return the next character, and return 'eof' if no
+        // characters remain.
+    {
+        if (0 != d_chunkSize) {
+            return std::streambuf::uflow();                           // RETURN
+        }
+        if (d_position == d_data.size()) {
+            return traits_type::eof();                                // RETURN
+        }
+        return traits_type::to_int_type(d_data[d_position++]);
+    }
+
+  public:
+    // CREATORS
+    ChunkedStreambuf(const std::string& data, std::size_t chunkSize)
+        // Create a stream buffer that supplies the specified 'data' through
+        // a get area of at most the specified 'chunkSize' characters, or
+        // without a get area if 'chunkSize' is 0.
+    : d_data(data)
+    , d_position(0)
+    , d_chunkSize(chunkSize)
+    {
+    }
+};
+
+template <class STRING>
+std::istream& getlineByCharacter(std::istream& is, STRING& str, char delim)
+    // Load into the specified 'str' the characters extracted from the
+    // specified 'is' up to (and excluding) the specified 'delim', extracting
+    // one character at a time with 'sbumpc', and return 'is'.  This function
+    // reproduces the implementation that 'bsl::getline' used before scanning
+    // the get area in bulk, and serves as the baseline of the 'getline'
+    // performance test.
+{
+    std::size_t nread = 0;
+    std::istream::sentry sentry(is, true);
+    if (sentry) {
+        std::streambuf *buf = is.rdbuf();
+        str.clear();
+
+        while (true) {
+            std::streambuf::int_type c1 = buf->sbumpc();
+            if (std::char_traits<char>::eq_int_type(
+                                       c1, std::char_traits<char>::eof())) {
+                is.setstate(std::ios_base::eofbit);
+                break;
+            }
+            ++nread;
+            char c = std::char_traits<char>::to_char_type(c1);
+            if (c == delim) {
+                break;
+            }
+            str.push_back(c);
+        }
+    }
+    if (0 == nread) {
+        is.setstate(std::ios_base::failbit);
+    }
+    return is;
+}
+
 //=============================================================================
 //                       TEST DRIVER TEMPLATE
 //-----------------------------------------------------------------------------
@@ -13642,7 +13757,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 29: {
+      case 30: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -13853,6 +13968,156 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // TESTING 'getline'
+        //
+        // Concerns:
+        //: 1 'getline' extracts the characters up to and including the
+        //:   delimiter, and loads into the string those preceding it.
+        //:
+        //: 2 'getline' sets 'eofbit' if the input ends before the delimiter,
+        //:   and 'failbit' if no characters are extracted, exactly as
+        //:   'std::getline' does.
+        //:
+        //: 3 'getline' produces the same results whether the characters are
+        //:   found in the get area of the stream buffer, span several refills
+        //:   of the get area, or are supplied by a stream buffer that has no
+        //:   get area.
+        //:
+        //: 4 The previous contents of the string are replaced.
+        //:
+        //: 5 'getline' works for character types other than 'char'.
+        //
+        // Plan:
+        //: 1 For a table of inputs, and for two delimiters, read the input
+        //:   line by line using 'bsl::getline' and 'std::getline' in lock
+        //:   step, and verify that the strings and the stream states agree
+        //:   after each call.  Supply the input to 'bsl::getline' from an
+        //:   'std::istringstream', and from a 'ChunkedStreambuf' using get
+        //:   areas of a range of sizes (including none).  (C-1..4)
+        //:
+        //: 2 Read lines of 'wchar_t' from an 'std::wistringstream'.  (C-5)
+        //
+        // Testing:
+        //   basic_istream<C,CT>& getline(basic_istream<C,CT>&, string&, C);
+        //   basic_istream<C,CT>& getline(basic_istream<C,CT>&, string&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTesting 'getline'"
+                            "\n=================\n");
+
+        static const struct {
+            int         d_line;   // source line number
+            const char *d_input;  // input characters
+        } DATA[] = {
+            //LINE  INPUT
+            //----  -----------------------
+            { L_,   ""                      },
+            { L_,   "\n"                    },
+            { L_,   "\n\n"                  },
+            { L_,   "a"                     },
+            { L_,   "a\n"                   },
+            { L_,   "\na"                   },
+            { L_,   "abc\ndef"              },
+            { L_,   "abc\ndef\n"            },
+            { L_,   "a\n\nbb\n\nccc\n"      },
+            { L_,   "abcdefghijklmnopqrst\nuvwxyz\n0123456789abcdefghij" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const std::size_t CHUNKS[] = { 0, 1, 2, 3, 7, 64, 4096 };
+        const int NUM_CHUNKS = sizeof CHUNKS / sizeof *CHUNKS;
+
+        const char DELIMS[] = { '\n', 'b' };
+        const int NUM_DELIMS = sizeof DELIMS / sizeof *DELIMS;
+
+        // A long line spanning many refills of the get area.
+
+        std::string longInput(5000, 'x');
+        longInput += "\nshort\n";
+        longInput.append(3000, 'y');
+
+        for (int ti = 0; ti <= NUM_DATA; ++ti) {
+            const int         LINE  = ti < NUM_DATA ? DATA[ti].d_line : L_;
+            const std::string INPUT = ti < NUM_DATA
+                                    ? std::string(DATA[ti].d_input)
+                                    : longInput;
+
+            if (veryVerbose) { T_; P_(LINE); P(INPUT.size()); }
+
+            for (int di = 0; di < NUM_DELIMS; ++di) {
+                const char DELIM = DELIMS[di];
+
+                for (int ci = -1; ci < NUM_CHUNKS; ++ci) {
+                    // 'ci == -1' reads from an 'std::istringstream'.
+
+                    std::istringstream stringInput(INPUT);
+                    ChunkedStreambuf   chunkedBuf(INPUT,
+                                                  ci < 0 ? 0 : CHUNKS[ci]);
+                    std::istream       chunkedInput(&chunkedBuf);
+                    std::istream&      input = ci < 0 ? stringInput
+                                                      : chunkedInput;
+
+                    std::istringstream expInput(INPUT);
+
+                    bsl::string mX("garbage");  const bsl::string& X = mX;
+                    std::string exp;
+
+                    for (int n = 0; n < 1000; ++n) {
+                        const bool RESULT = !!bsl::getline(input, mX, DELIM);
+                        const bool EXP    = !!std::getline(expInput,
+                                                           exp,
+                                                           DELIM);
+
+                        LOOP4_ASSERT(LINE, di, ci, n, EXP == RESULT);
+                        LOOP4_ASSERT(LINE, di, ci, n,
+                                     expInput.eof() == input.eof());
+                        LOOP4_ASSERT(LINE, di, ci, n,
+                                     expInput.fail() == input.fail());
+                        if (RESULT) {
+                            LOOP4_ASSERT(LINE, di, ci, n,
+                                         exp == std::string(X.c_str(),
+                                                            X.size()));
+                        }
+                        if (!RESULT || !EXP) {
+                            break;
+                        }
+                    }
+                }
+            }
+
+            // The default delimiter is a newline.
+
+            std::istringstream input(INPUT);
+            std::istringstream expInput(INPUT);
+
+            bsl::string mX;  const bsl::string& X = mX;
+            std::string exp;
+
+            while (bsl::getline(input, mX)) {
+                LOOP_ASSERT(LINE, std::getline(expInput, exp));
+                LOOP_ASSERT(LINE, exp == std::string(X.c_str(), X.size()));
+            }
+            LOOP_ASSERT(LINE, !std::getline(expInput, exp));
+        }
+
+        if (verbose) printf("\nTesting 'getline' with 'wchar_t'.\n");
+        {
+            std::wistringstream input(L"ab\n\ncde");
+
+            bsl::wstring mX(L"garbage");  const bsl::wstring& X = mX;
+
+            ASSERT(bsl::getline(input, mX));
+            ASSERT(L"ab" == X);
+            ASSERT(bsl::getline(input, mX));
+            ASSERT(X.empty());
+            ASSERT(bsl::getline(input, mX));
+            ASSERT(L"cde" == X);
+            ASSERT(input.eof());
+            ASSERT(!bsl::getline(input, mX));
+        }
+      } break;
       case 28: {
         // --------------------------------------------------------------------
         // TESTING THE SHORT STRING OPTIMIZATION
@@ -14876,6 +15141,114 @@ int main(int argc, char *argv[])
         TestDriver<char>::testCaseM1(NITER, RANDOM_SEED);
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // 'getline' PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Reading a large line-oriented input with 'getline' is limited by
+        //:   the scanning of the input, rather than by a per-character cost.
+        //
+        // Plan:
+        //: 1 Following the 'readLines' function of the 'read_lines' sample,
+        //:   read every line of a generated input (of a size in megabytes
+        //:   optionally specified on the command line) from an
+        //:   'std::istringstream' into a 'bsl::string', and report the
+        //:   throughput of 'bsl::getline', of a reference implementation
+        //:   that extracts one character at a time (the implementation used
+        //:   by 'bsl::getline' before it scanned the get area in bulk), and of
+        //:   'std::getline'.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: getline(istream&, string&, C delim);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'getline' PERFORMANCE TEST"
+                            "\n==========================\n");
+
+        const int NUM_MEGABYTES = argc > 2 ? atoi(argv[2]) : 16;
+        const std::size_t INPUT_SIZE = NUM_MEGABYTES > 0
+                                     ? std::size_t(NUM_MEGABYTES) << 20
+                                     : std::size_t(16) << 20;
+
+        // Generate lines of lengths varying from 0 to 159 characters.
+
+        std::string input;
+        input.reserve(INPUT_SIZE + 160);
+        srand(0x12345678);
+        while (input.size() < INPUT_SIZE) {
+            const int length = rand() % 160;
+            for (int i = 0; i < length; ++i) {
+                input.push_back(static_cast<char>('a' + i % 26));
+            }
+            input.push_back('\n');
+        }
+
+        printf("\tInput size: %u bytes.\n", static_cast<unsigned>(
+                                                               input.size()));
+
+        const double MEGABYTES = double(input.size()) / (1 << 20);
+
+        std::size_t totalLength[3] = { 0, 0, 0 };
+        std::size_t numLines[3]    = { 0, 0, 0 };
+
+        bsls::Stopwatch timer;
+        {
+            std::istringstream inputStream(input);
+            bsl::string        line;
+
+            timer.start();
+            while (bsl::getline(inputStream, line)) {
+                totalLength[0] += line.size();
+                ++numLines[0];
+            }
+            timer.stop();
+
+            printf("\t%-22s %8.4fs  %8.1f MB/s\n",
+                   "bsl::getline:",
+                   timer.elapsedTime(),
+                   MEGABYTES / timer.elapsedTime());
+        }
+        {
+            std::istringstream inputStream(input);
+            bsl::string        line;
+
+            timer.reset();
+            timer.start();
+            while (getlineByCharacter(inputStream, line, '\n')) {
+                totalLength[1] += line.size();
+                ++numLines[1];
+            }
+            timer.stop();
+
+            printf("\t%-22s %8.4fs  %8.1f MB/s\n",
+                   "per-character getline:",
+                   timer.elapsedTime(),
+                   MEGABYTES / timer.elapsedTime());
+        }
+        {
+            std::istringstream inputStream(input);
+            std::string        line;
+
+            timer.reset();
+            timer.start();
+            while (std::getline(inputStream, line)) {
+                totalLength[2] += line.size();
+                ++numLines[2];
+            }
+            timer.stop();
+
+            printf("\t%-22s %8.4fs  %8.1f MB/s\n",
+                   "std::getline:",
+                   timer.elapsedTime(),
+                   MEGABYTES / timer.elapsedTime());
+        }
+
+        ASSERT(totalLength[0] == totalLength[1]);
+        ASSERT(totalLength[0] == totalLength[2]);
+        ASSERT(numLines[0] == numLines[1]);
+        ASSERT(numLines[0] == numLines[2]);
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
@@ -13,6 +13,9 @@ BSLS_IDENT("$Id: $")
 //   bslstl::StringRefImp: reference wrapper for a generic string
 //      bslstl::StringRef: reference wrapper for a 'char' string
 //  bslstl::StringRefWide: reference wrapper for a 'wchar_t' string
+//  bslstl::StringRefHash: transparent hash functor for 'char' strings
+//  bslstl::StringRefEqualTo: transparent equality functor for 'char' strings
+//  bslstl::StringRefLess: transparent ordering functor for 'char' strings
 //
 //@DESCRIPTION: This component defines two classes, 'bsls::StringRef' and
 // 'bsls::StringRefWide', each providing a reference to a non-modifiable string
@@ -65,7 +68,26 @@ BSLS_IDENT("$Id: $")
 //
 // The 'bsl::hash' template class is specialized for 'bslstl::StringRef' to
 // enable the use of 'bslstl::StringRef' with STL hash containers (e.g.,
-// 'bsl::unordered_set' and 'bsl::unordered_map').
+// 'bsl::unordered_set' and 'bsl::unordered_map').  The hash value of a
+// 'bslstl::StringRef' is the same as that of a 'bsl::string' having the same
+// characters.
+//
+///Transparent Functors
+///--------------------
+// This component also provides three functors, 'bslstl::StringRefHash',
+// 'bslstl::StringRefEqualTo', and 'bslstl::StringRefLess', that hash,
+// compare for equality, and order (respectively) the values of any
+// combination of 'bslstl::StringRef', 'bsl::string', 'native_std::string',
+// and null-terminated 'const char *' arguments, by binding a
+// 'bslstl::StringRef' to each argument (which never allocates memory).  Each
+// functor declares a nested 'is_transparent' type, so that a standard
+// associative container using them as its hasher and comparator (e.g.,
+// 'bsl::unordered_map<bsl::string, VALUE, bslstl::StringRefHash,
+// bslstl::StringRefEqualTo>' or 'bsl::map<bsl::string, VALUE,
+// bslstl::StringRefLess>') accepts keys of any of those types in its lookup
+// methods, without creating a temporary 'bsl::string' (see
+// 'bslmf_istransparent').  'bslstl::StringRefHash' returns the same hash
+// value as 'bsl::hash<bsl::string>' for the same characters.
 //
 ///Efficiency and Usage Considerations
 ///-----------------------------------
@@ -247,11 +269,55 @@ BSLS_IDENT("$Id: $")
 //  numBlanks = getNumBlanks(bslstl::StringRef(poemWithNulls, poemLength));
 //  assert(42 == numBlanks);
 //..
+//
+///Example 2: Looking Up String Keys Without Temporaries
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a parser looks up, in a 'bsl::map' keyed by 'bsl::string',
+// tokens that it has found in an input buffer.  A lookup using the default
+// comparator ('native_std::less<bsl::string>') would first construct a
+// temporary 'bsl::string' from each token, which allocates memory if the token
+// is longer than the short-string buffer of 'bsl::string'.
+//
+// First, we create a map using the transparent 'bslstl::StringRefLess'
+// comparator, and populate it:
+//..
+//  typedef bsl::map<bsl::string, int, bslstl::StringRefLess> KeywordMap;
+//
+//  KeywordMap keywords;
+//  keywords["a-keyword-too-long-for-the-short-string-buffer"] = 1;
+//  keywords["while"]                                          = 2;
+//..
+// Then, we take a token from the input buffer, referring to the token in place
+// without copying it:
+//..
+//  const char              *input = "while (a-keyword-too-long-for-the-"
+//                                   "short-string-buffer) {}";
+//  const bslstl::StringRef  token(input + 7, 46);
+//..
+// Now, we install a test allocator as the default allocator, so that we can
+// observe that the lookups allocate no memory:
+//..
+//  bslma::TestAllocator         da;
+//  bslma::DefaultAllocatorGuard guard(&da);
+//..
+// Finally, we search for the token, and for a null-terminated string:
+//..
+//  KeywordMap::const_iterator it = keywords.find(token);
+//  assert(keywords.end() != it);
+//  assert(1 == it->second);
+//
+//  assert(1 == keywords.count("while"));
+//  assert(0 == da.numBlocksTotal());
+//..
 
 #ifndef INCLUDED_BSLSCM_VERSION
 #include <bslscm_version.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_HASHUTIL
+#include <bslalg_hashutil.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ASSERT
 #include <bsls_assert.h>
 #endif
@@ -1363,32 +1429,116 @@ template <typename CHAR_TYPE>
 std::size_t hash<BloombergLP::bslstl::StringRefImp<CHAR_TYPE> >::
 operator()(const BloombergLP::bslstl::StringRefImp<CHAR_TYPE>& stringRef) const
 {
-    const CHAR_TYPE *string = stringRef.begin();
-    const CHAR_TYPE *end    = stringRef.end();
+    return BloombergLP::bslalg::HashUtil::computeBytesHash(
+                                       stringRef.data(),
+                                       stringRef.length() * sizeof(CHAR_TYPE));
+}
 
-    const unsigned int ADDEND       = 1013904223U;
-    const unsigned int MULTIPLICAND =    1664525U;
-    const unsigned int MASK         = 4294967295U;
+}  // close namespace bsl
 
-    std::size_t r = 0;
+namespace BloombergLP {
+namespace bslstl {
 
-    if (4 == sizeof(int)) {
-        while (string != end) {
-            r ^= *string++;
-            r = r * MULTIPLICAND + ADDEND;
-        }
-    }
-    else {
-        while (string != end) {
-            r ^= *string++;
-            r = (r * MULTIPLICAND + ADDEND) & MASK;
-        }
-    }
+                            // ====================
+                            // struct StringRefHash
+                            // ====================
+
+struct StringRefHash {
+    // This transparent functor computes the hash value of the string
+    // referenced by a 'StringRef' bound to its argument.  The hash value of a
+    // string is independent of the type ('StringRef', 'bsl::string',
+    // 'native_std::string', or 'const char *') supplying it, and is equal to
+    // 'bsl::hash<bsl::string>' of the same characters.
+
+    // TYPES
+    typedef void is_transparent;
+        // Indicate that this functor can be invoked with arguments of types
+        // other than the key type of a container (see 'bslmf_istransparent').
+
+    // ACCESSORS
+    native_std::size_t operator()(const StringRef& string) const;
+        // Return the hash value of the specified 'string'.
+};
+
+                          // =======================
+                          // struct StringRefEqualTo
+                          // =======================
+
+struct StringRefEqualTo {
+    // This transparent functor compares the values of the strings referenced
+    // by 'StringRef' objects bound to its arguments for equality.
+
+    // TYPES
+    typedef void is_transparent;
+        // Indicate that this functor can be invoked with arguments of types
+        // other than the key type of a container (see 'bslmf_istransparent').
 
-    return r;
+    // ACCESSORS
+    bool operator()(const StringRef& lhs, const StringRef& rhs) const;
+        // Return 'true' if the specified 'lhs' and 'rhs' strings have the same
+        // value, and 'false' otherwise.
+};
+
+                            // ====================
+                            // struct StringRefLess
+                            // ====================
+
+struct StringRefLess {
+    // This transparent functor lexicographically orders the strings
+    // referenced by 'StringRef' objects bound to its arguments.
+
+    // TYPES
+    typedef void is_transparent;
+        // Indicate that this functor can be invoked with arguments of types
+        // other than the key type of a container (see 'bslmf_istransparent').
+
+    // ACCESSORS
+    bool operator()(const StringRef& lhs, const StringRef& rhs) const;
+        // Return 'true' if the specified 'lhs' string lexicographically
+        // precedes the specified 'rhs' string, and 'false' otherwise.
+};
+
+// ===========================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ===========================================================================
+
+                            // --------------------
+                            // struct StringRefHash
+                            // --------------------
+
+// ACCESSORS
+inline
+native_std::size_t StringRefHash::operator()(const StringRef& string) const
+{
+    return bsl::hash<StringRef>()(string);
 }
 
-}  // close namespace bsl
+                          // -----------------------
+                          // struct StringRefEqualTo
+                          // -----------------------
+
+// ACCESSORS
+inline
+bool StringRefEqualTo::operator()(const StringRef& lhs,
+                                  const StringRef& rhs) const
+{
+    return lhs == rhs;
+}
+
+                            // --------------------
+                            // struct StringRefLess
+                            // --------------------
+
+// ACCESSORS
+inline
+bool StringRefLess::operator()(const StringRef& lhs,
+                               const StringRef& rhs) const
+{
+    return lhs < rhs;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
 
 #endif
 
@@ -2,6 +2,12 @@
 
 #include <bslstl_stringref.h>
 
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslmf_istransparent.h>
+#include <bslstl_map.h>
+#include <bslstl_unorderedmap.h>
+
 #include <bsls_nativestd.h>
 
 #include <algorithm>
@@ -104,9 +110,12 @@ using namespace bsl;  // automatically added by script
 // [ 7] operator+(const char *lhs, const StringRef& rhs);
 // [ 7] operator+(const StringRef& lhs, const char *rhs);
 // [ 8] bsl::hash<BloombergLP::bslstl::StringRef>
+// [ 9] size_t StringRefHash::operator()(const StringRef& string) const;
+// [ 9] bool StringRefEqualTo::operator()(const StringRef&, const StringRef&);
+// [ 9] bool StringRefLess::operator()(const StringRef&, const StringRef&);
 //--------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 9] USAGE
+// [10] USAGE
 //=============================================================================
 //                  STANDARD BDE ASSERT TEST MACROS
 //-----------------------------------------------------------------------------
@@ -205,7 +214,7 @@ int main(int argc, char *argv[])
     std::cout << "TEST " << __FILE__ << " CASE " << test << std::endl;
 
     switch (test) { case 0:
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -316,8 +325,191 @@ int main(int argc, char *argv[])
 //..
     numBlanks = getNumBlanks(bslstl::StringRef(poemWithNulls, poemLength));
     ASSERT(42 == numBlanks);
+//..
+//
+///Example 2: Looking Up String Keys Without Temporaries
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a parser looks up, in a 'bsl::map' keyed by 'bsl::string',
+// tokens that it has found in an input buffer.  A lookup using the default
+// comparator ('native_std::less<bsl::string>') would first construct a
+// temporary 'bsl::string' from each token, which allocates memory if the token
+// is longer than the short-string buffer of 'bsl::string'.
+//
+// First, we create a map using the transparent 'bslstl::StringRefLess'
+// comparator, and populate it:
+//..
+    typedef bsl::map<bsl::string, int, bslstl::StringRefLess> KeywordMap;
+
+    KeywordMap keywords;
+    keywords["a-keyword-too-long-for-the-short-string-buffer"] = 1;
+    keywords["while"]                                          = 2;
+//..
+// Then, we take a token from the input buffer, referring to the token in place
+// without copying it:
+//..
+    const char              *input = "while (a-keyword-too-long-for-the-"
+                                     "short-string-buffer) {}";
+    const bslstl::StringRef  token(input + 7, 46);
+//..
+// Now, we install a test allocator as the default allocator, so that we can
+// observe that the lookups allocate no memory:
+//..
+    bslma::TestAllocator         da;
+    bslma::DefaultAllocatorGuard guard(&da);
+//..
+// Finally, we search for the token, and for a null-terminated string:
+//..
+    KeywordMap::const_iterator it = keywords.find(token);
+    ASSERT(keywords.end() != it);
+    ASSERT(1 == it->second);
+
+    ASSERT(1 == keywords.count("while"));
+    ASSERT(0 == da.numBlocksTotal());
 //..
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSPARENT FUNCTORS
+        //
+        // Concerns:
+        //: 1 Each of 'StringRefHash', 'StringRefEqualTo', and 'StringRefLess'
+        //:   is transparent.
+        //:
+        //: 2 Each functor gives the same result for any combination of
+        //:   'StringRef', 'bsl::string', 'native_std::string', and
+        //:   'const char *' arguments having the same characters.
+        //:
+        //: 3 'StringRefHash' returns the same value as
+        //:   'bsl::hash<bsl::string>'.
+        //:
+        //: 4 'StringRefEqualTo' and 'StringRefLess' agree with the
+        //:   corresponding 'StringRef' operators.
+        //:
+        //: 5 Containers using the functors can be searched for a key of any
+        //:   of those types without allocating memory.
+        //
+        // Plan:
+        //: 1 Use 'bslmf::IsTransparent' to verify that each functor is
+        //:   transparent.  (C-1)
+        //:
+        //: 2 For each pair of strings in a table, invoke each functor with
+        //:   each supported argument type, and compare the results with those
+        //:   of 'bsl::hash<bsl::string>' and the 'StringRef' operators.
+        //:   (C-2..4)
+        //:
+        //: 3 Populate a 'bsl::map' and a 'bsl::unordered_map' using the
+        //:   functors with keys longer than the short-string buffer of
+        //:   'bsl::string'.  Install a test allocator as the default
+        //:   allocator, and search both containers for each key supplied as a
+        //:   'StringRef' and as a 'const char *'; verify that the default
+        //:   allocator is not used.  (C-5)
+        //
+        // Testing:
+        //   size_t StringRefHash::operator()(const StringRef& string) const;
+        //   bool StringRefEqualTo::operator()(const StringRef&, const SR&);
+        //   bool StringRefLess::operator()(const StringRef&, const SR&);
+        // --------------------------------------------------------------------
+
+        if (verbose) std::cout << "\nTESTING TRANSPARENT FUNCTORS"
+                               << "\n============================"
+                               << std::endl;
+
+        ASSERT(bslmf::IsTransparent<bslstl::StringRefHash>::value);
+        ASSERT(bslmf::IsTransparent<bslstl::StringRefEqualTo>::value);
+        ASSERT(bslmf::IsTransparent<bslstl::StringRefLess>::value);
+
+        static const char *DATA[] = {
+            "",
+            "a",
+            "ab",
+            "b",
+            "a string that is too long for the short-string buffer",
+            "a string that is too long for the short-string buffes",
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const bslstl::StringRefHash    hash    = bslstl::StringRefHash();
+        const bslstl::StringRefEqualTo equalTo = bslstl::StringRefEqualTo();
+        const bslstl::StringRefLess    less    = bslstl::StringRefLess();
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const char               *U = DATA[i];
+            const Obj                 UR(U);
+            const bsl::string         US(U);
+            const native_std::string  UN(U);
+
+            if (veryVerbose) { T_(); P(U); }
+
+            const native_std::size_t EXP_HASH = bsl::hash<bsl::string>()(US);
+
+            LOOP_ASSERT(i, EXP_HASH == hash(U));
+            LOOP_ASSERT(i, EXP_HASH == hash(UR));
+            LOOP_ASSERT(i, EXP_HASH == hash(US));
+            LOOP_ASSERT(i, EXP_HASH == hash(UN));
+
+            for (int j = 0; j < NUM_DATA; ++j) {
+                const char        *V = DATA[j];
+                const Obj          VR(V);
+                const bsl::string  VS(V);
+
+                const bool EXP_EQ   = UR == VR;
+                const bool EXP_LESS = UR <  VR;
+
+                LOOP2_ASSERT(i, j, (i == j) == EXP_EQ);
+
+                LOOP2_ASSERT(i, j, EXP_EQ   == equalTo(U,  V));
+                LOOP2_ASSERT(i, j, EXP_EQ   == equalTo(UR, VS));
+                LOOP2_ASSERT(i, j, EXP_EQ   == equalTo(US, V));
+                LOOP2_ASSERT(i, j, EXP_EQ   == equalTo(UN, VR));
+
+                LOOP2_ASSERT(i, j, EXP_LESS == less(U,  V));
+                LOOP2_ASSERT(i, j, EXP_LESS == less(UR, VS));
+                LOOP2_ASSERT(i, j, EXP_LESS == less(US, V));
+                LOOP2_ASSERT(i, j, EXP_LESS == less(UN, VR));
+            }
+        }
+
+        if (verbose) std::cout << "\nTesting lookup without allocation."
+                               << std::endl;
+        {
+            bslma::TestAllocator oa("object");
+            bslma::TestAllocator da("default");
+
+            typedef bsl::map<bsl::string, int, bslstl::StringRefLess> Map;
+            typedef bsl::unordered_map<bsl::string,
+                                       int,
+                                       bslstl::StringRefHash,
+                                       bslstl::StringRefEqualTo>  HashMap;
+
+            Map     mX(&oa);  const Map&     X = mX;
+            HashMap mY(&oa);  const HashMap& Y = mY;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                mX[bsl::string(DATA[i], &oa)] = i;
+                mY[bsl::string(DATA[i], &oa)] = i;
+            }
+
+            bslma::DefaultAllocatorGuard guard(&da);
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const char *KEY = DATA[i];
+                const Obj   REF(KEY);
+
+                LOOP_ASSERT(i, X.end() != X.find(KEY));
+                LOOP_ASSERT(i, i       == X.find(REF)->second);
+                LOOP_ASSERT(i, 1       == X.count(REF));
+
+                LOOP_ASSERT(i, Y.end() != Y.find(KEY));
+                LOOP_ASSERT(i, i       == Y.find(REF)->second);
+                LOOP_ASSERT(i, 1       == Y.count(REF));
+            }
+
+            ASSERT(X.end() == X.find("not present"));
+            ASSERT(Y.end() == Y.find("not present"));
+
+            LOOP_ASSERT(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // TESTING HASH FUNCTION
@@ -327,7 +519,8 @@ int main(int argc, char *argv[])
         //   /main/bb/dev/10 returned '0' for all input strings.  This test
         //   will verify that the hash function returns acceptably distinct
         //   values for a set of input strings, allowing for at most one
-        //   collision.
+        //   collision.  The hash of a 'bslstl::StringRef' should also equal
+        //   the hash of a 'bsl::string' having the same characters.
         //
         // Plan:
         //   Hash a reasonably large number of strings, capturing the hash
@@ -344,6 +537,9 @@ int main(int argc, char *argv[])
         //   representative, this at least allows us to make sure that our hash
         //   performs in a reasonable manner.
         //
+        //   Also hash a 'bsl::string' copy of each string, and verify that
+        //   the two hash values are the same.
+        //
         // Testing:
         //   bsl::hash<BloombergLP::bslstl::StringRef>
         // --------------------------------------------------------------------
@@ -1540,6 +1736,10 @@ int main(int argc, char *argv[])
                 printf("%4d: STR=%-20s, HASH=%x\n",LINE, STR, hash_value);
             }
 
+            LOOP_ASSERT(LINE,
+                        bsl::hash<bsl::string>()(bsl::string(STR)) ==
+                                                                   hash_value);
+
             hash_results[o] = hash_value;
             hash_value_counts[hash_value]++;
         }
@@ -26,6 +26,16 @@ BSLS_IDENT("$Id: $")
 // Subsequent allocations double the number of memory blocks of the previous
 // allocation up to an implementation defined maximum number of blocks.
 //
+///Winking Out
+///-----------
+// A tree-based container being destroyed may call 'winkOut' instead of
+// deleting each of its nodes.  If the parameterized 'VALUE' type is trivially
+// destructible and the allocator of the pool is a 'bslma::ManagedAllocator'
+// (see 'bslma_managedallocator'), 'winkOut' relinquishes all of the nodes of
+// the pool in constant time, leaving their memory to be reclaimed when the
+// managed allocator is released, and returns 'true'; otherwise 'winkOut' has
+// no effect and returns 'false', and the container must delete its nodes.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -147,8 +157,10 @@ BSLS_IDENT("$Id: $")
 //  template <class ALLOCATOR>
 //  bool IntSet<ALLOCATOR>::remove(int value)
 //  {
-//      bslalg::RbTreeNode *node =
-//                bslalg::RbTreeUtil::find(d_tree, IntNodeComparator(), value);
+//      IntNodeComparator comp;
+//      bslalg::RbTreeNode *node = bslalg::RbTreeUtil::find(d_tree,
+//                                                          comp,
+//                                                          value);
 //..
 // Here we use the 'TreeNodePool' object, 'd_nodePool', to delete a node that
 // was removed from the set.
@@ -237,6 +249,14 @@ BSL_OVERRIDES_STD mode"
 #include <bslma_deallocatorproctor.h>
 #endif
 
+#ifndef INCLUDED_BSLMA_MANAGEDALLOCATOR
+#include <bslma_managedallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
 #ifndef INCLUDED_BSLS_UTIL
 #include <bsls_util.h>
 #endif
@@ -318,6 +338,17 @@ class TreeNodePool {
         // the specified 'other' object.  The behavior is undefined unless the
         // underlying mechanisms of 'allocator()' refers to the same allocator.
 
+    bool winkOut();
+        // If 'VALUE' is trivially destructible and the mechanism of
+        // 'allocator()' is a 'bslma::ManagedAllocator', relinquish all of the
+        // nodes of this pool, without destroying their values or returning
+        // their memory to the allocator, and return 'true'; otherwise return
+        // 'false' with no effect.  The behavior is undefined if a node
+        // allocated from this pool is used after this method returns 'true'.
+        // Note that the relinquished memory is reclaimed when the managed
+        // allocator is released, and that a container may call this method
+        // from its destructor instead of deleting each of its nodes.
+
     // ACCESSORS
     const AllocatorType& allocator() const;
         // Return a reference providing non-modifiable access to the rebound
@@ -416,6 +447,23 @@ void TreeNodePool<VALUE, ALLOCATOR>::swap(
 }
 
 // ACCESSORS
+template <class VALUE, class ALLOCATOR>
+inline
+bool TreeNodePool<VALUE, ALLOCATOR>::winkOut()
+{
+    // 'BitwiseCopyable' is a valid surrogate for 'HasTrivialDestructor'.  The
+    // run-time check is made only if the pool has memory to relinquish.
+
+    if (!bsl::is_trivially_copyable<VALUE>::value
+     || !d_pool.hasMemory()
+     || !bslma::ManagedAllocatorUtil::hasManagedMechanism(allocator())) {
+        return false;                                                 // RETURN
+    }
+
+    d_pool.winkOut();
+    return true;
+}
+
 template <class VALUE, class ALLOCATOR>
 inline
 const typename SimplePool<TreeNode<VALUE>, ALLOCATOR>::AllocatorType&
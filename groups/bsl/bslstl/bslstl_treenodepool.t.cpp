@@ -13,10 +13,13 @@
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_default.h>
 
+#include <bslmf_istriviallycopyable.h>
+
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
 
+#include <bsltf_managedtestallocator.h>
 #include <bsltf_templatetestfacility.h>
 #include <bsltf_stdtestallocator.h>
 #include <bsltf_testvaluesarray.h>
@@ -55,11 +58,13 @@ using namespace bslstl;
 // [ 5] void deleteNode(bslalg::RbTreeNode *node);
 // [ 6] void reserveNodes(std::size_t numNodes);
 // [ 8] void swap(TreeNodePool<VALUE, ALLOCATOR>& other);
+// [ 9] bool winkOut();
 //
 // ACCESSORS
 // [ 4] const AllocatorType& allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
+// [10] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 //=============================================================================
 
@@ -277,11 +282,8 @@ class TestDriver {
 
   public:
     // TEST CASES
-    // static void testCase10();
-        // Reserved for BSLX.
-
     static void testCase9();
-        // Test usage example.
+        // Test 'winkOut'.
 
     static void testCase8();
         // Test 'swap' member.
@@ -361,6 +363,126 @@ void TestDriver<VALUE>::createFreeBlocks(Obj   *result,
     }
 }
 
+template<class VALUE>
+void TestDriver<VALUE>::testCase9()
+{
+    // ------------------------------------------------------------------------
+    // MANIPULATOR 'winkOut'
+    //
+    // Concerns:
+    //: 1 'winkOut' returns 'true' if, and only if, 'VALUE' is trivially
+    //:   destructible, the pool holds memory, and the allocator of the pool
+    //:   is a managed allocator.
+    //:
+    //: 2 If 'winkOut' returns 'true', no destructor is invoked and no memory
+    //:   is deallocated, and subsequent 'createNode' allocates memory from
+    //:   the allocator.
+    //:
+    //: 3 If 'winkOut' returns 'false', it has no effect: the nodes created
+    //:   from the pool remain valid, and may be deleted.
+    //:
+    //: 4 'winkOut' allocates no memory.
+    //
+    // Plan:
+    //: 1 Using a managed allocator that counts deallocations, and obtains
+    //:   its memory from a test allocator, and (separately) using a test
+    //:   allocator, create and delete various numbers of nodes, and call
+    //:   'winkOut'.  Verify the result, and that no memory was allocated or
+    //:   deallocated.  (C-1..2, 4)
+    //:
+    //: 2 If 'winkOut' returned 'true', verify that 'createNode' allocates
+    //:   memory; otherwise, delete the nodes still in use.  Verify that all
+    //:   memory is returned once the managed allocator is released.  (C-3)
+    //
+    // Testing:
+    //   bool winkOut();
+    // ------------------------------------------------------------------------
+
+    const bool TRIVIAL = bsl::is_trivially_copyable<VALUE>::value;
+
+    if (veryVerbose) P(TRIVIAL);
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    struct {
+        int d_line;
+        int d_numAlloc;
+        int d_numDealloc;
+    } DATA[] = {
+
+    //LINE  ALLOC  DEALLOC
+    //----  -----  -------
+
+    { L_,       0,       0 },
+    { L_,       1,       0 },
+    { L_,       1,       1 },
+    { L_,       2,       1 },
+    { L_,       3,       0 },
+    { L_,       4,       4 },
+    { L_,      33,      17 }
+
+    };
+    int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int LINE     = DATA[ti].d_line;
+        const int ALLOCS   = DATA[ti].d_numAlloc;
+        const int DEALLOCS = DATA[ti].d_numDealloc;
+
+        for (int managed = 0; managed < 2; ++managed) {
+            bslma::TestAllocator        oa("object", veryVeryVeryVerbose);
+            bsltf::ManagedTestAllocator ma(&oa);
+
+            bslma::Allocator *const ALLOC = managed
+                                          ? static_cast<bslma::Allocator *>(
+                                                                          &ma)
+                                          : &oa;
+
+            const bool EXP = TRIVIAL && managed && 0 < ALLOCS;
+
+            {
+                Stack usedX;
+                Stack freeX;
+
+                Obj mX(ALLOC);
+                init(&mX, &usedX, &freeX, ALLOCS, DEALLOCS);
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                const int NUM_DEALLOCS = ma.numDeallocations();
+
+                ASSERTV(LINE, managed, EXP == mX.winkOut());
+
+                ASSERTV(LINE, managed, oam.isTotalSame());
+                ASSERTV(LINE, managed, oam.isInUseSame());
+                ASSERTV(LINE, managed,
+                        NUM_DEALLOCS == ma.numDeallocations());
+
+                if (EXP) {
+                    mX.createNode();
+
+                    ASSERTV(LINE, managed, oam.isTotalUp());
+                }
+                else {
+                    while (!usedX.empty()) {
+                        mX.deleteNode(usedX.back());
+                        usedX.pop();
+                    }
+                }
+            }
+
+            ma.release();
+
+            ASSERTV(LINE, managed, 0 == oa.numBlocksInUse());
+        }
+    }
+
+    // Verify no memory is allocated from the default allocator.
+
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+}
+
 template<class VALUE>
 void TestDriver<VALUE>::testCase8()
 {
@@ -1263,8 +1385,10 @@ void TestDriver<VALUE>::testCase2()
     template <class ALLOCATOR>
     bool IntSet<ALLOCATOR>::remove(int value)
     {
-        bslalg::RbTreeNode *node =
-                  bslalg::RbTreeUtil::find(d_tree, IntNodeComparator(), value);
+        IntNodeComparator comp;
+        bslalg::RbTreeNode *node = bslalg::RbTreeUtil::find(d_tree,
+                                                            comp,
+                                                            value);
 //..
 // Here we use the 'TreeNodePool' object, 'd_nodePool', to delete a node that
 // was removed from the set.
@@ -1308,7 +1432,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 9: {
+      case 10: {
         if (verbose) printf("\nUSAGE EXAMPLE"
                             "\n=============\n");
 
@@ -1343,6 +1467,13 @@ int main(int argc, char *argv[])
     ASSERT(0 <  objectAllocator.numBytesInUse());
 //..
       } break;
+      case 9: {
+        if (verbose) printf("\nMANIPULATOR 'winkOut'"
+                            "\n=====================\n");
+
+        TestDriver<int>::testCase9();
+        TestDriver<bsltf::AllocTestType>::testCase9();
+      } break;
       case 8: {
         TestDriver<bsltf::AllocTestType>::testCase8();
       } break;
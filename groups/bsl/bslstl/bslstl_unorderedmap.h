@@ -295,6 +295,18 @@ BSLS_IDENT("$Id: $")
 // adapting the existing default hash functions for primitive types, an
 // approach that may not always prove adequate.
 //
+///Heterogeneous Lookup
+///--------------------
+// If both the 'HASH' and the 'EQUAL' functors of an unordered map are
+// *transparent* (i.e., each declares a nested type named 'is_transparent'; see
+// 'bslmf_istransparent'), then 'find', 'count', and 'equal_range' also accept
+// a key of any type that both functors can be invoked with, and search for it
+// without first converting it to a temporary 'KEY' object.  Such a key must
+// hash to the same value as any 'KEY' to which it compares equal.  For
+// example, an unordered map of 'bsl::string' keys that uses
+// 'bslstl::StringRefHash' and 'bslstl::StringRefEqualTo' can be searched for
+// a string literal or a 'bslstl::StringRef' without allocating memory.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -906,6 +918,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslmf_isbitwisemoveable.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRANSPARENT
+#include <bslmf_istransparent.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
 #include <bslmf_nestedtraitdeclaration.h>
 #endif
@@ -1205,6 +1221,33 @@ class unordered_map {
         // object in this unordered map having the specified 'key', if such an
         // entry exists, and the past-the-end iterator ('end') otherwise.
 
+    void findBatch(iterator       *results,
+                   const key_type *keys,
+                   size_type       numKeys);
+        // Load into each of the first specified 'numKeys' elements of the
+        // specified 'results' array the iterator that 'find' returns for the
+        // corresponding element of the specified 'keys' array.  The behavior
+        // is undefined unless 'results' and 'keys' each refer to an array of
+        // at least 'numKeys' elements.  Note that this method is typically
+        // faster than calling 'find' for each key of a large, out-of-cache
+        // map, as the memory accesses of the searches overlap.
+
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                                     iterator,
+                                                     HASH,
+                                                     EQUAL>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this unordered map having a key equal to the specified
+        // 'key', if such an entry exists, and the past-the-end iterator
+        // ('end') otherwise.  This method participates in overload resolution
+        // only if both 'HASH' and 'EQUAL' are transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        return iterator(d_impl.find(key));
+    }
+
     template <class SOURCE_TYPE>
     pair<iterator, bool> insert(const SOURCE_TYPE& value);
         // Insert the specified 'value' into this unordered map if the key (the
@@ -1258,6 +1301,28 @@ class unordered_map {
         // value, 'end()'.  Note that since an unordered map maintains unique
         // keys, the range will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                                     pair<iterator, iterator>,
+                                                     HASH,
+                                                     EQUAL>::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this unordered map having a key
+        // equal to the specified 'key', where the first iterator is positioned
+        // at the start of the sequence, and the second is positioned one past
+        // the end of the sequence.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent (see
+        // {Heterogeneous Lookup}).
+    {
+        typedef bsl::pair<iterator, iterator> ResultType;
+
+        HashTableLink *first = d_impl.find(key);
+        return first
+             ? ResultType(iterator(first), iterator(first->nextLink()))
+             : ResultType(iterator(0),     iterator(0));
+    }
+
     void max_load_factor(float newMaxLoadFactor);
         // Set the maximum load factor of this unordered map to the specified
         // 'newMaxLoadFactor'.  If 'newMaxLoadFactor < loadFactor()', this
@@ -1365,6 +1430,20 @@ class unordered_map {
         // unordered map maintains unique keys, the returned value will be
         // either 0 or 1.
 
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                                     size_type,
+                                                     HASH,
+                                                     EQUAL>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects contained within this
+        // unordered map having a key equal to the specified 'key'.  This
+        // method participates in overload resolution only if both 'HASH' and
+        // 'EQUAL' are transparent (see {Heterogeneous Lookup}).
+    {
+        return d_impl.find(key) != 0;
+    }
+
     bool empty() const;
         // Return 'true' if this unordered map contains no elements, and
         // 'false' otherwise.
@@ -1380,12 +1459,63 @@ class unordered_map {
         // value, 'end()'.  Note that since an unordered map maintains unique
         // keys, the range will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<
+                                         LOOKUP_KEY,
+                                         pair<const_iterator, const_iterator>,
+                                         HASH,
+                                         EQUAL>::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this unordered map having a key
+        // equal to the specified 'key', where the first iterator is positioned
+        // at the start of the sequence, and the second is positioned one past
+        // the end of the sequence.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent (see
+        // {Heterogeneous Lookup}).
+    {
+        typedef bsl::pair<const_iterator, const_iterator> ResultType;
+
+        HashTableLink *first = d_impl.find(key);
+        return first
+             ? ResultType(const_iterator(first),
+                          const_iterator(first->nextLink()))
+             : ResultType(const_iterator(0), const_iterator(0));
+    }
+
     const_iterator find(const key_type& key) const;
         // Return an iterator providing non-modifiable access to the
         // 'value_type' object in this unordered map having the specified
         // 'key', if such an entry exists, and the past-the-end iterator
         // ('end') otherwise.
 
+    void findBatch(const_iterator *results,
+                   const key_type *keys,
+                   size_type       numKeys) const;
+        // Load into each of the first specified 'numKeys' elements of the
+        // specified 'results' array the iterator that 'find' returns for the
+        // corresponding element of the specified 'keys' array.  The behavior
+        // is undefined unless 'results' and 'keys' each refer to an array of
+        // at least 'numKeys' elements.  Note that this method is typically
+        // faster than calling 'find' for each key of a large, out-of-cache
+        // map, as the memory accesses of the searches overlap.
+
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                                     const_iterator,
+                                                     HASH,
+                                                     EQUAL>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this unordered map having a key equal to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // iterator ('end') otherwise.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent (see
+        // {Heterogeneous Lookup}).
+    {
+        return const_iterator(d_impl.find(key));
+    }
+
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
         // unordered map.
@@ -1712,6 +1842,17 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
     return iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::findBatch(
+                                                       iterator       *results,
+                                                       const key_type *keys,
+                                                       size_type       numKeys)
+{
+    d_impl.findBatch(results, keys, numKeys);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 template <class SOURCE_TYPE>
 bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
@@ -1875,7 +2016,9 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::begin(size_type index) const
 {
     BSLS_ASSERT_SAFE(index < this->bucket_count());
 
-    return const_local_iterator(&d_impl.bucketAtIndex(index));
+    return const_local_iterator(&d_impl.bucketAtIndex(index),
+                                d_impl.nextNodeInBucketFunction(),
+                                &d_impl);
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
@@ -1899,7 +2042,9 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::cbegin(
 {
     BSLS_ASSERT_SAFE(index < this->bucket_count());
 
-    return const_local_iterator(&d_impl.bucketAtIndex(index));
+    return const_local_iterator(&d_impl.bucketAtIndex(index),
+                                d_impl.nextNodeInBucketFunction(),
+                                &d_impl);
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
@@ -1999,6 +2144,17 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::findBatch(
+                                                 const_iterator *results,
+                                                 const key_type *keys,
+                                                 size_type       numKeys) const
+{
+    d_impl.findBatch(results, keys, numKeys);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 ALLOCATOR
@@ -6,12 +6,14 @@
 #include <bslstl_string.h>
 #include <bslstl_vector.h>
 
+#include <bslalg_hashtableanchor.h>
 #include <bslalg_swaputil.h>
 
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_mallocfreeallocator.h>
+#include <bslma_multipoolallocator.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
 #include <bslma_usesbslmaallocator.h>
@@ -25,8 +27,13 @@
 #include <bsls_exceptionutil.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 #include <bsls_util.h>
 
+#include <bsltf_countedkey.h>
+#include <bsltf_managedtestallocator.h>
 #include <bsltf_stdtestallocator.h>
 #include <bsltf_templatetestfacility.h>
 #include <bsltf_testvaluesarray.h>
@@ -70,7 +77,20 @@ using namespace BloombergLP;
 // [ ]
 //-----------------------------------------------------------------------------
 // [1] BREATHING TEST
-// [2] USAGE EXAMPLE
+// [17] CONCERN: 'HashTableCachesHashCodes' avoids redundant hash/compare
+// [18] CONCERN: 'HashTableRehashesIncrementally' bounds insertion cost
+// [19] void findBatch(iterator *, const key_type *, size_type);
+// [19] void findBatch(const_iterator *, const key_type *, size_type) const;
+// [20] iterator find(const LOOKUP_KEY& key);
+// [20] const_iterator find(const LOOKUP_KEY& key) const;
+// [20] size_type count(const LOOKUP_KEY& key) const;
+// [20] bsl::pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+// [20] bsl::pair<const_iter, const_iter> equal_range(const LOOKUP_KEY&) c;
+// [21] CONCERN: Destruction winks out with a managed allocator.
+// [22] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: string keys, with and without cached hash codes
+// [-2] PERFORMANCE TEST: insertion latency, incremental vs. full rehash
+// [-3] PERFORMANCE TEST: 'findBatch' vs. 'find' on out-of-cache maps
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -9554,6 +9574,331 @@ void testImplicitInsert(CONTAINER& mX)
 
 }  // close namespace BREATHING_TEST
 
+// ============================================================================
+//                      CACHED HASH CODE POLICY SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int numHashCalls = 0;     // number of calls to a counting hash functor
+int numCompareCalls = 0;  // number of calls to a counting comparator
+
+struct CountingStringHash {
+    // This hash functor returns the 'bsl::hash' of its 'bsl::string'
+    // argument, and counts the number of times it is called in
+    // 'numHashCalls'.
+
+    native_std::size_t operator()(const bsl::string& key) const
+        // Return the hash code of the specified 'key'.
+    {
+        ++numHashCalls;
+        return bsl::hash<bsl::string>()(key);
+    }
+};
+
+struct CachingCountingStringHash : CountingStringHash {
+    // This hash functor behaves as 'CountingStringHash', and selects the
+    // cached hash code policy of the underlying hash table.
+
+    BSLMF_NESTED_TRAIT_DECLARATION(CachingCountingStringHash,
+                                   bslstl::HashTableCachesHashCodes);
+};
+
+struct CountingStringEqual {
+    // This comparator compares two 'bsl::string' objects for equality, and
+    // counts the number of times it is called in 'numCompareCalls'.
+
+    bool operator()(const bsl::string& lhs, const bsl::string& rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' have the same value,
+        // and 'false' otherwise.
+    {
+        ++numCompareCalls;
+        return lhs == rhs;
+    }
+};
+
+struct CachingStringHash {
+    // This hash functor returns the 'bsl::hash' of its 'bsl::string'
+    // argument, and selects the cached hash code policy of the underlying
+    // hash table.
+
+    BSLMF_NESTED_TRAIT_DECLARATION(CachingStringHash,
+                                   bslstl::HashTableCachesHashCodes);
+
+    native_std::size_t operator()(const bsl::string& key) const
+        // Return the hash code of the specified 'key'.
+    {
+        return bsl::hash<bsl::string>()(key);
+    }
+};
+
+void makeKey(bsl::string *result, int index, const char *prefix)
+    // Load into the specified 'result' a string key, unique for the specified
+    // 'index', starting with the specified 'prefix'.
+{
+    char buffer[64];
+    sprintf(buffer, "%s-%010d", prefix, index);
+    result->assign(buffer);
+}
+
+template <class MAP>
+double timeInsertions(MAP *map, const bsl::vector<bsl::string>& keys)
+    // Insert each of the specified 'keys' into the specified 'map', and return
+    // the elapsed time in seconds.
+{
+    bsls::Stopwatch timer;
+    timer.start();
+    for (native_std::size_t i = 0; i < keys.size(); ++i) {
+        (*map)[keys[i]] = static_cast<int>(i);
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+template <class MAP>
+double timeLookups(long                            *checksum,
+                   const MAP&                       map,
+                   const bsl::vector<bsl::string>&  keys)
+    // Look up each of the specified 'keys' in the specified 'map', in a
+    // scattered order, adding to the specified 'checksum' the number of keys
+    // found, and return the elapsed time in seconds.
+{
+    const native_std::size_t N = keys.size();
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (native_std::size_t i = 0, k = 0; i < N; ++i, k = (k + 7919) % N) {
+        *checksum += map.end() != map.find(keys[k]);
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+template <class MAP>
+double timeCopy(const MAP& map)
+    // Copy-construct a map from the specified 'map', and return the elapsed
+    // time in seconds (excluding the destruction of the copy).
+{
+    bsls::Stopwatch timer;
+    timer.start();
+    MAP copy(map);
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                     INCREMENTAL REHASH POLICY SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct IncrementalCountingStringHash : CountingStringHash {
+    // This hash functor behaves as 'CountingStringHash', and selects the
+    // incremental rehash policy of the underlying hash table.
+
+    BSLMF_NESTED_TRAIT_DECLARATION(IncrementalCountingStringHash,
+                                   bslstl::HashTableRehashesIncrementally);
+};
+
+struct IncrementalIntHash {
+    // This hash functor returns the 'bsl::hash' of its 'int' argument, and
+    // selects the incremental rehash policy of the underlying hash table.
+
+    BSLMF_NESTED_TRAIT_DECLARATION(IncrementalIntHash,
+                                   bslstl::HashTableRehashesIncrementally);
+
+    native_std::size_t operator()(int key) const
+        // Return the hash code of the specified 'key'.
+    {
+        return bsl::hash<int>()(key);
+    }
+};
+
+template <class MAP>
+int fillUntilGrowth(MAP                             *map,
+                    const bsl::vector<bsl::string>&  keys,
+                    native_std::size_t               minSize)
+    // Insert into the specified 'map', in order, each of the specified 'keys'
+    // (mapping 'keys[i]' to 'i') until 'map' holds at least the specified
+    // 'minSize' elements and an insertion has increased the number of buckets
+    // of 'map', and return the number of keys inserted, or -1 if 'keys' is
+    // exhausted first.  Note that, if 'map' rehashes incrementally, its
+    // rehash is in progress on return.
+{
+    for (native_std::size_t i = 0; i < keys.size(); ++i) {
+        const native_std::size_t numBuckets = map->bucket_count();
+        (*map)[keys[i]] = static_cast<int>(i);
+        if (map->size() >= minSize && map->bucket_count() != numBuckets) {
+            return static_cast<int>(i + 1);                           // RETURN
+        }
+    }
+    return -1;
+}
+
+template <class MAP>
+bool hasExactlyKeys(const MAP&                      map,
+                    const bsl::vector<bsl::string>& keys,
+                    int                             numKeys,
+                    int                             stride)
+    // Return 'true' if the specified 'map' holds exactly the elements
+    // '(keys[i], i)' for every 'i' in '[0, numKeys)' that is a multiple of the
+    // specified 'stride', both when iterated over and when each key is
+    // searched for, and 'false' otherwise.
+{
+    int expectedSize = 0;
+    for (int i = 0; i < numKeys; i += stride) {
+        typename MAP::const_iterator it = map.find(keys[i]);
+        if (map.end() == it || i != it->second) {
+            return false;                                             // RETURN
+        }
+        ++expectedSize;
+    }
+
+    bsl::vector<int> timesSeen(numKeys, 0);
+    int              numSeen = 0;
+    for (typename MAP::const_iterator it = map.begin(); it != map.end();
+                                                                        ++it) {
+        if (it->second < 0 || it->second >= numKeys
+         || 0 != it->second % stride || 0 != timesSeen[it->second]++) {
+            return false;                                             // RETURN
+        }
+        ++numSeen;
+    }
+
+    return expectedSize == numSeen
+        && expectedSize == static_cast<int>(map.size());
+}
+
+template <class MAP>
+void measureInsertLatencies(bsl::vector<bsls::Types::Int64> *latencies,
+                            bsls::Types::Int64              *maxGrowLatency,
+                            int                              numKeys)
+    // Insert into an empty map of the (template parameter) type 'MAP' the
+    // keys '[0, numKeys)', in a scattered order, and load into the specified
+    // 'latencies' the duration of each insertion in nanoseconds, sorted in
+    // increasing order, and into the specified 'maxGrowLatency' the longest
+    // duration of an insertion that increased the number of buckets.
+{
+    latencies->resize(numKeys);
+    *maxGrowLatency = 0;
+
+    MAP map(&bslma::MallocFreeAllocator::singleton());
+    for (int i = 0; i < numKeys; ++i) {
+        const int key = static_cast<int>(
+                        (static_cast<bsls::Types::Uint64>(i) * 2654435761u)
+                                                                  % numKeys);
+        const native_std::size_t numBuckets = map.bucket_count();
+
+        const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+        map[key] = i;
+        (*latencies)[i] = bsls::TimeUtil::getTimer() - start;
+
+        if (map.bucket_count() != numBuckets) {
+            *maxGrowLatency = native_std::max(*maxGrowLatency,
+                                              (*latencies)[i]);
+        }
+    }
+
+    native_std::sort(latencies->begin(), latencies->end());
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                          BATCHED LOOKUP SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace {
+
+template <class MAP>
+bool findBatchMatchesFind(MAP                          *map,
+                          const typename MAP::key_type *keys,
+                          int                           numKeys)
+    // Return 'true' if both the modifiable and the non-modifiable
+    // 'findBatch' of the specified 'map', given the first specified
+    // 'numKeys' elements of the specified 'keys' array, load the same
+    // iterators as calling 'find' for each of those keys, and 'false'
+    // otherwise.  Note that the arrays of results are surrounded by guard
+    // values to detect writes beyond 'numKeys' elements.
+{
+    typedef typename MAP::iterator       Iter;
+    typedef typename MAP::const_iterator CIter;
+
+    const MAP& X = *map;
+
+    bsl::vector<Iter>  results(numKeys + 2, map->begin());
+    bsl::vector<CIter> cresults(numKeys + 2, X.begin());
+
+    map->findBatch(&results[1], keys, numKeys);
+    X.findBatch(&cresults[1], keys, numKeys);
+
+    if (map->begin() != results[0] || map->begin() != results[numKeys + 1]
+     || X.begin() != cresults[0]   || X.begin() != cresults[numKeys + 1]) {
+        return false;                                                 // RETURN
+    }
+
+    for (int i = 0; i < numKeys; ++i) {
+        if (map->find(keys[i]) != results[i + 1]
+         || X.find(keys[i]) != cresults[i + 1]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class MAP>
+double timeFindLoop(long                    *checksum,
+                    const MAP&               map,
+                    const bsl::vector<int>&  keys)
+    // Search the specified 'map' for each of the specified 'keys', one
+    // 'find' at a time, add the mapped values found to the specified
+    // 'checksum', and return the elapsed wall time in seconds.
+{
+    bsls::Stopwatch timer;
+    timer.start();
+    for (native_std::size_t i = 0; i < keys.size(); ++i) {
+        typename MAP::const_iterator it = map.find(keys[i]);
+        if (map.end() != it) {
+            *checksum += it->second;
+        }
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+template <class MAP>
+double timeFindBatch(long                    *checksum,
+                      const MAP&               map,
+                      const bsl::vector<int>&  keys,
+                      int                      batchSize)
+    // Search the specified 'map' for each of the specified 'keys', calling
+    // 'findBatch' for each group of the specified 'batchSize' consecutive
+    // keys, add the mapped values found to the specified 'checksum', and
+    // return the elapsed wall time in seconds.
+{
+    bsl::vector<typename MAP::const_iterator> results(batchSize, map.end());
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (native_std::size_t i = 0; i < keys.size(); i += batchSize) {
+        const int n = static_cast<int>(
+                    native_std::min<native_std::size_t>(batchSize,
+                                                        keys.size() - i));
+        map.findBatch(&results[0], &keys[i], n);
+        for (int j = 0; j < n; ++j) {
+            if (map.end() != results[j]) {
+                *checksum += results[j]->second;
+            }
+        }
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+}  // close unnamed namespace
+
 //=============================================================================
 // MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -9573,7 +9918,7 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:
 #if !defined(BSLSTL_UNORDEREDMAP_DO_NOT_TEST_USAGE)
-        case 17: {
+        case 22: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -9594,6 +9939,898 @@ int main(int argc, char *argv[])
         usage();
       } break;
 #endif
+      case 21: {
+        // --------------------------------------------------------------------
+        // TESTING WINK-OUT ON DESTRUCTION
+        //
+        // Concerns:
+        //: 1 An unordered map whose elements are trivially destructible, and
+        //:   whose allocator is a 'bslma::ManagedAllocator', does not return
+        //:   its nodes or its bucket array to the allocator on destruction.
+        //:
+        //: 2 The memory of such an unordered map is reclaimed by releasing
+        //:   the allocator.
+        //:
+        //: 3 An unordered map whose elements are not trivially destructible
+        //:   destroys each of its elements on destruction, even if its
+        //:   allocator is a 'bslma::ManagedAllocator'.
+        //:
+        //: 4 An unordered map whose allocator is not a
+        //:   'bslma::ManagedAllocator' returns all of its memory on
+        //:   destruction.
+        //:
+        //: 5 Repeatedly creating and destroying an unordered map of 'int'
+        //:   values whose allocator is a 'bslma::MultipoolAllocator', which
+        //:   recycles the memory returned to it and is not a managed
+        //:   allocator, does not increase the memory that the multipool
+        //:   obtains from its upstream allocator.
+        //
+        // Plan:
+        //: 1 Create an unordered map of 'int' values with a
+        //:   'ManagedTestAllocator', add and erase some elements, destroy the
+        //:   unordered map, and verify that the allocator was not called to
+        //:   deallocate.  Release the allocator and verify that all memory is
+        //:   returned upstream.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 with an unordered map of 'bsltf::AllocTestType'
+        //:   values, and verify that each remaining element deallocates its
+        //:   memory on destruction of the unordered map.  (C-3)
+        //:
+        //: 3 Repeat P-1 with an unordered map whose allocator is a test
+        //:   allocator, and verify that all memory is returned on
+        //:   destruction.  (C-4)
+        //:
+        //: 4 Create and destroy an unordered map of 'int' values using a
+        //:   'bslma::MultipoolAllocator' many times, and verify that the
+        //:   memory in use from the upstream test allocator after the first
+        //:   iteration does not change.  (C-5)
+        //
+        // Testing:
+        //   CONCERN: Destruction winks out with a managed allocator.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING WINK-OUT ON DESTRUCTION"
+                            "\n===============================\n");
+
+        const int NUM_VALUES = 100;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tTrivially destructible elements.\n");
+        {
+            typedef bsl::unordered_map<int, int> Obj;
+
+            bslma::TestAllocator        oa("object", veryVeryVeryVerbose);
+            bsltf::ManagedTestAllocator ma(&oa);
+
+            int numDeallocations;
+            {
+                Obj mX(&ma);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX[i] = i;
+                }
+                for (int i = 0; i < NUM_VALUES; i += 2) {
+                    mX.erase(i);
+                }
+                numDeallocations = ma.numDeallocations();
+            }
+            ASSERTV(numDeallocations,   ma.numDeallocations(),
+                    numDeallocations == ma.numDeallocations());
+            ASSERTV(oa.numBlocksInUse(), 0 < oa.numBlocksInUse());
+
+            ma.release();
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tElements that allocate memory.\n");
+        {
+            typedef bsl::unordered_map<int, bsltf::AllocTestType> Obj;
+
+            bslma::TestAllocator        oa("object", veryVeryVeryVerbose);
+            bsltf::ManagedTestAllocator ma(&oa);
+
+            int numDeallocations;
+            {
+                Obj mX(&ma);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX[i] = bsltf::AllocTestType(i);
+                }
+                for (int i = 0; i < NUM_VALUES; i += 2) {
+                    mX.erase(i);
+                }
+                numDeallocations = ma.numDeallocations();
+            }
+            ASSERTV(numDeallocations,   ma.numDeallocations(),
+                    numDeallocations + NUM_VALUES / 2
+                                                  <= ma.numDeallocations());
+        }
+
+        if (verbose) printf("\tAllocator that is not managed.\n");
+        {
+            typedef bsl::unordered_map<int, int> Obj;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                Obj mX(&oa);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX[i] = i;
+                }
+                ASSERTV(oa.numBlocksInUse(), 0 < oa.numBlocksInUse());
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tMultipool allocator.\n");
+        {
+            typedef bsl::unordered_map<int, int> Obj;
+
+            const int NUM_ITERATIONS = 100;
+
+            bslma::TestAllocator      oa("object", veryVeryVeryVerbose);
+            bslma::MultipoolAllocator mpa(&oa);
+
+            bsls::Types::Int64 numBytes = 0;
+            for (int ti = 0; ti < NUM_ITERATIONS; ++ti) {
+                {
+                    Obj mX(&mpa);
+                    for (int i = 0; i < NUM_VALUES; ++i) {
+                        mX[i] = i;
+                    }
+                }
+                if (0 == ti) {
+                    numBytes = oa.numBytesInUse();
+                }
+                ASSERTV(ti, oa.numBytesInUse(),
+                        numBytes == oa.numBytesInUse());
+            }
+        }
+      } break;
+      case 20: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSPARENT LOOKUP
+        //
+        // Concerns:
+        //: 1 If both 'HASH' and 'EQUAL' are transparent, 'find', 'count', and
+        //:   'equal_range' accept a key of a type other than 'key_type',
+        //:   without converting it to 'key_type'.
+        //:
+        //: 2 Each such lookup returns the same result as the same method
+        //:   called with a 'key_type' object having an equal value, whether
+        //:   or not the key is present.
+        //:
+        //: 3 Both the modifiable and the non-modifiable overloads are
+        //:   available.
+        //:
+        //: 4 If 'HASH' is not transparent, a lookup using a key of another
+        //:   type still converts the key to 'key_type'.
+        //
+        // Plan:
+        //: 1 Create an unordered map, using a transparent hasher and
+        //:   equality comparator, of keys of a type, 'CountedKey', that
+        //:   counts the objects of that type created and is implicitly
+        //:   convertible from 'int'.  Insert the even numbers in a range.
+        //:
+        //: 2 For each 'int' in a larger range, call each lookup method with
+        //:   the 'int', and with an equal 'CountedKey', and verify that the
+        //:   results are the same, and that no 'CountedKey' is created by the
+        //:   calls taking an 'int'.  (C-1..3)
+        //:
+        //: 3 Create an unordered map using a hasher that is not
+        //:   transparent, and verify that a lookup using an 'int' creates a
+        //:   'CountedKey'.  (C-4)
+        //
+        // Testing:
+        //   iterator find(const LOOKUP_KEY& key);
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+        //   const_iterator find(const LOOKUP_KEY& key) const;
+        //   size_type count(const LOOKUP_KEY& key) const;
+        //   pair<c_iter, c_iter> equal_range(const LOOKUP_KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING TRANSPARENT LOOKUP"
+                            "\n==========================\n");
+
+        typedef bsltf::CountedKey           Key;
+        typedef bsltf::CountedKeyHash       Hash;
+        typedef bsltf::CountedKeyEqual      Equal;
+        typedef bsltf::CountedKeyOpaqueHash OpaqueHash;
+
+        typedef bsl::unordered_map<Key, int, Hash, Equal>       Map;
+        typedef bsl::unordered_map<Key, int, OpaqueHash, Equal> OpaqueMap;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Map mX(&oa);  const Map& X = mX;
+        for (int i = 0; i < 20; i += 2) {
+            mX.insert(bsl::pair<const Key, int>(Key(i), i));
+        }
+
+        for (int ti = -1; ti <= 20; ++ti) {
+            const int KEY = ti;
+            const Key COUNTED_KEY(ti);
+
+            if (veryVerbose) { T_ P(KEY) }
+
+            const Map::iterator  EXP_FIND = mX.find(COUNTED_KEY);
+            const Map::iterator  EXP_LAST = mX.equal_range(COUNTED_KEY).second;
+            const Map::size_type EXP_CNT  = X.count(COUNTED_KEY);
+
+            const int NUM_CREATED = Key::numCreated();
+
+            ASSERTV(KEY, EXP_FIND == mX.find(KEY));
+            ASSERTV(KEY, EXP_FIND == mX.equal_range(KEY).first);
+            ASSERTV(KEY, EXP_LAST == mX.equal_range(KEY).second);
+
+            ASSERTV(KEY, EXP_FIND == X.find(KEY));
+            ASSERTV(KEY, EXP_CNT  == X.count(KEY));
+            ASSERTV(KEY, EXP_FIND == X.equal_range(KEY).first);
+            ASSERTV(KEY, EXP_LAST == X.equal_range(KEY).second);
+
+            ASSERTV(KEY, (0 == KEY % 2 && 0 <= KEY && KEY < 20) == EXP_CNT);
+            ASSERTV(KEY, NUM_CREATED == Key::numCreated());
+        }
+
+        if (verbose) printf("Testing a hasher that is not transparent.\n");
+        {
+            OpaqueMap mY(&oa);  const OpaqueMap& Y = mY;
+            mY.insert(bsl::pair<const Key, int>(Key(2), 2));
+
+            const int NUM_CREATED = Key::numCreated();
+
+            ASSERT(Y.end() != Y.find(2));
+            ASSERT(NUM_CREATED < Key::numCreated());
+        }
+      } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING 'findBatch'
+        //
+        // Concerns:
+        //: 1 'findBatch' loads, for each key, the same iterator as 'find',
+        //:   whether or not the key is present.
+        //:
+        //: 2 'findBatch' writes exactly 'numKeys' results, for a number of
+        //:   keys that is zero, smaller than, equal to, and larger than (and
+        //:   not a multiple of) the internal batch size.
+        //:
+        //: 3 Both the modifiable and the non-modifiable overloads are
+        //:   available and agree.
+        //:
+        //: 4 'findBatch' is correct for an empty map, for a map caching its
+        //:   hash codes, and for a map whose incremental rehash is in
+        //:   progress.
+        //:
+        //: 5 'findBatch' allocates no memory.
+        //
+        // Plan:
+        //: 1 For maps of each policy, holding the even keys of a range,
+        //:   call 'findBatch' on prefixes of various lengths of an array of
+        //:   both even and odd keys, and compare the results with 'find'.
+        //:   Surround the result arrays with guard values.  (C-1..3)
+        //:
+        //: 2 Repeat P-1 for an empty map, a map of string keys using a
+        //:   caching hasher, and a map stopped while its incremental rehash
+        //:   is in progress.  (C-4)
+        //:
+        //: 3 Use a test allocator to verify no memory is allocated by the
+        //:   map during the calls.  (C-5)
+        //
+        // Testing:
+        //   void findBatch(iterator *, const key_type *, size_type);
+        //   void findBatch(const_iterator *, const key_type *, size_type) c;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'findBatch'"
+                            "\n===================\n");
+
+        const int NUM_KEYS     = 1000;
+        const int BATCH_SIZES[] = { 0, 1, 2, 15, 16, 17, 33, 64, 999, 1000 };
+        const int NUM_BATCH_SIZES =
+                               sizeof BATCH_SIZES / sizeof *BATCH_SIZES;
+
+        bsl::vector<int> keys(NUM_KEYS);
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            keys[i] = static_cast<int>(
+                        (static_cast<bsls::Types::Uint64>(i) * 2654435761u)
+                                                            % (2 * NUM_KEYS));
+        }
+
+        if (verbose) printf("Testing an empty map.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            bsl::unordered_map<int, int> mX(&oa);
+
+            for (int ti = 0; ti < NUM_BATCH_SIZES; ++ti) {
+                ASSERTV(BATCH_SIZES[ti],
+                        findBatchMatchesFind(&mX, &keys[0], BATCH_SIZES[ti]));
+            }
+            ASSERTV(oa.numBlocksTotal(), 0 == oa.numBlocksTotal());
+        }
+
+        if (verbose) printf("Testing maps of each policy.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            bsl::unordered_map<int, int>                     mP(&oa);
+            bsl::unordered_map<int, int, IncrementalIntHash> mI(&oa);
+
+            for (int i = 0; i < 2 * NUM_KEYS; i += 2) {
+                mP[i] = i;
+            }
+
+            // Stop filling 'mI' as soon as it grows beyond 512 elements,
+            // leaving its incremental rehash in progress.
+
+            int numInserted = 0;
+            for (int i = 0; i < 2 * NUM_KEYS; i += 2) {
+                const native_std::size_t numBuckets = mI.bucket_count();
+                mI[i] = i;
+                ++numInserted;
+                if (mI.size() > 512 && mI.bucket_count() != numBuckets) {
+                    break;
+                }
+            }
+            ASSERTV(numInserted, numInserted < NUM_KEYS);
+
+            const bsls::Types::Int64 BLOCKS = oa.numBlocksTotal();
+
+            for (int ti = 0; ti < NUM_BATCH_SIZES; ++ti) {
+                const int N = BATCH_SIZES[ti];
+
+                ASSERTV(N, findBatchMatchesFind(&mP, &keys[0], N));
+                ASSERTV(N, findBatchMatchesFind(&mI, &keys[0], N));
+            }
+
+            ASSERTV(BLOCKS, oa.numBlocksTotal(),
+                    BLOCKS == oa.numBlocksTotal());
+
+            // Spot check the results against the known contents.
+
+            bsl::unordered_map<int, int>::iterator results[17];
+            mP.findBatch(results, &keys[0], 17);
+            for (int i = 0; i < 17; ++i) {
+                if (keys[i] % 2) {
+                    ASSERTV(i, mP.end() == results[i]);
+                }
+                else {
+                    ASSERTV(i, mP.end() != results[i]);
+                    ASSERTV(i, keys[i] == results[i]->second);
+                }
+            }
+        }
+
+        if (verbose) printf("Testing cached hash codes.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            bsl::vector<bsl::string> stringKeys(NUM_KEYS);
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                makeKey(&stringKeys[i], keys[i], "batched-lookup-key");
+            }
+
+            bsl::unordered_map<bsl::string, int, CachingStringHash> mX(&oa);
+            for (int i = 0; i < NUM_KEYS; i += 3) {
+                mX[stringKeys[i]] = i;
+            }
+
+            const bsls::Types::Int64 BLOCKS = oa.numBlocksTotal();
+
+            for (int ti = 0; ti < NUM_BATCH_SIZES; ++ti) {
+                const int N = BATCH_SIZES[ti];
+
+                ASSERTV(N, findBatchMatchesFind(&mX, &stringKeys[0], N));
+            }
+
+            ASSERTV(BLOCKS, oa.numBlocksTotal(),
+                    BLOCKS == oa.numBlocksTotal());
+        }
+      } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING INCREMENTAL REHASH POLICY
+        //
+        // Concerns:
+        //: 1 'HashTableRehashesIncrementally' is 'true' for a hash functor
+        //:   declaring the trait, and 'false' for other hash functors.
+        //:
+        //: 2 An insertion into a map whose hash functor declares the trait
+        //:   calls the hash functor a bounded number of times, independent of
+        //:   the size of the map, even when the bucket array grows.
+        //:
+        //: 3 While a rehash is in progress, every element can be found, and
+        //:   iteration visits every element exactly once.
+        //:
+        //: 4 While a rehash is in progress, erasing elements does not
+        //:   invalidate iterators to, or change the iteration order of, the
+        //:   remaining elements.
+        //:
+        //: 5 Copying, swapping, clearing, and explicitly rehashing a map
+        //:   whose rehash is in progress behave as for any other map, and no
+        //:   memory is leaked.
+        //:
+        //: 6 Only a map whose hash functor declares the trait is enlarged by
+        //:   the state of an incremental rehash.
+        //:
+        //: 7 While a rehash is in progress, 'bucket_size' counts, and the
+        //:   local iterators of a 'const' map visit, without modifying the
+        //:   map, every element in the bucket returned by 'bucket' for its
+        //:   key, and obtaining a local iterator from a non-'const' map
+        //:   completes the rehash, releasing the old bucket array without
+        //:   changing the number of buckets, after which iterating over the
+        //:   bucket returned by 'bucket' for a key finds that key.
+        //:
+        //: 8 An insertion that grows the bucket array of a map whose hash
+        //:   functor declares the trait does not allocate the new array, which
+        //:   has been allocated (and cleared) by earlier insertions.
+        //
+        // Plan:
+        //: 1 Test the trait for a functor declaring it, and for
+        //:   'bsl::hash<bsl::string>'.  (C-1)
+        //:
+        //: 2 Using a counting hash functor, insert 'N' distinct keys into maps
+        //:   with and without the trait, recording the maximum number of calls
+        //:   to the hash functor made by a single insertion, and verify that
+        //:   the maximum is small with the trait, and large without it.
+        //:   (C-2)
+        //:
+        //: 3 Insert keys into a map having the trait until its bucket array
+        //:   grows, so that a rehash is in progress, and verify its contents
+        //:   by both lookup and iteration.  Continue to insert keys, verifying
+        //:   the contents after each insertion.  (C-3)
+        //:
+        //: 4 Bring a map having the trait to the start of a rehash, and erase
+        //:   every element having an odd value while iterating over the map,
+        //:   then verify the remaining contents.  (C-4)
+        //:
+        //: 5 Bring a map having the trait to the start of a rehash, then copy,
+        //:   swap, explicitly rehash, and clear it, verifying the contents of
+        //:   each map after each operation, and verify that all memory is
+        //:   returned to the object allocator.  (C-5)
+        //:
+        //: 6 Compare the footprints of maps with and without the trait, whose
+        //:   hash functors are otherwise identical, empty types.  (C-6)
+        //:
+        //: 7 Bring a map having the trait to the start of a rehash, count the
+        //:   keys for which 'bucket' returns each index, and verify that
+        //:   'bucket_size' returns that count for every bucket, and that
+        //:   iterating over each bucket with the 'const' 'begin', 'end',
+        //:   'cbegin', and 'cend' methods visits that many elements, each of
+        //:   whose keys 'bucket' assigns to that bucket, without releasing the
+        //:   old bucket array.  Call the
+        //:   non-'const' 'begin' for a bucket, and verify that the old bucket
+        //:   array is released, that the number of buckets is unchanged, that
+        //:   'bucket_size' is unchanged, and that every element is found by
+        //:   iterating over the bucket returned by 'bucket' for its key.
+        //:   (C-7)
+        //:
+        //: 8 Insert 'N' distinct keys into a map having the trait, and verify
+        //:   that each insertion that increases the number of buckets
+        //:   allocates fewer bytes than the new bucket array occupies.  (C-8)
+        //
+        // Testing:
+        //   CONCERN: 'HashTableRehashesIncrementally' bounds insertion cost
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING INCREMENTAL REHASH POLICY"
+                            "\n=================================\n");
+
+        typedef bsl::unordered_map<bsl::string,
+                                   int,
+                                   IncrementalCountingStringHash,
+                                   CountingStringEqual>     IncrementalMap;
+        typedef bsl::unordered_map<bsl::string,
+                                   int,
+                                   CountingStringHash,
+                                   CountingStringEqual>     PlainMap;
+
+        if (verbose) printf("\tTesting the trait.\n");
+        {
+            ASSERT( bslstl::HashTableRehashesIncrementally<
+                                      IncrementalCountingStringHash>::value);
+            ASSERT( bslstl::HashTableRehashesIncrementally<
+                                                 IncrementalIntHash>::value);
+            ASSERT(!bslstl::HashTableRehashesIncrementally<
+                                                 CountingStringHash>::value);
+            ASSERT(!bslstl::HashTableRehashesIncrementally<
+                                             bsl::hash<bsl::string> >::value);
+        }
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int N = 20000;
+
+        bsl::vector<bsl::string> keys(&oa);
+        keys.resize(N);
+        for (int i = 0; i < N; ++i) {
+            makeKey(&keys[i], i, "incremental");
+        }
+        const bsls::Types::Int64 NUM_KEY_BLOCKS = oa.numBlocksInUse();
+
+        if (verbose) printf("\tTesting calls to the hash functor.\n");
+        {
+            // Each insertion hashes its own key, and the elements of the
+            // bucket holding that key and of a fixed number of other buckets.
+
+            const int MAX_CALLS_PER_INSERT = 64;
+
+            IncrementalMap mX(&oa);  const IncrementalMap& X = mX;
+            PlainMap       mY(&oa);  const PlainMap&       Y = mY;
+
+            int maxCallsX = 0;
+            int maxCallsY = 0;
+            for (int i = 0; i < N; ++i) {
+                numHashCalls = 0;
+                mX[keys[i]] = i;
+                maxCallsX = native_std::max(maxCallsX, numHashCalls);
+
+                numHashCalls = 0;
+                mY[keys[i]] = i;
+                maxCallsY = native_std::max(maxCallsY, numHashCalls);
+            }
+
+            if (veryVerbose) { P_(maxCallsX) P(maxCallsY) }
+
+            ASSERTV(maxCallsX, MAX_CALLS_PER_INSERT >= maxCallsX);
+            ASSERTV(maxCallsY, N / 4 < maxCallsY);
+
+            ASSERT(hasExactlyKeys(X, keys, N, 1));
+            ASSERT(hasExactlyKeys(Y, keys, N, 1));
+            ASSERTV(X.load_factor(), X.max_load_factor(),
+                    X.load_factor() <= X.max_load_factor());
+        }
+        ASSERTV(oa.numBlocksInUse(), NUM_KEY_BLOCKS == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting allocation of the bucket array.\n");
+        {
+            IncrementalMap mX(&oa);  const IncrementalMap& X = mX;
+
+            int numGrowths = 0;
+            for (int i = 0; i < N; ++i) {
+                const native_std::size_t numBuckets = X.bucket_count();
+                const bsls::Types::Int64 numBytes   = oa.numBytesTotal();
+
+                mX[keys[i]] = i;
+
+                if (X.bucket_count() != numBuckets && 1000 < numBuckets) {
+                    const bsls::Types::Int64 arrayBytes =
+                                           X.bucket_count()
+                                         * sizeof(bslalg::HashTableBucket);
+
+                    ASSERTV(i, oa.numBytesTotal() - numBytes, arrayBytes,
+                            oa.numBytesTotal() - numBytes < arrayBytes);
+                    ++numGrowths;
+                }
+            }
+            ASSERTV(numGrowths, 0 < numGrowths);
+            ASSERT(hasExactlyKeys(X, keys, N, 1));
+        }
+        ASSERTV(oa.numBlocksInUse(), NUM_KEY_BLOCKS == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting lookup and iteration.\n");
+        {
+            IncrementalMap mX(&oa);  const IncrementalMap& X = mX;
+
+            int n = fillUntilGrowth(&mX, keys, 1000);
+            ASSERTV(n, 0 < n);
+            ASSERT(hasExactlyKeys(X, keys, n, 1));
+
+            for (; n < N; ++n) {
+                mX[keys[n]] = n;
+
+                ASSERTV(n, X.end() != X.find(keys[n]));
+                ASSERTV(n, 1       == X.count(keys[n / 2]));
+                ASSERTV(n, n + 1   == static_cast<int>(X.size()));
+
+                if (0 == n % 997) {
+                    ASSERTV(n, hasExactlyKeys(X, keys, n + 1, 1));
+                }
+            }
+            ASSERT(hasExactlyKeys(X, keys, N, 1));
+        }
+
+        if (verbose) printf("\tTesting erasure while iterating.\n");
+        {
+            IncrementalMap mX(&oa);  const IncrementalMap& X = mX;
+
+            const int n = fillUntilGrowth(&mX, keys, 1000);
+            ASSERTV(n, 0 < n);
+
+            int numErased = 0;
+            for (IncrementalMap::iterator it = mX.begin(); it != mX.end(); ) {
+                if (it->second % 2) {
+                    it = mX.erase(it);
+                    ++numErased;
+                }
+                else {
+                    ++it;
+                }
+            }
+            ASSERTV(n, numErased, n / 2 == numErased);
+            ASSERT(hasExactlyKeys(X, keys, n, 2));
+
+            for (int i = 0; i < n; i += 2) {
+                ASSERTV(i, 1 == mX.erase(keys[i]));
+            }
+            ASSERT(X.empty());
+            ASSERT(X.begin() == X.end());
+        }
+
+        if (verbose) printf("\tTesting copy, swap, rehash, and clear.\n");
+        {
+            IncrementalMap mX(&oa);  const IncrementalMap& X = mX;
+
+            const int n = fillUntilGrowth(&mX, keys, 1000);
+            ASSERTV(n, 0 < n);
+
+            {
+                IncrementalMap mZ(X, &oa);  const IncrementalMap& Z = mZ;
+                ASSERT(hasExactlyKeys(Z, keys, n, 1));
+                ASSERT(X == Z);
+
+                mZ = X;
+                ASSERT(hasExactlyKeys(Z, keys, n, 1));
+            }
+
+            {
+                IncrementalMap mW(&oa);  const IncrementalMap& W = mW;
+                mW.swap(mX);
+                ASSERT(X.empty());
+                ASSERT(hasExactlyKeys(W, keys, n, 1));
+
+                mW.swap(mX);
+                ASSERT(W.empty());
+                ASSERT(hasExactlyKeys(X, keys, n, 1));
+            }
+
+            const native_std::size_t numBuckets = X.bucket_count();
+            mX.rehash(2 * numBuckets);
+            ASSERTV(numBuckets, X.bucket_count(),
+                    2 * numBuckets <= X.bucket_count());
+            ASSERT(hasExactlyKeys(X, keys, n, 1));
+
+            mX.clear();
+            ASSERT(X.empty());
+
+            const int m = fillUntilGrowth(&mX, keys, 1000);
+            ASSERTV(m, 0 < m);
+            ASSERT(hasExactlyKeys(X, keys, m, 1));
+
+            mX.clear();
+            ASSERT(X.empty());
+        }
+        ASSERTV(oa.numBlocksInUse(), NUM_KEY_BLOCKS == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting the footprint of the rehash state.\n");
+        {
+            ASSERTV(sizeof(PlainMap), sizeof(IncrementalMap),
+                    sizeof(PlainMap) + sizeof(bslalg::HashTableAnchor)
+                                     + sizeof(bslalg::HashTableBucket *)
+                                     + 3 * sizeof(native_std::size_t)
+                                                   == sizeof(IncrementalMap));
+        }
+
+        if (verbose) printf("\tTesting the bucket interface.\n");
+        {
+            IncrementalMap mX(&oa);  const IncrementalMap& X = mX;
+
+            const int n = fillUntilGrowth(&mX, keys, 1000);
+            ASSERTV(n, 0 < n);
+
+            const native_std::size_t numBuckets = X.bucket_count();
+
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+            bsl::vector<native_std::size_t> counts(numBuckets, 0, &sa);
+            for (int i = 0; i < n; ++i) {
+                ++counts[X.bucket(keys[i])];
+            }
+            for (native_std::size_t i = 0; i < numBuckets; ++i) {
+                ASSERTV(i, counts[i], X.bucket_size(i),
+                        counts[i] == X.bucket_size(i));
+            }
+
+            const bsls::Types::Int64 numBlocks = oa.numBlocksInUse();
+
+            for (native_std::size_t i = 0; i < numBuckets; ++i) {
+                native_std::size_t numVisited = 0;
+                for (IncrementalMap::const_local_iterator it = X.begin(i);
+                                                       it != X.end(i); ++it) {
+                    ASSERTV(i, X.bucket(it->first), i == X.bucket(it->first));
+                    ++numVisited;
+                }
+                ASSERTV(i, counts[i], numVisited, counts[i] == numVisited);
+
+                numVisited = 0;
+                for (IncrementalMap::const_local_iterator it = X.cbegin(i);
+                                                      it != X.cend(i); ++it) {
+                    ++numVisited;
+                }
+                ASSERTV(i, counts[i], numVisited, counts[i] == numVisited);
+            }
+            ASSERTV(numBlocks, oa.numBlocksInUse(),
+                    numBlocks == oa.numBlocksInUse());
+
+            mX.begin(0);
+            ASSERTV(numBlocks, oa.numBlocksInUse(),
+                    numBlocks - 1 == oa.numBlocksInUse());
+            ASSERTV(numBuckets, X.bucket_count(),
+                    numBuckets == X.bucket_count());
+            ASSERT(hasExactlyKeys(X, keys, n, 1));
+
+            for (native_std::size_t i = 0; i < numBuckets; ++i) {
+                ASSERTV(i, counts[i], X.bucket_size(i),
+                        counts[i] == X.bucket_size(i));
+            }
+
+            for (int i = 0; i < n; ++i) {
+                const native_std::size_t b = X.bucket(keys[i]);
+
+                bool found = false;
+                for (IncrementalMap::const_local_iterator it = X.begin(b);
+                                                       it != X.end(b); ++it) {
+                    found = found || keys[i] == it->first;
+                }
+                ASSERTV(i, found);
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), NUM_KEY_BLOCKS == oa.numBlocksInUse());
+      } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING CACHED HASH CODE POLICY
+        //
+        // Concerns:
+        //: 1 'HashTableCachesHashCodes' is 'true' for a hash functor declaring
+        //:   the trait, and 'false' for other hash functors.
+        //:
+        //: 2 A map whose hash functor declares the trait calls the hash
+        //:   functor exactly once per inserted key, and never when its bucket
+        //:   array grows, when it is copied, or when it is rehashed.
+        //:
+        //: 3 Erasing an element by key calls the hash functor exactly once.
+        //:
+        //: 4 A successful 'find' calls the comparator only for elements having
+        //:   the same hash code as the key, and an unsuccessful 'find' does
+        //:   not call the comparator unless the hash code of the key collides
+        //:   with that of an element.
+        //:
+        //: 5 The value of a map is not affected by the policy.
+        //
+        // Plan:
+        //: 1 Test the trait for a functor declaring it, and for
+        //:   'bsl::hash<bsl::string>'.  (C-1)
+        //:
+        //: 2 Using a counting hash functor and a counting comparator, insert
+        //:   'N' distinct keys into maps with and without the trait, and
+        //:   verify the number of calls to the hash functor.  (C-2)
+        //:
+        //: 3 Copy and rehash the map having the trait, and verify that the
+        //:   hash functor is not called.  (C-2)
+        //:
+        //: 4 Find each key, and 'N' absent keys, and verify the number of
+        //:   calls to the comparator.  (C-4)
+        //:
+        //: 5 Erase half of the keys, and verify the number of calls to the
+        //:   hash functor, and the contents of the maps.  (C-3, 5)
+        //
+        // Testing:
+        //   CONCERN: 'HashTableCachesHashCodes' avoids redundant hash/compare
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CACHED HASH CODE POLICY"
+                            "\n===============================\n");
+
+        typedef bsl::unordered_map<bsl::string,
+                                   int,
+                                   CachingCountingStringHash,
+                                   CountingStringEqual>     CachingMap;
+        typedef bsl::unordered_map<bsl::string,
+                                   int,
+                                   CountingStringHash,
+                                   CountingStringEqual>     PlainMap;
+
+        if (verbose) printf("\tTesting the trait.\n");
+        {
+            ASSERT( bslstl::HashTableCachesHashCodes<
+                                          CachingCountingStringHash>::value);
+            ASSERT(!bslstl::HashTableCachesHashCodes<
+                                                 CountingStringHash>::value);
+            ASSERT(!bslstl::HashTableCachesHashCodes<
+                                             bsl::hash<bsl::string> >::value);
+        }
+
+        if (verbose) printf("\tTesting calls to the functors.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            const int N = 2000;
+
+            bsl::vector<bsl::string> keys(&oa);
+            bsl::vector<bsl::string> absentKeys(&oa);
+            keys.resize(N);
+            absentKeys.resize(N);
+            for (int i = 0; i < N; ++i) {
+                makeKey(&keys[i],       i, "a-long-prefix-present");
+                makeKey(&absentKeys[i], i, "a-long-prefix-absent");
+            }
+
+            CachingMap mX(&oa);  const CachingMap& X = mX;
+            PlainMap   mY(&oa);  const PlainMap&   Y = mY;
+
+            numHashCalls = 0;
+            for (int i = 0; i < N; ++i) {
+                mX[keys[i]] = i;
+            }
+            ASSERTV(numHashCalls, N == numHashCalls);
+
+            numHashCalls = 0;
+            for (int i = 0; i < N; ++i) {
+                mY[keys[i]] = i;
+            }
+            ASSERTV(numHashCalls, N < numHashCalls);
+
+            numHashCalls = 0;
+            {
+                CachingMap mZ(X, &oa);  const CachingMap& Z = mZ;
+                ASSERTV(numHashCalls, 0 == numHashCalls);
+
+                mZ.rehash(4 * X.bucket_count());
+                ASSERTV(numHashCalls, 0 == numHashCalls);
+                ASSERTV(Z.bucket_count(), 4 * X.bucket_count() <=
+                                                             Z.bucket_count());
+                ASSERTV(X == Z);
+            }
+            numHashCalls = 0;
+
+            numCompareCalls = 0;
+            for (int i = 0; i < N; ++i) {
+                CachingMap::const_iterator it = X.find(keys[i]);
+                ASSERTV(i, X.end() != it);
+                ASSERTV(i, i == it->second);
+            }
+            ASSERTV(numHashCalls, N == numHashCalls);
+            ASSERTV(numCompareCalls, N == numCompareCalls);
+
+            numCompareCalls = 0;
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(i, X.end() == X.find(absentKeys[i]));
+            }
+            ASSERTV(numCompareCalls, 0 == numCompareCalls);
+
+            // Without cached hash codes, the comparator is called for each
+            // element in the bucket of an absent key.
+
+            numCompareCalls = 0;
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(i, Y.end() == Y.find(absentKeys[i]));
+            }
+            ASSERTV(numCompareCalls, 0 < numCompareCalls);
+
+            numHashCalls = 0;
+            for (int i = 0; i < N; i += 2) {
+                ASSERTV(i, 1 == mX.erase(keys[i]));
+            }
+            ASSERTV(numHashCalls, N / 2 == numHashCalls);
+
+            for (int i = 0; i < N; i += 2) {
+                ASSERTV(i, 1 == mY.erase(keys[i]));
+            }
+
+            ASSERTV(X.size(), N / 2 == static_cast<int>(X.size()));
+            ASSERTV(Y.size(), N / 2 == static_cast<int>(Y.size()));
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(i, (i % 2) == static_cast<int>(X.count(keys[i])));
+                ASSERTV(i, (i % 2) == static_cast<int>(Y.count(keys[i])));
+            }
+            for (PlainMap::const_iterator it = Y.begin(); it != Y.end();
+                                                                        ++it) {
+                CachingMap::const_iterator xIt = X.find(it->first);
+                ASSERTV(X.end() != xIt);
+                ASSERTV(xIt->second == it->second);
+            }
+        }
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // GROWING FUNCTIONS
@@ -10018,6 +11255,200 @@ int main(int argc, char *argv[])
         if (veryVerbose)
             printf("Final message to confim the end of the breathing test.\n");
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Provide a benchmark comparing insertion, successful lookup,
+        //:   unsuccessful lookup, and copying of string-keyed maps having
+        //:   many elements, with and without cached hash codes.
+        //
+        // Plan:
+        //: 1 Using 'bsls_stopwatch', time each operation on maps of
+        //:   increasing size (up to the optional second argument, 1M by
+        //:   default), and report the results.  These values should only be
+        //:   used as a comparison across the two policies and versions.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: string keys, with and without cached hash codes
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE TEST"
+               "\n================\n");
+
+        const int MAX_N = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        typedef bsl::unordered_map<bsl::string, int>                PlainMap;
+        typedef bsl::unordered_map<bsl::string, int, CachingStringHash>
+                                                                    CachingMap;
+
+        bslma::Allocator *ma = &bslma::MallocFreeAllocator::singleton();
+
+        printf("%8s %7s %10s %10s %10s %10s\n",
+               "N", "cached", "insert", "hit", "miss", "copy");
+
+        for (int n = 1000; n <= MAX_N; n *= 10) {
+            bsl::vector<bsl::string> keys(ma);
+            bsl::vector<bsl::string> absentKeys(ma);
+            keys.resize(n);
+            absentKeys.resize(n);
+            for (int i = 0; i < n; ++i) {
+                makeKey(&keys[i],       i, "benchmark-key-present");
+                makeKey(&absentKeys[i], i, "benchmark-key-absent");
+            }
+
+            for (int cached = 0; cached < 2; ++cached) {
+                long   checksum = 0;
+                double times[4];
+
+                if (cached) {
+                    CachingMap map(ma);
+                    times[0] = timeInsertions(&map, keys);
+                    times[1] = timeLookups(&checksum, map, keys);
+                    times[2] = timeLookups(&checksum, map, absentKeys);
+                    times[3] = timeCopy(map);
+                }
+                else {
+                    PlainMap map(ma);
+                    times[0] = timeInsertions(&map, keys);
+                    times[1] = timeLookups(&checksum, map, keys);
+                    times[2] = timeLookups(&checksum, map, absentKeys);
+                    times[3] = timeCopy(map);
+                }
+
+                ASSERTV(n, checksum, n == checksum);
+
+                printf("%8d %7s %10.4f %10.4f %10.4f %10.4f\n",
+                       n, cached ? "yes" : "no",
+                       times[0], times[1], times[2], times[3]);
+            }
+        }
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: INSERTION LATENCY
+        //
+        // Concerns:
+        //: 1 Provide a benchmark comparing the distribution of the latency of
+        //:   individual insertions into a growing map, with and without
+        //:   incremental rehashing.
+        //
+        // Plan:
+        //: 1 Using 'bsls::TimeUtil', time each insertion of distinct 'int'
+        //:   keys into an initially empty map, for maps of increasing size (up
+        //:   to the optional second argument, 4M by default), and report the
+        //:   median, 99th, 99.9th, and 99.99th percentile, and maximum latency
+        //:   of an insertion, and the maximum latency of an insertion that
+        //:   grew the bucket array.  These values should only be used as a
+        //:   comparison across the two policies and versions.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: insertion latency, incremental vs. full rehash
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE TEST: INSERTION LATENCY"
+               "\n===================================\n");
+
+        const int MAX_N = argc > 2 ? atoi(argv[2]) : 4000000;
+
+        typedef bsl::unordered_map<int, int>                     PlainMap;
+        typedef bsl::unordered_map<int, int, IncrementalIntHash>
+                                                                IncrementalMap;
+
+        bsl::vector<bsls::Types::Int64> latencies(
+                                     &bslma::MallocFreeAllocator::singleton());
+
+        printf("%8s %12s %8s %8s %8s %8s %10s %10s  (nanoseconds)\n",
+               "N", "incremental", "p50", "p99", "p99.9", "p99.99", "max",
+               "max grow");
+
+        for (int n = 10000; n <= MAX_N; n *= 20) {
+            for (int incremental = 0; incremental < 2; ++incremental) {
+                bsls::Types::Int64 maxGrowLatency;
+                if (incremental) {
+                    measureInsertLatencies<IncrementalMap>(&latencies,
+                                                           &maxGrowLatency,
+                                                           n);
+                }
+                else {
+                    measureInsertLatencies<PlainMap>(&latencies,
+                                                     &maxGrowLatency,
+                                                     n);
+                }
+
+                printf("%8d %12s %8lld %8lld %8lld %8lld %10lld %10lld\n",
+                       n, incremental ? "yes" : "no",
+                       latencies[n / 2],
+                       latencies[n - n / 100],
+                       latencies[n - n / 1000],
+                       latencies[n - n / 10000],
+                       latencies[n - 1],
+                       maxGrowLatency);
+            }
+        }
+      } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: BATCHED LOOKUP
+        //
+        // Concerns:
+        //: 1 Provide a benchmark comparing 'findBatch' with a loop of 'find'
+        //:   calls, for maps too large to fit in cache.
+        //
+        // Plan:
+        //: 1 Using 'bsls_stopwatch', time the lookup of every key of maps of
+        //:   increasing size (up to the optional second argument, 4M by
+        //:   default), in a scattered order, both one 'find' at a time and
+        //:   in batches of 16 and 64 keys, and report the results.  Half of
+        //:   the keys searched for are absent.  These values should only be
+        //:   used as a comparison across the two approaches and versions.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: 'findBatch' vs. 'find' on out-of-cache maps
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE TEST: BATCHED LOOKUP"
+               "\n================================\n");
+
+        const int MAX_N = argc > 2 ? atoi(argv[2]) : 4000000;
+
+        typedef bsl::unordered_map<int, int> Map;
+
+        bslma::Allocator *ma = &bslma::MallocFreeAllocator::singleton();
+
+        printf("%8s %10s %10s %10s %8s %8s  (seconds)\n",
+               "N", "find", "batch16", "batch64", "x16", "x64");
+
+        for (int n = 1000; n <= MAX_N; n *= 4) {
+            Map map(ma);
+            for (int i = 0; i < n; ++i) {
+                map[2 * i] = i;
+            }
+
+            bsl::vector<int> keys(ma);
+            keys.resize(2 * n);
+            for (int i = 0; i < 2 * n; ++i) {
+                keys[i] = static_cast<int>(
+                          (static_cast<bsls::Types::Uint64>(i) * 2654435761u)
+                                                                   % (2 * n));
+            }
+
+            long checksums[3] = { 0, 0, 0 };
+
+            const double tFind = timeFindLoop(&checksums[0], map, keys);
+            const double t16 = timeFindBatch(&checksums[1], map, keys, 16);
+            const double t64 = timeFindBatch(&checksums[2], map, keys, 64);
+
+            ASSERTV(checksums[0], checksums[1], checksums[0] == checksums[1]);
+            ASSERTV(checksums[0], checksums[2], checksums[0] == checksums[2]);
+
+            printf("%8d %10.4f %10.4f %10.4f %8.2f %8.2f\n",
+                   n, tFind, t16, t64,
+                   t16 > 0 ? tFind / t16 : 0.0,
+                   t64 > 0 ? tFind / t64 : 0.0);
+        }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
@@ -1324,7 +1324,9 @@ unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::begin(
 {
     BSLS_ASSERT_SAFE(index < this->bucket_count());
 
-    return const_local_iterator(&d_impl.bucketAtIndex(index));
+    return const_local_iterator(&d_impl.bucketAtIndex(index),
+                                d_impl.nextNodeInBucketFunction(),
+                                &d_impl);
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
@@ -1348,7 +1350,9 @@ unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::cbegin(
 {
     BSLS_ASSERT_SAFE(index < this->bucket_count());
 
-    return const_local_iterator(&d_impl.bucketAtIndex(index));
+    return const_local_iterator(&d_impl.bucketAtIndex(index),
+                                d_impl.nextNodeInBucketFunction(),
+                                &d_impl);
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
@@ -60,6 +60,7 @@ using namespace BloombergLP;
 //-----------------------------------------------------------------------------
 // [1] BREATHING TEST
 // [2] USAGE EXAMPLE
+// [17] CONCERN: 'HashTableRehashesIncrementally' keeps key ranges intact
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -5506,6 +5507,63 @@ void testErase(CONTAINER& mX)
 
 }  // close namespace BREATING_TEST
 
+// ============================================================================
+//                     INCREMENTAL REHASH POLICY SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct IncrementalIntHash {
+    // This hash functor returns the 'bsl::hash' of its 'int' argument, and
+    // selects the incremental rehash policy of the underlying hash table.
+
+    BSLMF_NESTED_TRAIT_DECLARATION(IncrementalIntHash,
+                                   bslstl::HashTableRehashesIncrementally);
+
+    native_std::size_t operator()(int key) const
+        // Return the hash code of the specified 'key'.
+    {
+        return bsl::hash<int>()(key);
+    }
+};
+
+template <class MULTIMAP>
+bool hasExpectedRanges(const MULTIMAP& multimap, int numInserted, int numKeys)
+    // Return 'true' if, for each key 'k' in '[0, numKeys)', the specified
+    // 'multimap' holds, in a contiguous range, exactly one element '(k, v)'
+    // for each 'v' in '[0, numInserted)' such that 'v % numKeys == k', and
+    // 'false' otherwise.
+{
+    typedef typename MULTIMAP::const_iterator Iterator;
+
+    native_std::size_t numSeen = 0;
+    for (int k = 0; k < numKeys; ++k) {
+        const int expected = k < numInserted
+                           ? (numInserted - 1 - k) / numKeys + 1
+                           : 0;
+
+        bsl::pair<Iterator, Iterator> range = multimap.equal_range(k);
+
+        int count = 0;
+        for (; range.first != range.second; ++range.first, ++count) {
+            if (k != range.first->first
+             || k != range.first->second % numKeys) {
+                return false;                                         // RETURN
+            }
+        }
+        if (expected != count) {
+            return false;                                             // RETURN
+        }
+        numSeen += count;
+    }
+
+    return numSeen == multimap.size()
+        && numSeen == static_cast<native_std::size_t>(
+                            bsl::distance(multimap.begin(), multimap.end()));
+}
+
+}  // close unnamed namespace
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -5524,7 +5582,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&testAlloc);
 
     switch (test) { case 0:
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -5547,6 +5605,105 @@ int main(int argc, char *argv[])
             usage();
         }
       } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING INCREMENTAL REHASH POLICY
+        //
+        // Concerns:
+        //: 1 While an incremental rehash is in progress, the elements having
+        //:   equivalent keys form a contiguous range, whether inserted with
+        //:   or without a hint.
+        //:
+        //: 2 Erasing a range of equivalent keys while an incremental rehash is
+        //:   in progress removes exactly those elements.
+        //:
+        //: 3 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Using a hash functor declaring the
+        //:   'HashTableRehashesIncrementally' trait, insert many elements
+        //:   having a small number of distinct keys, alternating between
+        //:   insertion with and without a hint, and verify the range of each
+        //:   key after each insertion that grows the bucket array, and after
+        //:   a number of subsequent insertions.  (C-1)
+        //:
+        //: 2 Erase the range of every other key after each growth of the
+        //:   bucket array of a second multimap, and verify the contents.
+        //:   (C-2)
+        //:
+        //: 3 Verify that all memory is returned to the object allocator.
+        //:   (C-3)
+        //
+        // Testing:
+        //   CONCERN: 'HashTableRehashesIncrementally' keeps key ranges intact
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING INCREMENTAL REHASH POLICY"
+                            "\n=================================\n");
+
+        typedef bsl::unordered_multimap<int, int, IncrementalIntHash> Obj;
+
+        const int NUM_KEYS     = 3001;
+        const int NUM_ELEMENTS = 40000;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting insertion.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            int checkUntil = -1;
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                const native_std::size_t numBuckets = X.bucket_count();
+
+                // Note that a hint must refer to an element of the multimap.
+
+                const int key = i % NUM_KEYS;
+                if (i % 2 || X.empty()) {
+                    mX.insert(Obj::value_type(key, i));
+                }
+                else {
+                    Obj::iterator hint = mX.find(key);
+                    mX.insert(X.end() == hint ? mX.begin() : hint,
+                              Obj::value_type(key, i));
+                }
+
+                if (X.bucket_count() != numBuckets) {
+                    checkUntil = i + 64;
+                }
+                if (i <= checkUntil && 0 == i % 8) {
+                    ASSERTV(i, hasExpectedRanges(X, i + 1, NUM_KEYS));
+                }
+            }
+            ASSERT(hasExpectedRanges(X, NUM_ELEMENTS, NUM_KEYS));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting erasure.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            native_std::size_t numErased = 0;
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                const native_std::size_t numBuckets = X.bucket_count();
+
+                mX.insert(Obj::value_type(i % NUM_KEYS, i));
+
+                if (X.bucket_count() != numBuckets) {
+                    for (int k = 0; k < NUM_KEYS; k += 2) {
+                        numErased += mX.erase(k);
+                        ASSERTV(i, k, X.end() == X.find(k));
+                    }
+                    ASSERTV(i, numErased + X.size() == i + 1u);
+
+                    for (int k = 1; k < NUM_KEYS && k <= i; k += 2) {
+                        ASSERTV(i, k, (i - k) / NUM_KEYS + 1u == X.count(k));
+                    }
+                }
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // GROWING FUNCTIONS
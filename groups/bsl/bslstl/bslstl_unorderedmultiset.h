@@ -1436,7 +1436,9 @@ unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::begin(size_type index) const
 {
     BSLS_ASSERT_SAFE(index < this->bucket_count());
 
-    return const_local_iterator(&d_impl.bucketAtIndex(index));
+    return const_local_iterator(&d_impl.bucketAtIndex(index),
+                                d_impl.nextNodeInBucketFunction(),
+                                &d_impl);
 }
 
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
@@ -1459,7 +1461,9 @@ unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::cbegin(size_type index) const
 {
     BSLS_ASSERT_SAFE(index < this->bucket_count());
 
-    return const_local_iterator(&d_impl.bucketAtIndex(index));
+    return const_local_iterator(&d_impl.bucketAtIndex(index),
+                                d_impl.nextNodeInBucketFunction(),
+                                &d_impl);
 }
 
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
@@ -261,6 +261,13 @@ BSLS_IDENT("$Id: $")
 // other unordered containers) is the choice of hash function.  Please see
 // the discussion in {'bslstl_unorderedmap'|Practical Requirements on 'HASH'}.
 //
+///Heterogeneous Lookup
+///--------------------
+// As for 'bsl::unordered_map', if both the 'HASH' and the 'EQUAL' functors of
+// an unordered set are transparent, then 'find', 'count', and 'equal_range'
+// also accept a key of any type that both functors can be invoked with (see
+// {'bslstl_unorderedmap'|Heterogeneous Lookup}).
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -561,6 +568,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslmf_isbitwisemoveable.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRANSPARENT
+#include <bslmf_istransparent.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
 #include <bslmf_nestedtraitdeclaration.h>
 #endif
@@ -803,6 +814,28 @@ class unordered_set
         // same value.  Note that since a set maintains unique keys, the range
         // will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                                     pair<iterator, iterator>,
+                                                     HASH,
+                                                     EQUAL>::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this unordered set having a key
+        // equal to the specified 'key', where the first iterator is positioned
+        // at the start of the sequence, and the second is positioned one past
+        // the end of the sequence.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent (see
+        // {Heterogeneous Lookup}).
+    {
+        typedef bsl::pair<iterator, iterator> ResultType;
+
+        HashTableLink *first = d_impl.find(key);
+        return first
+             ? ResultType(iterator(first), iterator(first->nextLink()))
+             : ResultType(iterator(0),     iterator(0));
+    }
+
     size_type erase(const key_type& key);
         // Remove from this set the 'value_type' object having the specified
         // 'key', if it exists, and return 1; otherwise, if there is no
@@ -831,6 +864,33 @@ class unordered_set
         // object in this set having the specified 'key', if such an entry
         // exists, and the past-the-end ('end') iterator otherwise.
 
+    void findBatch(iterator       *results,
+                   const key_type *keys,
+                   size_type       numKeys);
+        // Load into each of the first specified 'numKeys' elements of the
+        // specified 'results' array the iterator that 'find' returns for the
+        // corresponding element of the specified 'keys' array.  The behavior
+        // is undefined unless 'results' and 'keys' each refer to an array of
+        // at least 'numKeys' elements.  Note that this method is typically
+        // faster than calling 'find' for each key of a large, out-of-cache
+        // set, as the memory accesses of the searches overlap.
+
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                                     iterator,
+                                                     HASH,
+                                                     EQUAL>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this unordered set having a key equal to the specified
+        // 'key', if such an entry exists, and the past-the-end iterator
+        // ('end') otherwise.  This method participates in overload resolution
+        // only if both 'HASH' and 'EQUAL' are transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        return iterator(d_impl.find(key));
+    }
+
     pair<iterator, bool> insert(const value_type& value);
         // Insert the specified 'value' into this set if the key (the 'first'
         // element) of the 'value' does not already exist in this set;
@@ -953,6 +1013,20 @@ class unordered_set
         // specified 'key'.  Note that since an unordered set maintains unique
         // keys, the returned value will be either 0 or 1.
 
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                                     size_type,
+                                                     HASH,
+                                                     EQUAL>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects contained within this
+        // unordered set having a key equal to the specified 'key'.  This
+        // method participates in overload resolution only if both 'HASH' and
+        // 'EQUAL' are transparent (see {Heterogeneous Lookup}).
+    {
+        return d_impl.find(key) != 0;
+    }
+
     bool empty() const;
         // Return 'true' if this set contains no elements, and 'false'
         // otherwise.
@@ -968,11 +1042,62 @@ class unordered_set
         // same value.  Note that since a set maintains unique keys, the range
         // will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<
+                                         LOOKUP_KEY,
+                                         pair<const_iterator, const_iterator>,
+                                         HASH,
+                                         EQUAL>::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this unordered set having a key
+        // equal to the specified 'key', where the first iterator is positioned
+        // at the start of the sequence, and the second is positioned one past
+        // the end of the sequence.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent (see
+        // {Heterogeneous Lookup}).
+    {
+        typedef bsl::pair<const_iterator, const_iterator> ResultType;
+
+        HashTableLink *first = d_impl.find(key);
+        return first
+             ? ResultType(const_iterator(first),
+                          const_iterator(first->nextLink()))
+             : ResultType(const_iterator(0), const_iterator(0));
+    }
+
     const_iterator find(const key_type& key) const;
         // Return an iterator providing non-modifiable access to the
         // 'value_type' object in this set having the specified 'key', if such
         // an entry exists, and the past-the-end ('end') iterator otherwise.
 
+    void findBatch(const_iterator *results,
+                   const key_type *keys,
+                   size_type       numKeys) const;
+        // Load into each of the first specified 'numKeys' elements of the
+        // specified 'results' array the iterator that 'find' returns for the
+        // corresponding element of the specified 'keys' array.  The behavior
+        // is undefined unless 'results' and 'keys' each refer to an array of
+        // at least 'numKeys' elements.  Note that this method is typically
+        // faster than calling 'find' for each key of a large, out-of-cache
+        // set, as the memory accesses of the searches overlap.
+
+    template <class LOOKUP_KEY>
+    typename BloombergLP::bslmf::EnableIfTransparent<LOOKUP_KEY,
+                                                     const_iterator,
+                                                     HASH,
+                                                     EQUAL>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this unordered set having a key equal to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // iterator ('end') otherwise.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent (see
+        // {Heterogeneous Lookup}).
+    {
+        return const_iterator(d_impl.find(key));
+    }
+
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
         // set.
@@ -1251,6 +1376,17 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
     return iterator(d_impl.find(key));
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::findBatch(
+                                                       iterator       *results,
+                                                       const key_type *keys,
+                                                       size_type       numKeys)
+{
+    d_impl.findBatch(results, keys, numKeys);
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 bsl::pair<typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator, bool>
@@ -1357,7 +1493,9 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::begin(size_type index) const
 {
     BSLS_ASSERT_SAFE(index < this->bucket_count());
 
-    return const_local_iterator(&d_impl.bucketAtIndex(index));
+    return const_local_iterator(&d_impl.bucketAtIndex(index),
+                                d_impl.nextNodeInBucketFunction(),
+                                &d_impl);
 }
 
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
@@ -1427,6 +1565,17 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key) const
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::findBatch(
+                                                 const_iterator *results,
+                                                 const key_type *keys,
+                                                 size_type       numKeys) const
+{
+    d_impl.findBatch(results, keys, numKeys);
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 bsl::pair<typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator,
@@ -1488,7 +1637,9 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::cbegin(size_type index) const
 {
     BSLS_ASSERT_SAFE(index < this->bucket_count());
 
-    return const_local_iterator(&d_impl.bucketAtIndex(index));
+    return const_local_iterator(&d_impl.bucketAtIndex(index),
+                                d_impl.nextNodeInBucketFunction(),
+                                &d_impl);
 }
 
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
@@ -19,8 +19,10 @@
 
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
+#include <bsls_types.h>
 #include <bsls_util.h>
 
+#include <bsltf_countedkey.h>
 #include <bsltf_stdtestallocator.h>
 #include <bsltf_templatetestfacility.h>
 #include <bsltf_testvaluesarray.h>
@@ -168,6 +170,13 @@ using namespace BloombergLP;
 //*[13] size_type count(const key_type& key) const;
 //*[13] bsl::pair<iterator, iterator> equal_range(const key_type& key);
 //*[13] bsl::pair<const_iter, const_iter> equal_range(const key_type&) const;
+// [29] void findBatch(iterator *, const key_type *, size_type);
+// [29] void findBatch(const_iterator *, const key_type *, size_type) const;
+// [30] iterator find(const LOOKUP_KEY& key);
+// [30] const_iterator find(const LOOKUP_KEY& key) const;
+// [30] size_type count(const LOOKUP_KEY& key) const;
+// [30] bsl::pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+// [30] bsl::pair<const_iter, const_iter> equal_range(const LOOKUP_KEY&) c;
 //
 // bucket interface:
 //*[26] size_type bucket_count() const;
@@ -198,7 +207,8 @@ using namespace BloombergLP;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] default construction (only)
-// [29] USAGE EXAMPLE
+// [28] CONCERN: 'HashTableUsesPowerOfTwoBuckets' selects power-of-2 size
+// [31] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 //*[ 3] int ggg(unordered_set<K,H,E,A> *object, const char *spec, int verbose);
@@ -6051,6 +6061,43 @@ void TestDriver<KEY, HASH, EQUAL, ALLOC>::testCase2()
     }
 }
 
+// ============================================================================
+//                      POWER-OF-TWO BUCKET POLICY SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct PowerOfTwoIdentityHash {
+    // This hash functor returns the value of its 'int' argument, and selects
+    // the power-of-two bucket policy of the underlying hash table.  Note that
+    // the identity hash is the worst case for selecting a bucket by masking,
+    // unless the hash table post-mixes the hash codes.
+
+    BSLMF_NESTED_TRAIT_DECLARATION(PowerOfTwoIdentityHash,
+                                   bslstl::HashTableUsesPowerOfTwoBuckets);
+
+    native_std::size_t operator()(int key) const
+        // Return the specified 'key' converted to 'size_t'.
+    {
+        return static_cast<native_std::size_t>(key);
+    }
+};
+
+size_t identityHashFunction(int key)
+    // Return the specified 'key' converted to 'size_t'.
+{
+    return static_cast<size_t>(key);
+}
+
+bool isPowerOfTwo(size_t value)
+    // Return 'true' if the specified 'value' is a power of two, and 'false'
+    // otherwise.
+{
+    return 0 != value && 0 == (value & (value - 1));
+}
+
+}  // close unnamed namespace
+
 // ============================================================================
 //                              USAGE EXAMPLES
 // ----------------------------------------------------------------------------
@@ -6377,7 +6424,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&testAlloc);
 
     switch (test) { case 0:
-      case 28: {
+      case 31: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6532,6 +6579,365 @@ if (verbose) {
 // See the material in {'bslstl_unorderedmap'|Example 2}.
 
       } break;
+      case 30: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSPARENT LOOKUP
+        //
+        // Concerns:
+        //: 1 If both 'HASH' and 'EQUAL' are transparent, 'find', 'count', and
+        //:   'equal_range' accept a key of a type other than 'key_type',
+        //:   without converting it to 'key_type'.
+        //:
+        //: 2 Each such lookup returns the same result as the same method
+        //:   called with a 'key_type' object having an equal value, whether
+        //:   or not the key is present.
+        //:
+        //: 3 Both the modifiable and the non-modifiable overloads are
+        //:   available.
+        //:
+        //: 4 If 'HASH' is not transparent, a lookup using a key of another
+        //:   type still converts the key to 'key_type'.
+        //
+        // Plan:
+        //: 1 Create an unordered set, using a transparent hasher and
+        //:   equality comparator, of keys of a type, 'CountedKey', that
+        //:   counts the objects of that type created and is implicitly
+        //:   convertible from 'int'.  Insert the even numbers in a range.
+        //:
+        //: 2 For each 'int' in a larger range, call each lookup method with
+        //:   the 'int', and with an equal 'CountedKey', and verify that the
+        //:   results are the same, and that no 'CountedKey' is created by the
+        //:   calls taking an 'int'.  (C-1..3)
+        //:
+        //: 3 Create an unordered set using a hasher that is not
+        //:   transparent, and verify that a lookup using an 'int' creates a
+        //:   'CountedKey'.  (C-4)
+        //
+        // Testing:
+        //   iterator find(const LOOKUP_KEY& key);
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+        //   const_iterator find(const LOOKUP_KEY& key) const;
+        //   size_type count(const LOOKUP_KEY& key) const;
+        //   pair<c_iter, c_iter> equal_range(const LOOKUP_KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING TRANSPARENT LOOKUP"
+                            "\n==========================\n");
+
+        typedef bsltf::CountedKey           Key;
+        typedef bsltf::CountedKeyHash       Hash;
+        typedef bsltf::CountedKeyEqual      Equal;
+        typedef bsltf::CountedKeyOpaqueHash OpaqueHash;
+
+        typedef bsl::unordered_set<Key, Hash, Equal>       Set;
+        typedef bsl::unordered_set<Key, OpaqueHash, Equal> OpaqueSet;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Set mX(&oa);  const Set& X = mX;
+        for (int i = 0; i < 20; i += 2) {
+            mX.insert(Key(i));
+        }
+
+        for (int ti = -1; ti <= 20; ++ti) {
+            const int KEY = ti;
+            const Key COUNTED_KEY(ti);
+
+            if (veryVerbose) { T_ P(KEY) }
+
+            const Set::iterator  EXP_FIND = mX.find(COUNTED_KEY);
+            const Set::iterator  EXP_LAST = mX.equal_range(COUNTED_KEY).second;
+            const Set::size_type EXP_CNT  = X.count(COUNTED_KEY);
+
+            const int NUM_CREATED = Key::numCreated();
+
+            ASSERTV(KEY, EXP_FIND == mX.find(KEY));
+            ASSERTV(KEY, EXP_FIND == mX.equal_range(KEY).first);
+            ASSERTV(KEY, EXP_LAST == mX.equal_range(KEY).second);
+
+            ASSERTV(KEY, EXP_FIND == X.find(KEY));
+            ASSERTV(KEY, EXP_CNT  == X.count(KEY));
+            ASSERTV(KEY, EXP_FIND == X.equal_range(KEY).first);
+            ASSERTV(KEY, EXP_LAST == X.equal_range(KEY).second);
+
+            ASSERTV(KEY, (0 == KEY % 2 && 0 <= KEY && KEY < 20) == EXP_CNT);
+            ASSERTV(KEY, NUM_CREATED == Key::numCreated());
+        }
+
+        if (verbose) printf("Testing a hasher that is not transparent.\n");
+        {
+            OpaqueSet mY(&oa);  const OpaqueSet& Y = mY;
+            mY.insert(Key(2));
+
+            const int NUM_CREATED = Key::numCreated();
+
+            ASSERT(Y.end() != Y.find(2));
+            ASSERT(NUM_CREATED < Key::numCreated());
+        }
+      } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // TESTING 'findBatch'
+        //
+        // Concerns:
+        //: 1 'findBatch' loads, for each key, the same iterator as 'find',
+        //:   whether or not the key is present, for a number of keys that is
+        //:   zero, smaller than, and larger than the internal batch size.
+        //:
+        //: 2 'findBatch' writes no result beyond the 'numKeys'th.
+        //:
+        //: 3 'findBatch' is correct for a set using each bucket policy, and
+        //:   allocates no memory.
+        //
+        // Plan:
+        //: 1 For a set holding the even keys of a range, using the default
+        //:   and the power-of-two bucket policies, call both overloads of
+        //:   'findBatch' on prefixes of various lengths of an array of even
+        //:   and odd keys, and compare each result with 'find'.  Verify that
+        //:   a guard value following the results is unchanged, and that the
+        //:   object allocator is not used.  (C-1..3)
+        //
+        // Testing:
+        //   void findBatch(iterator *, const key_type *, size_type);
+        //   void findBatch(const_iterator *, const key_type *, size_type) c;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'findBatch'"
+                            "\n===================\n");
+
+        const int NUM_KEYS = 500;
+        const int BATCH_SIZES[] = { 0, 1, 7, 16, 31, 100, 500 };
+        const int NUM_BATCH_SIZES = sizeof BATCH_SIZES / sizeof *BATCH_SIZES;
+
+        int keys[NUM_KEYS];
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            keys[i] = (i * 7919) % (2 * NUM_KEYS);
+        }
+
+        for (int policy = 0; policy < 2; ++policy) {
+            if (veryVerbose) { T_ P(policy) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            bsl::unordered_set<int>                         mA(&oa);
+            bsl::unordered_set<int, PowerOfTwoIdentityHash> mB(&oa);
+
+            for (int i = 0; i < 2 * NUM_KEYS; i += 2) {
+                if (policy) {
+                    mB.insert(i * 1024);
+                }
+                else {
+                    mA.insert(i);
+                }
+            }
+
+            const bsls::Types::Int64 BLOCKS = oa.numBlocksTotal();
+
+            for (int ti = 0; ti < NUM_BATCH_SIZES; ++ti) {
+                const int N = BATCH_SIZES[ti];
+
+                bsl::unordered_set<int>::iterator results[NUM_KEYS + 1];
+                bsl::unordered_set<int, PowerOfTwoIdentityHash>::iterator
+                                                     bResults[NUM_KEYS + 1];
+                int bKeys[NUM_KEYS];
+                for (int i = 0; i < N; ++i) {
+                    bKeys[i] = keys[i] * 1024;
+                }
+
+                for (int isConst = 0; isConst < 2; ++isConst) {
+                    results[N]  = mA.begin();
+                    bResults[N] = mB.begin();
+
+                    if (policy && isConst) {
+                        const bsl::unordered_set<int, PowerOfTwoIdentityHash>&
+                                                                       B = mB;
+                        B.findBatch(bResults, bKeys, N);
+                    }
+                    else if (policy) {
+                        mB.findBatch(bResults, bKeys, N);
+                    }
+                    else if (isConst) {
+                        const bsl::unordered_set<int>& A = mA;
+                        A.findBatch(results, keys, N);
+                    }
+                    else {
+                        mA.findBatch(results, keys, N);
+                    }
+
+                    ASSERTV(policy, N, mA.begin() == results[N]);
+                    ASSERTV(policy, N, mB.begin() == bResults[N]);
+
+                    for (int i = 0; i < N; ++i) {
+                        if (policy) {
+                            ASSERTV(N, i, mB.find(bKeys[i]) == bResults[i]);
+                            ASSERTV(N, i, (mB.end() == bResults[i])
+                                                          == (keys[i] % 2));
+                        }
+                        else {
+                            ASSERTV(N, i, mA.find(keys[i]) == results[i]);
+                            ASSERTV(N, i, (mA.end() == results[i])
+                                                          == (keys[i] % 2));
+                        }
+                    }
+                }
+            }
+
+            ASSERTV(policy, BLOCKS == oa.numBlocksTotal());
+        }
+      } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // TESTING POWER-OF-TWO BUCKET POLICY
+        //
+        // Concerns:
+        //: 1 'HashTableUsesPowerOfTwoBuckets' is 'true' for a hash functor
+        //:   declaring the trait, and 'false' for other hash functors,
+        //:   including function pointers.
+        //:
+        //: 2 A set whose hash functor declares the trait always has a number
+        //:   of buckets that is a power of two, and never exceeds its maximum
+        //:   load factor.
+        //:
+        //: 3 'rehash' and 'reserve' grow the bucket array to the smallest
+        //:   sufficient power of two.
+        //:
+        //: 4 Hash codes that differ only in their high-order bits are
+        //:   distributed across the buckets, even though the bucket index is
+        //:   computed by masking the low-order bits of the (post-mixed) hash
+        //:   code.
+        //:
+        //: 5 'find', 'count', 'bucket', and 'erase' agree with the indexing
+        //:   of the elements.
+        //
+        // Plan:
+        //: 1 Test the trait for a functor declaring it, for 'bsl::hash<int>',
+        //:   and for a function pointer.  (C-1)
+        //:
+        //: 2 Insert the keys '0, 1024, 2048, ...' into a set using an identity
+        //:   hash functor declaring the trait and, after each insertion,
+        //:   verify the number of buckets and the load factor.  (C-2)
+        //:
+        //: 3 Verify that no bucket holds more than a small number of elements.
+        //:   (C-4)
+        //:
+        //: 4 Find, count, and erase each element, verifying that each
+        //:   element is in the bucket reported by 'bucket'.  (C-5)
+        //:
+        //: 5 Call 'rehash' and 'reserve', and verify the number of buckets.
+        //:   (C-3)
+        //
+        // Testing:
+        //   CONCERN: 'HashTableUsesPowerOfTwoBuckets' selects power-of-2 size
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING POWER-OF-TWO BUCKET POLICY"
+                            "\n==================================\n");
+
+        typedef bsl::unordered_set<int, PowerOfTwoIdentityHash> Set;
+        typedef size_t (*HashFunction)(int);
+
+        if (verbose) printf("\tTesting the trait.\n");
+        {
+            ASSERT( bslstl::HashTableUsesPowerOfTwoBuckets<
+                                             PowerOfTwoIdentityHash>::value);
+            ASSERT(!bslstl::HashTableUsesPowerOfTwoBuckets<
+                                                     bsl::hash<int> >::value);
+            ASSERT(!bslstl::HashTableUsesPowerOfTwoBuckets<
+                                                         HashFunction>::value);
+        }
+
+        if (verbose) printf("\tTesting growth and distribution.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            const int NUM_KEYS = 4096;
+            const int STRIDE   = 1024;
+
+            Set mX(&oa);  const Set& X = mX;
+            ASSERTV(X.bucket_count(), isPowerOfTwo(X.bucket_count()));
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                ASSERTV(i, mX.insert(i * STRIDE).second);
+                ASSERTV(i, X.bucket_count(), isPowerOfTwo(X.bucket_count()));
+                ASSERTV(i, X.load_factor() <= X.max_load_factor());
+            }
+            ASSERTV(X.size(), NUM_KEYS == static_cast<int>(X.size()));
+
+            size_t maxBucketSize = 0;
+            for (size_t b = 0; b < X.bucket_count(); ++b) {
+                if (X.bucket_size(b) > maxBucketSize) {
+                    maxBucketSize = X.bucket_size(b);
+                }
+            }
+            ASSERTV(maxBucketSize, maxBucketSize <= 10);
+
+            // A set using a function pointer is indexed by prime numbers of
+            // buckets, and holds the same elements.
+
+            bsl::unordered_set<int, HashFunction> mY(X.begin(),
+                                                     X.end(),
+                                                     0,
+                                                     &identityHashFunction,
+                                                     bsl::equal_to<int>(),
+                                                     &oa);
+            ASSERTV(mY.bucket_count(), !isPowerOfTwo(mY.bucket_count()));
+            ASSERTV(X.size() == mY.size());
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const int KEY = i * STRIDE;
+
+                Set::const_iterator it = X.find(KEY);
+                ASSERTV(i, X.end() != it);
+                ASSERTV(i, 1 == X.count(KEY));
+                ASSERTV(i, 1 == mY.count(KEY));
+
+                const size_t B = X.bucket(KEY);
+                bool found = false;
+                for (Set::const_local_iterator lit = X.begin(B);
+                     lit != X.end(B);
+                     ++lit) {
+                    found = found || KEY == *lit;
+                }
+                ASSERTV(i, found);
+
+                ASSERTV(i, 0 == X.count(KEY + 1));
+            }
+
+            for (int i = 0; i < NUM_KEYS; i += 2) {
+                ASSERTV(i, 1 == mX.erase(i * STRIDE));
+            }
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                ASSERTV(i, (i % 2) == static_cast<int>(X.count(i * STRIDE)));
+            }
+        }
+
+        if (verbose) printf("\tTesting 'rehash' and 'reserve'.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Set mX(&oa);  const Set& X = mX;
+
+            mX.rehash(1000);
+            ASSERTV(X.bucket_count(), 1024 == X.bucket_count());
+
+            mX.rehash(1025);
+            ASSERTV(X.bucket_count(), 2048 == X.bucket_count());
+
+            Set mY(&oa);  const Set& Y = mY;
+            mY.max_load_factor(0.5f);
+            mY.reserve(3000);
+            ASSERTV(Y.bucket_count(), 8192 == Y.bucket_count());
+
+            for (int i = 0; i < 3000; ++i) {
+                mY.insert(i);
+            }
+            ASSERTV(Y.bucket_count(), 8192 == Y.bucket_count());
+
+            mY.max_load_factor(0.25f);
+            ASSERTV(Y.bucket_count(), 16384 == Y.bucket_count());
+            ASSERTV(3000 == Y.size());
+        }
+      } break;
       case 27: {
         // --------------------------------------------------------------------
         // TESTING SPREAD
@@ -5,9 +5,11 @@
       'bsltf_alloctesttype.cpp',
       'bsltf_bitwisemoveabletesttype.cpp',
       'bsltf_convertiblevaluewrapper.cpp',
+      'bsltf_countedkey.cpp',
       'bsltf_degeneratefunctor.cpp',
       'bsltf_enumeratedtesttype.cpp',
       'bsltf_evilbooleantype.cpp',
+      'bsltf_managedtestallocator.cpp',
       'bsltf_nonassignabletesttype.cpp',
       'bsltf_noncopyconstructibletesttype.cpp',
       'bsltf_nondefaultconstructibletesttype.cpp',
@@ -25,9 +27,11 @@
       'bsltf_alloctesttype.t',
       'bsltf_bitwisemoveabletesttype.t',
       'bsltf_convertiblevaluewrapper.t',
+      'bsltf_countedkey.t',
       'bsltf_degeneratefunctor.t',
       'bsltf_enumeratedtesttype.t',
       'bsltf_evilbooleantype.t',
+      'bsltf_managedtestallocator.t',
       'bsltf_nonassignabletesttype.t',
       'bsltf_noncopyconstructibletesttype.t',
       'bsltf_nondefaultconstructibletesttype.t',
@@ -45,9 +49,11 @@
       '<(PRODUCT_DIR)/bsltf_alloctesttype.t',
       '<(PRODUCT_DIR)/bsltf_bitwisemoveabletesttype.t',
       '<(PRODUCT_DIR)/bsltf_convertiblevaluewrapper.t',
+      '<(PRODUCT_DIR)/bsltf_countedkey.t',
       '<(PRODUCT_DIR)/bsltf_degeneratefunctor.t',
       '<(PRODUCT_DIR)/bsltf_enumeratedtesttype.t',
       '<(PRODUCT_DIR)/bsltf_evilbooleantype.t',
+      '<(PRODUCT_DIR)/bsltf_managedtestallocator.t',
       '<(PRODUCT_DIR)/bsltf_nonassignabletesttype.t',
       '<(PRODUCT_DIR)/bsltf_noncopyconstructibletesttype.t',
       '<(PRODUCT_DIR)/bsltf_nondefaultconstructibletesttype.t',
@@ -148,6 +154,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bsltf_convertiblevaluewrapper.t.cpp' ],
     },
+    {
+      'target_name': 'bsltf_countedkey.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bsltf_pkgdeps)', 'bsltf' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bsltf_countedkey.t.cpp' ],
+    },
     {
       'target_name': 'bsltf_degeneratefunctor.t',
       'type': 'executable',
@@ -172,6 +186,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bsltf_evilbooleantype.t.cpp' ],
     },
+    {
+      'target_name': 'bsltf_managedtestallocator.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bsltf_pkgdeps)', 'bsltf' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bsltf_managedtestallocator.t.cpp' ],
+    },
     {
       'target_name': 'bsltf_nonassignabletesttype.t',
       'type': 'executable',
@@ -0,0 +1,359 @@
+// bsltf_countedkey.h                                                 -*-C++-*-
+#ifndef INCLUDED_BSLTF_COUNTEDKEY
+#define INCLUDED_BSLTF_COUNTEDKEY
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a key type that counts its creations, with functors.
+//
+//@CLASSES:
+//           bsltf::CountedKey: 'int' key counting the objects created
+//       bsltf::CountedKeyLess: transparent 'CountedKey' and 'int' comparator
+// bsltf::CountedKeyOpaqueLess: non-transparent 'CountedKey' comparator
+//       bsltf::CountedKeyHash: transparent 'CountedKey' and 'int' hasher
+//      bsltf::CountedKeyEqual: transparent 'CountedKey' and 'int' equality
+// bsltf::CountedKeyOpaqueHash: non-transparent 'CountedKey' hasher
+//
+//@SEE_ALSO: bsltf_templatetestfacility
+//
+//@DESCRIPTION: This component provides a key type, 'CountedKey', that holds
+// an 'int' value, is implicitly convertible from 'int', and counts the number
+// of 'CountedKey' objects that are created, along with a set of functors that
+// order, hash, and compare 'CountedKey' objects.  These types can be used to
+// verify that a container supporting heterogeneous ("transparent") lookup does
+// not convert a lookup argument to a (temporary) key when the container's
+// functors are transparent, and does so when they are not.
+//
+// 'CountedKeyLess', 'CountedKeyHash', and 'CountedKeyEqual' are transparent:
+// each declares a nested 'is_transparent' type, and accepts any combination
+// of 'CountedKey' objects and 'int' values.  'CountedKeyOpaqueLess' and
+// 'CountedKeyOpaqueHash' accept only 'CountedKey' objects, and produce the
+// same results as their transparent counterparts.
+//
+// The number of 'CountedKey' objects created is held in a single counter that
+// is shared by all threads; the counter is *not* thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Detecting the Conversion of a Lookup Argument
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to verify that comparing an 'int' with a 'CountedKey' using
+// a transparent comparator does not create a 'CountedKey'.
+//
+// First, we create a 'CountedKey' and a comparator of each kind:
+//..
+//  const bsltf::CountedKey     KEY(3);
+//  bsltf::CountedKeyLess       transparentLess;
+//  bsltf::CountedKeyOpaqueLess opaqueLess;
+//..
+// Then, we compare an 'int' with the key using the transparent comparator, and
+// observe that no 'CountedKey' is created:
+//..
+//  int numCreated = bsltf::CountedKey::numCreated();
+//  assert(true == transparentLess(2, KEY));
+//  assert(numCreated == bsltf::CountedKey::numCreated());
+//..
+// Finally, we make the same comparison using the non-transparent comparator,
+// and observe that the 'int' is converted to a temporary 'CountedKey':
+//..
+//  assert(true == opaqueLess(2, KEY));
+//  assert(numCreated + 1 == bsltf::CountedKey::numCreated());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>       // for 'std::size_t'
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bsltf {
+
+                        // ================
+                        // class CountedKey
+                        // ================
+
+class CountedKey {
+    // This class holds an 'int' value, and counts the number of objects of
+    // this class that are created, so that a test can verify that a lookup
+    // does not convert its argument to a (temporary) 'CountedKey'.
+
+    // CLASS DATA
+    static int s_numCreated;  // number of objects created
+
+    // DATA
+    int        d_value;       // held value
+
+  public:
+    // CLASS METHODS
+    static int numCreated();
+        // Return the number of 'CountedKey' objects created since the start
+        // of the program.
+
+    // CREATORS
+    CountedKey(int value);                                          // IMPLICIT
+        // Create a 'CountedKey' object holding the specified 'value'.
+
+    CountedKey(const CountedKey& original);
+        // Create a 'CountedKey' object holding the same value as the specified
+        // 'original' object.
+
+    // ~CountedKey() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    // CountedKey& operator=(const CountedKey& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    // ACCESSORS
+    int value() const;
+        // Return the value held by this object.
+};
+
+                        // =====================
+                        // struct CountedKeyLess
+                        // =====================
+
+struct CountedKeyLess {
+    // This transparent comparator orders any combination of 'CountedKey'
+    // objects and 'int' values by their 'int' value.
+
+    // TYPES
+    typedef void is_transparent;
+
+    // ACCESSORS
+    bool operator()(const CountedKey& lhs, const CountedKey& rhs) const;
+    bool operator()(const CountedKey& lhs, int               rhs) const;
+    bool operator()(int               lhs, const CountedKey& rhs) const;
+        // Return 'true' if the 'int' value of the specified 'lhs' is less
+        // than that of the specified 'rhs', and 'false' otherwise.
+};
+
+                        // ===========================
+                        // struct CountedKeyOpaqueLess
+                        // ===========================
+
+struct CountedKeyOpaqueLess {
+    // This comparator orders 'CountedKey' objects by their 'int' value.  It is
+    // not transparent.
+
+    // ACCESSORS
+    bool operator()(const CountedKey& lhs, const CountedKey& rhs) const;
+        // Return 'true' if the value held by the specified 'lhs' is less than
+        // that held by the specified 'rhs', and 'false' otherwise.
+};
+
+                        // =====================
+                        // struct CountedKeyHash
+                        // =====================
+
+struct CountedKeyHash {
+    // This transparent hasher returns the same hash code for a 'CountedKey'
+    // object and an 'int' having the same value.
+
+    // TYPES
+    typedef void is_transparent;
+
+    // ACCESSORS
+    native_std::size_t operator()(const CountedKey& key) const;
+    native_std::size_t operator()(int               key) const;
+        // Return a hash code for the 'int' value of the specified 'key'.
+};
+
+                        // ======================
+                        // struct CountedKeyEqual
+                        // ======================
+
+struct CountedKeyEqual {
+    // This transparent functor compares any combination of 'CountedKey'
+    // objects and 'int' values for equality of their 'int' value.
+
+    // TYPES
+    typedef void is_transparent;
+
+    // ACCESSORS
+    bool operator()(const CountedKey& lhs, const CountedKey& rhs) const;
+    bool operator()(const CountedKey& lhs, int               rhs) const;
+    bool operator()(int               lhs, const CountedKey& rhs) const;
+        // Return 'true' if the specified 'lhs' and 'rhs' have the same 'int'
+        // value, and 'false' otherwise.
+};
+
+                        // ===========================
+                        // struct CountedKeyOpaqueHash
+                        // ===========================
+
+struct CountedKeyOpaqueHash {
+    // This hasher returns the same hash code as 'CountedKeyHash' for a
+    // 'CountedKey' object.  It is not transparent.
+
+    // ACCESSORS
+    native_std::size_t operator()(const CountedKey& key) const;
+        // Return a hash code for the value held by the specified 'key'.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ----------------
+                        // class CountedKey
+                        // ----------------
+
+// CLASS METHODS
+inline
+int CountedKey::numCreated()
+{
+    return s_numCreated;
+}
+
+// CREATORS
+inline
+CountedKey::CountedKey(int value)
+: d_value(value)
+{
+    ++s_numCreated;
+}
+
+inline
+CountedKey::CountedKey(const CountedKey& original)
+: d_value(original.d_value)
+{
+    ++s_numCreated;
+}
+
+// ACCESSORS
+inline
+int CountedKey::value() const
+{
+    return d_value;
+}
+
+                        // ---------------------
+                        // struct CountedKeyLess
+                        // ---------------------
+
+// ACCESSORS
+inline
+bool CountedKeyLess::operator()(const CountedKey& lhs,
+                                const CountedKey& rhs) const
+{
+    return lhs.value() < rhs.value();
+}
+
+inline
+bool CountedKeyLess::operator()(const CountedKey& lhs, int rhs) const
+{
+    return lhs.value() < rhs;
+}
+
+inline
+bool CountedKeyLess::operator()(int lhs, const CountedKey& rhs) const
+{
+    return lhs < rhs.value();
+}
+
+                        // ---------------------------
+                        // struct CountedKeyOpaqueLess
+                        // ---------------------------
+
+// ACCESSORS
+inline
+bool CountedKeyOpaqueLess::operator()(const CountedKey& lhs,
+                                      const CountedKey& rhs) const
+{
+    return lhs.value() < rhs.value();
+}
+
+                        // ---------------------
+                        // struct CountedKeyHash
+                        // ---------------------
+
+// ACCESSORS
+inline
+native_std::size_t CountedKeyHash::operator()(const CountedKey& key) const
+{
+    return static_cast<native_std::size_t>(key.value());
+}
+
+inline
+native_std::size_t CountedKeyHash::operator()(int key) const
+{
+    return static_cast<native_std::size_t>(key);
+}
+
+                        // ----------------------
+                        // struct CountedKeyEqual
+                        // ----------------------
+
+// ACCESSORS
+inline
+bool CountedKeyEqual::operator()(const CountedKey& lhs,
+                                 const CountedKey& rhs) const
+{
+    return lhs.value() == rhs.value();
+}
+
+inline
+bool CountedKeyEqual::operator()(const CountedKey& lhs, int rhs) const
+{
+    return lhs.value() == rhs;
+}
+
+inline
+bool CountedKeyEqual::operator()(int lhs, const CountedKey& rhs) const
+{
+    return lhs == rhs.value();
+}
+
+                        // ---------------------------
+                        // struct CountedKeyOpaqueHash
+                        // ---------------------------
+
+// ACCESSORS
+inline
+native_std::size_t
+CountedKeyOpaqueHash::operator()(const CountedKey& key) const
+{
+    return static_cast<native_std::size_t>(key.value());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,413 @@
+// bsltf_countedkey.t.cpp                                             -*-C++-*-
+#include <bsltf_countedkey.h>
+
+#include <bslmf_issame.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+
+#include <cstddef>
+
+#include <stdlib.h>
+#include <stdio.h>
+
+using namespace BloombergLP;
+using namespace BloombergLP::bsltf;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a key type, 'CountedKey', that counts the
+// objects of its type that are created, and a set of functors on that type.
+// We verify that each creator increments the count and that the functors
+// produce the expected results without creating a 'CountedKey' except where
+// the (non-transparent) functor requires a conversion.
+//-----------------------------------------------------------------------------
+// class CountedKey
+//
+// CLASS METHODS
+// [ 2] static int numCreated();
+//
+// CREATORS
+// [ 2] CountedKey(int value);
+// [ 2] CountedKey(const CountedKey& original);
+//
+// ACCESSORS
+// [ 2] int value() const;
+//-----------------------------------------------------------------------------
+// struct CountedKeyLess
+//
+// [ 3] typedef void is_transparent;
+// [ 3] bool operator()(const CountedKey& lhs, const CountedKey& rhs) const;
+// [ 3] bool operator()(const CountedKey& lhs, int rhs) const;
+// [ 3] bool operator()(int lhs, const CountedKey& rhs) const;
+//-----------------------------------------------------------------------------
+// struct CountedKeyOpaqueLess
+//
+// [ 3] bool operator()(const CountedKey& lhs, const CountedKey& rhs) const;
+//-----------------------------------------------------------------------------
+// struct CountedKeyHash
+//
+// [ 4] typedef void is_transparent;
+// [ 4] size_t operator()(const CountedKey& key) const;
+// [ 4] size_t operator()(int key) const;
+//-----------------------------------------------------------------------------
+// struct CountedKeyEqual
+//
+// [ 4] typedef void is_transparent;
+// [ 4] bool operator()(const CountedKey& lhs, const CountedKey& rhs) const;
+// [ 4] bool operator()(const CountedKey& lhs, int rhs) const;
+// [ 4] bool operator()(int lhs, const CountedKey& rhs) const;
+//-----------------------------------------------------------------------------
+// struct CountedKeyOpaqueHash
+//
+// [ 4] size_t operator()(const CountedKey& key) const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) { ++testStatus; }
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef CountedKey Obj;
+
+//=============================================================================
+//                                 MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Detecting the Conversion of a Lookup Argument
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to verify that comparing an 'int' with a 'CountedKey' using
+// a transparent comparator does not create a 'CountedKey'.
+//
+// First, we create a 'CountedKey' and a comparator of each kind:
+//..
+        const bsltf::CountedKey     KEY(3);
+        bsltf::CountedKeyLess       transparentLess;
+        bsltf::CountedKeyOpaqueLess opaqueLess;
+//..
+// Then, we compare an 'int' with the key using the transparent comparator, and
+// observe that no 'CountedKey' is created:
+//..
+        int numCreated = bsltf::CountedKey::numCreated();
+        ASSERT(true == transparentLess(2, KEY));
+        ASSERT(numCreated == bsltf::CountedKey::numCreated());
+//..
+// Finally, we make the same comparison using the non-transparent comparator,
+// and observe that the 'int' is converted to a temporary 'CountedKey':
+//..
+        ASSERT(true == opaqueLess(2, KEY));
+        ASSERT(numCreated + 1 == bsltf::CountedKey::numCreated());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // HASH AND EQUALITY FUNCTORS
+        //
+        // Concerns:
+        //: 1 'CountedKeyHash' and 'CountedKeyEqual' declare 'is_transparent'.
+        //:
+        //: 2 'CountedKeyHash' returns the same hash code for a 'CountedKey'
+        //:   and an 'int' having the same value, and 'CountedKeyOpaqueHash'
+        //:   returns that hash code for the 'CountedKey'.
+        //:
+        //: 3 'CountedKeyEqual' compares any combination of 'CountedKey' and
+        //:   'int' arguments by their 'int' value.
+        //:
+        //: 4 No transparent overload creates a 'CountedKey'.
+        //
+        // Plan:
+        //: 1 Verify the 'is_transparent' typedefs using 'bsl::is_same'.
+        //:   (C-1)
+        //:
+        //: 2 For each pair of values in a small range, call every overload
+        //:   and verify the result against the result for the 'int' values,
+        //:   and verify that 'numCreated' is unchanged.  (C-2..4)
+        //
+        // Testing:
+        //   typedef void is_transparent;
+        //   size_t operator()(const CountedKey& key) const;
+        //   size_t operator()(int key) const;
+        //   bool operator()(const CountedKey& lhs, const CountedKey& rhs);
+        //   bool operator()(const CountedKey& lhs, int rhs) const;
+        //   bool operator()(int lhs, const CountedKey& rhs) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nHASH AND EQUALITY FUNCTORS"
+                            "\n==========================\n");
+
+        ASSERT((bsl::is_same<void, CountedKeyHash::is_transparent>::value));
+        ASSERT((bsl::is_same<void, CountedKeyEqual::is_transparent>::value));
+
+        const CountedKeyHash       hash       = CountedKeyHash();
+        const CountedKeyOpaqueHash opaqueHash = CountedKeyOpaqueHash();
+        const CountedKeyEqual      equal      = CountedKeyEqual();
+
+        for (int i = -2; i <= 2; ++i) {
+            const Obj X(i);
+
+            const int NUM_CREATED = Obj::numCreated();
+
+            const native_std::size_t HASH = hash(X);
+            ASSERTV(i, HASH == hash(i));
+            ASSERTV(i, HASH == opaqueHash(X));
+
+            for (int j = -2; j <= 2; ++j) {
+                const Obj Y(j);
+
+                const int  NUM_CREATED_J = Obj::numCreated();
+                const bool EXP           = i == j;
+
+                if (veryVerbose) { T_ P_(i) P_(j) P(EXP) }
+
+                ASSERTV(i, j, EXP == equal(X, Y));
+                ASSERTV(i, j, EXP == equal(X, j));
+                ASSERTV(i, j, EXP == equal(i, Y));
+                ASSERTV(i, j, NUM_CREATED_J == Obj::numCreated());
+            }
+
+            ASSERTV(i, NUM_CREATED + 5 == Obj::numCreated());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ORDERING FUNCTORS
+        //
+        // Concerns:
+        //: 1 'CountedKeyLess' declares 'is_transparent'.
+        //:
+        //: 2 'CountedKeyLess' orders any combination of 'CountedKey' and 'int'
+        //:   arguments by their 'int' value, without creating a 'CountedKey'.
+        //:
+        //: 3 'CountedKeyOpaqueLess' orders 'CountedKey' objects by their
+        //:   'int' value.
+        //
+        // Plan:
+        //: 1 Verify the 'is_transparent' typedef using 'bsl::is_same'.  (C-1)
+        //:
+        //: 2 For each pair of values in a small range, call every overload
+        //:   and verify the result against the result for the 'int' values,
+        //:   and verify that 'numCreated' is unchanged.  (C-2..3)
+        //
+        // Testing:
+        //   typedef void is_transparent;
+        //   bool operator()(const CountedKey& lhs, const CountedKey& rhs);
+        //   bool operator()(const CountedKey& lhs, int rhs) const;
+        //   bool operator()(int lhs, const CountedKey& rhs) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nORDERING FUNCTORS"
+                            "\n=================\n");
+
+        ASSERT((bsl::is_same<void, CountedKeyLess::is_transparent>::value));
+
+        const CountedKeyLess       less       = CountedKeyLess();
+        const CountedKeyOpaqueLess opaqueLess = CountedKeyOpaqueLess();
+
+        for (int i = -2; i <= 2; ++i) {
+            const Obj X(i);
+
+            for (int j = -2; j <= 2; ++j) {
+                const Obj Y(j);
+
+                const int  NUM_CREATED = Obj::numCreated();
+                const bool EXP         = i < j;
+
+                if (veryVerbose) { T_ P_(i) P_(j) P(EXP) }
+
+                ASSERTV(i, j, EXP == less(X, Y));
+                ASSERTV(i, j, EXP == less(X, j));
+                ASSERTV(i, j, EXP == less(i, Y));
+                ASSERTV(i, j, EXP == opaqueLess(X, Y));
+                ASSERTV(i, j, NUM_CREATED == Obj::numCreated());
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND 'numCreated'
+        //
+        // Concerns:
+        //: 1 Each creator initializes the held value as specified.
+        //:
+        //: 2 Each creator increments 'numCreated' by one.
+        //:
+        //: 3 An 'int' converts implicitly to a 'CountedKey', creating one
+        //:   object.
+        //:
+        //: 4 Destroying and assigning objects does not change 'numCreated'.
+        //
+        // Plan:
+        //: 1 Create objects using each creator and an implicit conversion,
+        //:   and verify the value and the change in 'numCreated'.  (C-1..3)
+        //:
+        //: 2 Assign and destroy objects, and verify that 'numCreated' is
+        //:   unchanged.  (C-4)
+        //
+        // Testing:
+        //   static int numCreated();
+        //   CountedKey(int value);
+        //   CountedKey(const CountedKey& original);
+        //   int value() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS AND 'numCreated'"
+                            "\n=========================\n");
+
+        const int NUM_CREATED = Obj::numCreated();
+
+        {
+            Obj mX(5);  const Obj& X = mX;
+            ASSERTV(X.value(), 5 == X.value());
+            ASSERTV(Obj::numCreated(), NUM_CREATED + 1 == Obj::numCreated());
+
+            const Obj Y(X);
+            ASSERTV(Y.value(), 5 == Y.value());
+            ASSERTV(Obj::numCreated(), NUM_CREATED + 2 == Obj::numCreated());
+
+            const Obj Z = 7;
+            ASSERTV(Z.value(), 7 == Z.value());
+            ASSERTV(Obj::numCreated(), NUM_CREATED + 3 == Obj::numCreated());
+
+            mX = Z;
+            ASSERTV(X.value(), 7 == X.value());
+            ASSERTV(Obj::numCreated(), NUM_CREATED + 3 == Obj::numCreated());
+        }
+
+        ASSERTV(Obj::numCreated(), NUM_CREATED + 3 == Obj::numCreated());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform an ad-hoc test of the primary manipulators and accessors.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        ASSERT(0 == Obj::numCreated());
+
+        const Obj X(1);
+        ASSERT(1 == X.value());
+        ASSERT(1 == Obj::numCreated());
+
+        ASSERT(true  == CountedKeyLess()(X, 2));
+        ASSERT(false == CountedKeyLess()(2, X));
+        ASSERT(true  == CountedKeyEqual()(1, X));
+        ASSERT(1 == Obj::numCreated());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,76 @@
+// bsltf_managedtestallocator.cpp                                     -*-C++-*-
+#include <bsltf_managedtestallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+namespace BloombergLP {
+namespace bsltf {
+
+                        // --------------------------
+                        // class ManagedTestAllocator
+                        // --------------------------
+
+// CREATORS
+ManagedTestAllocator::ManagedTestAllocator(bslma::Allocator *basicAllocator)
+: d_blocks_p(0)
+, d_numDeallocations(0)
+, d_upstream_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+ManagedTestAllocator::~ManagedTestAllocator()
+{
+    release();
+}
+
+// MANIPULATORS
+void *ManagedTestAllocator::allocate(size_type size)
+{
+    Header *header = static_cast<Header *>(
+                                d_upstream_p->allocate(sizeof(Header) + size));
+    header->d_next_p = d_blocks_p;
+    d_blocks_p       = header;
+    return header + 1;
+}
+
+void ManagedTestAllocator::deallocate(void *)
+{
+    ++d_numDeallocations;
+}
+
+void ManagedTestAllocator::release()
+{
+    while (d_blocks_p) {
+        Header *next = d_blocks_p->d_next_p;
+        d_upstream_p->deallocate(d_blocks_p);
+        d_blocks_p = next;
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
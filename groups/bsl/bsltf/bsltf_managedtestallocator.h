@@ -0,0 +1,181 @@
+// bsltf_managedtestallocator.h                                       -*-C++-*-
+#ifndef INCLUDED_BSLTF_MANAGEDTESTALLOCATOR
+#define INCLUDED_BSLTF_MANAGEDTESTALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a managed allocator that ignores deallocations.
+//
+//@CLASSES:
+//  bsltf::ManagedTestAllocator: managed allocator counting deallocations
+//
+//@SEE_ALSO: bslma_managedallocator, bslma_testallocator
+//
+//@DESCRIPTION: This component provides an allocator, 'ManagedTestAllocator',
+// that implements the 'bslma::ManagedAllocator' protocol.  Each block that a
+// 'ManagedTestAllocator' dispenses is obtained from an upstream allocator
+// supplied at construction.  Calls to 'deallocate' are counted, but otherwise
+// ignored; every dispensed block is returned to the upstream allocator only
+// when 'release' is called or the 'ManagedTestAllocator' is destroyed.
+//
+// This type can be used to verify that a container or pool supplied with a
+// managed allocator "winks out" its elements (i.e., skips destroying them and
+// returning their memory) on destruction: the number of deallocations can be
+// observed through 'numDeallocations', and an upstream 'bslma::TestAllocator'
+// reports no leaks once the managed allocator is released.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Observing a Winked-Out Object
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to verify that an object does not return its memory when it
+// is supplied with a managed allocator.
+//
+// First, we create a 'bslma::TestAllocator' to serve as the upstream
+// allocator, and a 'ManagedTestAllocator' that obtains memory from it:
+//..
+//  bslma::TestAllocator        oa("object");
+//  bsltf::ManagedTestAllocator ma(&oa);
+//..
+// Then, we allocate a block from the managed allocator, and observe that it is
+// obtained from the upstream allocator:
+//..
+//  void *p = ma.allocate(16);
+//  assert(1 == oa.numBlocksInUse());
+//..
+// Next, we deallocate the block, and observe that the deallocation is counted,
+// but that the block has not been returned upstream:
+//..
+//  ma.deallocate(p);
+//  assert(1 == ma.numDeallocations());
+//  assert(1 == oa.numBlocksInUse());
+//..
+// Finally, we release the managed allocator, and observe that all of its
+// memory is returned to the upstream allocator:
+//..
+//  ma.release();
+//  assert(0 == oa.numBlocksInUse());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_MANAGEDALLOCATOR
+#include <bslma_managedallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+namespace BloombergLP {
+namespace bsltf {
+
+                        // ==========================
+                        // class ManagedTestAllocator
+                        // ==========================
+
+class ManagedTestAllocator : public bslma::ManagedAllocator {
+    // This class provides a managed allocator that obtains each block it
+    // dispenses from an upstream allocator, counts, but otherwise ignores,
+    // deallocations, and returns all of the blocks to the upstream allocator
+    // on 'release' and destruction.
+
+    // PRIVATE TYPES
+    union Header {
+        // This 'union' prefixes each dispensed block, linking it into the list
+        // of blocks held by this allocator while preserving the maximal
+        // alignment of the memory that follows.
+
+        Header                              *d_next_p;     // next block
+        bsls::AlignmentUtil::MaxAlignedType  d_alignment;  // force alignment
+    };
+
+    // DATA
+    Header           *d_blocks_p;          // list of dispensed blocks
+    int               d_numDeallocations;  // calls to 'deallocate'
+    bslma::Allocator *d_upstream_p;        // upstream allocator (held, not
+                                           // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ManagedTestAllocator(const ManagedTestAllocator&);
+    ManagedTestAllocator& operator=(const ManagedTestAllocator&);
+
+  public:
+    // CREATORS
+    explicit ManagedTestAllocator(bslma::Allocator *basicAllocator = 0);
+        // Create a managed allocator that obtains memory from the optionally
+        // specified 'basicAllocator'.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    virtual ~ManagedTestAllocator();
+        // Destroy this allocator, returning all of its blocks to the upstream
+        // allocator.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly-allocated block of memory of at least the specified
+        // 'size' (in bytes), obtained from the upstream allocator.
+
+    virtual void deallocate(void *address);
+        // Increment the number of deallocations of this allocator.  The memory
+        // at the specified 'address' is not returned to the upstream
+        // allocator until 'release' is called.
+
+    virtual void release();
+        // Return all of the blocks dispensed by this allocator to the upstream
+        // allocator.  Note that the number of deallocations is not reset.
+
+    // ACCESSORS
+    int numDeallocations() const;
+        // Return the number of calls to 'deallocate' on this allocator.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // --------------------------
+                        // class ManagedTestAllocator
+                        // --------------------------
+
+// ACCESSORS
+inline
+int ManagedTestAllocator::numDeallocations() const
+{
+    return d_numDeallocations;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
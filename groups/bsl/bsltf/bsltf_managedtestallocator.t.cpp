@@ -0,0 +1,340 @@
+// bsltf_managedtestallocator.t.cpp                                   -*-C++-*-
+#include <bsltf_managedtestallocator.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_managedallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+using namespace BloombergLP;
+using namespace BloombergLP::bsltf;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements a mechanism, 'ManagedTestAllocator',
+// that obtains each block it dispenses from an upstream allocator, counts but
+// ignores deallocations, and returns its blocks upstream on 'release' and
+// destruction.  We use a 'bslma::TestAllocator' as the upstream allocator to
+// observe the memory held by the object under test.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit ManagedTestAllocator(bslma::Allocator *basicAllocator = 0);
+// [ 2] virtual ~ManagedTestAllocator();
+//
+// MANIPULATORS
+// [ 2] virtual void *allocate(size_type size);
+// [ 2] virtual void deallocate(void *address);
+// [ 2] virtual void release();
+//
+// ACCESSORS
+// [ 2] int numDeallocations() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) { ++testStatus; }
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ManagedTestAllocator Obj;
+
+//=============================================================================
+//                                 MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+    bool veryVeryVerbose     = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Observing a Winked-Out Object
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to verify that an object does not return its memory when it
+// is supplied with a managed allocator.
+//
+// First, we create a 'bslma::TestAllocator' to serve as the upstream
+// allocator, and a 'ManagedTestAllocator' that obtains memory from it:
+//..
+        bslma::TestAllocator        oa("object", veryVeryVeryVerbose);
+        bsltf::ManagedTestAllocator ma(&oa);
+//..
+// Then, we allocate a block from the managed allocator, and observe that it is
+// obtained from the upstream allocator:
+//..
+        void *p = ma.allocate(16);
+        ASSERT(1 == oa.numBlocksInUse());
+//..
+// Next, we deallocate the block, and observe that the deallocation is counted,
+// but that the block has not been returned upstream:
+//..
+        ma.deallocate(p);
+        ASSERT(1 == ma.numDeallocations());
+        ASSERT(1 == oa.numBlocksInUse());
+//..
+// Finally, we release the managed allocator, and observe that all of its
+// memory is returned to the upstream allocator:
+//..
+        ma.release();
+        ASSERT(0 == oa.numBlocksInUse());
+//..
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ALLOCATE, DEALLOCATE, AND RELEASE
+        //
+        // Concerns:
+        //: 1 An object created without an allocator obtains memory from the
+        //:   currently installed default allocator.
+        //:
+        //: 2 'allocate' returns a maximally aligned block of at least the
+        //:   requested size that is obtained from the upstream allocator.
+        //:
+        //: 3 'deallocate' increments 'numDeallocations' and does not return
+        //:   memory to the upstream allocator.
+        //:
+        //: 4 'release' returns all dispensed blocks to the upstream allocator,
+        //:   does not reset 'numDeallocations', and leaves the object usable.
+        //:
+        //: 5 The destructor returns all dispensed blocks to the upstream
+        //:   allocator.
+        //:
+        //: 6 The object is a 'bslma::ManagedAllocator'.
+        //
+        // Plan:
+        //: 1 Install a test allocator as the default, create an object without
+        //:   an allocator, and verify that an allocation is obtained from the
+        //:   default allocator.  (C-1)
+        //:
+        //: 2 Allocate a number of blocks of varying size, writing to every
+        //:   byte, and verify the alignment of each block and the number of
+        //:   blocks in use by the upstream allocator.  (C-2)
+        //:
+        //: 3 Deallocate each block, and verify that 'numDeallocations' is
+        //:   incremented and the upstream usage is unchanged.  (C-3)
+        //:
+        //: 4 Call 'release', verify that no upstream memory is in use and that
+        //:   'numDeallocations' is unchanged, then allocate again.  (C-4)
+        //:
+        //: 5 Let an object holding blocks go out of scope, and verify that no
+        //:   upstream memory is in use.  (C-5)
+        //:
+        //: 6 Verify that 'bslma::ManagedAllocatorUtil::isManaged' is 'true'
+        //:   for the object.  (C-6)
+        //
+        // Testing:
+        //   explicit ManagedTestAllocator(bslma::Allocator *basicAllocator);
+        //   virtual ~ManagedTestAllocator();
+        //   virtual void *allocate(size_type size);
+        //   virtual void deallocate(void *address);
+        //   virtual void release();
+        //   int numDeallocations() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nALLOCATE, DEALLOCATE, AND RELEASE"
+                            "\n=================================\n");
+
+        if (verbose) printf("\tDefault allocator.\n");
+        {
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Obj mX;
+            mX.allocate(1);
+            ASSERTV(da.numBlocksInUse(), 1 == da.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tAllocate, deallocate, and release.\n");
+        {
+            const int NUM_BLOCKS = 8;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+
+                ASSERT(bslma::ManagedAllocatorUtil::isManaged(&mX));
+                ASSERT(0 == X.numDeallocations());
+
+                void *blocks[NUM_BLOCKS];
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    const int SIZE = 1 << i;
+
+                    blocks[i] = mX.allocate(SIZE);
+
+                    const bsls::Types::UintPtr ADDRESS =
+                                reinterpret_cast<bsls::Types::UintPtr>(
+                                                                    blocks[i]);
+                    ASSERTV(i, 0 ==
+                            ADDRESS % bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+                    ASSERTV(i, i + 1 == oa.numBlocksInUse());
+
+                    memset(blocks[i], 0xa5, SIZE);
+                }
+
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    mX.deallocate(blocks[i]);
+
+                    ASSERTV(i, i + 1 == X.numDeallocations());
+                    ASSERTV(i, NUM_BLOCKS == oa.numBlocksInUse());
+                }
+
+                mX.release();
+
+                ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+                ASSERTV(X.numDeallocations(),
+                        NUM_BLOCKS == X.numDeallocations());
+
+                mX.allocate(1);
+                mX.allocate(2);
+                ASSERTV(oa.numBlocksInUse(), 2 == oa.numBlocksInUse());
+            }
+
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform an ad-hoc test of the primary manipulators and accessors.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            void *p = mX.allocate(4);
+            ASSERT(p);
+            ASSERT(1 == oa.numBlocksInUse());
+
+            mX.deallocate(p);
+            ASSERT(1 == X.numDeallocations());
+            ASSERT(1 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -130,6 +130,14 @@ BSLS_IDENT("$Id: $")
 #include <bslma_allocator.h>
 #endif
 
+#ifndef INCLUDED_BSLS_ALIGNMENTFROMTYPE
+#include <bsls_alignmentfromtype.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ASSERT
 #include <bsls_assert.h>
 #endif
@@ -276,12 +284,15 @@ class StdTestAllocator {
     pointer allocate(size_type numElements);
         // Allocate enough (properly aligned) space for the specified
         // 'numElements' of type 'T'.  The behavior is undefined unless
-        // 'numElements <= max_size()'.
+        // 'numElements <= max_size()'.  Note that the memory for a type
+        // requiring more than the maximal alignment of the platform is
+        // obtained using 'allocateAligned' on the delegate allocator.
 
     void deallocate(pointer address, size_type numElements = 1);
         // Return memory previously at the specified 'address' for
         // 'numElements' back to this allocator.  The 'numElements' argument is
-        // ignored by this allocator type.  The behavior is undefined unless
+        // ignored by this allocator type unless 'TYPE' requires more than the
+        // maximal alignment of the platform.  The behavior is undefined unless
         // 'address' was allocated using this allocator object and has not
         // already been deallocated.
 
@@ -449,16 +460,38 @@ typename StdTestAllocator<TYPE>::pointer
 StdTestAllocator<TYPE>::allocate(typename StdTestAllocator<TYPE>::size_type
                                                                    numElements)
 {
-    return
-      static_cast<pointer>(StdTestAllocatorConfiguration::delegateAllocator()->
-            allocate(bslma::Allocator::size_type(numElements * sizeof(TYPE))));
+    static const int k_ALIGNMENT = bsls::AlignmentFromType<TYPE>::VALUE;
+
+    const bslma::Allocator::size_type size =
+                      bslma::Allocator::size_type(numElements * sizeof(TYPE));
+
+    bslma::Allocator *allocator =
+                            StdTestAllocatorConfiguration::delegateAllocator();
+
+    void *address = k_ALIGNMENT > bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
+                  ? allocator->allocateAligned(size, k_ALIGNMENT)
+                  : allocator->allocate(size);
+
+    return static_cast<pointer>(address);
 }
 
 template <class TYPE>
 inline
-void StdTestAllocator<TYPE>::deallocate(pointer address, size_type)
+void StdTestAllocator<TYPE>::deallocate(pointer address, size_type numElements)
 {
-    StdTestAllocatorConfiguration::delegateAllocator()->deallocate(address);
+    static const int k_ALIGNMENT = bsls::AlignmentFromType<TYPE>::VALUE;
+
+    bslma::Allocator *allocator =
+                            StdTestAllocatorConfiguration::delegateAllocator();
+
+    if (k_ALIGNMENT > bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT) {
+        allocator->deallocateAligned(
+                       address,
+                       bslma::Allocator::size_type(numElements * sizeof(TYPE)),
+                       k_ALIGNMENT);
+        return;                                                       // RETURN
+    }
+    allocator->deallocate(address);
 }
 
 template <class TYPE>
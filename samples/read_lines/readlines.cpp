@@ -2,15 +2,12 @@
 #include <bsl_string.h>
 #include <bsl_vector.h>
 
-#include <bufferallocator.h>
+#include <bslma_localarena.h>
 
 void readLines(bsl::istream& inputStream)
 {
-    const int BUFFER_SIZE = 1024;
-    char      buffer[BUFFER_SIZE];
-
-    BufferAllocator          allocator(buffer, BUFFER_SIZE);
-    bsl::vector<bsl::string> lines(&allocator);
+    BloombergLP::bslma::LocalArena<1024> allocator;
+    bsl::vector<bsl::string>             lines(&allocator);
 
     while (inputStream) {
         bsl::string input(&allocator);